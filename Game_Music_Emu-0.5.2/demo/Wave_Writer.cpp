@@ -2,8 +2,15 @@
 
 #include "Wave_Writer.h"
 
+#include "gme/blargg_thread.h"
+#include "gme/blargg_endian.h"
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined (__linux__)
+	#include <fcntl.h>
+#endif
 
 /* Copyright (C) 2003-2006 by Shay Green. Permission is hereby granted, free
 of charge, to any person obtaining a copy of this software and associated
@@ -28,12 +35,27 @@ static void exit_with_error( const char* str )
 	exit( EXIT_FAILURE );
 }
 
+// Background writer. Holds one full buffer while caller fills the other.
+struct Wave_Writer::async_t {
+	blargg_mutex mutex;
+	blargg_cond cond;
+	blargg_thread thread;
+	unsigned char* buf;
+	long size;
+	bool busy;
+	bool quit;
+	bool error;
+};
+
 Wave_Writer::Wave_Writer( long sample_rate, const char* filename )
 {
 	sample_count_ = 0;
+	expected_count = -1;
 	rate = sample_rate;
 	buf_pos = header_size;
 	chan_count = 1;
+	sample_size = sizeof (sample_t);
+	async = 0;
 	
 	buf = (unsigned char*) malloc( buf_size * sizeof *buf );
 	if ( !buf )
@@ -43,16 +65,85 @@ Wave_Writer::Wave_Writer( long sample_rate, const char* filename )
 	if ( !file )
 		exit_with_error( "Couldn't open WAVE file for writing" );
 	
-	setvbuf( file, 0, _IOFBF, 32 * 1024L );
+	// writes are already in large blocks, so stdio buffering would only add a copy
+	setvbuf( file, 0, _IONBF, 0 );
+}
+
+void Wave_Writer::enable_async()
+{
+	if ( async )
+		return;
+	
+	async = new async_t;
+	if ( !async || !(async->buf = (unsigned char*) malloc( buf_size * sizeof *buf )) )
+		exit_with_error( "Out of memory" );
+	async->size  = 0;
+	async->busy  = false;
+	async->quit  = false;
+	async->error = false;
+	if ( async->thread.start( async_func, this ) )
+		exit_with_error( "Couldn't start writer thread" );
+}
+
+void Wave_Writer::async_func( void* self )
+{
+	Wave_Writer& ww = *(Wave_Writer*) self;
+	async_t& a = *ww.async;
+	a.mutex.lock();
+	for ( ;; )
+	{
+		while ( !a.busy && !a.quit )
+			a.cond.wait( a.mutex );
+		if ( !a.busy )
+			break;
+		
+		a.mutex.unlock();
+		bool ok = fwrite( a.buf, a.size, 1, ww.file ) == 1;
+		a.mutex.lock();
+		
+		if ( !ok )
+			a.error = true;
+		a.busy = false;
+		a.cond.broadcast();
+	}
+	a.mutex.unlock();
 }
 
 void Wave_Writer::flush()
 {
-	if ( buf_pos && !fwrite( buf, buf_pos, 1, file ) )
+	if ( async )
+	{
+		async_t& a = *async;
+		blargg_lock lock( a.mutex );
+		while ( a.busy )
+			a.cond.wait( a.mutex );
+		if ( a.error )
+			exit_with_error( "Couldn't write WAVE data" );
+		
+		if ( buf_pos )
+		{
+			unsigned char* full = buf;
+			buf = a.buf;
+			a.buf = full;
+			a.size = buf_pos;
+			a.busy = true;
+			a.cond.broadcast();
+		}
+	}
+	else if ( buf_pos && !fwrite( buf, buf_pos, 1, file ) )
+	{
 		exit_with_error( "Couldn't write WAVE data" );
+	}
 	buf_pos = 0;
 }
 
+static inline void write_float( unsigned char* p, float f )
+{
+	union { float f; blargg_ulong n; } u;
+	u.f = f;
+	set_le32( p, u.n );
+}
+
 void Wave_Writer::write( const sample_t* in, long remain, int skip )
 {
 	sample_count_ += remain;
@@ -61,19 +152,41 @@ void Wave_Writer::write( const sample_t* in, long remain, int skip )
 		if ( buf_pos >= buf_size )
 			flush();
 		
-		long n = (buf_size - buf_pos) / sizeof (sample_t);
+		long n = (buf_size - buf_pos) / sample_size;
 		if ( n > remain )
 			n = remain;
 		remain -= n;
 		
-		// convert to lsb first format
 		unsigned char* p = &buf [buf_pos];
-		while ( n-- )
+	#if BLARGG_LITTLE_ENDIAN
+		if ( skip == 1 && sample_size == sizeof *in )
 		{
-			int s = *in;
-			in += skip;
-			*p++ = (unsigned char) s;
-			*p++ = (unsigned char) (s >> 8);
+			// already in file format
+			memcpy( p, in, n * sizeof *in );
+			in += n;
+			p  += n * sizeof *in;
+		}
+		else
+	#endif
+		if ( sample_size == sizeof *in )
+		{
+			// convert to lsb first format
+			while ( n-- )
+			{
+				int s = *in;
+				in += skip;
+				*p++ = (unsigned char) s;
+				*p++ = (unsigned char) (s >> 8);
+			}
+		}
+		else
+		{
+			while ( n-- )
+			{
+				write_float( p, *in * (1.0f / 0x8000) );
+				in += skip;
+				p += sizeof (float);
+			}
 		}
 		
 		buf_pos = p - buf;
@@ -81,7 +194,6 @@ void Wave_Writer::write( const sample_t* in, long remain, int skip )
 	}
 }
 
-
 void Wave_Writer::write( const float* in, long remain, int skip )
 {
 	sample_count_ += remain;
@@ -90,21 +202,45 @@ void Wave_Writer::write( const float* in, long remain, int skip )
 		if ( buf_pos >= buf_size )
 			flush();
 		
-		long n = (buf_size - buf_pos) / sizeof (sample_t);
+		long n = (buf_size - buf_pos) / sample_size;
 		if ( n > remain )
 			n = remain;
 		remain -= n;
 		
-		// convert to lsb first format
 		unsigned char* p = &buf [buf_pos];
-		while ( n-- )
+		if ( sample_size == sizeof *in )
 		{
-			long s = (long) (*in * 0x7FFF);
-			in += skip;
-			if ( (short) s != s )
-				s = 0x7FFF - (s >> 24); // clamp to 16 bits
-			*p++ = (unsigned char) s;
-			*p++ = (unsigned char) (s >> 8);
+		#if BLARGG_LITTLE_ENDIAN
+			if ( skip == 1 )
+			{
+				// already in file format
+				memcpy( p, in, n * sizeof *in );
+				in += n;
+				p  += n * sizeof *in;
+			}
+			else
+		#endif
+			{
+				while ( n-- )
+				{
+					write_float( p, *in );
+					in += skip;
+					p += sizeof *in;
+				}
+			}
+		}
+		else
+		{
+			// convert to lsb first format
+			while ( n-- )
+			{
+				long s = (long) (*in * 0x7FFF);
+				in += skip;
+				if ( (short) s != s )
+					s = 0x7FFF - (s >> 24); // clamp to 16 bits
+				*p++ = (unsigned char) s;
+				*p++ = (unsigned char) (s >> 8);
+			}
 		}
 		
 		buf_pos = p - buf;
@@ -112,41 +248,88 @@ void Wave_Writer::write( const float* in, long remain, int skip )
 	}
 }
 
+void Wave_Writer::write_header( unsigned char* out, long sample_count ) const
+{
+	long ds = sample_count * sample_size;
+	int frame_size = chan_count * sample_size;
+	static unsigned char const header [header_size] =
+	{
+		'R','I','F','F',
+		0,0,0,0,            // length of rest of file
+		'W','A','V','E',
+		'f','m','t',' ',
+		0x10,0,0,0,         // size of fmt chunk
+		1,0,                // uncompressed format
+		1,0,                // channel count
+		0,0,0,0,            // sample rate
+		0,0,0,0,            // bytes per second
+		2,0,                // bytes per sample frame
+		16,0,               // bits per sample
+		'd','a','t','a',
+		0,0,0,0             // size of sample data
+		// ...              // sample data
+	};
+	memcpy( out, header, header_size );
+	set_le32( out + 0x04, header_size - 8 + ds );
+	if ( sample_size == sizeof (float) )
+		out [0x14] = 3;     // IEEE float format
+	out [0x16] = (unsigned char) chan_count;
+	set_le32( out + 0x18, rate );
+	set_le32( out + 0x1C, rate * frame_size );
+	out [0x20] = (unsigned char) frame_size;
+	out [0x22] = (unsigned char) (sample_size * 8);
+	set_le32( out + 0x28, ds );
+}
+
+void Wave_Writer::set_sample_count( long count )
+{
+	assert( sample_count_ == 0 && buf_pos == header_size );
+	expected_count = count;
+	write_header( buf, count );
+	
+	#if defined (__linux__)
+		// only a hint; file is written normally if this fails
+		posix_fallocate( fileno( file ), 0, header_size + count * sample_size );
+	#endif
+}
+
 void Wave_Writer::close()
 {
 	if ( file )
 	{
 		flush();
 		
-		// generate header
-		long ds = sample_count_ * sizeof (sample_t);
-		long rs = header_size - 8 + ds;
-		int frame_size = chan_count * sizeof (sample_t);
-		long bps = rate * frame_size;
-		unsigned char header [header_size] =
+		if ( async )
 		{
-			'R','I','F','F',
-			rs,rs>>8,           // length of rest of file
-			rs>>16,rs>>24,
-			'W','A','V','E',
-			'f','m','t',' ',
-			0x10,0,0,0,         // size of fmt chunk
-			1,0,                // uncompressed format
-			chan_count,0,       // channel count
-			rate,rate >> 8,     // sample rate
-			rate>>16,rate>>24,
-			bps,bps>>8,         // bytes per second
-			bps>>16,bps>>24,
-			frame_size,0,       // bytes per sample frame
-			16,0,               // bits per sample
-			'd','a','t','a',
-			ds,ds>>8,ds>>16,ds>>24// size of sample data
-			// ...              // sample data
-		};
+			{
+				blargg_lock lock( async->mutex );
+				while ( async->busy )
+					async->cond.wait( async->mutex );
+				async->quit = true;
+				async->cond.broadcast();
+			}
+			async->thread.join();
+			if ( async->error )
+				exit_with_error( "Couldn't write WAVE data" );
+			free( async->buf );
+			delete async;
+			async = 0;
+		}
 		
-		// write header
-		fseek( file, 0, SEEK_SET );
-		fwrite( header, sizeof header, 1, file );
+		if ( sample_count_ != expected_count )
+		{
+			#if defined (__linux__)
+				// drop any reserved space that wasn't used
+				if ( expected_count >= 0 && ftruncate( fileno( file ),
+						header_size + sample_count_ * sample_size ) )
+					exit_with_error( "Couldn't write WAVE data" );
+			#endif
+			
+			unsigned char header [header_size];
+			write_header( header, sample_count_ );
+			fseek( file, 0, SEEK_SET );
+			fwrite( header, sizeof header, 1, file );
+		}
 		
 		fclose( file );
 		file = 0;
@@ -34,6 +34,20 @@ public:
 	// Enable stereo output
 	void enable_stereo();
 	
+	// Write 32-bit floating-point samples rather than 16-bit. Float input is then
+	// copied without conversion. Must be called before first write().
+	void enable_float();
+	
+	// Hand full buffers to a background thread for writing, so that write() only
+	// copies into memory and rarely waits on the disk. Must be called before
+	// first write().
+	void enable_async();
+	
+	// Tell writer that exactly 'count' samples will be written. Writes final header
+	// up front and reserves file space, so close() doesn't need to go back and patch
+	// it. Call after enable_stereo() and enable_float(), before first write().
+	void set_sample_count( long count );
+	
 	// Append 'count' samples to file. Use every 'skip'th source sample; allows
 	// one channel of stereo sample pairs to be written by specifying a skip of 2.
 	void write( const sample_t*, long count, int skip = 1 );
@@ -53,19 +67,27 @@ public:
 	// Deprecated
 	void stereo( bool b ) { chan_count = b ? 2 : 1; }
 private:
-	enum { buf_size = 32768 * 2 };
+	enum { buf_size = 256 * 1024L }; // multiple of disk block size
+	struct async_t;
 	unsigned char* buf;
 	FILE*   file;
+	async_t* async;
 	long    sample_count_;
+	long    expected_count;
 	long    rate;
 	long    buf_pos;
 	int     chan_count;
+	int     sample_size;
 	
 	void flush();
+	void write_header( unsigned char* out, long sample_count ) const;
+	static void async_func( void* );
 };
 
 inline void Wave_Writer::enable_stereo() { chan_count = 2; }
 
+inline void Wave_Writer::enable_float() { sample_size = sizeof (float); }
+
 inline long Wave_Writer::sample_count() const { return sample_count_; }
 
 #endif
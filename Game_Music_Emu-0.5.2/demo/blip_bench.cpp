@@ -0,0 +1,74 @@
+// Times Blip_Synth::offset() at each quality level and prints a checksum of the
+// output. Build once normally and once with BLIP_BUFFER_NO_SIMD defined to
+// compare the vector and portable versions; the checksums should match.
+
+#include "gme/Blip_Buffer.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+long const clock_rate  = 3579545;
+long const sample_rate = 44100;
+int  const frame_len   = 100000; // clocks
+int  const frame_count = 2000;
+
+template<int quality>
+void bench( const char* name )
+{
+	Blip_Buffer buf;
+	if ( buf.set_sample_rate( sample_rate ) )
+	{
+		printf( "Out of memory\n" );
+		exit( EXIT_FAILURE );
+	}
+	buf.clock_rate( clock_rate );
+
+	Blip_Synth<quality,30> synth;
+	synth.volume( 0.5 );
+	synth.treble_eq( -8.0 );
+
+	unsigned long checksum = 0;
+	long offsets = 0;
+	unsigned rand = 1;
+	blip_sample_t out [4096];
+
+	clock_t start = clock();
+	for ( int n = 0; n < frame_count; n++ )
+	{
+		// random deltas at irregular times, as from a busy channel
+		for ( int t = 0; t < frame_len; t += rand >> 28 )
+		{
+			rand = rand * 1664525 + 1013904223;
+			synth.offset( t, (int) (rand >> 8 & 31) - 15, &buf );
+			offsets++;
+		}
+		buf.end_frame( frame_len );
+
+		while ( buf.samples_avail() )
+		{
+			long count = buf.read_samples( out, 4096 );
+			for ( long i = 0; i < count; i++ )
+				checksum = checksum * 31 + (unsigned short) out [i];
+		}
+	}
+	double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+	printf( "%-14s %8.1f M offsets/sec  checksum %08lX\n", name,
+			offsets / secs / 1e6, checksum & 0xFFFFFFFF );
+}
+
+int main()
+{
+	#if BLIP_BUFFER_SSE2
+		printf( "SSE2\n" );
+	#elif BLIP_BUFFER_NEON
+		printf( "NEON\n" );
+	#else
+		printf( "Portable\n" );
+	#endif
+	bench<blip_med_quality >( "med_quality"  );
+	bench<blip_good_quality>( "good_quality" );
+	bench<blip_high_quality>( "high_quality" );
+	return 0;
+}
@@ -0,0 +1,125 @@
+// Times the CPU core used by each music file given on the command line, and prints
+// how many emulated CPU instructions it runs per second of wall time, along with a
+// checksum of the sound that follows. Skipping mostly runs emulators without
+// generating sound, so the CPU and its memory accesses dominate. Playing is timed
+// too, since it shows how much of the total the CPU actually is. Compare checksums
+// after changing a CPU core; they should match.
+//
+// Counts come from gme_get_stats(), so the library must be built with GME_STATS
+// set to 1 (see blargg_config.h). Instructions per second is the instructions run
+// over the time spent running the CPU and sound chips (emulate_msec), so it only
+// reflects the core's speed for files that keep the CPU busy. Most music leaves
+// the CPU idle for much of each frame, so also print millions of instructions per
+// second of music, to show how busy each file keeps it.
+
+#include "gme/Music_Emu.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+long const sample_rate = 44100;
+int  const seconds     = 120; // of music to emulate for each file
+
+struct core_t
+{
+	gme_type_t type;
+	const char* cpu;
+};
+
+static core_t const cores [] = {
+	{ gme_nsf_type,  "6502"    },
+	{ gme_nsfe_type, "6502"    },
+	{ gme_sap_type,  "6502"    },
+	{ gme_hes_type,  "HuC6280" },
+	{ gme_gbs_type,  "GB Z80"  },
+	{ gme_kss_type,  "Z80"     },
+	{ gme_ay_type,   "Z80"     },
+	{ gme_spc_type,  "SPC-700" },
+};
+
+static void handle_error( const char* str )
+{
+	if ( str )
+	{
+		printf( "Error: %s\n", str );
+		exit( EXIT_FAILURE );
+	}
+}
+
+static Music_Emu* open_emu( const char* path, gme_type_t type )
+{
+	Music_Emu* emu = type->new_emu();
+	if ( !emu )
+		handle_error( "Out of memory" );
+	handle_error( emu->set_sample_rate( sample_rate ) );
+	handle_error( emu->load_file( path ) );
+	emu->ignore_silence();
+	handle_error( emu->start_track( 0 ) );
+	emu->clear_stats();
+	return emu;
+}
+
+// Millions of instructions per second of emulation time
+static double mips( Music_Emu::stats_t const& s )
+{
+	if ( s.cpu_instructions <= 0 )
+		handle_error( "No instructions counted; build library with GME_STATS set to 1" );
+	double msec = (s.emulate_msec > 0 ? s.emulate_msec : 1e-3);
+	return s.cpu_instructions / msec / 1000;
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc < 2 )
+	{
+		printf( "Usage: cpu_bench file...\n" );
+		return EXIT_FAILURE;
+	}
+
+	printf( "%-8s %10s %10s %10s  %-8s\n", "CPU", "skip MIPS", "play MIPS",
+			"M/music s", "checksum" );
+	for ( int i = 1; i < argc; i++ )
+	{
+		gme_type_t type;
+		handle_error( gme_identify_file( argv [i], &type ) );
+		core_t const* core = 0;
+		for ( unsigned n = 0; n < sizeof cores / sizeof cores [0]; n++ )
+			if ( cores [n].type == type )
+				core = &cores [n];
+		if ( !core )
+		{
+			printf( "%s: no CPU core\n", argv [i] );
+			continue;
+		}
+
+		long const count = seconds * sample_rate * 2;
+
+		Music_Emu* emu = open_emu( argv [i], type );
+		handle_error( emu->skip( count ) );
+		Music_Emu::stats_t skip_stats;
+		emu->get_stats( &skip_stats );
+
+		// checksum of sound after skipping, to catch differences in emulation
+		unsigned long checksum = 0;
+		short buf [1024];
+		handle_error( emu->play( 1024, buf ) );
+		for ( int n = 0; n < 1024; n++ )
+			checksum = checksum * 31 + (unsigned short) buf [n];
+		delete emu;
+
+		emu = open_emu( argv [i], type );
+		for ( long n = 0; n < count; n += 1024 )
+			handle_error( emu->play( 1024, buf ) );
+		Music_Emu::stats_t play_stats;
+		emu->get_stats( &play_stats );
+		delete emu;
+
+		double per_sec = play_stats.cpu_instructions / seconds / 1e6;
+
+		printf( "%-8s %10.1f %10.1f %10.2f  %08lX  %s\n", core->cpu,
+				mips( skip_stats ), mips( play_stats ), per_sec,
+				checksum & 0xFFFFFFFF, argv [i] );
+	}
+
+	return 0;
+}
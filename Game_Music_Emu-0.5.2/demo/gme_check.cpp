@@ -0,0 +1,232 @@
+// Checks each music file given on the command line, and prints any problems found.
+// Build without NDEBUG, so that memory allocated while playing asserts (see
+// BLARGG_ALLOC_HOOK in blargg_common.h). Exits with failure if any check fails.
+
+#include "gme/Music_Emu.h"
+#include "gme/Effects_Buffer.h"
+#include "gme/Hes_Emu.h"
+#include "gme/Sap_Emu.h"
+#include "gme/Vgm_Emu.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+long const sample_rate = 44100;
+
+static int failures;
+
+static bool handle_error( const char* path, const char* str )
+{
+	if ( str )
+	{
+		printf( "%s: Error: %s\n", path, str );
+		failures++;
+	}
+	return str != 0;
+}
+
+static gme_type_t identify( const char* path )
+{
+	gme_type_t type = 0;
+	if ( !handle_error( path, gme_identify_file( path, &type ) ) && !type )
+		handle_error( path, "Unsupported music type" );
+	return type;
+}
+
+// Opens file in emu, or in a new emulator of its type if emu is NULL
+static Music_Emu* open_emu( const char* path, Music_Emu* emu = 0 )
+{
+	if ( !emu )
+	{
+		gme_type_t type = identify( path );
+		if ( !type )
+			return 0;
+		emu = type->new_emu();
+	}
+	if ( !emu )
+	{
+		handle_error( path, "Out of memory" );
+		return 0;
+	}
+	if ( handle_error( path, emu->set_sample_rate( sample_rate ) ) ||
+			handle_error( path, emu->load_file( path ) ) )
+	{
+		delete emu;
+		return 0;
+	}
+	emu->ignore_silence();
+	return emu;
+}
+
+// Starting each track and probing its length mustn't allocate
+static void check_start_and_probe( const char* path )
+{
+	Music_Emu* emu = open_emu( path );
+	if ( !emu )
+		return;
+	for ( int track = 0; track < emu->track_count() && track < 4; track++ )
+	{
+		short buf [1024];
+		if ( handle_error( path, emu->start_track( track ) ) ||
+				handle_error( path, emu->play( 1024, buf ) ) ||
+				handle_error( path, emu->skip( sample_rate * 2 ) ) )
+			break;
+
+		gme_length_t len;
+		if ( handle_error( path, emu->probe_length( track, 60 * 1000L, &len ) ) )
+			break;
+	}
+	delete emu;
+}
+
+// Emulators that pass each sound write on immediately rather than journaling it
+// (see journal_write() in Classic_Emu.h)
+class Direct_Hes_Emu : public Hes_Emu {
+protected:
+	blargg_err_t load_( Data_Reader& in )
+	{
+		blargg_err_t err = Hes_Emu::load_( in );
+		return err ? err : resize_journal( 0 );
+	}
+};
+
+class Direct_Sap_Emu : public Sap_Emu {
+protected:
+	blargg_err_t load_mem_( byte const* in, long size )
+	{
+		blargg_err_t err = Sap_Emu::load_mem_( in, size );
+		return err ? err : resize_journal( 0 );
+	}
+};
+
+int  const block_size  = 1024;
+long const block_count = 10 * sample_rate * 2 / block_size; // about 10 seconds
+
+// Plays beginning of track 0 into out, muting a voice for part of it
+static bool play_track( const char* path, Music_Emu* emu, short* out )
+{
+	if ( handle_error( path, emu->start_track( 0 ) ) )
+		return false;
+	for ( long n = 0; n < block_count; n++ )
+	{
+		if ( n == block_count / 4 )
+			emu->mute_voice( 0, true );
+		if ( n == block_count / 2 )
+			emu->mute_voice( 0, false );
+		if ( handle_error( path, emu->play( block_size, out + n * block_size ) ) )
+			return false;
+	}
+	return true;
+}
+
+// Journaled sound writes must give the same output as direct ones, with any
+// stereo depth and when muting
+static void check_journal( const char* path )
+{
+	gme_type_t type = identify( path );
+	if ( type != gme_hes_type && type != gme_sap_type )
+		return;
+	
+	long const count = block_count * block_size;
+	short* expected = (short*) malloc( count * sizeof *expected );
+	short* actual   = (short*) malloc( count * sizeof *actual );
+	static double const depths [] = { 0, 0.6, 1.0 };
+	for ( int i = 0; i < 3 && expected && actual; i++ )
+	{
+		// buffers must outlive emulators
+		Effects_Buffer direct_buf;
+		Effects_Buffer buf;
+		Music_Emu* direct = (type == gme_hes_type ? (Music_Emu*) new Direct_Hes_Emu :
+				(Music_Emu*) new Direct_Sap_Emu);
+		Music_Emu* emu = type->new_emu();
+		if ( direct && emu )
+		{
+			direct->set_buffer( &direct_buf );
+			emu->set_buffer( &buf );
+			direct = open_emu( path, direct );
+			emu    = open_emu( path, emu );
+		}
+		direct_buf.set_depth( depths [i] );
+		buf.set_depth( depths [i] );
+		if ( direct && emu &&
+				play_track( path, direct, expected ) &&
+				play_track( path, emu, actual ) &&
+				memcmp( expected, actual, count * sizeof *actual ) )
+		{
+			printf( "%s: journaled output differs at stereo depth %.1f\n", path, depths [i] );
+			failures++;
+		}
+		delete emu;
+		delete direct;
+	}
+	free( actual );
+	free( expected );
+}
+
+// True if samples differ by more than rounding
+static bool differs( short const* expected, short const* actual, long count )
+{
+	for ( long i = 0; i < count; i++ )
+	{
+		if ( abs( expected [i] - actual [i] ) > 1 )
+			return true;
+	}
+	return false;
+}
+
+// Seeking must give the same output as playing up to that point, apart from rounding
+// left by the buffer's removal of DC. Sound chips keep running while muted, except
+// FM ones, and SPC has its own approximate skip.
+static void check_seek( const char* path )
+{
+	gme_type_t type = identify( path );
+	if ( !type || type == gme_spc_type || type == gme_gym_type )
+		return;
+	
+	long const seek_msec = 4000;
+	long const offset = seek_msec * sample_rate / 1000 * 2;
+	long const count  = block_count * block_size;
+	short* expected = (short*) malloc( (offset + count) * sizeof *expected );
+	short* actual   = (short*) malloc( count * sizeof *actual );
+	Music_Emu* emu = open_emu( path );
+	if ( emu && (type == gme_vgm_type || type == gme_vgz_type) &&
+			!((Vgm_Emu*) emu)->is_classic_emu() )
+	{
+		delete emu;
+		emu = 0;
+	}
+	if ( emu && expected && actual &&
+			!handle_error( path, emu->start_track( 0 ) ) &&
+			!handle_error( path, emu->play( offset + count, expected ) ) &&
+			!handle_error( path, emu->start_track( 0 ) ) &&
+			!handle_error( path, emu->seek( seek_msec ) ) &&
+			!handle_error( path, emu->play( count, actual ) ) &&
+			differs( expected + offset, actual, count ) )
+	{
+		printf( "%s: output after seek differs from playing through\n", path );
+		failures++;
+	}
+	delete emu;
+	free( actual );
+	free( expected );
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc < 2 )
+	{
+		printf( "Usage: gme_check file...\n" );
+		return EXIT_FAILURE;
+	}
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		check_start_and_probe( argv [i] );
+		check_journal( argv [i] );
+		check_seek( argv [i] );
+	}
+
+	printf( failures ? "%d failures\n" : "All checks passed\n", failures );
+	return failures ? EXIT_FAILURE : 0;
+}
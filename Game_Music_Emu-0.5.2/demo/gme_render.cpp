@@ -0,0 +1,219 @@
+// Renders every track of each music file given on the command line, using all
+// processors, and reports emulation speed. Optionally writes each track to a WAVE
+// file. With no output directory nothing is written, which makes it a benchmark of
+// the emulators alone.
+//
+// Usage: gme_render [-j threads] [-s seconds] [-r rate] [-o dir] file...
+//
+// Wildcards in file names are expanded by the shell. Speed is given as a multiple
+// of real time. A file's speed is per processor, from the time its tracks took on
+// their worker threads; the total line is from elapsed time, so it shows the
+// gain from running in parallel.
+
+#include "gme/gme.h"
+#include "gme/Gme_Batch.h"
+#include "gme/blargg_thread.h"
+
+#include "Wave_Writer.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined (_WIN32)
+	#include <time.h>
+#endif
+
+static long sample_rate   = 44100;
+static long length_msec   = 0; // 0 to use track info
+static int  thread_count  = 0; // 0 for one per processor
+static const char* out_dir = 0;
+
+struct file_t
+{
+	const char* path;
+	int track_count;
+	double audio_sec; // of sound rendered
+	double busy_sec;  // worker time spent rendering it
+	int error_count;
+};
+
+struct track_t
+{
+	file_t* file;
+	Wave_Writer* wave;
+	long sample_count;
+	double start;
+};
+
+static blargg_mutex totals_mutex;
+
+static void handle_error( const char* str )
+{
+	if ( str )
+	{
+		printf( "Error: %s\n", str );
+		exit( EXIT_FAILURE );
+	}
+}
+
+// Elapsed time in seconds, from an arbitrary starting point
+static double wall_time()
+{
+	#if defined (_WIN32)
+		LARGE_INTEGER freq, now;
+		QueryPerformanceFrequency( &freq );
+		QueryPerformanceCounter( &now );
+		return (double) now.QuadPart / freq.QuadPart;
+	#else
+		timespec now;
+		clock_gettime( CLOCK_MONOTONIC, &now );
+		return now.tv_sec + now.tv_nsec * 1e-9;
+	#endif
+}
+
+static const char* base_name( const char* path )
+{
+	const char* name = path;
+	for ( const char* p = path; *p; p++ )
+		if ( *p == '/' || *p == '\\' )
+			name = p + 1;
+	return name;
+}
+
+static gme_err_t output( void*, gme_batch_job_t const* job, short const* in, long count )
+{
+	track_t& t = *(track_t*) job->user_data;
+	if ( !t.sample_count )
+	{
+		// first block; time from here rather than from when the job began, so
+		// the first block isn't counted
+		t.start = wall_time();
+		if ( out_dir )
+		{
+			char path [1024];
+			sprintf( path, "%.700s/%.200s-%02d.wav", out_dir, base_name( t.file->path ),
+					job->track + 1 );
+			t.wave = new Wave_Writer( sample_rate, path );
+			if ( !t.wave )
+				return "Out of memory";
+			t.wave->enable_stereo();
+		}
+	}
+	if ( t.wave )
+		t.wave->write( in, count );
+	t.sample_count += count;
+	return 0;
+}
+
+static void done( void*, gme_batch_job_t const* job, gme_err_t err )
+{
+	track_t& t = *(track_t*) job->user_data;
+	double elapsed = t.sample_count ? wall_time() - t.start : 0;
+	delete t.wave;
+	t.wave = 0;
+
+	blargg_lock lock( totals_mutex );
+	file_t& f = *t.file;
+	f.audio_sec += (double) t.sample_count / (sample_rate * 2);
+	f.busy_sec  += elapsed;
+	if ( err )
+	{
+		f.error_count++;
+		printf( "%s track %d: %s\n", f.path, job->track + 1, err );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	int arg = 1;
+	for ( ; arg < argc && argv [arg] [0] == '-'; arg++ )
+	{
+		char opt = argv [arg] [1];
+		if ( !argv [arg + 1] || !strchr( "jsro", opt ) || argv [arg] [2] )
+		{
+			arg = argc;
+			break;
+		}
+		const char* value = argv [++arg];
+		switch ( opt )
+		{
+			case 'j': thread_count = atoi( value ); break;
+			case 's': length_msec  = atol( value ) * 1000; break;
+			case 'r': sample_rate  = atol( value ); break;
+			case 'o': out_dir      = value; break;
+		}
+	}
+	if ( arg >= argc )
+	{
+		printf( "Usage: gme_render [-j threads] [-s seconds] [-r rate] [-o dir] file...\n" );
+		return EXIT_FAILURE;
+	}
+
+	// Make one job per track
+	int file_count = argc - arg;
+	file_t* files = (file_t*) calloc( file_count, sizeof *files );
+	if ( !files )
+		handle_error( "Out of memory" );
+	int job_count = 0;
+	for ( int i = 0; i < file_count; i++ )
+	{
+		file_t& f = files [i];
+		f.path = argv [arg + i];
+		Music_Emu* emu;
+		gme_err_t err = gme_open_file( f.path, &emu, gme_info_only );
+		if ( err )
+		{
+			printf( "%s: %s\n", f.path, err );
+			continue;
+		}
+		f.track_count = gme_track_count( emu );
+		gme_delete( emu );
+		job_count += f.track_count;
+	}
+
+	gme_batch_job_t* jobs = (gme_batch_job_t*) calloc( job_count + 1, sizeof *jobs );
+	track_t* tracks = (track_t*) calloc( job_count + 1, sizeof *tracks );
+	if ( !jobs || !tracks )
+		handle_error( "Out of memory" );
+	int n = 0;
+	for ( int i = 0; i < file_count; i++ )
+	{
+		for ( int t = 0; t < files [i].track_count; t++, n++ )
+		{
+			tracks [n].file      = &files [i];
+			jobs [n].path        = files [i].path;
+			jobs [n].track       = t;
+			jobs [n].length_msec = length_msec;
+			jobs [n].user_data   = &tracks [n];
+		}
+	}
+
+	double start = wall_time();
+	handle_error( gme_render_batch( jobs, job_count, sample_rate, thread_count,
+			output, done, 0 ) );
+	double elapsed = wall_time() - start;
+
+	double audio_sec = 0;
+	double busy_sec  = 0;
+	for ( int i = 0; i < file_count; i++ )
+	{
+		file_t const& f = files [i];
+		if ( !f.track_count )
+			continue;
+		audio_sec += f.audio_sec;
+		busy_sec  += f.busy_sec;
+		printf( "%7.1fx %3d tracks %6.0f sec %s%s\n",
+				f.busy_sec > 0 ? f.audio_sec / f.busy_sec : 0.0, f.track_count,
+				f.audio_sec, f.path, f.error_count ? " (errors)" : "" );
+	}
+
+	if ( elapsed <= 0 ) elapsed = 1e-6;
+	if ( busy_sec <= 0 ) busy_sec = 1e-6;
+	printf( "%7.1fx total, %.1fx per thread; %d tracks, %.0f sec of sound in %.2f sec\n",
+			audio_sec / elapsed, audio_sec / busy_sec, job_count, audio_sec, elapsed );
+
+	free( tracks );
+	free( jobs );
+	free( files );
+	return 0;
+}
@@ -89,6 +89,7 @@ Ay_Apu::Ay_Apu()
 		}
 	}
 	
+	inaudible_period = 0;
 	output( 0 );
 	volume( 1.0 );
 	reset();
@@ -117,6 +118,25 @@ void Ay_Apu::reset()
 	write_data_( 13, 0 );
 }
 
+void Ay_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		osc_t& osc = oscs [i];
+		BLARGG_COPY( osc.period );
+		BLARGG_COPY( osc.delay );
+		BLARGG_COPY( osc.last_amp );
+		BLARGG_COPY( osc.phase );
+	}
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( latch );
+	BLARGG_COPY( regs );
+	BLARGG_COPY( noise );
+	BLARGG_COPY( env.delay );
+	BLARGG_COPY( env.wave ); // points into env.modes
+	BLARGG_COPY( env.pos );
+}
+
 void Ay_Apu::write_data_( int addr, int data )
 {
 	assert( (unsigned) addr < reg_count );
@@ -181,7 +201,17 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 	if ( !env.delay )
 		env.delay = env_period;
 	
-	// run each osc separately
+	// inaudible period depends on clock rate of output, so the last one is kept
+	// for when no osc has output
+	for ( int i = osc_count; i--; )
+	{
+		if ( oscs [i].output )
+			inaudible_period = (blargg_ulong) (oscs [i].output->clock_rate() +
+					inaudible_freq) / (inaudible_freq * 2);
+	}
+	
+	// run each osc separately, even without output, so that tone and noise are
+	// the same once output returns
 	for ( int index = 0; index < osc_count; index++ )
 	{
 		osc_t* const osc = &oscs [index];
@@ -189,14 +219,11 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 		
 		// output
 		Blip_Buffer* const osc_output = osc->output;
-		if ( !osc_output )
-			continue;
-		osc_output->set_modified();
+		if ( osc_output )
+			osc_output->set_modified();
 		
 		// period
 		int half_vol = 0;
-		blip_time_t inaudible_period = (blargg_ulong) (osc_output->clock_rate() +
-				inaudible_freq) / (inaudible_freq * 2);
 		if ( osc->period <= inaudible_period && !(osc_mode & tone_off) )
 		{
 			half_vol = 1; // Actually around 60%, but 50% is close enough
@@ -253,6 +280,13 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 			//  dprintf( "Used noise period 0\n" );
 		}
 		
+		if ( !osc_output && (osc_mode & (tone_off | noise_off)) == (tone_off | noise_off) )
+		{
+			// tone phase was maintained above, and there is nothing else to run
+			osc->delay = time - final_end_time;
+			continue;
+		}
+		
 		// The following efficiently handles several cases (least demanding first):
 		// * Tone, noise, and envelope disabled, where channel acts as 4-bit DAC
 		// * Just tone or just noise, envelope disabled
@@ -261,15 +295,54 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 		// * Tone and noise together
 		// * Tone and noise together with envelope
 		
+		// Envelope alone as waveform (tone and noise disabled) is common and can
+		// have a very short period, so it's stepped directly, keeping parallel
+		// resampled time to eliminate time conversion in the loop.
+		if ( (osc_mode & (tone_off | noise_off)) == (tone_off | noise_off) &&
+				end_time < final_end_time )
+		{
+			int last_amp = osc->last_amp;
+			int delta = volume - last_amp;
+			if ( delta )
+			{
+				last_amp = volume;
+				synth_.offset( start_time, delta, osc_output );
+			}
+			
+			blip_resampled_time_t const resampled_period =
+					osc_output->resampled_duration( env_period );
+			blip_resampled_time_t resampled_time = osc_output->resampled_time( end_time );
+			do
+			{
+				if ( ++osc_env_pos >= 0 )
+					osc_env_pos -= 32;
+				int amp = env.wave [osc_env_pos] >> half_vol;
+				delta = amp - last_amp;
+				if ( delta )
+				{
+					last_amp = amp;
+					synth_.offset_resampled( resampled_time, delta, osc_output );
+				}
+				resampled_time += resampled_period;
+				end_time += env_period;
+			}
+			while ( end_time < final_end_time );
+			
+			osc->last_amp = last_amp;
+			osc->delay = time - final_end_time;
+			continue;
+		}
+		
 		// This loop only runs one iteration if envelope is disabled. If envelope
-		// is being used as a waveform (tone and noise disabled), this loop will
-		// still be reasonably efficient since the bulk of it will be skipped.
+		// is being used as a waveform with tone or noise, this loop will still
+		// be reasonably efficient since the bulk of it will be skipped.
 		while ( 1 )
 		{
 			// current amplitude
 			int amp = 0;
 			if ( (osc_mode | osc->phase) & 1 & (osc_mode >> 3 | noise_lfsr) )
 				amp = volume;
+			if ( osc_output )
 			{
 				int delta = amp - osc->last_amp;
 				if ( delta )
@@ -303,7 +376,8 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 							if ( changed & 2 )
 							{
 								delta = -delta;
-								synth_.offset( ntime, delta, osc_output );
+								if ( osc_output )
+									synth_.offset( ntime, delta, osc_output );
 							}
 							ntime += noise_period;
 						}
@@ -325,7 +399,8 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 						while ( time < end )
 						{
 							delta = -delta;
-							synth_.offset( time, delta, osc_output );
+							if ( osc_output )
+								synth_.offset( time, delta, osc_output );
 							time += period;
 							//phase ^= 1;
 						}
@@ -347,7 +422,8 @@ void Ay_Apu::run_until( blip_time_t final_end_time )
 				}
 				while ( time < end_time || ntime < end_time );
 				
-				osc->last_amp = (delta + volume) >> 1;
+				if ( osc_output )
+					osc->last_amp = (delta + volume) >> 1;
 				if ( !(osc_mode & tone_off) )
 					osc->phase = phase;
 			}
@@ -37,6 +37,10 @@ public:
 	// Set treble equalization (see documentation)
 	void treble_eq( blip_eq_t const& );
 	
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs and volume aren't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Ay_Apu();
 	typedef unsigned char byte;
@@ -50,6 +54,7 @@ private:
 		Blip_Buffer* output;
 	} oscs [osc_count];
 	blip_time_t last_time;
+	blip_time_t inaudible_period; // from clock rate of last output
 	byte latch;
 	byte regs [reg_count];
 	
@@ -59,6 +59,7 @@ int const C01 = 0x01;
 Ay_Cpu::Ay_Cpu()
 {
 	state = &state_;
+	instr_count_ = 0;
 	for ( int i = 0x100; --i >= 0; )
 	{
 		int even = 1;
@@ -85,6 +86,14 @@ void Ay_Cpu::reset( void* m )
 	memset( &r, 0, sizeof r );
 }
 
+void Ay_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( r );
+	BLARGG_COPY( state_ );
+	BLARGG_COPY( end_time_ );
+}
+
 #define TIME                        (s_time + s.base)
 #define READ_PROG( addr )           (mem [addr])
 #define INSTR( offset )             READ_PROG( pc + (offset) )
@@ -176,6 +185,10 @@ jp_not_taken:
 	pc += 2;
 loop:
 	
+	#if GME_STATS
+		instr_count_++;
+	#endif
+	
 	check( (unsigned long) pc < 0x10000 );
 	check( (unsigned long) sp < 0x10000 );
 	check( (unsigned) flags < 0x100 );
@@ -21,6 +21,9 @@ public:
 	// instruction was encountered at any point during run.
 	bool run( cpu_time_t end_time );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Time of beginning of next instruction
 	cpu_time_t time() const             { return state->time + state->base; }
 	
@@ -65,6 +68,10 @@ public:
 	// can read this far past end of memory
 	enum { cpu_padding = 0x100 };
 	
+	// Save/load registers and timing (see blargg_copy_func_t). Not supported
+	// during run() call. Memory isn't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Ay_Cpu();
 private:
@@ -77,6 +84,7 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	void set_end_time( cpu_time_t t );
 public:
 	registers_t r;
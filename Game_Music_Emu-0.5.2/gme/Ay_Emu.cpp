@@ -116,7 +116,8 @@ struct Ay_File : Gme_Info_
 static Music_Emu* new_ay_emu () { return BLARGG_NEW Ay_Emu ; }
 static Music_Emu* new_ay_file() { return BLARGG_NEW Ay_File; }
 
-gme_type_t_ const gme_ay_type [1] = { "ZX Spectrum", 0, &new_ay_emu, &new_ay_file, "AY", 1 };
+gme_type_t_ const gme_ay_type [1] = { "ZX Spectrum", 0, &new_ay_emu, &new_ay_file, "AY", 1,
+		gme_caps_fast_skip | gme_caps_float | gme_caps_state, spectrum_clock };
 
 // Setup
 
@@ -262,7 +263,7 @@ blargg_err_t Ay_Emu::start_track_( int track )
 	
 	// start at spectrum speed
 	change_clock_rate( spectrum_clock );
-	set_tempo( tempo() );
+	set_tempo_( tempo() ); // set_tempo() would clear seek index
 	
 	spectrum_mode = false;
 	cpc_mode      = false;
@@ -286,6 +287,7 @@ void Ay_Emu::cpu_out_misc( cpu_time_t time, unsigned addr, int data )
 		
 		case 0xBEFD:
 			spectrum_mode = true;
+			count_apu_write();
 			apu.write( time, apu_addr, data );
 			return;
 		}
@@ -303,6 +305,7 @@ void Ay_Emu::cpu_out_misc( cpu_time_t time, unsigned addr, int data )
 				goto enable_cpc;
 			
 			case 0x80:
+				count_apu_write();
 				apu.write( time, apu_addr, cpc_latch );
 				goto enable_cpc;
 			}
@@ -322,7 +325,7 @@ enable_cpc:
 	{
 		cpc_mode = true;
 		change_clock_rate( cpc_clock );
-		set_tempo( tempo() );
+		set_tempo_( tempo() );
 	}
 }
 
@@ -359,6 +362,28 @@ int ay_cpu_in( Ay_Cpu*, unsigned addr )
 	return 0xFF;
 }
 
+blargg_err_t Ay_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( next_play );
+	BLARGG_COPY( beeper_delta );
+	BLARGG_COPY( last_beeper );
+	BLARGG_COPY( apu_addr );
+	BLARGG_COPY( cpc_latch );
+	BLARGG_COPY( spectrum_mode );
+	BLARGG_COPY( cpc_mode );
+	BLARGG_COPY( mem.ram );
+	apu.copy_state( io, copy );
+	
+	if ( loading_state() )
+	{
+		change_clock_rate( cpc_mode ? cpc_clock : spectrum_clock );
+		set_tempo_( tempo() );
+	}
+	return 0;
+}
+
 blargg_err_t Ay_Emu::run_clocks( blip_time_t& duration, int )
 {
 	set_time( 0 );
@@ -2,6 +2,7 @@
 
 #include "Blip_Buffer.h"
 
+#include "blargg_tables.h"
 #include <assert.h>
 #include <limits.h>
 #include <string.h>
@@ -34,6 +35,7 @@ Blip_Buffer::Blip_Buffer()
 	sample_rate_  = 0;
 	reader_accum_ = 0;
 	bass_shift_   = 0;
+	synth_count_  = 0;
 	clock_rate_   = 0;
 	bass_freq_    = 16;
 	length_       = 0;
@@ -53,7 +55,7 @@ Blip_Buffer::Blip_Buffer()
 Blip_Buffer::~Blip_Buffer()
 {
 	if ( buffer_size_ != silent_buf_size )
-		free( buffer_ );
+		BLARGG_FREE( buffer_ );
 }
 
 Silent_Blip_Buffer::Silent_Blip_Buffer()
@@ -97,7 +99,8 @@ Blip_Buffer::blargg_err_t Blip_Buffer::set_sample_rate( long new_rate, int msec
 	
 	if ( buffer_size_ != new_size )
 	{
-		void* p = realloc( buffer_, (new_size + blip_buffer_extra_) * sizeof *buffer_ );
+		BLARGG_ALLOC_HOOK( (new_size + blip_buffer_extra_) * sizeof *buffer_ );
+		void* p = BLARGG_REALLOC( buffer_, (new_size + blip_buffer_extra_) * sizeof *buffer_ );
 		if ( !p )
 			return "Out of memory";
 		buffer_ = (buf_t_*) p;
@@ -120,6 +123,27 @@ Blip_Buffer::blargg_err_t Blip_Buffer::set_sample_rate( long new_rate, int msec
 	return 0; // success
 }
 
+Blip_Buffer::blargg_err_t Blip_Buffer::change_sample_rate( long new_rate )
+{
+	assert( !samples_avail() ); // samples must be read out first
+	
+	buf_t_ tail [blip_buffer_extra_];
+	memcpy( tail, buffer_, sizeof tail );
+	blip_resampled_time_t const offset = offset_;
+	blip_long const accum = reader_accum_;
+	int const modified = modified_;
+	
+	blargg_err_t err = set_sample_rate( new_rate, length_ );
+	if ( err )
+		return err;
+	
+	memcpy( buffer_, tail, sizeof tail );
+	offset_       = offset;
+	reader_accum_ = accum;
+	modified_     = modified;
+	return 0;
+}
+
 blip_resampled_time_t Blip_Buffer::clock_rate_factor( long rate ) const
 {
 	double ratio = (double) sample_rate_ / rate;
@@ -147,6 +171,13 @@ void Blip_Buffer::end_frame( blip_time_t t )
 	assert( samples_avail() <= (long) buffer_size_ ); // time outside buffer length
 }
 
+void Blip_Buffer::sync_to( Blip_Buffer const& other )
+{
+	clear();
+	offset_ = other.offset_;
+	assert( samples_avail() <= (long) buffer_size_ );
+}
+
 void Blip_Buffer::remove_silence( long count )
 {
 	assert( count <= samples_avail() ); // tried to remove more samples than available
@@ -187,6 +218,18 @@ void Blip_Buffer::remove_samples( long count )
 	}
 }
 
+// Only the used part of the buffer is nonzero, but the whole buffer is copied so
+// that the state is always the same size
+void Blip_Buffer::copy_state( unsigned char** io, blip_copy_func_t copy )
+{
+	if ( !buffer_ )
+		return;
+	copy( io, &offset_, sizeof offset_ );
+	copy( io, &reader_accum_, sizeof reader_accum_ );
+	copy( io, &modified_, sizeof modified_ );
+	copy( io, buffer_, (buffer_size_ + blip_buffer_extra_) * sizeof *buffer_ );
+}
+
 // Blip_Synth_
 
 Blip_Synth_Fast_::Blip_Synth_Fast_()
@@ -203,8 +246,9 @@ void Blip_Synth_Fast_::volume_unit( double new_unit )
 
 #if !BLIP_BUFFER_FAST
 
-Blip_Synth_::Blip_Synth_( short* p, int w ) :
+Blip_Synth_::Blip_Synth_( short* p, int w, short* k ) :
 	impulses( p ),
+	kernels( k ),
 	width( w )
 {
 	volume_unit_ = 0.0;
@@ -266,10 +310,9 @@ void blip_eq_t::generate( float* out, int count ) const
 		out [i] *= 0.54f - 0.46f * (float) cos( i * to_fraction );
 }
 
-void Blip_Synth_::adjust_impulse()
+static void correct_impulses( short* impulses, int size, long kernel_unit )
 {
 	// sum pairs for each phase and add error correction to end of first half
-	int const size = impulses_size();
 	for ( int p = blip_res; p-- >= blip_res / 2; )
 	{
 		int p2 = blip_res - 2 - p;
@@ -284,14 +327,62 @@ void Blip_Synth_::adjust_impulse()
 		impulses [size - blip_res + p] += (short) error;
 		//printf( "error: %ld\n", error );
 	}
+}
+
+void Blip_Synth_::adjust_impulse()
+{
+	correct_impulses( impulses, impulses_size(), kernel_unit );
+	update_kernels();
 	
 	//for ( int i = blip_res; i--; printf( "\n" ) )
 	//  for ( int j = 0; j < width / 2; j++ )
 	//      printf( "%5ld,", impulses [j * blip_res + i + 1] );
 }
 
-void Blip_Synth_::treble_eq( blip_eq_t const& eq )
+// Rearranges impulses so each phase's kernel is contiguous, in the order
+// offset_resampled() adds it to the buffer
+void Blip_Synth_::update_kernels()
+{
+	if ( !kernels )
+		return;
+	
+	int const row  = blip_kernel_width_( width );
+	int const half = width / 2;
+	for ( int phase = 0; phase < blip_res; phase++ )
+	{
+		short* out = &kernels [phase * row];
+		short const* fwd = impulses + blip_res - phase;
+		short const* rev = impulses + phase;
+		for ( int i = 0; i < half; i++ )
+		{
+			out [i]             = fwd [blip_res * i];
+			out [width - 1 - i] = rev [blip_res * i];
+		}
+		for ( int i = width; i < row; i++ )
+			out [i] = 0;
+	}
+}
+
+// Impulses depend only on eq and width, so are shared by all synths with the
+// same settings. Each synth copies them, since volume can require rescaling.
+struct blip_impulses_key_t
 {
+	double treble;
+	long rolloff_freq;
+	long sample_rate;
+	long cutoff_freq;
+	long width;
+};
+
+double const blip_base_unit = 32768.0; // necessary for blip_unscaled to work
+
+void Blip_Synth_::build_impulses( void* table, void const* key_, void const* )
+{
+	blip_impulses_key_t const& key = *(blip_impulses_key_t const*) key_;
+	blip_eq_t const eq( key.treble, key.rolloff_freq, key.sample_rate, key.cutoff_freq );
+	int const width = (int) key.width;
+	short* const impulses = (short*) table;
+	
 	float fimpulse [blip_res / 2 * (blip_widest_impulse_ - 1) + blip_res * 2];
 	
 	int const half_size = blip_res / 2 * (width - 1);
@@ -314,21 +405,41 @@ void Blip_Synth_::treble_eq( blip_eq_t const& eq )
 	
 	//double const base_unit = 44800.0 - 128 * 18; // allows treble up to +0 dB
 	//double const base_unit = 37888.0; // allows treble to +5 dB
-	double const base_unit = 32768.0; // necessary for blip_unscaled to work
+	double const base_unit = blip_base_unit;
 	double rescale = base_unit / 2 / total;
-	kernel_unit = (long) base_unit;
 	
 	// integrate, first difference, rescale, convert to int
 	double sum = 0.0;
 	double next = 0.0;
-	int const impulses_size = this->impulses_size();
+	int const impulses_size = blip_res / 2 * width + 1;
 	for ( i = 0; i < impulses_size; i++ )
 	{
 		impulses [i] = (short) floor( (next - sum) * rescale + 0.5 );
 		sum += fimpulse [i];
 		next += fimpulse [i + blip_res];
 	}
-	adjust_impulse();
+	correct_impulses( impulses, impulses_size, (long) base_unit );
+}
+
+void Blip_Synth_::treble_eq( blip_eq_t const& eq )
+{
+	blip_impulses_key_t key;
+	memset( &key, 0, sizeof key );
+	key.treble       = eq.treble;
+	key.rolloff_freq = eq.rolloff_freq;
+	key.sample_rate  = eq.sample_rate;
+	key.cutoff_freq  = eq.cutoff_freq;
+	key.width        = width;
+	
+	long const size = impulses_size() * (long) sizeof *impulses;
+	void const* shared = blargg_shared_table( "Blip_Synth", &key, sizeof key, size, build_impulses );
+	if ( shared )
+		memcpy( impulses, shared, size );
+	else
+		build_impulses( impulses, &key, 0 ); // out of memory, so build our own
+	
+	kernel_unit = (long) blip_base_unit;
+	update_kernels();
 	
 	// volume might require rescaling
 	double vol = volume_unit_;
@@ -422,6 +533,30 @@ long Blip_Buffer::read_samples( blip_sample_t* BLIP_RESTRICT out, long max_sampl
 	return count;
 }
 
+long Blip_Buffer::read_samples( float* BLIP_RESTRICT out, long max_samples, int stereo )
+{
+	long count = samples_avail();
+	if ( count > max_samples )
+		count = max_samples;
+	
+	if ( count )
+	{
+		int const step = stereo ? 2 : 1;
+		int const bass = BLIP_READER_BASS( *this );
+		BLIP_READER_BEGIN( reader, *this );
+		for ( blip_long n = count; n; --n )
+		{
+			*out = BLIP_READER_READ_RAW( reader ) * blip_float_scale;
+			out += step;
+			BLIP_READER_NEXT( reader, bass );
+		}
+		BLIP_READER_END( reader, *this );
+		
+		remove_samples( count );
+	}
+	return count;
+}
+
 void Blip_Buffer::mix_samples( blip_sample_t const* in, long count )
 {
 	if ( buffer_size_ == silent_buf_size )
@@ -21,6 +21,10 @@ typedef blip_long blip_time_t;
 typedef short blip_sample_t;
 enum { blip_sample_max = 32767 };
 
+// State copying function (see blargg_copy_func_t in blargg_common.h)
+#include <stddef.h>
+typedef void (*blip_copy_func_t)( unsigned char** io, void* state, size_t size );
+
 class Blip_Buffer {
 public:
 	typedef const char* blargg_err_t;
@@ -44,6 +48,10 @@ public:
 	// easy interleving of two channels into a stereo output buffer.
 	long read_samples( blip_sample_t* dest, long max_samples, int stereo = 0 );
 	
+	// Same as above, but writes floating-point samples, where 1.0 corresponds to
+	// 32768. Samples aren't clamped, and keep the buffer's full internal resolution.
+	long read_samples( float* dest, long max_samples, int stereo = 0 );
+	
 // Additional optional features
 
 	// Current output sample rate
@@ -84,6 +92,27 @@ public:
 	// Mix 'count' samples from 'buf' into buffer.
 	void mix_samples( blip_sample_t const* buf, long count );
 	
+	// Number of amplitude changes added by Blip_Synths, if GME_STATS is set. Wraps
+	// around.
+	blip_ulong synth_count() const { return synth_count_; }
+	
+	// Clear buffer and give it the same number of samples available as 'other',
+	// as silence, so the two can be read together. Sample and clock rates must
+	// already match.
+	void sync_to( Blip_Buffer const& other );
+	
+	// Save/restore samples waiting to be read and the ends of waveform changes not
+	// yet read out (see blargg_copy_func_t). Sample rate, clock rate and length
+	// must be the same when restoring.
+	void copy_state( unsigned char** io, blip_copy_func_t );
+	
+	// Change output sample rate, keeping the same length, without clearing buffer.
+	// All samples must have been read out. The current level and the ends of any
+	// waveform changes not yet read out are kept, so the waveform continues at the
+	// new rate without a click. Returns error if there isn't enough memory,
+	// without affecting current buffer setup.
+	blargg_err_t change_sample_rate( long samples_per_sec );
+	
 	// not documented yet
 	void set_modified() { modified_ = 1; }
 	int clear_modified() { int b = modified_; modified_ = 0; return b; }
@@ -112,6 +141,7 @@ public:
 	blip_long buffer_size_;
 	blip_long reader_accum_;
 	int bass_shift_;
+	blip_ulong synth_count_;
 private:
 	long sample_rate_;
 	long clock_rate_;
@@ -142,6 +172,23 @@ private:
 	#endif
 #endif
 
+// BLIP_BUFFER_SSE2/BLIP_BUFFER_NEON: Set to 1 if vector code can be used. Both
+// instruction sets are always present on x86-64 and ARM64 processors, so no
+// run-time check is needed. Define BLIP_BUFFER_NO_SIMD to use portable code only.
+#ifndef BLIP_BUFFER_NO_SIMD
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define BLIP_BUFFER_SSE2 1
+	#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+		#define BLIP_BUFFER_NEON 1
+	#endif
+#endif
+
+#if BLIP_BUFFER_SSE2
+	#include <emmintrin.h>
+#elif BLIP_BUFFER_NEON
+	#include <arm_neon.h>
+#endif
+
 	// Internal
 	typedef blip_ulong blip_resampled_time_t;
 	int const blip_widest_impulse_ = 16;
@@ -149,6 +196,13 @@ private:
 	int const blip_res = 1 << BLIP_PHASE_BITS;
 	class blip_eq_t;
 	
+	// Kernel of each phase stored contiguously for vector code, padded to a
+	// multiple of 8 taps
+	#if (BLIP_BUFFER_SSE2 || BLIP_BUFFER_NEON) && !BLIP_BUFFER_FAST
+		#define BLIP_SYNTH_KERNELS 1
+	#endif
+	inline int blip_kernel_width_( int quality ) { return (quality + 7) & ~7; }
+	
 	class Blip_Synth_Fast_ {
 	public:
 		Blip_Buffer* buf;
@@ -167,15 +221,18 @@ private:
 		int delta_factor;
 		
 		void volume_unit( double );
-		Blip_Synth_( short* impulses, int width );
+		Blip_Synth_( short* impulses, int width, short* kernels = 0 );
 		void treble_eq( blip_eq_t const& );
 	private:
 		double volume_unit_;
 		short* const impulses;
+		short* const kernels;
 		int const width;
 		blip_long kernel_unit;
 		int impulses_size() const { return blip_res / 2 * width + 1; }
 		void adjust_impulse();
+		void update_kernels();
+		static void build_impulses( void*, void const*, void const* );
 	};
 
 // Quality level. Start with blip_good_quality.
@@ -202,6 +259,12 @@ public:
 	// Update amplitude of waveform at given time. Using this requires a separate
 	// Blip_Synth for each waveform.
 	void update( blip_time_t time, int amplitude );
+	
+	// Save/restore amplitude last set with update() (see Blip_Buffer::copy_state())
+	void copy_state( unsigned char** io, blip_copy_func_t copy )
+	{
+		copy( io, &impl.last_amp, sizeof impl.last_amp );
+	}
 
 // Low-level interface
 
@@ -229,8 +292,15 @@ private:
 	Blip_Synth_ impl;
 	typedef short imp_t;
 	imp_t impulses [blip_res * (quality / 2) + 1];
-public:
-	Blip_Synth() : impl( impulses, quality ) { }
+	#if BLIP_SYNTH_KERNELS
+		enum { kernel_width = (quality + 7) & ~7 };
+		imp_t kernels [blip_res] [kernel_width];
+	public:
+		Blip_Synth() : impl( impulses, quality, kernels [0] ) { }
+	#else
+	public:
+		Blip_Synth() : impl( impulses, quality ) { }
+	#endif
 #endif
 };
 
@@ -255,6 +325,9 @@ private:
 
 int const blip_sample_bits = 30;
 
+// Multiplier that converts internal samples to floating-point ones
+float const blip_float_scale = 1.0f / (1L << (blip_sample_bits - 1));
+
 // Dummy Blip_Buffer to direct sound output to, for easy muting without
 // having to stop sound code.
 class Silent_Blip_Buffer : public Blip_Buffer {
@@ -341,6 +414,9 @@ inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_time_t t
 	// Fails if time is beyond end of Blip_Buffer, due to a bug in caller code or the
 	// need for a longer buffer as set by set_sample_rate().
 	assert( (blip_long) (time >> BLIP_BUFFER_ACCURACY) < blip_buf->buffer_size_ );
+	#if GME_STATS
+		blip_buf->synth_count_++;
+	#endif
 	delta *= impl.delta_factor;
 	blip_long* BLIP_RESTRICT buf = blip_buf->buffer_ + (time >> BLIP_BUFFER_ACCURACY);
 	int phase = (int) (time >> (BLIP_BUFFER_ACCURACY - BLIP_PHASE_BITS) & (blip_res - 1));
@@ -363,6 +439,39 @@ inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_time_t t
 	int const rev = fwd + quality - 2;
 	int const mid = quality / 2 - 1;
 	
+	#if BLIP_SYNTH_KERNELS
+	// Multiply 16-bit taps by delta eight at a time and widen the products to
+	// 32 bits. Deltas that don't fit in 16 bits use the scalar code below.
+	if ( (short) delta == delta )
+	{
+		imp_t const* BLIP_RESTRICT k = kernels [phase];
+		buf += fwd;
+		#if BLIP_BUFFER_SSE2
+			__m128i const d = _mm_set1_epi16( (short) delta );
+			for ( int i = 0; i < kernel_width; i += 8 )
+			{
+				__m128i taps = _mm_loadu_si128( (__m128i const*) (k + i) );
+				__m128i lo = _mm_mullo_epi16( taps, d );
+				__m128i hi = _mm_mulhi_epi16( taps, d );
+				__m128i* out = (__m128i*) (buf + i);
+				_mm_storeu_si128( out    , _mm_add_epi32( _mm_loadu_si128( out     ),
+						_mm_unpacklo_epi16( lo, hi ) ) );
+				_mm_storeu_si128( out + 1, _mm_add_epi32( _mm_loadu_si128( out + 1 ),
+						_mm_unpackhi_epi16( lo, hi ) ) );
+			}
+		#else
+			int16x4_t const d = vdup_n_s16( (short) delta );
+			for ( int i = 0; i < kernel_width; i += 8 )
+			{
+				int16x8_t taps = vld1q_s16( k + i );
+				vst1q_s32( buf + i    , vmlal_s16( vld1q_s32( buf + i     ), vget_low_s16 ( taps ), d ) );
+				vst1q_s32( buf + i + 4, vmlal_s16( vld1q_s32( buf + i + 4 ), vget_high_s16( taps ), d ) );
+			}
+		#endif
+		return;
+	}
+	#endif
+	
 	imp_t const* BLIP_RESTRICT imp = impulses + blip_res - phase;
 	
 	#if defined (_M_IX86) || defined (_M_IA64) || defined (__i486__) || \
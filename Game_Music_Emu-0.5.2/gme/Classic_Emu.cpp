@@ -3,6 +3,7 @@
 #include "Classic_Emu.h"
 
 #include "Multi_Buffer.h"
+#include "Multitrack_Buffer.h"
 #include <string.h>
 
 /* Copyright (C) 2003-2006 Shay Green. This module is free software; you
@@ -23,6 +24,13 @@ Classic_Emu::Classic_Emu()
 	buf           = 0;
 	stereo_buffer = 0;
 	voice_types   = 0;
+	audio_off     = false;
+	buf_time_     = 0;
+	journal_count = 0;
+	last_instr_count = 0;
+	last_synth_count = 0;
+	carry_pos     = 0;
+	carry_remain  = 0;
 	
 	// avoid inconsistency in our duplicated constants
 	assert( (int) wave_type  == (int) Multi_Buffer::wave_type );
@@ -51,15 +59,94 @@ blargg_err_t Classic_Emu::set_sample_rate_( long rate )
 			CHECK_ALLOC( stereo_buffer = BLARGG_NEW Stereo_Buffer );
 		buf = stereo_buffer;
 	}
-	return buf->set_sample_rate( rate, 1000 / 20 );
+	return buf->set_sample_rate( rate, minimal_buffers() ? minimal_buffer_length : 1000 / 20 );
+}
+
+// Buffer can only change rate once emptied, so samples still in it are read out,
+// converted to the new rate, and played before those generated at it. A
+// multitrack buffer's are dropped.
+blargg_err_t Classic_Emu::change_sample_rate_( long rate )
+{
+	long const avail = buf->samples_avail();
+	if ( buf == (Multi_Buffer*) multitrack_buffer() )
+	{
+		buf->remove_samples( avail );
+	}
+	else if ( avail || carry_remain )
+	{
+		if ( carry_pos )
+		{
+			memmove( carry.begin(), &carry [carry_pos], carry_remain * sizeof carry [0] );
+			carry_pos = 0;
+		}
+		RETURN_ERR( carry.resize( carry_remain + avail ) );
+		carry_remain += buf->read_samples( &carry [carry_remain], avail );
+		RETURN_ERR( convert_carry( rate ) );
+	}
+	return buf->change_sample_rate( rate );
+}
+
+// Linearly interpolates carried samples from current sample rate to new one, so
+// they keep their pitch and duration
+blargg_err_t Classic_Emu::convert_carry( long rate )
+{
+	int const chans = buf->samples_per_frame();
+	long const in_frames  = carry_remain / chans;
+	long const out_frames = (long) ((double) in_frames * rate / sample_rate());
+	if ( in_frames < 2 || out_frames < 1 )
+	{
+		carry_remain = 0;
+		return 0;
+	}
+	
+	blargg_vector<sample_t> out;
+	RETURN_ERR( out.resize( out_frames * chans ) );
+	double const step = (double) (in_frames - 1) / out_frames;
+	for ( long i = 0; i < out_frames; i++ )
+	{
+		double pos = i * step;
+		long n = (long) pos;
+		int frac = (int) ((pos - n) * 0x8000);
+		sample_t const* in = &carry [n * chans];
+		for ( int c = 0; c < chans; c++ )
+			out [i * chans + c] = (sample_t) (in [c] + ((in [c + chans] - in [c]) * frac >> 15));
+	}
+	
+	RETURN_ERR( carry.resize( out.size() ) );
+	memcpy( carry.begin(), out.begin(), out.size() * sizeof out [0] );
+	carry_remain = out.size();
+	return 0;
+}
+
+long Classic_Emu::read_carry( sample_t* out, long count )
+{
+	count = min( count, carry_remain );
+	memcpy( out, &carry [carry_pos], count * sizeof *out );
+	carry_pos    += count;
+	carry_remain -= count;
+	return count;
+}
+
+long Classic_Emu::read_carry( float* out, long count )
+{
+	count = min( count, carry_remain );
+	for ( long i = 0; i < count; i++ )
+		out [i] = carry [carry_pos + i] * (1.0f / 0x8000);
+	carry_pos    += count;
+	carry_remain -= count;
+	return count;
 }
 
 void Classic_Emu::mute_voices_( int mask )
 {
+	// journaled writes, such as ones made by a track's init routine, must reach the
+	// sound chip while it still has the outputs they were made with
+	flush_journal();
+	
 	Music_Emu::mute_voices_( mask );
 	for ( int i = voice_count(); i--; )
 	{
-		if ( mask & (1 << i) )
+		if ( (mask & (1 << i)) || audio_off )
 		{
 			set_voice( i, 0, 0, 0 );
 		}
@@ -79,6 +166,8 @@ void Classic_Emu::change_clock_rate( long rate )
 	buf->clock_rate( rate );
 }
 
+int Classic_Emu::buffer_length() const { return buf->length(); }
+
 blargg_err_t Classic_Emu::setup_buffer( long rate )
 {
 	change_clock_rate( rate );
@@ -92,32 +181,189 @@ blargg_err_t Classic_Emu::start_track_( int track )
 {
 	RETURN_ERR( Music_Emu::start_track_( track ) );
 	buf->clear();
+	buf_time_ = 0;
+	carry_remain = 0;
+	journal_count = 0; // writes from previous track are dropped
+	memset( probe_regs, 0, sizeof probe_regs );
+	return 0;
+}
+
+// Copies sound buffer, for cores to call before copying their own state. Samples
+// kept from before a sample rate change aren't included, so they're lost when
+// loading.
+blargg_err_t Classic_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( !journal_count && !audio_off ); // only called between frames
+	BLARGG_COPY( buf_time_ );
+	BLARGG_COPY( probe_regs );
+	buf->copy_state( io, copy );
+	if ( loading_state() )
+		carry_remain = 0;
+	return 0;
+}
+
+blargg_err_t Classic_Emu::resize_journal( int max_writes )
+{
+	journal_count = 0;
+	return journal.resize( max_writes );
+}
+
+void Classic_Emu::flush_journal()
+{
+	int count = journal_count;
+	journal_count = 0;
+	if ( count )
+		replay_journal( journal.begin(), count );
+}
+
+void Classic_Emu::replay_journal( journal_entry_t const*, int ) { }
+
+void Classic_Emu::probe_frame( blip_time_t time, void const* ram, long ram_size,
+		void const* ram2, long ram2_size )
+{
+	probe_block_t blocks [3] = {
+		{ ram, ram_size },
+		{ ram2, ram2_size },
+		{ probe_regs, sizeof probe_regs }
+	};
+	blargg_long samples = buf_time_ +
+			(blargg_long) (time * (double) sample_rate() * buf->samples_per_frame() / clock_rate_);
+	Music_Emu::probe_frame( samples, blocks, 3 );
+}
+
+// Runs emulator for length of buffer
+blargg_err_t Classic_Emu::run_frame()
+{
+	if ( buf_changed_count != buf->channels_changed_count() )
+	{
+		buf_changed_count = buf->channels_changed_count();
+		remute_voices();
+	}
+	int msec = buf->length();
+	blip_time_t clocks_emulated = (blargg_long) msec * clock_rate_ / 1000;
+	long const avail = buf->samples_avail();
+	{
+		stats_timer_t timer( stats().emulate_msec );
+		RETURN_ERR( run_clocks( clocks_emulated, msec ) );
+		assert( clocks_emulated );
+		buf->end_frame( clocks_emulated );
+	}
+	buf_time_ += buf->samples_avail() - avail;
+	#if GME_STATS
+		update_stats();
+	#endif
 	return 0;
 }
 
+// Adds counts since last call, so counters in cores can wrap around
+void Classic_Emu::update_stats()
+{
+	blargg_ulong instr_count = cpu_instr_count();
+	stats().cpu_instructions += (blargg_ulong) (instr_count - last_instr_count);
+	last_instr_count = instr_count;
+	
+	blip_ulong synth_count = buf->synth_count();
+	stats().synth_updates += (blip_ulong) (synth_count - last_synth_count);
+	last_synth_count = synth_count;
+}
+
 blargg_err_t Classic_Emu::play_( long count, sample_t* out )
 {
 	long remain = count;
+	if ( carry_remain )
+		remain -= read_carry( out, remain );
 	while ( remain )
 	{
-		remain -= buf->read_samples( &out [count - remain], remain );
+		{
+			stats_timer_t timer( stats().mix_msec );
+			remain -= buf->read_samples( &out [count - remain], remain );
+		}
 		if ( remain )
+			RETURN_ERR( run_frame() );
+	}
+	return 0;
+}
+
+blargg_err_t Classic_Emu::play_float_( long count, float* out )
+{
+	long remain = count;
+	if ( carry_remain )
+		remain -= read_carry( out, remain );
+	while ( remain )
+	{
+		{
+			stats_timer_t timer( stats().mix_msec );
+			remain -= buf->read_samples( &out [count - remain], remain );
+		}
+		if ( remain )
+			RETURN_ERR( run_frame() );
+	}
+	return 0;
+}
+
+blargg_err_t Classic_Emu::play_multitrack_( long count, sample_t* const* out, long offset )
+{
+	Multitrack_Buffer* mt = multitrack_buffer();
+	if ( !mt || buf != mt )
+		return Music_Emu::play_multitrack_( count, out, offset );
+	
+	long remain = count;
+	while ( remain )
+	{
 		{
-			if ( buf_changed_count != buf->channels_changed_count() )
-			{
-				buf_changed_count = buf->channels_changed_count();
-				remute_voices();
-			}
-			int msec = buf->length();
-			blip_time_t clocks_emulated = (blargg_long) msec * clock_rate_ / 1000;
-			RETURN_ERR( run_clocks( clocks_emulated, msec ) );
-			assert( clocks_emulated );
-			buf->end_frame( clocks_emulated );
+			stats_timer_t timer( stats().mix_msec );
+			remain -= mt->read_voices( out, remain, offset + count - remain );
 		}
+		if ( remain )
+			RETURN_ERR( run_frame() );
 	}
 	return 0;
 }
 
+// Skips most of count with all voices disconnected from buffer, so cores only run
+// their CPU and sound registers, and output is removed from buffer without being
+// mixed. Plays the end normally so that sound has settled when skip finishes.
+blargg_err_t Classic_Emu::skip_( long count )
+{
+	long const settle = buf->length() * 2 * sample_rate() / 1000 * buf->samples_per_frame();
+	if ( carry_remain )
+	{
+		long n = min( count, carry_remain );
+		carry_pos    += n;
+		carry_remain -= n;
+		count -= n;
+	}
+	if ( count <= settle * 2 )
+		return Music_Emu::skip_( count );
+	
+	audio_off = true;
+	remute_voices();
+	
+	blargg_err_t err = 0;
+	long remain = count - settle;
+	while ( remain && !emu_track_ended() )
+	{
+		long n = buf->samples_avail();
+		if ( !n )
+		{
+			err = run_frame();
+			if ( err )
+				break;
+			continue;
+		}
+		if ( n > remain )
+			n = remain;
+		buf->remove_samples( n );
+		remain -= n;
+	}
+	
+	audio_off = false;
+	remute_voices();
+	RETURN_ERR( err );
+	
+	return Music_Emu::skip_( settle + remain );
+}
+
 // Rom_Data
 
 blargg_err_t Rom_Data_::load_rom_data_( Data_Reader& in,
@@ -125,9 +371,10 @@ blargg_err_t Rom_Data_::load_rom_data_( Data_Reader& in,
 {
 	long file_offset = pad_size - header_size;
 	
-	rom_addr = 0;
-	mask     = 0;
-	size_    = 0;
+	rom_addr    = 0;
+	mask        = 0;
+	size_       = 0;
+	mapped_size = 0;
 	rom.clear();
 	
 	file_size_ = in.remain();
@@ -172,8 +419,13 @@ void Rom_Data_::set_addr_( long addr, int unit )
 	if ( addr < 0 )
 		addr = 0;
 	size_ = rounded;
-	if ( rom.resize( rounded - rom_addr + pad_extra ) ) { } // OK if shrink fails
-
+	
+	// Padding added by load_rom_data_() already covers any rounding, so only the
+	// mapped size changes here and starting a track doesn't allocate
+	mapped_size = rounded - rom_addr + pad_extra;
+	if ( mapped_size > (blargg_long) rom.size() )
+		mapped_size = rom.size();
+	
 	if ( 0 )
 	{
 		dprintf( "addr: %X\n", addr );
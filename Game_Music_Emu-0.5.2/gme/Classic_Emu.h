@@ -21,25 +21,113 @@ protected:
 	long clock_rate() const { return clock_rate_; }
 	void change_clock_rate( long ); // experimental
 	
+	// Length of output buffer, in milliseconds
+	int buffer_length() const;
+	
+	// Length probing. Cores call probe_apu_write() for each sound register write, and
+	// probe_frame() when calling the play routine, with time in current frame and
+	// memory that determines what plays next. Register writes are included since
+	// sound chip state can't be compared directly.
+	void probe_apu_write( int addr, int data );
+	void probe_frame( blip_time_t, void const* ram, long ram_size,
+			void const* ram2 = 0, long ram2_size = 0 );
+	
+	// Statistics. probe_apu_write() counts sound register writes, and cores that
+	// don't call it call count_apu_write() for each one instead.
+	void count_apu_write();
+	
+	// Sound register write journal, for cores whose CPU can't read anything back
+	// from the sound chip. Rather than running the sound chip for each write, the
+	// core logs it with journal_write() and calls flush_journal() before ending the
+	// sound chip's time frame, which passes all writes in order to replay_journal().
+	// Writes are also flushed early if the journal fills, and before voice outputs
+	// change (see mute_voices_()). With resize_journal( 0 ), each write is passed on
+	// immediately, which must give the same output.
+	struct journal_entry_t
+	{
+		blip_time_t time;
+		unsigned short addr;
+		unsigned char data;
+	};
+	blargg_err_t resize_journal( int max_writes );
+	void journal_write( blip_time_t, int addr, int data );
+	void flush_journal();
+	
 	// Overridable
 	virtual void set_voice( int index, Blip_Buffer* center,
 			Blip_Buffer* left, Blip_Buffer* right ) = 0;
 	virtual void update_eq( blip_eq_t const& ) = 0;
 	virtual blargg_err_t start_track_( int track ) = 0;
 	virtual blargg_err_t run_clocks( blip_time_t& time_io, int msec ) = 0;
+	virtual void replay_journal( journal_entry_t const*, int count );
+	
+	// Number of instructions run by CPU so far, for statistics. Can wrap around.
+	virtual blargg_ulong cpu_instr_count() const { return 0; }
 protected:
 	blargg_err_t set_sample_rate_( long sample_rate );
+	blargg_err_t change_sample_rate_( long sample_rate );
 	void mute_voices_( int );
 	void set_equalizer_( equalizer_t const& );
 	blargg_err_t play_( long, sample_t* );
+	blargg_err_t play_float_( long, float* );
+	blargg_err_t skip_( long );
+	blargg_err_t play_multitrack_( long, sample_t* const*, long );
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
 private:
 	Multi_Buffer* buf;
 	Multi_Buffer* stereo_buffer; // NULL if using custom buffer
 	long clock_rate_;
 	unsigned buf_changed_count;
 	int const* voice_types;
+	bool audio_off; // all voices disconnected from buffer while skipping
+	blargg_long buf_time_; // samples generated since start_track_()
+	enum { probe_reg_count = 64 };
+	unsigned char probe_regs [probe_reg_count]; // last data written to each register
+	blargg_vector<journal_entry_t> journal;
+	int journal_count;
+	blargg_ulong last_instr_count; // counts when statistics were last updated
+	blip_ulong last_synth_count;
+	blargg_vector<sample_t> carry; // samples left in buf when sample rate was changed
+	long carry_pos;
+	long carry_remain;
+	long read_carry( sample_t*, long );
+	long read_carry( float*, long );
+	blargg_err_t convert_carry( long new_rate );
+	blargg_err_t run_frame();
+	void update_stats();
 };
 
+inline void Classic_Emu::count_apu_write()
+{
+	#if GME_STATS
+		stats().apu_writes++;
+	#endif
+}
+
+inline void Classic_Emu::probe_apu_write( int addr, int data )
+{
+	probe_regs [addr & (probe_reg_count - 1)] = data;
+	count_apu_write();
+}
+
+inline void Classic_Emu::journal_write( blip_time_t time, int addr, int data )
+{
+	if ( journal_count >= (int) journal.size() )
+	{
+		flush_journal();
+		if ( !journal.size() )
+		{
+			journal_entry_t const direct = { time, (unsigned short) addr, (unsigned char) data };
+			replay_journal( &direct, 1 );
+			return;
+		}
+	}
+	journal_entry_t& e = journal [journal_count++];
+	e.time = time;
+	e.addr = (unsigned short) addr;
+	e.data = (unsigned char) data;
+}
+
 inline void Classic_Emu::set_buffer( Multi_Buffer* new_buf )
 {
 	assert( !buf && new_buf );
@@ -60,6 +148,7 @@ protected:
 	blargg_long rom_addr;
 	blargg_long mask;
 	blargg_long size_; // TODO: eliminate
+	blargg_long mapped_size; // part of rom at_addr() maps, set by set_addr_()
 	
 	blargg_err_t load_rom_data_( Data_Reader& in, int header_size, void* header_out,
 			int fill, long pad_size );
@@ -108,7 +197,7 @@ public:
 	byte* at_addr( blargg_long addr )
 	{
 		blargg_ulong offset = mask_addr( addr ) - rom_addr;
-		if ( offset > blargg_ulong (rom.size() - pad_size) )
+		if ( offset > blargg_ulong (mapped_size - pad_size) )
 			offset = 0; // unmapped
 		return &rom [offset];
 	}
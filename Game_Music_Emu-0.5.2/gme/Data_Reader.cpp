@@ -7,6 +7,21 @@
 #include <string.h>
 #include <stdio.h>
 
+#ifndef BLARGG_MAPPED_FILES
+	#if defined (_WIN32) || defined (__unix__) || defined (__APPLE__)
+		#define BLARGG_MAPPED_FILES 1
+	#endif
+#endif
+
+#if BLARGG_MAPPED_FILES
+	#include "blargg_thread.h"
+	#if !defined (_WIN32)
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#include <fcntl.h>
+	#endif
+#endif
+
 /* Copyright (C) 2005-2006 Shay Green. This module is free software; you
 can redistribute it and/or modify it under the terms of the GNU Lesser
 General Public License as published by the Free Software Foundation; either
@@ -80,6 +95,15 @@ long Subset_Reader::read_avail( void* p, long s )
 	return in->read_avail( p, s );
 }
 
+// lets a File_Reader seek rather than read
+blargg_err_t Subset_Reader::skip( long count )
+{
+	if ( count > remain_ )
+		return eof_error;
+	remain_ -= count;
+	return in->skip( count );
+}
+
 // Remaining_Reader
 
 Remaining_Reader::Remaining_Reader( void const* h, long size, Data_Reader* r )
@@ -127,6 +151,15 @@ blargg_err_t Remaining_Reader::read( void* out, long count )
 	return in->read( (char*) out + first, second );
 }
 
+blargg_err_t Remaining_Reader::skip( long count )
+{
+	long first = header_end - header;
+	if ( first > count )
+		first = count;
+	header += first;
+	return in->skip( count - first );
+}
+
 // Mem_File_Reader
 
 Mem_File_Reader::Mem_File_Reader( const void* p, long s ) :
@@ -158,6 +191,194 @@ blargg_err_t Mem_File_Reader::seek( long n )
 	return 0;
 }
 
+// Mapped_File_Reader
+
+#if BLARGG_MAPPED_FILES
+
+struct Mapped_File_Reader::mapping_t
+{
+	char const* begin;
+	long size;
+	int refs;
+	blargg_mutex mutex;
+};
+
+static blargg_err_t map_file( const char* path, char const** begin_out, long* size_out )
+{
+#if defined (_WIN32)
+	HANDLE file = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, 0 );
+	if ( file == INVALID_HANDLE_VALUE )
+		return "Couldn't open file";
+	
+	DWORD high = 0;
+	DWORD size = GetFileSize( file, &high );
+	void* begin = 0;
+	if ( size && !high && size <= 0x7FFFFFFF )
+	{
+		// view keeps file mapped after handles are closed
+		HANDLE mapping = CreateFileMappingA( file, 0, PAGE_READONLY, 0, 0, 0 );
+		if ( mapping )
+		{
+			begin = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+			CloseHandle( mapping );
+		}
+	}
+	CloseHandle( file );
+	if ( size && !begin )
+		return "Couldn't map file into memory";
+#else
+	int fd = ::open( path, O_RDONLY );
+	if ( fd < 0 )
+		return "Couldn't open file";
+	
+	struct stat st;
+	long size = 0;
+	void* begin = 0;
+	if ( !fstat( fd, &st ) && st.st_size <= 0x7FFFFFFF )
+	{
+		size = (long) st.st_size;
+		if ( size )
+		{
+			begin = mmap( 0, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+			if ( begin == MAP_FAILED )
+				begin = 0;
+		}
+	}
+	close( fd );
+	if ( size && !begin )
+		return "Couldn't map file into memory";
+#endif
+	*begin_out = (char const*) begin;
+	*size_out  = (long) size;
+	return 0;
+}
+
+static void unmap_file( char const* begin, long size )
+{
+	if ( begin )
+	{
+	#if defined (_WIN32)
+		UnmapViewOfFile( begin );
+	#else
+		munmap( (void*) begin, size );
+	#endif
+	}
+}
+
+blargg_err_t Mapped_File_Reader::open( const char* path )
+{
+	close();
+	
+	char const* begin;
+	long size;
+	RETURN_ERR( map_file( path, &begin, &size ) );
+	
+	// compressed data can't be used directly
+	if ( size >= 2 && (unsigned char) begin [0] == 0x1F && (unsigned char) begin [1] == 0x8B )
+	{
+		unmap_file( begin, size );
+		return "Can't map gzipped file";
+	}
+	
+	map_ = BLARGG_NEW mapping_t;
+	if ( !map_ )
+	{
+		unmap_file( begin, size );
+		return "Out of memory";
+	}
+	map_->begin = begin;
+	map_->size  = size;
+	map_->refs  = 1;
+	return 0;
+}
+
+void Mapped_File_Reader::open( Mapped_File_Reader const& other )
+{
+	if ( other.map_ != map_ )
+	{
+		close();
+		if ( other.map_ )
+		{
+			blargg_lock lock( other.map_->mutex );
+			map_ = other.map_;
+			map_->refs++;
+		}
+	}
+	pos = 0;
+}
+
+void Mapped_File_Reader::close()
+{
+	if ( map_ )
+	{
+		int refs;
+		{
+			blargg_lock lock( map_->mutex );
+			refs = --map_->refs;
+		}
+		if ( !refs )
+		{
+			unmap_file( map_->begin, map_->size );
+			delete map_;
+		}
+		map_ = 0;
+	}
+	pos = 0;
+}
+
+void const* Mapped_File_Reader::data() const { return map_ ? map_->begin : 0; }
+
+long Mapped_File_Reader::size() const { return map_ ? map_->size : 0; }
+
+#else
+
+struct Mapped_File_Reader::mapping_t
+{
+	char const* begin;
+	long size;
+};
+
+blargg_err_t Mapped_File_Reader::open( const char* )
+{
+	close();
+	return "Memory-mapped files not supported";
+}
+
+void Mapped_File_Reader::open( Mapped_File_Reader const& ) { pos = 0; }
+
+void Mapped_File_Reader::close() { pos = 0; }
+
+void const* Mapped_File_Reader::data() const { return 0; }
+
+long Mapped_File_Reader::size() const { return 0; }
+
+#endif
+
+Mapped_File_Reader::Mapped_File_Reader() : map_( 0 ), pos( 0 ) { }
+
+Mapped_File_Reader::~Mapped_File_Reader() { close(); }
+
+long Mapped_File_Reader::read_avail( void* p, long s )
+{
+	long r = remain();
+	if ( s > r )
+		s = r;
+	memcpy( p, (char const*) data() + pos, s );
+	pos += s;
+	return s;
+}
+
+long Mapped_File_Reader::tell() const { return pos; }
+
+blargg_err_t Mapped_File_Reader::seek( long n )
+{
+	if ( n > size() )
+		return eof_error;
+	pos = n;
+	return 0;
+}
+
 // Callback_Reader
 
 Callback_Reader::Callback_Reader( callback_t c, long size, void* d ) :
@@ -312,4 +533,78 @@ void Gzip_File_Reader::close()
 	}
 }
 
+// Inflate_Reader
+
+int const inflate_buf_size = 4096;
+
+Inflate_Reader::Inflate_Reader() : stream_( 0 ) { }
+
+Inflate_Reader::~Inflate_Reader() { close(); }
+
+blargg_err_t Inflate_Reader::open( Data_Reader* in_, long in_size, long size, format_t format )
+{
+	close();
+	
+	RETURN_ERR( buf.resize( inflate_buf_size ) );
+	z_stream* z = (z_stream*) calloc( 1, sizeof (z_stream) );
+	CHECK_ALLOC( z );
+	
+	// negative window bits for raw deflate, plus 16 for gzip header and trailer
+	if ( inflateInit2( z, (format == gzip ? 16 + MAX_WBITS : -MAX_WBITS) ) != Z_OK )
+	{
+		free( z );
+		return "Couldn't initialize decompressor";
+	}
+	
+	stream_   = z;
+	in        = in_;
+	in_remain = in_size;
+	remain_   = size;
+	return 0;
+}
+
+long Inflate_Reader::remain() const { return remain_; }
+
+long Inflate_Reader::read_avail( void* p, long s )
+{
+	z_stream* z = (z_stream*) stream_;
+	if ( s > remain_ )
+		s = remain_;
+	
+	z->next_out  = (Bytef*) p;
+	z->avail_out = s;
+	while ( z->avail_out )
+	{
+		if ( !z->avail_in )
+		{
+			long n = min( in_remain, (long) buf.size() );
+			if ( n <= 0 || in->read( buf.begin(), n ) )
+				break;
+			in_remain -= n;
+			z->next_in  = (Bytef*) buf.begin();
+			z->avail_in = n;
+		}
+		
+		int err = inflate( z, Z_NO_FLUSH );
+		if ( err == Z_STREAM_END )
+			break;
+		if ( err != Z_OK )
+			return -1;
+	}
+	
+	s -= z->avail_out;
+	remain_ -= s;
+	return s;
+}
+
+void Inflate_Reader::close()
+{
+	if ( stream_ )
+	{
+		inflateEnd( (z_stream*) stream_ );
+		free( stream_ );
+		stream_ = 0;
+	}
+}
+
 #endif
@@ -84,6 +84,38 @@ private:
 	long pos;
 };
 
+// Disk file mapped into memory, so its data can be used without copying. Readers
+// opened from another reader share its mapping, which is released when the last
+// of them is closed.
+class Mapped_File_Reader : public File_Reader {
+public:
+	// Map file into memory. Fails for gzipped files and where mapping isn't
+	// supported (see BLARGG_MAPPED_FILES), in which case use another reader.
+	blargg_err_t open( const char* path );
+	
+	// Share mapping of another open reader, starting at beginning of file
+	void open( Mapped_File_Reader const& );
+	
+	void close();
+	
+	// Mapped data, valid until reader is closed
+	void const* data() const;
+	
+	bool is_open() const { return map_ != 0; }
+	
+public:
+	Mapped_File_Reader();
+	~Mapped_File_Reader();
+	long size() const;
+	long read_avail( void*, long );
+	long tell() const;
+	blargg_err_t seek( long );
+private:
+	struct mapping_t;
+	mapping_t* map_;
+	long pos;
+};
+
 // Makes it look like there are only count bytes remaining
 class Subset_Reader : public Data_Reader {
 public:
@@ -92,6 +124,7 @@ public:
 public:
 	long remain() const;
 	long read_avail( void*, long );
+	blargg_err_t skip( long );
 private:
 	Data_Reader* in;
 	long remain_;
@@ -106,6 +139,7 @@ public:
 	long remain() const;
 	long read_avail( void*, long );
 	blargg_err_t read( void*, long );
+	blargg_err_t skip( long );
 private:
 	char const* header;
 	char const* header_end;
@@ -146,6 +180,30 @@ private:
 	void* file_;
 	long size_;
 };
+
+// Decompresses deflated or gzipped data read from another reader, which must
+// remain open while in use. Size of decompressed data must be known in advance.
+class Inflate_Reader : public Data_Reader {
+public:
+	enum format_t { raw_deflate, gzip };
+	
+	// Decompress next in_size bytes of in, which give size bytes of data
+	blargg_err_t open( Data_Reader* in, long in_size, long size, format_t = raw_deflate );
+	
+	void close();
+	
+public:
+	Inflate_Reader();
+	~Inflate_Reader();
+	long remain() const;
+	long read_avail( void*, long );
+private:
+	Data_Reader* in;
+	long in_remain;
+	long remain_;
+	void* stream_;
+	blargg_vector<char> buf;
+};
 #endif
 
 #endif
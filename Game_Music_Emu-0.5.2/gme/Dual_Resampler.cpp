@@ -20,7 +20,7 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 
 unsigned const resampler_extra = 256;
 
-Dual_Resampler::Dual_Resampler() { }
+Dual_Resampler::Dual_Resampler() { resampler.set_width( 12 ); }
 
 Dual_Resampler::~Dual_Resampler() { }
 
@@ -49,6 +49,39 @@ void Dual_Resampler::resize( int pairs )
 	}
 }
 
+blargg_err_t Dual_Resampler::change_rate( int max_pairs, int pairs, double oversample )
+{
+	resampler.change_ratio( oversample );
+	
+	// move unplayed samples to beginning, so that resizing keeps them
+	int remain = sample_buf_size - buf_pos;
+	memmove( sample_buf.begin(), &sample_buf [buf_pos], remain * sizeof sample_buf [0] );
+	sample_buf_size = remain;
+	buf_pos = 0;
+	RETURN_ERR( sample_buf.resize( (max_pairs + (max_pairs >> 2)) * 2 ) );
+	
+	// then to end of new frame, where dual_play() expects them
+	int new_sample_buf_size = pairs * 2;
+	if ( remain > new_sample_buf_size )
+		remain = new_sample_buf_size;
+	memmove( &sample_buf [new_sample_buf_size - remain], sample_buf.begin(),
+			remain * sizeof sample_buf [0] );
+	sample_buf_size = new_sample_buf_size;
+	buf_pos = new_sample_buf_size - remain;
+	oversamples_per_frame = int (pairs * resampler.ratio()) * 2 + 2;
+	
+	int max_oversamples = int (max_pairs * resampler.ratio()) * 2 + 2;
+	resampler_size = max_oversamples + (max_oversamples >> 2);
+	return resampler.resize_buffer( resampler_size );
+}
+
+void Dual_Resampler::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( buf_pos );
+	copy( io, sample_buf.begin(), sample_buf.size() * sizeof sample_buf [0] );
+	resampler.copy_state( io, copy );
+}
+
 void Dual_Resampler::play_frame_( Blip_Buffer& blip_buf, dsample_t* out )
 {
 	long pair_count = sample_buf_size >> 1;
@@ -19,8 +19,18 @@ public:
 	void resize( int pairs_per_frame );
 	void clear();
 	
+	// Change output rate while playing. Arguments are as for reset(), resize() and
+	// setup(). Output not yet played and input not yet resampled are kept, and
+	// play at the new rate.
+	blargg_err_t change_rate( int max_pairs, int pairs_per_frame, double oversample );
+	void set_width( int points ) { resampler.set_width( points ); }
+	
 	void dual_play( long count, dsample_t* out, Blip_Buffer& );
 	
+	// Save/restore samples not yet played and input not yet resampled (see
+	// blargg_copy_func_t). The Blip_Buffer passed to dual_play() isn't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 protected:
 	virtual int play_frame( blip_time_t, int pcm_count, dsample_t* pcm_out ) = 0;
 private:
@@ -31,7 +41,7 @@ private:
 	int buf_pos;
 	int resampler_size;
 	
-	Fir_Resampler<12> resampler;
+	Fir_Resampler<32> resampler;
 	void mix_samples( Blip_Buffer&, dsample_t* );
 	void play_frame_( Blip_Buffer&, dsample_t* );
 };
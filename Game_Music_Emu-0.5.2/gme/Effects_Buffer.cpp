@@ -66,6 +66,9 @@ void Effects_Buffer::set_depth( double d )
 Effects_Buffer::Effects_Buffer( bool center_only ) : Multi_Buffer( 2 )
 {
 	buf_count = center_only ? max_buf_count - 4 : max_buf_count;
+	alloc_count = 0;
+	buf_msec = 0;
+	bass_freq_ = 16;
 	
 	echo_pos = 0;
 	reverb_pos = 0;
@@ -80,30 +83,73 @@ Effects_Buffer::~Effects_Buffer() { }
 
 blargg_err_t Effects_Buffer::set_sample_rate( long rate, int msec )
 {
-	if ( !echo_buf.size() )
+	buf_msec = msec;
+	alloc_count = 0;
+	RETURN_ERR( bufs [0].set_sample_rate( rate, msec ) );
+	alloc_count = 1;
+	RETURN_ERR( Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() ) );
+	RETURN_ERR( alloc_bufs( config_.effects_enabled ) );
+	
+	config( config_ );
+	clear();
+	
+	return 0;
+}
+
+// Echo and reverb keep what they hold, with delays converted to the new rate
+blargg_err_t Effects_Buffer::change_sample_rate( long rate )
+{
+	for ( int i = 0; i < alloc_count; i++ )
+		RETURN_ERR( bufs [i].change_sample_rate( rate ) );
+	RETURN_ERR( Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() ) );
+	config( config_ );
+	return 0;
+}
+
+// Allocates any buffers not yet allocated that the mixer uses with or without
+// effects. Without effects, only the first three buffers are used, or just one
+// when center_only.
+blargg_err_t Effects_Buffer::alloc_bufs( bool effects )
+{
+	if ( effects && !echo_buf.size() )
+	{
 		RETURN_ERR( echo_buf.resize( echo_size ) );
+		memset( &echo_buf [0], 0, echo_size * sizeof echo_buf [0] );
+	}
 	
-	if ( !reverb_buf.size() )
+	if ( effects && !reverb_buf.size() )
+	{
 		RETURN_ERR( reverb_buf.resize( reverb_size ) );
+		memset( &reverb_buf [0], 0, reverb_size * sizeof reverb_buf [0] );
+	}
 	
-	for ( int i = 0; i < buf_count; i++ )
-		RETURN_ERR( bufs [i].set_sample_rate( rate, msec ) );
+	int count = buf_count;
+	if ( !effects )
+		count = (buf_count < max_buf_count ? 1 : 3);
 	
-	config( config_ );
-	clear();
+	for ( ; alloc_count < count; alloc_count++ )
+	{
+		Blip_Buffer& buf = bufs [alloc_count];
+		RETURN_ERR( buf.set_sample_rate( sample_rate(), buf_msec ) );
+		if ( bufs [0].clock_rate() )
+			buf.clock_rate( bufs [0].clock_rate() );
+		buf.bass_freq( bass_freq_ );
+		buf.sync_to( bufs [0] );
+	}
 	
-	return Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() );
+	return 0;
 }
 
 void Effects_Buffer::clock_rate( long rate )
 {
-	for ( int i = 0; i < buf_count; i++ )
+	for ( int i = 0; i < alloc_count; i++ )
 		bufs [i].clock_rate( rate );
 }
 
 void Effects_Buffer::bass_freq( int freq )
 {
-	for ( int i = 0; i < buf_count; i++ )
+	bass_freq_ = freq;
+	for ( int i = 0; i < alloc_count; i++ )
 		bufs [i].bass_freq( freq );
 }
 
@@ -117,7 +163,7 @@ void Effects_Buffer::clear()
 	if ( reverb_buf.size() )
 		memset( &reverb_buf [0], 0, reverb_size * sizeof reverb_buf [0] );
 	
-	for ( int i = 0; i < buf_count; i++ )
+	for ( int i = 0; i < alloc_count; i++ )
 		bufs [i].clear();
 }
 
@@ -134,14 +180,19 @@ void Effects_Buffer::config( const config_t& cfg )
 {
 	channels_changed();
 	
+	bool effects = cfg.effects_enabled;
+	if ( effects && alloc_count < buf_count && alloc_count && alloc_bufs( true ) )
+		effects = false; // out of memory, so mix without effects
+	
 	// clear echo and reverb buffers
-	if ( !config_.effects_enabled && cfg.effects_enabled && echo_buf.size() )
+	if ( !config_.effects_enabled && effects && echo_buf.size() )
 	{
 		memset( &echo_buf [0], 0, echo_size * sizeof echo_buf [0] );
 		memset( &reverb_buf [0], 0, reverb_size * sizeof reverb_buf [0] );
 	}
 	
 	config_ = cfg;
+	config_.effects_enabled = effects;
 	
 	if ( config_.effects_enabled )
 	{
@@ -225,7 +276,7 @@ Effects_Buffer::channel_t Effects_Buffer::channel( int i, int type )
 void Effects_Buffer::end_frame( blip_time_t clock_count )
 {
 	int bufs_used = 0;
-	for ( int i = 0; i < buf_count; i++ )
+	for ( int i = 0; i < alloc_count; i++ )
 	{
 		bufs_used |= bufs [i].clear_modified() << i;
 		bufs [i].end_frame( clock_count );
@@ -246,7 +297,33 @@ long Effects_Buffer::samples_avail() const
 	return bufs [0].samples_avail() * 2;
 }
 
-long Effects_Buffer::read_samples( blip_sample_t* out, long total_samples )
+blip_ulong Effects_Buffer::synth_count() const
+{
+	blip_ulong n = 0;
+	for ( int i = 0; i < max_buf_count; i++ )
+		n += bufs [i].synth_count();
+	return n;
+}
+
+// Echo and reverb buffers are only copied once allocated, so state is larger
+// after effects are first enabled
+void Effects_Buffer::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( stereo_remain );
+	BLARGG_COPY( effect_remain );
+	BLARGG_COPY( effects_enabled );
+	BLARGG_COPY( reverb_pos );
+	BLARGG_COPY( echo_pos );
+	if ( echo_buf.size() )
+		copy( io, &echo_buf [0], echo_size * sizeof echo_buf [0] );
+	if ( reverb_buf.size() )
+		copy( io, &reverb_buf [0], reverb_size * sizeof reverb_buf [0] );
+	for ( int i = 0; i < alloc_count; i++ )
+		bufs [i].copy_state( io, copy );
+}
+
+template<class T>
+long Effects_Buffer::read_samples_( T* out, long total_samples )
 {
 	require( total_samples % 2 == 0 ); // count must be even
 	
@@ -256,7 +333,7 @@ long Effects_Buffer::read_samples( blip_sample_t* out, long total_samples )
 	total_samples = remain;
 	while ( remain )
 	{
-		int active_bufs = buf_count;
+		int active_bufs = alloc_count;
 		long count = remain;
 		
 		// optimizing mixing to skip any channels which had nothing added
@@ -297,7 +374,7 @@ long Effects_Buffer::read_samples( blip_sample_t* out, long total_samples )
 		if ( effect_remain < 0 )
 			effect_remain = 0;
 		
-		for ( int i = 0; i < buf_count; i++ )
+		for ( int i = 0; i < alloc_count; i++ )
 		{
 			if ( i < active_bufs )
 				bufs [i].remove_samples( count );
@@ -309,6 +386,26 @@ long Effects_Buffer::read_samples( blip_sample_t* out, long total_samples )
 	return total_samples * 2;
 }
 
+long Effects_Buffer::read_samples( blip_sample_t* out, long count )
+{
+	return read_samples_( out, count );
+}
+
+// Floating-point output isn't clamped
+long Effects_Buffer::read_samples( float* out, long count )
+{
+	return read_samples_( out, count );
+}
+
+static inline void write_sample( blip_sample_t& out, int s )
+{
+	if ( (BOOST::int16_t) s != s )
+		s = 0x7FFF - (s >> 24);
+	out = (blip_sample_t) s;
+}
+
+static inline void write_sample( float& out, int s ) { out = s * (1.0f / 0x8000); }
+
 void Effects_Buffer::mix_mono( blip_sample_t* out_, blargg_long count )
 {
 	blip_sample_t* BLIP_RESTRICT out = out_;
@@ -351,9 +448,28 @@ void Effects_Buffer::mix_mono( blip_sample_t* out_, blargg_long count )
 	BLIP_READER_END( c, bufs [0] );
 }
 
-void Effects_Buffer::mix_stereo( blip_sample_t* out_, blargg_long count )
+void Effects_Buffer::mix_mono( float* out_, blargg_long count )
 {
-	blip_sample_t* BLIP_RESTRICT out = out_;
+	float* BLIP_RESTRICT out = out_;
+	int const bass = BLIP_READER_BASS( bufs [0] );
+	BLIP_READER_BEGIN( c, bufs [0] );
+	
+	for ( ; count; --count )
+	{
+		float s = BLIP_READER_READ_RAW( c ) * blip_float_scale;
+		BLIP_READER_NEXT( c, bass );
+		out [0] = s;
+		out [1] = s;
+		out += 2;
+	}
+	
+	BLIP_READER_END( c, bufs [0] );
+}
+
+template<class T>
+void Effects_Buffer::mix_stereo( T* out_, blargg_long count )
+{
+	T* BLIP_RESTRICT out = out_;
 	int const bass = BLIP_READER_BASS( bufs [0] );
 	BLIP_READER_BEGIN( c, bufs [0] );
 	BLIP_READER_BEGIN( l, bufs [1] );
@@ -368,16 +484,9 @@ void Effects_Buffer::mix_stereo( blip_sample_t* out_, blargg_long count )
 		BLIP_READER_NEXT( l, bass );
 		BLIP_READER_NEXT( r, bass );
 		
-		if ( (BOOST::int16_t) left != left )
-			left = 0x7FFF - (left >> 24);
-		
-		out [0] = left;
-		out [1] = right;
-		
+		write_sample( out [0], left );
+		write_sample( out [1], right );
 		out += 2;
-		
-		if ( (BOOST::int16_t) right != right )
-			out [-1] = 0x7FFF - (right >> 24);
 	}
 	
 	BLIP_READER_END( r, bufs [2] );
@@ -385,9 +494,420 @@ void Effects_Buffer::mix_stereo( blip_sample_t* out_, blargg_long count )
 	BLIP_READER_END( c, bufs [0] );
 }
 
-void Effects_Buffer::mix_mono_enhanced( blip_sample_t* out_, blargg_long count )
+#if BLIP_BUFFER_SSE2 || BLIP_BUFFER_NEON
+
+void Effects_Buffer::mix_stereo( blip_sample_t* out, blargg_long count )
 {
-	blip_sample_t* BLIP_RESTRICT out = out_;
+	blip_mix_stereo_( out, &bufs [0], bufs [1], bufs [2], count );
+}
+
+// Mixing with effects is done in blocks. The readers of all buffers are run in
+// separate lanes of vectors, then four samples at a time are mixed with the echo
+// and reverb taps, which were all written before the block as long as it's no
+// longer than the shortest delay. Gives exactly the same results as the scalar
+// code below.
+
+int const max_block = 128; // samples mixed at a time
+
+typedef Blip_Buffer::buf_t_ const* BLIP_RESTRICT mix_in_t;
+
+static Blip_Buffer::buf_t_ const silence [max_block] = { 0 };
+
+#if BLIP_BUFFER_SSE2
+
+typedef __m128i lanes_t;
+
+static inline lanes_t lanes_load( blargg_long const* p ) { return _mm_loadu_si128( (__m128i const*) p ); }
+static inline void lanes_store( blargg_long* p, lanes_t v ) { _mm_storeu_si128( (__m128i*) p, v ); }
+static inline lanes_t lanes_add( lanes_t x, lanes_t y ) { return _mm_add_epi32( x, y ); }
+static inline lanes_t lanes_bass( int shift ) { return _mm_cvtsi32_si128( shift ); }
+
+static inline lanes_t lanes_read( lanes_t& acc, lanes_t in, lanes_t bass )
+{
+	lanes_t s = _mm_srai_epi32( acc, blip_sample_bits - 16 );
+	acc = _mm_add_epi32( acc, _mm_sub_epi32( in, _mm_sra_epi32( acc, bass ) ) );
+	return s;
+}
+
+static inline void lanes_transpose( lanes_t& a, lanes_t& b, lanes_t& c, lanes_t& d )
+{
+	lanes_t ab_lo = _mm_unpacklo_epi32( a, b );
+	lanes_t ab_hi = _mm_unpackhi_epi32( a, b );
+	lanes_t cd_lo = _mm_unpacklo_epi32( c, d );
+	lanes_t cd_hi = _mm_unpackhi_epi32( c, d );
+	a = _mm_unpacklo_epi64( ab_lo, cd_lo );
+	b = _mm_unpackhi_epi64( ab_lo, cd_lo );
+	c = _mm_unpacklo_epi64( ab_hi, cd_hi );
+	d = _mm_unpackhi_epi64( ab_hi, cd_hi );
+}
+
+// Level y from 0 to 0xFFFF split as yh * 0x8000 + yl, since SSE2 only has 16-bit
+// multiplies that keep the high half
+struct lanes_level_t {
+	lanes_t lo;   // yl
+	lanes_t lo2;  // yl in both halves
+	lanes_t hi;   // -1 if yh is 1
+};
+
+static inline lanes_level_t lanes_level( blargg_long y )
+{
+	lanes_level_t l;
+	l.lo  = _mm_set1_epi32( y & 0x7FFF );
+	l.lo2 = _mm_set1_epi32( (y & 0x7FFF) * 0x10001 );
+	l.hi  = _mm_set1_epi32( -(y >> 15 & 1) );
+	return l;
+}
+
+// FMUL( x, y ) for x from -0x20000 to 0x1FFFF, the range of a reader. With
+// x = xh * 0x10000 + xl, this is x * yh + xh * yl * 2 + (xl * yl >> 15).
+static inline lanes_t lanes_fmul( lanes_t x, lanes_level_t const& y )
+{
+	lanes_t xl_yl = _mm_add_epi32( _mm_slli_epi32( _mm_mulhi_epu16( x, y.lo ), 1 ),
+			_mm_srli_epi32( _mm_mullo_epi16( x, y.lo ), 15 ) );
+	lanes_t xh_yl = _mm_madd_epi16( _mm_srai_epi32( x, 16 ), y.lo );
+	return _mm_add_epi32( _mm_add_epi32( xl_yl, _mm_slli_epi32( xh_yl, 1 ) ),
+			_mm_and_si128( x, y.hi ) );
+}
+
+// (blip_sample_t) FMUL( x, y ) for any x. Only the low 32 bits of the product are
+// needed for this.
+static inline lanes_t lanes_fmul16( lanes_t x, lanes_level_t const& y )
+{
+	lanes_t p = _mm_add_epi32( _mm_mullo_epi16( x, y.lo2 ),
+			_mm_slli_epi32( _mm_mulhi_epu16( x, y.lo ), 16 ) );
+	p = _mm_add_epi32( p, _mm_and_si128( _mm_slli_epi32( x, 15 ), y.hi ) );
+	return _mm_srai_epi32( _mm_slli_epi32( p, 1 ), 16 );
+}
+
+// Left or right samples of four pairs
+static inline lanes_t load_reverb_l( blip_sample_t const* p )
+{
+	return _mm_srai_epi32( _mm_slli_epi32( _mm_loadu_si128( (__m128i const*) p ), 16 ), 16 );
+}
+
+static inline lanes_t load_reverb_r( blip_sample_t const* p )
+{
+	return _mm_srai_epi32( _mm_loadu_si128( (__m128i const*) p ), 16 );
+}
+
+static inline lanes_t load_echo( blip_sample_t const* p )
+{
+	lanes_t s = _mm_loadl_epi64( (__m128i const*) p );
+	return _mm_srai_epi32( _mm_unpacklo_epi16( s, s ), 16 );
+}
+
+// Truncates to 16 bits, as assignment to blip_sample_t does
+static inline void store_echo( blip_sample_t* out, lanes_t s )
+{
+	s = _mm_srai_epi32( _mm_slli_epi32( s, 16 ), 16 );
+	_mm_storel_epi64( (__m128i*) out, _mm_packs_epi32( s, s ) );
+}
+
+// Stores interleaved pairs of values already in 16-bit range
+static inline void store_reverb( blip_sample_t* out, lanes_t l, lanes_t r )
+{
+	_mm_storeu_si128( (__m128i*) out, _mm_packs_epi32(
+			_mm_unpacklo_epi32( l, r ), _mm_unpackhi_epi32( l, r ) ) );
+}
+
+// Saturating narrowing matches write_sample() for the range of values mixed here
+static inline void store_pairs( blip_sample_t* out, lanes_t l, lanes_t r )
+{
+	_mm_storeu_si128( (__m128i*) out, _mm_packs_epi32(
+			_mm_unpacklo_epi32( l, r ), _mm_unpackhi_epi32( l, r ) ) );
+}
+
+static inline void store_pairs( float* out, lanes_t l, lanes_t r )
+{
+	__m128 const scale = _mm_set1_ps( 1.0f / 0x8000 );
+	__m128 lf = _mm_mul_ps( _mm_cvtepi32_ps( l ), scale );
+	__m128 rf = _mm_mul_ps( _mm_cvtepi32_ps( r ), scale );
+	_mm_storeu_ps( out,     _mm_unpacklo_ps( lf, rf ) );
+	_mm_storeu_ps( out + 4, _mm_unpackhi_ps( lf, rf ) );
+}
+
+#else
+
+typedef int32x4_t lanes_t;
+typedef int32x4_t lanes_level_t;
+
+static inline lanes_t lanes_load( blargg_long const* p ) { return vld1q_s32( (int32_t const*) p ); }
+static inline void lanes_store( blargg_long* p, lanes_t v ) { vst1q_s32( (int32_t*) p, v ); }
+static inline lanes_t lanes_add( lanes_t x, lanes_t y ) { return vaddq_s32( x, y ); }
+static inline lanes_t lanes_bass( int shift ) { return vdupq_n_s32( -shift ); } // negative shifts right
+
+static inline lanes_t lanes_read( lanes_t& acc, lanes_t in, lanes_t bass )
+{
+	lanes_t s = vshrq_n_s32( acc, blip_sample_bits - 16 );
+	acc = vaddq_s32( acc, vsubq_s32( in, vshlq_s32( acc, bass ) ) );
+	return s;
+}
+
+static inline void lanes_transpose( lanes_t& a, lanes_t& b, lanes_t& c, lanes_t& d )
+{
+	int32x4x2_t ab = vtrnq_s32( a, b );
+	int32x4x2_t cd = vtrnq_s32( c, d );
+	a = vcombine_s32( vget_low_s32 ( ab.val [0] ), vget_low_s32 ( cd.val [0] ) );
+	b = vcombine_s32( vget_low_s32 ( ab.val [1] ), vget_low_s32 ( cd.val [1] ) );
+	c = vcombine_s32( vget_high_s32( ab.val [0] ), vget_high_s32( cd.val [0] ) );
+	d = vcombine_s32( vget_high_s32( ab.val [1] ), vget_high_s32( cd.val [1] ) );
+}
+
+static inline lanes_level_t lanes_level( blargg_long y ) { return vdupq_n_s32( y ); }
+
+// FMUL() with the full 64-bit product
+static inline lanes_t lanes_fmul( lanes_t x, lanes_level_t y )
+{
+	return vcombine_s32(
+			vshrn_n_s64( vmull_s32( vget_low_s32 ( x ), vget_low_s32 ( y ) ), 15 ),
+			vshrn_n_s64( vmull_s32( vget_high_s32( x ), vget_high_s32( y ) ), 15 ) );
+}
+
+// (blip_sample_t) FMUL( x, y )
+static inline lanes_t lanes_fmul16( lanes_t x, lanes_level_t y )
+{
+	return vmovl_s16( vmovn_s32( lanes_fmul( x, y ) ) );
+}
+
+// Left or right samples of four pairs
+static inline lanes_t load_reverb_l( blip_sample_t const* p ) { return vmovl_s16( vld2_s16( p ).val [0] ); }
+
+static inline lanes_t load_reverb_r( blip_sample_t const* p ) { return vmovl_s16( vld2_s16( p ).val [1] ); }
+
+static inline lanes_t load_echo( blip_sample_t const* p ) { return vmovl_s16( vld1_s16( p ) ); }
+
+// Truncates to 16 bits, as assignment to blip_sample_t does
+static inline void store_echo( blip_sample_t* out, lanes_t s ) { vst1_s16( out, vmovn_s32( s ) ); }
+
+// Stores interleaved pairs of values already in 16-bit range
+static inline void store_reverb( blip_sample_t* out, lanes_t l, lanes_t r )
+{
+	int16x4x2_t p = { { vmovn_s32( l ), vmovn_s32( r ) } };
+	vst2_s16( out, p );
+}
+
+// Saturating narrowing matches write_sample() for the range of values mixed here
+static inline void store_pairs( blip_sample_t* out, lanes_t l, lanes_t r )
+{
+	int16x4x2_t p = { { vqmovn_s32( l ), vqmovn_s32( r ) } };
+	vst2_s16( out, p );
+}
+
+static inline void store_pairs( float* out, lanes_t l, lanes_t r )
+{
+	float32x4x2_t p = { {
+		vmulq_n_f32( vcvtq_f32_s32( l ), 1.0f / 0x8000 ),
+		vmulq_n_f32( vcvtq_f32_s32( r ), 1.0f / 0x8000 )
+	} };
+	vst2q_f32( out, p );
+}
+
+#endif
+
+// Runs readers of four buffers in separate lanes, starting offset samples into
+// them, and writes count samples from each to out [i]. NULL buffers read as silence.
+// Samples must then be removed by the caller.
+static void read_lanes( Blip_Buffer* const* bufs, blargg_long* const* out, long offset,
+		int count, int bass_shift )
+{
+	blargg_long accums [4];
+	for ( int b = 0; b < 4; b++ )
+		accums [b] = bufs [b] ? bufs [b]->reader_accum_ : 0;
+	
+	mix_in_t in0 = bufs [0] ? bufs [0]->buffer_ + offset : silence;
+	mix_in_t in1 = bufs [1] ? bufs [1]->buffer_ + offset : silence;
+	mix_in_t in2 = bufs [2] ? bufs [2]->buffer_ + offset : silence;
+	mix_in_t in3 = bufs [3] ? bufs [3]->buffer_ + offset : silence;
+	blargg_long* BLIP_RESTRICT out0 = out [0];
+	blargg_long* BLIP_RESTRICT out1 = out [1];
+	blargg_long* BLIP_RESTRICT out2 = out [2];
+	blargg_long* BLIP_RESTRICT out3 = out [3];
+	
+	lanes_t const bass = lanes_bass( bass_shift );
+	lanes_t acc = lanes_load( accums );
+	int i = 0;
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		lanes_t s0 = lanes_load( in0 + i );
+		lanes_t s1 = lanes_load( in1 + i );
+		lanes_t s2 = lanes_load( in2 + i );
+		lanes_t s3 = lanes_load( in3 + i );
+		
+		lanes_transpose( s0, s1, s2, s3 ); // sn now holds sample n of each buffer
+		s0 = lanes_read( acc, s0, bass );
+		s1 = lanes_read( acc, s1, bass );
+		s2 = lanes_read( acc, s2, bass );
+		s3 = lanes_read( acc, s3, bass );
+		lanes_transpose( s0, s1, s2, s3 );
+		
+		lanes_store( out0 + i, s0 );
+		lanes_store( out1 + i, s1 );
+		lanes_store( out2 + i, s2 );
+		lanes_store( out3 + i, s3 );
+	}
+	
+	for ( ; i < count; i++ )
+	{
+		blargg_long s [4] = { in0 [i], in1 [i], in2 [i], in3 [i] };
+		lanes_store( s, lanes_read( acc, lanes_load( s ), bass ) );
+		out0 [i] = s [0];
+		out1 [i] = s [1];
+		out2 [i] = s [2];
+		out3 [i] = s [3];
+	}
+	
+	lanes_store( accums, acc );
+	for ( int b = 0; b < 4; b++ )
+	{
+		if ( bufs [b] )
+			bufs [b]->reader_accum_ = accums [b];
+	}
+}
+
+// Length of next block, limited so that taps are all from before it and neither
+// reads nor writes of echo and reverb buffers wrap around
+int Effects_Buffer::effects_block( blargg_long count ) const
+{
+	int n = max_block;
+	n = min( n, (int) (reverb_size     - chans.reverb_delay_l) / 2 );
+	n = min( n, (int) (reverb_size + 1 - chans.reverb_delay_r) / 2 );
+	n = min( n, (int) (echo_size - chans.echo_delay_l) );
+	n = min( n, (int) (echo_size - chans.echo_delay_r) );
+	n = min( n, (int) (reverb_size - reverb_pos) / 2 );
+	n = min( n, (int) (reverb_size - ((reverb_pos + chans.reverb_delay_l) & reverb_mask)) / 2 );
+	n = min( n, (int) (reverb_size - ((reverb_pos + chans.reverb_delay_r - 1) & reverb_mask)) / 2 );
+	n = min( n, (int) (echo_size - echo_pos) );
+	n = min( n, (int) (echo_size - ((echo_pos + chans.echo_delay_l) & echo_mask)) );
+	n = min( n, (int) (echo_size - ((echo_pos + chans.echo_delay_r) & echo_mask)) );
+	if ( n > count )
+		n = (int) count;
+	return n;
+}
+
+template<class T>
+void Effects_Buffer::mix_effects( T* out_, blargg_long count, bool stereo )
+{
+	T* BLIP_RESTRICT out = out_;
+	int const bass = BLIP_READER_BASS( bufs [2] );
+	
+	// sq1, sq2, center, l1, r1, l2, r2 and unused lane
+	blargg_long in [8] [max_block];
+	if ( !stereo )
+		memset( in [3], 0, 4 * sizeof in [0] ); // l1, r1, l2 and r2 are silent
+	Blip_Buffer* const bufs_lo [4] = { &bufs [0], &bufs [1], &bufs [2], stereo ? &bufs [3] : 0 };
+	Blip_Buffer* const bufs_hi [4] = { &bufs [4], &bufs [5], &bufs [6], 0 };
+	blargg_long* const in_lo [4] = { in [0], in [1], in [2], in [3] };
+	blargg_long* const in_hi [4] = { in [4], in [5], in [6], in [7] };
+	
+	blip_sample_t* const reverb_buf = this->reverb_buf.begin();
+	blip_sample_t* const echo_buf = this->echo_buf.begin();
+	
+	// vector code handles levels from 0 to 0xFFFF; others are mixed by scalar code
+	bool const vector = !((chans.pan_1_levels [0] | chans.pan_1_levels [1] |
+			chans.pan_2_levels [0] | chans.pan_2_levels [1] |
+			chans.reverb_level | chans.echo_level) & ~0xFFFF);
+	lanes_level_t const pan_1_l      = lanes_level( chans.pan_1_levels [0] );
+	lanes_level_t const pan_1_r      = lanes_level( chans.pan_1_levels [1] );
+	lanes_level_t const pan_2_l      = lanes_level( chans.pan_2_levels [0] );
+	lanes_level_t const pan_2_r      = lanes_level( chans.pan_2_levels [1] );
+	lanes_level_t const reverb_level = lanes_level( chans.reverb_level );
+	lanes_level_t const echo_level   = lanes_level( chans.echo_level );
+	
+	for ( long offset = 0; offset < count; )
+	{
+		int const n = effects_block( count - offset );
+		read_lanes( bufs_lo, in_lo, offset, n, bass );
+		if ( stereo )
+			read_lanes( bufs_hi, in_hi, offset, n, bass );
+		offset += n;
+		
+		// taps point to sample pairs, so the right one uses the odd half
+		blip_sample_t* const reverb_out = reverb_buf + reverb_pos;
+		blip_sample_t const* const reverb_l = reverb_buf + ((reverb_pos + chans.reverb_delay_l) & reverb_mask);
+		blip_sample_t const* const reverb_r = reverb_buf + ((reverb_pos + chans.reverb_delay_r - 1) & reverb_mask);
+		blip_sample_t* const echo_out = echo_buf + echo_pos;
+		blip_sample_t const* const echo_l = echo_buf + ((echo_pos + chans.echo_delay_l) & echo_mask);
+		blip_sample_t const* const echo_r = echo_buf + ((echo_pos + chans.echo_delay_r) & echo_mask);
+		
+		int i = 0;
+		for ( ; vector && i + 4 <= n; i += 4 )
+		{
+			lanes_t sum1_s = lanes_load( in [0] + i );
+			lanes_t sum2_s = lanes_load( in [1] + i );
+			
+			lanes_t new_reverb_l = lanes_add(
+					lanes_add( lanes_fmul( sum1_s, pan_1_l ), lanes_fmul( sum2_s, pan_2_l ) ),
+					lanes_add( lanes_load( in [3] + i ), load_reverb_l( reverb_l + i * 2 ) ) );
+			
+			lanes_t new_reverb_r = lanes_add(
+					lanes_add( lanes_fmul( sum1_s, pan_1_r ), lanes_fmul( sum2_s, pan_2_r ) ),
+					lanes_add( lanes_load( in [4] + i ), load_reverb_r( reverb_r + i * 2 ) ) );
+			
+			store_reverb( reverb_out + i * 2, lanes_fmul16( new_reverb_l, reverb_level ),
+					lanes_fmul16( new_reverb_r, reverb_level ) );
+			
+			lanes_t sum3_s = lanes_load( in [2] + i );
+			
+			lanes_t left = lanes_add( lanes_add( new_reverb_l, sum3_s ), lanes_add(
+					lanes_load( in [5] + i ), lanes_fmul( load_echo( echo_l + i ), echo_level ) ) );
+			lanes_t right = lanes_add( lanes_add( new_reverb_r, sum3_s ), lanes_add(
+					lanes_load( in [6] + i ), lanes_fmul( load_echo( echo_r + i ), echo_level ) ) );
+			
+			store_echo( echo_out + i, sum3_s );
+			store_pairs( out, left, right );
+			out += 8;
+		}
+		
+		for ( ; i < n; i++ )
+		{
+			int sum1_s = in [0] [i];
+			int sum2_s = in [1] [i];
+			
+			int new_reverb_l = FMUL( sum1_s, chans.pan_1_levels [0] ) +
+					FMUL( sum2_s, chans.pan_2_levels [0] ) + in [3] [i] + reverb_l [i * 2];
+			
+			int new_reverb_r = FMUL( sum1_s, chans.pan_1_levels [1] ) +
+					FMUL( sum2_s, chans.pan_2_levels [1] ) + in [4] [i] + reverb_r [i * 2 + 1];
+			
+			fixed_t reverb_level = chans.reverb_level;
+			reverb_out [i * 2] = (blip_sample_t) FMUL( new_reverb_l, reverb_level );
+			reverb_out [i * 2 + 1] = (blip_sample_t) FMUL( new_reverb_r, reverb_level );
+			
+			int sum3_s = in [2] [i];
+			
+			int left = new_reverb_l + sum3_s + in [5] [i] + FMUL( chans.echo_level, echo_l [i] );
+			int right = new_reverb_r + sum3_s + in [6] [i] + FMUL( chans.echo_level, echo_r [i] );
+			
+			echo_out [i] = sum3_s;
+			
+			write_sample( out [0], left );
+			write_sample( out [1], right );
+			out += 2;
+		}
+		
+		reverb_pos = (reverb_pos + n * 2) & reverb_mask;
+		echo_pos = (echo_pos + n) & echo_mask;
+	}
+}
+
+template<class T>
+void Effects_Buffer::mix_mono_enhanced( T* out, blargg_long count )
+{
+	mix_effects( out, count, false );
+}
+
+template<class T>
+void Effects_Buffer::mix_enhanced( T* out, blargg_long count )
+{
+	mix_effects( out, count, true );
+}
+
+#else
+
+template<class T>
+void Effects_Buffer::mix_mono_enhanced( T* out_, blargg_long count )
+{
+	T* BLIP_RESTRICT out = out_;
 	int const bass = BLIP_READER_BASS( bufs [2] );
 	BLIP_READER_BEGIN( center, bufs [2] );
 	BLIP_READER_BEGIN( sq1, bufs [0] );
@@ -430,16 +950,9 @@ void Effects_Buffer::mix_mono_enhanced( blip_sample_t* out_, blargg_long count )
 		echo_buf [echo_pos] = sum3_s;
 		echo_pos = (echo_pos + 1) & echo_mask;
 		
-		if ( (BOOST::int16_t) left != left )
-			left = 0x7FFF - (left >> 24);
-		
-		out [0] = left;
-		out [1] = right;
-		
+		write_sample( out [0], left );
+		write_sample( out [1], right );
 		out += 2;
-		
-		if ( (BOOST::int16_t) right != right )
-			out [-1] = 0x7FFF - (right >> 24);
 	}
 	this->reverb_pos = reverb_pos;
 	this->echo_pos = echo_pos;
@@ -449,9 +962,10 @@ void Effects_Buffer::mix_mono_enhanced( blip_sample_t* out_, blargg_long count )
 	BLIP_READER_END( center, bufs [2] );
 }
 
-void Effects_Buffer::mix_enhanced( blip_sample_t* out_, blargg_long count )
+template<class T>
+void Effects_Buffer::mix_enhanced( T* out_, blargg_long count )
 {
-	blip_sample_t* BLIP_RESTRICT out = out_;
+	T* BLIP_RESTRICT out = out_;
 	int const bass = BLIP_READER_BASS( bufs [2] );
 	BLIP_READER_BEGIN( center, bufs [2] );
 	BLIP_READER_BEGIN( l1, bufs [3] );
@@ -504,16 +1018,9 @@ void Effects_Buffer::mix_enhanced( blip_sample_t* out_, blargg_long count )
 		echo_buf [echo_pos] = sum3_s;
 		echo_pos = (echo_pos + 1) & echo_mask;
 		
-		if ( (BOOST::int16_t) left != left )
-			left = 0x7FFF - (left >> 24);
-		
-		out [0] = left;
-		out [1] = right;
-		
+		write_sample( out [0], left );
+		write_sample( out [1], right );
 		out += 2;
-		
-		if ( (BOOST::int16_t) right != right )
-			out [-1] = 0x7FFF - (right >> 24);
 	}
 	this->reverb_pos = reverb_pos;
 	this->echo_pos = echo_pos;
@@ -527,3 +1034,4 @@ void Effects_Buffer::mix_enhanced( blip_sample_t* out_, blargg_long count )
 	BLIP_READER_END( center, bufs [2] );
 }
 
+#endif
@@ -10,7 +10,8 @@
 class Effects_Buffer : public Multi_Buffer {
 public:
 	// If center_only is true, only center buffers are created and
-	// less memory is used.
+	// less memory is used. Buffers used only by effects are allocated the
+	// first time effects are enabled.
 	Effects_Buffer( bool center_only = false );
 	
 	// Channel  Effect    Center Pan
@@ -41,13 +42,17 @@ public:
 public:
 	~Effects_Buffer();
 	blargg_err_t set_sample_rate( long samples_per_sec, int msec = blip_default_length );
+	blargg_err_t change_sample_rate( long samples_per_sec );
 	void clock_rate( long );
 	void bass_freq( int );
 	void clear();
 	channel_t channel( int, int );
 	void end_frame( blip_time_t );
 	long read_samples( blip_sample_t*, long );
+	long read_samples( float*, long );
 	long samples_avail() const;
+	blip_ulong synth_count() const;
+	void copy_state( unsigned char**, blargg_copy_func_t );
 private:
 	typedef long fixed_t;
 	
@@ -59,6 +64,9 @@ private:
 	long stereo_remain;
 	long effect_remain;
 	int buf_count;
+	int alloc_count; // bufs [0] to bufs [alloc_count - 1] have memory
+	int buf_msec;
+	int bass_freq_;
 	bool effects_enabled;
 	
 	blargg_vector<blip_sample_t> reverb_buf;
@@ -77,10 +85,18 @@ private:
 		fixed_t reverb_level;
 	} chans;
 	
+	blargg_err_t alloc_bufs( bool effects );
+	template<class T> long read_samples_( T*, long );
 	void mix_mono( blip_sample_t*, blargg_long );
-	void mix_stereo( blip_sample_t*, blargg_long );
-	void mix_enhanced( blip_sample_t*, blargg_long );
-	void mix_mono_enhanced( blip_sample_t*, blargg_long );
+	void mix_mono( float*, blargg_long );
+	template<class T> void mix_stereo( T*, blargg_long );
+	template<class T> void mix_enhanced( T*, blargg_long );
+	template<class T> void mix_mono_enhanced( T*, blargg_long );
+	#if BLIP_BUFFER_SSE2 || BLIP_BUFFER_NEON
+		void mix_stereo( blip_sample_t*, blargg_long );
+		template<class T> void mix_effects( T*, blargg_long, bool stereo );
+		int effects_block( blargg_long ) const;
+	#endif
 };
 
 #endif
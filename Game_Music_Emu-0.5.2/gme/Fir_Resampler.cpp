@@ -7,6 +7,18 @@
 #include <stdio.h>
 #include <math.h>
 
+#if FIR_RESAMPLER_SSE2
+	#include <emmintrin.h>
+#elif FIR_RESAMPLER_NEON
+	#include <arm_neon.h>
+#endif
+
+#if FIR_RESAMPLER_JIT
+	#define XBYAK_NO_OP_NAMES
+	#include "xbyak.h"
+	#include "cpu_features.h"
+#endif
+
 /* Copyright (C) 2004-2006 Shay Green. This module is free software; you
 can redistribute it and/or modify it under the terms of the GNU Lesser
 General Public License as published by the Free Software Foundation; either
@@ -52,20 +64,207 @@ static void gen_sinc( double rolloff, int width, double offset, double spacing,
 	}
 }
 
-Fir_Resampler_::Fir_Resampler_( int width, sample_t* impulses_ ) :
+#if FIR_RESAMPLER_JIT
+
+// Generated code for one whole cycle of res output frames, starting at phase
+// 0. The input offset of each frame and the FIR loop are unrolled for the
+// exact configuration, and the sums are the same as fir_stereo() below.
+class Fir_Resampler_Jit : public Xbyak::CodeGenerator {
+public:
+	typedef Fir_Resampler_::sample_t sample_t;
+	typedef void (*cycle_func)( sample_t const* in, sample_t const* lanes, sample_t* out );
+	
+	int width;
+	int res;
+	int step;
+	blargg_ulong skip_bits;
+	int span;    // input offset of last frame of cycle
+	int advance; // input used by whole cycle
+	cycle_func cycle;
+	
+	Fir_Resampler_Jit( int width, int res, int step, blargg_ulong skip_bits, bool avx2 );
+	
+	bool matches( int w, int r, int s, blargg_ulong b ) const
+	{
+		return width == w && res == r && step == s && skip_bits == b;
+	}
+private:
+	void fir_sse2( Xbyak::Reg64 const& in, int in_offset, Xbyak::Reg64 const& lanes, int lanes_offset );
+	void fir_avx2( Xbyak::Reg64 const& in, int in_offset, Xbyak::Reg64 const& lanes, int lanes_offset );
+};
+
+// Each group of four points is 16 bytes of input and of lanes
+enum { group_size = 16 };
+
+// Sum of one output frame into xmm0, using xmm1 to xmm3
+void Fir_Resampler_Jit::fir_sse2( Xbyak::Reg64 const& in, int in_offset,
+		Xbyak::Reg64 const& lanes, int lanes_offset )
+{
+	using namespace Xbyak;
+	int const groups = width / 4;
+	for ( int g = 0; g < groups; g++ )
+	{
+		Xmm const& sum = (g & 1) ? xmm1 : xmm0;
+		movdqu( xmm2, ptr [in + in_offset + g * group_size] );
+		movdqu( xmm3, ptr [lanes + lanes_offset + g * group_size] );
+		pshuflw( xmm2, xmm2, 0xD8 ); // _MM_SHUFFLE( 3, 1, 2, 0 )
+		pshufhw( xmm2, xmm2, 0xD8 );
+		pmaddwd( xmm2, xmm3 );
+		if ( g < 2 )
+			movdqa( sum, xmm2 );
+		else
+			paddd( sum, xmm2 );
+	}
+	if ( groups > 1 )
+		paddd( xmm0, xmm1 );
+	pshufd( xmm1, xmm0, 0xEE ); // high 64 bits
+	paddd( xmm0, xmm1 );
+}
+
+// Same, eight points at a time
+void Fir_Resampler_Jit::fir_avx2( Xbyak::Reg64 const& in, int in_offset,
+		Xbyak::Reg64 const& lanes, int lanes_offset )
+{
+	using namespace Xbyak;
+	int const pairs = width / 8;
+	for ( int g = 0; g < pairs; g++ )
+	{
+		Ymm const& sum = (g & 1) ? ymm1 : ymm0;
+		vmovdqu( ymm2, ptr [in + in_offset + g * 2 * group_size] );
+		vpshuflw( ymm2, ymm2, 0xD8 );
+		vpshufhw( ymm2, ymm2, 0xD8 );
+		vpmaddwd( ymm2, ymm2, ptr [lanes + lanes_offset + g * 2 * group_size] );
+		if ( g < 2 )
+			vmovdqa( sum, ymm2 );
+		else
+			vpaddd( sum, sum, ymm2 );
+	}
+	if ( pairs > 1 )
+		vpaddd( ymm0, ymm0, ymm1 );
+	if ( pairs )
+	{
+		vextracti128( xmm1, ymm0, 1 );
+		vpaddd( xmm0, xmm0, xmm1 );
+	}
+	if ( width & 4 )
+	{
+		int const g = pairs * 2;
+		vmovdqu( xmm2, ptr [in + in_offset + g * group_size] );
+		vpshuflw( xmm2, xmm2, 0xD8 );
+		vpshufhw( xmm2, xmm2, 0xD8 );
+		vpmaddwd( xmm2, xmm2, ptr [lanes + lanes_offset + g * group_size] );
+		if ( pairs )
+			vpaddd( xmm0, xmm0, xmm2 );
+		else
+			vmovdqa( xmm0, xmm2 );
+	}
+	vpshufd( xmm1, xmm0, 0xEE );
+	vpaddd( xmm0, xmm0, xmm1 );
+}
+
+Fir_Resampler_Jit::Fir_Resampler_Jit( int width_, int res_, int step_,
+		blargg_ulong skip_bits_, bool avx2 ) :
+	Xbyak::CodeGenerator( (res_ * (width_ / 4 * 48 + 64) + 64 + 4095) & ~4095 ),
+	width( width_ ),
+	res( res_ ),
+	step( step_ ),
+	skip_bits( skip_bits_ )
+{
+	using namespace Xbyak;
+	#ifdef XBYAK64_WIN
+		Reg64 const& in = rcx, & lanes = rdx, & out = r8;
+	#else
+		Reg64 const& in = rdi, & lanes = rsi, & out = rdx;
+	#endif
+	int const stereo = 2;
+	int const phase_size = width * 2;
+	int offset = 0;
+	span = 0;
+	for ( int i = 0; i < res; i++ )
+	{
+		int const in_offset = offset * (int) sizeof (sample_t);
+		int const lanes_offset = i * phase_size * (int) sizeof (sample_t);
+		if ( avx2 )
+			fir_avx2( in, in_offset, lanes, lanes_offset );
+		else
+			fir_sse2( in, in_offset, lanes, lanes_offset );
+		
+		// l >>= 15, r >>= 15, and keep low 16 bits of each
+		if ( avx2 )
+		{
+			vpsrad( xmm0, xmm0, 15 );
+			vpshuflw( xmm0, xmm0, 0x08 );
+			vmovd( ptr [out + i * stereo * (int) sizeof (sample_t)], xmm0 );
+		}
+		else
+		{
+			psrad( xmm0, 15 );
+			pshuflw( xmm0, xmm0, 0x08 );
+			movd( ptr [out + i * stereo * (int) sizeof (sample_t)], xmm0 );
+		}
+		
+		span = offset;
+		offset += step + ((skip_bits >> i) & 1) * stereo;
+	}
+	advance = offset;
+	if ( avx2 )
+		vzeroupper();
+	ret();
+	cycle = getCode<cycle_func>();
+}
+
+void Fir_Resampler_::update_jit()
+{
+	static unsigned const features = cpu_features();
+	bool const simd = lanes && !(width_ & 3) && (features & CPU_FEATURE_SSE2);
+	if ( jit && (!simd || !jit->matches( width_, res, step, skip_bits )) )
+	{
+		delete jit;
+		jit = 0;
+	}
+	if ( simd && !jit )
+	{
+		bool const avx2 = (features & CPU_FEATURE_AVX2) != 0;
+		try
+		{
+			jit = new Fir_Resampler_Jit( width_, res, step, skip_bits, avx2 );
+		}
+		catch ( ... )
+		{
+			jit = 0; // use normal code
+		}
+	}
+}
+
+#endif
+
+Fir_Resampler_::Fir_Resampler_( int width, sample_t* impulses_, sample_t* lanes_ ) :
 	width_( width ),
+	max_width_( width ),
 	write_offset( width * stereo - stereo ),
-	impulses( impulses_ )
+	impulses( impulses_ ),
+	lanes( lanes_ )
 {
+	#if FIR_RESAMPLER_JIT
+		jit = 0;
+	#endif
 	write_pos = 0;
 	res       = 1;
 	imp_phase = 0;
 	skip_bits = 0;
 	step      = stereo;
 	ratio_    = 1.0;
+	factor_   = 0.0;
+	rolloff_  = 0.999;
+	gain_     = 1.0;
 }
 
-Fir_Resampler_::~Fir_Resampler_() { }
+Fir_Resampler_::~Fir_Resampler_()
+{
+	#if FIR_RESAMPLER_JIT
+		delete jit;
+	#endif
+}
 
 void Fir_Resampler_::clear()
 {
@@ -77,16 +276,72 @@ void Fir_Resampler_::clear()
 	}
 }
 
+void Fir_Resampler_::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	if ( !buf.size() )
+		return;
+	
+	int pos = write_pos - buf.begin();
+	BLARGG_COPY( pos );
+	BLARGG_COPY( imp_phase );
+	copy( io, buf.begin(), buf.size() * sizeof buf [0] );
+	write_pos = buf.begin() + pos;
+}
+
 blargg_err_t Fir_Resampler_::buffer_size( int new_size )
 {
-	RETURN_ERR( buf.resize( new_size + write_offset ) );
+	// room for widest FIR, so width can be changed later
+	RETURN_ERR( buf.resize( new_size + max_width_ * stereo - stereo ) );
 	clear();
 	return 0;
 }
+
+void Fir_Resampler_::set_width( int new_width )
+{
+	require( new_width >= 4 && new_width <= max_width_ && !(new_width & 1) );
+	width_       = new_width;
+	write_offset = new_width * stereo - stereo;
+	if ( factor_ )
+		time_ratio( factor_, rolloff_, gain_ );
+	else
+		clear();
+}
 	
+blargg_err_t Fir_Resampler_::resize_buffer( int new_size )
+{
+	long const written = write_pos - buf.begin();
+	long const size = new_size + max_width_ * stereo - stereo;
+	require( written <= size ); // input already written must fit
+	RETURN_ERR( buf.resize( size ) );
+	write_pos = buf.begin() + written;
+	return 0;
+}
+
 double Fir_Resampler_::time_ratio( double new_factor, double rolloff, double gain )
 {
-	ratio_ = new_factor;
+	factor_  = new_factor;
+	rolloff_ = rolloff;
+	gain_    = gain;
+	update_impulses();
+	clear();
+	return ratio_;
+}
+
+double Fir_Resampler_::change_ratio( double new_factor )
+{
+	if ( new_factor != factor_ )
+	{
+		factor_ = new_factor;
+		update_impulses();
+		imp_phase = 0;
+	}
+	return ratio_;
+}
+
+// Sets ratio_ and impulses for factor_, rolloff_ and gain_
+void Fir_Resampler_::update_impulses()
+{
+	ratio_ = factor_;
 	
 	double fstep = 0.0;
 	{
@@ -119,8 +374,8 @@ double Fir_Resampler_::time_ratio( double new_factor, double rolloff, double gai
 	input_per_cycle = 0;
 	for ( int i = 0; i < res; i++ )
 	{
-		gen_sinc( rolloff, int (width_ * filter + 1) & ~1, pos, filter,
-				double (0x7FFF * gain * filter),
+		gen_sinc( rolloff_, int (width_ * filter + 1) & ~1, pos, filter,
+				double (0x7FFF * gain_ * filter),
 				(int) width_, impulses + i * width_ );
 		
 		pos += fstep;
@@ -133,9 +388,30 @@ double Fir_Resampler_::time_ratio( double new_factor, double rolloff, double gai
 		}
 	}
 	
-	clear();
+	if ( lanes && !(width_ & 3) )
+	{
+		// each group of four points as p0 p1 p0 p1 p2 p3 p2 p3, to match input
+		// after it's shuffled to l0 l1 r0 r1 l2 l3 r2 r3
+		sample_t const* in = impulses;
+		sample_t* out = lanes;
+		for ( int n = res * width_ / 4; n; --n )
+		{
+			out [0] = in [0];
+			out [1] = in [1];
+			out [2] = in [0];
+			out [3] = in [1];
+			out [4] = in [2];
+			out [5] = in [3];
+			out [6] = in [2];
+			out [7] = in [3];
+			in  += 4;
+			out += 8;
+		}
+	}
 	
-	return ratio_;
+	#if FIR_RESAMPLER_JIT
+		update_jit();
+	#endif
 }
 
 int Fir_Resampler_::input_needed( blargg_long output_count ) const
@@ -188,6 +464,8 @@ int Fir_Resampler_::skip_input( long count )
 {
 	int remain = write_pos - buf.begin();
 	int max_count = remain - width_ * stereo;
+	if ( max_count < 0 ) // less than one filter width buffered, as after clear()
+		max_count = 0;
 	if ( count > max_count )
 		count = max_count;
 	
@@ -197,3 +475,169 @@ int Fir_Resampler_::skip_input( long count )
 	
 	return count;
 }
+
+// Reading
+
+#if FIR_RESAMPLER_SSE2
+
+// Left and right in separate lanes, four points at a time
+#define FIR_POINTS( sum, offset ) {\
+	__m128i s_ = _mm_loadu_si128( (__m128i const*) (in + offset) );\
+	s_ = _mm_shufflelo_epi16( s_, _MM_SHUFFLE( 3, 1, 2, 0 ) );\
+	s_ = _mm_shufflehi_epi16( s_, _MM_SHUFFLE( 3, 1, 2, 0 ) );\
+	sum = _mm_add_epi32( sum, _mm_madd_epi16( s_,\
+			_mm_loadu_si128( (__m128i const*) (lanes + offset) ) ) );\
+}
+
+static inline void fir_stereo( Fir_Resampler_::sample_t const* in,
+		Fir_Resampler_::sample_t const* lanes, int width, blargg_long& l, blargg_long& r )
+{
+	// two sums, so consecutive additions don't wait on each other
+	__m128i sum  = _mm_setzero_si128();
+	__m128i sum2 = _mm_setzero_si128();
+	int n = width >> 2;
+	for ( ; n >= 2; n -= 2 )
+	{
+		FIR_POINTS( sum,  0 );
+		FIR_POINTS( sum2, 8 );
+		in    += 16;
+		lanes += 16;
+	}
+	if ( n )
+		FIR_POINTS( sum, 0 );
+	sum = _mm_add_epi32( sum, sum2 );
+	sum = _mm_add_epi32( sum, _mm_unpackhi_epi64( sum, sum ) );
+	l = _mm_cvtsi128_si32( sum );
+	r = _mm_cvtsi128_si32( _mm_srli_si128( sum, 4 ) );
+}
+
+#elif FIR_RESAMPLER_NEON
+
+// Input deinterleaved into left and right vectors, four points at a time
+static inline void fir_stereo( Fir_Resampler_::sample_t const* in,
+		Fir_Resampler_::sample_t const* imp, int width, blargg_long& l, blargg_long& r )
+{
+	int32x4_t sum_l = vdupq_n_s32( 0 );
+	int32x4_t sum_r = vdupq_n_s32( 0 );
+	for ( int n = width >> 2; n; --n )
+	{
+		int16x4x2_t s = vld2_s16( in );
+		int16x4_t p = vld1_s16( imp );
+		sum_l = vmlal_s16( sum_l, s.val [0], p );
+		sum_r = vmlal_s16( sum_r, s.val [1], p );
+		in  += 8;
+		imp += 4;
+	}
+	int32x2_t sum = vpadd_s32(
+			vadd_s32( vget_low_s32( sum_l ), vget_high_s32( sum_l ) ),
+			vadd_s32( vget_low_s32( sum_r ), vget_high_s32( sum_r ) ) );
+	l = vget_lane_s32( sum, 0 );
+	r = vget_lane_s32( sum, 1 );
+}
+
+#endif
+
+int Fir_Resampler_::read( sample_t* out_begin, blargg_long count )
+{
+	sample_t* out = out_begin;
+	const sample_t* in = buf.begin();
+	sample_t* end_pos = write_pos;
+	blargg_ulong skip = skip_bits >> imp_phase;
+	int remain = res - imp_phase;
+	int const step = this->step;
+	int const width = width_;
+	
+	#if FIR_RESAMPLER_SSE2
+		bool const simd = lanes && !(width & 3);
+		int const phase_size = simd ? width * 2 : width;
+		sample_t const* const imp_begin = simd ? lanes : impulses;
+	#else
+		#if FIR_RESAMPLER_NEON
+			bool const simd = !(width & 3);
+		#endif
+		int const phase_size = width;
+		sample_t const* const imp_begin = impulses;
+	#endif
+	sample_t const* imp = imp_begin + imp_phase * phase_size;
+	
+	count >>= 1;
+	
+	if ( end_pos - in >= width * stereo )
+	{
+		end_pos -= width * stereo;
+		do
+		{
+		#if FIR_RESAMPLER_JIT
+			// whole cycles at once when at phase 0 with enough input and output space
+			if ( jit && remain == res && count >= res && end_pos - in >= jit->span )
+			{
+				jit->cycle( in, imp_begin, out );
+				in    += jit->advance;
+				out   += res * stereo;
+				count -= res;
+				continue;
+			}
+		#endif
+			count--;
+			
+			// accumulate in extended precision
+			blargg_long l = 0;
+			blargg_long r = 0;
+			
+			if ( count < 0 )
+				break;
+			
+		#if FIR_RESAMPLER_SSE2 || FIR_RESAMPLER_NEON
+			if ( simd )
+			{
+				fir_stereo( in, imp, width, l, r );
+				imp += phase_size;
+			}
+			else
+		#endif
+			{
+				const sample_t* i = in;
+				for ( int n = width / 2; n; --n )
+				{
+					int pt0 = imp [0];
+					l += pt0 * i [0];
+					r += pt0 * i [1];
+					int pt1 = imp [1];
+					imp += 2;
+					l += pt1 * i [2];
+					r += pt1 * i [3];
+					i += 4;
+				}
+			}
+			
+			remain--;
+			
+			l >>= 15;
+			r >>= 15;
+			
+			in += (skip * stereo) & stereo;
+			skip >>= 1;
+			in += step;
+			
+			if ( !remain )
+			{
+				imp = imp_begin;
+				skip = skip_bits;
+				remain = res;
+			}
+			
+			out [0] = (sample_t) l;
+			out [1] = (sample_t) r;
+			out += 2;
+		}
+		while ( in <= end_pos );
+	}
+	
+	imp_phase = res - remain;
+	
+	int left = write_pos - in;
+	write_pos = &buf [left];
+	memmove( buf.begin(), in, left * sizeof *in );
+	
+	return out - out_begin;
+}
@@ -7,10 +7,29 @@
 #include "blargg_common.h"
 #include <string.h>
 
+// FIR_RESAMPLER_SSE2/FIR_RESAMPLER_NEON: Set to 1 if read() can use vector code,
+// which gives the same output (see BLIP_BUFFER_NO_SIMD)
+#ifndef BLIP_BUFFER_NO_SIMD
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define FIR_RESAMPLER_SSE2 1
+	#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+		#define FIR_RESAMPLER_NEON 1
+	#endif
+#endif
+
+// FIR_RESAMPLER_JIT: Set in blargg_config.h to generate code for the current
+// width and ratio at run time, using AVX2 if available. Requires x86-64 and
+// the SSE2 layout. Falls back to the code above if generation fails.
+#if FIR_RESAMPLER_JIT && !(FIR_RESAMPLER_SSE2 && (defined (__x86_64__) || defined (_M_X64)))
+	#undef FIR_RESAMPLER_JIT
+#endif
+
+class Fir_Resampler_Jit;
+
 class Fir_Resampler_ {
 public:
-	
-	// Use Fir_Resampler<width> (below)
+
+	// Use Fir_Resampler<max_width> (below)
 	
 	// Set input/output resampling ratio and optionally low-pass rolloff and gain.
 	// Returns actual ratio used (rounded to internal precision).
@@ -19,13 +38,28 @@ public:
 	// Current input/output ratio
 	double ratio() const { return ratio_; }
 	
-// Input
+	// Change ratio while resampling, keeping rolloff, gain and input already
+	// written, rather than clearing it as time_ratio() does. Returns actual ratio
+	// used.
+	double change_ratio( double factor );
+	
+	// Set number of points in FIR, from 4 to max_width. Must be even; multiples of 4
+	// are fastest with vector code. Clears input buffer.
+	void set_width( int );
 	
+	// Current number of points in FIR
+	int width() const { return width_; }
+
+// Input
+
 	typedef short sample_t;
 	
 	// Resize and clear input buffer
 	blargg_err_t buffer_size( int );
 	
+	// Resize input buffer without clearing it. Input already written must fit.
+	blargg_err_t resize_buffer( int );
+	
 	// Clear input buffer. At least two output samples will be available after
 	// two input samples are written.
 	void clear();
@@ -44,8 +78,11 @@ public:
 	
 	// Skip 'count' input samples. Returns number of samples actually skipped.
 	int skip_input( long count );
-	
+
 // Output
+
+	// Read at most 'count' samples. Returns number of samples actually read.
+	int read( sample_t* out, blargg_long count );
 	
 	// Number of extra input samples needed until 'count' output samples are available
 	int input_needed( blargg_long count ) const;
@@ -53,6 +90,11 @@ public:
 	// Number of output samples available
 	int avail() const { return avail_( write_pos - &buf [width_ * stereo] ); }
 	
+	// Save/restore input not yet resampled and position within it (see
+	// blargg_copy_func_t). Ratio, width and buffer size must be the same when
+	// restoring.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+
 public:
 	~Fir_Resampler_();
 protected:
@@ -62,30 +104,43 @@ protected:
 	sample_t* write_pos;
 	int res;
 	int imp_phase;
-	int const width_;
-	int const write_offset;
+	int width_;
+	int const max_width_;
+	int write_offset;
 	blargg_ulong skip_bits;
 	int step;
 	int input_per_cycle;
 	double ratio_;
+	double factor_;  // time_ratio() parameters, for set_width()
+	double rolloff_;
+	double gain_;
 	sample_t* impulses;
+	sample_t* lanes; // impulses arranged for SSE2 code, or NULL if not used
+	#if FIR_RESAMPLER_JIT
+		Fir_Resampler_Jit* jit; // code for current configuration, or NULL if not used
+		void update_jit();
+	#endif
 	
-	Fir_Resampler_( int width, sample_t* );
+	Fir_Resampler_( int max_width, sample_t* impulses, sample_t* lanes );
 	int avail_( blargg_long input_count ) const;
+	void update_impulses();
 };
 
-// Width is number of points in FIR. Must be even and 4 or more. More points give
-// better quality and rolloff effectiveness, and take longer to calculate.
-template<int width>
+// Max_width is maximum number of points in FIR, which is also the initial width.
+// Must be even and 4 or more. More points give better quality and rolloff
+// effectiveness, and take longer to calculate.
+template<int max_width>
 class Fir_Resampler : public Fir_Resampler_ {
-	BOOST_STATIC_ASSERT( width >= 4 && width % 2 == 0 );
-	short impulses [max_res] [width];
+	BOOST_STATIC_ASSERT( max_width >= 4 && max_width % 2 == 0 );
+	short impulse_buf [max_res] [max_width];
+	#if FIR_RESAMPLER_SSE2
+		short lane_buf [max_res] [max_width * 2];
+		sample_t* lanes_() { return lane_buf [0]; }
+	#else
+		sample_t* lanes_() { return 0; }
+	#endif
 public:
-	Fir_Resampler() : Fir_Resampler_( width, impulses [0] ) { }
-	
-	// Read at most 'count' samples. Returns number of samples actually read.
-	typedef short sample_t;
-	int read( sample_t* out, blargg_long count );
+	Fir_Resampler() : Fir_Resampler_( max_width, impulse_buf [0], lanes_() ) { }
 };
 
 // End of public interface
@@ -96,76 +151,4 @@ inline void Fir_Resampler_::write( long count )
 	assert( write_pos <= buf.end() );
 }
 
-template<int width>
-int Fir_Resampler<width>::read( sample_t* out_begin, blargg_long count )
-{
-	sample_t* out = out_begin;
-	const sample_t* in = buf.begin();
-	sample_t* end_pos = write_pos;
-	blargg_ulong skip = skip_bits >> imp_phase;
-	sample_t const* imp = impulses [imp_phase];
-	int remain = res - imp_phase;
-	int const step = this->step;
-	
-	count >>= 1;
-	
-	if ( end_pos - in >= width * stereo )
-	{
-		end_pos -= width * stereo;
-		do
-		{
-			count--;
-			
-			// accumulate in extended precision
-			blargg_long l = 0;
-			blargg_long r = 0;
-			
-			const sample_t* i = in;
-			if ( count < 0 )
-				break;
-			
-			for ( int n = width / 2; n; --n )
-			{
-				int pt0 = imp [0];
-				l += pt0 * i [0];
-				r += pt0 * i [1];
-				int pt1 = imp [1];
-				imp += 2;
-				l += pt1 * i [2];
-				r += pt1 * i [3];
-				i += 4;
-			}
-			
-			remain--;
-			
-			l >>= 15;
-			r >>= 15;
-			
-			in += (skip * stereo) & stereo;
-			skip >>= 1;
-			in += step;
-			
-			if ( !remain )
-			{
-				imp = impulses [0];
-				skip = skip_bits;
-				remain = res;
-			}
-			
-			out [0] = (sample_t) l;
-			out [1] = (sample_t) r;
-			out += 2;
-		}
-		while ( in <= end_pos );
-	}
-	
-	imp_phase = res - remain;
-	
-	int left = write_pos - in;
-	write_pos = &buf [left];
-	memmove( buf.begin(), in, left * sizeof *in );
-	
-	return out - out_begin;
-}
-
 #endif
@@ -37,6 +37,7 @@ Gb_Apu::Gb_Apu()
 		Gb_Osc& osc = *oscs [i];
 		osc.regs = &regs [i * 5];
 		osc.output = 0;
+		osc.span_rendering = false;
 		osc.outputs [0] = 0;
 		osc.outputs [1] = 0;
 		osc.outputs [2] = 0;
@@ -54,6 +55,12 @@ void Gb_Apu::treble_eq( const blip_eq_t& eq )
 	other_synth.treble_eq( eq );
 }
 
+void Gb_Apu::enable_span_rendering( bool b )
+{
+	for ( int i = 0; i < osc_count; i++ )
+		oscs [i]->span_rendering = b;
+}
+
 void Gb_Apu::osc_output( int index, Blip_Buffer* center, Blip_Buffer* left, Blip_Buffer* right )
 {
 	require( (unsigned) index < osc_count );
@@ -143,19 +150,19 @@ void Gb_Apu::run_until( blip_time_t end_time )
 		{
 			Gb_Osc& osc = *oscs [i];
 			if ( osc.output )
-			{
 				osc.output->set_modified(); // TODO: misses optimization opportunities?
-				int playing = false;
-				if ( osc.enabled && osc.volume &&
-						(!(osc.regs [4] & osc.len_enabled_mask) || osc.length) )
-					playing = -1;
-				switch ( i )
-				{
-				case 0: square1.run( last_time, time, playing ); break;
-				case 1: square2.run( last_time, time, playing ); break;
-				case 2: wave   .run( last_time, time, playing ); break;
-				case 3: noise  .run( last_time, time, playing ); break;
-				}
+			
+			// run even without output, so phase is the same once output returns
+			int playing = false;
+			if ( osc.enabled && osc.volume &&
+					(!(osc.regs [4] & osc.len_enabled_mask) || osc.length) )
+				playing = -1;
+			switch ( i )
+			{
+			case 0: square1.run( last_time, time, playing ); break;
+			case 1: square2.run( last_time, time, playing ); break;
+			case 2: wave   .run( last_time, time, playing ); break;
+			case 3: noise  .run( last_time, time, playing ); break;
 			}
 		}
 		last_time = time;
@@ -283,6 +290,41 @@ void Gb_Apu::write_register( blip_time_t time, unsigned addr, int data )
 	}
 }
 
+void Gb_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( next_frame_time );
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( frame_count );
+	BLARGG_COPY( regs );
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		Gb_Osc& osc = *oscs [i];
+		BLARGG_COPY( osc.output_select );
+		BLARGG_COPY( osc.delay );
+		BLARGG_COPY( osc.last_amp );
+		BLARGG_COPY( osc.volume );
+		BLARGG_COPY( osc.length );
+		BLARGG_COPY( osc.enabled );
+		BLARGG_COPY( osc.span_error );
+		osc.output = osc.outputs [osc.output_select];
+	}
+	
+	Gb_Square* const squares [2] = { &square1, &square2 };
+	for ( int i = 0; i < 2; i++ )
+	{
+		BLARGG_COPY( squares [i]->env_delay );
+		BLARGG_COPY( squares [i]->sweep_delay );
+		BLARGG_COPY( squares [i]->sweep_freq );
+		BLARGG_COPY( squares [i]->phase );
+	}
+	BLARGG_COPY( wave.wave_pos );
+	BLARGG_COPY( wave.wave );
+	BLARGG_COPY( noise.env_delay );
+	BLARGG_COPY( noise.bits );
+	
+	update_volume();
+}
+
 int Gb_Apu::read_register( blip_time_t time, unsigned addr )
 {
 	run_until( time );
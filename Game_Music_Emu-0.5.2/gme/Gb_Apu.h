@@ -15,6 +15,13 @@ public:
 	// Set treble equalization
 	void treble_eq( const blip_eq_t& );
 	
+	// Output wave and noise stepping faster than the sample rate as the average
+	// of each sample, instead of a band-limited step for every transition, and
+	// output squares above the Nyquist frequency as their average level. Reduces
+	// work for ultrasonic tones and fast noise at the cost of slight aliasing.
+	// Disabled by default.
+	void enable_span_rendering( bool = true );
+	
 	// Outputs can be assigned to a single buffer for mono output, or to three
 	// buffers for stereo output (using Stereo_Buffer to do the mixing).
 	
@@ -50,6 +57,10 @@ public:
 	
 	void set_tempo( double );
 	
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs, volume and tempo aren't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Gb_Apu();
 private:
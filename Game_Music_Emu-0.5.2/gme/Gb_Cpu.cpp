@@ -19,6 +19,10 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include "gb_cpu_io.h"
 
+#ifdef GB_CPU_LOG_H
+	#undef BLARGG_COMPUTED_GOTO // log goes through loop
+#endif
+
 #include "blargg_source.h"
 
 // Common instructions:
@@ -79,6 +83,14 @@ void Gb_Cpu::map_code( gb_addr_t start, unsigned size, void* data )
 		set_code_page( first_page + i, (uint8_t*) data + i * page_size );
 }
 
+void Gb_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( r );
+	BLARGG_COPY( rst_base );
+	BLARGG_COPY( state_ );
+}
+
 #define READ( addr )            CPU_READ( this, (addr), s.remain )
 #define WRITE( addr, data )     {CPU_WRITE( this, (addr), (data), s.remain );}
 #define READ_FAST( addr, out )  CPU_READ_FAST( this, (addr), s.remain, out )
@@ -123,38 +135,98 @@ bool Gb_Cpu::run( blargg_long cycle_count )
 	unsigned sp = r.sp;
 	unsigned flags = r.flags;
 	
-loop:
-	
-	check( (unsigned long) pc < 0x10000 );
-	check( (unsigned long) sp < 0x10000 );
-	check( (flags & ~0xF0) == 0 );
+	#if BLARGG_COMPUTED_GOTO
+		// Address of code for each opcode, matching the OP_CASE labels below
+		static void* const op_table [0x100] = {
+			&&op_0x00, &&op_0x01, &&op_0x02, &&op_0x03, &&op_0x04, &&op_0x05, &&op_0x06, &&op_0x07,
+			&&op_0x08, &&op_0x09, &&op_0x0A, &&op_0x0B, &&op_0x0C, &&op_0x0D, &&op_0x0E, &&op_0x0F,
+			&&op_0x10, &&op_0x11, &&op_0x12, &&op_0x13, &&op_0x14, &&op_0x15, &&op_0x16, &&op_0x17,
+			&&op_0x18, &&op_0x19, &&op_0x1A, &&op_0x1B, &&op_0x1C, &&op_0x1D, &&op_0x1E, &&op_0x1F,
+			&&op_0x20, &&op_0x21, &&op_0x22, &&op_0x23, &&op_0x24, &&op_0x25, &&op_0x26, &&op_0x27,
+			&&op_0x28, &&op_0x29, &&op_0x2A, &&op_0x2B, &&op_0x2C, &&op_0x2D, &&op_0x2E, &&op_0x2F,
+			&&op_0x30, &&op_0x31, &&op_0x32, &&op_0x33, &&op_0x34, &&op_0x35, &&op_0x36, &&op_0x37,
+			&&op_0x38, &&op_0x39, &&op_0x3A, &&op_0x3B, &&op_0x3C, &&op_0x3D, &&op_0x3E, &&op_0x3F,
+			&&op_0x40, &&op_0x41, &&op_0x42, &&op_0x43, &&op_0x44, &&op_0x45, &&op_0x46, &&op_0x47,
+			&&op_0x48, &&op_0x49, &&op_0x4A, &&op_0x4B, &&op_0x4C, &&op_0x4D, &&op_0x4E, &&op_0x4F,
+			&&op_0x50, &&op_0x51, &&op_0x52, &&op_0x53, &&op_0x54, &&op_0x55, &&op_0x56, &&op_0x57,
+			&&op_0x58, &&op_0x59, &&op_0x5A, &&op_0x5B, &&op_0x5C, &&op_0x5D, &&op_0x5E, &&op_0x5F,
+			&&op_0x60, &&op_0x61, &&op_0x62, &&op_0x63, &&op_0x64, &&op_0x65, &&op_0x66, &&op_0x67,
+			&&op_0x68, &&op_0x69, &&op_0x6A, &&op_0x6B, &&op_0x6C, &&op_0x6D, &&op_0x6E, &&op_0x6F,
+			&&op_0x70, &&op_0x71, &&op_0x72, &&op_0x73, &&op_0x74, &&op_0x75, &&op_0x76, &&op_0x77,
+			&&op_0x78, &&op_0x79, &&op_0x7A, &&op_0x7B, &&op_0x7C, &&op_0x7D, &&op_0x7E, &&op_0x7F,
+			&&op_0x80, &&op_0x81, &&op_0x82, &&op_0x83, &&op_0x84, &&op_0x85, &&op_0x86, &&op_0x87,
+			&&op_0x88, &&op_0x89, &&op_0x8A, &&op_0x8B, &&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_0x8F,
+			&&op_0x90, &&op_0x91, &&op_0x92, &&op_0x93, &&op_0x94, &&op_0x95, &&op_0x96, &&op_0x97,
+			&&op_0x98, &&op_0x99, &&op_0x9A, &&op_0x9B, &&op_0x9C, &&op_0x9D, &&op_0x9E, &&op_0x9F,
+			&&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_0xA3, &&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_0xA7,
+			&&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_0xAB, &&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_0xAF,
+			&&op_0xB0, &&op_0xB1, &&op_0xB2, &&op_0xB3, &&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_0xB7,
+			&&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_0xBB, &&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_0xBF,
+			&&op_0xC0, &&op_0xC1, &&op_0xC2, &&op_0xC3, &&op_0xC4, &&op_0xC5, &&op_0xC6, &&op_0xC7,
+			&&op_0xC8, &&op_0xC9, &&op_0xCA, &&op_0xCB, &&op_0xCC, &&op_0xCD, &&op_0xCE, &&op_0xCF,
+			&&op_0xD0, &&op_0xD1, &&op_0xD2, &&op_0xD3, &&op_0xD4, &&op_0xD5, &&op_0xD6, &&op_0xD7,
+			&&op_0xD8, &&op_0xD9, &&op_0xDA, &&op_0xDB, &&op_0xDC, &&op_0xDD, &&op_0xDE, &&op_0xDF,
+			&&op_0xE0, &&op_0xE1, &&op_0xE2, &&op_0xE3, &&op_0xE4, &&op_0xE5, &&op_0xE6, &&op_0xE7,
+			&&op_0xE8, &&op_0xE9, &&op_0xEA, &&op_0xEB, &&op_0xEC, &&op_0xED, &&op_0xEE, &&op_0xEF,
+			&&op_0xF0, &&op_0xF1, &&op_0xF2, &&op_0xF3, &&op_0xF4, &&op_0xF5, &&op_0xF6, &&op_0xF7,
+			&&op_0xF8, &&op_0xF9, &&op_0xFA, &&op_0xFB, &&op_0xFC, &&op_0xFD, &&op_0xFE, &&op_0xFF
+		};
+	#endif
 	
-	uint8_t const* instr = s.code_map [pc >> page_shift];
+	uint8_t const* instr;
 	unsigned op;
+	unsigned data;
 	
 	// TODO: eliminate this special case
 	#if BLARGG_NONPORTABLE
-		op = instr [pc];
-		pc++;
-		instr += pc;
+		#define FETCH_OP() (instr = s.code_map [pc >> page_shift], op = instr [pc], instr += ++pc)
 	#else
-		instr += PAGE_OFFSET( pc );
-		op = *instr++;
-		pc++;
+		#define FETCH_OP() (instr = s.code_map [pc >> page_shift] + PAGE_OFFSET( pc ),\
+				op = *instr++, pc++)
+	#endif
+	
+	// Runs next instruction. With computed goto, this is expanded at the end of each
+	// instruction, giving each its own indirect jump for the host CPU to predict.
+	#if BLARGG_COMPUTED_GOTO
+		#define NEXT_INSTR() {\
+			COUNT_INSTR();\
+			FETCH_OP();\
+			if ( !--s.remain )\
+				goto stop;\
+			data = *instr;\
+			goto *op_table [op];\
+		}
+	#else
+		#define NEXT_INSTR() goto loop
 	#endif
 	
+#if !BLARGG_COMPUTED_GOTO
+loop:
+#endif
+	
+	COUNT_INSTR();
+	
+	check( (unsigned long) pc < 0x10000 );
+	check( (unsigned long) sp < 0x10000 );
+	check( (flags & ~0xF0) == 0 );
+	
+	FETCH_OP();
+	
 #define GET_ADDR()  GET_LE16( instr )
 	
 	if ( !--s.remain )
 		goto stop;
 	
-	unsigned data;
 	data = *instr;
 	
 	#ifdef GB_CPU_LOG_H
 		gb_cpu_log( "new", pc - 1, op, data, instr [1] );
 	#endif
 	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [op];
+	#endif
+	
 	switch ( op )
 	{
 
@@ -163,75 +235,75 @@ loop:
 {\
 	pc++;\
 	int offset = (BOOST::int8_t) data;\
-	if ( !(cond) ) goto loop;\
+	if ( !(cond) ) NEXT_INSTR();\
 	pc = uint16_t (pc + offset);\
-	goto loop;\
+	NEXT_INSTR();\
 }
 
 // Most Common
 
-	case 0x20: // JR NZ
+	OP_CASE( 0x20 ): // JR NZ
 		BRANCH( !(flags & z_flag) )
 	
-	case 0x21: // LD HL,IMM (common)
+	OP_CASE( 0x21 ): // LD HL,IMM (common)
 		rp.hl = GET_ADDR();
 		pc += 2;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x28: // JR Z
+	OP_CASE( 0x28 ): // JR Z
 		BRANCH( flags & z_flag )
 	
 	{
 		unsigned temp;
-	case 0xF0: // LD A,(0xFF00+imm)
+	OP_CASE( 0xF0 ): // LD A,(0xFF00+imm)
 		temp = data | 0xFF00;
 		pc++;
 		goto ld_a_ind_comm;
 	
-	case 0xF2: // LD A,(0xFF00+C)
+	OP_CASE( 0xF2 ): // LD A,(0xFF00+C)
 		temp = rg.c | 0xFF00;
 		goto ld_a_ind_comm;
 	
-	case 0x0A: // LD A,(BC)
+	OP_CASE( 0x0A ): // LD A,(BC)
 		temp = rp.bc;
 		goto ld_a_ind_comm;
 	
-	case 0x3A: // LD A,(HL-)
+	OP_CASE( 0x3A ): // LD A,(HL-)
 		temp = rp.hl;
 		rp.hl = temp - 1;
 		goto ld_a_ind_comm;
 	
-	case 0x1A: // LD A,(DE)
+	OP_CASE( 0x1A ): // LD A,(DE)
 		temp = rp.de;
 		goto ld_a_ind_comm;
 	
-	case 0x2A: // LD A,(HL+) (common)
+	OP_CASE( 0x2A ): // LD A,(HL+) (common)
 		temp = rp.hl;
 		rp.hl = temp + 1;
 		goto ld_a_ind_comm;
 		
-	case 0xFA: // LD A,IND16 (common)
+	OP_CASE( 0xFA ): // LD A,IND16 (common)
 		temp = GET_ADDR();
 		pc += 2;
 	ld_a_ind_comm:
 		READ_FAST( temp, rg.a );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xBE: // CMP (HL)
+	OP_CASE( 0xBE ): // CMP (HL)
 		data = READ( rp.hl );
 		goto cmp_comm;
 	
-	case 0xB8: // CMP B
-	case 0xB9: // CMP C
-	case 0xBA: // CMP D
-	case 0xBB: // CMP E
-	case 0xBC: // CMP H
-	case 0xBD: // CMP L
+	OP_CASE( 0xB8 ): // CMP B
+	OP_CASE( 0xB9 ): // CMP C
+	OP_CASE( 0xBA ): // CMP D
+	OP_CASE( 0xBB ): // CMP E
+	OP_CASE( 0xBC ): // CMP H
+	OP_CASE( 0xBD ): // CMP L
 		data = R8( op & 7 );
 		goto cmp_comm;
 	
-	case 0xFE: // CMP IMM
+	OP_CASE( 0xFE ): // CMP IMM
 		pc++;
 	cmp_comm:
 		op = rg.a;
@@ -241,29 +313,29 @@ loop:
 		flags |= (data >> 4) & c_flag;
 		flags |= n_flag;
 		if ( data & 0xFF )
-			goto loop;
+			NEXT_INSTR();
 		flags |= z_flag;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x46: // LD B,(HL)
-	case 0x4E: // LD C,(HL)
-	case 0x56: // LD D,(HL)
-	case 0x5E: // LD E,(HL)
-	case 0x66: // LD H,(HL)
-	case 0x6E: // LD L,(HL)
-	case 0x7E:{// LD A,(HL)
+	OP_CASE( 0x46 ): // LD B,(HL)
+	OP_CASE( 0x4E ): // LD C,(HL)
+	OP_CASE( 0x56 ): // LD D,(HL)
+	OP_CASE( 0x5E ): // LD E,(HL)
+	OP_CASE( 0x66 ): // LD H,(HL)
+	OP_CASE( 0x6E ): // LD L,(HL)
+	OP_CASE( 0x7E ):{// LD A,(HL)
 		unsigned addr = rp.hl;
 		READ_FAST( addr, R8( (op >> 3) & 7 ) );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xC4: // CNZ (next-most-common)
+	OP_CASE( 0xC4 ): // CNZ (next-most-common)
 		pc += 2;
 		if ( flags & z_flag )
-			goto loop;
+			NEXT_INSTR();
 	call:
 		pc -= 2;
-	case 0xCD: // CALL (most-common)
+	OP_CASE( 0xCD ): // CALL (most-common)
 		data = pc + 2;
 		pc = GET_ADDR();
 	push:
@@ -271,31 +343,31 @@ loop:
 		WRITE( sp, data >> 8 );
 		sp = (sp - 1) & 0xFFFF;
 		WRITE( sp, data & 0xFF );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC8: // RNZ (next-most-common)
+	OP_CASE( 0xC8 ): // RNZ (next-most-common)
 		if ( !(flags & z_flag) )
-			goto loop;
-	case 0xC9: // RET (most common)
+			NEXT_INSTR();
+	OP_CASE( 0xC9 ): // RET (most common)
 	ret:
 		pc = READ( sp );
 		pc += 0x100 * READ( sp + 1 );
 		sp = (sp + 2) & 0xFFFF;
-		goto loop;
-	
-	case 0x00: // NOP
-	case 0x40: // LD B,B
-	case 0x49: // LD C,C
-	case 0x52: // LD D,D
-	case 0x5B: // LD E,E
-	case 0x64: // LD H,H
-	case 0x6D: // LD L,L
-	case 0x7F: // LD A,A
-		goto loop;
+		NEXT_INSTR();
+	
+	OP_CASE( 0x00 ): // NOP
+	OP_CASE( 0x40 ): // LD B,B
+	OP_CASE( 0x49 ): // LD C,C
+	OP_CASE( 0x52 ): // LD D,D
+	OP_CASE( 0x5B ): // LD E,E
+	OP_CASE( 0x64 ): // LD H,H
+	OP_CASE( 0x6D ): // LD L,L
+	OP_CASE( 0x7F ): // LD A,A
+		NEXT_INSTR();
 	
 // CB Instructions
 
-	case 0xCB:
+	OP_CASE( 0xCB ):
 		pc++;
 		// now data is the opcode
 		switch ( data ) {
@@ -336,7 +408,7 @@ loop:
 			flags &= ~n_flag;
 			flags |= h_flag | z_flag;
 			flags ^= (temp << bit) & z_flag;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x86: // RES b,(HL)
@@ -361,7 +433,7 @@ loop:
 			if ( !(data & 0x40) )
 				bit = 0;
 			WRITE( rp.hl, temp | bit );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0xC0: case 0xC1: case 0xC2: case 0xC3: // SET b,r
@@ -379,7 +451,7 @@ loop:
 		case 0xF7: case 0xF8: case 0xF9: case 0xFA:
 		case 0xFB: case 0xFC: case 0xFD: case 0xFF:
 			R8( data & 7 ) |= 1 << ((data >> 3) & 7);
-			goto loop;
+			NEXT_INSTR();
 
 		case 0x80: case 0x81: case 0x82: case 0x83: // RES b,r
 		case 0x84: case 0x85: case 0x87: case 0x88:
@@ -396,7 +468,7 @@ loop:
 		case 0xB7: case 0xB8: case 0xB9: case 0xBA:
 		case 0xBB: case 0xBC: case 0xBD: case 0xBF:
 			R8( data & 7 ) &= ~(1 << ((data >> 3) & 7));
-			goto loop;
+			NEXT_INSTR();
 		
 		{
 			int temp;
@@ -451,8 +523,8 @@ loop:
 	} // CB op
 	assert( false ); // unhandled CB op
 
-	case 0x07: // RLCA
-	case 0x17: // RLA
+	OP_CASE( 0x07 ): // RLCA
+	OP_CASE( 0x17 ): // RLA
 		data = op;
 		op = rg.a;
 	rl_comm:
@@ -464,8 +536,8 @@ loop:
 		// SLA doesn't fill lower bit
 		goto shift_comm;
 	
-	case 0x0F: // RRCA
-	case 0x1F: // RRA
+	OP_CASE( 0x0F ): // RRCA
+	OP_CASE( 0x1F ): // RRA
 		data = op;
 		op = rg.a;
 	rr_comm:
@@ -483,197 +555,204 @@ loop:
 		if ( data == 6 )
 			goto write_hl_op_ff;
 		R8( data ) = op;
-		goto loop;
+		NEXT_INSTR();
 
 // Load
 
-	case 0x70: // LD (HL),B
-	case 0x71: // LD (HL),C
-	case 0x72: // LD (HL),D
-	case 0x73: // LD (HL),E
-	case 0x74: // LD (HL),H
-	case 0x75: // LD (HL),L
-	case 0x77: // LD (HL),A
+	OP_CASE( 0x70 ): // LD (HL),B
+	OP_CASE( 0x71 ): // LD (HL),C
+	OP_CASE( 0x72 ): // LD (HL),D
+	OP_CASE( 0x73 ): // LD (HL),E
+	OP_CASE( 0x74 ): // LD (HL),H
+	OP_CASE( 0x75 ): // LD (HL),L
+	OP_CASE( 0x77 ): // LD (HL),A
 		op = R8( op & 7 );
 	write_hl_op_ff:
 		WRITE( rp.hl, op & 0xFF );
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: // LD r,r
-	case 0x48: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F:
-	case 0x50: case 0x51: case 0x53: case 0x54: case 0x55: case 0x57:
-	case 0x58: case 0x59: case 0x5A: case 0x5C: case 0x5D: case 0x5F:
-	case 0x60: case 0x61: case 0x62: case 0x63: case 0x65: case 0x67:
-	case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6F:
-	case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D:
+	OP_CASE( 0x41 ): OP_CASE( 0x42 ): OP_CASE( 0x43 ): OP_CASE( 0x44 ): OP_CASE( 0x45 ): // LD r,r
+	OP_CASE( 0x47 ):
+	OP_CASE( 0x48 ): OP_CASE( 0x4A ): OP_CASE( 0x4B ): OP_CASE( 0x4C ): OP_CASE( 0x4D ):
+	OP_CASE( 0x4F ):
+	OP_CASE( 0x50 ): OP_CASE( 0x51 ): OP_CASE( 0x53 ): OP_CASE( 0x54 ): OP_CASE( 0x55 ):
+	OP_CASE( 0x57 ):
+	OP_CASE( 0x58 ): OP_CASE( 0x59 ): OP_CASE( 0x5A ): OP_CASE( 0x5C ): OP_CASE( 0x5D ):
+	OP_CASE( 0x5F ):
+	OP_CASE( 0x60 ): OP_CASE( 0x61 ): OP_CASE( 0x62 ): OP_CASE( 0x63 ): OP_CASE( 0x65 ):
+	OP_CASE( 0x67 ):
+	OP_CASE( 0x68 ): OP_CASE( 0x69 ): OP_CASE( 0x6A ): OP_CASE( 0x6B ): OP_CASE( 0x6C ):
+	OP_CASE( 0x6F ):
+	OP_CASE( 0x78 ): OP_CASE( 0x79 ): OP_CASE( 0x7A ): OP_CASE( 0x7B ): OP_CASE( 0x7C ):
+	OP_CASE( 0x7D ):
 		R8( (op >> 3) & 7 ) = R8( op & 7 );
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x08: // LD IND16,SP
+	OP_CASE( 0x08 ): // LD IND16,SP
 		data = GET_ADDR();
 		pc += 2;
 		WRITE( data, sp&0xFF );
 		data++;
 		WRITE( data, sp >> 8 );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF9: // LD SP,HL
+	OP_CASE( 0xF9 ): // LD SP,HL
 		sp = rp.hl;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x31: // LD SP,IMM
+	OP_CASE( 0x31 ): // LD SP,IMM
 		sp = GET_ADDR();
 		pc += 2;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x01: // LD BC,IMM
-	case 0x11: // LD DE,IMM
+	OP_CASE( 0x01 ): // LD BC,IMM
+	OP_CASE( 0x11 ): // LD DE,IMM
 		r16 [op >> 4] = GET_ADDR();
 		pc += 2;
-		goto loop;
+		NEXT_INSTR();
 	
 	{
 		unsigned temp;
-	case 0xE0: // LD (0xFF00+imm),A
+	OP_CASE( 0xE0 ): // LD (0xFF00+imm),A
 		temp = data | 0xFF00;
 		pc++;
 		goto write_data_rg_a;
 	
-	case 0xE2: // LD (0xFF00+C),A
+	OP_CASE( 0xE2 ): // LD (0xFF00+C),A
 		temp = rg.c | 0xFF00;
 		goto write_data_rg_a;
 
-	case 0x32: // LD (HL-),A
+	OP_CASE( 0x32 ): // LD (HL-),A
 		temp = rp.hl;
 		rp.hl = temp - 1;
 		goto write_data_rg_a;
 	
-	case 0x02: // LD (BC),A
+	OP_CASE( 0x02 ): // LD (BC),A
 		temp = rp.bc;
 		goto write_data_rg_a;
 	
-	case 0x12: // LD (DE),A
+	OP_CASE( 0x12 ): // LD (DE),A
 		temp = rp.de;
 		goto write_data_rg_a;
 	
-	case 0x22: // LD (HL+),A
+	OP_CASE( 0x22 ): // LD (HL+),A
 		temp = rp.hl;
 		rp.hl = temp + 1;
 		goto write_data_rg_a;
 		
-	case 0xEA: // LD IND16,A (common)
+	OP_CASE( 0xEA ): // LD IND16,A (common)
 		temp = GET_ADDR();
 		pc += 2;
 	write_data_rg_a:
 		WRITE( temp, rg.a );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x06: // LD B,IMM
+	OP_CASE( 0x06 ): // LD B,IMM
 		rg.b = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x0E: // LD C,IMM
+	OP_CASE( 0x0E ): // LD C,IMM
 		rg.c = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x16: // LD D,IMM
+	OP_CASE( 0x16 ): // LD D,IMM
 		rg.d = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x1E: // LD E,IMM
+	OP_CASE( 0x1E ): // LD E,IMM
 		rg.e = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x26: // LD H,IMM
+	OP_CASE( 0x26 ): // LD H,IMM
 		rg.h = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x2E: // LD L,IMM
+	OP_CASE( 0x2E ): // LD L,IMM
 		rg.l = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x36: // LD (HL),IMM
+	OP_CASE( 0x36 ): // LD (HL),IMM
 		WRITE( rp.hl, data );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x3E: // LD A,IMM
+	OP_CASE( 0x3E ): // LD A,IMM
 		rg.a = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 
 // Increment/Decrement
 
-	case 0x03: // INC BC
-	case 0x13: // INC DE
-	case 0x23: // INC HL
+	OP_CASE( 0x03 ): // INC BC
+	OP_CASE( 0x13 ): // INC DE
+	OP_CASE( 0x23 ): // INC HL
 		r16 [op >> 4]++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x33: // INC SP
+	OP_CASE( 0x33 ): // INC SP
 		sp = (sp + 1) & 0xFFFF;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x0B: // DEC BC
-	case 0x1B: // DEC DE
-	case 0x2B: // DEC HL
+	OP_CASE( 0x0B ): // DEC BC
+	OP_CASE( 0x1B ): // DEC DE
+	OP_CASE( 0x2B ): // DEC HL
 		r16 [op >> 4]--;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x3B: // DEC SP
+	OP_CASE( 0x3B ): // DEC SP
 		sp = (sp - 1) & 0xFFFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x34: // INC (HL)
+	OP_CASE( 0x34 ): // INC (HL)
 		op = rp.hl;
 		data = READ( op );
 		data++;
 		WRITE( op, data & 0xFF );
 		goto inc_comm;
 	
-	case 0x04: // INC B
-	case 0x0C: // INC C (common)
-	case 0x14: // INC D
-	case 0x1C: // INC E
-	case 0x24: // INC H
-	case 0x2C: // INC L
-	case 0x3C: // INC A
+	OP_CASE( 0x04 ): // INC B
+	OP_CASE( 0x0C ): // INC C (common)
+	OP_CASE( 0x14 ): // INC D
+	OP_CASE( 0x1C ): // INC E
+	OP_CASE( 0x24 ): // INC H
+	OP_CASE( 0x2C ): // INC L
+	OP_CASE( 0x3C ): // INC A
 		op = (op >> 3) & 7;
 		R8( op ) = data = R8( op ) + 1;
 	inc_comm:
 		flags = (flags & c_flag) | (((data & 15) - 1) & h_flag) | ((data >> 1) & z_flag);
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x35: // DEC (HL)
+	OP_CASE( 0x35 ): // DEC (HL)
 		op = rp.hl;
 		data = READ( op );
 		data--;
 		WRITE( op, data & 0xFF );
 		goto dec_comm;
 	
-	case 0x05: // DEC B
-	case 0x0D: // DEC C
-	case 0x15: // DEC D
-	case 0x1D: // DEC E
-	case 0x25: // DEC H
-	case 0x2D: // DEC L
-	case 0x3D: // DEC A
+	OP_CASE( 0x05 ): // DEC B
+	OP_CASE( 0x0D ): // DEC C
+	OP_CASE( 0x15 ): // DEC D
+	OP_CASE( 0x1D ): // DEC E
+	OP_CASE( 0x25 ): // DEC H
+	OP_CASE( 0x2D ): // DEC L
+	OP_CASE( 0x3D ): // DEC A
 		op = (op >> 3) & 7;
 		data = R8( op ) - 1;
 		R8( op ) = data;
 	dec_comm:
 		flags = (flags & c_flag) | n_flag | (((data & 15) + 0x31) & h_flag);
 		if ( data & 0xFF )
-			goto loop;
+			NEXT_INSTR();
 		flags |= z_flag;
-		goto loop;
+		NEXT_INSTR();
 
 // Add 16-bit
 
@@ -681,7 +760,7 @@ loop:
 		blargg_ulong temp; // need more than 16 bits for carry
 		unsigned prev;
 		
-	case 0xF8: // LD HL,SP+imm
+	OP_CASE( 0xF8 ): // LD HL,SP+imm
 		temp = BOOST::int8_t (data); // sign-extend to 16 bits
 		pc++;
 		flags = 0;
@@ -689,7 +768,7 @@ loop:
 		prev = sp;
 		goto add_16_hl;
 	
-	case 0xE8: // ADD SP,IMM
+	OP_CASE( 0xE8 ): // ADD SP,IMM
 		temp = BOOST::int8_t (data); // sign-extend to 16 bits
 		pc++;
 		flags = 0;
@@ -698,13 +777,13 @@ loop:
 		sp = temp & 0xFFFF;
 		goto add_16_comm;
 
-	case 0x39: // ADD HL,SP
+	OP_CASE( 0x39 ): // ADD HL,SP
 		temp = sp;
 		goto add_hl_comm;
 	
-	case 0x09: // ADD HL,BC
-	case 0x19: // ADD HL,DE
-	case 0x29: // ADD HL,HL
+	OP_CASE( 0x09 ): // ADD HL,BC
+	OP_CASE( 0x19 ): // ADD HL,DE
+	OP_CASE( 0x29 ): // ADD HL,HL
 		temp = r16 [op >> 4];
 	add_hl_comm:
 		prev = rp.hl;
@@ -715,24 +794,24 @@ loop:
 	add_16_comm:
 		flags |= (temp >> 12) & c_flag;
 		flags |= (((temp & 0x0FFF) - (prev & 0x0FFF)) >> 7) & h_flag;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x86: // ADD (HL)
+	OP_CASE( 0x86 ): // ADD (HL)
 		data = READ( rp.hl );
 		goto add_comm;
 	
-	case 0x80: // ADD B
-	case 0x81: // ADD C
-	case 0x82: // ADD D
-	case 0x83: // ADD E
-	case 0x84: // ADD H
-	case 0x85: // ADD L
-	case 0x87: // ADD A
+	OP_CASE( 0x80 ): // ADD B
+	OP_CASE( 0x81 ): // ADD C
+	OP_CASE( 0x82 ): // ADD D
+	OP_CASE( 0x83 ): // ADD E
+	OP_CASE( 0x84 ): // ADD H
+	OP_CASE( 0x85 ): // ADD L
+	OP_CASE( 0x87 ): // ADD A
 		data = R8( op & 7 );
 		goto add_comm;
 	
-	case 0xC6: // ADD IMM
+	OP_CASE( 0xC6 ): // ADD IMM
 		pc++;
 	add_comm:
 		flags = rg.a;
@@ -741,48 +820,48 @@ loop:
 		flags |= (data >> 4) & c_flag;
 		rg.a = data;
 		if ( data & 0xFF )
-			goto loop;
+			NEXT_INSTR();
 		flags |= z_flag;
-		goto loop;
+		NEXT_INSTR();
 
 // Add/Subtract
 
-	case 0x8E: // ADC (HL)
+	OP_CASE( 0x8E ): // ADC (HL)
 		data = READ( rp.hl );
 		goto adc_comm;
 	
-	case 0x88: // ADC B
-	case 0x89: // ADC C
-	case 0x8A: // ADC D
-	case 0x8B: // ADC E
-	case 0x8C: // ADC H
-	case 0x8D: // ADC L
-	case 0x8F: // ADC A
+	OP_CASE( 0x88 ): // ADC B
+	OP_CASE( 0x89 ): // ADC C
+	OP_CASE( 0x8A ): // ADC D
+	OP_CASE( 0x8B ): // ADC E
+	OP_CASE( 0x8C ): // ADC H
+	OP_CASE( 0x8D ): // ADC L
+	OP_CASE( 0x8F ): // ADC A
 		data = R8( op & 7 );
 		goto adc_comm;
 	
-	case 0xCE: // ADC IMM
+	OP_CASE( 0xCE ): // ADC IMM
 		pc++;
 	adc_comm:
 		data += (flags >> 4) & 1;
 		data &= 0xFF; // to do: does carry get set when sum + carry = 0x100?
 		goto add_comm;
 
-	case 0x96: // SUB (HL)
+	OP_CASE( 0x96 ): // SUB (HL)
 		data = READ( rp.hl );
 		goto sub_comm;
 	
-	case 0x90: // SUB B
-	case 0x91: // SUB C
-	case 0x92: // SUB D
-	case 0x93: // SUB E
-	case 0x94: // SUB H
-	case 0x95: // SUB L
-	case 0x97: // SUB A
+	OP_CASE( 0x90 ): // SUB B
+	OP_CASE( 0x91 ): // SUB C
+	OP_CASE( 0x92 ): // SUB D
+	OP_CASE( 0x93 ): // SUB E
+	OP_CASE( 0x94 ): // SUB H
+	OP_CASE( 0x95 ): // SUB L
+	OP_CASE( 0x97 ): // SUB A
 		data = R8( op & 7 );
 		goto sub_comm;
 	
-	case 0xD6: // SUB IMM
+	OP_CASE( 0xD6 ): // SUB IMM
 		pc++;
 	sub_comm:
 		op = rg.a;
@@ -790,21 +869,21 @@ loop:
 		rg.a = data;
 		goto sub_set_flags;
 
-	case 0x9E: // SBC (HL)
+	OP_CASE( 0x9E ): // SBC (HL)
 		data = READ( rp.hl );
 		goto sbc_comm;
 	
-	case 0x98: // SBC B
-	case 0x99: // SBC C
-	case 0x9A: // SBC D
-	case 0x9B: // SBC E
-	case 0x9C: // SBC H
-	case 0x9D: // SBC L
-	case 0x9F: // SBC A
+	OP_CASE( 0x98 ): // SBC B
+	OP_CASE( 0x99 ): // SBC C
+	OP_CASE( 0x9A ): // SBC D
+	OP_CASE( 0x9B ): // SBC E
+	OP_CASE( 0x9C ): // SBC H
+	OP_CASE( 0x9D ): // SBC L
+	OP_CASE( 0x9F ): // SBC A
 		data = R8( op & 7 );
 		goto sbc_comm;
 	
-	case 0xDE: // SBC IMM
+	OP_CASE( 0xDE ): // SBC IMM
 		pc++;
 	sbc_comm:
 		data += (flags >> 4) & 1;
@@ -813,226 +892,226 @@ loop:
 
 // Logical
 
-	case 0xA0: // AND B
-	case 0xA1: // AND C
-	case 0xA2: // AND D
-	case 0xA3: // AND E
-	case 0xA4: // AND H
-	case 0xA5: // AND L
+	OP_CASE( 0xA0 ): // AND B
+	OP_CASE( 0xA1 ): // AND C
+	OP_CASE( 0xA2 ): // AND D
+	OP_CASE( 0xA3 ): // AND E
+	OP_CASE( 0xA4 ): // AND H
+	OP_CASE( 0xA5 ): // AND L
 		data = R8( op & 7 );
 		goto and_comm;
 	
-	case 0xA6: // AND (HL)
+	OP_CASE( 0xA6 ): // AND (HL)
 		data = READ( rp.hl );
 		pc--;
-	case 0xE6: // AND IMM
+	OP_CASE( 0xE6 ): // AND IMM
 		pc++;
 	and_comm:
 		rg.a &= data;
-	case 0xA7: // AND A
+	OP_CASE( 0xA7 ): // AND A
 		flags = h_flag | (((rg.a - 1) >> 1) & z_flag);
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xB0: // OR B
-	case 0xB1: // OR C
-	case 0xB2: // OR D
-	case 0xB3: // OR E
-	case 0xB4: // OR H
-	case 0xB5: // OR L
+	OP_CASE( 0xB0 ): // OR B
+	OP_CASE( 0xB1 ): // OR C
+	OP_CASE( 0xB2 ): // OR D
+	OP_CASE( 0xB3 ): // OR E
+	OP_CASE( 0xB4 ): // OR H
+	OP_CASE( 0xB5 ): // OR L
 		data = R8( op & 7 );
 		goto or_comm;
 	
-	case 0xB6: // OR (HL)
+	OP_CASE( 0xB6 ): // OR (HL)
 		data = READ( rp.hl );
 		pc--;
-	case 0xF6: // OR IMM
+	OP_CASE( 0xF6 ): // OR IMM
 		pc++;
 	or_comm:
 		rg.a |= data;
-	case 0xB7: // OR A
+	OP_CASE( 0xB7 ): // OR A
 		flags = ((rg.a - 1) >> 1) & z_flag;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xA8: // XOR B
-	case 0xA9: // XOR C
-	case 0xAA: // XOR D
-	case 0xAB: // XOR E
-	case 0xAC: // XOR H
-	case 0xAD: // XOR L
+	OP_CASE( 0xA8 ): // XOR B
+	OP_CASE( 0xA9 ): // XOR C
+	OP_CASE( 0xAA ): // XOR D
+	OP_CASE( 0xAB ): // XOR E
+	OP_CASE( 0xAC ): // XOR H
+	OP_CASE( 0xAD ): // XOR L
 		data = R8( op & 7 );
 		goto xor_comm;
 	
-	case 0xAE: // XOR (HL)
+	OP_CASE( 0xAE ): // XOR (HL)
 		data = READ( rp.hl );
 		pc--;
-	case 0xEE: // XOR IMM
+	OP_CASE( 0xEE ): // XOR IMM
 		pc++;
 	xor_comm:
 		data ^= rg.a;
 		rg.a = data;
 		data--;
 		flags = (data >> 1) & z_flag;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xAF: // XOR A
+	OP_CASE( 0xAF ): // XOR A
 		rg.a = 0;
 		flags = z_flag;
-		goto loop;
+		NEXT_INSTR();
 
 // Stack
 
-	case 0xF1: // POP FA
-	case 0xC1: // POP BC
-	case 0xD1: // POP DE
-	case 0xE1: // POP HL (common)
+	OP_CASE( 0xF1 ): // POP FA
+	OP_CASE( 0xC1 ): // POP BC
+	OP_CASE( 0xD1 ): // POP DE
+	OP_CASE( 0xE1 ): // POP HL (common)
 		data = READ( sp );
 		r16 [(op >> 4) & 3] = data + 0x100 * READ( sp + 1 );
 		sp = (sp + 2) & 0xFFFF;
 		if ( op != 0xF1 )
-			goto loop;
+			NEXT_INSTR();
 		flags = rg.flags & 0xF0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC5: // PUSH BC
+	OP_CASE( 0xC5 ): // PUSH BC
 		data = rp.bc;
 		goto push;
 	
-	case 0xD5: // PUSH DE
+	OP_CASE( 0xD5 ): // PUSH DE
 		data = rp.de;
 		goto push;
 	
-	case 0xE5: // PUSH HL
+	OP_CASE( 0xE5 ): // PUSH HL
 		data = rp.hl;
 		goto push;
 	
-	case 0xF5: // PUSH FA
+	OP_CASE( 0xF5 ): // PUSH FA
 		data = (flags << 8) | rg.a;
 		goto push;
 
 // Flow control
 	
-	case 0xFF:
+	OP_CASE( 0xFF ):
 		if ( pc == idle_addr + 1 )
 			goto stop;
-	case 0xC7: case 0xCF: case 0xD7: case 0xDF:  // RST
-	case 0xE7: case 0xEF: case 0xF7:
+	OP_CASE( 0xC7 ): OP_CASE( 0xCF ): OP_CASE( 0xD7 ): OP_CASE( 0xDF ):  // RST
+	OP_CASE( 0xE7 ): OP_CASE( 0xEF ): OP_CASE( 0xF7 ):
 		data = pc;
 		pc = (op & 0x38) + rst_base;
 		goto push;
 	
-	case 0xCC: // CZ
+	OP_CASE( 0xCC ): // CZ
 		pc += 2;
 		if ( flags & z_flag )
 			goto call;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD4: // CNC
+	OP_CASE( 0xD4 ): // CNC
 		pc += 2;
 		if ( !(flags & c_flag) )
 			goto call;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xDC: // CC
+	OP_CASE( 0xDC ): // CC
 		pc += 2;
 		if ( flags & c_flag )
 			goto call;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xD9: // RETI
+	OP_CASE( 0xD9 ): // RETI
 		//interrupts_enabled = 1;
 		goto ret;
 	
-	case 0xC0: // RZ
+	OP_CASE( 0xC0 ): // RZ
 		if ( !(flags & z_flag) )
 			goto ret;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD0: // RNC
+	OP_CASE( 0xD0 ): // RNC
 		if ( !(flags & c_flag) )
 			goto ret;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD8: // RC
+	OP_CASE( 0xD8 ): // RC
 		if ( flags & c_flag )
 			goto ret;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x18: // JR
+	OP_CASE( 0x18 ): // JR
 		BRANCH( true )
 	
-	case 0x30: // JR NC
+	OP_CASE( 0x30 ): // JR NC
 		BRANCH( !(flags & c_flag) )
 	
-	case 0x38: // JR C
+	OP_CASE( 0x38 ): // JR C
 		BRANCH( flags & c_flag )
 	
-	case 0xE9: // JP_HL
+	OP_CASE( 0xE9 ): // JP_HL
 		pc = rp.hl;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xC3: // JP (next-most-common)
+	OP_CASE( 0xC3 ): // JP (next-most-common)
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC2: // JP NZ
+	OP_CASE( 0xC2 ): // JP NZ
 		pc += 2;
 		if ( !(flags & z_flag) )
 			goto jp_taken;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xCA: // JP Z (most common)
+	OP_CASE( 0xCA ): // JP Z (most common)
 		pc += 2;
 		if ( !(flags & z_flag) )
-			goto loop;
+			NEXT_INSTR();
 	jp_taken:
 		pc -= 2;
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD2: // JP NC
+	OP_CASE( 0xD2 ): // JP NC
 		pc += 2;
 		if ( !(flags & c_flag) )
 			goto jp_taken;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xDA: // JP C
+	OP_CASE( 0xDA ): // JP C
 		pc += 2;
 		if ( flags & c_flag )
 			goto jp_taken;
-		goto loop;
+		NEXT_INSTR();
 
 // Flags
 
-	case 0x2F: // CPL
+	OP_CASE( 0x2F ): // CPL
 		rg.a = ~rg.a;
 		flags |= n_flag | h_flag;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x3F: // CCF
+	OP_CASE( 0x3F ): // CCF
 		flags = (flags ^ c_flag) & ~(n_flag | h_flag);
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x37: // SCF
+	OP_CASE( 0x37 ): // SCF
 		flags = (flags | c_flag) & ~(n_flag | h_flag);
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xF3: // DI
+	OP_CASE( 0xF3 ): // DI
 		//interrupts_enabled = 0;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xFB: // EI
+	OP_CASE( 0xFB ): // EI
 		//interrupts_enabled = 1;
-		goto loop;
+		NEXT_INSTR();
 
 // Special
 
-	case 0xDD: case 0xD3: case 0xDB: case 0xE3: case 0xE4: // ?
-	case 0xEB: case 0xEC: case 0xF4: case 0xFD: case 0xFC:
-	case 0x10: // STOP
-	case 0x27: // DAA (I'll have to implement this eventually...)
-	case 0xBF:
-	case 0xED: // Z80 prefix
-	case 0x76: // HALT
+	OP_CASE( 0xDD ): OP_CASE( 0xD3 ): OP_CASE( 0xDB ): OP_CASE( 0xE3 ): OP_CASE( 0xE4 ): // ?
+	OP_CASE( 0xEB ): OP_CASE( 0xEC ): OP_CASE( 0xF4 ): OP_CASE( 0xFD ): OP_CASE( 0xFC ):
+	OP_CASE( 0x10 ): // STOP
+	OP_CASE( 0x27 ): // DAA (I'll have to implement this eventually...)
+	OP_CASE( 0xBF ):
+	OP_CASE( 0xED ): // Z80 prefix
+	OP_CASE( 0x76 ): // HALT
 		s.remain++;
 		goto stop;
 	}
@@ -56,14 +56,22 @@ public:
 	// illegal instruction is encountered.
 	bool run( blargg_long count );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Number of clock cycles remaining for most recent run() call
 	blargg_long remain() const { return state->remain * clocks_per_instr; }
 	
 	// Can read this many bytes past end of a page
 	enum { cpu_padding = 8 };
 	
+	// Save/load registers, memory map and timing (see blargg_copy_func_t). Must
+	// not be called during run(). Memory map holds pointers, so state can only be
+	// loaded back into the same emulator.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
-	Gb_Cpu() : rst_base( 0 ) { state = &state_; }
+	Gb_Cpu() : rst_base( 0 ), instr_count_( 0 ) { state = &state_; }
 	enum { page_shift = 13 };
 	enum { page_count = 0x10000 >> page_shift };
 private:
@@ -77,6 +85,7 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	
 	void set_code_page( int, uint8_t* );
 };
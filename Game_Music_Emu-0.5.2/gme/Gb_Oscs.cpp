@@ -23,6 +23,7 @@ void Gb_Osc::reset()
 {
 	delay = 0;
 	last_amp = 0;
+	span_error = 0;
 	length = 0;
 	output_select = 3;
 	output = outputs [output_select];
@@ -122,13 +123,23 @@ void Gb_Square::run( blip_time_t time, blip_time_t end_time, int playing )
 		amp = -amp;
 	
 	int frequency = this->frequency();
+	int const period = (2048 - frequency) * 4;
+	bool average = false;
 	if ( unsigned (frequency - 1) > 2040 ) // frequency < 1 || frequency > 2041
 	{
 		// really high frequency results in DC at half volume
 		amp = volume >> 1;
 		playing = false;
 	}
+	else if ( playing && (!output || span_steps( period * 4 )) )
+	{
+		// above Nyquist frequency, band-limited output is just the average,
+		// and without output only phase needs to be kept
+		amp = volume * (duty - 4) / 4;
+		average = true;
+	}
 	
+	if ( output )
 	{
 		int delta = amp - last_amp;
 		if ( delta )
@@ -142,9 +153,15 @@ void Gb_Square::run( blip_time_t time, blip_time_t end_time, int playing )
 	if ( !playing )
 		time = end_time;
 	
-	if ( time < end_time )
+	if ( time < end_time && average )
+	{
+		// keep calculating phase
+		int count = (end_time - time + period - 1) / period;
+		phase = (phase + count) & 7;
+		time += count * period;
+	}
+	else if ( time < end_time )
 	{
-		int const period = (2048 - frequency) * 4;
 		Blip_Buffer* const output = this->output;
 		int phase = this->phase;
 		int delta = amp * 2;
@@ -168,6 +185,8 @@ void Gb_Square::run( blip_time_t time, blip_time_t end_time, int playing )
 
 // Gb_Noise
 
+static unsigned char const noise_periods [8] = { 8, 16, 32, 48, 64, 80, 96, 112 };
+
 void Gb_Noise::run( blip_time_t time, blip_time_t end_time, int playing )
 {
 	int amp = volume & playing;
@@ -175,6 +194,7 @@ void Gb_Noise::run( blip_time_t time, blip_time_t end_time, int playing )
 	if ( bits >> tap & 2 )
 		amp = -amp;
 	
+	if ( output )
 	{
 		int delta = amp - last_amp;
 		if ( delta )
@@ -188,10 +208,24 @@ void Gb_Noise::run( blip_time_t time, blip_time_t end_time, int playing )
 	if ( !playing )
 		time = end_time;
 	
+	if ( time < end_time && !output )
+	{
+		// keep calculating bits
+		int const period = noise_periods [regs [3] & 7] << (regs [3] >> 4);
+		unsigned bits = this->bits;
+		do
+		{
+			unsigned changed = (bits >> tap) + 1;
+			time += period;
+			bits = (bits << 1) | (changed >> 1 & 1);
+		}
+		while ( time < end_time );
+		this->bits = bits;
+	}
+	
 	if ( time < end_time )
 	{
-		static unsigned char const table [8] = { 8, 16, 32, 48, 64, 80, 96, 112 };
-		int period = table [regs [3] & 7] << (regs [3] >> 4);
+		int period = noise_periods [regs [3] & 7] << (regs [3] >> 4);
 		
 		// keep parallel resampled time to eliminate time conversion in the loop
 		Blip_Buffer* const output = this->output;
@@ -201,23 +235,61 @@ void Gb_Noise::run( blip_time_t time, blip_time_t end_time, int playing )
 		unsigned bits = this->bits;
 		int delta = amp * 2;
 		
-		do
+		int const steps = span_steps( period );
+		if ( steps >= 2 )
 		{
-			unsigned changed = (bits >> tap) + 1;
-			time += period;
-			bits <<= 1;
-			if ( changed & 2 )
+			// output average of each sample's worth of steps rather than
+			// every transition
+			int const vol = volume & playing;
+			int error = span_error;
+			do
 			{
-				delta = -delta;
-				bits |= 1;
-				synth->offset_resampled( resampled_time, delta, output );
+				// count steps with output low, without branching
+				int low = 0;
+				int n = 0;
+				do
+				{
+					unsigned changed = (bits >> tap) + 1;
+					time += period;
+					bits = (bits << 1) | (changed >> 1 & 1);
+					low += bits >> tap & 2;
+				}
+				while ( ++n < steps && time < end_time );
+				
+				int sum = vol * (n - low) + error;
+				int avg = sum / n;
+				error = sum - avg * n;
+				if ( avg != last_amp )
+				{
+					synth->offset_resampled( resampled_time, avg - last_amp, output );
+					last_amp = avg;
+				}
+				resampled_time += resampled_period * n;
 			}
-			resampled_time += resampled_period;
+			while ( time < end_time );
+			
+			span_error = error;
+		}
+		else
+		{
+			do
+			{
+				unsigned changed = (bits >> tap) + 1;
+				time += period;
+				bits <<= 1;
+				if ( changed & 2 )
+				{
+					delta = -delta;
+					bits |= 1;
+					synth->offset_resampled( resampled_time, delta, output );
+				}
+				resampled_time += resampled_period;
+			}
+			while ( time < end_time );
+			
+			last_amp = delta >> 1;
 		}
-		while ( time < end_time );
-		
 		this->bits = bits;
-		last_amp = delta >> 1;
 	}
 	delay = time - end_time;
 }
@@ -267,7 +339,7 @@ void Gb_Wave::run( blip_time_t time, blip_time_t end_time, int playing )
 		}
 		
 		int delta = amp - last_amp;
-		if ( delta )
+		if ( delta && output )
 		{
 			last_amp = amp;
 			synth->offset( time, delta, output );
@@ -278,25 +350,67 @@ void Gb_Wave::run( blip_time_t time, blip_time_t end_time, int playing )
 	if ( !playing )
 		time = end_time;
 	
+	int const period = (2048 - frequency) * 2;
+	if ( time < end_time && !output )
+	{
+		// keep calculating position
+		int count = (end_time - time + period - 1) / period;
+		wave_pos = (wave_pos + count) & (wave_size - 1);
+		time += count * period;
+	}
+	
 	if ( time < end_time )
 	{
 		Blip_Buffer* const output = this->output;
-		int const period = (2048 - frequency) * 2;
 	 	int wave_pos = (this->wave_pos + 1) & (wave_size - 1);
 	 	
-		do
+		int const steps = span_steps( period );
+		if ( steps >= 2 )
 		{
-			int amp = (wave [wave_pos] >> volume_shift) * 2;
-			wave_pos = (wave_pos + 1) & (wave_size - 1);
-			int delta = amp - last_amp;
-			if ( delta )
+			// output average of each sample's worth of steps rather than
+			// every transition
+			int error = span_error;
+			do
 			{
-				last_amp = amp;
-				synth->offset_inline( time, delta, output );
+				blip_time_t const start = time;
+				int sum = error;
+				int n = 0;
+				do
+				{
+					sum += (wave [wave_pos] >> volume_shift) * 2;
+					wave_pos = (wave_pos + 1) & (wave_size - 1);
+					time += period;
+				}
+				while ( ++n < steps && time < end_time );
+				
+				int avg = sum / n;
+				error = sum - avg * n;
+				if ( avg != last_amp )
+				{
+					synth->offset_inline( start, avg - last_amp, output );
+					last_amp = avg;
+				}
 			}
-			time += period;
+			while ( time < end_time );
+			
+			span_error = error;
+		}
+		else
+		{
+			do
+			{
+				int amp = (wave [wave_pos] >> volume_shift) * 2;
+				wave_pos = (wave_pos + 1) & (wave_size - 1);
+				int delta = amp - last_amp;
+				if ( delta )
+				{
+					last_amp = amp;
+					synth->offset_inline( time, delta, output );
+				}
+				time += period;
+			}
+			while ( time < end_time );
 		}
-		while ( time < end_time );
 		
 		this->wave_pos = (wave_pos - 1) & (wave_size - 1);
 	}
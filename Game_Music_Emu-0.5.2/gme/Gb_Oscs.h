@@ -22,10 +22,13 @@ struct Gb_Osc
 	int volume;
 	int length;
 	int enabled;
+	bool span_rendering;
+	int span_error; // rounding error carried from last span
 	
 	void reset();
 	void clock_length();
 	int frequency() const { return (regs [4] & 7) * 0x100 + regs [3]; }
+	int span_steps( int period ) const;
 };
 
 struct Gb_Env : Gb_Osc
@@ -74,6 +77,15 @@ struct Gb_Wave : Gb_Osc
 	void run( blip_time_t, blip_time_t, int playing );
 };
 
+// Number of whole periods in one output sample, or 0 if span rendering is disabled
+inline int Gb_Osc::span_steps( int period ) const
+{
+	if ( !span_rendering )
+		return 0;
+	blip_resampled_time_t const sample = (blip_resampled_time_t) 1 << BLIP_BUFFER_ACCURACY;
+	return (int) (sample / (output->resampled_duration( period ) + 1));
+}
+
 inline void Gb_Env::reset()
 {
 	env_delay = 0;
@@ -99,7 +99,8 @@ struct Gbs_File : Gme_Info_
 static Music_Emu* new_gbs_emu () { return BLARGG_NEW Gbs_Emu ; }
 static Music_Emu* new_gbs_file() { return BLARGG_NEW Gbs_File; }
 
-gme_type_t_ const gme_gbs_type [1] = { "Game Boy", 0, &new_gbs_emu, &new_gbs_file, "GBS", 1 };
+gme_type_t_ const gme_gbs_type [1] = { "Game Boy", 0, &new_gbs_emu, &new_gbs_file, "GBS", 1,
+		gme_caps_fast_skip | gme_caps_float | gme_caps_find_loop | gme_caps_state, 4194304 };
 
 // Setup
 
@@ -235,6 +236,18 @@ blargg_err_t Gbs_Emu::start_track_( int track )
 	return 0;
 }
 
+blargg_err_t Gbs_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( cpu_time );
+	BLARGG_COPY( play_period );
+	BLARGG_COPY( next_play );
+	BLARGG_COPY( ram );
+	apu.copy_state( io, copy );
+	return 0;
+}
+
 blargg_err_t Gbs_Emu::run_clocks( blip_time_t& duration, int )
 {
 	cpu_time = 0;
@@ -260,6 +273,8 @@ blargg_err_t Gbs_Emu::run_clocks( blip_time_t& duration, int )
 				next_play += play_period;
 				cpu_jsr( get_le16( header_.play_addr ) );
 				GME_FRAME_HOOK( this );
+				if ( probing() )
+					probe_frame( clock(), ram, sizeof ram );
 				// TODO: handle timer rates different than 60 Hz
 			}
 			else if ( cpu::r.pc > 0xFFFF )
@@ -0,0 +1,311 @@
+// Game_Music_Emu 0.5.2. http://www.slack.net/~ant/
+
+#include "Gme_Batch.h"
+
+#include "blargg_thread.h"
+#include "Music_Emu.h"
+#include <string.h>
+
+/* Copyright (C) 2006 Shay Green. This module is free software; you
+can redistribute it and/or modify it under the terms of the GNU Lesser
+General Public License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version. This
+module is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+details. You should have received a copy of the GNU Lesser General Public
+License along with this module; if not, write to the Free Software Foundation,
+Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include "blargg_source.h"
+
+int const max_threads = 64;
+long const block_size = 4096; // samples passed to each output callback
+
+// File data shared by all jobs with the same path
+struct Batch_File
+{
+	const char* path;
+	int jobs_remain; // data is freed when this reaches zero
+	bool loaded;
+	blargg_err_t err;
+	gme_type_t type;
+	Mapped_File_Reader mapped;  // shared by emulators if file could be mapped
+	blargg_vector<byte> data;   // otherwise file is read into memory
+	blargg_mutex mutex;
+
+	Batch_File( const char* p ) : path( p ), jobs_remain( 0 ), loaded( false ), err( 0 ), type( 0 ) { }
+
+	blargg_err_t load();
+	void job_done();
+	BLARGG_DISABLE_NOTHROW
+private:
+	blargg_err_t load_();
+};
+
+blargg_err_t Batch_File::load_()
+{
+	void const* header = 0;
+	if ( !mapped.open( path ) )
+	{
+		if ( mapped.size() >= 4 )
+			header = mapped.data();
+	}
+	else
+	{
+		GME_FILE_READER in;
+		RETURN_ERR( in.open( path ) );
+		RETURN_ERR( data.resize( in.remain() ) );
+		RETURN_ERR( in.read( data.begin(), data.size() ) );
+		if ( data.size() >= 4 )
+			header = data.begin();
+	}
+
+	type = gme_identify_extension( path );
+	if ( !type && header )
+		type = gme_identify_extension( gme_identify_header( header ) );
+	if ( !type )
+		return gme_wrong_file_type;
+	return 0;
+}
+
+// Loads data the first time; other workers wanting the same file wait for it
+blargg_err_t Batch_File::load()
+{
+	blargg_lock lock( mutex );
+	if ( !loaded )
+	{
+		loaded = true;
+		err = load_();
+		if ( err )
+		{
+			mapped.close();
+			data.clear();
+		}
+	}
+	return err;
+}
+
+void Batch_File::job_done()
+{
+	blargg_lock lock( mutex );
+	if ( !--jobs_remain )
+	{
+		// emulators still holding this file won't be used again
+		mapped.close();
+		data.clear();
+	}
+}
+
+struct Gme_Batch
+{
+	long sample_rate;
+	gme_batch_output_t out;
+	gme_batch_done_t done;
+	void* user_data;
+
+	int job_count;
+	blargg_vector<gme_batch_job_t const*> order; // jobs sorted by path
+	blargg_vector<Batch_File*> files;            // file for each entry in order
+
+	blargg_mutex mutex;
+	int next_job; // index into order
+
+	Gme_Batch() { next_job = 0; }
+	~Gme_Batch();
+	blargg_err_t init( gme_batch_job_t const*, int count );
+	void run();
+private:
+	struct worker_t;
+	blargg_err_t render( gme_batch_job_t const&, Batch_File*, worker_t& );
+};
+
+// Emulators kept by a worker, at most one of each type. Loading a new file into
+// an existing emulator avoids constructing it again, which for short files can
+// take longer than rendering them (Spc_Emu clears and sets up 64K of SPC state,
+// and any emulator not at its native rate sets up its resampler).
+struct Gme_Batch::worker_t
+{
+	enum { max_emus = 16 };
+	Music_Emu* emus [max_emus];
+	int emu_count;
+	Music_Emu* emu;         // emulator with emu_file loaded, or NULL
+	Batch_File* emu_file;
+	short buf [block_size];
+
+	worker_t() : emu_count( 0 ), emu( 0 ), emu_file( 0 ) { }
+	~worker_t();
+	Music_Emu* find_emu( gme_type_t, long sample_rate );
+};
+
+Gme_Batch::worker_t::~worker_t()
+{
+	for ( int i = 0; i < emu_count; i++ )
+		delete emus [i];
+}
+
+// Emulator of given type, creating it if worker doesn't have one yet
+Music_Emu* Gme_Batch::worker_t::find_emu( gme_type_t type, long sample_rate )
+{
+	for ( int i = 0; i < emu_count; i++ )
+		if ( emus [i]->type() == type )
+			return emus [i];
+
+	Music_Emu* e = gme_new_emu( type, sample_rate );
+	if ( e )
+	{
+		if ( emu_count >= max_emus )
+			delete emus [--emu_count];
+		emus [emu_count++] = e;
+	}
+	return e;
+}
+
+static int compare_jobs( const void* x, const void* y )
+{
+	gme_batch_job_t const* a = *(gme_batch_job_t const* const*) x;
+	gme_batch_job_t const* b = *(gme_batch_job_t const* const*) y;
+	int diff = strcmp( a->path, b->path );
+	if ( !diff )
+		diff = (a > b) - (a < b); // keep caller's order for tracks of same file
+	return diff;
+}
+
+blargg_err_t Gme_Batch::init( gme_batch_job_t const* jobs, int count )
+{
+	job_count = count;
+	RETURN_ERR( order.resize( count ) );
+	RETURN_ERR( files.resize( count ) );
+	memset( files.begin(), 0, count * sizeof files [0] );
+
+	for ( int i = 0; i < count; i++ )
+		order [i] = &jobs [i];
+	qsort( order.begin(), count, sizeof order [0], compare_jobs );
+
+	Batch_File* file = 0;
+	for ( int i = 0; i < count; i++ )
+	{
+		if ( !file || strcmp( file->path, order [i]->path ) )
+		{
+			file = BLARGG_NEW Batch_File( order [i]->path );
+			CHECK_ALLOC( file );
+		}
+		file->jobs_remain++;
+		files [i] = file;
+	}
+	return 0;
+}
+
+Gme_Batch::~Gme_Batch()
+{
+	for ( int i = 0; i < (int) files.size(); i++ )
+	{
+		if ( files [i] && (i + 1 == (int) files.size() || files [i + 1] != files [i]) )
+			delete files [i];
+	}
+}
+
+blargg_err_t Gme_Batch::render( gme_batch_job_t const& job, Batch_File* file, worker_t& w )
+{
+	// keep loaded file if previous job was for same file
+	if ( w.emu_file != file )
+	{
+		w.emu = 0;
+		w.emu_file = 0;
+
+		RETURN_ERR( file->load() );
+		Music_Emu* emu = w.find_emu( file->type, sample_rate );
+		CHECK_ALLOC( emu );
+		if ( file->mapped.is_open() )
+			RETURN_ERR( emu->load_mapped( file->mapped ) );
+		else
+			RETURN_ERR( emu->load_mem( file->data.begin(), file->data.size() ) );
+		w.emu = emu;
+		w.emu_file = file;
+	}
+	Music_Emu* emu = w.emu;
+
+	long length = job.length_msec;
+	if ( length <= 0 )
+	{
+		track_info_t info;
+		RETURN_ERR( emu->track_info( &info, job.track ) );
+		length = info.length;
+		if ( length <= 0 && info.loop_length > 0 )
+			length = info.intro_length + info.loop_length * 2;
+		if ( length <= 0 )
+			length = 150 * 1000L;
+	}
+
+	RETURN_ERR( emu->start_track( job.track ) );
+	emu->set_fade( length );
+	emu->clear_stats();
+	while ( !emu->track_ended() )
+	{
+		RETURN_ERR( emu->play( block_size, w.buf ) );
+		RETURN_ERR( out( user_data, &job, w.buf, block_size ) );
+	}
+	gme_record_cost( emu );
+	return 0;
+}
+
+void Gme_Batch::run()
+{
+	worker_t w;
+
+	for ( ;; )
+	{
+		int i;
+		{
+			blargg_lock lock( mutex );
+			if ( next_job >= job_count )
+				break;
+			i = next_job++;
+		}
+
+		blargg_err_t err = render( *order [i], files [i], w );
+		files [i]->job_done();
+
+		if ( done )
+			done( user_data, order [i], err );
+	}
+}
+
+static void batch_thread( void* batch ) { STATIC_CAST(Gme_Batch*,batch)->run(); }
+
+gme_err_t gme_render_batch( gme_batch_job_t const jobs [], int job_count, long sample_rate,
+		int thread_count, gme_batch_output_t out, gme_batch_done_t done, void* user_data )
+{
+	require( (jobs || !job_count) && out );
+	require( sample_rate > 0 ); // gme_info_only can't be rendered
+
+	Gme_Batch batch;
+	batch.sample_rate = sample_rate;
+	batch.out         = out;
+	batch.done        = done;
+	batch.user_data   = user_data;
+	RETURN_ERR( batch.init( jobs, job_count ) );
+
+	if ( thread_count <= 0 )
+		thread_count = blargg_thread::cpu_count();
+	if ( thread_count > job_count )
+		thread_count = job_count;
+	if ( thread_count > max_threads )
+		thread_count = max_threads;
+
+	// calling thread is first worker; if a thread can't be created, the others
+	// still finish all jobs
+	blargg_thread threads [max_threads];
+	for ( int i = 1; i < thread_count; i++ )
+	{
+		if ( threads [i].start( batch_thread, &batch ) )
+			break;
+	}
+
+	batch.run();
+
+	for ( int i = 1; i < thread_count; i++ )
+		threads [i].join();
+
+	return 0;
+}
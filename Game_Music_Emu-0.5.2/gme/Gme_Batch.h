@@ -0,0 +1,46 @@
+/* Multi-threaded rendering of many tracks to PCM (also usable from C++) */
+
+/* Game_Music_Emu 0.5.2 */
+#ifndef GME_BATCH_H
+#define GME_BATCH_H
+
+#include "gme.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* One track to render */
+typedef struct gme_batch_job_t
+{
+	const char* path;   /* music file; jobs with the same path share its loaded data */
+	int track;          /* 0 is the first track */
+	long length_msec;   /* time to begin fade, or <= 0 to use track info (see gme.txt) */
+	void* user_data;    /* for your use */
+} gme_batch_job_t;
+
+/* Receives the next 'count' interleaved stereo samples of a job. Return an error
+string to abandon the job. Called from worker threads, so different jobs are
+delivered concurrently, though a given job's samples always arrive in order. */
+typedef gme_err_t (*gme_batch_output_t)( void* your_data, gme_batch_job_t const*,
+		short const* samples, long count );
+
+/* Called from worker thread once a job has finished, with NULL if successful or
+the error that ended it */
+typedef void (*gme_batch_done_t)( void* your_data, gme_batch_job_t const*, gme_err_t );
+
+/* Render jobs with thread_count workers (0 for one per processor), each using its
+own emulators, and return once all have finished. A worker keeps one emulator of each
+type and loads later files of that type into it rather than creating another. Jobs are started in order of path,
+so each file is read once and released when the last job using it finishes. The
+calling thread is used as one of the workers. Returns an error only if rendering
+couldn't be started; errors in individual jobs are reported to 'done', which can
+be NULL. */
+gme_err_t gme_render_batch( gme_batch_job_t const jobs [], int job_count, long sample_rate,
+		int thread_count, gme_batch_output_t, gme_batch_done_t, void* your_data );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
@@ -33,6 +33,7 @@ void Gme_File::unload()
 	track_count_     = 0;
 	raw_track_count_ = 0;
 	file_data.clear();
+	mapped_file.close();
 }
 
 Gme_File::Gme_File()
@@ -59,6 +60,9 @@ blargg_err_t Gme_File::load_mem_( byte const* data, long size )
 
 blargg_err_t Gme_File::load_( Data_Reader& in )
 {
+	if ( &in == &mapped_file )
+		return load_mem_( (byte const*) mapped_file.data(), mapped_file.size() );
+	
 	RETURN_ERR( file_data.resize( in.remain() ) );
 	RETURN_ERR( in.read( file_data.begin(), file_data.size() ) );
 	return load_mem_( file_data.begin(), file_data.size() );
@@ -96,12 +100,38 @@ blargg_err_t Gme_File::load( Data_Reader& in )
 	return post_load( load_( in ) );
 }
 
-blargg_err_t Gme_File::load_file( const char* path )
+blargg_err_t Gme_File::load_mapped_()
+{
+	blargg_err_t err = load_( mapped_file );
+	
+	// emulators that override load_() read the data into their own memory
+	if ( mapped_file.tell() )
+		mapped_file.close();
+	
+	return err;
+}
+
+blargg_err_t Gme_File::load_mapped( Mapped_File_Reader const& in )
 {
 	pre_load();
+	mapped_file.open( in );
+	return post_load( load_mapped_() );
+}
+
+blargg_err_t Gme_File::load_file_( const char* path )
+{
+	if ( !mapped_file.open( path ) )
+		return load_mapped_();
+	
 	GME_FILE_READER in;
 	RETURN_ERR( in.open( path ) );
-	return post_load( load_( in ) );
+	return load_( in );
+}
+
+blargg_err_t Gme_File::load_file( const char* path )
+{
+	pre_load();
+	return post_load( load_file_( path ) );
 }
 
 blargg_err_t Gme_File::load_remaining_( void const* h, long s, Data_Reader& in )
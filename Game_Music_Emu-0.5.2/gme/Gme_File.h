@@ -20,9 +20,14 @@ public:
 	// file is wrong type or is seriously corrupt. They also set warning
 	// string for minor problems.
 	
-	// Load from file on disk
+	// Load from file on disk. The file is mapped into memory where possible, so
+	// emulators that play directly from the file's data don't copy it.
 	blargg_err_t load_file( const char* path );
 	
+	// Load from file already mapped into memory, sharing the mapping rather than
+	// making another (see Data_Reader.h)
+	blargg_err_t load_mapped( Mapped_File_Reader const& );
+	
 	// Load from custom data source (see Data_Reader.h)
 	blargg_err_t load( Data_Reader& );
 	
@@ -85,6 +90,7 @@ protected:
 	virtual void unload();  // called before loading file and if loading fails
 	virtual blargg_err_t load_( Data_Reader& ); // default loads then calls load_mem_()
 	virtual blargg_err_t load_mem_( byte const* data, long size ); // use data in memory
+	virtual blargg_err_t load_file_( const char* path ); // default maps or reads file
 	virtual blargg_err_t track_info_( track_info_t* out, int track ) const = 0;
 	virtual void pre_load();
 	virtual void post_load_();
@@ -106,7 +112,9 @@ private:
 	M3u_Playlist playlist;
 	char playlist_warning [64];
 	blargg_vector<byte> file_data; // only if loaded into memory using default load
+	Mapped_File_Reader mapped_file; // only if data is used directly from mapped file
 	
+	blargg_err_t load_mapped_();
 	blargg_err_t load_m3u_( blargg_err_t );
 	blargg_err_t post_load( blargg_err_t err );
 public:
@@ -0,0 +1,201 @@
+// Game_Music_Emu 0.5.2. http://www.slack.net/~ant/
+
+#include "Gme_Index.h"
+
+#include "blargg_thread.h"
+#include "Music_Emu.h"
+#include <string.h>
+
+/* Copyright (C) 2006 Shay Green. This module is free software; you
+can redistribute it and/or modify it under the terms of the GNU Lesser
+General Public License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version. This
+module is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+details. You should have received a copy of the GNU Lesser General Public
+License along with this module; if not, write to the Free Software Foundation,
+Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include "blargg_source.h"
+
+int const max_threads = 64;
+
+// Info readers of one worker, kept from file to file of the same type
+struct Index_Worker
+{
+	enum { max_types = 32 };
+	gme_type_t types [max_types];
+	Music_Emu* infos [max_types];
+	int type_count;
+	blargg_vector<char> m3u_path;
+	track_info_t info;
+
+	Index_Worker() { type_count = 0; }
+	~Index_Worker();
+	Music_Emu* info_reader( gme_type_t );
+	BLARGG_DISABLE_NOTHROW
+};
+
+Index_Worker::~Index_Worker()
+{
+	for ( int i = 0; i < type_count; i++ )
+		delete infos [i];
+}
+
+Music_Emu* Index_Worker::info_reader( gme_type_t type )
+{
+	for ( int i = 0; i < type_count; i++ )
+		if ( types [i] == type )
+			return infos [i];
+
+	if ( type_count >= max_types )
+		return 0;
+
+	Music_Emu* emu = gme_new_emu( type, gme_info_only );
+	if ( emu )
+	{
+		types [type_count] = type;
+		infos [type_count] = emu;
+		type_count++;
+	}
+	return emu;
+}
+
+struct Gme_Index
+{
+	const char* const* paths;
+	int file_count;
+	bool use_m3u;
+	gme_index_track_t out;
+	gme_index_done_t done;
+	void* user_data;
+
+	blargg_mutex mutex;
+	int next_file;
+
+	Gme_Index() { next_file = 0; }
+	void run();
+private:
+	blargg_err_t index( int file, Index_Worker& );
+	blargg_err_t load_m3u( const char* path, Music_Emu*, Index_Worker& );
+};
+
+blargg_err_t Gme_Index::load_m3u( const char* path, Music_Emu* emu, Index_Worker& w )
+{
+	// replace extension, if any, with .m3u
+	long len = strlen( path );
+	long base = len;
+	for ( long i = len; i-- && path [i] != '/' && path [i] != '\\'; )
+	{
+		if ( path [i] == '.' )
+		{
+			base = i;
+			break;
+		}
+	}
+	RETURN_ERR( w.m3u_path.resize( base + 5 ) );
+	memcpy( w.m3u_path.begin(), path, base );
+	memcpy( w.m3u_path.begin() + base, ".m3u", 5 );
+
+	GME_FILE_READER in;
+	if ( in.open( w.m3u_path.begin() ) )
+		return 0; // no playlist
+	return emu->load_m3u( in );
+}
+
+blargg_err_t Gme_Index::index( int file, Index_Worker& w )
+{
+	const char* path = paths [file];
+	GME_FILE_READER in;
+	RETURN_ERR( in.open( path ) );
+
+	char header [4];
+	int header_size = 0;
+	gme_type_t type = gme_identify_extension( path );
+	if ( !type )
+	{
+		header_size = sizeof header;
+		RETURN_ERR( in.read( header, sizeof header ) );
+		type = gme_identify_extension( gme_identify_header( header ) );
+		if ( !type )
+			return gme_wrong_file_type;
+	}
+
+	Music_Emu* emu = w.info_reader( type );
+	CHECK_ALLOC( emu );
+
+	// optimization: avoids seeking/re-reading header
+	Remaining_Reader rem( header, header_size, &in );
+	RETURN_ERR( emu->load( rem ) );
+	in.close();
+
+	if ( use_m3u )
+		RETURN_ERR( load_m3u( path, emu, w ) );
+
+	int track_count = emu->track_count();
+	for ( int i = 0; i < track_count; i++ )
+	{
+		RETURN_ERR( emu->track_info( &w.info, i ) );
+		out( user_data, file, i, &w.info );
+	}
+	return 0;
+}
+
+void Gme_Index::run()
+{
+	Index_Worker w;
+	for ( ;; )
+	{
+		int i;
+		{
+			blargg_lock lock( mutex );
+			if ( next_file >= file_count )
+				break;
+			i = next_file++;
+		}
+
+		blargg_err_t err = index( i, w );
+		if ( done )
+			done( user_data, i, err );
+	}
+}
+
+static void index_thread( void* index ) { STATIC_CAST(Gme_Index*,index)->run(); }
+
+gme_err_t gme_index_files( const char* const paths [], int file_count, int use_m3u,
+		int thread_count, gme_index_track_t out, gme_index_done_t done, void* user_data )
+{
+	require( (paths || !file_count) && out );
+
+	Gme_Index index;
+	index.paths      = paths;
+	index.file_count = file_count;
+	index.use_m3u    = (use_m3u != 0);
+	index.out        = out;
+	index.done       = done;
+	index.user_data  = user_data;
+
+	if ( thread_count <= 0 )
+		thread_count = blargg_thread::cpu_count();
+	if ( thread_count > file_count )
+		thread_count = file_count;
+	if ( thread_count > max_threads )
+		thread_count = max_threads;
+
+	// calling thread is first worker; if a thread can't be created, the others
+	// still finish all files
+	blargg_thread threads [max_threads];
+	for ( int i = 1; i < thread_count; i++ )
+	{
+		if ( threads [i].start( index_thread, &index ) )
+			break;
+	}
+
+	index.run();
+
+	for ( int i = 1; i < thread_count; i++ )
+		threads [i].join();
+
+	return 0;
+}
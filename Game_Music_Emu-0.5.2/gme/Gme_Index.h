@@ -0,0 +1,39 @@
+/* Track information for many files at once, without emulators (also usable from C++) */
+
+/* Game_Music_Emu 0.5.2 */
+#ifndef GME_INDEX_H
+#define GME_INDEX_H
+
+#include "gme.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* Receives information for one track of paths [file]. Tracks are numbered as for
+gme_start_track(), so they follow any m3u playlist. Called from worker threads, so
+different files are delivered concurrently, though a given file's tracks always
+arrive in order. */
+typedef void (*gme_index_track_t)( void* your_data, int file, int track,
+		track_info_t const* );
+
+/* Called from worker thread once a file has been read, with NULL if successful or
+the error that ended it */
+typedef void (*gme_index_done_t)( void* your_data, int file, gme_err_t );
+
+/* Read information for all tracks of each file with thread_count workers (0 for one
+per processor), and return once all have been read. Files are read as for
+gme_info_only, but aren't mapped into memory, so only the header and any parts
+holding information are read (GD3 tags, ID666 and xid6 tags, NSFE chunks). If
+use_m3u is non-zero, each file's playlist is loaded as with gme_load_m3u() from the
+same path with .m3u in place of its extension, if there is one. The calling thread
+is used as one of the workers. Returns an error only if reading couldn't be
+started; errors for individual files are reported to 'done', which can be NULL. */
+gme_err_t gme_index_files( const char* const paths [], int file_count, int use_m3u,
+		int thread_count, gme_index_track_t, gme_index_done_t, void* your_data );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
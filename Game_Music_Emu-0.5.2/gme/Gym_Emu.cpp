@@ -161,7 +161,8 @@ struct Gym_File : Gme_Info_
 static Music_Emu* new_gym_emu () { return BLARGG_NEW Gym_Emu ; }
 static Music_Emu* new_gym_file() { return BLARGG_NEW Gym_File; }
 
-gme_type_t_ const gme_gym_type [1] = { "Sega Genesis", 1, &new_gym_emu, &new_gym_file, "GYM", 0 };
+gme_type_t_ const gme_gym_type [1] = { "Sega Genesis", 1, &new_gym_emu, &new_gym_file, "GYM", 0,
+		gme_caps_multi_chip | gme_caps_state, clock_rate };
 
 // Setup
 
@@ -184,6 +185,19 @@ blargg_err_t Gym_Emu::set_sample_rate_( long sample_rate )
 	return 0;
 }
 
+blargg_err_t Gym_Emu::change_sample_rate_( long sample_rate )
+{
+	blip_eq_t eq( -32, 8000, sample_rate );
+	apu.treble_eq( eq );
+	dac_synth.treble_eq( eq );
+	fm_sample_rate = fm_sample_rate * sample_rate / this->sample_rate();
+	
+	RETURN_ERR( blip_buf.change_sample_rate( sample_rate ) );
+	RETURN_ERR( fm.change_rate( fm_sample_rate ) );
+	return Dual_Resampler::change_rate( long (1.0 / 60 / min_tempo * sample_rate),
+			long (sample_rate / (60.0 * tempo())), oversample_factor );
+}
+
 void Gym_Emu::set_tempo_( double t )
 {
 	if ( t < min_tempo )
@@ -246,6 +260,22 @@ blargg_err_t Gym_Emu::start_track_( int track )
 	return 0;
 }
 
+blargg_err_t Gym_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( pos );
+	BLARGG_COPY( loop_begin );
+	BLARGG_COPY( loop_remain );
+	BLARGG_COPY( dac_amp );
+	BLARGG_COPY( prev_dac_count );
+	BLARGG_COPY( dac_enabled );
+	fm.copy_state( io, copy );
+	apu.copy_state( io, copy );
+	dac_synth.copy_state( io, copy );
+	blip_buf.copy_state( io, copy );
+	Dual_Resampler::copy_state( io, copy );
+	return 0;
+}
+
 void Gym_Emu::run_dac( int dac_count )
 {
 	// Guess beginning and end of sample and adjust rate and buffer position accordingly.
@@ -290,7 +320,8 @@ void Gym_Emu::run_dac( int dac_count )
 	{
 		int delta = dac_buf [i] - dac_amp;
 		dac_amp += delta;
-		dac_synth.offset_resampled( time, delta, &blip_buf );
+		if ( delta ) // samples often repeat
+			dac_synth.offset_resampled( time, delta, &blip_buf );
 		time += period;
 	}
 	this->dac_amp = dac_amp;
@@ -307,6 +338,9 @@ void Gym_Emu::parse_frame()
 	int cmd;
 	while ( (cmd = *pos++) != 0 )
 	{
+		#if GME_STATS
+			stats().apu_writes++;
+		#endif
 		int data = *pos++;
 		if ( cmd == 1 )
 		{
@@ -318,10 +352,26 @@ void Gym_Emu::parse_frame()
 				
 				fm.write0( data, data2 );
 			}
-			else if ( dac_count < (int) sizeof dac_buf )
+			else
 			{
-				dac_buf [dac_count] = data2;
-				dac_count += dac_enabled;
+				// DAC samples come in long bursts of writes to 0x2A, so take
+				// the rest of the burst here
+				int const enabled = dac_enabled;
+				while ( true )
+				{
+					if ( dac_count < (int) sizeof dac_buf )
+					{
+						dac_buf [dac_count] = data2;
+						dac_count += enabled;
+					}
+					if ( pos [0] != 1 || pos [1] != 0x2A )
+						break;
+					data2 = pos [2];
+					pos += 3;
+					#if GME_STATS
+						stats().apu_writes++;
+					#endif
+				}
 			}
 		}
 		else if ( cmd == 2 )
@@ -361,6 +411,7 @@ void Gym_Emu::parse_frame()
 
 int Gym_Emu::play_frame( blip_time_t blip_time, int sample_count, sample_t* buf )
 {
+	stats_timer_t timer( stats().emulate_msec );
 	if ( !track_ended() )
 		parse_frame();
 	
@@ -374,6 +425,19 @@ int Gym_Emu::play_frame( blip_time_t blip_time, int sample_count, sample_t* buf
 
 blargg_err_t Gym_Emu::play_( long count, sample_t* out )
 {
-	Dual_Resampler::dual_play( count, out, blip_buf );
+	#if GME_STATS
+		double emulate_msec = stats().emulate_msec;
+		blip_ulong synth_count = blip_buf.synth_count();
+	#endif
+	{
+		stats_timer_t timer( stats().mix_msec );
+		Dual_Resampler::dual_play( count, out, blip_buf );
+	}
+	#if GME_STATS
+		// play_frame() times emulation separately
+		stats().mix_msec -= stats().emulate_msec - emulate_msec;
+		stats().synth_updates += (blip_ulong) (blip_buf.synth_count() - synth_count);
+		stats().resampled_frames += count >> 1;
+	#endif
 	return 0;
 }
@@ -30,6 +30,9 @@ public:
 	// Header for currently loaded file
 	header_t const& header() const { return header_; }
 	
+	// Use faster YM2612 core. See Ym2612_Emu::enable_fast().
+	void enable_fast_fm( bool enable = true ) { fm.enable_fast( enable ); }
+	
 	static gme_type_t static_type() { return gme_gym_type; }
 	
 public:
@@ -47,10 +50,13 @@ protected:
 	blargg_err_t load_mem_( byte const*, long );
 	blargg_err_t track_info_( track_info_t*, int track ) const;
 	blargg_err_t set_sample_rate_( long sample_rate );
+	blargg_err_t change_sample_rate_( long sample_rate );
 	blargg_err_t start_track_( int );
 	blargg_err_t play_( long count, sample_t* );
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
 	void mute_voices_( int );
 	void set_tempo_( double );
+	void set_resampler_width_( int n ) { Dual_Resampler::set_width( n ); }
 	int play_frame( blip_time_t blip_time, int sample_count, sample_t* buf );
 private:
 	// sequence data begin, loop begin, current position, end
@@ -71,12 +71,14 @@ void Hes_Apu::osc_output( int index, Blip_Buffer* center, Blip_Buffer* left, Bli
 
 void Hes_Osc::run_until( synth_t& synth_, blip_time_t end_time )
 {
+	// runs even without output, so phase and noise are the same once output returns
 	Blip_Buffer* const osc_outputs_0 = outputs [0]; // cache often-used values
-	if ( osc_outputs_0 && control & 0x80 )
+	if ( control & 0x80 )
 	{
 		int dac = this->dac;
 		
 		int const volume_0 = volume [0];
+		if ( osc_outputs_0 )
 		{
 			int delta = dac * volume_0 - last_amp [0];
 			if ( delta )
@@ -115,7 +117,8 @@ void Hes_Osc::run_until( synth_t& synth_, blip_time_t end_time )
 						if ( delta )
 						{
 							dac = new_dac;
-							synth_.offset( time, delta * volume_0, osc_outputs_0 );
+							if ( osc_outputs_0 )
+								synth_.offset( time, delta * volume_0, osc_outputs_0 );
 							if ( osc_outputs_1 )
 								synth_.offset( time, delta * volume_1, osc_outputs_1 );
 						}
@@ -142,7 +145,8 @@ void Hes_Osc::run_until( synth_t& synth_, blip_time_t end_time )
 						if ( delta )
 						{
 							dac = new_dac;
-							synth_.offset( time, delta * volume_0, osc_outputs_0 );
+							if ( osc_outputs_0 )
+								synth_.offset( time, delta * volume_0, osc_outputs_0 );
 							if ( osc_outputs_1 )
 								synth_.offset( time, delta * volume_1, osc_outputs_1 );
 						}
@@ -175,8 +179,11 @@ void Hes_Osc::run_until( synth_t& synth_, blip_time_t end_time )
 		delay = time;
 		
 		this->dac = dac;
-		last_amp [0] = dac * volume_0;
-		last_amp [1] = dac * volume_1;
+		if ( osc_outputs_0 )
+		{
+			last_amp [0] = dac * volume_0;
+			last_amp [1] = dac * volume_1;
+		}
 	}
 	last_time = end_time;
 }
@@ -300,6 +307,28 @@ void Hes_Apu::write_data( blip_time_t time, int addr, int data )
 	}
 }
 
+void Hes_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( latch );
+	BLARGG_COPY( balance );
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		Hes_Osc& osc = oscs [i];
+		copy( io, &osc, offsetof (Hes_Osc,outputs) );
+		BLARGG_COPY( osc.noise_lfsr );
+		BLARGG_COPY( osc.control );
+		
+		// as balance_changed() sets them, without adjusting last_amp
+		osc.outputs [0] = osc.chans [0];
+		osc.outputs [1] = 0;
+		if ( osc.volume [0] != osc.volume [1] )
+		{
+			osc.outputs [0] = osc.chans [1];
+			osc.outputs [1] = osc.chans [2];
+		}
+	}
+}
+
 void Hes_Apu::end_frame( blip_time_t end_time )
 {
 	Hes_Osc* osc = &oscs [osc_count];
@@ -47,6 +47,10 @@ public:
 	
 	void end_frame( blip_time_t );
 	
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs and volume aren't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Hes_Apu();
 private:
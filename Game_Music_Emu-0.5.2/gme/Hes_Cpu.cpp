@@ -28,6 +28,10 @@ int const ram_addr = 0x2000;
 
 #include "hes_cpu_io.h"
 
+#ifdef HES_CPU_LOG_H
+	#undef BLARGG_COMPUTED_GOTO // log goes through loop
+#endif
+
 #include "blargg_source.h"
 
 #if BLARGG_NONPORTABLE
@@ -75,6 +79,17 @@ void Hes_Cpu::set_mmr( int reg, int bank )
 	state->code_map [reg] = code - PAGE_OFFSET( reg << page_shift );
 }
 
+void Hes_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( ram );
+	BLARGG_COPY( r );
+	BLARGG_COPY( mmr );
+	BLARGG_COPY( state_ );
+	BLARGG_COPY( irq_time_ );
+	BLARGG_COPY( end_time_ );
+}
+
 #define TIME    (s_time + s.base)
 
 #define READ( addr )            CPU_READ( this, (addr), TIME )
@@ -134,11 +149,112 @@ bool Hes_Cpu::run( hes_time_t end_time )
 		SET_STATUS( temp );
 	}
 	
+	#if BLARGG_COMPUTED_GOTO
+		// Address of code for each opcode, matching the OP_CASE labels below
+		static void* const op_table [0x100] = {
+			&&op_0x00, &&ind_x0x05, &&op_0x02, &&op_0x03,
+			&&op_0x04, &&zp0x05, &&op_0x06, &&op_0x07,
+			&&op_0x08, &&imm0x05, &&op_0x0A, &&op_default,
+			&&op_0x0C, &&abs0x05, &&op_0x0E, &&op_0x0F,
+			&&op_0x10, &&ind_y0x05, &&zp_ind0x05, &&op_0x13,
+			&&op_0x14, &&zp_x0x05, &&op_0x16, &&op_0x17,
+			&&op_0x18, &&abs_y0x05, &&op_0x1A, &&op_default,
+			&&op_0x1C, &&abs_x0x05, &&op_0x1E, &&op_0x1F,
+			&&op_0x20, &&ind_x0x25, &&op_0x22, &&op_0x23,
+			&&op_0x24, &&zp0x25, &&op_0x26, &&op_0x27,
+			&&op_0x28, &&imm0x25, &&op_0x2A, &&op_default,
+			&&op_0x2C, &&abs0x25, &&op_0x2E, &&op_0x2F,
+			&&op_0x30, &&ind_y0x25, &&zp_ind0x25, &&op_default,
+			&&op_0x34, &&zp_x0x25, &&op_0x36, &&op_0x37,
+			&&op_0x38, &&abs_y0x25, &&op_0x3A, &&op_default,
+			&&op_0x3C, &&abs_x0x25, &&op_0x3E, &&op_0x3F,
+			&&op_0x40, &&ind_x0x45, &&op_0x42, &&op_0x43,
+			&&op_0x44, &&zp0x45, &&op_0x46, &&op_0x47,
+			&&op_0x48, &&imm0x45, &&op_0x4A, &&op_default,
+			&&op_0x4C, &&abs0x45, &&op_0x4E, &&op_0x4F,
+			&&op_0x50, &&ind_y0x45, &&zp_ind0x45, &&op_0x53,
+			&&op_0x54, &&zp_x0x45, &&op_0x56, &&op_0x57,
+			&&op_0x58, &&abs_y0x45, &&op_0x5A, &&op_default,
+			&&op_default, &&abs_x0x45, &&op_0x5E, &&op_0x5F,
+			&&op_0x60, &&ind_x0x65, &&op_0x62, &&op_default,
+			&&op_0x64, &&zp0x65, &&op_0x66, &&op_0x67,
+			&&op_0x68, &&imm0x65, &&op_0x6A, &&op_default,
+			&&op_0x6C, &&abs0x65, &&op_0x6E, &&op_0x6F,
+			&&op_0x70, &&ind_y0x65, &&zp_ind0x65, &&op_0x73,
+			&&op_0x74, &&zp_x0x65, &&op_0x76, &&op_0x77,
+			&&op_0x78, &&abs_y0x65, &&op_0x7A, &&op_default,
+			&&op_0x7C, &&abs_x0x65, &&op_0x7E, &&op_0x7F,
+			&&op_0x80, &&op_0x81, &&op_0x82, &&op_0x83,
+			&&op_0x84, &&op_0x85, &&op_0x86, &&op_0x87,
+			&&op_0x88, &&op_0x89, &&op_0x8A, &&op_default,
+			&&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_0x8F,
+			&&op_0x90, &&op_0x91, &&op_0x92, &&op_0x93,
+			&&op_0x94, &&op_0x95, &&op_0x96, &&op_0x97,
+			&&op_0x98, &&op_0x99, &&op_0x9A, &&op_default,
+			&&op_0x9C, &&op_0x9D, &&op_0x9E, &&op_0x9F,
+			&&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_0xA3,
+			&&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_0xA7,
+			&&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_default,
+			&&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_0xAF,
+			&&op_0xB0, &&op_0xB1, &&op_0xB2, &&op_0xB3,
+			&&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_0xB7,
+			&&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_default,
+			&&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_0xBF,
+			&&op_0xC0, &&ind_x0xC5, &&op_0xC2, &&op_0xC3,
+			&&op_0xC4, &&zp0xC5, &&op_0xC6, &&op_0xC7,
+			&&op_0xC8, &&imm0xC5, &&op_0xCA, &&op_default,
+			&&op_0xCC, &&abs0xC5, &&op_0xCE, &&op_0xCF,
+			&&op_0xD0, &&ind_y0xC5, &&zp_ind0xC5, &&op_0xD3,
+			&&op_0xD4, &&zp_x0xC5, &&op_0xD6, &&op_0xD7,
+			&&op_0xD8, &&abs_y0xC5, &&op_0xDA, &&op_default,
+			&&op_default, &&abs_x0xC5, &&op_0xDE, &&op_0xDF,
+			&&op_0xE0, &&ind_x0xE5, &&op_default, &&op_0xE3,
+			&&op_0xE4, &&zp0xE5, &&op_0xE6, &&op_0xE7,
+			&&op_0xE8, &&imm0xE5, &&op_0xEA, &&op_default,
+			&&op_0xEC, &&abs0xE5, &&op_0xEE, &&op_0xEF,
+			&&op_0xF0, &&ind_y0xE5, &&zp_ind0xE5, &&op_0xF3,
+			&&op_0xF4, &&zp_x0xE5, &&op_0xF6, &&op_0xF7,
+			&&op_0xF8, &&abs_y0xE5, &&op_0xFA, &&op_default,
+			&&op_default, &&abs_x0xE5, &&op_0xFE, &&op_0xFF,
+		};
+	#endif
+	
+	uint8_t const* instr;
+	fuint8 opcode;
+	fuint16 data;
+	
+	// TODO: eliminate this special case
+	#if BLARGG_NONPORTABLE
+		#define FETCH_OP() (instr = s.code_map [pc >> page_shift],\
+				opcode = instr [pc], instr += ++pc)
+	#else
+		#define FETCH_OP() (instr = s.code_map [pc >> page_shift] + PAGE_OFFSET( pc ),\
+				opcode = *instr++, pc++)
+	#endif
+	
+	// Runs next instruction. With computed goto, this is expanded at the end of each
+	// instruction, giving each its own indirect jump for the host CPU to predict.
+	#if BLARGG_COMPUTED_GOTO
+		#define NEXT_INSTR() {\
+			COUNT_INSTR();\
+			FETCH_OP();\
+			data = clock_table [opcode];\
+			if ( (s_time += data) >= 0 )\
+				goto possibly_out_of_time;\
+			data = *instr;\
+			goto *op_table [opcode];\
+		}
+	#else
+		#define NEXT_INSTR() goto loop
+	#endif
+	
 	goto loop;
 branch_not_taken:
 	s_time -= 2;
 loop:
 	
+	COUNT_INSTR();
+	
 	#ifndef NDEBUG
 	{
 		hes_time_t correct = end_time_;
@@ -158,19 +274,7 @@ loop:
 	check( (unsigned) a < 0x100 );
 	check( (unsigned) x < 0x100 );
 	
-	uint8_t const* instr = s.code_map [pc >> page_shift];
-	fuint8 opcode;
-	
-	// TODO: eliminate this special case
-	#if BLARGG_NONPORTABLE
-		opcode = instr [pc];
-		pc++;
-		instr += pc;
-	#else
-		instr += PAGE_OFFSET( pc );
-		opcode = *instr++;
-		pc++;
-	#endif
+	FETCH_OP();
 	
 	// TODO: each reference lists slightly different timing values, ugh
 	static uint8_t const clock_table [256] =
@@ -193,7 +297,6 @@ loop:
 		4,7,7,17,2,4,6,7,2,5,4,2,2,5,7,6 // F
 	}; // 0x00 was 8
 	
-	fuint16 data;
 	data = clock_table [opcode];
 	if ( (s_time += data) >= 0 )
 		goto possibly_out_of_time;
@@ -207,6 +310,10 @@ almost_out_of_time:
 		//log_opcode( opcode );
 	#endif
 	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [opcode];
+	#endif
+	
 	switch ( opcode )
 	{
 possibly_out_of_time:
@@ -234,55 +341,55 @@ possibly_out_of_time:
 	pc++;\
 	if ( !(cond) ) goto branch_not_taken;\
 	pc = BOOST::uint16_t (pc + offset);\
-	goto loop;\
+	NEXT_INSTR();\
 }
 
-	case 0xF0: // BEQ
+	OP_CASE( 0xF0 ): // BEQ
 		BRANCH( !((uint8_t) nz) );
 	
-	case 0xD0: // BNE
+	OP_CASE( 0xD0 ): // BNE
 		BRANCH( (uint8_t) nz );
 	
-	case 0x10: // BPL
+	OP_CASE( 0x10 ): // BPL
 		BRANCH( !IS_NEG );
 	
-	case 0x90: // BCC
+	OP_CASE( 0x90 ): // BCC
 		BRANCH( !(c & 0x100) )
 	
-	case 0x30: // BMI
+	OP_CASE( 0x30 ): // BMI
 		BRANCH( IS_NEG )
 	
-	case 0x50: // BVC
+	OP_CASE( 0x50 ): // BVC
 		BRANCH( !(status & st_v) )
 	
-	case 0x70: // BVS
+	OP_CASE( 0x70 ): // BVS
 		BRANCH( status & st_v )
 	
-	case 0xB0: // BCS
+	OP_CASE( 0xB0 ): // BCS
 		BRANCH( c & 0x100 )
 	
-	case 0x80: // BRA
+	OP_CASE( 0x80 ): // BRA
 	branch_taken:
 		BRANCH( true );
 	
-	case 0xFF:
+	OP_CASE( 0xFF ):
 		if ( pc == idle_addr + 1 )
 			goto idle_done;
-	case 0x0F: // BBRn
-	case 0x1F:
-	case 0x2F:
-	case 0x3F:
-	case 0x4F:
-	case 0x5F:
-	case 0x6F:
-	case 0x7F:
-	case 0x8F: // BBSn
-	case 0x9F:
-	case 0xAF:
-	case 0xBF:
-	case 0xCF:
-	case 0xDF:
-	case 0xEF: {
+	OP_CASE( 0x0F ): // BBRn
+	OP_CASE( 0x1F ):
+	OP_CASE( 0x2F ):
+	OP_CASE( 0x3F ):
+	OP_CASE( 0x4F ):
+	OP_CASE( 0x5F ):
+	OP_CASE( 0x6F ):
+	OP_CASE( 0x7F ):
+	OP_CASE( 0x8F ): // BBSn
+	OP_CASE( 0x9F ):
+	OP_CASE( 0xAF ):
+	OP_CASE( 0xBF ):
+	OP_CASE( 0xCF ):
+	OP_CASE( 0xDF ):
+	OP_CASE( 0xEF ): {
 		fuint16 t = 0x101 * READ_LOW( data );
 		t ^= 0xFF;
 		pc++;
@@ -290,165 +397,165 @@ possibly_out_of_time:
 		BRANCH( t & (1 << (opcode >> 4)) )
 	}
 	
-	case 0x4C: // JMP abs
+	OP_CASE( 0x4C ): // JMP abs
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x7C: // JMP (ind+X)
+	OP_CASE( 0x7C ): // JMP (ind+X)
 		data += x;
-	case 0x6C:{// JMP (ind)
+	OP_CASE( 0x6C ):{// JMP (ind)
 		data += 0x100 * GET_MSB();
 		pc = GET_LE16( &READ_PROG( data ) );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Subroutine
 
-	case 0x44: // BSR
+	OP_CASE( 0x44 ): // BSR
 		WRITE_LOW( 0x100 | (sp - 1), pc >> 8 );
 		sp = (sp - 2) | 0x100;
 		WRITE_LOW( sp, pc );
 		goto branch_taken;
 	
-	case 0x20: { // JSR
+	OP_CASE( 0x20 ): { // JSR
 		fuint16 temp = pc + 1;
 		pc = GET_ADDR();
 		WRITE_LOW( 0x100 | (sp - 1), temp >> 8 );
 		sp = (sp - 2) | 0x100;
 		WRITE_LOW( sp, temp );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x60: // RTS
+	OP_CASE( 0x60 ): // RTS
 		pc = 0x100 * READ_LOW( 0x100 | (sp - 0xFF) );
 		pc += 1 + READ_LOW( sp );
 		sp = (sp - 0xFE) | 0x100;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x00: // BRK
+	OP_CASE( 0x00 ): // BRK
 		goto handle_brk;
 	
 // Common
 
-	case 0xBD:{// LDA abs,X
+	OP_CASE( 0xBD ):{// LDA abs,X
 		PAGE_CROSS_PENALTY( data + x );
 		fuint16 addr = GET_ADDR() + x;
 		pc += 2;
 		CPU_READ_FAST( this, addr, TIME, nz );
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x9D:{// STA abs,X
+	OP_CASE( 0x9D ):{// STA abs,X
 		fuint16 addr = GET_ADDR() + x;
 		pc += 2;
 		CPU_WRITE_FAST( this, addr, a, TIME );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x95: // STA zp,x
+	OP_CASE( 0x95 ): // STA zp,x
 		data = uint8_t (data + x);
-	case 0x85: // STA zp
+	OP_CASE( 0x85 ): // STA zp
 		pc++;
 		WRITE_LOW( data, a );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xAE:{// LDX abs
+	OP_CASE( 0xAE ):{// LDX abs
 		fuint16 addr = GET_ADDR();
 		pc += 2;
 		CPU_READ_FAST( this, addr, TIME, nz );
 		x = nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xA5: // LDA zp
+	OP_CASE( 0xA5 ): // LDA zp
 		a = nz = READ_LOW( data );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 // Load/store
 	
 	{
 		fuint16 addr;
-	case 0x91: // STA (ind),Y
+	OP_CASE( 0x91 ): // STA (ind),Y
 		addr = 0x100 * READ_LOW( uint8_t (data + 1) );
 		addr += READ_LOW( data ) + y;
 		pc++;
 		goto sta_ptr;
 	
-	case 0x81: // STA (ind,X)
+	OP_CASE( 0x81 ): // STA (ind,X)
 		data = uint8_t (data + x);
-	case 0x92: // STA (ind)
+	OP_CASE( 0x92 ): // STA (ind)
 		addr = 0x100 * READ_LOW( uint8_t (data + 1) );
 		addr += READ_LOW( data );
 		pc++;
 		goto sta_ptr;
 	
-	case 0x99: // STA abs,Y
+	OP_CASE( 0x99 ): // STA abs,Y
 		data += y;
-	case 0x8D: // STA abs
+	OP_CASE( 0x8D ): // STA abs
 		addr = data + 0x100 * GET_MSB();
 		pc += 2;
 	sta_ptr:
 		CPU_WRITE_FAST( this, addr, a, TIME );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 	{
 		fuint16 addr;
-	case 0xA1: // LDA (ind,X)
+	OP_CASE( 0xA1 ): // LDA (ind,X)
 		data = uint8_t (data + x);
-	case 0xB2: // LDA (ind)
+	OP_CASE( 0xB2 ): // LDA (ind)
 		addr = 0x100 * READ_LOW( uint8_t (data + 1) );
 		addr += READ_LOW( data );
 		pc++;
 		goto a_nz_read_addr;
 	
-	case 0xB1:// LDA (ind),Y
+	OP_CASE( 0xB1 ):// LDA (ind),Y
 		addr = READ_LOW( data ) + y;
 		PAGE_CROSS_PENALTY( addr );
 		addr += 0x100 * READ_LOW( (uint8_t) (data + 1) );
 		pc++;
 		goto a_nz_read_addr;
 	
-	case 0xB9: // LDA abs,Y
+	OP_CASE( 0xB9 ): // LDA abs,Y
 		data += y;
 		PAGE_CROSS_PENALTY( data );
-	case 0xAD: // LDA abs
+	OP_CASE( 0xAD ): // LDA abs
 		addr = data + 0x100 * GET_MSB();
 		pc += 2;
 	a_nz_read_addr:
 		CPU_READ_FAST( this, addr, TIME, nz );
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 
-	case 0xBE:{// LDX abs,y
+	OP_CASE( 0xBE ):{// LDX abs,y
 		PAGE_CROSS_PENALTY( data + y );
 		fuint16 addr = GET_ADDR() + y;
 		pc += 2;
 		FLUSH_TIME();
 		x = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xB5: // LDA zp,x
+	OP_CASE( 0xB5 ): // LDA zp,x
 		a = nz = READ_LOW( uint8_t (data + x) );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xA9: // LDA #imm
+	OP_CASE( 0xA9 ): // LDA #imm
 		pc++;
 		a  = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 
 // Bit operations
 
-	case 0x3C: // BIT abs,x
+	OP_CASE( 0x3C ): // BIT abs,x
 		data += x;
-	case 0x2C:{// BIT abs
+	OP_CASE( 0x2C ):{// BIT abs
 		fuint16 addr;
 		ADD_PAGE( addr );
 		FLUSH_TIME();
@@ -456,29 +563,29 @@ possibly_out_of_time:
 		CACHE_TIME();
 		goto bit_common;
 	}
-	case 0x34: // BIT zp,x
+	OP_CASE( 0x34 ): // BIT zp,x
 		data = uint8_t (data + x);
-	case 0x24: // BIT zp
+	OP_CASE( 0x24 ): // BIT zp
 		data = READ_LOW( data );
-	case 0x89: // BIT imm
+	OP_CASE( 0x89 ): // BIT imm
 		nz = data;
 	bit_common:
 		pc++;
 		status &= ~st_v;
 		status |= nz & st_v;
 		if ( nz & a )
-			goto loop; // Z should be clear, and nz must be non-zero if nz & a is
+			NEXT_INSTR(); // Z should be clear, and nz must be non-zero if nz & a is
 		nz <<= 8; // set Z flag without affecting N flag
-		goto loop;
+		NEXT_INSTR();
 		
 	{
 		fuint16 addr;
 		
-	case 0xB3: // TST abs,x
+	OP_CASE( 0xB3 ): // TST abs,x
 		addr = GET_MSB() + x;
 		goto tst_abs;
 	
-	case 0x93: // TST abs
+	OP_CASE( 0x93 ): // TST abs
 		addr = GET_MSB();
 	tst_abs:
 		addr += 0x100 * instr [2];
@@ -489,32 +596,32 @@ possibly_out_of_time:
 		goto tst_common;
 	}
 	
-	case 0xA3: // TST zp,x
+	OP_CASE( 0xA3 ): // TST zp,x
 		nz = READ_LOW( uint8_t (GET_MSB() + x) );
 		goto tst_common;
 	
-	case 0x83: // TST zp
+	OP_CASE( 0x83 ): // TST zp
 		nz = READ_LOW( GET_MSB() );
 	tst_common:
 		pc += 2;
 		status &= ~st_v;
 		status |= nz & st_v;
 		if ( nz & data )
-			goto loop; // Z should be clear, and nz must be non-zero if nz & data is
+			NEXT_INSTR(); // Z should be clear, and nz must be non-zero if nz & data is
 		nz <<= 8; // set Z flag without affecting N flag
-		goto loop;
+		NEXT_INSTR();
 	
 	{
 		fuint16 addr;
-	case 0x0C: // TSB abs
-	case 0x1C: // TRB abs
+	OP_CASE( 0x0C ): // TSB abs
+	OP_CASE( 0x1C ): // TRB abs
 		addr = GET_ADDR();
 		pc++;
 		goto txb_addr;
 	
 	// TODO: everyone lists different behaviors for the status flags, ugh
-	case 0x04: // TSB zp
-	case 0x14: // TRB zp
+	OP_CASE( 0x04 ): // TSB zp
+	OP_CASE( 0x14 ): // TRB zp
 		addr = data + ram_addr;
 	txb_addr:
 		FLUSH_TIME();
@@ -526,105 +633,105 @@ possibly_out_of_time:
 		pc++;
 		WRITE( addr, nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x07: // RMBn
-	case 0x17:
-	case 0x27:
-	case 0x37:
-	case 0x47:
-	case 0x57:
-	case 0x67:
-	case 0x77:
+	OP_CASE( 0x07 ): // RMBn
+	OP_CASE( 0x17 ):
+	OP_CASE( 0x27 ):
+	OP_CASE( 0x37 ):
+	OP_CASE( 0x47 ):
+	OP_CASE( 0x57 ):
+	OP_CASE( 0x67 ):
+	OP_CASE( 0x77 ):
 		pc++;
 		READ_LOW( data ) &= ~(1 << (opcode >> 4));
-		goto loop;
-	
-	case 0x87: // SMBn
-	case 0x97:
-	case 0xA7:
-	case 0xB7:
-	case 0xC7:
-	case 0xD7:
-	case 0xE7:
-	case 0xF7:
+		NEXT_INSTR();
+	
+	OP_CASE( 0x87 ): // SMBn
+	OP_CASE( 0x97 ):
+	OP_CASE( 0xA7 ):
+	OP_CASE( 0xB7 ):
+	OP_CASE( 0xC7 ):
+	OP_CASE( 0xD7 ):
+	OP_CASE( 0xE7 ):
+	OP_CASE( 0xF7 ):
 		pc++;
 		READ_LOW( data ) |= 1 << ((opcode >> 4) - 8);
-		goto loop;
+		NEXT_INSTR();
 	
 // Load/store
 	
-	case 0x9E: // STZ abs,x
+	OP_CASE( 0x9E ): // STZ abs,x
 		data += x;
-	case 0x9C: // STZ abs
+	OP_CASE( 0x9C ): // STZ abs
 		ADD_PAGE( data );
 		pc++;
 		FLUSH_TIME();
 		WRITE( data, 0 );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x74: // STZ zp,x
+	OP_CASE( 0x74 ): // STZ zp,x
 		data = uint8_t (data + x);
-	case 0x64: // STZ zp
+	OP_CASE( 0x64 ): // STZ zp
 		pc++;
 		WRITE_LOW( data, 0 );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x94: // STY zp,x
+	OP_CASE( 0x94 ): // STY zp,x
 		data = uint8_t (data + x);
-	case 0x84: // STY zp
+	OP_CASE( 0x84 ): // STY zp
 		pc++;
 		WRITE_LOW( data, y );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x96: // STX zp,y
+	OP_CASE( 0x96 ): // STX zp,y
 		data = uint8_t (data + y);
-	case 0x86: // STX zp
+	OP_CASE( 0x86 ): // STX zp
 		pc++;
 		WRITE_LOW( data, x );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB6: // LDX zp,y
+	OP_CASE( 0xB6 ): // LDX zp,y
 		data = uint8_t (data + y);
-	case 0xA6: // LDX zp
+	OP_CASE( 0xA6 ): // LDX zp
 		data = READ_LOW( data );
-	case 0xA2: // LDX #imm
+	OP_CASE( 0xA2 ): // LDX #imm
 		pc++;
 		x = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB4: // LDY zp,x
+	OP_CASE( 0xB4 ): // LDY zp,x
 		data = uint8_t (data + x);
-	case 0xA4: // LDY zp
+	OP_CASE( 0xA4 ): // LDY zp
 		data = READ_LOW( data );
-	case 0xA0: // LDY #imm
+	OP_CASE( 0xA0 ): // LDY #imm
 		pc++;
 		y = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBC: // LDY abs,X
+	OP_CASE( 0xBC ): // LDY abs,X
 		data += x;
 		PAGE_CROSS_PENALTY( data );
-	case 0xAC:{// LDY abs
+	OP_CASE( 0xAC ):{// LDY abs
 		fuint16 addr = data + 0x100 * GET_MSB();
 		pc += 2;
 		FLUSH_TIME();
 		y = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 	{
 		fuint8 temp;
-	case 0x8C: // STY abs
+	OP_CASE( 0x8C ): // STY abs
 		temp = y;
 		goto store_abs;
 	
-	case 0x8E: // STX abs
+	OP_CASE( 0x8E ): // STX abs
 		temp = x;
 	store_abs:
 		fuint16 addr = GET_ADDR();
@@ -632,12 +739,12 @@ possibly_out_of_time:
 		FLUSH_TIME();
 		WRITE( addr, temp );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 
 // Compare
 
-	case 0xEC:{// CPX abs
+	OP_CASE( 0xEC ):{// CPX abs
 		fuint16 addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -646,17 +753,17 @@ possibly_out_of_time:
 		goto cpx_data;
 	}
 	
-	case 0xE4: // CPX zp
+	OP_CASE( 0xE4 ): // CPX zp
 		data = READ_LOW( data );
-	case 0xE0: // CPX #imm
+	OP_CASE( 0xE0 ): // CPX #imm
 	cpx_data:
 		nz = x - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xCC:{// CPY abs
+	OP_CASE( 0xCC ):{// CPY abs
 		fuint16 addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -665,43 +772,43 @@ possibly_out_of_time:
 		goto cpy_data;
 	}
 	
-	case 0xC4: // CPY zp
+	OP_CASE( 0xC4 ): // CPY zp
 		data = READ_LOW( data );
-	case 0xC0: // CPY #imm
+	OP_CASE( 0xC0 ): // CPY #imm
 	cpy_data:
 		nz = y - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
 // Logical
 
 #define ARITH_ADDR_MODES( op )\
-	case op - 0x04: /* (ind,x) */\
+	OP_CASE_NAMED( op - 0x04, ind_x##op ): /* (ind,x) */\
 		data = uint8_t (data + x);\
-	case op + 0x0D: /* (ind) */\
+	OP_CASE_NAMED( op + 0x0D, zp_ind##op ): /* (ind) */\
 		data = 0x100 * READ_LOW( uint8_t (data + 1) ) + READ_LOW( data );\
 		goto ptr##op;\
-	case op + 0x0C:{/* (ind),y */\
+	OP_CASE_NAMED( op + 0x0C, ind_y##op ):{/* (ind),y */\
 		fuint16 temp = READ_LOW( data ) + y;\
 		PAGE_CROSS_PENALTY( temp );\
 		data = temp + 0x100 * READ_LOW( uint8_t (data + 1) );\
 		goto ptr##op;\
 	}\
-	case op + 0x10: /* zp,X */\
+	OP_CASE_NAMED( op + 0x10, zp_x##op ): /* zp,X */\
 		data = uint8_t (data + x);\
-	case op + 0x00: /* zp */\
+	OP_CASE_NAMED( op + 0x00, zp##op ): /* zp */\
 		data = READ_LOW( data );\
 		goto imm##op;\
-	case op + 0x14: /* abs,Y */\
+	OP_CASE_NAMED( op + 0x14, abs_y##op ): /* abs,Y */\
 		data += y;\
 		goto ind##op;\
-	case op + 0x18: /* abs,X */\
+	OP_CASE_NAMED( op + 0x18, abs_x##op ): /* abs,X */\
 		data += x;\
 	ind##op:\
 		PAGE_CROSS_PENALTY( data );\
-	case op + 0x08: /* abs */\
+	OP_CASE_NAMED( op + 0x08, abs##op ): /* abs */\
 		ADD_PAGE( data );\
 	ptr##op:\
 		FLUSH_TIME();\
@@ -715,22 +822,22 @@ possibly_out_of_time:
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x25 ) // AND
 		nz = (a &= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x45 ) // EOR
 		nz = (a ^= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x05 ) // ORA
 		nz = (a |= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 // Add/subtract
 
@@ -749,40 +856,40 @@ possibly_out_of_time:
 		c = nz = a + data + carry;
 		pc++;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Shift/rotate
 
-	case 0x4A: // LSR A
+	OP_CASE( 0x4A ): // LSR A
 		c = 0;
-	case 0x6A: // ROR A
+	OP_CASE( 0x6A ): // ROR A
 		nz = c >> 1 & 0x80;
 		c = a << 8;
 		nz |= a >> 1;
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x0A: // ASL A
+	OP_CASE( 0x0A ): // ASL A
 		nz = a << 1;
 		c = nz;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x2A: { // ROL A
+	OP_CASE( 0x2A ): { // ROL A
 		nz = a << 1;
 		fint16 temp = c >> 8 & 1;
 		c = nz;
 		nz |= temp;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x5E: // LSR abs,X
+	OP_CASE( 0x5E ): // LSR abs,X
 		data += x;
-	case 0x4E: // LSR abs
+	OP_CASE( 0x4E ): // LSR abs
 		c = 0;
-	case 0x6E: // ROR abs
+	OP_CASE( 0x6E ): // ROR abs
 	ror_abs: {
 		ADD_PAGE( data );
 		FLUSH_TIME();
@@ -792,15 +899,15 @@ possibly_out_of_time:
 		goto rotate_common;
 	}
 	
-	case 0x3E: // ROL abs,X
+	OP_CASE( 0x3E ): // ROL abs,X
 		data += x;
 		goto rol_abs;
 	
-	case 0x1E: // ASL abs,X
+	OP_CASE( 0x1E ): // ASL abs,X
 		data += x;
-	case 0x0E: // ASL abs
+	OP_CASE( 0x0E ): // ASL abs
 		c = 0;
-	case 0x2E: // ROL abs
+	OP_CASE( 0x2E ): // ROL abs
 	rol_abs:
 		ADD_PAGE( data );
 		nz = c >> 8 & 1;
@@ -810,21 +917,21 @@ possibly_out_of_time:
 		pc++;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x7E: // ROR abs,X
+	OP_CASE( 0x7E ): // ROR abs,X
 		data += x;
 		goto ror_abs;
 	
-	case 0x76: // ROR zp,x
+	OP_CASE( 0x76 ): // ROR zp,x
 		data = uint8_t (data + x);
 		goto ror_zp;
 	
-	case 0x56: // LSR zp,x
+	OP_CASE( 0x56 ): // LSR zp,x
 		data = uint8_t (data + x);
-	case 0x46: // LSR zp
+	OP_CASE( 0x46 ): // LSR zp
 		c = 0;
-	case 0x66: // ROR zp
+	OP_CASE( 0x66 ): // ROR zp
 	ror_zp: {
 		int temp = READ_LOW( data );
 		nz = (c >> 1 & 0x80) | (temp >> 1);
@@ -832,15 +939,15 @@ possibly_out_of_time:
 		goto write_nz_zp;
 	}
 	
-	case 0x36: // ROL zp,x
+	OP_CASE( 0x36 ): // ROL zp,x
 		data = uint8_t (data + x);
 		goto rol_zp;
 	
-	case 0x16: // ASL zp,x
+	OP_CASE( 0x16 ): // ASL zp,x
 		data = uint8_t (data + x);
-	case 0x06: // ASL zp
+	OP_CASE( 0x06 ): // ASL zp
 		c = 0;
-	case 0x26: // ROL zp
+	OP_CASE( 0x26 ): // ROL zp
 	rol_zp:
 		nz = c >> 8 & 1;
 		nz |= (c = READ_LOW( data ) << 1);
@@ -848,58 +955,58 @@ possibly_out_of_time:
 	
 // Increment/decrement
 
-#define INC_DEC_AXY( reg, n ) reg = uint8_t (nz = reg + n); goto loop;
+#define INC_DEC_AXY( reg, n ) reg = uint8_t (nz = reg + n); NEXT_INSTR();
 
-	case 0x1A: // INA
+	OP_CASE( 0x1A ): // INA
 		INC_DEC_AXY( a, +1 )
 	
-	case 0xE8: // INX
+	OP_CASE( 0xE8 ): // INX
 		INC_DEC_AXY( x, +1 )
 	
-	case 0xC8: // INY
+	OP_CASE( 0xC8 ): // INY
 		INC_DEC_AXY( y, +1 )
 
-	case 0x3A: // DEA
+	OP_CASE( 0x3A ): // DEA
 		INC_DEC_AXY( a, -1 )
 	
-	case 0xCA: // DEX
+	OP_CASE( 0xCA ): // DEX
 		INC_DEC_AXY( x, -1 )
 	
-	case 0x88: // DEY
+	OP_CASE( 0x88 ): // DEY
 		INC_DEC_AXY( y, -1 )
 	
-	case 0xF6: // INC zp,x
+	OP_CASE( 0xF6 ): // INC zp,x
 		data = uint8_t (data + x);
-	case 0xE6: // INC zp
+	OP_CASE( 0xE6 ): // INC zp
 		nz = 1;
 		goto add_nz_zp;
 	
-	case 0xD6: // DEC zp,x
+	OP_CASE( 0xD6 ): // DEC zp,x
 		data = uint8_t (data + x);
-	case 0xC6: // DEC zp
+	OP_CASE( 0xC6 ): // DEC zp
 		nz = (unsigned) -1;
 	add_nz_zp:
 		nz += READ_LOW( data );
 	write_nz_zp:
 		pc++;
 		WRITE_LOW( data, nz );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xFE: // INC abs,x
+	OP_CASE( 0xFE ): // INC abs,x
 		data = x + GET_ADDR();
 		goto inc_ptr;
 	
-	case 0xEE: // INC abs
+	OP_CASE( 0xEE ): // INC abs
 		data = GET_ADDR();
 	inc_ptr:
 		nz = 1;
 		goto inc_common;
 	
-	case 0xDE: // DEC abs,x
+	OP_CASE( 0xDE ): // DEC abs,x
 		data = x + GET_ADDR();
 		goto dec_ptr;
 	
-	case 0xCE: // DEC abs
+	OP_CASE( 0xCE ): // DEC abs
 		data = GET_ADDR();
 	dec_ptr:
 		nz = (unsigned) -1;
@@ -909,81 +1016,81 @@ possibly_out_of_time:
 		pc += 2;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 		
 // Transfer
 
-	case 0xA8: // TAY
+	OP_CASE( 0xA8 ): // TAY
 		y  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x98: // TYA
+	OP_CASE( 0x98 ): // TYA
 		a  = y;
 		nz = y;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xAA: // TAX
+	OP_CASE( 0xAA ): // TAX
 		x  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x8A: // TXA
+	OP_CASE( 0x8A ): // TXA
 		a  = x;
 		nz = x;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x9A: // TXS
+	OP_CASE( 0x9A ): // TXS
 		SET_SP( x ); // verified (no flag change)
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBA: // TSX
+	OP_CASE( 0xBA ): // TSX
 		x = nz = GET_SP();
-		goto loop;
+		NEXT_INSTR();
 	
 	#define SWAP_REGS( r1, r2 ) {\
 		fuint8 t = r1;\
 		r1 = r2;\
 		r2 = t;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 	
-	case 0x02: // SXY
+	OP_CASE( 0x02 ): // SXY
 		SWAP_REGS( x, y );
 	
-	case 0x22: // SAX
+	OP_CASE( 0x22 ): // SAX
 		SWAP_REGS( a, x );
 	
-	case 0x42: // SAY
+	OP_CASE( 0x42 ): // SAY
 		SWAP_REGS( a, y );
 	
-	case 0x62: // CLA
+	OP_CASE( 0x62 ): // CLA
 		a = 0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x82: // CLX
+	OP_CASE( 0x82 ): // CLX
 		x = 0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC2: // CLY
+	OP_CASE( 0xC2 ): // CLY
 		y = 0;
-		goto loop;
+		NEXT_INSTR();
 	
 // Stack
 	
-	case 0x48: // PHA
+	OP_CASE( 0x48 ): // PHA
 		PUSH( a );
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0xDA: // PHX
+	OP_CASE( 0xDA ): // PHX
 		PUSH( x );
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x5A: // PHY
+	OP_CASE( 0x5A ): // PHY
 		PUSH( y );
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x40:{// RTI
+	OP_CASE( 0x40 ):{// RTI
 		fuint8 temp = READ_LOW( sp );
 		pc  = READ_LOW( 0x100 | (sp - 0xFF) );
 		pc |= READ_LOW( 0x100 | (sp - 0xFE) ) * 0x100;
@@ -1000,67 +1107,67 @@ possibly_out_of_time:
 			s.base = new_time;
 			s_time += delta;
 		}
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 	#define POP()  READ_LOW( sp ); sp = (sp - 0xFF) | 0x100
 	
-	case 0x68: // PLA
+	OP_CASE( 0x68 ): // PLA
 		a = nz = POP();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xFA: // PLX
+	OP_CASE( 0xFA ): // PLX
 		x = nz = POP();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x7A: // PLY
+	OP_CASE( 0x7A ): // PLY
 		y = nz = POP();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x28:{// PLP
+	OP_CASE( 0x28 ):{// PLP
 		fuint8 temp = POP();
 		fuint8 changed = status ^ temp;
 		SET_STATUS( temp );
 		if ( !(changed & st_i) )
-			goto loop; // I flag didn't change
+			NEXT_INSTR(); // I flag didn't change
 		if ( status & st_i )
 			goto handle_sei;
 		goto handle_cli;
 	}
 	#undef POP
 	
-	case 0x08: { // PHP
+	OP_CASE( 0x08 ): { // PHP
 		fuint8 temp;
 		CALC_STATUS( temp );
 		PUSH( temp | st_b );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Flags
 
-	case 0x38: // SEC
+	OP_CASE( 0x38 ): // SEC
 		c = (unsigned) ~0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x18: // CLC
+	OP_CASE( 0x18 ): // CLC
 		c = 0;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0xB8: // CLV
+	OP_CASE( 0xB8 ): // CLV
 		status &= ~st_v;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD8: // CLD
+	OP_CASE( 0xD8 ): // CLD
 		status &= ~st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF8: // SED
+	OP_CASE( 0xF8 ): // SED
 		status |= st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x58: // CLI
+	OP_CASE( 0x58 ): // CLI
 		if ( !(status & st_i) )
-			goto loop;
+			NEXT_INSTR();
 		status &= ~st_i;
 	handle_cli: {
 		this->r.status = status; // update externally-visible I flag
@@ -1068,13 +1175,13 @@ possibly_out_of_time:
 		if ( delta <= 0 )
 		{
 			if ( TIME < irq_time_ )
-				goto loop;
+				NEXT_INSTR();
 			goto delayed_cli;
 		}
 		s.base = irq_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		
 		if ( delta >= s_time + 1 )
 		{
@@ -1082,16 +1189,16 @@ possibly_out_of_time:
 			s.base += s_time + 1;
 			s_time = -1;
 			irq_time_ = s.base; // TODO: remove, as only to satisfy debug check in loop
-			goto loop;
+			NEXT_INSTR();
 		}
 	delayed_cli:
 		dprintf( "Delayed CLI not supported\n" ); // TODO: implement
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x78: // SEI
+	OP_CASE( 0x78 ): // SEI
 		if ( status & st_i )
-			goto loop;
+			NEXT_INSTR();
 		status |= st_i;
 	handle_sei: {
 		this->r.status = status; // update externally-visible I flag
@@ -1099,23 +1206,23 @@ possibly_out_of_time:
 		s.base = end_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		dprintf( "Delayed SEI not supported\n" ); // TODO: implement
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Special
 	
-	case 0x53:{// TAM
+	OP_CASE( 0x53 ):{// TAM
 		fuint8 const bits = data; // avoid using data across function call
 		pc++;
 		for ( int i = 0; i < 8; i++ )
 			if ( bits & (1 << i) )
 				set_mmr( i, a );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x43:{// TMA
+	OP_CASE( 0x43 ):{// TMA
 		pc++;
 		byte const* in = mmr;
 		do
@@ -1125,12 +1232,12 @@ possibly_out_of_time:
 			in++;
 		}
 		while ( (data >>= 1) != 0 );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x03: // ST0
-	case 0x13: // ST1
-	case 0x23:{// ST2
+	OP_CASE( 0x03 ): // ST0
+	OP_CASE( 0x13 ): // ST1
+	OP_CASE( 0x23 ):{// ST2
 		fuint16 addr = opcode >> 4;
 		if ( addr )
 			addr++;
@@ -1138,28 +1245,28 @@ possibly_out_of_time:
 		FLUSH_TIME();
 		CPU_WRITE_VDP( this, addr, data, TIME );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xEA: // NOP
-		goto loop;
+	OP_CASE( 0xEA ): // NOP
+		NEXT_INSTR();
 
-	case 0x54: // CSL
+	OP_CASE( 0x54 ): // CSL
 		dprintf( "CSL not supported\n" );
 		illegal_encountered = true;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD4: // CSH
-		goto loop;
+	OP_CASE( 0xD4 ): // CSH
+		NEXT_INSTR();
 	
-	case 0xF4: { // SET
+	OP_CASE( 0xF4 ): { // SET
 		//fuint16 operand = GET_MSB();
 		dprintf( "SET not handled\n" );
 		//switch ( data )
 		//{
 		//}
 		illegal_encountered = true;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Block transfer
@@ -1170,11 +1277,11 @@ possibly_out_of_time:
 		fuint16 out_alt;
 		fint16 out_inc;
 		
-	case 0xE3: // TIA
+	OP_CASE( 0xE3 ): // TIA
 		in_alt  = 0;
 		goto bxfer_alt;
 	
-	case 0xF3: // TAI
+	OP_CASE( 0xF3 ): // TAI
 		in_alt  = 1;
 	bxfer_alt:
 		in_inc  = in_alt ^ 1;
@@ -1182,17 +1289,17 @@ possibly_out_of_time:
 		out_inc = in_alt;
 		goto bxfer;
 	
-	case 0xD3: // TIN
+	OP_CASE( 0xD3 ): // TIN
 		in_inc  = 1;
 		out_inc = 0;
 		goto bxfer_no_alt;
 	
-	case 0xC3: // TDD
+	OP_CASE( 0xC3 ): // TDD
 		in_inc  = -1;
 		out_inc = -1;
 		goto bxfer_no_alt;
 	
-	case 0x73: // TII
+	OP_CASE( 0x73 ): // TII
 		in_inc  = 1;
 		out_inc = 1;
 	bxfer_no_alt:
@@ -1226,16 +1333,16 @@ possibly_out_of_time:
 		}
 		while ( --count );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 
 // Illegal
 
-	default:
+	OP_DEFAULT:
 		assert( (unsigned) opcode <= 0xFF );
 		dprintf( "Illegal opcode $%02X at $%04X\n", (int) opcode, (int) pc - 1 );
 		illegal_encountered = true;
-		goto loop;
+		NEXT_INSTR();
 	}
 	assert( false );
 	
@@ -43,6 +43,9 @@ public:
 	// instructions were encountered.
 	bool run( hes_time_t end_time );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Time of beginning of next instruction to be executed
 	hes_time_t time() const             { return state->time + state->base; }
 	void set_time( hes_time_t t )       { state->time = t - state->base; }
@@ -64,8 +67,13 @@ public:
 	// Can read this many bytes past end of a page
 	enum { cpu_padding = 8 };
 	
+	// Save/load RAM, registers, memory map and timing (see blargg_copy_func_t).
+	// Must not be called during run(). Memory map holds pointers, so state can
+	// only be loaded back into the same emulator.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
-	Hes_Cpu() { state = &state_; }
+	Hes_Cpu() : instr_count_( 0 ) { state = &state_; }
 	enum { irq_inhibit = 0x04 };
 private:
 	// noncopyable
@@ -79,6 +87,7 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	hes_time_t irq_time_;
 	hes_time_t end_time_;
 	
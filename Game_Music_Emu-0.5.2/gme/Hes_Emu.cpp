@@ -132,7 +132,8 @@ struct Hes_File : Gme_Info_
 static Music_Emu* new_hes_emu () { return BLARGG_NEW Hes_Emu ; }
 static Music_Emu* new_hes_file() { return BLARGG_NEW Hes_File; }
 
-gme_type_t_ const gme_hes_type [1] = { "PC Engine", 256, &new_hes_emu, &new_hes_file, "HES", 1 };
+gme_type_t_ const gme_hes_type [1] = { "PC Engine", 256, &new_hes_emu, &new_hes_file, "HES", 1,
+		gme_caps_fast_skip | gme_caps_float | gme_caps_find_loop | gme_caps_state, 7159091 };
 
 // Setup
 
@@ -182,6 +183,7 @@ blargg_err_t Hes_Emu::load_( Data_Reader& in )
 	set_voice_count( apu.osc_count );
 	
 	apu.volume( gain() );
+	RETURN_ERR( resize_journal( 1024 ) );
 	
 	return setup_buffer( 7159091 );
 }
@@ -281,14 +283,22 @@ void Hes_Emu::cpu_write_vdp( int addr, int data )
 	}
 }
 
+// PSG can't be read, so writes are journaled and run once per frame
+void Hes_Emu::replay_journal( journal_entry_t const* in, int count )
+{
+	for ( int i = 0; i < count; i++ )
+		apu.write_data( in [i].time, in [i].addr, in [i].data );
+}
+
 void Hes_Emu::cpu_write_( hes_addr_t addr, int data )
 {
 	if ( unsigned (addr - apu.start_addr) <= apu.end_addr - apu.start_addr )
 	{
 		GME_APU_HOOK( this, addr - apu.start_addr, data );
+		probe_apu_write( addr - apu.start_addr, data );
 		// avoid going way past end when a long block xfer is writing to I/O space
 		hes_time_t t = min( time(), end_time() + 8 );
-		apu.write_data( t, addr, data );
+		journal_write( t, addr, data );
 		return;
 	}
 	
@@ -462,17 +472,18 @@ int Hes_Emu::cpu_done()
 			timer.fired = true;
 			irq.timer = future_hes_time;
 			irq_changed(); // overkill, but not worth writing custom code
-			#if GME_FRAME_HOOK_DEFINED
 			{
+				// timer is also used for sound, so only count it when near 60 Hz
 				unsigned const threshold = period_60hz / 30;
 				unsigned long elapsed = present - last_frame_hook;
 				if ( elapsed - period_60hz + threshold / 2 < threshold )
 				{
 					last_frame_hook = present;
 					GME_FRAME_HOOK( this );
+					if ( probing() )
+						probe_frame( present, ram, sizeof ram, sgx, sizeof sgx );
 				}
 			}
-			#endif
 			return 0x0A;
 		}
 		
@@ -482,10 +493,10 @@ int Hes_Emu::cpu_done()
 			//run_until( present );
 			//irq.vdp = future_hes_time;
 			//irq_changed();
-			#if GME_FRAME_HOOK_DEFINED
-				last_frame_hook = present;
-				GME_FRAME_HOOK( this );
-			#endif
+			last_frame_hook = present;
+			GME_FRAME_HOOK( this );
+			if ( probing() )
+				probe_frame( present, ram, sizeof ram, sgx, sizeof sgx );
 			return 0x08;
 		}
 	}
@@ -502,6 +513,20 @@ static void adjust_time( blargg_long& time, hes_time_t delta )
 	}
 }
 
+blargg_err_t Hes_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( write_pages );
+	BLARGG_COPY( last_frame_hook );
+	BLARGG_COPY( timer );
+	BLARGG_COPY( vdp );
+	BLARGG_COPY( irq );
+	BLARGG_COPY( sgx );
+	apu.copy_state( io, copy );
+	return 0;
+}
+
 blargg_err_t Hes_Emu::run_clocks( blip_time_t& duration_, int )
 {
 	blip_time_t const duration = duration_; // cache
@@ -517,12 +542,11 @@ blargg_err_t Hes_Emu::run_clocks( blip_time_t& duration_, int )
 	// end time frame
 	timer.last_time -= duration;
 	vdp.next_vbl    -= duration;
-	#if GME_FRAME_HOOK_DEFINED
-		last_frame_hook -= duration;
-	#endif
+	last_frame_hook -= duration;
 	cpu::end_frame( duration );
 	::adjust_time( irq.timer, duration );
 	::adjust_time( irq.vdp,   duration );
+	flush_journal();
 	apu.end_frame( duration );
 	
 	return 0;
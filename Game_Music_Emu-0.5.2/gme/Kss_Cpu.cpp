@@ -38,6 +38,10 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 #define CPU_WRITE( cpu, addr, data, time )\
 	(SYNC_TIME(), kss_cpu_write( this, addr, data ))
 
+#ifdef Z80_CPU_LOG_H
+	#undef BLARGG_COMPUTED_GOTO // log goes through loop
+#endif
+
 #include "blargg_source.h"
 
 // flags, named with hex value for clarity
@@ -62,6 +66,7 @@ int const C01 = 0x01;
 Kss_Cpu::Kss_Cpu()
 {
 	state = &state_;
+	instr_count_ = 0;
 	
 	for ( int i = 0x100; --i >= 0; )
 	{
@@ -111,6 +116,14 @@ void Kss_Cpu::map_mem( unsigned addr, blargg_ulong size, void* write, void const
 	}
 }
 
+void Kss_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( r );
+	BLARGG_COPY( state_ );
+	BLARGG_COPY( end_time_ );
+}
+
 #define TIME                        (s_time + s.base)
 #define RW_MEM( addr, rw )          (s.rw [(addr) >> page_shift] [KSS_CPU_PAGE_OFFSET( addr )])
 #define READ_PROG( addr )           RW_MEM( addr, read )
@@ -141,6 +154,13 @@ void Kss_Cpu::map_mem( unsigned addr, blargg_ulong size, void* write, void const
 #define CASE7( a, b, c, d, e, f, g    ) CASE6( a, b, c, d, e, f    ): case 0x##g
 #define CASE8( a, b, c, d, e, f, g, h ) CASE7( a, b, c, d, e, f, g ): case 0x##h
 
+// same, for main opcode switch (see OP_CASE in blargg_source.h)
+#define OP_CASE5( a, b, c, d, e          ) OP_CASE( 0x##a ):OP_CASE( 0x##b ):OP_CASE( 0x##c ):\
+		OP_CASE( 0x##d ):OP_CASE( 0x##e )
+#define OP_CASE6( a, b, c, d, e, f       ) OP_CASE5( a, b, c, d, e       ): OP_CASE( 0x##f )
+#define OP_CASE7( a, b, c, d, e, f, g    ) OP_CASE6( a, b, c, d, e, f    ): OP_CASE( 0x##g )
+#define OP_CASE8( a, b, c, d, e, f, g, h ) OP_CASE7( a, b, c, d, e, f, g ): OP_CASE( 0x##h )
+
 // high four bits are $ED time - 8, low four bits are $DD/$FD time - 8
 static byte const ed_dd_timing [0x100] = {
 //0    1    2    3    4    5    6    7    8    9    A    B    C    D    E    F
@@ -191,6 +211,74 @@ bool Kss_Cpu::run( cpu_time_t end_time )
 	fuint16 iy = r.iy;
 	int flags = r.b.flags;
 	
+	#if BLARGG_COMPUTED_GOTO
+		// Address of code for each opcode, matching the OP_CASE labels below
+		static void* const op_table [0x100] = {
+			&&op_0x00, &&op_0x01, &&op_0x02, &&op_0x03, &&op_0x04, &&op_0x05, &&op_0x06, &&op_0x07,
+			&&op_0x08, &&op_0x09, &&op_0x0A, &&op_0x0B, &&op_0x0C, &&op_0x0D, &&op_0x0E, &&op_0x0F,
+			&&op_0x10, &&op_0x11, &&op_0x12, &&op_0x13, &&op_0x14, &&op_0x15, &&op_0x16, &&op_0x17,
+			&&op_0x18, &&op_0x19, &&op_0x1A, &&op_0x1B, &&op_0x1C, &&op_0x1D, &&op_0x1E, &&op_0x1F,
+			&&op_0x20, &&op_0x21, &&op_0x22, &&op_0x23, &&op_0x24, &&op_0x25, &&op_0x26, &&op_0x27,
+			&&op_0x28, &&op_0x29, &&op_0x2A, &&op_0x2B, &&op_0x2C, &&op_0x2D, &&op_0x2E, &&op_0x2F,
+			&&op_0x30, &&op_0x31, &&op_0x32, &&op_0x33, &&op_0x34, &&op_0x35, &&op_0x36, &&op_0x37,
+			&&op_0x38, &&op_0x39, &&op_0x3A, &&op_0x3B, &&op_0x3C, &&op_0x3D, &&op_0x3E, &&op_0x3F,
+			&&op_0x40, &&op_0x41, &&op_0x42, &&op_0x43, &&op_0x44, &&op_0x45, &&op_0x46, &&op_0x47,
+			&&op_0x48, &&op_0x49, &&op_0x4A, &&op_0x4B, &&op_0x4C, &&op_0x4D, &&op_0x4E, &&op_0x4F,
+			&&op_0x50, &&op_0x51, &&op_0x52, &&op_0x53, &&op_0x54, &&op_0x55, &&op_0x56, &&op_0x57,
+			&&op_0x58, &&op_0x59, &&op_0x5A, &&op_0x5B, &&op_0x5C, &&op_0x5D, &&op_0x5E, &&op_0x5F,
+			&&op_0x60, &&op_0x61, &&op_0x62, &&op_0x63, &&op_0x64, &&op_0x65, &&op_0x66, &&op_0x67,
+			&&op_0x68, &&op_0x69, &&op_0x6A, &&op_0x6B, &&op_0x6C, &&op_0x6D, &&op_0x6E, &&op_0x6F,
+			&&op_0x70, &&op_0x71, &&op_0x72, &&op_0x73, &&op_0x74, &&op_0x75, &&op_0x76, &&op_0x77,
+			&&op_0x78, &&op_0x79, &&op_0x7A, &&op_0x7B, &&op_0x7C, &&op_0x7D, &&op_0x7E, &&op_0x7F,
+			&&op_0x80, &&op_0x81, &&op_0x82, &&op_0x83, &&op_0x84, &&op_0x85, &&op_0x86, &&op_0x87,
+			&&op_0x88, &&op_0x89, &&op_0x8A, &&op_0x8B, &&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_0x8F,
+			&&op_0x90, &&op_0x91, &&op_0x92, &&op_0x93, &&op_0x94, &&op_0x95, &&op_0x96, &&op_0x97,
+			&&op_0x98, &&op_0x99, &&op_0x9A, &&op_0x9B, &&op_0x9C, &&op_0x9D, &&op_0x9E, &&op_0x9F,
+			&&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_0xA3, &&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_0xA7,
+			&&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_0xAB, &&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_0xAF,
+			&&op_0xB0, &&op_0xB1, &&op_0xB2, &&op_0xB3, &&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_0xB7,
+			&&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_0xBB, &&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_0xBF,
+			&&op_0xC0, &&op_0xC1, &&op_0xC2, &&op_0xC3, &&op_0xC4, &&op_0xC5, &&op_0xC6, &&op_0xC7,
+			&&op_0xC8, &&op_0xC9, &&op_0xCA, &&op_0xCB, &&op_0xCC, &&op_0xCD, &&op_0xCE, &&op_0xCF,
+			&&op_0xD0, &&op_0xD1, &&op_0xD2, &&op_0xD3, &&op_0xD4, &&op_0xD5, &&op_0xD6, &&op_0xD7,
+			&&op_0xD8, &&op_0xD9, &&op_0xDA, &&op_0xDB, &&op_0xDC, &&op_0xDD, &&op_0xDE, &&op_0xDF,
+			&&op_0xE0, &&op_0xE1, &&op_0xE2, &&op_0xE3, &&op_0xE4, &&op_0xE5, &&op_0xE6, &&op_0xE7,
+			&&op_0xE8, &&op_0xE9, &&op_0xEA, &&op_0xEB, &&op_0xEC, &&op_0xED, &&op_0xEE, &&op_0xEF,
+			&&op_0xF0, &&op_0xF1, &&op_0xF2, &&op_0xF3, &&op_0xF4, &&op_0xF5, &&op_0xF6, &&op_0xF7,
+			&&op_0xF8, &&op_0xF9, &&op_0xFA, &&op_0xFB, &&op_0xFC, &&op_0xFD, &&op_0xFE, &&op_0xFF
+		};
+	#endif
+	
+	uint8_t const* instr;
+	fuint8 opcode;
+	fuint16 data;
+	
+#define GET_ADDR()  GET_LE16( instr )
+	
+	// TODO: eliminate this special case
+	#if BLARGG_NONPORTABLE
+		#define FETCH_OP() (instr = s.read [pc >> page_shift], opcode = instr [pc], instr += ++pc)
+	#else
+		#define FETCH_OP() (instr = s.read [pc >> page_shift] + KSS_CPU_PAGE_OFFSET( pc ),\
+				opcode = *instr++, pc++)
+	#endif
+	
+	// Runs next instruction. With computed goto, this is expanded at the end of each
+	// instruction, giving each its own indirect jump for the host CPU to predict.
+	#if BLARGG_COMPUTED_GOTO
+		#define NEXT_INSTR() {\
+			COUNT_INSTR();\
+			FETCH_OP();\
+			data = base_timing [opcode];\
+			if ( (s_time += data) >= 0 )\
+				goto possibly_out_of_time;\
+			data = READ_PROG( pc );\
+			goto *op_table [opcode];\
+		}
+	#else
+		#define NEXT_INSTR() goto loop
+	#endif
+	
 	goto loop;
 jr_not_taken:
 	s_time -= 5;
@@ -201,27 +289,15 @@ jp_not_taken:
 	pc += 2;
 loop:
 	
+	COUNT_INSTR();
+	
 	check( (unsigned long) pc < 0x10000 );
 	check( (unsigned long) sp < 0x10000 );
 	check( (unsigned) flags < 0x100 );
 	check( (unsigned) ix < 0x10000 );
 	check( (unsigned) iy < 0x10000 );
 	
-	uint8_t const* instr = s.read [pc >> page_shift];
-#define GET_ADDR()  GET_LE16( instr )
-	
-	fuint8 opcode;
-	
-	// TODO: eliminate this special case
-	#if BLARGG_NONPORTABLE
-		opcode = instr [pc];
-		pc++;
-		instr += pc;
-	#else
-		instr += KSS_CPU_PAGE_OFFSET( pc );
-		opcode = *instr++;
-		pc++;
-	#endif
+	FETCH_OP();
 	
 	static byte const base_timing [0x100] = {
 	//   0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
@@ -243,7 +319,6 @@ loop:
 		11,10,10, 4,17,11, 7,11,11, 6,10, 4,17, 8, 7,11, // F
 	};
 	
-	fuint16 data;
 	data = base_timing [opcode];
 	if ( (s_time += data) >= 0 )
 		goto possibly_out_of_time;
@@ -258,6 +333,10 @@ almost_out_of_time:
 				READ_PROG( pc + 1 ), READ_PROG( pc + 2 ) );
 	#endif
 	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [opcode];
+	#endif
+	
 	switch ( opcode )
 	{
 possibly_out_of_time:
@@ -268,11 +347,11 @@ possibly_out_of_time:
 
 // Common
 
-	case 0x00: // NOP
-	CASE7( 40, 49, 52, 5B, 64, 6D, 7F ): // LD B,B etc.
-		goto loop;
+	OP_CASE( 0x00 ): // NOP
+	OP_CASE7( 40, 49, 52, 5B, 64, 6D, 7F ): // LD B,B etc.
+		NEXT_INSTR();
 	
-	case 0x08:{// EX AF,AF'
+	OP_CASE( 0x08 ):{// EX AF,AF'
 		int temp = r.alt.b.a;
 		r.alt.b.a = rg.a;
 		rg.a = temp;
@@ -280,29 +359,29 @@ possibly_out_of_time:
 		temp = r.alt.b.flags;
 		r.alt.b.flags = flags;
 		flags = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xD3: // OUT (imm),A
+	OP_CASE( 0xD3 ): // OUT (imm),A
 		pc++;
 		OUT( data + rg.a * 0x100, rg.a );
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x2E: // LD L,imm
+	OP_CASE( 0x2E ): // LD L,imm
 		pc++;
 		rg.l = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x3E: // LD A,imm
+	OP_CASE( 0x3E ): // LD A,imm
 		pc++;
 		rg.a = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x3A:{// LD A,(addr)
+	OP_CASE( 0x3A ):{// LD A,(addr)
 		fuint16 addr = GET_ADDR();
 		pc += 2;
 		rg.a = READ( addr );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Conditional
@@ -320,137 +399,137 @@ possibly_out_of_time:
 	if ( !(cond) )\
 		goto jr_not_taken;\
 	pc = uint16_t (pc + offset);\
-	goto loop;\
+	NEXT_INSTR();\
 }
 	
-	case 0x20: JR( !ZERO  ) // JR NZ,disp
-	case 0x28: JR(  ZERO  ) // JR Z,disp
-	case 0x30: JR( !CARRY ) // JR NC,disp
-	case 0x38: JR(  CARRY ) // JR C,disp
-	case 0x18: JR(  true  ) // JR disp
+	OP_CASE( 0x20 ): JR( !ZERO  ) // JR NZ,disp
+	OP_CASE( 0x28 ): JR(  ZERO  ) // JR Z,disp
+	OP_CASE( 0x30 ): JR( !CARRY ) // JR NC,disp
+	OP_CASE( 0x38 ): JR(  CARRY ) // JR C,disp
+	OP_CASE( 0x18 ): JR(  true  ) // JR disp
 
-	case 0x10:{// DJNZ disp
+	OP_CASE( 0x10 ):{// DJNZ disp
 		int temp = rg.b - 1;
 		rg.b = temp;
 		JR( temp )
 	}
 	
 // JP
-#define JP( cond )  if ( !(cond) ) goto jp_not_taken; pc = GET_ADDR(); goto loop;
-	
-	case 0xC2: JP( !ZERO  ) // JP NZ,addr
-	case 0xCA: JP(  ZERO  ) // JP Z,addr
-	case 0xD2: JP( !CARRY ) // JP NC,addr
-	case 0xDA: JP(  CARRY ) // JP C,addr
-	case 0xE2: JP( !EVEN  ) // JP PO,addr
-	case 0xEA: JP(  EVEN  ) // JP PE,addr
-	case 0xF2: JP( !MINUS ) // JP P,addr
-	case 0xFA: JP(  MINUS ) // JP M,addr
-	
-	case 0xC3: // JP addr
+#define JP( cond )  if ( !(cond) ) goto jp_not_taken; pc = GET_ADDR(); NEXT_INSTR();
+	
+	OP_CASE( 0xC2 ): JP( !ZERO  ) // JP NZ,addr
+	OP_CASE( 0xCA ): JP(  ZERO  ) // JP Z,addr
+	OP_CASE( 0xD2 ): JP( !CARRY ) // JP NC,addr
+	OP_CASE( 0xDA ): JP(  CARRY ) // JP C,addr
+	OP_CASE( 0xE2 ): JP( !EVEN  ) // JP PO,addr
+	OP_CASE( 0xEA ): JP(  EVEN  ) // JP PE,addr
+	OP_CASE( 0xF2 ): JP( !MINUS ) // JP P,addr
+	OP_CASE( 0xFA ): JP(  MINUS ) // JP M,addr
+	
+	OP_CASE( 0xC3 ): // JP addr
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xE9: // JP HL
+	OP_CASE( 0xE9 ): // JP HL
 		pc = rp.hl;
-		goto loop;
+		NEXT_INSTR();
 
 // RET
-#define RET( cond ) if ( cond ) goto ret_taken; s_time -= 6; goto loop;
-	
-	case 0xC0: RET( !ZERO  ) // RET NZ
-	case 0xC8: RET(  ZERO  ) // RET Z
-	case 0xD0: RET( !CARRY ) // RET NC
-	case 0xD8: RET(  CARRY ) // RET C
-	case 0xE0: RET( !EVEN  ) // RET PO
-	case 0xE8: RET(  EVEN  ) // RET PE
-	case 0xF0: RET( !MINUS ) // RET P
-	case 0xF8: RET(  MINUS ) // RET M
-	
-	case 0xC9: // RET
+#define RET( cond ) if ( cond ) goto ret_taken; s_time -= 6; NEXT_INSTR();
+	
+	OP_CASE( 0xC0 ): RET( !ZERO  ) // RET NZ
+	OP_CASE( 0xC8 ): RET(  ZERO  ) // RET Z
+	OP_CASE( 0xD0 ): RET( !CARRY ) // RET NC
+	OP_CASE( 0xD8 ): RET(  CARRY ) // RET C
+	OP_CASE( 0xE0 ): RET( !EVEN  ) // RET PO
+	OP_CASE( 0xE8 ): RET(  EVEN  ) // RET PE
+	OP_CASE( 0xF0 ): RET( !MINUS ) // RET P
+	OP_CASE( 0xF8 ): RET(  MINUS ) // RET M
+	
+	OP_CASE( 0xC9 ): // RET
 	ret_taken:
 		pc = READ_WORD( sp );
 		sp = uint16_t (sp + 2);
-		goto loop;
+		NEXT_INSTR();
 	
 // CALL
 #define CALL( cond ) if ( cond ) goto call_taken; goto call_not_taken;
 
-	case 0xC4: CALL( !ZERO  ) // CALL NZ,addr
-	case 0xCC: CALL(  ZERO  ) // CALL Z,addr
-	case 0xD4: CALL( !CARRY ) // CALL NC,addr
-	case 0xDC: CALL(  CARRY ) // CALL C,addr
-	case 0xE4: CALL( !EVEN  ) // CALL PO,addr
-	case 0xEC: CALL(  EVEN  ) // CALL PE,addr
-	case 0xF4: CALL( !MINUS ) // CALL P,addr
-	case 0xFC: CALL(  MINUS ) // CALL M,addr
-	
-	case 0xCD:{// CALL addr
+	OP_CASE( 0xC4 ): CALL( !ZERO  ) // CALL NZ,addr
+	OP_CASE( 0xCC ): CALL(  ZERO  ) // CALL Z,addr
+	OP_CASE( 0xD4 ): CALL( !CARRY ) // CALL NC,addr
+	OP_CASE( 0xDC ): CALL(  CARRY ) // CALL C,addr
+	OP_CASE( 0xE4 ): CALL( !EVEN  ) // CALL PO,addr
+	OP_CASE( 0xEC ): CALL(  EVEN  ) // CALL PE,addr
+	OP_CASE( 0xF4 ): CALL( !MINUS ) // CALL P,addr
+	OP_CASE( 0xFC ): CALL(  MINUS ) // CALL M,addr
+	
+	OP_CASE( 0xCD ):{// CALL addr
 	call_taken:
 		fuint16 addr = pc + 2;
 		pc = GET_ADDR();
 		sp = uint16_t (sp - 2);
 		WRITE_WORD( sp, addr );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xFF: // RST
+	OP_CASE( 0xFF ): // RST
 		if ( pc > idle_addr )
 			goto hit_idle_addr;
-	CASE7( C7, CF, D7, DF, E7, EF, F7 ):
+	OP_CASE7( C7, CF, D7, DF, E7, EF, F7 ):
 		data = pc;
 		pc = opcode & 0x38;
 		goto push_data;
 
 // PUSH/POP
-	case 0xF5: // PUSH AF
+	OP_CASE( 0xF5 ): // PUSH AF
 		data = rg.a * 0x100u + flags;
 		goto push_data;
 	
-	case 0xC5: // PUSH BC
-	case 0xD5: // PUSH DE
-	case 0xE5: // PUSH HL
+	OP_CASE( 0xC5 ): // PUSH BC
+	OP_CASE( 0xD5 ): // PUSH DE
+	OP_CASE( 0xE5 ): // PUSH HL
 		data = R16( opcode, 4, 0xC5 );
 	push_data:
 		sp = uint16_t (sp - 2);
 		WRITE_WORD( sp, data );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF1: // POP AF
+	OP_CASE( 0xF1 ): // POP AF
 		flags = READ( sp );
 		rg.a = READ( sp + 1 );
 		sp = uint16_t (sp + 2);
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC1: // POP BC
-	case 0xD1: // POP DE
-	case 0xE1: // POP HL
+	OP_CASE( 0xC1 ): // POP BC
+	OP_CASE( 0xD1 ): // POP DE
+	OP_CASE( 0xE1 ): // POP HL
 		R16( opcode, 4, 0xC1 ) = READ_WORD( sp );
 		sp = uint16_t (sp + 2);
-		goto loop;
+		NEXT_INSTR();
 	
 // ADC/ADD/SBC/SUB
-	case 0x96: // SUB (HL)
-	case 0x86: // ADD (HL)
+	OP_CASE( 0x96 ): // SUB (HL)
+	OP_CASE( 0x86 ): // ADD (HL)
 		flags &= ~C01;
-	case 0x9E: // SBC (HL)
-	case 0x8E: // ADC (HL)
+	OP_CASE( 0x9E ): // SBC (HL)
+	OP_CASE( 0x8E ): // ADC (HL)
 		data = READ( rp.hl );
 		goto adc_data;
 	
-	case 0xD6: // SUB A,imm
-	case 0xC6: // ADD imm
+	OP_CASE( 0xD6 ): // SUB A,imm
+	OP_CASE( 0xC6 ): // ADD imm
 		flags &= ~C01;
-	case 0xDE: // SBC A,imm
-	case 0xCE: // ADC imm
+	OP_CASE( 0xDE ): // SBC A,imm
+	OP_CASE( 0xCE ): // ADC imm
 		pc++;
 		goto adc_data;
 	
-	CASE7( 90, 91, 92, 93, 94, 95, 97 ): // SUB r
-	CASE7( 80, 81, 82, 83, 84, 85, 87 ): // ADD r
+	OP_CASE7( 90, 91, 92, 93, 94, 95, 97 ): // SUB r
+	OP_CASE7( 80, 81, 82, 83, 84, 85, 87 ): // ADD r
 		flags &= ~C01;
-	CASE7( 98, 99, 9A, 9B, 9C, 9D, 9F ): // SBC r
-	CASE7( 88, 89, 8A, 8B, 8C, 8D, 8F ): // ADC r
+	OP_CASE7( 98, 99, 9A, 9B, 9C, 9D, 9F ): // SBC r
+	OP_CASE7( 88, 89, 8A, 8B, 8C, 8D, 8F ): // ADC r
 		data = R8( opcode & 7, 0 );
 	adc_data: {
 		int result = data + (flags & C01);
@@ -464,19 +543,19 @@ possibly_out_of_time:
 				((data - -0x80) >> 6 & V04) |
 				SZ28C( result & 0x1FF );
 		rg.a = result;
-		goto loop;
+		NEXT_INSTR();
 	}
 
 // CP
-	case 0xBE: // CP (HL)
+	OP_CASE( 0xBE ): // CP (HL)
 		data = READ( rp.hl );
 		goto cp_data;
 	
-	case 0xFE: // CP imm
+	OP_CASE( 0xFE ): // CP imm
 		pc++;
 		goto cp_data;
 	
-	CASE7( B8, B9, BA, BB, BC, BD, BF ): // CP r
+	OP_CASE7( B8, B9, BA, BB, BC, BD, BF ): // CP r
 		data = R8( opcode, 0xB8 );
 	cp_data: {
 		int result = rg.a - data;
@@ -485,20 +564,20 @@ possibly_out_of_time:
 		flags |=(((result ^ rg.a) & data) >> 5 & V04) |
 				(((data & H10) ^ result) & (S80 | H10));
 		if ( (uint8_t) result )
-			goto loop;
+			NEXT_INSTR();
 		flags |= Z40;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // ADD HL,rp
 	
-	case 0x39: // ADD HL,SP
+	OP_CASE( 0x39 ): // ADD HL,SP
 		data = sp;
 		goto add_hl_data;
 	
-	case 0x09: // ADD HL,BC
-	case 0x19: // ADD HL,DE
-	case 0x29: // ADD HL,HL
+	OP_CASE( 0x09 ): // ADD HL,BC
+	OP_CASE( 0x19 ): // ADD HL,DE
+	OP_CASE( 0x29 ): // ADD HL,HL
 		data = R16( opcode, 4, 0x09 );
 	add_hl_data: {
 		blargg_ulong sum = rp.hl + data;
@@ -508,10 +587,10 @@ possibly_out_of_time:
 				(sum >> 16) |
 				(sum >> 8 & (F20 | F08)) |
 				((data ^ sum) >> 8 & H10);
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x27:{// DAA
+	OP_CASE( 0x27 ):{// DAA
 		int a = rg.a;
 		if ( a > 0x99 )
 			flags |= C01;
@@ -529,7 +608,7 @@ possibly_out_of_time:
 				((rg.a ^ a) & H10) |
 				SZ28P( (uint8_t) a );
 		rg.a = a;
-		goto loop;
+		NEXT_INSTR();
 	}
 	/*
 	case 0x27:{// DAA
@@ -546,268 +625,268 @@ possibly_out_of_time:
 		
 		flags = (f & (N02 | C01)) | ((rg.a ^ a) & H10) | SZ28P( (uint8_t) a );
 		rg.a = a;
-		goto loop;
+		NEXT_INSTR();
 	}
 	*/
 	
 // INC/DEC
-	case 0x34: // INC (HL)
+	OP_CASE( 0x34 ): // INC (HL)
 		data = READ( rp.hl ) + 1;
 		WRITE( rp.hl, data );
 		goto inc_set_flags;
 	
-	CASE7( 04, 0C, 14, 1C, 24, 2C, 3C ): // INC r
+	OP_CASE7( 04, 0C, 14, 1C, 24, 2C, 3C ): // INC r
 		data = ++R8( opcode >> 3, 0 );
 	inc_set_flags:
 		flags = (flags & C01) |
 				(((data & 0x0F) - 1) & H10) |
 				SZ28( (uint8_t) data );
 		if ( data != 0x80 )
-			goto loop;
+			NEXT_INSTR();
 		flags |= V04;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x35: // DEC (HL)
+	OP_CASE( 0x35 ): // DEC (HL)
 		data = READ( rp.hl ) - 1;
 		WRITE( rp.hl, data );
 		goto dec_set_flags;
 	
-	CASE7( 05, 0D, 15, 1D, 25, 2D, 3D ): // DEC r
+	OP_CASE7( 05, 0D, 15, 1D, 25, 2D, 3D ): // DEC r
 		data = --R8( opcode >> 3, 0 );
 	dec_set_flags:
 		flags = (flags & C01) | N02 |
 				(((data & 0x0F) + 1) & H10) |
 				SZ28( (uint8_t) data );
 		if ( data != 0x7F )
-			goto loop;
+			NEXT_INSTR();
 		flags |= V04;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x03: // INC BC
-	case 0x13: // INC DE
-	case 0x23: // INC HL
+	OP_CASE( 0x03 ): // INC BC
+	OP_CASE( 0x13 ): // INC DE
+	OP_CASE( 0x23 ): // INC HL
 		R16( opcode, 4, 0x03 )++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x33: // INC SP
+	OP_CASE( 0x33 ): // INC SP
 		sp = uint16_t (sp + 1);
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x0B: // DEC BC
-	case 0x1B: // DEC DE
-	case 0x2B: // DEC HL
+	OP_CASE( 0x0B ): // DEC BC
+	OP_CASE( 0x1B ): // DEC DE
+	OP_CASE( 0x2B ): // DEC HL
 		R16( opcode, 4, 0x0B )--;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x3B: // DEC SP
+	OP_CASE( 0x3B ): // DEC SP
 		sp = uint16_t (sp - 1);
-		goto loop;
+		NEXT_INSTR();
 	
 // AND
-	case 0xA6: // AND (HL)
+	OP_CASE( 0xA6 ): // AND (HL)
 		data = READ( rp.hl );
 		goto and_data;
 	
-	case 0xE6: // AND imm
+	OP_CASE( 0xE6 ): // AND imm
 		pc++;
 		goto and_data;
 	
-	CASE7( A0, A1, A2, A3, A4, A5, A7 ): // AND r
+	OP_CASE7( A0, A1, A2, A3, A4, A5, A7 ): // AND r
 		data = R8( opcode, 0xA0 );
 	and_data:
 		rg.a &= data;
 		flags = SZ28P( rg.a ) | H10;
-		goto loop;
+		NEXT_INSTR();
 	
 // OR
-	case 0xB6: // OR (HL)
+	OP_CASE( 0xB6 ): // OR (HL)
 		data = READ( rp.hl );
 		goto or_data;
 	
-	case 0xF6: // OR imm
+	OP_CASE( 0xF6 ): // OR imm
 		pc++;
 		goto or_data;
 	
-	CASE7( B0, B1, B2, B3, B4, B5, B7 ): // OR r
+	OP_CASE7( B0, B1, B2, B3, B4, B5, B7 ): // OR r
 		data = R8( opcode, 0xB0 );
 	or_data:
 		rg.a |= data;
 		flags = SZ28P( rg.a );
-		goto loop;
+		NEXT_INSTR();
 
 // XOR
-	case 0xAE: // XOR (HL)
+	OP_CASE( 0xAE ): // XOR (HL)
 		data = READ( rp.hl );
 		goto xor_data;
 	
-	case 0xEE: // XOR imm
+	OP_CASE( 0xEE ): // XOR imm
 		pc++;
 		goto xor_data;
 	
-	CASE7( A8, A9, AA, AB, AC, AD, AF ): // XOR r
+	OP_CASE7( A8, A9, AA, AB, AC, AD, AF ): // XOR r
 		data = R8( opcode, 0xA8 );
 	xor_data:
 		rg.a ^= data;
 		flags = SZ28P( rg.a );
-		goto loop;
+		NEXT_INSTR();
 
 // LD
-	CASE7( 70, 71, 72, 73, 74, 75, 77 ): // LD (HL),r
+	OP_CASE7( 70, 71, 72, 73, 74, 75, 77 ): // LD (HL),r
 		WRITE( rp.hl, R8( opcode, 0x70 ) );
-		goto loop;
-	
-	CASE6( 41, 42, 43, 44, 45, 47 ): // LD B,r
-	CASE6( 48, 4A, 4B, 4C, 4D, 4F ): // LD C,r
-	CASE6( 50, 51, 53, 54, 55, 57 ): // LD D,r
-	CASE6( 58, 59, 5A, 5C, 5D, 5F ): // LD E,r
-	CASE6( 60, 61, 62, 63, 65, 67 ): // LD H,r
-	CASE6( 68, 69, 6A, 6B, 6C, 6F ): // LD L,r
-	CASE6( 78, 79, 7A, 7B, 7C, 7D ): // LD A,r
+		NEXT_INSTR();
+	
+	OP_CASE6( 41, 42, 43, 44, 45, 47 ): // LD B,r
+	OP_CASE6( 48, 4A, 4B, 4C, 4D, 4F ): // LD C,r
+	OP_CASE6( 50, 51, 53, 54, 55, 57 ): // LD D,r
+	OP_CASE6( 58, 59, 5A, 5C, 5D, 5F ): // LD E,r
+	OP_CASE6( 60, 61, 62, 63, 65, 67 ): // LD H,r
+	OP_CASE6( 68, 69, 6A, 6B, 6C, 6F ): // LD L,r
+	OP_CASE6( 78, 79, 7A, 7B, 7C, 7D ): // LD A,r
 		R8( opcode >> 3 & 7, 0 ) = R8( opcode & 7, 0 );
-		goto loop;
+		NEXT_INSTR();
 	
-	CASE5( 06, 0E, 16, 1E, 26 ): // LD r,imm
+	OP_CASE5( 06, 0E, 16, 1E, 26 ): // LD r,imm
 		R8( opcode >> 3, 0 ) = data;
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x36: // LD (HL),imm
+	OP_CASE( 0x36 ): // LD (HL),imm
 		pc++;
 		WRITE( rp.hl, data );
-		goto loop;
+		NEXT_INSTR();
 	
-	CASE7( 46, 4E, 56, 5E, 66, 6E, 7E ): // LD r,(HL)
+	OP_CASE7( 46, 4E, 56, 5E, 66, 6E, 7E ): // LD r,(HL)
 		R8( opcode >> 3, 8 ) = READ( rp.hl );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x01: // LD rp,imm
-	case 0x11:
-	case 0x21:
+	OP_CASE( 0x01 ): // LD rp,imm
+	OP_CASE( 0x11 ):
+	OP_CASE( 0x21 ):
 		R16( opcode, 4, 0x01 ) = GET_ADDR();
 		pc += 2;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x31: // LD sp,imm
+	OP_CASE( 0x31 ): // LD sp,imm
 		sp = GET_ADDR();
 		pc += 2;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x2A:{// LD HL,(addr)
+	OP_CASE( 0x2A ):{// LD HL,(addr)
 		fuint16 addr = GET_ADDR();
 		pc += 2;
 		rp.hl = READ_WORD( addr );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x32:{// LD (addr),A
+	OP_CASE( 0x32 ):{// LD (addr),A
 		fuint16 addr = GET_ADDR();
 		pc += 2;
 		WRITE( addr, rg.a );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x22:{// LD (addr),HL
+	OP_CASE( 0x22 ):{// LD (addr),HL
 		fuint16 addr = GET_ADDR();
 		pc += 2;
 		WRITE_WORD( addr, rp.hl );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x02: // LD (BC),A
-	case 0x12: // LD (DE),A
+	OP_CASE( 0x02 ): // LD (BC),A
+	OP_CASE( 0x12 ): // LD (DE),A
 		WRITE( R16( opcode, 4, 0x02 ), rg.a );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x0A: // LD A,(BC)
-	case 0x1A: // LD A,(DE)
+	OP_CASE( 0x0A ): // LD A,(BC)
+	OP_CASE( 0x1A ): // LD A,(DE)
 		rg.a = READ( R16( opcode, 4, 0x0A ) );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF9: // LD SP,HL
+	OP_CASE( 0xF9 ): // LD SP,HL
 		sp = rp.hl;
-		goto loop;
+		NEXT_INSTR();
 	
 // Rotate
 	
-	case 0x07:{// RLCA
+	OP_CASE( 0x07 ):{// RLCA
 		fuint16 temp = rg.a;
 		temp = (temp << 1) | (temp >> 7);
 		flags = (flags & (S80 | Z40 | P04)) |
 				(temp & (F20 | F08 | C01));
 		rg.a = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x0F:{// RRCA
+	OP_CASE( 0x0F ):{// RRCA
 		fuint16 temp = rg.a;
 		flags = (flags & (S80 | Z40 | P04)) |
 				(temp & C01);
 		temp = (temp << 7) | (temp >> 1);
 		flags |= temp & (F20 | F08);
 		rg.a = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x17:{// RLA
+	OP_CASE( 0x17 ):{// RLA
 		blargg_ulong temp = (rg.a << 1) | (flags & C01);
 		flags = (flags & (S80 | Z40 | P04)) |
 				(temp & (F20 | F08)) |
 				(temp >> 8);
 		rg.a = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x1F:{// RRA
+	OP_CASE( 0x1F ):{// RRA
 		fuint16 temp = (flags << 7) | (rg.a >> 1);
 		flags = (flags & (S80 | Z40 | P04)) |
 				(temp & (F20 | F08)) |
 				(rg.a & C01);
 		rg.a = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Misc
-	case 0x2F:{// CPL
+	OP_CASE( 0x2F ):{// CPL
 		fuint16 temp = ~rg.a;
 		flags = (flags & (S80 | Z40 | P04 | C01)) |
 				(temp & (F20 | F08)) |
 				(H10 | N02);
 		rg.a = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x3F:{// CCF
+	OP_CASE( 0x3F ):{// CCF
 		flags = ((flags & (S80 | Z40 | P04 | C01)) ^ C01) |
 				(flags << 4 & H10) |
 				(rg.a & (F20 | F08));
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x37: // SCF
+	OP_CASE( 0x37 ): // SCF
 		flags = (flags & (S80 | Z40 | P04)) | C01 |
 				(rg.a & (F20 | F08));
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xDB: // IN A,(imm)
+	OP_CASE( 0xDB ): // IN A,(imm)
 		pc++;
 		rg.a = IN( data + rg.a * 0x100 );
-		goto loop;
+		NEXT_INSTR();
 
-	case 0xE3:{// EX (SP),HL
+	OP_CASE( 0xE3 ):{// EX (SP),HL
 		fuint16 temp = READ_WORD( sp );
 		WRITE_WORD( sp, rp.hl );
 		rp.hl = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xEB:{// EX DE,HL
+	OP_CASE( 0xEB ):{// EX DE,HL
 		fuint16 temp = rp.hl;
 		rp.hl = rp.de;
 		rp.de = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xD9:{// EXX DE,HL
+	OP_CASE( 0xD9 ):{// EXX DE,HL
 		fuint16 temp = r.alt.w.bc;
 		r.alt.w.bc = rp.bc;
 		rp.bc = temp;
@@ -819,26 +898,26 @@ possibly_out_of_time:
 		temp = r.alt.w.hl;
 		r.alt.w.hl = rp.hl;
 		rp.hl = temp;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xF3: // DI
+	OP_CASE( 0xF3 ): // DI
 		r.iff1 = 0;
 		r.iff2 = 0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xFB: // EI
+	OP_CASE( 0xFB ): // EI
 		r.iff1 = 1;
 		r.iff2 = 1;
 		// TODO: delayed effect
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x76: // HALT
+	OP_CASE( 0x76 ): // HALT
 		goto halt;
 	
 //////////////////////////////////////// CB prefix
 	{
-	case 0xCB:
+	OP_CASE( 0xCB ):
 		unsigned data2;
 		data2 = instr [1];
 		pc++;
@@ -852,7 +931,7 @@ possibly_out_of_time:
 		result = uint8_t (result << 1) | (result >> 7);\
 		flags = SZ28P( result ) | (result & C01);\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x06: // RLC (HL)
@@ -870,7 +949,7 @@ possibly_out_of_time:
 		fuint16 result = (read << 1) | (flags & C01);\
 		flags = SZ28PC( result );\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x16: // RL (HL)
@@ -888,7 +967,7 @@ possibly_out_of_time:
 		fuint16 result = (read << 1) | add;\
 		flags = SZ28PC( result );\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x26: // SLA (HL)
@@ -921,7 +1000,7 @@ possibly_out_of_time:
 		result = uint8_t (result << 7) | (result >> 1);\
 		flags |= SZ28P( result );\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x0E: // RRC (HL)
@@ -941,7 +1020,7 @@ possibly_out_of_time:
 		result = uint8_t (flags << 7) | (result >> 1);\
 		flags = SZ28P( result ) | temp;\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x1E: // RR (HL)
@@ -961,7 +1040,7 @@ possibly_out_of_time:
 		result = (result & 0x80) | (result >> 1);\
 		flags |= SZ28P( result );\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x2E: // SRA (HL)
@@ -981,7 +1060,7 @@ possibly_out_of_time:
 		result >>= 1;\
 		flags |= SZ28P( result );\
 		write;\
-		goto loop;\
+		NEXT_INSTR();\
 	}
 		
 		case 0x3E: // SRL (HL)
@@ -1017,7 +1096,7 @@ possibly_out_of_time:
 			int masked = temp & 1 << (data >> 3 & 7);
 			flags |=(masked & S80) | H10 |
 					((masked - 1) >> 8 & (Z40 | P04));
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 	// SET/RES
@@ -1030,7 +1109,7 @@ possibly_out_of_time:
 			if ( !(data & 0x40) )
 				temp ^= bit; // RES
 			WRITE( rp.hl, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		CASE7( C0, C1, C2, C3, C4, C5, C7 ): // SET 0,r
@@ -1042,7 +1121,7 @@ possibly_out_of_time:
 		CASE7( F0, F1, F2, F3, F4, F5, F7 ): // SET 6,r
 		CASE7( F8, F9, FA, FB, FC, FD, FF ): // SET 7,r
 			R8( data & 7, 0 ) |= 1 << (data >> 3 & 7);
-			goto loop;
+			NEXT_INSTR();
 		
 		CASE7( 80, 81, 82, 83, 84, 85, 87 ): // RES 0,r
 		CASE7( 88, 89, 8A, 8B, 8C, 8D, 8F ): // RES 1,r
@@ -1053,7 +1132,7 @@ possibly_out_of_time:
 		CASE7( B0, B1, B2, B3, B4, B5, B7 ): // RES 6,r
 		CASE7( B8, B9, BA, BB, BC, BD, BF ): // RES 7,r
 			R8( data & 7, 0 ) &= ~(1 << (data >> 3 & 7));
-			goto loop;
+			NEXT_INSTR();
 		}
 		assert( false );
 	}
@@ -1063,7 +1142,7 @@ possibly_out_of_time:
 
 //////////////////////////////////////// ED prefix
 	{
-	case 0xED:
+	OP_CASE( 0xED ):
 		pc++;
 		s_time += ed_dd_timing [data] >> 4;
 		switch ( data )
@@ -1094,23 +1173,23 @@ possibly_out_of_time:
 					((temp - -0x8000) >> 14 & V04);
 			rp.hl = sum;
 			if ( (uint16_t) sum )
-				goto loop;
+				NEXT_INSTR();
 			flags |= Z40;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		CASE8( 40, 48, 50, 58, 60, 68, 70, 78 ):{// IN r,(C)
 			int temp = IN( rp.bc );
 			R8( data >> 3, 8 ) = temp;
 			flags = (flags & C01) | SZ28P( temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x71: // OUT (C),0
 			rg.flags = 0;
 		CASE7( 41, 49, 51, 59, 61, 69, 79 ): // OUT (C),r
 			OUT( rp.bc, R8( data >> 3, 8 ) );
-			goto loop;
+			NEXT_INSTR();
 		
 		{
 			unsigned temp;
@@ -1123,7 +1202,7 @@ possibly_out_of_time:
 			fuint16 addr = GET_ADDR();
 			pc += 2;
 			WRITE_WORD( addr, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x4B: // LD BC,(ADDR)
@@ -1131,14 +1210,14 @@ possibly_out_of_time:
 			fuint16 addr = GET_ADDR();
 			pc += 2;
 			R16( data, 4, 0x4B ) = READ_WORD( addr );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x7B:{// LD SP,(ADDR)
 			fuint16 addr = GET_ADDR();
 			pc += 2;
 			sp = READ_WORD( addr );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x67:{// RRD
@@ -1147,7 +1226,7 @@ possibly_out_of_time:
 			temp = (rg.a & 0xF0) | (temp & 0x0F);
 			flags = (flags & C01) | SZ28P( temp );
 			rg.a = temp;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x6F:{// RLD
@@ -1156,7 +1235,7 @@ possibly_out_of_time:
 			temp = (rg.a & 0xF0) | (temp >> 4);
 			flags = (flags & C01) | SZ28P( temp );
 			rg.a = temp;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		CASE8( 44, 4C, 54, 5C, 64, 6C, 74, 7C ): // NEG
@@ -1188,15 +1267,15 @@ possibly_out_of_time:
 			flags |= result & F08;
 			flags |= result << 4 & F20;
 			if ( !--rp.bc )
-				goto loop;
+				NEXT_INSTR();
 			
 			flags |= V04;
 			if ( flags & Z40 || data < 0xB0 )
-				goto loop;
+				NEXT_INSTR();
 			
 			pc -= 2;
 			s_time += 5;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		{
@@ -1220,15 +1299,15 @@ possibly_out_of_time:
 			flags = (flags & (S80 | Z40 | C01)) |
 					(temp & F08) | (temp << 4 & F20);
 			if ( !--rp.bc )
-				goto loop;
+				NEXT_INSTR();
 			
 			flags |= V04;
 			if ( data < 0xB0 )
-				goto loop;
+				NEXT_INSTR();
 			
 			pc -= 2;
 			s_time += 5;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		{
@@ -1253,7 +1332,7 @@ possibly_out_of_time:
 			}
 			
 			OUT( rp.bc, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		{
@@ -1280,18 +1359,18 @@ possibly_out_of_time:
 			}
 			
 			WRITE( addr, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x47: // LD I,A
 			r.i = rg.a;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x4F: // LD R,A
 			SET_R( rg.a );
 			dprintf( "LD R,A not supported\n" );
 			warning = true;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x57: // LD A,I
 			rg.a = r.i;
@@ -1303,7 +1382,7 @@ possibly_out_of_time:
 			warning = true;
 		ld_ai_common:
 			flags = (flags & C01) | SZ28( rg.a ) | (r.iff2 << 2 & V04);
-			goto loop;
+			NEXT_INSTR();
 		
 		CASE8( 45, 4D, 55, 5D, 65, 6D, 75, 7D ): // RETI/RETN
 			r.iff1 = r.iff2;
@@ -1311,20 +1390,20 @@ possibly_out_of_time:
 		
 		case 0x46: case 0x4E: case 0x66: case 0x6E: // IM 0
 			r.im = 0;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x56: case 0x76: // IM 1
 			r.im = 1;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x5E: case 0x7E: // IM 2
 			r.im = 2;
-			goto loop;
+			NEXT_INSTR();
 		
 		default:
 			dprintf( "Opcode $ED $%02X not supported\n", data );
 			warning = true;
-			goto loop;
+			NEXT_INSTR();
 		}
 		assert( false );
 	}
@@ -1332,10 +1411,10 @@ possibly_out_of_time:
 //////////////////////////////////////// DD/FD prefix
 	{
 	fuint16 ixy;
-	case 0xDD:
+	OP_CASE( 0xDD ):
 		ixy = ix;
 		goto ix_prefix;
-	case 0xFD:
+	OP_CASE( 0xFD ):
 		ixy = iy;
 	ix_prefix:
 		pc++;
@@ -1468,24 +1547,24 @@ possibly_out_of_time:
 				pc++, data = READ_PROG( pc );
 			pc++;
 			WRITE( IXY_DISP( ixy, (int8_t) data2 ), data );
-			goto loop;
+			NEXT_INSTR();
 
 		CASE5( 44, 4C, 54, 5C, 7C ): // LD r,HXY
 			R8( data >> 3, 8 ) = ixy >> 8;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x64: // LD HXY,HXY
 		case 0x6D: // LD LXY,LXY
-			goto loop;
+			NEXT_INSTR();
 		
 		CASE5( 45, 4D, 55, 5D, 7D ): // LD r,LXY
 			R8( data >> 3, 8 ) = ixy;
-			goto loop;
+			NEXT_INSTR();
 		
 		CASE7( 46, 4E, 56, 5E, 66, 6E, 7E ): // LD r,(IXY+disp)
 			pc++;
 			R8( data >> 3, 8 ) = READ( IXY_DISP( ixy, (int8_t) data2 ) );
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0x26: // LD HXY,imm
 			pc++;
@@ -1517,20 +1596,20 @@ possibly_out_of_time:
 			if ( opcode == 0xDD )
 			{
 				ix = ixy;
-				goto loop;
+				NEXT_INSTR();
 			}
 			iy = ixy;
-			goto loop;
+			NEXT_INSTR();
 
 		case 0xF9: // LD SP,IXY
 			sp = ixy;
-			goto loop;
+			NEXT_INSTR();
 	
 		case 0x22:{// LD (ADDR),IXY
 			fuint16 addr = GET_ADDR();
 			pc += 2;
 			WRITE_WORD( addr, ixy );
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		case 0x21: // LD IXY,imm
@@ -1568,7 +1647,7 @@ possibly_out_of_time:
 				flags = (flags & C01) | H10 |
 						(masked & S80) |
 						((masked - 1) >> 8 & (Z40 | P04));
-				goto loop;
+				NEXT_INSTR();
 			}
 			
 			CASE8( 86, 8E, 96, 9E, A6, AE, B6, BE ): // RES b,(IXY+disp)
@@ -1579,13 +1658,13 @@ possibly_out_of_time:
 				if ( !(data2 & 0x40) )
 					temp ^= bit; // RES
 				WRITE( data, temp );
-				goto loop;
+				NEXT_INSTR();
 			}
 			
 			default:
 				dprintf( "Opcode $%02X $CB $%02X not supported\n", opcode, data2 );
 				warning = true;
-				goto loop;
+				NEXT_INSTR();
 			}
 			assert( false );
 		}
@@ -1662,7 +1741,7 @@ possibly_out_of_time:
 		
 		case 0xE9: // JP (IXY)
 			pc = ixy;
-			goto loop;
+			NEXT_INSTR();
 		
 		case 0xE3:{// EX (SP),IXY
 			fuint16 temp = READ_WORD( sp );
@@ -1675,7 +1754,7 @@ possibly_out_of_time:
 			dprintf( "Unnecessary DD/FD prefix encountered\n" );
 			warning = true;
 			pc--;
-			goto loop;
+			NEXT_INSTR();
 		}
 		assert( false );
 	}
@@ -32,6 +32,9 @@ public:
 	// instruction was encountered at any point during run.
 	bool run( cpu_time_t end_time );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Time of beginning of next instruction
 	cpu_time_t time() const             { return state->time + state->base; }
 	
@@ -77,6 +80,11 @@ public:
 	// can read this far past end of a page
 	enum { cpu_padding = 0x100 };
 	
+	// Save/load registers, memory map and timing (see blargg_copy_func_t). Not
+	// supported during run() call. Memory map holds pointers, so state can only be
+	// loaded back into the same emulator.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Kss_Cpu();
 	enum { page_shift = 13 };
@@ -92,6 +100,7 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	void set_end_time( cpu_time_t t );
 	void set_page( int i, void* write, void const* read );
 public:
@@ -101,7 +101,9 @@ struct Kss_File : Gme_Info_
 static Music_Emu* new_kss_emu () { return BLARGG_NEW Kss_Emu ; }
 static Music_Emu* new_kss_file() { return BLARGG_NEW Kss_File; }
 
-gme_type_t_ const gme_kss_type [1] = { "MSX", 256, &new_kss_emu, &new_kss_file, "KSS", 0x03 };
+gme_type_t_ const gme_kss_type [1] = { "MSX", 256, &new_kss_emu, &new_kss_file, "KSS", 0x03,
+		gme_caps_fast_skip | gme_caps_multi_chip | gme_caps_float | gme_caps_find_loop |
+		gme_caps_state, clock_rate };
 
 // Setup
 
@@ -192,7 +194,7 @@ void Kss_Emu::set_tempo_( double t )
 blargg_err_t Kss_Emu::start_track_( int track )
 {
 	RETURN_ERR( Classic_Emu::start_track_( track ) );
-
+	
 	memset( ram, 0xC9, 0x4000 );
 	memset( ram + 0x4000, 0, sizeof ram - 0x4000 );
 	
@@ -321,6 +323,7 @@ void kss_cpu_out( Kss_Cpu* cpu, cpu_time_t time, unsigned addr, int data )
 	
 	case 0xA1:
 		GME_APU_HOOK( &emu, emu.ay_latch, data );
+		emu.probe_apu_write( emu.ay_latch, data );
 		emu.ay.write( time, emu.ay_latch, data );
 		return;
 	
@@ -337,6 +340,7 @@ void kss_cpu_out( Kss_Cpu* cpu, cpu_time_t time, unsigned addr, int data )
 		if ( emu.sn )
 		{
 			GME_APU_HOOK( &emu, 16, data );
+			emu.probe_apu_write( (data & 0x80) ? 16 + (data >> 4 & 7) : 24, data );
 			emu.sn->write_data( time, data );
 			return;
 		}
@@ -372,6 +376,31 @@ int kss_cpu_in( Kss_Cpu*, cpu_time_t, unsigned addr )
 
 // Emulation
 
+blargg_err_t Kss_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( next_play );
+	BLARGG_COPY( ay_latch );
+	BLARGG_COPY( ram );
+	ay.copy_state( io, copy );
+	scc.copy_state( io, copy );
+	if ( sn )
+		sn->copy_state( io, copy );
+	
+	BLARGG_COPY( scc_accessed );
+	BLARGG_COPY( gain_updated );
+	if ( loading_state() )
+	{
+		// gain is only raised for SCC once play routine has been called
+		bool const accessed = scc_accessed;
+		scc_accessed = accessed && gain_updated;
+		update_gain();
+		scc_accessed = accessed;
+	}
+	return 0;
+}
+
 blargg_err_t Kss_Emu::run_clocks( blip_time_t& duration, int )
 {
 	while ( time() < duration )
@@ -397,6 +426,8 @@ blargg_err_t Kss_Emu::run_clocks( blip_time_t& duration, int )
 				ram [--r.sp] = idle_addr & 0xFF;
 				r.pc = get_le16( header_.play_addr );
 				GME_FRAME_HOOK( this );
+				if ( probing() )
+					probe_frame( time(), ram, sizeof ram );
 			}
 		}
 	}
@@ -55,6 +55,8 @@ protected:
 	blargg_err_t load_( Data_Reader& );
 	blargg_err_t start_track_( int );
 	blargg_err_t run_clocks( blip_time_t&, int );
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
+	blargg_ulong cpu_instr_count() const { return cpu::instr_count(); }
 	void set_tempo_( double );
 	void set_voice( int, Blip_Buffer*, Blip_Buffer*, Blip_Buffer* );
 	void update_eq( blip_eq_t const& );
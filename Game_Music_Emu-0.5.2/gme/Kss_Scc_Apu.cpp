@@ -21,21 +21,29 @@ unsigned const inaudible_freq = 16384;
 
 int const wave_size = 0x20;
 
+void Scc_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	for ( int i = 0; i < osc_count; i++ )
+		copy( io, &oscs [i], offsetof (osc_t,output) );
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( regs );
+}
+
 void Scc_Apu::run_until( blip_time_t end_time )
 {
 	for ( int index = 0; index < osc_count; index++ )
 	{
 		osc_t& osc = oscs [index];
 		
+		// without output, just maintain phase
 		Blip_Buffer* const output = osc.output;
-		if ( !output )
-			continue;
-		output->set_modified();
+		if ( output )
+			output->set_modified();
 		
 		blip_time_t period = (regs [0x80 + index * 2 + 1] & 0x0F) * 0x100 +
 				regs [0x80 + index * 2] + 1;
 		int volume = 0;
-		if ( regs [0x8F] & (1 << index) )
+		if ( output && regs [0x8F] & (1 << index) )
 		{
 			blip_time_t inaudible_period = (blargg_ulong) (output->clock_rate() +
 					inaudible_freq * 32) / (inaudible_freq * 16);
@@ -46,6 +54,7 @@ void Scc_Apu::run_until( blip_time_t end_time )
 		BOOST::int8_t const* wave = (BOOST::int8_t*) regs + index * wave_size;
 		if ( index == osc_count - 1 )
 			wave -= wave_size; // last two oscs share wave
+		if ( output )
 		{
 			int amp = wave [osc.phase] * volume;
 			int delta = amp - osc.last_amp;
@@ -68,26 +77,46 @@ void Scc_Apu::run_until( blip_time_t end_time )
 			}
 			else
 			{
+				blargg_long count = (end_time - time + period - 1) / period;
 				
+				// find transitions over one cycle (or less) from current phase,
+				// then run whole cycles of just those
+				int step  [wave_size];
+				int delta [wave_size];
+				int transitions = 0;
 				int phase = osc.phase;
 				int last_wave = wave [phase];
-				phase = (phase + 1) & (wave_size - 1); // pre-advance for optimal inner loop
-				
-				do
+				int steps = (count < wave_size ? (int) count : wave_size);
+				for ( int i = 0; i < steps; i++ )
 				{
-					int amp = wave [phase];
-					phase = (phase + 1) & (wave_size - 1);
-					int delta = amp - last_wave;
-					if ( delta )
+					int amp = wave [(phase + 1 + i) & (wave_size - 1)];
+					if ( amp != last_wave )
 					{
+						step  [transitions] = i;
+						delta [transitions] = (amp - last_wave) * volume;
+						transitions++;
 						last_wave = amp;
-						synth.offset( time, delta * volume, output );
 					}
-					time += period;
 				}
-				while ( time < end_time );
 				
-				osc.phase = phase = (phase - 1) & (wave_size - 1); // undo pre-advance
+				if ( transitions )
+				{
+					blip_time_t const cycle = period * wave_size;
+					blip_time_t cycle_time = time;
+					for ( blargg_long base = 0; base < count; base += wave_size )
+					{
+						for ( int i = 0; i < transitions; i++ )
+						{
+							if ( base + step [i] >= count )
+								break;
+							synth.offset( cycle_time + step [i] * period, delta [i], output );
+						}
+						cycle_time += cycle;
+					}
+				}
+				
+				time += count * period;
+				osc.phase = phase = (phase + count) & (wave_size - 1);
 				osc.last_amp = wave [phase] * volume;
 			}
 		}
@@ -38,6 +38,10 @@ public:
 	// Set treble equalization (see documentation)
 	void treble_eq( blip_eq_t const& );
 	
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs and volume aren't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
 	Scc_Apu();
 private:
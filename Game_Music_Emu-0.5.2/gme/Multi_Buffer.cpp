@@ -2,6 +2,14 @@
 
 #include "Multi_Buffer.h"
 
+#include <string.h>
+
+#if BLIP_BUFFER_SSE2
+	#include <emmintrin.h>
+#elif BLIP_BUFFER_NEON
+	#include <arm_neon.h>
+#endif
+
 /* Copyright (C) 2003-2006 Shay Green. This module is free software; you
 can redistribute it and/or modify it under the terms of the GNU Lesser
 General Public License as published by the Free Software Foundation; either
@@ -28,6 +36,34 @@ Multi_Buffer::Multi_Buffer( int spf ) : samples_per_frame_( spf )
 
 blargg_err_t Multi_Buffer::set_channel_count( int ) { return 0; }
 
+long Multi_Buffer::read_samples( float* out, long count )
+{
+	long total = 0;
+	blip_sample_t buf [1024];
+	while ( total < count )
+	{
+		long n = read_samples( buf, min( count - total, (long) (sizeof buf / sizeof buf [0]) ) );
+		if ( !n )
+			break;
+		for ( long i = 0; i < n; i++ )
+			out [total + i] = buf [i] * (1.0f / 0x8000);
+		total += n;
+	}
+	return total;
+}
+
+void Multi_Buffer::remove_samples( long count )
+{
+	blip_sample_t buf [1024];
+	while ( count )
+	{
+		long n = read_samples( buf, min( count, (long) (sizeof buf / sizeof buf [0]) ) );
+		if ( !n )
+			break;
+		count -= n;
+	}
+}
+
 // Silent_Buffer
 
 Silent_Buffer::Silent_Buffer() : Multi_Buffer( 1 ) // 0 channels would probably confuse
@@ -55,6 +91,12 @@ blargg_err_t Mono_Buffer::set_sample_rate( long rate, int msec )
 	return Multi_Buffer::set_sample_rate( buf.sample_rate(), buf.length() );
 }
 
+blargg_err_t Mono_Buffer::change_sample_rate( long rate )
+{
+	RETURN_ERR( buf.change_sample_rate( rate ) );
+	return Multi_Buffer::set_sample_rate( buf.sample_rate(), buf.length() );
+}
+
 // Stereo_Buffer
 
 Stereo_Buffer::Stereo_Buffer() : Multi_Buffer( 2 )
@@ -73,6 +115,13 @@ blargg_err_t Stereo_Buffer::set_sample_rate( long rate, int msec )
 	return Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() );
 }
 
+blargg_err_t Stereo_Buffer::change_sample_rate( long rate )
+{
+	for ( int i = 0; i < buf_count; i++ )
+		RETURN_ERR( bufs [i].change_sample_rate( rate ) );
+	return Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() );
+}
+
 void Stereo_Buffer::clock_rate( long rate )
 {
 	for ( int i = 0; i < buf_count; i++ )
@@ -103,7 +152,21 @@ void Stereo_Buffer::end_frame( blip_time_t clock_count )
 	}
 }
 
-long Stereo_Buffer::read_samples( blip_sample_t* out, long count )
+void Stereo_Buffer::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( stereo_added );
+	BLARGG_COPY( was_stereo );
+	for ( int i = 0; i < buf_count; i++ )
+		bufs [i].copy_state( io, copy );
+}
+
+blip_ulong Stereo_Buffer::synth_count() const
+{
+	return bufs [0].synth_count() + bufs [1].synth_count() + bufs [2].synth_count();
+}
+
+template<class T>
+long Stereo_Buffer::read_samples_( T* out, long count )
 {
 	require( !(count & 1) ); // count must be even
 	count = (unsigned) count / 2;
@@ -148,6 +211,196 @@ long Stereo_Buffer::read_samples( blip_sample_t* out, long count )
 	return count * 2;
 }
 
+long Stereo_Buffer::read_samples( blip_sample_t* out, long count )
+{
+	return read_samples_( out, count );
+}
+
+long Stereo_Buffer::read_samples( float* out, long count )
+{
+	return read_samples_( out, count );
+}
+
+void Stereo_Buffer::remove_samples( long count )
+{
+	require( !(count & 1) ); // count must be even
+	count = (unsigned) count / 2;
+	
+	long avail = bufs [0].samples_avail();
+	if ( count > avail )
+		count = avail;
+	for ( int i = 0; i < buf_count; i++ )
+		bufs [i].remove_samples( count );
+	
+	if ( !bufs [0].samples_avail() )
+	{
+		was_stereo   = stereo_added;
+		stereo_added = 0;
+	}
+}
+
+#if BLIP_BUFFER_SSE2 || BLIP_BUFFER_NEON
+
+// Runs the readers of center, left and right buffers in separate lanes of a vector
+// and writes interleaved stereo output directly. Center is NULL if unused. Gives
+// exactly the same results as the scalar code below, since saturating narrowing
+// matches its clamping for the range of values a reader can produce.
+
+typedef Blip_Buffer::buf_t_ const* BLIP_RESTRICT mix_in_t;
+
+#if BLIP_BUFFER_SSE2
+
+#define MIX_SAMPLE( in, pair ) {\
+	__m128i s_ = _mm_srai_epi32( acc, blip_sample_bits - 16 );\
+	acc = _mm_add_epi32( acc, _mm_sub_epi32( (in), _mm_sra_epi32( acc, bass ) ) );\
+	s_ = _mm_add_epi32( s_, _mm_shuffle_epi32( s_, 0 ) );\
+	pair = _mm_shuffle_epi32( s_, _MM_SHUFFLE( 3, 3, 2, 1 ) );\
+}
+
+void blip_mix_stereo_( blip_sample_t* BLIP_RESTRICT out, Blip_Buffer* center,
+		Blip_Buffer& left, Blip_Buffer& right, blargg_long count )
+{
+	mix_in_t cin = center ? center->buffer_ : 0;
+	mix_in_t lin = left.buffer_;
+	mix_in_t rin = right.buffer_;
+	__m128i const bass = _mm_cvtsi32_si128( BLIP_READER_BASS( left ) );
+	__m128i const zero = _mm_setzero_si128();
+	
+	// lanes: center, left, right, unused
+	__m128i acc = _mm_setr_epi32( center ? center->reader_accum_ : 0,
+			left.reader_accum_, right.reader_accum_, 0 );
+	
+	for ( ; count >= 4; count -= 4 )
+	{
+		__m128i c = zero;
+		if ( cin )
+		{
+			c = _mm_loadu_si128( (__m128i const*) cin );
+			cin += 4;
+		}
+		__m128i l = _mm_loadu_si128( (__m128i const*) lin );
+		__m128i r = _mm_loadu_si128( (__m128i const*) rin );
+		lin += 4;
+		rin += 4;
+		
+		// transpose so that each vector holds one sample from each buffer
+		__m128i cl_lo = _mm_unpacklo_epi32( c, l );
+		__m128i cl_hi = _mm_unpackhi_epi32( c, l );
+		__m128i r_lo  = _mm_unpacklo_epi32( r, zero );
+		__m128i r_hi  = _mm_unpackhi_epi32( r, zero );
+		
+		__m128i p0, p1, p2, p3;
+		MIX_SAMPLE( _mm_unpacklo_epi64( cl_lo, r_lo ), p0 );
+		MIX_SAMPLE( _mm_unpackhi_epi64( cl_lo, r_lo ), p1 );
+		MIX_SAMPLE( _mm_unpacklo_epi64( cl_hi, r_hi ), p2 );
+		MIX_SAMPLE( _mm_unpackhi_epi64( cl_hi, r_hi ), p3 );
+		
+		_mm_storeu_si128( (__m128i*) out, _mm_packs_epi32(
+				_mm_unpacklo_epi64( p0, p1 ), _mm_unpacklo_epi64( p2, p3 ) ) );
+		out += 8;
+	}
+	
+	for ( ; count; --count )
+	{
+		__m128i pair;
+		MIX_SAMPLE( _mm_setr_epi32( cin ? *cin++ : 0, *lin++, *rin++, 0 ), pair );
+		int lr = _mm_cvtsi128_si32( _mm_packs_epi32( pair, pair ) );
+		memcpy( out, &lr, sizeof lr );
+		out += 2;
+	}
+	
+	blip_long accums [4];
+	_mm_storeu_si128( (__m128i*) accums, acc );
+	if ( center )
+		center->reader_accum_ = accums [0];
+	left.reader_accum_  = accums [1];
+	right.reader_accum_ = accums [2];
+}
+
+#else
+
+#define MIX_SAMPLE( in, pair ) {\
+	int32x4_t s_ = vshrq_n_s32( acc, blip_sample_bits - 16 );\
+	acc = vaddq_s32( acc, vsubq_s32( (in), vshlq_s32( acc, bass ) ) );\
+	s_ = vaddq_s32( s_, vdupq_n_s32( vgetq_lane_s32( s_, 0 ) ) );\
+	pair = vget_low_s32( vextq_s32( s_, s_, 1 ) );\
+}
+
+void blip_mix_stereo_( blip_sample_t* BLIP_RESTRICT out, Blip_Buffer* center,
+		Blip_Buffer& left, Blip_Buffer& right, blargg_long count )
+{
+	mix_in_t cin = center ? center->buffer_ : 0;
+	mix_in_t lin = left.buffer_;
+	mix_in_t rin = right.buffer_;
+	int32x4_t const bass = vdupq_n_s32( -BLIP_READER_BASS( left ) ); // negative shifts right
+	int32x4_t const zero = vdupq_n_s32( 0 );
+	
+	// lanes: center, left, right, unused
+	blip_long accums [4] = { center ? center->reader_accum_ : 0,
+			left.reader_accum_, right.reader_accum_, 0 };
+	int32x4_t acc = vld1q_s32( accums );
+	
+	for ( ; count >= 4; count -= 4 )
+	{
+		int32x4_t c = zero;
+		if ( cin )
+		{
+			c = vld1q_s32( cin );
+			cin += 4;
+		}
+		int32x4_t l = vld1q_s32( lin );
+		int32x4_t r = vld1q_s32( rin );
+		lin += 4;
+		rin += 4;
+		
+		// transpose so that each vector holds one sample from each buffer
+		int32x4x2_t cl = vtrnq_s32( c, l );
+		int32x4x2_t rz = vtrnq_s32( r, zero );
+		
+		int32x2_t p0, p1, p2, p3;
+		MIX_SAMPLE( vcombine_s32( vget_low_s32 ( cl.val [0] ), vget_low_s32 ( rz.val [0] ) ), p0 );
+		MIX_SAMPLE( vcombine_s32( vget_low_s32 ( cl.val [1] ), vget_low_s32 ( rz.val [1] ) ), p1 );
+		MIX_SAMPLE( vcombine_s32( vget_high_s32( cl.val [0] ), vget_high_s32( rz.val [0] ) ), p2 );
+		MIX_SAMPLE( vcombine_s32( vget_high_s32( cl.val [1] ), vget_high_s32( rz.val [1] ) ), p3 );
+		
+		vst1q_s16( out, vcombine_s16( vqmovn_s32( vcombine_s32( p0, p1 ) ),
+				vqmovn_s32( vcombine_s32( p2, p3 ) ) ) );
+		out += 8;
+	}
+	
+	for ( ; count; --count )
+	{
+		blip_long in [4] = { cin ? *cin++ : 0, *lin++, *rin++, 0 };
+		int32x2_t pair;
+		MIX_SAMPLE( vld1q_s32( in ), pair );
+		vst1_lane_s32( (int32_t*) out, vreinterpret_s32_s16(
+				vqmovn_s32( vcombine_s32( pair, pair ) ) ), 0 );
+		out += 2;
+	}
+	
+	vst1q_s32( accums, acc );
+	if ( center )
+		center->reader_accum_ = accums [0];
+	left.reader_accum_  = accums [1];
+	right.reader_accum_ = accums [2];
+}
+
+#endif
+
+#undef MIX_SAMPLE
+
+void Stereo_Buffer::mix_stereo( blip_sample_t* out, blargg_long count )
+{
+	blip_mix_stereo_( out, &bufs [0], bufs [1], bufs [2], count );
+}
+
+void Stereo_Buffer::mix_stereo_no_center( blip_sample_t* out, blargg_long count )
+{
+	blip_mix_stereo_( out, 0, bufs [1], bufs [2], count );
+}
+
+#else
+
 void Stereo_Buffer::mix_stereo( blip_sample_t* out_, blargg_long count )
 {
 	blip_sample_t* BLIP_RESTRICT out = out_;
@@ -210,6 +463,8 @@ void Stereo_Buffer::mix_stereo_no_center( blip_sample_t* out_, blargg_long count
 	BLIP_READER_END( left, bufs [1] );
 }
 
+#endif
+
 void Stereo_Buffer::mix_mono( blip_sample_t* out_, blargg_long count )
 {
 	blip_sample_t* BLIP_RESTRICT out = out_;
@@ -230,3 +485,69 @@ void Stereo_Buffer::mix_mono( blip_sample_t* out_, blargg_long count )
 	
 	BLIP_READER_END( center, bufs [0] );
 }
+
+// Floating-point mixing uses full internal resolution and doesn't clamp
+
+void Stereo_Buffer::mix_stereo( float* out_, blargg_long count )
+{
+	float* BLIP_RESTRICT out = out_;
+	int const bass = BLIP_READER_BASS( bufs [1] );
+	BLIP_READER_BEGIN( left, bufs [1] );
+	BLIP_READER_BEGIN( right, bufs [2] );
+	BLIP_READER_BEGIN( center, bufs [0] );
+	
+	for ( ; count; --count )
+	{
+		float c = BLIP_READER_READ_RAW( center ) * blip_float_scale;
+		out [0] = c + BLIP_READER_READ_RAW( left  ) * blip_float_scale;
+		out [1] = c + BLIP_READER_READ_RAW( right ) * blip_float_scale;
+		out += 2;
+		
+		BLIP_READER_NEXT( center, bass );
+		BLIP_READER_NEXT( left, bass );
+		BLIP_READER_NEXT( right, bass );
+	}
+	
+	BLIP_READER_END( center, bufs [0] );
+	BLIP_READER_END( right, bufs [2] );
+	BLIP_READER_END( left, bufs [1] );
+}
+
+void Stereo_Buffer::mix_stereo_no_center( float* out_, blargg_long count )
+{
+	float* BLIP_RESTRICT out = out_;
+	int const bass = BLIP_READER_BASS( bufs [1] );
+	BLIP_READER_BEGIN( left, bufs [1] );
+	BLIP_READER_BEGIN( right, bufs [2] );
+	
+	for ( ; count; --count )
+	{
+		out [0] = BLIP_READER_READ_RAW( left  ) * blip_float_scale;
+		out [1] = BLIP_READER_READ_RAW( right ) * blip_float_scale;
+		out += 2;
+		
+		BLIP_READER_NEXT( left, bass );
+		BLIP_READER_NEXT( right, bass );
+	}
+	
+	BLIP_READER_END( right, bufs [2] );
+	BLIP_READER_END( left, bufs [1] );
+}
+
+void Stereo_Buffer::mix_mono( float* out_, blargg_long count )
+{
+	float* BLIP_RESTRICT out = out_;
+	int const bass = BLIP_READER_BASS( bufs [0] );
+	BLIP_READER_BEGIN( center, bufs [0] );
+	
+	for ( ; count; --count )
+	{
+		float s = BLIP_READER_READ_RAW( center ) * blip_float_scale;
+		BLIP_READER_NEXT( center, bass );
+		out [0] = s;
+		out [1] = s;
+		out += 2;
+	}
+	
+	BLIP_READER_END( center, bufs [0] );
+}
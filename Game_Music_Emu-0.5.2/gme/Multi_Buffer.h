@@ -30,6 +30,13 @@ public:
 	// See Blip_Buffer.h
 	virtual blargg_err_t set_sample_rate( long rate, int msec = blip_default_length ) = 0;
 	virtual void clock_rate( long ) = 0;
+	
+	// Change sample rate while playing, keeping buffer length. All samples must
+	// have been read out. Default calls set_sample_rate(), which clears buffer;
+	// buffers made of Blip_Buffers use Blip_Buffer::change_sample_rate() instead,
+	// so sound continues without a click.
+	virtual blargg_err_t change_sample_rate( long rate );
+
 	virtual void bass_freq( int ) = 0;
 	virtual void clear() = 0;
 	long sample_rate() const;
@@ -51,6 +58,23 @@ public:
 	virtual long read_samples( blip_sample_t*, long ) = 0;
 	virtual long samples_avail() const = 0;
 	
+	// Read floating-point samples (see Blip_Buffer.h). Default converts output of
+	// read_samples() above, so clamping still occurs unless this is overridden.
+	virtual long read_samples( float*, long );
+	
+	// Remove count samples without reading them, for when sound is being skipped.
+	// Default reads and discards them.
+	virtual void remove_samples( long count );
+	
+	// Total synth_count() of all Blip_Buffers (see Blip_Buffer.h). Default is 0.
+	virtual blip_ulong synth_count() const { return 0; }
+	
+	// Save/restore samples waiting to be read, and anything else affecting those
+	// to come (see blargg_copy_func_t). Sample rate, clock rate, length and channel
+	// configuration must be the same when restoring. Default copies nothing, so
+	// that buffered samples are lost when restoring.
+	virtual void copy_state( unsigned char**, blargg_copy_func_t ) { }
+	
 public:
 	BLARGG_DISABLE_NOTHROW
 protected:
@@ -78,13 +102,18 @@ public:
 	Mono_Buffer();
 	~Mono_Buffer();
 	blargg_err_t set_sample_rate( long rate, int msec = blip_default_length );
+	blargg_err_t change_sample_rate( long rate );
 	void clock_rate( long rate ) { buf.clock_rate( rate ); }
 	void bass_freq( int freq ) { buf.bass_freq( freq ); }
 	void clear() { buf.clear(); }
 	long samples_avail() const { return buf.samples_avail(); }
 	long read_samples( blip_sample_t* p, long s ) { return buf.read_samples( p, s ); }
+	long read_samples( float* p, long s ) { return buf.read_samples( p, s ); }
+	void remove_samples( long s ) { buf.remove_samples( s ); }
 	channel_t channel( int, int ) { return chan; }
 	void end_frame( blip_time_t t ) { buf.end_frame( t ); }
+	blip_ulong synth_count() const { return buf.synth_count(); }
+	void copy_state( unsigned char** io, blargg_copy_func_t copy ) { buf.copy_state( io, copy ); }
 };
 
 // Uses three buffers (one for center) and outputs stereo sample pairs.
@@ -100,6 +129,7 @@ public:
 	Stereo_Buffer();
 	~Stereo_Buffer();
 	blargg_err_t set_sample_rate( long, int msec = blip_default_length );
+	blargg_err_t change_sample_rate( long );
 	void clock_rate( long );
 	void bass_freq( int );
 	void clear();
@@ -108,6 +138,10 @@ public:
 	
 	long samples_avail() const { return bufs [0].samples_avail() * 2; }
 	long read_samples( blip_sample_t*, long );
+	long read_samples( float*, long );
+	void remove_samples( long );
+	blip_ulong synth_count() const;
+	void copy_state( unsigned char**, blargg_copy_func_t );
 	
 private:
 	enum { buf_count = 3 };
@@ -116,9 +150,13 @@ private:
 	int stereo_added;
 	int was_stereo;
 	
+	template<class T> long read_samples_( T*, long );
 	void mix_stereo_no_center( blip_sample_t*, blargg_long );
 	void mix_stereo( blip_sample_t*, blargg_long );
 	void mix_mono( blip_sample_t*, blargg_long );
+	void mix_stereo_no_center( float*, blargg_long );
+	void mix_stereo( float*, blargg_long );
+	void mix_mono( float*, blargg_long );
 };
 
 // Silent_Buffer generates no samples, useful where no sound is wanted
@@ -137,8 +175,18 @@ public:
 	void end_frame( blip_time_t ) { }
 	long samples_avail() const { return 0; }
 	long read_samples( blip_sample_t*, long ) { return 0; }
+	long read_samples( float*, long ) { return 0; }
+	void remove_samples( long ) { }
 };
 
+// End of public interface
+
+#if BLIP_BUFFER_SSE2 || BLIP_BUFFER_NEON
+	// Mix center (if not NULL), left and right buffers into clamped stereo pairs
+	// without removing samples. Used by Stereo_Buffer and Effects_Buffer.
+	void blip_mix_stereo_( blip_sample_t* out, Blip_Buffer* center, Blip_Buffer& left,
+			Blip_Buffer& right, blargg_long count );
+#endif
 
 inline blargg_err_t Multi_Buffer::set_sample_rate( long rate, int msec )
 {
@@ -147,6 +195,11 @@ inline blargg_err_t Multi_Buffer::set_sample_rate( long rate, int msec )
 	return 0;
 }
 
+inline blargg_err_t Multi_Buffer::change_sample_rate( long rate )
+{
+	return set_sample_rate( rate, length() );
+}
+
 inline int Multi_Buffer::samples_per_frame() const { return samples_per_frame_; }
 
 inline long Multi_Buffer::sample_rate() const { return sample_rate_; }
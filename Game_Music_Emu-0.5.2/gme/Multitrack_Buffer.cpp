@@ -0,0 +1,268 @@
+// Game_Music_Emu 0.5.2. http://www.slack.net/~ant/
+
+#include "Multitrack_Buffer.h"
+
+#include <string.h>
+
+/* Copyright (C) 2006 Shay Green. This module is free software; you
+can redistribute it and/or modify it under the terms of the GNU Lesser
+General Public License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version. This
+module is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+details. You should have received a copy of the GNU Lesser General Public
+License along with this module; if not, write to the Free Software Foundation,
+Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include "blargg_source.h"
+
+int const mix_chunk = 512; // samples mixed at a time by read_samples()
+
+Multitrack_Buffer::Multitrack_Buffer() : Multi_Buffer( 2 )
+{
+	voice_count = 1;
+	clock_rate_ = 0;
+	bass_freq_  = 16;
+	voices_added = 0;
+	was_added    = 0;
+}
+
+Multitrack_Buffer::~Multitrack_Buffer() { }
+
+blargg_err_t Multitrack_Buffer::set_sample_rate( long rate, int msec )
+{
+	for ( int i = 0; i < voice_count; i++ )
+		RETURN_ERR( bufs [i].set_sample_rate( rate, msec ) );
+	return Multi_Buffer::set_sample_rate( bufs [0].sample_rate(), bufs [0].length() );
+}
+
+// Buffers for new voices get the settings the others already have
+blargg_err_t Multitrack_Buffer::set_channel_count( int count )
+{
+	if ( count > max_voices )
+		return "Too many voices for multitrack output";
+	
+	for ( int i = voice_count; i < count; i++ )
+	{
+		if ( sample_rate() )
+		{
+			RETURN_ERR( bufs [i].set_sample_rate( sample_rate(), length() ) );
+			if ( clock_rate_ )
+				bufs [i].clock_rate( clock_rate_ );
+		}
+		bufs [i].bass_freq( bass_freq_ );
+	}
+	if ( count < 1 )
+		count = 1;
+	if ( count != voice_count )
+	{
+		voice_count = count;
+		channels_changed();
+	}
+	return 0;
+}
+
+void Multitrack_Buffer::clock_rate( long rate )
+{
+	clock_rate_ = rate;
+	for ( int i = 0; i < voice_count; i++ )
+		bufs [i].clock_rate( rate );
+}
+
+void Multitrack_Buffer::bass_freq( int bass )
+{
+	bass_freq_ = bass;
+	for ( int i = 0; i < voice_count; i++ )
+		bufs [i].bass_freq( bass );
+}
+
+void Multitrack_Buffer::clear()
+{
+	voices_added = 0;
+	was_added    = 0;
+	for ( int i = 0; i < voice_count; i++ )
+		bufs [i].clear();
+}
+
+Multi_Buffer::channel_t Multitrack_Buffer::channel( int index, int )
+{
+	channel_t ch;
+	ch.center = &bufs [index < voice_count ? index : 0];
+	ch.left   = ch.center;
+	ch.right  = ch.center;
+	return ch;
+}
+
+void Multitrack_Buffer::end_frame( blip_time_t clock_count )
+{
+	voices_added = 0;
+	for ( int i = 0; i < voice_count; i++ )
+	{
+		voices_added |= (blargg_ulong) bufs [i].clear_modified() << i;
+		bufs [i].end_frame( clock_count );
+	}
+}
+
+blip_ulong Multitrack_Buffer::synth_count() const
+{
+	blip_ulong n = 0;
+	for ( int i = 0; i < max_voices; i++ )
+		n += bufs [i].synth_count();
+	return n;
+}
+
+void Multitrack_Buffer::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( voices_added );
+	BLARGG_COPY( was_added );
+	for ( int i = 0; i < voice_count; i++ )
+		bufs [i].copy_state( io, copy );
+}
+
+long Multitrack_Buffer::read_voices( blip_sample_t* const* out, long count, long offset )
+{
+	long avail = bufs [0].samples_avail();
+	if ( count > avail )
+		count = avail;
+	if ( count )
+	{
+		for ( int i = 0; i < voice_count; i++ )
+		{
+			if ( out [i] )
+				bufs [i].read_samples( out [i] + offset, count );
+			else
+				bufs [i].remove_samples( count );
+		}
+		
+		if ( !bufs [0].samples_avail() )
+		{
+			was_added    = voices_added;
+			voices_added = 0;
+		}
+	}
+	return count;
+}
+
+// Mixes voices which have had sound added, in chunks
+
+void Multitrack_Buffer::mix( blip_sample_t* out, int count )
+{
+	blargg_long sum [mix_chunk];
+	memset( sum, 0, count * sizeof sum [0] );
+	
+	blargg_ulong const used = voices_added | was_added;
+	for ( int v = 0; v < voice_count; v++ )
+	{
+		if ( !(used >> v & 1) )
+			continue;
+		
+		int const bass = BLIP_READER_BASS( bufs [v] );
+		BLIP_READER_BEGIN( in, bufs [v] );
+		for ( int i = 0; i < count; i++ )
+		{
+			sum [i] += BLIP_READER_READ( in );
+			BLIP_READER_NEXT( in, bass );
+		}
+		BLIP_READER_END( in, bufs [v] );
+	}
+	
+	for ( int i = 0; i < count; i++ )
+	{
+		blargg_long s = sum [i];
+		if ( (BOOST::int16_t) s != s )
+			s = 0x7FFF - (s >> 24);
+		out [0] = (blip_sample_t) s;
+		out [1] = (blip_sample_t) s;
+		out += 2;
+	}
+}
+
+// Floating-point mixing uses full internal resolution and doesn't clamp
+
+void Multitrack_Buffer::mix( float* out, int count )
+{
+	float sum [mix_chunk];
+	for ( int i = 0; i < count; i++ )
+		sum [i] = 0;
+	
+	blargg_ulong const used = voices_added | was_added;
+	for ( int v = 0; v < voice_count; v++ )
+	{
+		if ( !(used >> v & 1) )
+			continue;
+		
+		int const bass = BLIP_READER_BASS( bufs [v] );
+		BLIP_READER_BEGIN( in, bufs [v] );
+		for ( int i = 0; i < count; i++ )
+		{
+			sum [i] += BLIP_READER_READ_RAW( in ) * blip_float_scale;
+			BLIP_READER_NEXT( in, bass );
+		}
+		BLIP_READER_END( in, bufs [v] );
+	}
+	
+	for ( int i = 0; i < count; i++ )
+	{
+		out [0] = sum [i];
+		out [1] = sum [i];
+		out += 2;
+	}
+}
+
+template<class T>
+long Multitrack_Buffer::read_samples_( T* out, long count )
+{
+	require( !(count & 1) ); // count must be even
+	count = (unsigned) count / 2;
+	
+	long avail = bufs [0].samples_avail();
+	if ( count > avail )
+		count = avail;
+	
+	blargg_ulong const used = voices_added | was_added;
+	for ( long pos = 0; pos < count; )
+	{
+		int n = (int) min( count - pos, (long) mix_chunk );
+		mix( out + pos * 2, n );
+		pos += n;
+		
+		for ( int v = 0; v < voice_count; v++ )
+		{
+			if ( used >> v & 1 )
+				bufs [v].remove_samples( n );
+			else
+				bufs [v].remove_silence( n );
+		}
+	}
+	
+	if ( !bufs [0].samples_avail() )
+	{
+		was_added    = voices_added;
+		voices_added = 0;
+	}
+	
+	return count * 2;
+}
+
+long Multitrack_Buffer::read_samples( blip_sample_t* out, long count ) { return read_samples_( out, count ); }
+
+long Multitrack_Buffer::read_samples( float* out, long count ) { return read_samples_( out, count ); }
+
+void Multitrack_Buffer::remove_samples( long count )
+{
+	require( !(count & 1) ); // count must be even
+	count = (unsigned) count / 2;
+	
+	long avail = bufs [0].samples_avail();
+	if ( count > avail )
+		count = avail;
+	for ( int i = 0; i < voice_count; i++ )
+		bufs [i].remove_samples( count );
+	
+	if ( !bufs [0].samples_avail() )
+	{
+		was_added    = voices_added;
+		voices_added = 0;
+	}
+}
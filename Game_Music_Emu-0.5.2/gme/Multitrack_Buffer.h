@@ -0,0 +1,56 @@
+// Multi-channel buffer with a separate mono buffer for each voice
+
+// Game_Music_Emu 0.5.2
+#ifndef MULTITRACK_BUFFER_H
+#define MULTITRACK_BUFFER_H
+
+#include "Multi_Buffer.h"
+
+// Multitrack_Buffer gives each channel its own Blip_Buffer, so that voices can
+// be read separately with read_voices() after a single emulation pass. Voices are
+// mono; one panned to left and right is mixed as the sum of both. Normal reading
+// outputs stereo sample pairs of all voices mixed together.
+class Multitrack_Buffer : public Multi_Buffer {
+public:
+	enum { max_voices = 32 };
+	
+	// Read at most count samples from each voice's buffer into out [i] + offset,
+	// for voice i from 0 to channel count - 1. Voices where out [i] is NULL are
+	// discarded. Returns number of samples read from each.
+	long read_voices( blip_sample_t* const* out, long count, long offset = 0 );
+	
+	// Number of samples available from each voice's buffer
+	long voice_samples_avail() const { return bufs [0].samples_avail(); }
+
+public:
+	Multitrack_Buffer();
+	~Multitrack_Buffer();
+	blargg_err_t set_channel_count( int );
+	blargg_err_t set_sample_rate( long, int msec = blip_default_length );
+	void clock_rate( long );
+	void bass_freq( int );
+	void clear();
+	channel_t channel( int, int );
+	void end_frame( blip_time_t );
+	
+	long samples_avail() const { return bufs [0].samples_avail() * 2; }
+	long read_samples( blip_sample_t*, long );
+	long read_samples( float*, long );
+	void remove_samples( long );
+	blip_ulong synth_count() const;
+	void copy_state( unsigned char**, blargg_copy_func_t );
+
+private:
+	Blip_Buffer bufs [max_voices];
+	int voice_count;
+	long clock_rate_;
+	int bass_freq_;
+	blargg_ulong voices_added; // bit for each voice with sound added in last frame
+	blargg_ulong was_added;    // voices_added when buffers were last emptied
+	
+	template<class T> long read_samples_( T*, long );
+	void mix( blip_sample_t*, int count );
+	void mix( float*, int count );
+};
+
+#endif
@@ -5,6 +5,14 @@
 #include "Multi_Buffer.h"
 #include <string.h>
 
+#if GME_STATS
+	#ifdef _WIN32
+		#include <windows.h>
+	#else
+		#include <time.h>
+	#endif
+#endif
+
 /* Copyright (C) 2003-2006 Shay Green. This module is free software; you
 can redistribute it and/or modify it under the terms of the GNU Lesser
 General Public License as published by the Free Software Foundation; either
@@ -18,11 +26,16 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include "blargg_source.h"
 
+#ifdef BLARGG_THREAD_LOCAL
+	BLARGG_THREAD_LOCAL int blargg_no_alloc_depth;
+#endif
+
 int const stereo = 2; // number of channels for stereo
 int const silence_max = 6; // seconds
 int const silence_threshold = 0x10;
 long const fade_block_size = 512;
 int const fade_shift = 8; // fade ends with gain at 1.0 / (1 << fade_shift)
+blargg_long const no_snapshot = 0x7FFFFFFF;
 
 Music_Emu::equalizer_t const Music_Emu::tv_eq = { -8.0, 180 };
 
@@ -31,13 +44,15 @@ void Music_Emu::clear_track_vars()
 	current_track_   = -1;
 	out_time         = 0;
 	emu_time         = 0;
+	silence_removed  = 0;
 	emu_track_ended_ = true;
 	track_ended_     = true;
-	fade_start       = LONG_MAX / 2 + 1;
+	fade_start       = INT_MAX / 2 + 1;
 	fade_step        = 1;
 	silence_time     = 0;
 	silence_count    = 0;
 	buf_remain       = 0;
+	float_track      = false;
 	warning(); // clear warning
 }
 
@@ -45,14 +60,17 @@ void Music_Emu::unload()
 {
 	voice_count_ = 0;
 	clear_track_vars();
+	clear_seek_index();
 	Gme_File::unload();
 }
 
 Music_Emu::Music_Emu()
 {
 	effects_buffer = 0;
+	multitrack_buffer_ = 0;
 	
 	sample_rate_ = 0;
+	minimal_buffers_ = false;
 	mute_mask_   = 0;
 	tempo_       = 1.0;
 	gain_        = 1.0;
@@ -61,9 +79,21 @@ Music_Emu::Music_Emu()
 	max_initial_silence = 2;
 	silence_lookahead   = 3;
 	ignore_silence_     = false;
+	float_output_       = false;
 	equalizer_.treble   = -1.0;
 	equalizer_.bass     = 60;
 	
+	loading_state_ = false;
+	load_count     = 0;
+	index_msec     = 0;
+	index_max_count = 0;
+	index_interval = 0;
+	index_max      = 0;
+	index_state_size = 0;
+	index_ignore_silence = false;
+	probe_         = 0;
+	clear_stats();
+	
 	static const char* const names [] = {
 		"Voice 1", "Voice 2", "Voice 3", "Voice 4",
 		"Voice 5", "Voice 6", "Voice 7", "Voice 8"
@@ -74,18 +104,90 @@ Music_Emu::Music_Emu()
 
 Music_Emu::~Music_Emu() { delete effects_buffer; }
 
+void Music_Emu::clear_stats() { memset( &stats_, 0, sizeof stats_ ); }
+
+#if GME_STATS
+double Music_Emu::stats_time()
+{
+	#ifdef _WIN32
+		LARGE_INTEGER freq, now;
+		QueryPerformanceFrequency( &freq );
+		QueryPerformanceCounter( &now );
+		return (double) now.QuadPart * 1000 / freq.QuadPart;
+	#else
+		timespec now;
+		clock_gettime( CLOCK_MONOTONIC, &now );
+		return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+	#endif
+}
+#else
+double Music_Emu::stats_time() { return 0; }
+#endif
+
 blargg_err_t Music_Emu::set_sample_rate( long rate )
 {
 	require( !sample_rate() ); // sample rate can't be changed once set
 	RETURN_ERR( set_sample_rate_( rate ) );
 	RETURN_ERR( buf.resize( buf_size ) );
+	RETURN_ERR( float_buf.resize( buf_size ) );
+	sample_rate_ = rate;
+	return 0;
+}
+
+// Buffers are sized by set_sample_rate_(), so it's run again at the same rate
+blargg_err_t Music_Emu::set_minimal_buffers( bool enabled )
+{
+	require( !track_count() ); // must be called before loading file
+	minimal_buffers_ = enabled;
+	if ( !sample_rate_ )
+		return 0;
+	return set_sample_rate_( sample_rate_ );
+}
+
+blargg_err_t Music_Emu::change_sample_rate_( long )
+{
+	return "Changing sample rate not supported for this music type";
+}
+
+// Converts sample count to new sample rate, keeping it a multiple of stereo
+static blargg_long rescale_time( blargg_long n, long new_rate, long old_rate )
+{
+	double t = (double) (n / stereo) * new_rate / old_rate;
+	if ( t >= INT_MAX / 2 / stereo )
+		return INT_MAX / 2 + 1;
+	return (blargg_long) (t + 0.5) * stereo;
+}
+
+blargg_err_t Music_Emu::change_sample_rate( long rate )
+{
+	require( sample_rate() ); // set_sample_rate() must be called first
+	long const old_rate = sample_rate_;
+	if ( rate == old_rate )
+		return 0;
+	
+	RETURN_ERR( change_sample_rate_( rate ) );
 	sample_rate_ = rate;
+	
+	// times in current track, keeping samples emulated but not yet played
+	blargg_long const buffered = emu_time - out_time;
+	blargg_long const silent   = emu_time - silence_time;
+	out_time     = rescale_time( out_time, rate, old_rate );
+	emu_time     = out_time + buffered;
+	silence_time = emu_time - rescale_time( silent, rate, old_rate );
+	if ( fade_start < INT_MAX / 2 + 1 )
+		fade_start = rescale_time( fade_start, rate, old_rate );
+	fade_step = max( 1, (int) ((double) fade_step * rate / old_rate + 0.5) );
+	
+	// snapshots include sound buffers, which depend on the rate
+	set_seek_index( index_msec, index_max_count );
+	
 	return 0;
 }
 
 void Music_Emu::pre_load()
 {
 	require( sample_rate() ); // set_sample_rate() must be called before loading a file
+	load_count++;
 	Gme_File::pre_load();
 }
 
@@ -115,24 +217,44 @@ void Music_Emu::mute_voices( int mask )
 void Music_Emu::set_tempo( double t )
 {
 	require( sample_rate() ); // sample rate must be set first
+	blargg_no_alloc_t no_alloc;
 	double const min = 0.02;
 	double const max = 4.00;
 	if ( t < min ) t = min;
 	if ( t > max ) t = max;
 	tempo_ = t;
 	set_tempo_( t );
+	clear_seek_index(); // snapshot times depend on tempo
 }
 
 void Music_Emu::post_load_()
 {
 	set_tempo( tempo_ );
 	remute_voices();
+	set_seek_index( index_msec, index_max_count ); // state size depends on file
+}
+
+void Music_Emu::set_resampler_width( int width )
+{
+	int const max_width = 32; // Fir_Resampler<32> in Spc_Emu and Dual_Resampler
+	if ( width < 4 ) width = 4;
+	if ( width > max_width ) width = max_width;
+	set_resampler_width_( width & ~3 );
 }
 
 blargg_err_t Music_Emu::start_track( int track )
 {
+	blargg_no_alloc_t no_alloc;
 	clear_track_vars();
 	
+	if ( track != index_track || ignore_silence_ != index_ignore_silence )
+		clear_seek_index();
+	index_track = track;
+	index_ignore_silence = ignore_silence_;
+	index_next = no_snapshot; // initial silence is removed from track time
+	
+	float_track = float_output_;
+	
 	int remapped = track;
 	RETURN_ERR( remap_track_( &remapped ) );
 	current_track_ = track;
@@ -146,16 +268,21 @@ blargg_err_t Music_Emu::start_track( int track )
 		// play until non-silence or end of track
 		for ( long end = max_initial_silence * stereo * sample_rate(); emu_time < end; )
 		{
-			fill_buf();
+			if ( float_track )
+				fill_buf<float>();
+			else
+				fill_buf<sample_t>();
 			if ( buf_remain | (int) emu_track_ended_ )
 				break;
 		}
 		
+		silence_removed = emu_time - buf_remain;
 		emu_time      = buf_remain;
 		out_time      = 0;
 		silence_time  = 0;
 		silence_count = 0;
 	}
+	update_index_next();
 	return track_ended() ? warning() : 0;
 }
 
@@ -186,8 +313,17 @@ long Music_Emu::tell() const
 
 blargg_err_t Music_Emu::seek( long msec )
 {
+	blargg_no_alloc_t no_alloc;
 	blargg_long time = msec_to_samples( msec );
-	if ( time < out_time )
+	
+	// nearest snapshot at or before time
+	int i = index_count;
+	while ( i > 0 && index_times [i - 1] > time )
+		i--;
+	
+	if ( i > 0 && (time < out_time || index_times [i - 1] > out_time) )
+		RETURN_ERR( load_snapshot( i - 1 ) );
+	else if ( time < out_time )
 		RETURN_ERR( start_track( current_track_ ) );
 	return skip( time - out_time );
 }
@@ -195,6 +331,8 @@ blargg_err_t Music_Emu::seek( long msec )
 blargg_err_t Music_Emu::skip( long count )
 {
 	require( current_track() >= 0 ); // start_track() must have been called already
+	blargg_no_alloc_t no_alloc;
+	stats_timer_t timer( stats_.play_msec );
 	out_time += count;
 	
 	// remove from silence and buf first
@@ -208,10 +346,12 @@ blargg_err_t Music_Emu::skip( long count )
 		count -= n;
 	}
 		
-	if ( count && !emu_track_ended_ )
+	while ( count && !emu_track_ended_ )
 	{
-		emu_time += count;
-		end_track_if_error( skip_( count ) );
+		long n = index_limit( count );
+		count -= n;
+		emu_time += n;
+		end_track_if_error( skip_( n ) );
 	}
 	
 	if ( !(silence_count | buf_remain) ) // caught up to emulator, so update track ended
@@ -249,6 +389,267 @@ blargg_err_t Music_Emu::skip_( long count )
 	return 0;
 }
 
+blargg_err_t Music_Emu::play_float_( long count, float* out )
+{
+	// buf isn't needed for silence detection when playing a float track
+	while ( count )
+	{
+		long n = min( count, (long) buf_size );
+		RETURN_ERR( play_( n, buf.begin() ) );
+		for ( long i = 0; i < n; i++ )
+			out [i] = buf [i] * (1.0f / 0x8000);
+		out += n;
+		count -= n;
+	}
+	return 0;
+}
+
+// State
+
+static void count_state_data( unsigned char** io, void*, size_t size )
+{
+	*io += size;
+}
+
+static void save_state_data( unsigned char** io, void* state, size_t size )
+{
+	memcpy( *io, state, size );
+	*io += size;
+}
+
+static void load_state_data( unsigned char** io, void* state, size_t size )
+{
+	memcpy( state, *io, size );
+	*io += size;
+}
+
+blargg_err_t Music_Emu::copy_state_( unsigned char**, blargg_copy_func_t )
+{
+	return "Saving state not supported for this music type";
+}
+
+// Size of state from copy_state_(), or 0 if not supported
+long Music_Emu::emu_state_size()
+{
+	static unsigned char base [1]; // counting starts here, but nothing is written
+	unsigned char* p = base;
+	if ( copy_state_( &p, count_state_data ) )
+		return 0;
+	return (long) (p - base);
+}
+
+// Track position and silence buffers. Both buffers are copied so that size doesn't
+// depend on sample format.
+void Music_Emu::copy_track_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	bool ended = track_ended_;
+	BLARGG_COPY( current_track_ );
+	BLARGG_COPY( out_time );
+	BLARGG_COPY( emu_time );
+	BLARGG_COPY( emu_track_ended_ );
+	BLARGG_COPY( silence_removed );
+	BLARGG_COPY( ended );
+	BLARGG_COPY( float_track );
+	BLARGG_COPY( silence_time );
+	BLARGG_COPY( silence_count );
+	BLARGG_COPY( buf_remain );
+	copy( io, buf.begin(), buf_size * sizeof buf [0] );
+	copy( io, float_buf.begin(), buf_size * sizeof float_buf [0] );
+	track_ended_ = ended;
+}
+
+// Identifies emulator, file and settings that state was saved for
+struct gme_state_header_t
+{
+	blargg_ulong tag;
+	long size;
+	Music_Emu const* emu;
+	unsigned load_count;
+	long sample_rate;
+	double tempo;
+};
+
+blargg_ulong const state_tag = BLARGG_4CHAR( 'G','M','E','s' );
+
+long Music_Emu::state_size()
+{
+	long size = emu_state_size();
+	if ( !size )
+		return 0;
+	
+	static unsigned char base [1];
+	unsigned char* p = base;
+	copy_track_state( &p, count_state_data );
+	return size + (long) (p - base) + (long) sizeof (gme_state_header_t);
+}
+
+blargg_err_t Music_Emu::save_state( void* out )
+{
+	require( current_track() >= 0 ); // start_track() must have been called already
+	blargg_no_alloc_t no_alloc;
+	long const size = state_size();
+	if ( !size )
+		return Music_Emu::copy_state_( 0, 0 ); // not supported
+	
+	gme_state_header_t h;
+	h.tag         = state_tag;
+	h.size        = size;
+	h.emu         = this;
+	h.load_count  = load_count;
+	h.sample_rate = sample_rate();
+	h.tempo       = tempo_;
+	unsigned char* p = (unsigned char*) out;
+	memcpy( p, &h, sizeof h );
+	p += sizeof h;
+	
+	copy_track_state( &p, save_state_data );
+	RETURN_ERR( copy_state_( &p, save_state_data ) );
+	assert( p - (unsigned char*) out == size );
+	return 0;
+}
+
+blargg_err_t Music_Emu::load_state( void const* in, long size )
+{
+	require( sample_rate() ); // sample rate must be set first
+	blargg_no_alloc_t no_alloc;
+	gme_state_header_t h;
+	if ( size < (long) sizeof h )
+		return "Not a saved state";
+	memcpy( &h, in, sizeof h );
+	if ( h.tag != state_tag || h.size != size )
+		return "Not a saved state";
+	if ( h.emu != this || h.load_count != load_count || !track_count() )
+		return "State was saved for a different emulator or file";
+	if ( h.sample_rate != sample_rate() || h.tempo != tempo_ )
+		return "State was saved at a different sample rate or tempo";
+	if ( state_size() != size )
+		return "State doesn't match current sound buffer configuration";
+	
+	// copy function only reads from state data when loading
+	unsigned char* p = (unsigned char*) in + sizeof h;
+	loading_state_ = true;
+	copy_track_state( &p, load_state_data );
+	blargg_err_t err = copy_state_( &p, load_state_data );
+	loading_state_ = false;
+	RETURN_ERR( err );
+	remute_voices();
+	
+	// keep snapshots if they're for the same track
+	if ( current_track_ != index_track || ignore_silence_ != index_ignore_silence )
+	{
+		clear_seek_index();
+		index_track = current_track_;
+		index_ignore_silence = ignore_silence_;
+	}
+	update_index_next();
+	return 0;
+}
+
+// Seek index
+
+// Snapshots are sized for the loaded file and sample rate, so this is called again
+// after loading and changing sample rate
+void Music_Emu::set_seek_index( long interval_msec, int max_count )
+{
+	require( sample_rate() ); // sample rate must be set first
+	index_msec      = interval_msec;
+	index_max_count = max_count;
+	index_interval = interval_msec > 0 && max_count > 0 ? msec_to_samples( interval_msec ) : 0;
+	index_max      = index_interval ? max_count : 0;
+	clear_seek_index();
+	index_data.clear();
+	index_times.clear();
+	index_state_size = 0;
+	
+	// allocate all snapshot space now, so playback doesn't allocate
+	long size = (index_max && track_count() ? emu_state_size() : 0);
+	if ( !size || index_data.resize( index_max * size ) || index_times.resize( index_max ) )
+	{
+		// not supported by this emulator, or out of memory
+		index_data.clear();
+		index_times.clear();
+		index_interval = 0;
+		index_max      = 0;
+	}
+	else
+	{
+		index_state_size = size;
+	}
+	
+	if ( current_track_ >= 0 && index_interval )
+	{
+		index_track = current_track_;
+		index_ignore_silence = ignore_silence_;
+		index_next = emu_time + index_interval;
+	}
+}
+
+void Music_Emu::clear_seek_index()
+{
+	index_count      = 0;
+	index_track      = -1;
+	index_next       = no_snapshot;
+}
+
+void Music_Emu::update_index_next()
+{
+	index_next = no_snapshot;
+	if ( index_interval && index_count < index_max )
+		index_next = (index_count ? index_times [index_count - 1] : 0) + index_interval;
+}
+
+void Music_Emu::save_snapshot()
+{
+	index_next = no_snapshot;
+	if ( index_count >= index_max )
+		return;
+	
+	long size = index_state_size; // allocated by set_seek_index()
+	if ( emu_state_size() != size )
+	{
+		// sound buffer configuration changed, so snapshot won't fit
+		clear_seek_index();
+		return;
+	}
+	byte* p = &index_data [index_count * size];
+	if ( copy_state_( &p, save_state_data ) )
+		return;
+	index_times [index_count++] = emu_time;
+	update_index_next();
+}
+
+blargg_err_t Music_Emu::load_snapshot( int i )
+{
+	assert( (unsigned) i < (unsigned) index_count );
+	byte* p = &index_data [i * index_state_size];
+	loading_state_ = true;
+	blargg_err_t err = copy_state_( &p, load_state_data );
+	loading_state_ = false;
+	RETURN_ERR( err );
+	remute_voices();
+	
+	out_time         = index_times [i];
+	emu_time         = out_time;
+	emu_track_ended_ = false;
+	track_ended_     = false;
+	silence_time     = out_time;
+	silence_count    = 0;
+	buf_remain       = 0;
+	update_index_next();
+	return 0;
+}
+
+// Takes snapshot if one is due, then returns number of samples that can be
+// emulated before next one is due
+long Music_Emu::index_limit( long count )
+{
+	if ( emu_time >= index_next )
+		save_snapshot();
+	if ( count > index_next - emu_time )
+		count = index_next - emu_time;
+	return count;
+}
+
 // Fading
 
 void Music_Emu::set_fade( long start_msec, long length_msec )
@@ -265,7 +666,24 @@ static int int_log( blargg_long x, int step, int unit )
 	return ((unit - fraction) + (fraction >> 1)) >> shift;
 }
 
-void Music_Emu::handle_fade( long out_count, sample_t* out )
+static inline void fade_samples( Music_Emu::sample_t* io, int count, int gain, int shift )
+{
+	for ( ; count; --count )
+	{
+		*io = Music_Emu::sample_t ((*io * gain) >> shift);
+		++io;
+	}
+}
+
+static inline void fade_samples( float* io, int count, int gain, int shift )
+{
+	float const scale = (float) gain / (1 << shift);
+	for ( ; count; --count )
+		*io++ *= scale;
+}
+
+template<class T>
+void Music_Emu::handle_fade( long out_count, T* out )
 {
 	for ( int i = 0; i < out_count; i += fade_block_size )
 	{
@@ -276,46 +694,81 @@ void Music_Emu::handle_fade( long out_count, sample_t* out )
 		if ( gain < (unit >> fade_shift) )
 			track_ended_ = emu_track_ended_ = true;
 		
-		sample_t* io = &out [i];
-		for ( int count = min( fade_block_size, out_count - i ); count; --count )
+		fade_samples( &out [i], min( fade_block_size, out_count - i ), gain, shift );
+	}
+}
+
+void Music_Emu::fade_voices( long count, sample_t* const* out )
+{
+	int const block = fade_block_size / stereo; // fade timing counts both channels
+	for ( long i = 0; i < count; i += block )
+	{
+		int const shift = 14;
+		int const unit = 1 << shift;
+		int gain = int_log( (out_time + i * stereo - fade_start) / fade_block_size,
+				fade_step, unit );
+		if ( gain < (unit >> fade_shift) )
+			track_ended_ = emu_track_ended_ = true;
+		
+		for ( int v = voice_count(); v--; )
 		{
-			*io = sample_t ((*io * gain) >> shift);
-			++io;
+			if ( out [v] )
+				fade_samples( &out [v] [i], min( (long) block, count - i ), gain, shift );
 		}
 	}
 }
 
 // Silence detection
 
-void Music_Emu::emu_play( long count, sample_t* out )
+template<class T>
+void Music_Emu::emu_play( long count, T* out )
 {
 	check( current_track_ >= 0 );
+	while ( count && current_track_ >= 0 && !emu_track_ended_ )
+	{
+		long n = index_limit( count );
+		count -= n;
+		emu_time += n;
+		end_track_if_error( emu_play_( n, out ) );
+		out += n;
+	}
 	emu_time += count;
-	if ( current_track_ >= 0 && !emu_track_ended_ )
-		end_track_if_error( play_( count, out ) );
-	else
-		memset( out, 0, count * sizeof *out );
+	memset( out, 0, count * sizeof *out );
+}
+
+static inline bool is_silent( Music_Emu::sample_t s )
+{
+	return (unsigned) (s + silence_threshold / 2) <= (unsigned) silence_threshold;
+}
+
+static inline bool is_silent( float s )
+{
+	float const threshold = (silence_threshold / 2) * (1.0f / 0x8000);
+	return s >= -threshold && s <= threshold;
 }
 
 // number of consecutive silent samples at end
-static long count_silence( Music_Emu::sample_t* begin, long size )
+template<class T>
+static long count_silence( T* begin, long size )
 {
-	Music_Emu::sample_t first = *begin;
+	T first = *begin;
 	*begin = silence_threshold; // sentinel
-	Music_Emu::sample_t* p = begin + size;
-	while ( (unsigned) (*--p + silence_threshold / 2) <= (unsigned) silence_threshold ) { }
+	T* p = begin + size;
+	while ( is_silent( *--p ) ) { }
 	*begin = first;
 	return size - (p - begin);
 }
 
 // fill internal buffer and check it for silence
+template<class T>
 void Music_Emu::fill_buf()
 {
 	assert( !buf_remain );
 	if ( !emu_track_ended_ )
 	{
-		emu_play( buf_size, buf.begin() );
-		long silence = count_silence( buf.begin(), buf_size );
+		T* buf = silence_buf( (T*) 0 );
+		emu_play( buf_size, buf );
+		long silence = count_silence( buf, buf_size );
 		if ( silence < buf_size )
 		{
 			silence_time = emu_time - silence;
@@ -326,8 +779,30 @@ void Music_Emu::fill_buf()
 	silence_count += buf_size;
 }
 
-blargg_err_t Music_Emu::play( long out_count, sample_t* out )
+blargg_err_t Music_Emu::play( long count, sample_t* out )
+{
+	require( !float_track ); // use play( long, float* ) for this track
+	stats_timer_t timer( stats_.play_msec );
+	#if GME_STATS
+		stats_.played_frames += count / stereo;
+	#endif
+	return play_samples( count, out );
+}
+
+blargg_err_t Music_Emu::play( long count, float* out )
 {
+	require( float_track || current_track_ < 0 ); // set_float_output() must be called before start_track()
+	stats_timer_t timer( stats_.play_msec );
+	#if GME_STATS
+		stats_.played_frames += count / stereo;
+	#endif
+	return play_samples( count, out );
+}
+
+template<class T>
+blargg_err_t Music_Emu::play_samples( long out_count, T* out )
+{
+	blargg_no_alloc_t no_alloc;
 	if ( track_ended_ )
 	{
 		memset( out, 0, out_count * sizeof *out );
@@ -348,7 +823,7 @@ blargg_err_t Music_Emu::play( long out_count, sample_t* out )
 			// during a run of silence, run emulator at >=2x speed so it gets ahead
 			long ahead_time = silence_lookahead * (out_time + out_count - silence_time) + silence_time;
 			while ( emu_time < ahead_time && !(buf_remain | emu_track_ended_) )
-				fill_buf();
+				fill_buf<T>();
 			
 			// fill with silence
 			pos = min( silence_count, out_count );
@@ -367,7 +842,7 @@ blargg_err_t Music_Emu::play( long out_count, sample_t* out )
 		{
 			// empty silence buf
 			long n = min( buf_remain, out_count - pos );
-			memcpy( &out [pos], buf.begin() + (buf_size - buf_remain), n * sizeof *out );
+			memcpy( &out [pos], silence_buf( out ) + (buf_size - buf_remain), n * sizeof *out );
 			buf_remain -= n;
 			pos += n;
 		}
@@ -387,7 +862,7 @@ blargg_err_t Music_Emu::play( long out_count, sample_t* out )
 					silence_time = emu_time - silence;
 				
 				if ( emu_time - silence_time >= buf_size )
-					fill_buf(); // cause silence detection on next play()
+					fill_buf<T>(); // cause silence detection on next play()
 			}
 		}
 		
@@ -398,6 +873,238 @@ blargg_err_t Music_Emu::play( long out_count, sample_t* out )
 	return 0;
 }
 
+// Multitrack output
+
+blargg_err_t Music_Emu::play_multitrack_( long, sample_t* const*, long )
+{
+	return "Multitrack output not supported for this music type";
+}
+
+blargg_err_t Music_Emu::play_multitrack( long count, sample_t* const* out )
+{
+	require( current_track() >= 0 && !float_track );
+	require( !(silence_count | buf_remain) ); // can't separate voices of buffered sound
+	blargg_no_alloc_t no_alloc;
+	stats_timer_t timer( stats_.play_msec );
+	#if GME_STATS
+		stats_.played_frames += count;
+	#endif
+	
+	long pos = 0;
+	if ( !track_ended_ )
+	{
+		while ( pos < count && !emu_track_ended_ )
+		{
+			long n = index_limit( (count - pos) * stereo ) / stereo;
+			RETURN_ERR( play_multitrack_( n, out, pos ) );
+			emu_time += n * stereo;
+			pos += n;
+		}
+		emu_time += (count - pos) * stereo;
+		track_ended_ |= emu_track_ended_;
+	}
+	
+	for ( int v = voice_count(); v--; )
+	{
+		if ( out [v] )
+			memset( out [v] + pos, 0, (count - pos) * sizeof *out [v] );
+	}
+	
+	if ( out_time > fade_start && pos )
+		fade_voices( pos, out );
+	out_time += count * stereo;
+	return 0;
+}
+
+// Length probing
+
+long const probe_chunk  = 1000; // msec run between checks for silence
+long const probe_window = 50;   // msec played normally and checked for silence
+
+// Frame hashes in order, with hash table to find repeats
+class Length_Probe {
+public:
+	long intro; // -1 until a repeat is found
+	long loop;
+	
+	Length_Probe() : intro( -1 ), loop( -1 ), count( 0 ), added( 0 ) { }
+	
+	// Make room for the frames the next probe_chunk adds, judging by how many the
+	// last one did. add() is called while playing, so it mustn't allocate.
+	blargg_err_t reserve();
+	
+	void add( blargg_ulong hash, blargg_ulong check, long msec );
+private:
+	struct frame_t
+	{
+		blargg_ulong hash;
+		blargg_ulong check;
+		long msec;
+	};
+	blargg_vector<frame_t> frames;
+	blargg_vector<long> table; // index into frames + 1, or 0 if unused
+	long count;
+	long added; // add() calls since reserve()
+};
+
+blargg_err_t Length_Probe::reserve()
+{
+	long const need = count + max( 4096L, added * 2 );
+	added = 0;
+	if ( need <= (long) frames.size() )
+		return 0;
+	
+	long size = frames.size() ? frames.size() : 4096;
+	while ( size < need )
+		size *= 2;
+	RETURN_ERR( frames.resize( size ) );
+	RETURN_ERR( table.resize( size * 2 ) );
+	memset( table.begin(), 0, table.size() * sizeof table [0] );
+	long const mask = table.size() - 1;
+	for ( long n = 0; n < count; n++ )
+	{
+		long i = frames [n].hash & mask;
+		while ( table [i] )
+			i = (i + 1) & mask;
+		table [i] = n + 1;
+	}
+	return 0;
+}
+
+void Length_Probe::add( blargg_ulong hash, blargg_ulong check, long msec )
+{
+	if ( loop >= 0 )
+		return;
+	
+	// if play routine runs unusually often, frames beyond the reserved room are
+	// dropped until the next reserve()
+	added++;
+	if ( count >= (long) frames.size() )
+		return;
+	
+	long const mask = table.size() - 1;
+	long i = hash & mask;
+	for ( ; table [i]; i = (i + 1) & mask )
+	{
+		frame_t const& f = frames [table [i] - 1];
+		if ( f.hash == hash && f.check == check )
+		{
+			intro = f.msec;
+			loop  = msec - f.msec;
+			return;
+		}
+	}
+	
+	frame_t& f = frames [count];
+	f.hash  = hash;
+	f.check = check;
+	f.msec  = msec;
+	table [i] = ++count;
+}
+
+void Music_Emu::probe_frame( blargg_long samples, probe_block_t const* blocks, int count )
+{
+	if ( !probe_ )
+		return;
+	
+	// two independent hashes, so a false match is very unlikely
+	blargg_ulong hash  = 0x811C9DC5;
+	blargg_ulong check = 0;
+	for ( int n = 0; n < count; n++ )
+	{
+		byte const* p = (byte const*) blocks [n].data;
+		long i = blocks [n].size;
+		blargg_ulong w;
+		for ( ; i >= (long) sizeof w; i -= sizeof w, p += sizeof w )
+		{
+			memcpy( &w, p, sizeof w );
+			hash  = (hash ^ w) * 0x01000193;
+			check = (check + w) * 0x9E3779B1 + 1;
+		}
+		for ( ; i; i--, p++ )
+		{
+			hash  = (hash ^ *p) * 0x01000193;
+			check = (check + *p) * 0x9E3779B1 + 1;
+		}
+	}
+	
+	samples -= silence_removed;
+	if ( samples >= 0 )
+		probe_->add( hash, check, (long) (samples * 1000.0 / (stereo * sample_rate())) );
+}
+
+blargg_err_t Music_Emu::probe_length_( long max_msec, gme_length_t* out )
+{
+	long silent_since = -1; // start of current run of silence, or -1 if not silent
+	while ( !track_ended() && tell() < max_msec )
+	{
+		RETURN_ERR( probe_->reserve() );
+		RETURN_ERR( skip( msec_to_samples( probe_chunk - probe_window ) ) );
+		
+		long const start = tell();
+		bool silent = true;
+		for ( long remain = msec_to_samples( probe_window ); remain && !track_ended(); )
+		{
+			sample_t buf [1024];
+			long n = min( remain, (long) (sizeof buf / sizeof buf [0]) );
+			RETURN_ERR( play( n, buf ) );
+			remain -= n;
+			for ( long i = 0; i < n; i++ )
+				silent &= is_silent( buf [i] );
+		}
+		
+		if ( !silent )
+		{
+			silent_since = -1;
+			
+			// a repeat only counts while there's sound; when a finished track's memory
+			// stops changing, it's caught as silence
+			if ( probe_->loop >= 0 )
+			{
+				out->intro_length = probe_->intro;
+				out->loop_length  = probe_->loop;
+				return 0;
+			}
+		}
+		else if ( silent_since < 0 )
+		{
+			silent_since = start;
+		}
+		
+		if ( silent_since >= 0 && tell() - silent_since >= silence_max * 1000L )
+			break;
+	}
+	
+	if ( silent_since >= 0 )
+		out->length = silent_since;
+	else if ( track_ended() )
+		out->length = tell();
+	return 0;
+}
+
+blargg_err_t Music_Emu::probe_length( int track, long max_msec, gme_length_t* out )
+{
+	out->length       = -1;
+	out->intro_length = -1;
+	out->loop_length  = -1;
+	
+	// probe 16-bit samples with end of track detection turned off
+	bool const saved_float = float_output_;
+	float_output_ = false;
+	blargg_err_t err = start_track( track );
+	float_output_ = saved_float;
+	RETURN_ERR( err );
+	
+	Length_Probe probe;
+	bool const saved_ignore = ignore_silence_;
+	ignore_silence_ = true;
+	probe_ = &probe;
+	err = probe_length_( max_msec, out );
+	probe_ = 0;
+	ignore_silence_ = saved_ignore;
+	return err;
+}
+
 // Gme_Info_
 
 blargg_err_t Gme_Info_::set_sample_rate_( long )            { return 0; }
@@ -6,6 +6,8 @@
 
 #include "Gme_File.h"
 class Multi_Buffer;
+class Multitrack_Buffer;
+class Length_Probe;
 
 struct Music_Emu : public Gme_File {
 public:
@@ -14,6 +16,19 @@ public:
 	// Set output sample rate. Must be called only once before loading file.
 	blargg_err_t set_sample_rate( long sample_rate );
 	
+	// Change output sample rate after it has been set, without reloading, even
+	// while a track is playing. Position, fade and emulator state are kept, and
+	// sound continues at the new rate. Returns error without changing anything if
+	// music type doesn't support this. After other errors, file must be loaded
+	// again.
+	blargg_err_t change_sample_rate( long sample_rate );
+	
+	// Size sound buffers for a single short emulation frame rather than the
+	// default length, reducing memory used by each emulator at the cost of running
+	// frames more often. Game Boy and SMS/Game Gear PSG sound changes slightly
+	// as a result (see gme.h). Must be called before loading file.
+	blargg_err_t set_minimal_buffers( bool enabled = true );
+	
 	// Start a track, where 0 is the first track. Also clears warning string.
 	blargg_err_t start_track( int );
 	
@@ -22,6 +37,17 @@ public:
 	typedef short sample_t;
 	blargg_err_t play( long count, sample_t* buf );
 	
+	// Same as above, but generates floating-point samples, where 1.0 corresponds to
+	// 32768 above. Samples aren't clipped. Can only be used when float output was
+	// enabled before the track was started.
+	blargg_err_t play( long count, float* buf );
+	
+	// Generate 'count' mono samples for each voice into out [0] to out [voice_count() - 1]
+	// with a single run of the emulator, discarding voices whose pointer is NULL.
+	// Requires emulator created by gme_new_emu_multitrack(). Fade is applied to each
+	// voice, and silence isn't detected. Returns error if music type doesn't support it.
+	blargg_err_t play_multitrack( long count, sample_t* const* out );
+	
 // Informational
 	
 	// Sample rate sound is generated at
@@ -41,12 +67,45 @@ public:
 	// Number of milliseconds (1000 msec = 1 second) played since beginning of track
 	long tell() const;
 	
-	// Seek to new time in track. Seeking backwards or far forward can take a while.
+	// Seek to new time in track. Seeking backwards or far forward can take a while,
+	// unless a seek index has been enabled (see below).
 	blargg_err_t seek( long msec );
 	
-	// Skip n samples
+	// Record a snapshot of emulator state every interval_msec of the current track,
+	// keeping at most max_count of them, so that seek() can resume from the nearest
+	// snapshot rather than replaying from the beginning. Snapshots are kept when
+	// the same track is restarted. Pass 0 to disable. Has no effect on emulator
+	// types that don't support snapshots. Allocates memory for all snapshots now,
+	// so playback doesn't.
+	void set_seek_index( long interval_msec, int max_count = 64 );
+	
+	// Save current playback state to out, which must have room for state_size()
+	// bytes, so that load_state() can later continue playing from this point. State
+	// covers the emulated hardware, sound buffers and track position, but not
+	// settings such as fade, muting and equalization. It can only be loaded into this
+	// same emulator, with the same file still loaded, at the same sample rate and
+	// tempo. Returns error if music type doesn't support this.
+	blargg_err_t save_state( void* out );
+	
+	// Size of state saved by save_state(), or 0 if music type doesn't support it.
+	// Fixed while a file is loaded, unless sound buffer configuration changes (such
+	// as effects being enabled for the first time).
+	long state_size();
+	
+	// Restore state saved by save_state(). Returns error without changing anything
+	// if state doesn't belong to this emulator and file, or doesn't match the
+	// current sample rate and tempo.
+	blargg_err_t load_state( void const* in, long size );
+	
+	// Skip n samples. Most emulators run without generating sound for all but the
+	// end of a long skip, so this is much faster than playing.
 	blargg_err_t skip( long n );
 	
+	// Find length of track by running it quickly without generating sound, for at
+	// most max_msec (see gme_probe_length() in gme.h). Leaves track started, so
+	// start it again before playing.
+	blargg_err_t probe_length( int track, long max_msec, gme_length_t* out );
+	
 	// True if a track has reached its end
 	bool track_ended() const;
 	
@@ -57,16 +116,32 @@ public:
 	// Disable automatic end-of-track detection and skipping of silence at beginning
 	void ignore_silence( bool disable = true );
 	
+	// Generate floating-point samples with play() rather than 16-bit ones. Takes
+	// effect when the next track is started.
+	void set_float_output( bool enabled = true );
+	
 	// Info for current track
 	Gme_File::track_info;
 	blargg_err_t track_info( track_info_t* out ) const;
 	
+// Statistics
+
+	// Emulation work done since emulator was created or clear_stats() was last
+	// called. All zero unless GME_STATS is set (see gme_get_stats() in gme.h).
+	typedef gme_stats_t stats_t;
+	void get_stats( stats_t* out ) const    { *out = stats_; }
+	void clear_stats();
+	
 // Sound customization
 	
 	// Adjust song tempo, where 1.0 = normal, 0.5 = half speed, 2.0 = double speed.
 	// Track length as returned by track_info() assumes a tempo of 1.0.
 	void set_tempo( double );
 	
+	// Set number of points in resampling filter, for emulators which use one (see
+	// gme_set_resampler_width() in gme.h)
+	void set_resampler_width( int );
+	
 	// Mute/unmute voice i, where voice 0 is first voice
 	void mute_voice( int index, bool mute = true );
 	
@@ -106,17 +181,71 @@ protected:
 	void set_voice_count( int n )               { voice_count_ = n; }
 	void set_voice_names( const char* const* names );
 	void set_track_ended()                      { emu_track_ended_ = true; }
+	bool emu_track_ended() const                { return emu_track_ended_; }
+	Multitrack_Buffer* multitrack_buffer() const { return multitrack_buffer_; }
+	
+	// Loop detection for probe_length(). While probing(), an emulator that can find
+	// loops calls probe_frame() at each call of the music's play routine, with the
+	// memory that determines what plays next and the number of samples it has
+	// generated since start_track_() (see Classic_Emu).
+	struct probe_block_t { void const* data; long size; };
+	bool probing() const                        { return probe_ != 0; }
+	void probe_frame( blargg_long samples, probe_block_t const* blocks, int count );
 	double gain() const                         { return gain_; }
 	double tempo() const                        { return tempo_; }
 	void remute_voices();
 	
+	// Buffer length in milliseconds emulators use when set_minimal_buffers() is
+	// enabled, a little more than one 60 Hz frame
+	enum { minimal_buffer_length = 1000 / 60 + 1 };
+	bool minimal_buffers() const                { return minimal_buffers_; }
+	
+	// Statistics that emulators add their counts to, if GME_STATS is set. A
+	// stats_timer_t adds the time from its creation to its destruction to total.
+	stats_t& stats()                            { return stats_; }
+	class stats_timer_t {
+	public:
+		stats_timer_t( double& total );
+		~stats_timer_t();
+	#if GME_STATS
+	private:
+		double& total;
+		double start;
+	#endif
+	};
+	static double stats_time(); // milliseconds since arbitrary point
+	
 	virtual blargg_err_t set_sample_rate_( long sample_rate ) = 0;
+	
+	// Change output rate while playing. sample_rate() is still the old rate. Any
+	// sound generated but not yet played should be kept. Default returns error.
+	virtual blargg_err_t change_sample_rate_( long sample_rate );
+	
 	virtual void set_equalizer_( equalizer_t const& ) { };
 	virtual void mute_voices_( int mask ) = 0;
 	virtual void set_tempo_( double ) = 0;
+	virtual void set_resampler_width_( int ) { }
 	virtual blargg_err_t start_track_( int ) = 0; // tempo is set before this
 	virtual blargg_err_t play_( long count, sample_t* out ) = 0;
 	virtual blargg_err_t skip_( long count );
+	
+	// Generate floating-point samples. Default converts the output of play_(), so
+	// emulators should override this if they can avoid clamping.
+	virtual blargg_err_t play_float_( long count, float* out );
+	
+	// Generate count samples into out [i] + offset for each voice i, from
+	// multitrack_buffer(). Default returns error.
+	virtual blargg_err_t play_multitrack_( long count, sample_t* const* out, long offset );
+	
+	// Save, load or size the state of the emulator and its sound buffers (see
+	// blargg_copy_func_t), for save_state() and the seek index. Called only between
+	// calls to play_() and the like. State only needs to be restorable into the same
+	// emulator object with the same file loaded, so it can include pointers, and it
+	// must be the same size each time. Default returns error.
+	virtual blargg_err_t copy_state_( unsigned char** io, blargg_copy_func_t );
+	
+	// True while copy_state_() is loading state rather than saving or sizing it
+	bool loading_state() const                  { return loading_state_; }
 protected:
 	virtual void unload();
 	virtual void pre_load();
@@ -132,6 +261,7 @@ private:
 	double gain_;
 	
 	long sample_rate_;
+	bool minimal_buffers_;
 	blargg_long msec_to_samples( blargg_long msec ) const;
 	
 	// track-specific
@@ -139,14 +269,21 @@ private:
 	blargg_long out_time;  // number of samples played since start of track
 	blargg_long emu_time;  // number of samples emulator has generated since start of track
 	bool emu_track_ended_; // emulator has reached end of track
+	blargg_long silence_removed; // emulator samples skipped as initial silence
 	volatile bool track_ended_;
+	bool float_output_;    // set_float_output() setting
+	bool float_track;      // current track uses float samples
 	void clear_track_vars();
 	void end_track_if_error( blargg_err_t );
+	template<class T> blargg_err_t play_samples( long count, T* out );
+	blargg_err_t emu_play_( long n, sample_t* out )   { return play_( n, out ); }
+	blargg_err_t emu_play_( long n, float* out )      { return play_float_( n, out ); }
 	
 	// fading
 	blargg_long fade_start;
 	int fade_step;
-	void handle_fade( long count, sample_t* out );
+	template<class T> void handle_fade( long count, T* out );
+	void fade_voices( long count, sample_t* const* out );
 	
 	// silence detection
 	int silence_lookahead; // speed to run emulator when looking ahead for silence
@@ -156,11 +293,46 @@ private:
 	long buf_remain;       // number of samples left in silence buffer
 	enum { buf_size = 2048 };
 	blargg_vector<sample_t> buf;
-	void fill_buf();
-	void emu_play( long count, sample_t* out );
+	blargg_vector<float> float_buf; // used instead of buf for float tracks
+	sample_t* silence_buf( sample_t* )  { return buf.begin(); }
+	float* silence_buf( float* )        { return float_buf.begin(); }
+	template<class T> void fill_buf();
+	template<class T> void emu_play( long count, T* out );
+	
+	// state
+	bool loading_state_;
+	unsigned load_count;   // number of files loaded, to tell states of each apart
+	long emu_state_size();
+	void copy_track_state( unsigned char** io, blargg_copy_func_t );
+	
+	// seek index
+	long index_msec;            // set_seek_index() parameters
+	int index_max_count;
+	blargg_long index_interval; // samples between snapshots, or 0 if disabled
+	blargg_long index_next;     // emu_time at which next snapshot is due
+	int index_max;
+	int index_count;
+	int index_track;            // track snapshots were recorded for
+	bool index_ignore_silence;  // ignore_silence_ when snapshots were recorded
+	long index_state_size;
+	blargg_vector<byte> index_data;
+	blargg_vector<blargg_long> index_times;
+	void clear_seek_index();
+	void update_index_next();
+	void save_snapshot();
+	blargg_err_t load_snapshot( int index );
+	long index_limit( long count );
+	
+	// length probing
+	Length_Probe* probe_;
 	
-	Multi_Buffer* effects_buffer;
+	stats_t stats_;
+	blargg_err_t probe_length_( long max_msec, gme_length_t* out );
+	
+	Multi_Buffer* effects_buffer; // created by gme_new_emu() and owned by emulator
+	Multitrack_Buffer* multitrack_buffer_; // same as effects_buffer if multitrack
 	friend Music_Emu* gme_new_emu( gme_type_t, long );
+	friend Music_Emu* gme_new_emu_multitrack( gme_type_t, long );
 	friend void gme_set_stereo_depth( Music_Emu*, double );
 };
 
@@ -192,6 +364,7 @@ inline const Music_Emu::equalizer_t& Music_Emu::equalizer() const { return equal
 inline void Music_Emu::set_tempo_( double t )       { tempo_ = t; }
 inline void Music_Emu::remute_voices()              { mute_voices( mute_mask_ ); }
 inline void Music_Emu::ignore_silence( bool b )     { ignore_silence_ = b; }
+inline void Music_Emu::set_float_output( bool b )   { float_output_ = b; }
 inline blargg_err_t Music_Emu::start_track_( int )  { return 0; }
 
 inline void Music_Emu::set_voice_names( const char* const* names )
@@ -202,6 +375,14 @@ inline void Music_Emu::set_voice_names( const char* const* names )
 
 inline void Music_Emu::mute_voices_( int ) { }
 
+#if GME_STATS
+	inline Music_Emu::stats_timer_t::stats_timer_t( double& t ) : total( t ), start( stats_time() ) { }
+	inline Music_Emu::stats_timer_t::~stats_timer_t() { total += stats_time() - start; }
+#else
+	inline Music_Emu::stats_timer_t::stats_timer_t( double& ) { }
+	inline Music_Emu::stats_timer_t::~stats_timer_t() { }
+#endif
+
 inline void Music_Emu::set_gain( double g )
 {
 	assert( !sample_rate() ); // you must set gain before setting sample rate
@@ -22,6 +22,7 @@ Nes_Apu::Nes_Apu() :
 	square2( &square_synth )
 {
 	tempo_ = 1.0;
+	queued_count = 0;
 	dmc.apu = this;
 	dmc.prg_reader = NULL;
 	irq_notifier_ = NULL;
@@ -96,6 +97,7 @@ void Nes_Apu::reset( bool pal_mode, int initial_dmc_dac )
 	noise.reset();
 	dmc.reset();
 	
+	queued_count = 0; // writes queued before reset are dropped
 	last_time = 0;
 	last_dmc_time = 0;
 	osc_enables = 0;
@@ -109,6 +111,8 @@ void Nes_Apu::reset( bool pal_mode, int initial_dmc_dac )
 		write_register( 0, addr, (addr & 3) ? 0x00 : 0x10 );
 	
 	dmc.dac = initial_dmc_dac;
+	flush_writes();
+	
 	if ( !dmc.nonlinear )
 		triangle.last_amp = 15;
 	if ( !dmc.nonlinear ) // TODO: remove?
@@ -237,6 +241,8 @@ inline void zero_apu_osc( T* osc, nes_time_t time )
 
 void Nes_Apu::end_frame( nes_time_t end_time )
 {
+	flush_writes();
+	
 	if ( end_time > last_time )
 		run_until_( end_time );
 	
@@ -271,6 +277,58 @@ void Nes_Apu::end_frame( nes_time_t end_time )
 	}
 }
 
+void Nes_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( !queued_count ); // end_frame() runs queued writes
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		Nes_Osc& osc = *oscs [i];
+		BLARGG_COPY( osc.regs );
+		BLARGG_COPY( osc.reg_written );
+		BLARGG_COPY( osc.length_counter );
+		BLARGG_COPY( osc.delay );
+		BLARGG_COPY( osc.last_amp );
+	}
+	
+	Nes_Envelope* const envs [3] = { &square1, &square2, &noise };
+	for ( int i = 0; i < 3; i++ )
+	{
+		BLARGG_COPY( envs [i]->envelope );
+		BLARGG_COPY( envs [i]->env_delay );
+	}
+	BLARGG_COPY( square1.phase );
+	BLARGG_COPY( square1.sweep_delay );
+	BLARGG_COPY( square2.phase );
+	BLARGG_COPY( square2.sweep_delay );
+	BLARGG_COPY( triangle.phase );
+	BLARGG_COPY( triangle.linear_counter );
+	BLARGG_COPY( noise.noise );
+	
+	BLARGG_COPY( dmc.address );
+	BLARGG_COPY( dmc.period );
+	BLARGG_COPY( dmc.buf );
+	BLARGG_COPY( dmc.bits_remain );
+	BLARGG_COPY( dmc.bits );
+	BLARGG_COPY( dmc.buf_full );
+	BLARGG_COPY( dmc.silence );
+	BLARGG_COPY( dmc.dac );
+	BLARGG_COPY( dmc.next_irq );
+	BLARGG_COPY( dmc.irq_enabled );
+	BLARGG_COPY( dmc.irq_flag );
+	BLARGG_COPY( dmc.pal_mode );
+	
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( last_dmc_time );
+	BLARGG_COPY( earliest_irq_ );
+	BLARGG_COPY( next_irq );
+	BLARGG_COPY( frame_period );
+	BLARGG_COPY( frame_delay );
+	BLARGG_COPY( frame );
+	BLARGG_COPY( osc_enables );
+	BLARGG_COPY( frame_mode );
+	BLARGG_COPY( irq_flag );
+}
+
 // registers
 
 static const unsigned char length_table [0x20] = {
@@ -280,7 +338,15 @@ static const unsigned char length_table [0x20] = {
 	0xC0, 0x18, 0x48, 0x1A, 0x10, 0x1C, 0x20, 0x1E
 };
 
-void Nes_Apu::write_register( nes_time_t time, nes_addr_t addr, int data )
+void Nes_Apu::flush_writes()
+{
+	int count = queued_count;
+	queued_count = 0;
+	for ( int i = 0; i < count; i++ )
+		write_register_( queued [i].time, queued [i].addr, queued [i].data );
+}
+
+void Nes_Apu::write_register_( nes_time_t time, nes_addr_t addr, int data )
 {
 	require( addr > 0x20 ); // addr must be actual address (i.e. 0x40xx)
 	require( (unsigned) data <= 0xFF );
@@ -289,6 +355,10 @@ void Nes_Apu::write_register( nes_time_t time, nes_addr_t addr, int data )
 	if ( unsigned (addr - start_addr) > end_addr - start_addr )
 		return;
 	
+	// only from flush_writes() while others are queued
+	if ( queued_count )
+		flush_writes();
+	
 	run_until_( time );
 	
 	if ( addr < 0x4014 )
@@ -368,6 +438,7 @@ void Nes_Apu::write_register( nes_time_t time, nes_addr_t addr, int data )
 
 int Nes_Apu::read_status( nes_time_t time )
 {
+	flush_writes();
 	run_until_( time - 1 );
 	
 	int result = (dmc.irq_flag << 7) | (irq_flag << 6);
@@ -11,7 +11,6 @@ typedef unsigned nes_addr_t; // 16-bit memory address
 
 #include "Nes_Oscs.h"
 
-struct apu_state_t;
 class Nes_Buffer;
 
 class Nes_Apu {
@@ -53,9 +52,9 @@ public:
 	// Adjust frame period
 	void set_tempo( double );
 	
-	// Save/load exact emulation state
-	void save_state( apu_state_t* out ) const;
-	void load_state( apu_state_t const& );
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs and volume aren't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
 	
 	// Set overall volume (default is 1.0)
 	void volume( double );
@@ -130,14 +129,41 @@ private:
 	void* irq_data;
 	Nes_Square::Synth square_synth; // shared by squares
 	
+	// Writes to the square, triangle and noise registers can't be seen by
+	// the CPU until it reads the status register, so they're queued and run
+	// in one go, without going back and forth between CPU and oscillators
+	enum { queued_end_addr = 0x4010 };
+	enum { max_queued = 256 };
+	struct queued_write_t {
+		nes_time_t time;
+		unsigned short addr;
+		unsigned char data;
+	};
+	int queued_count;
+	queued_write_t queued [max_queued];
+	
+	void flush_writes();
+	void write_register_( nes_time_t, nes_addr_t, int data );
 	void irq_changed();
-	void state_restored();
 	void run_until_( nes_time_t );
 	
 	// TODO: remove
 	friend class Nes_Core;
 };
 
+inline void Nes_Apu::write_register( nes_time_t time, nes_addr_t addr, int data )
+{
+	if ( unsigned (addr - start_addr) < queued_end_addr - start_addr && queued_count < max_queued )
+	{
+		queued_write_t* w = &queued [queued_count++];
+		w->time = time;
+		w->addr = (unsigned short) addr;
+		w->data = (unsigned char) data;
+		return;
+	}
+	write_register_( time, addr, data );
+}
+
 inline void Nes_Apu::osc_output( int osc, Blip_Buffer* buf )
 {
 	assert( (unsigned) osc < osc_count );
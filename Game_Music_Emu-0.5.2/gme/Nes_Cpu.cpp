@@ -4,6 +4,12 @@
 
 #include "blargg_endian.h"
 #include <limits.h>
+#include <string.h>
+
+#if NES_CPU_JIT
+	#define XBYAK_NO_OP_NAMES
+	#include "xbyak.h"
+#endif
 
 #define BLARGG_CPU_X86 1
 
@@ -62,6 +68,26 @@ int const st_i = 0x04;
 int const st_z = 0x02;
 int const st_c = 0x01;
 
+static BOOST::uint8_t const clock_table [256] =
+{// 0 1 2 3 4 5 6 7 8 9 A B C D E F
+	0,6,2,8,3,3,5,5,3,2,2,2,4,4,6,6,// 0
+	3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 1
+	6,6,2,8,3,3,5,5,4,2,2,2,4,4,6,6,// 2
+	3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 3
+	6,6,2,8,3,3,5,5,3,2,2,2,3,4,6,6,// 4
+	3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 5
+	6,6,2,8,3,3,5,5,4,2,2,2,5,4,6,6,// 6
+	3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 7
+	2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,// 8
+	3,6,2,6,4,4,4,4,2,5,2,5,5,5,5,5,// 9
+	2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,// A
+	3,5,2,5,4,4,4,4,2,4,2,4,4,4,4,4,// B
+	2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,// C
+	3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// D
+	2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,// E
+	3,5,0,8,4,4,6,6,2,4,2,7,4,4,7,7 // F
+}; // 0x00 was 7 and 0xF2 was 2
+
 void Nes_Cpu::reset( void const* unmapped_page )
 {
 	check( state == &state_ );
@@ -102,6 +128,1208 @@ void Nes_Cpu::map_code( nes_addr_t start, unsigned size, void const* data, bool
 	}
 }
 
+void Nes_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( low_mem );
+	BLARGG_COPY( r );
+	BLARGG_COPY( state_ );
+	BLARGG_COPY( irq_time_ );
+	BLARGG_COPY( end_time_ );
+	BLARGG_COPY( error_count_ );
+}
+
+#if NES_CPU_JIT
+
+// Translates basic blocks of 6502 code to x86-64 code, which run() uses in
+// place of interpreting when a whole block has time to finish. Generated code
+// keeps registers and flags in the same form as run(), so it can stop after any
+// instruction and leave the rest to the interpreter. A block ends at a branch,
+// jump, call or return, at the end of its page, or before an instruction that
+// isn't translated (BRK, RTI, JMP (ind), those that change the I flag, and the
+// unofficial ones other than NOPs). A block that branches back to its beginning
+// runs again without returning to run() while there's time for all of it.
+//
+// Memory is accessed the same way as the interpreter does it: the zero page and
+// stack in low_mem, reads of RAM and ROM through the code map, and the rest
+// through CPU_READ and CPU_WRITE with the time up to date. A block stops after
+// a write that maps another bank at its page or writes into its own code, and
+// after an access through CPU_READ or CPU_WRITE that changed the time so that a
+// later instruction wouldn't begin. A block's code is compared with memory
+// each time it's run, and code that keeps changing is left to the interpreter,
+// as is code in low_mem, which stores change without going through CPU_WRITE.
+class Nes_Cpu_Jit : public Xbyak::CodeGenerator {
+public:
+	typedef BOOST::uint8_t uint8_t;
+	struct block_t;
+	
+	// State passed between run() and generated code
+	struct regs_t {
+		unsigned a, x, y, sp, status, c, nz, pc; // in the same form as run()
+		int time;
+		unsigned count; // instructions run in earlier passes through a loop
+		Nes_Cpu* cpu;
+		uint8_t* low_mem;
+		uint8_t const* const* code_map;
+		block_t const* block;
+	};
+	
+	// Returns number of instructions run
+	typedef unsigned (*block_func)( regs_t* );
+	
+	enum { max_len = 32 }; // bytes of 6502 code in a block
+	struct block_t {
+		block_func run;         // NULL if interpreted
+		uint8_t const* page;    // code map entry block was translated from
+		unsigned pc;
+		int time;               // at most, before last instruction begins
+		int len;
+		int changes;            // times code has been found changed
+		uint8_t code [max_len]; // as translated
+	};
+	
+	regs_t regs;
+	
+	explicit Nes_Cpu_Jit( Nes_Cpu* );
+	
+	// Block at pc, translated if it hasn't been, or NULL if it's interpreted
+	block_t const* find( unsigned pc, uint8_t const* const* code_map );
+	
+	unsigned run( block_t const* b )
+	{
+		regs.block = b;
+		return b->run( &regs );
+	}
+	
+private:
+	enum { page_size = Nes_Cpu::page_size };
+	enum { page_bits = Nes_Cpu::page_bits };
+	enum { block_count = 2048 }; // direct-mapped by address
+	enum { code_size = 1024 * 1024 };
+	enum { max_block_size = 8192 }; // generated code
+	enum { max_changes = 4 };
+	block_t blocks [block_count];
+	
+	struct instr_t {
+		unsigned addr;
+		int opcode;
+		unsigned data;   // byte after opcode
+		unsigned addr16; // word after opcode
+		int len;
+		int time;        // clocks, with page crossing
+		int rest;        // clocks from start of this instruction until last one begins
+	};
+	instr_t instrs [max_len];
+	int instr_count;
+	
+	// while translating an instruction
+	int pending;         // clocks not yet added to time
+	unsigned next_pc;
+	int run_count;       // instructions run once it's done
+	bool io;             // may have called CPU_READ or CPU_WRITE
+	Xbyak::Label* top;
+	Xbyak::Label* done;
+	
+	// 6502 state kept in callee-saved registers; the rest is in regs
+	Xbyak::Reg32 const A, X, Y, NZ, C;
+	Xbyak::Reg64 const arg0;
+	Xbyak::Reg32 const arg1, arg2;
+	
+	static int read_thunk( regs_t*, unsigned addr );
+	static int write_thunk( regs_t*, unsigned addr, int data );
+	
+	void flush();
+	void translate( block_t&, uint8_t const* code );
+	void decode( uint8_t const* code, unsigned pc );
+	block_func generate();
+	void translate_instr( instr_t const& );
+	void flush_time();
+	void exit_block( unsigned pc, int extra_time = 0 );
+	void loop_back( unsigned pc, int extra_time = 0 );
+	void low_base();
+	void zp( unsigned addr, Xbyak::Reg64 const* index = 0 );
+	void read_prog();
+	void read();
+	void read_abs( unsigned addr );
+	void write();
+	void write_abs( unsigned addr );
+	void call_write();
+	void adc();
+	void compare( Xbyak::Reg32 const& );
+	void bit();
+	void rol();
+	void ror();
+	void push_byte( Xbyak::Reg8 const& );
+};
+
+#define REG( name ) dword [rbx + (int) offsetof (Nes_Cpu_Jit::regs_t, name)]
+#define PTR( name ) qword [rbx + (int) offsetof (Nes_Cpu_Jit::regs_t, name)]
+
+Nes_Cpu_Jit::Nes_Cpu_Jit( Nes_Cpu* cpu ) :
+	Xbyak::CodeGenerator( code_size ),
+	A( r12d ),
+	X( r13d ),
+	Y( r14d ),
+	NZ( r15d ),
+	C( ebp ),
+#ifdef XBYAK64_WIN
+	arg0( rcx ),
+	arg1( edx ),
+	arg2( r8d )
+#else
+	arg0( rdi ),
+	arg1( esi ),
+	arg2( edx )
+#endif
+{
+	memset( &regs, 0, sizeof regs );
+	regs.cpu     = cpu;
+	regs.low_mem = cpu->low_mem;
+	flush();
+}
+
+void Nes_Cpu_Jit::flush()
+{
+	reset();
+	for ( int i = 0; i < block_count; i++ )
+	{
+		block_t& b = blocks [i];
+		b.run     = 0;
+		b.page    = 0;
+		b.pc      = ~0u; // matches no address
+		b.len     = 0;
+		b.changes = 0;
+	}
+}
+
+inline Nes_Cpu_Jit::block_t const* Nes_Cpu_Jit::find( unsigned pc, uint8_t const* const* code_map )
+{
+	block_t& b = blocks [pc & (block_count - 1)];
+	uint8_t const* page = code_map [pc >> page_bits];
+	uint8_t const* code = page + PAGE_OFFSET( pc );
+	if ( b.pc != pc || b.page != page )
+	{
+		b.pc      = pc;
+		b.page    = page;
+		b.changes = 0;
+		translate( b, code );
+	}
+	else if ( memcmp( b.code, code, b.len ) )
+	{
+		if ( ++b.changes <= max_changes )
+		{
+			translate( b, code );
+		}
+		else
+		{
+			b.run = 0; // keeps changing
+			b.len = 0;
+		}
+	}
+	return b.run ? &b : 0;
+}
+
+int Nes_Cpu_Jit::read_thunk( regs_t* r, unsigned addr )
+{
+	Nes_Cpu* cpu = r->cpu;
+	cpu->state->time = r->time;
+	int result = cpu->jit_read( addr );
+	r->time = cpu->state->time;
+	return result;
+}
+
+// Returns non-zero if the write could have changed code in the block
+int Nes_Cpu_Jit::write_thunk( regs_t* r, unsigned addr, int data )
+{
+	Nes_Cpu* cpu = r->cpu;
+	cpu->state->time = r->time;
+	cpu->jit_write( addr, data );
+	r->time = cpu->state->time;
+	block_t const* b = r->block;
+	return r->code_map [b->pc >> page_bits] != b->page || addr - b->pc < (unsigned) b->len;
+}
+
+// Length of instruction, or 0 if it isn't translated
+static int jit_instr_len( int opcode )
+{
+	if ( (opcode & 3) == 1 ) // ORA AND EOR ADC STA LDA CMP SBC
+	{
+		if ( opcode == 0x89 )
+			return 0;
+		int mode = opcode >> 2 & 7;
+		return (mode == 3 || mode >= 6) ? 3 : 2;
+	}
+	
+	switch ( opcode )
+	{
+	case 0x0A: case 0x2A: case 0x4A: case 0x6A: // shift A
+	case 0xE8: case 0xC8: case 0xCA: case 0x88: // INX INY DEX DEY
+	case 0xAA: case 0x8A: case 0xA8: case 0x98: case 0x9A: case 0xBA: // transfer
+	case 0x48: case 0x68: case 0x08: // PHA PLA PHP
+	case 0x38: case 0x18: case 0xB8: case 0xD8: case 0xF8: // flags
+	case 0xEA: case 0x1A: case 0x3A: case 0x5A: case 0x7A: case 0xDA: case 0xFA: // NOP
+	case 0x60: // RTS
+		return 1;
+	
+	case 0xA2: case 0xA6: case 0xB6: // LDX
+	case 0xA0: case 0xA4: case 0xB4: // LDY
+	case 0x86: case 0x96: case 0x84: case 0x94: // STX STY
+	case 0xE0: case 0xE4: case 0xC0: case 0xC4: // CPX CPY
+	case 0x24: // BIT
+	case 0x06: case 0x16: case 0x26: case 0x36: case 0x46: case 0x56: case 0x66: case 0x76: // shift zp
+	case 0xE6: case 0xF6: case 0xC6: case 0xD6: // INC DEC
+	case 0x10: case 0x30: case 0x50: case 0x70: case 0x90: case 0xB0: case 0xD0: case 0xF0: // branch
+		return 2;
+	
+	case 0xAE: case 0xBE: case 0xAC: case 0xBC: // LDX LDY
+	case 0x8E: case 0x8C: // STX STY
+	case 0xEC: case 0xCC: // CPX CPY
+	case 0x2C: // BIT
+	case 0x0E: case 0x1E: case 0x2E: case 0x3E: case 0x4E: case 0x5E: case 0x6E: case 0x7E: // shift abs
+	case 0xEE: case 0xFE: case 0xCE: case 0xDE: // INC DEC
+	case 0x4C: case 0x20: // JMP JSR
+		return 3;
+	}
+	return 0;
+}
+
+// Reads that take a clock more when indexing crosses a page
+static bool jit_page_crossing( int opcode )
+{
+	if ( (opcode & 3) == 1 )
+	{
+		int mode = opcode >> 2 & 7;
+		return (opcode >> 5) != 4 && (mode == 4 || mode >= 6); // not STA
+	}
+	return opcode == 0xBE || opcode == 0xBC;
+}
+
+static bool jit_ends_block( int opcode )
+{
+	return (opcode & 0x1F) == 0x10 || opcode == 0x4C || opcode == 0x20 || opcode == 0x60;
+}
+
+void Nes_Cpu_Jit::decode( uint8_t const* code, unsigned pc )
+{
+	unsigned const page_end = (pc | (page_size - 1)) + 1;
+	int len = 0;
+	instr_count = 0;
+	while ( true )
+	{
+		int opcode = code [len];
+		int n = jit_instr_len( opcode );
+		if ( !n || len + n > max_len || pc + len + n > page_end )
+			break;
+		
+		instr_t& in = instrs [instr_count++];
+		in.addr   = pc + len;
+		in.opcode = opcode;
+		in.len    = n;
+		in.data   = (n > 1 ? code [len + 1] : 0);
+		in.addr16 = in.data + (n > 2 ? 0x100 * code [len + 2] : 0);
+		in.time   = clock_table [opcode] + jit_page_crossing( opcode );
+		len += n;
+		if ( jit_ends_block( opcode ) )
+			break;
+	}
+	
+	if ( !instr_count )
+		return;
+	
+	int rest = 0;
+	instrs [instr_count - 1].rest = 0;
+	for ( int i = instr_count - 1; i--; )
+	{
+		rest += instrs [i].time;
+		instrs [i].rest = rest;
+	}
+}
+
+void Nes_Cpu_Jit::translate( block_t& b, uint8_t const* code )
+{
+	b.run  = 0;
+	b.time = 0;
+	b.len  = 0;
+	
+	uint8_t const* low_mem = regs.low_mem;
+	if ( b.pc > 0xFFFF || (code >= low_mem && code < low_mem + sizeof regs.cpu->low_mem) )
+		return;
+	
+	decode( code, b.pc );
+	if ( !instr_count )
+	{
+		b.len = 1; // retranslate if opcode changes
+		b.code [0] = code [0];
+		return;
+	}
+	instr_t const& last = instrs [instr_count - 1];
+	b.len  = last.addr + last.len - b.pc;
+	b.time = instrs [0].rest;
+	memcpy( b.code, code, b.len );
+	
+	if ( getSize() + max_block_size > code_size )
+	{
+		// start over when code memory is full
+		block_t temp = b;
+		flush();
+		b = temp;
+	}
+	
+	try
+	{
+		b.run = generate();
+	}
+	catch ( ... )
+	{
+		// labels may be left unresolved, so start over
+		block_t temp = b;
+		flush();
+		b = temp;
+	}
+}
+
+Nes_Cpu_Jit::block_func Nes_Cpu_Jit::generate()
+{
+	using namespace Xbyak;
+	block_func func = getCurr<block_func>();
+	Label top_, done_;
+	top  = &top_;
+	done = &done_;
+	
+	push( rbx );
+	push( rbp );
+	push( r12 );
+	push( r13 );
+	push( r14 );
+	push( r15 );
+	sub( rsp, 40 ); // shadow space for Win64 calls, and alignment
+	mov( rbx, arg0 );
+	mov( A,  REG( a ) );
+	mov( X,  REG( x ) );
+	mov( Y,  REG( y ) );
+	mov( NZ, REG( nz ) );
+	mov( C,  REG( c ) );
+	mov( REG( count ), 0 );
+	L( top_ );
+	
+	pending = 0;
+	for ( int i = 0; i < instr_count; i++ )
+	{
+		instr_t const& in = instrs [i];
+		next_pc   = in.addr + in.len;
+		run_count = i + 1;
+		io        = false;
+		translate_instr( in );
+		
+		if ( io && i + 1 < instr_count )
+		{
+			// stop if CPU_READ or CPU_WRITE moved time so a later instruction wouldn't begin
+			Label ok;
+			mov( eax, REG( time ) );
+			add( eax, pending + instrs [i + 1].rest );
+			js( ok, T_NEAR );
+			exit_block( next_pc );
+			L( ok );
+		}
+	}
+	if ( !jit_ends_block( instrs [instr_count - 1].opcode ) )
+		exit_block( next_pc );
+	
+	L( done_ );
+	add( eax, REG( count ) );
+	mov( REG( a ),  A );
+	mov( REG( x ),  X );
+	mov( REG( y ),  Y );
+	mov( REG( nz ), NZ );
+	mov( REG( c ),  C );
+	add( rsp, 40 );
+	pop( r15 );
+	pop( r14 );
+	pop( r13 );
+	pop( r12 );
+	pop( rbp );
+	pop( rbx );
+	ret();
+	return func;
+}
+
+// Adds clocks counted so far to time, before CPU_READ or CPU_WRITE might be called
+void Nes_Cpu_Jit::flush_time()
+{
+	if ( pending )
+		add( REG( time ), pending );
+	pending = 0;
+}
+
+// Leaves block after the current instruction, continuing at pc
+void Nes_Cpu_Jit::exit_block( unsigned pc, int extra_time )
+{
+	if ( pending + extra_time )
+		add( REG( time ), pending + extra_time );
+	mov( REG( pc ), pc );
+	mov( eax, run_count );
+	jmp( *done, T_NEAR );
+}
+
+// Runs block again without leaving when jumping back to its beginning, if
+// there's time for all of it, as run() would
+void Nes_Cpu_Jit::loop_back( unsigned pc, int extra_time )
+{
+	if ( pc != instrs [0].addr )
+		return;
+	
+	Xbyak::Label no_time;
+	mov( eax, REG( time ) );
+	add( eax, pending + extra_time + instrs [0].rest );
+	jns( no_time, T_NEAR );
+	add( REG( time ), pending + extra_time );
+	add( REG( count ), instr_count );
+	jmp( *top, T_NEAR );
+	L( no_time );
+}
+
+void Nes_Cpu_Jit::low_base()
+{
+	mov( r11, PTR( low_mem ) );
+}
+
+// Zero page address into rax, with low_mem in r11
+void Nes_Cpu_Jit::zp( unsigned addr, Xbyak::Reg64 const* index )
+{
+	low_base();
+	if ( index )
+	{
+		lea( eax, ptr [*index + addr] );
+		movzx( eax, al );
+	}
+	else
+	{
+		mov( eax, addr );
+	}
+}
+
+// ecx = READ_PROG( r10d )
+void Nes_Cpu_Jit::read_prog()
+{
+	mov( r11, PTR( code_map ) );
+	mov( eax, r10d );
+	shr( eax, page_bits );
+	mov( r11, qword [r11 + rax * 8] );
+	#if BLARGG_NONPORTABLE
+		movzx( ecx, ptr [r11 + r10] );
+	#else
+		mov( eax, r10d );
+		and_( eax, page_size - 1 );
+		movzx( ecx, ptr [r11 + rax] );
+	#endif
+}
+
+// ecx = byte at r10d; RAM and ROM are read from the code map as the
+// interpreter's LDA does, the rest with CPU_READ
+void Nes_Cpu_Jit::read()
+{
+	using namespace Xbyak;
+	Label io_, ok;
+	flush_time();
+	io = true;
+	mov( eax, r10d );
+	xor_( eax, 0x8000 );
+	cmp( eax, 0x9FFF );
+	ja( io_, T_NEAR );
+	read_prog();
+	jmp( ok, T_NEAR );
+	L( io_ );
+	mov( arg1, r10d );
+	mov( arg0, rbx );
+	mov( rax, (size_t) read_thunk );
+	call( rax );
+	mov( ecx, eax );
+	L( ok );
+}
+
+void Nes_Cpu_Jit::read_abs( unsigned addr )
+{
+	mov( r10d, addr );
+	if ( (addr ^ 0x8000) <= 0x9FFF )
+		read_prog();
+	else
+		read();
+}
+
+// Writes ecx to r10d; low_mem is written directly as in the interpreter, the
+// rest with CPU_WRITE
+void Nes_Cpu_Jit::write()
+{
+	using namespace Xbyak;
+	Label io_, ok;
+	flush_time();
+	cmp( r10d, 0x7FF );
+	ja( io_, T_NEAR );
+	low_base();
+	mov( ptr [r11 + r10], cl );
+	jmp( ok, T_NEAR );
+	L( io_ );
+	call_write();
+	L( ok );
+}
+
+void Nes_Cpu_Jit::write_abs( unsigned addr )
+{
+	if ( addr <= 0x7FF )
+	{
+		low_base();
+		mov( ptr [r11 + addr], cl );
+	}
+	else
+	{
+		flush_time();
+		mov( r10d, addr );
+		call_write();
+	}
+}
+
+void Nes_Cpu_Jit::call_write()
+{
+	using namespace Xbyak;
+	io = true;
+	mov( arg2, ecx ); // arg0 last, since it's rcx on Win64
+	mov( arg1, r10d );
+	mov( arg0, rbx );
+	mov( rax, (size_t) write_thunk );
+	call( rax );
+	Label ok;
+	test( eax, eax );
+	jz( ok, T_NEAR );
+	exit_block( next_pc );
+	L( ok );
+}
+
+// A += ecx + carry
+void Nes_Cpu_Jit::adc()
+{
+	mov( eax, C );
+	shr( eax, 8 );
+	and_( eax, 1 );
+	movsx( edx, cl );
+	add( edx, eax );
+	mov( r8d, A );
+	xor_( r8d, 0x80 );
+	add( edx, r8d );
+	sar( edx, 2 );
+	and_( edx, st_v );
+	and_( REG( status ), ~st_v );
+	or_( REG( status ), edx );
+	lea( NZ, ptr [r12 + rcx] );
+	add( NZ, eax );
+	mov( C, NZ );
+	movzx( A, NZ.cvt8() );
+}
+
+void Nes_Cpu_Jit::compare( Xbyak::Reg32 const& reg )
+{
+	mov( NZ, reg );
+	sub( NZ, ecx );
+	mov( C, NZ );
+	not_( C );
+	and_( NZ, 0xFF );
+}
+
+void Nes_Cpu_Jit::bit()
+{
+	mov( NZ, ecx );
+	and_( REG( status ), ~st_v );
+	mov( eax, ecx );
+	and_( eax, st_v );
+	or_( REG( status ), eax );
+	mov( eax, NZ );
+	shl( eax, 8 ); // result must be zero, even if N bit is set
+	test( A, ecx );
+	cmovz( NZ, eax );
+}
+
+// nz = ecx << 1 | carry, c = ecx << 1
+void Nes_Cpu_Jit::rol()
+{
+	mov( NZ, C );
+	shr( NZ, 8 );
+	and_( NZ, 1 );
+	lea( C, ptr [rcx + rcx] );
+	or_( NZ, C );
+}
+
+// nz = ecx >> 1 | carry << 7, c = ecx << 8
+void Nes_Cpu_Jit::ror()
+{
+	mov( NZ, C );
+	shr( NZ, 1 );
+	and_( NZ, 0x80 );
+	mov( C, ecx );
+	shl( C, 8 );
+	shr( ecx, 1 );
+	or_( NZ, ecx );
+}
+
+void Nes_Cpu_Jit::push_byte( Xbyak::Reg8 const& reg )
+{
+	mov( eax, REG( sp ) );
+	dec( eax );
+	or_( eax, 0x100 );
+	mov( REG( sp ), eax );
+	low_base();
+	mov( ptr [r11 + rax], reg );
+}
+
+void Nes_Cpu_Jit::translate_instr( instr_t const& in )
+{
+	using namespace Xbyak;
+	int const opcode = in.opcode;
+	unsigned const data = in.data;
+	unsigned const addr = in.addr16;
+	pending += clock_table [opcode];
+	
+	if ( (opcode & 3) == 1 )
+	{
+		// ORA AND EOR ADC STA LDA CMP SBC
+		int const op = opcode >> 5;
+		int const mode = opcode >> 2 & 7;
+		bool const sta = (op == 4);
+		
+		// address into r10d, or operand into ecx
+		switch ( mode )
+		{
+		case 0: // (ind,x)
+			low_base();
+			lea( eax, ptr [r13 + data] );
+			movzx( ecx, al );
+			movzx( r10d, ptr [r11 + rcx] );
+			inc( eax );
+			movzx( ecx, al );
+			movzx( ecx, ptr [r11 + rcx] );
+			shl( ecx, 8 );
+			or_( r10d, ecx );
+			break;
+		
+		case 1: // zp
+		case 5: // zp,x
+			zp( data, mode == 5 ? &r13 : 0 );
+			if ( !sta )
+				movzx( ecx, ptr [r11 + rax] );
+			break;
+		
+		case 2: // imm
+			mov( ecx, data );
+			break;
+		
+		case 3: // abs
+			if ( !sta )
+				read_abs( addr );
+			break;
+		
+		case 4: // (ind),y
+			low_base();
+			movzx( r10d, ptr [r11 + data] );
+			add( r10d, Y );
+			if ( !sta )
+			{
+				mov( eax, r10d );
+				shr( eax, 8 );
+				add( REG( time ), eax );
+			}
+			movzx( eax, ptr [r11 + ((data + 1) & 0xFF)] );
+			shl( eax, 8 );
+			add( r10d, eax );
+			break;
+		
+		case 6: // abs,y
+		case 7: { // abs,x
+			Reg64 const& index = (mode == 6 ? r14 : r13);
+			if ( !sta )
+			{
+				lea( eax, ptr [index + data] );
+				shr( eax, 8 );
+				add( REG( time ), eax );
+			}
+			lea( r10d, ptr [index + addr] );
+			break;
+		}
+		}
+		
+		if ( sta )
+		{
+			mov( ecx, A );
+			if ( mode == 1 || mode == 5 )
+				mov( ptr [r11 + rax], r12b );
+			else if ( mode == 3 )
+				write_abs( addr );
+			else
+				write();
+			return;
+		}
+		
+		if ( mode == 0 || mode == 4 || mode >= 6 )
+			read();
+		
+		switch ( op )
+		{
+		case 0: // ORA
+			or_( A, ecx );
+			mov( NZ, A );
+			break;
+		
+		case 1: // AND
+			and_( A, ecx );
+			mov( NZ, A );
+			break;
+		
+		case 2: // EOR
+			xor_( A, ecx );
+			mov( NZ, A );
+			break;
+		
+		case 7: // SBC
+			xor_( ecx, 0xFF );
+		case 3: // ADC
+			adc();
+			break;
+		
+		case 5: // LDA
+			mov( A, ecx );
+			mov( NZ, ecx );
+			break;
+		
+		case 6: // CMP
+			compare( A );
+			break;
+		}
+		return;
+	}
+	
+	switch ( opcode )
+	{
+// Load/store
+	
+	case 0xA2: // LDX #imm
+		mov( X, data );
+		mov( NZ, data );
+		break;
+	
+	case 0xA6: // LDX zp
+	case 0xB6: // LDX zp,y
+		zp( data, opcode == 0xB6 ? &r14 : 0 );
+		movzx( X, ptr [r11 + rax] );
+		mov( NZ, X );
+		break;
+	
+	case 0xA0: // LDY #imm
+		mov( Y, data );
+		mov( NZ, data );
+		break;
+	
+	case 0xA4: // LDY zp
+	case 0xB4: // LDY zp,x
+		zp( data, opcode == 0xB4 ? &r13 : 0 );
+		movzx( Y, ptr [r11 + rax] );
+		mov( NZ, Y );
+		break;
+	
+	case 0xAE: // LDX abs
+		read_abs( addr );
+		mov( X, ecx );
+		mov( NZ, ecx );
+		break;
+	
+	case 0xBE: // LDX abs,y
+		lea( eax, ptr [r14 + data] );
+		shr( eax, 8 );
+		add( REG( time ), eax );
+		lea( r10d, ptr [r14 + addr] );
+		read();
+		mov( X, ecx );
+		mov( NZ, ecx );
+		break;
+	
+	case 0xAC: // LDY abs
+		read_abs( addr );
+		mov( Y, ecx );
+		mov( NZ, ecx );
+		break;
+	
+	case 0xBC: // LDY abs,x
+		lea( eax, ptr [r13 + data] );
+		shr( eax, 8 );
+		add( REG( time ), eax );
+		lea( r10d, ptr [r13 + addr] );
+		read();
+		mov( Y, ecx );
+		mov( NZ, ecx );
+		break;
+	
+	case 0x86: // STX zp
+	case 0x96: // STX zp,y
+		zp( data, opcode == 0x96 ? &r14 : 0 );
+		mov( ptr [r11 + rax], r13b );
+		break;
+	
+	case 0x84: // STY zp
+	case 0x94: // STY zp,x
+		zp( data, opcode == 0x94 ? &r13 : 0 );
+		mov( ptr [r11 + rax], r14b );
+		break;
+	
+	case 0x8E: // STX abs
+		mov( ecx, X );
+		write_abs( addr );
+		break;
+	
+	case 0x8C: // STY abs
+		mov( ecx, Y );
+		write_abs( addr );
+		break;
+	
+// Compare
+	
+	case 0xE0: // CPX #imm
+	case 0xC0: // CPY #imm
+		mov( ecx, data );
+		compare( opcode == 0xE0 ? X : Y );
+		break;
+	
+	case 0xE4: // CPX zp
+	case 0xC4: // CPY zp
+		zp( data );
+		movzx( ecx, ptr [r11 + rax] );
+		compare( opcode == 0xE4 ? X : Y );
+		break;
+	
+	case 0xEC: // CPX abs
+	case 0xCC: // CPY abs
+		read_abs( addr );
+		compare( opcode == 0xEC ? X : Y );
+		break;
+	
+	case 0x24: // BIT zp
+		zp( data );
+		movzx( ecx, ptr [r11 + rax] );
+		bit();
+		break;
+	
+	case 0x2C: // BIT abs
+		read_abs( addr );
+		bit();
+		break;
+	
+// Shift/rotate
+	
+	case 0x4A: // LSR A
+		xor_( C, C );
+	case 0x6A: // ROR A
+		mov( ecx, A );
+		ror();
+		mov( A, NZ );
+		break;
+	
+	case 0x0A: // ASL A
+		xor_( C, C );
+	case 0x2A: // ROL A
+		mov( ecx, A );
+		rol();
+		movzx( A, NZ.cvt8() );
+		break;
+	
+	case 0x06: case 0x16: // ASL zp, zp,x
+	case 0x26: case 0x36: // ROL
+	case 0x46: case 0x56: // LSR
+	case 0x66: case 0x76: // ROR
+		zp( data, (opcode & 0x10) ? &r13 : 0 );
+		movzx( ecx, ptr [r11 + rax] );
+		if ( !(opcode & 0x20) )
+			xor_( C, C );
+		if ( opcode & 0x40 )
+			ror();
+		else
+			rol();
+		mov( ptr [r11 + rax], NZ.cvt8() );
+		break;
+	
+	case 0x0E: case 0x1E: // ASL abs, abs,x
+	case 0x2E: case 0x3E: // ROL
+	case 0x4E: case 0x5E: // LSR
+	case 0x6E: case 0x7E: // ROR
+		if ( opcode & 0x10 )
+		{
+			lea( r10d, ptr [r13 + addr] );
+			read();
+		}
+		else
+		{
+			read_abs( addr );
+		}
+		if ( !(opcode & 0x20) )
+			xor_( C, C );
+		if ( opcode & 0x40 )
+			ror();
+		else
+			rol();
+		movzx( ecx, NZ.cvt8() );
+		if ( opcode & 0x10 )
+		{
+			lea( r10d, ptr [r13 + addr] );
+			write();
+		}
+		else
+		{
+			write_abs( addr );
+		}
+		break;
+	
+// Increment/decrement
+	
+	case 0xE8: // INX
+	case 0xCA: // DEX
+		lea( NZ, ptr [r13 + (opcode == 0xE8 ? 1 : -1)] );
+		movzx( X, NZ.cvt8() );
+		break;
+	
+	case 0xC8: // INY
+	case 0x88: // DEY
+		lea( NZ, ptr [r14 + (opcode == 0xC8 ? 1 : -1)] );
+		movzx( Y, NZ.cvt8() );
+		break;
+	
+	case 0xE6: case 0xF6: // INC zp, zp,x
+	case 0xC6: case 0xD6: // DEC
+		zp( data, (opcode & 0x10) ? &r13 : 0 );
+		movzx( ecx, ptr [r11 + rax] );
+		lea( NZ, ptr [rcx + (opcode & 0x20 ? 1 : -1)] );
+		mov( ptr [r11 + rax], NZ.cvt8() );
+		break;
+	
+	case 0xEE: case 0xFE: // INC abs, abs,x
+	case 0xCE: case 0xDE: // DEC
+		if ( opcode & 0x10 )
+		{
+			lea( r10d, ptr [r13 + addr] );
+			read();
+		}
+		else
+		{
+			read_abs( addr );
+		}
+		lea( NZ, ptr [rcx + (opcode & 0x20 ? 1 : -1)] );
+		movzx( ecx, NZ.cvt8() );
+		if ( opcode & 0x10 )
+		{
+			lea( r10d, ptr [r13 + addr] );
+			write();
+		}
+		else
+		{
+			write_abs( addr );
+		}
+		break;
+	
+// Transfer
+	
+	case 0xAA: // TAX
+		mov( X, A );
+		mov( NZ, A );
+		break;
+	
+	case 0x8A: // TXA
+		mov( A, X );
+		mov( NZ, X );
+		break;
+	
+	case 0xA8: // TAY
+		mov( Y, A );
+		mov( NZ, A );
+		break;
+	
+	case 0x98: // TYA
+		mov( A, Y );
+		mov( NZ, Y );
+		break;
+	
+	case 0x9A: // TXS
+		lea( eax, ptr [r13 + 1] );
+		or_( eax, 0x100 );
+		mov( REG( sp ), eax );
+		break;
+	
+	case 0xBA: // TSX
+		mov( eax, REG( sp ) );
+		dec( eax );
+		movzx( X, al );
+		mov( NZ, X );
+		break;
+	
+// Stack
+	
+	case 0x48: // PHA
+		push_byte( r12b );
+		break;
+	
+	case 0x68: // PLA
+		mov( eax, REG( sp ) );
+		low_base();
+		movzx( A, ptr [r11 + rax] );
+		mov( NZ, A );
+		sub( eax, 0xFF );
+		or_( eax, 0x100 );
+		mov( REG( sp ), eax );
+		break;
+	
+	case 0x08: // PHP
+		mov( ecx, REG( status ) );
+		and_( ecx, st_v | st_d | st_i );
+		mov( eax, NZ );
+		shr( eax, 8 );
+		or_( eax, NZ );
+		and_( eax, st_n );
+		or_( ecx, eax );
+		mov( eax, C );
+		shr( eax, 8 );
+		and_( eax, st_c );
+		or_( ecx, eax );
+		mov( eax, ecx );
+		or_( eax, st_z );
+		test( NZ, 0xFF );
+		cmovz( ecx, eax );
+		or_( ecx, st_b | st_r );
+		push_byte( cl );
+		break;
+	
+// Flags
+	
+	case 0x38: // SEC
+		mov( C, ~0u );
+		break;
+	
+	case 0x18: // CLC
+		xor_( C, C );
+		break;
+	
+	case 0xB8: // CLV
+		and_( REG( status ), ~st_v );
+		break;
+	
+	case 0xD8: // CLD
+		and_( REG( status ), ~st_d );
+		break;
+	
+	case 0xF8: // SED
+		or_( REG( status ), st_d );
+		break;
+	
+	case 0xEA: case 0x1A: case 0x3A: case 0x5A: case 0x7A: case 0xDA: case 0xFA: // NOP
+		break;
+	
+// Jump
+	
+	case 0x4C: // JMP abs
+		loop_back( addr );
+		exit_block( addr );
+		break;
+	
+	case 0x20: { // JSR
+		unsigned const ret = in.addr + 2;
+		mov( eax, REG( sp ) );
+		low_base();
+		lea( ecx, ptr [rax - 1] );
+		or_( ecx, 0x100 );
+		mov( edx, ret >> 8 & 0xFF );
+		mov( ptr [r11 + rcx], dl );
+		sub( eax, 2 );
+		or_( eax, 0x100 );
+		mov( REG( sp ), eax );
+		mov( edx, ret & 0xFF );
+		mov( ptr [r11 + rax], dl );
+		exit_block( addr );
+		break;
+	}
+	
+	case 0x60: // RTS
+		mov( eax, REG( sp ) );
+		low_base();
+		movzx( ecx, ptr [r11 + rax] );
+		inc( ecx );
+		lea( edx, ptr [rax - 0xFF] );
+		or_( edx, 0x100 );
+		movzx( edx, ptr [r11 + rdx] );
+		shl( edx, 8 );
+		add( ecx, edx );
+		sub( eax, 0xFE );
+		or_( eax, 0x100 );
+		mov( REG( sp ), eax );
+		if ( pending )
+			add( REG( time ), pending );
+		mov( REG( pc ), ecx );
+		mov( eax, run_count );
+		jmp( *done, T_NEAR );
+		break;
+	
+// Branch
+	
+	default: {
+		assert( (opcode & 0x1F) == 0x10 );
+		unsigned const next = in.addr + 2;
+		int const offset = (BOOST::int8_t) data;
+		unsigned const extra_clock = (next & 0xFF) + offset;
+		Label taken;
+		switch ( opcode )
+		{
+		case 0x10: test( NZ, 0x8080 );     jz ( taken, T_NEAR ); break; // BPL
+		case 0x30: test( NZ, 0x8080 );     jnz( taken, T_NEAR ); break; // BMI
+		case 0x50: test( REG( status ), st_v ); jz ( taken, T_NEAR ); break; // BVC
+		case 0x70: test( REG( status ), st_v ); jnz( taken, T_NEAR ); break; // BVS
+		case 0x90: test( C, 0x100 );       jz ( taken, T_NEAR ); break; // BCC
+		case 0xB0: test( C, 0x100 );       jnz( taken, T_NEAR ); break; // BCS
+		case 0xD0: test( r15b, r15b );     jnz( taken, T_NEAR ); break; // BNE
+		case 0xF0: test( r15b, r15b );     jz ( taken, T_NEAR ); break; // BEQ
+		}
+		exit_block( next, -1 );
+		L( taken );
+		unsigned const target = BOOST::uint16_t (next + offset);
+		loop_back( target, extra_clock >> 8 & 1 );
+		exit_block( target, extra_clock >> 8 & 1 );
+		break;
+	}
+	}
+}
+
+#undef REG
+#undef PTR
+
+Nes_Cpu::Nes_Cpu() : instr_count_( 0 )
+{
+	state = &state_;
+	try
+	{
+		jit = new Nes_Cpu_Jit( this );
+	}
+	catch ( ... )
+	{
+		jit = 0; // interpret everything
+	}
+}
+
+Nes_Cpu::~Nes_Cpu()
+{
+	delete jit;
+}
+
+int Nes_Cpu::jit_read( nes_addr_t addr )
+{
+	return CPU_READ( this, addr, time() );
+}
+
+void Nes_Cpu::jit_write( nes_addr_t addr, int data )
+{
+	CPU_WRITE( this, addr, data, time() );
+}
+
+#endif
+
 #define TIME    (s_time + s.base)
 #define READ_LIKELY_PPU( addr, out )    {CPU_READ_PPU( this, (addr), out, TIME );}
 #define READ( addr )                    CPU_READ( this, (addr), TIME )
@@ -124,6 +1352,10 @@ bool Nes_Cpu::run( nes_time_t end_time )
 	set_end_time( end_time );
 	state_t s = this->state_;
 	this->state = &s;
+	#if NES_CPU_JIT
+		if ( jit )
+			jit->regs.code_map = s.code_map;
+	#endif
 	// even on x86, using s.time in place of s_time was slower
 	fint16 s_time = s.time;
 	
@@ -160,11 +1392,140 @@ bool Nes_Cpu::run( nes_time_t end_time )
 		SET_STATUS( temp );
 	}
 	
+	#if BLARGG_COMPUTED_GOTO
+		// Address of code for each opcode, matching the OP_CASE labels below
+		static void* const op_table [0x100] = {
+			&&op_0x00, &&ind_x0x05, &&op_0x02, &&op_default,
+			&&op_0x04, &&zp0x05, &&op_0x06, &&op_default,
+			&&op_0x08, &&imm0x05, &&op_0x0A, &&op_default,
+			&&op_0x0C, &&abs0x05, &&op_0x0E, &&op_default,
+			&&op_0x10, &&ind_y0x05, &&op_0x12, &&op_default,
+			&&op_0x14, &&zp_x0x05, &&op_0x16, &&op_default,
+			&&op_0x18, &&abs_y0x05, &&op_0x1A, &&op_default,
+			&&op_0x1C, &&abs_x0x05, &&op_0x1E, &&op_default,
+			&&op_0x20, &&ind_x0x25, &&op_0x22, &&op_default,
+			&&op_0x24, &&zp0x25, &&op_0x26, &&op_default,
+			&&op_0x28, &&imm0x25, &&op_0x2A, &&op_default,
+			&&op_0x2C, &&abs0x25, &&op_0x2E, &&op_default,
+			&&op_0x30, &&ind_y0x25, &&op_0x32, &&op_default,
+			&&op_0x34, &&zp_x0x25, &&op_0x36, &&op_default,
+			&&op_0x38, &&abs_y0x25, &&op_0x3A, &&op_default,
+			&&op_0x3C, &&abs_x0x25, &&op_0x3E, &&op_default,
+			&&op_0x40, &&ind_x0x45, &&op_0x42, &&op_default,
+			&&op_0x44, &&zp0x45, &&op_0x46, &&op_default,
+			&&op_0x48, &&imm0x45, &&op_0x4A, &&op_default,
+			&&op_0x4C, &&abs0x45, &&op_0x4E, &&op_default,
+			&&op_0x50, &&ind_y0x45, &&op_0x52, &&op_default,
+			&&op_0x54, &&zp_x0x45, &&op_0x56, &&op_default,
+			&&op_0x58, &&abs_y0x45, &&op_0x5A, &&op_default,
+			&&op_0x5C, &&abs_x0x45, &&op_0x5E, &&op_default,
+			&&op_0x60, &&ind_x0x65, &&op_0x62, &&op_default,
+			&&op_0x64, &&zp0x65, &&op_0x66, &&op_default,
+			&&op_0x68, &&imm0x65, &&op_0x6A, &&op_default,
+			&&op_0x6C, &&abs0x65, &&op_0x6E, &&op_default,
+			&&op_0x70, &&ind_y0x65, &&op_0x72, &&op_default,
+			&&op_0x74, &&zp_x0x65, &&op_0x76, &&op_default,
+			&&op_0x78, &&abs_y0x65, &&op_0x7A, &&op_default,
+			&&op_0x7C, &&abs_x0x65, &&op_0x7E, &&op_default,
+			&&op_0x80, &&op_0x81, &&op_0x82, &&op_default,
+			&&op_0x84, &&op_0x85, &&op_0x86, &&op_default,
+			&&op_0x88, &&op_0x89, &&op_0x8A, &&op_default,
+			&&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_default,
+			&&op_0x90, &&op_0x91, &&op_0x92, &&op_default,
+			&&op_0x94, &&op_0x95, &&op_0x96, &&op_default,
+			&&op_0x98, &&op_0x99, &&op_0x9A, &&op_default,
+			&&op_default, &&op_0x9D, &&op_default, &&op_default,
+			&&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_default,
+			&&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_default,
+			&&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_default,
+			&&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_default,
+			&&op_0xB0, &&op_0xB1, &&op_0xB2, &&op_default,
+			&&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_default,
+			&&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_default,
+			&&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_default,
+			&&op_0xC0, &&ind_x0xC5, &&op_0xC2, &&op_default,
+			&&op_0xC4, &&zp0xC5, &&op_0xC6, &&op_default,
+			&&op_0xC8, &&imm0xC5, &&op_0xCA, &&op_default,
+			&&op_0xCC, &&abs0xC5, &&op_0xCE, &&op_default,
+			&&op_0xD0, &&ind_y0xC5, &&op_0xD2, &&op_default,
+			&&op_0xD4, &&zp_x0xC5, &&op_0xD6, &&op_default,
+			&&op_0xD8, &&abs_y0xC5, &&op_0xDA, &&op_default,
+			&&op_0xDC, &&abs_x0xC5, &&op_0xDE, &&op_default,
+			&&op_0xE0, &&ind_x0xE5, &&op_0xE2, &&op_default,
+			&&op_0xE4, &&zp0xE5, &&op_0xE6, &&op_default,
+			&&op_0xE8, &&imm0xE5, &&op_0xEA, &&op_0xEB,
+			&&op_0xEC, &&abs0xE5, &&op_0xEE, &&op_default,
+			&&op_0xF0, &&ind_y0xE5, &&op_bad_opcode, &&op_default,
+			&&op_0xF4, &&zp_x0xE5, &&op_0xF6, &&op_default,
+			&&op_0xF8, &&abs_y0xE5, &&op_0xFA, &&op_default,
+			&&op_0xFC, &&abs_x0xE5, &&op_0xFE, &&op_0xFF,
+		};
+	#endif
+	
+	uint8_t const* instr;
+	fuint8 opcode;
+	fuint16 data;
+	
+	// TODO: eliminate this special case
+	#if BLARGG_NONPORTABLE
+		#define FETCH_OP() (instr = s.code_map [pc >> page_bits],\
+				opcode = instr [pc], instr += ++pc)
+	#else
+		#define FETCH_OP() (instr = s.code_map [pc >> page_bits] + PAGE_OFFSET( pc ),\
+				opcode = *instr++, pc++)
+	#endif
+	
+	// Runs next instruction. With computed goto, this is expanded at the end of each
+	// instruction, giving each its own indirect jump for the host CPU to predict.
+	// The JIT needs every instruction to go through loop.
+	#if BLARGG_COMPUTED_GOTO && !NES_CPU_JIT
+		#define NEXT_INSTR() NEXT_INSTR_()
+	#else
+		#define NEXT_INSTR() goto loop
+	#endif
+	
 	goto loop;
 dec_clock_loop:
 	s_time--;
 loop:
 	
+	#if NES_CPU_JIT
+		if ( jit )
+		{
+			Nes_Cpu_Jit::block_t const* block = jit->find( pc, s.code_map );
+			if ( block && s_time + block->time < 0 )
+			{
+				Nes_Cpu_Jit::regs_t& j = jit->regs;
+				j.pc     = pc;
+				j.a      = a;
+				j.x      = x;
+				j.y      = y;
+				j.sp     = sp;
+				j.status = status;
+				j.c      = c;
+				j.nz     = nz;
+				j.time   = s_time;
+				unsigned count = jit->run( block );
+				pc     = j.pc;
+				a      = j.a;
+				x      = j.x;
+				y      = j.y;
+				sp     = j.sp;
+				status = j.status;
+				c      = j.c;
+				nz     = j.nz;
+				s_time = j.time;
+				#if GME_STATS
+					instr_count_ += count;
+				#endif
+				(void) count;
+				goto loop;
+			}
+		}
+	#endif
+	
+	COUNT_INSTR();
+	
 	check( (unsigned) GET_SP() < 0x100 );
 	check( (unsigned) pc < 0x10000 );
 	check( (unsigned) a < 0x100 );
@@ -172,41 +1533,7 @@ loop:
 	check( (unsigned) y < 0x100 );
 	check( -32768 <= s_time && s_time < 32767 );
 	
-	uint8_t const* instr = s.code_map [pc >> page_bits];
-	fuint8 opcode;
-	
-	// TODO: eliminate this special case
-	#if BLARGG_NONPORTABLE
-		opcode = instr [pc];
-		pc++;
-		instr += pc;
-	#else
-		instr += PAGE_OFFSET( pc );
-		opcode = *instr++;
-		pc++;
-	#endif
-	
-	static uint8_t const clock_table [256] =
-	{// 0 1 2 3 4 5 6 7 8 9 A B C D E F
-		0,6,2,8,3,3,5,5,3,2,2,2,4,4,6,6,// 0
-		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 1
-		6,6,2,8,3,3,5,5,4,2,2,2,4,4,6,6,// 2
-		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 3
-		6,6,2,8,3,3,5,5,3,2,2,2,3,4,6,6,// 4
-		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 5
-		6,6,2,8,3,3,5,5,4,2,2,2,5,4,6,6,// 6
-		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// 7
-		2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,// 8
-		3,6,2,6,4,4,4,4,2,5,2,5,5,5,5,5,// 9
-		2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,// A
-		3,5,2,5,4,4,4,4,2,4,2,4,4,4,4,4,// B
-		2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,// C
-		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7,// D
-		2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,// E
-		3,5,0,8,4,4,6,6,2,4,2,7,4,4,7,7 // F
-	}; // 0x00 was 7 and 0xF2 was 2
-	
-	fuint16 data;
+	FETCH_OP();
 	
 #if !BLARGG_CPU_X86
 	if ( s_time >= 0 )
@@ -215,6 +1542,21 @@ loop:
 	
 	data = *instr;
 	
+	// same as above
+	#define NEXT_INSTR_() {\
+		COUNT_INSTR();\
+		FETCH_OP();\
+		if ( s_time >= 0 )\
+			goto out_of_time;\
+		s_time += clock_table [opcode];\
+		data = *instr;\
+		goto *op_table [opcode];\
+	}
+	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [opcode];
+	#endif
+	
 	switch ( opcode )
 	{
 #else
@@ -226,6 +1568,21 @@ almost_out_of_time:
 	
 	data = *instr;
 	
+	// same as above
+	#define NEXT_INSTR_() {\
+		COUNT_INSTR();\
+		FETCH_OP();\
+		data = clock_table [opcode];\
+		if ( (s_time += data) >= 0 )\
+			goto possibly_out_of_time;\
+		data = *instr;\
+		goto *op_table [opcode];\
+	}
+	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [opcode];
+	#endif
+	
 	switch ( opcode )
 	{
 possibly_out_of_time:
@@ -244,7 +1601,7 @@ possibly_out_of_time:
 #define NO_PAGE_CROSSING( lsb )
 #define HANDLE_PAGE_CROSSING( lsb ) s_time += (lsb) >> 8;
 
-#define INC_DEC_XY( reg, n ) reg = uint8_t (nz = reg + n); goto loop;
+#define INC_DEC_XY( reg, n ) reg = uint8_t (nz = reg + n); NEXT_INSTR();
 
 #define IND_Y( cross, out ) {\
 		fuint16 temp = READ_LOW( data ) + y;\
@@ -258,25 +1615,25 @@ possibly_out_of_time:
 	}
 	
 #define ARITH_ADDR_MODES( op )\
-case op - 0x04: /* (ind,x) */\
+OP_CASE_NAMED( op - 0x04, ind_x##op ): /* (ind,x) */\
 	IND_X( data )\
 	goto ptr##op;\
-case op + 0x0C: /* (ind),y */\
+OP_CASE_NAMED( op + 0x0C, ind_y##op ): /* (ind),y */\
 	IND_Y( HANDLE_PAGE_CROSSING, data )\
 	goto ptr##op;\
-case op + 0x10: /* zp,X */\
+OP_CASE_NAMED( op + 0x10, zp_x##op ): /* zp,X */\
 	data = uint8_t (data + x);\
-case op + 0x00: /* zp */\
+OP_CASE_NAMED( op + 0x00, zp##op ): /* zp */\
 	data = READ_LOW( data );\
 	goto imm##op;\
-case op + 0x14: /* abs,Y */\
+OP_CASE_NAMED( op + 0x14, abs_y##op ): /* abs,Y */\
 	data += y;\
 	goto ind##op;\
-case op + 0x18: /* abs,X */\
+OP_CASE_NAMED( op + 0x18, abs_x##op ): /* abs,X */\
 	data += x;\
 ind##op:\
 	HANDLE_PAGE_CROSSING( data );\
-case op + 0x08: /* abs */\
+OP_CASE_NAMED( op + 0x08, abs##op ): /* abs */\
 	ADD_PAGE();\
 ptr##op:\
 	FLUSH_TIME();\
@@ -293,41 +1650,41 @@ imm##op:
 	if ( !(cond) ) goto dec_clock_loop;\
 	pc = BOOST::uint16_t (pc + offset);\
 	s_time += extra_clock >> 8 & 1;\
-	goto loop;\
+	NEXT_INSTR();\
 }
 
 // Often-Used
 
-	case 0xB5: // LDA zp,x
+	OP_CASE( 0xB5 ): // LDA zp,x
 		a = nz = READ_LOW( uint8_t (data + x) );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xA5: // LDA zp
+	OP_CASE( 0xA5 ): // LDA zp
 		a = nz = READ_LOW( data );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD0: // BNE
+	OP_CASE( 0xD0 ): // BNE
 		BRANCH( (uint8_t) nz );
 	
-	case 0x20: { // JSR
+	OP_CASE( 0x20 ): { // JSR
 		fuint16 temp = pc + 1;
 		pc = GET_ADDR();
 		WRITE_LOW( 0x100 | (sp - 1), temp >> 8 );
 		sp = (sp - 2) | 0x100;
 		WRITE_LOW( sp, temp );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x4C: // JMP abs
+	OP_CASE( 0x4C ): // JMP abs
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xE8: // INX
+	OP_CASE( 0xE8 ): // INX
 		INC_DEC_XY( x, 1 )
 	
-	case 0x10: // BPL
+	OP_CASE( 0x10 ): // BPL
 		BRANCH( !IS_NEG )
 	
 	ARITH_ADDR_MODES( 0xC5 ) // CMP
@@ -335,227 +1692,227 @@ imm##op:
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x30: // BMI
+	OP_CASE( 0x30 ): // BMI
 		BRANCH( IS_NEG )
 	
-	case 0xF0: // BEQ
+	OP_CASE( 0xF0 ): // BEQ
 		BRANCH( !(uint8_t) nz );
 	
-	case 0x95: // STA zp,x
+	OP_CASE( 0x95 ): // STA zp,x
 		data = uint8_t (data + x);
-	case 0x85: // STA zp
+	OP_CASE( 0x85 ): // STA zp
 		pc++;
 		WRITE_LOW( data, a );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC8: // INY
+	OP_CASE( 0xC8 ): // INY
 		INC_DEC_XY( y, 1 )
 
-	case 0xA8: // TAY
+	OP_CASE( 0xA8 ): // TAY
 		y  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x98: // TYA
+	OP_CASE( 0x98 ): // TYA
 		a  = y;
 		nz = y;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xAD:{// LDA abs
+	OP_CASE( 0xAD ):{// LDA abs
 		unsigned addr = GET_ADDR();
 		pc += 2;
 		READ_LIKELY_PPU( addr, nz );
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x60: // RTS
+	OP_CASE( 0x60 ): // RTS
 		pc = 1 + READ_LOW( sp );
 		pc += 0x100 * READ_LOW( 0x100 | (sp - 0xFF) );
 		sp = (sp - 0xFE) | 0x100;
-		goto loop;
+		NEXT_INSTR();
 	
 	{
 		fuint16 addr;
 		
-	case 0x99: // STA abs,Y
+	OP_CASE( 0x99 ): // STA abs,Y
 		addr = y + GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 		goto sta_ptr;
 	
-	case 0x8D: // STA abs
+	OP_CASE( 0x8D ): // STA abs
 		addr = GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 		goto sta_ptr;
 	
-	case 0x9D: // STA abs,X (slightly more common than STA abs)
+	OP_CASE( 0x9D ): // STA abs,X (slightly more common than STA abs)
 		addr = x + GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 	sta_ptr:
 		FLUSH_TIME();
 		WRITE( addr, a );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x91: // STA (ind),Y
+	OP_CASE( 0x91 ): // STA (ind),Y
 		IND_Y( NO_PAGE_CROSSING, addr )
 		pc++;
 		goto sta_ptr;
 	
-	case 0x81: // STA (ind,X)
+	OP_CASE( 0x81 ): // STA (ind,X)
 		IND_X( addr )
 		pc++;
 		goto sta_ptr;
 	
 	}
 	
-	case 0xA9: // LDA #imm
+	OP_CASE( 0xA9 ): // LDA #imm
 		pc++;
 		a  = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 
 	// common read instructions
 	{
 		fuint16 addr;
 		
-	case 0xA1: // LDA (ind,X)
+	OP_CASE( 0xA1 ): // LDA (ind,X)
 		IND_X( addr )
 		pc++;
 		goto a_nz_read_addr;
 	
-	case 0xB1:// LDA (ind),Y
+	OP_CASE( 0xB1 ):// LDA (ind),Y
 		addr = READ_LOW( data ) + y;
 		HANDLE_PAGE_CROSSING( addr );
 		addr += 0x100 * READ_LOW( (uint8_t) (data + 1) );
 		pc++;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 		goto a_nz_read_addr;
 	
-	case 0xB9: // LDA abs,Y
+	OP_CASE( 0xB9 ): // LDA abs,Y
 		HANDLE_PAGE_CROSSING( data + y );
 		addr = GET_ADDR() + y;
 		pc += 2;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 		goto a_nz_read_addr;
 	
-	case 0xBD: // LDA abs,X
+	OP_CASE( 0xBD ): // LDA abs,X
 		HANDLE_PAGE_CROSSING( data + x );
 		addr = GET_ADDR() + x;
 		pc += 2;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 	a_nz_read_addr:
 		FLUSH_TIME();
 		a = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
 	}
 
 // Branch
 
-	case 0x50: // BVC
+	OP_CASE( 0x50 ): // BVC
 		BRANCH( !(status & st_v) )
 	
-	case 0x70: // BVS
+	OP_CASE( 0x70 ): // BVS
 		BRANCH( status & st_v )
 	
-	case 0xB0: // BCS
+	OP_CASE( 0xB0 ): // BCS
 		BRANCH( c & 0x100 )
 	
-	case 0x90: // BCC
+	OP_CASE( 0x90 ): // BCC
 		BRANCH( !(c & 0x100) )
 	
 // Load/store
 	
-	case 0x94: // STY zp,x
+	OP_CASE( 0x94 ): // STY zp,x
 		data = uint8_t (data + x);
-	case 0x84: // STY zp
+	OP_CASE( 0x84 ): // STY zp
 		pc++;
 		WRITE_LOW( data, y );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x96: // STX zp,y
+	OP_CASE( 0x96 ): // STX zp,y
 		data = uint8_t (data + y);
-	case 0x86: // STX zp
+	OP_CASE( 0x86 ): // STX zp
 		pc++;
 		WRITE_LOW( data, x );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB6: // LDX zp,y
+	OP_CASE( 0xB6 ): // LDX zp,y
 		data = uint8_t (data + y);
-	case 0xA6: // LDX zp
+	OP_CASE( 0xA6 ): // LDX zp
 		data = READ_LOW( data );
-	case 0xA2: // LDX #imm
+	OP_CASE( 0xA2 ): // LDX #imm
 		pc++;
 		x = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB4: // LDY zp,x
+	OP_CASE( 0xB4 ): // LDY zp,x
 		data = uint8_t (data + x);
-	case 0xA4: // LDY zp
+	OP_CASE( 0xA4 ): // LDY zp
 		data = READ_LOW( data );
-	case 0xA0: // LDY #imm
+	OP_CASE( 0xA0 ): // LDY #imm
 		pc++;
 		y = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBC: // LDY abs,X
+	OP_CASE( 0xBC ): // LDY abs,X
 		data += x;
 		HANDLE_PAGE_CROSSING( data );
-	case 0xAC:{// LDY abs
+	OP_CASE( 0xAC ):{// LDY abs
 		unsigned addr = data + 0x100 * GET_MSB();
 		pc += 2;
 		FLUSH_TIME();
 		y = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xBE: // LDX abs,y
+	OP_CASE( 0xBE ): // LDX abs,y
 		data += y;
 		HANDLE_PAGE_CROSSING( data );
-	case 0xAE:{// LDX abs
+	OP_CASE( 0xAE ):{// LDX abs
 		unsigned addr = data + 0x100 * GET_MSB();
 		pc += 2;
 		FLUSH_TIME();
 		x = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 	{
 		fuint8 temp;
-	case 0x8C: // STY abs
+	OP_CASE( 0x8C ): // STY abs
 		temp = y;
 		goto store_abs;
 	
-	case 0x8E: // STX abs
+	OP_CASE( 0x8E ): // STX abs
 		temp = x;
 	store_abs:
 		unsigned addr = GET_ADDR();
@@ -563,17 +1920,17 @@ imm##op:
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		FLUSH_TIME();
 		WRITE( addr, temp );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 
 // Compare
 
-	case 0xEC:{// CPX abs
+	OP_CASE( 0xEC ):{// CPX abs
 		unsigned addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -582,17 +1939,17 @@ imm##op:
 		goto cpx_data;
 	}
 	
-	case 0xE4: // CPX zp
+	OP_CASE( 0xE4 ): // CPX zp
 		data = READ_LOW( data );
-	case 0xE0: // CPX #imm
+	OP_CASE( 0xE0 ): // CPX #imm
 	cpx_data:
 		nz = x - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xCC:{// CPY abs
+	OP_CASE( 0xCC ):{// CPY abs
 		unsigned addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -601,59 +1958,59 @@ imm##op:
 		goto cpy_data;
 	}
 	
-	case 0xC4: // CPY zp
+	OP_CASE( 0xC4 ): // CPY zp
 		data = READ_LOW( data );
-	case 0xC0: // CPY #imm
+	OP_CASE( 0xC0 ): // CPY #imm
 	cpy_data:
 		nz = y - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
 // Logical
 
 	ARITH_ADDR_MODES( 0x25 ) // AND
 		nz = (a &= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x45 ) // EOR
 		nz = (a ^= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x05 ) // ORA
 		nz = (a |= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x2C:{// BIT abs
+	OP_CASE( 0x2C ):{// BIT abs
 		unsigned addr = GET_ADDR();
 		pc += 2;
 		status &= ~st_v;
 		READ_LIKELY_PPU( addr, nz );
 		status |= nz & st_v;
 		if ( a & nz )
-			goto loop;
+			NEXT_INSTR();
 		nz <<= 8; // result must be zero, even if N bit is set
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x24: // BIT zp
+	OP_CASE( 0x24 ): // BIT zp
 		nz = READ_LOW( data );
 		pc++;
 		status &= ~st_v;
 		status |= nz & st_v;
 		if ( a & nz )
-			goto loop;
+			NEXT_INSTR();
 		nz <<= 8; // result must be zero, even if N bit is set
-		goto loop;
+		NEXT_INSTR();
 		
 // Add/subtract
 
 	ARITH_ADDR_MODES( 0xE5 ) // SBC
-	case 0xEB: // unofficial equivalent
+	OP_CASE( 0xEB ): // unofficial equivalent
 		data ^= 0xFF;
 		goto adc_imm;
 	
@@ -666,40 +2023,40 @@ imm##op:
 		c = nz = a + data + carry;
 		pc++;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Shift/rotate
 
-	case 0x4A: // LSR A
+	OP_CASE( 0x4A ): // LSR A
 		c = 0;
-	case 0x6A: // ROR A
+	OP_CASE( 0x6A ): // ROR A
 		nz = c >> 1 & 0x80;
 		c = a << 8;
 		nz |= a >> 1;
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x0A: // ASL A
+	OP_CASE( 0x0A ): // ASL A
 		nz = a << 1;
 		c = nz;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x2A: { // ROL A
+	OP_CASE( 0x2A ): { // ROL A
 		nz = a << 1;
 		fint16 temp = c >> 8 & 1;
 		c = nz;
 		nz |= temp;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x5E: // LSR abs,X
+	OP_CASE( 0x5E ): // LSR abs,X
 		data += x;
-	case 0x4E: // LSR abs
+	OP_CASE( 0x4E ): // LSR abs
 		c = 0;
-	case 0x6E: // ROR abs
+	OP_CASE( 0x6E ): // ROR abs
 	ror_abs: {
 		ADD_PAGE();
 		FLUSH_TIME();
@@ -709,15 +2066,15 @@ imm##op:
 		goto rotate_common;
 	}
 	
-	case 0x3E: // ROL abs,X
+	OP_CASE( 0x3E ): // ROL abs,X
 		data += x;
 		goto rol_abs;
 	
-	case 0x1E: // ASL abs,X
+	OP_CASE( 0x1E ): // ASL abs,X
 		data += x;
-	case 0x0E: // ASL abs
+	OP_CASE( 0x0E ): // ASL abs
 		c = 0;
-	case 0x2E: // ROL abs
+	OP_CASE( 0x2E ): // ROL abs
 	rol_abs:
 		ADD_PAGE();
 		nz = c >> 8 & 1;
@@ -727,21 +2084,21 @@ imm##op:
 		pc++;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x7E: // ROR abs,X
+	OP_CASE( 0x7E ): // ROR abs,X
 		data += x;
 		goto ror_abs;
 	
-	case 0x76: // ROR zp,x
+	OP_CASE( 0x76 ): // ROR zp,x
 		data = uint8_t (data + x);
 		goto ror_zp;
 	
-	case 0x56: // LSR zp,x
+	OP_CASE( 0x56 ): // LSR zp,x
 		data = uint8_t (data + x);
-	case 0x46: // LSR zp
+	OP_CASE( 0x46 ): // LSR zp
 		c = 0;
-	case 0x66: // ROR zp
+	OP_CASE( 0x66 ): // ROR zp
 	ror_zp: {
 		int temp = READ_LOW( data );
 		nz = (c >> 1 & 0x80) | (temp >> 1);
@@ -749,15 +2106,15 @@ imm##op:
 		goto write_nz_zp;
 	}
 	
-	case 0x36: // ROL zp,x
+	OP_CASE( 0x36 ): // ROL zp,x
 		data = uint8_t (data + x);
 		goto rol_zp;
 	
-	case 0x16: // ASL zp,x
+	OP_CASE( 0x16 ): // ASL zp,x
 		data = uint8_t (data + x);
-	case 0x06: // ASL zp
+	OP_CASE( 0x06 ): // ASL zp
 		c = 0;
-	case 0x26: // ROL zp
+	OP_CASE( 0x26 ): // ROL zp
 	rol_zp:
 		nz = c >> 8 & 1;
 		nz |= (c = READ_LOW( data ) << 1);
@@ -765,44 +2122,44 @@ imm##op:
 	
 // Increment/decrement
 
-	case 0xCA: // DEX
+	OP_CASE( 0xCA ): // DEX
 		INC_DEC_XY( x, -1 )
 	
-	case 0x88: // DEY
+	OP_CASE( 0x88 ): // DEY
 		INC_DEC_XY( y, -1 )
 	
-	case 0xF6: // INC zp,x
+	OP_CASE( 0xF6 ): // INC zp,x
 		data = uint8_t (data + x);
-	case 0xE6: // INC zp
+	OP_CASE( 0xE6 ): // INC zp
 		nz = 1;
 		goto add_nz_zp;
 	
-	case 0xD6: // DEC zp,x
+	OP_CASE( 0xD6 ): // DEC zp,x
 		data = uint8_t (data + x);
-	case 0xC6: // DEC zp
+	OP_CASE( 0xC6 ): // DEC zp
 		nz = (unsigned) -1;
 	add_nz_zp:
 		nz += READ_LOW( data );
 	write_nz_zp:
 		pc++;
 		WRITE_LOW( data, nz );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xFE: // INC abs,x
+	OP_CASE( 0xFE ): // INC abs,x
 		data = x + GET_ADDR();
 		goto inc_ptr;
 	
-	case 0xEE: // INC abs
+	OP_CASE( 0xEE ): // INC abs
 		data = GET_ADDR();
 	inc_ptr:
 		nz = 1;
 		goto inc_common;
 	
-	case 0xDE: // DEC abs,x
+	OP_CASE( 0xDE ): // DEC abs,x
 		data = x + GET_ADDR();
 		goto dec_ptr;
 	
-	case 0xCE: // DEC abs
+	OP_CASE( 0xCE ): // DEC abs
 		data = GET_ADDR();
 	dec_ptr:
 		nz = (unsigned) -1;
@@ -812,113 +2169,113 @@ imm##op:
 		pc += 2;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 		
 // Transfer
 
-	case 0xAA: // TAX
+	OP_CASE( 0xAA ): // TAX
 		x  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x8A: // TXA
+	OP_CASE( 0x8A ): // TXA
 		a  = x;
 		nz = x;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x9A: // TXS
+	OP_CASE( 0x9A ): // TXS
 		SET_SP( x ); // verified (no flag change)
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBA: // TSX
+	OP_CASE( 0xBA ): // TSX
 		x = nz = GET_SP();
-		goto loop;
+		NEXT_INSTR();
 	
 // Stack
 	
-	case 0x48: // PHA
+	OP_CASE( 0x48 ): // PHA
 		PUSH( a ); // verified
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x68: // PLA
+	OP_CASE( 0x68 ): // PLA
 		a = nz = READ_LOW( sp );
 		sp = (sp - 0xFF) | 0x100;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x40:{// RTI
+	OP_CASE( 0x40 ):{// RTI
 		fuint8 temp = READ_LOW( sp );
 		pc  = READ_LOW( 0x100 | (sp - 0xFF) );
 		pc |= READ_LOW( 0x100 | (sp - 0xFE) ) * 0x100;
 		sp = (sp - 0xFD) | 0x100;
 		data = status;
 		SET_STATUS( temp );
-		if ( !((data ^ status) & st_i) ) goto loop; // I flag didn't change
+		if ( !((data ^ status) & st_i) ) NEXT_INSTR(); // I flag didn't change
 		this->r.status = status; // update externally-visible I flag
 		blargg_long delta = s.base - irq_time_;
-		if ( delta <= 0 ) goto loop;
-		if ( status & st_i ) goto loop;
+		if ( delta <= 0 ) NEXT_INSTR();
+		if ( status & st_i ) NEXT_INSTR();
 		s_time += delta;
 		s.base = irq_time_;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x28:{// PLP
+	OP_CASE( 0x28 ):{// PLP
 		fuint8 temp = READ_LOW( sp );
 		sp = (sp - 0xFF) | 0x100;
 		fuint8 changed = status ^ temp;
 		SET_STATUS( temp );
 		if ( !(changed & st_i) )
-			goto loop; // I flag didn't change
+			NEXT_INSTR(); // I flag didn't change
 		if ( status & st_i )
 			goto handle_sei;
 		goto handle_cli;
 	}
 	
-	case 0x08: { // PHP
+	OP_CASE( 0x08 ): { // PHP
 		fuint8 temp;
 		CALC_STATUS( temp );
 		PUSH( temp | (st_b | st_r) );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x6C:{// JMP (ind)
+	OP_CASE( 0x6C ):{// JMP (ind)
 		data = GET_ADDR();
 		check( unsigned (data - 0x2000) >= 0x4000 ); // ensure it's outside I/O space
 		uint8_t const* page = s.code_map [data >> page_bits];
 		pc = page [PAGE_OFFSET( data )];
 		data = (data & 0xFF00) | ((data + 1) & 0xFF);
 		pc |= page [PAGE_OFFSET( data )] << 8;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x00: // BRK
+	OP_CASE( 0x00 ): // BRK
 		goto handle_brk;
 	
 // Flags
 
-	case 0x38: // SEC
+	OP_CASE( 0x38 ): // SEC
 		c = (unsigned) ~0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x18: // CLC
+	OP_CASE( 0x18 ): // CLC
 		c = 0;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0xB8: // CLV
+	OP_CASE( 0xB8 ): // CLV
 		status &= ~st_v;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD8: // CLD
+	OP_CASE( 0xD8 ): // CLD
 		status &= ~st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF8: // SED
+	OP_CASE( 0xF8 ): // SED
 		status |= st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x58: // CLI
+	OP_CASE( 0x58 ): // CLI
 		if ( !(status & st_i) )
-			goto loop;
+			NEXT_INSTR();
 		status &= ~st_i;
 	handle_cli: {
 		//dprintf( "CLI at %d\n", TIME );
@@ -927,30 +2284,30 @@ imm##op:
 		if ( delta <= 0 )
 		{
 			if ( TIME < irq_time_ )
-				goto loop;
+				NEXT_INSTR();
 			goto delayed_cli;
 		}
 		s.base = irq_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		
 		if ( delta >= s_time + 1 )
 		{
 			s.base += s_time + 1;
 			s_time = -1;
-			goto loop;
+			NEXT_INSTR();
 		}
 		
 		// TODO: implement
 	delayed_cli:
 		dprintf( "Delayed CLI not emulated\n" );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x78: // SEI
+	OP_CASE( 0x78 ): // SEI
 		if ( status & st_i )
-			goto loop;
+			NEXT_INSTR();
 		status |= st_i;
 	handle_sei: {
 		this->r.status = status; // update externally-visible I flag
@@ -958,46 +2315,51 @@ imm##op:
 		s.base = end_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		
 		dprintf( "Delayed SEI not emulated\n" );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Unofficial
 	
 	// SKW - Skip word
-	case 0x1C: case 0x3C: case 0x5C: case 0x7C: case 0xDC: case 0xFC:
+	OP_CASE( 0x1C ): OP_CASE( 0x3C ): OP_CASE( 0x5C ): OP_CASE( 0x7C ): OP_CASE( 0xDC ):
+	OP_CASE( 0xFC ):
 		HANDLE_PAGE_CROSSING( data + x );
-	case 0x0C:
+	OP_CASE( 0x0C ):
 		pc++;
 	// SKB - Skip byte
-	case 0x74: case 0x04: case 0x14: case 0x34: case 0x44: case 0x54: case 0x64:
-	case 0x80: case 0x82: case 0x89: case 0xC2: case 0xD4: case 0xE2: case 0xF4:
+	OP_CASE( 0x74 ): OP_CASE( 0x04 ): OP_CASE( 0x14 ): OP_CASE( 0x34 ): OP_CASE( 0x44 ):
+	OP_CASE( 0x54 ): OP_CASE( 0x64 ):
+	OP_CASE( 0x80 ): OP_CASE( 0x82 ): OP_CASE( 0x89 ): OP_CASE( 0xC2 ): OP_CASE( 0xD4 ):
+	OP_CASE( 0xE2 ): OP_CASE( 0xF4 ):
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	// NOP
-	case 0xEA: case 0x1A: case 0x3A: case 0x5A: case 0x7A: case 0xDA: case 0xFA:
-		goto loop;
+	OP_CASE( 0xEA ): OP_CASE( 0x1A ): OP_CASE( 0x3A ): OP_CASE( 0x5A ): OP_CASE( 0x7A ):
+	OP_CASE( 0xDA ): OP_CASE( 0xFA ):
+		NEXT_INSTR();
 
-	case bad_opcode: // HLT
+	OP_CASE( bad_opcode ): // HLT
 		pc--;
 		if ( pc > 0xFFFF )
 		{
 			// handle wrap-around (assumes caller has put page of HLT at 0x10000)
 			pc &= 0xFFFF;
-			goto loop;
+			NEXT_INSTR();
 		}
-	case 0x02: case 0x12: case 0x22: case 0x32: case 0x42: case 0x52:
-	case 0x62: case 0x72: case 0x92: case 0xB2: case 0xD2:
+	OP_CASE( 0x02 ): OP_CASE( 0x12 ): OP_CASE( 0x22 ): OP_CASE( 0x32 ): OP_CASE( 0x42 ):
+	OP_CASE( 0x52 ):
+	OP_CASE( 0x62 ): OP_CASE( 0x72 ): OP_CASE( 0x92 ): OP_CASE( 0xB2 ): OP_CASE( 0xD2 ):
 		goto stop;
 	
 // Unimplemented
 	
-	case 0xFF: // force 256-entry jump table for optimization purposes
+	OP_CASE( 0xFF ): // force 256-entry jump table for optimization purposes
 		c |= 1;
-	default:
+	OP_DEFAULT:
 		check( (unsigned) opcode <= 0xFF );
 		// skip over proper number of bytes
 		static unsigned char const illop_lens [8] = {
@@ -1017,7 +2379,7 @@ imm##op:
 			if ( opcode != 0xB7 )
 				HANDLE_PAGE_CROSSING( data + y );
 		}
-		goto loop;
+		NEXT_INSTR();
 	}
 	assert( false );
 	
@@ -10,6 +10,15 @@ typedef blargg_long nes_time_t; // clock cycle count
 typedef unsigned nes_addr_t; // 16-bit address
 enum { future_nes_time = LONG_MAX / 2 + 1 };
 
+// NES_CPU_JIT: Set in blargg_config.h to have run() translate 6502 code to
+// x86-64 code a block at a time using Xbyak. Requires x86-64. Timing and memory
+// accesses are the same as the interpreter's.
+#if NES_CPU_JIT && !(defined (__x86_64__) || defined (_M_X64))
+	#undef NES_CPU_JIT
+#endif
+
+class Nes_Cpu_Jit;
+
 class Nes_Cpu {
 public:
 	typedef BOOST::uint8_t uint8_t;
@@ -45,6 +54,9 @@ public:
 	// stopped due to encountering bad_opcode.
 	bool run( nes_time_t end_time );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Time of beginning of next instruction to be executed
 	nes_time_t time() const             { return state->time + state->base; }
 	void set_time( nes_time_t t )       { state->time = t - state->base; }
@@ -63,8 +75,18 @@ public:
 	// CPU invokes bad opcode handler if it encounters this
 	enum { bad_opcode = 0xF2 };
 	
+	// Save/load registers, low memory, memory map and timing (see
+	// blargg_copy_func_t). Must not be called during run(). Memory map holds
+	// pointers, so state can only be loaded back into the same emulator.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
-	Nes_Cpu() { state = &state_; }
+	#if NES_CPU_JIT
+		Nes_Cpu();
+		~Nes_Cpu();
+	#else
+		Nes_Cpu() : instr_count_( 0 ) { state = &state_; }
+	#endif
 	enum { page_bits = 11 };
 	enum { page_count = 0x10000 >> page_bits };
 	enum { irq_inhibit = 0x04 };
@@ -76,12 +98,24 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	nes_time_t irq_time_;
 	nes_time_t end_time_;
 	unsigned long error_count_;
 	
 	void set_code_page( int, void const* );
 	inline int update_end_time( nes_time_t end, nes_time_t irq );
+	
+	#if NES_CPU_JIT
+		friend class Nes_Cpu_Jit;
+		Nes_Cpu_Jit* jit; // NULL if code memory couldn't be allocated
+		int jit_read( nes_addr_t );
+		void jit_write( nes_addr_t, int data );
+		
+		// noncopyable
+		Nes_Cpu( const Nes_Cpu& );
+		Nes_Cpu& operator = ( const Nes_Cpu& );
+	#endif
 };
 
 inline BOOST::uint8_t const* Nes_Cpu::get_code( nes_addr_t addr )
@@ -28,6 +28,15 @@ void Nes_Fme7_Apu::reset()
 	memset( state, 0, sizeof *state );
 }
 
+void Nes_Fme7_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	fme7_apu_state_t* state = this;
+	copy( io, state, sizeof *state );
+	BLARGG_COPY( last_time );
+	for ( int i = 0; i < osc_count; i++ )
+		BLARGG_COPY( oscs [i].last_amp );
+}
+
 unsigned char const Nes_Fme7_Apu::amp_table [16] =
 {
 	#define ENTRY( n ) (unsigned char) (n * amp_range + 0.5)
@@ -49,9 +58,8 @@ void Nes_Fme7_Apu::run_until( blip_time_t end_time )
 		int volume = amp_table [vol_mode & 0x0F];
 		
 		Blip_Buffer* const osc_output = oscs [index].output;
-		if ( !osc_output )
-			continue;
-		osc_output->set_modified();
+		if ( osc_output )
+			osc_output->set_modified();
 		
 		// check for unsupported mode
 		#ifndef NDEBUG
@@ -73,11 +81,14 @@ void Nes_Fme7_Apu::run_until( blip_time_t end_time )
 			if ( !period ) // on my AY-3-8910A, period doesn't have extra one added
 				period = period_factor;
 		}
+		if ( !osc_output )
+			volume = 0; // just maintain phase, so it's the same once output returns
 		
 		// current amplitude
 		int amp = volume;
 		if ( !phases [index] )
 			amp = 0;
+		if ( osc_output )
 		{
 			int delta = amp - oscs [index].last_amp;
 			if ( delta )
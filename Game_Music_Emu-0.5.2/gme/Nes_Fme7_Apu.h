@@ -29,6 +29,10 @@ public:
 	void save_state( fme7_apu_state_t* ) const;
 	void load_state( fme7_apu_state_t const& );
 	
+	// Save/load exact emulation state, including amplitudes, so that sound
+	// continues without a click (see blargg_copy_func_t)
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 	// Mask and addresses of registers
 	enum { addr_mask = 0xE000 };
 	enum { data_addr = 0xE000 };
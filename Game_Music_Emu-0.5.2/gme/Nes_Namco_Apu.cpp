@@ -17,6 +17,7 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 
 Nes_Namco_Apu::Nes_Namco_Apu()
 {
+	resampled_rate = 0;
 	output( NULL );
 	volume( 1.0 );
 	reset();
@@ -46,6 +47,19 @@ void Nes_Namco_Apu::output( Blip_Buffer* buf )
 		osc_output( i, buf );
 }
 
+void Nes_Namco_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( addr_reg );
+	BLARGG_COPY( reg );
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		BLARGG_COPY( oscs [i].delay );
+		BLARGG_COPY( oscs [i].last_amp );
+		BLARGG_COPY( oscs [i].wave_pos );
+	}
+}
+
 /*
 void Nes_Namco_Apu::reflect_state( Tagged_Data& data )
 {
@@ -75,18 +89,27 @@ void Nes_Namco_Apu::end_frame( blip_time_t time )
 
 void Nes_Namco_Apu::run_until( blip_time_t nes_end_time )
 {
+	// oscs without output still run, at the rate of the last output, so their
+	// wave position is the same once output returns
+	for ( int i = osc_count; i--; )
+	{
+		if ( oscs [i].output )
+			resampled_rate = oscs [i].output->resampled_duration( 1 );
+	}
+	
 	int active_oscs = (reg [0x7F] >> 4 & 7) + 1;
 	for ( int i = osc_count - active_oscs; i < osc_count; i++ )
 	{
 		Namco_Osc& osc = oscs [i];
 		Blip_Buffer* output = osc.output;
-		if ( !output )
-			continue;
-		output->set_modified();
-		
-		blip_resampled_time_t time =
-				output->resampled_time( last_time ) + osc.delay;
-		blip_resampled_time_t end_time = output->resampled_time( nes_end_time );
+		blip_resampled_time_t time = last_time * resampled_rate + osc.delay;
+		blip_resampled_time_t end_time = nes_end_time * resampled_rate;
+		if ( output )
+		{
+			output->set_modified();
+			time = output->resampled_time( last_time ) + osc.delay;
+			end_time = output->resampled_time( nes_end_time );
+		}
 		osc.delay = 0;
 		if ( time < end_time )
 		{
@@ -102,7 +125,7 @@ void Nes_Namco_Apu::run_until( blip_time_t nes_end_time )
 			if ( freq < 64 * active_oscs )
 				continue; // prevent low frequencies from excessively delaying freq changes
 			blip_resampled_time_t period =
-					output->resampled_duration( 983040 ) / freq * active_oscs;
+					resampled_rate * 983040 / freq * active_oscs;
 			
 			int wave_size = 32 - (osc_reg [4] >> 2 & 7) * 4;
 			if ( !wave_size )
@@ -121,7 +144,7 @@ void Nes_Namco_Apu::run_until( blip_time_t nes_end_time )
 				
 				// output impulse if amplitude changed
 				int delta = sample - last_amp;
-				if ( delta )
+				if ( delta && output )
 				{
 					last_amp = sample;
 					synth.offset_resampled( time, delta, output );
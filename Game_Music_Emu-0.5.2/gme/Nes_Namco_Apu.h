@@ -7,8 +7,6 @@
 #include "blargg_common.h"
 #include "Blip_Buffer.h"
 
-struct namco_state_t;
-
 class Nes_Namco_Apu {
 public:
 	// See Nes_Apu.h for reference.
@@ -29,9 +27,9 @@ public:
 	enum { addr_reg_addr = 0xF800 };
 	void write_addr( int );
 	
-	// to do: implement save/restore
-	void save_state( namco_state_t* out ) const;
-	void load_state( namco_state_t const& );
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
 	
 public:
 	Nes_Namco_Apu();
@@ -51,6 +49,7 @@ private:
 	Namco_Osc oscs [osc_count];
 	
 	blip_time_t last_time;
+	blip_resampled_time_t resampled_rate; // resampled_duration( 1 ) of last output
 	int addr_reg;
 	
 	enum { reg_count = 0x80 };
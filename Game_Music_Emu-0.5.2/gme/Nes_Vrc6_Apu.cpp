@@ -102,12 +102,27 @@ void Nes_Vrc6_Apu::load_state( vrc6_apu_state_t const& in )
 		oscs [2].phase = 1;
 }
 
+void Nes_Vrc6_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	BLARGG_COPY( last_time );
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		Vrc6_Osc& osc = oscs [i];
+		BLARGG_COPY( osc.regs );
+		BLARGG_COPY( osc.delay );
+		BLARGG_COPY( osc.last_amp );
+		BLARGG_COPY( osc.phase );
+		BLARGG_COPY( osc.amp );
+	}
+}
+
+// Oscs are run even without output, so phase is the same once output returns
+
 void Nes_Vrc6_Apu::run_square( Vrc6_Osc& osc, blip_time_t end_time )
 {
 	Blip_Buffer* output = osc.output;
-	if ( !output )
-		return;
-	output->set_modified();
+	if ( output )
+		output->set_modified();
 	
 	int volume = osc.regs [0] & 15;
 	if ( !(osc.regs [2] & 0x80) )
@@ -117,7 +132,7 @@ void Nes_Vrc6_Apu::run_square( Vrc6_Osc& osc, blip_time_t end_time )
 	int duty = ((osc.regs [0] >> 4) & 7) + 1;
 	int delta = ((gate || osc.phase < duty) ? volume : 0) - osc.last_amp;
 	blip_time_t time = last_time;
-	if ( delta )
+	if ( delta && output )
 	{
 		osc.last_amp += delta;
 		square_synth.offset( time, delta, output );
@@ -128,6 +143,14 @@ void Nes_Vrc6_Apu::run_square( Vrc6_Osc& osc, blip_time_t end_time )
 	int period = osc.period();
 	if ( volume && !gate && period > 4 )
 	{
+		if ( time < end_time && !output )
+		{
+			// keep calculating phase
+			int count = (end_time - time + period - 1) / period;
+			osc.phase = (osc.phase + count) & 15;
+			time += count * period;
+		}
+		
 		if ( time < end_time )
 		{
 			int phase = osc.phase;
@@ -160,9 +183,8 @@ void Nes_Vrc6_Apu::run_saw( blip_time_t end_time )
 {
 	Vrc6_Osc& osc = oscs [2];
 	Blip_Buffer* output = osc.output;
-	if ( !output )
-		return;
-	output->set_modified();
+	if ( output )
+		output->set_modified();
 	
 	int amp = osc.amp;
 	int amp_step = osc.regs [0] & 0x3F;
@@ -171,9 +193,12 @@ void Nes_Vrc6_Apu::run_saw( blip_time_t end_time )
 	if ( !(osc.regs [2] & 0x80) || !(amp_step | amp) )
 	{
 		osc.delay = 0;
-		int delta = (amp >> 3) - last_amp;
-		last_amp = amp >> 3;
-		saw_synth.offset( time, delta, output );
+		if ( output )
+		{
+			int delta = (amp >> 3) - last_amp;
+			last_amp = amp >> 3;
+			saw_synth.offset( time, delta, output );
+		}
 	}
 	else
 	{
@@ -192,7 +217,7 @@ void Nes_Vrc6_Apu::run_saw( blip_time_t end_time )
 				}
 				
 				int delta = (amp >> 3) - last_amp;
-				if ( delta )
+				if ( delta && output )
 				{
 					last_amp = amp >> 3;
 					saw_synth.offset( time, delta, output );
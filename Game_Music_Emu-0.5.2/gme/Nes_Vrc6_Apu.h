@@ -22,6 +22,10 @@ public:
 	void save_state( vrc6_apu_state_t* ) const;
 	void load_state( vrc6_apu_state_t const& );
 	
+	// Save/load exact emulation state, including amplitudes, so that sound
+	// continues without a click (see blargg_copy_func_t)
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 	// Oscillator 0 write-only registers are at $9000-$9002
 	// Oscillator 1 write-only registers are at $A000-$A002
 	// Oscillator 2 write-only registers are at $B000-$B002
@@ -10,6 +10,7 @@
 	#include "Nes_Namco_Apu.h"
 	#include "Nes_Vrc6_Apu.h"
 	#include "Nes_Fme7_Apu.h"
+	#include "blargg_thread.h"
 #endif
 
 /* Copyright (C) 2003-2006 Shay Green. This module is free software; you
@@ -31,6 +32,38 @@ int const fme7_flag  = 0x20;
 
 long const clock_divisor = 12;
 
+#if !NSF_EMU_APU_ONLY
+
+// Expansion chip run on a worker thread
+struct Nsf_Emu::chip_worker_t
+{
+	enum { max_writes = 1024 }; // if a frame has more, earlier ones are run right away
+	struct write_t
+	{
+		nes_time_t time;
+		nes_addr_t addr;
+		int data;
+	};
+	
+	Nsf_Emu* emu;
+	int chip;
+	int osc_count;
+	bool direct; // run on emulator thread this frame, into output buffers
+	nes_time_t end_time;
+	int write_count;
+	write_t writes [max_writes];
+	Blip_Buffer* routes [max_chip_oscs]; // where each oscillator goes this frame
+	Blip_Buffer bufs [max_chip_oscs]; // one for each different output buffer
+	
+	enum { idle, busy, quit };
+	int state;
+	blargg_mutex mutex;
+	blargg_cond cond;
+	blargg_thread thread;
+};
+
+#endif
+
 Nsf_Emu::equalizer_t const Nsf_Emu::nes_eq     = {  -1.0, 80 };
 Nsf_Emu::equalizer_t const Nsf_Emu::famicom_eq = { -15.0, 80 };
 
@@ -44,6 +77,9 @@ Nsf_Emu::Nsf_Emu()
 	vrc6  = 0;
 	namco = 0;
 	fme7  = 0;
+	parallel_chips = false;
+	memset( workers, 0, sizeof workers );
+	memset( chip_outputs, 0, sizeof chip_outputs );
 	
 	set_type( gme_nsf_type );
 	set_silence_lookahead( 6 );
@@ -59,6 +95,9 @@ void Nsf_Emu::unload()
 {
 	#if !NSF_EMU_APU_ONLY
 	{
+		stop_workers();
+		memset( chip_outputs, 0, sizeof chip_outputs );
+		
 		delete vrc6;
 		vrc6  = 0;
 		
@@ -127,7 +166,9 @@ struct Nsf_File : Gme_Info_
 static Music_Emu* new_nsf_emu () { return BLARGG_NEW Nsf_Emu ; }
 static Music_Emu* new_nsf_file() { return BLARGG_NEW Nsf_File; }
 
-gme_type_t_ const gme_nsf_type [1] = { "Nintendo NES", 0, &new_nsf_emu, &new_nsf_file, "NSF", 1 };
+gme_type_t_ const gme_nsf_type [1] = { "Nintendo NES", 0, &new_nsf_emu, &new_nsf_file, "NSF", 1,
+		gme_caps_fast_skip | gme_caps_multi_chip | gme_caps_float | gme_caps_find_loop |
+		gme_caps_state, 1789773 };
 
 // Setup
 
@@ -151,7 +192,7 @@ void Nsf_Emu::set_tempo_( double t )
 	
 	if ( playback_rate != standard_rate || t != 1.0 )
 		play_period = long (playback_rate * clock_rate_ / (1000000.0 / clock_divisor * t));
-
+	
 	apu.set_tempo( t );
 }
 
@@ -323,7 +364,14 @@ blargg_err_t Nsf_Emu::load_( Data_Reader& in )
 	
 	set_tempo( tempo() );
 	
-	return setup_buffer( (long) (clock_rate_ + 0.5) );
+	RETURN_ERR( setup_buffer( (long) (clock_rate_ + 0.5) ) );
+	
+	#if !NSF_EMU_APU_ONLY
+		if ( parallel_chips )
+			RETURN_ERR( start_workers() );
+	#endif
+	
+	return 0;
 }
 
 void Nsf_Emu::update_eq( blip_eq_t const& eq )
@@ -352,7 +400,7 @@ void Nsf_Emu::set_voice( int i, Blip_Buffer* buf, Blip_Buffer*, Blip_Buffer* )
 	{
 		if ( fme7 && i < Nes_Fme7_Apu::osc_count )
 		{
-			fme7->osc_output( i, buf );
+			set_chip_output( fme7_chip, i, buf );
 			return;
 		}
 		
@@ -363,7 +411,7 @@ void Nsf_Emu::set_voice( int i, Blip_Buffer* buf, Blip_Buffer*, Blip_Buffer* )
 				// put saw first
 				if ( --i < 0 )
 					i = 2;
-				vrc6->osc_output( i, buf );
+				set_chip_output( vrc6_chip, i, buf );
 				return;
 			}
 			i -= Nes_Vrc6_Apu::osc_count;
@@ -371,7 +419,7 @@ void Nsf_Emu::set_voice( int i, Blip_Buffer* buf, Blip_Buffer*, Blip_Buffer* )
 		
 		if ( namco && i < Nes_Namco_Apu::osc_count )
 		{
-			namco->osc_output( i, buf );
+			set_chip_output( namco_chip, i, buf );
 			return;
 		}
 	}
@@ -391,11 +439,18 @@ void Nsf_Emu::cpu_write_misc( nes_addr_t addr, int data )
 			switch ( addr )
 			{
 			case Nes_Namco_Apu::data_reg_addr:
-				namco->write_data( time(), data );
+				count_apu_write();
+				if ( workers [namco_chip] )
+					log_chip_write( namco_chip, addr, data );
+				else
+					namco->write_data( time(), data );
 				return;
 			
 			case Nes_Namco_Apu::addr_reg_addr:
-				namco->write_addr( data );
+				if ( workers [namco_chip] )
+					log_chip_write( namco_chip, addr, data );
+				else
+					namco->write_addr( data );
 				return;
 			}
 		}
@@ -405,11 +460,18 @@ void Nsf_Emu::cpu_write_misc( nes_addr_t addr, int data )
 			switch ( addr & Nes_Fme7_Apu::addr_mask )
 			{
 			case Nes_Fme7_Apu::latch_addr:
-				fme7->write_latch( data );
+				if ( workers [fme7_chip] )
+					log_chip_write( fme7_chip, addr, data );
+				else
+					fme7->write_latch( data );
 				return;
 			
 			case Nes_Fme7_Apu::data_addr:
-				fme7->write_data( time(), data );
+				count_apu_write();
+				if ( workers [fme7_chip] )
+					log_chip_write( fme7_chip, addr, data );
+				else
+					fme7->write_data( time(), data );
 				return;
 			}
 		}
@@ -420,7 +482,11 @@ void Nsf_Emu::cpu_write_misc( nes_addr_t addr, int data )
 			unsigned osc = unsigned (addr - Nes_Vrc6_Apu::base_addr) / Nes_Vrc6_Apu::addr_step;
 			if ( osc < Nes_Vrc6_Apu::osc_count && reg < Nes_Vrc6_Apu::reg_count )
 			{
-				vrc6->write_osc( time(), osc, reg, data );
+				count_apu_write();
+				if ( workers [vrc6_chip] )
+					log_chip_write( vrc6_chip, addr, data );
+				else
+					vrc6->write_osc( time(), osc, reg, data );
 				return;
 			}
 		}
@@ -465,6 +531,10 @@ blargg_err_t Nsf_Emu::start_track_( int track )
 		if ( namco ) namco->reset();
 		if ( vrc6  ) vrc6 ->reset();
 		if ( fme7  ) fme7 ->reset();
+		
+		for ( int i = 0; i < chip_count; i++ )
+			if ( workers [i] )
+				workers [i]->write_count = 0;
 	}
 	#endif
 	
@@ -485,6 +555,10 @@ blargg_err_t Nsf_Emu::start_track_( int track )
 
 blargg_err_t Nsf_Emu::run_clocks( blip_time_t& duration, int )
 {
+	#if !NSF_EMU_APU_ONLY
+		begin_chips();
+	#endif
+	
 	set_time( 0 );
 	while ( time() < duration )
 	{
@@ -527,6 +601,8 @@ blargg_err_t Nsf_Emu::run_clocks( blip_time_t& duration, int )
 				low_mem [0x100 + r.sp--] = (badop_addr - 1) >> 8;
 				low_mem [0x100 + r.sp--] = (badop_addr - 1) & 0xFF;
 				GME_FRAME_HOOK( this );
+				if ( probing() )
+					probe_frame( time(), low_mem, sizeof low_mem, sram, sizeof sram );
 			}
 		}
 	}
@@ -543,15 +619,344 @@ blargg_err_t Nsf_Emu::run_clocks( blip_time_t& duration, int )
 	if ( next_play < 0 )
 		next_play = 0;
 	
-	apu.end_frame( duration );
+	#if NSF_EMU_APU_ONLY
+		apu.end_frame( duration );
+	#else
+		end_chips( duration );
+	#endif
+	
+	return 0;
+}
+
+// Chip workers are idle and their buffers empty between frames, so they have no
+// state of their own
+blargg_err_t Nsf_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( saved_state );
+	BLARGG_COPY( next_play );
+	BLARGG_COPY( play_period );
+	BLARGG_COPY( play_extra );
+	BLARGG_COPY( play_ready );
+	BLARGG_COPY( sram );
+	apu.copy_state( io, copy );
 	
 	#if !NSF_EMU_APU_ONLY
 	{
-		if ( namco ) namco->end_frame( duration );
-		if ( vrc6  ) vrc6 ->end_frame( duration );
-		if ( fme7  ) fme7 ->end_frame( duration );
+		if ( namco ) namco->copy_state( io, copy );
+		if ( vrc6  ) vrc6 ->copy_state( io, copy );
+		if ( fme7  ) fme7 ->copy_state( io, copy );
+	}
+	#endif
+	return 0;
+}
+
+blargg_err_t Nsf_Emu::change_sample_rate_( long rate )
+{
+	RETURN_ERR( Classic_Emu::change_sample_rate_( rate ) );
+	#if !NSF_EMU_APU_ONLY
+	{
+		// workers are idle between frames and their buffers are empty
+		for ( int i = 0; i < chip_count; i++ )
+		{
+			chip_worker_t* w = workers [i];
+			for ( int n = 0; w && n < w->osc_count; n++ )
+				RETURN_ERR( w->bufs [n].set_sample_rate( rate, buffer_length() ) );
+		}
+	}
+	#endif
+	return 0;
+}
+
+// Expansion chips on worker threads
+
+blargg_err_t Nsf_Emu::enable_parallel_chips( bool b )
+{
+	parallel_chips = b;
+	#if !NSF_EMU_APU_ONLY
+	{
+		if ( !b )
+			stop_workers();
+		else if ( namco || vrc6 || fme7 )
+			RETURN_ERR( start_workers() );
 	}
 	#endif
+	return 0;
+}
+
+#if !NSF_EMU_APU_ONLY
+
+void Nsf_Emu::chip_osc_output( int chip, int i, Blip_Buffer* buf )
+{
+	switch ( chip )
+	{
+		case namco_chip: namco->osc_output( i, buf ); break;
+		case vrc6_chip:  vrc6 ->osc_output( i, buf ); break;
+		case fme7_chip:  fme7 ->osc_output( i, buf ); break;
+	}
+}
+
+void Nsf_Emu::set_chip_output( int chip, int i, Blip_Buffer* buf )
+{
+	chip_outputs [chip] [i] = buf;
+	if ( !workers [chip] )
+		chip_osc_output( chip, i, buf ); // otherwise routed in begin_chips()
+}
+
+void Nsf_Emu::chip_thread( void* data )
+{
+	chip_worker_t& w = *(chip_worker_t*) data;
+	w.mutex.lock();
+	while ( true )
+	{
+		while ( w.state == chip_worker_t::idle )
+			w.cond.wait( w.mutex );
+		if ( w.state == chip_worker_t::quit )
+			break;
+		
+		w.mutex.unlock();
+		w.emu->run_chip( w.chip, w.end_time );
+		w.mutex.lock();
+		
+		w.state = chip_worker_t::idle;
+		w.cond.broadcast();
+	}
+	w.mutex.unlock();
+}
+
+blargg_err_t Nsf_Emu::start_workers()
+{
+	if ( blargg_thread::cpu_count() < 2 )
+		return 0;
+	
+
+	void* const chips [chip_count] = { namco, vrc6, fme7 };
+	static int const osc_counts [chip_count] = {
+		Nes_Namco_Apu::osc_count, Nes_Vrc6_Apu::osc_count, Nes_Fme7_Apu::osc_count
+	};
 	
+	for ( int i = 0; i < chip_count; i++ )
+	{
+		if ( !chips [i] )
+			continue;
+		
+		if ( workers [i] )
+			continue;
+		
+		chip_worker_t* w = BLARGG_NEW chip_worker_t;
+		CHECK_ALLOC( w );
+		w->emu         = this;
+		w->chip        = i;
+		w->osc_count   = osc_counts [i];
+		w->direct      = false;
+		w->end_time    = 0;
+		w->write_count = 0;
+		w->state       = chip_worker_t::idle;
+		
+		// allocated now since playing can't
+		blargg_err_t err = 0;
+		for ( int n = 0; n < w->osc_count && !err; n++ )
+			err = w->bufs [n].set_sample_rate( sample_rate(), buffer_length() );
+		if ( !err )
+			err = w->thread.start( chip_thread, w );
+		if ( err )
+		{
+			delete w;
+			return err;
+		}
+		workers [i] = w;
+	}
 	return 0;
 }
+
+void Nsf_Emu::stop_workers()
+{
+	for ( int i = 0; i < chip_count; i++ )
+	{
+		chip_worker_t* w = workers [i];
+		if ( !w )
+			continue;
+		
+		w->mutex.lock();
+		w->state = chip_worker_t::quit;
+		w->cond.broadcast();
+		w->mutex.unlock();
+		w->thread.join();
+		
+		workers [i] = 0;
+		delete w;
+		
+		for ( int n = 0; n < max_chip_oscs; n++ )
+			if ( chip_outputs [i] [n] )
+				chip_osc_output( i, n, chip_outputs [i] [n] );
+	}
+}
+
+void Nsf_Emu::log_chip_write( int chip, nes_addr_t addr, int data )
+{
+	chip_worker_t& w = *workers [chip];
+	if ( w.write_count >= chip_worker_t::max_writes )
+		run_chip_writes( chip );
+	
+	chip_worker_t::write_t& out = w.writes [w.write_count++];
+	out.time = time();
+	out.addr = addr;
+	out.data = data;
+}
+
+void Nsf_Emu::run_chip_writes( int chip )
+{
+	chip_worker_t& w = *workers [chip];
+	chip_worker_t::write_t const* in = w.writes;
+	chip_worker_t::write_t const* const end = in + w.write_count;
+	w.write_count = 0;
+	
+	switch ( chip )
+	{
+	case namco_chip:
+		for ( ; in != end; in++ )
+		{
+			if ( in->addr == Nes_Namco_Apu::data_reg_addr )
+				namco->write_data( in->time, in->data );
+			else
+				namco->write_addr( in->data );
+		}
+		break;
+	
+	case vrc6_chip:
+		for ( ; in != end; in++ )
+		{
+			unsigned reg = in->addr & (Nes_Vrc6_Apu::addr_step - 1);
+			unsigned osc = unsigned (in->addr - Nes_Vrc6_Apu::base_addr) / Nes_Vrc6_Apu::addr_step;
+			vrc6->write_osc( in->time, osc, reg, in->data );
+		}
+		break;
+	
+	case fme7_chip:
+		for ( ; in != end; in++ )
+		{
+			if ( (in->addr & Nes_Fme7_Apu::addr_mask) == Nes_Fme7_Apu::latch_addr )
+				fme7->write_latch( in->data );
+			else
+				fme7->write_data( in->time, in->data );
+		}
+		break;
+	}
+}
+
+void Nsf_Emu::run_chip( int chip, nes_time_t end )
+{
+	if ( workers [chip] )
+		run_chip_writes( chip );
+	
+	switch ( chip )
+	{
+		case namco_chip: namco->end_frame( end ); break;
+		case vrc6_chip:  vrc6 ->end_frame( end ); break;
+		case fme7_chip:  fme7 ->end_frame( end ); break;
+	}
+}
+
+void Nsf_Emu::begin_chips()
+{
+	for ( int i = 0; i < chip_count; i++ )
+	{
+		chip_worker_t* w = workers [i];
+		if ( !w )
+			continue;
+		
+		w->direct = false;
+		Blip_Buffer* const* outputs = chip_outputs [i];
+		for ( int n = 0; n < w->osc_count; n++ )
+		{
+			Blip_Buffer* out = outputs [n];
+			Blip_Buffer* buf = 0;
+			if ( out )
+			{
+				for ( int m = 0; m < n; m++ )
+					if ( outputs [m] == out )
+						buf = w->routes [m];
+				
+				if ( !buf )
+				{
+					// deltas must land at the same positions they would in out
+					buf = &w->bufs [n];
+					if ( buf->buffer_size_ < out->buffer_size_ )
+						w->direct = true; // custom buffer longer than expected
+					buf->factor_ = out->factor_;
+					buf->offset_ = out->offset_;
+				}
+			}
+			w->routes [n] = buf;
+		}
+		
+		for ( int n = 0; n < w->osc_count; n++ )
+			chip_osc_output( i, n, (w->direct ? outputs [n] : w->routes [n]) );
+	}
+}
+
+// Adds deltas from frame in 'in' to 'out', and clears them from 'in'
+static void mix_chip_buf( Blip_Buffer* out, Blip_Buffer& in, nes_time_t end )
+{
+	long first = in.samples_avail();
+	long last  = (long) (in.resampled_time( end ) >> BLIP_BUFFER_ACCURACY) + blip_buffer_extra_;
+	if ( last > out->buffer_size_ + blip_buffer_extra_ )
+		last = out->buffer_size_ + blip_buffer_extra_;
+	
+	Blip_Buffer::buf_t_* BLIP_RESTRICT to   = out->buffer_;
+	Blip_Buffer::buf_t_* BLIP_RESTRICT from = in.buffer_;
+	for ( long n = first; n < last; n++ )
+	{
+		to [n] += from [n];
+		from [n] = 0;
+	}
+	
+	if ( in.clear_modified() )
+		out->set_modified();
+	out->synth_count_ += in.synth_count_;
+	in.synth_count_ = 0;
+}
+
+void Nsf_Emu::end_chips( nes_time_t end )
+{
+	bool const present [chip_count] = { namco != 0, vrc6 != 0, fme7 != 0 };
+	
+	int i;
+	for ( i = 0; i < chip_count; i++ )
+	{
+		chip_worker_t* w = workers [i];
+		if ( w && !w->direct )
+		{
+			w->mutex.lock();
+			w->end_time = end;
+			w->state = chip_worker_t::busy;
+			w->cond.broadcast();
+			w->mutex.unlock();
+		}
+	}
+	
+	apu.end_frame( end );
+	
+	for ( i = 0; i < chip_count; i++ )
+		if ( present [i] && (!workers [i] || workers [i]->direct) )
+			run_chip( i, end );
+	
+	for ( i = 0; i < chip_count; i++ )
+	{
+		chip_worker_t* w = workers [i];
+		if ( !w || w->direct )
+			continue;
+		
+		w->mutex.lock();
+		while ( w->state == chip_worker_t::busy )
+			w->cond.wait( w->mutex );
+		w->mutex.unlock();
+		
+		for ( int n = 0; n < w->osc_count; n++ )
+			if ( w->routes [n] == &w->bufs [n] )
+				mix_chip_buf( chip_outputs [i] [n], w->bufs [n], end );
+	}
+}
+
+#endif
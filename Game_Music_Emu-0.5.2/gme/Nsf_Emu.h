@@ -42,6 +42,13 @@ public:
 	
 	static gme_type_t static_type() { return gme_nsf_type; }
 	
+	// Run each expansion sound chip on its own thread, alongside the NES APU.
+	// Writes to the chips are logged during a frame and run at its end, each
+	// chip into its own buffers, which are then mixed into the output. Output
+	// is the same either way. Can be called before or after loading a file, but
+	// not while playing. Has no effect on machines with only one processor.
+	blargg_err_t enable_parallel_chips( bool = true );
+	
 public:
 	// deprecated
 	Music_Emu::load;
@@ -56,7 +63,10 @@ protected:
 	blargg_err_t track_info_( track_info_t*, int track ) const;
 	blargg_err_t load_( Data_Reader& );
 	blargg_err_t start_track_( int );
+	blargg_err_t change_sample_rate_( long );
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
 	blargg_err_t run_clocks( blip_time_t&, int );
+	blargg_ulong cpu_instr_count() const { return cpu::instr_count(); }
 	void set_tempo_( double );
 	void set_voice( int, Blip_Buffer*, Blip_Buffer*, Blip_Buffer* );
 	void update_eq( blip_eq_t const& );
@@ -96,6 +106,24 @@ private:
 	static int pcm_read( void*, nes_addr_t );
 	blargg_err_t init_sound();
 	
+	// expansion chips run on worker threads
+	enum { namco_chip, vrc6_chip, fme7_chip, chip_count };
+	enum { max_chip_oscs = 8 };
+	struct chip_worker_t;
+	chip_worker_t* workers [chip_count]; // NULL if chip is run directly
+	Blip_Buffer* chip_outputs [chip_count] [max_chip_oscs]; // as set by set_voice()
+	bool parallel_chips;
+	blargg_err_t start_workers();
+	void stop_workers();
+	void set_chip_output( int chip, int osc, Blip_Buffer* );
+	void chip_osc_output( int chip, int osc, Blip_Buffer* );
+	void log_chip_write( int chip, nes_addr_t, int data );
+	void run_chip_writes( int chip );
+	void run_chip( int chip, nes_time_t end );
+	void begin_chips();
+	void end_chips( nes_time_t );
+	static void chip_thread( void* );
+	
 	header_t header_;
 	
 	enum { sram_addr = 0x6000 };
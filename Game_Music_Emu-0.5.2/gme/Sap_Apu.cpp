@@ -90,6 +90,17 @@ void Sap_Apu::reset( Sap_Apu_Impl* new_impl )
 		memset( &oscs [i], 0, offsetof (osc_t,output) );
 }
 
+void Sap_Apu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	for ( int i = 0; i < osc_count; i++ )
+		copy( io, &oscs [i], offsetof (osc_t,output) );
+	BLARGG_COPY( last_time );
+	BLARGG_COPY( poly5_pos );
+	BLARGG_COPY( poly4_pos );
+	BLARGG_COPY( polym_pos );
+	BLARGG_COPY( control );
+}
+
 inline void Sap_Apu::calc_periods()
 {
 	 // 15/64 kHz clock
@@ -27,6 +27,10 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 	#define CPU_DONE( cpu, time, result_out )   { result_out = -1; }
 #endif
 
+#ifdef NES_CPU_LOG_H
+	#undef BLARGG_COMPUTED_GOTO // log goes through loop
+#endif
+
 #include "blargg_source.h"
 
 int const st_n = 0x80;
@@ -57,6 +61,15 @@ void Sap_Cpu::reset( void* new_mem )
 	blargg_verify_byte_order();
 }
 
+void Sap_Cpu::copy_state( unsigned char** io, blargg_copy_func_t copy )
+{
+	assert( state == &state_ ); // not during run()
+	BLARGG_COPY( r );
+	BLARGG_COPY( state_ );
+	BLARGG_COPY( irq_time_ );
+	BLARGG_COPY( end_time_ );
+}
+
 #define TIME                    (s_time + s.base)
 #define READ( addr )            CPU_READ( this, (addr), TIME )
 #define WRITE( addr, data )     {CPU_WRITE( this, (addr), (data), TIME );}
@@ -116,11 +129,105 @@ bool Sap_Cpu::run( sap_time_t end_time )
 		SET_STATUS( temp );
 	}
 	
+	#if BLARGG_COMPUTED_GOTO
+		// Address of code for each opcode, matching the OP_CASE labels below
+		static void* const op_table [0x100] = {
+			&&op_0x00, &&ind_x0x05, &&op_default, &&op_default,
+			&&op_0x04, &&zp0x05, &&op_0x06, &&op_default,
+			&&op_0x08, &&imm0x05, &&op_0x0A, &&op_default,
+			&&op_0x0C, &&abs0x05, &&op_0x0E, &&op_default,
+			&&op_0x10, &&ind_y0x05, &&op_default, &&op_default,
+			&&op_0x14, &&zp_x0x05, &&op_0x16, &&op_default,
+			&&op_0x18, &&abs_y0x05, &&op_0x1A, &&op_default,
+			&&op_0x1C, &&abs_x0x05, &&op_0x1E, &&op_default,
+			&&op_0x20, &&ind_x0x25, &&op_default, &&op_default,
+			&&op_0x24, &&zp0x25, &&op_0x26, &&op_default,
+			&&op_0x28, &&imm0x25, &&op_0x2A, &&op_default,
+			&&op_0x2C, &&abs0x25, &&op_0x2E, &&op_default,
+			&&op_0x30, &&ind_y0x25, &&op_default, &&op_default,
+			&&op_0x34, &&zp_x0x25, &&op_0x36, &&op_default,
+			&&op_0x38, &&abs_y0x25, &&op_0x3A, &&op_default,
+			&&op_0x3C, &&abs_x0x25, &&op_0x3E, &&op_default,
+			&&op_0x40, &&ind_x0x45, &&op_default, &&op_default,
+			&&op_0x44, &&zp0x45, &&op_0x46, &&op_default,
+			&&op_0x48, &&imm0x45, &&op_0x4A, &&op_default,
+			&&op_0x4C, &&abs0x45, &&op_0x4E, &&op_default,
+			&&op_0x50, &&ind_y0x45, &&op_default, &&op_default,
+			&&op_0x54, &&zp_x0x45, &&op_0x56, &&op_default,
+			&&op_0x58, &&abs_y0x45, &&op_0x5A, &&op_default,
+			&&op_0x5C, &&abs_x0x45, &&op_0x5E, &&op_default,
+			&&op_0x60, &&ind_x0x65, &&op_default, &&op_default,
+			&&op_0x64, &&zp0x65, &&op_0x66, &&op_default,
+			&&op_0x68, &&imm0x65, &&op_0x6A, &&op_default,
+			&&op_0x6C, &&abs0x65, &&op_0x6E, &&op_default,
+			&&op_0x70, &&ind_y0x65, &&op_default, &&op_default,
+			&&op_0x74, &&zp_x0x65, &&op_0x76, &&op_default,
+			&&op_0x78, &&abs_y0x65, &&op_0x7A, &&op_default,
+			&&op_0x7C, &&abs_x0x65, &&op_0x7E, &&op_default,
+			&&op_0x80, &&op_0x81, &&op_0x82, &&op_default,
+			&&op_0x84, &&op_0x85, &&op_0x86, &&op_default,
+			&&op_0x88, &&op_0x89, &&op_0x8A, &&op_default,
+			&&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_default,
+			&&op_0x90, &&op_0x91, &&op_default, &&op_default,
+			&&op_0x94, &&op_0x95, &&op_0x96, &&op_default,
+			&&op_0x98, &&op_0x99, &&op_0x9A, &&op_default,
+			&&op_default, &&op_0x9D, &&op_default, &&op_default,
+			&&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_default,
+			&&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_default,
+			&&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_default,
+			&&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_default,
+			&&op_0xB0, &&op_0xB1, &&op_default, &&op_default,
+			&&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_default,
+			&&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_default,
+			&&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_default,
+			&&op_0xC0, &&ind_x0xC5, &&op_0xC2, &&op_default,
+			&&op_0xC4, &&zp0xC5, &&op_0xC6, &&op_default,
+			&&op_0xC8, &&imm0xC5, &&op_0xCA, &&op_default,
+			&&op_0xCC, &&abs0xC5, &&op_0xCE, &&op_default,
+			&&op_0xD0, &&ind_y0xC5, &&op_default, &&op_default,
+			&&op_0xD4, &&zp_x0xC5, &&op_0xD6, &&op_default,
+			&&op_0xD8, &&abs_y0xC5, &&op_0xDA, &&op_default,
+			&&op_0xDC, &&abs_x0xC5, &&op_0xDE, &&op_default,
+			&&op_0xE0, &&ind_x0xE5, &&op_0xE2, &&op_default,
+			&&op_0xE4, &&zp0xE5, &&op_0xE6, &&op_default,
+			&&op_0xE8, &&imm0xE5, &&op_0xEA, &&op_0xEB,
+			&&op_0xEC, &&abs0xE5, &&op_0xEE, &&op_default,
+			&&op_0xF0, &&ind_y0xE5, &&op_default, &&op_default,
+			&&op_0xF4, &&zp_x0xE5, &&op_0xF6, &&op_default,
+			&&op_0xF8, &&abs_y0xE5, &&op_0xFA, &&op_default,
+			&&op_0xFC, &&abs_x0xE5, &&op_0xFE, &&op_default,
+		};
+	#endif
+	
+	uint8_t const* instr;
+	fuint8 opcode;
+	fuint16 data;
+	
+	// Runs next instruction. With computed goto, this is expanded at the end of each
+	// instruction, giving each its own indirect jump for the host CPU to predict.
+	#if BLARGG_COMPUTED_GOTO
+		#define NEXT_INSTR() {\
+			COUNT_INSTR();\
+			opcode = mem [pc];\
+			pc++;\
+			instr = mem + pc;\
+			data = clock_table [opcode];\
+			if ( (s_time += data) >= 0 )\
+				goto possibly_out_of_time;\
+			data = *instr;\
+			goto *op_table [opcode];\
+		}
+	#else
+		#define NEXT_INSTR() goto loop
+	#endif
+	
 	goto loop;
 dec_clock_loop:
 	s_time--;
 loop:
 	
+	COUNT_INSTR();
+	
 	#ifndef NDEBUG
 	{
 		sap_time_t correct = end_time_;
@@ -135,9 +242,9 @@ loop:
 	check( (unsigned) x < 0x100 );
 	check( (unsigned) y < 0x100 );
 	
-	fuint8 opcode = mem [pc];
+	opcode = mem [pc];
 	pc++;
-	uint8_t const* instr = mem + pc;
+	instr = mem + pc;
 	
 	static uint8_t const clock_table [256] =
 	{// 0 1 2 3 4 5 6 7 8 9 A B C D E F
@@ -159,7 +266,6 @@ loop:
 		3,5,2,8,4,4,6,6,2,4,2,7,4,4,7,7 // F
 	}; // 0x00 was 7
 	
-	fuint16 data;
 	data = clock_table [opcode];
 	if ( (s_time += data) >= 0 )
 		goto possibly_out_of_time;
@@ -171,6 +277,10 @@ almost_out_of_time:
 		nes_cpu_log( "cpu_log", pc - 1, opcode, instr [0], instr [1] );
 	#endif
 	
+	#if BLARGG_COMPUTED_GOTO
+		goto *op_table [opcode];
+	#endif
+	
 	switch ( opcode )
 	{
 possibly_out_of_time:
@@ -188,7 +298,7 @@ possibly_out_of_time:
 #define NO_PAGE_CROSSING( lsb )
 #define HANDLE_PAGE_CROSSING( lsb ) s_time += (lsb) >> 8;
 
-#define INC_DEC_XY( reg, n ) reg = uint8_t (nz = reg + n); goto loop;
+#define INC_DEC_XY( reg, n ) reg = uint8_t (nz = reg + n); NEXT_INSTR();
 
 #define IND_Y( cross, out ) {\
 		fuint16 temp = READ_LOW( data ) + y;\
@@ -202,25 +312,25 @@ possibly_out_of_time:
 	}
 	
 #define ARITH_ADDR_MODES( op )\
-case op - 0x04: /* (ind,x) */\
+OP_CASE_NAMED( op - 0x04, ind_x##op ): /* (ind,x) */\
 	IND_X( data )\
 	goto ptr##op;\
-case op + 0x0C: /* (ind),y */\
+OP_CASE_NAMED( op + 0x0C, ind_y##op ): /* (ind),y */\
 	IND_Y( HANDLE_PAGE_CROSSING, data )\
 	goto ptr##op;\
-case op + 0x10: /* zp,X */\
+OP_CASE_NAMED( op + 0x10, zp_x##op ): /* zp,X */\
 	data = uint8_t (data + x);\
-case op + 0x00: /* zp */\
+OP_CASE_NAMED( op + 0x00, zp##op ): /* zp */\
 	data = READ_LOW( data );\
 	goto imm##op;\
-case op + 0x14: /* abs,Y */\
+OP_CASE_NAMED( op + 0x14, abs_y##op ): /* abs,Y */\
 	data += y;\
 	goto ind##op;\
-case op + 0x18: /* abs,X */\
+OP_CASE_NAMED( op + 0x18, abs_x##op ): /* abs,X */\
 	data += x;\
 ind##op:\
 	HANDLE_PAGE_CROSSING( data );\
-case op + 0x08: /* abs */\
+OP_CASE_NAMED( op + 0x08, abs##op ): /* abs */\
 	ADD_PAGE();\
 ptr##op:\
 	FLUSH_TIME();\
@@ -237,41 +347,41 @@ imm##op:
 	if ( !(cond) ) goto dec_clock_loop;\
 	pc += offset;\
 	s_time += extra_clock >> 8 & 1;\
-	goto loop;\
+	NEXT_INSTR();\
 }
 
 // Often-Used
 
-	case 0xB5: // LDA zp,x
+	OP_CASE( 0xB5 ): // LDA zp,x
 		a = nz = READ_LOW( uint8_t (data + x) );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xA5: // LDA zp
+	OP_CASE( 0xA5 ): // LDA zp
 		a = nz = READ_LOW( data );
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD0: // BNE
+	OP_CASE( 0xD0 ): // BNE
 		BRANCH( (uint8_t) nz );
 	
-	case 0x20: { // JSR
+	OP_CASE( 0x20 ): { // JSR
 		fuint16 temp = pc + 1;
 		pc = GET_ADDR();
 		WRITE_LOW( 0x100 | (sp - 1), temp >> 8 );
 		sp = (sp - 2) | 0x100;
 		WRITE_LOW( sp, temp );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x4C: // JMP abs
+	OP_CASE( 0x4C ): // JMP abs
 		pc = GET_ADDR();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xE8: // INX
+	OP_CASE( 0xE8 ): // INX
 		INC_DEC_XY( x, 1 )
 	
-	case 0x10: // BPL
+	OP_CASE( 0x10 ): // BPL
 		BRANCH( !IS_NEG )
 	
 	ARITH_ADDR_MODES( 0xC5 ) // CMP
@@ -279,227 +389,227 @@ imm##op:
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x30: // BMI
+	OP_CASE( 0x30 ): // BMI
 		BRANCH( IS_NEG )
 	
-	case 0xF0: // BEQ
+	OP_CASE( 0xF0 ): // BEQ
 		BRANCH( !(uint8_t) nz );
 	
-	case 0x95: // STA zp,x
+	OP_CASE( 0x95 ): // STA zp,x
 		data = uint8_t (data + x);
-	case 0x85: // STA zp
+	OP_CASE( 0x85 ): // STA zp
 		pc++;
 		WRITE_LOW( data, a );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xC8: // INY
+	OP_CASE( 0xC8 ): // INY
 		INC_DEC_XY( y, 1 )
 
-	case 0xA8: // TAY
+	OP_CASE( 0xA8 ): // TAY
 		y  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x98: // TYA
+	OP_CASE( 0x98 ): // TYA
 		a  = y;
 		nz = y;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xAD:{// LDA abs
+	OP_CASE( 0xAD ):{// LDA abs
 		unsigned addr = GET_ADDR();
 		pc += 2;
 		nz = READ( addr );
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x60: // RTS
+	OP_CASE( 0x60 ): // RTS
 		pc = 1 + READ_LOW( sp );
 		pc += 0x100 * READ_LOW( 0x100 | (sp - 0xFF) );
 		sp = (sp - 0xFE) | 0x100;
-		goto loop;
+		NEXT_INSTR();
 	
 	{
 		fuint16 addr;
 		
-	case 0x99: // STA abs,Y
+	OP_CASE( 0x99 ): // STA abs,Y
 		addr = y + GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 		goto sta_ptr;
 	
-	case 0x8D: // STA abs
+	OP_CASE( 0x8D ): // STA abs
 		addr = GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 		goto sta_ptr;
 	
-	case 0x9D: // STA abs,X (slightly more common than STA abs)
+	OP_CASE( 0x9D ): // STA abs,X (slightly more common than STA abs)
 		addr = x + GET_ADDR();
 		pc += 2;
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, a );
-			goto loop;
+			NEXT_INSTR();
 		}
 	sta_ptr:
 		FLUSH_TIME();
 		WRITE( addr, a );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x91: // STA (ind),Y
+	OP_CASE( 0x91 ): // STA (ind),Y
 		IND_Y( NO_PAGE_CROSSING, addr )
 		pc++;
 		goto sta_ptr;
 	
-	case 0x81: // STA (ind,X)
+	OP_CASE( 0x81 ): // STA (ind,X)
 		IND_X( addr )
 		pc++;
 		goto sta_ptr;
 	
 	}
 	
-	case 0xA9: // LDA #imm
+	OP_CASE( 0xA9 ): // LDA #imm
 		pc++;
 		a  = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 
 	// common read instructions
 	{
 		fuint16 addr;
 		
-	case 0xA1: // LDA (ind,X)
+	OP_CASE( 0xA1 ): // LDA (ind,X)
 		IND_X( addr )
 		pc++;
 		goto a_nz_read_addr;
 	
-	case 0xB1:// LDA (ind),Y
+	OP_CASE( 0xB1 ):// LDA (ind),Y
 		addr = READ_LOW( data ) + y;
 		HANDLE_PAGE_CROSSING( addr );
 		addr += 0x100 * READ_LOW( (uint8_t) (data + 1) );
 		pc++;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 		goto a_nz_read_addr;
 	
-	case 0xB9: // LDA abs,Y
+	OP_CASE( 0xB9 ): // LDA abs,Y
 		HANDLE_PAGE_CROSSING( data + y );
 		addr = GET_ADDR() + y;
 		pc += 2;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 		goto a_nz_read_addr;
 	
-	case 0xBD: // LDA abs,X
+	OP_CASE( 0xBD ): // LDA abs,X
 		HANDLE_PAGE_CROSSING( data + x );
 		addr = GET_ADDR() + x;
 		pc += 2;
 		a = nz = READ_PROG( addr );
 		if ( (addr ^ 0x8000) <= 0x9FFF )
-			goto loop;
+			NEXT_INSTR();
 	a_nz_read_addr:
 		FLUSH_TIME();
 		a = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
 	}
 
 // Branch
 
-	case 0x50: // BVC
+	OP_CASE( 0x50 ): // BVC
 		BRANCH( !(status & st_v) )
 	
-	case 0x70: // BVS
+	OP_CASE( 0x70 ): // BVS
 		BRANCH( status & st_v )
 	
-	case 0xB0: // BCS
+	OP_CASE( 0xB0 ): // BCS
 		BRANCH( c & 0x100 )
 	
-	case 0x90: // BCC
+	OP_CASE( 0x90 ): // BCC
 		BRANCH( !(c & 0x100) )
 	
 // Load/store
 	
-	case 0x94: // STY zp,x
+	OP_CASE( 0x94 ): // STY zp,x
 		data = uint8_t (data + x);
-	case 0x84: // STY zp
+	OP_CASE( 0x84 ): // STY zp
 		pc++;
 		WRITE_LOW( data, y );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x96: // STX zp,y
+	OP_CASE( 0x96 ): // STX zp,y
 		data = uint8_t (data + y);
-	case 0x86: // STX zp
+	OP_CASE( 0x86 ): // STX zp
 		pc++;
 		WRITE_LOW( data, x );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB6: // LDX zp,y
+	OP_CASE( 0xB6 ): // LDX zp,y
 		data = uint8_t (data + y);
-	case 0xA6: // LDX zp
+	OP_CASE( 0xA6 ): // LDX zp
 		data = READ_LOW( data );
-	case 0xA2: // LDX #imm
+	OP_CASE( 0xA2 ): // LDX #imm
 		pc++;
 		x = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xB4: // LDY zp,x
+	OP_CASE( 0xB4 ): // LDY zp,x
 		data = uint8_t (data + x);
-	case 0xA4: // LDY zp
+	OP_CASE( 0xA4 ): // LDY zp
 		data = READ_LOW( data );
-	case 0xA0: // LDY #imm
+	OP_CASE( 0xA0 ): // LDY #imm
 		pc++;
 		y = data;
 		nz = data;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBC: // LDY abs,X
+	OP_CASE( 0xBC ): // LDY abs,X
 		data += x;
 		HANDLE_PAGE_CROSSING( data );
-	case 0xAC:{// LDY abs
+	OP_CASE( 0xAC ):{// LDY abs
 		unsigned addr = data + 0x100 * GET_MSB();
 		pc += 2;
 		FLUSH_TIME();
 		y = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0xBE: // LDX abs,y
+	OP_CASE( 0xBE ): // LDX abs,y
 		data += y;
 		HANDLE_PAGE_CROSSING( data );
-	case 0xAE:{// LDX abs
+	OP_CASE( 0xAE ):{// LDX abs
 		unsigned addr = data + 0x100 * GET_MSB();
 		pc += 2;
 		FLUSH_TIME();
 		x = nz = READ( addr );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 	{
 		fuint8 temp;
-	case 0x8C: // STY abs
+	OP_CASE( 0x8C ): // STY abs
 		temp = y;
 		goto store_abs;
 	
-	case 0x8E: // STX abs
+	OP_CASE( 0x8E ): // STX abs
 		temp = x;
 	store_abs:
 		unsigned addr = GET_ADDR();
@@ -507,17 +617,17 @@ imm##op:
 		if ( addr <= 0x7FF )
 		{
 			WRITE_LOW( addr, temp );
-			goto loop;
+			NEXT_INSTR();
 		}
 		FLUSH_TIME();
 		WRITE( addr, temp );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	}
 
 // Compare
 
-	case 0xEC:{// CPX abs
+	OP_CASE( 0xEC ):{// CPX abs
 		unsigned addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -526,17 +636,17 @@ imm##op:
 		goto cpx_data;
 	}
 	
-	case 0xE4: // CPX zp
+	OP_CASE( 0xE4 ): // CPX zp
 		data = READ_LOW( data );
-	case 0xE0: // CPX #imm
+	OP_CASE( 0xE0 ): // CPX #imm
 	cpx_data:
 		nz = x - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xCC:{// CPY abs
+	OP_CASE( 0xCC ):{// CPY abs
 		unsigned addr = GET_ADDR();
 		pc++;
 		FLUSH_TIME();
@@ -545,59 +655,59 @@ imm##op:
 		goto cpy_data;
 	}
 	
-	case 0xC4: // CPY zp
+	OP_CASE( 0xC4 ): // CPY zp
 		data = READ_LOW( data );
-	case 0xC0: // CPY #imm
+	OP_CASE( 0xC0 ): // CPY #imm
 	cpy_data:
 		nz = y - data;
 		pc++;
 		c = ~nz;
 		nz &= 0xFF;
-		goto loop;
+		NEXT_INSTR();
 	
 // Logical
 
 	ARITH_ADDR_MODES( 0x25 ) // AND
 		nz = (a &= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x45 ) // EOR
 		nz = (a ^= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	ARITH_ADDR_MODES( 0x05 ) // ORA
 		nz = (a |= data);
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x2C:{// BIT abs
+	OP_CASE( 0x2C ):{// BIT abs
 		unsigned addr = GET_ADDR();
 		pc += 2;
 		status &= ~st_v;
 		nz = READ( addr );
 		status |= nz & st_v;
 		if ( a & nz )
-			goto loop;
+			NEXT_INSTR();
 		nz <<= 8; // result must be zero, even if N bit is set
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x24: // BIT zp
+	OP_CASE( 0x24 ): // BIT zp
 		nz = READ_LOW( data );
 		pc++;
 		status &= ~st_v;
 		status |= nz & st_v;
 		if ( a & nz )
-			goto loop;
+			NEXT_INSTR();
 		nz <<= 8; // result must be zero, even if N bit is set
-		goto loop;
+		NEXT_INSTR();
 		
 // Add/subtract
 
 	ARITH_ADDR_MODES( 0xE5 ) // SBC
-	case 0xEB: // unofficial equivalent
+	OP_CASE( 0xEB ): // unofficial equivalent
 		data ^= 0xFF;
 		goto adc_imm;
 	
@@ -611,40 +721,40 @@ imm##op:
 		c = nz = a + data + carry;
 		pc++;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Shift/rotate
 
-	case 0x4A: // LSR A
+	OP_CASE( 0x4A ): // LSR A
 		c = 0;
-	case 0x6A: // ROR A
+	OP_CASE( 0x6A ): // ROR A
 		nz = c >> 1 & 0x80;
 		c = a << 8;
 		nz |= a >> 1;
 		a = nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x0A: // ASL A
+	OP_CASE( 0x0A ): // ASL A
 		nz = a << 1;
 		c = nz;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x2A: { // ROL A
+	OP_CASE( 0x2A ): { // ROL A
 		nz = a << 1;
 		fint16 temp = c >> 8 & 1;
 		c = nz;
 		nz |= temp;
 		a = (uint8_t) nz;
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x5E: // LSR abs,X
+	OP_CASE( 0x5E ): // LSR abs,X
 		data += x;
-	case 0x4E: // LSR abs
+	OP_CASE( 0x4E ): // LSR abs
 		c = 0;
-	case 0x6E: // ROR abs
+	OP_CASE( 0x6E ): // ROR abs
 	ror_abs: {
 		ADD_PAGE();
 		FLUSH_TIME();
@@ -654,15 +764,15 @@ imm##op:
 		goto rotate_common;
 	}
 	
-	case 0x3E: // ROL abs,X
+	OP_CASE( 0x3E ): // ROL abs,X
 		data += x;
 		goto rol_abs;
 	
-	case 0x1E: // ASL abs,X
+	OP_CASE( 0x1E ): // ASL abs,X
 		data += x;
-	case 0x0E: // ASL abs
+	OP_CASE( 0x0E ): // ASL abs
 		c = 0;
-	case 0x2E: // ROL abs
+	OP_CASE( 0x2E ): // ROL abs
 	rol_abs:
 		ADD_PAGE();
 		nz = c >> 8 & 1;
@@ -672,21 +782,21 @@ imm##op:
 		pc++;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x7E: // ROR abs,X
+	OP_CASE( 0x7E ): // ROR abs,X
 		data += x;
 		goto ror_abs;
 	
-	case 0x76: // ROR zp,x
+	OP_CASE( 0x76 ): // ROR zp,x
 		data = uint8_t (data + x);
 		goto ror_zp;
 	
-	case 0x56: // LSR zp,x
+	OP_CASE( 0x56 ): // LSR zp,x
 		data = uint8_t (data + x);
-	case 0x46: // LSR zp
+	OP_CASE( 0x46 ): // LSR zp
 		c = 0;
-	case 0x66: // ROR zp
+	OP_CASE( 0x66 ): // ROR zp
 	ror_zp: {
 		int temp = READ_LOW( data );
 		nz = (c >> 1 & 0x80) | (temp >> 1);
@@ -694,15 +804,15 @@ imm##op:
 		goto write_nz_zp;
 	}
 	
-	case 0x36: // ROL zp,x
+	OP_CASE( 0x36 ): // ROL zp,x
 		data = uint8_t (data + x);
 		goto rol_zp;
 	
-	case 0x16: // ASL zp,x
+	OP_CASE( 0x16 ): // ASL zp,x
 		data = uint8_t (data + x);
-	case 0x06: // ASL zp
+	OP_CASE( 0x06 ): // ASL zp
 		c = 0;
-	case 0x26: // ROL zp
+	OP_CASE( 0x26 ): // ROL zp
 	rol_zp:
 		nz = c >> 8 & 1;
 		nz |= (c = READ_LOW( data ) << 1);
@@ -710,44 +820,44 @@ imm##op:
 	
 // Increment/decrement
 
-	case 0xCA: // DEX
+	OP_CASE( 0xCA ): // DEX
 		INC_DEC_XY( x, -1 )
 	
-	case 0x88: // DEY
+	OP_CASE( 0x88 ): // DEY
 		INC_DEC_XY( y, -1 )
 	
-	case 0xF6: // INC zp,x
+	OP_CASE( 0xF6 ): // INC zp,x
 		data = uint8_t (data + x);
-	case 0xE6: // INC zp
+	OP_CASE( 0xE6 ): // INC zp
 		nz = 1;
 		goto add_nz_zp;
 	
-	case 0xD6: // DEC zp,x
+	OP_CASE( 0xD6 ): // DEC zp,x
 		data = uint8_t (data + x);
-	case 0xC6: // DEC zp
+	OP_CASE( 0xC6 ): // DEC zp
 		nz = (unsigned) -1;
 	add_nz_zp:
 		nz += READ_LOW( data );
 	write_nz_zp:
 		pc++;
 		WRITE_LOW( data, nz );
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xFE: // INC abs,x
+	OP_CASE( 0xFE ): // INC abs,x
 		data = x + GET_ADDR();
 		goto inc_ptr;
 	
-	case 0xEE: // INC abs
+	OP_CASE( 0xEE ): // INC abs
 		data = GET_ADDR();
 	inc_ptr:
 		nz = 1;
 		goto inc_common;
 	
-	case 0xDE: // DEC abs,x
+	OP_CASE( 0xDE ): // DEC abs,x
 		data = x + GET_ADDR();
 		goto dec_ptr;
 	
-	case 0xCE: // DEC abs
+	OP_CASE( 0xCE ): // DEC abs
 		data = GET_ADDR();
 	dec_ptr:
 		nz = (unsigned) -1;
@@ -757,40 +867,40 @@ imm##op:
 		pc += 2;
 		WRITE( data, (uint8_t) nz );
 		CACHE_TIME();
-		goto loop;
+		NEXT_INSTR();
 		
 // Transfer
 
-	case 0xAA: // TAX
+	OP_CASE( 0xAA ): // TAX
 		x  = a;
 		nz = a;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x8A: // TXA
+	OP_CASE( 0x8A ): // TXA
 		a  = x;
 		nz = x;
-		goto loop;
+		NEXT_INSTR();
 
-	case 0x9A: // TXS
+	OP_CASE( 0x9A ): // TXS
 		SET_SP( x ); // verified (no flag change)
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xBA: // TSX
+	OP_CASE( 0xBA ): // TSX
 		x = nz = GET_SP();
-		goto loop;
+		NEXT_INSTR();
 	
 // Stack
 	
-	case 0x48: // PHA
+	OP_CASE( 0x48 ): // PHA
 		PUSH( a ); // verified
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x68: // PLA
+	OP_CASE( 0x68 ): // PLA
 		a = nz = READ_LOW( sp );
 		sp = (sp - 0xFF) | 0x100;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0x40:{// RTI
+	OP_CASE( 0x40 ):{// RTI
 		fuint8 temp = READ_LOW( sp );
 		pc  = READ_LOW( 0x100 | (sp - 0xFF) );
 		pc |= READ_LOW( 0x100 | (sp - 0xFE) ) * 0x100;
@@ -807,64 +917,64 @@ imm##op:
 			s.base = new_time;
 			s_time += delta;
 		}
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x28:{// PLP
+	OP_CASE( 0x28 ):{// PLP
 		fuint8 temp = READ_LOW( sp );
 		sp = (sp - 0xFF) | 0x100;
 		fuint8 changed = status ^ temp;
 		SET_STATUS( temp );
 		if ( !(changed & st_i) )
-			goto loop; // I flag didn't change
+			NEXT_INSTR(); // I flag didn't change
 		if ( status & st_i )
 			goto handle_sei;
 		goto handle_cli;
 	}
 	
-	case 0x08: { // PHP
+	OP_CASE( 0x08 ): { // PHP
 		fuint8 temp;
 		CALC_STATUS( temp );
 		PUSH( temp | (st_b | st_r) );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x6C:{// JMP (ind)
+	OP_CASE( 0x6C ):{// JMP (ind)
 		data = GET_ADDR();
 		pc = READ_PROG( data );
 		data = (data & 0xFF00) | ((data + 1) & 0xFF);
 		pc |= 0x100 * READ_PROG( data );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x00: // BRK
+	OP_CASE( 0x00 ): // BRK
 		goto handle_brk;
 	
 // Flags
 
-	case 0x38: // SEC
+	OP_CASE( 0x38 ): // SEC
 		c = (unsigned) ~0;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x18: // CLC
+	OP_CASE( 0x18 ): // CLC
 		c = 0;
-		goto loop;
+		NEXT_INSTR();
 		
-	case 0xB8: // CLV
+	OP_CASE( 0xB8 ): // CLV
 		status &= ~st_v;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xD8: // CLD
+	OP_CASE( 0xD8 ): // CLD
 		status &= ~st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0xF8: // SED
+	OP_CASE( 0xF8 ): // SED
 		status |= st_d;
-		goto loop;
+		NEXT_INSTR();
 	
-	case 0x58: // CLI
+	OP_CASE( 0x58 ): // CLI
 		if ( !(status & st_i) )
-			goto loop;
+			NEXT_INSTR();
 		status &= ~st_i;
 	handle_cli: {
 		this->r.status = status; // update externally-visible I flag
@@ -872,13 +982,13 @@ imm##op:
 		if ( delta <= 0 )
 		{
 			if ( TIME < irq_time_ )
-				goto loop;
+				NEXT_INSTR();
 			goto delayed_cli;
 		}
 		s.base = irq_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		
 		if ( delta >= s_time + 1 )
 		{
@@ -886,16 +996,16 @@ imm##op:
 			s.base += s_time + 1;
 			s_time = -1;
 			irq_time_ = s.base; // TODO: remove, as only to satisfy debug check in loop
-			goto loop;
+			NEXT_INSTR();
 		}
 	delayed_cli:
 		dprintf( "Delayed CLI not emulated\n" );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
-	case 0x78: // SEI
+	OP_CASE( 0x78 ): // SEI
 		if ( status & st_i )
-			goto loop;
+			NEXT_INSTR();
 		status |= st_i;
 	handle_sei: {
 		this->r.status = status; // update externally-visible I flag
@@ -903,27 +1013,31 @@ imm##op:
 		s.base = end_time_;
 		s_time += delta;
 		if ( s_time < 0 )
-			goto loop;
+			NEXT_INSTR();
 		dprintf( "Delayed SEI not emulated\n" );
-		goto loop;
+		NEXT_INSTR();
 	}
 	
 // Unofficial
 	
 	// SKW - Skip word
-	case 0x1C: case 0x3C: case 0x5C: case 0x7C: case 0xDC: case 0xFC:
+	OP_CASE( 0x1C ): OP_CASE( 0x3C ): OP_CASE( 0x5C ): OP_CASE( 0x7C ): OP_CASE( 0xDC ):
+	OP_CASE( 0xFC ):
 		HANDLE_PAGE_CROSSING( data + x );
-	case 0x0C:
+	OP_CASE( 0x0C ):
 		pc++;
 	// SKB - Skip byte
-	case 0x74: case 0x04: case 0x14: case 0x34: case 0x44: case 0x54: case 0x64:
-	case 0x80: case 0x82: case 0x89: case 0xC2: case 0xD4: case 0xE2: case 0xF4:
+	OP_CASE( 0x74 ): OP_CASE( 0x04 ): OP_CASE( 0x14 ): OP_CASE( 0x34 ): OP_CASE( 0x44 ):
+	OP_CASE( 0x54 ): OP_CASE( 0x64 ):
+	OP_CASE( 0x80 ): OP_CASE( 0x82 ): OP_CASE( 0x89 ): OP_CASE( 0xC2 ): OP_CASE( 0xD4 ):
+	OP_CASE( 0xE2 ): OP_CASE( 0xF4 ):
 		pc++;
-		goto loop;
+		NEXT_INSTR();
 	
 	// NOP
-	case 0xEA: case 0x1A: case 0x3A: case 0x5A: case 0x7A: case 0xDA: case 0xFA:
-		goto loop;
+	OP_CASE( 0xEA ): OP_CASE( 0x1A ): OP_CASE( 0x3A ): OP_CASE( 0x5A ): OP_CASE( 0x7A ):
+	OP_CASE( 0xDA ): OP_CASE( 0xFA ):
+		NEXT_INSTR();
 	
 // Unimplemented
 	
@@ -931,7 +1045,7 @@ imm##op:
 	//case 0x02: case 0x12: case 0x22: case 0x32: case 0x42: case 0x52:
 	//case 0x62: case 0x72: case 0x92: case 0xB2: case 0xD2: case 0xF2:
 	
-	default:
+	OP_DEFAULT:
 		assert( (unsigned) opcode <= 0xFF );
 		illegal_encountered = true;
 		pc--;
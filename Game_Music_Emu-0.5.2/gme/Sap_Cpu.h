@@ -21,6 +21,9 @@ public:
 	// instruction was encountered at any point during run.
 	bool run( sap_time_t end_time );
 	
+	// Number of instructions run so far, if GME_STATS is set. Wraps around.
+	blargg_ulong instr_count() const    { return instr_count_; }
+	
 	// Registers are not updated until run() returns (except I flag in status)
 	struct registers_t {
 		BOOST::uint16_t pc;
@@ -45,8 +48,12 @@ public:
 	sap_time_t end_time() const         { return end_time_; }
 	void set_end_time( sap_time_t );
 	
+	// Save/load registers and timing (see blargg_copy_func_t). Must not be called
+	// during run(). Memory isn't included.
+	void copy_state( unsigned char** io, blargg_copy_func_t );
+	
 public:
-	Sap_Cpu() { state = &state_; }
+	Sap_Cpu() : instr_count_( 0 ) { state = &state_; }
 	enum { irq_inhibit = 0x04 };
 private:
 	struct state_t {
@@ -55,6 +62,7 @@ private:
 	};
 	state_t* state; // points to state_ or a local copy within run()
 	state_t state_;
+	blargg_ulong instr_count_;
 	sap_time_t irq_time_;
 	sap_time_t end_time_;
 	uint8_t* mem;
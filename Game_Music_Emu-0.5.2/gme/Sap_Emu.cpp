@@ -235,7 +235,9 @@ struct Sap_File : Gme_Info_
 static Music_Emu* new_sap_emu () { return BLARGG_NEW Sap_Emu ; }
 static Music_Emu* new_sap_file() { return BLARGG_NEW Sap_File; }
 
-gme_type_t_ const gme_sap_type [1] = { "Atari XL", 0, &new_sap_emu, &new_sap_file, "SAP", 1 };
+gme_type_t_ const gme_sap_type [1] = { "Atari XL", 0, &new_sap_emu, &new_sap_file, "SAP", 1,
+		gme_caps_fast_skip | gme_caps_multi_chip | gme_caps_float | gme_caps_find_loop |
+		gme_caps_state, 1773447 };
 
 // Setup
 
@@ -256,6 +258,7 @@ blargg_err_t Sap_Emu::load_mem_( byte const* in, long size )
 	set_track_count( info.track_count );
 	set_voice_count( Sap_Apu::osc_count << info.stereo );
 	apu_impl.volume( gain() );
+	RETURN_ERR( resize_journal( 1024 ) );
 	
 	return setup_buffer( 1773447 );
 }
@@ -328,7 +331,7 @@ blargg_err_t Sap_Emu::start_track_( int track )
 	RETURN_ERR( Classic_Emu::start_track_( track ) );
 	
 	memset( &mem, 0, sizeof mem );
-
+	
 	byte const* in = info.rom_data;
 	while ( file_end - in >= 5 )
 	{
@@ -370,12 +373,26 @@ blargg_err_t Sap_Emu::start_track_( int track )
 
 // see sap_cpu_io.h for read/write functions
 
+// POKEY can't be read, so writes are journaled and run once per frame
+void Sap_Emu::replay_journal( journal_entry_t const* in, int count )
+{
+	for ( int i = 0; i < count; i++ )
+	{
+		int addr = in [i].addr;
+		if ( (addr ^ Sap_Apu::start_addr) <= (Sap_Apu::end_addr - Sap_Apu::start_addr) )
+			apu.write_data( in [i].time, addr, in [i].data );
+		else
+			apu2.write_data( in [i].time, addr ^ 0x10, in [i].data );
+	}
+}
+
 void Sap_Emu::cpu_write_( sap_addr_t addr, int data )
 {
 	if ( (addr ^ Sap_Apu::start_addr) <= (Sap_Apu::end_addr - Sap_Apu::start_addr) )
 	{
 		GME_APU_HOOK( this, addr - Sap_Apu::start_addr, data );
-		apu.write_data( time() & time_mask, addr, data );
+		probe_apu_write( addr - Sap_Apu::start_addr, data );
+		journal_write( time() & time_mask, addr, data );
 		return;
 	}
 	
@@ -383,10 +400,11 @@ void Sap_Emu::cpu_write_( sap_addr_t addr, int data )
 			info.stereo )
 	{
 		GME_APU_HOOK( this, addr - 0x10 - Sap_Apu::start_addr + 10, data );
-		apu2.write_data( time() & time_mask, addr ^ 0x10, data );
+		probe_apu_write( addr - 0x10 - Sap_Apu::start_addr + 10, data );
+		journal_write( time() & time_mask, addr, data );
 		return;
 	}
-
+	
 	if ( (addr & ~0x0010) != 0xD20F || data != 0x03 )
 		dprintf( "Unmapped write $%04X <- $%02X\n", addr, data );
 }
@@ -405,6 +423,17 @@ inline void Sap_Emu::call_play()
 	}
 }
 
+blargg_err_t Sap_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	cpu::copy_state( io, copy );
+	BLARGG_COPY( next_play );
+	BLARGG_COPY( mem.ram );
+	apu.copy_state( io, copy );
+	apu2.copy_state( io, copy );
+	return 0;
+}
+
 blargg_err_t Sap_Emu::run_clocks( blip_time_t& duration, int )
 {
 	set_time( 0 );
@@ -421,6 +450,8 @@ blargg_err_t Sap_Emu::run_clocks( blip_time_t& duration, int )
 				next_play += play_period();
 				call_play();
 				GME_FRAME_HOOK( this );
+				if ( probing() )
+					probe_frame( time(), mem.ram, sizeof mem.ram );
 			}
 			else
 			{
@@ -434,6 +465,7 @@ blargg_err_t Sap_Emu::run_clocks( blip_time_t& duration, int )
 	check( next_play >= 0 );
 	if ( next_play < 0 )
 		next_play = 0;
+	flush_journal();
 	apu.end_frame( duration );
 	if ( info.stereo )
 		apu2.end_frame( duration );
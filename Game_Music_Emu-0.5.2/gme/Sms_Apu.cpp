@@ -20,6 +20,7 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 Sms_Osc::Sms_Osc()
 {
 	output = 0;
+	span_rendering = false;
 	outputs [0] = 0; // always stays NULL
 	outputs [1] = 0;
 	outputs [2] = 0;
@@ -31,6 +32,7 @@ void Sms_Osc::reset()
 	delay = 0;
 	last_amp = 0;
 	volume = 0;
+	span_error = 0;
 	output_select = 3;
 	output = outputs [3];
 }
@@ -46,10 +48,12 @@ inline void Sms_Square::reset()
 
 void Sms_Square::run( blip_time_t time, blip_time_t end_time )
 {
-	if ( !volume || period <= 128 )
+	if ( !output || !volume || period <= 128 || span_steps( period ) )
 	{
-		// ignore 16kHz and higher
-		if ( last_amp )
+		// ignore 16kHz and higher (span rendering also ignores anything above
+		// the Nyquist frequency, as it averages to nothing). Without output, only
+		// phase is kept.
+		if ( last_amp && output )
 		{
 			synth->offset( time, -last_amp, output );
 			last_amp = 0;
@@ -116,6 +120,7 @@ void Sms_Noise::run( blip_time_t time, blip_time_t end_time )
 	if ( shifter & 1 )
 		amp = -amp;
 	
+	if ( output )
 	{
 		int delta = amp - last_amp;
 		if ( delta )
@@ -129,30 +134,82 @@ void Sms_Noise::run( blip_time_t time, blip_time_t end_time )
 	if ( !volume )
 		time = end_time;
 	
+	int period = *this->period * 2;
+	if ( !period )
+		period = 16;
+	
+	if ( time < end_time && !output )
+	{
+		// keep calculating shifter
+		unsigned shifter = this->shifter;
+		do
+		{
+			shifter = (feedback & -(shifter & 1)) ^ (shifter >> 1);
+			time += period;
+		}
+		while ( time < end_time );
+		this->shifter = shifter;
+	}
+	
 	if ( time < end_time )
 	{
 		Blip_Buffer* const output = this->output;
 		unsigned shifter = this->shifter;
 		int delta = amp * 2;
-		int period = *this->period * 2;
-		if ( !period )
-			period = 16;
 		
-		do
+		int const steps = span_steps( period );
+		if ( steps >= 2 )
 		{
-			int changed = shifter + 1;
-			shifter = (feedback & -(shifter & 1)) ^ (shifter >> 1);
-			if ( changed & 2 ) // true if bits 0 and 1 differ
+			// output average of each sample's worth of steps rather than
+			// every transition
+			int last_amp = this->last_amp;
+			int error = span_error;
+			do
 			{
-				delta = -delta;
-				synth.offset_inline( time, delta, output );
+				// count steps with output low, without branching
+				blip_time_t const start = time;
+				int low = 0;
+				int n = 0;
+				do
+				{
+					shifter = (feedback & -(shifter & 1)) ^ (shifter >> 1);
+					low += shifter & 1;
+					time += period;
+				}
+				while ( ++n < steps && time < end_time );
+				
+				int sum = volume * (n - low * 2) + error;
+				int avg = sum / n;
+				error = sum - avg * n;
+				if ( avg != last_amp )
+				{
+					synth.offset_inline( start, avg - last_amp, output );
+					last_amp = avg;
+				}
 			}
-			time += period;
+			while ( time < end_time );
+			
+			span_error = error;
+			this->last_amp = last_amp;
+		}
+		else
+		{
+			do
+			{
+				int changed = shifter + 1;
+				shifter = (feedback & -(shifter & 1)) ^ (shifter >> 1);
+				if ( changed & 2 ) // true if bits 0 and 1 differ
+				{
+					delta = -delta;
+					synth.offset_inline( time, delta, output );
+				}
+				time += period;
+			}
+			while ( time < end_time );
+			
+			this->last_amp = delta >> 1;
 		}
-		while ( time < end_time );
-		
 		this->shifter = shifter;
-		this->last_amp = delta >> 1;
 	}
 	delay = time - end_time;
 }
@@ -183,6 +240,12 @@ void Sms_Apu::volume( double vol )
 	noise.synth.volume( vol );
 }
 
+void Sms_Apu::enable_span_rendering( bool b )
+{
+	for ( int i = 0; i < osc_count; i++ )
+		oscs [i]->span_rendering = b;
+}
+
 void Sms_Apu::treble_eq( const blip_eq_t& eq )
 {
 	square_synth.treble_eq( eq );
@@ -242,13 +305,13 @@ void Sms_Apu::run_until( blip_time_t end_time )
 		{
 			Sms_Osc& osc = *oscs [i];
 			if ( osc.output )
-			{
 				osc.output->set_modified();
-				if ( i < 3 )
-					squares [i].run( last_time, end_time );
-				else
-					noise.run( last_time, end_time );
-			}
+			
+			// run even without output, so phase is the same once output returns
+			if ( i < 3 )
+				squares [i].run( last_time, end_time );
+			else
+				noise.run( last_time, end_time );
 		}
 		
 		last_time = end_time;
@@ -264,6 +327,36 @@ void Sms_Apu::end_frame( blip_time_t end_time )
 	last_time -= end_time;
 }
 
+void Sms_Apu::copy_state( unsigned char** io, blip_copy_func_t copy )
+{
+	copy( io, &last_time, sizeof last_time );
+	copy( io, &latch, sizeof latch );
+	copy( io, &noise_feedback, sizeof noise_feedback );
+	copy( io, &looped_feedback, sizeof looped_feedback );
+	for ( int i = 0; i < osc_count; i++ )
+	{
+		Sms_Osc& osc = *oscs [i];
+		copy( io, &osc.output_select, sizeof osc.output_select );
+		copy( io, &osc.delay, sizeof osc.delay );
+		copy( io, &osc.last_amp, sizeof osc.last_amp );
+		copy( io, &osc.volume, sizeof osc.volume );
+		copy( io, &osc.span_error, sizeof osc.span_error );
+		osc.output = osc.outputs [osc.output_select];
+	}
+	for ( int i = 0; i < 3; i++ )
+	{
+		copy( io, &squares [i].period, sizeof squares [i].period );
+		copy( io, &squares [i].phase, sizeof squares [i].phase );
+	}
+	
+	// noise period is either an entry of noise_periods or the third square's period
+	int select = (noise.period == &squares [2].period ? 3 : int (noise.period - noise_periods));
+	copy( io, &select, sizeof select );
+	noise.period = (select == 3 ? &squares [2].period : &noise_periods [select & 3]);
+	copy( io, &noise.shifter, sizeof noise.shifter );
+	copy( io, &noise.feedback, sizeof noise.feedback );
+}
+
 void Sms_Apu::write_ggstereo( blip_time_t time, int data )
 {
 	require( (unsigned) data <= 0xFF );
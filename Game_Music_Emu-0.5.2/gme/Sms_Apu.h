@@ -14,6 +14,12 @@ public:
 	// Set treble equalization
 	void treble_eq( const blip_eq_t& );
 	
+	// Output noise stepping faster than the sample rate as the average of each
+	// sample, instead of a band-limited step for every transition, and silence
+	// tones above the Nyquist frequency. Reduces work for fast noise at the cost
+	// of slight aliasing. Disabled by default.
+	void enable_span_rendering( bool = true );
+	
 	// Outputs can be assigned to a single buffer for mono output, or to three
 	// buffers for stereo output (using Stereo_Buffer to do the mixing).
 	
@@ -41,6 +47,10 @@ public:
 	// Run all oscillators up to specified time, end current frame, then
 	// start a new frame at time 0.
 	void end_frame( blip_time_t );
+	
+	// Save/load exact emulation state (see blargg_copy_func_t). Must be called
+	// between time frames. Outputs and volume aren't included.
+	void copy_state( unsigned char** io, blip_copy_func_t );
 
 public:
 	Sms_Apu();
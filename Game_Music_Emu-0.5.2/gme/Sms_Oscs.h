@@ -15,9 +15,12 @@ struct Sms_Osc
 	int delay;
 	int last_amp;
 	int volume;
+	bool span_rendering;
+	int span_error; // rounding error carried from last span
 	
 	Sms_Osc();
 	void reset();
+	int span_steps( int period ) const;
 };
 
 struct Sms_Square : Sms_Osc
@@ -45,4 +48,13 @@ struct Sms_Noise : Sms_Osc
 	void run( blip_time_t, blip_time_t );
 };
 
+// Number of whole periods in one output sample, or 0 if span rendering is disabled
+inline int Sms_Osc::span_steps( int period ) const
+{
+	if ( !span_rendering )
+		return 0;
+	blip_resampled_time_t const sample = (blip_resampled_time_t) 1 << BLIP_BUFFER_ACCURACY;
+	return (int) (sample / (output->resampled_duration( period ) + 1));
+}
+
 #endif
@@ -29,10 +29,20 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 
 //// Init
 
+Snes_Spc::Snes_Spc()
+{
+	dsp_thread  = 0;
+	dsp_logging = false;
+}
+
+Snes_Spc::~Snes_Spc() { enable_threaded_dsp( false ); }
+
 blargg_err_t Snes_Spc::init()
 {
 	memset( &m, 0, sizeof m );
 	dsp.init( RAM );
+	instr_count_     = 0;
+	dsp_write_count_ = 0;
 	
 	m.tempo = tempo_unit;
 	
@@ -259,6 +269,15 @@ void Snes_Spc::clear_echo()
 }
 
 
+//// Snapshots
+
+void Snes_Spc::copy_snapshot( unsigned char** io, blargg_copy_func_t copy )
+{
+	copy( io, &m, sizeof m );
+	copy( io, &dsp, sizeof dsp );
+}
+
+
 //// Sample output
 
 void Snes_Spc::reset_buf()
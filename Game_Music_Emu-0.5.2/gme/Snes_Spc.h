@@ -70,6 +70,16 @@ public:
 	enum { gain_unit = Spc_Dsp::gain_unit };
 	void set_gain( int gain );
 	
+	// If true, runs DSP on a second thread alongside the SPC-700 while generating
+	// output. DSP register writes are logged with their times and run in order
+	// by the other thread, and DSP register reads wait for it to catch up, so
+	// output is the same, except that the DSP sees RAM as it was at the start of
+	// each play() or end_frame() call, and the SPC-700 sees the echo buffer as of
+	// the end of the previous call. This only matters for music that changes
+	// sample data while it plays. Has no effect when skipping or on machines with
+	// only one processor. Must not be called from within play() or end_frame().
+	blargg_err_t enable_threaded_dsp( bool enable = true );
+	
 // SPC music files
 
 	// Loads SPC data into emulator
@@ -87,6 +97,21 @@ public:
 	// Skips count samples. Several times faster than play() when using fast DSP.
 	blargg_err_t skip( int count );
 	
+// Snapshots (available with either DSP)
+
+	// Saves/restores complete emulation state with a state copying function (see
+	// blargg_copy_func_t). A snapshot can only be restored into the same object it
+	// was saved from, since it includes internal pointers. Output must be set again
+	// after restoring; play() and skip() do this automatically.
+	void copy_snapshot( unsigned char** io, blargg_copy_func_t );
+	
+// Statistics
+
+	// Number of SPC-700 instructions run and DSP register writes so far, if
+	// GME_STATS is set. Wrap around, and aren't affected by snapshots.
+	blargg_ulong instr_count() const        { return instr_count_; }
+	blargg_ulong dsp_write_count() const    { return dsp_write_count_; }
+	
 // State save/load (only available with accurate DSP)
 
 #if !SPC_NO_COPY_STATE_FUNCS
@@ -108,6 +133,8 @@ public:
 #endif
 
 public:
+	Snes_Spc();
+	~Snes_Spc();
 	BLARGG_DISABLE_NOTHROW
 	
 	typedef BOOST::uint16_t uint16_t;
@@ -189,6 +216,20 @@ private:
 		} ram;
 	};
 	state_t m;
+	blargg_ulong instr_count_;
+	blargg_ulong dsp_write_count_;
+	
+	// DSP on second thread
+	struct dsp_thread_t;
+	dsp_thread_t* dsp_thread; // NULL unless enabled
+	bool dsp_logging;         // DSP accesses are being logged for dsp_thread
+	void run_threaded( time_t end_time );
+	void log_dsp_write( int data, rel_time_t );
+	int  log_dsp_read( rel_time_t );
+	void make_dsp_log_space();
+	void run_dsp_log();
+	void run_thread_dsp( rel_time_t& dsp_time, rel_time_t, int offset );
+	static void dsp_thread_func( void* );
 	
 	enum { rom_addr = 0xFFC0 };
 	
@@ -273,6 +314,7 @@ inline void Snes_Spc::write_port( time_t t, int port, int data )
 
 inline void Snes_Spc::set_gain( int gain ) { dsp.set_gain( gain ); }
 
+
 inline void Snes_Spc::mute_voices( int mask ) { dsp.mute_voices( mask ); }
 	
 inline void Snes_Spc::disable_surround( bool disable ) { dsp.disable_surround( disable ); }
@@ -4,6 +4,7 @@
 
 #include "Snes_Spc.h"
 
+#include "blargg_thread.h"
 #include <string.h>
 
 /* Copyright (C) 2004-2007 Shay Green. This module is free software; you
@@ -140,9 +141,17 @@ void Snes_Spc::enable_rom( int enable )
 
 int Snes_Spc::dsp_read( rel_time_t time )
 {
-	RUN_DSP( time, reg_times [REGS [r_dspaddr] & 0x7F] );
-	
-	int result = dsp.read( REGS [r_dspaddr] & 0x7F );
+	int result;
+	if ( dsp_logging )
+	{
+		result = log_dsp_read( time );
+	}
+	else
+	{
+		RUN_DSP( time, reg_times [REGS [r_dspaddr] & 0x7F] );
+		
+		result = dsp.read( REGS [r_dspaddr] & 0x7F );
+	}
 	
 	#ifdef SPC_DSP_READ_HOOK
 		SPC_DSP_READ_HOOK( spc_time + time, (REGS [r_dspaddr] & 0x7F), result );
@@ -153,28 +162,40 @@ int Snes_Spc::dsp_read( rel_time_t time )
 
 inline void Snes_Spc::dsp_write( int data, rel_time_t time )
 {
-	RUN_DSP( time, reg_times [REGS [r_dspaddr]] )
-	#if SPC_LESS_ACCURATE
-		else if ( m.dsp_time == skipping_time )
-		{
-			int r = REGS [r_dspaddr];
-			if ( r == Spc_Dsp::r_kon )
-				m.skipped_kon |= data & ~dsp.read( Spc_Dsp::r_koff );
-			
-			if ( r == Spc_Dsp::r_koff )
+	if ( !dsp_logging )
+	{
+		RUN_DSP( time, reg_times [REGS [r_dspaddr]] )
+		#if SPC_LESS_ACCURATE
+			else if ( m.dsp_time == skipping_time )
 			{
-				m.skipped_koff |= data;
-				m.skipped_kon &= ~data;
+				int r = REGS [r_dspaddr];
+				if ( r == Spc_Dsp::r_kon )
+					m.skipped_kon |= data & ~dsp.read( Spc_Dsp::r_koff );
+				
+				if ( r == Spc_Dsp::r_koff )
+				{
+					m.skipped_koff |= data;
+					m.skipped_kon &= ~data;
+				}
 			}
-		}
-	#endif
+		#endif
+	}
 	
 	#ifdef SPC_DSP_WRITE_HOOK
 		SPC_DSP_WRITE_HOOK( m.spc_time + time, REGS [r_dspaddr], (uint8_t) data );
 	#endif
 	
+	#if GME_STATS
+		dsp_write_count_++;
+	#endif
+	
 	if ( REGS [r_dspaddr] <= 0x7F )
-		dsp.write( REGS [r_dspaddr], data );
+	{
+		if ( dsp_logging )
+			log_dsp_write( data, time );
+		else
+			dsp.write( REGS [r_dspaddr], data );
+	}
 	else if ( !SPC_MORE_ACCURACY )
 		dprintf( "SPC wrote to DSP register > $7F\n" );
 }
@@ -196,6 +217,9 @@ inline void Snes_Spc::dsp_write( int data, rel_time_t time )
 	
 	bool Snes_Spc::check_echo_access( int addr )
 	{
+		if ( dsp_logging )
+			return false; // DSP registers belong to other thread
+		
 		if ( !(dsp.read( Spc_Dsp::r_flg ) & 0x20) )
 		{
 			int start = 0x100 * dsp.read( Spc_Dsp::r_esa );
@@ -534,7 +558,9 @@ void Snes_Spc::end_frame( time_t end_time )
 {
 	// Catch CPU up to as close to end as possible. If final instruction
 	// would exceed end, does NOT execute it and leaves m.spc_time < end.
-	if ( end_time > m.spc_time )
+	if ( dsp_thread && m.buf_begin )
+		run_threaded( end_time ); // also catches DSP up to CPU
+	else if ( end_time > m.spc_time )
 		run_until_( end_time );
 	
 	m.spc_time     -= end_time;
@@ -560,5 +586,294 @@ void Snes_Spc::end_frame( time_t end_time )
 		save_extra();
 }
 
+//// DSP on second thread
+
+// DSP accesses logged by SPC-700 for the DSP thread to run
+struct Snes_Spc::dsp_thread_t
+{
+	uint8_t ram [0x10000 + 0x400]; // copy of RAM for DSP; sample directory can extend past end
+	
+	enum { log_size = 1024 }; // must be a power of 2
+	enum { read_flag = 0x100 };
+	struct entry_t
+	{
+		rel_time_t time; // from beginning of frame
+		int reg;         // DSP register, plus read_flag if read
+		int data;
+	};
+	entry_t log [log_size];
+	
+	// used by SPC-700 only
+	int head;           // number of entries logged this frame
+	int space_end;      // head can reach this without waiting for DSP thread
+	
+	// guarded by mutex
+	int published;      // DSP thread can run entries up to this
+	int consumed;       // DSP thread has run entries up to this
+	int publish_count;
+	rel_time_t safe_time; // DSP can run up to SPC-700 accesses at this time
+	bool ending;        // nothing more will be published this frame
+	enum { idle, busy, quit };
+	int state;
+	
+	// used by DSP thread while busy
+	rel_time_t dsp_time; // from beginning of frame
+	int read_result;
+	
+	blargg_mutex mutex;
+	blargg_cond cond;
+	blargg_thread thread;
+};
+
+// SPC-700 publishes log at least this often, so DSP can keep up
+int const thread_slice = 64 * Snes_Spc::clocks_per_sample;
+
+#if SPC_LESS_ACCURATE
+	#define THREAD_REG_TIME( reg ) reg_times [reg]
+	int const thread_lag = max_reg_time;
+#else
+	#define THREAD_REG_TIME( reg ) 0
+	int const thread_lag = 0;
+#endif
+
+blargg_err_t Snes_Spc::enable_threaded_dsp( bool enable )
+{
+	if ( !enable )
+	{
+		if ( dsp_thread )
+		{
+			dsp_thread->mutex.lock();
+			dsp_thread->state = dsp_thread_t::quit;
+			dsp_thread->cond.broadcast();
+			dsp_thread->mutex.unlock();
+			dsp_thread->thread.join();
+			delete dsp_thread;
+			dsp_thread = 0;
+		}
+		return 0;
+	}
+	
+	if ( dsp_thread || blargg_thread::cpu_count() < 2 )
+		return 0;
+	
+	dsp_thread_t* t = BLARGG_NEW dsp_thread_t;
+	CHECK_ALLOC( t );
+	memset( &t->ram [0x10000], cpu_pad_fill, sizeof t->ram - 0x10000 );
+	t->state = dsp_thread_t::idle;
+	
+	dsp_thread = t;
+	blargg_err_t err = t->thread.start( dsp_thread_func, this );
+	if ( err )
+	{
+		dsp_thread = 0;
+		delete t;
+	}
+	return err;
+}
+
+void Snes_Spc::dsp_thread_func( void* spc ) { STATIC_CAST(Snes_Spc*,spc)->run_dsp_log(); }
+
+// Runs DSP as RUN_DSP() would for an access at given time, using DSP thread's time
+void Snes_Spc::run_thread_dsp( rel_time_t& dsp_time, rel_time_t time, int offset )
+{
+	#if SPC_LESS_ACCURATE
+		int count = time - offset - dsp_time;
+		if ( count >= 0 )
+		{
+			int clock_count = (count & ~(clocks_per_sample - 1)) + clocks_per_sample;
+			dsp_time += clock_count;
+			dsp.run( clock_count );
+		}
+	#else
+		(void) offset;
+		int count = time - dsp_time;
+		if ( count > 0 )
+		{
+			dsp_time = time;
+			dsp.run( count );
+		}
+	#endif
+}
+
+// DSP thread: runs each frame's log as it's published. Running DSP up to safe_time
+// between accesses ends it at the same sample any later access would have.
+void Snes_Spc::run_dsp_log()
+{
+	dsp_thread_t& t = *dsp_thread;
+	int seen = 0;
+	t.mutex.lock();
+	while ( t.state != dsp_thread_t::quit )
+	{
+		if ( t.state == dsp_thread_t::idle || t.publish_count == seen )
+		{
+			t.cond.wait( t.mutex );
+			continue;
+		}
+		
+		seen = t.publish_count;
+		int const begin = t.consumed;
+		int const end   = t.published;
+		rel_time_t const safe_time = t.safe_time;
+		bool const ending = t.ending;
+		t.mutex.unlock();
+		
+		for ( int i = begin; i != end; i++ )
+		{
+			dsp_thread_t::entry_t const& e = t.log [i & (dsp_thread_t::log_size - 1)];
+			if ( e.reg & dsp_thread_t::read_flag )
+			{
+				int reg = e.reg & 0x7F;
+				run_thread_dsp( t.dsp_time, e.time, THREAD_REG_TIME( reg ) );
+				t.read_result = dsp.read( reg );
+			}
+			else
+			{
+				run_thread_dsp( t.dsp_time, e.time, THREAD_REG_TIME( e.reg ) );
+				dsp.write( e.reg, e.data );
+			}
+		}
+		run_thread_dsp( t.dsp_time, safe_time, thread_lag );
+		
+		t.mutex.lock();
+		t.consumed = end;
+		if ( ending )
+		{
+			t.state = dsp_thread_t::idle;
+			seen = 0;
+		}
+		t.cond.broadcast();
+	}
+	t.mutex.unlock();
+}
+
+void Snes_Spc::make_dsp_log_space()
+{
+	dsp_thread_t& t = *dsp_thread;
+	t.mutex.lock();
+	t.published = t.head;
+	t.publish_count++;
+	t.cond.broadcast();
+	while ( t.head - t.consumed >= dsp_thread_t::log_size )
+		t.cond.wait( t.mutex );
+	t.space_end = t.consumed + dsp_thread_t::log_size;
+	t.mutex.unlock();
+}
+
+void Snes_Spc::log_dsp_write( int data, rel_time_t time )
+{
+	dsp_thread_t& t = *dsp_thread;
+	if ( t.head == t.space_end )
+		make_dsp_log_space();
+	
+	dsp_thread_t::entry_t& e = t.log [t.head & (dsp_thread_t::log_size - 1)];
+	e.time = m.spc_time + time;
+	e.reg  = REGS [r_dspaddr];
+	e.data = data;
+	t.head++;
+}
+
+int Snes_Spc::log_dsp_read( rel_time_t time )
+{
+	dsp_thread_t& t = *dsp_thread;
+	if ( t.head == t.space_end )
+		make_dsp_log_space();
+	
+	dsp_thread_t::entry_t& e = t.log [t.head & (dsp_thread_t::log_size - 1)];
+	e.time = m.spc_time + time;
+	e.reg  = (REGS [r_dspaddr] & 0x7F) | dsp_thread_t::read_flag;
+	e.data = 0;
+	t.head++;
+	
+	// wait for DSP thread to catch up and do the read
+	t.mutex.lock();
+	t.published = t.head;
+	t.publish_count++;
+	t.cond.broadcast();
+	while ( t.consumed != t.head )
+		t.cond.wait( t.mutex );
+	t.space_end = t.consumed + dsp_thread_t::log_size;
+	int result = t.read_result;
+	t.mutex.unlock();
+	
+	return result;
+}
+
+// Copies echo buffer that DSP writes with given register values
+static void copy_echo( BOOST::uint8_t* out, BOOST::uint8_t const* in, int flg, int esa, int edl )
+{
+	if ( !(flg & 0x20) )
+	{
+		int addr = 0x100 * esa;
+		int size = 0x800 * (edl & 0x0F);
+		if ( !size )
+			size = 4;
+		int first = 0x10000 - addr;
+		if ( first > size )
+			first = size;
+		memcpy( &out [addr], &in [addr], first );
+		memcpy( out, in, size - first ); // wraps around
+	}
+}
+
+// Runs SPC-700 to end_time while DSP thread runs the DSP up to the same point
+void Snes_Spc::run_threaded( time_t end_time )
+{
+	dsp_thread_t& t = *dsp_thread;
+	
+	// SPC-700 changes RAM while DSP runs, so DSP gets its own copy
+	memcpy( t.ram, RAM, 0x10000 );
+	dsp.set_ram( t.ram );
+	int const old_flg = dsp.read( Spc_Dsp::r_flg );
+	int const old_esa = dsp.read( Spc_Dsp::r_esa );
+	int const old_edl = dsp.read( Spc_Dsp::r_edl );
+	
+	t.head      = 0;
+	t.space_end = dsp_thread_t::log_size;
+	t.mutex.lock();
+	t.published     = 0;
+	t.consumed      = 0;
+	t.publish_count = 0;
+	t.safe_time     = m.spc_time;
+	t.ending        = false;
+	t.dsp_time      = m.spc_time + m.dsp_time;
+	t.state         = dsp_thread_t::busy;
+	t.mutex.unlock();
+	dsp_logging = true;
+	
+	for ( time_t slice_end = m.spc_time; slice_end < end_time; )
+	{
+		slice_end += thread_slice;
+		if ( slice_end > end_time )
+			slice_end = end_time;
+		if ( slice_end > m.spc_time )
+			run_until_( slice_end );
+		
+		t.mutex.lock();
+		t.published = t.head;
+		t.safe_time = m.spc_time;
+		t.publish_count++;
+		t.cond.broadcast();
+		t.space_end = t.consumed + dsp_thread_t::log_size;
+		t.mutex.unlock();
+	}
+	
+	t.mutex.lock();
+	t.ending = true;
+	t.publish_count++;
+	t.cond.broadcast();
+	while ( t.state == dsp_thread_t::busy )
+		t.cond.wait( t.mutex );
+	t.mutex.unlock();
+	dsp_logging = false;
+	
+	m.dsp_time = t.dsp_time - m.spc_time;
+	dsp.set_ram( RAM );
+	
+	// give SPC-700 the echo DSP wrote
+	copy_echo( RAM, t.ram, old_flg, old_esa, old_edl );
+	copy_echo( RAM, t.ram, dsp.read( Spc_Dsp::r_flg ), dsp.read( Spc_Dsp::r_esa ),
+			dsp.read( Spc_Dsp::r_edl ) );
+}
+
 // Inclusion here allows static memory access functions and better optimization
 #include "Spc_Cpu.h"
@@ -191,6 +191,10 @@ loop:
 	unsigned opcode;
 	unsigned data;
 	
+	#if GME_STATS
+		instr_count_++;
+	#endif
+	
 	check( (unsigned) a < 0x100 );
 	check( (unsigned) x < 0x100 );
 	check( (unsigned) y < 0x100 );
@@ -224,6 +224,7 @@ void Spc_Dsp::run( int clock_count )
 		}
 		
 		// Voices
+		int const kon = (m.every_other_sample ? m.kon : 0);
 		int pmon_input = 0;
 		int main_out_l = 0;
 		int main_out_r = 0;
@@ -236,6 +237,19 @@ void Spc_Dsp::run( int clock_count )
 		{
 			#define SAMPLE_PTR(i) GET_LE16A( &dir [VREG(v_regs,srcn) * 4 + i * 2] )
 			
+			// Released voice that has gone silent and isn't being keyed on only
+			// clears its output registers, so skip the rest (common)
+			if ( !(v->env | v->kon_delay | (kon & vbit)) && v->env_mode == env_release )
+			{
+				VREG(v_regs,envx) = 0;
+				VREG(v_regs,outx) = 0;
+				pmon_input = 0;
+				vbit <<= 1;
+				v_regs += 0x10;
+				v++;
+				continue;
+			}
+			
 			int brr_header = ram [v->brr_addr];
 			int kon_delay = v->kon_delay;
 			
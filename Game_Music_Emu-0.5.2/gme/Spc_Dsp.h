@@ -14,6 +14,9 @@ public:
 	
 	// Initializes DSP and has it use the 64K RAM provided
 	void init( void* ram_64k );
+	
+	// Has DSP use different 64K RAM, without resetting anything
+	void set_ram( void* ram_64k );
 
 	// Sets destination for output samples. If out is NULL or out_size is 0,
 	// doesn't generate any.
@@ -204,6 +207,8 @@ inline void Spc_Dsp::write( int addr, int data )
 	}
 }
 
+inline void Spc_Dsp::set_ram( void* ram_64k ) { m.ram = (uint8_t*) ram_64k; }
+
 inline void Spc_Dsp::set_gain( int gain ) { m.gain = gain; }
 
 inline void Spc_Dsp::disable_surround( bool disable )
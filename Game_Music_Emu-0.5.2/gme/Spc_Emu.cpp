@@ -22,6 +22,9 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 Spc_Emu::Spc_Emu()
 {
 	set_type( gme_spc_type );
+	resampler.set_width( 24 );
+	last_instr_count = 0;
+	last_write_count = 0;
 	
 	static const char* const names [Snes_Spc::voice_count] = {
 		"DSP 1", "DSP 2", "DSP 3", "DSP 4", "DSP 5", "DSP 6", "DSP 7", "DSP 8"
@@ -241,7 +244,8 @@ struct Spc_File : Gme_Info_
 static Music_Emu* new_spc_emu () { return BLARGG_NEW Spc_Emu ; }
 static Music_Emu* new_spc_file() { return BLARGG_NEW Spc_File; }
 
-gme_type_t_ const gme_spc_type [1] = { "Super Nintendo", 1, &new_spc_emu, &new_spc_file, "SPC", 0 };
+gme_type_t_ const gme_spc_type [1] = { "Super Nintendo", 1, &new_spc_emu, &new_spc_file, "SPC", 0,
+		gme_caps_fast_skip | gme_caps_state, Snes_Spc::clock_rate };
 
 // Setup
 
@@ -251,12 +255,31 @@ blargg_err_t Spc_Emu::set_sample_rate_( long sample_rate )
 	apu.set_gain( (int) (gain() * Snes_Spc::gain_unit) );
 	if ( sample_rate != native_sample_rate )
 	{
-		RETURN_ERR( resampler.buffer_size( native_sample_rate / 20 * 2 ) );
+		RETURN_ERR( resampler.buffer_size( resampler_size() ) );
 		resampler.time_ratio( (double) native_sample_rate / sample_rate, 0.9965 );
 	}
 	return 0;
 }
 
+// Input already in resampler is kept, except when changing to native rate
+blargg_err_t Spc_Emu::change_sample_rate_( long rate )
+{
+	if ( rate == native_sample_rate )
+	{
+		resampler.clear();
+	}
+	else if ( sample_rate() == native_sample_rate )
+	{
+		RETURN_ERR( resampler.buffer_size( resampler_size() ) );
+		resampler.time_ratio( (double) native_sample_rate / rate, 0.9965 );
+	}
+	else
+	{
+		resampler.change_ratio( (double) native_sample_rate / rate );
+	}
+	return 0;
+}
+
 void Spc_Emu::mute_voices_( int m )
 {
 	Music_Emu::mute_voices_( m );
@@ -298,7 +321,13 @@ blargg_err_t Spc_Emu::skip_( long count )
 	// TODO: shouldn't skip be adjusted for the 64 samples read afterwards?
 	
 	if ( count > 0 )
+	{
+		stats_timer_t timer( stats().emulate_msec );
 		RETURN_ERR( apu.skip( count ) );
+	}
+	#if GME_STATS
+		update_stats();
+	#endif
 	
 	// eliminate pop due to resampler
 	const int resampler_latency = 64;
@@ -306,20 +335,61 @@ blargg_err_t Spc_Emu::skip_( long count )
 	return play_( resampler_latency, buf );
 }
 
+blargg_err_t Spc_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	apu.copy_snapshot( io, copy );
+	resampler.copy_state( io, copy );
+	return 0;
+}
+
+// Adds counts since last call, so counters in apu can wrap around
+void Spc_Emu::update_stats()
+{
+	blargg_ulong instr_count = apu.instr_count();
+	stats().cpu_instructions += (blargg_ulong) (instr_count - last_instr_count);
+	last_instr_count = instr_count;
+	
+	blargg_ulong write_count = apu.dsp_write_count();
+	stats().apu_writes += (blargg_ulong) (write_count - last_write_count);
+	last_write_count = write_count;
+}
+
 blargg_err_t Spc_Emu::play_( long count, sample_t* out )
 {
 	if ( sample_rate() == native_sample_rate )
-		return apu.play( count, out );
+	{
+		{
+			stats_timer_t timer( stats().emulate_msec );
+			RETURN_ERR( apu.play( count, out ) );
+		}
+		#if GME_STATS
+			update_stats();
+		#endif
+		return 0;
+	}
 	
 	long remain = count;
 	while ( remain > 0 )
 	{
-		remain -= resampler.read( &out [count - remain], remain );
+		{
+			stats_timer_t timer( stats().mix_msec );
+			long n = resampler.read( &out [count - remain], remain );
+			remain -= n;
+			#if GME_STATS
+				stats().resampled_frames += n >> 1;
+			#endif
+		}
 		if ( remain > 0 )
 		{
 			long n = resampler.max_write();
-			RETURN_ERR( apu.play( n, resampler.buffer() ) );
+			{
+				stats_timer_t timer( stats().emulate_msec );
+				RETURN_ERR( apu.play( n, resampler.buffer() ) );
+			}
 			resampler.write( n );
+			#if GME_STATS
+				update_stats();
+			#endif
 		}
 	}
 	check( remain == 0 );
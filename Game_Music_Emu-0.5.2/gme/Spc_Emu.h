@@ -43,6 +43,10 @@ public:
 	// Prevents channels and global volumes from being phase-negated
 	void disable_surround( bool disable = true );
 	
+	// Runs DSP on a second thread while playing. Output only differs for music
+	// that changes sample data while it plays (see Snes_Spc.h).
+	blargg_err_t enable_threaded_dsp( bool enable = true );
+	
 	static gme_type_t static_type() { return gme_spc_type; }
 	
 public:
@@ -60,18 +64,27 @@ protected:
 	blargg_err_t load_mem_( byte const*, long );
 	blargg_err_t track_info_( track_info_t*, int track ) const;
 	blargg_err_t set_sample_rate_( long );
+	blargg_err_t change_sample_rate_( long );
 	blargg_err_t start_track_( int );
 	blargg_err_t play_( long, sample_t* );
 	blargg_err_t skip_( long );
 	void mute_voices_( int );
 	void set_tempo_( double );
+	void set_resampler_width_( int n ) { resampler.set_width( n ); }
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
 private:
 	byte const* file_data;
 	long        file_size;
-	Fir_Resampler<24> resampler;
+	Fir_Resampler<32> resampler;
+	long resampler_size() const { return native_sample_rate * 2 / (minimal_buffers() ? 60 : 20); }
 	Snes_Spc apu;
+	blargg_ulong last_instr_count; // counts when statistics were last updated
+	blargg_ulong last_write_count;
+	void update_stats();
 };
 
 inline void Spc_Emu::disable_surround( bool b ) { apu.disable_surround( b ); }
 
+inline blargg_err_t Spc_Emu::enable_threaded_dsp( bool b ) { return apu.enable_threaded_dsp( b ); }
+
 #endif
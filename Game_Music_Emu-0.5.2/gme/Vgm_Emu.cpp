@@ -22,10 +22,13 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 double const fm_gain = 3.0; // FM emulators are internally quieter to avoid 16-bit overflow
 double const rolloff = 0.990;
 double const oversample_factor = 1.5;
+long const stream_buf_size = 16 * 1024L;
 
 Vgm_Emu::Vgm_Emu()
 {
 	disable_oversampling_ = false;
+	streaming_ = false;
+	stream     = 0;
 	psg_rate   = 0;
 	set_type( gme_vgm_type );
 	
@@ -109,7 +112,14 @@ byte const* Vgm_Emu::gd3_data( int* size ) const
 		return 0;
 	
 	byte const* gd3 = data + header_size + gd3_offset;
-	long gd3_size = check_gd3_header( gd3, data_end - gd3 );
+	byte const* end = data_end;
+	if ( stream )
+	{
+		gd3 = data + header_size;
+		end = stream_info.end();
+	}
+	
+	long gd3_size = check_gd3_header( gd3, end - gd3 );
 	if ( !gd3_size )
 		return 0;
 	
@@ -203,8 +213,10 @@ struct Vgm_File : Gme_Info_
 static Music_Emu* new_vgm_emu () { return BLARGG_NEW Vgm_Emu ; }
 static Music_Emu* new_vgm_file() { return BLARGG_NEW Vgm_File; }
 
-gme_type_t_ const gme_vgm_type [1] = { "Sega SMS/Genesis", 1, &new_vgm_emu, &new_vgm_file, "VGM", 1 };
-gme_type_t_ const gme_vgz_type [1] = { "Sega SMS/Genesis", 1, &new_vgm_emu, &new_vgm_file, "VGZ", 1 };
+gme_type_t_ const gme_vgm_type [1] = { "Sega SMS/Genesis", 1, &new_vgm_emu, &new_vgm_file, "VGM", 1,
+		gme_caps_fast_skip | gme_caps_multi_chip | gme_caps_state, 3579545 };
+gme_type_t_ const gme_vgz_type [1] = { "Sega SMS/Genesis", 1, &new_vgm_emu, &new_vgm_file, "VGZ", 1,
+		gme_caps_fast_skip | gme_caps_multi_chip | gme_caps_state, 3579545 };
 
 // Setup
 
@@ -226,10 +238,36 @@ void Vgm_Emu::set_tempo_( double t )
 
 blargg_err_t Vgm_Emu::set_sample_rate_( long sample_rate )
 {
-	RETURN_ERR( blip_buf.set_sample_rate( sample_rate, 1000 / 30 ) );
+	RETURN_ERR( blip_buf.set_sample_rate( sample_rate,
+			minimal_buffers() ? minimal_buffer_length : 1000 / 30 ) );
 	return Classic_Emu::set_sample_rate_( sample_rate );
 }
 
+// FM runs at a fixed multiple of the output rate unless oversampling is
+// disabled, in which case the resampling ratio changes instead
+blargg_err_t Vgm_Emu::change_sample_rate_( long rate )
+{
+	RETURN_ERR( blip_buf.change_sample_rate( rate ) );
+	RETURN_ERR( Classic_Emu::change_sample_rate_( rate ) );
+	if ( uses_fm )
+	{
+		if ( ym2413.enabled() )
+			return "Can't change sample rate with YM2413 FM sound";
+		
+		double const old_fm_rate = fm_rate;
+		if ( !disable_oversampling_ )
+		{
+			fm_rate = rate * oversample_factor;
+			RETURN_ERR( ym2612.change_rate( fm_rate ) );
+		}
+		int pairs = blip_buf.length() * rate / 1000;
+		RETURN_ERR( Dual_Resampler::change_rate( pairs, pairs, fm_rate / rate ) );
+		fm_time_offset = (long) (fm_time_offset * (fm_rate / old_fm_rate));
+		set_tempo_( tempo() );
+	}
+	return 0;
+}
+
 void Vgm_Emu::update_eq( blip_eq_t const& eq )
 {
 	psg.treble_eq( eq );
@@ -274,26 +312,87 @@ blargg_err_t Vgm_Emu::load_mem_( byte const* new_data, long new_size )
 	if ( new_size <= header_size )
 		return gme_wrong_file_type;
 	
-	header_t const& h = *(header_t const*) new_data;
+	data       = new_data;
+	data_end   = new_data + new_size;
+	refill_pos = data_end;
+	stream     = 0;
 	
-	RETURN_ERR( check_vgm_header( h ) );
+	// get loop
+	loop_begin = data_end;
+	if ( get_le32( header().loop_offset ) )
+		loop_begin = &data [get_le32( header().loop_offset ) + offsetof (header_t,loop_offset)];
 	
-	check( get_le32( h.version ) <= 0x150 );
+	return setup_header();
+}
+
+blargg_err_t Vgm_Emu::load_file_( const char* path )
+{
+	if ( !streaming_ )
+		return Vgm_Emu_Impl::load_file_( path );
+	
+	RETURN_ERR( stream_file.open( path ) );
+	long file_size = stream_file.remain();
+	if ( file_size <= header_size )
+		return gme_wrong_file_type;
+	
+	RETURN_ERR( stream_info.resize( header_size ) );
+	RETURN_ERR( stream_file.read( stream_info.begin(), header_size ) );
+	data = stream_info.begin();
+	RETURN_ERR( check_vgm_header( header() ) );
+	
+	// keep GD3 tag after header
+	long gd3_offset = get_le32( header().gd3_offset ) - 0x2C;
+	long gd3_remain = file_size - header_size - gd3_offset;
+	if ( gd3_offset >= 0 && gd3_remain >= gd3_header_size )
+	{
+		byte gd3_h [gd3_header_size];
+		RETURN_ERR( stream_file.seek( header_size + gd3_offset ) );
+		RETURN_ERR( stream_file.read( gd3_h, sizeof gd3_h ) );
+		long gd3_size = check_gd3_header( gd3_h, gd3_remain );
+		if ( gd3_size )
+		{
+			RETURN_ERR( stream_info.resize( header_size + gd3_header_size + gd3_size ) );
+			data = stream_info.begin();
+			byte* out = stream_info.begin() + header_size;
+			memcpy( out, gd3_h, gd3_header_size );
+			RETURN_ERR( stream_file.read( out + gd3_header_size, gd3_size ) );
+		}
+	}
+	
+	stream_loop = 0;
+	if ( get_le32( header().loop_offset ) )
+		stream_loop = get_le32( header().loop_offset ) + offsetof (header_t,loop_offset);
+	
+	if ( !stream_buf.size() )
+		RETURN_ERR( stream_buf.resize( stream_buf_size ) );
+	
+	// first commands are needed by setup_fm()
+	stream = &stream_file;
+	seek_stream( commands_offset() );
+	
+	return setup_header();
+}
+
+void Vgm_Emu::unload()
+{
+	stream = 0;
+	stream_file.close();
+	Vgm_Emu_Impl::unload();
+}
+
+// Sets up emulator for header() once data is loaded
+blargg_err_t Vgm_Emu::setup_header()
+{
+	RETURN_ERR( check_vgm_header( header() ) );
+	
+	check( get_le32( header().version ) <= 0x150 );
 	
 	// psg rate
-	psg_rate = get_le32( h.psg_rate );
+	psg_rate = get_le32( header().psg_rate );
 	if ( !psg_rate )
 		psg_rate = 3579545;
 	blip_buf.clock_rate( psg_rate );
 	
-	data     = new_data;
-	data_end = new_data + new_size;
-	
-	// get loop
-	loop_begin = data_end;
-	if ( get_le32( h.loop_offset ) )
-		loop_begin = &data [get_le32( h.loop_offset ) + offsetof (header_t,loop_offset)];
-	
 	set_voice_count( psg.osc_count );
 	
 	RETURN_ERR( setup_fm() );
@@ -313,7 +412,8 @@ blargg_err_t Vgm_Emu::setup_fm()
 	long ym2612_rate = get_le32( header().ym2612_rate );
 	long ym2413_rate = get_le32( header().ym2413_rate );
 	if ( ym2413_rate && get_le32( header().version ) < 0x110 )
-		update_fm_rates( &ym2413_rate, &ym2612_rate );
+		update_fm_rates( stream ? stream_buf.begin() : data + header_size,
+				&ym2413_rate, &ym2612_rate );
 	
 	uses_fm = false;
 	
@@ -361,6 +461,20 @@ blargg_err_t Vgm_Emu::setup_fm()
 
 // Emulation
 
+// File offset of first command
+long Vgm_Emu::commands_offset() const
+{
+	long offset = header_size;
+	if ( get_le32( header().version ) >= 0x150 )
+	{
+		long data_offset = get_le32( header().data_offset );
+		check( data_offset );
+		if ( data_offset )
+			offset += data_offset + offsetof (header_t,data_offset) - 0x40;
+	}
+	return offset;
+}
+
 blargg_err_t Vgm_Emu::start_track_( int track )
 {
 	RETURN_ERR( Classic_Emu::start_track_( track ) );
@@ -372,12 +486,16 @@ blargg_err_t Vgm_Emu::start_track_( int track )
 	pcm_pos      = pos;
 	dac_amp      = -1;
 	vgm_time     = 0;
-	if ( get_le32( header().version ) >= 0x150 )
+	if ( stream )
 	{
-		long data_offset = get_le32( header().data_offset );
-		check( data_offset );
-		if ( data_offset )
-			pos += data_offset + offsetof (header_t,data_offset) - 0x40;
+		pos = seek_stream( commands_offset() );
+		if ( stream_pcm.size() )
+			pcm_data = stream_pcm.begin();
+		pcm_pos = pcm_data;
+	}
+	else
+	{
+		pos = data + commands_offset();
 	}
 	
 	if ( uses_fm )
@@ -402,11 +520,108 @@ blargg_err_t Vgm_Emu::run_clocks( blip_time_t& time_io, int msec )
 	return 0;
 }
 
+// Pointers into the commands are kept as offsets, since streamed commands move
+// within stream_buf and a streamed PCM data block can be reallocated. Only the
+// last PCM block read from a stream is kept, so restoring to before a later one
+// is read plays the later one's samples.
+blargg_err_t Vgm_Emu::copy_state_( unsigned char** io, blargg_copy_func_t copy )
+{
+	RETURN_ERR( Classic_Emu::copy_state_( io, copy ) );
+	BLARGG_COPY( vgm_time );
+	BLARGG_COPY( dac_amp );
+	BLARGG_COPY( dac_disabled );
+	dac_synth.copy_state( io, copy );
+	psg.copy_state( io, copy );
+	
+	byte const* const base = (stream ? stream_buf.begin() : data);
+	long pos_offset = pos - base;
+	BLARGG_COPY( pos_offset );
+	pos = base + pos_offset;
+	
+	bool pcm_streamed = (stream && stream_pcm.size() && pcm_data == stream_pcm.begin());
+	byte const* pcm_base = (pcm_streamed ? stream_pcm.begin() : data);
+	long pcm_data_offset = pcm_data - pcm_base;
+	long pcm_pos_offset  = pcm_pos  - pcm_base;
+	BLARGG_COPY( pcm_streamed );
+	BLARGG_COPY( pcm_data_offset );
+	BLARGG_COPY( pcm_pos_offset );
+	pcm_base = (pcm_streamed ? stream_pcm.begin() : data);
+	pcm_data = pcm_base + pcm_data_offset;
+	pcm_pos  = pcm_base + pcm_pos_offset;
+	
+	if ( stream )
+	{
+		long data_end_offset   = data_end   - base;
+		long refill_pos_offset = refill_pos - base;
+		long file_pos          = stream->tell();
+		BLARGG_COPY( data_end_offset );
+		BLARGG_COPY( refill_pos_offset );
+		BLARGG_COPY( file_pos );
+		copy( io, stream_buf.begin(), stream_buf.size() );
+		data_end   = base + data_end_offset;
+		refill_pos = base + refill_pos_offset;
+		if ( loading_state() )
+			RETURN_ERR( stream->seek( file_pos ) );
+	}
+	
+	if ( uses_fm )
+	{
+		BLARGG_COPY( fm_time_offset );
+		if ( ym2612.enabled() )
+			ym2612.copy_state( io, copy );
+		if ( ym2413.enabled() )
+			ym2413.copy_state( io, copy );
+		blip_buf.copy_state( io, copy );
+		Dual_Resampler::copy_state( io, copy );
+	}
+	return 0;
+}
+
 blargg_err_t Vgm_Emu::play_( long count, sample_t* out )
 {
 	if ( !uses_fm )
 		return Classic_Emu::play_( count, out );
 		
-	Dual_Resampler::dual_play( count, out, blip_buf );
+	#if GME_STATS
+		double emulate_msec = stats().emulate_msec;
+		blip_ulong synth_count = blip_buf.synth_count();
+	#endif
+	{
+		stats_timer_t timer( stats().mix_msec );
+		Dual_Resampler::dual_play( count, out, blip_buf );
+	}
+	#if GME_STATS
+		// play_frame() times emulation separately
+		stats().mix_msec -= stats().emulate_msec - emulate_msec;
+		stats().synth_updates += (blip_ulong) (blip_buf.synth_count() - synth_count);
+		stats().resampled_frames += count >> 1;
+	#endif
 	return 0;
 }
+
+blargg_err_t Vgm_Emu::play_float_( long count, float* out )
+{
+	// FM sound is resampled as 16-bit samples
+	if ( !uses_fm )
+		return Classic_Emu::play_float_( count, out );
+	
+	return Music_Emu::play_float_( count, out );
+}
+
+blargg_err_t Vgm_Emu::play_multitrack_( long count, sample_t* const* out, long offset )
+{
+	// FM sound is mixed before it reaches Classic_Emu's buffer
+	if ( !uses_fm )
+		return Classic_Emu::play_multitrack_( count, out, offset );
+	
+	return Music_Emu::play_multitrack_( count, out, offset );
+}
+
+blargg_err_t Vgm_Emu::skip_( long count )
+{
+	// FM sound goes through resampler rather than Classic_Emu's buffer
+	if ( !uses_fm )
+		return Classic_Emu::skip_( count );
+	
+	return Music_Emu::skip_( count );
+}
@@ -21,6 +21,15 @@ public:
 	// more aliasing of high notes.
 	void disable_oversampling( bool disable = true ) { disable_oversampling_ = disable; }
 	
+	// Read commands from file in small pieces as they're played, rather than
+	// loading whole file into memory. Takes effect at next load_file(); other ways
+	// of loading are unaffected. PCM data blocks are still kept in memory.
+	void set_streaming( bool enable = true ) { streaming_ = enable; }
+	
+	// Use faster YM2612 core, which gives the same output. See
+	// Ym2612_Emu::enable_fast().
+	void enable_fast_fm( bool enable = true ) { ym2612.enable_fast( enable ); }
+	
 	// VGM header format
 	enum { header_size = 0x40 };
 	struct header_t
@@ -62,11 +71,19 @@ public:
 protected:
 	blargg_err_t track_info_( track_info_t*, int track ) const;
 	blargg_err_t load_mem_( byte const*, long );
+	blargg_err_t load_file_( const char* );
+	void unload();
 	blargg_err_t set_sample_rate_( long sample_rate );
+	blargg_err_t change_sample_rate_( long sample_rate );
 	blargg_err_t start_track_( int );
 	blargg_err_t play_( long count, sample_t* );
+	blargg_err_t play_float_( long count, float* );
+	blargg_err_t skip_( long count );
+	blargg_err_t play_multitrack_( long count, sample_t* const*, long offset );
 	blargg_err_t run_clocks( blip_time_t&, int );
+	blargg_err_t copy_state_( unsigned char**, blargg_copy_func_t );
 	void set_tempo_( double );
+	void set_resampler_width_( int n ) { Dual_Resampler::set_width( n ); }
 	void mute_voices_( int mask );
 	void set_voice( int, Blip_Buffer*, Blip_Buffer*, Blip_Buffer* );
 	void update_eq( blip_eq_t const& );
@@ -77,8 +94,13 @@ private:
 	long psg_rate;
 	long vgm_rate;
 	bool disable_oversampling_;
+	bool streaming_;
 	bool uses_fm;
+	GME_FILE_READER stream_file;
+	blargg_vector<byte> stream_info; // header followed by GD3 tag
+	blargg_err_t setup_header();
 	blargg_err_t setup_fm();
+	long commands_offset() const;
 };
 
 #endif
@@ -40,6 +40,8 @@ enum {
 	ym2612_dac_port     = 0x2A
 };
 
+int const stream_cmd_max = 8; // longest command, including data block header
+
 inline int command_len( int command )
 {
 	switch ( command >> 4 )
@@ -102,6 +104,7 @@ inline blip_time_t Vgm_Emu_Impl::to_blip_time( vgm_time_t t ) const
 
 void Vgm_Emu_Impl::write_pcm( vgm_time_t vgm_time, int amp )
 {
+	count_apu_write();
 	blip_time_t blip_time = to_blip_time( vgm_time );
 	int old = dac_amp;
 	int delta = amp - old;
@@ -112,6 +115,126 @@ void Vgm_Emu_Impl::write_pcm( vgm_time_t vgm_time, int amp )
 		dac_amp |= dac_disabled;
 }
 
+// Runs a stream of PCM delay commands from data block, as logged DAC playback
+// usually is, without going back to run_commands() for each sample. pos [-1] is
+// the first command.
+byte const* Vgm_Emu_Impl::run_pcm( byte const* pos, vgm_time_t* time_io, vgm_time_t end_time )
+{
+	vgm_time_t vgm_time = *time_io;
+	
+	// first write handles DAC being enabled or disabled
+	write_pcm( vgm_time, *pcm_pos++ );
+	vgm_time += pos [-1] & 0x0F;
+	
+	// stop where run_commands() would check for something
+	byte const* end = (refill_pos < data_end ? refill_pos : data_end);
+	byte const* in = pcm_pos;
+	int amp = dac_amp;
+	if ( amp >= 0 )
+	{
+		while ( vgm_time < end_time && pos < end && (*pos & 0xF0) == cmd_pcm_delay )
+		{
+			int delta = *in - amp;
+			amp = *in++;
+			if ( delta ) // samples often repeat
+				dac_synth.offset_inline( to_blip_time( vgm_time ), delta, &blip_buf );
+			vgm_time += *pos++ & 0x0F;
+		}
+		dac_amp = amp;
+	}
+	else
+	{
+		// disabled, so just keep place in data
+		while ( vgm_time < end_time && pos < end && (*pos & 0xF0) == cmd_pcm_delay )
+		{
+			in++;
+			vgm_time += *pos++ & 0x0F;
+		}
+	}
+	#if GME_STATS
+		stats().apu_writes += in - pcm_pos;
+	#endif
+	pcm_pos = in;
+	
+	*time_io = vgm_time;
+	return pos;
+}
+
+// Streaming
+
+// Moves unread commands to beginning of stream_buf and reads more after them
+byte const* Vgm_Emu_Impl::refill_stream( byte const* pos )
+{
+	byte* buf = stream_buf.begin();
+	long remain = data_end - pos;
+	memmove( buf, pos, remain );
+	
+	long count = stream_buf.size() - remain;
+	if ( count > stream->remain() )
+		count = stream->remain();
+	blargg_err_t err = stream->read( buf + remain, count );
+	if ( err )
+	{
+		set_warning( err );
+		count = 0;
+	}
+	
+	data_end   = buf + remain + count;
+	refill_pos = data_end;
+	if ( !err && stream->remain() > 0 )
+		refill_pos -= stream_cmd_max;
+	return buf;
+}
+
+byte const* Vgm_Emu_Impl::seek_stream( long offset )
+{
+	data_end = stream_buf.begin();
+	refill_pos = data_end;
+	blargg_err_t err = stream->seek( offset );
+	if ( err )
+	{
+		set_warning( err );
+		return data_end;
+	}
+	return refill_stream( data_end );
+}
+
+// Keeps PCM data block and skips others. Data can extend past stream_buf.
+byte const* Vgm_Emu_Impl::read_data_block( byte const* pos, int type, long size )
+{
+	byte* out = 0;
+	if ( type == pcm_block_type )
+	{
+		if ( stream_pcm.size() < (size_t) size && stream_pcm.resize( size ) )
+			set_warning( "Out of memory" );
+		else
+			pcm_data = out = stream_pcm.begin();
+	}
+	
+	long first = data_end - pos;
+	if ( first > size )
+		first = size;
+	if ( out )
+		memcpy( out, pos, first );
+	pos += first;
+	
+	if ( first < size )
+	{
+		// rest of block follows window
+		blargg_err_t err = out ? stream->read( out + first, size - first ) :
+				stream->skip( size - first );
+		data_end = stream_buf.begin();
+		refill_pos = data_end;
+		if ( err )
+		{
+			set_warning( err );
+			return data_end;
+		}
+		pos = refill_stream( data_end );
+	}
+	return pos;
+}
+
 blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 {
 	vgm_time_t vgm_time = this->vgm_time; 
@@ -125,12 +248,21 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 	
 	while ( vgm_time < end_time && pos < data_end )
 	{
+		// never true unless streaming
+		if ( pos >= refill_pos )
+			pos = refill_stream( pos );
+		
 		// TODO: be sure there are enough bytes left in stream for particular command
 		// so we don't read past end
 		switch ( *pos++ )
 		{
 		case cmd_end:
-			pos = loop_begin; // if not looped, loop_begin == data_end
+			if ( !stream )
+				pos = loop_begin; // if not looped, loop_begin == data_end
+			else if ( stream_loop )
+				pos = seek_stream( stream_loop );
+			else
+				pos = data_end;
 			break;
 		
 		case cmd_delay_735:
@@ -142,10 +274,12 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 			break;
 		
 		case cmd_gg_stereo:
+			count_apu_write();
 			psg.write_ggstereo( to_blip_time( vgm_time ), *pos++ );
 			break;
 		
 		case cmd_psg:
+			count_apu_write();
 			psg.write_data( to_blip_time( vgm_time ), *pos++ );
 			break;
 		
@@ -160,7 +294,10 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 		
 		case cmd_ym2413:
 			if ( ym2413.run_until( to_fm_time( vgm_time ) ) )
+			{
+				count_apu_write();
 				ym2413.write( pos [0], pos [1] );
+			}
 			pos += 2;
 			break;
 		
@@ -171,6 +308,7 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 			}
 			else if ( ym2612.run_until( to_fm_time( vgm_time ) ) )
 			{
+				count_apu_write();
 				if ( pos [0] == 0x2B )
 				{
 					dac_disabled = (pos [1] >> 7 & 1) - 1;
@@ -183,7 +321,10 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 		
 		case cmd_ym2612_port1:
 			if ( ym2612.run_until( to_fm_time( vgm_time ) ) )
+			{
+				count_apu_write();
 				ym2612.write1( pos [0], pos [1] );
+			}
 			pos += 2;
 			break;
 			
@@ -192,6 +333,11 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 			int type = pos [1];
 			long size = get_le32( pos + 2 );
 			pos += 6;
+			if ( stream )
+			{
+				pos = read_data_block( pos, type, size );
+				break;
+			}
 			if ( type == pcm_block_type )
 				pcm_data = pos;
 			pos += size;
@@ -209,8 +355,7 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 			switch ( cmd & 0xF0 )
 			{
 				case cmd_pcm_delay:
-					write_pcm( vgm_time, *pcm_pos++ );
-					vgm_time += cmd & 0x0F;
+					pos = run_pcm( pos, &vgm_time, end_time );
 					break;
 				
 				case cmd_short_delay:
@@ -237,6 +382,7 @@ blip_time_t Vgm_Emu_Impl::run_commands( vgm_time_t end_time )
 int Vgm_Emu_Impl::play_frame( blip_time_t blip_time, int sample_count, sample_t* buf )
 {
 	// to do: timing is working mostly by luck
+	stats_timer_t timer( stats().emulate_msec );
 	
 	int min_pairs = sample_count >> 1;
 	int vgm_time = ((long) min_pairs << fm_time_bits) / fm_time_factor - 1;
@@ -269,9 +415,8 @@ int Vgm_Emu_Impl::play_frame( blip_time_t blip_time, int sample_count, sample_t*
 }
 
 // Update pre-1.10 header FM rates by scanning commands
-void Vgm_Emu_Impl::update_fm_rates( long* ym2413_rate, long* ym2612_rate ) const
+void Vgm_Emu_Impl::update_fm_rates( byte const* p, long* ym2413_rate, long* ym2612_rate ) const
 {
-	byte const* p = data + 0x40;
 	while ( p < data_end )
 	{
 		switch ( *p )
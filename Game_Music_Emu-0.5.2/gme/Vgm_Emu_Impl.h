@@ -45,7 +45,18 @@ protected:
 	byte const* data;
 	byte const* loop_begin;
 	byte const* data_end;
-	void update_fm_rates( long* ym2413_rate, long* ym2612_rate ) const;
+	void update_fm_rates( byte const* begin, long* ym2413_rate, long* ym2612_rate ) const;
+	
+	// When streaming, data_end is end of commands read ahead into stream_buf, and
+	// more are read once pos reaches refill_pos
+	File_Reader* stream;            // NULL unless streaming
+	blargg_vector<byte> stream_buf;
+	blargg_vector<byte> stream_pcm; // PCM data block read from stream
+	long stream_loop;               // file offset of loop, or 0 if none
+	byte const* refill_pos;
+	byte const* refill_stream( byte const* pos );
+	byte const* seek_stream( long offset );
+	byte const* read_data_block( byte const* pos, int type, long size );
 	
 	vgm_time_t vgm_time;
 	byte const* pos;
@@ -57,6 +68,7 @@ protected:
 	int dac_amp;
 	int dac_disabled; // -1 if disabled
 	void write_pcm( vgm_time_t, int amp );
+	byte const* run_pcm( byte const* pos, vgm_time_t* time_io, vgm_time_t end_time );
 	
 	Ym_Emu<Ym2612_Emu> ym2612;
 	Ym_Emu<Ym2413_Emu> ym2413;
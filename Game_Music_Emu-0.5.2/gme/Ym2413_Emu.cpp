@@ -19,3 +19,4 @@ void Ym2413_Emu::mute_voices( int ) { }
 
 void Ym2413_Emu::run( int, sample_t* ) { }
 
+void Ym2413_Emu::copy_state( unsigned char**, copy_func_t ) { }
@@ -4,6 +4,8 @@
 #ifndef YM2413_EMU_H
 #define YM2413_EMU_H
 
+#include <stddef.h>
+
 class Ym2413_Emu  {
 	struct OPLL* opll;
 public:
@@ -28,6 +30,10 @@ public:
 	typedef short sample_t;
 	enum { out_chan_count = 2 }; // stereo
 	void run( int pair_count, sample_t* out );
+	
+	// Save/load chip state (see Ym2612_Emu.h)
+	typedef void (*copy_func_t)( unsigned char** io, void* state, size_t size );
+	void copy_state( unsigned char** io, copy_func_t );
 };
 
 #endif
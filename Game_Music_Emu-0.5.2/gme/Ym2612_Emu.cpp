@@ -4,6 +4,7 @@
 
 #include "Ym2612_Emu.h"
 
+#include "blargg_tables.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
@@ -36,6 +37,18 @@ Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
 	#include BLARGG_ENABLE_OPTIMIZER
 #endif
 
+// YM2612_SSE2: Set to 1 if fast core can use SSE2 (see BLIP_BUFFER_NO_SIMD)
+#ifndef YM2612_SSE2
+	#if !defined (BLIP_BUFFER_NO_SIMD) && (defined (__SSE2__) || defined (_M_X64) || \
+			(defined (_M_IX86_FP) && _M_IX86_FP >= 2))
+		#define YM2612_SSE2 1
+	#endif
+#endif
+
+#if YM2612_SSE2
+	#include <emmintrin.h>
+#endif
+
 const int output_bits = 14;
 
 struct slot_t
@@ -101,6 +114,9 @@ struct channel_t
 struct state_t
 {
 	int TimerBase;      // TimerBase calculation
+	int LFOcnt;         // LFO counter = compteur-frequence pour le LFO
+	int LFOinc;         // LFO step counter = pas d'incrementation du compteur-frequence du LFO
+						// plus le pas est grand, plus la frequence est grande
 	int Status;         // YM2612 Status (timer overflow)
 	int TimerA;         // timerA limit = valeur jusqu' laquelle le timer A doit compter
 	int TimerAL;
@@ -191,12 +207,11 @@ inline void set_seg( slot_t& s, int seg )
 	}
 }
 
+// Tables depend only on sample and clock rates, so are shared by all instances
+// using the same rates (see blargg_tables.h)
 struct tables_t
 {
 	short SIN_TAB [SIN_LENGHT];                 // SINUS TABLE (offset into TL TABLE)
-	int LFOcnt;         // LFO counter = compteur-frequence pour le LFO
-	int LFOinc;         // LFO step counter = pas d'incrementation du compteur-frequence du LFO
-						// plus le pas est grand, plus la frequence est grande
 	unsigned int AR_TAB [128];                  // Attack rate table
 	unsigned int DR_TAB [96];                   // Decay rate table
 	unsigned int DT_TAB [8] [32];               // Detune table
@@ -213,6 +228,41 @@ struct tables_t
 	unsigned int FINC_TAB [2048];               // Frequency step table
 };
 
+// Tables used by fast core. These don't depend on the rates, so are built
+// from the first instance's tables and shared by all. Fast core limits attenuation to
+// PG_CUT_OFF, so each half of TL only needs to cover twice that.
+enum { fast_tl_half = PG_CUT_OFF * 2 + 1 };
+
+struct fast_tables_t
+{
+	int TL [fast_tl_half * 2];                  // positive then negative half
+	short SIN [SIN_LENGHT];                     // offset into TL
+	short ENV [2 * ENV_LENGHT + 8];
+	short LFO_ENV [LFO_LENGHT];
+	short LFO_FREQ [LFO_LENGHT];
+};
+
+#if YM2612_SSE2
+static void build_fast_tables( void* table, void const*, void const* data )
+{
+	fast_tables_t& t = *(fast_tables_t*) table;
+	tables_t const& g = *(tables_t const*) data;
+	for ( int i = 0; i < fast_tl_half; i++ )
+	{
+		t.TL [i] = (i < PG_CUT_OFF ? g.TL_TAB [i] : 0);
+		t.TL [fast_tl_half + i] = -t.TL [i];
+	}
+	for ( int i = 0; i < SIN_LENGHT; i++ )
+	{
+		int n = g.SIN_TAB [i];
+		t.SIN [i] = (n < TL_LENGHT ? n : n - TL_LENGHT + fast_tl_half);
+	}
+	memcpy( t.ENV, g.ENV_TAB, sizeof t.ENV );
+	memcpy( t.LFO_ENV, g.LFO_ENV_TAB, sizeof t.LFO_ENV );
+	memcpy( t.LFO_FREQ, g.LFO_FREQ_TAB, sizeof t.LFO_FREQ );
+}
+#endif
+
 static const unsigned char DT_DEF_TAB [4 * 32] =
 {
 // FD = 0
@@ -261,7 +311,10 @@ struct Ym2612_Impl
 	
 	state_t YM2612;
 	int mute_mask;
-	tables_t g;
+	bool fast;
+	tables_t const* g;
+	fast_tables_t const* fast_g;
+	double clock_rate;
 	
 	void KEY_ON( channel_t&, int );
 	void KEY_OFF( channel_t&, int );
@@ -269,12 +322,15 @@ struct Ym2612_Impl
 	int CHANNEL_SET( int, int );
 	int YM_SET( int, int );
 	
-	void set_rate( double sample_rate, double clock_factor );
+	const char* set_rate( double sample_rate, double clock_factor );
+	const char* set_tables( double sample_rate, double clock_rate );
+	const char* change_rate( double sample_rate );
 	void reset();
 	void write0( int addr, int data );
 	void write1( int addr, int data );
 	void run_timer( int );
 	void run( int pair_count, Ym2612_Emu::sample_t* );
+	void copy_state( unsigned char** io, Ym2612_Emu::copy_func_t );
 };
 
 void Ym2612_Impl::KEY_ON( channel_t& ch, int nsl)
@@ -287,10 +343,10 @@ void Ym2612_Impl::KEY_ON( channel_t& ch, int nsl)
 
 		// Fix Ecco 2 splash sound
 		
-		SL->Ecnt = (g.DECAY_TO_ATTACK [g.ENV_TAB [SL->Ecnt >> ENV_LBITS]] + ENV_ATTACK) & SL->ChgEnM;
+		SL->Ecnt = (g->DECAY_TO_ATTACK [g->ENV_TAB [SL->Ecnt >> ENV_LBITS]] + ENV_ATTACK) & SL->ChgEnM;
 		SL->ChgEnM = ~0;
 
-//      SL->Ecnt = g.DECAY_TO_ATTACK [g.ENV_TAB [SL->Ecnt >> ENV_LBITS]] + ENV_ATTACK;
+//      SL->Ecnt = g->DECAY_TO_ATTACK [g->ENV_TAB [SL->Ecnt >> ENV_LBITS]] + ENV_ATTACK;
 //      SL->Ecnt = 0;
 
 		SL->Einc = SL->EincA;
@@ -308,7 +364,7 @@ void Ym2612_Impl::KEY_OFF(channel_t& ch, int nsl)
 	{
 		if (SL->Ecnt < ENV_DECAY)   // attack phase ?
 		{
-			SL->Ecnt = (g.ENV_TAB [SL->Ecnt >> ENV_LBITS] << ENV_LBITS) + ENV_DECAY;
+			SL->Ecnt = (g->ENV_TAB [SL->Ecnt >> ENV_LBITS] << ENV_LBITS) + ENV_DECAY;
 		}
 
 		SL->Einc = SL->EincR;
@@ -333,7 +389,7 @@ int Ym2612_Impl::SLOT_SET( int Adr, int data )
 			if ( (sl.MUL = (data & 0x0F)) != 0 ) sl.MUL <<= 1;
 			else sl.MUL = 1;
 
-			sl.DT = (int*) g.DT_TAB [(data >> 4) & 7];
+			sl.DT = (int*) g->DT_TAB [(data >> 4) & 7];
 
 			ch.SLOT [0].Finc = -1;
 
@@ -358,8 +414,8 @@ int Ym2612_Impl::SLOT_SET( int Adr, int data )
 
 			ch.SLOT [0].Finc = -1;
 
-			if (data &= 0x1F) sl.AR = (int*) &g.AR_TAB [data << 1];
-			else sl.AR = (int*) &g.NULL_RATE [0];
+			if (data &= 0x1F) sl.AR = (int*) &g->AR_TAB [data << 1];
+			else sl.AR = (int*) &g->NULL_RATE [0];
 
 			sl.EincA = sl.AR [sl.KSR];
 			if (sl.Ecurp == ATTACK) sl.Einc = sl.EincA;
@@ -369,25 +425,25 @@ int Ym2612_Impl::SLOT_SET( int Adr, int data )
 			if ( (sl.AMSon = (data & 0x80)) != 0 ) sl.AMS = ch.AMS;
 			else sl.AMS = 31;
 
-			if (data &= 0x1F) sl.DR = (int*) &g.DR_TAB [data << 1];
-			else sl.DR = (int*) &g.NULL_RATE [0];
+			if (data &= 0x1F) sl.DR = (int*) &g->DR_TAB [data << 1];
+			else sl.DR = (int*) &g->NULL_RATE [0];
 
 			sl.EincD = sl.DR [sl.KSR];
 			if (sl.Ecurp == DECAY) sl.Einc = sl.EincD;
 			break;
 
 		case 0x70:
-			if (data &= 0x1F) sl.SR = (int*) &g.DR_TAB [data << 1];
-			else sl.SR = (int*) &g.NULL_RATE [0];
+			if (data &= 0x1F) sl.SR = (int*) &g->DR_TAB [data << 1];
+			else sl.SR = (int*) &g->NULL_RATE [0];
 
 			sl.EincS = sl.SR [sl.KSR];
 			if ((sl.Ecurp == SUBSTAIN) && (sl.Ecnt < ENV_END)) sl.Einc = sl.EincS;
 			break;
 
 		case 0x80:
-			sl.SLL = g.SL_TAB [data >> 4];
+			sl.SLL = g->SL_TAB [data >> 4];
 
-			sl.RR = (int*) &g.DR_TAB [((data & 0xF) << 2) + 2];
+			sl.RR = (int*) &g->DR_TAB [((data & 0xF) << 2) + 2];
 
 			sl.EincR = sl.RR [sl.KSR];
 			if ((sl.Ecurp == RELEASE) && (sl.Ecnt < ENV_END)) sl.Einc = sl.EincR;
@@ -532,11 +588,11 @@ int Ym2612_Impl::YM_SET(int Adr, int data)
 				// Cool Spot music 1, LFO modified severals time which
 				// distord the sound, have to check that on a real genesis...
 
-				g.LFOinc = g.LFO_INC_TAB [data & 7];
+				YM2612.LFOinc = g->LFO_INC_TAB [data & 7];
 			}
 			else
 			{
-				g.LFOinc = g.LFOcnt = 0;
+				YM2612.LFOinc = YM2612.LFOcnt = 0;
 			}
 			break;
 
@@ -628,20 +684,32 @@ int Ym2612_Impl::YM_SET(int Adr, int data)
 	return 0;
 }
 
-void Ym2612_Impl::set_rate( double sample_rate, double clock_rate )
+static double clock_frequence( double sample_rate, double clock_rate )
 {
-	assert( sample_rate );
-	assert( clock_rate > sample_rate );
-	
-	int i;
-
 	// 144 = 12 * (prescale * 2) = 12 * 6 * 2
 	// prescale set to 6 by default
 	
 	double Frequence = clock_rate / sample_rate / 144.0;
 	if ( fabs( Frequence - 1.0 ) < 0.0000001 )
 		Frequence = 1.0;
-	YM2612.TimerBase = int (Frequence * 4096.0);
+	return Frequence;
+}
+
+struct tables_key_t
+{
+	double sample_rate;
+	double clock_rate;
+};
+
+static void build_tables( void* table, void const* key, void const* )
+{
+	tables_t& g = *(tables_t*) table;
+	double const sample_rate = ((tables_key_t const*) key)->sample_rate;
+	double const clock_rate  = ((tables_key_t const*) key)->clock_rate;
+	
+	int i;
+	
+	double const Frequence = clock_frequence( sample_rate, clock_rate );
 
 	// Tableau TL :
 	// [0     -  4095] = +output  [4095  - ...] = +output overflow (fill with 0)
@@ -820,29 +888,160 @@ void Ym2612_Impl::set_rate( double sample_rate, double clock_rate )
 	g.LFO_INC_TAB [5] = (unsigned int) (9.63 * (double) (1 << (LFO_HBITS + LFO_LBITS)) / sample_rate);
 	g.LFO_INC_TAB [6] = (unsigned int) (48.1 * (double) (1 << (LFO_HBITS + LFO_LBITS)) / sample_rate);
 	g.LFO_INC_TAB [7] = (unsigned int) (72.2 * (double) (1 << (LFO_HBITS + LFO_LBITS)) / sample_rate);
+}
+
+const char* Ym2612_Impl::set_tables( double sample_rate, double clock_rate )
+{
+	assert( sample_rate );
+	assert( clock_rate > sample_rate );
+	
+	this->clock_rate = clock_rate;
+	YM2612.TimerBase = int (clock_frequence( sample_rate, clock_rate ) * 4096.0);
+	
+	tables_key_t key;
+	memset( &key, 0, sizeof key );
+	key.sample_rate = sample_rate;
+	key.clock_rate  = clock_rate;
+	g = (tables_t const*) blargg_shared_table( "Ym2612_Emu", &key, sizeof key,
+			sizeof (tables_t), build_tables );
+	if ( !g )
+		return "Out of memory";
+	
+	fast_g = 0;
+	#if YM2612_SSE2
+		fast_g = (fast_tables_t const*) blargg_shared_table( "Ym2612_Emu fast", 0, 0,
+				sizeof (fast_tables_t), build_fast_tables, g );
+		if ( !fast_g )
+			return "Out of memory";
+	#endif
+	
+	return 0;
+}
+
+const char* Ym2612_Impl::set_rate( double sample_rate, double clock_rate )
+{
+	const char* err = set_tables( sample_rate, clock_rate );
+	if ( err )
+		return err;
 	
 	reset();
+	return 0;
+}
+
+// Slots point into the tables, at the same places in the new ones
+template<class T>
+static inline T const* rebase( T const* p, tables_t const* from, tables_t const* to )
+{
+	return (T const*) ((char const*) to + ((char const*) p - (char const*) from));
+}
+
+const char* Ym2612_Impl::change_rate( double sample_rate )
+{
+	tables_t const* const old = g;
+	const char* err = set_tables( sample_rate, clock_rate );
+	if ( err )
+		return err;
+	
+	// redo everything calculated from the tables when registers were written
+	if ( YM2612.LFOinc )
+		YM2612.LFOinc = g->LFO_INC_TAB [YM2612.REG [0] [0x22] & 7];
+	
+	for ( int i = 0; i < channel_count; i++ )
+	{
+		channel_t& ch = YM2612.CHANNEL [i];
+		for ( int j = 0; j < 4; j++ )
+		{
+			slot_t& sl = ch.SLOT [j];
+			sl.DT = rebase( sl.DT, old, g );
+			sl.AR = rebase( sl.AR, old, g );
+			sl.DR = rebase( sl.DR, old, g );
+			sl.SR = rebase( sl.SR, old, g );
+			sl.RR = rebase( sl.RR, old, g );
+			
+			sl.EincA = sl.AR [sl.KSR];
+			sl.EincD = sl.DR [sl.KSR];
+			sl.EincS = sl.SR [sl.KSR];
+			sl.EincR = sl.RR [sl.KSR];
+			
+			if ( sl.Ecurp == ATTACK )
+				sl.Einc = sl.EincA;
+			else if ( sl.Ecurp == DECAY )
+				sl.Einc = sl.EincD;
+			else if ( sl.Ecnt < ENV_END )
+			{
+				if ( sl.Ecurp == SUBSTAIN )
+					sl.Einc = sl.EincS;
+				else if ( sl.Ecurp == RELEASE )
+					sl.Einc = sl.EincR;
+			}
+		}
+		ch.SLOT [0].Finc = -1; // recalculate phase steps
+	}
+	return 0;
 }
 
 const char* Ym2612_Emu::set_rate( double sample_rate, double clock_rate )
 {
 	if ( !impl )
 	{
-		impl = (Ym2612_Impl*) malloc( sizeof *impl );
+		BLARGG_ALLOC_HOOK( sizeof *impl );
+		impl = (Ym2612_Impl*) BLARGG_MALLOC( sizeof *impl );
 		if ( !impl )
 			return "Out of memory";
 		impl->mute_mask = 0;
 	}
 	memset( &impl->YM2612, 0, sizeof impl->YM2612 );
+	impl->fast = fast;
 	
-	impl->set_rate( sample_rate, clock_rate );
-	
-	return 0;
+	return impl->set_rate( sample_rate, clock_rate );
+}
+
+const char* Ym2612_Emu::change_rate( double sample_rate )
+{
+	assert( impl ); // set_rate() must have been called
+	return impl->change_rate( sample_rate );
 }
 
 Ym2612_Emu::~Ym2612_Emu()
 {
-	free( impl );
+	BLARGG_FREE( impl );
+}
+
+void Ym2612_Emu::enable_fast( bool b )
+{
+	fast = b;
+	if ( impl )
+		impl->fast = b;
+}
+
+void Ym2612_Impl::copy_state( unsigned char** io, Ym2612_Emu::copy_func_t copy )
+{
+	// slots point into the tables, which are shared and can be rebuilt elsewhere
+	// after a rate change, so the tables they pointed into are kept too
+	tables_t const* from = g;
+	copy( io, &YM2612, sizeof YM2612 );
+	copy( io, &from, sizeof from );
+	if ( from != g )
+	{
+		for ( int i = 0; i < channel_count; i++ )
+		{
+			for ( int j = 0; j < 4; j++ )
+			{
+				slot_t& sl = YM2612.CHANNEL [i].SLOT [j];
+				sl.DT = rebase( sl.DT, from, g );
+				sl.AR = rebase( sl.AR, from, g );
+				sl.DR = rebase( sl.DR, from, g );
+				sl.SR = rebase( sl.SR, from, g );
+				sl.RR = rebase( sl.RR, from, g );
+			}
+		}
+	}
+}
+
+void Ym2612_Emu::copy_state( unsigned char** io, copy_func_t copy )
+{
+	assert( impl ); // set_rate() must have been called
+	impl->copy_state( io, copy );
 }
 
 inline void Ym2612_Impl::write0( int opn_addr, int data )
@@ -887,7 +1086,7 @@ void Ym2612_Emu::reset()
 
 void Ym2612_Impl::reset()
 {
-	g.LFOcnt = 0;
+	YM2612.LFOcnt = 0;
 	YM2612.TimerA = 0;
 	YM2612.TimerAL = 0;
 	YM2612.TimerAcnt = 0;
@@ -1033,15 +1232,17 @@ inline void update_envelope( slot_t& sl )
 
 template<int algo>
 struct ym2612_update_chan {
-	static void func( tables_t&, channel_t&, Ym2612_Emu::sample_t*, int );
+	static void func( Ym2612_Impl const&, channel_t&, Ym2612_Emu::sample_t*, int );
 };
 
-typedef void (*ym2612_update_chan_t)( tables_t&, channel_t&, Ym2612_Emu::sample_t*, int );
+typedef void (*ym2612_update_chan_t)( Ym2612_Impl const&, channel_t&, Ym2612_Emu::sample_t*, int );
 
 template<int algo>
-void ym2612_update_chan<algo>::func( tables_t& g, channel_t& ch,
+void ym2612_update_chan<algo>::func( Ym2612_Impl const& impl, channel_t& ch,
 		Ym2612_Emu::sample_t* buf, int length )
 {
+	tables_t const& g = *impl.g;
+	
 	int not_end = ch.SLOT [S3].Ecnt - ENV_END;
 	
 	// algo is a compile-time constant, so all conditions based on it are resolved
@@ -1064,8 +1265,8 @@ void ym2612_update_chan<algo>::func( tables_t& g, channel_t& ch,
 	int in2 = ch.SLOT [S2].Fcnt;
 	int in3 = ch.SLOT [S3].Fcnt;
 	
-	int YM2612_LFOinc = g.LFOinc;
-	int YM2612_LFOcnt = g.LFOcnt + YM2612_LFOinc;
+	int YM2612_LFOinc = impl.YM2612.LFOinc;
+	int YM2612_LFOcnt = impl.YM2612.LFOcnt + YM2612_LFOinc;
 	
 	if ( !not_end )
 		return;
@@ -1201,6 +1402,244 @@ static const ym2612_update_chan_t UPDATE_CHAN [8] = {
 	&ym2612_update_chan<7>::func
 };
 
+// Fast core
+
+// Same as normal core, except the four slots of a channel are kept in lanes of
+// a vector, so that their envelopes and phases are updated together, and
+// operator output uses the smaller fast_tables. Without SSE2, normal core is
+// used instead, since plain code for this is slower than normal core.
+
+#if YM2612_SSE2
+
+typedef __m128i fast_vec;
+
+static inline fast_vec fast_set( int s0, int s1, int s2, int s3 ) { return _mm_set_epi32( s3, s2, s1, s0 ); }
+static inline fast_vec fast_add( fast_vec a, fast_vec b ) { return _mm_add_epi32( a, b ); }
+static inline fast_vec fast_sub( fast_vec a, fast_vec b ) { return _mm_sub_epi32( a, b ); }
+static inline fast_vec fast_and( fast_vec a, fast_vec b ) { return _mm_and_si128( a, b ); }
+static inline fast_vec fast_xor( fast_vec a, fast_vec b ) { return _mm_xor_si128( a, b ); }
+static inline fast_vec fast_sign( fast_vec a ) { return _mm_srai_epi32( a, 31 ); }
+
+// lanes must be 0 to 0x7FFF
+static inline fast_vec fast_min( fast_vec a, fast_vec b ) { return _mm_min_epi16( a, b ); }
+static inline void fast_store( int* out, fast_vec a ) { _mm_store_si128( (__m128i*) out, a ); }
+
+// (env_LFO * n) >> 4, where product is less than 0x10000
+static inline fast_vec fast_ams( int env_LFO, fast_vec n )
+{
+	return _mm_srli_epi32( _mm_mullo_epi16( _mm_set1_epi32( env_LFO ), n ), 4 );
+}
+
+// (unsigned) (a * b) >> 8
+static inline fast_vec fast_step( fast_vec a, int b )
+{
+	__m128i m = _mm_set1_epi32( b );
+	__m128i even = _mm_mul_epu32( a, m );
+	__m128i odd  = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), m );
+	__m128i lo = _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE( 0, 0, 2, 0 ) ),
+			_mm_shuffle_epi32( odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+	return _mm_srli_epi32( lo, LFO_FMS_LBITS - 1 );
+}
+
+// Bit n set if lane n of a >= b
+static inline int fast_ge( fast_vec a, fast_vec b )
+{
+	return _mm_movemask_ps( _mm_castsi128_ps( _mm_cmpgt_epi32( b, a ) ) ) ^ 0x0F;
+}
+
+// Output of slot with phase counter 'in' and attenuation 'en' (at most
+// PG_CUT_OFF). Same as TL_TAB [SIN_TAB [(in >> SIN_LBITS) & SIN_MASK] + en].
+static inline int fast_op( fast_tables_t const& t, int in, int en )
+{
+	return t.TL [t.SIN [(in >> SIN_LBITS) & SIN_MASK] + en];
+}
+
+// (env_LFO >> AMS) == (env_LFO * fast_ams_mul( AMS )) >> 4 for AMS in LFO_AMS_TAB
+static inline int fast_ams_mul( int ams ) { return ams <= 4 ? 16 >> ams : 0; }
+
+template<int algo>
+struct ym2612_fast_chan {
+	static void func( Ym2612_Impl const&, channel_t&, Ym2612_Emu::sample_t*, int );
+};
+
+template<int algo>
+void ym2612_fast_chan<algo>::func( Ym2612_Impl const& impl, channel_t& ch,
+		Ym2612_Emu::sample_t* buf, int length )
+{
+	int not_end = ch.SLOT [S3].Ecnt - ENV_END;
+	if ( algo == 7 )
+		not_end |= ch.SLOT [S0].Ecnt - ENV_END;
+	if ( algo >= 5 )
+		not_end |= ch.SLOT [S2].Ecnt - ENV_END;
+	if ( algo >= 4 )
+		not_end |= ch.SLOT [S1].Ecnt - ENV_END;
+	if ( !not_end )
+		return;
+	
+	fast_tables_t const& t = *impl.fast_g;
+	slot_t* const sl = ch.SLOT;
+	
+	#define FAST_SLOTS( field ) fast_set( sl [0].field, sl [1].field, sl [2].field, sl [3].field )
+	
+	fast_vec Fcnt = FAST_SLOTS( Fcnt );
+	fast_vec const Finc = FAST_SLOTS( Finc );
+	fast_vec const TLL  = FAST_SLOTS( TLL );
+	fast_vec const ams_mul = fast_set( fast_ams_mul( sl [0].AMS ), fast_ams_mul( sl [1].AMS ),
+			fast_ams_mul( sl [2].AMS ), fast_ams_mul( sl [3].AMS ) );
+	
+	// reloaded when envelope phase changes
+	fast_vec Ecnt = FAST_SLOTS( Ecnt );
+	fast_vec Einc = FAST_SLOTS( Einc );
+	fast_vec Ecmp = FAST_SLOTS( Ecmp );
+	fast_vec env_xor = FAST_SLOTS( env_xor );
+	fast_vec env_max = FAST_SLOTS( env_max );
+	
+	fast_vec const cut_off = fast_set( PG_CUT_OFF, PG_CUT_OFF, PG_CUT_OFF, PG_CUT_OFF );
+	
+	int CH_S0_OUT_0 = ch.S0_OUT [0];
+	int CH_S0_OUT_1 = ch.S0_OUT [1];
+	
+	int const LFOinc = impl.YM2612.LFOinc;
+	int LFOcnt = impl.YM2612.LFOcnt + LFOinc;
+	
+	BLARGG_ALIGN( 16 ) int en  [4];
+	BLARGG_ALIGN( 16 ) int in  [4];
+	BLARGG_ALIGN( 16 ) int env [4];
+	do
+	{
+		int const lfo_index = LFOcnt >> LFO_LBITS & LFO_MASK;
+		LFOcnt += LFOinc;
+		
+		// envelope
+		fast_store( env, Ecnt );
+		fast_vec temp = fast_add( TLL, fast_set( t.ENV [env [0] >> ENV_LBITS],
+				t.ENV [env [1] >> ENV_LBITS], t.ENV [env [2] >> ENV_LBITS], t.ENV [env [3] >> ENV_LBITS] ) );
+		temp = fast_and( fast_add( fast_xor( temp, env_xor ), fast_ams( t.LFO_ENV [lfo_index], ams_mul ) ),
+				fast_sign( fast_sub( temp, env_max ) ) );
+		fast_store( en, fast_min( temp, cut_off ) );
+		
+		fast_store( in, Fcnt );
+		int const in0 = in [S0], in1 = in [S1], in2 = in [S2], in3 = in [S3];
+		int const en0 = en [S0], en1 = en [S1], en2 = en [S2], en3 = en [S3];
+		
+		// feedback
+		{
+			int temp = in0 + ((CH_S0_OUT_0 + CH_S0_OUT_1) >> ch.FB);
+			CH_S0_OUT_1 = CH_S0_OUT_0;
+			CH_S0_OUT_0 = fast_op( t, temp, en0 );
+		}
+		
+		int CH_OUTd;
+		if ( algo == 0 )
+		{
+			int temp = in2 + fast_op( t, in1 + CH_S0_OUT_1, en1 );
+			temp = in3 + fast_op( t, temp, en2 );
+			CH_OUTd = fast_op( t, temp, en3 );
+		}
+		else if ( algo == 1 )
+		{
+			int temp = in2 + CH_S0_OUT_1 + fast_op( t, in1, en1 );
+			temp = in3 + fast_op( t, temp, en2 );
+			CH_OUTd = fast_op( t, temp, en3 );
+		}
+		else if ( algo == 2 )
+		{
+			int temp = in2 + fast_op( t, in1, en1 );
+			temp = in3 + CH_S0_OUT_1 + fast_op( t, temp, en2 );
+			CH_OUTd = fast_op( t, temp, en3 );
+		}
+		else if ( algo == 3 )
+		{
+			int temp = in3 + fast_op( t, in1 + CH_S0_OUT_1, en1 ) + fast_op( t, in2, en2 );
+			CH_OUTd = fast_op( t, temp, en3 );
+		}
+		else if ( algo == 4 )
+		{
+			CH_OUTd = fast_op( t, in3 + fast_op( t, in2, en2 ), en3 ) +
+					fast_op( t, in1 + CH_S0_OUT_1, en1 );
+		}
+		else if ( algo == 5 )
+		{
+			int temp = CH_S0_OUT_1;
+			CH_OUTd = fast_op( t, in3 + temp, en3 ) + fast_op( t, in1 + temp, en1 ) +
+					fast_op( t, in2 + temp, en2 );
+		}
+		else if ( algo == 6 )
+		{
+			CH_OUTd = fast_op( t, in3, en3 ) + fast_op( t, in1 + CH_S0_OUT_1, en1 ) +
+					fast_op( t, in2, en2 );
+		}
+		else if ( algo == 7 )
+		{
+			CH_OUTd = fast_op( t, in3, en3 ) + fast_op( t, in1, en1 ) +
+					fast_op( t, in2, en2 ) + CH_S0_OUT_1;
+		}
+		
+		CH_OUTd >>= MAX_OUT_BITS - output_bits + 2;
+		
+		// update phase
+		int freq_LFO = ((t.LFO_FREQ [lfo_index] * ch.FMS) >> (LFO_HBITS - 1 + 1)) +
+				(1L << (LFO_FMS_LBITS - 1));
+		Fcnt = fast_add( Fcnt, fast_step( Finc, freq_LFO ) );
+		
+		int t0 = buf [0] + (CH_OUTd & ch.LEFT);
+		int t1 = buf [1] + (CH_OUTd & ch.RIGHT);
+		
+		// envelope phase changes are rare, so are done on slots then reloaded
+		Ecnt = fast_add( Ecnt, Einc );
+		if ( int changed = fast_ge( Ecnt, Ecmp ) )
+		{
+			fast_store( env, Ecnt );
+			for ( int i = 0; i < 4; i++ )
+			{
+				sl [i].Ecnt = env [i];
+				if ( changed >> i & 1 )
+					update_envelope_( &sl [i] );
+			}
+			Ecnt = FAST_SLOTS( Ecnt );
+			Einc = FAST_SLOTS( Einc );
+			Ecmp = FAST_SLOTS( Ecmp );
+			env_xor = FAST_SLOTS( env_xor );
+			env_max = FAST_SLOTS( env_max );
+		}
+		
+		buf [0] = t0;
+		buf [1] = t1;
+		buf += 2;
+	}
+	while ( --length );
+	
+	ch.S0_OUT [0] = CH_S0_OUT_0;
+	ch.S0_OUT [1] = CH_S0_OUT_1;
+	
+	fast_store( in, Fcnt );
+	fast_store( env, Ecnt );
+	for ( int i = 0; i < 4; i++ )
+	{
+		sl [i].Fcnt = in [i];
+		sl [i].Ecnt = env [i];
+	}
+	
+	#undef FAST_SLOTS
+}
+
+static const ym2612_update_chan_t FAST_UPDATE_CHAN [8] = {
+	&ym2612_fast_chan<0>::func,
+	&ym2612_fast_chan<1>::func,
+	&ym2612_fast_chan<2>::func,
+	&ym2612_fast_chan<3>::func,
+	&ym2612_fast_chan<4>::func,
+	&ym2612_fast_chan<5>::func,
+	&ym2612_fast_chan<6>::func,
+	&ym2612_fast_chan<7>::func
+};
+
+#else
+
+static ym2612_update_chan_t const* const FAST_UPDATE_CHAN = UPDATE_CHAN;
+
+#endif
+
 void Ym2612_Impl::run_timer( int length )
 {
 	int const step = 6;
@@ -1273,7 +1712,7 @@ void Ym2612_Impl::run( int pair_count, Ym2612_Emu::sample_t* out )
 			// if ( i2 ) i2 = seq [i];
 			
 			slot_t& sl = ch.SLOT [i];
-			int finc = g.FINC_TAB [ch.FNUM [i2]] >> (7 - ch.FOCT [i2]);
+			int finc = g->FINC_TAB [ch.FNUM [i2]] >> (7 - ch.FOCT [i2]);
 			int ksr = ch.KC [i2] >> sl.KSR_S;   // keycode attenuation
 			sl.Finc = (finc + sl.DT [ch.KC [i2]]) * sl.MUL;
 			if (sl.KSR != ksr)          // si le KSR a change alors
@@ -1307,13 +1746,14 @@ void Ym2612_Impl::run( int pair_count, Ym2612_Emu::sample_t* out )
 		}
 	}
 	
+	ym2612_update_chan_t const* update_chan = (fast ? FAST_UPDATE_CHAN : UPDATE_CHAN);
 	for ( int i = 0; i < channel_count; i++ )
 	{
 		if ( !(mute_mask & (1 << i)) && (i != 5 || !YM2612.DAC) )
-			UPDATE_CHAN [YM2612.CHANNEL [i].ALGO]( g, YM2612.CHANNEL [i], out, pair_count );
+			update_chan [YM2612.CHANNEL [i].ALGO]( *this, YM2612.CHANNEL [i], out, pair_count );
 	}
 	
-	g.LFOcnt += g.LFOinc * pair_count;
+	YM2612.LFOcnt += YM2612.LFOinc * pair_count;
 }
 
 void Ym2612_Emu::run( int pair_count, sample_t* out ) { impl->run( pair_count, out ); }
@@ -4,18 +4,31 @@
 #ifndef YM2612_EMU_H
 #define YM2612_EMU_H
 
+#include <stddef.h>
+
 struct Ym2612_Impl;
 
 class Ym2612_Emu  {
 	Ym2612_Impl* impl;
+	bool fast;
 public:
-	Ym2612_Emu() { impl = 0; }
+	Ym2612_Emu() { impl = 0; fast = false; }
 	~Ym2612_Emu();
 	
+	// Use faster core that updates the four operators of a channel together with
+	// SSE2 instructions, and uses smaller tables. Output
+	// is the same as the normal core. Has no effect without SSE2. Can be changed
+	// at any time.
+	void enable_fast( bool enable = true );
+	
 	// Set output sample rate and chip clock rates, in Hz. Returns non-zero
 	// if error.
 	const char* set_rate( double sample_rate, double clock_rate );
 	
+	// Change output sample rate while playing, keeping current state and clock
+	// rate. Returns non-zero if error.
+	const char* change_rate( double sample_rate );
+	
 	// Reset to power-up state
 	void reset();
 	
@@ -33,6 +46,12 @@ public:
 	typedef short sample_t;
 	enum { out_chan_count = 2 }; // stereo
 	void run( int pair_count, sample_t* out );
+	
+	// Save/load chip state with a state copying function (see blargg_copy_func_t
+	// in blargg_common.h). Rates must be the same when loading. Mute mask isn't
+	// included.
+	typedef void (*copy_func_t)( unsigned char** io, void* state, size_t size );
+	void copy_state( unsigned char** io, copy_func_t );
 };
 
 #endif
@@ -0,0 +1,214 @@
+// Game_Music_Emu 0.5.2. http://www.slack.net/~ant/
+
+#include "Zip_Archive.h"
+
+#include "blargg_endian.h"
+#include <string.h>
+
+/* Copyright (C) 2006 Shay Green. This module is free software; you
+can redistribute it and/or modify it under the terms of the GNU Lesser
+General Public License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version. This
+module is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+details. You should have received a copy of the GNU Lesser General Public
+License along with this module; if not, write to the Free Software Foundation,
+Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include "blargg_source.h"
+
+const char Zip_Archive::not_zip [] = "Not a zip archive";
+
+// Record sizes and signatures
+int const end_size       = 22; // end of central directory
+int const entry_size     = 46; // central directory entry
+int const header_size    = 30; // local file header
+int const max_comment    = 0xFFFF;
+blargg_ulong const end_sig    = 0x06054B50;
+blargg_ulong const entry_sig  = 0x02014B50;
+blargg_ulong const header_sig = 0x04034B50;
+
+Zip_Archive::Zip_Archive() : in( 0 ) { }
+
+Zip_Archive::~Zip_Archive() { close(); }
+
+void Zip_Archive::close()
+{
+	in = 0;
+	file.close();
+	entries.clear();
+	names.clear();
+}
+
+blargg_err_t Zip_Archive::open( const char* path )
+{
+	close();
+	RETURN_ERR( file.open( path ) );
+	blargg_err_t err = open( &file );
+	if ( err )
+		close();
+	return err;
+}
+
+blargg_err_t Zip_Archive::open( File_Reader* new_in )
+{
+	if ( new_in != &file )
+		close();
+	entries.clear();
+	names.clear();
+	in = new_in;
+	
+	// End record is at end of file, followed only by comment
+	long const file_size = in->size();
+	if ( file_size < end_size )
+		return not_zip;
+	long search_size = min( file_size, (long) end_size + max_comment );
+	blargg_vector<byte> buf;
+	RETURN_ERR( buf.resize( search_size ) );
+	RETURN_ERR( in->seek( file_size - search_size ) );
+	RETURN_ERR( in->read( buf.begin(), search_size ) );
+	
+	byte const* end = 0;
+	for ( long i = search_size - end_size; i >= 0; i-- )
+	{
+		if ( get_le32( &buf [i] ) == end_sig )
+		{
+			end = &buf [i];
+			break;
+		}
+	}
+	if ( !end )
+		return not_zip;
+	
+	int  const count    = get_le16( end + 10 );
+	long const dir_size = get_le32( end + 12 );
+	long const dir_pos  = get_le32( end + 16 );
+	if ( dir_pos > file_size || dir_size > file_size - dir_pos )
+		return "Corrupt zip archive";
+	
+	// Read whole directory
+	blargg_vector<byte> dir;
+	RETURN_ERR( dir.resize( dir_size ) );
+	RETURN_ERR( in->seek( dir_pos ) );
+	RETURN_ERR( in->read( dir.begin(), dir_size ) );
+	
+	RETURN_ERR( entries.resize( count ) );
+	RETURN_ERR( names.resize( dir_size + count ) ); // room for terminators
+	
+	long pos = 0;
+	long name_pos = 0;
+	for ( int i = 0; i < count; i++ )
+	{
+		byte const* p = &dir [pos];
+		if ( dir_size - pos < entry_size || get_le32( p ) != entry_sig )
+			return "Corrupt zip archive";
+		
+		int const name_size = get_le16( p + 28 );
+		long const next = pos + entry_size + name_size + get_le16( p + 30 ) +
+				get_le16( p + 32 );
+		if ( next > dir_size )
+			return "Corrupt zip archive";
+		
+		entry_t& e = entries [i];
+		e.flags    = get_le16( p + 8 );
+		e.method   = get_le16( p + 10 );
+		e.raw_size = get_le32( p + 20 );
+		e.size     = get_le32( p + 24 );
+		e.offset   = get_le32( p + 42 );
+		e.name     = name_pos;
+		memcpy( &names [name_pos], p + entry_size, name_size );
+		name_pos += name_size;
+		names [name_pos++] = 0;
+		
+		pos = next;
+	}
+	
+	return 0;
+}
+
+int Zip_Archive::find( const char* path ) const
+{
+	for ( int i = 0; i < count(); i++ )
+		if ( !strcmp( name( i ), path ) )
+			return i;
+	return -1;
+}
+
+// Zip_File_Reader
+
+Zip_File_Reader::Zip_File_Reader()
+{
+	in       = 0;
+	remain_  = 0;
+	deflated = false;
+}
+
+void Zip_File_Reader::close()
+{
+	in      = 0;
+	remain_ = 0;
+	#ifdef HAVE_ZLIB_H
+		inflater.close();
+	#endif
+}
+
+blargg_err_t Zip_File_Reader::open( Zip_Archive& archive, int i )
+{
+	close();
+	require( (unsigned) i < (unsigned) archive.count() );
+	Zip_Archive::entry_t const& e = archive.entries [i];
+	
+	if ( e.flags & 1 )
+		return "Encrypted file in zip archive";
+	if ( e.method != 0 && e.method != 8 )
+		return "Unsupported compression in zip archive";
+	
+	// Data follows local header, whose name and extra fields can differ from
+	// those in directory
+	byte header [header_size];
+	RETURN_ERR( archive.in->seek( e.offset ) );
+	RETURN_ERR( archive.in->read( header, sizeof header ) );
+	if ( get_le32( header ) != header_sig )
+		return "Corrupt zip archive";
+	RETURN_ERR( archive.in->skip( get_le16( header + 26 ) + get_le16( header + 28 ) ) );
+	if ( e.raw_size > archive.in->remain() )
+		return "Corrupt zip archive";
+	
+	deflated = (e.method == 8);
+	if ( deflated )
+	{
+		#ifdef HAVE_ZLIB_H
+			RETURN_ERR( inflater.open( archive.in, e.raw_size, e.size ) );
+		#else
+			return "Compressed files in zip archive require zlib";
+		#endif
+	}
+	else if ( e.raw_size != e.size )
+	{
+		return "Corrupt zip archive";
+	}
+	
+	in      = archive.in;
+	remain_ = e.size;
+	return 0;
+}
+
+long Zip_File_Reader::remain() const { return remain_; }
+
+long Zip_File_Reader::read_avail( void* p, long s )
+{
+	if ( s > remain_ )
+		s = remain_;
+	
+	#ifdef HAVE_ZLIB_H
+		if ( deflated )
+			s = inflater.read_avail( p, s );
+		else
+	#endif
+			s = in->read_avail( p, s );
+	
+	if ( s > 0 )
+		remain_ -= s;
+	return s;
+}
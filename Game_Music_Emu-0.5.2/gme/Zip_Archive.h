@@ -0,0 +1,85 @@
+// Zip archive reader that keeps the archive directory in memory
+
+// Game_Music_Emu 0.5.2
+#ifndef ZIP_ARCHIVE_H
+#define ZIP_ARCHIVE_H
+
+#include "Data_Reader.h"
+
+// Reads the directory of a zip archive once, so that its files can be read any
+// number of times without extracting them. Files can be stored or deflated (the
+// latter requires zlib; see HAVE_ZLIB_H).
+class Zip_Archive {
+public:
+	// Open archive file and read its directory
+	blargg_err_t open( const char* path );
+	
+	// Read directory of archive in reader, which must remain open while archive
+	// is in use
+	blargg_err_t open( File_Reader* );
+	
+	void close();
+	
+	// Number of files in archive, including entries for directories
+	int count() const                   { return entries.size(); }
+	
+	// Path of file i in archive, using '/' to separate directories
+	const char* name( int i ) const     { return &names [entries [i].name]; }
+	
+	// Size of file i when extracted
+	long size( int i ) const            { return entries [i].size; }
+	
+	// Index of file with path, or -1 if not found
+	int find( const char* path ) const;
+	
+	// Error returned if file isn't a zip archive
+	static const char not_zip [];
+
+public:
+	Zip_Archive();
+	~Zip_Archive();
+private:
+	struct entry_t
+	{
+		long name;     // offset in names
+		long size;
+		long raw_size; // size in archive
+		long offset;   // of file's local header
+		int method;
+		int flags;
+	};
+	Std_File_Reader file;
+	File_Reader* in;
+	blargg_vector<entry_t> entries;
+	blargg_vector<char> names;
+	
+	friend class Zip_File_Reader;
+	
+	// noncopyable
+	Zip_Archive( const Zip_Archive& );
+	Zip_Archive& operator = ( const Zip_Archive& );
+};
+
+// Reads file from archive as it's extracted. Only one file in an archive can be
+// read at a time, since they share the archive's reader.
+class Zip_File_Reader : public Data_Reader {
+public:
+	// Start reading file i from beginning
+	blargg_err_t open( Zip_Archive&, int i );
+	
+	void close();
+
+public:
+	Zip_File_Reader();
+	long remain() const;
+	long read_avail( void*, long );
+private:
+	File_Reader* in;
+	long remain_;
+	bool deflated;
+#ifdef HAVE_ZLIB_H
+	Inflate_Reader inflater;
+#endif
+};
+
+#endif
@@ -25,6 +25,53 @@
 	typedef const char* blargg_err_t;
 #endif
 
+// BLARGG_ALLOC_HOOK( size ): Invoked before library code allocates memory. Once a
+// file is loaded, Music_Emu doesn't allocate while playing, starting a track, seeking,
+// or changing tempo, so it can be used from a real-time audio thread. Debug builds
+// mark those calls with a blargg_no_alloc_t, and the default hook asserts that the
+// current thread isn't in one. Define your own in blargg_config.h to check otherwise.
+#ifndef BLARGG_ALLOC_HOOK
+	#if !defined (NDEBUG) && defined (_MSC_VER)
+		#define BLARGG_THREAD_LOCAL __declspec(thread)
+	#elif !defined (NDEBUG) && defined (__GNUC__)
+		#define BLARGG_THREAD_LOCAL __thread
+	#endif
+	
+	#ifdef BLARGG_THREAD_LOCAL
+		extern BLARGG_THREAD_LOCAL int blargg_no_alloc_depth;
+		#define BLARGG_ALLOC_HOOK( size ) \
+			assert( !blargg_no_alloc_depth ) // allocated while playing
+	#else
+		#define BLARGG_ALLOC_HOOK( size ) ((void) 0)
+	#endif
+#endif
+
+// BLARGG_MALLOC/BLARGG_REALLOC/BLARGG_FREE: Heap functions for per-emulator memory
+// (blargg_vector, Blip_Buffer, BLARGG_DISABLE_NOTHROW objects). Define
+// BLARGG_RETRO_ARENA to use retro_arena.h.
+#ifndef BLARGG_MALLOC
+	#ifdef BLARGG_RETRO_ARENA
+		#include "retro_arena.h"
+		#define BLARGG_MALLOC  retro_arena_malloc
+		#define BLARGG_REALLOC retro_arena_realloc
+		#define BLARGG_FREE    retro_arena_free
+	#else
+		#define BLARGG_MALLOC  malloc
+		#define BLARGG_REALLOC realloc
+		#define BLARGG_FREE    free
+	#endif
+#endif
+
+// Marks a call that mustn't allocate memory, for BLARGG_ALLOC_HOOK
+struct blargg_no_alloc_t {
+#ifdef BLARGG_THREAD_LOCAL
+	blargg_no_alloc_t()  { blargg_no_alloc_depth++; }
+	~blargg_no_alloc_t() { blargg_no_alloc_depth--; }
+#else
+	blargg_no_alloc_t() { }
+#endif
+};
+
 // blargg_vector - very lightweight vector of POD types (no constructor/destructor)
 template<class T>
 class blargg_vector {
@@ -32,20 +79,21 @@ class blargg_vector {
 	size_t size_;
 public:
 	blargg_vector() : begin_( 0 ), size_( 0 ) { }
-	~blargg_vector() { free( begin_ ); }
+	~blargg_vector() { BLARGG_FREE( begin_ ); }
 	size_t size() const { return size_; }
 	T* begin() const { return begin_; }
 	T* end() const { return begin_ + size_; }
 	blargg_err_t resize( size_t n )
 	{
-		void* p = realloc( begin_, n * sizeof (T) );
+		BLARGG_ALLOC_HOOK( n * sizeof (T) );
+		void* p = BLARGG_REALLOC( begin_, n * sizeof (T) );
 		if ( !p && n )
 			return "Out of memory";
 		begin_ = (T*) p;
 		size_ = n;
 		return 0;
 	}
-	void clear() { void* p = begin_; begin_ = 0; size_ = 0; free( p ); }
+	void clear() { void* p = begin_; begin_ = 0; size_ = 0; BLARGG_FREE( p ); }
 	T& operator [] ( size_t n ) const
 	{
 		assert( n <= size_ ); // <= to allow past-the-end value
@@ -60,17 +108,39 @@ public:
 		#define BLARGG_THROWS( spec ) throw spec
 	#endif
 	#define BLARGG_DISABLE_NOTHROW \
-		void* operator new ( size_t s ) BLARGG_THROWS(()) { return malloc( s ); }\
-		void operator delete ( void* p ) { free( p ); }
+		void* operator new ( size_t s ) BLARGG_THROWS(()) { BLARGG_ALLOC_HOOK( s ); return BLARGG_MALLOC( s ); }\
+		void operator delete ( void* p ) { BLARGG_FREE( p ); }
 	#define BLARGG_NEW new
 #else
 	#include <new>
 	#define BLARGG_NEW new (std::nothrow)
 #endif
 
+// BLARGG_ALIGN( n ): Placed before a declaration to align it to n bytes, where
+// supported by compiler
+#ifndef BLARGG_ALIGN
+	#if defined (_MSC_VER)
+		#define BLARGG_ALIGN( n ) __declspec(align(n))
+	#elif defined (__GNUC__)
+		#define BLARGG_ALIGN( n ) __attribute__((aligned(n)))
+	#else
+		#define BLARGG_ALIGN( n )
+	#endif
+#endif
+
 #define BLARGG_4CHAR( a, b, c, d ) \
 	((a&0xFF)*0x1000000L + (b&0xFF)*0x10000L + (c&0xFF)*0x100L + (d&0xFF))
 
+// State save/restore. An object's copy_state() passes each part of its state to a
+// blargg_copy_func_t, which copies size bytes from state to *io when saving, from
+// *io to state when loading, or only counts them, then advances *io. The one
+// function thus saves, loads and sizes state. Anything derived from the state is
+// updated afterwards, so copy_state() must also be safe to call when saving.
+typedef void (*blargg_copy_func_t)( unsigned char** io, void* state, size_t size );
+
+// Copies var with the 'copy' function and 'io' pointer in scope
+#define BLARGG_COPY( var ) copy( io, &(var), sizeof (var) )
+
 // BOOST_STATIC_ASSERT( expr ): Generates compile error if expr is 0.
 #ifndef BOOST_STATIC_ASSERT
 	#ifdef _MSC_VER
@@ -10,9 +10,37 @@
 // for a list of all types.
 //#define GME_TYPE_LIST gme_nsf_type, gme_gbs_type
 
+// Uncomment to disable loading of files by mapping them into memory
+//#define BLARGG_MAPPED_FILES 0
+
 // Uncomment to enable platform-specific optimizations
 #define BLARGG_NONPORTABLE 1
 
+// Uncomment to have Fir_Resampler generate its FIR code at run time for each
+// configuration using Xbyak (x86-64 only; xbyak.h and cpu_features.h must be in
+// the include path)
+//#define FIR_RESAMPLER_JIT 1
+
+// Uncomment to allocate blargg_vector storage, sound buffers and objects from
+// the arena set for the calling thread with retro_arena.h (which must be in
+// the include path)
+//#define BLARGG_RETRO_ARENA 1
+
+// Uncomment to have Nes_Cpu translate 6502 code to x86-64 code as it runs, for
+// faster NSF emulation (x86-64 only; xbyak.h must be in the include path).
+// Translating allocates memory, so it is meant for batch work such as length
+// probing, rather than a real-time audio thread.
+//#define NES_CPU_JIT 1
+
+// Uncomment to have the CPU cores jump to each instruction through a table of
+// label addresses rather than a switch statement. Needs GCC's labels-as-values
+// extension; ignored by other compilers.
+//#define BLARGG_COMPUTED_GOTO 1
+
+// Uncomment to count emulation work and time stages of sound generation, for
+// gme_get_stats(). Slows emulation slightly.
+//#define GME_STATS 1
+
 // Uncomment to use faster, lower quality sound synthesis
 //#define BLIP_BUFFER_FAST 1
 
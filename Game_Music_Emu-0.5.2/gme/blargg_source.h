@@ -61,6 +61,30 @@ inline T max( T x, T y )
 	return x;
 }
 
+// Case labels in a CPU core's opcode switch. With BLARGG_COMPUTED_GOTO, each also
+// defines a label (op_0xNN, or the given name) for the core's table of label
+// addresses. OP_DEFAULT labels the default case as op_default.
+#if BLARGG_COMPUTED_GOTO && !defined (__GNUC__)
+	#undef BLARGG_COMPUTED_GOTO // labels as values is a GCC extension
+#endif
+
+#if BLARGG_COMPUTED_GOTO
+	#define OP_CASE( n )                case n: op_##n
+	#define OP_CASE_NAMED( n, name )    case n: name
+	#define OP_DEFAULT                  default: op_default
+#else
+	#define OP_CASE( n )                case n
+	#define OP_CASE_NAMED( n, name )    case n
+	#define OP_DEFAULT                  default
+#endif
+
+// Adds one to a CPU core's instruction count, if GME_STATS is set
+#if GME_STATS
+	#define COUNT_INSTR()   ((void) instr_count_++)
+#else
+	#define COUNT_INSTR()   ((void) 0)
+#endif
+
 // TODO: good idea? bad idea?
 #undef byte
 #define byte byte_
@@ -0,0 +1,91 @@
+// Game_Music_Emu 0.5.2. http://www.slack.net/~ant/
+
+#include "blargg_tables.h"
+
+#include "blargg_thread.h"
+#include <string.h>
+#include <stdlib.h>
+
+/* Copyright (C) 2006 Shay Green. This module is free software; you
+can redistribute it and/or modify it under the terms of the GNU Lesser
+General Public License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version. This
+module is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+details. You should have received a copy of the GNU Lesser General Public
+License along with this module; if not, write to the Free Software Foundation,
+Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include "blargg_source.h"
+
+int const table_align = 64;
+
+// Allocated as one block: entry, key bytes, then table at next aligned address
+struct Shared_Table
+{
+	Shared_Table* next;
+	const char* name;
+	void* table;
+	int key_size;
+	
+	unsigned char const* key() const { return (unsigned char const*) (this + 1); }
+};
+
+class Shared_Tables {
+public:
+	blargg_mutex mutex;
+	Shared_Table* list;
+	
+	Shared_Tables() { list = 0; }
+	
+	// frees tables at exit so they don't show up as leaks
+	~Shared_Tables()
+	{
+		while ( list )
+		{
+			Shared_Table* next = list->next;
+			free( list );
+			list = next;
+		}
+	}
+};
+
+static Shared_Tables shared_tables;
+
+void const* blargg_shared_table( const char* name, void const* key, int key_size,
+		long size, blargg_table_builder_t build, void const* data )
+{
+	require( name && (key || !key_size) && size > 0 && build );
+	
+	// held while building, so other threads wanting any table wait until it's done
+	blargg_lock lock( shared_tables.mutex );
+	
+	Shared_Table* t = shared_tables.list;
+	for ( ; t; t = t->next )
+	{
+		if ( t->key_size == key_size && !strcmp( t->name, name ) &&
+				(!key_size || !memcmp( t->key(), key, key_size )) )
+			return t->table;
+	}
+	
+	BLARGG_ALLOC_HOOK( sizeof *t + key_size + table_align - 1 + size );
+	t = (Shared_Table*) malloc( sizeof *t + key_size + table_align - 1 + size );
+	if ( !t )
+		return 0;
+	
+	t->name     = name;
+	t->key_size = key_size;
+	if ( key_size )
+		memcpy( (void*) t->key(), key, key_size );
+	
+	unsigned char* table = (unsigned char*) t->key() + key_size;
+	table += (table_align - (size_t) table % table_align) % table_align;
+	t->table = table;
+	memset( t->table, 0, size );
+	build( t->table, t->key(), data );
+	
+	t->next = shared_tables.list;
+	shared_tables.list = t;
+	return t->table;
+}
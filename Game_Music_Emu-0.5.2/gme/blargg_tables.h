@@ -0,0 +1,22 @@
+// Read-only lookup tables built once and shared by all emulator instances
+
+// Game_Music_Emu 0.5.2
+#ifndef BLARGG_TABLES_H
+#define BLARGG_TABLES_H
+
+#include "blargg_common.h"
+
+// Fills table, which is zeroed beforehand. Key is the one passed to
+// blargg_shared_table().
+typedef void (*blargg_table_builder_t)( void* table, void const* key, void const* data );
+
+// Get table identified by name and key_size bytes at key, calling build( table, key, data )
+// to make it the first time it's requested. Where a table depends on parameters
+// (sample rate, etc.), they should be in the key, with any padding bytes cleared.
+// Table is aligned to 64 bytes, must not be modified once built, and stays until
+// program exit. Can be called from multiple threads; a table is only built once,
+// with other threads wanting it waiting. Returns NULL if out of memory.
+void const* blargg_shared_table( const char* name, void const* key, int key_size,
+		long size, blargg_table_builder_t build, void const* data = 0 );
+
+#endif
@@ -0,0 +1,256 @@
+// Minimal thread, mutex and condition variable wrappers (Win32 or POSIX threads)
+
+// Game_Music_Emu 0.5.2
+#ifndef BLARGG_THREAD_H
+#define BLARGG_THREAD_H
+
+#include "blargg_common.h"
+
+#if defined (_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <pthread.h>
+	#include <unistd.h>
+#endif
+
+// Library code must include this before blargg_source.h, since windows.h
+// could otherwise interfere with its definitions.
+
+class blargg_mutex {
+public:
+	blargg_mutex();
+	~blargg_mutex();
+	void lock();
+	void unlock();
+private:
+#if defined (_WIN32)
+	CRITICAL_SECTION cs;
+#else
+	pthread_mutex_t mutex;
+#endif
+	friend class blargg_cond;
+
+	// noncopyable
+	blargg_mutex( const blargg_mutex& );
+	blargg_mutex& operator = ( const blargg_mutex& );
+};
+
+// Locks mutex for lifetime of object
+class blargg_lock {
+public:
+	blargg_lock( blargg_mutex& m ) : mutex( m ) { m.lock(); }
+	~blargg_lock()                              { mutex.unlock(); }
+private:
+	blargg_mutex& mutex;
+	blargg_lock( const blargg_lock& );
+	blargg_lock& operator = ( const blargg_lock& );
+};
+
+class blargg_cond {
+public:
+	blargg_cond();
+	~blargg_cond();
+
+	// Mutex must be locked by caller
+	void wait( blargg_mutex& );
+	void signal();
+	void broadcast();
+private:
+#if defined (_WIN32)
+	CONDITION_VARIABLE cond;
+#else
+	pthread_cond_t cond;
+#endif
+	blargg_cond( const blargg_cond& );
+	blargg_cond& operator = ( const blargg_cond& );
+};
+
+class blargg_thread {
+public:
+	typedef void (*func_t)( void* data );
+
+	// Start thread running func( data )
+	blargg_err_t start( func_t, void* data );
+
+	// Wait for thread to finish. Does nothing if thread wasn't started.
+	void join();
+
+	// Number of processors available, at least 1
+	static int cpu_count();
+
+	// Suspend calling thread for at least msec milliseconds
+	static void sleep( int msec );
+
+public:
+	blargg_thread() : started( false ) { }
+	~blargg_thread() { join(); }
+private:
+	func_t func;
+	void* data;
+	bool started;
+#if defined (_WIN32)
+	HANDLE handle;
+	static DWORD WINAPI entry( LPVOID self );
+#else
+	pthread_t handle;
+	static void* entry( void* self );
+#endif
+	blargg_thread( const blargg_thread& );
+	blargg_thread& operator = ( const blargg_thread& );
+};
+
+// Value shared between threads without a mutex. Memory writes made before set()
+// are visible to another thread once its get() returns the new value.
+class blargg_atomic {
+public:
+	long get() const;
+	void set( long );
+
+	blargg_atomic( long n = 0 ) : value( n ) { }
+private:
+#if defined (_WIN32)
+	LONG volatile value;
+#else
+	long volatile value;
+#endif
+};
+
+#if defined (_WIN32)
+
+inline blargg_mutex::blargg_mutex()         { InitializeCriticalSection( &cs ); }
+inline blargg_mutex::~blargg_mutex()        { DeleteCriticalSection( &cs ); }
+inline void blargg_mutex::lock()            { EnterCriticalSection( &cs ); }
+inline void blargg_mutex::unlock()          { LeaveCriticalSection( &cs ); }
+
+inline blargg_cond::blargg_cond()           { InitializeConditionVariable( &cond ); }
+inline blargg_cond::~blargg_cond()          { }
+inline void blargg_cond::wait( blargg_mutex& m ) { SleepConditionVariableCS( &cond, &m.cs, INFINITE ); }
+inline void blargg_cond::signal()           { WakeConditionVariable( &cond ); }
+inline void blargg_cond::broadcast()        { WakeAllConditionVariable( &cond ); }
+
+inline DWORD WINAPI blargg_thread::entry( LPVOID self )
+{
+	blargg_thread* t = (blargg_thread*) self;
+	t->func( t->data );
+	return 0;
+}
+
+inline blargg_err_t blargg_thread::start( func_t f, void* d )
+{
+	join();
+	func = f;
+	data = d;
+	handle = CreateThread( 0, 0, entry, this, 0, 0 );
+	if ( !handle )
+		return "Couldn't create thread";
+	started = true;
+	return 0;
+}
+
+inline void blargg_thread::join()
+{
+	if ( started )
+	{
+		WaitForSingleObject( handle, INFINITE );
+		CloseHandle( handle );
+		started = false;
+	}
+}
+
+inline int blargg_thread::cpu_count()
+{
+	SYSTEM_INFO info;
+	GetSystemInfo( &info );
+	return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+}
+
+inline void blargg_thread::sleep( int msec ) { Sleep( msec ); }
+
+// Interlocked functions are full barriers
+inline long blargg_atomic::get() const
+{
+	return InterlockedCompareExchange( const_cast<LONG volatile*> (&value), 0, 0 );
+}
+
+inline void blargg_atomic::set( long n ) { InterlockedExchange( &value, n ); }
+
+#else
+
+inline blargg_mutex::blargg_mutex()         { pthread_mutex_init( &mutex, 0 ); }
+inline blargg_mutex::~blargg_mutex()        { pthread_mutex_destroy( &mutex ); }
+inline void blargg_mutex::lock()            { pthread_mutex_lock( &mutex ); }
+inline void blargg_mutex::unlock()          { pthread_mutex_unlock( &mutex ); }
+
+inline blargg_cond::blargg_cond()           { pthread_cond_init( &cond, 0 ); }
+inline blargg_cond::~blargg_cond()          { pthread_cond_destroy( &cond ); }
+inline void blargg_cond::wait( blargg_mutex& m ) { pthread_cond_wait( &cond, &m.mutex ); }
+inline void blargg_cond::signal()           { pthread_cond_signal( &cond ); }
+inline void blargg_cond::broadcast()        { pthread_cond_broadcast( &cond ); }
+
+inline void* blargg_thread::entry( void* self )
+{
+	blargg_thread* t = (blargg_thread*) self;
+	t->func( t->data );
+	return 0;
+}
+
+inline blargg_err_t blargg_thread::start( func_t f, void* d )
+{
+	join();
+	func = f;
+	data = d;
+	if ( pthread_create( &handle, 0, entry, this ) )
+		return "Couldn't create thread";
+	started = true;
+	return 0;
+}
+
+inline void blargg_thread::join()
+{
+	if ( started )
+	{
+		pthread_join( handle, 0 );
+		started = false;
+	}
+}
+
+inline int blargg_thread::cpu_count()
+{
+	#ifdef _SC_NPROCESSORS_ONLN
+		long n = sysconf( _SC_NPROCESSORS_ONLN );
+		if ( n > 0 )
+			return (int) n;
+	#endif
+	return 1;
+}
+
+inline void blargg_thread::sleep( int msec ) { usleep( msec * 1000L ); }
+
+#if defined (__ATOMIC_ACQUIRE)
+	inline long blargg_atomic::get() const  { return __atomic_load_n( &value, __ATOMIC_ACQUIRE ); }
+	inline void blargg_atomic::set( long n ) { __atomic_store_n( &value, n, __ATOMIC_RELEASE ); }
+#else
+	// older GCC
+	inline long blargg_atomic::get() const
+	{
+		long n = value;
+		__sync_synchronize();
+		return n;
+	}
+
+	inline void blargg_atomic::set( long n )
+	{
+		__sync_synchronize();
+		value = n;
+	}
+#endif
+
+#endif
+
+#endif
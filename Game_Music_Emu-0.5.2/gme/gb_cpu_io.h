@@ -28,6 +28,7 @@ void Gbs_Emu::cpu_write( gb_addr_t addr, int data )
 			if ( unsigned (addr - Gb_Apu::start_addr) < Gb_Apu::register_count )
 			{
 				GME_APU_HOOK( this, addr - Gb_Apu::start_addr, data );
+				count_apu_write();
 				apu.write_register( clock(), addr, data );
 			}
 			else if ( (addr ^ 0xFF06) < 2 )
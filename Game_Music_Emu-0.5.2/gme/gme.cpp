@@ -4,8 +4,11 @@
 
 #if !GME_DISABLE_STEREO_DEPTH
 #include "Effects_Buffer.h"
+#include "Multitrack_Buffer.h"
 #endif
+#include "Zip_Archive.h"
 #include "blargg_endian.h"
+#include "blargg_thread.h"
 #include <string.h>
 #include <ctype.h>
 
@@ -48,6 +51,66 @@ gme_type_t const* gme_type_list()
 	return gme_type_list_;
 }
 
+int gme_type_caps( gme_type_t type ) { return type->caps_; }
+
+// Measured cost of each type, from gme_record_cost()
+struct gme_type_cost_t
+{
+	gme_type_t type;
+	double play_msec;
+	double played_sec;
+};
+static gme_type_cost_t type_costs [sizeof gme_type_list_ / sizeof gme_type_list_ [0]];
+static blargg_mutex type_costs_mutex;
+
+// Entry for type, or NULL if type isn't in list (and table is full)
+static gme_type_cost_t* find_type_cost( gme_type_t type )
+{
+	int const max_costs = sizeof type_costs / sizeof type_costs [0];
+	for ( int i = 0; i < max_costs; i++ )
+	{
+		gme_type_cost_t& c = type_costs [i];
+		if ( !c.type )
+			c.type = type;
+		if ( c.type == type )
+			return &c;
+	}
+	return 0;
+}
+
+gme_cost_t gme_type_cost( gme_type_t type )
+{
+	gme_cost_t out;
+	out.clocks_per_sec = type->clock_rate_;
+	out.cpu_per_sec    = 0;
+	out.measured_sec   = 0;
+	
+	blargg_lock lock( type_costs_mutex );
+	gme_type_cost_t const* c = find_type_cost( type );
+	if ( c && c->played_sec > 0 )
+	{
+		out.cpu_per_sec  = c->play_msec / 1000 / c->played_sec;
+		out.measured_sec = c->played_sec;
+	}
+	return out;
+}
+
+void gme_record_cost( Music_Emu const* me )
+{
+	gme_stats_t stats;
+	me->get_stats( &stats );
+	if ( stats.played_frames <= 0 || me->sample_rate() <= 0 )
+		return;
+	
+	blargg_lock lock( type_costs_mutex );
+	gme_type_cost_t* c = find_type_cost( me->type() );
+	if ( c )
+	{
+		c->play_msec  += stats.play_msec;
+		c->played_sec += stats.played_frames / me->sample_rate();
+	}
+}
+
 const char* gme_identify_header( void const* header )
 {
 	switch ( get_be32( header ) )
@@ -136,13 +199,34 @@ gme_err_t gme_open_file( const char* path, Music_Emu** out, long sample_rate )
 	require( path && out );
 	*out = 0;
 	
+	gme_type_t file_type = gme_identify_extension( path );
+	
+	// use data directly from file if possible
+	Mapped_File_Reader mapped;
+	if ( !mapped.open( path ) )
+	{
+		if ( !file_type && mapped.size() >= 4 )
+			file_type = gme_identify_extension( gme_identify_header( mapped.data() ) );
+		if ( !file_type )
+			return gme_wrong_file_type;
+		
+		Music_Emu* emu = gme_new_emu( file_type, sample_rate );
+		CHECK_ALLOC( emu );
+		
+		gme_err_t err = emu->load_mapped( mapped );
+		if ( err )
+			delete emu;
+		else
+			*out = emu;
+		return err;
+	}
+	
 	GME_FILE_READER in;
 	RETURN_ERR( in.open( path ) );
 	
 	char header [4];
 	int header_size = 0;
 	
-	gme_type_t file_type = gme_identify_extension( path );
 	if ( !file_type )
 	{
 		header_size = sizeof header;
@@ -201,6 +285,36 @@ Music_Emu* gme_new_emu( gme_type_t type, long rate )
 	return 0;
 }
 
+Music_Emu* gme_new_emu_multitrack( gme_type_t type, long rate )
+{
+	if ( !type || rate == gme_info_only )
+		return gme_new_emu( type, rate );
+	
+	Music_Emu* me = type->new_emu();
+	if ( me )
+	{
+		// silence detection buffers mixed sound
+		me->ignore_silence();
+		
+		// other types can't use a custom buffer, so play_multitrack() reports an error
+		if ( type->flags_ & 1 )
+		{
+			me->multitrack_buffer_ = BLARGG_NEW Multitrack_Buffer;
+			me->effects_buffer = me->multitrack_buffer_;
+			if ( me->effects_buffer )
+				me->set_buffer( me->effects_buffer );
+		}
+		
+		if ( !(type->flags_ & 1) || me->effects_buffer )
+		{
+			if ( !me->set_sample_rate( rate ) )
+				return me;
+		}
+		delete me;
+	}
+	return 0;
+}
+
 gme_err_t gme_load_file( Music_Emu* me, const char* path ) { return me->load_file( path ); }
 
 gme_err_t gme_load_data( Music_Emu* me, void const* data, long size )
@@ -215,6 +329,106 @@ gme_err_t gme_load_custom( Music_Emu* me, gme_reader_t func, long size, void* da
 	return me->load( in );
 }
 
+// Zip archives
+
+struct gme_archive_t : Zip_Archive { };
+
+gme_err_t gme_open_archive( const char* path, gme_archive_t** out )
+{
+	require( path && out );
+	*out = 0;
+	
+	gme_archive_t* archive = BLARGG_NEW gme_archive_t;
+	CHECK_ALLOC( archive );
+	
+	gme_err_t err = archive->open( path );
+	if ( err )
+		delete archive;
+	else
+		*out = archive;
+	return err;
+}
+
+int gme_archive_count( gme_archive_t const* archive ) { return archive->count(); }
+
+const char* gme_archive_name( gme_archive_t const* archive, int i )
+{
+	if ( (unsigned) i >= (unsigned) archive->count() )
+		return 0;
+	return archive->name( i );
+}
+
+void gme_delete_archive( gme_archive_t* archive ) { delete archive; }
+
+// Loads data into *emu_io, first creating emulator for it if *emu_io is NULL
+static gme_err_t load_archived( Data_Reader& in, const char* path, Music_Emu** emu_io,
+		long sample_rate )
+{
+	byte header [4];
+	long header_size = min( in.remain(), (long) sizeof header );
+	RETURN_ERR( in.read( header, header_size ) );
+	Remaining_Reader rem( header, header_size, &in );
+	
+	if ( header_size >= 2 && header [0] == 0x1F && header [1] == 0x8B )
+	{
+	#ifdef HAVE_ZLIB_H
+		// size of decompressed data is at end of gzip file, so read all of it
+		long size = rem.remain();
+		if ( size < 4 )
+			return "Corrupt gzip file";
+		blargg_vector<byte> data;
+		RETURN_ERR( data.resize( size ) );
+		RETURN_ERR( rem.read( data.begin(), size ) );
+		
+		Mem_File_Reader mem( data.begin(), size );
+		Inflate_Reader inflater;
+		RETURN_ERR( inflater.open( &mem, size, get_le32( &data [size - 4] ), Inflate_Reader::gzip ) );
+		return load_archived( inflater, path, emu_io, sample_rate );
+	#else
+		return "Gzipped files require zlib";
+	#endif
+	}
+	
+	Music_Emu* emu = *emu_io;
+	if ( !emu )
+	{
+		gme_type_t file_type = gme_identify_extension( path );
+		if ( !file_type && header_size == sizeof header )
+			file_type = gme_identify_extension( gme_identify_header( header ) );
+		if ( !file_type )
+			return gme_wrong_file_type;
+		
+		emu = gme_new_emu( file_type, sample_rate );
+		CHECK_ALLOC( emu );
+	}
+	
+	gme_err_t err = emu->load( rem );
+	if ( err )
+	{
+		if ( emu != *emu_io )
+			delete emu;
+		return err;
+	}
+	*emu_io = emu;
+	return 0;
+}
+
+gme_err_t gme_archive_open_emu( gme_archive_t* archive, int i, Music_Emu** out, long sample_rate )
+{
+	require( out );
+	*out = 0;
+	Zip_File_Reader in;
+	RETURN_ERR( in.open( *archive, i ) );
+	return load_archived( in, archive->name( i ), out, sample_rate );
+}
+
+gme_err_t gme_archive_load( gme_archive_t* archive, int i, Music_Emu* me )
+{
+	Zip_File_Reader in;
+	RETURN_ERR( in.open( *archive, i ) );
+	return load_archived( in, archive->name( i ), &me, 0 );
+}
+
 void gme_delete( Music_Emu* me ) { delete me; }
 
 gme_type_t gme_type( Music_Emu const* me ) { return me->type(); }
@@ -231,7 +445,7 @@ const char* gme_track_info( Music_Emu const* me, track_info_t* out, int track )
 void gme_set_stereo_depth( Music_Emu* me, double depth )
 {
 #if !GME_DISABLE_STEREO_DEPTH
-	if ( me->effects_buffer )
+	if ( me->effects_buffer && !me->multitrack_buffer_ )
 		STATIC_CAST(Effects_Buffer*,me->effects_buffer)->set_depth( depth );
 #endif
 }
@@ -242,13 +456,26 @@ void      gme_set_user_cleanup(Music_Emu* me, gme_user_cleanup_t func ) { me->se
 
 gme_err_t gme_start_track    ( Music_Emu* me, int index )           { return me->start_track( index ); }
 gme_err_t gme_play           ( Music_Emu* me, long n, short* p )    { return me->play( n, p ); }
+gme_err_t gme_play_multitrack( Music_Emu* me, long n, short* const out [] ) { return me->play_multitrack( n, out ); }
 void      gme_set_fade       ( Music_Emu* me, long start_msec )     { me->set_fade( start_msec ); }
 int       gme_track_ended    ( Music_Emu const* me )                { return me->track_ended(); }
 long      gme_tell           ( Music_Emu const* me )                { return me->tell(); }
 gme_err_t gme_seek           ( Music_Emu* me, long msec )           { return me->seek( msec ); }
+void      gme_set_seek_index ( Music_Emu* me, long msec, int max )  { me->set_seek_index( msec, max ); }
+gme_err_t gme_save_state     ( Music_Emu* me, void* out )           { return me->save_state( out ); }
+long      gme_state_size     ( Music_Emu* me )                      { return me->state_size(); }
+gme_err_t gme_load_state     ( Music_Emu* me, void const* in, long size ) { return me->load_state( in, size ); }
+gme_err_t gme_probe_length   ( Music_Emu* me, int track, long max, gme_length_t* out ) { return me->probe_length( track, max, out ); }
+void      gme_get_stats      ( Music_Emu const* me, gme_stats_t* out ) { me->get_stats( out ); }
+void      gme_clear_stats    ( Music_Emu* me )                      { me->clear_stats(); }
 int       gme_voice_count    ( Music_Emu const* me )                { return me->voice_count(); }
 void      gme_ignore_silence ( Music_Emu* me, int disable )         { me->ignore_silence( disable != 0 ); }
+void      gme_set_resampler_width( Music_Emu* me, int points )      { me->set_resampler_width( points ); }
+void      gme_enable_float   ( Music_Emu* me, int enable )          { me->set_float_output( enable != 0 ); }
+gme_err_t gme_play_float     ( Music_Emu* me, long n, float* p )    { return me->play( n, p ); }
 void      gme_set_tempo      ( Music_Emu* me, double t )            { me->set_tempo( t ); }
+gme_err_t gme_change_sample_rate( Music_Emu* me, long rate )        { return me->change_sample_rate( rate ); }
+gme_err_t gme_set_minimal_buffers( Music_Emu* me, int enable )      { return me->set_minimal_buffers( enable != 0 ); }
 void      gme_mute_voice     ( Music_Emu* me, int index, int mute ) { me->mute_voice( index, mute != 0 ); }
 void      gme_mute_voices    ( Music_Emu* me, int mask )            { me->mute_voices( mask ); }
 void      gme_set_equalizer  ( Music_Emu* me, gme_equalizer_t const* eq ) { me->set_equalizer( *eq ); }
@@ -45,9 +45,45 @@ int gme_track_ended( Music_Emu const* );
 /* Number of milliseconds (1000 = one second) played since beginning of track */
 long gme_tell( Music_Emu const* );
 
-/* Seek to new time in track. Seeking backwards or far forward can take a while. */
+/* Seek to new time in track. Seeking backwards or far forward can take a while,
+unless a seek index has been enabled with gme_set_seek_index(). */
 gme_err_t gme_seek( Music_Emu*, long msec );
 
+/* Record emulator state every interval_msec of the current track, keeping at most
+max_count snapshots, so gme_seek() resumes from the nearest one rather than replaying
+the track from the beginning. Pass 0 to disable. */
+void gme_set_seek_index( Music_Emu*, long interval_msec, int max_count );
+
+/* Save state of current track to out, which must have room for gme_state_size() bytes,
+so gme_load_state() can later continue playing from that point without emulating the
+track from the beginning. State covers emulated hardware, sound buffers and position,
+but not settings such as fade and muting. It can only be loaded into the same Music_Emu
+with the same file loaded, and at the same sample rate and tempo. */
+gme_err_t gme_save_state( Music_Emu*, void* out );
+
+/* Size of state saved by gme_save_state(), or 0 if music type doesn't support it */
+long gme_state_size( Music_Emu* );
+
+/* Restore state saved by gme_save_state(). Returns error without changing anything if
+state doesn't match this emulator, file, sample rate and tempo. */
+gme_err_t gme_load_state( Music_Emu*, void const* in, long size );
+
+/* Times in milliseconds found by gme_probe_length(); -1 if not found */
+typedef struct gme_length_t
+{
+	long length;        /* when track ended or went silent */
+	long intro_length;  /* when music began repeating */
+	long loop_length;   /* length of repeated part */
+} gme_length_t;
+
+/* Find length of a track by running it quickly without generating sound, for at most
+max_msec. Sets out->length if track ends or goes silent, otherwise intro_length and
+loop_length if its music repeats. Repeats are found by recognizing memory and sound
+registers that match an earlier call of the music's play routine, which NSF, GBS, HES,
+KSS and SAP support; other types only find the end. Starts the track, so start it again
+before playing. */
+gme_err_t gme_probe_length( Music_Emu*, int track, long max_msec, gme_length_t* out );
+
 
 /******** Informational ********/
 
@@ -97,14 +133,34 @@ enum { gme_max_field = 255 };
 GYM, SPC, and Sega Genesis VGM music */
 void gme_set_stereo_depth( Music_Emu*, double depth );
 
+/* Set number of points in the resampling filter used for SPC, GYM, and Sega Genesis
+VGM music, from 4 to 32 in multiples of 4. More points give better quality and take
+longer. Default is 24 for SPC and 12 for the others. Has no effect for other types. */
+void gme_set_resampler_width( Music_Emu*, int points );
+
 /* Disable automatic end-of-track detection and skipping of silence at beginning
 if ignore is true */
 void gme_ignore_silence( Music_Emu*, int ignore );
 
+/* Generate 32-bit floating-point samples rather than 16-bit ones, starting with the
+next track started. Samples must then be generated with gme_play_float(). */
+void gme_enable_float( Music_Emu*, int enable );
+
+/* Generate 'count' floating-point samples into 'out', where 1.0 corresponds to 32768
+from gme_play(). Samples aren't clipped, so they can exceed 1.0. Sound from emulators
+which don't mix in Blip_Buffer (SPC, GYM, and Sega Genesis VGM) is converted from
+16-bit samples. */
+gme_err_t gme_play_float( Music_Emu*, long count, float* out );
+
 /* Adjust song tempo, where 1.0 = normal, 0.5 = half speed, 2.0 = double speed.
 Track length as returned by track_info() assumes a tempo of 1.0. */
 void gme_set_tempo( Music_Emu*, double tempo );
 
+/* Change output sample rate without reloading, even while a track is playing, for
+when the output device changes rate. Position, fade and emulator state are kept.
+If this fails, load the file again at the new rate. */
+gme_err_t gme_change_sample_rate( Music_Emu*, long sample_rate );
+
 /* Number of voices used by currently loaded file */
 int gme_voice_count( Music_Emu const* );
 
@@ -118,6 +174,13 @@ void gme_mute_voice( Music_Emu*, int index, int mute );
 voices, 0 unmutes them all, 0x01 mutes just the first voice, etc. */
 void gme_mute_voices( Music_Emu*, int muting_mask );
 
+/* Generate 'count' 16-bit mono samples for each voice into out [0] to
+out [gme_voice_count() - 1], with a single run of the emulator, for separately
+recording each voice. Voices where out [i] is NULL are discarded. Emulator must have
+been created with gme_new_emu_multitrack(). Not supported for GYM, SPC, and Sega
+Genesis VGM music. */
+gme_err_t gme_play_multitrack( Music_Emu*, long count, short* const out [] );
+
 /* Frequency equalizer parameters (see gme.txt) */
 typedef struct gme_equalizer_t
 {
@@ -132,6 +195,33 @@ gme_equalizer_t gme_equalizer( Music_Emu const* );
 void gme_set_equalizer( Music_Emu*, gme_equalizer_t const* eq );
 
 
+/******** Performance statistics ********/
+
+/* Emulation work done since emulator was created or gme_clear_stats() was last called.
+Only counted if library was built with GME_STATS set to 1 (see blargg_config.h);
+otherwise everything is zero. Counts are doubles so they can't overflow. */
+typedef struct gme_stats_t
+{
+	double cpu_instructions; /* instructions run by emulated CPU */
+	double apu_writes;       /* writes to sound chip registers */
+	double synth_updates;    /* amplitude changes added to Blip_Buffers */
+	double resampled_frames; /* stereo frames generated by resampling filter */
+	
+	/* wall time in milliseconds */
+	double emulate_msec;     /* running CPU and sound chips */
+	double mix_msec;         /* reading, mixing, and resampling their sound */
+	double play_msec;        /* total in the gme_play functions and gme_seek() */
+	
+	double played_frames;    /* stereo frames returned by the gme_play functions */
+} gme_stats_t;
+
+/* Get statistics for emulator work so far */
+void gme_get_stats( Music_Emu const*, gme_stats_t* out );
+
+/* Reset statistics to zero */
+void gme_clear_stats( Music_Emu* );
+
+
 
 /******** Game music types ********/
 
@@ -148,6 +238,8 @@ struct gme_type_t_
 	/* internal */
 	const char* extension_;
 	int flags_;
+	int caps_;
+	long clock_rate_;
 };
 
 /* Emulator type constants for each supported file type */
@@ -162,6 +254,34 @@ gme_type_t gme_type( Music_Emu const* );
 to this library to support new music types without having to be updated. */
 gme_type_t const* gme_type_list();
 
+/* Capabilities of a music type, as bits returned by gme_type_caps() */
+enum {
+	gme_caps_fast_skip  = 0x01, /* skipping and seeking run faster than playing */
+	gme_caps_state      = 0x02, /* gme_save_state() and gme_set_seek_index() work */
+	gme_caps_multi_chip = 0x04, /* files can use more than one sound chip */
+	gme_caps_float      = 0x08, /* generates floating-point samples directly rather than
+	                               converting 16-bit ones (gme_play_float() works for all) */
+	gme_caps_find_loop  = 0x10  /* gme_probe_length() can find where music repeats */
+};
+int gme_type_caps( gme_type_t );
+
+/* Cost of emulating a music type, for scheduling many jobs */
+typedef struct gme_cost_t
+{
+	double clocks_per_sec; /* emulated clocks per second of output (nominal; some files
+	                          change the clock rate) */
+	double cpu_per_sec;    /* measured wall time per second of output, for one stream,
+	                          or 0 if nothing has been measured yet */
+	double measured_sec;   /* seconds of output that cpu_per_sec is based on */
+} gme_cost_t;
+gme_cost_t gme_type_cost( gme_type_t );
+
+/* Add emulator's statistics (see gme_get_stats()) to the measured cost of its type.
+Call before deleting emulator or clearing its statistics. Can be called from several
+threads at once. Does nothing unless library was built with GME_STATS set to 1.
+gme_render_batch() does this for each job. */
+void gme_record_cost( Music_Emu const* );
+
 
 /******** Advanced file loading ********/
 
@@ -187,6 +307,18 @@ gme_err_t gme_identify_file( const char* path, gme_type_t* type_out );
 track information, pass gme_info_only for sample_rate. */
 Music_Emu* gme_new_emu( gme_type_t, long sample_rate );
 
+/* Same as gme_new_emu(), but emulator can also generate each voice separately with
+gme_play_multitrack(). Silence detection is disabled, as with gme_ignore_silence(),
+and gme_set_stereo_depth() has no effect. */
+Music_Emu* gme_new_emu_multitrack( gme_type_t, long sample_rate );
+
+/* Size emulator's sound buffers for one short frame rather than the default length,
+reducing memory use when running many emulators at once, at the cost of some speed.
+Since frames then end at different times, Game Boy (GBS) and Sega Master System/Game
+Gear (VGM with PSG) samples differ slightly, by up to a few hundred; other types
+are unchanged. Must be called before loading a file. */
+gme_err_t gme_set_minimal_buffers( Music_Emu*, int enable );
+
 /* Load music file into emulator */
 gme_err_t gme_load_file( Music_Emu*, const char* path );
 
@@ -202,6 +334,33 @@ gme_err_t gme_load_custom( Music_Emu*, gme_reader_t, long file_size, void* your_
 gme_err_t gme_load_m3u_data( Music_Emu*, void const* data, long size );
 
 
+/******** Zip archives ********/
+
+/* Zip archive whose directory is read once when opened, so that files in it can be
+loaded any number of times without extracting them. Files can be stored or deflated
+(deflated ones require zlib), and gzipped files such as VGZ are decompressed too. */
+typedef struct gme_archive_t gme_archive_t;
+
+/* Open zip archive and read its directory */
+gme_err_t gme_open_archive( const char* path, gme_archive_t** out );
+
+/* Number of files in archive, including entries for directories */
+int gme_archive_count( gme_archive_t const* );
+
+/* Path of file in archive, where 0 is the first file, or NULL if there is no such
+file. Valid until archive is deleted. */
+const char* gme_archive_name( gme_archive_t const*, int index );
+
+/* Same as gme_open_file(), but opens file in archive */
+gme_err_t gme_archive_open_emu( gme_archive_t*, int index, Music_Emu** out, long sample_rate );
+
+/* Same as gme_load_file(), but loads file in archive into emulator */
+gme_err_t gme_archive_load( gme_archive_t*, int index, Music_Emu* );
+
+/* Close archive and free its memory */
+void gme_delete_archive( gme_archive_t* );
+
+
 /******** User data ********/
 
 /* Set/get pointer to data you want to associate with this emulator.
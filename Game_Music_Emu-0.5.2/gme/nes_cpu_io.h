@@ -28,7 +28,11 @@ int Nsf_Emu::cpu_read( nes_addr_t addr )
 	
 	#if !NSF_EMU_APU_ONLY
 		if ( addr == Nes_Namco_Apu::data_reg_addr && namco )
+		{
+			if ( workers [namco_chip] )
+				run_chip_writes( namco_chip ); // read must see logged writes
 			return namco->read_data();
+		}
 	#endif
 	
 	result = addr >> 8; // simulate open bus
@@ -62,6 +66,7 @@ void Nsf_Emu::cpu_write( nes_addr_t addr, int data )
 	if ( unsigned (addr - Nes_Apu::start_addr) <= Nes_Apu::end_addr - Nes_Apu::start_addr )
 	{
 		GME_APU_HOOK( this, addr - Nes_Apu::start_addr, data );
+		probe_apu_write( addr - Nes_Apu::start_addr, data );
 		apu.write_register( cpu::time(), addr, data );
 		return;
 	}
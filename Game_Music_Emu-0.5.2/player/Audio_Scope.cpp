@@ -20,11 +20,123 @@ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
 IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-int const step_bits = 8;
-int const step_unit = 1 << step_bits;
 int const erase_color = 1;
 int const draw_color = 2;
 
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SCOPE_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// Scope_Buffer
+
+Scope_Buffer::Scope_Buffer()
+{
+	data = 0;
+	width = 0;
+	levels = 0;
+}
+
+Scope_Buffer::~Scope_Buffer()
+{
+	free( data );
+}
+
+const char* Scope_Buffer::init( int w, int n )
+{
+	assert( w > 0 && n > 0 && n <= max_levels );
+	assert( !data ); // can only call init() once
+	
+	width = w;
+	levels = n;
+	long total = 0;
+	for ( int i = 0; i < n; i++ )
+	{
+		offsets [i] = total;
+		total += level_width( i );
+	}
+	
+	data = (range_t*) calloc( total, sizeof *data );
+	if ( !data )
+		return "Out of memory";
+	
+	return 0; // success
+}
+
+static Scope_Buffer::range_t find_range( const short* in, long count )
+{
+	int min = 0x7FFF;
+	int max = -0x8000;
+	
+	#if SCOPE_SSE2
+		__m128i vmin = _mm_set1_epi16( 0x7FFF );
+		__m128i vmax = _mm_set1_epi16( -0x8000 );
+		for ( ; count >= 8; count -= 8, in += 8 )
+		{
+			__m128i s = _mm_loadu_si128( (__m128i const*) in );
+			vmin = _mm_min_epi16( vmin, s );
+			vmax = _mm_max_epi16( vmax, s );
+		}
+		short lanes [2] [8];
+		_mm_storeu_si128( (__m128i*) lanes [0], vmin );
+		_mm_storeu_si128( (__m128i*) lanes [1], vmax );
+		for ( int i = 0; i < 8; i++ )
+		{
+			if ( min > lanes [0] [i] ) min = lanes [0] [i];
+			if ( max < lanes [1] [i] ) max = lanes [1] [i];
+		}
+	#endif
+	
+	while ( count-- )
+	{
+		int s = *in++;
+		if ( min > s ) min = s;
+		if ( max < s ) max = s;
+	}
+	
+	Scope_Buffer::range_t r;
+	r.min = (short) min;
+	r.max = (short) max;
+	return r;
+}
+
+void Scope_Buffer::write( const short* in, long count )
+{
+	// finest level; spreads samples evenly, repeating them if there are too few
+	range_t* out = data + offsets [0];
+	int n = level_width( 0 );
+	for ( int i = 0; i < n; i++ )
+	{
+		long begin = count * i / n;
+		long end = count * (i + 1) / n;
+		if ( end <= begin )
+			end = begin + 1;
+		if ( end > count )
+		{
+			out [i].min = out [i].max = 0;
+			continue;
+		}
+		out [i] = find_range( in + begin, end - begin );
+	}
+	
+	// each higher level from pairs of the one below
+	for ( int l = 1; l < levels; l++ )
+	{
+		range_t const* below = data + offsets [l - 1];
+		range_t* out = data + offsets [l];
+		int n = level_width( l );
+		for ( int i = 0; i < n; i++ )
+		{
+			range_t a = below [i * 2];
+			range_t b = below [i * 2 + 1];
+			out [i].min = (a.min < b.min ? a.min : b.min);
+			out [i].max = (a.max > b.max ? a.max : b.max);
+		}
+	}
+}
+
+// Audio_Scope
+
 Audio_Scope::Audio_Scope()
 {
 	surface = 0;
@@ -44,7 +156,7 @@ const char* Audio_Scope::init( int width, int height )
 	assert( height <= 256 );
 	assert( !buf ); // can only call init() once
 	
-	buf = (byte*) calloc( width * sizeof *buf, 1 );
+	buf = (byte*) calloc( width * 2 * sizeof *buf, 1 );
 	if ( !buf )
 		return "Out of memory";
 	
@@ -72,21 +184,18 @@ const char* Audio_Scope::init( int width, int height )
 	return 0; // success
 }
 
-const char* Audio_Scope::draw( const short* in, long count, double step )
+const char* Audio_Scope::draw( Scope_Buffer const& in, int n )
 {
 	int low = low_y;
 	int high = high_y;
 	
-	if ( count >= buf_size )
-	{
+	int count = in.level_width( n );
+	if ( count > buf_size )
 		count = buf_size;
-		low_y = 0x7FFF;
-		high_y = 0;
-	}
 	
 	if ( SDL_LockSurface( surface ) < 0 )
 		return "Couldn't lock surface";
-	render( in, count, (long) (step * step_unit) );
+	render( in.level( n ), count );
 	SDL_UnlockSurface( surface );
 	
 	if ( low > low_y )
@@ -110,87 +219,58 @@ const char* Audio_Scope::draw( const short* in, long count, double step )
 	return 0; // success
 }
 
-void Audio_Scope::render( short const* in, long count, long step )
+static inline void fill_column( Uint8* out, long pitch, int top, int bottom, int color )
+{
+	out += top * pitch;
+	for ( int n = bottom - top + 1; n--; )
+	{
+		*out = color;
+		out += pitch;
+	}
+}
+
+void Audio_Scope::render( Scope_Buffer::range_t const* in, int count )
 {
-	byte* old_pos = buf;
 	long surface_pitch = surface->pitch;
 	byte* out = (byte*) surface->pixels + v_offset * surface_pitch;
-	int old_erase = *old_pos;
-	int old_draw = 0;
-	long in_pos = 0;
 	
-	int low_y  = this->low_y;
-	int high_y = this->high_y;
-	int half_step = (step + step_unit / 2) >> (step_bits + 1);
+	// dirty range covers old lines being erased and new ones
+	int low_y  = 0x7FFF;
+	int high_y = 0;
+	int prev_top = -1;
+	int prev_bottom = 0;
 	
-	while ( count-- )
+	for ( int x = 0; x < count; x++ )
 	{
-		// Line drawing/erasing starts at previous sample and ends one short of
-		// current sample, except when previous and current are the same.
+		byte* old = &buf [x * 2];
+		if ( low_y > old [0] )
+			low_y = old [0];
+		if ( high_y < old [1] )
+			high_y = old [1];
+		fill_column( out + x, surface_pitch, old [0], old [1], erase_color );
 		
-		// Extra read on the last iteration of line loops will always be at the
-		// height of the next sample, and thus within the gworld bounds.
-		
-		// Erase old line
-		{
-			int delta = *old_pos - old_erase;
-			int offset = old_erase * surface_pitch;
-			old_erase += delta;
-			
-			int next_line = surface_pitch;
-			if ( delta < 0 )
-			{
-				delta = -delta;
-				next_line = -surface_pitch;
-			}
-			
-			do
-			{
-				out [offset] = erase_color;
-				offset += next_line;
-			}
-			while ( delta-- > 1 );
-		}
+		// larger samples are higher on screen
+		int top    = ((0x7FFF - in [x].max) * 2) >> sample_shift;
+		int bottom = ((0x7FFF - in [x].min) * 2) >> sample_shift;
 		
-		// Draw new line and put in old_buf
+		// extend to previous column so steep slopes stay connected
+		if ( prev_top >= 0 )
 		{
-			
-			int in_whole = in_pos >> step_bits;
-			int sample = (0x7FFF * 2 - in [in_whole] - in [in_whole + half_step]) >> sample_shift;
-			if ( !in_pos )
-				old_draw = sample;
-			in_pos += step;
-			
-			int delta = sample - old_draw;
-			int offset = old_draw * surface_pitch;
-			old_draw += delta;
-			
-			int next_line = surface_pitch;
-			if ( delta < 0 )
-			{
-				delta = -delta;
-				next_line = -surface_pitch;
-			}
-			
-			*old_pos++ = sample;
-			
-			// min/max updating can be interleved anywhere
-			
-			if ( low_y > sample )
-				low_y = sample;
-			
-			do
-			{
-				out [offset] = draw_color;
-				offset += next_line;
-			}
-			while ( delta-- > 1 );
-			
-			if ( high_y < sample )
-				high_y = sample;
+			if ( top > prev_bottom )
+				top = prev_bottom;
+			if ( bottom < prev_top )
+				bottom = prev_top;
 		}
+		prev_top = ((0x7FFF - in [x].max) * 2) >> sample_shift;
+		prev_bottom = ((0x7FFF - in [x].min) * 2) >> sample_shift;
 		
-		out++;
+		old [0] = top;
+		old [1] = bottom;
+		if ( low_y > top )
+			low_y = top;
+		if ( high_y < bottom )
+			high_y = bottom;
+		fill_column( out + x, surface_pitch, top, bottom, draw_color );
 	}
 	
 	this->low_y = low_y;
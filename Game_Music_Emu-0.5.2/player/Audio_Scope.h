@@ -5,32 +5,67 @@
 
 #include "SDL.h"
 
+// Minimum and maximum of recent audio at several resolutions. Level 0 is the
+// finest, and each higher level combines pairs of entries of the one below it,
+// down to the top level with 'width' entries. Filled by the audio thread and
+// drawn by Audio_Scope, so drawing cost depends only on the width.
+class Scope_Buffer {
+public:
+	typedef const char* error_t;
+	struct range_t { short min, max; };
+
+	// Initialize with given top level width and number of levels
+	error_t init( int width, int levels = 4 );
+
+	// Replace contents with summary of 'count' samples from 'in'. Interleaved
+	// channels are combined. Called from audio thread.
+	void write( const short* in, long count );
+
+	// Number of levels
+	int level_count() const                 { return levels; }
+
+	// Entries of level n, and number of them. Can be read while write() runs in
+	// another thread; a frame might then mix old and new audio.
+	range_t const* level( int n ) const     { return data + offsets [n]; }
+	int level_width( int n ) const          { return width << (levels - 1 - n); }
+
+	Scope_Buffer();
+	~Scope_Buffer();
+
+private:
+	enum { max_levels = 8 };
+	range_t* data;
+	int offsets [max_levels];
+	int width;
+	int levels;
+};
+
 class Audio_Scope {
 public:
 	typedef const char* error_t;
-	
+
 	// Initialize scope window of specified size. Height must be 256 or less.
 	error_t init( int width, int height );
-	
-	// Draw at most 'count' samples from 'in', skipping 'step' samples after
-	// each sample drawn. Step can be less than 1.0.
-	error_t draw( const short* in, long count, double step = 1.0 );
-	
+
+	// Draw level 'n' of 'in', one entry per column, as a vertical line from its
+	// minimum to its maximum
+	error_t draw( Scope_Buffer const& in, int n );
+
 	Audio_Scope();
 	~Audio_Scope();
-	
+
 private:
 	typedef unsigned char byte;
 	SDL_Surface* screen;
 	SDL_Surface* surface;
-	byte* buf;
+	byte* buf; // top and bottom of line previously drawn in each column
 	int buf_size;
 	int sample_shift;
 	int low_y;
 	int high_y;
 	int v_offset;
-	
-	void render( short const* in, long count, long step );
+
+	void render( Scope_Buffer::range_t const* in, int count );
 };
 
 #endif
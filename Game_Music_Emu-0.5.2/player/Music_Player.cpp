@@ -2,10 +2,12 @@
 
 #include "Music_Player.h"
 
+#include "Audio_Scope.h"
 #include "gme/Music_Emu.h"
 
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
 
 /* Copyright (C) 2005-2006 by Shay Green. Permission is hereby granted, free of
 charge, to any person obtaining a copy of this software module and associated
@@ -27,6 +29,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // Number of audio buffers per second. Adjust if you encounter audio skipping.
 const int fill_rate = 45;
 
+// Number of samples look-ahead thread generates at a time
+const int produce_size = 512;
+
+// Length of fade at end of track
+const long fade_length = 8000; // msec
+
+// Amount of next track generated ahead of time for gapless playback, in addition
+// to crossfade
+const int head_msec = 250;
+
 // Simple sound driver using SDL
 typedef void (*sound_callback_t)( void* data, short* out, int count );
 static const char* sound_init( long sample_rate, int buf_size, sound_callback_t, void* data );
@@ -34,30 +46,87 @@ static void sound_start();
 static void sound_stop();
 static void sound_cleanup();
 
+static long msec_to_samples( long msec, long rate )
+{
+	long sec = msec / 1000;
+	return (sec * rate + (msec - sec * 1000) * rate / 1000) * 2;
+}
+
 Music_Player::Music_Player()
 {
-	emu_      = 0;
+	emus [0]  = 0;
+	emus [1]  = 0;
 	scope_buf = 0;
+	max_count = produce_size;
 	paused    = false;
+	ring_mask = 0;
+	ring_fill = 0;
+	gapless   = false;
+	crossfade = 0;
+	track_pos = 0;
+	head_pos  = 0;
+	fade_in   = false;
+	draining  = false;
+	next_failed = false;
+	xfade_start = LONG_MAX;
+	next_xfade_start = LONG_MAX;
+	next_request.set( -1 );
+	next_done.set( -1 );
 }
 
-blargg_err_t Music_Player::init( long rate )
+blargg_err_t Music_Player::init( long rate, int device_msec, int ahead_msec )
 {
 	sample_rate = rate;
 	
 	int min_size = sample_rate * 2 / fill_rate;
 	int buf_size = 512;
+	if ( device_msec )
+	{
+		min_size = sample_rate * device_msec / 1000;
+		buf_size = 16;
+	}
 	while ( buf_size < min_size )
 		buf_size *= 2;
+	max_count = (buf_size * 2 > produce_size ? buf_size * 2 : produce_size);
+	
+	ring.clear();
+	if ( ahead_msec )
+	{
+		// keep a device buffer's worth ready in addition to look-ahead
+		ring_fill = buf_size * 2 + sample_rate * ahead_msec / 1000 * 2;
+		ring_fill = (ring_fill + produce_size - 1) / produce_size * produce_size;
+		
+		long size = produce_size * 2;
+		while ( size < ring_fill + produce_size )
+			size *= 2;
+		RETURN_ERR( ring.resize( size ) );
+		ring_mask = size - 1;
+	}
 	
 	return sound_init( sample_rate, buf_size, fill_buffer, this );
 }
 
+blargg_err_t Music_Player::set_gapless( bool enabled, int crossfade_msec )
+{
+	stop();
+	gapless   = enabled;
+	crossfade = msec_to_samples( crossfade_msec, sample_rate );
+	head.clear();
+	if ( enabled )
+		RETURN_ERR( head.resize( msec_to_samples( crossfade_msec + head_msec, sample_rate ) + max_count ) );
+	return 0;
+}
+
 void Music_Player::stop()
 {
 	sound_stop();
-	delete emu_;
-	emu_ = 0;
+	stop_producer();
+	stop_preparer();
+	delete emus [0];
+	delete emus [1];
+	emus [0] = 0;
+	emus [1] = 0;
+	cur.set( 0 );
 }
 
 Music_Player::~Music_Player()
@@ -70,7 +139,9 @@ blargg_err_t Music_Player::load_file( const char* path )
 {
 	stop();
 	
-	RETURN_ERR( gme_open_file( path, &emu_, sample_rate ) );
+	RETURN_ERR( gme_open_file( path, &emus [0], sample_rate ) );
+	if ( gapless )
+		RETURN_ERR( gme_open_file( path, &emus [1], sample_rate ) );
 	
 	char m3u_path [256 + 5];
 	strncpy( m3u_path, path, 256 );
@@ -79,41 +150,63 @@ blargg_err_t Music_Player::load_file( const char* path )
 	if ( !p )
 		p = m3u_path + strlen( m3u_path );
 	strcpy( p, ".m3u" );
-	if ( emu_->load_m3u( m3u_path ) ) { } // ignore error
+	for ( int i = 0; i < 2; i++ )
+	{
+		if ( emus [i] && emus [i]->load_m3u( m3u_path ) ) { } // ignore error
+	}
 	
 	return 0;
 }
 
 int Music_Player::track_count() const
 {
-	return emu_ ? emu_->track_count() : false;
+	return emu() ? emu()->track_count() : false;
+}
+
+int Music_Player::current_track() const
+{
+	return emu() ? emu()->current_track() : -1;
 }
 
 blargg_err_t Music_Player::start_track( int track )
 {
-	if ( emu_ )
+	if ( emu() )
 	{
 		// Sound must not be running when operating on emulator
 		sound_stop();
-		RETURN_ERR( emu_->start_track( track ) );
-		
-		// Calculate track length
-		if ( !emu_->track_info( &track_info_ ) )
-		{
-			if ( track_info_.length <= 0 )
-				track_info_.length = track_info_.intro_length +
-						track_info_.loop_length * 2;
-		}
-		if ( track_info_.length <= 0 )
-			track_info_.length = (long) (2.5 * 60 * 1000);
-		emu_->set_fade( track_info_.length );
+		stop_producer();
+		stop_preparer();
+		int i = (int) cur.get();
+		RETURN_ERR( emus [i]->start_track( track ) );
+		xfade_start = start_fade( emus [i], &infos [i] );
+		track_pos = 0;
 		
 		paused = false;
-		sound_start();
+		resume();
 	}
 	return 0;
 }
 
+// Sets fade-out of track just started and returns position in track where
+// crossfade into next one begins
+long Music_Player::start_fade( Music_Emu* emu, track_info_t* info )
+{
+	// Calculate track length
+	if ( !emu->track_info( info ) )
+	{
+		if ( info->length <= 0 )
+			info->length = info->intro_length + info->loop_length * 2;
+	}
+	if ( info->length <= 0 )
+		info->length = (long) (2.5 * 60 * 1000);
+	emu->set_fade( info->length, fade_length );
+	
+	if ( !crossfade )
+		return LONG_MAX;
+	long start = msec_to_samples( info->length + fade_length, sample_rate ) - crossfade;
+	return (start > 0 ? start : 0);
+}
+
 void Music_Player::pause( int b )
 {
 	paused = b;
@@ -123,54 +216,315 @@ void Music_Player::pause( int b )
 		sound_start();
 }
 
+// Look-ahead and prepared start of next track are discarded, so that changes
+// take effect immediately
+
 void Music_Player::suspend()
 {
 	if ( !paused )
 		sound_stop();
+	stop_producer();
+	stop_preparer();
 }
 
 void Music_Player::resume()
 {
+	if ( draining )
+	{
+		track_pos += (long) head.size() - head_pos;
+		draining = false;
+	}
+	next_done.set( -1 );
+	request_next();
+	start_preparer();
+	start_producer();
 	if ( !paused )
 		sound_start();
 }
 
 bool Music_Player::track_ended() const
 {
-	return emu_ ? emu_->track_ended() : false;
+	// next_request is cleared after switching emulators, so it must be read first
+	long next = next_request.get();
+	return emu() ? emu()->track_ended() && next < 0 : false;
 }
 
 void Music_Player::set_stereo_depth( double tempo )
 {
 	suspend();
-	gme_set_stereo_depth( emu_, tempo );
+	for ( int i = 0; i < 2; i++ )
+	{
+		if ( emus [i] )
+			gme_set_stereo_depth( emus [i], tempo );
+	}
 	resume();
 }
 
 void Music_Player::set_tempo( double tempo )
 {
 	suspend();
-	emu_->set_tempo( tempo );
+	for ( int i = 0; i < 2; i++ )
+	{
+		if ( emus [i] )
+			emus [i]->set_tempo( tempo );
+	}
 	resume();
 }
 
 void Music_Player::mute_voices( int mask )
 {
 	suspend();
-	emu_->mute_voices( mask );
-	emu_->ignore_silence( mask != 0 );
+	for ( int i = 0; i < 2; i++ )
+	{
+		if ( emus [i] )
+		{
+			emus [i]->mute_voices( mask );
+			emus [i]->ignore_silence( mask != 0 );
+		}
+	}
 	resume();
 }
 
+// Look-ahead thread
+
+void Music_Player::start_producer()
+{
+	if ( ring.size() && emu() )
+	{
+		read_pos.set( 0 );
+		write_pos.set( 0 );
+		
+		// have sound ready before device starts
+		while ( fill_ring() ) { }
+		
+		producing.set( true );
+		if ( producer.start( produce, this ) )
+		{
+			// generate sound in callback instead
+			producing.set( false );
+			ring.clear();
+		}
+	}
+}
+
+void Music_Player::stop_producer()
+{
+	producing.set( false );
+	producer.join();
+}
+
+void Music_Player::produce( void* data )
+{
+	Music_Player* self = (Music_Player*) data;
+	while ( self->producing.get() )
+	{
+		if ( !self->fill_ring() )
+			blargg_thread::sleep( 1 );
+	}
+}
+
+// Generates produce_size samples into ring and returns true, or returns false if
+// enough are already ready
+bool Music_Player::fill_ring()
+{
+	long write = write_pos.get();
+	long avail = (write - read_pos.get()) & ring_mask;
+	if ( avail + produce_size > ring_fill )
+		return false;
+	
+	// ring size is a multiple of produce_size, so this never wraps around
+	play_( &ring [write], produce_size );
+	write_pos.set( (write + produce_size) & ring_mask );
+	return true;
+}
+
+void Music_Player::read_ring( sample_t* out, int count )
+{
+	long read = read_pos.get();
+	long avail = (write_pos.get() - read) & ring_mask;
+	int n = (count < avail ? count : (int) avail);
+	
+	int first = (int) ring.size() - read;
+	if ( first > n )
+		first = n;
+	memcpy( out, &ring [read], first * sizeof *out );
+	memcpy( out + first, ring.begin(), (n - first) * sizeof *out );
+	read_pos.set( (read + n) & ring_mask );
+	
+	// silence if thread couldn't keep up
+	memset( out + n, 0, (count - n) * sizeof *out );
+}
+
 void Music_Player::fill_buffer( void* data, sample_t* out, int count )
 {
 	Music_Player* self = (Music_Player*) data;
-	if ( self->emu_ )
+	if ( self->emu() )
 	{
-		if ( self->emu_->play( count, out ) ) { } // ignore error
+		if ( self->ring.size() )
+			self->read_ring( out, count );
+		else
+			self->play_( out, count );
 		
 		if ( self->scope_buf )
-			memcpy( self->scope_buf, out, self->scope_buf_size * sizeof *self->scope_buf );
+			self->scope_buf->write( out, count );
+	}
+}
+
+// Generates count samples, continuing with next track once current one ends
+void Music_Player::play_( sample_t* out, int count )
+{
+	Music_Emu* emu = emus [cur.get()];
+	
+	int pos = 0;
+	if ( draining )
+	{
+		pos = read_head( out, count, false );
+		if ( head_pos >= (long) head.size() )
+		{
+			draining = false;
+			request_next();
+		}
+	}
+	if ( pos < count && emu->play( count - pos, out + pos ) ) { } // ignore error
+	long start = track_pos;
+	track_pos += count;
+	
+	long next = next_request.get();
+	if ( next < 0 || next_done.get() != next )
+		return;
+	
+	if ( next_failed )
+	{
+		// let caller handle error when it starts track itself
+		if ( emu->track_ended() )
+			next_request.set( -1 );
+		return;
+	}
+	
+	if ( track_pos > xfade_start )
+	{
+		int offset = (start < xfade_start ? (int) (xfade_start - start) : 0);
+		fade_in = true;
+		read_head( out + offset, count - offset, true );
+	}
+	
+	if ( emu->track_ended() || head_pos >= (long) head.size() )
+	{
+		if ( !head_pos )
+		{
+			// next track begins right after last sound of current one
+			int end = count;
+			while ( end && !out [end - 1] )
+				end--;
+			end = (end + 1) & ~1; // keep channels in order
+			read_head( out + end, count - end, false );
+		}
+		next_track();
+	}
+}
+
+// Copies or mixes up to count samples of head into out, and returns number used
+int Music_Player::read_head( sample_t* out, int count, bool add )
+{
+	long n = head.size() - head_pos;
+	if ( n > count )
+		n = count;
+	sample_t const* in = &head [head_pos];
+	
+	if ( !add && !(fade_in && head_pos < crossfade) )
+	{
+		memcpy( out, in, n * sizeof *out );
+	}
+	else
+	{
+		for ( long i = 0; i < n; i++ )
+		{
+			long s = in [i];
+			if ( fade_in && head_pos + i < crossfade )
+				s = (long) (s * ((double) (head_pos + i) / crossfade));
+			if ( add )
+			{
+				s += out [i];
+				if ( (sample_t) s != s )
+					s = 0x7FFF - (s >> 24);
+			}
+			out [i] = (sample_t) s;
+		}
+	}
+	head_pos += n;
+	return (int) n;
+}
+
+// Switches to other emulator, whose track was started by prepare thread
+void Music_Player::next_track()
+{
+	cur.set( 1 - cur.get() );
+	next_request.set( -1 );
+	xfade_start = next_xfade_start;
+	track_pos   = head_pos;
+	draining    = true;
+}
+
+// Gapless playback thread
+
+// Has prepare thread start next track of file, if there is one
+void Music_Player::request_next()
+{
+	int track = current_track() + 1;
+	next_request.set( gapless && track < track_count() ? track : -1 );
+}
+
+void Music_Player::start_preparer()
+{
+	if ( gapless && emus [1] )
+	{
+		preparing.set( true );
+		if ( preparer.start( prepare, this ) )
+		{
+			// tracks will be started by caller instead
+			preparing.set( false );
+			next_request.set( -1 );
+		}
+	}
+}
+
+void Music_Player::stop_preparer()
+{
+	preparing.set( false );
+	preparer.join();
+}
+
+void Music_Player::prepare( void* data )
+{
+	Music_Player* self = (Music_Player*) data;
+	while ( self->preparing.get() )
+	{
+		long track = self->next_request.get();
+		if ( track >= 0 && track != self->next_done.get() )
+		{
+			self->prepare_track( (int) track );
+			self->next_done.set( track );
+		}
+		else
+		{
+			blargg_thread::sleep( 10 );
+		}
+	}
+}
+
+// Starts track on emulator not playing and generates its beginning into head.
+// Only the prepare thread uses that emulator and head until next_done is set.
+void Music_Player::prepare_track( int track )
+{
+	int i = 1 - (int) cur.get();
+	Music_Emu* emu = emus [i];
+	head_pos = 0;
+	fade_in  = false;
+	next_failed = (emu->start_track( track ) != 0);
+	if ( !next_failed )
+	{
+		next_xfade_start = start_fade( emu, &infos [i] );
+		if ( emu->play( head.size(), head.begin() ) ) { } // ignore error
 	}
 }
 
@@ -5,15 +5,29 @@
 #define MUSIC_PLAYER_H
 
 #include "gme/Music_Emu.h"
+#include "gme/blargg_thread.h"
+
+class Scope_Buffer;
 
 class Music_Player {
 public:
-	// Initialize player and set sample rate
-	blargg_err_t init( long sample_rate = 44100 );
+	// Initialize player and set sample rate. Sound device buffer holds about
+	// device_msec of sound, or a default amount if 0. If ahead_msec is non-zero,
+	// sound is generated that far ahead in a separate thread, so the device
+	// buffer can be made small without sound skipping on slow parts of music.
+	// Otherwise it's generated as the device needs it.
+	blargg_err_t init( long sample_rate = 44100, int device_msec = 0, int ahead_msec = 0 );
 	
 	// Load game music file. NULL on success, otherwise error string.
 	blargg_err_t load_file( const char* path );
 	
+	// Enable gapless playback. When the current track ends, the next track of the
+	// file continues without a gap. A second emulator starts that track and
+	// generates its beginning in a background thread ahead of time. If
+	// crossfade_msec is non-zero, the next track fades in that long before the
+	// current one has finished fading out. Must be called before load_file().
+	blargg_err_t set_gapless( bool enabled = true, int crossfade_msec = 0 );
+	
 	// (Re)start playing track. Tracks are numbered from 0 to track_count() - 1.
 	blargg_err_t start_track( int track );
 	
@@ -25,17 +39,20 @@ public:
 	// Number of tracks in current file, or 0 if no file loaded.
 	int track_count() const;
 	
+	// Current track. During gapless playback, changes when the next track begins.
+	int current_track() const;
+	
 	// Info for current track
-	track_info_t const& track_info() const { return track_info_; }
+	track_info_t const& track_info() const { return infos [cur.get()]; }
 	
 	// Pause/resume playing current track.
 	void pause( int );
 	
-	// True if track ended
+	// True if track ended and no other track follows it
 	bool track_ended() const;
 	
-	// Pointer to emulator
-	Music_Emu* emu() const { return emu_; }
+	// Pointer to emulator of current track
+	Music_Emu* emu() const { return emus [cur.get()]; }
 	
 	// Set stereo depth, where 0.0 = none and 1.0 = maximum
 	void set_stereo_depth( double );
@@ -46,24 +63,66 @@ public:
 	// Set voice muting bitmask
 	void mute_voices( int );
 	
-	// Set buffer to copy samples from each buffer into, or NULL to disable
+	// Set scope buffer to summarize each buffer of samples into, or NULL to disable
 	typedef short sample_t;
-	void set_scope_buffer( sample_t* buf, int size ) { scope_buf = buf; scope_buf_size = size; }
+	void set_scope_buffer( Scope_Buffer* buf ) { scope_buf = buf; }
 	
 public:
 	Music_Player();
 	~Music_Player();
 private:
-	Music_Emu* emu_;
-	sample_t* scope_buf;
+	// emus [cur] is playing. With gapless playback, the other one prepares next track.
+	Music_Emu* emus [2];
+	track_info_t infos [2];
+	blargg_atomic cur;       // changed only by whatever calls play_()
+	Scope_Buffer* scope_buf;
 	long sample_rate;
-	int scope_buf_size;
+	int max_count;           // most samples generated at once
 	bool paused;
-	track_info_t track_info_;
+	
+	// look-ahead, with samples from read_pos up to write_pos ready to play
+	blargg_vector<sample_t> ring;
+	long ring_mask;
+	long ring_fill;          // number of samples to keep ready
+	blargg_atomic read_pos;  // changed only by sound callback
+	blargg_atomic write_pos; // changed only by producer thread
+	blargg_atomic producing; // cleared to stop producer thread
+	blargg_thread producer;
 	
 	void suspend();
 	void resume();
+	void start_producer();
+	void stop_producer();
+	static void produce( void* );
+	bool fill_ring();
+	void read_ring( sample_t*, int );
 	static void fill_buffer( void*, sample_t*, int );
+	void play_( sample_t*, int );
+	
+	// gapless playback, with start of next track generated into head
+	bool gapless;
+	long crossfade;          // number of samples next track fades in over
+	long xfade_start;        // position in current track where crossfade begins
+	long next_xfade_start;
+	long track_pos;          // number of samples played of current track
+	blargg_vector<sample_t> head;
+	long head_pos;           // number of head samples used
+	bool fade_in;            // head samples are faded in
+	bool draining;           // head is now of current track
+	bool next_failed;        // next track couldn't be started
+	blargg_atomic next_request; // next track to prepare, or -1 if none
+	blargg_atomic next_done;    // most recent track prepared, or -1
+	blargg_atomic preparing;    // cleared to stop prepare thread
+	blargg_thread preparer;
+	
+	long start_fade( Music_Emu*, track_info_t* );
+	void request_next();
+	void start_preparer();
+	void stop_preparer();
+	static void prepare( void* );
+	void prepare_track( int );
+	int read_head( sample_t*, int, bool add );
+	void next_track();
 };
 
 #endif
@@ -24,7 +24,7 @@ void handle_error( const char* );
 static bool paused;
 static Audio_Scope* scope;
 static Music_Player* player;
-static short scope_buf [scope_width * 2];
+static Scope_Buffer scope_buf;
 
 static void init()
 {
@@ -40,23 +40,20 @@ static void init()
 		handle_error( "Out of memory" );
 	if ( scope->init( scope_width, 256 ) )
 		handle_error( "Couldn't initialize scope" );
-	memset( scope_buf, 0, sizeof scope_buf );
+	handle_error( scope_buf.init( scope_width ) );
 	
 	// Create player
 	player = new Music_Player;
 	if ( !player )
 		handle_error( "Out of memory" );
-	handle_error( player->init() );
-	player->set_scope_buffer( scope_buf, scope_width * 2 );
+	handle_error( player->init( 44100, 5, 100 ) ); // small device buffer with look-ahead
+	handle_error( player->set_gapless( true, 2000 ) ); // next track follows with crossfade
+	player->set_scope_buffer( &scope_buf );
 }
 
-static void start_track( int track, const char* path )
+// Update window title with track info
+static void show_track( int track, const char* path )
 {
-	paused = false;
-	handle_error( player->start_track( track - 1 ) );
-	
-	// update window title with track info
-	
 	long seconds = player->track_info().length / 1000;
 	const char* game = player->track_info().game;
 	if ( !*game )
@@ -78,6 +75,13 @@ static void start_track( int track, const char* path )
 	SDL_WM_SetCaption( title, title );
 }
 
+static void start_track( int track, const char* path )
+{
+	paused = false;
+	handle_error( player->start_track( track - 1 ) );
+	show_track( track, path );
+}
+
 int main( int argc, char** argv )
 {
 	init();
@@ -98,7 +102,11 @@ int main( int argc, char** argv )
 		SDL_Delay( 1000 / 100 );
 		
 		// Update scope
-		scope->draw( scope_buf, scope_width, 2 );
+		scope->draw( scope_buf, scope_buf.level_count() - 1 );
+		
+		// Player continues with next track by itself during gapless playback
+		if ( player->current_track() + 1 != track )
+			show_track( track = player->current_track() + 1, path );
 		
 		// Automatically go to next track when current one ends
 		if ( player->track_ended() )
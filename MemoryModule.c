@@ -29,23 +29,65 @@
 
 #include <Windows.h>
 #include <winnt.h>
+#include <string.h>
 #ifdef DEBUG_OUTPUT
 #include <stdio.h>
 #endif
 
 #include "MemoryModule.h"
+#include "sha256.h"
 
 #ifndef IMAGE_SIZEOF_BASE_RELOCATION
 // Vista SDKs no longer define IMAGE_SIZEOF_BASE_RELOCATION!?
 #define IMAGE_SIZEOF_BASE_RELOCATION (sizeof(IMAGE_BASE_RELOCATION))
 #endif
 
+// lazy import stubs are generated as x86 machine code
+#if defined(_M_IX86) || defined(__i386__)
+#define LAZY_IMPORTS
+#endif
+
+#ifdef LAZY_IMPORTS
+// a library whose imports are bound on first call
+typedef struct {
+	LPCSTR name;
+	HMODULE volatile handle;
+	CRITICAL_SECTION *lock;
+} LAZYLIBRARY;
+
+// an import table entry pointing at a stub, and what it should point at
+typedef struct {
+	LAZYLIBRARY *library;
+	DWORD *funcRef;
+	LPCSTR name;
+	WORD hint;
+} LAZYIMPORT;
+
+// exception raised when a lazy import can't be resolved, the same code
+// the Visual C++ delay load helper uses
+#define LAZY_IMPORT_EXCEPTION(err)	(ERROR_SEVERITY_ERROR | (109 << 16) | (err))
+#endif
+
 typedef struct {
 	PIMAGE_NT_HEADERS headers;
 	unsigned char *codeBase;
 	HMODULE *modules;
+	LPCSTR *moduleNames;
 	int numModules;
+	int maxModules;
 	int initialized;
+	int largePages;
+	DWORD *exportIndex;
+	DWORD exportIndexMask;
+#ifdef LAZY_IMPORTS
+	LAZYLIBRARY *lazyLibraries;
+	int numLazyLibraries;
+	LAZYIMPORT *lazyImports;
+	int numLazyImports;
+	unsigned char *lazyStubs;
+	DWORD lazyStubsSize;
+	CRITICAL_SECTION lazyLock;
+#endif
 } MEMORYMODULE, *PMEMORYMODULE;
 
 typedef BOOL (WINAPI *DllEntryProc)(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved);
@@ -84,10 +126,13 @@ CopySections(const unsigned char *data, PIMAGE_NT_HEADERS old_headers, PMEMORYMO
 			size = old_headers->OptionalHeader.SectionAlignment;
 			if (size > 0)
 			{
-				dest = (unsigned char *)VirtualAlloc(codeBase + section->VirtualAddress,
-					size,
-					MEM_COMMIT,
-					PAGE_READWRITE);
+				if (module->largePages)
+					dest = codeBase + section->VirtualAddress;
+				else
+					dest = (unsigned char *)VirtualAlloc(codeBase + section->VirtualAddress,
+						size,
+						MEM_COMMIT,
+						PAGE_READWRITE);
 
 				section->Misc.PhysicalAddress = (DWORD)dest;
 				memset(dest, 0, size);
@@ -98,10 +143,13 @@ CopySections(const unsigned char *data, PIMAGE_NT_HEADERS old_headers, PMEMORYMO
 		}
 
 		// commit memory block and copy data from dll
-		dest = (unsigned char *)VirtualAlloc(codeBase + section->VirtualAddress,
-							section->SizeOfRawData,
-							MEM_COMMIT,
-							PAGE_READWRITE);
+		if (module->largePages)
+			dest = codeBase + section->VirtualAddress;
+		else
+			dest = (unsigned char *)VirtualAlloc(codeBase + section->VirtualAddress,
+								section->SizeOfRawData,
+								MEM_COMMIT,
+								PAGE_READWRITE);
 		memcpy(dest, data + section->PointerToRawData, section->SizeOfRawData);
 		section->Misc.PhysicalAddress = (DWORD)dest;
 	}
@@ -168,6 +216,59 @@ FinalizeSections(PMEMORYMODULE module)
 	}
 }
 
+// Large pages are committed whole with the process lock privilege held, so
+// it is enabled first; AdjustTokenPrivileges succeeds without enabling
+// anything if the user hasn't been granted it, hence the last error check
+static int
+EnableLockMemoryPrivilege(void)
+{
+	TOKEN_PRIVILEGES privileges;
+	HANDLE token;
+	int result;
+
+	if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+		return 0;
+
+	privileges.PrivilegeCount = 1;
+	privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+	result = LookupPrivilegeValueA(NULL, "SeLockMemoryPrivilege", &privileges.Privileges[0].Luid) &&
+		AdjustTokenPrivileges(token, FALSE, &privileges, 0, NULL, NULL) &&
+		GetLastError() == ERROR_SUCCESS;
+	CloseHandle(token);
+	return result;
+}
+
+// Reserve and commit the image in large pages at once, at its preferred base
+// if that is aligned to them, otherwise anywhere if it can be relocated.
+// Returns NULL if that fails, leaving the caller to use normal pages.
+static unsigned char *
+AllocLargePageImage(PIMAGE_NT_HEADERS old_headers)
+{
+	SIZE_T largePage = GetLargePageMinimum();
+	SIZE_T size;
+	DWORD imageBase = old_headers->OptionalHeader.ImageBase;
+	unsigned char *code = NULL;
+
+	if (largePage == 0 || !EnableLockMemoryPrivilege())
+		return NULL;
+
+	size = (old_headers->OptionalHeader.SizeOfImage + largePage - 1) & ~(largePage - 1);
+	if ((imageBase & (largePage - 1)) == 0)
+		code = (unsigned char *)VirtualAlloc((LPVOID)imageBase,
+			size,
+			MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+			PAGE_EXECUTE_READWRITE);
+
+	if (code == NULL && !(old_headers->FileHeader.Characteristics & IMAGE_FILE_RELOCS_STRIPPED) &&
+		old_headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_BASERELOC].Size != 0)
+		code = (unsigned char *)VirtualAlloc(NULL,
+			size,
+			MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+			PAGE_EXECUTE_READWRITE);
+
+	return code;
+}
+
 static void
 PerformBaseRelocation(PMEMORYMODULE module, DWORD delta)
 {
@@ -178,46 +279,257 @@ PerformBaseRelocation(PMEMORYMODULE module, DWORD delta)
 	if (directory->Size > 0)
 	{
 		PIMAGE_BASE_RELOCATION relocation = (PIMAGE_BASE_RELOCATION)(codeBase + directory->VirtualAddress);
-		for (; relocation->VirtualAddress > 0; )
+		unsigned char *end = codeBase + directory->VirtualAddress + directory->Size;
+
+		// stop at the end of the directory as well as at an empty block, so
+		// padding after the last block is never taken for relocations
+		while ((unsigned char *)relocation + IMAGE_SIZEOF_BASE_RELOCATION <= end &&
+			relocation->VirtualAddress > 0 && relocation->SizeOfBlock >= IMAGE_SIZEOF_BASE_RELOCATION)
 		{
 			unsigned char *dest = (unsigned char *)(codeBase + relocation->VirtualAddress);
 			unsigned short *relInfo = (unsigned short *)((unsigned char *)relocation + IMAGE_SIZEOF_BASE_RELOCATION);
-			for (i=0; i<((relocation->SizeOfBlock-IMAGE_SIZEOF_BASE_RELOCATION) / 2); i++, relInfo++)
-			{
-				DWORD *patchAddrHL;
-				int type, offset;
-
-				// the upper 4 bits define the type of relocation
-				type = *relInfo >> 12;
-				// the lower 12 bits define the offset
-				offset = *relInfo & 0xfff;
-				
-				switch (type)
-				{
-				case IMAGE_REL_BASED_ABSOLUTE:
-					// skip relocation
-					break;
+			DWORD count = (relocation->SizeOfBlock-IMAGE_SIZEOF_BASE_RELOCATION) / 2;
 
-				case IMAGE_REL_BASED_HIGHLOW:
+			for (i=0; i<count; i++)
+			{
+				// the upper 4 bits define the type of relocation, the lower
+				// 12 bits the offset
+				unsigned short info = relInfo[i];
+				if ((info >> 12) == IMAGE_REL_BASED_HIGHLOW)
 					// change complete 32 bit address
-					patchAddrHL = (DWORD *)(dest + offset);
-					*patchAddrHL += delta;
-					break;
+					*(DWORD *)(dest + (info & 0xfff)) += delta;
 
-				default:
-					//printf("Unknown relocation: %d\n", type);
-					break;
-				}
+				// IMAGE_REL_BASED_ABSOLUTE is padding, and other types
+				// are unknown and skipped
 			}
 
 			// advance to next relocation block
-			relocation = (PIMAGE_BASE_RELOCATION)(((DWORD)relocation) + relocation->SizeOfBlock);
+			relocation = (PIMAGE_BASE_RELOCATION)(((unsigned char *)relocation) + relocation->SizeOfBlock);
+		}
+	}
+}
+
+// Look up an import in a loaded library. The hint is where its name should
+// be in the library's export name table, which saves GetProcAddress a
+// search; forwarded exports point into the export directory and are left
+// to GetProcAddress.
+static FARPROC
+GetImportAddress(HMODULE handle, WORD hint, LPCSTR name)
+{
+	unsigned char *base = (unsigned char *)handle;
+	PIMAGE_NT_HEADERS headers = (PIMAGE_NT_HEADERS)(base + ((PIMAGE_DOS_HEADER)base)->e_lfanew);
+	PIMAGE_DATA_DIRECTORY directory = &headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+
+	if (HIWORD(name) != 0 && directory->Size > 0)
+	{
+		PIMAGE_EXPORT_DIRECTORY exports = (PIMAGE_EXPORT_DIRECTORY)(base + directory->VirtualAddress);
+		if (hint < exports->NumberOfNames)
+		{
+			DWORD *nameRef = (DWORD *)(base + exports->AddressOfNames);
+			WORD *ordinal = (WORD *)(base + exports->AddressOfNameOrdinals);
+			if (strcmp((const char *)(base + nameRef[hint]), name) == 0 &&
+				ordinal[hint] < exports->NumberOfFunctions)
+			{
+				DWORD rva = ((DWORD *)(base + exports->AddressOfFunctions))[ordinal[hint]];
+				if (rva < directory->VirtualAddress || rva >= directory->VirtualAddress + directory->Size)
+					return (FARPROC)(base + rva);
+			}
+		}
+	}
+
+	return GetProcAddress(handle, name);
+}
+
+// Load a library the module imports from, or give back the handle opened
+// already if the module has more than one descriptor for it
+static HMODULE
+LoadImportLibrary(PMEMORYMODULE module, LPCSTR name)
+{
+	int i;
+	HMODULE handle;
+
+	for (i=0; i<module->numModules; i++)
+		if (stricmp(module->moduleNames[i], name) == 0)
+			return module->modules[i];
+
+	if (module->numModules == module->maxModules)
+	{
+		int maxModules = module->maxModules ? module->maxModules * 2 : 16;
+		HMODULE *modules;
+		LPCSTR *moduleNames;
+
+		modules = (HMODULE *)realloc(module->modules, maxModules*(sizeof(HMODULE)));
+		if (modules == NULL)
+			return NULL;
+		module->modules = modules;
+
+		moduleNames = (LPCSTR *)realloc(module->moduleNames, maxModules*(sizeof(LPCSTR)));
+		if (moduleNames == NULL)
+			return NULL;
+		module->moduleNames = moduleNames;
+		module->maxModules = maxModules;
+	}
+
+	handle = LoadLibrary(name);
+	if (handle == NULL)
+	{
+#if DEBUG_OUTPUT
+		OutputLastError("Can't load library");
+#endif
+		return NULL;
+	}
+
+	module->moduleNames[module->numModules] = name;
+	module->modules[module->numModules++] = handle;
+	return handle;
+}
+
+#ifdef LAZY_IMPORTS
+// Code shared by the stubs, which push their LAZYIMPORT and jump here. It
+// saves the registers that may hold arguments, resolves the import and
+// returns into the resolved function with the stack as the caller left it.
+static const unsigned char LazyStubCommon[] = {
+	0x51,				// push ecx
+	0x52,				// push edx
+	0x50,				// push eax
+	0xff, 0x74, 0x24, 0x0c,		// push dword ptr [esp+12]
+	0xe8, 0, 0, 0, 0,		// call ResolveLazyImport
+	0x83, 0xc4, 0x04,		// add esp, 4
+	0x89, 0x44, 0x24, 0x0c,		// mov [esp+12], eax
+	0x58,				// pop eax
+	0x5a,				// pop edx
+	0x59,				// pop ecx
+	0xc3,				// ret
+};
+#define LAZY_STUB_CALL		7	// offset of the call in LazyStubCommon
+#define LAZY_STUB_SIZE		10	// push imm32, jmp rel32
+
+static FARPROC __cdecl
+ResolveLazyImport(LAZYIMPORT *import)
+{
+	LAZYLIBRARY *library = import->library;
+	HMODULE handle = library->handle;
+	MEMORY_BASIC_INFORMATION info;
+	DWORD protect, oldProtect;
+	FARPROC proc;
+
+	if (handle == NULL)
+	{
+		handle = LoadLibrary(library->name);
+		if (handle == NULL)
+			RaiseException(LAZY_IMPORT_EXCEPTION(ERROR_MOD_NOT_FOUND), EXCEPTION_NONCONTINUABLE, 0, NULL);
+
+		// another thread may have got there first
+		if (InterlockedCompareExchangePointer((PVOID volatile *)&library->handle, handle, NULL) != NULL)
+		{
+			FreeLibrary(handle);
+			handle = library->handle;
+		}
+	}
+
+	proc = GetImportAddress(handle, import->hint, import->name);
+	if (proc == NULL)
+		RaiseException(LAZY_IMPORT_EXCEPTION(ERROR_PROC_NOT_FOUND), EXCEPTION_NONCONTINUABLE, 0, NULL);
+
+	// the import table has been protected by FinalizeSections, perhaps as
+	// part of a code section, so opening it up for writing must not take
+	// away execute access, and must not race another thread doing the same
+	EnterCriticalSection(library->lock);
+	VirtualQuery(import->funcRef, &info, sizeof(info));
+	if (info.Protect & (PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY))
+		*import->funcRef = (DWORD)proc;
+	else
+	{
+		protect = (info.Protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ)) ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE;
+		if (VirtualProtect(import->funcRef, sizeof(DWORD), protect, &oldProtect))
+		{
+			*import->funcRef = (DWORD)proc;
+			VirtualProtect(import->funcRef, sizeof(DWORD), oldProtect, &oldProtect);
 		}
 	}
+	LeaveCriticalSection(library->lock);
+
+	return proc;
+}
+
+// Allocate stubs for every import, whether or not it ends up lazy
+static int
+PrepareLazyImports(PMEMORYMODULE module, PIMAGE_IMPORT_DESCRIPTOR importDesc)
+{
+	unsigned char *codeBase = module->codeBase;
+	int numLibraries = 0, numImports = 0;
+	DWORD call;
+
+	for (; !IsBadReadPtr(importDesc, sizeof(IMAGE_IMPORT_DESCRIPTOR)) && importDesc->Name; importDesc++)
+	{
+		DWORD *thunkRef = (DWORD *)(codeBase + (importDesc->OriginalFirstThunk ? importDesc->OriginalFirstThunk : importDesc->FirstThunk));
+		for (; *thunkRef; thunkRef++)
+			numImports++;
+		numLibraries++;
+	}
+
+	if (numImports == 0)
+		return 1;
+
+	module->lazyLibraries = (LAZYLIBRARY *)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, numLibraries*sizeof(LAZYLIBRARY));
+	module->lazyImports = (LAZYIMPORT *)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, numImports*sizeof(LAZYIMPORT));
+	if (module->lazyLibraries == NULL || module->lazyImports == NULL)
+		return 0;
+
+	module->lazyStubsSize = sizeof(LazyStubCommon) + numImports*LAZY_STUB_SIZE;
+	module->lazyStubs = (unsigned char *)VirtualAlloc(NULL,
+		module->lazyStubsSize,
+		MEM_RESERVE | MEM_COMMIT,
+		PAGE_READWRITE);
+	if (module->lazyStubs == NULL)
+	{
+#if DEBUG_OUTPUT
+		OutputLastError("Can't allocate import stubs");
+#endif
+		return 0;
+	}
+
+	memcpy(module->lazyStubs, LazyStubCommon, sizeof(LazyStubCommon));
+	call = (DWORD)ResolveLazyImport - (DWORD)(module->lazyStubs + LAZY_STUB_CALL + 5);
+	memcpy(module->lazyStubs + LAZY_STUB_CALL + 1, &call, sizeof(call));
+	InitializeCriticalSection(&module->lazyLock);
+	return 1;
+}
+
+// Point an import table entry at a new stub for it
+static void
+AddLazyImport(PMEMORYMODULE module, LAZYLIBRARY *library, DWORD thunk, DWORD *funcRef)
+{
+	LAZYIMPORT *import = &module->lazyImports[module->numLazyImports];
+	unsigned char *stub = module->lazyStubs + sizeof(LazyStubCommon) + module->numLazyImports*LAZY_STUB_SIZE;
+	DWORD operand;
+
+	import->library = library;
+	import->funcRef = funcRef;
+	if IMAGE_SNAP_BY_ORDINAL(thunk)
+		import->name = (LPCSTR)IMAGE_ORDINAL(thunk);
+	else {
+		PIMAGE_IMPORT_BY_NAME thunkData = (PIMAGE_IMPORT_BY_NAME)(module->codeBase + thunk);
+		import->name = (LPCSTR)&thunkData->Name;
+		import->hint = thunkData->Hint;
+	}
+
+	// push import
+	stub[0] = 0x68;
+	operand = (DWORD)import;
+	memcpy(stub + 1, &operand, sizeof(operand));
+	// jmp LazyStubCommon
+	stub[5] = 0xe9;
+	operand = (DWORD)module->lazyStubs - (DWORD)(stub + LAZY_STUB_SIZE);
+	memcpy(stub + 6, &operand, sizeof(operand));
+
+	*funcRef = (DWORD)stub;
+	module->numLazyImports++;
 }
+#endif
 
 static int
-BuildImportTable(PMEMORYMODULE module)
+BuildImportTable(PMEMORYMODULE module, DWORD flags)
 {
 	int result=1;
 	unsigned char *codeBase = module->codeBase;
@@ -226,27 +538,18 @@ BuildImportTable(PMEMORYMODULE module)
 	if (directory->Size > 0)
 	{
 		PIMAGE_IMPORT_DESCRIPTOR importDesc = (PIMAGE_IMPORT_DESCRIPTOR)(codeBase + directory->VirtualAddress);
+#ifdef LAZY_IMPORTS
+		if ((flags & MEMORY_LOAD_LAZY_IMPORTS) && !PrepareLazyImports(module, importDesc))
+			return 0;
+#else
+		(void)flags;
+#endif
 		for (; !IsBadReadPtr(importDesc, sizeof(IMAGE_IMPORT_DESCRIPTOR)) && importDesc->Name; importDesc++)
 		{
 			DWORD *thunkRef, *funcRef;
-			HMODULE handle = LoadLibrary((LPCSTR)(codeBase + importDesc->Name));
-			if (handle == INVALID_HANDLE_VALUE)
-			{
-#if DEBUG_OUTPUT
-				OutputLastError("Can't load library");
-#endif
-				result = 0;
-				break;
-			}
+			LPCSTR name = (LPCSTR)(codeBase + importDesc->Name);
+			HMODULE handle;
 
-			module->modules = (HMODULE *)realloc(module->modules, (module->numModules+1)*(sizeof(HMODULE)));
-			if (module->modules == NULL)
-			{
-				result = 0;
-				break;
-			}
-
-			module->modules[module->numModules++] = handle;
 			if (importDesc->OriginalFirstThunk)
 			{
 				thunkRef = (DWORD *)(codeBase + importDesc->OriginalFirstThunk);
@@ -256,13 +559,35 @@ BuildImportTable(PMEMORYMODULE module)
 				thunkRef = (DWORD *)(codeBase + importDesc->FirstThunk);
 				funcRef = (DWORD *)(codeBase + importDesc->FirstThunk);
 			}
+
+#ifdef LAZY_IMPORTS
+			// libraries that are loaded already cost little to bind to now,
+			// and binding them keeps any data they export working
+			if (module->lazyStubs != NULL && GetModuleHandle(name) == NULL)
+			{
+				LAZYLIBRARY *library = &module->lazyLibraries[module->numLazyLibraries++];
+				library->name = name;
+				library->lock = &module->lazyLock;
+				for (; *thunkRef; thunkRef++, funcRef++)
+					AddLazyImport(module, library, *thunkRef, funcRef);
+				continue;
+			}
+#endif
+
+			handle = LoadImportLibrary(module, name);
+			if (handle == NULL)
+			{
+				result = 0;
+				break;
+			}
+
 			for (; *thunkRef; thunkRef++, funcRef++)
 			{
 				if IMAGE_SNAP_BY_ORDINAL(*thunkRef)
 					*funcRef = (DWORD)GetProcAddress(handle, (LPCSTR)IMAGE_ORDINAL(*thunkRef));
 				else {
 					PIMAGE_IMPORT_BY_NAME thunkData = (PIMAGE_IMPORT_BY_NAME)(codeBase + *thunkRef);
-					*funcRef = (DWORD)GetProcAddress(handle, (LPCSTR)&thunkData->Name);
+					*funcRef = (DWORD)GetImportAddress(handle, thunkData->Hint, (LPCSTR)&thunkData->Name);
 				}
 				if (*funcRef == 0)
 				{
@@ -274,17 +599,286 @@ BuildImportTable(PMEMORYMODULE module)
 			if (!result)
 				break;
 		}
+
+#ifdef LAZY_IMPORTS
+		if (module->lazyStubs != NULL)
+		{
+			DWORD oldProtect;
+			VirtualProtect(module->lazyStubs, module->lazyStubsSize, PAGE_EXECUTE_READ, &oldProtect);
+			FlushInstructionCache(GetCurrentProcess(), module->lazyStubs, module->lazyStubsSize);
+		}
+#endif
+	}
+
+	return result;
+}
+
+static PIMAGE_EXPORT_DIRECTORY
+GetExportDirectory(PMEMORYMODULE module)
+{
+	PIMAGE_EXPORT_DIRECTORY exports;
+	PIMAGE_DATA_DIRECTORY directory = GET_HEADER_DICTIONARY(module, IMAGE_DIRECTORY_ENTRY_EXPORT);
+	if (directory->Size == 0)
+		// no export table found
+		return NULL;
+
+	exports = (PIMAGE_EXPORT_DIRECTORY)(module->codeBase + directory->VirtualAddress);
+	if (exports->NumberOfNames == 0 || exports->NumberOfFunctions == 0)
+		// DLL doesn't export anything
+		return NULL;
+
+	return exports;
+}
+
+// FNV-1a hash of a name regardless of case, as exports are looked up
+static DWORD
+HashExportName(const char *name)
+{
+	DWORD hash = 2166136261u;
+	for (; *name; name++)
+	{
+		unsigned char c = (unsigned char)*name;
+		if (c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		hash = (hash ^ c) * 16777619u;
+	}
+	return hash;
+}
+
+// Index the exported names in an open addressed hash table of name
+// numbers plus one, at most half full so that chains stay short
+static void
+BuildExportIndex(PMEMORYMODULE module)
+{
+	unsigned char *codeBase = module->codeBase;
+	PIMAGE_EXPORT_DIRECTORY exports = GetExportDirectory(module);
+	DWORD i, size, *nameRef;
+
+	if (exports == NULL)
+		return;
+
+	for (size = 16; size < exports->NumberOfNames * 2; size *= 2)
+		;
+
+	// without an index lookups search the name table instead
+	module->exportIndex = (DWORD *)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, size*sizeof(DWORD));
+	if (module->exportIndex == NULL)
+		return;
+	module->exportIndexMask = size - 1;
+
+	nameRef = (DWORD *)(codeBase + exports->AddressOfNames);
+	for (i=0; i<exports->NumberOfNames; i++)
+	{
+		DWORD slot = HashExportName((const char *)(codeBase + nameRef[i])) & module->exportIndexMask;
+		while (module->exportIndex[slot] != 0)
+			slot = (slot + 1) & module->exportIndexMask;
+		module->exportIndex[slot] = i + 1;
+	}
+}
+
+// Find the function number of an exported name, preferring an exact match
+// to one that differs in case
+static int
+FindExport(PMEMORYMODULE module, PIMAGE_EXPORT_DIRECTORY exports, const char *name)
+{
+	unsigned char *codeBase = module->codeBase;
+	DWORD *nameRef = (DWORD *)(codeBase + exports->AddressOfNames);
+	WORD *ordinal = (WORD *)(codeBase + exports->AddressOfNameOrdinals);
+	int idx = -1;
+	DWORD i, lo, hi;
+
+	if (module->exportIndex != NULL)
+	{
+		DWORD slot = HashExportName(name) & module->exportIndexMask;
+		DWORD entry;
+		while ((entry = module->exportIndex[slot]) != 0)
+		{
+			const char *exportName = (const char *)(codeBase + nameRef[entry - 1]);
+			if (strcmp(name, exportName) == 0)
+				return ordinal[entry - 1];
+			if (idx == -1 && stricmp(name, exportName) == 0)
+				idx = ordinal[entry - 1];
+			slot = (slot + 1) & module->exportIndexMask;
+		}
+		return idx;
+	}
+
+	// the list of exported names is sorted, so search it by halves
+	lo = 0;
+	hi = exports->NumberOfNames;
+	while (lo < hi)
+	{
+		DWORD mid = lo + (hi - lo) / 2;
+		int cmp = strcmp(name, (const char *)(codeBase + nameRef[mid]));
+		if (cmp == 0)
+			return ordinal[mid];
+		if (cmp < 0)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+
+	// names used to be matched regardless of case
+	for (i=0; i<exports->NumberOfNames; i++)
+		if (stricmp(name, (const char *)(codeBase + nameRef[i])) == 0)
+			return ordinal[i];
+
+	// exported symbol not found
+	return -1;
+}
+
+static FARPROC
+GetExportAddress(PMEMORYMODULE module, PIMAGE_EXPORT_DIRECTORY exports, int idx)
+{
+	unsigned char *codeBase = module->codeBase;
+
+	if (idx == -1)
+		return NULL;
+
+	if ((DWORD)idx >= exports->NumberOfFunctions)
+		// name <-> ordinal number don't match
+		return NULL;
+
+	// AddressOfFunctions contains the RVAs to the "real" functions
+	return (FARPROC)(codeBase + *(DWORD *)(codeBase + exports->AddressOfFunctions + (idx*4)));
+}
+
+// Header of a prelinked image in the cache, followed by the image itself
+typedef struct {
+	DWORD magic;
+	DWORD version;
+	BYTE sha256[SHA256_BLOCK_SIZE];	// of the DLL the image was made from
+	DWORD imageBase;
+	DWORD sizeOfImage;
+} PRELINKHEADER;
+
+#define PRELINK_MAGIC	0x4b4e4c50	// "PLNK"
+#define PRELINK_VERSION	1
+
+// What the cache is asked for: the DLL's hash, and where its file goes
+typedef struct {
+	const char *dir;
+	BYTE sha256[SHA256_BLOCK_SIZE];
+} PRELINKKEY;
+
+static void
+GetPrelinkPath(const PRELINKKEY *key, DWORD base, char *path, size_t size)
+{
+	static const char hex[] = "0123456789abcdef";
+	char name[SHA256_BLOCK_SIZE*2 + 1];
+	int i;
+
+	for (i=0; i<SHA256_BLOCK_SIZE; i++)
+	{
+		name[i*2] = hex[key->sha256[i] >> 4];
+		name[i*2 + 1] = hex[key->sha256[i] & 15];
 	}
+	name[SHA256_BLOCK_SIZE*2] = 0;
+	_snprintf(path, size, "%s\\%s-%08lx.img", key->dir, name, (unsigned long)base);
+	path[size - 1] = 0;
+}
+
+// Read the image made for this base straight into place, checking first
+// that its header is the one expected. The image is as it was after
+// CopySections and PerformBaseRelocation, so neither needs to run.
+static int
+LoadPrelinkedImage(const PRELINKKEY *key, unsigned char *code, DWORD sizeOfImage)
+{
+	char path[MAX_PATH];
+	PRELINKHEADER header;
+	LARGE_INTEGER fileSize;
+	DWORD read;
+	HANDLE file;
+	int result = 0;
+
+	GetPrelinkPath(key, (DWORD)code, path, sizeof(path));
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return 0;
 
+	if (GetFileSizeEx(file, &fileSize) &&
+		fileSize.QuadPart == (LONGLONG)sizeof(header) + sizeOfImage &&
+		ReadFile(file, &header, sizeof(header), &read, NULL) && read == sizeof(header) &&
+		header.magic == PRELINK_MAGIC && header.version == PRELINK_VERSION &&
+		memcmp(header.sha256, key->sha256, SHA256_BLOCK_SIZE) == 0 &&
+		header.imageBase == (DWORD)code && header.sizeOfImage == sizeOfImage &&
+		ReadFile(file, code, sizeOfImage, &read, NULL) && read == sizeOfImage)
+		result = 1;
+
+	CloseHandle(file);
 	return result;
 }
 
+// Save an image copied into place and relocated, writing a temporary file
+// and renaming it so that a reader never sees half of one
+static void
+SavePrelinkedImage(const PRELINKKEY *key, const unsigned char *code, DWORD sizeOfImage)
+{
+	char path[MAX_PATH], temp[MAX_PATH + 8];
+	PRELINKHEADER header;
+	DWORD written;
+	HANDLE file;
+	BOOL ok;
+
+	GetPrelinkPath(key, (DWORD)code, path, sizeof(path));
+	_snprintf(temp, sizeof(temp), "%s.%lx", path, (unsigned long)GetCurrentProcessId());
+	temp[sizeof(temp) - 1] = 0;
+
+	file = CreateFileA(temp, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	memset(&header, 0, sizeof(header));
+	header.magic = PRELINK_MAGIC;
+	header.version = PRELINK_VERSION;
+	memcpy(header.sha256, key->sha256, SHA256_BLOCK_SIZE);
+	header.imageBase = (DWORD)code;
+	header.sizeOfImage = sizeOfImage;
+
+	ok = WriteFile(file, &header, sizeof(header), &written, NULL) && written == sizeof(header) &&
+		WriteFile(file, code, sizeOfImage, &written, NULL) && written == sizeOfImage;
+	CloseHandle(file);
+
+	if (!ok || !MoveFileExA(temp, path, MOVEFILE_REPLACE_EXISTING))
+		DeleteFileA(temp);
+}
+
+static HMEMORYMODULE
+LoadLibraryInternal(const void *data, DWORD flags, const PRELINKKEY *key);
+
 HMEMORYMODULE MemoryLoadLibrary(const void *data)
+{
+	return MemoryLoadLibraryEx(data, 0);
+}
+
+HMEMORYMODULE MemoryLoadLibraryEx(const void *data, DWORD flags)
+{
+	return LoadLibraryInternal(data, flags, NULL);
+}
+
+HMEMORYMODULE MemoryLoadLibraryCached(const void *data, size_t size, const char *cacheDir, DWORD flags)
+{
+	PRELINKKEY key;
+	SHA256_CTX ctx;
+
+	if (cacheDir == NULL || *cacheDir == 0)
+		return LoadLibraryInternal(data, flags, NULL);
+
+	key.dir = cacheDir;
+	sha256_init(&ctx);
+	sha256_update(&ctx, (const BYTE *)data, size);
+	sha256_final(&ctx, key.sha256);
+	return LoadLibraryInternal(data, flags, &key);
+}
+
+static HMEMORYMODULE
+LoadLibraryInternal(const void *data, DWORD flags, const PRELINKKEY *key)
 {
 	PMEMORYMODULE result;
 	PIMAGE_DOS_HEADER dos_header;
 	PIMAGE_NT_HEADERS old_header;
-	unsigned char *code, *headers;
+	unsigned char *code = NULL, *headers;
+	int largePages = 0;
 	DWORD locationDelta;
 	DllEntryProc DllEntry;
 	BOOL successfull;
@@ -307,11 +901,18 @@ HMEMORYMODULE MemoryLoadLibrary(const void *data)
 		return NULL;
 	}
 
+	if (flags & MEMORY_LOAD_LARGE_PAGES)
+	{
+		code = AllocLargePageImage(old_header);
+		largePages = code != NULL;
+	}
+
 	// reserve memory for image of library
-	code = (unsigned char *)VirtualAlloc((LPVOID)(old_header->OptionalHeader.ImageBase),
-		old_header->OptionalHeader.SizeOfImage,
-		MEM_RESERVE,
-		PAGE_READWRITE);
+	if (code == NULL)
+		code = (unsigned char *)VirtualAlloc((LPVOID)(old_header->OptionalHeader.ImageBase),
+			old_header->OptionalHeader.SizeOfImage,
+			MEM_RESERVE,
+			PAGE_READWRITE);
 
     if (code == NULL)
         // try to allocate memory at arbitrary position
@@ -328,47 +929,69 @@ HMEMORYMODULE MemoryLoadLibrary(const void *data)
 		return NULL;
 	}
 
-	result = (PMEMORYMODULE)HeapAlloc(GetProcessHeap(), 0, sizeof(MEMORYMODULE));
+	result = (PMEMORYMODULE)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(MEMORYMODULE));
 	result->codeBase = code;
 	result->numModules = 0;
 	result->modules = NULL;
 	result->initialized = 0;
+	result->largePages = largePages;
 
-	// XXX: is it correct to commit the complete memory region at once?
-    //      calling DllEntry raises an exception if we don't...
-	VirtualAlloc(code,
-		old_header->OptionalHeader.SizeOfImage,
-		MEM_COMMIT,
-		PAGE_READWRITE);
+	if (largePages)
+	{
+		// committed along with the reservation
+		headers = code;
+	} else {
+		// XXX: is it correct to commit the complete memory region at once?
+		//      calling DllEntry raises an exception if we don't...
+		VirtualAlloc(code,
+			old_header->OptionalHeader.SizeOfImage,
+			MEM_COMMIT,
+			PAGE_READWRITE);
 
-	// commit memory for headers
-	headers = (unsigned char *)VirtualAlloc(code,
-		old_header->OptionalHeader.SizeOfHeaders,
-		MEM_COMMIT,
-		PAGE_READWRITE);
+		// commit memory for headers
+		headers = (unsigned char *)VirtualAlloc(code,
+			old_header->OptionalHeader.SizeOfHeaders,
+			MEM_COMMIT,
+			PAGE_READWRITE);
+	}
 	
-	// copy PE header to code
-	memcpy(headers, dos_header, dos_header->e_lfanew + old_header->OptionalHeader.SizeOfHeaders);
-	result->headers = (PIMAGE_NT_HEADERS)&((const unsigned char *)(headers))[dos_header->e_lfanew];
+	if (key != NULL && LoadPrelinkedImage(key, code, old_header->OptionalHeader.SizeOfImage))
+	{
+		// headers, sections and relocations are all in place already
+		result->headers = (PIMAGE_NT_HEADERS)&((const unsigned char *)(headers))[dos_header->e_lfanew];
+	} else {
+		// copy PE header to code
+		memcpy(headers, dos_header, dos_header->e_lfanew + old_header->OptionalHeader.SizeOfHeaders);
+		result->headers = (PIMAGE_NT_HEADERS)&((const unsigned char *)(headers))[dos_header->e_lfanew];
+
+		// update position
+		result->headers->OptionalHeader.ImageBase = (DWORD)code;
 
-	// update position
-	result->headers->OptionalHeader.ImageBase = (DWORD)code;
+		// copy sections from DLL file block to new memory location
+		CopySections(data, old_header, result);
 
-	// copy sections from DLL file block to new memory location
-	CopySections(data, old_header, result);
+		// adjust base address of imported data
+		locationDelta = (DWORD)(code - old_header->OptionalHeader.ImageBase);
+		if (locationDelta != 0)
+			PerformBaseRelocation(result, locationDelta);
 
-	// adjust base address of imported data
-	locationDelta = (DWORD)(code - old_header->OptionalHeader.ImageBase);
-	if (locationDelta != 0)
-		PerformBaseRelocation(result, locationDelta);
+		// nothing after this depends on anything but the base address
+		if (key != NULL)
+			SavePrelinkedImage(key, code, old_header->OptionalHeader.SizeOfImage);
+	}
 
 	// load required dlls and adjust function table of imports
-	if (!BuildImportTable(result))
+	if (!BuildImportTable(result, flags))
 		goto error;
 
+	// index the export table for MemoryGetProcAddress
+	BuildExportIndex(result);
+
 	// mark memory pages depending on section headers and release
-	// sections that are marked as "discardable"
-	FinalizeSections(result);
+	// sections that are marked as "discardable"; large pages can only
+	// be left as they are
+	if (!largePages)
+		FinalizeSections(result);
 
 	// get entry point of loaded library
 	if (result->headers->OptionalHeader.AddressOfEntryPoint != 0)
@@ -404,41 +1027,28 @@ error:
 
 FARPROC MemoryGetProcAddress(HMEMORYMODULE module, const char *name)
 {
-	unsigned char *codeBase = ((PMEMORYMODULE)module)->codeBase;
-	int idx=-1;
-	DWORD i, *nameRef;
-	WORD *ordinal;
-	PIMAGE_EXPORT_DIRECTORY exports;
-	PIMAGE_DATA_DIRECTORY directory = GET_HEADER_DICTIONARY((PMEMORYMODULE)module, IMAGE_DIRECTORY_ENTRY_EXPORT);
-	if (directory->Size == 0)
-		// no export table found
+	PIMAGE_EXPORT_DIRECTORY exports = GetExportDirectory((PMEMORYMODULE)module);
+	if (exports == NULL)
 		return NULL;
 
-	exports = (PIMAGE_EXPORT_DIRECTORY)(codeBase + directory->VirtualAddress);
-	if (exports->NumberOfNames == 0 || exports->NumberOfFunctions == 0)
-		// DLL doesn't export anything
-		return NULL;
-
-	// search function name in list of exported names
-	nameRef = (DWORD *)(codeBase + exports->AddressOfNames);
-	ordinal = (WORD *)(codeBase + exports->AddressOfNameOrdinals);
-	for (i=0; i<exports->NumberOfNames; i++, nameRef++, ordinal++)
-		if (stricmp(name, (const char *)(codeBase + *nameRef)) == 0)
-		{
-			idx = *ordinal;
-			break;
-		}
+	return GetExportAddress((PMEMORYMODULE)module, exports, FindExport((PMEMORYMODULE)module, exports, name));
+}
 
-	if (idx == -1)
-		// exported symbol not found
-		return NULL;
+int MemoryGetProcAddresses(HMEMORYMODULE module, const char *const *names, FARPROC *procs, int count)
+{
+	int i, found = 0;
+	PIMAGE_EXPORT_DIRECTORY exports = GetExportDirectory((PMEMORYMODULE)module);
 
-	if ((DWORD)idx > exports->NumberOfFunctions)
-		// name <-> ordinal number don't match
-		return NULL;
+	for (i=0; i<count; i++)
+	{
+		procs[i] = NULL;
+		if (exports != NULL)
+			procs[i] = GetExportAddress((PMEMORYMODULE)module, exports, FindExport((PMEMORYMODULE)module, exports, names[i]));
+		if (procs[i] != NULL)
+			found++;
+	}
 
-	// AddressOfFunctions contains the RVAs to the "real" functions
-	return (FARPROC)(codeBase + *(DWORD *)(codeBase + exports->AddressOfFunctions + (idx*4)));
+	return found;
 }
 
 void MemoryFreeLibrary(HMEMORYMODULE mod)
@@ -465,6 +1075,31 @@ void MemoryFreeLibrary(HMEMORYMODULE mod)
 
 			free(module->modules);
 		}
+		free(module->moduleNames);
+
+		if (module->exportIndex != NULL)
+			HeapFree(GetProcessHeap(), 0, module->exportIndex);
+
+#ifdef LAZY_IMPORTS
+		if (module->lazyLibraries != NULL)
+		{
+			// free the libraries lazy imports have been bound to
+			for (i=0; i<module->numLazyLibraries; i++)
+				if (module->lazyLibraries[i].handle != NULL)
+					FreeLibrary(module->lazyLibraries[i].handle);
+
+			HeapFree(GetProcessHeap(), 0, module->lazyLibraries);
+		}
+
+		if (module->lazyImports != NULL)
+			HeapFree(GetProcessHeap(), 0, module->lazyImports);
+
+		if (module->lazyStubs != NULL)
+		{
+			VirtualFree(module->lazyStubs, 0, MEM_RELEASE);
+			DeleteCriticalSection(&module->lazyLock);
+		}
+#endif
 
 		if (module->codeBase != NULL)
 			// release memory of library
@@ -37,8 +37,38 @@ extern "C" {
 
 HMEMORYMODULE MemoryLoadLibrary(const void *);
 
+// Bind imports from libraries that aren't loaded yet on first call rather
+// than at load time (32 bit x86 only, ignored elsewhere). Like /DELAYLOAD,
+// this must not be used for modules importing data from such libraries.
+// An import that can't be resolved raises the same exceptions as the
+// Visual C++ delay load helper.
+#define MEMORY_LOAD_LAZY_IMPORTS	0x0001
+
+// Map the whole image with large pages, so its code takes a few TLB entries
+// rather than one per 4 KB. Needs SeLockMemoryPrivilege granted to the user;
+// it is enabled in the process token as required. Large pages can't be
+// protected section by section, so the image stays readable, writable and
+// executable, and discardable sections are kept. Falls back to normal pages
+// if large ones can't be had, or the image can't be relocated to fit them.
+#define MEMORY_LOAD_LARGE_PAGES	0x0002
+
+HMEMORYMODULE MemoryLoadLibraryEx(const void *, DWORD flags);
+
+// Load a DLL of size bytes, keeping its image as it is once copied into
+// place and relocated, in cacheDir, so that the next load of the same DLL
+// at the same address reads it back in one go instead. Images are named
+// after the DLL's SHA-256 and the base address, and their headers checked
+// against both before use; a missing or stale one is made afresh. Imports
+// are bound and the entry point called every time. With a NULL or empty
+// cacheDir this is MemoryLoadLibraryEx. Needs sha256.c.
+HMEMORYMODULE MemoryLoadLibraryCached(const void *, size_t size, const char *cacheDir, DWORD flags);
+
 FARPROC MemoryGetProcAddress(HMEMORYMODULE, const char *);
 
+// Look up count names at once, storing NULL for any that aren't exported.
+// Returns how many were found.
+int MemoryGetProcAddresses(HMEMORYMODULE, const char *const *names, FARPROC *procs, int count);
+
 void MemoryFreeLibrary(HMEMORYMODULE);
 
 #ifdef __cplusplus
@@ -54,6 +54,11 @@ protected:
     /// num of filter taps
     uint length;
 
+    /// Scratch buffers for the coefficient design, sized by setLength() so
+    /// that changing the cutoff frequency doesn't allocate
+    double *work;
+    SAMPLETYPE *coeffs;
+
     /// Calculate the FIR coefficients realizing the given cutoff-frequency
     void calculateCoeffs();
 public:
@@ -198,7 +198,7 @@ BPMDetect::BPMDetect(int numChannels, int aSampleRate) :
     assert(windowLen > windowStart);
 
     // allocate new working objects
-    xcorr = new float[windowLen];
+    xcorr = (float *)alignedAlloc(windowLen * sizeof(float));
     memset(xcorr, 0, windowLen * sizeof(float));
 
     pos = 0;
@@ -206,8 +206,9 @@ BPMDetect::BPMDetect(int numChannels, int aSampleRate) :
     peakVal = 0;
     init_scaler = 1;
     beatcorr_ringbuffpos = 0;
-    beatcorr_ringbuff = new float[windowLen];
+    beatcorr_ringbuff = (float *)alignedAlloc(windowLen * sizeof(float));
     memset(beatcorr_ringbuff, 0, windowLen * sizeof(float));
+    sums = (float *)alignedAlloc(windowLen * sizeof(float));
 
     // allocate processing buffer
     buffer = new FIFOSampleBuffer();
@@ -216,19 +217,20 @@ BPMDetect::BPMDetect(int numChannels, int aSampleRate) :
     buffer->clear();
 
     // calculate hamming windows
-    hamw = new float[XCORR_UPDATE_SEQUENCE];
+    hamw = (float *)alignedAlloc(XCORR_UPDATE_SEQUENCE * sizeof(float));
     hamming(hamw, XCORR_UPDATE_SEQUENCE);
-    hamw2 = new float[XCORR_UPDATE_SEQUENCE / 2];
+    hamw2 = (float *)alignedAlloc(XCORR_UPDATE_SEQUENCE / 2 * sizeof(float));
     hamming(hamw2, XCORR_UPDATE_SEQUENCE / 2);
 }
 
 
 BPMDetect::~BPMDetect()
 {
-    delete[] xcorr;
-    delete[] beatcorr_ringbuff;
-    delete[] hamw;
-    delete[] hamw2;
+    alignedFree(xcorr);
+    alignedFree(beatcorr_ringbuff);
+    alignedFree(sums);
+    alignedFree(hamw);
+    alignedFree(hamw2);
     delete buffer;
 }
 
@@ -289,6 +291,63 @@ int BPMDetect::decimate(SAMPLETYPE *dest, const SAMPLETYPE *src, int numsamples)
 }
 
 
+// Number of correlation offsets that xcorrSums calculates at a time
+#define XCORR_BLOCK 8
+
+// Calculates sums of 'tmp[i] * pBuffer[offs + i]' over i = 0 .. length - 1 for 
+// offsets 'offs' of 'first' ... 'last' - 1, to 'sums[offs]'. Correlation values of
+// XCORR_BLOCK consecutive offsets are summed side by side, so that compilers can
+// turn the innermost loop into SIMD instructions. That keeps the summation order
+// of each offset same as with an ordinary loop, unlike vectorizing the sum over 'i'.
+static void xcorrSums(float *sums, const float *tmp, const SAMPLETYPE *pBuffer, 
+                      int length, int first, int last)
+{
+    int block;
+    const int numBlocks = (last - first + XCORR_BLOCK - 1) / XCORR_BLOCK;
+
+    #pragma omp parallel for
+    for (block = 0; block < numBlocks; block ++)
+    {
+        const int offs = first + block * XCORR_BLOCK;
+        float sum[XCORR_BLOCK];
+        int i, j;
+
+        if (offs + XCORR_BLOCK <= last)
+        {
+            for (j = 0; j < XCORR_BLOCK; j ++)
+            {
+                sum[j] = 0;
+            }
+            for (i = 0; i < length; i ++)
+            {
+                const SAMPLETYPE *p = pBuffer + offs + i;
+                for (j = 0; j < XCORR_BLOCK; j ++)
+                {
+                    sum[j] += tmp[i] * p[j];
+                }
+            }
+            for (j = 0; j < XCORR_BLOCK; j ++)
+            {
+                sums[offs + j] = sum[j];
+            }
+        }
+        else
+        {
+            // last partial block
+            for (j = offs; j < last; j ++)
+            {
+                float s = 0;
+                for (i = 0; i < length; i ++)
+                {
+                    s += tmp[i] * pBuffer[j + i];
+                }
+                sums[j] = s;
+            }
+        }
+    }
+}
+
+
 // Calculates autocorrelation function of the sample history buffer
 void BPMDetect::updateXCorr(int process_samples)
 {
@@ -310,20 +369,14 @@ void BPMDetect::updateXCorr(int process_samples)
         tmp[i] = hamw[i] * hamw[i] * pBuffer[i];
     }
 
-    #pragma omp parallel for
+    // scaling the sub-results shouldn't be necessary
+    xcorrSums(sums, tmp, pBuffer, process_samples, windowStart, windowLen);
+
     for (offs = windowStart; offs < windowLen; offs ++) 
     {
-        float sum;
-        int i;
-
-        sum = 0;
-        for (i = 0; i < process_samples; i ++) 
-        {
-            sum += tmp[i] * pBuffer[i + offs];  // scaling the sub-result shouldn't be necessary
-        }
         xcorr[offs] *= xcorr_decay;   // decay 'xcorr' here with suitable time constant.
 
-        xcorr[offs] += (float)fabs(sum);
+        xcorr[offs] += (float)fabs(sums[offs]);
     }
 }
 
@@ -349,14 +402,11 @@ void BPMDetect::updateBeatPos(int process_samples)
         tmp[i] = hamw2[i] * hamw2[i] * pBuffer[i];
     }
 
-    #pragma omp parallel for
+    xcorrSums(sums, tmp, pBuffer, process_samples, windowStart, windowLen);
+
     for (int offs = windowStart; offs < windowLen; offs++)
     {
-        float sum = 0;
-        for (int i = 0; i < process_samples; i++)
-        {
-            sum += tmp[i] * pBuffer[offs + i];
-        }
+        float sum = sums[offs];
         beatcorr_ringbuff[(beatcorr_ringbuffpos + offs) % windowLen] += (float)((sum > 0) ? sum : 0); // accumulate only positive correlations
     }
 
@@ -414,6 +464,7 @@ void BPMDetect::updateBeatPos(int process_samples)
 void BPMDetect::inputSamples(const SAMPLETYPE *samples, int numSamples)
 {
     SAMPLETYPE decimated[DECIMATED_BLOCK_SIZE];
+    int req = max(windowLen + XCORR_UPDATE_SEQUENCE, 2 * XCORR_UPDATE_SEQUENCE);
 
     // iterate so that max INPUT_BLOCK_SAMPLES processed per iteration
     while (numSamples > 0)
@@ -429,19 +480,19 @@ void BPMDetect::inputSamples(const SAMPLETYPE *samples, int numSamples)
         numSamples -= block;
 
         buffer->putSamples(decimated, decSamples);
-    }
 
-    // when the buffer has enough samples for processing...
-    int req = max(windowLen + XCORR_UPDATE_SEQUENCE, 2 * XCORR_UPDATE_SEQUENCE);
-    while ((int)buffer->numSamples() >= req) 
-    {
-        // ... update autocorrelations...
-        updateXCorr(XCORR_UPDATE_SEQUENCE);
-        // ...update beat position calculation...
-        updateBeatPos(XCORR_UPDATE_SEQUENCE / 2);
-        // ... and remove proceessed samples from the buffer
-        int n = XCORR_UPDATE_SEQUENCE / OVERLAP_FACTOR;
-        buffer->receiveSamples(n);
+        // when the buffer has enough samples for processing... Processing after 
+        // each block keeps the buffer size bounded however large 'samples' is.
+        while ((int)buffer->numSamples() >= req) 
+        {
+            // ... update autocorrelations...
+            updateXCorr(XCORR_UPDATE_SEQUENCE);
+            // ...update beat position calculation...
+            updateBeatPos(XCORR_UPDATE_SEQUENCE / 2);
+            // ... and remove proceessed samples from the buffer
+            int n = XCORR_UPDATE_SEQUENCE / OVERLAP_FACTOR;
+            buffer->receiveSamples(n);
+        }
     }
 }
 
@@ -527,7 +578,7 @@ float BPMDetect::getBpm()
     _SaveDebugData("soundtouch-bpm-xcorr.txt", xcorr, windowStart, windowLen, coeff);
 
     // Smoothen by N-point moving-average
-    float *data = new float[windowLen];
+    float *data = (float *)alignedAlloc(windowLen * sizeof(float));
     memset(data, 0, sizeof(float) * windowLen);
     MAFilter(data, xcorr, windowStart, windowLen, MOVING_AVERAGE_N);
 
@@ -537,7 +588,7 @@ float BPMDetect::getBpm()
     // save bpm debug data if debug data writing enabled
     _SaveDebugData("soundtouch-bpm-smoothed.txt", data, windowStart, windowLen, coeff);
 
-    delete[] data;
+    alignedFree(data);
 
     assert(decimateBy != 0);
     if (peakPos < 1e-9) return 0.0; // detection failed.
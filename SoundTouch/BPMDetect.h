@@ -87,6 +87,9 @@ namespace soundtouch
 
 
     /// Class for calculating BPM rate for audio data.
+    ///
+    /// Separate instances share no data, so several songs can be analyzed at the 
+    /// same time in threads of their own.
     class BPMDetect
     {
     protected:
@@ -127,6 +130,9 @@ namespace soundtouch
         float peakVal;
         float *beatcorr_ringbuff;
 
+        /// Correlation sums of the latest update, work buffer of 'windowLen' items
+        float *sums;
+
         /// FIFO-buffer for decimated processing samples.
         soundtouch::FIFOSampleBuffer *buffer;
 
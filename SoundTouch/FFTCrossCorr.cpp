@@ -0,0 +1,350 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// FFT-based cross-correlation for seeking the best overlapping position in 
+/// TDStretch.
+///
+/// Correlating a sequence of 'N' samples at 'M' offsets directly takes N * M 
+/// multiplications. Transforming both sequences, multiplying the spectra, 
+/// and transforming back gives the correlation at all offsets at once in 
+/// O((N + M) log (N + M)) time. Each channel is correlated separately, and 
+/// the spectra summed so that one inverse transform gives the total. Both 
+/// real sequences of a channel are transformed with a single complex FFT, as 
+/// the real & imaginary parts of its input.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <assert.h>
+
+#include "FFTCrossCorr.h"
+
+using namespace soundtouch;
+
+#ifndef M_PI
+    #define M_PI 3.14159265358979323846
+#endif
+
+
+FFTCrossCorr::FFTCrossCorr()
+{
+    fftSize = 0;
+    allocSize = 0;
+    allocInput = 0;
+    allocBuffers = 0;
+    pData = NULL;
+    pSum = NULL;
+    pTwiddle = NULL;
+    pSwaps = NULL;
+    numSwaps = 0;
+    pSquares = NULL;
+    pCorr = NULL;
+}
+
+
+FFTCrossCorr::~FFTCrossCorr()
+{
+    alignedFree(pData);
+    alignedFree(pSum);
+    alignedFree(pTwiddle);
+    alignedFree(pSwaps);
+    alignedFree(pSquares);
+    alignedFree(pCorr);
+}
+
+
+// Sets FFT length & reallocates buffers if necessary. Buffers only grow, so 
+// that changing the parameters back and forth doesn't reallocate.
+void FFTCrossCorr::setSize(int newFftSize, int inputFrames, int buffers)
+{
+    if (newFftSize > allocSize)
+    {
+        alignedFree(pData);
+        alignedFree(pSum);
+        alignedFree(pTwiddle);
+        alignedFree(pSwaps);
+        alignedFree(pCorr);
+
+        allocSize = newFftSize;
+        allocBuffers = buffers;
+        pData = (double *)alignedAlloc(2 * allocSize * allocBuffers * sizeof(double));
+        pSum = (double *)alignedAlloc((allocSize + 2) * sizeof(double));
+        pTwiddle = (double *)alignedAlloc(2 * allocSize * sizeof(double));
+        pSwaps = (int *)alignedAlloc(allocSize * sizeof(int));       // less than one pair per two values
+        pCorr = (double *)alignedAlloc(allocSize * sizeof(double));    // offsets never exceed FFT length
+        fftSize = 0;
+    }
+    else if (buffers > allocBuffers)
+    {
+        alignedFree(pData);
+        allocBuffers = buffers;
+        pData = (double *)alignedAlloc(2 * allocSize * allocBuffers * sizeof(double));
+    }
+
+    if (inputFrames + 1 > allocInput)
+    {
+        alignedFree(pSquares);
+        allocInput = inputFrames + 1;
+        pSquares = (double *)alignedAlloc(allocInput * sizeof(double));
+    }
+
+    if (newFftSize != fftSize)
+    {
+        int i, j, half;
+
+        fftSize = newFftSize;
+
+        // twiddles of stage with butterflies 'half' apart start at complex index 'half - 1'
+        for (half = 1; half < fftSize; half <<= 1)
+        {
+            for (j = 0; j < half; j ++)
+            {
+                pTwiddle[2 * (half - 1 + j)] = cos(M_PI * j / half);
+                pTwiddle[2 * (half - 1 + j) + 1] = -sin(M_PI * j / half);
+            }
+        }
+
+        // index pairs for bit-reversed reordering
+        numSwaps = 0;
+        for (i = 1, j = 0; i < fftSize; i ++)
+        {
+            int bit = fftSize >> 1;
+            for (; j & bit; bit >>= 1)
+            {
+                j ^= bit;
+            }
+            j ^= bit;
+
+            if (i < j)
+            {
+                pSwaps[numSwaps * 2] = i;
+                pSwaps[numSwaps * 2 + 1] = j;
+                numSwaps ++;
+            }
+        }
+    }
+}
+
+
+// In-place forward FFT of 'data'. Iterative radix-2 algorithm, with the inner 
+// loop running over consecutive butterflies & twiddles so that the compiler 
+// can vectorize it.
+void FFTCrossCorr::fft(double *data) const
+{
+    int i, j, half;
+    const int n = fftSize;
+
+    // reorder to bit-reversed index order
+    for (i = 0; i < numSwaps; i ++)
+    {
+        double *a = data + 2 * pSwaps[2 * i];
+        double *b = data + 2 * pSwaps[2 * i + 1];
+        double temp;
+
+        temp = a[0]; a[0] = b[0]; b[0] = temp;
+        temp = a[1]; a[1] = b[1]; b[1] = temp;
+    }
+
+    // first stage has only trivial twiddles
+    for (i = 0; i < 2 * n; i += 4)
+    {
+        double *a = data + i;
+        const double tr = a[2];
+        const double ti = a[3];
+
+        a[2] = a[0] - tr;
+        a[3] = a[1] - ti;
+        a[0] += tr;
+        a[1] += ti;
+    }
+
+    for (half = 2; half < n; half <<= 1)
+    {
+        const double *w = pTwiddle + 2 * (half - 1);
+
+        for (i = 0; i < 2 * n; i += 4 * half)
+        {
+            double *a = data + i;
+            double *b = a + 2 * half;
+
+            for (j = 0; j < 2 * half; j += 2)
+            {
+                const double tr = b[j] * w[j] - b[j + 1] * w[j + 1];
+                const double ti = b[j] * w[j + 1] + b[j + 1] * w[j];
+
+                b[j] = a[j] - tr;
+                b[j + 1] = a[j + 1] - ti;
+                a[j] += tr;
+                a[j + 1] += ti;
+            }
+        }
+    }
+}
+
+
+// Allocates the buffers for calculating up to 'count' offsets of 'length' frames
+// long sequences
+void FFTCrossCorr::reserve(int channels, int length, int count)
+{
+    int n;
+
+#ifdef _OPENMP
+    const int buffers = channels;
+#else
+    // channels are transformed one after another in a single buffer
+    const int buffers = 1;
+    (void)channels;
+#endif
+
+    const int inputFrames = count - 1 + length;
+    for (n = 2; n < inputFrames; n <<= 1) {}
+    setSize(n, inputFrames, buffers);
+}
+
+
+// Calculates normalized cross-correlation of 'compare' against 'mixingPos' at
+// offsets of 0, 1, ..., count - 1 sample frames
+const double *FFTCrossCorr::calculate(const SAMPLETYPE *mixingPos, const SAMPLETYPE *compare, 
+                                      int channels, int length, int count)
+{
+    int i, c, first;
+    int n;
+
+    assert(channels > 0 && length > 0 && count > 0);
+
+#ifdef _OPENMP
+    const int buffers = channels;
+#else
+    const int buffers = 1;
+#endif
+
+    // FFT must be long enough that the correlation doesn't wrap around
+    const int inputFrames = count - 1 + length;
+    for (n = 2; n < inputFrames; n <<= 1) {}
+    setSize(n, inputFrames, buffers);
+
+    // sum of squares of all channels, for normalizing
+    pSquares[0] = 0;
+    for (i = 0; i < inputFrames; i ++)
+    {
+        double sum = 0;
+        for (c = 0; c < channels; c ++)
+        {
+            const double x = (double)mixingPos[i * channels + c];
+            sum += x * x;
+        }
+        pSquares[i + 1] = pSquares[i] + sum;
+    }
+
+    for (first = 0; first < channels; first += buffers)
+    {
+        const int last = (first + buffers < channels) ? first + buffers : channels;
+
+        // Transform the channels in parallel threads, each into its own buffer
+        #pragma omp parallel for private(i)
+        for (c = first; c < last; c ++)
+        {
+            double *data = pData + 2 * n * (c - first);
+
+            // transform both sequences at once, 'mixingPos' as the real part and
+            // 'compare' as the imaginary part
+            for (i = 0; i < length; i ++)
+            {
+                data[2 * i] = (double)mixingPos[i * channels + c];
+                data[2 * i + 1] = (double)compare[i * channels + c];
+            }
+            for (; i < inputFrames; i ++)
+            {
+                data[2 * i] = (double)mixingPos[i * channels + c];
+                data[2 * i + 1] = 0;
+            }
+            for (i *= 2; i < 2 * n; i ++)
+            {
+                data[i] = 0;
+            }
+
+            fft(data);
+        }
+
+        // Then sum the channels in fixed order, so that the result doesn't 
+        // depend on the number of threads
+        for (c = first; c < last; c ++)
+        {
+            const double *data = pData + 2 * n * (c - first);
+
+            // separate the spectra X & Y of the two sequences, and sum X * conj(Y), 
+            // which is the spectrum of their cross-correlation
+            for (i = 0; i <= n / 2; i ++)
+            {
+                const int k = (n - i) & (n - 1);
+                const double zr = data[2 * i], zi = data[2 * i + 1];
+                const double wr = data[2 * k], wi = data[2 * k + 1];
+
+                // X = (Z[i] + conj(Z[n - i])) / 2, Y = (Z[i] - conj(Z[n - i])) / 2i
+                const double xr = 0.5 * (zr + wr), xi = 0.5 * (zi - wi);
+                const double yr = 0.5 * (zi + wi), yi = 0.5 * (wr - zr);
+
+                const double pr = xr * yr + xi * yi;
+                const double pi = xi * yr - xr * yi;
+
+                if (c == 0)
+                {
+                    pSum[2 * i] = pr;
+                    pSum[2 * i + 1] = pi;
+                }
+                else
+                {
+                    pSum[2 * i] += pr;
+                    pSum[2 * i + 1] += pi;
+                }
+            }
+        }
+    }
+
+    // inverse transform is real, so do it as forward transform of the conjugate
+    for (i = 0; i <= n / 2; i ++)
+    {
+        const int k = (n - i) & (n - 1);
+
+        pData[2 * i] = pSum[2 * i];
+        pData[2 * i + 1] = -pSum[2 * i + 1];
+        pData[2 * k] = pSum[2 * i];
+        pData[2 * k + 1] = pSum[2 * i + 1];
+    }
+
+    fft(pData);
+
+    // normalize like calcCrossCorr does
+    const double scale = 1.0 / n;
+    for (i = 0; i < count; i ++)
+    {
+        const double norm = pSquares[i + length] - pSquares[i];
+        pCorr[i] = pData[2 * i] * scale / sqrt((norm < 1e-9) ? 1.0 : norm);
+    }
+
+    return pCorr;
+}
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Calculates cross-correlation of two sample sequences at many offsets at 
+/// once using FFT. Used by TDStretch for seeking the best overlapping 
+/// position, where this is faster than correlating each offset separately 
+/// when the seek window and overlap are long.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FFTCrossCorr_H
+#define FFTCrossCorr_H
+
+#include "STTypes.h"
+
+namespace soundtouch
+{
+
+class FFTCrossCorr
+{
+protected:
+    /// FFT length, a power of 2, and buffer sizes it has been allocated for
+    int fftSize;
+    int allocSize;
+    int allocInput;
+    int allocBuffers;
+
+    /// FFT work buffers of complex values, real & imaginary parts interleaved. 
+    /// There's one buffer per channel when built with OpenMP, so that the 
+    /// channels can be transformed in parallel.
+    double *pData;
+
+    /// Cross-correlation spectrum summed over channels, also complex
+    double *pSum;
+
+    /// Complex twiddle factors of each FFT stage one after another, 'fftSize' - 1 
+    /// in total
+    double *pTwiddle;
+
+    /// Pairs of indices to swap for reordering FFT input to bit-reversed order,
+    /// and number of pairs
+    int *pSwaps;
+    int numSwaps;
+
+    /// Running sum of squared input samples, for normalizing the correlation
+    double *pSquares;
+
+    /// Result of the latest 'calculate' call
+    double *pCorr;
+
+    /// Sets FFT length & reallocates buffers if necessary.
+    void setSize(int newFftSize, int inputFrames, int buffers);
+
+    /// In-place forward FFT of 'data', 'fftSize' complex values
+    void fft(double *data) const;
+
+public:
+    FFTCrossCorr();
+    ~FFTCrossCorr();
+
+    /// Allocates the buffers for 'calculate' calls with parameters up to these
+    /// in advance, so that such calls won't allocate memory.
+    void reserve(int channels, int length, int count);
+
+    /// Calculates normalized cross-correlation of 'compare' against 'mixingPos' at
+    /// offsets of 0, 1, ..., count - 1 sample frames. Same as TDStretch's 
+    /// calcCrossCorr, but for all offsets at once.
+    ///
+    /// \return Array of 'count' correlation values, valid until the next call.
+    const double *calculate(const SAMPLETYPE *mixingPos, ///< Samples to search; must be at least
+                                                         ///< count - 1 + length frames long.
+                            const SAMPLETYPE *compare,   ///< Sequence to look for.
+                            int channels,                ///< Number of interleaved channels.
+                            int length,                  ///< Length of 'compare' in sample frames.
+                            int count                    ///< Number of offsets to calculate.
+                            );
+};
+
+}
+
+#endif // FFTCrossCorr_H
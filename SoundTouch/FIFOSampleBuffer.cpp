@@ -51,7 +51,7 @@ FIFOSampleBuffer::FIFOSampleBuffer(int numChannels)
     assert(numChannels > 0);
     sizeInBytes = 0; // reasonable initial value
     buffer = NULL;
-    bufferUnaligned = NULL;
+    bufferAlloc = NULL;
     samplesInBuffer = 0;
     bufferPos = 0;
     channels = (uint)numChannels;
@@ -62,8 +62,8 @@ FIFOSampleBuffer::FIFOSampleBuffer(int numChannels)
 // destructor
 FIFOSampleBuffer::~FIFOSampleBuffer()
 {
-    delete[] bufferUnaligned;
-    bufferUnaligned = NULL;
+    alignedFree(bufferAlloc);
+    bufferAlloc = NULL;
     buffer = NULL;
 }
 
@@ -75,6 +75,8 @@ void FIFOSampleBuffer::setChannels(int numChannels)
 
     if (!verifyNumberOfChannels(numChannels)) return;
 
+    // 'bufferPos' is counted in sample frames, so rewind before changing their size
+    rewind();
     usedBytes = channels * samplesInBuffer;
     channels = (uint)numChannels;
     samplesInBuffer = usedBytes / channels;
@@ -134,7 +136,7 @@ void FIFOSampleBuffer::putSamples(uint nSamples)
 SAMPLETYPE *FIFOSampleBuffer::ptrEnd(uint slackCapacity) 
 {
     ensureCapacity(samplesInBuffer + slackCapacity);
-    return buffer + samplesInBuffer * channels;
+    return ptrBegin() + samplesInBuffer * channels;
 }
 
 
@@ -156,39 +158,64 @@ SAMPLETYPE *FIFOSampleBuffer::ptrBegin()
 // 'capacityRequirement' number of samples. The buffer is grown in steps of
 // 4 kilobytes to eliminate the need for frequently growing up the buffer,
 // as well as to round the buffer size up to the virtual memory page size.
+//
+// The remaining samples are moved to the beginning of the buffer only when 
+// there isn't enough room after them, instead of every time that samples are 
+// added, so that the move happens once per roughly buffer full of output 
+// samples rather than once per processing round.
 void FIFOSampleBuffer::ensureCapacity(uint capacityRequirement)
 {
-    SAMPLETYPE *tempUnaligned, *temp;
+    SAMPLETYPE *temp;
 
     if (capacityRequirement > getCapacity()) 
     {
         // enlarge the buffer in 4kbyte steps (round up to next 4k boundary)
         sizeInBytes = (capacityRequirement * channels * sizeof(SAMPLETYPE) + 4095) & (uint)-4096;
         assert(sizeInBytes % 2 == 0);
-        tempUnaligned = new SAMPLETYPE[sizeInBytes / sizeof(SAMPLETYPE) + 16 / sizeof(SAMPLETYPE)];
-        if (tempUnaligned == NULL)
-        {
-            ST_THROW_RT_ERROR("Couldn't allocate memory!\n");
-        }
-        // Align the buffer to begin at 16byte cache line boundary for optimal performance
-        temp = (SAMPLETYPE *)SOUNDTOUCH_ALIGN_POINTER_16(tempUnaligned);
+        // The buffer begins at cache line boundary for optimal performance
+        temp = (SAMPLETYPE *)alignedAlloc(sizeInBytes);
         if (samplesInBuffer)
         {
             memcpy(temp, ptrBegin(), samplesInBuffer * channels * sizeof(SAMPLETYPE));
         }
-        delete[] bufferUnaligned;
+        alignedFree(bufferAlloc);
         buffer = temp;
-        bufferUnaligned = tempUnaligned;
+        bufferAlloc = temp;
         bufferPos = 0;
     } 
-    else 
+    else if (bufferPos + capacityRequirement > getCapacity())
     {
-        // simply rewind the buffer (if necessary)
+        // simply rewind the buffer
         rewind();
     }
 }
 
 
+// Grows the buffer to hold at least 'numSamples' sample frames
+void FIFOSampleBuffer::reserve(uint numSamples)
+{
+    ensureCapacity(numSamples);
+}
+
+
+// Makes the buffer use caller-provided memory for storing the samples
+void FIFOSampleBuffer::setStorage(SAMPLETYPE *memory, uint sizeInSamples)
+{
+    assert(memory);
+    assert(sizeInSamples >= samplesInBuffer * channels);
+
+    if (samplesInBuffer)
+    {
+        memmove(memory, ptrBegin(), samplesInBuffer * channels * sizeof(SAMPLETYPE));
+    }
+    alignedFree(bufferAlloc);
+    bufferAlloc = NULL;         // not ours to free
+    buffer = memory;
+    sizeInBytes = sizeInSamples * sizeof(SAMPLETYPE);
+    bufferPos = 0;
+}
+
+
 // Returns the current buffer capacity in terms of samples
 uint FIFOSampleBuffer::getCapacity() const
 {
@@ -230,6 +257,7 @@ uint FIFOSampleBuffer::receiveSamples(uint maxSamples)
 
         temp = samplesInBuffer;
         samplesInBuffer = 0;
+        bufferPos = 0;      // no samples to move, so start from the beginning for free
         return temp;
     }
 
@@ -55,9 +55,9 @@ private:
     /// Sample buffer.
     SAMPLETYPE *buffer;
 
-    // Raw unaligned buffer memory. 'buffer' is made aligned by pointing it to first
-    // 16-byte aligned location of this buffer
-    SAMPLETYPE *bufferUnaligned;
+    // Buffer memory from 'alignedAlloc', or NULL if 'buffer' points to memory 
+    // given with 'setStorage'
+    SAMPLETYPE *bufferAlloc;
 
     /// Sample buffer size in bytes
     uint sizeInBytes;
@@ -70,7 +70,7 @@ private:
 
     /// Current position pointer to the buffer. This pointer is increased when samples are 
     /// removed from the pipe so that it's necessary to actually rewind buffer (move data)
-    /// only new data when is put to the pipe.
+    /// only when new data doesn't fit after the samples in the buffer.
     uint bufferPos;
 
     /// Rewind the buffer by moving data from position pointed by 'bufferPos' to real 
@@ -152,6 +152,20 @@ public:
     /// Returns number of samples currently available.
     virtual uint numSamples() const;
 
+    /// Makes the buffer store its samples in memory provided by the caller instead 
+    /// of allocating it. Samples currently in the buffer are moved to the new memory.
+    /// The buffer doesn't free the memory; it must stay valid until the buffer is
+    /// destroyed or given other memory. If more samples need to be stored than fit 
+    /// in the memory, the buffer switches back to memory of its own.
+    void setStorage(SAMPLETYPE *memory,  ///< Sample memory, preferably 16-byte aligned.
+                    uint sizeInSamples   ///< Memory size in SAMPLETYPE values, i.e. 
+                                         ///< sample frames times channels.
+                    );
+
+    /// Grows the buffer so that it can hold at least 'numSamples' sample frames
+    /// without allocating more memory.
+    void reserve(uint numSamples);
+
     /// Sets number of channels, 1 = mono, 2 = stereo.
     void setChannels(int numChannels);
 
@@ -65,7 +65,7 @@ FIRFilter::FIRFilter()
 
 FIRFilter::~FIRFilter()
 {
-    delete[] filterCoeffs;
+    alignedFree(filterCoeffs);
 }
 
 
@@ -215,6 +215,8 @@ uint FIRFilter::evaluateFilterMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, uin
         {
 #ifdef SOUNDTOUCH_INTEGER_SAMPLES
             sums[c] >>= resultDivFactor;
+            // saturate to 16 bit integer limits, as in the mono & stereo versions
+            sums[c] = (sums[c] < -32768) ? -32768 : (sums[c] > 32767) ? 32767 : sums[c];
 #else
             sums[c] *= dScaler;
 #endif // SOUNDTOUCH_INTEGER_SAMPLES
@@ -233,6 +235,14 @@ void FIRFilter::setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint u
     assert(newLength > 0);
     if (newLength % 8) ST_THROW_RT_ERROR("FIR filter length not divisible by 8");
 
+    // keep the old buffer when only the coefficient values change, so that
+    // updating the cutoff doesn't touch the heap
+    if ((filterCoeffs == NULL) || (newLength != length))
+    {
+        alignedFree(filterCoeffs);
+        filterCoeffs = (SAMPLETYPE *)alignedAlloc(newLength * sizeof(SAMPLETYPE));
+    }
+
     lengthDiv8 = newLength / 8;
     length = lengthDiv8 * 8;
     assert(length == newLength);
@@ -240,8 +250,6 @@ void FIRFilter::setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint u
     resultDivFactor = uResultDivFactor;
     resultDivider = (SAMPLETYPE)::pow(2.0, (int)resultDivFactor);
 
-    delete[] filterCoeffs;
-    filterCoeffs = new SAMPLETYPE[length];
     memcpy(filterCoeffs, coeffs, length * sizeof(SAMPLETYPE));
 }
 
@@ -297,7 +305,25 @@ FIRFilter * FIRFilter::newInstance()
 
     uExtensions = detectCPUextensions();
 
-    // Check if MMX/SSE instruction set extensions supported by CPU
+    // Check if AVX2/SSE2/MMX/SSE/NEON instruction set extensions supported by CPU
+
+#ifdef SOUNDTOUCH_ALLOW_AVX2
+    if (uExtensions & SUPPORT_AVX2)
+    {
+        // AVX2 & FMA support, for both sample types
+        return ::new FIRFilterAVX2;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_AVX2
+
+#ifdef SOUNDTOUCH_ALLOW_SSE2
+    // SSE2 routines available only with integer sample types
+    if (uExtensions & SUPPORT_SSE2)
+    {
+        return ::new FIRFilterSSE2;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_SSE2
 
 #ifdef SOUNDTOUCH_ALLOW_MMX
     // MMX routines available only with integer sample types
@@ -317,6 +343,15 @@ FIRFilter * FIRFilter::newInstance()
     else
 #endif // SOUNDTOUCH_ALLOW_SSE
 
+#ifdef SOUNDTOUCH_ALLOW_NEON
+    if (uExtensions & SUPPORT_NEON)
+    {
+        // NEON support
+        return ::new FIRFilterNEON;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_NEON
+
     {
         // ISA optimizations not supported, use plain C version
         return ::new FIRFilter;
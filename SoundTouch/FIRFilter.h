@@ -102,7 +102,6 @@ public:
     class FIRFilterMMX : public FIRFilter
     {
     protected:
-        short *filterCoeffsUnalign;
         short *filterCoeffsAlign;
 
         virtual uint evaluateFilterStereo(short *dest, const short *src, uint numSamples) const;
@@ -116,12 +115,37 @@ public:
 #endif // SOUNDTOUCH_ALLOW_MMX
 
 
+#ifdef SOUNDTOUCH_ALLOW_SSE2
+    /// Class that implements SSE2 optimized functions exclusive for 16bit integer samples 
+    /// type, for mono, stereo & multichannel sound like FIRFilterAVX2. Used instead of 
+    /// FIRFilterMMX, which isn't available in X64 mode.
+    class FIRFilterSSE2 : public FIRFilter
+    {
+    protected:
+        /// Pairs of consecutive filter coefficients packed into 32 bits for 'pmaddwd'
+        int *filterCoeffsPaired;
+
+        SOUNDTOUCH_TARGET_SSE2 uint evaluateFilterSSE2(short *dest, const short *src, 
+                                                       uint numSamples, uint numChannels) const;
+
+        virtual uint evaluateFilterStereo(short *dest, const short *src, uint numSamples) const;
+        virtual uint evaluateFilterMono(short *dest, const short *src, uint numSamples) const;
+        virtual uint evaluateFilterMulti(short *dest, const short *src, uint numSamples, uint numChannels);
+    public:
+        FIRFilterSSE2();
+        ~FIRFilterSSE2();
+
+        virtual void setCoefficients(const short *coeffs, uint newLength, uint uResultDivFactor);
+    };
+
+#endif // SOUNDTOUCH_ALLOW_SSE2
+
+
 #ifdef SOUNDTOUCH_ALLOW_SSE
     /// Class that implements SSE optimized functions exclusive for floating point samples type.
     class FIRFilterSSE : public FIRFilter
     {
     protected:
-        float *filterCoeffsUnalign;
         float *filterCoeffsAlign;
 
         virtual uint evaluateFilterStereo(float *dest, const float *src, uint numSamples) const;
@@ -134,6 +158,64 @@ public:
 
 #endif // SOUNDTOUCH_ALLOW_SSE
 
+
+#ifdef SOUNDTOUCH_ALLOW_AVX2
+    /// Class that implements AVX2 & FMA optimized functions for both sample types. 
+    /// Each output value is a sum of input values 'numChannels' apart, so the same 
+    /// routine filters mono, stereo & multichannel sound.
+    class FIRFilterAVX2 : public FIRFilter
+    {
+    protected:
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+        /// Filter coefficients divided by 'resultDivider', so that results needn't be scaled
+        float *filterCoeffsScaled;
+#else
+        /// Pairs of consecutive filter coefficients packed into 32 bits for 'vpmaddwd'
+        int *filterCoeffsPaired;
+#endif
+
+        SOUNDTOUCH_TARGET_AVX2 uint evaluateFilterAVX2(SAMPLETYPE *dest, const SAMPLETYPE *src, 
+                                                       uint numSamples, uint numChannels) const;
+
+        virtual uint evaluateFilterStereo(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const;
+        virtual uint evaluateFilterMono(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const;
+        virtual uint evaluateFilterMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples, uint numChannels);
+    public:
+        FIRFilterAVX2();
+        ~FIRFilterAVX2();
+
+        virtual void setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint uResultDivFactor);
+    };
+
+#endif // SOUNDTOUCH_ALLOW_AVX2
+
+
+#ifdef SOUNDTOUCH_ALLOW_NEON
+    /// Class that implements NEON optimized functions for both sample types, for 
+    /// mono, stereo & multichannel sound like FIRFilterAVX2.
+    class FIRFilterNEON : public FIRFilter
+    {
+    protected:
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+        /// Filter coefficients divided by 'resultDivider', so that results needn't be scaled
+        float *filterCoeffsScaled;
+#endif
+
+        uint evaluateFilterNEON(SAMPLETYPE *dest, const SAMPLETYPE *src, 
+                                uint numSamples, uint numChannels) const;
+
+        virtual uint evaluateFilterStereo(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const;
+        virtual uint evaluateFilterMono(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const;
+        virtual uint evaluateFilterMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples, uint numChannels);
+    public:
+        FIRFilterNEON();
+        ~FIRFilterNEON();
+
+        virtual void setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint uResultDivFactor);
+    };
+
+#endif // SOUNDTOUCH_ALLOW_NEON
+
 }
 
 #endif  // FIRFilter_H
@@ -154,21 +154,44 @@ int InterpolateCubic::transposeMulti(SAMPLETYPE *pdest,
                     const SAMPLETYPE *psrc, 
                     int &srcSamples)
 {
-    int i;
+    int i, count;
     int srcSampleEnd = srcSamples - 4;
     int srcCount = 0;
 
-    i = 0;
+    // First step through the source positions of output frames. That has to
+    // be done in order, but is cheap compared to interpolating the channels.
+    reserveFrameTable(srcSamples);
+    count = 0;
     while (srcCount < srcSampleEnd)
     {
+        assert(fract < 1.0);
+        assert(count < frameTableSize);
+
+        pFramePos[count] = srcCount * numChannels;
+        pFrameFract[count] = fract;
+        count ++;
+
+        // update position fraction
+        fract += rate;
+        // update whole positions
+        int whole = (int)fract;
+        fract -= whole;
+        srcCount += whole;
+    }
+
+    // Output frames are then independent of each other, so OpenMP can share
+    // them between threads
+    #pragma omp parallel for
+    for (i = 0; i < count; i ++)
+    {
+        const SAMPLETYPE *src = psrc + pFramePos[i];
+        SAMPLETYPE *dest = pdest + i * numChannels;
         const float x3 = 1.0f;
-        const float x2 = (float)fract;    // x
-        const float x1 = x2*x2;           // x^2
-        const float x0 = x1*x2;           // x^3
+        const float x2 = (float)pFrameFract[i];    // x
+        const float x1 = x2*x2;                    // x^2
+        const float x0 = x1*x2;                    // x^3
         float y0, y1, y2, y3;
 
-        assert(fract < 1.0);
-
         y0 =  _coeffs[0] * x0 +  _coeffs[1] * x1 +  _coeffs[2] * x2 +  _coeffs[3] * x3;
         y1 =  _coeffs[4] * x0 +  _coeffs[5] * x1 +  _coeffs[6] * x2 +  _coeffs[7] * x3;
         y2 =  _coeffs[8] * x0 +  _coeffs[9] * x1 + _coeffs[10] * x2 + _coeffs[11] * x3;
@@ -177,20 +200,10 @@ int InterpolateCubic::transposeMulti(SAMPLETYPE *pdest,
         for (int c = 0; c < numChannels; c ++)
         {
             float out;
-            out = y0 * psrc[c] + y1 * psrc[c + numChannels] + y2 * psrc[c + 2 * numChannels] + y3 * psrc[c + 3 * numChannels];
-            pdest[0] = (SAMPLETYPE)out;
-            pdest ++;
+            out = y0 * src[c] + y1 * src[c + numChannels] + y2 * src[c + 2 * numChannels] + y3 * src[c + 3 * numChannels];
+            dest[c] = (SAMPLETYPE)out;
         }
-        i ++;
-
-        // update position fraction
-        fract += rate;
-        // update whole positions
-        int whole = (int)fract;
-        fract -= whole;
-        psrc += numChannels*whole;
-        srcCount += whole;
     }
     srcSamples = srcCount;
-    return i;
+    return count;
 }
@@ -56,6 +56,11 @@ protected:
 
 public:
     InterpolateCubic();
+
+    virtual int getLatency() const
+    {
+        return 4;
+    }
 };
 
 }
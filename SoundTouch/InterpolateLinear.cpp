@@ -132,35 +132,48 @@ int InterpolateLinearInteger::transposeStereo(SAMPLETYPE *dest, const SAMPLETYPE
 
 int InterpolateLinearInteger::transposeMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, int &srcSamples)
 {
-    int i;
+    int i, count;
     int srcSampleEnd = srcSamples - 1;
     int srcCount = 0;
 
-    i = 0;
+    // Step through the source positions in order first, then interpolate
+    // the output frames in parallel, as in InterpolateCubic
+    reserveFrameTable(srcSamples);
+    count = 0;
     while (srcCount < srcSampleEnd)
     {
-        LONG_SAMPLETYPE temp, vol1;
-    
         assert(iFract < SCALE);
-        vol1 = (SCALE - iFract);
-        for (int c = 0; c < numChannels; c ++)
-        {
-            temp = vol1 * src[c] + iFract * src[c + numChannels];
-            dest[0] = (SAMPLETYPE)(temp / SCALE);
-            dest ++;
-        }
-        i++;
+        assert(count < frameTableSize);
+
+        pFramePos[count] = srcCount * numChannels;
+        pFrameFract[count] = iFract;
+        count ++;
 
         iFract += iRate;
 
         int iWhole = iFract / SCALE;
         iFract -= iWhole * SCALE;
         srcCount += iWhole;
-        src += iWhole * numChannels;
+    }
+
+    #pragma omp parallel for
+    for (i = 0; i < count; i ++)
+    {
+        const SAMPLETYPE *psrc = src + pFramePos[i];
+        SAMPLETYPE *pdest = dest + i * numChannels;
+        LONG_SAMPLETYPE temp, vol1, fract;
+
+        fract = (LONG_SAMPLETYPE)pFrameFract[i];
+        vol1 = (SCALE - fract);
+        for (int c = 0; c < numChannels; c ++)
+        {
+            temp = vol1 * psrc[c] + fract * psrc[c + numChannels];
+            pdest[c] = (SAMPLETYPE)(temp / SCALE);
+        }
     }
     srcSamples = srcCount;
 
-    return i;
+    return count;
 }
 
 
@@ -264,33 +277,45 @@ int InterpolateLinearFloat::transposeStereo(SAMPLETYPE *dest, const SAMPLETYPE *
 
 int InterpolateLinearFloat::transposeMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, int &srcSamples)
 {
-    int i;
+    int i, count;
     int srcSampleEnd = srcSamples - 1;
     int srcCount = 0;
 
-    i = 0;
+    // Step through the source positions in order first, then interpolate
+    // the output frames in parallel, as in InterpolateCubic
+    reserveFrameTable(srcSamples);
+    count = 0;
     while (srcCount < srcSampleEnd)
     {
-        float temp, vol1, fract_float;
-    
-        vol1 = (float)(1.0 - fract);
-		fract_float = (float)fract;
-        for (int c = 0; c < numChannels; c ++)
-        {
-			temp = vol1 * src[c] + fract_float * src[c + numChannels];
-            *dest = (SAMPLETYPE)temp;
-            dest ++;
-        }
-        i++;
+        assert(count < frameTableSize);
+
+        pFramePos[count] = srcCount * numChannels;
+        pFrameFract[count] = fract;
+        count ++;
 
         fract += rate;
 
         int iWhole = (int)fract;
         fract -= iWhole;
         srcCount += iWhole;
-        src += iWhole * numChannels;
+    }
+
+    #pragma omp parallel for
+    for (i = 0; i < count; i ++)
+    {
+        const SAMPLETYPE *psrc = src + pFramePos[i];
+        SAMPLETYPE *pdest = dest + i * numChannels;
+        float temp, vol1, fract_float;
+    
+        vol1 = (float)(1.0 - pFrameFract[i]);
+        fract_float = (float)pFrameFract[i];
+        for (int c = 0; c < numChannels; c ++)
+        {
+            temp = vol1 * psrc[c] + fract_float * psrc[c + numChannels];
+            pdest[c] = (SAMPLETYPE)temp;
+        }
     }
     srcSamples = srcCount;
 
-    return i;
+    return count;
 }
@@ -57,6 +57,11 @@ protected:
 public:
     InterpolateLinearInteger();
 
+    virtual int getLatency() const
+    {
+        return 1;
+    }
+
     /// Sets new target rate. Normal rate = 1.0, smaller values represent slower 
     /// rate, larger faster rates.
     virtual void setRate(double newRate);
@@ -81,6 +86,11 @@ protected:
 
 public:
     InterpolateLinearFloat();
+
+    virtual int getLatency() const
+    {
+        return 1;
+    }
 };
 
 }
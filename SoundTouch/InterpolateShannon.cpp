@@ -69,7 +69,28 @@ void InterpolateShannon::resetRegisters()
 
 
 #define PI 3.1415926536
-#define sinc(x) (sin(PI * (x)) / (PI * (x)))
+
+/// Signs of sin(PI * (k - fract)) relative to sin(PI * fract) for the taps
+/// k = -3 .. 4
+static const double _sinSign[8] = { 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0 };
+
+/// Calculates the windowed sinc weights of the 8 taps for position 'fract' 
+/// after the 4th tap. As sin(PI * (k - fract)) = -(-1)^k * sin(PI * fract) for 
+/// integer k, one sin() call gives the sinc values of all taps.
+static inline void shannonWeights(double fract, double *w)
+{
+    const double s = sin(PI * fract) / PI;
+
+    for (int k = 0; k < 8; k ++)
+    {
+        w[k] = _sinSign[k] * s / (k - 3.0 - fract) * _kaiser8[k];
+    }
+    if (fract < 1e-6)
+    {
+        w[3] = _kaiser8[3];     // sinc(0) = 1
+    }
+}
+
 
 /// Transpose mono audio. Returns number of produced output samples, and 
 /// updates "srcSamples" to amount of consumed source samples
@@ -84,24 +105,18 @@ int InterpolateShannon::transposeMono(SAMPLETYPE *pdest,
     i = 0;
     while (srcCount < srcSampleEnd)
     {
-        double out;
+        double out, w[8];
         assert(fract < 1.0);
 
-        out  = psrc[0] * sinc(-3.0 - fract) * _kaiser8[0];
-        out += psrc[1] * sinc(-2.0 - fract) * _kaiser8[1];
-        out += psrc[2] * sinc(-1.0 - fract) * _kaiser8[2];
-        if (fract < 1e-6)
-        {
-            out += psrc[3] * _kaiser8[3];     // sinc(0) = 1
-        }
-        else
-        {
-            out += psrc[3] * sinc(- fract) * _kaiser8[3];
-        }
-        out += psrc[4] * sinc( 1.0 - fract) * _kaiser8[4];
-        out += psrc[5] * sinc( 2.0 - fract) * _kaiser8[5];
-        out += psrc[6] * sinc( 3.0 - fract) * _kaiser8[6];
-        out += psrc[7] * sinc( 4.0 - fract) * _kaiser8[7];
+        shannonWeights(fract, w);
+        out  = psrc[0] * w[0];
+        out += psrc[1] * w[1];
+        out += psrc[2] * w[2];
+        out += psrc[3] * w[3];
+        out += psrc[4] * w[4];
+        out += psrc[5] * w[5];
+        out += psrc[6] * w[6];
+        out += psrc[7] * w[7];
 
         pdest[i] = (SAMPLETYPE)out;
         i ++;
@@ -132,25 +147,18 @@ int InterpolateShannon::transposeStereo(SAMPLETYPE *pdest,
     i = 0;
     while (srcCount < srcSampleEnd)
     {
-        double out0, out1, w;
+        double out0, out1, w[8];
         assert(fract < 1.0);
 
-        w = sinc(-3.0 - fract) * _kaiser8[0];
-        out0 = psrc[0] * w; out1 = psrc[1] * w;
-        w = sinc(-2.0 - fract) * _kaiser8[1];
-        out0 += psrc[2] * w; out1 += psrc[3] * w;
-        w = sinc(-1.0 - fract) * _kaiser8[2];
-        out0 += psrc[4] * w; out1 += psrc[5] * w;
-        w = _kaiser8[3] * ((fract < 1e-5) ? 1.0 : sinc(- fract));   // sinc(0) = 1
-        out0 += psrc[6] * w; out1 += psrc[7] * w;
-        w = sinc( 1.0 - fract) * _kaiser8[4];
-        out0 += psrc[8] * w; out1 += psrc[9] * w;
-        w = sinc( 2.0 - fract) * _kaiser8[5];
-        out0 += psrc[10] * w; out1 += psrc[11] * w;
-        w = sinc( 3.0 - fract) * _kaiser8[6];
-        out0 += psrc[12] * w; out1 += psrc[13] * w;
-        w = sinc( 4.0 - fract) * _kaiser8[7];
-        out0 += psrc[14] * w; out1 += psrc[15] * w;
+        shannonWeights(fract, w);
+        out0 = psrc[0] * w[0]; out1 = psrc[1] * w[0];
+        out0 += psrc[2] * w[1]; out1 += psrc[3] * w[1];
+        out0 += psrc[4] * w[2]; out1 += psrc[5] * w[2];
+        out0 += psrc[6] * w[3]; out1 += psrc[7] * w[3];
+        out0 += psrc[8] * w[4]; out1 += psrc[9] * w[4];
+        out0 += psrc[10] * w[5]; out1 += psrc[11] * w[5];
+        out0 += psrc[12] * w[6]; out1 += psrc[13] * w[6];
+        out0 += psrc[14] * w[7]; out1 += psrc[15] * w[7];
 
         pdest[2*i]   = (SAMPLETYPE)out0;
         pdest[2*i+1] = (SAMPLETYPE)out1;
@@ -169,13 +177,57 @@ int InterpolateShannon::transposeStereo(SAMPLETYPE *pdest,
 }
 
 
-/// Transpose stereo audio. Returns number of produced output samples, and 
+/// Transpose multichannel audio. Returns number of produced output samples, and 
 /// updates "srcSamples" to amount of consumed source samples
 int InterpolateShannon::transposeMulti(SAMPLETYPE *pdest, 
                     const SAMPLETYPE *psrc, 
                     int &srcSamples)
 {
-    // not implemented
-    assert(false);
-    return 0;
+    int i, count;
+    int srcSampleEnd = srcSamples - 8;
+    int srcCount = 0;
+
+    // Step through the source positions in order first, then interpolate
+    // the output frames in parallel, as in InterpolateCubic
+    reserveFrameTable(srcSamples);
+    count = 0;
+    while (srcCount < srcSampleEnd)
+    {
+        assert(fract < 1.0);
+        assert(count < frameTableSize);
+
+        pFramePos[count] = srcCount * numChannels;
+        pFrameFract[count] = fract;
+        count ++;
+
+        // update position fraction
+        fract += rate;
+        // update whole positions
+        int whole = (int)fract;
+        fract -= whole;
+        srcCount += whole;
+    }
+
+    #pragma omp parallel for
+    for (i = 0; i < count; i ++)
+    {
+        const SAMPLETYPE *src = psrc + pFramePos[i];
+        SAMPLETYPE *dest = pdest + i * numChannels;
+        double w[8];
+
+        shannonWeights(pFrameFract[i], w);
+
+        // weights are the same for all channels of the frame
+        for (int c = 0; c < numChannels; c ++)
+        {
+            double out = 0;
+            for (int k = 0; k < 8; k ++)
+            {
+                out += src[c + k * numChannels] * w[k];
+            }
+            dest[c] = (SAMPLETYPE)out;
+        }
+    }
+    srcSamples = srcCount;
+    return count;
 }
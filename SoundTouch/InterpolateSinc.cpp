@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Sample rate transposer using the polyphase windowed sinc resampler of
+/// 'resampler.h'. The sinc filter's cutoff is lowered along with the output
+/// rate, so that it does the anti-alias filtering and the interpolation in
+/// the same pass, and RateTransposer skips its separate anti-alias filter.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "STTypes.h"
+
+#ifdef SOUNDTOUCH_RESAMPLER_SINC
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "InterpolateSinc.h"
+
+// 'resampler.h' is a C library; its implementation is compiled in a C source
+// file of the application
+extern "C"
+{
+#include "resampler.h"
+}
+
+using namespace soundtouch;
+
+/// Sidelobes of the filter at rates up to 1.0. Lowering the cutoff for higher
+/// rates lengthens the filter in proportion, to keep the transition band as
+/// sharp relative to the cutoff, up to MAX_SIDELOBES.
+#define SINC_SIDELOBES      8
+#define MAX_SIDELOBES       64
+
+/// Input frames kept for priming a redesigned filter, enough for the longest one
+#define HISTORY_FRAMES      (2 * MAX_SIDELOBES)
+
+
+InterpolateSinc::InterpolateSinc()
+{
+    pResampler = NULL;
+    pFadeResampler = NULL;
+    pHistory = NULL;
+    historyFrames = 0;
+    cutoffStep = 0;
+    taps = 2 * SINC_SIDELOBES;
+    fixedCutoffStep = -1;
+}
+
+
+InterpolateSinc::~InterpolateSinc()
+{
+    if (pResampler) resampler_sinc_free(pResampler);
+    if (pFadeResampler) resampler_sinc_free(pFadeResampler);
+    alignedFree(pHistory);
+}
+
+
+// Returns how many semitones the cutoff is lowered by for 'rate'. The design
+// changes in semitone steps, so that gliding rates don't redesign the filter
+// for every batch.
+static int getCutoffStep(double rate)
+{
+    if (rate <= 1.0) return 0;
+    return (int)ceil(12.0 * log(rate) / log(2.0) - 1e-9);
+}
+
+
+void InterpolateSinc::resetRegisters()
+{
+    alignedFree(pHistory);
+    pHistory = NULL;
+    historyFrames = 0;
+    if (pResampler) resampler_sinc_free(pResampler);
+    if (pFadeResampler) resampler_sinc_free(pFadeResampler);
+    pResampler = NULL;
+    pFadeResampler = NULL;
+
+    if (numChannels <= 0) return;
+
+    // history followed by scratch space for the discarded priming output
+    pHistory = (SAMPLETYPE *)alignedAlloc(2 * (HISTORY_FRAMES + 2) * numChannels * sizeof(SAMPLETYPE));
+    design((fixedCutoffStep >= 0) ? fixedCutoffStep : getCutoffStep(rate));
+}
+
+
+// Builds the resampler for a cutoff lowered by 'newCutoffStep' semitones, and
+// runs the kept input history through it so that its delay line continues
+// from the old one's. The old one is kept for fading out over the next batch.
+void InterpolateSinc::design(int newCutoffStep)
+{
+    resampler_sinc_config config;
+    double scale;
+    void *newResampler;
+
+    scale = pow(2.0, -newCutoffStep / 12.0);
+    resampler_sinc_config_preset(&config, RESAMPLER_QUALITY_NORMAL, numChannels);
+    config.cutoff *= scale;
+    config.sidelobes = (unsigned)ceil(SINC_SIDELOBES / scale);
+    if (config.sidelobes > MAX_SIDELOBES) config.sidelobes = MAX_SIDELOBES;
+
+    newResampler = resampler_sinc_init_config(&config);
+    if (newResampler == NULL)
+    {
+        ST_THROW_RT_ERROR("Couldn't initialize the sinc resampler");
+    }
+    if (pFadeResampler) resampler_sinc_free(pFadeResampler);
+    pFadeResampler = (historyFrames > 0) ? pResampler : NULL;
+    if (pResampler && pFadeResampler == NULL) resampler_sinc_free(pResampler);
+    pResampler = newResampler;
+    cutoffStep = newCutoffStep;
+    taps = (2 * config.sidelobes + 3) & ~3;
+
+    if (historyFrames > 0)
+    {
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+        resampler_data_s16 data;
+#else
+        resampler_data data;
+#endif
+        data.data_in = pHistory;
+        data.data_out = pHistory + (HISTORY_FRAMES + 2) * numChannels;
+        data.input_frames = historyFrames;
+        data.output_frames = 0;
+        data.ratio = 1.0;
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+        resampler_sinc_process_s16(pResampler, &data);
+#else
+        resampler_sinc_process(pResampler, &data);
+#endif
+    }
+}
+
+
+void InterpolateSinc::setRate(double newRate)
+{
+    int step;
+
+    TransposerBase::setRate(newRate);
+    if (pResampler == NULL || fixedCutoffStep >= 0) return;
+
+    step = getCutoffStep(newRate);
+    if (step != cutoffStep) design(step);
+}
+
+
+// Designs the filter for 'maxRate' up front, so that changing the rate within
+// the range won't allocate. Rates below 'maxRate' are then filtered a bit more
+// than necessary. 'maxRate' of zero lets the design follow the rate again.
+void InterpolateSinc::setRateRange(double minRate, double maxRate)
+{
+    int step;
+
+    fixedCutoffStep = (maxRate > 0) ? getCutoffStep(maxRate) : -1;
+    step = (fixedCutoffStep >= 0) ? fixedCutoffStep : getCutoffStep(rate);
+    if (pResampler && step != cutoffStep) design(step);
+}
+
+
+// Keeps the last HISTORY_FRAMES input frames
+void InterpolateSinc::keepHistory(const SAMPLETYPE *src, int srcSamples)
+{
+    if (srcSamples >= HISTORY_FRAMES)
+    {
+        memcpy(pHistory, src + (srcSamples - HISTORY_FRAMES) * numChannels,
+               HISTORY_FRAMES * numChannels * sizeof(SAMPLETYPE));
+        historyFrames = HISTORY_FRAMES;
+        return;
+    }
+
+    int keep = HISTORY_FRAMES - srcSamples;
+    if (keep > historyFrames) keep = historyFrames;
+    memmove(pHistory, pHistory + (historyFrames - keep) * numChannels,
+            keep * numChannels * sizeof(SAMPLETYPE));
+    memcpy(pHistory + keep * numChannels, src, srcSamples * numChannels * sizeof(SAMPLETYPE));
+    historyFrames = keep + srcSamples;
+}
+
+
+// Runs 'srcSamples' input frames through 'resampler', returns the number of
+// output frames
+static int resample(void *resampler, SAMPLETYPE *pdest, const SAMPLETYPE *psrc,
+                    int srcSamples, double rate)
+{
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+    resampler_data_s16 data;
+#else
+    resampler_data data;
+#endif
+
+    data.data_in = psrc;
+    data.data_out = pdest;
+    data.input_frames = srcSamples;
+    data.output_frames = 0;
+    data.ratio = 1.0 / rate;
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+    resampler_sinc_process_s16(resampler, &data);
+#else
+    resampler_sinc_process(resampler, &data);
+#endif
+    return (int)data.output_frames;
+}
+
+
+// Transposes all of the 'srcSamples' input frames; the resampler keeps the
+// frames its filter still needs in its own delay line
+int InterpolateSinc::process(SAMPLETYPE *pdest, const SAMPLETYPE *psrc, int srcSamples)
+{
+    int numOutput;
+
+    assert(pResampler);
+
+    numOutput = resample(pResampler, pdest, psrc, srcSamples, rate);
+
+    if (pFadeResampler && srcSamples > 0)
+    {
+        // crossfade from the replaced filter's output to the new one's
+        int i, c, fadeFrames;
+        SAMPLETYPE *pFade;
+
+        pFade = (SAMPLETYPE *)alignedAlloc((numOutput + 8) * numChannels * sizeof(SAMPLETYPE));
+        fadeFrames = resample(pFadeResampler, pFade, psrc, srcSamples, rate);
+        if (fadeFrames > numOutput) fadeFrames = numOutput;
+        for (i = 0; i < fadeFrames; i ++)
+        {
+            float w = (float)(i + 1) / (float)(fadeFrames + 1);
+            for (c = 0; c < numChannels; c ++)
+            {
+                int k = i * numChannels + c;
+                pdest[k] = (SAMPLETYPE)(pFade[k] + w * (pdest[k] - pFade[k]));
+            }
+        }
+        alignedFree(pFade);
+        resampler_sinc_free(pFadeResampler);
+        pFadeResampler = NULL;
+    }
+
+    keepHistory(psrc, srcSamples);
+
+    return numOutput;
+}
+
+
+int InterpolateSinc::transposeMono(SAMPLETYPE *pdest, const SAMPLETYPE *psrc, int &srcSamples)
+{
+    return process(pdest, psrc, srcSamples);
+}
+
+
+int InterpolateSinc::transposeStereo(SAMPLETYPE *pdest, const SAMPLETYPE *psrc, int &srcSamples)
+{
+    return process(pdest, psrc, srcSamples);
+}
+
+
+int InterpolateSinc::transposeMulti(SAMPLETYPE *pdest, const SAMPLETYPE *psrc, int &srcSamples)
+{
+    return process(pdest, psrc, srcSamples);
+}
+
+#endif // SOUNDTOUCH_RESAMPLER_SINC
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Sample rate transposer using the polyphase windowed sinc resampler of
+/// 'resampler.h'. The sinc filter's cutoff is lowered along with the output
+/// rate, so that it does the anti-alias filtering and the interpolation in
+/// the same pass, and RateTransposer skips its separate anti-alias filter.
+///
+/// Requires SOUNDTOUCH_RESAMPLER_SINC, see STTypes.h.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _InterpolateSinc_H_
+#define _InterpolateSinc_H_
+
+#include "RateTransposer.h"
+#include "STTypes.h"
+
+namespace soundtouch
+{
+
+class InterpolateSinc : public TransposerBase
+{
+protected:
+    /// 'resampler.h' sinc resampler, or NULL until the channel count is set
+    void *pResampler;
+
+    /// Resampler replaced by a redesign, kept for crossfading into the new one
+    /// over the next batch, as their delays and phases differ a little
+    void *pFadeResampler;
+
+    /// Filter design: number of semitones the cutoff is lowered by, and the
+    /// number of filter taps
+    int cutoffStep;
+    int taps;
+
+    /// Cutoff step fixed by 'setRateRange', or -1 to follow the rate
+    int fixedCutoffStep;
+
+    /// Last input frames, for priming a redesigned filter so that the output
+    /// continues without a gap
+    SAMPLETYPE *pHistory;
+    int historyFrames;
+
+    void resetRegisters();
+    int transposeMono(SAMPLETYPE *dest,
+                        const SAMPLETYPE *src,
+                        int &srcSamples);
+    int transposeStereo(SAMPLETYPE *dest,
+                        const SAMPLETYPE *src,
+                        int &srcSamples);
+    int transposeMulti(SAMPLETYPE *dest,
+                        const SAMPLETYPE *src,
+                        int &srcSamples);
+
+    int process(SAMPLETYPE *dest, const SAMPLETYPE *src, int srcSamples);
+    void design(int newCutoffStep);
+    void keepHistory(const SAMPLETYPE *src, int srcSamples);
+
+public:
+    InterpolateSinc();
+    ~InterpolateSinc();
+
+    void setRate(double newRate);
+    void setRateRange(double minRate, double maxRate);
+
+    bool filtersAliasing() const
+    {
+        return true;
+    }
+
+    int getLatency() const
+    {
+        return taps / 2;
+    }
+};
+
+}
+
+#endif
@@ -39,6 +39,7 @@
 #include "InterpolateLinear.h"
 #include "InterpolateCubic.h"
 #include "InterpolateShannon.h"
+#include "InterpolateSinc.h"
 #include "AAFilter.h"
 
 using namespace soundtouch;
@@ -58,6 +59,9 @@ RateTransposer::RateTransposer() : FIFOProcessor(&outputBuffer)
         false;
 #endif
 
+    bFixedOrder = false;
+    bFixedTransposeFirst = false;
+
     // Instantiates the anti-alias filter
     pAAFilter = new AAFilter(64);
     pTransposer = TransposerBase::newInstance();
@@ -107,14 +111,29 @@ void RateTransposer::setRate(double newRate)
     {
         fCutoff = 0.5 / newRate;
     } 
-    else 
+    else if (isTransposedFirst())
     {
         fCutoff = 0.5 * newRate;
     }
+    else
+    {
+        // filtering before transposing down, when the order is fixed. Nothing 
+        // folds over then, so keep the whole band.
+        fCutoff = 0.5;
+    }
     pAAFilter->setCutoffFreq(fCutoff);
 }
 
 
+// Returns true if the samples are transposed first and then anti-alias filtered,
+// which is the better order for rates below 1.0
+bool RateTransposer::isTransposedFirst() const
+{
+    if (bFixedOrder) return bFixedTransposeFirst;
+    return (pTransposer->rate < 1.0f);
+}
+
+
 // Adds 'nSamples' pcs of samples from the 'samples' memory position into
 // the input of the object.
 void RateTransposer::putSamples(const SAMPLETYPE *samples, uint nSamples)
@@ -136,9 +155,9 @@ void RateTransposer::processSamples(const SAMPLETYPE *src, uint nSamples)
     // Store samples to input buffer
     inputBuffer.putSamples(src, nSamples);
 
-    // If anti-alias filter is turned off, simply transpose without applying
-    // the filter
-    if (bUseAAFilter == false) 
+    // If anti-alias filter is turned off, or the transposer filters the
+    // aliasing itself, simply transpose without applying the filter
+    if ((bUseAAFilter == false) || pTransposer->filtersAliasing()) 
     {
         count = pTransposer->transpose(outputBuffer, inputBuffer);
         return;
@@ -147,7 +166,7 @@ void RateTransposer::processSamples(const SAMPLETYPE *src, uint nSamples)
     assert(pAAFilter);
 
     // Transpose with anti-alias filter
-    if (pTransposer->rate < 1.0f) 
+    if (isTransposedFirst()) 
     {
         // If the parameter 'Rate' value is smaller than 1, first transpose
         // the samples and then apply the anti-alias filter to remove aliasing.
@@ -186,6 +205,40 @@ void RateTransposer::setChannels(int nChannels)
 }
 
 
+// Sizes the buffers for the worst case within the rate range. Up to the filter 
+// and interpolation lengths of samples are left over between batches; the 
+// transposed batch is largest at the lowest rate.
+uint RateTransposer::setRateRange(double minRate, double maxRate, uint maxInputSamples)
+{
+    uint maxInput, maxOutput;
+
+    if (maxInputSamples == 0)
+    {
+        bFixedOrder = false;
+        pTransposer->setRateRange(0, 0);
+        setRate(pTransposer->rate);
+        return 0;
+    }
+
+    bFixedOrder = true;
+    bFixedTransposeFirst = (maxRate <= 1.0);
+    pTransposer->setRateRange(minRate, maxRate);
+    setRate(pTransposer->rate);
+
+    if (minRate > 1.0) minRate = 1.0;
+
+    maxInput = maxInputSamples + pAAFilter->getLength() + (uint)pTransposer->getLatency() + 8;
+    maxOutput = (uint)((double)maxInput / minRate) + pAAFilter->getLength() + 8;
+
+    inputBuffer.reserve(maxInput);
+    midBuffer.reserve(maxOutput);
+    outputBuffer.reserve(maxOutput);
+    pTransposer->reserveFrames((int)maxOutput);
+
+    return maxOutput;
+}
+
+
 // Clears all the samples in the object
 void RateTransposer::clear()
 {
@@ -206,10 +259,25 @@ int RateTransposer::isEmpty() const
 }
 
 
-/// Return approximate initial input-output latency
+/// Return initial input-output latency in input samples. The anti-alias filter 
+/// works on transposed samples if they're transposed first, and on input samples
+/// otherwise, see 'isTransposedFirst'.
 int RateTransposer::getLatency() const
 {
-    return (bUseAAFilter) ? pAAFilter->getLength() : 0;
+    int latency = pTransposer->getLatency();
+
+    if (bUseAAFilter && !pTransposer->filtersAliasing())
+    {
+        if (isTransposedFirst())
+        {
+            latency += (int)(pAAFilter->getLength() * pTransposer->rate + 0.5);
+        }
+        else
+        {
+            latency += pAAFilter->getLength();
+        }
+    }
+    return latency;
 }
 
 
@@ -260,11 +328,37 @@ TransposerBase::TransposerBase()
 {
     numChannels = 0;
     rate = 1.0f;
+    pFramePos = NULL;
+    pFrameFract = NULL;
+    frameTableSize = 0;
 }
 
 
 TransposerBase::~TransposerBase()
 {
+    alignedFree(pFramePos);
+    alignedFree(pFrameFract);
+}
+
+
+void TransposerBase::reserveFrameTable(int srcSamples)
+{
+    // same output size estimate as in 'transpose'
+    reserveFrames((int)((double)srcSamples / rate) + 8);
+}
+
+
+void TransposerBase::reserveFrames(int size)
+{
+    if (size > frameTableSize)
+    {
+        alignedFree(pFramePos);
+        alignedFree(pFrameFract);
+        // grow with some slack so that varying input sizes don't reallocate often
+        frameTableSize = size + size / 2;
+        pFramePos = (int *)alignedAlloc(frameTableSize * sizeof(int));
+        pFrameFract = (double *)alignedAlloc(frameTableSize * sizeof(double));
+    }
 }
 
 
@@ -285,6 +379,9 @@ void TransposerBase::setRate(double newRate)
 TransposerBase *TransposerBase::newInstance()
 {
 #ifdef SOUNDTOUCH_INTEGER_SAMPLES
+#ifdef SOUNDTOUCH_RESAMPLER_SINC
+    if (algorithm == SINC) return ::new InterpolateSinc;
+#endif
     // Notice: For integer arithmetic support only linear algorithm (due to simplest calculus)
     return ::new InterpolateLinearInteger;
 #else
@@ -299,6 +396,14 @@ TransposerBase *TransposerBase::newInstance()
         case SHANNON:
             return new InterpolateShannon;
 
+        case SINC:
+#ifdef SOUNDTOUCH_RESAMPLER_SINC
+            return new InterpolateSinc;
+#else
+            // not compiled in, see STTypes.h
+            return new InterpolateShannon;
+#endif
+
         default:
             assert(false);
             return NULL;
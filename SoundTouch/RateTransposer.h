@@ -55,7 +55,8 @@ public:
         enum ALGORITHM {
         LINEAR = 0,
         CUBIC,
-        SHANNON
+        SHANNON,
+        SINC
     };
 
 protected:
@@ -73,7 +74,20 @@ protected:
 
     static ALGORITHM algorithm;
 
+    /// Source offsets and position fractions of output sample frames. Multichannel
+    /// routines step through the positions first, then interpolate the frames
+    /// in parallel threads.
+    int *pFramePos;
+    double *pFrameFract;
+    int frameTableSize;
+
+    /// Ensures that the frame position table fits output of 'srcSamples' samples
+    void reserveFrameTable(int srcSamples);
+
 public:
+    /// Ensures that the frame position table fits 'numFrames' output frames
+    void reserveFrames(int numFrames);
+
     double rate;
     int numChannels;
 
@@ -84,6 +98,21 @@ public:
     virtual void setRate(double newRate);
     virtual void setChannels(int channels);
 
+    /// Prepares for changing the rate between a minimum and maximum rate without
+    /// allocating memory. A maximum rate of zero ends that.
+    virtual void setRateRange(double, double) {}
+
+    /// Returns true if the transposition also removes the frequencies that
+    /// would alias, so that RateTransposer doesn't need its anti-alias filter
+    virtual bool filtersAliasing() const
+    {
+        return false;
+    }
+
+    /// Returns how many source samples the interpolation needs beyond the 
+    /// current position before it can produce output
+    virtual int getLatency() const = 0;
+
     // static factory function
     static TransposerBase *newInstance();
 
@@ -113,6 +142,13 @@ protected:
 
     bool bUseAAFilter;
 
+    /// Flags: is the order of the filter & transposition fixed, and to which
+    bool bFixedOrder;
+    bool bFixedTransposeFirst;
+
+    /// Returns true if the samples are transposed before the anti-alias filter
+    bool isTransposedFirst() const;
+
 
     /// Transposes sample rate by applying anti-alias filter to prevent folding. 
     /// Returns amount of samples returned in the "dest" buffer.
@@ -144,6 +180,19 @@ public:
     /// Sets the number of channels, 1 = mono, 2 = stereo
     void setChannels(int channels);
 
+    /// Prepares for changing the rate continuously between 'minRate' and 'maxRate'.
+    /// Sizes the buffers for input batches of at most 'maxInputSamples', so that 
+    /// rate changes within the range and processing such batches won't allocate
+    /// memory, as long as the output is received after each batch. Also fixes the
+    /// order of the anti-alias filter and the transposition, so that crossing 
+    /// rate 1.0 doesn't treat the samples left between them the wrong way and 
+    /// click. If the range reaches above 1.0 the filter goes first, and rates 
+    /// below 1.0 then aren't low-pass filtered. 'maxInputSamples' of zero lets 
+    /// the order follow the rate again.
+    ///
+    /// \return The largest number of samples that one input batch can output.
+    uint setRateRange(double minRate, double maxRate, uint maxInputSamples);
+
     /// Adds 'numSamples' pcs of samples from the 'samples' memory position into
     /// the input of the object.
     void putSamples(const SAMPLETYPE *samples, uint numSamples);
@@ -154,7 +203,8 @@ public:
     /// Returns nonzero if there aren't any samples available for outputting.
     int isEmpty() const;
 
-    /// Return approximate initial input-output latency
+    /// Return initial input-output latency, i.e. how many input samples are
+    /// needed before the first samples come out
     int getLatency() const;
 };
 
@@ -32,6 +32,8 @@
 #ifndef STTypes_H
 #define STTypes_H
 
+#include <stddef.h>
+
 typedef unsigned int    uint;
 typedef unsigned long   ulong;
 
@@ -71,6 +73,13 @@ namespace soundtouch
     /// runtime performance so recommendation is to keep this off.
     // #define USE_MULTICH_ALWAYS
 
+    /// Define this to add the 'TransposerBase::SINC' rate transposer, which uses
+    /// the polyphase sinc resampler of 'resampler.h' for both the anti-alias
+    /// filtering and the interpolation. 'resampler.h' must be in the include 
+    /// path, and RESAMPLER_IMPLEMENTATION defined in one C source file of the
+    /// application that includes it. Works with integer samples as well.
+    // #define SOUNDTOUCH_RESAMPLER_SINC
+
     #if (defined(__SOFTFP__) && defined(ANDROID))
         // For Android compilation: Force use of Integer samples in case that
         // compilation uses soft-floating point emulation - soft-fp is way too slow
@@ -143,6 +152,9 @@ namespace soundtouch
             #if (!_M_X64)
                 #define SOUNDTOUCH_ALLOW_MMX   1
             #endif
+            // Allow SSE2 optimizations, chosen over the MMX ones when the CPU 
+            // supports them
+            #define SOUNDTOUCH_ALLOW_SSE2      1
         #endif
 
     #else
@@ -159,6 +171,67 @@ namespace soundtouch
 
     #endif  // SOUNDTOUCH_INTEGER_SAMPLES
 
+    // AVX2 & NEON routines exist for both sample types
+    #ifdef SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS
+        #if (_MSC_VER >= 1700) || defined(__clang__) || \
+            (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+            // Allow AVX2 & FMA optimizations. These are chosen at run time, so
+            // the compiler must support them, but needn't be set to target them.
+            #define SOUNDTOUCH_ALLOW_AVX2      1
+        #endif
+    #endif
+
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        // Allow NEON optimizations. Used only when compiling for a processor
+        // with NEON, so these aren't chosen at run time.
+        #define SOUNDTOUCH_ALLOW_NEON      1
+    #endif
+
+    #ifdef SOUNDTOUCH_ALLOW_AVX2
+        // Marks routines that use AVX2 & FMA instructions, so that GCC and clang
+        // compile them for those even if other code isn't.
+        #if defined(__GNUC__) || defined(__clang__)
+            #define SOUNDTOUCH_TARGET_AVX2  __attribute__((target("avx2,fma")))
+        #else
+            #define SOUNDTOUCH_TARGET_AVX2
+        #endif
+    #endif
+
+    #ifdef SOUNDTOUCH_ALLOW_SSE2
+        // Marks routines that use SSE2 instructions, so that GCC and clang 
+        // compile them for SSE2 also in 32-bit x86 builds that don't target it.
+        #if defined(__GNUC__) || defined(__clang__)
+            #define SOUNDTOUCH_TARGET_SSE2  __attribute__((target("sse2")))
+        #else
+            #define SOUNDTOUCH_TARGET_SSE2
+        #endif
+    #endif
+
+    /// Alignment of memory blocks from 'alignedAlloc', in bytes. Enough for aligned
+    /// AVX loads, and keeps separate buffers in separate cache lines.
+    #define SOUNDTOUCH_ALIGNMENT        64
+
+    /// Function for allocating 'size' bytes of memory aligned to 'alignment' bytes. 
+    /// Returns NULL if out of memory. 'context' is the value given to 'setAllocator'.
+    typedef void *(*ST_ALLOC_FUNC)(size_t size, size_t alignment, void *context);
+
+    /// Function for freeing memory from the matching ST_ALLOC_FUNC. Gets also NULLs.
+    typedef void (*ST_FREE_FUNC)(void *ptr, void *context);
+
+    /// Sets the functions that the library uses for allocating sample buffers and 
+    /// other working memory, e.g. for allocating from a memory arena of the stream
+    /// that's being processed. NULL 'alloc' & 'free' restore the default heap 
+    /// allocation. Memory must be freed with the same functions that allocated it,
+    /// so call this only when no SoundTouch or BPMDetect objects exist.
+    void setAllocator(ST_ALLOC_FUNC alloc, ST_FREE_FUNC free, void *context);
+
+    /// Allocates SOUNDTOUCH_ALIGNMENT aligned memory with the current allocator.
+    /// Throws a runtime error if out of memory.
+    void *alignedAlloc(size_t size);
+
+    /// Frees memory from 'alignedAlloc'. NULL is allowed.
+    void alignedFree(void *ptr);
+
 };
 
 // define ST_NO_EXCEPTION_HANDLING switch to disable throwing std exceptions:
@@ -78,6 +78,11 @@ using namespace soundtouch;
 /// test if two floating point numbers are equal
 #define TEST_FLOAT_EQUAL(a, b)  (fabs(a - b) < 1e-10)
 
+/// Length of the slices in which 'putSamples' blocks are processed when ramping 
+/// automated parameters. Shorter slices make smoother ramps but redesign the 
+/// anti-alias filter more often.
+#define AUTOMATION_SLICE        256
+
 
 /// Print library version string for autoconf
 extern "C" void soundtouch_ac_test()
@@ -101,6 +106,13 @@ SoundTouch::SoundTouch()
     virtualRate = 
     virtualTempo = 1.0;
 
+    bAutomation = false;
+    bRampPending = false;
+    autoMinTempo = autoMaxTempo = 1.0;
+    autoMinPitch = autoMaxPitch = 1.0;
+    autoMinRate = autoMaxRate = 1.0;
+    targetTempo = targetPitch = targetRate = 1.0;
+
     calcEffectiveRateAndTempo();
 
     samplesExpectedOut = 0;
@@ -213,6 +225,98 @@ void SoundTouch::setPitchSemiTones(double newPitch)
 }
 
 
+#define CLAMP(x, mi, ma) (((x) < (mi)) ? (mi) : (((x) > (ma)) ? (ma) : (x)))
+
+// Prepares for automating the parameters within the given limits
+void SoundTouch::setAutomationRange(double minTempo, double maxTempo,
+                                    double minPitch, double maxPitch,
+                                    double minRate, double maxRate,
+                                    uint maxBlockSamples)
+{
+    double minEffTempo, maxEffTempo, minEffRate, maxEffRate;
+    uint maxOutput;
+
+    bRampPending = false;
+    if (maxBlockSamples == 0)
+    {
+        // back to normal, letting the stage order follow the rate
+        bAutomation = false;
+        pRateTransposer->setRateRange(0, 0, 0);
+        calcEffectiveRateAndTempo();
+        return;
+    }
+
+    if (bSrateSet == false) 
+    {
+        ST_THROW_RT_ERROR("SoundTouch : Sample rate not defined");
+    } 
+    else if (channels == 0) 
+    {
+        ST_THROW_RT_ERROR("SoundTouch : Number of channels not defined");
+    }
+    assert(minTempo > 0 && minPitch > 0 && minRate > 0);
+    assert(minTempo <= maxTempo && minPitch <= maxPitch && minRate <= maxRate);
+
+    autoMinTempo = minTempo;
+    autoMaxTempo = maxTempo;
+    autoMinPitch = minPitch;
+    autoMaxPitch = maxPitch;
+    autoMinRate = minRate;
+    autoMaxRate = maxRate;
+
+    // limits of the effective values, see 'calcEffectiveRateAndTempo'
+    minEffTempo = minTempo / maxPitch;
+    maxEffTempo = maxTempo / minPitch;
+    minEffRate = minPitch * minRate;
+    maxEffRate = maxPitch * maxRate;
+
+    // bring the current values inside the limits
+    virtualTempo = CLAMP(virtualTempo, minTempo, maxTempo);
+    virtualPitch = CLAMP(virtualPitch, minPitch, maxPitch);
+    virtualRate = CLAMP(virtualRate, minRate, maxRate);
+
+    // fix the stage order for the whole range, by the same rule that 
+    // 'calcEffectiveRateAndTempo' applies to single rates
+    bAutomation = true;
+#ifndef SOUNDTOUCH_PREVENT_CLICK_AT_RATE_CROSSOVER
+    setStageOrder(maxEffRate <= 1.0);
+#endif
+    calcEffectiveRateAndTempo();
+
+    // size the buffers for the largest batches each stage can get
+    if (output == pTDStretch)
+    {
+        maxOutput = pRateTransposer->setRateRange(minEffRate, maxEffRate, maxBlockSamples);
+        pTDStretch->reserveTempoRange(minEffTempo, maxEffTempo, maxOutput);
+    }
+    else
+    {
+        maxOutput = pTDStretch->reserveTempoRange(minEffTempo, maxEffTempo, maxBlockSamples);
+        pRateTransposer->setRateRange(minEffRate, maxEffRate, maxOutput);
+    }
+}
+
+
+// Sets the values to ramp the parameters to during the next 'putSamples' block
+void SoundTouch::rampTo(double newTempo, double newPitch, double newRate)
+{
+    if (bAutomation == false)
+    {
+        // nothing to ramp in, just set the values
+        virtualTempo = newTempo;
+        virtualPitch = newPitch;
+        virtualRate = newRate;
+        calcEffectiveRateAndTempo();
+        return;
+    }
+
+    targetTempo = CLAMP(newTempo, autoMinTempo, autoMaxTempo);
+    targetPitch = CLAMP(newPitch, autoMinPitch, autoMaxPitch);
+    targetRate = CLAMP(newRate, autoMinRate, autoMaxRate);
+    bRampPending = true;
+}
+
+
 // Calculates 'effective' rate and tempo values from the
 // nominal control values.
 void SoundTouch::calcEffectiveRateAndTempo()
@@ -227,7 +331,22 @@ void SoundTouch::calcEffectiveRateAndTempo()
     if (!TEST_FLOAT_EQUAL(tempo, oldTempo)) pTDStretch->setTempo(tempo);
 
 #ifndef SOUNDTOUCH_PREVENT_CLICK_AT_RATE_CROSSOVER
-    if (rate <= 1.0f) 
+    // with automation the order is fixed by 'setAutomationRange' instead
+    if (bAutomation == false)
+    {
+        setStageOrder(rate <= 1.0f);
+    }
+#else
+    setStageOrder(false);
+#endif
+}
+
+
+// Puts the rate transposer first & tempo changer last in the chain, or the 
+// other way around, moving the samples that are in between
+void SoundTouch::setStageOrder(bool transposeFirst)
+{
+    if (transposeFirst) 
     {
         if (output != pTDStretch) 
         {
@@ -244,7 +363,6 @@ void SoundTouch::calcEffectiveRateAndTempo()
         }
     }
     else
-#endif
     {
         if (output != pRateTransposer) 
         {
@@ -285,15 +403,63 @@ void SoundTouch::putSamples(const SAMPLETYPE *samples, uint nSamples)
         ST_THROW_RT_ERROR("SoundTouch : Number of channels not defined");
     }
 
+    if (bRampPending)
+    {
+        rampSamples(samples, nSamples);
+    }
+    else
+    {
+        processSamples(samples, nSamples);
+    }
+}
+
+
+// Moves the parameters linearly to the ramp targets over the block, changing 
+// them between slices of AUTOMATION_SLICE samples
+void SoundTouch::rampSamples(const SAMPLETYPE *samples, uint nSamples)
+{
+    const double startTempo = virtualTempo;
+    const double startPitch = virtualPitch;
+    const double startRate = virtualRate;
+    uint pos, count;
+
+    for (pos = 0; pos < nSamples; pos += count)
+    {
+        double t;
+
+        count = nSamples - pos;
+        if (count > AUTOMATION_SLICE) count = AUTOMATION_SLICE;
+
+        // use the values at the middle of the slice
+        t = ((double)pos + 0.5 * count) / nSamples;
+        virtualTempo = startTempo + t * (targetTempo - startTempo);
+        virtualPitch = startPitch + t * (targetPitch - startPitch);
+        virtualRate = startRate + t * (targetRate - startRate);
+        calcEffectiveRateAndTempo();
+
+        processSamples(samples + pos * channels, count);
+    }
+
+    virtualTempo = targetTempo;
+    virtualPitch = targetPitch;
+    virtualRate = targetRate;
+    calcEffectiveRateAndTempo();
+    bRampPending = false;
+}
+
+
+// Feeds the samples through the rate transposer & tempo changer in their 
+// current order
+void SoundTouch::processSamples(const SAMPLETYPE *samples, uint nSamples)
+{
     // accumulate how many samples are expected out from processing, given the current 
     // processing setting
     samplesExpectedOut += (double)nSamples / ((double)rate * (double)tempo);
 
 #ifndef SOUNDTOUCH_PREVENT_CLICK_AT_RATE_CROSSOVER
-    if (rate <= 1.0f) 
+    if (output == pTDStretch) 
     {
         // transpose the rate down, output the transposed sound to tempo changer buffer
-        assert(output == pTDStretch);
         pRateTransposer->putSamples(samples, nSamples);
         pTDStretch->moveSamples(*pRateTransposer);
     } 
@@ -308,6 +474,48 @@ void SoundTouch::putSamples(const SAMPLETYPE *samples, uint nSamples)
 }
 
 
+// Processes a batch of independent streams in one call. With OpenMP the batch
+// is split statically, so that the same threads keep processing the same 
+// streams from call to call.
+void SoundTouch::processStreams(SoundTouch * const *streams, int numStreams,
+                                const SAMPLETYPE * const *input, const uint *numInput,
+                                SAMPLETYPE * const *output, const uint *maxOutput,
+                                uint *numOutput)
+{
+    int i;
+
+    // Check the settings before going parallel, as an exception can't be passed
+    // out from the parallel threads
+    for (i = 0; i < numStreams; i ++)
+    {
+        if (streams[i]->bSrateSet == false) 
+        {
+            ST_THROW_RT_ERROR("SoundTouch : Sample rate not defined");
+        } 
+        else if (streams[i]->channels == 0) 
+        {
+            ST_THROW_RT_ERROR("SoundTouch : Number of channels not defined");
+        }
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (i = 0; i < numStreams; i ++)
+    {
+        SoundTouch *st = streams[i];
+
+        st->putSamples(input[i], numInput[i]);
+        if (output)
+        {
+            numOutput[i] = st->receiveSamples(output[i], maxOutput[i]);
+        }
+        else if (numOutput)
+        {
+            numOutput[i] = 0;
+        }
+    }
+}
+
+
 // Flushes the last samples from the processing pipeline to the output.
 // Clears also the internal processing buffers.
 //
@@ -319,7 +527,7 @@ void SoundTouch::flush()
 {
     int i;
     int numStillExpected;
-    SAMPLETYPE *buff = new SAMPLETYPE[128 * channels];
+    SAMPLETYPE *buff = (SAMPLETYPE *)alignedAlloc(128 * channels * sizeof(SAMPLETYPE));
 
     // how many samples are still expected to output
     numStillExpected = (int)((long)(samplesExpectedOut + 0.5) - samplesOutput);
@@ -337,7 +545,7 @@ void SoundTouch::flush()
 
     adjustAmountOfSamples(numStillExpected);
 
-    delete[] buff;
+    alignedFree(buff);
 
     // Clear input buffers
     pTDStretch->clearInput();
@@ -372,6 +580,18 @@ bool SoundTouch::setSetting(int settingId, int value)
             pTDStretch->enableQuickSeek((value != 0) ? true : false);
             return true;
 
+        case SETTING_USE_FFT_SEEK :
+            // enables / disables tempo routine FFT-based seeking algorithm
+            pTDStretch->enableFFTSeek((value != 0) ? true : false);
+            return true;
+
+        case SETTING_LOW_LATENCY :
+            // enables / disables low-latency mode: shorter processing sequences and
+            // anti-alias filter. 64 taps is the default filter length of RateTransposer
+            pTDStretch->enableLowLatency((value != 0) ? true : false);
+            pRateTransposer->getAAFilter()->setLength((value != 0) ? 32 : 64);
+            return true;
+
         case SETTING_SEQUENCE_MS:
             // change time-stretch sequence duration parameter
             pTDStretch->setParameters(sampleRate, value, seekWindowMs, overlapMs);
@@ -412,6 +632,12 @@ int SoundTouch::getSetting(int settingId) const
         case SETTING_USE_QUICKSEEK :
             return (uint)pTDStretch->isQuickSeekEnabled();
 
+        case SETTING_USE_FFT_SEEK :
+            return (uint)pTDStretch->isFFTSeekEnabled();
+
+        case SETTING_LOW_LATENCY :
+            return (uint)pTDStretch->isLowLatencyEnabled();
+
         case SETTING_SEQUENCE_MS:
             pTDStretch->getParameters(NULL, &temp, NULL, NULL);
             return temp;
@@ -455,16 +681,25 @@ int SoundTouch::getSetting(int settingId) const
             double latency = pTDStretch->getLatency();
             int latency_tr = pRateTransposer->getLatency();
 
+            // Both latencies are counted in input samples of the stage in question
 #ifndef SOUNDTOUCH_PREVENT_CLICK_AT_RATE_CROSSOVER
             if (rate <= 1.0)
             {
-                // transposing done before timestretch, which impacts latency
-                latency = (latency + latency_tr) * rate;
+                // transposing done before timestretch, which gets 1 / rate samples
+                // for each input sample
+                latency = latency * rate + latency_tr;
             }
             else
 #endif
             {
-                latency += (double)latency_tr / rate;
+                // timestretch done first. Its first output batch normally covers 
+                // what the transposer needs; if not, each further sample for the 
+                // transposer takes 'tempo' input samples.
+                int batch = pTDStretch->getOutputBatchSize();
+                if (latency_tr > batch)
+                {
+                    latency += (double)(latency_tr - batch) * tempo;
+                }
             }
 
             return (int)(latency + 0.5);
@@ -165,6 +165,22 @@ namespace soundtouch
 #define SETTING_INITIAL_LATENCY             8
 
 
+/// Enable/disable FFT-based seeking algorithm in tempo changer routine. It checks
+/// every possible overlapping location like the default algorithm does without
+/// SIMD shortcuts, but calculates all of them at once. This lowers CPU utilization
+/// with long seek windows and overlaps (e.g. SETTING_SEEKWINDOW_MS of 60 ms or
+/// more). Quick seeking is used instead if it's also enabled.
+#define SETTING_USE_FFT_SEEK                9
+
+
+/// Enable/disable low-latency mode for real-time use such as live voice effects.
+/// Halves the automatically chosen sequence & seek window durations (settings 
+/// given explicitly with SETTING_SEQUENCE_MS and SETTING_SEEKWINDOW_MS are kept),
+/// and shortens the anti-alias filter to 32 taps, or restores the default 64 taps
+/// when disabled. Check the resulting latency with SETTING_INITIAL_LATENCY.
+#define SETTING_LOW_LATENCY                 10
+
+
 class SoundTouch : public FIFOProcessor
 {
 private:
@@ -193,10 +209,35 @@ private:
     /// Accumulator for how many samples in total have been read out from the processing so far
     long   samplesOutput;
 
+    /// Flag: are the parameters automated, see 'setAutomationRange'
+    bool  bAutomation;
+
+    /// Flag: has 'rampTo' set new targets for the next 'putSamples' block?
+    bool  bRampPending;
+
+    /// Limits of the automated parameters
+    double autoMinTempo, autoMaxTempo;
+    double autoMinPitch, autoMaxPitch;
+    double autoMinRate, autoMaxRate;
+
+    /// Parameter values to reach by the end of the next 'putSamples' block
+    double targetTempo, targetPitch, targetRate;
+
     /// Calculates effective rate & tempo valuescfrom 'virtualRate', 'virtualTempo' and 
     /// 'virtualPitch' parameters.
     void calcEffectiveRateAndTempo();
 
+    /// Puts the rate transposer first in the processing chain, or last, moving 
+    /// the samples between them accordingly
+    void setStageOrder(bool transposeFirst);
+
+    /// Processes the samples through the chain in slices, ramping the parameters 
+    /// to the 'rampTo' targets
+    void rampSamples(const SAMPLETYPE *samples, uint numSamples);
+
+    /// Processes the samples through the chain with the current parameters
+    void processSamples(const SAMPLETYPE *samples, uint numSamples);
+
 protected :
     /// Number of channels
     uint  channels;
@@ -246,6 +287,35 @@ public:
     void setPitchSemiTones(int newPitch);
     void setPitchSemiTones(double newPitch);
 
+    /// Prepares for automating tempo, pitch and rate, i.e. changing them 
+    /// continuously during processing, e.g. from a DJ controller. All the 
+    /// processing buffers are sized in advance for any combination of values 
+    /// within the given limits and for 'putSamples' blocks of at most 
+    /// 'maxBlockSamples' samples, so that neither parameter changes within the
+    /// limits nor processing allocate memory afterwards, as long as the output 
+    /// is received after each block. The order of the processing stages is also
+    /// fixed for the whole range, so that moving the rate across 1.0 doesn't 
+    /// click. Use 'rampTo' to change the parameters smoothly.
+    ///
+    /// Call after setting the sample rate, channels and other settings. Zero 
+    /// 'maxBlockSamples' ends automation. Throws a runtime_error exception if the
+    /// sample rate or channels aren't set.
+    void setAutomationRange(double minTempo,        ///< Lowest tempo value.
+                            double maxTempo,        ///< Highest tempo value.
+                            double minPitch,        ///< Lowest pitch value.
+                            double maxPitch,        ///< Highest pitch value.
+                            double minRate,         ///< Lowest rate value.
+                            double maxRate,         ///< Highest rate value.
+                            uint maxBlockSamples    ///< Largest 'putSamples' block.
+                            );
+
+    /// Sets new tempo, pitch and rate values, to be reached by the end of the 
+    /// next 'putSamples' block. That block is processed in short slices, with
+    /// the values moving linearly towards the new ones between slices, so that
+    /// large changes don't jump. The values are clamped to the limits given to
+    /// 'setAutomationRange'. Without automation, sets the values right away.
+    void rampTo(double newTempo, double newPitch, double newRate);
+
     /// Sets the number of channels, 1 = mono, 2 = stereo
     void setChannels(uint numChannels);
 
@@ -289,6 +359,36 @@ public:
                                                     ///< contains data for both channels.
             );
 
+    /// Processes a batch of independent streams, one SoundTouch instance per 
+    /// stream, in one call: adds 'numInput[i]' samples from 'input[i]' to 
+    /// stream 'i', and then receives at most 'maxOutput[i]' processed samples 
+    /// from it to 'output[i]', setting 'numOutput[i]' to the number of samples 
+    /// received. 'output' may be NULL to leave the processed samples in the 
+    /// streams for receiving them later with 'receiveSamples', in which case 
+    /// 'maxOutput' and 'numOutput' may be NULL, too.
+    ///
+    /// When built with OpenMP, the streams are divided evenly among threads in
+    /// consecutive groups, so that on successive calls each thread processes 
+    /// the same streams and their state stays in the same caches. This works 
+    /// best when the streams have the same settings and roughly the same amount
+    /// of input, so that each group takes equally long. The caller can also 
+    /// schedule the work over its own threads by giving each thread a separate 
+    /// part of the batch.
+    ///
+    /// Each instance must appear in the batch only once, and the allocator set 
+    /// with 'setAllocator' must be thread-safe. Throws a runtime_error exception
+    /// before processing anything if the sample rate or channels aren't set in
+    /// some of the streams.
+    static void processStreams(
+            SoundTouch * const *streams,        ///< Instances to process.
+            int numStreams,                     ///< Number of instances in 'streams'.
+            const SAMPLETYPE * const *input,    ///< Input sample buffer of each stream.
+            const uint *numInput,               ///< Number of input samples of each stream.
+            SAMPLETYPE * const *output,         ///< Output sample buffer of each stream, or NULL.
+            const uint *maxOutput,              ///< Capacity of each output buffer in samples.
+            uint *numOutput                     ///< Receives the number of samples output by each stream.
+            );
+
     /// Output samples from beginning of the sample buffer. Copies requested samples to 
     /// output buffer and removes them from the sample buffer. If there are less than 
     /// 'numsample' samples in the buffer, returns all that available.
@@ -84,10 +84,12 @@ const short _scanOffsets[5][24]={
 TDStretch::TDStretch() : FIFOProcessor(&outputBuffer)
 {
     bQuickSeek = false;
+    bFFTSeek = false;
+    bLowLatency = false;
+    pFFTCorr = NULL;
     channels = 2;
 
     pMidBuffer = NULL;
-    pMidBufferUnaligned = NULL;
     overlapLength = 0;
 
     bAutoSeqSetting = true;
@@ -109,7 +111,8 @@ TDStretch::TDStretch() : FIFOProcessor(&outputBuffer)
 
 TDStretch::~TDStretch()
 {
-    delete[] pMidBufferUnaligned;
+    alignedFree(pMidBuffer);
+    delete pFFTCorr;
 }
 
 
@@ -251,6 +254,40 @@ bool TDStretch::isQuickSeekEnabled() const
 }
 
 
+// Enables/disables FFT-based position seeking.
+void TDStretch::enableFFTSeek(bool enable)
+{
+    if (enable && (pFFTCorr == NULL))
+    {
+        pFFTCorr = new FFTCrossCorr;
+    }
+    bFFTSeek = enable;
+}
+
+
+// Returns nonzero if FFT-based seeking is enabled.
+bool TDStretch::isFFTSeekEnabled() const
+{
+    return bFFTSeek;
+}
+
+
+// Enables/disables low-latency mode
+void TDStretch::enableLowLatency(bool enable)
+{
+    bLowLatency = enable;
+    // recalculate automatic sequence parameters & input requirement
+    setTempo(tempo);
+}
+
+
+// Returns nonzero if low-latency mode is enabled.
+bool TDStretch::isLowLatencyEnabled() const
+{
+    return bLowLatency;
+}
+
+
 // Seeks for the optimal overlap-mixing position.
 int TDStretch::seekBestOverlapPosition(const SAMPLETYPE *refPos)
 {
@@ -258,6 +295,10 @@ int TDStretch::seekBestOverlapPosition(const SAMPLETYPE *refPos)
     {
         return seekBestOverlapPositionQuick(refPos);
     }
+    else if (bFFTSeek)
+    {
+        return seekBestOverlapPositionFFT(refPos);
+    }
     else 
     {
         return seekBestOverlapPositionFull(refPos);
@@ -355,6 +396,49 @@ int TDStretch::seekBestOverlapPositionFull(const SAMPLETYPE *refPos)
 }
 
 
+// Seeks for the optimal overlap-mixing position like 'seekBestOverlapPositionFull', 
+// but calculates the cross-correlation of all positions at once using FFT. This 
+// is faster when the seek window and overlap are long.
+int TDStretch::seekBestOverlapPositionFFT(const SAMPLETYPE *refPos) 
+{
+    int bestOffs;
+    double bestCorr;
+    const double *corrs;
+    int i;
+
+    assert(pFFTCorr);
+    corrs = pFFTCorr->calculate(refPos, pMidBuffer, channels, overlapLength, seekLength);
+
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+    // match the scale of the integer calcCrossCorr, which shifts both sums right
+    // by 'overlapDividerBitsNorm' bits, so that the heuristic below weighs the
+    // same. There's no risk of overflow here, so no need to adapt the normalizer.
+    const double scale = pow(2.0, -0.5 * overlapDividerBitsNorm);
+#else
+    const double scale = 1.0;
+#endif
+
+    bestCorr = (corrs[0] * scale + 0.1) * 0.75;
+    bestOffs = 0;
+
+    for (i = 1; i < seekLength; i ++) 
+    {
+        // heuristic rule to slightly favour values close to mid of the range
+        double tmp = (double)(2 * i - seekLength) / (double)seekLength;
+        double corr = ((corrs[i] * scale + 0.1) * (1.0 - 0.25 * tmp * tmp));
+
+        // Checks for the highest correlation value
+        if (corr > bestCorr) 
+        {
+            bestCorr = corr;
+            bestOffs = i;
+        }
+    }
+
+    return bestOffs;
+}
+
+
 // Quick seek algorithm for improved runtime-performance: First roughly scans through the 
 // correlation area, and then scan surroundings of two best preliminary correlation candidates
 // with improved precision
@@ -533,22 +617,27 @@ void TDStretch::calcSeqParameters()
     #define AUTOSEEK_K          ((AUTOSEEK_AT_MAX - AUTOSEEK_AT_MIN) / (AUTOSEQ_TEMPO_TOP - AUTOSEQ_TEMPO_LOW))
     #define AUTOSEEK_C          (AUTOSEEK_AT_MIN - (AUTOSEEK_K) * (AUTOSEQ_TEMPO_LOW))
 
+    // scale of the automatic settings in low-latency mode. Shorter sequences 
+    // make the sound more "chopped" for music, but speech does well with them.
+    #define LOW_LATENCY_SCALE   0.5
+
     #define CHECK_LIMITS(x, mi, ma) (((x) < (mi)) ? (mi) : (((x) > (ma)) ? (ma) : (x)))
 
     double seq, seek;
+    const double scale = (bLowLatency) ? LOW_LATENCY_SCALE : 1.0;
     
     if (bAutoSeqSetting)
     {
         seq = AUTOSEQ_C + AUTOSEQ_K * tempo;
         seq = CHECK_LIMITS(seq, AUTOSEQ_AT_MAX, AUTOSEQ_AT_MIN);
-        sequenceMs = (int)(seq + 0.5);
+        sequenceMs = (int)(seq * scale + 0.5);
     }
 
     if (bAutoSeekSetting)
     {
         seek = AUTOSEEK_C + AUTOSEEK_K * tempo;
         seek = CHECK_LIMITS(seek, AUTOSEEK_AT_MAX, AUTOSEEK_AT_MIN);
-        seekWindowMs = (int)(seek + 0.5);
+        seekWindowMs = (int)(seek * scale + 0.5);
     }
 
     // Update seek window lengths
@@ -585,6 +674,46 @@ void TDStretch::setTempo(double newTempo)
 
 
 
+// Sizes the buffers for the worst case within the tempo range. The sequence 
+// parameters depend on the tempo, so step through the range and find the 
+// largest requirements.
+uint TDStretch::reserveTempoRange(double minTempo, double maxTempo, uint maxInputSamples)
+{
+    const int steps = 32;
+    const double oldTempo = tempo;
+    int i, maxReq, maxSeek, maxBatch, numBatches;
+    double minSkip;
+    uint maxOutput;
+
+    maxReq = maxSeek = maxBatch = 0;
+    minSkip = 1e9;
+    for (i = 0; i <= steps; i ++)
+    {
+        setTempo(minTempo + (maxTempo - minTempo) * i / steps);
+        if (sampleReq > maxReq) maxReq = sampleReq;
+        if (seekLength > maxSeek) maxSeek = seekLength;
+        if (seekWindowLength - overlapLength > maxBatch) maxBatch = seekWindowLength - overlapLength;
+        if (nominalSkip < minSkip) minSkip = nominalSkip;
+    }
+    setTempo(oldTempo);
+    if (minSkip < 1.0) minSkip = 1.0;
+
+    // less than 'sampleReq' samples are left unprocessed between batches, and each 
+    // processing round consumes about 'nominalSkip' samples & outputs 'maxBatch'
+    numBatches = (int)((double)(maxReq + (int)maxInputSamples) / minSkip) + 1;
+    maxOutput = (uint)(numBatches * maxBatch + overlapLength);
+
+    inputBuffer.reserve((uint)maxReq + maxInputSamples);
+    outputBuffer.reserve(maxOutput);
+    if (pFFTCorr)
+    {
+        pFFTCorr->reserve(channels, overlapLength, maxSeek);
+    }
+
+    return maxOutput;
+}
+
+
 // Sets the number of channels, 1 = mono, 2 = stereo
 void TDStretch::setChannels(int numChannels)
 {
@@ -747,11 +876,9 @@ void TDStretch::acceptNewOverlapLength(int newOverlapLength)
 
     if (overlapLength > prevOvl)
     {
-        delete[] pMidBufferUnaligned;
+        alignedFree(pMidBuffer);
 
-        pMidBufferUnaligned = new SAMPLETYPE[overlapLength * channels + 16 / sizeof(SAMPLETYPE)];
-        // ensure that 'pMidBuffer' is aligned to 16 byte boundary for efficiency
-        pMidBuffer = (SAMPLETYPE *)SOUNDTOUCH_ALIGN_POINTER_16(pMidBufferUnaligned);
+        pMidBuffer = (SAMPLETYPE *)alignedAlloc(overlapLength * channels * sizeof(SAMPLETYPE));
 
         clearMidBuffer();
     }
@@ -774,7 +901,25 @@ TDStretch * TDStretch::newInstance()
 
     uExtensions = detectCPUextensions();
 
-    // Check if MMX/SSE instruction set extensions supported by CPU
+    // Check if AVX2/SSE2/MMX/SSE/NEON instruction set extensions supported by CPU
+
+#ifdef SOUNDTOUCH_ALLOW_AVX2
+    if (uExtensions & SUPPORT_AVX2)
+    {
+        // AVX2 & FMA support
+        return ::new TDStretchAVX2;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_AVX2
+
+#ifdef SOUNDTOUCH_ALLOW_SSE2
+    // SSE2 routines available only with integer sample types
+    if (uExtensions & SUPPORT_SSE2)
+    {
+        return ::new TDStretchSSE2;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_SSE2
 
 #ifdef SOUNDTOUCH_ALLOW_MMX
     // MMX routines available only with integer sample types
@@ -795,6 +940,16 @@ TDStretch * TDStretch::newInstance()
     else
 #endif // SOUNDTOUCH_ALLOW_SSE
 
+
+#ifdef SOUNDTOUCH_ALLOW_NEON
+    if (uExtensions & SUPPORT_NEON)
+    {
+        // NEON support
+        return ::new TDStretchNEON;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_NEON
+
     {
         // ISA optimizations not supported, use plain C version
         return ::new TDStretch;
@@ -925,7 +1080,7 @@ double TDStretch::calcCrossCorr(const short *mixingPos, const short *compare, do
 double TDStretch::calcCrossCorrAccumulate(const short *mixingPos, const short *compare, double &norm)
 {
     long corr;
-    unsigned long lnorm;
+    long lnorm;     // signed, as the first taps are subtracted
     int i;
 
     // cancel first normalizer tap from previous round
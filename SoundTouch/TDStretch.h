@@ -41,6 +41,7 @@
 #include "STTypes.h"
 #include "RateTransposer.h"
 #include "FIFOSamplePipe.h"
+#include "FFTCrossCorr.h"
 
 namespace soundtouch
 {
@@ -125,16 +126,19 @@ protected:
     double skipFract;
 
     bool bQuickSeek;
+    bool bFFTSeek;
+    bool bLowLatency;
     bool bAutoSeqSetting;
     bool bAutoSeekSetting;
     bool isBeginning;
 
     SAMPLETYPE *pMidBuffer;
-    SAMPLETYPE *pMidBufferUnaligned;
 
     FIFOSampleBuffer outputBuffer;
     FIFOSampleBuffer inputBuffer;
 
+    FFTCrossCorr *pFFTCorr;
+
     void acceptNewOverlapLength(int newOverlapLength);
 
     virtual void clearCrossCorrState();
@@ -145,6 +149,7 @@ protected:
 
     virtual int seekBestOverlapPositionFull(const SAMPLETYPE *refPos);
     virtual int seekBestOverlapPositionQuick(const SAMPLETYPE *refPos);
+    int seekBestOverlapPositionFFT(const SAMPLETYPE *refPos);
     virtual int seekBestOverlapPosition(const SAMPLETYPE *refPos);
 
     virtual void overlapStereo(SAMPLETYPE *output, const SAMPLETYPE *input) const;
@@ -168,7 +173,7 @@ public:
     virtual ~TDStretch();
 
     /// Operator 'new' is overloaded so that it automatically creates a suitable instance 
-    /// depending on if we've a MMX/SSE/etc-capable CPU available or not.
+    /// depending on if we've a MMX/SSE/AVX2/NEON-capable CPU available or not.
     static void *operator new(size_t s);
 
     /// Use this function instead of "new" operator to create a new instance of this class. 
@@ -186,6 +191,15 @@ public:
     /// tempo, larger faster tempo.
     void setTempo(double newTempo);
 
+    /// Sizes the buffers for any tempo between 'minTempo' and 'maxTempo' and for
+    /// input batches of at most 'maxInputSamples', so that later tempo changes 
+    /// within the range and processing such batches won't allocate memory, as 
+    /// long as the output is received after each batch. Call after the other
+    /// parameters have been set.
+    ///
+    /// \return The largest number of samples that one input batch can output.
+    uint reserveTempoRange(double minTempo, double maxTempo, uint maxInputSamples);
+
     /// Returns nonzero if there aren't any samples available for outputting.
     virtual void clear();
 
@@ -202,6 +216,22 @@ public:
     /// Returns nonzero if the quick seeking algorithm is enabled.
     bool isQuickSeekEnabled() const;
 
+    /// Enables/disables FFT-based position seeking. It finds the same positions as 
+    /// the default full seek, but is faster with long seek windows and overlaps.
+    /// Quick seek is used instead if it's also enabled.
+    void enableFFTSeek(bool enable);
+
+    /// Returns nonzero if FFT-based seeking is enabled.
+    bool isFFTSeekEnabled() const;
+
+    /// Enables/disables low-latency mode, which halves the sequence and seek 
+    /// window durations that are chosen automatically. Has no effect on 
+    /// durations that have been set explicitly.
+    void enableLowLatency(bool enable);
+
+    /// Returns nonzero if low-latency mode is enabled.
+    bool isLowLatencyEnabled() const;
+
     /// Sets routine control parameters. These control are certain time constants
     /// defining how the sound is stretched to the desired duration.
     //
@@ -275,5 +305,49 @@ public:
 
 #endif /// SOUNDTOUCH_ALLOW_SSE
 
+
+#ifdef SOUNDTOUCH_ALLOW_SSE2
+    /// Class that implements SSE2 optimized routines for 16bit integer samples type.
+    /// Used instead of the MMX routines, which aren't available in X64 mode.
+    class TDStretchSSE2 : public TDStretch
+    {
+    protected:
+        SOUNDTOUCH_TARGET_SSE2 double calcCrossCorr(const short *mixingPos, const short *compare, double &norm);
+        SOUNDTOUCH_TARGET_SSE2 double calcCrossCorrAccumulate(const short *mixingPos, const short *compare, double &norm);
+        SOUNDTOUCH_TARGET_SSE2 virtual void overlapStereo(short *output, const short *input) const;
+    };
+
+#endif /// SOUNDTOUCH_ALLOW_SSE2
+
+
+#ifdef SOUNDTOUCH_ALLOW_AVX2
+    /// Class that implements AVX2 & FMA optimized routines for both sample types.
+    class TDStretchAVX2 : public TDStretch
+    {
+    protected:
+        SOUNDTOUCH_TARGET_AVX2 double calcCrossCorr(const SAMPLETYPE *mixingPos, const SAMPLETYPE *compare, double &norm);
+        SOUNDTOUCH_TARGET_AVX2 double calcCrossCorrAccumulate(const SAMPLETYPE *mixingPos, const SAMPLETYPE *compare, double &norm);
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+        SOUNDTOUCH_TARGET_AVX2 virtual void overlapStereo(short *output, const short *input) const;
+#endif
+    };
+
+#endif /// SOUNDTOUCH_ALLOW_AVX2
+
+
+#ifdef SOUNDTOUCH_ALLOW_NEON
+    /// Class that implements NEON optimized routines for both sample types.
+    class TDStretchNEON : public TDStretch
+    {
+    protected:
+        double calcCrossCorr(const SAMPLETYPE *mixingPos, const SAMPLETYPE *compare, double &norm);
+        double calcCrossCorrAccumulate(const SAMPLETYPE *mixingPos, const SAMPLETYPE *compare, double &norm);
+#ifdef SOUNDTOUCH_INTEGER_SAMPLES
+        virtual void overlapStereo(short *output, const short *input) const;
+#endif
+    };
+
+#endif /// SOUNDTOUCH_ALLOW_NEON
+
 }
 #endif  /// TDStretch_H
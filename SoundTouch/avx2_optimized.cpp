@@ -0,0 +1,549 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// AVX2 & FMA optimized routines for Haswell, Excavator and later CPUs. All 
+/// AVX2 optimized functions have been gathered into this single source code 
+/// file, like the SSE ones in 'sse_optimized.cpp'.
+///
+/// The library chooses these routines at run time if the CPU supports them, 
+/// so the rest of the library needn't be compiled for AVX2. GCC and clang 
+/// compile just these routines for AVX2 & FMA, see SOUNDTOUCH_TARGET_AVX2;
+/// Visual C++ 2012 or later allows the intrinsics without special settings.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "cpu_detect.h"
+#include "STTypes.h"
+
+using namespace soundtouch;
+
+#ifdef SOUNDTOUCH_ALLOW_AVX2
+
+#include <immintrin.h>
+#include <math.h>
+#include <assert.h>
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of AVX2 optimized functions of class 'TDStretchAVX2'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TDStretch.h"
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+
+// Returns vSum[0] + vSum[1] + ... + vSum[7]
+static inline SOUNDTOUCH_TARGET_AVX2 float horizontalSum(__m256 vSum)
+{
+    __m128 vTemp;
+
+    vTemp = _mm_add_ps(_mm256_castps256_ps128(vSum), _mm256_extractf128_ps(vSum, 1));
+    vTemp = _mm_add_ps(vTemp, _mm_movehl_ps(vTemp, vTemp));
+    vTemp = _mm_add_ss(vTemp, _mm_shuffle_ps(vTemp, vTemp, 1));
+    return _mm_cvtss_f32(vTemp);
+}
+
+
+// Calculates cross correlation of two buffers
+double TDStretchAVX2::calcCrossCorr(const float *pV1, const float *pV2, double &anorm)
+{
+    int i;
+    __m256 vSum1, vSum2, vNorm1, vNorm2;
+
+#ifdef SOUNDTOUCH_ALLOW_NONEXACT_SIMD_OPTIMIZATION
+    // Same little cheating as in the SSE version: return valid correlation only 
+    // for locations aligned to 16 bytes, meaning every second round for stereo 
+    // sound. Sticking to the same locations keeps the result same as with SSE.
+    if (((ulongptr)pV1) & 15)
+    {
+        // skip unaligned locations, and tell calcCrossCorrAccumulate that 
+        // "norm" wasn't calculated
+        anorm = -1e50;
+        return -1e50;
+    }
+#endif
+
+    // ensure overlapLength is divisible by 8
+    assert((overlapLength % 8) == 0);
+
+    // Calculates the cross-correlation value between 'pV1' and 'pV2' vectors.
+    // Neither needs to be aligned to 32 bytes, as unaligned AVX loads cost 
+    // little on CPUs that have AVX2.
+    vSum1 = vSum2 = vNorm1 = vNorm2 = _mm256_setzero_ps();
+
+    // Process 16 samples per round, same amount as in the SSE version. Using 
+    // two sets of sums lets the multiply-adds run in parallel.
+    for (i = 0; i < channels * overlapLength / 16; i ++) 
+    {
+        __m256 vTemp1, vTemp2;
+
+        // vSum += pV1[0..7] * pV2[0..7]
+        vTemp1 = _mm256_loadu_ps(pV1);
+        vSum1  = _mm256_fmadd_ps(vTemp1, _mm256_loadu_ps(pV2), vSum1);
+        vNorm1 = _mm256_fmadd_ps(vTemp1, vTemp1, vNorm1);
+
+        // vSum += pV1[8..15] * pV2[8..15]
+        vTemp2 = _mm256_loadu_ps(pV1 + 8);
+        vSum2  = _mm256_fmadd_ps(vTemp2, _mm256_loadu_ps(pV2 + 8), vSum2);
+        vNorm2 = _mm256_fmadd_ps(vTemp2, vTemp2, vNorm2);
+
+        pV1 += 16;
+        pV2 += 16;
+    }
+
+    float norm = horizontalSum(_mm256_add_ps(vNorm1, vNorm2));
+    anorm = norm;
+
+    float corr = horizontalSum(_mm256_add_ps(vSum1, vSum2));
+    return (double)corr / sqrt(norm < 1e-9 ? 1.0 : norm);
+}
+
+
+// Update cross-correlation by accumulating "norm" coefficient by previously 
+// calculated value, so that only the correlation sum needs calculating.
+double TDStretchAVX2::calcCrossCorrAccumulate(const float *pV1, const float *pV2, double &norm)
+{
+    int i;
+    __m256 vSum1, vSum2;
+
+    // Same amount of samples as summed by calcCrossCorr
+    const int count = channels * overlapLength / 16 * 16;
+
+    // previous location was skipped, so there's no "norm" to update
+    if (norm <= -1e50) return calcCrossCorr(pV1, pV2, norm);
+
+    // cancel first normalizer tap from previous round, and add last samples of 
+    // this round. Done also for locations that are skipped below, so that 
+    // "norm" stays valid for the following rounds.
+    for (i = 1; i <= channels; i ++)
+    {
+        norm -= pV1[-i] * pV1[-i];
+        norm += pV1[count - i] * pV1[count - i];
+    }
+
+#ifdef SOUNDTOUCH_ALLOW_NONEXACT_SIMD_OPTIMIZATION
+    if (((ulongptr)pV1) & 15) return -1e50;    // skip unaligned locations
+#endif
+
+    vSum1 = vSum2 = _mm256_setzero_ps();
+
+    for (i = 0; i < count; i += 16) 
+    {
+        vSum1 = _mm256_fmadd_ps(_mm256_loadu_ps(pV1 + i), _mm256_loadu_ps(pV2 + i), vSum1);
+        vSum2 = _mm256_fmadd_ps(_mm256_loadu_ps(pV1 + i + 8), _mm256_loadu_ps(pV2 + i + 8), vSum2);
+    }
+
+    float corr = horizontalSum(_mm256_add_ps(vSum1, vSum2));
+    return (double)corr / sqrt(norm < 1e-9 ? 1.0 : norm);
+}
+
+#else // SOUNDTOUCH_FLOAT_SAMPLES
+
+// Returns vSum[0] + vSum[1] + ... + vSum[7], summed in 64 bits
+static inline SOUNDTOUCH_TARGET_AVX2 long horizontalSum32(__m256i vSum)
+{
+    int values[8];
+    long sum = 0;
+
+    _mm256_storeu_si256((__m256i *)values, vSum);
+    for (int i = 0; i < 8; i ++)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+
+
+// Calculates cross correlation of two buffers like the SSE2 version, but 
+// for 8 product pairs at a time
+double TDStretchAVX2::calcCrossCorr(const short *pV1, const short *pV2, double &dnorm)
+{
+    const __m128i shifter = _mm_cvtsi32_si128(overlapDividerBitsNorm);
+    __m256i accu, normaccu;
+    long corr;
+    unsigned long lnorm;
+    int i;
+
+    // overlap length is a power of 2, at least 16
+    assert((channels * overlapLength) % 16 == 0);
+
+    accu = normaccu = _mm256_setzero_si256();
+
+    // Process 16 samples per round
+    for (i = 0; i < channels * overlapLength; i += 16)
+    {
+        const __m256i v1 = _mm256_loadu_si256((const __m256i *)(pV1 + i));
+        const __m256i v2 = _mm256_loadu_si256((const __m256i *)(pV2 + i));
+
+        accu = _mm256_add_epi32(accu, _mm256_sra_epi32(_mm256_madd_epi16(v1, v2), shifter));
+        normaccu = _mm256_add_epi32(normaccu, _mm256_sra_epi32(_mm256_madd_epi16(v1, v1), shifter));
+    }
+
+    corr = horizontalSum32(accu);
+    lnorm = (unsigned long)horizontalSum32(normaccu);
+
+    if (lnorm > maxnorm)
+    {
+        // modify 'maxnorm' inside critical section to avoid multi-access conflict if in OpenMP mode
+        #pragma omp critical
+        if (lnorm > maxnorm)
+        {
+            maxnorm = lnorm;
+        }
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    dnorm = (double)lnorm;
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+/// Update cross-correlation by accumulating "norm" coefficient by previously calculated value
+double TDStretchAVX2::calcCrossCorrAccumulate(const short *pV1, const short *pV2, double &dnorm)
+{
+    const __m128i shifter = _mm_cvtsi32_si128(overlapDividerBitsNorm);
+    const int count = channels * overlapLength;
+    __m256i accu;
+    long corr, lnorm;
+    int i;
+
+    // cancel first normalizer tap from previous round, and add last samples 
+    // of this round
+    lnorm = 0;
+    for (i = 1; i <= channels; i ++)
+    {
+        lnorm -= (pV1[-i] * pV1[-i]) >> overlapDividerBitsNorm;
+        lnorm += (pV1[count - i] * pV1[count - i]) >> overlapDividerBitsNorm;
+    }
+
+    accu = _mm256_setzero_si256();
+
+    for (i = 0; i < count; i += 16)
+    {
+        accu = _mm256_add_epi32(accu, _mm256_sra_epi32(_mm256_madd_epi16(
+                    _mm256_loadu_si256((const __m256i *)(pV1 + i)), 
+                    _mm256_loadu_si256((const __m256i *)(pV2 + i))), shifter));
+    }
+    corr = horizontalSum32(accu);
+
+    dnorm += (double)lnorm;
+    if (dnorm > maxnorm)
+    {
+        maxnorm = (unsigned long)dnorm;
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+// AVX2-optimized version of the function overlapStereo, see the SSE2 version. 
+// The 128-bit halves unpack & pack separately, so the lower half handles 
+// stereo frames 0..3 and the upper half frames 4..7 of each round.
+void TDStretchAVX2::overlapStereo(short *output, const short *input) const
+{
+    // overlap length is 2^(overlapDividerBitsPure + 1)
+    const int shift = overlapDividerBitsPure + 1;
+    const __m128i shifter = _mm_cvtsi32_si128(shift);
+    const __m256i rounding = _mm256_set1_epi32(overlapLength - 1);
+    const short ovl = (short)overlapLength;
+    __m256i mix1, mix2, adder;
+    int i;
+
+    assert(overlapLength == (1 << shift));
+
+    // weights of mid buffer & input for frames 0 & 1 | 4 & 5, and 2 & 3 | 6 & 7
+    mix1  = _mm256_set_epi16(5, ovl - 5, 5, ovl - 5, 4, ovl - 4, 4, ovl - 4, 
+                             1, ovl - 1, 1, ovl - 1, 0, ovl,     0, ovl);
+    mix2  = _mm256_add_epi16(mix1, _mm256_set1_epi32(0x0002fffe));
+    adder = _mm256_set1_epi32(0x0008fff8);
+
+    for (i = 0; i < 2 * overlapLength; i += 16)
+    {
+        const __m256i vMid = _mm256_loadu_si256((const __m256i *)(pMidBuffer + i));
+        const __m256i vInput = _mm256_loadu_si256((const __m256i *)(input + i));
+        __m256i temp1, temp2;
+
+        temp1 = _mm256_madd_epi16(_mm256_unpacklo_epi16(vMid, vInput), mix1);
+        temp2 = _mm256_madd_epi16(_mm256_unpackhi_epi16(vMid, vInput), mix2);
+
+        // divide by overlap length rounding towards zero, like the plain C version
+        temp1 = _mm256_add_epi32(temp1, _mm256_and_si256(_mm256_srai_epi32(temp1, 31), rounding));
+        temp2 = _mm256_add_epi32(temp2, _mm256_and_si256(_mm256_srai_epi32(temp2, 31), rounding));
+        temp1 = _mm256_sra_epi32(temp1, shifter);
+        temp2 = _mm256_sra_epi32(temp2, shifter);
+        _mm256_storeu_si256((__m256i *)(output + i), _mm256_packs_epi32(temp1, temp2));
+
+        mix1 = _mm256_add_epi16(mix1, adder);
+        mix2 = _mm256_add_epi16(mix2, adder);
+    }
+}
+
+#endif  // SOUNDTOUCH_FLOAT_SAMPLES
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of AVX2 optimized functions of class 'FIRFilterAVX2'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "FIRFilter.h"
+
+FIRFilterAVX2::FIRFilterAVX2() : FIRFilter()
+{
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    filterCoeffsScaled = NULL;
+#else
+    filterCoeffsPaired = NULL;
+#endif
+}
+
+
+FIRFilterAVX2::~FIRFilterAVX2()
+{
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    alignedFree(filterCoeffsScaled);
+#else
+    alignedFree(filterCoeffsPaired);
+#endif
+}
+
+
+// (overloaded) Calculates filter coefficients for AVX2 routine
+void FIRFilterAVX2::setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint uResultDivFactor)
+{
+    uint i;
+    bool resize = (newLength != length);
+
+    FIRFilter::setCoefficients(coeffs, newLength, uResultDivFactor);
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    // Scale the filter coefficients so that it won't be necessary to scale the filtering result
+    float fDivider = (float)resultDivider;
+
+    if (resize || (filterCoeffsScaled == NULL))
+    {
+        alignedFree(filterCoeffsScaled);
+        filterCoeffsScaled = (float *)alignedAlloc(newLength * sizeof(float));
+    }
+    for (i = 0; i < newLength; i ++)
+    {
+        filterCoeffsScaled[i] = coeffs[i] / fDivider;
+    }
+#else
+    // Pack coefficient pairs like consecutive shorts in memory, the first one 
+    // in the low half
+    if (resize || (filterCoeffsPaired == NULL))
+    {
+        alignedFree(filterCoeffsPaired);
+        filterCoeffsPaired = (int *)alignedAlloc(newLength / 2 * sizeof(int));
+    }
+    for (i = 0; i < newLength / 2; i ++)
+    {
+        filterCoeffsPaired[i] = (int)(((uint)(unsigned short)coeffs[2 * i + 1] << 16) | 
+                                      (unsigned short)coeffs[2 * i]);
+    }
+#endif
+}
+
+
+uint FIRFilterAVX2::evaluateFilterStereo(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const
+{
+    return evaluateFilterAVX2(dest, src, numSamples, 2);
+}
+
+
+uint FIRFilterAVX2::evaluateFilterMono(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const
+{
+    return evaluateFilterAVX2(dest, src, numSamples, 1);
+}
+
+
+uint FIRFilterAVX2::evaluateFilterMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples, uint numChannels)
+{
+    return evaluateFilterAVX2(dest, src, numSamples, numChannels);
+}
+
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+
+// AVX2-optimized filter routine for any number of channels. Output value 'dest[m]' 
+// is the sum of 'src[m + i * numChannels] * coefficient[i]' over the filter taps 
+// 'i', so for 8 consecutive output values each tap takes one broadcast coefficient
+// and one unaligned load whatever the number of channels is.
+uint FIRFilterAVX2::evaluateFilterAVX2(float *dest, const float *src, uint numSamples, uint numChannels) const
+{
+    const int count = (int)((numSamples - length) * numChannels);
+    const int stride = (int)numChannels;
+    const int blocks = count / 32;
+    int b, m;
+
+    assert(src != NULL);
+    assert(dest != NULL);
+    assert(filterCoeffsScaled != NULL);
+
+    // 32 output values per round, in four sums so that several multiply-adds 
+    // are in flight at a time
+    #pragma omp parallel for
+    for (b = 0; b < blocks; b ++)
+    {
+        const float *pSrc = src + 32 * b;
+        float *pDest = dest + 32 * b;
+        __m256 sum0, sum1, sum2, sum3;
+        uint i;
+
+        sum0 = sum1 = sum2 = sum3 = _mm256_setzero_ps();
+
+        for (i = 0; i < length; i ++)
+        {
+            const __m256 coeff = _mm256_broadcast_ss(filterCoeffsScaled + i);
+
+            sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc),      coeff, sum0);
+            sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc + 8),  coeff, sum1);
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc + 16), coeff, sum2);
+            sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc + 24), coeff, sum3);
+            pSrc += stride;
+        }
+
+        _mm256_storeu_ps(pDest,      sum0);
+        _mm256_storeu_ps(pDest + 8,  sum1);
+        _mm256_storeu_ps(pDest + 16, sum2);
+        _mm256_storeu_ps(pDest + 24, sum3);
+    }
+
+    // remaining values 8 at a time, and the last ones separately
+    for (m = 32 * blocks; m + 8 <= count; m += 8)
+    {
+        const float *pSrc = src + m;
+        __m256 sum = _mm256_setzero_ps();
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc), _mm256_broadcast_ss(filterCoeffsScaled + i), sum);
+            pSrc += stride;
+        }
+        _mm256_storeu_ps(dest + m, sum);
+    }
+    for (; m < count; m ++)
+    {
+        float sum = 0;
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum += src[m + i * stride] * filterCoeffsScaled[i];
+        }
+        dest[m] = sum;
+    }
+
+    return numSamples - length;
+}
+
+#else // SOUNDTOUCH_FLOAT_SAMPLES
+
+// Interleaves 8 + 8 shorts of 'a' and 'b' to a0 b0 a1 b1 ... a7 b7
+static inline SOUNDTOUCH_TARGET_AVX2 __m256i interleave16(__m128i a, __m128i b)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(a, b)), 
+                                   _mm_unpackhi_epi16(a, b), 1);
+}
+
+
+// AVX2-optimized filter routine for any number of channels, see the float 
+// version above. Values of two taps at a time are interleaved, so that 
+// 'vpmaddwd' multiplies them with the coefficient pair and adds the products 
+// to 32-bit sums.
+uint FIRFilterAVX2::evaluateFilterAVX2(short *dest, const short *src, uint numSamples, uint numChannels) const
+{
+    const int count = (int)((numSamples - length) * numChannels);
+    const int stride = (int)numChannels;
+    const int blocks = count / 16;
+    const __m128i shift = _mm_cvtsi32_si128((int)resultDivFactor);
+    int b, m;
+
+    assert(src != NULL);
+    assert(dest != NULL);
+    assert(filterCoeffsPaired != NULL);
+
+    // 16 output values per round
+    #pragma omp parallel for
+    for (b = 0; b < blocks; b ++)
+    {
+        const short *pSrc = src + 16 * b;
+        short *pDest = dest + 16 * b;
+        __m256i sum0, sum1;
+        uint i;
+
+        sum0 = sum1 = _mm256_setzero_si256();
+
+        for (i = 0; i < length / 2; i ++)
+        {
+            const __m256i coeff = _mm256_set1_epi32(filterCoeffsPaired[i]);
+
+            sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(interleave16(
+                        _mm_loadu_si128((const __m128i *)pSrc), 
+                        _mm_loadu_si128((const __m128i *)(pSrc + stride))), coeff));
+            sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(interleave16(
+                        _mm_loadu_si128((const __m128i *)(pSrc + 8)), 
+                        _mm_loadu_si128((const __m128i *)(pSrc + stride + 8))), coeff));
+            pSrc += 2 * stride;
+        }
+
+        sum0 = _mm256_sra_epi32(sum0, shift);
+        sum1 = _mm256_sra_epi32(sum1, shift);
+
+        // saturate to 16 bit integer limits & store
+        _mm_storeu_si128((__m128i *)pDest, 
+            _mm_packs_epi32(_mm256_castsi256_si128(sum0), _mm256_extracti128_si256(sum0, 1)));
+        _mm_storeu_si128((__m128i *)(pDest + 8), 
+            _mm_packs_epi32(_mm256_castsi256_si128(sum1), _mm256_extracti128_si256(sum1, 1)));
+    }
+
+    // remaining values one at a time, as in the plain C version
+    for (m = 16 * blocks; m < count; m ++)
+    {
+        LONG_SAMPLETYPE sum = 0;
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum += src[m + i * stride] * filterCoeffs[i];
+        }
+        sum >>= resultDivFactor;
+        // saturate to 16 bit integer limits
+        sum = (sum < -32768) ? -32768 : (sum > 32767) ? 32767 : sum;
+        dest[m] = (short)sum;
+    }
+
+    return numSamples - length;
+}
+
+#endif // SOUNDTOUCH_FLOAT_SAMPLES
+
+#endif  // SOUNDTOUCH_ALLOW_AVX2
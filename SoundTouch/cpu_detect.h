@@ -43,6 +43,8 @@
 #define SUPPORT_ALTIVEC     0x0004
 #define SUPPORT_SSE         0x0008
 #define SUPPORT_SSE2        0x0010
+#define SUPPORT_AVX2        0x0020      ///< AVX2 & FMA, with ymm state saved by the OS
+#define SUPPORT_NEON        0x0040
 
 /// Checks which instruction set extensions are supported by the CPU.
 ///
@@ -35,28 +35,15 @@
 #include "cpu_detect.h"
 #include "STTypes.h"
 
+// The instruction sets come from cpu_features(), shared with the other
+// SIMD code built alongside SoundTouch, so that the CPU_FEATURES
+// environment variable can turn them off for all of it at once.
+#include "../cpu_features.h"
 
-#if defined(SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS)
 
-   #if defined(__GNUC__) && defined(__i386__)
-       // gcc
-       #include "cpuid.h"
-   #elif defined(_M_IX86)
-       // windows non-gcc
-       #include <intrin.h>
-   #endif
-
-   #define bit_MMX     (1 << 23)
-   #define bit_SSE     (1 << 25)
-   #define bit_SSE2    (1 << 26)
-#endif
-
-
-//////////////////////////////////////////////////////////////////////////////
 //
 // processor instructions extension detection routines
 //
-//////////////////////////////////////////////////////////////////////////////
 
 // Flag variable indicating whick ISA extensions are disabled (for debugging)
 static uint _dwDisabledISA = 0x00;      // 0xffffffff; //<- use this to disable all extensions
@@ -71,60 +58,28 @@ void disableExtensions(uint dwDisableMask)
 /// Checks which instruction set extensions are supported by the CPU.
 uint detectCPUextensions(void)
 {
-/// If building for a 64bit system (no Itanium) and the user wants optimizations.
-/// Return the OR of SUPPORT_{MMX,SSE,SSE2}. 11001 or 0x19.
-/// Keep the _dwDisabledISA test (2 more operations, could be eliminated).
-#if ((defined(__GNUC__) && defined(__x86_64__)) \
-    || defined(_M_X64))  \
-    && defined(SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS)
-    return 0x19 & ~_dwDisabledISA;
-
-/// If building for a 32bit system and the user wants optimizations.
-/// Keep the _dwDisabledISA test (2 more operations, could be eliminated).
-#elif ((defined(__GNUC__) && defined(__i386__)) \
-    || defined(_M_IX86))  \
-    && defined(SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS)
-
-    if (_dwDisabledISA == 0xffffffff) return 0;
- 
     uint res = 0;
- 
-#if defined(__GNUC__)
-    // GCC version of cpuid. Requires GCC 4.3.0 or later for __cpuid intrinsic support.
-    uint eax, ebx, ecx, edx;  // unsigned int is the standard type. uint is defined by the compiler and not guaranteed to be portable.
-
-    // Check if no cpuid support.
-    if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx)) return 0; // always disable extensions.
+    uint features;
 
-    if (edx & bit_MMX)  res = res | SUPPORT_MMX;
-    if (edx & bit_SSE)  res = res | SUPPORT_SSE;
-    if (edx & bit_SSE2) res = res | SUPPORT_SSE2;
-
-#else
-    // Window / VS version of cpuid. Notice that Visual Studio 2005 or later required 
-    // for __cpuid intrinsic support.
-    int reg[4] = {-1};
+    if (_dwDisabledISA == 0xffffffff) return 0;
 
-    // Check if no cpuid support.
-    __cpuid(reg,0);
-    if ((unsigned int)reg[0] == 0) return 0; // always disable extensions.
+    features = cpu_features();
 
-    __cpuid(reg,1);
-    if ((unsigned int)reg[3] & bit_MMX)  res = res | SUPPORT_MMX;
-    if ((unsigned int)reg[3] & bit_SSE)  res = res | SUPPORT_SSE;
-    if ((unsigned int)reg[3] & bit_SSE2) res = res | SUPPORT_SSE2;
+#if defined(SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS) && \
+    ((defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))) || defined(_M_IX86) || defined(_M_X64))
+    /// MMX and SSE are reported along with SSE2, the x86-64 baseline. Older
+    /// 32-bit CPUs without SSE2 run the plain C++ code.
+    if (features & CPU_FEATURE_SSE2) res |= SUPPORT_MMX | SUPPORT_SSE | SUPPORT_SSE2;
+#if defined(SOUNDTOUCH_ALLOW_AVX2)
+    /// AVX2 & FMA, with the ymm state saved by the OS
+    if ((features & CPU_FEATURE_AVX2) && (features & CPU_FEATURE_FMA)) res |= SUPPORT_AVX2;
+#endif
 
+/// NEON is known at compile time, when building for a processor that has it.
+#elif defined(SOUNDTOUCH_ALLOW_NEON)
+    if (features & CPU_FEATURE_NEON) res |= SUPPORT_NEON;
 #endif
 
+    (void)features;
     return res & ~_dwDisabledISA;
-
-#else
-
-/// One of these is true:
-/// 1) We don't want optimizations.
-/// 2) Using an unsupported compiler.
-/// 3) Running on a non-x86 platform.
-    return 0;
-
-#endif
 }
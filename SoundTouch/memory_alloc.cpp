@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Aligned memory allocation with a replaceable allocator. All sample buffers
+/// and working memory of the library are allocated through 'alignedAlloc', so
+/// that an application can direct them e.g. to a memory arena per stream.
+///
+/// The default allocator takes memory from the heap with 'malloc', enlarged
+/// for alignment, and stores the original pointer just before the aligned
+/// block for freeing. With SOUNDTOUCH_RETRO_ARENA defined, it allocates from
+/// the 'retro_arena.h' arena set for the calling thread instead.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <assert.h>
+
+#include "STTypes.h"
+
+#ifdef SOUNDTOUCH_RETRO_ARENA
+#include "retro_arena.h"
+#endif
+
+using namespace soundtouch;
+
+
+#ifdef SOUNDTOUCH_RETRO_ARENA
+
+static void *defaultAlloc(size_t size, size_t alignment, void *)
+{
+    return retro_arena_memalign(alignment, size);
+}
+
+
+static void defaultFree(void *ptr, void *)
+{
+    retro_arena_free(ptr);
+}
+
+#else
+
+static void *defaultAlloc(size_t size, size_t alignment, void *)
+{
+    void *unaligned;
+    void **aligned;
+
+    // room for alignment and the original pointer
+    unaligned = malloc(size + alignment + sizeof(void *));
+    if (unaligned == NULL) return NULL;
+
+    aligned = (void **)(((ulongptr)unaligned + sizeof(void *) + alignment - 1) & ~(ulongptr)(alignment - 1));
+    aligned[-1] = unaligned;
+    return aligned;
+}
+
+
+static void defaultFree(void *ptr, void *)
+{
+    if (ptr) free(((void **)ptr)[-1]);
+}
+
+#endif
+
+
+static ST_ALLOC_FUNC allocFunc = defaultAlloc;
+static ST_FREE_FUNC freeFunc = defaultFree;
+static void *allocContext = NULL;
+
+
+void soundtouch::setAllocator(ST_ALLOC_FUNC alloc, ST_FREE_FUNC free, void *context)
+{
+    if ((alloc == NULL) || (free == NULL))
+    {
+        allocFunc = defaultAlloc;
+        freeFunc = defaultFree;
+        allocContext = NULL;
+    }
+    else
+    {
+        allocFunc = alloc;
+        freeFunc = free;
+        allocContext = context;
+    }
+}
+
+
+void *soundtouch::alignedAlloc(size_t size)
+{
+    void *ptr;
+
+    ptr = allocFunc(size, SOUNDTOUCH_ALIGNMENT, allocContext);
+    if (ptr == NULL)
+    {
+        ST_THROW_RT_ERROR("Couldn't allocate memory!\n");
+    }
+    assert(((ulongptr)ptr & (SOUNDTOUCH_ALIGNMENT - 1)) == 0);
+    return ptr;
+}
+
+
+void soundtouch::alignedFree(void *ptr)
+{
+    freeFunc(ptr, allocContext);
+}
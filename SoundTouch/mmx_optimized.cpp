@@ -295,13 +295,12 @@ void TDStretchMMX::overlapStereo(short *output, const short *input) const
 FIRFilterMMX::FIRFilterMMX() : FIRFilter()
 {
     filterCoeffsAlign = NULL;
-    filterCoeffsUnalign = NULL;
 }
 
 
 FIRFilterMMX::~FIRFilterMMX()
 {
-    delete[] filterCoeffsUnalign;
+    alignedFree(filterCoeffsAlign);
 }
 
 
@@ -309,12 +308,15 @@ FIRFilterMMX::~FIRFilterMMX()
 void FIRFilterMMX::setCoefficients(const short *coeffs, uint newLength, uint uResultDivFactor)
 {
     uint i;
+    bool resize = (filterCoeffsAlign == NULL) || (newLength != length);
+
     FIRFilter::setCoefficients(coeffs, newLength, uResultDivFactor);
 
-    // Ensure that filter coeffs array is aligned to 16-byte boundary
-    delete[] filterCoeffsUnalign;
-    filterCoeffsUnalign = new short[2 * newLength + 8];
-    filterCoeffsAlign = (short *)SOUNDTOUCH_ALIGN_POINTER_16(filterCoeffsUnalign);
+    if (resize)
+    {
+        alignedFree(filterCoeffsAlign);
+        filterCoeffsAlign = (short *)alignedAlloc(2 * newLength * sizeof(short));
+    }
 
     // rearrange the filter coefficients for mmx routines 
     for (i = 0;i < length; i += 4) 
@@ -0,0 +1,519 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// NEON optimized routines for ARM CPUs. All NEON optimized functions have 
+/// been gathered into this single source code file, like the SSE ones in 
+/// 'sse_optimized.cpp'.
+///
+/// NEON is always present on 64bit ARM processors, and on 32bit ones these
+/// routines are used only if the compiler is set to target NEON, so they
+/// aren't chosen at run time like the x86 ones.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "cpu_detect.h"
+#include "STTypes.h"
+
+using namespace soundtouch;
+
+#ifdef SOUNDTOUCH_ALLOW_NEON
+
+#include <arm_neon.h>
+#include <math.h>
+#include <assert.h>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    // fused multiply-add
+    #define ST_VMLA(sum, a, b)      vfmaq_f32(sum, a, b)
+#else
+    #define ST_VMLA(sum, a, b)      vmlaq_f32(sum, a, b)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of NEON optimized functions of class 'TDStretchNEON'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TDStretch.h"
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+
+// Returns vSum[0] + vSum[1] + vSum[2] + vSum[3]
+static inline float horizontalSum(float32x4_t vSum)
+{
+    float32x2_t vTemp = vadd_f32(vget_low_f32(vSum), vget_high_f32(vSum));
+    return vget_lane_f32(vpadd_f32(vTemp, vTemp), 0);
+}
+
+
+// Calculates cross correlation of two buffers
+double TDStretchNEON::calcCrossCorr(const float *pV1, const float *pV2, double &anorm)
+{
+    int i;
+    float32x4_t vSum1, vSum2, vNorm1, vNorm2;
+
+#ifdef SOUNDTOUCH_ALLOW_NONEXACT_SIMD_OPTIMIZATION
+    // Same little cheating as in the SSE version: return valid correlation only 
+    // for locations aligned to 16 bytes, meaning every second round for stereo 
+    // sound.
+    if (((ulongptr)pV1) & 15)
+    {
+        // skip unaligned locations, and tell calcCrossCorrAccumulate that 
+        // "norm" wasn't calculated
+        anorm = -1e50;
+        return -1e50;
+    }
+#endif
+
+    // ensure overlapLength is divisible by 8
+    assert((overlapLength % 8) == 0);
+
+    vSum1 = vSum2 = vNorm1 = vNorm2 = vdupq_n_f32(0);
+
+    // Process 16 samples per round, same amount as in the SSE version. Using 
+    // two sets of sums lets the multiply-adds run in parallel.
+    for (i = 0; i < channels * overlapLength / 16; i ++) 
+    {
+        float32x4_t vTemp;
+
+        // vSum += pV1[0..3] * pV2[0..3]
+        vTemp  = vld1q_f32(pV1);
+        vSum1  = ST_VMLA(vSum1, vTemp, vld1q_f32(pV2));
+        vNorm1 = ST_VMLA(vNorm1, vTemp, vTemp);
+
+        // vSum += pV1[4..7] * pV2[4..7]
+        vTemp  = vld1q_f32(pV1 + 4);
+        vSum2  = ST_VMLA(vSum2, vTemp, vld1q_f32(pV2 + 4));
+        vNorm2 = ST_VMLA(vNorm2, vTemp, vTemp);
+
+        // vSum += pV1[8..11] * pV2[8..11]
+        vTemp  = vld1q_f32(pV1 + 8);
+        vSum1  = ST_VMLA(vSum1, vTemp, vld1q_f32(pV2 + 8));
+        vNorm1 = ST_VMLA(vNorm1, vTemp, vTemp);
+
+        // vSum += pV1[12..15] * pV2[12..15]
+        vTemp  = vld1q_f32(pV1 + 12);
+        vSum2  = ST_VMLA(vSum2, vTemp, vld1q_f32(pV2 + 12));
+        vNorm2 = ST_VMLA(vNorm2, vTemp, vTemp);
+
+        pV1 += 16;
+        pV2 += 16;
+    }
+
+    float norm = horizontalSum(vaddq_f32(vNorm1, vNorm2));
+    anorm = norm;
+
+    float corr = horizontalSum(vaddq_f32(vSum1, vSum2));
+    return (double)corr / sqrt(norm < 1e-9 ? 1.0 : norm);
+}
+
+
+// Update cross-correlation by accumulating "norm" coefficient by previously 
+// calculated value, so that only the correlation sum needs calculating.
+double TDStretchNEON::calcCrossCorrAccumulate(const float *pV1, const float *pV2, double &norm)
+{
+    int i;
+    float32x4_t vSum1, vSum2;
+
+    // Same amount of samples as summed by calcCrossCorr
+    const int count = channels * overlapLength / 16 * 16;
+
+    // previous location was skipped, so there's no "norm" to update
+    if (norm <= -1e50) return calcCrossCorr(pV1, pV2, norm);
+
+    // cancel first normalizer tap from previous round, and add last samples of 
+    // this round. Done also for locations that are skipped below, so that 
+    // "norm" stays valid for the following rounds.
+    for (i = 1; i <= channels; i ++)
+    {
+        norm -= pV1[-i] * pV1[-i];
+        norm += pV1[count - i] * pV1[count - i];
+    }
+
+#ifdef SOUNDTOUCH_ALLOW_NONEXACT_SIMD_OPTIMIZATION
+    if (((ulongptr)pV1) & 15) return -1e50;    // skip unaligned locations
+#endif
+
+    vSum1 = vSum2 = vdupq_n_f32(0);
+
+    for (i = 0; i < count; i += 8) 
+    {
+        vSum1 = ST_VMLA(vSum1, vld1q_f32(pV1 + i), vld1q_f32(pV2 + i));
+        vSum2 = ST_VMLA(vSum2, vld1q_f32(pV1 + i + 4), vld1q_f32(pV2 + i + 4));
+    }
+
+    float corr = horizontalSum(vaddq_f32(vSum1, vSum2));
+    return (double)corr / sqrt(norm < 1e-9 ? 1.0 : norm);
+}
+
+#else // SOUNDTOUCH_FLOAT_SAMPLES
+
+// Returns vSum[0] + vSum[1] + vSum[2] + vSum[3], summed in 64 bits
+static inline long horizontalSum32(int32x4_t vSum)
+{
+    int64x2_t vTemp = vpaddlq_s32(vSum);
+    return (long)(vgetq_lane_s64(vTemp, 0) + vgetq_lane_s64(vTemp, 1));
+}
+
+
+// Returns sums of the products of pairs of consecutive values of 'a' & 'b', 
+// shifted right by 'shift', i.e. what 'pmaddwd' & 'psrad' do on x86
+static inline int32x4_t multiplyPairs(int16x8_t a, int16x8_t b, int32x4_t shift)
+{
+    const int32x4_t lo = vmull_s16(vget_low_s16(a), vget_low_s16(b));
+    const int32x4_t hi = vmull_s16(vget_high_s16(a), vget_high_s16(b));
+    const int32x4_t pairs = vcombine_s32(vpadd_s32(vget_low_s32(lo), vget_high_s32(lo)),
+                                         vpadd_s32(vget_low_s32(hi), vget_high_s32(hi)));
+    return vshlq_s32(pairs, shift);
+}
+
+
+// Calculates cross correlation of two buffers like the plain C version, 
+// scaling each product pair down by 'overlapDividerBitsNorm' bits before summing
+double TDStretchNEON::calcCrossCorr(const short *pV1, const short *pV2, double &dnorm)
+{
+    const int32x4_t shift = vdupq_n_s32(-overlapDividerBitsNorm);  // negative => shift right
+    int32x4_t accu, normaccu;
+    long corr;
+    unsigned long lnorm;
+    int i;
+
+    // overlap length is a power of 2, at least 16
+    assert((channels * overlapLength) % 16 == 0);
+
+    accu = normaccu = vdupq_n_s32(0);
+
+    // Process 16 samples per round
+    for (i = 0; i < channels * overlapLength; i += 16)
+    {
+        const int16x8_t v1a = vld1q_s16(pV1 + i);
+        const int16x8_t v1b = vld1q_s16(pV1 + i + 8);
+
+        accu = vaddq_s32(accu, vaddq_s32(multiplyPairs(v1a, vld1q_s16(pV2 + i), shift),
+                                         multiplyPairs(v1b, vld1q_s16(pV2 + i + 8), shift)));
+        normaccu = vaddq_s32(normaccu, vaddq_s32(multiplyPairs(v1a, v1a, shift),
+                                                 multiplyPairs(v1b, v1b, shift)));
+    }
+
+    corr = horizontalSum32(accu);
+    lnorm = (unsigned long)horizontalSum32(normaccu);
+
+    if (lnorm > maxnorm)
+    {
+        // modify 'maxnorm' inside critical section to avoid multi-access conflict if in OpenMP mode
+        #pragma omp critical
+        if (lnorm > maxnorm)
+        {
+            maxnorm = lnorm;
+        }
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    dnorm = (double)lnorm;
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+/// Update cross-correlation by accumulating "norm" coefficient by previously calculated value
+double TDStretchNEON::calcCrossCorrAccumulate(const short *pV1, const short *pV2, double &dnorm)
+{
+    const int32x4_t shift = vdupq_n_s32(-overlapDividerBitsNorm);
+    const int count = channels * overlapLength;
+    int32x4_t accu;
+    long corr, lnorm;
+    int i;
+
+    // cancel first normalizer tap from previous round, and add last samples 
+    // of this round
+    lnorm = 0;
+    for (i = 1; i <= channels; i ++)
+    {
+        lnorm -= (pV1[-i] * pV1[-i]) >> overlapDividerBitsNorm;
+        lnorm += (pV1[count - i] * pV1[count - i]) >> overlapDividerBitsNorm;
+    }
+
+    accu = vdupq_n_s32(0);
+
+    for (i = 0; i < count; i += 16)
+    {
+        accu = vaddq_s32(accu, multiplyPairs(vld1q_s16(pV1 + i), vld1q_s16(pV2 + i), shift));
+        accu = vaddq_s32(accu, multiplyPairs(vld1q_s16(pV1 + i + 8), vld1q_s16(pV2 + i + 8), shift));
+    }
+    corr = horizontalSum32(accu);
+
+    dnorm += (double)lnorm;
+    if (dnorm > maxnorm)
+    {
+        maxnorm = (unsigned long)dnorm;
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+// NEON-optimized version of the function overlapStereo. Each round mixes 4 
+// stereo frames with widening multiply-adds.
+void TDStretchNEON::overlapStereo(short *output, const short *input) const
+{
+    // overlap length is 2^(overlapDividerBitsPure + 1)
+    const int shift = overlapDividerBitsPure + 1;
+    const int32x4_t shifter = vdupq_n_s32(-shift);
+    const int32x4_t rounding = vdupq_n_s32(overlapLength - 1);
+    const short ovl = (short)overlapLength;
+    const short initMid[8] = {ovl, ovl, (short)(ovl - 1), (short)(ovl - 1), 
+                              (short)(ovl - 2), (short)(ovl - 2), (short)(ovl - 3), (short)(ovl - 3)};
+    const short initInput[8] = {0, 0, 1, 1, 2, 2, 3, 3};
+    int16x8_t mixMid, mixInput;
+    const int16x8_t adder = vdupq_n_s16(4);
+    int i;
+
+    assert(overlapLength == (1 << shift));
+
+    // weights of the mid buffer & input for stereo frames 0..3
+    mixMid = vld1q_s16(initMid);
+    mixInput = vld1q_s16(initInput);
+
+    for (i = 0; i < 2 * overlapLength; i += 8)
+    {
+        const int16x8_t vMid = vld1q_s16(pMidBuffer + i);
+        const int16x8_t vInput = vld1q_s16(input + i);
+        int32x4_t lo, hi;
+
+        lo = vmull_s16(vget_low_s16(vMid), vget_low_s16(mixMid));
+        lo = vmlal_s16(lo, vget_low_s16(vInput), vget_low_s16(mixInput));
+        hi = vmull_s16(vget_high_s16(vMid), vget_high_s16(mixMid));
+        hi = vmlal_s16(hi, vget_high_s16(vInput), vget_high_s16(mixInput));
+
+        // divide by overlap length rounding towards zero, like the plain C version
+        lo = vaddq_s32(lo, vandq_s32(vshrq_n_s32(lo, 31), rounding));
+        hi = vaddq_s32(hi, vandq_s32(vshrq_n_s32(hi, 31), rounding));
+        lo = vshlq_s32(lo, shifter);
+        hi = vshlq_s32(hi, shifter);
+        vst1q_s16(output + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+
+        mixMid = vsubq_s16(mixMid, adder);
+        mixInput = vaddq_s16(mixInput, adder);
+    }
+}
+
+#endif  // SOUNDTOUCH_FLOAT_SAMPLES
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of NEON optimized functions of class 'FIRFilterNEON'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "FIRFilter.h"
+
+FIRFilterNEON::FIRFilterNEON() : FIRFilter()
+{
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    filterCoeffsScaled = NULL;
+#endif
+}
+
+
+FIRFilterNEON::~FIRFilterNEON()
+{
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    alignedFree(filterCoeffsScaled);
+#endif
+}
+
+
+// (overloaded) Calculates filter coefficients for NEON routine
+void FIRFilterNEON::setCoefficients(const SAMPLETYPE *coeffs, uint newLength, uint uResultDivFactor)
+{
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    bool resize = (filterCoeffsScaled == NULL) || (newLength != length);
+#endif
+
+    FIRFilter::setCoefficients(coeffs, newLength, uResultDivFactor);
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+    // Scale the filter coefficients so that it won't be necessary to scale the filtering result
+    float fDivider = (float)resultDivider;
+
+    if (resize)
+    {
+        alignedFree(filterCoeffsScaled);
+        filterCoeffsScaled = (float *)alignedAlloc(newLength * sizeof(float));
+    }
+    for (uint i = 0; i < newLength; i ++)
+    {
+        filterCoeffsScaled[i] = coeffs[i] / fDivider;
+    }
+#endif
+}
+
+
+uint FIRFilterNEON::evaluateFilterStereo(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const
+{
+    return evaluateFilterNEON(dest, src, numSamples, 2);
+}
+
+
+uint FIRFilterNEON::evaluateFilterMono(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples) const
+{
+    return evaluateFilterNEON(dest, src, numSamples, 1);
+}
+
+
+uint FIRFilterNEON::evaluateFilterMulti(SAMPLETYPE *dest, const SAMPLETYPE *src, uint numSamples, uint numChannels)
+{
+    return evaluateFilterNEON(dest, src, numSamples, numChannels);
+}
+
+
+#ifdef SOUNDTOUCH_FLOAT_SAMPLES
+
+// NEON-optimized filter routine for any number of channels. Output value 'dest[m]' 
+// is the sum of 'src[m + i * numChannels] * coefficient[i]' over the filter taps,
+// as in FIRFilterAVX2.
+uint FIRFilterNEON::evaluateFilterNEON(float *dest, const float *src, uint numSamples, uint numChannels) const
+{
+    const int count = (int)((numSamples - length) * numChannels);
+    const int stride = (int)numChannels;
+    const int blocks = count / 16;
+    int b, m;
+
+    assert(src != NULL);
+    assert(dest != NULL);
+    assert(filterCoeffsScaled != NULL);
+
+    // 16 output values per round, in four sums
+    #pragma omp parallel for
+    for (b = 0; b < blocks; b ++)
+    {
+        const float *pSrc = src + 16 * b;
+        float *pDest = dest + 16 * b;
+        float32x4_t sum0, sum1, sum2, sum3;
+        uint i;
+
+        sum0 = sum1 = sum2 = sum3 = vdupq_n_f32(0);
+
+        for (i = 0; i < length; i ++)
+        {
+            const float32x4_t coeff = vdupq_n_f32(filterCoeffsScaled[i]);
+
+            sum0 = ST_VMLA(sum0, vld1q_f32(pSrc),      coeff);
+            sum1 = ST_VMLA(sum1, vld1q_f32(pSrc + 4),  coeff);
+            sum2 = ST_VMLA(sum2, vld1q_f32(pSrc + 8),  coeff);
+            sum3 = ST_VMLA(sum3, vld1q_f32(pSrc + 12), coeff);
+            pSrc += stride;
+        }
+
+        vst1q_f32(pDest,      sum0);
+        vst1q_f32(pDest + 4,  sum1);
+        vst1q_f32(pDest + 8,  sum2);
+        vst1q_f32(pDest + 12, sum3);
+    }
+
+    // remaining values
+    for (m = 16 * blocks; m < count; m ++)
+    {
+        float sum = 0;
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum += src[m + i * stride] * filterCoeffsScaled[i];
+        }
+        dest[m] = sum;
+    }
+
+    return numSamples - length;
+}
+
+#else // SOUNDTOUCH_FLOAT_SAMPLES
+
+// NEON-optimized filter routine for any number of channels, see the float 
+// version above. Products are accumulated to 32-bit sums with widening 
+// multiply-adds.
+uint FIRFilterNEON::evaluateFilterNEON(short *dest, const short *src, uint numSamples, uint numChannels) const
+{
+    const int count = (int)((numSamples - length) * numChannels);
+    const int stride = (int)numChannels;
+    const int blocks = count / 8;
+    const int32x4_t shift = vdupq_n_s32(-(int)resultDivFactor);  // negative => shift right
+    int b, m;
+
+    assert(src != NULL);
+    assert(dest != NULL);
+    assert(filterCoeffs != NULL);
+
+    // 8 output values per round
+    #pragma omp parallel for
+    for (b = 0; b < blocks; b ++)
+    {
+        const short *pSrc = src + 8 * b;
+        int32x4_t sumLo, sumHi;
+        uint i;
+
+        sumLo = sumHi = vdupq_n_s32(0);
+
+        for (i = 0; i < length; i ++)
+        {
+            const int16x8_t values = vld1q_s16(pSrc);
+
+            sumLo = vmlal_n_s16(sumLo, vget_low_s16(values), filterCoeffs[i]);
+            sumHi = vmlal_n_s16(sumHi, vget_high_s16(values), filterCoeffs[i]);
+            pSrc += stride;
+        }
+
+        // scale, saturate to 16 bit integer limits & store
+        sumLo = vshlq_s32(sumLo, shift);
+        sumHi = vshlq_s32(sumHi, shift);
+        vst1q_s16(dest + 8 * b, vcombine_s16(vqmovn_s32(sumLo), vqmovn_s32(sumHi)));
+    }
+
+    // remaining values one at a time, as in the plain C version
+    for (m = 8 * blocks; m < count; m ++)
+    {
+        LONG_SAMPLETYPE sum = 0;
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum += src[m + i * stride] * filterCoeffs[i];
+        }
+        sum >>= resultDivFactor;
+        // saturate to 16 bit integer limits
+        sum = (sum < -32768) ? -32768 : (sum > 32767) ? 32767 : sum;
+        dest[m] = (short)sum;
+    }
+
+    return numSamples - length;
+}
+
+#endif // SOUNDTOUCH_FLOAT_SAMPLES
+
+#endif  // SOUNDTOUCH_ALLOW_NEON
@@ -196,15 +196,13 @@ double TDStretchSSE::calcCrossCorrAccumulate(const float *pV1, const float *pV2,
 FIRFilterSSE::FIRFilterSSE() : FIRFilter()
 {
     filterCoeffsAlign = NULL;
-    filterCoeffsUnalign = NULL;
 }
 
 
 FIRFilterSSE::~FIRFilterSSE()
 {
-    delete[] filterCoeffsUnalign;
+    alignedFree(filterCoeffsAlign);
     filterCoeffsAlign = NULL;
-    filterCoeffsUnalign = NULL;
 }
 
 
@@ -213,15 +211,17 @@ void FIRFilterSSE::setCoefficients(const float *coeffs, uint newLength, uint uRe
 {
     uint i;
     float fDivider;
+    bool resize = (filterCoeffsAlign == NULL) || (newLength != length);
 
     FIRFilter::setCoefficients(coeffs, newLength, uResultDivFactor);
 
     // Scale the filter coefficients so that it won't be necessary to scale the filtering result
     // also rearrange coefficients suitably for SSE
-    // Ensure that filter coeffs array is aligned to 16-byte boundary
-    delete[] filterCoeffsUnalign;
-    filterCoeffsUnalign = new float[2 * newLength + 4];
-    filterCoeffsAlign = (float *)SOUNDTOUCH_ALIGN_POINTER_16(filterCoeffsUnalign);
+    if (resize)
+    {
+        alignedFree(filterCoeffsAlign);
+        filterCoeffsAlign = (float *)alignedAlloc(2 * newLength * sizeof(float));
+    }
 
     fDivider = (float)resultDivider;
 
@@ -363,3 +363,299 @@ uint FIRFilterSSE::evaluateFilterStereo(float *dest, const float *source, uint n
 }
 
 #endif  // SOUNDTOUCH_ALLOW_SSE
+
+
+#ifdef SOUNDTOUCH_ALLOW_SSE2
+
+// SSE2 routines available only with integer sample type. These replace the MMX
+// routines, doing twice the work per instruction, and are also available in 
+// X64 mode where MMX isn't.
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of SSE2 optimized functions of class 'TDStretchSSE2'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TDStretch.h"
+#include <emmintrin.h>
+#include <math.h>
+#include <assert.h>
+
+// Returns vSum[0] + vSum[1] + vSum[2] + vSum[3], summed in 64 bits
+static inline SOUNDTOUCH_TARGET_SSE2 long horizontalSum32(__m128i vSum)
+{
+    int values[4];
+
+    _mm_storeu_si128((__m128i *)values, vSum);
+    return (long)values[0] + values[1] + values[2] + values[3];
+}
+
+
+// Calculates cross correlation of two buffers. Like in the plain C version, 
+// each product pair is scaled down by 'overlapDividerBitsNorm' bits before 
+// summing, which 'pmaddwd' & 'psrad' do for 4 pairs at a time.
+double TDStretchSSE2::calcCrossCorr(const short *pV1, const short *pV2, double &dnorm)
+{
+    const __m128i shifter = _mm_cvtsi32_si128(overlapDividerBitsNorm);
+    __m128i accu, normaccu;
+    long corr;
+    unsigned long lnorm;
+    int i;
+
+    // overlap length is a power of 2, at least 16
+    assert((channels * overlapLength) % 16 == 0);
+
+    accu = normaccu = _mm_setzero_si128();
+
+    // Process 16 samples per round
+    for (i = 0; i < channels * overlapLength; i += 16)
+    {
+        const __m128i v1a = _mm_loadu_si128((const __m128i *)(pV1 + i));
+        const __m128i v1b = _mm_loadu_si128((const __m128i *)(pV1 + i + 8));
+        const __m128i v2a = _mm_loadu_si128((const __m128i *)(pV2 + i));
+        const __m128i v2b = _mm_loadu_si128((const __m128i *)(pV2 + i + 8));
+
+        accu = _mm_add_epi32(accu, _mm_add_epi32(_mm_sra_epi32(_mm_madd_epi16(v1a, v2a), shifter),
+                                                 _mm_sra_epi32(_mm_madd_epi16(v1b, v2b), shifter)));
+        normaccu = _mm_add_epi32(normaccu, _mm_add_epi32(_mm_sra_epi32(_mm_madd_epi16(v1a, v1a), shifter),
+                                                         _mm_sra_epi32(_mm_madd_epi16(v1b, v1b), shifter)));
+    }
+
+    corr = horizontalSum32(accu);
+    lnorm = (unsigned long)horizontalSum32(normaccu);
+
+    if (lnorm > maxnorm)
+    {
+        // modify 'maxnorm' inside critical section to avoid multi-access conflict if in OpenMP mode
+        #pragma omp critical
+        if (lnorm > maxnorm)
+        {
+            maxnorm = lnorm;
+        }
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    dnorm = (double)lnorm;
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+/// Update cross-correlation by accumulating "norm" coefficient by previously calculated value
+double TDStretchSSE2::calcCrossCorrAccumulate(const short *pV1, const short *pV2, double &dnorm)
+{
+    const __m128i shifter = _mm_cvtsi32_si128(overlapDividerBitsNorm);
+    const int count = channels * overlapLength;
+    __m128i accu;
+    long corr, lnorm;
+    int i;
+
+    // cancel first normalizer tap from previous round, and add last samples 
+    // of this round
+    lnorm = 0;
+    for (i = 1; i <= channels; i ++)
+    {
+        lnorm -= (pV1[-i] * pV1[-i]) >> overlapDividerBitsNorm;
+        lnorm += (pV1[count - i] * pV1[count - i]) >> overlapDividerBitsNorm;
+    }
+
+    accu = _mm_setzero_si128();
+
+    for (i = 0; i < count; i += 16)
+    {
+        accu = _mm_add_epi32(accu, _mm_sra_epi32(_mm_madd_epi16(
+                    _mm_loadu_si128((const __m128i *)(pV1 + i)), 
+                    _mm_loadu_si128((const __m128i *)(pV2 + i))), shifter));
+        accu = _mm_add_epi32(accu, _mm_sra_epi32(_mm_madd_epi16(
+                    _mm_loadu_si128((const __m128i *)(pV1 + i + 8)), 
+                    _mm_loadu_si128((const __m128i *)(pV2 + i + 8))), shifter));
+    }
+    corr = horizontalSum32(accu);
+
+    dnorm += (double)lnorm;
+    if (dnorm > maxnorm)
+    {
+        maxnorm = (unsigned long)dnorm;
+    }
+
+    // Normalize result by dividing by sqrt(norm) - this step is easiest 
+    // done using floating point operation
+    return (double)corr / sqrt((dnorm < 1e-9) ? 1.0 : dnorm);
+}
+
+
+// Divides 32-bit values by 2^shift, rounding towards zero like the integer 
+// division in the plain C version
+static inline SOUNDTOUCH_TARGET_SSE2 __m128i divideTowardsZero(__m128i value, int shift)
+{
+    const __m128i bias = _mm_and_si128(_mm_srai_epi32(value, 31), _mm_set1_epi32((1 << shift) - 1));
+    return _mm_sra_epi32(_mm_add_epi32(value, bias), _mm_cvtsi32_si128(shift));
+}
+
+
+// SSE2-optimized version of the function overlapStereo. Input & mid buffer samples
+// are paired, so that 'pmaddwd' multiplies both with their weights and adds them.
+void TDStretchSSE2::overlapStereo(short *output, const short *input) const
+{
+    // overlap length is 2^(overlapDividerBitsPure + 1)
+    const int shift = overlapDividerBitsPure + 1;
+    __m128i mix1, mix2, adder;
+    int i;
+
+    assert(overlapLength == (1 << shift));
+
+    // weights of mid buffer & input for stereo frames 0 & 1, and 2 & 3
+    mix1  = _mm_set_epi16(1, (short)(overlapLength - 1), 1, (short)(overlapLength - 1), 
+                          0, (short)overlapLength, 0, (short)overlapLength);
+    mix2  = _mm_add_epi16(mix1, _mm_set_epi16(2, -2, 2, -2, 2, -2, 2, -2));
+    adder = _mm_set_epi16(4, -4, 4, -4, 4, -4, 4, -4);
+
+    for (i = 0; i < 2 * overlapLength; i += 8)
+    {
+        const __m128i vMid = _mm_loadu_si128((const __m128i *)(pMidBuffer + i));
+        const __m128i vInput = _mm_loadu_si128((const __m128i *)(input + i));
+        __m128i temp1, temp2;
+
+        // pair the samples as m0l i0l m0r i0r m1l i1l m1r i1r, and then 2 & 3
+        temp1 = _mm_madd_epi16(_mm_unpacklo_epi16(vMid, vInput), mix1);
+        temp2 = _mm_madd_epi16(_mm_unpackhi_epi16(vMid, vInput), mix2);
+
+        temp1 = divideTowardsZero(temp1, shift);
+        temp2 = divideTowardsZero(temp2, shift);
+        _mm_storeu_si128((__m128i *)(output + i), _mm_packs_epi32(temp1, temp2));
+
+        mix1 = _mm_add_epi16(mix1, adder);
+        mix2 = _mm_add_epi16(mix2, adder);
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of SSE2 optimized functions of class 'FIRFilterSSE2'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "FIRFilter.h"
+
+FIRFilterSSE2::FIRFilterSSE2() : FIRFilter()
+{
+    filterCoeffsPaired = NULL;
+}
+
+
+FIRFilterSSE2::~FIRFilterSSE2()
+{
+    alignedFree(filterCoeffsPaired);
+}
+
+
+// (overloaded) Calculates filter coefficients for SSE2 routine
+void FIRFilterSSE2::setCoefficients(const short *coeffs, uint newLength, uint uResultDivFactor)
+{
+    uint i;
+    bool resize = (filterCoeffsPaired == NULL) || (newLength != length);
+
+    FIRFilter::setCoefficients(coeffs, newLength, uResultDivFactor);
+
+    // Pack coefficient pairs like consecutive shorts in memory, the first one 
+    // in the low half
+    if (resize)
+    {
+        alignedFree(filterCoeffsPaired);
+        filterCoeffsPaired = (int *)alignedAlloc(newLength / 2 * sizeof(int));
+    }
+    for (i = 0; i < newLength / 2; i ++)
+    {
+        filterCoeffsPaired[i] = (int)(((uint)(unsigned short)coeffs[2 * i + 1] << 16) | 
+                                      (unsigned short)coeffs[2 * i]);
+    }
+}
+
+
+uint FIRFilterSSE2::evaluateFilterStereo(short *dest, const short *src, uint numSamples) const
+{
+    return evaluateFilterSSE2(dest, src, numSamples, 2);
+}
+
+
+uint FIRFilterSSE2::evaluateFilterMono(short *dest, const short *src, uint numSamples) const
+{
+    return evaluateFilterSSE2(dest, src, numSamples, 1);
+}
+
+
+uint FIRFilterSSE2::evaluateFilterMulti(short *dest, const short *src, uint numSamples, uint numChannels)
+{
+    return evaluateFilterSSE2(dest, src, numSamples, numChannels);
+}
+
+
+// SSE2-optimized filter routine for any number of channels, like the AVX2 one. 
+// Values of two taps at a time are interleaved, so that 'pmaddwd' multiplies 
+// them with the coefficient pair and adds the products to 32-bit sums.
+uint FIRFilterSSE2::evaluateFilterSSE2(short *dest, const short *src, uint numSamples, uint numChannels) const
+{
+    const int count = (int)((numSamples - length) * numChannels);
+    const int stride = (int)numChannels;
+    const int blocks = count / 16;
+    const __m128i shift = _mm_cvtsi32_si128((int)resultDivFactor);
+    int b, m;
+
+    assert(src != NULL);
+    assert(dest != NULL);
+    assert(filterCoeffsPaired != NULL);
+
+    // 16 output values per round
+    #pragma omp parallel for
+    for (b = 0; b < blocks; b ++)
+    {
+        const short *pSrc = src + 16 * b;
+        short *pDest = dest + 16 * b;
+        __m128i sum0, sum1, sum2, sum3;
+        uint i;
+
+        sum0 = sum1 = sum2 = sum3 = _mm_setzero_si128();
+
+        for (i = 0; i < length / 2; i ++)
+        {
+            const __m128i coeff = _mm_set1_epi32(filterCoeffsPaired[i]);
+            const __m128i a0 = _mm_loadu_si128((const __m128i *)pSrc);
+            const __m128i b0 = _mm_loadu_si128((const __m128i *)(pSrc + stride));
+            const __m128i a1 = _mm_loadu_si128((const __m128i *)(pSrc + 8));
+            const __m128i b1 = _mm_loadu_si128((const __m128i *)(pSrc + stride + 8));
+
+            sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(a0, b0), coeff));
+            sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(a0, b0), coeff));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi16(a1, b1), coeff));
+            sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi16(a1, b1), coeff));
+            pSrc += 2 * stride;
+        }
+
+        // scale, saturate to 16 bit integer limits & store
+        _mm_storeu_si128((__m128i *)pDest, 
+            _mm_packs_epi32(_mm_sra_epi32(sum0, shift), _mm_sra_epi32(sum1, shift)));
+        _mm_storeu_si128((__m128i *)(pDest + 8), 
+            _mm_packs_epi32(_mm_sra_epi32(sum2, shift), _mm_sra_epi32(sum3, shift)));
+    }
+
+    // remaining values one at a time, as in the plain C version
+    for (m = 16 * blocks; m < count; m ++)
+    {
+        LONG_SAMPLETYPE sum = 0;
+
+        for (uint i = 0; i < length; i ++)
+        {
+            sum += src[m + i * stride] * filterCoeffs[i];
+        }
+        sum >>= resultDivFactor;
+        // saturate to 16 bit integer limits
+        sum = (sum < -32768) ? -32768 : (sum > 32767) ? 32767 : sum;
+        dest[m] = (short)sum;
+    }
+
+    return numSamples - length;
+}
+
+#endif  // SOUNDTOUCH_ALLOW_SSE2
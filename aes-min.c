@@ -13,6 +13,34 @@
 
 #include <string.h>
 
+/* AES-NI and ARMv8 crypto extension versions of the block functions are
+ * compiled in where the compiler supports them, and used when
+ * cpu_features() reports them. Define DISABLE_AES_HW to build only the
+ * byte-oriented code. */
+#ifndef DISABLE_AES_HW
+#include "cpu_features.h"
+#if (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)) && \
+    (defined(_MSC_VER) || (defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))))
+#define AES_HW_X86
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#define AES_HW_TARGET
+#define AES_HW_CLMUL_TARGET
+#else
+#define AES_HW_TARGET   __attribute__((target("aes,sse2")))
+#define AES_HW_CLMUL_TARGET __attribute__((target("pclmul,ssse3,sse2")))
+#endif
+#elif defined(_M_ARM64) || (defined(__aarch64__) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)))
+#define AES_HW_ARMV8
+#include <arm_neon.h>
+#endif
+#if defined(AES_HW_X86) || defined(AES_HW_ARMV8)
+#define AES_HW
+#endif
+#endif
+
 /*****************************************************************************
  * Defines
  ****************************************************************************/
@@ -25,6 +53,22 @@
 
 #define AES_INV_CHAIN_LEN               11u
 
+/* Number of blocks the hardware versions of the bulk modes keep in flight */
+#define AES_HW_PARALLEL_BLOCKS          8u
+
+/* Bits returned by aes_hw_features() */
+#define AES_HW_FEATURE_AES              1u
+#define AES_HW_FEATURE_CLMUL            2u
+
+#define aes_hw_available()              ((aes_hw_features() & AES_HW_FEATURE_AES) != 0u)
+
+/* GCM hashes this much data after encrypting it, or before decrypting it,
+ * so it is still in the cache for the second pass */
+#define AES_GCM_CHUNK_SIZE              4096u
+
+/* GCM length block and IV length for which the counter is simply iv || 1 */
+#define AES_GCM_IV_SIZE                 12u
+
 /*****************************************************************************
  * Look-up tables
  ****************************************************************************/
@@ -89,6 +133,18 @@ static void aes_shift_rows(uint8_t p_block[AES_BLOCK_SIZE]);
 static void aes_shift_rows_inv(uint8_t p_block[AES_BLOCK_SIZE]);
 static void aes_mix_columns(uint8_t p_block[AES_BLOCK_SIZE]);
 static void aes_mix_columns_inv(uint8_t p_block[AES_BLOCK_SIZE]);
+static void aes128_sw_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+static void aes128_sw_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+static void aes_ctr_add64(uint8_t p_counter[AES_BLOCK_SIZE], uint64_t n);
+static void aes_gcm_init_table(aes128_gcm_ctx_t * p_ctx);
+static void aes_gcm_ghash(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t num_blocks);
+static void aes_gcm_ctr(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks);
+static void aes_gcm_crypt_partial(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, int decrypt);
+static void aes_gcm_crypt(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, int decrypt);
+static int aes_gcm_check_tag(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+#ifdef AES_HW
+static unsigned int aes_hw_features(void);
+#endif
 
 /*****************************************************************************
  * Inline functions
@@ -170,6 +226,381 @@ static inline uint8_t aes_rotate_left_uint8(uint8_t a, uint_fast8_t num_bits)
     return ((a << num_bits) | (a >> (8u - num_bits)));
 }
 
+/* Add one to a 16-byte big-endian counter block, as in NIST SP 800-38A. */
+static inline void aes_ctr_increment(uint8_t p_counter[AES_BLOCK_SIZE])
+{
+    uint_fast8_t    i = AES_BLOCK_SIZE;
+
+    while (i-- > 0u && ++p_counter[i] == 0u)
+    {
+    }
+}
+
+static inline uint32_t aes_load_be32(const uint8_t p_bytes[4])
+{
+    return ((uint32_t)p_bytes[0] << 24u) | ((uint32_t)p_bytes[1] << 16u) | ((uint32_t)p_bytes[2] << 8u) | p_bytes[3];
+}
+
+static inline uint64_t aes_load_be64(const uint8_t p_bytes[8])
+{
+    return ((uint64_t)aes_load_be32(p_bytes) << 32u) | aes_load_be32(p_bytes + 4u);
+}
+
+static inline void aes_store_be64(uint8_t p_bytes[8], uint64_t value)
+{
+    uint_fast8_t    i;
+
+    for (i = 8u; i-- > 0u; value >>= 8u)
+    {
+        p_bytes[i] = (uint8_t)value;
+    }
+}
+
+/* Add one to the last 32 bits of a GCM counter block, ignoring any carry. */
+static inline void aes_gcm_increment(uint8_t p_counter[AES_BLOCK_SIZE])
+{
+    uint_fast8_t    i = AES_BLOCK_SIZE;
+
+    while (i-- > AES_BLOCK_SIZE - 4u && ++p_counter[i] == 0u)
+    {
+    }
+}
+
+/* Add n to a 16-byte big-endian counter block. */
+static inline void aes_ctr_add(uint8_t p_counter[AES_BLOCK_SIZE], uint_fast8_t n)
+{
+    uint_fast8_t    i = AES_BLOCK_SIZE - 1u;
+    uint_fast16_t   sum = p_counter[i] + n;
+
+    p_counter[i] = (uint8_t)sum;
+    if (sum > 0xFFu)
+    {
+        while (i-- > 0u && ++p_counter[i] == 0u)
+        {
+        }
+    }
+}
+
+/*****************************************************************************
+ * Hardware implementations
+ ****************************************************************************/
+
+#ifdef AES_HW_X86
+
+static unsigned int aes_hw_detect(void)
+{
+    unsigned int    cpu = cpu_features();
+    unsigned int    features = 0;
+
+    if ((cpu & CPU_FEATURE_SSE2) == 0u)     /* for everything */
+        return 0;
+    if (cpu & CPU_FEATURE_AES)
+        features |= AES_HW_FEATURE_AES;
+    if ((cpu & CPU_FEATURE_PCLMUL) && (cpu & CPU_FEATURE_SSSE3))
+        features |= AES_HW_FEATURE_CLMUL;
+    return features;
+}
+
+/* GHASH with carry-less multiplication, as in Intel's white paper "Intel
+ * Carry-Less Multiplication Instruction and its Usage for Computing the GCM
+ * Mode". p_x is the running hash, which becomes (p_x ^ block) * H for each
+ * block of p_data in turn. */
+AES_HW_CLMUL_TARGET
+static void aes_hw_ghash(uint8_t p_x[AES_BLOCK_SIZE], const uint8_t p_h[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks)
+{
+    const __m128i   reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i         h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p_h), reverse);
+    __m128i         x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p_x), reverse);
+    __m128i         lo, mid, hi, t, carry_lo, carry_hi, carry;
+
+    for ( ; num_blocks > 0u; --num_blocks, p_data += AES_BLOCK_SIZE)
+    {
+        x = _mm_xor_si128(x, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p_data), reverse));
+
+        /* 256-bit product */
+        lo = _mm_clmulepi64_si128(x, h, 0x00);
+        mid = _mm_xor_si128(_mm_clmulepi64_si128(x, h, 0x10), _mm_clmulepi64_si128(x, h, 0x01));
+        hi = _mm_clmulepi64_si128(x, h, 0x11);
+        lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+        hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+        /* Shift left by one, as the operands are bit-reflected */
+        carry_lo = _mm_srli_epi32(lo, 31);
+        carry_hi = _mm_srli_epi32(hi, 31);
+        lo = _mm_slli_epi32(lo, 1);
+        hi = _mm_slli_epi32(hi, 1);
+        carry = _mm_srli_si128(carry_lo, 12);
+        carry_hi = _mm_slli_si128(carry_hi, 4);
+        carry_lo = _mm_slli_si128(carry_lo, 4);
+        lo = _mm_or_si128(lo, carry_lo);
+        hi = _mm_or_si128(hi, _mm_or_si128(carry_hi, carry));
+
+        /* Reduce modulo x^128 + x^7 + x^2 + x + 1 */
+        t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+        carry = _mm_srli_si128(t, 4);
+        lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+        t = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+        lo = _mm_xor_si128(lo, _mm_xor_si128(t, carry));
+        x = _mm_xor_si128(hi, lo);
+    }
+    _mm_storeu_si128((__m128i *)p_x, _mm_shuffle_epi8(x, reverse));
+}
+
+AES_HW_TARGET
+static inline void aes_hw_load_keys(__m128i p_keys[AES128_NUM_ROUNDS + 1u], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    for (round = 0; round <= AES128_NUM_ROUNDS; ++round)
+    {
+        p_keys[round] = _mm_loadu_si128((const __m128i *)&p_key_schedule[round * AES_BLOCK_SIZE]);
+    }
+}
+
+/* Round keys for the equivalent inverse cipher, which AESDEC implements:
+ * the encryption keys in reverse order, with InvMixColumns applied to all
+ * but the first and last. */
+AES_HW_TARGET
+static inline void aes_hw_load_decrypt_keys(__m128i p_keys[AES128_NUM_ROUNDS + 1u], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    p_keys[0] = _mm_loadu_si128((const __m128i *)&p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    {
+        p_keys[round] = _mm_aesimc_si128(_mm_loadu_si128((const __m128i *)&p_key_schedule[(AES128_NUM_ROUNDS - round) * AES_BLOCK_SIZE]));
+    }
+    p_keys[AES128_NUM_ROUNDS] = _mm_loadu_si128((const __m128i *)p_key_schedule);
+}
+
+/* Encrypt or decrypt num_blocks (at most AES_HW_PARALLEL_BLOCKS) independent
+ * blocks together, so that each round of one block overlaps the others. */
+AES_HW_TARGET
+static inline void aes_hw_encrypt_blocks(__m128i *p_blocks, uint_fast8_t num_blocks, const __m128i p_keys[AES128_NUM_ROUNDS + 1u])
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = _mm_xor_si128(p_blocks[i], p_keys[0]);
+    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    {
+        for (i = 0; i < num_blocks; ++i)
+            p_blocks[i] = _mm_aesenc_si128(p_blocks[i], p_keys[round]);
+    }
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = _mm_aesenclast_si128(p_blocks[i], p_keys[AES128_NUM_ROUNDS]);
+}
+
+AES_HW_TARGET
+static inline void aes_hw_decrypt_blocks(__m128i *p_blocks, uint_fast8_t num_blocks, const __m128i p_keys[AES128_NUM_ROUNDS + 1u])
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = _mm_xor_si128(p_blocks[i], p_keys[0]);
+    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    {
+        for (i = 0; i < num_blocks; ++i)
+            p_blocks[i] = _mm_aesdec_si128(p_blocks[i], p_keys[round]);
+    }
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = _mm_aesdeclast_si128(p_blocks[i], p_keys[AES128_NUM_ROUNDS]);
+}
+
+#define aes_hw_block_t          __m128i
+#define aes_hw_load(p)          _mm_loadu_si128((const __m128i *)(p))
+#define aes_hw_store(p, v)      _mm_storeu_si128((__m128i *)(p), (v))
+#define aes_hw_xor(a, b)        _mm_xor_si128((a), (b))
+#define aes_hw_add_bytes(a, b)  _mm_add_epi8((a), (b))
+
+#endif /* AES_HW_X86 */
+
+#ifdef AES_HW_ARMV8
+
+static unsigned int aes_hw_detect(void)
+{
+    return (cpu_features() & CPU_FEATURE_AES) ? AES_HW_FEATURE_AES : 0u;
+}
+
+static inline void aes_hw_load_keys(uint8x16_t p_keys[AES128_NUM_ROUNDS + 1u], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    for (round = 0; round <= AES128_NUM_ROUNDS; ++round)
+    {
+        p_keys[round] = vld1q_u8(&p_key_schedule[round * AES_BLOCK_SIZE]);
+    }
+}
+
+/* Round keys for the equivalent inverse cipher, as for AES-NI. AESD adds the
+ * round key before its InvShiftRows and InvSubBytes, and InvMixColumns is a
+ * separate AESIMC, so the key for each middle round needs InvMixColumns
+ * applied to it in the same way. */
+static inline void aes_hw_load_decrypt_keys(uint8x16_t p_keys[AES128_NUM_ROUNDS + 1u], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    p_keys[0] = vld1q_u8(&p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    {
+        p_keys[round] = vaesimcq_u8(vld1q_u8(&p_key_schedule[(AES128_NUM_ROUNDS - round) * AES_BLOCK_SIZE]));
+    }
+    p_keys[AES128_NUM_ROUNDS] = vld1q_u8(p_key_schedule);
+}
+
+/* AESE and AESMC are fused by most cores when they are adjacent, so each
+ * round is done for all blocks before moving on to the next. */
+static inline void aes_hw_encrypt_blocks(uint8x16_t *p_blocks, uint_fast8_t num_blocks, const uint8x16_t p_keys[AES128_NUM_ROUNDS + 1u])
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+
+    for (round = 0; round < AES128_NUM_ROUNDS - 1u; ++round)
+    {
+        for (i = 0; i < num_blocks; ++i)
+            p_blocks[i] = vaesmcq_u8(vaeseq_u8(p_blocks[i], p_keys[round]));
+    }
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = veorq_u8(vaeseq_u8(p_blocks[i], p_keys[AES128_NUM_ROUNDS - 1u]), p_keys[AES128_NUM_ROUNDS]);
+}
+
+static inline void aes_hw_decrypt_blocks(uint8x16_t *p_blocks, uint_fast8_t num_blocks, const uint8x16_t p_keys[AES128_NUM_ROUNDS + 1u])
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+
+    for (round = 0; round < AES128_NUM_ROUNDS - 1u; ++round)
+    {
+        for (i = 0; i < num_blocks; ++i)
+            p_blocks[i] = vaesimcq_u8(vaesdq_u8(p_blocks[i], p_keys[round]));
+    }
+    for (i = 0; i < num_blocks; ++i)
+        p_blocks[i] = veorq_u8(vaesdq_u8(p_blocks[i], p_keys[AES128_NUM_ROUNDS - 1u]), p_keys[AES128_NUM_ROUNDS]);
+}
+
+#define AES_HW_TARGET
+#define aes_hw_block_t          uint8x16_t
+#define aes_hw_load(p)          vld1q_u8((const uint8_t *)(p))
+#define aes_hw_store(p, v)      vst1q_u8((uint8_t *)(p), (v))
+#define aes_hw_xor(a, b)        veorq_u8((a), (b))
+#define aes_hw_add_bytes(a, b)  vaddq_u8((a), (b))
+
+#endif /* AES_HW_ARMV8 */
+
+#ifdef AES_HW
+
+AES_HW_TARGET
+static void aes128_hw_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_hw_block_t  keys[AES128_NUM_ROUNDS + 1u];
+    aes_hw_block_t  block;
+
+    aes_hw_load_keys(keys, p_key_schedule);
+    block = aes_hw_load(p_block);
+    aes_hw_encrypt_blocks(&block, 1u, keys);
+    aes_hw_store(p_block, block);
+}
+
+AES_HW_TARGET
+static void aes128_hw_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_hw_block_t  keys[AES128_NUM_ROUNDS + 1u];
+    aes_hw_block_t  block;
+
+    aes_hw_load_decrypt_keys(keys, p_key_schedule);
+    block = aes_hw_load(p_block);
+    aes_hw_decrypt_blocks(&block, 1u, keys);
+    aes_hw_store(p_block, block);
+}
+
+/* Whole blocks only; the caller deals with any partial block at the end. */
+AES_HW_TARGET
+static void aes128_hw_ctr_crypt(uint8_t *p_data, size_t num_blocks, uint8_t p_counter[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    /* Added to the last byte of the counter when that can't carry */
+    static const uint8_t counter_steps[AES_HW_PARALLEL_BLOCKS][AES_BLOCK_SIZE] =
+    {
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7 },
+    };
+    aes_hw_block_t  keys[AES128_NUM_ROUNDS + 1u];
+    aes_hw_block_t  blocks[AES_HW_PARALLEL_BLOCKS];
+    aes_hw_block_t  counter;
+    uint_fast8_t    n;
+    uint_fast8_t    i;
+
+    aes_hw_load_keys(keys, p_key_schedule);
+    while (num_blocks > 0u)
+    {
+        n = (num_blocks < AES_HW_PARALLEL_BLOCKS) ? (uint_fast8_t)num_blocks : AES_HW_PARALLEL_BLOCKS;
+        if (p_counter[AES_BLOCK_SIZE - 1u] <= 0x100u - n)
+        {
+            counter = aes_hw_load(p_counter);
+            for (i = 0; i < n; ++i)
+            {
+                blocks[i] = aes_hw_add_bytes(counter, aes_hw_load(counter_steps[i]));
+            }
+            aes_ctr_add(p_counter, n);
+        }
+        else
+        {
+            for (i = 0; i < n; ++i)
+            {
+                blocks[i] = aes_hw_load(p_counter);
+                aes_ctr_increment(p_counter);
+            }
+        }
+        aes_hw_encrypt_blocks(blocks, n, keys);
+        for (i = 0; i < n; ++i)
+        {
+            aes_hw_store(p_data, aes_hw_xor(blocks[i], aes_hw_load(p_data)));
+            p_data += AES_BLOCK_SIZE;
+        }
+        num_blocks -= n;
+    }
+}
+
+AES_HW_TARGET
+static void aes128_hw_cbc_decrypt(uint8_t *p_data, size_t num_blocks, uint8_t p_iv[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_hw_block_t  keys[AES128_NUM_ROUNDS + 1u];
+    aes_hw_block_t  blocks[AES_HW_PARALLEL_BLOCKS];
+    aes_hw_block_t  cipher[AES_HW_PARALLEL_BLOCKS];
+    aes_hw_block_t  prev;
+    uint_fast8_t    n;
+    uint_fast8_t    i;
+
+    aes_hw_load_decrypt_keys(keys, p_key_schedule);
+    prev = aes_hw_load(p_iv);
+    while (num_blocks > 0u)
+    {
+        n = (num_blocks < AES_HW_PARALLEL_BLOCKS) ? (uint_fast8_t)num_blocks : AES_HW_PARALLEL_BLOCKS;
+        for (i = 0; i < n; ++i)
+        {
+            cipher[i] = blocks[i] = aes_hw_load(p_data + i * AES_BLOCK_SIZE);
+        }
+        aes_hw_decrypt_blocks(blocks, n, keys);
+        for (i = 0; i < n; ++i)
+        {
+            aes_hw_store(p_data, aes_hw_xor(blocks[i], prev));
+            prev = cipher[i];
+            p_data += AES_BLOCK_SIZE;
+        }
+        num_blocks -= n;
+    }
+    aes_hw_store(p_iv, prev);
+}
+
+#endif /* AES_HW */
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -183,19 +614,14 @@ static inline uint8_t aes_rotate_left_uint8(uint8_t a, uint_fast8_t num_bits)
  */
 void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
 {
-    uint_fast8_t    round;
-
-    aes_block_xor(p_block, p_key_schedule);
-    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+#ifdef AES_HW
+    if (aes_hw_available())
     {
-        aes_sbox_apply_block(p_block);
-        aes_shift_rows(p_block);
-        aes_mix_columns(p_block);
-        aes_block_xor(p_block, &p_key_schedule[round * AES_BLOCK_SIZE]);
+        aes128_hw_encrypt(p_block, p_key_schedule);
+        return;
     }
-    aes_sbox_apply_block(p_block);
-    aes_shift_rows(p_block);
-    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+#endif
+    aes128_sw_encrypt(p_block, p_key_schedule);
 }
 
 /* AES-128 decryption.
@@ -207,19 +633,359 @@ void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedul
  */
 void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
 {
-    uint_fast8_t    round;
+#ifdef AES_HW
+    if (aes_hw_available())
+    {
+        aes128_hw_decrypt(p_block, p_key_schedule);
+        return;
+    }
+#endif
+    aes128_sw_decrypt(p_block, p_key_schedule);
+}
 
-    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
-    aes_shift_rows_inv(p_block);
-    aes_sbox_inv_apply_block(p_block);
-    for (round = AES128_NUM_ROUNDS - 1u; round >= 1; --round)
+/* AES-128 counter mode encryption or decryption, which are the same thing.
+ *
+ * p_data points to data_len bytes to encrypt or decrypt in-place.
+ * p_counter points to the 16-byte initial counter block, which is treated as
+ * a 128-bit big-endian number and incremented once per block. On exit it
+ * holds the counter for the next block, so a long stream can be processed in
+ * several calls, as long as every call but the last is for a multiple of 16
+ * bytes: a partial block at the end uses up a whole counter value.
+ * p_key_schedule points to a pre-calculated key schedule, which can be
+ * calculated by aes128_key_schedule().
+ */
+void aes128_ctr_crypt(uint8_t *p_data, size_t data_len, uint8_t p_counter[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint8_t         key_stream[AES_BLOCK_SIZE];
+    size_t          num_blocks = data_len / AES_BLOCK_SIZE;
+    uint_fast8_t    i;
+
+#ifdef AES_HW
+    if (aes_hw_available())
     {
-        aes_block_xor(p_block, &p_key_schedule[round * AES_BLOCK_SIZE]);
-        aes_mix_columns_inv(p_block);
-        aes_shift_rows_inv(p_block);
-        aes_sbox_inv_apply_block(p_block);
+        aes128_hw_ctr_crypt(p_data, num_blocks, p_counter, p_key_schedule);
+        p_data += num_blocks * AES_BLOCK_SIZE;
+        num_blocks = 0;
+    }
+#endif
+    for ( ; num_blocks > 0u; --num_blocks)
+    {
+        memcpy(key_stream, p_counter, AES_BLOCK_SIZE);
+        aes128_sw_encrypt(key_stream, p_key_schedule);
+        aes_block_xor(p_data, key_stream);
+        aes_ctr_increment(p_counter);
+        p_data += AES_BLOCK_SIZE;
+    }
+    data_len %= AES_BLOCK_SIZE;
+    if (data_len > 0u)
+    {
+        memcpy(key_stream, p_counter, AES_BLOCK_SIZE);
+        aes128_encrypt(key_stream, p_key_schedule);
+        for (i = 0; i < data_len; ++i)
+        {
+            p_data[i] ^= key_stream[i];
+        }
+        aes_ctr_increment(p_counter);
     }
-    aes_block_xor(p_block, p_key_schedule);
+}
+
+/* AES-128 CBC mode encryption.
+ *
+ * p_data points to num_blocks 16-byte blocks of plain data to encrypt
+ * in-place. Padding is up to the caller.
+ * p_iv points to the 16-byte initialisation vector. On exit it holds the last
+ * block of encrypted data, which is the IV to continue the chain with.
+ * p_key_schedule points to a pre-calculated key schedule, which can be
+ * calculated by aes128_key_schedule().
+ *
+ * Each block depends on the one before, so unlike decryption this can't
+ * process several blocks at once.
+ */
+void aes128_cbc_encrypt(uint8_t *p_data, size_t num_blocks, uint8_t p_iv[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    for ( ; num_blocks > 0u; --num_blocks)
+    {
+        aes_block_xor(p_data, p_iv);
+        aes128_encrypt(p_data, p_key_schedule);
+        memcpy(p_iv, p_data, AES_BLOCK_SIZE);
+        p_data += AES_BLOCK_SIZE;
+    }
+}
+
+/* AES-128 CBC mode decryption.
+ *
+ * p_data points to num_blocks 16-byte blocks of encrypted data to decrypt
+ * in-place.
+ * p_iv points to the 16-byte initialisation vector. On exit it holds the last
+ * block of encrypted data, which is the IV to continue the chain with.
+ * p_key_schedule points to a pre-calculated key schedule, which can be
+ * calculated by aes128_key_schedule().
+ */
+void aes128_cbc_decrypt(uint8_t *p_data, size_t num_blocks, uint8_t p_iv[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint8_t         cipher[AES_BLOCK_SIZE];
+
+#ifdef AES_HW
+    if (aes_hw_available())
+    {
+        aes128_hw_cbc_decrypt(p_data, num_blocks, p_iv, p_key_schedule);
+        return;
+    }
+#endif
+    for ( ; num_blocks > 0u; --num_blocks)
+    {
+        memcpy(cipher, p_data, AES_BLOCK_SIZE);
+        aes128_sw_decrypt(p_data, p_key_schedule);
+        aes_block_xor(p_data, p_iv);
+        memcpy(p_iv, cipher, AES_BLOCK_SIZE);
+        p_data += AES_BLOCK_SIZE;
+    }
+}
+
+/* Start a CTR mode stream.
+ *
+ * p_key points to the 16-byte AES-128 key, and p_iv to the 16-byte counter
+ * block for the first block of the stream.
+ */
+void aes128_ctr_init(aes128_ctr_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t p_iv[AES_BLOCK_SIZE])
+{
+    aes128_key_schedule(p_ctx->key_schedule, p_key);
+    memcpy(p_ctx->iv, p_iv, AES_BLOCK_SIZE);
+    memcpy(p_ctx->counter, p_iv, AES_BLOCK_SIZE);
+    p_ctx->key_stream_pos = AES_BLOCK_SIZE;
+}
+
+/* Encrypt or decrypt the next data_len bytes of a CTR mode stream in-place.
+ * The data can be split between calls at any point.
+ */
+void aes128_ctr_update(aes128_ctr_ctx_t * p_ctx, uint8_t * p_data, size_t data_len)
+{
+    size_t          whole_len;
+
+    /* Use up the key stream left from a partial block last time */
+    for ( ; data_len > 0u && p_ctx->key_stream_pos < AES_BLOCK_SIZE; --data_len)
+    {
+        *p_data++ ^= p_ctx->key_stream[p_ctx->key_stream_pos++];
+    }
+
+    whole_len = data_len - data_len % AES_BLOCK_SIZE;
+    aes128_ctr_crypt(p_data, whole_len, p_ctx->counter, p_ctx->key_schedule);
+    p_data += whole_len;
+    data_len -= whole_len;
+
+    if (data_len > 0u)
+    {
+        memcpy(p_ctx->key_stream, p_ctx->counter, AES_BLOCK_SIZE);
+        aes128_encrypt(p_ctx->key_stream, p_ctx->key_schedule);
+        aes_ctr_increment(p_ctx->counter);
+        for (p_ctx->key_stream_pos = 0; p_ctx->key_stream_pos < data_len; ++p_ctx->key_stream_pos)
+        {
+            p_data[p_ctx->key_stream_pos] ^= p_ctx->key_stream[p_ctx->key_stream_pos];
+        }
+    }
+}
+
+/* Encrypt or decrypt data_len bytes in-place, which are at byte offset of
+ * the CTR mode stream started by aes128_ctr_init().
+ *
+ * This doesn't change p_ctx, only reads the key and IV from it, so several
+ * threads can work on disjoint parts of one stream (of a memory-mapped file,
+ * say) at the same time. It is independent of aes128_ctr_update().
+ */
+void aes128_ctr_update_range(const aes128_ctr_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, uint64_t offset)
+{
+    uint8_t         counter[AES_BLOCK_SIZE];
+    uint8_t         key_stream[AES_BLOCK_SIZE];
+    uint_fast8_t    pos = (uint_fast8_t)(offset % AES_BLOCK_SIZE);
+
+    memcpy(counter, p_ctx->iv, AES_BLOCK_SIZE);
+    aes_ctr_add64(counter, offset / AES_BLOCK_SIZE);
+
+    /* Start part way through a block */
+    if (pos > 0u && data_len > 0u)
+    {
+        memcpy(key_stream, counter, AES_BLOCK_SIZE);
+        aes128_encrypt(key_stream, p_ctx->key_schedule);
+        aes_ctr_increment(counter);
+        for ( ; data_len > 0u && pos < AES_BLOCK_SIZE; --data_len)
+        {
+            *p_data++ ^= key_stream[pos++];
+        }
+    }
+
+    aes128_ctr_crypt(p_data, data_len, counter, p_ctx->key_schedule);
+}
+
+/* Start a CBC mode stream.
+ *
+ * p_key points to the 16-byte AES-128 key, and p_iv to the 16-byte
+ * initialisation vector.
+ */
+void aes128_cbc_init(aes128_cbc_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t p_iv[AES_BLOCK_SIZE])
+{
+    aes128_key_schedule(p_ctx->key_schedule, p_key);
+    memcpy(p_ctx->iv, p_iv, AES_BLOCK_SIZE);
+}
+
+/* Encrypt the next num_blocks 16-byte blocks of a CBC mode stream in-place.
+ * Padding the end of the stream to a whole block is up to the caller.
+ */
+void aes128_cbc_encrypt_update(aes128_cbc_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks)
+{
+    aes128_cbc_encrypt(p_data, num_blocks, p_ctx->iv, p_ctx->key_schedule);
+}
+
+/* Decrypt the next num_blocks 16-byte blocks of a CBC mode stream in-place.
+ */
+void aes128_cbc_decrypt_update(aes128_cbc_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks)
+{
+    aes128_cbc_decrypt(p_data, num_blocks, p_ctx->iv, p_ctx->key_schedule);
+}
+
+/* Start a GCM mode encryption or decryption.
+ *
+ * p_key points to the 16-byte AES-128 key, and p_iv to the iv_len-byte
+ * initialisation vector. 12 bytes is the usual length and the most efficient,
+ * but any non-zero length works.
+ *
+ * Any additional authenticated data is then given to aes128_gcm_aad(), all
+ * of it before any of the data is given to aes128_gcm_encrypt_update() or
+ * aes128_gcm_decrypt_update(). Finally aes128_gcm_finish() gives the tag, or
+ * aes128_gcm_verify() checks it.
+ */
+void aes128_gcm_init(aes128_gcm_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t * p_iv, size_t iv_len)
+{
+    size_t          whole_len = iv_len - iv_len % AES_BLOCK_SIZE;
+
+    memset(p_ctx, 0, sizeof(*p_ctx));
+    aes128_key_schedule(p_ctx->key_schedule, p_key);
+
+    /* The hash subkey is the encrypted zero block */
+    aes128_encrypt(p_ctx->h, p_ctx->key_schedule);
+    aes_gcm_init_table(p_ctx);
+
+    if (iv_len == AES_GCM_IV_SIZE)
+    {
+        memcpy(p_ctx->j0, p_iv, AES_GCM_IV_SIZE);
+        p_ctx->j0[AES_BLOCK_SIZE - 1u] = 1u;
+    }
+    else
+    {
+        /* Hash the IV, padded with zero bytes, and then its length in bits */
+        aes_gcm_ghash(p_ctx, p_iv, whole_len / AES_BLOCK_SIZE);
+        if (iv_len > whole_len)
+        {
+            memcpy(p_ctx->partial, p_iv + whole_len, iv_len - whole_len);
+            aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+        }
+        memset(p_ctx->partial, 0, AES_BLOCK_SIZE);
+        aes_store_be64(p_ctx->partial + AES_BLOCK_SIZE / 2u, (uint64_t)iv_len * 8u);
+        aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+        memcpy(p_ctx->j0, p_ctx->ghash, AES_BLOCK_SIZE);
+        memset(p_ctx->ghash, 0, AES_BLOCK_SIZE);
+        memset(p_ctx->partial, 0, AES_BLOCK_SIZE);
+    }
+    memcpy(p_ctx->counter, p_ctx->j0, AES_BLOCK_SIZE);
+    aes_gcm_increment(p_ctx->counter);
+}
+
+/* Add the next aad_len bytes of additional authenticated data to a GCM mode
+ * operation. This data is authenticated but not encrypted, and can be split
+ * between calls at any point.
+ */
+void aes128_gcm_aad(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_aad, size_t aad_len)
+{
+    size_t          n;
+
+    p_ctx->aad_len += aad_len;
+    if (p_ctx->partial_len > 0u)
+    {
+        n = AES_BLOCK_SIZE - p_ctx->partial_len;
+        n = (aad_len < n) ? aad_len : n;
+        memcpy(p_ctx->partial + p_ctx->partial_len, p_aad, n);
+        p_ctx->partial_len += (uint8_t)n;
+        p_aad += n;
+        aad_len -= n;
+        if (p_ctx->partial_len < AES_BLOCK_SIZE)
+            return;
+        aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+        p_ctx->partial_len = 0;
+    }
+    aes_gcm_ghash(p_ctx, p_aad, aad_len / AES_BLOCK_SIZE);
+    n = aad_len % AES_BLOCK_SIZE;
+    memcpy(p_ctx->partial, p_aad + (aad_len - n), n);
+    p_ctx->partial_len = (uint8_t)n;
+}
+
+/* Encrypt the next data_len bytes of a GCM mode operation in-place. The data
+ * can be split between calls at any point.
+ */
+void aes128_gcm_encrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len)
+{
+    aes_gcm_crypt(p_ctx, p_data, data_len, 0);
+}
+
+/* Decrypt the next data_len bytes of a GCM mode operation in-place. The data
+ * can be split between calls at any point.
+ *
+ * The decrypted data mustn't be trusted until aes128_gcm_verify() has
+ * checked the tag.
+ */
+void aes128_gcm_decrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len)
+{
+    aes_gcm_crypt(p_ctx, p_data, data_len, 1);
+}
+
+/* Finish a GCM mode operation and write the 16-byte authentication tag to
+ * p_tag. It may be truncated by the caller, though not below
+ * AES128_GCM_MIN_TAG_SIZE bytes if it is to mean much.
+ */
+void aes128_gcm_finish(aes128_gcm_ctx_t * p_ctx, uint8_t p_tag[AES_BLOCK_SIZE])
+{
+    uint8_t         lengths[AES_BLOCK_SIZE];
+
+    if (p_ctx->partial_len > 0u)
+    {
+        memset(p_ctx->partial + p_ctx->partial_len, 0, AES_BLOCK_SIZE - p_ctx->partial_len);
+        aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+        p_ctx->partial_len = 0;
+    }
+    /* Lengths in bits */
+    aes_store_be64(lengths, p_ctx->aad_len * 8u);
+    aes_store_be64(lengths + AES_BLOCK_SIZE / 2u, p_ctx->text_len * 8u);
+    aes_gcm_ghash(p_ctx, lengths, 1u);
+
+    memcpy(p_tag, p_ctx->j0, AES_BLOCK_SIZE);
+    aes128_encrypt(p_tag, p_ctx->key_schedule);
+    aes_block_xor(p_tag, p_ctx->ghash);
+}
+
+/* Finish a GCM mode decryption, and check the tag_len-byte tag that came
+ * with the data against the one calculated, in constant time. Returns 1 if
+ * they match, or 0 if the data or AAD are not authentic. Tags shorter than
+ * AES128_GCM_MIN_TAG_SIZE bytes are rejected.
+ */
+int aes128_gcm_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    if (tag_len < AES128_GCM_MIN_TAG_SIZE || tag_len > AES_BLOCK_SIZE)
+    {
+        return 0;
+    }
+    return aes_gcm_check_tag(p_ctx, p_tag, tag_len);
+}
+
+/* As aes128_gcm_verify(), but for the 4- or 8-byte tags some protocols use
+ * (SP 800-38D appendix C), rejecting any other length. Such tags are only
+ * safe with the limits those protocols put on message length and on the
+ * number of failed checks per key.
+ */
+int aes128_gcm_verify_short(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    if (tag_len != 4u && tag_len != 8u)
+    {
+        return 0;
+    }
+    return aes_gcm_check_tag(p_ctx, p_tag, tag_len);
 }
 
 void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE])
@@ -359,6 +1125,59 @@ void _aes_sbox_apply_block_for_test(uint8_t p_block[AES_BLOCK_SIZE])
  * Local functions
  ****************************************************************************/
 
+/* Byte-oriented AES-128 encryption and decryption, used when the CPU has no
+ * AES instructions. See aes128_encrypt() and aes128_decrypt(). */
+static void aes128_sw_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    aes_block_xor(p_block, p_key_schedule);
+    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    {
+        aes_sbox_apply_block(p_block);
+        aes_shift_rows(p_block);
+        aes_mix_columns(p_block);
+        aes_block_xor(p_block, &p_key_schedule[round * AES_BLOCK_SIZE]);
+    }
+    aes_sbox_apply_block(p_block);
+    aes_shift_rows(p_block);
+    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+}
+
+static void aes128_sw_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint_fast8_t    round;
+
+    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+    aes_shift_rows_inv(p_block);
+    aes_sbox_inv_apply_block(p_block);
+    for (round = AES128_NUM_ROUNDS - 1u; round >= 1; --round)
+    {
+        aes_block_xor(p_block, &p_key_schedule[round * AES_BLOCK_SIZE]);
+        aes_mix_columns_inv(p_block);
+        aes_shift_rows_inv(p_block);
+        aes_sbox_inv_apply_block(p_block);
+    }
+    aes_block_xor(p_block, p_key_schedule);
+}
+
+#ifdef AES_HW
+
+/* Which of the AES_HW_FEATURE_* instructions can be used, checked on first
+ * use. Threads racing to set this all store the same value. */
+static unsigned int aes_hw_features(void)
+{
+    static volatile int features = -1;
+
+    if (features < 0)
+    {
+        features = (int)aes_hw_detect();
+    }
+    return (unsigned int)features;
+}
+
+#endif
+
 /* This is used for aes128_otfks_encrypt(), on-the-fly key schedule encryption.
  * It is also used by aes128_otfks_decrypt_start_key() to calculate the
  * starting key state for decryption with on-the-fly key schedule calculation.
@@ -649,3 +1468,204 @@ static void aes_mix_columns_inv(uint8_t p_block[AES_BLOCK_SIZE])
         memcpy(&p_block[i * AES_COLUMN_SIZE], temp_column, AES_COLUMN_SIZE);
     }
 }
+
+/* Add n to a 16-byte big-endian counter block. */
+static void aes_ctr_add64(uint8_t p_counter[AES_BLOCK_SIZE], uint64_t n)
+{
+    uint_fast8_t    i = AES_BLOCK_SIZE;
+    uint_fast16_t   sum;
+
+    while (i-- > 0u && n != 0u)
+    {
+        sum = p_counter[i] + (uint_fast16_t)(n & 0xFFu);
+        p_counter[i] = (uint8_t)sum;
+        n = (n >> 8u) + (sum >> 8u);
+    }
+}
+
+/* Precalculate the multiples of the hash subkey H by each 4-bit value, for
+ * multiplication in GF(2^128) four bits at a time, as described by Shoup
+ * and in the GCM specification. Like the S-box tables, this leaves the
+ * timing dependent on the data, which AES-NI and PCLMULQDQ don't.
+ */
+static void aes_gcm_init_table(aes128_gcm_ctx_t * p_ctx)
+{
+    uint64_t        vh = aes_load_be64(p_ctx->h);
+    uint64_t        vl = aes_load_be64(p_ctx->h + AES_BLOCK_SIZE / 2u);
+    uint64_t        reduce_byte;
+    uint_fast8_t    i;
+    uint_fast8_t    j;
+
+    p_ctx->h_table_hi[0] = 0;
+    p_ctx->h_table_lo[0] = 0;
+    p_ctx->h_table_hi[8] = vh;
+    p_ctx->h_table_lo[8] = vl;
+    for (i = 4u; i > 0u; i >>= 1u)
+    {
+        /* Multiply by x, which is a right shift as the bits are reflected */
+        reduce_byte = (0u - (vl & 1u)) & 0xE1u;
+        vl = (vh << 63u) | (vl >> 1u);
+        vh = (vh >> 1u) ^ (reduce_byte << 56u);
+        p_ctx->h_table_hi[i] = vh;
+        p_ctx->h_table_lo[i] = vl;
+    }
+    for (i = 2u; i <= 8u; i *= 2u)
+    {
+        for (j = 1u; j < i; ++j)
+        {
+            p_ctx->h_table_hi[i + j] = p_ctx->h_table_hi[i] ^ p_ctx->h_table_hi[j];
+            p_ctx->h_table_lo[i + j] = p_ctx->h_table_lo[i] ^ p_ctx->h_table_lo[j];
+        }
+    }
+}
+
+/* Add num_blocks whole blocks to the GHASH of a GCM mode operation. */
+static void aes_gcm_ghash(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t num_blocks)
+{
+    /* Reduction of the four bits shifted out of the bottom */
+    static const uint16_t reduce[16u] =
+    {
+        0x0000u, 0x1C20u, 0x3840u, 0x2460u, 0x7080u, 0x6CA0u, 0x48C0u, 0x54E0u,
+        0xE100u, 0xFD20u, 0xD940u, 0xC560u, 0x9180u, 0x8DA0u, 0xA9C0u, 0xB5E0u
+    };
+    uint64_t        z_hi;
+    uint64_t        z_lo;
+    uint_fast8_t    i;
+    uint_fast8_t    nibble;
+    uint_fast8_t    rem;
+    uint_fast8_t    half;
+
+#ifdef AES_HW_X86
+    if (aes_hw_features() & AES_HW_FEATURE_CLMUL)
+    {
+        aes_hw_ghash(p_ctx->ghash, p_ctx->h, p_data, num_blocks);
+        return;
+    }
+#endif
+    for ( ; num_blocks > 0u; --num_blocks, p_data += AES_BLOCK_SIZE)
+    {
+        aes_block_xor(p_ctx->ghash, p_data);
+
+        /* Multiply by H, from the last byte and low nibble up */
+        z_hi = 0;
+        z_lo = 0;
+        for (i = AES_BLOCK_SIZE; i-- > 0u; )
+        {
+            for (half = 0; half < 2u; ++half)
+            {
+                nibble = half ? (p_ctx->ghash[i] >> 4u) : (p_ctx->ghash[i] & 0x0Fu);
+                rem = (uint_fast8_t)(z_lo & 0x0Fu);
+                z_lo = (z_hi << 60u) | (z_lo >> 4u);
+                z_hi = (z_hi >> 4u) ^ ((uint64_t)reduce[rem] << 48u);
+                z_hi ^= p_ctx->h_table_hi[nibble];
+                z_lo ^= p_ctx->h_table_lo[nibble];
+            }
+        }
+        aes_store_be64(p_ctx->ghash, z_hi);
+        aes_store_be64(p_ctx->ghash + AES_BLOCK_SIZE / 2u, z_lo);
+    }
+}
+
+/* Encrypt or decrypt num_blocks whole blocks in-place in GCM mode, whose
+ * counter only increments its last 32 bits. */
+static void aes_gcm_ctr(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks)
+{
+    uint64_t        room;
+    size_t          n;
+
+    while (num_blocks > 0u)
+    {
+        room = 0x100000000u - aes_load_be32(p_ctx->counter + AES_BLOCK_SIZE - 4u);
+        n = (num_blocks < room) ? num_blocks : (size_t)room;
+        aes128_ctr_crypt(p_data, n * AES_BLOCK_SIZE, p_ctx->counter, p_ctx->key_schedule);
+        if (n == room)
+        {
+            /* The counter wrapped; undo the carry out of the last 32 bits */
+            memcpy(p_ctx->counter, p_ctx->j0, AES_BLOCK_SIZE - 4u);
+        }
+        p_data += n * AES_BLOCK_SIZE;
+        num_blocks -= n;
+    }
+}
+
+/* Encrypt or decrypt bytes of a partial block, using the key stream from
+ * the current position, and collect the encrypted bytes to hash. */
+static void aes_gcm_crypt_partial(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, int decrypt)
+{
+    uint8_t         byte_value;
+
+    for ( ; data_len > 0u; --data_len, ++p_data)
+    {
+        byte_value = *p_data;
+        *p_data ^= p_ctx->key_stream[p_ctx->partial_len];
+        p_ctx->partial[p_ctx->partial_len] = decrypt ? byte_value : *p_data;
+        if (++p_ctx->partial_len == AES_BLOCK_SIZE)
+        {
+            aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+            p_ctx->partial_len = 0;
+        }
+    }
+}
+
+static void aes_gcm_crypt(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, int decrypt)
+{
+    size_t          n;
+
+    /* The AAD is hashed padded to a whole block */
+    if (p_ctx->text_len == 0u && p_ctx->partial_len > 0u)
+    {
+        memset(p_ctx->partial + p_ctx->partial_len, 0, AES_BLOCK_SIZE - p_ctx->partial_len);
+        aes_gcm_ghash(p_ctx, p_ctx->partial, 1u);
+        p_ctx->partial_len = 0;
+    }
+    p_ctx->text_len += data_len;
+
+    /* Finish the partial block from last time */
+    if (p_ctx->partial_len > 0u)
+    {
+        n = AES_BLOCK_SIZE - p_ctx->partial_len;
+        n = (data_len < n) ? data_len : n;
+        aes_gcm_crypt_partial(p_ctx, p_data, n, decrypt);
+        p_data += n;
+        data_len -= n;
+    }
+
+    /* The hash is always of the encrypted data */
+    while (data_len >= AES_BLOCK_SIZE)
+    {
+        n = data_len - data_len % AES_BLOCK_SIZE;
+        n = (n < AES_GCM_CHUNK_SIZE) ? n : AES_GCM_CHUNK_SIZE;
+        if (decrypt)
+            aes_gcm_ghash(p_ctx, p_data, n / AES_BLOCK_SIZE);
+        aes_gcm_ctr(p_ctx, p_data, n / AES_BLOCK_SIZE);
+        if (!decrypt)
+            aes_gcm_ghash(p_ctx, p_data, n / AES_BLOCK_SIZE);
+        p_data += n;
+        data_len -= n;
+    }
+
+    if (data_len > 0u)
+    {
+        memcpy(p_ctx->key_stream, p_ctx->counter, AES_BLOCK_SIZE);
+        aes128_encrypt(p_ctx->key_stream, p_ctx->key_schedule);
+        aes_gcm_increment(p_ctx->counter);
+        aes_gcm_crypt_partial(p_ctx, p_data, data_len, decrypt);
+    }
+}
+
+/* Finish a GCM mode operation and compare the first tag_len bytes of its tag
+ * with p_tag, in constant time.
+ */
+static int aes_gcm_check_tag(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t         tag[AES_BLOCK_SIZE];
+    uint8_t         diff = 0;
+    uint_fast8_t    i;
+
+    aes128_gcm_finish(p_ctx, tag);
+    for (i = 0; i < tag_len; ++i)
+    {
+        diff |= tag[i] ^ p_tag[i];
+    }
+    return diff == 0u;
+}
@@ -12,6 +12,7 @@
  * Includes
  ****************************************************************************/
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*****************************************************************************
@@ -28,6 +29,50 @@
 #define AES128_KEY_SIZE             16u
 #define AES128_KEY_SCHEDULE_SIZE    (AES_BLOCK_SIZE * (AES128_NUM_ROUNDS + 1u))
 
+/* Shortest GCM tag aes128_gcm_verify() accepts. Shorter tags are much easier
+ * to forge, so 4- and 8-byte ones are only checked by
+ * aes128_gcm_verify_short(), for protocols that specify them.
+ */
+#define AES128_GCM_MIN_TAG_SIZE     12u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/* State of a CTR mode stream, for aes128_ctr_update(). */
+typedef struct
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     iv[AES_BLOCK_SIZE];             /* Counter block at the start of the stream */
+    uint8_t     counter[AES_BLOCK_SIZE];        /* Counter block for the next block */
+    uint8_t     key_stream[AES_BLOCK_SIZE];     /* Of the current partial block */
+    uint8_t     key_stream_pos;                 /* AES_BLOCK_SIZE between blocks */
+} aes128_ctr_ctx_t;
+
+/* State of a CBC mode stream. */
+typedef struct
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     iv[AES_BLOCK_SIZE];             /* Last encrypted block */
+} aes128_cbc_ctx_t;
+
+/* State of a GCM mode encryption or decryption. */
+typedef struct
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     h[AES_BLOCK_SIZE];              /* Hash subkey */
+    uint64_t    h_table_hi[16];                 /* Multiples of h, for GHASH without PCLMULQDQ */
+    uint64_t    h_table_lo[16];
+    uint8_t     j0[AES_BLOCK_SIZE];             /* Counter block for the tag */
+    uint8_t     counter[AES_BLOCK_SIZE];        /* Counter block for the next block */
+    uint8_t     key_stream[AES_BLOCK_SIZE];     /* Of the current partial block */
+    uint8_t     ghash[AES_BLOCK_SIZE];
+    uint8_t     partial[AES_BLOCK_SIZE];        /* AAD or encrypted data not hashed yet */
+    uint8_t     partial_len;
+    uint64_t    aad_len;
+    uint64_t    text_len;
+} aes128_gcm_ctx_t;
+
 /*****************************************************************************
  * Inline functions
  ****************************************************************************/
@@ -53,6 +98,26 @@ static inline void aes_block_xor(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t
 void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
 void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
 
+void aes128_ctr_crypt(uint8_t *p_data, size_t data_len, uint8_t p_counter[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+void aes128_cbc_encrypt(uint8_t *p_data, size_t num_blocks, uint8_t p_iv[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+void aes128_cbc_decrypt(uint8_t *p_data, size_t num_blocks, uint8_t p_iv[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+
+void aes128_ctr_init(aes128_ctr_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t p_iv[AES_BLOCK_SIZE]);
+void aes128_ctr_update(aes128_ctr_ctx_t * p_ctx, uint8_t * p_data, size_t data_len);
+void aes128_ctr_update_range(const aes128_ctr_ctx_t * p_ctx, uint8_t * p_data, size_t data_len, uint64_t offset);
+
+void aes128_cbc_init(aes128_cbc_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t p_iv[AES_BLOCK_SIZE]);
+void aes128_cbc_encrypt_update(aes128_cbc_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks);
+void aes128_cbc_decrypt_update(aes128_cbc_ctx_t * p_ctx, uint8_t * p_data, size_t num_blocks);
+
+void aes128_gcm_init(aes128_gcm_ctx_t * p_ctx, const uint8_t p_key[AES128_KEY_SIZE], const uint8_t * p_iv, size_t iv_len);
+void aes128_gcm_aad(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_aad, size_t aad_len);
+void aes128_gcm_encrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len);
+void aes128_gcm_decrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_data, size_t data_len);
+void aes128_gcm_finish(aes128_gcm_ctx_t * p_ctx, uint8_t p_tag[AES_BLOCK_SIZE]);
+int aes128_gcm_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+int aes128_gcm_verify_short(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+
 void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE]);
 
 void aes128_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE]);
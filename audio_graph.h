@@ -0,0 +1,666 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// FILE: audio_graph.h
+//
+// Block-based pull graph for chaining Game_Music_Emu, SoundTouch and
+// Rubber Band without a conversion buffer at every hop.
+//
+// Each node hands out a View of audio it already holds, rather than
+// copying into a buffer its consumer owns. A View is float samples of
+// any layout: one pointer per channel and a stride between frames, so
+// interleaved data (gme's output, SoundTouch's FIFO) and planar data
+// (Rubber Band's) both pass through as they are, and a consumer that
+// takes the same layout uses the samples in place:
+//
+//    Music_Emu::play(float)    writes into the source's block
+//    SoundTouch::putSamples    reads that block directly, interleaved
+//    SoundTouch::ptrBegin      handed on without receiveSamples() copying
+//    RubberBandStretcher       gets its input deinterleaved once, the
+//                              only layout change on the path, and
+//                              retrieves into the node's planar block
+//
+// There is no 16-bit stage, so nothing is converted to short and back.
+// Working blocks come from a BufferPool that nodes share, so a graph
+// allocates nothing once built, and graphs built and torn down one
+// after another reuse the same memory.
+//
+//    audio_graph::BufferPool pool(2, 1024);
+//    audio_graph::GmeSource source(pool, emu);          // set_float_output() first
+//    audio_graph::SoundTouchNode tempo(pool, source, st);
+//    audio_graph::RubberBandNode pitch(pool, tempo, rb);
+//    while ((n = audio_graph::readPlanar(pitch, out, 512)) > 0)
+//        ...
+//
+// A graph's output can be played through BASS with BassStream, which
+// has the last node render straight into the buffer BASS provides.
+//
+// The adapters are defined when the library's header is included
+// before this one. A graph, and the pool, belong to one thread.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+
+//------------------------------------------------------------------------
+//                              INCLUDES
+//------------------------------------------------------------------------
+
+#include <stdlib.h>     // malloc, free
+#include <string.h>     // memcpy
+#include <new>          // std::bad_alloc
+
+
+
+namespace audio_graph {
+
+
+// Most channels a View can describe.
+enum { MaxChannels = 8 };
+
+
+//------------------------------------------------------------------------
+// Audio held by a node: sample i of channel c is data[c][i * stride].
+// Valid until the next pull() from the same node.
+//------------------------------------------------------------------------
+struct View
+{
+    const float * data[MaxChannels];
+    int channels;
+    int stride;
+
+    // True if the frames are interleaved in one buffer starting at data[0].
+    bool interleaved() const
+    {
+        if (stride != channels)
+            return false;
+        for (int c = 1; c < channels; ++c)
+            if (data[c] != data[0] + c)
+                return false;
+        return true;
+    }
+
+    bool planar() const
+    {
+        return stride == 1;
+    }
+
+    static View makeInterleaved(const float * samples, int channels)
+    {
+        View v;
+        v.channels = channels;
+        v.stride = channels;
+        for (int c = 0; c < channels; ++c)
+            v.data[c] = samples + c;
+        return v;
+    }
+
+    static View makePlanar(const float * const * planes, int channels)
+    {
+        View v;
+        v.channels = channels;
+        v.stride = 1;
+        for (int c = 0; c < channels; ++c)
+            v.data[c] = planes[c];
+        return v;
+    }
+};
+
+
+//------------------------------------------------------------------------
+// Fixed-size blocks of channels * frames floats, 64-byte aligned. Blocks
+// given back are kept for the next node, and freed with the pool.
+//------------------------------------------------------------------------
+class BufferPool
+{
+public:
+
+    BufferPool(int channels, int frames)
+        : m_channels(channels < 1 ? 1 : channels > MaxChannels ? MaxChannels : channels)
+        , m_frames(frames < 1 ? 1 : frames)
+        , m_free(NULL)
+    {
+    }
+
+    ~BufferPool()
+    {
+        while (m_free)
+        {
+            Block * next = m_free->next;
+            free(m_free->raw);
+            m_free = next;
+        }
+    }
+
+    int channels() const  { return m_channels; }
+    int frames() const    { return m_frames; }
+
+    // A block of channels() * frames() floats. Throws std::bad_alloc.
+    float * acquire()
+    {
+        Block * block = m_free;
+        if (block)
+        {
+            m_free = block->next;
+            return block->samples;
+        }
+        size_t size = (size_t)m_channels * m_frames * sizeof(float);
+        void * raw = malloc(sizeof(Block) + size + 64);
+        if (!raw)
+            throw std::bad_alloc();
+        size_t addr = ((size_t)raw + sizeof(Block) + 63) & ~(size_t)63;
+        float * samples = (float *)addr;
+        block = header(samples);
+        block->raw = raw;
+        block->samples = samples;
+        return samples;
+    }
+
+    void release(float * samples)
+    {
+        if (!samples)
+            return;
+        Block * block = header(samples);
+        block->next = m_free;
+        m_free = block;
+    }
+
+private:
+
+    struct Block
+    {
+        Block * next;
+        void * raw;
+        float * samples;
+    };
+
+    // Kept just before the samples, which are at least sizeof(Block) into raw
+    static Block * header(float * samples)
+    {
+        return (Block *)((char *)samples - sizeof(Block));
+    }
+
+    int m_channels;
+    int m_frames;
+    Block * m_free;
+
+    BufferPool(const BufferPool &);
+    BufferPool & operator=(const BufferPool &);
+};
+
+
+//------------------------------------------------------------------------
+// A stage of the graph.
+//------------------------------------------------------------------------
+class Node
+{
+public:
+
+    virtual ~Node() { }
+
+    virtual int channels() const = 0;
+
+    // Point 'out' at up to 'frames' frames of output, and return how
+    // many. Fewer than asked for is fine; 0 means the end of the stream,
+    // or an error if error() is set.
+    virtual int pull(View & out, int frames) = 0;
+
+    // Write up to 'frames' frames, interleaved, into 'out', which the
+    // caller owns; for handing audio to an output that supplies its own
+    // buffer. Returns fewer only at the end of the stream. Nodes that
+    // can produce straight into 'out' do; the rest pull and copy.
+    virtual int render(float * out, int frames);
+
+    // Reason the stream ended early, or NULL.
+    const char * error() const  { return m_error; }
+
+protected:
+
+    Node() : m_error(NULL) { }
+
+    const char * m_error;
+};
+
+
+//------------------------------------------------------------------------
+// Base for nodes that hold one block from the pool.
+//------------------------------------------------------------------------
+class PooledNode : public Node
+{
+protected:
+
+    explicit PooledNode(BufferPool & pool)
+        : m_pool(pool)
+        , m_block(pool.acquire())
+    {
+    }
+
+    virtual ~PooledNode()
+    {
+        m_pool.release(m_block);
+    }
+
+    // Planes of the block, for 'channels' channels of blockFrames() each
+    void planes(float ** out, int channels) const
+    {
+        for (int c = 0; c < channels; ++c)
+            out[c] = m_block + (size_t)c * m_pool.frames();
+    }
+
+    int blockFrames() const  { return m_pool.frames(); }
+
+    BufferPool & m_pool;
+    float * m_block;
+};
+
+
+//------------------------------------------------------------------------
+// Copy helpers, for where a layout change can't be avoided.
+//------------------------------------------------------------------------
+inline void copyToPlanar(const View & in, float * const * out, int frames)
+{
+    for (int c = 0; c < in.channels; ++c)
+    {
+        const float * src = in.data[c];
+        float * dst = out[c];
+        if (in.stride == 1)
+        {
+            memcpy(dst, src, frames * sizeof(float));
+            continue;
+        }
+        for (int i = 0; i < frames; ++i)
+            dst[i] = src[(size_t)i * in.stride];
+    }
+}
+
+inline void copyToInterleaved(const View & in, float * out, int frames)
+{
+    if (in.interleaved())
+    {
+        memcpy(out, in.data[0], (size_t)frames * in.channels * sizeof(float));
+        return;
+    }
+    for (int c = 0; c < in.channels; ++c)
+    {
+        const float * src = in.data[c];
+        float * dst = out + c;
+        for (int i = 0; i < frames; ++i)
+            dst[(size_t)i * in.channels] = src[(size_t)i * in.stride];
+    }
+}
+
+// Fill 'out' with up to 'frames' frames of the node's channels, pulling
+// as often as it takes. Returns the frames read, fewer only at the end.
+inline int readPlanar(Node & node, float * const * out, int frames)
+{
+    int done = 0;
+    while (done < frames)
+    {
+        View v;
+        int n = node.pull(v, frames - done);
+        if (n <= 0)
+            break;
+        float * at[MaxChannels];
+        for (int c = 0; c < v.channels; ++c)
+            at[c] = out[c] + done;
+        copyToPlanar(v, at, n);
+        done += n;
+    }
+    return done;
+}
+
+inline int readInterleaved(Node & node, float * out, int frames)
+{
+    int done = 0;
+    while (done < frames)
+    {
+        View v;
+        int n = node.pull(v, frames - done);
+        if (n <= 0)
+            break;
+        copyToInterleaved(v, out + (size_t)done * v.channels, n);
+        done += n;
+    }
+    return done;
+}
+
+inline int Node::render(float * out, int frames)
+{
+    return readInterleaved(*this, out, frames);
+}
+
+
+#ifdef MUSIC_EMU_H
+
+//------------------------------------------------------------------------
+// A gme track, stereo interleaved, ending when the track does. The
+// emulator must have had set_float_output() before start_track().
+//------------------------------------------------------------------------
+class GmeSource : public PooledNode
+{
+public:
+
+    GmeSource(BufferPool & pool, Music_Emu * emu)
+        : PooledNode(pool)
+        , m_emu(emu)
+    {
+        if (pool.channels() < 2)
+            m_error = "Buffer pool needs two channels for gme";
+    }
+
+    virtual int channels() const  { return 2; }
+
+    virtual int pull(View & out, int frames)
+    {
+        if (m_error || m_emu->track_ended())
+            return 0;
+        if (frames > blockFrames())
+            frames = blockFrames();
+        if (blargg_err_t err = m_emu->play(frames * 2L, m_block))
+        {
+            m_error = err;
+            return 0;
+        }
+        out = View::makeInterleaved(m_block, 2);
+        return frames;
+    }
+
+    virtual int render(float * out, int frames)
+    {
+        if (m_error || m_emu->track_ended())
+            return 0;
+        if (blargg_err_t err = m_emu->play(frames * 2L, out))
+        {
+            m_error = err;
+            return 0;
+        }
+        return frames;
+    }
+
+private:
+
+    Music_Emu * m_emu;
+};
+
+#endif // MUSIC_EMU_H
+
+
+#if defined(SoundTouch_H) && defined(SOUNDTOUCH_FLOAT_SAMPLES)
+
+//------------------------------------------------------------------------
+// SoundTouch fed from 'input'. Output is read in place from SoundTouch's
+// FIFO, and removed from it on the next pull. At the end of the input
+// the pipeline is flushed, so its tail comes out too.
+//------------------------------------------------------------------------
+class SoundTouchNode : public PooledNode
+{
+public:
+
+    SoundTouchNode(BufferPool & pool, Node & input, soundtouch::SoundTouch & st)
+        : PooledNode(pool)
+        , m_input(input)
+        , m_st(st)
+        , m_pending(0)
+        , m_flushed(false)
+    {
+    }
+
+    virtual int channels() const  { return m_input.channels(); }
+
+    virtual int pull(View & out, int frames)
+    {
+        if (m_pending)
+        {
+            m_st.receiveSamples(m_pending);
+            m_pending = 0;
+        }
+        int n = fill();
+        if (n > frames)
+            n = frames;
+        if (n <= 0)
+            return 0;
+        // ptrBegin() is public only through the pipe interface
+        soundtouch::FIFOSamplePipe & pipe = m_st;
+        out = View::makeInterleaved(pipe.ptrBegin(), channels());
+        m_pending = n;
+        return n;
+    }
+
+    // Straight out of SoundTouch's FIFO with receiveSamples()
+    virtual int render(float * out, int frames)
+    {
+        if (m_pending)
+        {
+            m_st.receiveSamples(m_pending);
+            m_pending = 0;
+        }
+        int done = 0;
+        while (done < frames && fill() > 0)
+            done += (int)m_st.receiveSamples(out + (size_t)done * channels(),
+                    frames - done);
+        return done;
+    }
+
+private:
+
+    // Feed SoundTouch until it has output or the input ends; returns
+    // the frames it has ready
+    int fill()
+    {
+        while (!m_st.numSamples() && !m_flushed)
+        {
+            View in;
+            int n = m_input.pull(in, blockFrames());
+            if (n <= 0)
+            {
+                m_error = m_input.error();
+                m_st.flush();
+                m_flushed = true;
+                break;
+            }
+            if (in.interleaved())
+            {
+                m_st.putSamples(in.data[0], n);
+            }
+            else
+            {
+                copyToInterleaved(in, m_block, n);
+                m_st.putSamples(m_block, n);
+            }
+        }
+        return (int)m_st.numSamples();
+    }
+
+    Node & m_input;
+    soundtouch::SoundTouch & m_st;
+    int m_pending;
+    bool m_flushed;
+};
+
+#endif // SoundTouch_H
+
+
+#ifdef _RUBBERBANDSTRETCHER_H_
+
+//------------------------------------------------------------------------
+// A RubberBandStretcher fed from 'input', which must have been created
+// with OptionProcessRealTime so that process() never waits for a
+// study() pass, and with as many channels as the input. Planar input
+// goes to process() as it is; interleaved input is split into the
+// node's block first.
+//------------------------------------------------------------------------
+class RubberBandNode : public PooledNode
+{
+public:
+
+    RubberBandNode(BufferPool & pool, Node & input, RubberBand::RubberBandStretcher & rb)
+        : PooledNode(pool)
+        , m_input(input)
+        , m_rb(rb)
+        , m_final(false)
+    {
+        if ((int)rb.getChannelCount() != input.channels() ||
+                input.channels() > pool.channels())
+            m_error = "Stretcher and input have different channel counts";
+    }
+
+    virtual int channels() const  { return (int)m_rb.getChannelCount(); }
+
+    virtual int pull(View & out, int frames)
+    {
+        if (m_error)
+            return 0;
+        if (frames > blockFrames())
+            frames = blockFrames();
+        float * planes[MaxChannels];
+        this->planes(planes, channels());
+        for (;;)
+        {
+            int available = m_rb.available();
+            if (available > 0)
+            {
+                int n = available < frames ? available : frames;
+                n = (int)m_rb.retrieve(planes, n);
+                out = View::makePlanar(planes, channels());
+                return n;
+            }
+            if (available < 0 || m_final)
+                return 0;
+
+            size_t required = m_rb.getSamplesRequired();
+            int want = required > 0 && required < (size_t)blockFrames()
+                ? (int)required : blockFrames();
+            View in;
+            int n = m_input.pull(in, want);
+            if (n <= 0)
+            {
+                m_error = m_input.error();
+                m_rb.process(planes, 0, true);
+                m_final = true;
+                continue;
+            }
+            if (in.planar())
+            {
+                m_rb.process(in.data, n, false);
+            }
+            else
+            {
+                copyToPlanar(in, planes, n);
+                m_rb.process(planes, n, false);
+            }
+        }
+    }
+
+private:
+
+    Node & m_input;
+    RubberBand::RubberBandStretcher & m_rb;
+    bool m_final;
+};
+
+#endif // _RUBBERBANDSTRETCHER_H_
+
+
+#ifdef BASS_H
+
+//------------------------------------------------------------------------
+// A BASS user stream playing a node. BASS asks the STREAMPROC to fill a
+// buffer it owns, and render() goes straight into it, so gme's and
+// SoundTouch's output is written once, where BASS reads it. Samples are
+// 32-bit float if BASS takes them, and otherwise converted to 16-bit on
+// the way in. With BASS_STREAM_DECODE in the flags the stream isn't
+// played but read with BASS_ChannelGetData(), which runs the graph as
+// fast as it can go, for rendering to a file.
+//------------------------------------------------------------------------
+class BassStream
+{
+public:
+
+    BassStream(BufferPool & pool, Node & input)
+        : m_pool(pool)
+        , m_block(pool.acquire())
+        , m_input(input)
+        , m_handle(0)
+        , m_float(true)
+    {
+    }
+
+    ~BassStream()
+    {
+        if (m_handle)
+            BASS_StreamFree(m_handle);
+        m_pool.release(m_block);
+    }
+
+    // Make the stream. Returns its handle, or 0 with BASS_ErrorGetCode()
+    // telling why.
+    HSTREAM create(DWORD freq, DWORD flags = 0)
+    {
+        DWORD channels = (DWORD)m_input.channels();
+        m_float = true;
+        m_handle = BASS_StreamCreate(freq, channels, flags | BASS_SAMPLE_FLOAT, proc, this);
+        if (!m_handle && BASS_ErrorGetCode() == BASS_ERROR_FORMAT)
+        {
+            m_float = false;
+            m_handle = BASS_StreamCreate(freq, channels, flags & ~BASS_SAMPLE_FLOAT, proc, this);
+        }
+        return m_handle;
+    }
+
+    HSTREAM handle() const       { return m_handle; }
+    bool floatSamples() const    { return m_float; }
+
+    // The STREAMPROC, with this object as 'user', for creating the
+    // stream some other way, such as through a BASS loaded at run time.
+    static DWORD CALLBACK proc(HSTREAM, void * buffer, DWORD length, void * user)
+    {
+        BassStream & s = *(BassStream *)user;
+        int channels = s.m_input.channels();
+        if (s.m_float)
+        {
+            int frames = (int)(length / (channels * sizeof(float)));
+            int n = s.m_input.render((float *)buffer, frames);
+            DWORD bytes = (DWORD)(n * channels * sizeof(float));
+            return n < frames ? bytes | BASS_STREAMPROC_END : bytes;
+        }
+
+        int frames = (int)(length / (channels * sizeof(short)));
+        int piece = s.m_pool.frames() * s.m_pool.channels() / channels;
+        short * out = (short *)buffer;
+        int done = 0;
+        while (done < frames)
+        {
+            int want = frames - done < piece ? frames - done : piece;
+            int n = s.m_input.render(s.m_block, want);
+            const float * in = s.m_block;
+            for (int i = n * channels; i--; )
+            {
+                float f = *in++ * 32768.0f;
+                *out++ = (short)(f >= 32767.0f ? 32767 : f <= -32768.0f ? -32768
+                        : (int)(f < 0.0f ? f - 0.5f : f + 0.5f));
+            }
+            done += n;
+            if (n < want)
+                break;
+        }
+        DWORD bytes = (DWORD)(done * channels * sizeof(short));
+        return done < frames ? bytes | BASS_STREAMPROC_END : bytes;
+    }
+
+private:
+
+    BufferPool & m_pool;
+    float * m_block;
+    Node & m_input;
+    HSTREAM m_handle;
+    bool m_float;
+
+    BassStream(const BassStream &);
+    BassStream & operator=(const BassStream &);
+};
+
+#endif // BASS_H
+
+
+} // namespace audio_graph
@@ -42,6 +42,20 @@
 
 #include <string.h>
 
+/*
+ * mbedtls_mpi_exp_mod_batch() runs on Win32 threads or pthreads, unless
+ * MBEDTLS_MPI_NO_THREADS is defined
+ */
+#if !defined(MBEDTLS_MPI_NO_THREADS)
+#if defined(_WIN32)
+#include <windows.h>
+#define MPI_HAVE_THREADS
+#elif defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#include <pthread.h>
+#define MPI_HAVE_THREADS
+#endif
+#endif /* !MBEDTLS_MPI_NO_THREADS */
+
 #if defined(MBEDTLS_PLATFORM_C)
 #include "platform.h"
 #else
@@ -77,6 +91,132 @@
 #define MPI_VALIDATE( cond )                                           \
     MBEDTLS_INTERNAL_VALIDATE( cond )
 
+/*
+ * Multiply-accumulate: d[] += s[] * b, with the carry in c.
+ *
+ * Assembly versions are used for x86-64 and AArch64 with GCC or Clang,
+ * unless MBEDTLS_NO_ASM is defined. On x86-64 the BMI2 and ADX version
+ * (MULX with the two carry chains of ADCX and ADOX) is picked at compile
+ * time when those extensions are enabled, e.g. by -mbmi2 -madx or
+ * -march=broadwell and later; otherwise MULQ is used.
+ */
+#if !defined(MBEDTLS_NO_ASM) && defined(MBEDTLS_HAVE_INT64) && \
+    defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) )
+
+#if defined(__BMI2__) && defined(__ADX__)
+
+#define MULADDC_INIT                        \
+    asm(                                    \
+        "movq   %%rbx, %%rdx        \n\t"
+
+#define MULADDC_CORE                        \
+        "mulxq  (%%rsi), %%rax, %%r9 \n\t"  \
+        "addq   %%rcx, %%rax        \n\t"  \
+        "adcq   $0, %%r9            \n\t"  \
+        "addq   %%rax, (%%rdi)      \n\t"  \
+        "adcq   $0, %%r9            \n\t"  \
+        "movq   %%r9, %%rcx         \n\t"  \
+        "addq   $8, %%rsi           \n\t"  \
+        "addq   $8, %%rdi           \n\t"
+
+/* One limb of MULADDC_HUIT: the high half of the previous product goes
+ * into the CF chain and the destination limb into the OF chain */
+#define MULADDC_MULX( off )                 \
+        "mulxq  " #off "(%%rsi), %%rax, %%r9 \n\t" \
+        "adcxq  %%rcx, %%rax        \n\t"  \
+        "adoxq  " #off "(%%rdi), %%rax \n\t" \
+        "movq   %%rax, " #off "(%%rdi) \n\t" \
+        "movq   %%r9, %%rcx         \n\t"
+
+#define MULADDC_HUIT                        \
+        "xorl   %%r8d, %%r8d        \n\t"  \
+        MULADDC_MULX( 0 )                   \
+        MULADDC_MULX( 8 )                   \
+        MULADDC_MULX( 16 )                  \
+        MULADDC_MULX( 24 )                  \
+        MULADDC_MULX( 32 )                  \
+        MULADDC_MULX( 40 )                  \
+        MULADDC_MULX( 48 )                  \
+        MULADDC_MULX( 56 )                  \
+        "adcxq  %%r8, %%rcx         \n\t"  \
+        "adoxq  %%r8, %%rcx         \n\t"  \
+        "addq   $64, %%rsi          \n\t"  \
+        "addq   $64, %%rdi          \n\t"
+
+#define MULADDC_STOP                        \
+        : "+c" (c), "+D" (d), "+S" (s)      \
+        : "b" (b)                           \
+        : "rax", "rdx", "r8", "r9", "cc", "memory" \
+    );
+
+#else /* __BMI2__ && __ADX__ */
+
+#define MULADDC_INIT                        \
+    asm(                                    \
+        "xorq   %%r8, %%r8          \n\t"
+
+#define MULADDC_CORE                        \
+        "movq   (%%rsi), %%rax      \n\t"  \
+        "mulq   %%rbx               \n\t"  \
+        "addq   $8, %%rsi           \n\t"  \
+        "addq   %%rcx, %%rax        \n\t"  \
+        "movq   %%r8, %%rcx         \n\t"  \
+        "adcq   $0, %%rdx           \n\t"  \
+        "addq   %%rax, (%%rdi)      \n\t"  \
+        "adcq   %%rdx, %%rcx        \n\t"  \
+        "addq   $8, %%rdi           \n\t"
+
+#define MULADDC_STOP                        \
+        : "+c" (c), "+D" (d), "+S" (s)      \
+        : "b" (b)                           \
+        : "rax", "rdx", "r8", "cc", "memory" \
+    );
+
+#endif /* __BMI2__ && __ADX__ */
+
+#elif !defined(MBEDTLS_NO_ASM) && defined(MBEDTLS_HAVE_INT64) && \
+    defined(__GNUC__) && defined(__aarch64__)
+
+#define MULADDC_INIT                        \
+    asm(
+
+#define MULADDC_CORE                        \
+        "ldr    x4, [%2], #8        \n\t"  \
+        "ldr    x5, [%1]            \n\t"  \
+        "mul    x6, x4, %3          \n\t"  \
+        "umulh  x7, x4, %3          \n\t"  \
+        "adds   x5, x5, x6          \n\t"  \
+        "adc    x7, x7, xzr         \n\t"  \
+        "adds   x5, x5, %0          \n\t"  \
+        "adc    %0, x7, xzr         \n\t"  \
+        "str    x5, [%1], #8        \n\t"
+
+#define MULADDC_STOP                        \
+        : "+r" (c), "+r" (d), "+r" (s)      \
+        : "r" (b)                           \
+        : "x4", "x5", "x6", "x7", "cc", "memory" \
+    );
+
+#elif defined(_MSC_VER) && defined(_M_AMD64)
+
+/* No inline assembly, and no 128-bit type, but _umul128() compiles to MUL */
+#include <intrin.h>
+
+#define MULADDC_INIT                    \
+{                                       \
+    mbedtls_mpi_uint r0, r1;
+
+#define MULADDC_CORE                    \
+    r0  = _umul128( *(s++), b, &r1 );   \
+    r0 += c;  r1 += (r0 <  c);          \
+    r0 += *d; r1 += (r0 < *d);          \
+    c = r1; *(d++) = r0;
+
+#define MULADDC_STOP                    \
+}
+
+#else
+
 #define MULADDC_INIT                    \
 {                                       \
     mbedtls_t_udbl r;                           \
@@ -93,6 +233,8 @@
 #define MULADDC_STOP                    \
 }
 
+#endif
+
 #define ciL    (sizeof(mbedtls_mpi_uint))         /* chars in limb  */
 #define biL    (ciL << 3)               /* bits  in limb  */
 #define biH    (ciL << 2)               /* half limb size */
@@ -107,9 +249,13 @@
 #define CHARS_TO_LIMBS(i) ( (i) / ciL + ( (i) % ciL != 0 ) )
 
 /* Implementation that should never be optimized out by the compiler */
+/* Calling memset through a volatile pointer stops the compiler from
+ * optimizing away the zeroing of memory that is about to be freed */
+static void * (* const volatile mpi_memset)( void *, int, size_t ) = memset;
+
 static void mbedtls_platform_zeroize(void* buf, size_t len)
 {
-	memset(buf, 0, len);
+	mpi_memset(buf, 0, len);
 }
 
 static void mbedtls_mpi_zeroize( mbedtls_mpi_uint *v, size_t n )
@@ -117,6 +263,132 @@ static void mbedtls_mpi_zeroize( mbedtls_mpi_uint *v, size_t n )
     mbedtls_platform_zeroize( v, ciL * n );
 }
 
+/*
+ * Limb storage comes from the calling thread's arena, if it has one
+ */
+#if defined(MBEDTLS_MPI_THREAD_LOCAL)
+#define MPI_THREAD_LOCAL MBEDTLS_MPI_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define MPI_THREAD_LOCAL __declspec( thread )
+#elif defined(__GNUC__)
+#define MPI_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define MPI_THREAD_LOCAL _Thread_local
+#else
+#define MPI_THREAD_LOCAL /* one arena for the whole program */
+#endif
+
+static MPI_THREAD_LOCAL mbedtls_mpi_arena *mpi_arena = NULL;
+
+/*
+ * Size class for a number of limbs: blocks of class c hold 2^c limbs, and
+ * at least a pointer for the free list
+ */
+static size_t mpi_arena_class( size_t nblimbs )
+{
+    size_t c = 0;
+
+    while( ( (size_t) 1 << c ) < nblimbs || ( ciL << c ) < sizeof( void * ) )
+        c++;
+
+    return( c );
+}
+
+static mbedtls_mpi_uint *mpi_alloc_limbs( size_t nblimbs )
+{
+    mbedtls_mpi_arena *arena = mpi_arena;
+    mbedtls_mpi_uint *p = NULL;
+    size_t c;
+
+    if( arena != NULL )
+    {
+        c = mpi_arena_class( nblimbs );
+        if( c < MBEDTLS_MPI_ARENA_CLASSES )
+        {
+            if( arena->free_list[c] != NULL )
+            {
+                p = (mbedtls_mpi_uint *) arena->free_list[c];
+                memcpy( &arena->free_list[c], p, sizeof( void * ) );
+            }
+            else if( ( ciL << c ) <= arena->size - arena->used )
+            {
+                p = (mbedtls_mpi_uint *)( arena->buf + arena->used );
+                arena->used += ciL << c;
+            }
+        }
+
+        if( p != NULL )
+        {
+            memset( p, 0, nblimbs * ciL );
+            return( p );
+        }
+
+        arena->fallbacks++;
+    }
+
+    return( (mbedtls_mpi_uint*)mbedtls_calloc( nblimbs, ciL ) );
+}
+
+/* p must have been zeroized already */
+static void mpi_free_limbs( mbedtls_mpi_uint *p, size_t nblimbs )
+{
+    mbedtls_mpi_arena *arena = mpi_arena;
+    size_t c;
+
+    if( arena != NULL && (uintptr_t) p >= (uintptr_t) arena->buf &&
+        (uintptr_t) p < (uintptr_t)( arena->buf + arena->size ) )
+    {
+        c = mpi_arena_class( nblimbs );
+        memcpy( p, &arena->free_list[c], sizeof( void * ) );
+        arena->free_list[c] = p;
+        return;
+    }
+
+    mbedtls_free( p );
+}
+
+void mbedtls_mpi_arena_init( mbedtls_mpi_arena *arena, void *buf, size_t size )
+{
+    size_t skip;
+    MPI_VALIDATE( arena != NULL );
+    MPI_VALIDATE( buf != NULL || size == 0 );
+
+    memset( arena, 0, sizeof( mbedtls_mpi_arena ) );
+
+    /* Limbs must be aligned */
+    skip = ( ciL - (uintptr_t) buf % ciL ) % ciL;
+    if( size < skip )
+        return;
+
+    arena->buf = (unsigned char *) buf + skip;
+    arena->size = size - skip;
+}
+
+void mbedtls_mpi_arena_reset( mbedtls_mpi_arena *arena )
+{
+    size_t c;
+    MPI_VALIDATE( arena != NULL );
+
+    /* Freed blocks were zeroized when they were freed, apart from the free
+     * list pointers, and live ones are being abandoned */
+    if( arena->buf != NULL )
+        mbedtls_platform_zeroize( arena->buf, arena->used );
+
+    arena->used = 0;
+    arena->fallbacks = 0;
+    for( c = 0; c < MBEDTLS_MPI_ARENA_CLASSES; c++ )
+        arena->free_list[c] = NULL;
+}
+
+mbedtls_mpi_arena *mbedtls_mpi_arena_set( mbedtls_mpi_arena *arena )
+{
+    mbedtls_mpi_arena *prev = mpi_arena;
+
+    mpi_arena = arena;
+
+    return( prev );
+}
+
 /*
  * Initialize one MPI
  */
@@ -140,7 +412,7 @@ void mbedtls_mpi_free( mbedtls_mpi *X )
     if( X->p != NULL )
     {
         mbedtls_mpi_zeroize( X->p, X->n );
-        mbedtls_free( X->p );
+        mpi_free_limbs( X->p, X->n );
     }
 
     X->s = 1;
@@ -161,14 +433,14 @@ int mbedtls_mpi_grow( mbedtls_mpi *X, size_t nblimbs )
 
     if( X->n < nblimbs )
     {
-        if( ( p = (mbedtls_mpi_uint*)mbedtls_calloc( nblimbs, ciL ) ) == NULL )
+        if( ( p = mpi_alloc_limbs( nblimbs ) ) == NULL )
             return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
 
         if( X->p != NULL )
         {
             memcpy( p, X->p, X->n * ciL );
             mbedtls_mpi_zeroize( X->p, X->n );
-            mbedtls_free( X->p );
+            mpi_free_limbs( X->p, X->n );
         }
 
         X->n = nblimbs;
@@ -203,14 +475,14 @@ int mbedtls_mpi_shrink( mbedtls_mpi *X, size_t nblimbs )
     if( i < nblimbs )
         i = nblimbs;
 
-    if( ( p = (mbedtls_mpi_uint*)mbedtls_calloc( i, ciL ) ) == NULL )
+    if( ( p = mpi_alloc_limbs( i ) ) == NULL )
         return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
 
     if( X->p != NULL )
     {
         memcpy( p, X->p, i * ciL );
         mbedtls_mpi_zeroize( X->p, X->n );
-        mbedtls_free( X->p );
+        mpi_free_limbs( X->p, X->n );
     }
 
     X->n = i;
@@ -1974,6 +2246,355 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Montgomery context: everything exponentiation needs that depends only on
+ * the modulus, and optionally a fixed exponent
+ */
+void mbedtls_mpi_mont_init( mbedtls_mpi_mont_ctx *ctx )
+{
+    MPI_VALIDATE( ctx != NULL );
+
+    mbedtls_mpi_init( &ctx->N );
+    mbedtls_mpi_init( &ctx->RR );
+    mbedtls_mpi_init( &ctx->E );
+    ctx->mm = 0;
+    ctx->wsize = 0;
+}
+
+void mbedtls_mpi_mont_free( mbedtls_mpi_mont_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_mpi_free( &ctx->N );
+    mbedtls_mpi_free( &ctx->RR );
+    mbedtls_mpi_free( &ctx->E );
+    ctx->mm = 0;
+    ctx->wsize = 0;
+}
+
+/*
+ * Window size for an exponent of the given bit length
+ */
+static size_t mpi_window_size( size_t ebits )
+{
+    size_t wsize = ( ebits > 671 ) ? 6 : ( ebits > 239 ) ? 5 :
+                   ( ebits >  79 ) ? 4 : ( ebits >  23 ) ? 3 : 1;
+
+    if( wsize > MBEDTLS_MPI_WINDOW_SIZE )
+        wsize = MBEDTLS_MPI_WINDOW_SIZE;
+
+    return( wsize );
+}
+
+int mbedtls_mpi_mont_setup( mbedtls_mpi_mont_ctx *ctx, const mbedtls_mpi *N,
+                            const mbedtls_mpi *E )
+{
+    int ret;
+    MPI_VALIDATE_RET( ctx != NULL );
+    MPI_VALIDATE_RET( N != NULL );
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( E != NULL && mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    /* The copy has no leading zero limbs, and R is taken from its size */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &ctx->N, N ) );
+    mpi_montg_init( &ctx->mm, &ctx->N );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &ctx->RR, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &ctx->RR, ctx->N.n * 2 * biL ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->RR, &ctx->RR, &ctx->N ) );
+
+    if( E != NULL )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &ctx->E, E ) );
+        ctx->wsize = mpi_window_size( mbedtls_mpi_bitlen( E ) );
+    }
+    else
+    {
+        mbedtls_mpi_free( &ctx->E );
+        ctx->wsize = 0;
+    }
+
+cleanup:
+
+    if( ret != 0 )
+        mbedtls_mpi_mont_free( ctx );
+
+    return( ret );
+}
+
+/*
+ * Digit of E at bit position pos, wsize bits wide
+ */
+static size_t mpi_window_digit( const mbedtls_mpi *E, size_t pos, size_t wsize )
+{
+    size_t i, digit = 0;
+
+    for( i = wsize; i > 0; i-- )
+        digit = ( digit << 1 ) | (size_t) mbedtls_mpi_get_bit( E, pos + i - 1 );
+
+    return( digit );
+}
+
+/*
+ * Fixed-window exponentiation (HAC 14.82), on a Montgomery context
+ */
+static int mpi_exp_mod_fixed( mbedtls_mpi *X, const mbedtls_mpi *A,
+                              const mbedtls_mpi *E, size_t wsize,
+                              const mbedtls_mpi_mont_ctx *ctx )
+{
+    int ret;
+    size_t i, j, k, digit, ndigits, one = 1;
+    const mbedtls_mpi *N = &ctx->N;
+    mbedtls_mpi T, Apos, W[ 1 << MBEDTLS_MPI_WINDOW_SIZE ];
+    int neg;
+
+    mbedtls_mpi_init( &T ); mbedtls_mpi_init( &Apos );
+    for( i = 0; i < ( one << wsize ); i++ )
+        mbedtls_mpi_init( &W[i] );
+
+    j = N->n + 1;
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, j ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T, j * 2 ) );
+
+    /*
+     * Compensate for negative A (and correct at the end)
+     */
+    neg = ( A->s == -1 );
+    if( neg )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Apos, A ) );
+        Apos.s = 1;
+        A = &Apos;
+    }
+
+    /*
+     * W[0] = R mod N, W[1] = A * R mod N, W[i] = W[i - 1] * W[1]
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[0], &ctx->RR ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[0], j ) );
+    MBEDTLS_MPI_CHK( mpi_montred( &W[0], N, ctx->mm, &T ) );
+
+    if( mbedtls_mpi_cmp_mpi( A, N ) >= 0 )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &W[1], A, N ) );
+    else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[1], A ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[1], j ) );
+    MBEDTLS_MPI_CHK( mpi_montmul( &W[1], &ctx->RR, N, ctx->mm, &T ) );
+
+    for( i = 2; i < ( one << wsize ); i++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[i], j ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[i], &W[i - 1] ) );
+        MBEDTLS_MPI_CHK( mpi_montmul( &W[i], &W[1], N, ctx->mm, &T ) );
+    }
+
+    /*
+     * Digits from the most significant, skipping the multiplication for
+     * zero digits: the time taken depends on E, as for
+     * mbedtls_mpi_exp_mod(), but not on A
+     */
+    ndigits = ( mbedtls_mpi_bitlen( E ) + wsize - 1 ) / wsize;
+    digit = ( ndigits > 0 ) ? mpi_window_digit( E, ( ndigits - 1 ) * wsize, wsize ) : 0;
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &W[digit] ) );
+
+    for( k = ndigits - ( ndigits > 0 ); k > 0; k-- )
+    {
+        for( i = 0; i < wsize; i++ )
+            MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, ctx->mm, &T ) );
+
+        digit = mpi_window_digit( E, ( k - 1 ) * wsize, wsize );
+        if( digit != 0 )
+            MBEDTLS_MPI_CHK( mpi_montmul( X, &W[digit], N, ctx->mm, &T ) );
+    }
+
+    /*
+     * X = A^E * R * R^-1 mod N = A^E mod N
+     */
+    MBEDTLS_MPI_CHK( mpi_montred( X, N, ctx->mm, &T ) );
+
+    if( neg && E->n != 0 && ( E->p[0] & 1 ) != 0 )
+    {
+        X->s = -1;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( X, N, X ) );
+    }
+
+cleanup:
+
+    for( i = 0; i < ( one << wsize ); i++ )
+        mbedtls_mpi_free( &W[i] );
+
+    mbedtls_mpi_free( &T ); mbedtls_mpi_free( &Apos );
+
+    return( ret );
+}
+
+int mbedtls_mpi_exp_mod_ctx( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi *E,
+                             const mbedtls_mpi_mont_ctx *ctx )
+{
+    MPI_VALIDATE_RET( X != NULL );
+    MPI_VALIDATE_RET( A != NULL );
+    MPI_VALIDATE_RET( ctx != NULL );
+
+    if( ctx->N.p == NULL )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( E == NULL )
+    {
+        if( ctx->wsize == 0 )
+            return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+        return( mpi_exp_mod_fixed( X, A, &ctx->E, ctx->wsize, ctx ) );
+    }
+
+    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    return( mpi_exp_mod_fixed( X, A, E, mpi_window_size( mbedtls_mpi_bitlen( E ) ), ctx ) );
+}
+
+/*
+ * Batch exponentiation: each thread takes every threads'th item, and
+ * keeps the first error it meets
+ */
+typedef struct
+{
+    mbedtls_mpi *X;
+    const mbedtls_mpi *A;
+    size_t count;
+    size_t first;
+    size_t step;
+    const mbedtls_mpi_mont_ctx *ctx;
+    int ret;
+}
+mpi_exp_mod_job;
+
+static void mpi_exp_mod_run( mpi_exp_mod_job *job )
+{
+    size_t i;
+    int ret;
+
+    job->ret = 0;
+    for( i = job->first; i < job->count; i += job->step )
+    {
+        ret = mpi_exp_mod_fixed( &job->X[i], &job->A[i], &job->ctx->E,
+                                 job->ctx->wsize, job->ctx );
+        if( ret != 0 && job->ret == 0 )
+            job->ret = ret;
+    }
+}
+
+#if defined(MPI_HAVE_THREADS)
+#if defined(_WIN32)
+static DWORD WINAPI mpi_exp_mod_thread( LPVOID job )
+{
+    mpi_exp_mod_run( (mpi_exp_mod_job *) job );
+    return( 0 );
+}
+#else
+static void *mpi_exp_mod_thread( void *job )
+{
+    mpi_exp_mod_run( (mpi_exp_mod_job *) job );
+    return( NULL );
+}
+#endif
+#endif /* MPI_HAVE_THREADS */
+
+int mbedtls_mpi_exp_mod_batch( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               size_t count, const mbedtls_mpi_mont_ctx *ctx,
+                               int threads )
+{
+    int ret = 0;
+    size_t i, started = 0;
+    mpi_exp_mod_job *jobs;
+#if defined(MPI_HAVE_THREADS)
+#if defined(_WIN32)
+    HANDLE *handles;
+#else
+    pthread_t *handles;
+#endif
+#endif
+    MPI_VALIDATE_RET( count == 0 || X != NULL );
+    MPI_VALIDATE_RET( count == 0 || A != NULL );
+    MPI_VALIDATE_RET( ctx != NULL );
+
+    if( ctx->N.p == NULL || ctx->wsize == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( threads < 1 )
+        threads = 1;
+    if( (size_t) threads > count )
+        threads = ( count > 0 ) ? (int) count : 1;
+
+    jobs = (mpi_exp_mod_job *) mbedtls_calloc( threads, sizeof( mpi_exp_mod_job ) );
+    if( jobs == NULL )
+        return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+
+    for( i = 0; i < (size_t) threads; i++ )
+    {
+        jobs[i].X = X;
+        jobs[i].A = A;
+        jobs[i].count = count;
+        jobs[i].first = i;
+        jobs[i].step = threads;
+        jobs[i].ctx = ctx;
+        jobs[i].ret = 0;
+    }
+
+#if defined(MPI_HAVE_THREADS)
+    /* The calling thread does the first share itself */
+    handles = ( threads > 1 ) ?
+        mbedtls_calloc( threads - 1, sizeof( *handles ) ) : NULL;
+    if( handles != NULL )
+    {
+        for( started = 0; started < (size_t) threads - 1; started++ )
+        {
+#if defined(_WIN32)
+            handles[started] = CreateThread( NULL, 0, mpi_exp_mod_thread,
+                                             &jobs[started + 1], 0, NULL );
+            if( handles[started] == NULL )
+                break;
+#else
+            if( pthread_create( &handles[started], NULL, mpi_exp_mod_thread,
+                                &jobs[started + 1] ) != 0 )
+                break;
+#endif
+        }
+    }
+#endif /* MPI_HAVE_THREADS */
+
+    mpi_exp_mod_run( &jobs[0] );
+
+    /* Anything no thread was started for is done here */
+    for( i = started + 1; i < (size_t) threads; i++ )
+        mpi_exp_mod_run( &jobs[i] );
+
+#if defined(MPI_HAVE_THREADS)
+    for( i = 0; i < started; i++ )
+    {
+#if defined(_WIN32)
+        WaitForSingleObject( handles[i], INFINITE );
+        CloseHandle( handles[i] );
+#else
+        pthread_join( handles[i], NULL );
+#endif
+    }
+    mbedtls_free( handles );
+#endif /* MPI_HAVE_THREADS */
+
+    for( i = 0; i < (size_t) threads && ret == 0; i++ )
+        ret = jobs[i].ret;
+
+    mbedtls_free( jobs );
+
+    return( ret );
+}
+
 /*
  * Greatest common divisor: G = gcd(A, B)  (HAC 14.54)
  */
@@ -47,6 +47,13 @@
  */
 #define MBEDTLS_MPI_MAX_LIMBS                             10000
 
+/*
+ * Number of block size classes in an mbedtls_mpi_arena: class c holds
+ * 2^c limbs, so 15 classes cover MBEDTLS_MPI_MAX_LIMBS. Larger MPIs are
+ * allocated on the heap.
+ */
+#define MBEDTLS_MPI_ARENA_CLASSES                         15
+
 #if !defined(MBEDTLS_MPI_WINDOW_SIZE)
 /*
  * Maximum window size used for modular exponentiation. Default: 6
@@ -179,6 +186,40 @@ typedef struct mbedtls_mpi
 }
 mbedtls_mpi;
 
+/**
+ * \brief          Arena for MPI limb storage, set up in a caller-supplied
+ *                 buffer by mbedtls_mpi_arena_init(). While it is set for a
+ *                 thread with mbedtls_mpi_arena_set(), limbs are taken from
+ *                 free lists of power-of-two sized blocks carved from the
+ *                 buffer rather than from the heap.
+ */
+typedef struct mbedtls_mpi_arena
+{
+    unsigned char *buf;         /*!<  the buffer, aligned for limbs       */
+    size_t size;                /*!<  usable size of buf                  */
+    size_t used;                /*!<  bytes carved into blocks so far     */
+    size_t fallbacks;           /*!<  allocations that had to use the heap */
+    void *free_list[MBEDTLS_MPI_ARENA_CLASSES]; /*!<  freed blocks        */
+}
+mbedtls_mpi_arena;
+
+/**
+ * \brief          Montgomery context, holding everything modular
+ *                 exponentiation needs that depends only on the modulus,
+ *                 and optionally a fixed exponent. Set up once per key with
+ *                 mbedtls_mpi_mont_setup(), it can be shared by any number
+ *                 of threads calling mbedtls_mpi_exp_mod_ctx() at once.
+ */
+typedef struct mbedtls_mpi_mont_ctx
+{
+    mbedtls_mpi N;              /*!<  modulus                             */
+    mbedtls_mpi RR;             /*!<  R^2 mod N, with R = 2^(biL * N.n)   */
+    mbedtls_mpi E;              /*!<  fixed exponent, if wsize != 0       */
+    mbedtls_mpi_uint mm;        /*!<  -N^-1 mod 2^biL                     */
+    size_t wsize;               /*!<  window size for E, or 0 if no E     */
+}
+mbedtls_mpi_mont_ctx;
+
 /**
  * \brief           Initialize an MPI context.
  *
@@ -788,6 +829,133 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
                          const mbedtls_mpi *E, const mbedtls_mpi *N,
                          mbedtls_mpi *_RR );
 
+/**
+ * \brief          Set up an arena for MPI limbs in the buffer \p buf.
+ *
+ * \param arena    The arena to set up. This must not be \c NULL.
+ * \param buf      The memory to allocate from. It must stay valid while the
+ *                 arena is in use.
+ * \param size     The size of \p buf in bytes. A few kilobytes suffice for
+ *                 2048-bit RSA; the arena's \c used field after a typical
+ *                 operation shows how much is needed.
+ */
+void mbedtls_mpi_arena_init( mbedtls_mpi_arena *arena, void *buf, size_t size );
+
+/**
+ * \brief          Zeroize everything allocated from an arena and make all
+ *                 of it available again.
+ *
+ * \param arena    The arena to reset. Any MPIs still using memory from it
+ *                 must not be used or freed afterwards, other than by
+ *                 mbedtls_mpi_init().
+ */
+void mbedtls_mpi_arena_reset( mbedtls_mpi_arena *arena );
+
+/**
+ * \brief          Make \p arena the one the calling thread allocates MPI
+ *                 limbs from, or go back to the heap if it is \c NULL.
+ *
+ *                 An MPI with limbs from an arena must be freed while that
+ *                 arena is set for the thread, or the arena reset. If the
+ *                 arena runs out of space, limbs come from the heap as
+ *                 usual and its \c fallbacks count goes up.
+ *
+ * \note           The arena is per thread where the compiler supports
+ *                 thread-local storage (define MBEDTLS_MPI_THREAD_LOCAL to
+ *                 the keyword for others), and must only be set for one
+ *                 thread at a time. The threads started by
+ *                 mbedtls_mpi_exp_mod_batch() use the heap.
+ *
+ * \param arena    The arena, set up with mbedtls_mpi_arena_init(), or
+ *                 \c NULL.
+ *
+ * \return         The arena that was set before, or \c NULL.
+ */
+mbedtls_mpi_arena *mbedtls_mpi_arena_set( mbedtls_mpi_arena *arena );
+
+/**
+ * \brief          Initialize a Montgomery context.
+ *
+ * \param ctx      The context to initialize. This must not be \c NULL.
+ */
+void mbedtls_mpi_mont_init( mbedtls_mpi_mont_ctx *ctx );
+
+/**
+ * \brief          Free the components of a Montgomery context.
+ *
+ * \param ctx      The context to be cleared. This may be \c NULL,
+ *                 in which case this function is a no-op.
+ */
+void mbedtls_mpi_mont_free( mbedtls_mpi_mont_ctx *ctx );
+
+/**
+ * \brief          Set up a Montgomery context for the modulus \p N,
+ *                 computing R^2 mod N and the Montgomery constant once
+ *                 rather than on every exponentiation.
+ *
+ * \param ctx      The context to set up. This must point to an initialized
+ *                 context.
+ * \param N        The modulus. This must point to an initialized MPI.
+ * \param E        A fixed exponent for mbedtls_mpi_exp_mod_ctx() and
+ *                 mbedtls_mpi_exp_mod_batch() to use, such as the public
+ *                 exponent of an RSA key. This may be \c NULL.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \c N is negative or
+ *                 even, or if \c E is negative.
+ */
+int mbedtls_mpi_mont_setup( mbedtls_mpi_mont_ctx *ctx, const mbedtls_mpi *N,
+                            const mbedtls_mpi *E );
+
+/**
+ * \brief          Perform a modular exponentiation: X = A^E mod N, using
+ *                 the modulus of a Montgomery context and a fixed window.
+ *
+ * \param X        The destination MPI. This must point to an initialized MPI.
+ * \param A        The base of the exponentiation.
+ *                 This must point to an initialized MPI.
+ * \param E        The exponent MPI, or \c NULL to use the context's fixed
+ *                 exponent.
+ * \param ctx      The Montgomery context, set up with
+ *                 mbedtls_mpi_mont_setup(). It is not modified.
+ *
+ * \note           The time taken depends on \p E, but not on \p A.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \c E is negative, or
+ *                 \c NULL and the context has no fixed exponent.
+ */
+int mbedtls_mpi_exp_mod_ctx( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi *E,
+                             const mbedtls_mpi_mont_ctx *ctx );
+
+/**
+ * \brief          Perform \p count modular exponentiations with the fixed
+ *                 exponent of a Montgomery context: X[i] = A[i]^E mod N,
+ *                 spread across \p threads threads (including the
+ *                 calling one). This verifies a batch of RSA signatures
+ *                 made with one key, say.
+ *
+ * \param X        An array of \p count initialized MPIs for the results.
+ * \param A        An array of \p count initialized MPIs for the bases.
+ * \param count    The number of exponentiations.
+ * \param ctx      The Montgomery context, set up with
+ *                 mbedtls_mpi_mont_setup() with a fixed exponent.
+ * \param threads  The number of threads to use. Without thread support
+ *                 (see MBEDTLS_MPI_NO_THREADS), or if threads can't be
+ *                 started, everything is done on the calling thread.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if the context has no
+ *                 fixed exponent.
+ */
+int mbedtls_mpi_exp_mod_batch( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               size_t count, const mbedtls_mpi_mont_ctx *ctx,
+                               int threads );
+
 /**
  * \brief          Fill an MPI with a number of random bytes.
  *
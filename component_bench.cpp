@@ -0,0 +1,975 @@
+// Runs each library in this tree over a fixed corpus the way an application
+// would, whole files at a time, and reports throughput, heap allocations and
+// peak heap use for each. Results can be written as JSON and checked against
+// an earlier run, so that updating one of the vendored libraries can't make
+// it slower, or hungrier, without anyone noticing. kernel_bench times the
+// inner loops alone; this times everything around them too.
+//
+//     component_bench [-corpus dir] [-ms n] [-reps n] [-json file]
+//             [-baseline file] [-tolerance percent] [name...]
+//
+// The built-in corpus is generated, so it is the same on every machine: tone
+// and noise for the audio components, a gradient-and-noise image encoded as
+// PNG and JPEG for stb_image, 16 MB of pseudo-random bytes for sha256, and
+// gme's test.nsf. Files in -corpus are added to it by extension: music files
+// gme recognizes, .wav, .png and .jpg, and anything else is hashed as a ROM.
+// The JSON records a hash of the corpus, and comparing against a baseline
+// made from a different corpus gives a warning, as the numbers don't compare.
+//
+// Throughput is the best of -reps repetitions of at least -ms milliseconds.
+// Allocations and peak heap are from one run, counted from when it starts;
+// with glibc every malloc is counted, through the functions defined below,
+// and elsewhere only operator new and the allocators of SoundTouch, stb and
+// dr_wav. With -baseline, components whose throughput dropped, or whose
+// allocation count or peak heap grew, by more than -tolerance percent (10 by
+// default) are listed, and the exit status is 1.
+//
+// Build with the tree's root, gme, SoundTouch and rubberband directories in
+// the include path, linking the gme, SoundTouch and rubberband libraries and
+// sha256.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#if defined (__GLIBC__)
+	#define BENCH_COUNT_MALLOC 1
+	#include <malloc.h>
+	#include <errno.h>
+#else
+	// Count what the C libraries allocate, which can't be seen otherwise
+	static void* bench_malloc( size_t );
+	static void* bench_realloc( void*, size_t );
+	static void  bench_free( void* );
+	#define STBI_MALLOC( n )            bench_malloc( n )
+	#define STBI_REALLOC( p, n )        bench_realloc( p, n )
+	#define STBI_FREE( p )              bench_free( p )
+	#define STBIW_MALLOC( n )           bench_malloc( n )
+	#define STBIW_REALLOC( p, n )       bench_realloc( p, n )
+	#define STBIW_FREE( p )             bench_free( p )
+	#define DRWAV_MALLOC( n )           bench_malloc( n )
+	#define DRWAV_REALLOC( p, n )       bench_realloc( p, n )
+	#define DRWAV_FREE( p )             bench_free( p )
+#endif
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+#define DR_WAV_IMPLEMENTATION
+#include "dr_wav.h"
+#define RESAMPLER_IMPLEMENTATION
+#include "resampler.h"
+#include "sha256.h"
+
+#include "gme/gme.h"
+#include "SoundTouch.h"
+#include "rubberband/RubberBandStretcher.h"
+
+#if defined (_WIN32)
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <time.h>
+	#include <dirent.h>
+	#include <sys/resource.h>
+#endif
+
+static double now_sec()
+{
+#if defined (_WIN32)
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency( &freq );
+	QueryPerformanceCounter( &count );
+	return (double) count.QuadPart / (double) freq.QuadPart;
+#else
+	timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// Heap counters
+
+static long long heap_count; // allocations
+static long long heap_total; // bytes allocated
+static long long heap_live;  // bytes allocated and not yet freed
+static long long heap_peak;  // highest heap_live since heap_reset()
+
+static long long atomic_add( long long* p, long long n )
+{
+#if defined (_MSC_VER)
+	return _InterlockedExchangeAdd64( p, n ) + n;
+#else
+	return __atomic_add_fetch( p, n, __ATOMIC_RELAXED );
+#endif
+}
+
+static void note_alloc( size_t n )
+{
+	atomic_add( &heap_count, 1 );
+	atomic_add( &heap_total, (long long) n );
+	long long live = atomic_add( &heap_live, (long long) n );
+	// a lost race only loses a peak another thread was also raising
+	if ( live > heap_peak )
+		heap_peak = live;
+}
+
+static void note_free( size_t n )
+{
+	atomic_add( &heap_live, -(long long) n );
+}
+
+static void heap_reset()
+{
+	heap_count = 0;
+	heap_total = 0;
+	heap_peak  = heap_live;
+}
+
+#if BENCH_COUNT_MALLOC
+
+// Wrap glibc's allocator, which everything in the process, operator new
+// included, ends up in
+extern "C" {
+	void* __libc_malloc( size_t );
+	void* __libc_calloc( size_t, size_t );
+	void* __libc_realloc( void*, size_t );
+	void* __libc_memalign( size_t, size_t );
+	void  __libc_free( void* );
+
+	void* malloc( size_t n ) throw()
+	{
+		void* p = __libc_malloc( n );
+		if ( p )
+			note_alloc( malloc_usable_size( p ) );
+		return p;
+	}
+
+	void* calloc( size_t n, size_t size ) throw()
+	{
+		void* p = __libc_calloc( n, size );
+		if ( p )
+			note_alloc( malloc_usable_size( p ) );
+		return p;
+	}
+
+	void* realloc( void* old, size_t n ) throw()
+	{
+		size_t old_size = old ? malloc_usable_size( old ) : 0;
+		void* p = __libc_realloc( old, n );
+		if ( p || !n )
+		{
+			note_free( old_size );
+			if ( p )
+				note_alloc( malloc_usable_size( p ) );
+		}
+		return p;
+	}
+
+	void* memalign( size_t align, size_t n ) throw()
+	{
+		void* p = __libc_memalign( align, n );
+		if ( p )
+			note_alloc( malloc_usable_size( p ) );
+		return p;
+	}
+
+	void* aligned_alloc( size_t align, size_t n ) throw()
+	{
+		return memalign( align, n );
+	}
+
+	int posix_memalign( void** out, size_t align, size_t n ) throw()
+	{
+		void* p = memalign( align, n );
+		if ( !p )
+			return ENOMEM;
+		*out = p;
+		return 0;
+	}
+
+	void free( void* p ) throw()
+	{
+		if ( p )
+			note_free( malloc_usable_size( p ) );
+		__libc_free( p );
+	}
+}
+
+#else
+
+// Sizes are kept in front of each block, to be taken off again when it's freed
+const size_t header_size = 16;
+
+static void* bench_malloc( size_t n )
+{
+	char* p = (char*) ::malloc( n + header_size );
+	if ( !p )
+		return NULL;
+	*(size_t*) p = n;
+	note_alloc( n );
+	return p + header_size;
+}
+
+static void bench_free( void* p )
+{
+	if ( !p )
+		return;
+	char* block = (char*) p - header_size;
+	note_free( *(size_t*) block );
+	::free( block );
+}
+
+static void* bench_realloc( void* old, size_t n )
+{
+	if ( !old )
+		return bench_malloc( n );
+	char* block = (char*) old - header_size;
+	size_t old_size = *(size_t*) block;
+	char* p = (char*) ::realloc( block, n + header_size );
+	if ( !p )
+		return NULL;
+	note_free( old_size );
+	note_alloc( n );
+	*(size_t*) p = n;
+	return p + header_size;
+}
+
+static void* bench_aligned_alloc( size_t n, size_t align, void* )
+{
+	char* raw = (char*) bench_malloc( n + align + sizeof (void*) );
+	if ( !raw )
+		return NULL;
+	char* p = (char*) (((size_t) raw + sizeof (void*) + align - 1) & ~(align - 1));
+	((void**) p) [-1] = raw;
+	return p;
+}
+
+static void bench_aligned_free( void* p, void* )
+{
+	if ( p )
+		bench_free( ((void**) p) [-1] );
+}
+
+void* operator new ( size_t n )
+{
+	void* p = bench_malloc( n ? n : 1 );
+	if ( !p )
+		throw std::bad_alloc();
+	return p;
+}
+
+void* operator new [] ( size_t n )      { return operator new ( n ); }
+void operator delete ( void* p ) throw()    { bench_free( p ); }
+void operator delete [] ( void* p ) throw() { bench_free( p ); }
+
+#endif
+
+// Peak resident size of the whole process, in KB
+static long peak_rss_kb()
+{
+#if defined (_WIN32)
+	PROCESS_MEMORY_COUNTERS pmc;
+	if ( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof pmc ) )
+		return (long) (pmc.PeakWorkingSetSize / 1024);
+	return 0;
+#else
+	rusage usage;
+	if ( getrusage( RUSAGE_SELF, &usage ) )
+		return 0;
+	#if defined (__APPLE__)
+		return usage.ru_maxrss / 1024;
+	#else
+		return usage.ru_maxrss;
+	#endif
+#endif
+}
+
+// Corpus
+
+typedef std::vector<unsigned char> bytes_t;
+
+static bool read_file( const char* path, bytes_t& out )
+{
+	FILE* in = fopen( path, "rb" );
+	if ( !in )
+		return false;
+	out.clear();
+	unsigned char buf [65536];
+	size_t n;
+	while ( (n = fread( buf, 1, sizeof buf, in )) > 0 )
+		out.insert( out.end(), buf, buf + n );
+	bool ok = !ferror( in );
+	fclose( in );
+	return ok;
+}
+
+static void fill_audio( float* out, long frames, int channels, int rate )
+{
+	unsigned r = 1;
+	for ( long i = 0; i < frames; i++ )
+	{
+		float tone = 0.3f * (float) sin( i * (2 * 3.14159265 * 440 / rate) );
+		for ( int c = 0; c < channels; c++ )
+		{
+			r = r * 1664525 + 1013904223;
+			out [i * channels + c] = tone + ((int) (r >> 16 & 0xFFFF) - 0x8000) * (0.1f / 0x8000);
+		}
+	}
+}
+
+static void append_bytes( void* context, void* data, int size )
+{
+	bytes_t& out = *(bytes_t*) context;
+	out.insert( out.end(), (unsigned char*) data, (unsigned char*) data + size );
+}
+
+// Gradient with noise, so neither codec has it too easy
+static void make_image( bytes_t& png, bytes_t& jpeg, int w, int h )
+{
+	std::vector<unsigned char> pixels( (size_t) w * h * 3 );
+	unsigned r = 1;
+	for ( int y = 0; y < h; y++ )
+	{
+		for ( int x = 0; x < w; x++ )
+		{
+			unsigned char* p = &pixels [((size_t) y * w + x) * 3];
+			r = r * 1664525 + 1013904223;
+			int noise = (int) (r >> 28);
+			p [0] = (unsigned char) (x * 255 / w ^ noise);
+			p [1] = (unsigned char) (y * 255 / h ^ noise);
+			p [2] = (unsigned char) ((x + y) * 127 / (w + h) + noise);
+		}
+	}
+	stbi_write_png_to_func( append_bytes, &png, w, h, 3, &pixels [0], w * 3 );
+	stbi_write_jpg_to_func( append_bytes, &jpeg, w, h, 3, &pixels [0], 90 );
+}
+
+static void make_wav( bytes_t& out, long frames, int rate )
+{
+	std::vector<float> audio( frames * 2 );
+	fill_audio( &audio [0], frames, 2, rate );
+	std::vector<drwav_int16> pcm( frames * 2 );
+	drwav_f32_to_s16( &pcm [0], &audio [0], pcm.size() );
+
+	drwav_data_format format;
+	format.container     = drwav_container_riff;
+	format.format        = DR_WAVE_FORMAT_PCM;
+	format.channels      = 2;
+	format.sampleRate    = rate;
+	format.bitsPerSample = 16;
+	void* data = NULL;
+	size_t size = 0;
+	drwav wav;
+	if ( !drwav_init_memory_write( &wav, &data, &size, &format, NULL ) )
+		return;
+	drwav_write_pcm_frames( &wav, frames, &pcm [0] );
+	drwav_uninit( &wav );
+	out.assign( (unsigned char*) data, (unsigned char*) data + size );
+	drwav_free( data, NULL );
+}
+
+// Components
+
+// One use of a library on one input. run() does the same work each time and
+// returns how many units it got through.
+class Component {
+public:
+	std::string name;
+	const char* unit;
+	Component( std::string const& n, const char* u ) : name( n ), unit( u ) { }
+	virtual ~Component() { }
+	virtual double run() = 0;
+};
+
+// Render the first track of a music file, opened from memory each time
+class Gme_Render : public Component {
+	bytes_t data;
+	long length; // in seconds
+public:
+	Gme_Render( std::string const& n, bytes_t const& d, long sec ) :
+			Component( n, "sec" ), data( d ), length( sec ) { }
+	double run()
+	{
+		Music_Emu* emu;
+		if ( gme_open_data( &data [0], (long) data.size(), &emu, 44100 ) )
+			return 0;
+		short buf [4096];
+		double sec = 0;
+		if ( !gme_start_track( emu, 0 ) )
+		{
+			long count = length * 44100 * 2;
+			for ( long done = 0; done < count && !gme_track_ended( emu ); done += 4096 )
+			{
+				if ( gme_play( emu, 4096, buf ) )
+					break;
+				sec += 4096.0 / (44100 * 2);
+			}
+		}
+		gme_delete( emu );
+		return sec;
+	}
+};
+
+// SoundTouch at 1.25x tempo, fed and drained in blocks as a player would
+class SoundTouch_Tempo : public Component {
+	std::vector<float> in;
+	std::vector<float> out;
+public:
+	SoundTouch_Tempo( long frames ) : Component( "soundtouch.tempo", "sec" ),
+			in( frames * 2 ), out( 8192 * 2 )
+	{
+		fill_audio( &in [0], frames, 2, 44100 );
+	}
+	double run()
+	{
+		soundtouch::SoundTouch st;
+		st.setSampleRate( 44100 );
+		st.setChannels( 2 );
+		st.setTempo( 1.25 );
+		long frames = (long) in.size() / 2;
+		for ( long pos = 0; pos < frames; pos += 4096 )
+		{
+			st.putSamples( &in [pos * 2], std::min( 4096L, frames - pos ) );
+			while ( st.receiveSamples( &out [0], 8192 ) ) { }
+		}
+		st.flush();
+		while ( st.receiveSamples( &out [0], 8192 ) ) { }
+		return (double) frames / 44100;
+	}
+};
+
+// RubberBandStretcher offline, 1.5x longer: study, then process
+class Rubberband_Stretch : public Component {
+	std::vector<float> left, right;
+	std::vector<float> out_left, out_right;
+public:
+	Rubberband_Stretch( long frames ) : Component( "rubberband.offline", "sec" ),
+			left( frames ), right( frames ), out_left( 8192 ), out_right( 8192 )
+	{
+		std::vector<float> in( frames * 2 );
+		fill_audio( &in [0], frames, 2, 44100 );
+		for ( long i = 0; i < frames; i++ )
+		{
+			left [i]  = in [i * 2];
+			right [i] = in [i * 2 + 1];
+		}
+	}
+	static void drain( RubberBand::RubberBandStretcher& rb, float* const* out )
+	{
+		int n;
+		while ( (n = rb.available()) > 0 )
+			rb.retrieve( out, std::min( n, 8192 ) );
+	}
+	double run()
+	{
+		RubberBand::RubberBandStretcher rb( 44100, 2,
+				RubberBand::RubberBandStretcher::OptionProcessOffline, 1.5 );
+		long frames = (long) left.size();
+		rb.setExpectedInputDuration( frames );
+		for ( long pos = 0; pos < frames; pos += 4096 )
+		{
+			const float* in [2] = { &left [pos], &right [pos] };
+			long n = std::min( 4096L, frames - pos );
+			rb.study( in, n, pos + n >= frames );
+		}
+		float* out [2] = { &out_left [0], &out_right [0] };
+		for ( long pos = 0; pos < frames; pos += 4096 )
+		{
+			const float* in [2] = { &left [pos], &right [pos] };
+			long n = std::min( 4096L, frames - pos );
+			rb.process( in, n, pos + n >= frames );
+			drain( rb, out );
+		}
+		drain( rb, out );
+		return (double) frames / 44100;
+	}
+};
+
+// resampler_sinc 44.1 kHz to 48 kHz, stereo, in player-sized blocks
+class Sinc_Resample : public Component {
+	std::vector<float> in;
+	std::vector<float> out;
+public:
+	Sinc_Resample( long frames ) : Component( "resampler_sinc.44k_48k", "sec" ),
+			in( frames * 2 ), out( 1024 * 2 * 2 )
+	{
+		fill_audio( &in [0], frames, 2, 44100 );
+	}
+	double run()
+	{
+		resampler_sinc_config config;
+		resampler_sinc_config_preset( &config, RESAMPLER_QUALITY_NORMAL, 2 );
+		void* re = resampler_sinc_init_config( &config );
+		if ( !re )
+			return 0;
+		long frames = (long) in.size() / 2;
+		for ( long pos = 0; pos < frames; pos += 1024 )
+		{
+			resampler_data data;
+			data.data_in = &in [pos * 2];
+			data.data_out = &out [0];
+			data.input_frames = std::min( 1024L, frames - pos );
+			data.output_frames = 0;
+			data.ratio = 48000.0 / 44100;
+			resampler_sinc_process( re, &data );
+		}
+		resampler_sinc_free( re );
+		return (double) frames / 44100;
+	}
+};
+
+// Decode a whole WAVE file from memory to float
+class Drwav_Decode : public Component {
+	bytes_t data;
+	std::vector<float> out;
+public:
+	Drwav_Decode( std::string const& n, bytes_t const& d ) : Component( n, "sec" ),
+			data( d ), out( 4096 * 8 ) { }
+	double run()
+	{
+		drwav wav;
+		if ( !drwav_init_memory( &wav, &data [0], data.size(), NULL ) )
+			return 0;
+		drwav_uint64 frames = 0, n;
+		drwav_uint64 chunk = out.size() / (wav.channels ? wav.channels : 1);
+		while ( (n = drwav_read_pcm_frames_f32( &wav, chunk, &out [0] )) > 0 )
+			frames += n;
+		double sec = wav.sampleRate ? (double) frames / wav.sampleRate : 0;
+		drwav_uninit( &wav );
+		return sec;
+	}
+};
+
+// Decode an image from memory to RGBA
+class Stbi_Decode : public Component {
+	bytes_t data;
+public:
+	Stbi_Decode( std::string const& n, bytes_t const& d ) : Component( n, "Mpixel" ), data( d ) { }
+	double run()
+	{
+		int w, h, comp;
+		stbi_uc* pixels = stbi_load_from_memory( &data [0], (int) data.size(), &w, &h, &comp, 4 );
+		if ( !pixels )
+			return 0;
+		stbi_image_free( pixels );
+		return w * (double) h / 1e6;
+	}
+};
+
+// Encode an image as PNG, into memory
+class Stbiw_Png : public Component {
+	std::vector<unsigned char> pixels;
+	int w, h;
+public:
+	Stbiw_Png( bytes_t const& png ) : Component( "stb_image_write.png", "Mpixel" ), w( 0 ), h( 0 )
+	{
+		int comp;
+		stbi_uc* p = stbi_load_from_memory( &png [0], (int) png.size(), &w, &h, &comp, 3 );
+		if ( p )
+			pixels.assign( p, p + (size_t) w * h * 3 );
+		stbi_image_free( p );
+	}
+	double run()
+	{
+		if ( pixels.empty() )
+			return 0;
+		bytes_t out;
+		stbi_write_png_to_func( append_bytes, &out, w, h, 3, &pixels [0], w * 3 );
+		return w * (double) h / 1e6;
+	}
+};
+
+class Sha256_File : public Component {
+	bytes_t data;
+public:
+	Sha256_File( std::string const& n, bytes_t const& d ) : Component( n, "MB" ), data( d ) { }
+	double run()
+	{
+		SHA256_CTX ctx;
+		BYTE hash [SHA256_BLOCK_SIZE];
+		sha256_init( &ctx );
+		if ( !data.empty() )
+			sha256_update( &ctx, &data [0], data.size() );
+		sha256_final( &ctx, hash );
+		return data.size() / 1e6;
+	}
+};
+
+// Corpus hash, over each input's name and contents
+
+static SHA256_CTX corpus_ctx;
+
+static void add_to_corpus( std::string const& name, bytes_t const& data )
+{
+	sha256_update( &corpus_ctx, (const BYTE*) name.c_str(), name.size() + 1 );
+	if ( !data.empty() )
+		sha256_update( &corpus_ctx, &data [0], data.size() );
+}
+
+static std::string corpus_hash()
+{
+	BYTE hash [SHA256_BLOCK_SIZE];
+	sha256_final( &corpus_ctx, hash );
+	char hex [SHA256_BLOCK_SIZE * 2 + 1];
+	for ( int i = 0; i < SHA256_BLOCK_SIZE; i++ )
+		sprintf( hex + i * 2, "%02x", hash [i] );
+	return hex;
+}
+
+static std::string lower_ext( std::string const& name )
+{
+	size_t dot = name.rfind( '.' );
+	std::string ext = dot == std::string::npos ? "" : name.substr( dot + 1 );
+	for ( size_t i = 0; i < ext.size(); i++ )
+		ext [i] = (char) tolower( (unsigned char) ext [i] );
+	return ext;
+}
+
+static void add_file( std::vector<Component*>& list, std::string const& path, std::string const& name )
+{
+	bytes_t data;
+	if ( !read_file( path.c_str(), data ) || data.empty() )
+	{
+		fprintf( stderr, "Couldn't read %s\n", path.c_str() );
+		return;
+	}
+	add_to_corpus( name, data );
+	std::string ext = lower_ext( name );
+	if ( ext == "wav" )
+		list.push_back( new Drwav_Decode( "drwav.decode." + name, data ) );
+	else if ( ext == "png" || ext == "jpg" || ext == "jpeg" )
+		list.push_back( new Stbi_Decode( "stb_image.decode." + name, data ) );
+	else if ( data.size() >= 4 && *gme_identify_header( &data [0] ) )
+		list.push_back( new Gme_Render( "gme." + name, data, 60 ) );
+	else
+		list.push_back( new Sha256_File( "sha256." + name, data ) );
+}
+
+static void add_corpus_dir( std::vector<Component*>& list, const char* dir )
+{
+	std::vector<std::string> names;
+#if defined (_WIN32)
+	WIN32_FIND_DATAA fd;
+	HANDLE h = FindFirstFileA( (std::string( dir ) + "\\*").c_str(), &fd );
+	if ( h != INVALID_HANDLE_VALUE )
+	{
+		do
+		{
+			if ( !(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) )
+				names.push_back( fd.cFileName );
+		}
+		while ( FindNextFileA( h, &fd ) );
+		FindClose( h );
+	}
+#else
+	if ( DIR* d = opendir( dir ) )
+	{
+		while ( dirent* e = readdir( d ) )
+			if ( e->d_name [0] != '.' )
+				names.push_back( e->d_name );
+		closedir( d );
+	}
+#endif
+	if ( names.empty() )
+		fprintf( stderr, "No files in %s\n", dir );
+	// sorted, so the corpus hash doesn't depend on directory order
+	std::sort( names.begin(), names.end() );
+	for ( size_t i = 0; i < names.size(); i++ )
+		add_file( list, std::string( dir ) + "/" + names [i], names [i] );
+}
+
+static void add_builtin( std::vector<Component*>& list, const char* nsf_path )
+{
+	add_to_corpus( "builtin-1", bytes_t() );
+
+	bytes_t nsf;
+	if ( read_file( nsf_path, nsf ) && !nsf.empty() )
+	{
+		add_to_corpus( "test.nsf", nsf );
+		list.push_back( new Gme_Render( "gme.nsf", nsf, 60 ) );
+	}
+	else
+	{
+		fprintf( stderr, "Couldn't read %s; gme left out\n", nsf_path );
+	}
+
+	list.push_back( new SoundTouch_Tempo( 44100 * 30 ) );
+	list.push_back( new Rubberband_Stretch( 44100 * 10 ) );
+	list.push_back( new Sinc_Resample( 44100 * 30 ) );
+
+	bytes_t wav;
+	make_wav( wav, 44100 * 30, 44100 );
+	list.push_back( new Drwav_Decode( "drwav.decode", wav ) );
+
+	bytes_t png, jpeg;
+	make_image( png, jpeg, 1024, 1024 );
+	list.push_back( new Stbi_Decode( "stb_image.decode_png", png ) );
+	list.push_back( new Stbi_Decode( "stb_image.decode_jpeg", jpeg ) );
+	list.push_back( new Stbiw_Png( png ) );
+
+	bytes_t rom( 16 << 20 );
+	unsigned r = 1;
+	for ( size_t i = 0; i < rom.size(); i++ )
+	{
+		r = r * 1664525 + 1013904223;
+		rom [i] = (unsigned char) (r >> 24);
+	}
+	list.push_back( new Sha256_File( "sha256.16mb", rom ) );
+}
+
+// Measuring
+
+struct Result {
+	Component* component;
+	double per_sec;       // units per second, best repetition
+	long long allocs;     // in one run
+	long long alloc_bytes;
+	long long peak_bytes; // heap in use at the peak, over that at the start
+};
+
+static Result measure( Component& c, int reps, double min_sec )
+{
+	Result res;
+	res.component = &c;
+
+	// first run, also the warmup, counts the heap
+	long long live = heap_live;
+	heap_reset();
+	c.run();
+	res.allocs      = heap_count;
+	res.alloc_bytes = heap_total;
+	res.peak_bytes  = heap_peak - live;
+
+	res.per_sec = 0;
+	for ( int r = 0; r < reps; r++ )
+	{
+		double units = 0;
+		double start = now_sec();
+		double elapsed;
+		do
+		{
+			units += c.run();
+			elapsed = now_sec() - start;
+		}
+		while ( elapsed < min_sec );
+		res.per_sec = std::max( res.per_sec, units / elapsed );
+	}
+	return res;
+}
+
+static void json_string( FILE* out, std::string const& s )
+{
+	fputc( '"', out );
+	for ( size_t i = 0; i < s.size(); i++ )
+	{
+		unsigned char c = (unsigned char) s [i];
+		if ( c == '"' || c == '\\' )
+			fprintf( out, "\\%c", c );
+		else if ( c < 0x20 )
+			fprintf( out, "\\u%04x", c );
+		else
+			fputc( c, out );
+	}
+	fputc( '"', out );
+}
+
+// One component per line, so a baseline can be read back without a parser
+static void write_json( FILE* out, std::vector<Result> const& results, std::string const& corpus )
+{
+	fprintf( out, "{\n  \"corpus\": \"%s\",\n  \"peak_rss_kb\": %ld,\n  \"components\": [\n",
+			corpus.c_str(), peak_rss_kb() );
+	for ( size_t i = 0; i < results.size(); i++ )
+	{
+		Result const& r = results [i];
+		fprintf( out, "    { \"name\": " );
+		json_string( out, r.component->name );
+		fprintf( out, ", \"unit\": \"%s\", \"per_sec\": %.4f, \"allocs\": %lld, "
+				"\"alloc_bytes\": %lld, \"peak_bytes\": %lld }%s\n",
+				r.component->unit, r.per_sec, r.allocs, r.alloc_bytes, r.peak_bytes,
+				i + 1 < results.size() ? "," : "" );
+	}
+	fprintf( out, "  ]\n}\n" );
+}
+
+struct Baseline {
+	std::string name;
+	double per_sec;
+	long long allocs;
+	long long peak_bytes;
+};
+
+static bool read_baseline( const char* path, std::vector<Baseline>& out, std::string& corpus )
+{
+	FILE* in = fopen( path, "r" );
+	if ( !in )
+		return false;
+	char line [4096];
+	while ( fgets( line, sizeof line, in ) )
+	{
+		char* p;
+		if ( (p = strstr( line, "\"corpus\": \"" )) != NULL )
+		{
+			p += 11;
+			corpus.assign( p, strcspn( p, "\"" ) );
+			continue;
+		}
+		if ( (p = strstr( line, "\"name\": \"" )) == NULL )
+			continue;
+		p += 9;
+		Baseline b;
+		// names with escapes don't round trip, and are just not matched
+		b.name.assign( p, strcspn( p, "\"" ) );
+		char* f;
+		b.per_sec    = (f = strstr( p, "\"per_sec\": " )) ? atof( f + 11 ) : 0;
+		b.allocs     = (f = strstr( p, "\"allocs\": " )) ? atoll( f + 10 ) : 0;
+		b.peak_bytes = (f = strstr( p, "\"peak_bytes\": " )) ? atoll( f + 14 ) : 0;
+		out.push_back( b );
+	}
+	fclose( in );
+	return true;
+}
+
+// Lists what got worse, and returns how many
+static int compare( std::vector<Result> const& results, std::vector<Baseline> const& base,
+		double tolerance )
+{
+	int regressions = 0;
+	for ( size_t i = 0; i < results.size(); i++ )
+	{
+		Result const& r = results [i];
+		for ( size_t j = 0; j < base.size(); j++ )
+		{
+			Baseline const& b = base [j];
+			if ( b.name != r.component->name )
+				continue;
+			const char* name = b.name.c_str();
+			if ( b.per_sec > 0 && r.per_sec < b.per_sec * (1 - tolerance) )
+			{
+				printf( "REGRESSION %s: %.1f %s/s, was %.1f (%+.1f%%)\n", name, r.per_sec,
+						r.component->unit, b.per_sec, (r.per_sec / b.per_sec - 1) * 100 );
+				regressions++;
+			}
+			// a few allocations more are noise, not a regression
+			if ( r.allocs > b.allocs * (1 + tolerance) + 2 )
+			{
+				printf( "REGRESSION %s: %lld allocations, was %lld\n", name, r.allocs, b.allocs );
+				regressions++;
+			}
+			if ( r.peak_bytes > b.peak_bytes * (1 + tolerance) + 4096 )
+			{
+				printf( "REGRESSION %s: peak heap %lld KB, was %lld KB\n", name,
+						r.peak_bytes / 1024, b.peak_bytes / 1024 );
+				regressions++;
+			}
+			break;
+		}
+	}
+	return regressions;
+}
+
+int main( int argc, char** argv )
+{
+	int reps = 3;
+	double min_ms = 500;
+	double tolerance = 0.10;
+	const char* json = NULL;
+	const char* baseline = NULL;
+	const char* corpus_dir = NULL;
+	const char* nsf_path = "Game_Music_Emu-0.5.2/test.nsf";
+	std::vector<const char*> names;
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( !strcmp( argv [i], "-corpus" ) && i + 1 < argc )
+			corpus_dir = argv [++i];
+		else if ( !strcmp( argv [i], "-nsf" ) && i + 1 < argc )
+			nsf_path = argv [++i];
+		else if ( !strcmp( argv [i], "-reps" ) && i + 1 < argc )
+			reps = std::max( 1, atoi( argv [++i] ) );
+		else if ( !strcmp( argv [i], "-ms" ) && i + 1 < argc )
+			min_ms = std::max( 1.0, atof( argv [++i] ) );
+		else if ( !strcmp( argv [i], "-json" ) && i + 1 < argc )
+			json = argv [++i];
+		else if ( !strcmp( argv [i], "-baseline" ) && i + 1 < argc )
+			baseline = argv [++i];
+		else if ( !strcmp( argv [i], "-tolerance" ) && i + 1 < argc )
+			tolerance = std::max( 0.0, atof( argv [++i] ) / 100 );
+		else if ( argv [i] [0] == '-' )
+		{
+			fprintf( stderr, "usage: %s [-corpus dir] [-nsf file] [-ms n] [-reps n] [-json file]\n"
+					"        [-baseline file] [-tolerance percent] [name...]\n", argv [0] );
+			return EXIT_FAILURE;
+		}
+		else
+			names.push_back( argv [i] );
+	}
+
+#if !BENCH_COUNT_MALLOC
+	soundtouch::setAllocator( bench_aligned_alloc, bench_aligned_free, NULL );
+#endif
+
+	sha256_init( &corpus_ctx );
+	std::vector<Component*> list;
+	add_builtin( list, nsf_path );
+	if ( corpus_dir )
+		add_corpus_dir( list, corpus_dir );
+	std::string corpus = corpus_hash();
+
+	printf( "%-32s %14s %10s %10s %12s\n", "component", "per sec", "allocs", "alloc KB", "peak KB" );
+	std::vector<Result> results;
+	for ( size_t i = 0; i < list.size(); i++ )
+	{
+		Component& c = *list [i];
+		int wanted = names.empty();
+		for ( size_t n = 0; n < names.size(); n++ )
+			wanted |= strstr( c.name.c_str(), names [n] ) != NULL;
+		if ( !wanted )
+			continue;
+
+		Result r = measure( c, reps, min_ms / 1000 );
+		results.push_back( r );
+		printf( "%-32.32s %9.1f %-6s %8lld %10lld %12lld\n", c.name.c_str(), r.per_sec,
+				c.unit, r.allocs, r.alloc_bytes / 1024, r.peak_bytes / 1024 );
+		fflush( stdout );
+	}
+	printf( "peak resident %ld KB\n", peak_rss_kb() );
+
+	int status = 0;
+	if ( baseline )
+	{
+		std::vector<Baseline> base;
+		std::string base_corpus;
+		if ( !read_baseline( baseline, base, base_corpus ) )
+		{
+			perror( baseline );
+			return EXIT_FAILURE;
+		}
+		if ( base_corpus != corpus )
+			printf( "warning: baseline was made with a different corpus\n" );
+		int n = compare( results, base, tolerance );
+		printf( "%d regression%s against %s\n", n, n == 1 ? "" : "s", baseline );
+		if ( n )
+			status = 1;
+	}
+
+	if ( json )
+	{
+		FILE* out = fopen( json, "w" );
+		if ( !out )
+		{
+			perror( json );
+			return EXIT_FAILURE;
+		}
+		write_json( out, results, corpus );
+		fclose( out );
+	}
+
+	for ( size_t i = 0; i < list.size(); i++ )
+		delete list [i];
+	return status;
+}
@@ -0,0 +1,303 @@
+/* cpu_features.h - run-time CPU feature detection and kernel dispatch
+ *
+ * One place for the SIMD code in this tree (resampler.h, dr_wav.h,
+ * sha256.c, aes-min.c, SoundTouch, Game_Music_Emu) to ask which
+ * instruction set extensions it may use, so that they all agree and can
+ * all be steered from one environment variable.
+ *
+ * cpu_features() returns the CPU_FEATURE_* bits that are both present in
+ * the CPU and enabled by the OS (for AVX and AVX-512, that the OS saves
+ * the register state), detected on the first call. The x86 checks are
+ * the same ones Xbyak::util::Cpu makes, usable from C.
+ *
+ * Setting CPU_FEATURES in the environment restricts the result, for
+ * testing each kernel on a machine that has a better one:
+ *
+ *    CPU_FEATURES=none          portable code only
+ *    CPU_FEATURES=sse2,ssse3    at most these
+ *    CPU_FEATURES=-avx512f      everything detected but AVX-512
+ *
+ * Names are those of cpu_feature_names below, separated by commas or
+ * spaces. Features the CPU lacks are never added, and removing one
+ * removes the features that depend on it (-avx also removes fma, avx2
+ * and AVX-512).
+ *
+ * A kernel table lists alternatives best first, with the portable one,
+ * needing no features, last:
+ *
+ *    static const cpu_kernel blocks_kernels[] = {
+ *       { "shani", CPU_FEATURE_SHA | CPU_FEATURE_SSE41, (cpu_func)blocks_shani },
+ *       { "c",     0,                                    (cpu_func)blocks_c }
+ *    };
+ *    blocks = (blocks_fn)cpu_select(blocks_kernels,
+ *       sizeof(blocks_kernels) / sizeof(blocks_kernels[0]))->func;
+ *
+ * Everything here is static to the including file. Each file detects once
+ * and caches the result; threads racing through the first call all store
+ * the same value. This header is C89, and may be included from C++.
+ */
+
+#ifndef __CPU_FEATURES_H__
+#define __CPU_FEATURES_H__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CPU_FEATURES_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)
+#define CPU_FEATURES_ARM 1
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__) && !defined(__ANDROID__) || defined(__ANDROID_API__) && __ANDROID_API__ >= 18
+#include <sys/auxv.h>
+#define CPU_FEATURES_AUXV 1
+#endif
+#endif
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define CPU_FEATURES_API static __inline
+#elif defined(__GNUC__)
+#define CPU_FEATURES_API static __inline__ __attribute__((unused))
+#else
+#define CPU_FEATURES_API static inline
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CPU_FEATURE_SSE2     (1u << 0)
+#define CPU_FEATURE_SSSE3    (1u << 1)
+#define CPU_FEATURE_SSE41    (1u << 2)
+#define CPU_FEATURE_SSE42    (1u << 3)
+#define CPU_FEATURE_AVX      (1u << 4)
+#define CPU_FEATURE_FMA      (1u << 5)  /* FMA3 */
+#define CPU_FEATURE_AVX2     (1u << 6)
+#define CPU_FEATURE_AVX512F  (1u << 7)
+#define CPU_FEATURE_AVX512BW (1u << 8)
+#define CPU_FEATURE_PCLMUL   (1u << 9)
+#define CPU_FEATURE_NEON     (1u << 10)
+#define CPU_FEATURE_AES      (1u << 11) /* AES-NI, or the ARMv8 AES instructions */
+#define CPU_FEATURE_SHA      (1u << 12) /* SHA extensions, or the ARMv8 SHA-2 instructions */
+
+typedef void (*cpu_func)(void);
+
+typedef struct cpu_kernel
+{
+	const char *name;
+	unsigned needs;  /* CPU_FEATURE_* bits */
+	cpu_func func;
+} cpu_kernel;
+
+static const struct { const char *name; unsigned feature; } cpu_feature_names[] = {
+	{ "sse2",     CPU_FEATURE_SSE2 },
+	{ "ssse3",    CPU_FEATURE_SSSE3 },
+	{ "sse41",    CPU_FEATURE_SSE41 },
+	{ "sse42",    CPU_FEATURE_SSE42 },
+	{ "avx",      CPU_FEATURE_AVX },
+	{ "fma",      CPU_FEATURE_FMA },
+	{ "avx2",     CPU_FEATURE_AVX2 },
+	{ "avx512f",  CPU_FEATURE_AVX512F },
+	{ "avx512bw", CPU_FEATURE_AVX512BW },
+	{ "pclmul",   CPU_FEATURE_PCLMUL },
+	{ "neon",     CPU_FEATURE_NEON },
+	{ "aes",      CPU_FEATURE_AES },
+	{ "sha",      CPU_FEATURE_SHA }
+};
+
+#if CPU_FEATURES_X86
+CPU_FEATURES_API void cpu_features_cpuid(unsigned leaf, unsigned regs[4])
+{
+#if defined(_MSC_VER)
+	__cpuidex((int*)regs, (int)leaf, 0);
+#else
+	__cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+CPU_FEATURES_API unsigned cpu_features_detect(void)
+{
+	unsigned regs[4], ecx1, edx1, ebx7 = 0, max, features = 0;
+	unsigned xcr0 = 0;
+
+	cpu_features_cpuid(0, regs);
+	max = regs[0];
+	if (max < 1)
+		return 0;
+	cpu_features_cpuid(1, regs);
+	ecx1 = regs[2];
+	edx1 = regs[3];
+	if (max >= 7)
+	{
+		cpu_features_cpuid(7, regs);
+		ebx7 = regs[1];
+	}
+	if (ecx1 & (1u << 27)) /* OSXSAVE, so XGETBV works */
+	{
+#if defined(_MSC_VER)
+		xcr0 = (unsigned)_xgetbv(0);
+#else
+		unsigned hi;
+		__asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0), "=d"(hi) : "c"(0));
+#endif
+	}
+
+	if (!(edx1 & (1u << 26)))
+		return 0;
+	features |= CPU_FEATURE_SSE2;
+	if (ecx1 & (1u << 9))  features |= CPU_FEATURE_SSSE3;
+	if (ecx1 & (1u << 19)) features |= CPU_FEATURE_SSE41;
+	if (ecx1 & (1u << 20)) features |= CPU_FEATURE_SSE42;
+	if (ecx1 & (1u << 1))  features |= CPU_FEATURE_PCLMUL;
+	if (ecx1 & (1u << 25)) features |= CPU_FEATURE_AES;
+	if (ebx7 & (1u << 29)) features |= CPU_FEATURE_SHA;
+	/* AVX needs the OS to save the XMM and YMM state, AVX-512 the
+	 * opmask and ZMM state as well */
+	if ((ecx1 & (1u << 28)) && (xcr0 & 0x06) == 0x06)
+	{
+		features |= CPU_FEATURE_AVX;
+		if (ecx1 & (1u << 12)) features |= CPU_FEATURE_FMA;
+		if (ebx7 & (1u << 5))  features |= CPU_FEATURE_AVX2;
+		if ((ebx7 & (1u << 16)) && (xcr0 & 0xe0) == 0xe0)
+		{
+			features |= CPU_FEATURE_AVX512F;
+			if (ebx7 & (1u << 30)) features |= CPU_FEATURE_AVX512BW;
+		}
+	}
+	return features;
+}
+#elif CPU_FEATURES_ARM
+CPU_FEATURES_API unsigned cpu_features_detect(void)
+{
+	unsigned features = 0;
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+	features |= CPU_FEATURE_NEON; /* part of the base ARMv8 A64 instruction set */
+#endif
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO) || defined(__APPLE__) && defined(__aarch64__)
+	features |= CPU_FEATURE_AES;
+#endif
+#if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO) || defined(__APPLE__) && defined(__aarch64__)
+	features |= CPU_FEATURE_SHA;
+#endif
+#if defined(_WIN32) && defined(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE)
+	if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE))
+		features |= CPU_FEATURE_AES | CPU_FEATURE_SHA;
+#elif CPU_FEATURES_AUXV && defined(__aarch64__)
+	{
+		unsigned long hwcap = getauxval(AT_HWCAP);
+		if (hwcap & (1ul << 3)) features |= CPU_FEATURE_AES;  /* HWCAP_AES */
+		if (hwcap & (1ul << 6)) features |= CPU_FEATURE_SHA;  /* HWCAP_SHA2 */
+	}
+#elif CPU_FEATURES_AUXV
+	if (getauxval(AT_HWCAP) & (1ul << 12)) /* HWCAP_NEON */
+		features |= CPU_FEATURE_NEON;
+#endif
+	return features;
+}
+#else
+CPU_FEATURES_API unsigned cpu_features_detect(void)
+{
+	return 0;
+}
+#endif
+
+/* Applies a CPU_FEATURES override to the detected features. */
+CPU_FEATURES_API unsigned cpu_features_override(unsigned features, const char *spec)
+{
+	unsigned only = 0, removed = 0;
+	int restrict_to = 0;
+
+	while (*spec)
+	{
+		size_t len, i;
+		int remove = 0;
+
+		if (*spec == ',' || *spec == ' ')
+		{
+			spec++;
+			continue;
+		}
+		if (*spec == '-')
+		{
+			remove = 1;
+			spec++;
+		}
+		for (len = 0; spec[len] && spec[len] != ',' && spec[len] != ' '; len++);
+		if (!remove)
+			restrict_to = 1;
+		for (i = 0; i < sizeof(cpu_feature_names) / sizeof(cpu_feature_names[0]); i++)
+		{
+			if (strlen(cpu_feature_names[i].name) == len &&
+				!memcmp(cpu_feature_names[i].name, spec, len))
+			{
+				if (remove)
+					removed |= cpu_feature_names[i].feature;
+				else
+					only |= cpu_feature_names[i].feature;
+			}
+		}
+		spec += len;
+	}
+
+	if (restrict_to)
+		features &= only;
+	features &= ~removed;
+
+	/* drop whatever depends on a feature that has gone */
+	if (!(features & CPU_FEATURE_SSE2))
+		features &= CPU_FEATURE_NEON | CPU_FEATURE_AES | CPU_FEATURE_SHA;
+	if (!(features & CPU_FEATURE_AVX))
+		features &= ~(CPU_FEATURE_FMA | CPU_FEATURE_AVX2 | CPU_FEATURE_AVX512F);
+	if (!(features & CPU_FEATURE_AVX512F))
+		features &= ~CPU_FEATURE_AVX512BW;
+	return features;
+}
+
+/* The CPU_FEATURE_* bits that may be used, detected on the first call. */
+CPU_FEATURES_API unsigned cpu_features(void)
+{
+	/* bit 31 marks the cache as filled */
+	static volatile unsigned cached = 0;
+	unsigned features = cached;
+
+	if (!features)
+	{
+		const char *spec = getenv("CPU_FEATURES");
+		features = cpu_features_detect();
+		if (spec)
+			features = cpu_features_override(features, spec);
+		cached = features | (1u << 31);
+	}
+	return features & ~(1u << 31);
+}
+
+CPU_FEATURES_API int cpu_has(unsigned required)
+{
+	return (cpu_features() & required) == required;
+}
+
+/* The first entry of table whose features are all available, or the last
+ * entry if none are. */
+CPU_FEATURES_API const cpu_kernel *cpu_select(const cpu_kernel *table, size_t count)
+{
+	unsigned features = cpu_features();
+	size_t i;
+
+	for (i = 0; i + 1 < count; i++)
+		if ((table[i].needs & features) == table[i].needs)
+			break;
+	return &table[i];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -111,6 +111,18 @@ Build Options
 #define DR_WAV_NO_STDIO
   Disables APIs that initialize a decoder from a file such as `drwav_init_file()`, `drwav_init_file_write()`, etc.
 
+#define DR_WAV_NO_MMAP
+  Disables `drwav_init_file_mapped()`, which otherwise needs <windows.h> on Windows and <sys/mman.h> elsewhere. With this defined
+  it always returns false.
+
+#define DR_WAV_NO_THREADS
+  Makes `drwav_init_file_write_async()` write its buffers on the calling thread rather than a background thread. The background thread
+  otherwise uses Win32 threads on Windows and pthreads elsewhere, so you may need to link with -pthread.
+
+#define DR_WAV_NO_SIMD
+  Disables the SSE2, AVX2 and NEON sample format conversion kernels. The kernel used is otherwise chosen at run time from what the
+  CPU supports. Use DRWAV_NO_SSE2, DRWAV_NO_AVX2 or DRWAV_NO_NEON to disable only one of them.
+
 
 
 Notes
@@ -419,6 +431,24 @@ The read pointer will be sitting on the first byte after the chunk's header. You
 */
 typedef drwav_uint64 (* drwav_chunk_proc)(void* pChunkUserData, drwav_read_proc onRead, drwav_seek_proc onSeek, void* pReadSeekUserData, const drwav_chunk_header* pChunkHeader, drwav_container container, const drwav_fmt* pFMT);
 
+/*
+A unit of work handed out by drwav_read_adpcm_blocks_s16(). Call it once for each iJob from 0 to jobCount-1, passing in pJobData.
+Different jobs can be run at the same time on different threads.
+*/
+typedef void (* drwav_job_proc)(void* pJobData, drwav_uint32 iJob);
+
+/*
+Callback for running jobs, typically on a thread pool.
+
+pUserData [in] The user data that was passed to drwav_read_adpcm_blocks_s16().
+onJob     [in] The function to run for each job.
+pJobData  [in] The data to pass to onJob.
+jobCount  [in] The number of jobs.
+
+This must not return until every job has finished.
+*/
+typedef void (* drwav_run_jobs_proc)(void* pUserData, drwav_job_proc onJob, void* pJobData, drwav_uint32 jobCount);
+
 typedef struct
 {
     void* pUserData;
@@ -540,6 +570,12 @@ typedef struct
     /* Keeps track of whether or not the wav writer was initialized in sequential mode. */
     drwav_bool32 isSequentialWrite;
 
+    /*
+    Whether the writer reserved room for an RF64 "ds64" chunk in a "JUNK" chunk before the "fmt " chunk. When set, drwav_uninit()
+    turns a RIFF file whose data has outgrown the 32-bit sizes into RF64 by rewriting the header in place.
+    */
+    drwav_bool32 isRF64Reserved;
+
 
     /* smpl chunk. */
     drwav_smpl smpl;
@@ -549,6 +585,14 @@ typedef struct
     drwav__memory_stream memoryStream;
     drwav__memory_stream_write memoryStreamWrite;
 
+    /* The mapping of the whole file when opened with drwav_init_file_mapped(), which is read through memoryStream. */
+    struct
+    {
+        void* pData;
+        size_t dataSize;
+        size_t prefetchedPos;   /* The end of the range last handed to the OS for read-ahead. */
+    } mapped;
+
     /* Generic data for compressed formats. This data is shared across all block-compressed formats. */
     struct
     {
@@ -690,6 +734,46 @@ Returns true if successful; false otherwise.
 */
 DRWAV_API drwav_bool32 drwav_seek_to_pcm_frame(drwav* pWav, drwav_uint64 targetFrameIndex);
 
+/*
+Gives direct access to up to framesToMap frames at the current read position, without copying them, and moves the read position
+past them the same way drwav_read_pcm_frames() does.
+
+*ppFrames is set to the frames in the file's own sample format, exactly as drwav_read_pcm_frames() would have copied them out. The
+pointer stays valid until drwav_uninit() and is only as aligned as the data chunk is in the file.
+
+This is only possible when reading from memory (drwav_init_memory() and drwav_init_file_mapped()), for uncompressed formats and on
+little-endian hosts. Returns 0 and sets *ppFrames to NULL otherwise, in which case use drwav_read_pcm_frames().
+*/
+DRWAV_API drwav_uint64 drwav_map_pcm_frames(drwav* pWav, drwav_uint64 framesToMap, const void** ppFrames);
+
+/*
+Retrieves the number of PCM frames in each block of an MS-ADPCM or IMA ADPCM stream. Only the last block can hold fewer.
+
+Returns 0 for formats that aren't block compressed.
+
+Seeking to a multiple of this with drwav_seek_to_pcm_frame() puts the read position on a block boundary, for use with
+drwav_read_adpcm_blocks_s16(). Seeking in these formats only ever decodes from the start of the block holding the target frame.
+*/
+DRWAV_API drwav_uint32 drwav_get_pcm_frames_per_block(drwav* pWav);
+
+/*
+Decodes up to blockCount whole MS-ADPCM or IMA ADPCM blocks from the current read position as signed 16-bit PCM, one job per block.
+
+pWav       [in]  The decoder. The read position must be on a block boundary, see drwav_get_pcm_frames_per_block().
+blockCount [in]  The maximum number of blocks to decode.
+pBufferOut [out] Receives the frames. Must have room for blockCount * drwav_get_pcm_frames_per_block() frames.
+onRunJobs  [in]  Optional. Runs the decoding jobs, concurrently if it likes. When NULL the blocks are decoded one after the other.
+pUserData  [in]  Passed to onRunJobs.
+
+Returns the number of PCM frames decoded, which is less than blockCount * drwav_get_pcm_frames_per_block() at the end of the stream.
+Returns 0 for other formats and when the read position isn't on a block boundary.
+
+The blocks are read from the stream before any of them are decoded. When reading from memory (drwav_init_memory() and
+drwav_init_file_mapped()) they're decoded straight out of memory; otherwise they're read into a temporary buffer allocated with
+the decoder's allocation callbacks. Reading then carries on from the first frame after the last block.
+*/
+DRWAV_API drwav_uint64 drwav_read_adpcm_blocks_s16(drwav* pWav, drwav_uint64 blockCount, drwav_int16* pBufferOut, drwav_run_jobs_proc onRunJobs, void* pUserData);
+
 
 /*
 Writes raw audio data.
@@ -812,6 +896,23 @@ DRWAV_API void drwav_alaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size
 /* Low-level function for converting u-law samples to signed 32-bit PCM samples. */
 DRWAV_API void drwav_mulaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount);
 
+
+/*
+Reads and converts a chunk of audio data like drwav_read_pcm_frames_f32(), drwav_read_pcm_frames_s32() and drwav_read_pcm_frames_s16(),
+but into a separate buffer for each channel.
+
+pWav         [in]  The decoder.
+framesToRead [in]  The number of PCM frames to read.
+ppFramesOut  [out] One buffer per channel, pWav->channels of them, each with room for framesToRead samples.
+
+Returns the number of PCM frames actually read. If this is less than <framesToRead> the end of the file has been reached.
+
+Stereo, quad, 5.1 and 7.1 streams are deinterleaved with SSE2 or NEON where available.
+*/
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32_planar(drwav* pWav, drwav_uint64 framesToRead, float* const* ppFramesOut);
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_s32_planar(drwav* pWav, drwav_uint64 framesToRead, drwav_int32* const* ppFramesOut);
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_s16_planar(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* const* ppFramesOut);
+
 #endif  /* DR_WAV_NO_CONVERSION_API */
 
 
@@ -830,6 +931,21 @@ DRWAV_API drwav_bool32 drwav_init_file_ex(drwav* pWav, const char* filename, drw
 DRWAV_API drwav_bool32 drwav_init_file_w(drwav* pWav, const wchar_t* filename, const drwav_allocation_callbacks* pAllocationCallbacks);
 DRWAV_API drwav_bool32 drwav_init_file_ex_w(drwav* pWav, const wchar_t* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
 
+/*
+Helper for initializing a wave file for reading through a read-only memory mapping of the whole file.
+
+Nothing is read through stdio: drwav_read_pcm_frames() copies straight out of the mapping, the conversion functions such as
+drwav_read_pcm_frames_f32() convert straight from it in large blocks, and drwav_map_pcm_frames() hands out pointers into it with no
+copy at all. The OS is asked to read ahead of the current read position. The file handle is not held open.
+
+Returns false if the file can't be opened or mapped, such as a file bigger than the address space of a 32-bit build, in which case
+drwav_init_file() can be used instead.
+*/
+DRWAV_API drwav_bool32 drwav_init_file_mapped(drwav* pWav, const char* filename, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mapped_ex(drwav* pWav, const char* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mapped_w(drwav* pWav, const wchar_t* filename, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mapped_ex_w(drwav* pWav, const wchar_t* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
+
 /*
 Helper for initializing a wave file for writing using stdio.
 
@@ -843,6 +959,28 @@ DRWAV_API drwav_bool32 drwav_init_file_write_sequential_pcm_frames(drwav* pWav,
 DRWAV_API drwav_bool32 drwav_init_file_write_w(drwav* pWav, const wchar_t* filename, const drwav_data_format* pFormat, const drwav_allocation_callbacks* pAllocationCallbacks);
 DRWAV_API drwav_bool32 drwav_init_file_write_sequential_w(drwav* pWav, const wchar_t* filename, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, const drwav_allocation_callbacks* pAllocationCallbacks);
 DRWAV_API drwav_bool32 drwav_init_file_write_sequential_pcm_frames_w(drwav* pWav, const wchar_t* filename, const drwav_data_format* pFormat, drwav_uint64 totalPCMFrameCount, const drwav_allocation_callbacks* pAllocationCallbacks);
+
+/*
+Helper for initializing a wave file for writing from a thread that mustn't wait on the disk, such as an audio callback.
+
+pWav                  [out]          A pointer to the drwav object being initialized.
+filename              [in]           The file to create.
+pFormat               [in]           The format of the data to be written.
+expectedPCMFrameCount [in, optional] The number of PCM frames the recording is expected to run to. The file is allocated to that length
+                                     up front and cut back to what was actually written by drwav_uninit(). 0 to allocate as it grows.
+bufferSizeInBytes     [in, optional] The size of each of the two buffers. 0 for DRWAV_ASYNC_WRITE_BUFFER_SIZE.
+
+drwav_write_raw() and drwav_write_pcm_frames() copy into one of two buffers. When it fills up it's handed to a background thread which
+writes it to the file while the other buffer fills, so a write only waits if the disk has fallen a whole buffer behind. drwav_uninit()
+waits for everything to be written and returns DRWAV_IO_ERROR if any of it couldn't be.
+
+For drwav_container_riff the header has room for an RF64 "ds64" chunk, so a recording that outgrows the 4GB limit of RIFF is turned into
+RF64 by drwav_uninit() without rewriting any of the audio data.
+
+Without threads (DR_WAV_NO_THREADS, or a platform other than Windows and POSIX) each buffer is written by the write that fills it.
+*/
+DRWAV_API drwav_bool32 drwav_init_file_write_async(drwav* pWav, const char* filename, const drwav_data_format* pFormat, drwav_uint64 expectedPCMFrameCount, size_t bufferSizeInBytes, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_write_async_w(drwav* pWav, const wchar_t* filename, const drwav_data_format* pFormat, drwav_uint64 expectedPCMFrameCount, size_t bufferSizeInBytes, const drwav_allocation_callbacks* pAllocationCallbacks);
 #endif  /* DR_WAV_NO_STDIO */
 
 /*
@@ -941,11 +1079,70 @@ DRWAV_API drwav_bool32 drwav_fourcc_equal(const drwav_uint8* a, const char* b);
 #include <wchar.h>
 #endif
 
+#if !defined(DR_WAV_NO_STDIO) && !defined(DR_WAV_NO_MMAP)
+    #if defined(_WIN32)
+        #include <windows.h>
+        #include <io.h>     /* For _get_osfhandle() */
+        #define DRWAV_HAS_MMAP
+    #elif (defined(__unix__) || defined(__APPLE__)) && !(defined(__STRICT_ANSI__) && !defined(_POSIX_C_SOURCE))
+        /* fileno() and posix_madvise() are POSIX, so a strict ANSI build without _POSIX_C_SOURCE goes without mapping. */
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+        #define DRWAV_HAS_MMAP
+    #endif
+#endif
+
+/* How far ahead of the read position drwav_init_file_mapped() loaders ask the OS to read, and how much a conversion function converts per step from memory. */
+#ifndef DRWAV_MAPPED_PREFETCH_SIZE
+#define DRWAV_MAPPED_PREFETCH_SIZE  (4*1024*1024)
+#endif
+#define DRWAV_MAPPED_CHUNK_SIZE     (256*1024)
+
+/*
+Threads and file preallocation for drwav_init_file_write_async(). posix_fallocate() and ftruncate() are POSIX.1-2001, so they're only
+used when the C library says it has them, which rules out macOS.
+*/
+#if !defined(DR_WAV_NO_STDIO)
+    #if defined(_WIN32)
+        #include <windows.h>
+        #include <io.h>     /* For _get_osfhandle() */
+        #if !defined(DR_WAV_NO_THREADS)
+            #define DRWAV_HAS_THREADS
+        #endif
+    #elif (defined(__unix__) || defined(__APPLE__)) && !(defined(__STRICT_ANSI__) && !defined(_POSIX_C_SOURCE))
+        #if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L && !defined(__APPLE__)
+            #include <fcntl.h>
+            #include <unistd.h>
+            #define DRWAV_HAS_POSIX_FILE_SIZE
+        #endif
+        #if !defined(DR_WAV_NO_THREADS)
+            #include <pthread.h>
+            #define DRWAV_HAS_THREADS
+        #endif
+    #endif
+#endif
+
+/* The size of each of the two buffers of a drwav_init_file_write_async() writer when none is given. */
+#ifndef DRWAV_ASYNC_WRITE_BUFFER_SIZE
+#define DRWAV_ASYNC_WRITE_BUFFER_SIZE   (1024*1024)
+#endif
+
+/* The size of an RF64 "ds64" chunk with no table: the RIFF, data and sample counts and the table length. */
+#define DRWAV_DS64_CHUNK_SIZE       28
+
 /* Standard library stuff. */
 #ifndef DRWAV_ASSERT
 #include <assert.h>
 #define DRWAV_ASSERT(expression)           assert(expression)
 #endif
+/* With DRWAV_RETRO_ARENA, the default allocation callbacks use retro_arena.h, allocating from the arena set for the calling thread. */
+#ifdef DRWAV_RETRO_ARENA
+#include "retro_arena.h"
+#define DRWAV_MALLOC(sz)                   retro_arena_malloc((sz))
+#define DRWAV_REALLOC(p, sz)               retro_arena_realloc((p), (sz))
+#define DRWAV_FREE(p)                      retro_arena_free((p))
+#endif
 #ifndef DRWAV_MALLOC
 #define DRWAV_MALLOC(sz)                   malloc((sz))
 #endif
@@ -980,6 +1177,8 @@ DRWAV_API drwav_bool32 drwav_fourcc_equal(const drwav_uint8* a, const char* b);
     #define DRWAV_X86
 #elif defined(__arm__) || defined(_M_ARM)
     #define DRWAV_ARM
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define DRWAV_ARM64
 #endif
 
 #ifdef _MSC_VER
@@ -1001,6 +1200,62 @@ DRWAV_API drwav_bool32 drwav_fourcc_equal(const drwav_uint8* a, const char* b);
     #define DRWAV_INLINE
 #endif
 
+/* Intrinsics Support */
+#if !defined(DR_WAV_NO_SIMD)
+    #if defined(DRWAV_X64) || defined(DRWAV_X86)
+        #if defined(_MSC_VER) && !defined(__clang__)
+            /* MSVC. */
+            #if _MSC_VER >= 1400 && !defined(DRWAV_NO_SSE2)    /* 2005 */
+                #define DRWAV_SUPPORT_SSE2
+            #endif
+            #if _MSC_VER >= 1700 && !defined(DRWAV_NO_AVX2)    /* 2012 */
+                #define DRWAV_SUPPORT_AVX2
+            #endif
+        #elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+            /* Assume GNUC-style. */
+            #if defined(__SSE2__) && !defined(DRWAV_NO_SSE2)
+                #define DRWAV_SUPPORT_SSE2
+            #endif
+            /* The AVX2 kernels are compiled with the target attribute so they don't need -mavx2. They're only called when the CPU reports AVX2. */
+            #if defined(DRWAV_SUPPORT_SSE2) && !defined(DRWAV_NO_AVX2)
+                #define DRWAV_SUPPORT_AVX2
+                #define DRWAV_TARGET_AVX2 __attribute__((target("avx2")))
+            #endif
+        #endif
+
+        #if defined(DRWAV_SUPPORT_AVX2)
+            #include <immintrin.h>
+        #elif defined(DRWAV_SUPPORT_SSE2)
+            #include <emmintrin.h>
+        #endif
+    #endif
+
+    #if defined(DRWAV_ARM) || defined(DRWAV_ARM64)
+        #if !defined(DRWAV_NO_NEON) && (defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64))
+            #define DRWAV_SUPPORT_NEON
+            #include <arm_neon.h>
+        #endif
+    #endif
+
+    /* Which kernels the CPU can run comes from cpu_features(), so the CPU_FEATURES environment variable applies here too. */
+    #if defined(DRWAV_SUPPORT_SSE2) || defined(DRWAV_SUPPORT_AVX2) || defined(DRWAV_SUPPORT_NEON)
+        #include "cpu_features.h"
+    #endif
+#endif
+
+#ifndef DRWAV_TARGET_AVX2
+#define DRWAV_TARGET_AVX2
+#endif
+
+#if defined(__has_feature)
+    #if __has_feature(thread_sanitizer)
+        #define DRWAV_NO_THREAD_SANITIZE __attribute__((no_sanitize("thread")))
+    #endif
+#endif
+#ifndef DRWAV_NO_THREAD_SANITIZE
+#define DRWAV_NO_THREAD_SANITIZE
+#endif
+
 #if defined(SIZE_MAX)
     #define DRWAV_SIZE_MAX  SIZE_MAX
 #else
@@ -1778,6 +2033,8 @@ static drwav_bool32 drwav_init__internal(drwav* pWav, drwav_chunk_proc onChunk,
     drwav_bool32 foundDataChunk;
     drwav_uint64 dataChunkSize;
     drwav_uint64 chunkSize;
+    drwav_bool32 isRF64 = DRWAV_FALSE;
+    drwav_uint64 dataChunkSizeRF64 = 0;
 
     cursor = 0;
     sequential = (flags & DRWAV_SEQUENTIAL) != 0;
@@ -1789,10 +2046,13 @@ static drwav_bool32 drwav_init__internal(drwav* pWav, drwav_chunk_proc onChunk,
 
     /*
     The first 4 bytes can be used to identify the container. For RIFF files it will start with "RIFF" and for
-    w64 it will start with "riff".
+    w64 it will start with "riff". RF64 is RIFF with 64-bit sizes in a "ds64" chunk, which is otherwise laid out the same.
     */
     if (drwav__fourcc_equal(riff, "RIFF")) {
         pWav->container = drwav_container_riff;
+    } else if (drwav__fourcc_equal(riff, "RF64")) {
+        pWav->container = drwav_container_riff;
+        isRF64 = DRWAV_TRUE;
     } else if (drwav__fourcc_equal(riff, "riff")) {
         int i;
         drwav_uint8 riff2[12];
@@ -1834,6 +2094,29 @@ static drwav_bool32 drwav_init__internal(drwav* pWav, drwav_chunk_proc onChunk,
         if (!drwav__fourcc_equal(wave, "WAVE")) {
             return DRWAV_FALSE;    /* Expecting "WAVE". */
         }
+
+        /* RF64 requires the "ds64" chunk to come first. The size we want is the data chunk's, which comes after the RIFF size. */
+        if (isRF64) {
+            drwav_chunk_header header;
+            drwav_uint8 ds64[24];
+
+            if (drwav__read_chunk_header(pWav->onRead, pWav->pUserData, pWav->container, &cursor, &header) != DRWAV_SUCCESS) {
+                return DRWAV_FALSE;
+            }
+            if (!drwav__fourcc_equal(header.id.fourcc, "ds64") || header.sizeInBytes < sizeof(ds64)) {
+                return DRWAV_FALSE;
+            }
+            if (drwav__on_read(pWav->onRead, pWav->pUserData, ds64, sizeof(ds64), &cursor) != sizeof(ds64)) {
+                return DRWAV_FALSE;
+            }
+
+            dataChunkSizeRF64 = drwav__bytes_to_u64(ds64 + 8);
+
+            if (!drwav__seek_forward(pWav->onSeek, header.sizeInBytes - sizeof(ds64) + header.paddingSize, pWav->pUserData)) {
+                return DRWAV_FALSE;
+            }
+            cursor += header.sizeInBytes - sizeof(ds64) + header.paddingSize;
+        }
     } else {
         drwav_uint8 chunkSizeBytes[8];
         drwav_uint8 wave[16];
@@ -1904,6 +2187,12 @@ static drwav_bool32 drwav_init__internal(drwav* pWav, drwav_chunk_proc onChunk,
             }
         }
 
+        /* In RF64 files the data chunk's real size is in the "ds64" chunk. */
+        if (isRF64 && header.sizeInBytes == 0xFFFFFFFF && drwav__fourcc_equal(header.id.fourcc, "data")) {
+            header.sizeInBytes = dataChunkSizeRF64;
+            header.paddingSize = drwav__chunk_padding_size_riff(dataChunkSizeRF64);
+        }
+
         /* Tell the client about this chunk. */
         if (!sequential && onChunk != NULL) {
             drwav_uint64 callbackBytesRead = onChunk(pChunkUserData, pWav->onRead, pWav->onSeek, pWav->pUserData, &header, pWav->container, &fmt);
@@ -2253,10 +2542,20 @@ static drwav_bool32 drwav_init_write__internal(drwav* pWav, const drwav_data_for
 
     /* "RIFF" chunk. */
     if (pFormat->container == drwav_container_riff) {
-        drwav_uint32 chunkSizeRIFF = 36 + (drwav_uint32)initialDataChunkSize;   /* +36 = "RIFF"+[RIFF Chunk Size]+"WAVE" + [sizeof "fmt " chunk] */
+        drwav_uint32 chunkSizeRIFF = 36 + (drwav_uint32)initialDataChunkSize + (pWav->isRF64Reserved ? 8 + DRWAV_DS64_CHUNK_SIZE : 0);   /* +36 = "RIFF"+[RIFF Chunk Size]+"WAVE" + [sizeof "fmt " chunk] */
         runningPos += pWav->onWrite(pWav->pUserData, "RIFF", 4);
         runningPos += pWav->onWrite(pWav->pUserData, &chunkSizeRIFF, 4);
         runningPos += pWav->onWrite(pWav->pUserData, "WAVE", 4);
+
+        /* "JUNK" chunk, the same size as the "ds64" chunk it may turn into. */
+        if (pWav->isRF64Reserved) {
+            drwav_uint32 chunkSizeJUNK = DRWAV_DS64_CHUNK_SIZE;
+            drwav_uint8  junk[DRWAV_DS64_CHUNK_SIZE];
+            DRWAV_ZERO_MEMORY(junk, sizeof(junk));
+            runningPos += pWav->onWrite(pWav->pUserData, "JUNK", 4);
+            runningPos += pWav->onWrite(pWav->pUserData, &chunkSizeJUNK, 4);
+            runningPos += pWav->onWrite(pWav->pUserData, junk, sizeof(junk));
+        }
     } else {
         drwav_uint64 chunkSizeRIFF = 80 + 24 + initialDataChunkSize;   /* +24 because W64 includes the size of the GUID and size fields. */
         runningPos += pWav->onWrite(pWav->pUserData, drwavGUID_W64_RIFF, 16);
@@ -2298,7 +2597,7 @@ static drwav_bool32 drwav_init_write__internal(drwav* pWav, const drwav_data_for
 
     /* Simple validation. */
     if (pFormat->container == drwav_container_riff) {
-        if (runningPos != 20 + chunkSizeFMT + 8) {
+        if (runningPos != 20 + chunkSizeFMT + 8 + (pWav->isRF64Reserved ? 8 + DRWAV_DS64_CHUNK_SIZE : 0)) {
             return DRWAV_FALSE;
         }
     } else {
@@ -3059,954 +3358,2901 @@ DRWAV_API drwav_bool32 drwav_init_file_write_sequential_pcm_frames_w(drwav* pWav
 
     return drwav_init_file_write_sequential_w(pWav, filename, pFormat, totalPCMFrameCount*pFormat->channels, pAllocationCallbacks);
 }
-#endif  /* DR_WAV_NO_STDIO */
 
+/*
+Support for drwav_init_file_write_async(). The writer fills one buffer while the other is written to the file, by a background
+thread where there is one and otherwise on the calling thread when the buffer fills up.
+*/
+typedef struct
+{
+    FILE* pFile;
+    drwav_uint8* pBuffers[2];
+    size_t bufferSize;
+    drwav_uint32 iFrontBuffer;          /* The buffer being filled by drwav_write_*(). */
+    size_t frontBufferUsed;
+    size_t backBufferUsed;              /* The size of the buffer being written to the file. */
+    drwav_uint64 fileSize;              /* Everything written before the first seek, which is where the file ends. */
+    drwav_bool32 isDirect;              /* Set by the first seek. After that writes go straight to the file. */
+    drwav_bool32 isPreallocated;        /* Whether the file was extended up front and needs to be cut back to fileSize in drwav_uninit(). */
+    drwav_bool32 hasWriteFailed;
+#ifdef DRWAV_HAS_THREADS
+    drwav_bool32 hasThread;
+    drwav_bool32 isBackBufferPending;   /* Guarded by the lock. */
+    drwav_bool32 isStopping;            /* Guarded by the lock. */
+#if defined(_WIN32)
+    HANDLE hThread;
+    CRITICAL_SECTION lock;
+    HANDLE hBufferSubmitted;            /* Auto-reset events. Waited on without the lock held, and the state checked again afterwards. */
+    HANDLE hBufferWritten;
+#else
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t bufferSubmitted;
+    pthread_cond_t bufferWritten;
+#endif
+#endif
+} drwav__async_file;
 
-static size_t drwav__on_read_memory(void* pUserData, void* pBufferOut, size_t bytesToRead)
+/* Extends the file to its expected size so the file system can allocate it in one go. Returns whether the size changed. */
+static drwav_bool32 drwav__preallocate_file(FILE* pFile, drwav_uint64 size)
 {
-    drwav* pWav = (drwav*)pUserData;
-    size_t bytesRemaining;
+#if defined(_WIN32)
+    HANDLE hFile = (HANDLE)_get_osfhandle(_fileno(pFile));
+    LARGE_INTEGER zero;
+    LARGE_INTEGER position;
+    LARGE_INTEGER end;
+    drwav_bool32 result;
 
-    DRWAV_ASSERT(pWav != NULL);
-    DRWAV_ASSERT(pWav->memoryStream.dataSize >= pWav->memoryStream.currentReadPos);
+    if (hFile == INVALID_HANDLE_VALUE || fflush(pFile) != 0) {
+        return DRWAV_FALSE;
+    }
 
-    bytesRemaining = pWav->memoryStream.dataSize - pWav->memoryStream.currentReadPos;
-    if (bytesToRead > bytesRemaining) {
-        bytesToRead = bytesRemaining;
+    /* SetEndOfFile() works at the file pointer, which stdio writes from, so it needs to be put back afterwards. */
+    zero.QuadPart = 0;
+    end.QuadPart  = (LONGLONG)size;
+    if (!SetFilePointerEx(hFile, zero, &position, FILE_CURRENT)) {
+        return DRWAV_FALSE;
     }
 
-    if (bytesToRead > 0) {
-        DRWAV_COPY_MEMORY(pBufferOut, pWav->memoryStream.data + pWav->memoryStream.currentReadPos, bytesToRead);
-        pWav->memoryStream.currentReadPos += bytesToRead;
+    result = SetFilePointerEx(hFile, end, NULL, FILE_BEGIN) && SetEndOfFile(hFile);
+    SetFilePointerEx(hFile, position, NULL, FILE_BEGIN);
+    return result;
+#elif defined(DRWAV_HAS_POSIX_FILE_SIZE)
+    if ((drwav_uint64)(off_t)size != size || fflush(pFile) != 0) {
+        return DRWAV_FALSE;
     }
 
-    return bytesToRead;
+    return posix_fallocate(fileno(pFile), 0, (off_t)size) == 0;
+#else
+    (void)pFile;
+    (void)size;
+    return DRWAV_FALSE;
+#endif
 }
 
-static drwav_bool32 drwav__on_seek_memory(void* pUserData, int offset, drwav_seek_origin origin)
+static void drwav__truncate_file(FILE* pFile, drwav_uint64 size)
 {
-    drwav* pWav = (drwav*)pUserData;
-    DRWAV_ASSERT(pWav != NULL);
+#if defined(_WIN32)
+    HANDLE hFile = (HANDLE)_get_osfhandle(_fileno(pFile));
+    LARGE_INTEGER position;
 
-    if (origin == drwav_seek_origin_current) {
-        if (offset > 0) {
-            if (pWav->memoryStream.currentReadPos + offset > pWav->memoryStream.dataSize) {
-                return DRWAV_FALSE; /* Trying to seek too far forward. */
-            }
-        } else {
-            if (pWav->memoryStream.currentReadPos < (size_t)-offset) {
-                return DRWAV_FALSE; /* Trying to seek too far backwards. */
-            }
-        }
+    position.QuadPart = (LONGLONG)size;
+    if (hFile != INVALID_HANDLE_VALUE && SetFilePointerEx(hFile, position, NULL, FILE_BEGIN)) {
+        SetEndOfFile(hFile);
+    }
+#elif defined(DRWAV_HAS_POSIX_FILE_SIZE)
+    if (ftruncate(fileno(pFile), (off_t)size) != 0) {
+        /* Nothing more we can do. The file is still readable with zeros on the end. */
+    }
+#else
+    (void)pFile;
+    (void)size;
+#endif
+}
 
-        /* This will never underflow thanks to the clamps above. */
-        pWav->memoryStream.currentReadPos += offset;
-    } else {
-        if ((drwav_uint32)offset <= pWav->memoryStream.dataSize) {
-            pWav->memoryStream.currentReadPos = offset;
-        } else {
-            return DRWAV_FALSE; /* Trying to seek too far forward. */
-        }
+static void drwav__async_write_buffer(drwav__async_file* pAsync, const drwav_uint8* pBuffer, size_t size)
+{
+    if (fwrite(pBuffer, 1, size, pAsync->pFile) != size) {
+        pAsync->hasWriteFailed = DRWAV_TRUE;
     }
-    
-    return DRWAV_TRUE;
 }
 
-static size_t drwav__on_write_memory(void* pUserData, const void* pDataIn, size_t bytesToWrite)
+#ifdef DRWAV_HAS_THREADS
+static void drwav__async_lock(drwav__async_file* pAsync)
 {
-    drwav* pWav = (drwav*)pUserData;
-    size_t bytesRemaining;
+#if defined(_WIN32)
+    EnterCriticalSection(&pAsync->lock);
+#else
+    pthread_mutex_lock(&pAsync->lock);
+#endif
+}
 
-    DRWAV_ASSERT(pWav != NULL);
-    DRWAV_ASSERT(pWav->memoryStreamWrite.dataCapacity >= pWav->memoryStreamWrite.currentWritePos);
+static void drwav__async_unlock(drwav__async_file* pAsync)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(&pAsync->lock);
+#else
+    pthread_mutex_unlock(&pAsync->lock);
+#endif
+}
 
-    bytesRemaining = pWav->memoryStreamWrite.dataCapacity - pWav->memoryStreamWrite.currentWritePos;
-    if (bytesRemaining < bytesToWrite) {
-        /* Need to reallocate. */
-        void* pNewData;
-        size_t newDataCapacity = (pWav->memoryStreamWrite.dataCapacity == 0) ? 256 : pWav->memoryStreamWrite.dataCapacity * 2;
+/* Waits for the back buffer to be submitted or written. Called with the lock held, and returns with it held. Can wake spuriously. */
+static void drwav__async_wait(drwav__async_file* pAsync, drwav_bool32 forWritten)
+{
+#if defined(_WIN32)
+    drwav__async_unlock(pAsync);
+    WaitForSingleObject(forWritten ? pAsync->hBufferWritten : pAsync->hBufferSubmitted, INFINITE);
+    drwav__async_lock(pAsync);
+#else
+    pthread_cond_wait(forWritten ? &pAsync->bufferWritten : &pAsync->bufferSubmitted, &pAsync->lock);
+#endif
+}
 
-        /* If doubling wasn't enough, just make it the minimum required size to write the data. */
-        if ((newDataCapacity - pWav->memoryStreamWrite.currentWritePos) < bytesToWrite) {
-            newDataCapacity = pWav->memoryStreamWrite.currentWritePos + bytesToWrite;
-        }
+static void drwav__async_signal(drwav__async_file* pAsync, drwav_bool32 forWritten)
+{
+#if defined(_WIN32)
+    SetEvent(forWritten ? pAsync->hBufferWritten : pAsync->hBufferSubmitted);
+#else
+    pthread_cond_signal(forWritten ? &pAsync->bufferWritten : &pAsync->bufferSubmitted);
+#endif
+}
 
-        pNewData = drwav__realloc_from_callbacks(*pWav->memoryStreamWrite.ppData, newDataCapacity, pWav->memoryStreamWrite.dataCapacity, &pWav->allocationCallbacks);
-        if (pNewData == NULL) {
-            return 0;
+#if defined(_WIN32)
+static DWORD WINAPI drwav__async_thread(LPVOID pUserData)
+#else
+static void* drwav__async_thread(void* pUserData)
+#endif
+{
+    drwav__async_file* pAsync = (drwav__async_file*)pUserData;
+
+    for (;;) {
+        drwav__async_lock(pAsync);
+        while (!pAsync->isBackBufferPending && !pAsync->isStopping) {
+            drwav__async_wait(pAsync, DRWAV_FALSE);
+        }
+        if (!pAsync->isBackBufferPending) {
+            drwav__async_unlock(pAsync);
+            break;
         }
+        drwav__async_unlock(pAsync);
 
-        *pWav->memoryStreamWrite.ppData = pNewData;
-        pWav->memoryStreamWrite.dataCapacity = newDataCapacity;
+        drwav__async_write_buffer(pAsync, pAsync->pBuffers[pAsync->iFrontBuffer ^ 1], pAsync->backBufferUsed);
+
+        drwav__async_lock(pAsync);
+        pAsync->isBackBufferPending = DRWAV_FALSE;
+        drwav__async_unlock(pAsync);
+        drwav__async_signal(pAsync, DRWAV_TRUE);
     }
 
-    DRWAV_COPY_MEMORY(((drwav_uint8*)(*pWav->memoryStreamWrite.ppData)) + pWav->memoryStreamWrite.currentWritePos, pDataIn, bytesToWrite);
+    return 0;
+}
 
-    pWav->memoryStreamWrite.currentWritePos += bytesToWrite;
-    if (pWav->memoryStreamWrite.dataSize < pWav->memoryStreamWrite.currentWritePos) {
-        pWav->memoryStreamWrite.dataSize = pWav->memoryStreamWrite.currentWritePos;
+static drwav_bool32 drwav__async_start_thread(drwav__async_file* pAsync)
+{
+#if defined(_WIN32)
+    InitializeCriticalSection(&pAsync->lock);
+    pAsync->hBufferSubmitted = CreateEventA(NULL, FALSE, FALSE, NULL);
+    pAsync->hBufferWritten   = CreateEventA(NULL, FALSE, FALSE, NULL);
+    if (pAsync->hBufferSubmitted != NULL && pAsync->hBufferWritten != NULL) {
+        pAsync->hThread = CreateThread(NULL, 0, drwav__async_thread, pAsync, 0, NULL);
+        if (pAsync->hThread != NULL) {
+            return DRWAV_TRUE;
+        }
     }
 
-    *pWav->memoryStreamWrite.pDataSize = pWav->memoryStreamWrite.dataSize;
+    if (pAsync->hBufferSubmitted != NULL) {
+        CloseHandle(pAsync->hBufferSubmitted);
+    }
+    if (pAsync->hBufferWritten != NULL) {
+        CloseHandle(pAsync->hBufferWritten);
+    }
+    DeleteCriticalSection(&pAsync->lock);
+    return DRWAV_FALSE;
+#else
+    if (pthread_mutex_init(&pAsync->lock, NULL) != 0) {
+        return DRWAV_FALSE;
+    }
+    if (pthread_cond_init(&pAsync->bufferSubmitted, NULL) != 0) {
+        pthread_mutex_destroy(&pAsync->lock);
+        return DRWAV_FALSE;
+    }
+    if (pthread_cond_init(&pAsync->bufferWritten, NULL) != 0) {
+        pthread_cond_destroy(&pAsync->bufferSubmitted);
+        pthread_mutex_destroy(&pAsync->lock);
+        return DRWAV_FALSE;
+    }
+    if (pthread_create(&pAsync->thread, NULL, drwav__async_thread, pAsync) != 0) {
+        pthread_cond_destroy(&pAsync->bufferWritten);
+        pthread_cond_destroy(&pAsync->bufferSubmitted);
+        pthread_mutex_destroy(&pAsync->lock);
+        return DRWAV_FALSE;
+    }
 
-    return bytesToWrite;
+    return DRWAV_TRUE;
+#endif
 }
 
-static drwav_bool32 drwav__on_seek_memory_write(void* pUserData, int offset, drwav_seek_origin origin)
+static void drwav__async_stop_thread(drwav__async_file* pAsync)
 {
-    drwav* pWav = (drwav*)pUserData;
-    DRWAV_ASSERT(pWav != NULL);
+    drwav__async_lock(pAsync);
+    pAsync->isStopping = DRWAV_TRUE;
+    drwav__async_unlock(pAsync);
+    drwav__async_signal(pAsync, DRWAV_FALSE);
 
-    if (origin == drwav_seek_origin_current) {
-        if (offset > 0) {
-            if (pWav->memoryStreamWrite.currentWritePos + offset > pWav->memoryStreamWrite.dataSize) {
-                offset = (int)(pWav->memoryStreamWrite.dataSize - pWav->memoryStreamWrite.currentWritePos);  /* Trying to seek too far forward. */
-            }
-        } else {
-            if (pWav->memoryStreamWrite.currentWritePos < (size_t)-offset) {
-                offset = -(int)pWav->memoryStreamWrite.currentWritePos;  /* Trying to seek too far backwards. */
-            }
-        }
+#if defined(_WIN32)
+    WaitForSingleObject(pAsync->hThread, INFINITE);
+    CloseHandle(pAsync->hThread);
+    CloseHandle(pAsync->hBufferSubmitted);
+    CloseHandle(pAsync->hBufferWritten);
+    DeleteCriticalSection(&pAsync->lock);
+#else
+    pthread_join(pAsync->thread, NULL);
+    pthread_cond_destroy(&pAsync->bufferWritten);
+    pthread_cond_destroy(&pAsync->bufferSubmitted);
+    pthread_mutex_destroy(&pAsync->lock);
+#endif
 
-        /* This will never underflow thanks to the clamps above. */
-        pWav->memoryStreamWrite.currentWritePos += offset;
-    } else {
-        if ((drwav_uint32)offset <= pWav->memoryStreamWrite.dataSize) {
-            pWav->memoryStreamWrite.currentWritePos = offset;
-        } else {
-            pWav->memoryStreamWrite.currentWritePos = pWav->memoryStreamWrite.dataSize;  /* Trying to seek too far forward. */
-        }
-    }
-    
-    return DRWAV_TRUE;
+    pAsync->hasThread = DRWAV_FALSE;
 }
+#endif  /* DRWAV_HAS_THREADS */
 
-DRWAV_API drwav_bool32 drwav_init_memory(drwav* pWav, const void* data, size_t dataSize, const drwav_allocation_callbacks* pAllocationCallbacks)
+/* Hands the front buffer over to be written. This only waits if the previous one is still being written. */
+static void drwav__async_submit(drwav__async_file* pAsync)
 {
-    return drwav_init_memory_ex(pWav, data, dataSize, NULL, NULL, 0, pAllocationCallbacks);
+#ifdef DRWAV_HAS_THREADS
+    if (pAsync->hasThread) {
+        drwav__async_lock(pAsync);
+        while (pAsync->isBackBufferPending) {
+            drwav__async_wait(pAsync, DRWAV_TRUE);
+        }
+        pAsync->iFrontBuffer        ^= 1;
+        pAsync->backBufferUsed       = pAsync->frontBufferUsed;
+        pAsync->isBackBufferPending  = DRWAV_TRUE;
+        drwav__async_unlock(pAsync);
+        drwav__async_signal(pAsync, DRWAV_FALSE);
+
+        pAsync->frontBufferUsed = 0;
+        return;
+    }
+#endif
+
+    drwav__async_write_buffer(pAsync, pAsync->pBuffers[pAsync->iFrontBuffer], pAsync->frontBufferUsed);
+    pAsync->frontBufferUsed = 0;
 }
 
-DRWAV_API drwav_bool32 drwav_init_memory_ex(drwav* pWav, const void* data, size_t dataSize, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+/* Gets everything written so far into the file. */
+static void drwav__async_drain(drwav__async_file* pAsync)
 {
-    if (data == NULL || dataSize == 0) {
-        return DRWAV_FALSE;
+    if (pAsync->frontBufferUsed > 0) {
+        drwav__async_submit(pAsync);
     }
 
-    if (!drwav_preinit(pWav, drwav__on_read_memory, drwav__on_seek_memory, pWav, pAllocationCallbacks)) {
-        return DRWAV_FALSE;
+#ifdef DRWAV_HAS_THREADS
+    if (pAsync->hasThread) {
+        drwav__async_lock(pAsync);
+        while (pAsync->isBackBufferPending) {
+            drwav__async_wait(pAsync, DRWAV_TRUE);
+        }
+        drwav__async_unlock(pAsync);
     }
-
-    pWav->memoryStream.data = (const drwav_uint8*)data;
-    pWav->memoryStream.dataSize = dataSize;
-    pWav->memoryStream.currentReadPos = 0;
-
-    return drwav_init__internal(pWav, onChunk, pChunkUserData, flags);
+#endif
 }
 
-
-static drwav_bool32 drwav_init_memory_write__internal(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, drwav_bool32 isSequential, const drwav_allocation_callbacks* pAllocationCallbacks)
+static size_t drwav__on_write_async(void* pUserData, const void* pData, size_t bytesToWrite)
 {
-    if (ppData == NULL || pDataSize == NULL) {
-        return DRWAV_FALSE;
-    }
-
-    *ppData = NULL; /* Important because we're using realloc()! */
-    *pDataSize = 0;
+    drwav__async_file* pAsync = (drwav__async_file*)pUserData;
+    const drwav_uint8* pRunningData = (const drwav_uint8*)pData;
+    size_t bytesRemaining = bytesToWrite;
 
-    if (!drwav_preinit_write(pWav, pFormat, isSequential, drwav__on_write_memory, drwav__on_seek_memory_write, pWav, pAllocationCallbacks)) {
-        return DRWAV_FALSE;
+    if (pAsync->isDirect) {
+        return fwrite(pData, 1, bytesToWrite, pAsync->pFile);
     }
 
-    pWav->memoryStreamWrite.ppData = ppData;
-    pWav->memoryStreamWrite.pDataSize = pDataSize;
-    pWav->memoryStreamWrite.dataSize = 0;
-    pWav->memoryStreamWrite.dataCapacity = 0;
-    pWav->memoryStreamWrite.currentWritePos = 0;
+    while (bytesRemaining > 0) {
+        size_t bytesToCopy = drwav_min(bytesRemaining, pAsync->bufferSize - pAsync->frontBufferUsed);
+        DRWAV_COPY_MEMORY(pAsync->pBuffers[pAsync->iFrontBuffer] + pAsync->frontBufferUsed, pRunningData, bytesToCopy);
+        pAsync->frontBufferUsed += bytesToCopy;
+        pRunningData            += bytesToCopy;
+        bytesRemaining          -= bytesToCopy;
 
-    return drwav_init_write__internal(pWav, pFormat, totalSampleCount);
-}
+        if (pAsync->frontBufferUsed == pAsync->bufferSize) {
+            drwav__async_submit(pAsync);
+        }
+    }
 
-DRWAV_API drwav_bool32 drwav_init_memory_write(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, const drwav_allocation_callbacks* pAllocationCallbacks)
-{
-    return drwav_init_memory_write__internal(pWav, ppData, pDataSize, pFormat, 0, DRWAV_FALSE, pAllocationCallbacks);
+    pAsync->fileSize += bytesToWrite;
+    return bytesToWrite;
 }
 
-DRWAV_API drwav_bool32 drwav_init_memory_write_sequential(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, const drwav_allocation_callbacks* pAllocationCallbacks)
+/* Only drwav_uninit() seeks, to fill in the header, and only once all of the audio data has been written. */
+static drwav_bool32 drwav__on_seek_async(void* pUserData, int offset, drwav_seek_origin origin)
 {
-    return drwav_init_memory_write__internal(pWav, ppData, pDataSize, pFormat, totalSampleCount, DRWAV_TRUE, pAllocationCallbacks);
-}
+    drwav__async_file* pAsync = (drwav__async_file*)pUserData;
 
-DRWAV_API drwav_bool32 drwav_init_memory_write_sequential_pcm_frames(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalPCMFrameCount, const drwav_allocation_callbacks* pAllocationCallbacks)
-{
-    if (pFormat == NULL) {
-        return DRWAV_FALSE;
+    if (!pAsync->isDirect) {
+        drwav__async_drain(pAsync);
+        pAsync->isDirect = DRWAV_TRUE;
     }
 
-    return drwav_init_memory_write_sequential(pWav, ppData, pDataSize, pFormat, totalPCMFrameCount*pFormat->channels, pAllocationCallbacks);
+    return drwav__on_seek_stdio(pAsync->pFile, offset, origin);
 }
 
-
-
-DRWAV_API drwav_result drwav_uninit(drwav* pWav)
+/* Called by drwav_uninit() once the header has been filled in. */
+static drwav_result drwav__async_uninit(drwav__async_file* pAsync, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    drwav_result result = DRWAV_SUCCESS;
+    drwav_result result;
 
-    if (pWav == NULL) {
-        return DRWAV_INVALID_ARGS;
+    drwav__async_drain(pAsync);
+#ifdef DRWAV_HAS_THREADS
+    if (pAsync->hasThread) {
+        drwav__async_stop_thread(pAsync);
     }
+#endif
 
-    /*
-    If the drwav object was opened in write mode we'll need to finalize a few things:
-      - Make sure the "data" chunk is aligned to 16-bits for RIFF containers, or 64 bits for W64 containers.
-      - Set the size of the "data" chunk.
-    */
-    if (pWav->onWrite != NULL) {
-        drwav_uint32 paddingSize = 0;
-
-        /* Padding. Do not adjust pWav->dataChunkDataSize - this should not include the padding. */
-        if (pWav->container == drwav_container_riff) {
-            paddingSize = drwav__chunk_padding_size_riff(pWav->dataChunkDataSize);
-        } else {
-            paddingSize = drwav__chunk_padding_size_w64(pWav->dataChunkDataSize);
-        }
-        
-        if (paddingSize > 0) {
-            drwav_uint64 paddingData = 0;
-            pWav->onWrite(pWav->pUserData, &paddingData, paddingSize);
-        }
-
-        /*
-        Chunk sizes. When using sequential mode, these will have been filled in at initialization time. We only need
-        to do this when using non-sequential mode.
-        */
-        if (pWav->onSeek && !pWav->isSequentialWrite) {
-            if (pWav->container == drwav_container_riff) {
-                /* The "RIFF" chunk size. */
-                if (pWav->onSeek(pWav->pUserData, 4, drwav_seek_origin_start)) {
-                    drwav_uint32 riffChunkSize = drwav__riff_chunk_size_riff(pWav->dataChunkDataSize);
-                    pWav->onWrite(pWav->pUserData, &riffChunkSize, 4);
-                }
-
-                /* the "data" chunk size. */
-                if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 4, drwav_seek_origin_start)) {
-                    drwav_uint32 dataChunkSize = drwav__data_chunk_size_riff(pWav->dataChunkDataSize);
-                    pWav->onWrite(pWav->pUserData, &dataChunkSize, 4);
-                }
-            } else {
-                /* The "RIFF" chunk size. */
-                if (pWav->onSeek(pWav->pUserData, 16, drwav_seek_origin_start)) {
-                    drwav_uint64 riffChunkSize = drwav__riff_chunk_size_w64(pWav->dataChunkDataSize);
-                    pWav->onWrite(pWav->pUserData, &riffChunkSize, 8);
-                }
-
-                /* The "data" chunk size. */
-                if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 16, drwav_seek_origin_start)) {
-                    drwav_uint64 dataChunkSize = drwav__data_chunk_size_w64(pWav->dataChunkDataSize);
-                    pWav->onWrite(pWav->pUserData, &dataChunkSize, 8);
-                }
-            }
-        }
-
-        /* Validation for sequential mode. */
-        if (pWav->isSequentialWrite) {
-            if (pWav->dataChunkDataSize != pWav->dataChunkDataSizeTargetWrite) {
-                result = DRWAV_INVALID_FILE;
-            }
-        }
+    if (fflush(pAsync->pFile) != 0) {
+        pAsync->hasWriteFailed = DRWAV_TRUE;
     }
-
-#ifndef DR_WAV_NO_STDIO
-    /*
-    If we opened the file with drwav_open_file() we will want to close the file handle. We can know whether or not drwav_open_file()
-    was used by looking at the onRead and onSeek callbacks.
-    */
-    if (pWav->onRead == drwav__on_read_stdio || pWav->onWrite == drwav__on_write_stdio) {
-        fclose((FILE*)pWav->pUserData);
+    if (pAsync->isPreallocated) {
+        drwav__truncate_file(pAsync->pFile, pAsync->fileSize);
     }
-#endif
 
-    return result;
-}
+    result = pAsync->hasWriteFailed ? DRWAV_IO_ERROR : DRWAV_SUCCESS;
 
+    fclose(pAsync->pFile);
+    drwav__free_from_callbacks(pAsync, pAllocationCallbacks);
 
+    return result;
+}
 
-DRWAV_API size_t drwav_read_raw(drwav* pWav, size_t bytesToRead, void* pBufferOut)
+static drwav_bool32 drwav_init_file_write_async__internal_FILE(drwav* pWav, FILE* pFile, const drwav_data_format* pFormat, drwav_uint64 expectedPCMFrameCount, size_t bufferSizeInBytes, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    size_t bytesRead;
+    drwav_allocation_callbacks allocationCallbacks = drwav_copy_allocation_callbacks_or_defaults(pAllocationCallbacks);
+    drwav__async_file* pAsync;
 
-    if (pWav == NULL || bytesToRead == 0 || pBufferOut == NULL) {
-        return 0;
+    if (pFormat == NULL) {
+        fclose(pFile);
+        return DRWAV_FALSE;
     }
 
-    if (bytesToRead > pWav->bytesRemaining) {
-        bytesToRead = (size_t)pWav->bytesRemaining;
+    if (bufferSizeInBytes == 0) {
+        bufferSizeInBytes = DRWAV_ASYNC_WRITE_BUFFER_SIZE;
+    }
+    if (bufferSizeInBytes > (DRWAV_SIZE_MAX - sizeof(*pAsync)) / 2) {
+        fclose(pFile);
+        return DRWAV_FALSE;
     }
 
-    bytesRead = pWav->onRead(pWav->pUserData, pBufferOut, bytesToRead);
-
-    pWav->bytesRemaining -= bytesRead;
-    return bytesRead;
-}
-
-
+    pAsync = (drwav__async_file*)drwav__malloc_from_callbacks(sizeof(*pAsync) + bufferSizeInBytes*2, &allocationCallbacks);
+    if (pAsync == NULL) {
+        fclose(pFile);
+        return DRWAV_FALSE;
+    }
 
-DRWAV_API drwav_uint64 drwav_read_pcm_frames_le(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
-{
-    drwav_uint32 bytesPerFrame;
+    DRWAV_ZERO_MEMORY(pAsync, sizeof(*pAsync));
+    pAsync->pFile       = pFile;
+    pAsync->pBuffers[0] = (drwav_uint8*)(pAsync + 1);
+    pAsync->pBuffers[1] = pAsync->pBuffers[0] + bufferSizeInBytes;
+    pAsync->bufferSize  = bufferSizeInBytes;
 
-    if (pWav == NULL || framesToRead == 0 || pBufferOut == NULL) {
-        return 0;
+    if (!drwav_preinit_write(pWav, pFormat, DRWAV_FALSE, drwav__on_write_async, drwav__on_seek_async, pAsync, pAllocationCallbacks)) {
+        drwav__free_from_callbacks(pAsync, &allocationCallbacks);
+        fclose(pFile);
+        return DRWAV_FALSE;
     }
 
-    /* Cannot use this function for compressed formats. */
-    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
-        return 0;
-    }
+    pWav->isRF64Reserved = (pFormat->container == drwav_container_riff);
 
-    bytesPerFrame = drwav_get_bytes_per_pcm_frame(pWav);
-    if (bytesPerFrame == 0) {
-        return 0;
+    /* The header only goes into the front buffer here, so nothing is written to the file yet. */
+    if (!drwav_init_write__internal(pWav, pFormat, 0)) {
+        drwav__free_from_callbacks(pAsync, &allocationCallbacks);
+        fclose(pFile);
+        return DRWAV_FALSE;
     }
 
-    /* Don't try to read more samples than can potentially fit in the output buffer. */
-    if (framesToRead * bytesPerFrame > DRWAV_SIZE_MAX) {
-        framesToRead = DRWAV_SIZE_MAX / bytesPerFrame;
+    if (expectedPCMFrameCount > 0) {
+        pAsync->isPreallocated = drwav__preallocate_file(pFile, pAsync->fileSize + expectedPCMFrameCount*drwav_get_bytes_per_pcm_frame(pWav));
     }
 
-    return drwav_read_raw(pWav, (size_t)(framesToRead * bytesPerFrame), pBufferOut) / bytesPerFrame;
+#ifdef DRWAV_HAS_THREADS
+    /* Without a thread the buffers are written when they fill up, which is slower to return but otherwise the same. */
+    pAsync->hasThread = drwav__async_start_thread(pAsync);
+#endif
+
+    return DRWAV_TRUE;
 }
 
-DRWAV_API drwav_uint64 drwav_read_pcm_frames_be(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
+DRWAV_API drwav_bool32 drwav_init_file_write_async(drwav* pWav, const char* filename, const drwav_data_format* pFormat, drwav_uint64 expectedPCMFrameCount, size_t bufferSizeInBytes, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    drwav_uint64 framesRead = drwav_read_pcm_frames_le(pWav, framesToRead, pBufferOut);
-    drwav__bswap_samples(pBufferOut, framesRead*pWav->channels, drwav_get_bytes_per_pcm_frame(pWav)/pWav->channels, pWav->translatedFormatTag);
+    FILE* pFile;
+    if (drwav_fopen(&pFile, filename, "wb") != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
+    }
 
-    return framesRead;
+    /* This takes ownership of the FILE* object. */
+    return drwav_init_file_write_async__internal_FILE(pWav, pFile, pFormat, expectedPCMFrameCount, bufferSizeInBytes, pAllocationCallbacks);
 }
 
-DRWAV_API drwav_uint64 drwav_read_pcm_frames(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
+DRWAV_API drwav_bool32 drwav_init_file_write_async_w(drwav* pWav, const wchar_t* filename, const drwav_data_format* pFormat, drwav_uint64 expectedPCMFrameCount, size_t bufferSizeInBytes, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    if (drwav__is_little_endian()) {
-        return drwav_read_pcm_frames_le(pWav, framesToRead, pBufferOut);
-    } else {
-        return drwav_read_pcm_frames_be(pWav, framesToRead, pBufferOut);
+    FILE* pFile;
+    if (drwav_wfopen(&pFile, filename, L"wb", pAllocationCallbacks) != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
     }
+
+    /* This takes ownership of the FILE* object. */
+    return drwav_init_file_write_async__internal_FILE(pWav, pFile, pFormat, expectedPCMFrameCount, bufferSizeInBytes, pAllocationCallbacks);
 }
+#endif  /* DR_WAV_NO_STDIO */
 
 
+#ifdef DRWAV_HAS_MMAP
+#if defined(_WIN32)
+/* PrefetchVirtualMemory() is Windows 8 and newer, so it's looked up at run time. */
+typedef struct
+{
+    PVOID VirtualAddress;
+    SIZE_T NumberOfBytes;
+} drwav__win32_memory_range_entry;
+typedef BOOL (WINAPI * drwav__PrefetchVirtualMemory_proc)(HANDLE hProcess, ULONG_PTR numberOfEntries, drwav__win32_memory_range_entry* pEntries, ULONG flags);
+#endif
 
-DRWAV_API drwav_bool32 drwav_seek_to_first_pcm_frame(drwav* pWav)
+static void drwav__mapped_advise_willneed(const drwav_uint8* pData, size_t size)
 {
-    if (pWav->onWrite != NULL) {
-        return DRWAV_FALSE; /* No seeking in write mode. */
-    }
+#if defined(_WIN32)
+    static drwav__PrefetchVirtualMemory_proc pPrefetchVirtualMemory = NULL;
+    static drwav_bool32 isPrefetchLoaded = DRWAV_FALSE;
+    drwav__win32_memory_range_entry entry;
 
-    if (!pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos, drwav_seek_origin_start)) {
-        return DRWAV_FALSE;
+    if (!isPrefetchLoaded) {
+        pPrefetchVirtualMemory = (drwav__PrefetchVirtualMemory_proc)GetProcAddress(GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory");
+        isPrefetchLoaded = DRWAV_TRUE;
     }
-
-    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
-        pWav->compressed.iCurrentPCMFrame = 0;
+    if (pPrefetchVirtualMemory != NULL) {
+        entry.VirtualAddress = (PVOID)pData;
+        entry.NumberOfBytes  = size;
+        pPrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
     }
-    
-    pWav->bytesRemaining = pWav->dataChunkDataSize;
-    return DRWAV_TRUE;
+#else
+    /* posix_madvise() wants a page-aligned start. */
+    size_t pageSize  = (size_t)sysconf(_SC_PAGESIZE);
+    size_t alignment = (size_t)((drwav_uint64)(size_t)pData % pageSize);
+    posix_madvise((void*)(pData - alignment), size + alignment, POSIX_MADV_WILLNEED);
+#endif
 }
 
-DRWAV_API drwav_bool32 drwav_seek_to_pcm_frame(drwav* pWav, drwav_uint64 targetFrameIndex)
+/* Asks the OS for the next DRWAV_MAPPED_PREFETCH_SIZE bytes once the read position is within half of that of the end of what was last asked for. */
+static void drwav__mapped_prefetch(drwav* pWav)
 {
-    /* Seeking should be compatible with wave files > 2GB. */
+    size_t pos;
+    size_t start;
+    size_t end;
 
-    if (pWav == NULL || pWav->onSeek == NULL) {
-        return DRWAV_FALSE;
+    if (pWav->mapped.pData == NULL) {
+        return;
     }
 
-    /* No seeking in write mode. */
-    if (pWav->onWrite != NULL) {
-        return DRWAV_FALSE;
+    pos = pWav->memoryStream.currentReadPos;
+    if (pos + DRWAV_MAPPED_PREFETCH_SIZE/2 < pWav->mapped.prefetchedPos && pos + DRWAV_MAPPED_PREFETCH_SIZE > pWav->mapped.prefetchedPos) {
+        return; /* Still well inside the window. */
     }
 
-    /* If there are no samples, just return DRWAV_TRUE without doing anything. */
-    if (pWav->totalPCMFrameCount == 0) {
-        return DRWAV_TRUE;
+    /* Continue from the end of the last window, unless the read position has been seeked out of it. */
+    start = pWav->mapped.prefetchedPos;
+    if (pos > start || pos + DRWAV_MAPPED_PREFETCH_SIZE <= start) {
+        start = pos;
     }
-
-    /* Make sure the sample is clamped. */
-    if (targetFrameIndex >= pWav->totalPCMFrameCount) {
-        targetFrameIndex  = pWav->totalPCMFrameCount - 1;
+    end = pos + DRWAV_MAPPED_PREFETCH_SIZE;
+    if (end > pWav->mapped.dataSize) {
+        end = pWav->mapped.dataSize;
+    }
+    if (start >= end) {
+        return;
     }
 
-    /*
-    For compressed formats we just use a slow generic seek. If we are seeking forward we just seek forward. If we are going backwards we need
-    to seek back to the start.
-    */
-    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
-        /* TODO: This can be optimized. */
-        
-        /*
-        If we're seeking forward it's simple - just keep reading samples until we hit the sample we're requesting. If we're seeking backwards,
-        we first need to seek back to the start and then just do the same thing as a forward seek.
-        */
-        if (targetFrameIndex < pWav->compressed.iCurrentPCMFrame) {
-            if (!drwav_seek_to_first_pcm_frame(pWav)) {
-                return DRWAV_FALSE;
-            }
-        }
-
-        if (targetFrameIndex > pWav->compressed.iCurrentPCMFrame) {
-            drwav_uint64 offsetInFrames = targetFrameIndex - pWav->compressed.iCurrentPCMFrame;
+    drwav__mapped_advise_willneed((const drwav_uint8*)pWav->mapped.pData + start, end - start);
+    pWav->mapped.prefetchedPos = end;
+}
+#endif  /* DRWAV_HAS_MMAP */
 
-            drwav_int16 devnull[2048];
-            while (offsetInFrames > 0) {
-                drwav_uint64 framesRead = 0;
-                drwav_uint64 framesToRead = offsetInFrames;
-                if (framesToRead > drwav_countof(devnull)/pWav->channels) {
-                    framesToRead = drwav_countof(devnull)/pWav->channels;
-                }
+static size_t drwav__on_read_memory(void* pUserData, void* pBufferOut, size_t bytesToRead)
+{
+    drwav* pWav = (drwav*)pUserData;
+    size_t bytesRemaining;
 
-                if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
-                    framesRead = drwav_read_pcm_frames_s16__msadpcm(pWav, framesToRead, devnull);
-                } else if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM) {
-                    framesRead = drwav_read_pcm_frames_s16__ima(pWav, framesToRead, devnull);
-                } else {
-                    assert(DRWAV_FALSE);    /* If this assertion is triggered it means I've implemented a new compressed format but forgot to add a branch for it here. */
-                }
+    DRWAV_ASSERT(pWav != NULL);
+    DRWAV_ASSERT(pWav->memoryStream.dataSize >= pWav->memoryStream.currentReadPos);
 
-                if (framesRead != framesToRead) {
-                    return DRWAV_FALSE;
-                }
+    bytesRemaining = pWav->memoryStream.dataSize - pWav->memoryStream.currentReadPos;
+    if (bytesToRead > bytesRemaining) {
+        bytesToRead = bytesRemaining;
+    }
 
-                offsetInFrames -= framesRead;
-            }
-        }
-    } else {
-        drwav_uint64 totalSizeInBytes;
-        drwav_uint64 currentBytePos;
-        drwav_uint64 targetBytePos;
-        drwav_uint64 offset;
+    if (bytesToRead > 0) {
+        DRWAV_COPY_MEMORY(pBufferOut, pWav->memoryStream.data + pWav->memoryStream.currentReadPos, bytesToRead);
+        pWav->memoryStream.currentReadPos += bytesToRead;
+#ifdef DRWAV_HAS_MMAP
+        drwav__mapped_prefetch(pWav);
+#endif
+    }
 
-        totalSizeInBytes = pWav->totalPCMFrameCount * drwav_get_bytes_per_pcm_frame(pWav);
-        DRWAV_ASSERT(totalSizeInBytes >= pWav->bytesRemaining);
+    return bytesToRead;
+}
 
-        currentBytePos = totalSizeInBytes - pWav->bytesRemaining;
-        targetBytePos  = targetFrameIndex * drwav_get_bytes_per_pcm_frame(pWav);
+static drwav_bool32 drwav__on_seek_memory(void* pUserData, int offset, drwav_seek_origin origin)
+{
+    drwav* pWav = (drwav*)pUserData;
+    DRWAV_ASSERT(pWav != NULL);
 
-        if (currentBytePos < targetBytePos) {
-            /* Offset forwards. */
-            offset = (targetBytePos - currentBytePos);
+    if (origin == drwav_seek_origin_current) {
+        if (offset > 0) {
+            if (pWav->memoryStream.currentReadPos + offset > pWav->memoryStream.dataSize) {
+                return DRWAV_FALSE; /* Trying to seek too far forward. */
+            }
         } else {
-            /* Offset backwards. */
-            if (!drwav_seek_to_first_pcm_frame(pWav)) {
-                return DRWAV_FALSE;
+            if (pWav->memoryStream.currentReadPos < (size_t)-offset) {
+                return DRWAV_FALSE; /* Trying to seek too far backwards. */
             }
-            offset = targetBytePos;
         }
 
-        while (offset > 0) {
-            int offset32 = ((offset > INT_MAX) ? INT_MAX : (int)offset);
-            if (!pWav->onSeek(pWav->pUserData, offset32, drwav_seek_origin_current)) {
-                return DRWAV_FALSE;
-            }
-
-            pWav->bytesRemaining -= offset32;
-            offset -= offset32;
+        /* This will never underflow thanks to the clamps above. */
+        pWav->memoryStream.currentReadPos += offset;
+    } else {
+        if ((drwav_uint32)offset <= pWav->memoryStream.dataSize) {
+            pWav->memoryStream.currentReadPos = offset;
+        } else {
+            return DRWAV_FALSE; /* Trying to seek too far forward. */
         }
     }
-
+    
     return DRWAV_TRUE;
 }
 
-
-DRWAV_API size_t drwav_write_raw(drwav* pWav, size_t bytesToWrite, const void* pData)
+static size_t drwav__on_write_memory(void* pUserData, const void* pDataIn, size_t bytesToWrite)
 {
-    size_t bytesWritten;
-
-    if (pWav == NULL || bytesToWrite == 0 || pData == NULL) {
-        return 0;
-    }
+    drwav* pWav = (drwav*)pUserData;
+    size_t bytesRemaining;
 
-    bytesWritten = pWav->onWrite(pWav->pUserData, pData, bytesToWrite);
-    pWav->dataChunkDataSize += bytesWritten;
+    DRWAV_ASSERT(pWav != NULL);
+    DRWAV_ASSERT(pWav->memoryStreamWrite.dataCapacity >= pWav->memoryStreamWrite.currentWritePos);
 
-    return bytesWritten;
-}
+    bytesRemaining = pWav->memoryStreamWrite.dataCapacity - pWav->memoryStreamWrite.currentWritePos;
+    if (bytesRemaining < bytesToWrite) {
+        /* Need to reallocate. */
+        void* pNewData;
+        size_t newDataCapacity = (pWav->memoryStreamWrite.dataCapacity == 0) ? 256 : pWav->memoryStreamWrite.dataCapacity * 2;
 
+        /* If doubling wasn't enough, just make it the minimum required size to write the data. */
+        if ((newDataCapacity - pWav->memoryStreamWrite.currentWritePos) < bytesToWrite) {
+            newDataCapacity = pWav->memoryStreamWrite.currentWritePos + bytesToWrite;
+        }
 
-DRWAV_API drwav_uint64 drwav_write_pcm_frames_le(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
-{
-    drwav_uint64 bytesToWrite;
-    drwav_uint64 bytesWritten;
-    const drwav_uint8* pRunningData;
+        pNewData = drwav__realloc_from_callbacks(*pWav->memoryStreamWrite.ppData, newDataCapacity, pWav->memoryStreamWrite.dataCapacity, &pWav->allocationCallbacks);
+        if (pNewData == NULL) {
+            return 0;
+        }
 
-    if (pWav == NULL || framesToWrite == 0 || pData == NULL) {
-        return 0;
+        *pWav->memoryStreamWrite.ppData = pNewData;
+        pWav->memoryStreamWrite.dataCapacity = newDataCapacity;
     }
 
-    bytesToWrite = ((framesToWrite * pWav->channels * pWav->bitsPerSample) / 8);
-    if (bytesToWrite > DRWAV_SIZE_MAX) {
-        return 0;
+    DRWAV_COPY_MEMORY(((drwav_uint8*)(*pWav->memoryStreamWrite.ppData)) + pWav->memoryStreamWrite.currentWritePos, pDataIn, bytesToWrite);
+
+    pWav->memoryStreamWrite.currentWritePos += bytesToWrite;
+    if (pWav->memoryStreamWrite.dataSize < pWav->memoryStreamWrite.currentWritePos) {
+        pWav->memoryStreamWrite.dataSize = pWav->memoryStreamWrite.currentWritePos;
     }
 
-    bytesWritten = 0;
-    pRunningData = (const drwav_uint8*)pData;
+    *pWav->memoryStreamWrite.pDataSize = pWav->memoryStreamWrite.dataSize;
 
-    while (bytesToWrite > 0) {
-        size_t bytesJustWritten;
-        drwav_uint64 bytesToWriteThisIteration;
+    return bytesToWrite;
+}
 
-        bytesToWriteThisIteration = bytesToWrite;
-        DRWAV_ASSERT(bytesToWriteThisIteration <= DRWAV_SIZE_MAX);  /* <-- This is checked above. */
+static drwav_bool32 drwav__on_seek_memory_write(void* pUserData, int offset, drwav_seek_origin origin)
+{
+    drwav* pWav = (drwav*)pUserData;
+    DRWAV_ASSERT(pWav != NULL);
 
-        bytesJustWritten = drwav_write_raw(pWav, (size_t)bytesToWriteThisIteration, pRunningData);
-        if (bytesJustWritten == 0) {
-            break;
+    if (origin == drwav_seek_origin_current) {
+        if (offset > 0) {
+            if (pWav->memoryStreamWrite.currentWritePos + offset > pWav->memoryStreamWrite.dataSize) {
+                offset = (int)(pWav->memoryStreamWrite.dataSize - pWav->memoryStreamWrite.currentWritePos);  /* Trying to seek too far forward. */
+            }
+        } else {
+            if (pWav->memoryStreamWrite.currentWritePos < (size_t)-offset) {
+                offset = -(int)pWav->memoryStreamWrite.currentWritePos;  /* Trying to seek too far backwards. */
+            }
         }
 
-        bytesToWrite -= bytesJustWritten;
-        bytesWritten += bytesJustWritten;
-        pRunningData += bytesJustWritten;
+        /* This will never underflow thanks to the clamps above. */
+        pWav->memoryStreamWrite.currentWritePos += offset;
+    } else {
+        if ((drwav_uint32)offset <= pWav->memoryStreamWrite.dataSize) {
+            pWav->memoryStreamWrite.currentWritePos = offset;
+        } else {
+            pWav->memoryStreamWrite.currentWritePos = pWav->memoryStreamWrite.dataSize;  /* Trying to seek too far forward. */
+        }
     }
-
-    return (bytesWritten * 8) / pWav->bitsPerSample / pWav->channels;
+    
+    return DRWAV_TRUE;
 }
 
-DRWAV_API drwav_uint64 drwav_write_pcm_frames_be(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
+DRWAV_API drwav_bool32 drwav_init_memory(drwav* pWav, const void* data, size_t dataSize, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    drwav_uint64 bytesToWrite;
-    drwav_uint64 bytesWritten;
-    drwav_uint32 bytesPerSample;
-    const drwav_uint8* pRunningData;
+    return drwav_init_memory_ex(pWav, data, dataSize, NULL, NULL, 0, pAllocationCallbacks);
+}
 
-    if (pWav == NULL || framesToWrite == 0 || pData == NULL) {
-        return 0;
+DRWAV_API drwav_bool32 drwav_init_memory_ex(drwav* pWav, const void* data, size_t dataSize, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    if (data == NULL || dataSize == 0) {
+        return DRWAV_FALSE;
     }
 
-    bytesToWrite = ((framesToWrite * pWav->channels * pWav->bitsPerSample) / 8);
-    if (bytesToWrite > DRWAV_SIZE_MAX) {
-        return 0;
+    if (!drwav_preinit(pWav, drwav__on_read_memory, drwav__on_seek_memory, pWav, pAllocationCallbacks)) {
+        return DRWAV_FALSE;
     }
 
-    bytesWritten = 0;
-    pRunningData = (const drwav_uint8*)pData;
+    pWav->memoryStream.data = (const drwav_uint8*)data;
+    pWav->memoryStream.dataSize = dataSize;
+    pWav->memoryStream.currentReadPos = 0;
 
-    bytesPerSample = drwav_get_bytes_per_pcm_frame(pWav) / pWav->channels;
-    
-    while (bytesToWrite > 0) {
-        drwav_uint8 temp[4096];
-        drwav_uint32 sampleCount;
-        size_t bytesJustWritten;
-        drwav_uint64 bytesToWriteThisIteration;
+    return drwav_init__internal(pWav, onChunk, pChunkUserData, flags);
+}
 
-        bytesToWriteThisIteration = bytesToWrite;
-        DRWAV_ASSERT(bytesToWriteThisIteration <= DRWAV_SIZE_MAX);  /* <-- This is checked above. */
 
-        /*
-        WAV files are always little-endian. We need to byte swap on big-endian architectures. Since our input buffer is read-only we need
-        to use an intermediary buffer for the conversion.
-        */
-        sampleCount = sizeof(temp)/bytesPerSample;
+#ifndef DR_WAV_NO_STDIO
+#ifdef DRWAV_HAS_MMAP
+static drwav_bool32 drwav__map_FILE(FILE* pFile, void** ppData, size_t* pDataSize)
+{
+#if defined(_WIN32)
+    HANDLE hFile = (HANDLE)_get_osfhandle(_fileno(pFile));
+    HANDLE hMapping;
+    LARGE_INTEGER fileSize;
+    void* pData;
 
-        if (bytesToWriteThisIteration > ((drwav_uint64)sampleCount)*bytesPerSample) {
-            bytesToWriteThisIteration = ((drwav_uint64)sampleCount)*bytesPerSample;
-        }
+    if (hFile == INVALID_HANDLE_VALUE || !GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart <= 0 || (drwav_uint64)fileSize.QuadPart > DRWAV_SIZE_MAX) {
+        return DRWAV_FALSE;
+    }
 
-        DRWAV_COPY_MEMORY(temp, pRunningData, (size_t)bytesToWriteThisIteration);
-        drwav__bswap_samples(temp, sampleCount, bytesPerSample, pWav->translatedFormatTag);
+    hMapping = CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping == NULL) {
+        return DRWAV_FALSE;
+    }
 
-        bytesJustWritten = drwav_write_raw(pWav, (size_t)bytesToWriteThisIteration, temp);
-        if (bytesJustWritten == 0) {
-            break;
-        }
+    /* The view keeps the mapping object alive. */
+    pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMapping);
+    if (pData == NULL) {
+        return DRWAV_FALSE;
+    }
 
-        bytesToWrite -= bytesJustWritten;
-        bytesWritten += bytesJustWritten;
-        pRunningData += bytesJustWritten;
+    *ppData    = pData;
+    *pDataSize = (size_t)fileSize.QuadPart;
+    return DRWAV_TRUE;
+#else
+    int fd = fileno(pFile);
+    struct stat fileInfo;
+    void* pData;
+
+    if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0 || (drwav_uint64)fileInfo.st_size > DRWAV_SIZE_MAX) {
+        return DRWAV_FALSE;
     }
 
-    return (bytesWritten * 8) / pWav->bitsPerSample / pWav->channels;
+    pData = mmap(NULL, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (pData == MAP_FAILED) {
+        return DRWAV_FALSE;
+    }
+
+    /* Mostly read front to back, so the kernel can read ahead aggressively and drop pages behind the read position. */
+    posix_madvise(pData, (size_t)fileInfo.st_size, POSIX_MADV_SEQUENTIAL);
+
+    *ppData    = pData;
+    *pDataSize = (size_t)fileInfo.st_size;
+    return DRWAV_TRUE;
+#endif
 }
 
-DRWAV_API drwav_uint64 drwav_write_pcm_frames(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
+static void drwav__unmap(void* pData, size_t dataSize)
 {
-    if (drwav__is_little_endian()) {
-        return drwav_write_pcm_frames_le(pWav, framesToWrite, pData);
-    } else {
-        return drwav_write_pcm_frames_be(pWav, framesToWrite, pData);
-    }
+#if defined(_WIN32)
+    (void)dataSize;
+    UnmapViewOfFile(pData);
+#else
+    munmap(pData, dataSize);
+#endif
 }
+#endif  /* DRWAV_HAS_MMAP */
 
-
-static drwav_uint64 drwav_read_pcm_frames_s16__msadpcm(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* pBufferOut)
+/* Takes ownership of the FILE* object, which is closed once the file is mapped. */
+static drwav_bool32 drwav_init_file_mapped__internal_FILE(drwav* pWav, FILE* pFile, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
-    drwav_uint64 totalFramesRead = 0;
+#ifdef DRWAV_HAS_MMAP
+    void* pData;
+    size_t dataSize;
+    drwav_bool32 result;
 
-    DRWAV_ASSERT(pWav != NULL);
-    DRWAV_ASSERT(framesToRead > 0);
-    DRWAV_ASSERT(pBufferOut != NULL);
+    result = drwav__map_FILE(pFile, &pData, &dataSize);
+    fclose(pFile);  /* The mapping holds its own reference to the file. */
+    if (result != DRWAV_TRUE) {
+        return DRWAV_FALSE;
+    }
 
-    /* TODO: Lots of room for optimization here. */
+    if (!drwav_init_memory_ex(pWav, pData, dataSize, onChunk, pChunkUserData, flags, pAllocationCallbacks)) {
+        drwav__unmap(pData, dataSize);
+        return DRWAV_FALSE;
+    }
 
-    while (framesToRead > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
-        /* If there are no cached frames we need to load a new block. */
-        if (pWav->msadpcm.cachedFrameCount == 0 && pWav->msadpcm.bytesRemainingInBlock == 0) {
-            if (pWav->channels == 1) {
-                /* Mono. */
-                drwav_uint8 header[7];
-                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
-                    return totalFramesRead;
-                }
-                pWav->msadpcm.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+    pWav->mapped.pData         = pData;
+    pWav->mapped.dataSize      = dataSize;
+    pWav->mapped.prefetchedPos = 0;
+    drwav__mapped_prefetch(pWav);
 
-                pWav->msadpcm.predictor[0]     = header[0];
-                pWav->msadpcm.delta[0]         = drwav__bytes_to_s16(header + 1);
-                pWav->msadpcm.prevFrames[0][1] = (drwav_int32)drwav__bytes_to_s16(header + 3);
-                pWav->msadpcm.prevFrames[0][0] = (drwav_int32)drwav__bytes_to_s16(header + 5);
-                pWav->msadpcm.cachedFrames[2]  = pWav->msadpcm.prevFrames[0][0];
-                pWav->msadpcm.cachedFrames[3]  = pWav->msadpcm.prevFrames[0][1];
-                pWav->msadpcm.cachedFrameCount = 2;
-            } else {
-                /* Stereo. */
-                drwav_uint8 header[14];
-                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
-                    return totalFramesRead;
-                }
-                pWav->msadpcm.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+    return DRWAV_TRUE;
+#else
+    (void)pWav;
+    (void)onChunk;
+    (void)pChunkUserData;
+    (void)flags;
+    (void)pAllocationCallbacks;
+    fclose(pFile);
+    return DRWAV_FALSE;
+#endif
+}
 
-                pWav->msadpcm.predictor[0] = header[0];
-                pWav->msadpcm.predictor[1] = header[1];
-                pWav->msadpcm.delta[0] = drwav__bytes_to_s16(header + 2);
-                pWav->msadpcm.delta[1] = drwav__bytes_to_s16(header + 4);
-                pWav->msadpcm.prevFrames[0][1] = (drwav_int32)drwav__bytes_to_s16(header + 6);
-                pWav->msadpcm.prevFrames[1][1] = (drwav_int32)drwav__bytes_to_s16(header + 8);
-                pWav->msadpcm.prevFrames[0][0] = (drwav_int32)drwav__bytes_to_s16(header + 10);
-                pWav->msadpcm.prevFrames[1][0] = (drwav_int32)drwav__bytes_to_s16(header + 12);
+DRWAV_API drwav_bool32 drwav_init_file_mapped(drwav* pWav, const char* filename, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_file_mapped_ex(pWav, filename, NULL, NULL, 0, pAllocationCallbacks);
+}
 
-                pWav->msadpcm.cachedFrames[0] = pWav->msadpcm.prevFrames[0][0];
-                pWav->msadpcm.cachedFrames[1] = pWav->msadpcm.prevFrames[1][0];
-                pWav->msadpcm.cachedFrames[2] = pWav->msadpcm.prevFrames[0][1];
-                pWav->msadpcm.cachedFrames[3] = pWav->msadpcm.prevFrames[1][1];
-                pWav->msadpcm.cachedFrameCount = 2;
-            }
-        }
+DRWAV_API drwav_bool32 drwav_init_file_mapped_ex(drwav* pWav, const char* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    FILE* pFile;
+    if (drwav_fopen(&pFile, filename, "rb") != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
+    }
 
-        /* Output anything that's cached. */
-        while (framesToRead > 0 && pWav->msadpcm.cachedFrameCount > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
-            drwav_uint32 iSample = 0;
-            for (iSample = 0; iSample < pWav->channels; iSample += 1) {
-                pBufferOut[iSample] = (drwav_int16)pWav->msadpcm.cachedFrames[(drwav_countof(pWav->msadpcm.cachedFrames) - (pWav->msadpcm.cachedFrameCount*pWav->channels)) + iSample];
-            }
+    return drwav_init_file_mapped__internal_FILE(pWav, pFile, onChunk, pChunkUserData, flags, pAllocationCallbacks);
+}
 
-            pBufferOut      += pWav->channels;
-            framesToRead    -= 1;
-            totalFramesRead += 1;
-            pWav->compressed.iCurrentPCMFrame += 1;
-            pWav->msadpcm.cachedFrameCount -= 1;
-        }
+DRWAV_API drwav_bool32 drwav_init_file_mapped_w(drwav* pWav, const wchar_t* filename, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_file_mapped_ex_w(pWav, filename, NULL, NULL, 0, pAllocationCallbacks);
+}
 
-        if (framesToRead == 0) {
-            return totalFramesRead;
-        }
+DRWAV_API drwav_bool32 drwav_init_file_mapped_ex_w(drwav* pWav, const wchar_t* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    FILE* pFile;
+    if (drwav_wfopen(&pFile, filename, L"rb", pAllocationCallbacks) != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
+    }
 
+    return drwav_init_file_mapped__internal_FILE(pWav, pFile, onChunk, pChunkUserData, flags, pAllocationCallbacks);
+}
+#endif  /* DR_WAV_NO_STDIO */
 
-        /*
-        If there's nothing left in the cache, just go ahead and load more. If there's nothing left to load in the current block we just continue to the next
-        loop iteration which will trigger the loading of a new block.
-        */
-        if (pWav->msadpcm.cachedFrameCount == 0) {
-            if (pWav->msadpcm.bytesRemainingInBlock == 0) {
-                continue;
-            } else {
-                static drwav_int32 adaptationTable[] = { 
-                    230, 230, 230, 230, 307, 409, 512, 614, 
-                    768, 614, 512, 409, 307, 230, 230, 230 
-                };
-                static drwav_int32 coeff1Table[] = { 256, 512, 0, 192, 240, 460,  392 };
-                static drwav_int32 coeff2Table[] = { 0,  -256, 0, 64,  0,  -208, -232 };
 
-                drwav_uint8 nibbles;
-                drwav_int32 nibble0;
-                drwav_int32 nibble1;
+static drwav_bool32 drwav_init_memory_write__internal(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, drwav_bool32 isSequential, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    if (ppData == NULL || pDataSize == NULL) {
+        return DRWAV_FALSE;
+    }
 
-                if (pWav->onRead(pWav->pUserData, &nibbles, 1) != 1) {
-                    return totalFramesRead;
-                }
-                pWav->msadpcm.bytesRemainingInBlock -= 1;
+    *ppData = NULL; /* Important because we're using realloc()! */
+    *pDataSize = 0;
+
+    if (!drwav_preinit_write(pWav, pFormat, isSequential, drwav__on_write_memory, drwav__on_seek_memory_write, pWav, pAllocationCallbacks)) {
+        return DRWAV_FALSE;
+    }
 
-                /* TODO: Optimize away these if statements. */
-                nibble0 = ((nibbles & 0xF0) >> 4); if ((nibbles & 0x80)) { nibble0 |= 0xFFFFFFF0UL; }
-                nibble1 = ((nibbles & 0x0F) >> 0); if ((nibbles & 0x08)) { nibble1 |= 0xFFFFFFF0UL; }
+    pWav->memoryStreamWrite.ppData = ppData;
+    pWav->memoryStreamWrite.pDataSize = pDataSize;
+    pWav->memoryStreamWrite.dataSize = 0;
+    pWav->memoryStreamWrite.dataCapacity = 0;
+    pWav->memoryStreamWrite.currentWritePos = 0;
 
-                if (pWav->channels == 1) {
-                    /* Mono. */
-                    drwav_int32 newSample0;
-                    drwav_int32 newSample1;
+    return drwav_init_write__internal(pWav, pFormat, totalSampleCount);
+}
 
-                    newSample0  = ((pWav->msadpcm.prevFrames[0][1] * coeff1Table[pWav->msadpcm.predictor[0]]) + (pWav->msadpcm.prevFrames[0][0] * coeff2Table[pWav->msadpcm.predictor[0]])) >> 8;
-                    newSample0 += nibble0 * pWav->msadpcm.delta[0];
-                    newSample0  = drwav_clamp(newSample0, -32768, 32767);
+DRWAV_API drwav_bool32 drwav_init_memory_write(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_memory_write__internal(pWav, ppData, pDataSize, pFormat, 0, DRWAV_FALSE, pAllocationCallbacks);
+}
 
-                    pWav->msadpcm.delta[0] = (adaptationTable[((nibbles & 0xF0) >> 4)] * pWav->msadpcm.delta[0]) >> 8;
-                    if (pWav->msadpcm.delta[0] < 16) {
-                        pWav->msadpcm.delta[0] = 16;
-                    }
+DRWAV_API drwav_bool32 drwav_init_memory_write_sequential(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_memory_write__internal(pWav, ppData, pDataSize, pFormat, totalSampleCount, DRWAV_TRUE, pAllocationCallbacks);
+}
 
-                    pWav->msadpcm.prevFrames[0][0] = pWav->msadpcm.prevFrames[0][1];
-                    pWav->msadpcm.prevFrames[0][1] = newSample0;
+DRWAV_API drwav_bool32 drwav_init_memory_write_sequential_pcm_frames(drwav* pWav, void** ppData, size_t* pDataSize, const drwav_data_format* pFormat, drwav_uint64 totalPCMFrameCount, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    if (pFormat == NULL) {
+        return DRWAV_FALSE;
+    }
 
+    return drwav_init_memory_write_sequential(pWav, ppData, pDataSize, pFormat, totalPCMFrameCount*pFormat->channels, pAllocationCallbacks);
+}
 
-                    newSample1  = ((pWav->msadpcm.prevFrames[0][1] * coeff1Table[pWav->msadpcm.predictor[0]]) + (pWav->msadpcm.prevFrames[0][0] * coeff2Table[pWav->msadpcm.predictor[0]])) >> 8;
-                    newSample1 += nibble1 * pWav->msadpcm.delta[0];
-                    newSample1  = drwav_clamp(newSample1, -32768, 32767);
 
-                    pWav->msadpcm.delta[0] = (adaptationTable[((nibbles & 0x0F) >> 0)] * pWav->msadpcm.delta[0]) >> 8;
-                    if (pWav->msadpcm.delta[0] < 16) {
-                        pWav->msadpcm.delta[0] = 16;
-                    }
 
-                    pWav->msadpcm.prevFrames[0][0] = pWav->msadpcm.prevFrames[0][1];
-                    pWav->msadpcm.prevFrames[0][1] = newSample1;
+DRWAV_API drwav_result drwav_uninit(drwav* pWav)
+{
+    drwav_result result = DRWAV_SUCCESS;
 
+    if (pWav == NULL) {
+        return DRWAV_INVALID_ARGS;
+    }
 
-                    pWav->msadpcm.cachedFrames[2] = newSample0;
-                    pWav->msadpcm.cachedFrames[3] = newSample1;
-                    pWav->msadpcm.cachedFrameCount = 2;
-                } else {
-                    /* Stereo. */
-                    drwav_int32 newSample0;
-                    drwav_int32 newSample1;
-
-                    /* Left. */
-                    newSample0  = ((pWav->msadpcm.prevFrames[0][1] * coeff1Table[pWav->msadpcm.predictor[0]]) + (pWav->msadpcm.prevFrames[0][0] * coeff2Table[pWav->msadpcm.predictor[0]])) >> 8;
-                    newSample0 += nibble0 * pWav->msadpcm.delta[0];
-                    newSample0  = drwav_clamp(newSample0, -32768, 32767);
-
-                    pWav->msadpcm.delta[0] = (adaptationTable[((nibbles & 0xF0) >> 4)] * pWav->msadpcm.delta[0]) >> 8;
-                    if (pWav->msadpcm.delta[0] < 16) {
-                        pWav->msadpcm.delta[0] = 16;
-                    }
+    /*
+    If the drwav object was opened in write mode we'll need to finalize a few things:
+      - Make sure the "data" chunk is aligned to 16-bits for RIFF containers, or 64 bits for W64 containers.
+      - Set the size of the "data" chunk.
+    */
+    if (pWav->onWrite != NULL) {
+        drwav_uint32 paddingSize = 0;
 
-                    pWav->msadpcm.prevFrames[0][0] = pWav->msadpcm.prevFrames[0][1];
-                    pWav->msadpcm.prevFrames[0][1] = newSample0;
+        /* Padding. Do not adjust pWav->dataChunkDataSize - this should not include the padding. */
+        if (pWav->container == drwav_container_riff) {
+            paddingSize = drwav__chunk_padding_size_riff(pWav->dataChunkDataSize);
+        } else {
+            paddingSize = drwav__chunk_padding_size_w64(pWav->dataChunkDataSize);
+        }
+        
+        if (paddingSize > 0) {
+            drwav_uint64 paddingData = 0;
+            pWav->onWrite(pWav->pUserData, &paddingData, paddingSize);
+        }
 
+        /*
+        Chunk sizes. When using sequential mode, these will have been filled in at initialization time. We only need
+        to do this when using non-sequential mode.
+        */
+        if (pWav->onSeek && !pWav->isSequentialWrite) {
+            if (pWav->container == drwav_container_riff && pWav->isRF64Reserved) {
+                drwav_uint64 riffChunkSize = 36 + 8 + DRWAV_DS64_CHUNK_SIZE + pWav->dataChunkDataSize + paddingSize;
+                if (riffChunkSize > 0xFFFFFFFF) {
+                    /* Too big for RIFF. The "RIFF" and "data" sizes become 0xFFFFFFFF and the real ones go into the "ds64" chunk in place of the "JUNK" chunk. */
+                    if (pWav->onSeek(pWav->pUserData, 0, drwav_seek_origin_start)) {
+                        drwav_uint32 riffChunkSize32 = 0xFFFFFFFF;
+                        drwav_uint32 ds64ChunkSize   = DRWAV_DS64_CHUNK_SIZE;
+                        drwav_uint64 sampleCount     = pWav->dataChunkDataSize / drwav_get_bytes_per_pcm_frame(pWav);
+                        drwav_uint32 tableLength     = 0;
+                        pWav->onWrite(pWav->pUserData, "RF64", 4);
+                        pWav->onWrite(pWav->pUserData, &riffChunkSize32, 4);
+                        pWav->onWrite(pWav->pUserData, "WAVE", 4);
+                        pWav->onWrite(pWav->pUserData, "ds64", 4);
+                        pWav->onWrite(pWav->pUserData, &ds64ChunkSize, 4);
+                        pWav->onWrite(pWav->pUserData, &riffChunkSize, 8);
+                        pWav->onWrite(pWav->pUserData, &pWav->dataChunkDataSize, 8);
+                        pWav->onWrite(pWav->pUserData, &sampleCount, 8);
+                        pWav->onWrite(pWav->pUserData, &tableLength, 4);
+                    }
 
-                    /* Right. */
-                    newSample1  = ((pWav->msadpcm.prevFrames[1][1] * coeff1Table[pWav->msadpcm.predictor[1]]) + (pWav->msadpcm.prevFrames[1][0] * coeff2Table[pWav->msadpcm.predictor[1]])) >> 8;
-                    newSample1 += nibble1 * pWav->msadpcm.delta[1];
-                    newSample1  = drwav_clamp(newSample1, -32768, 32767);
+                    if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 4, drwav_seek_origin_start)) {
+                        drwav_uint32 dataChunkSize = 0xFFFFFFFF;
+                        pWav->onWrite(pWav->pUserData, &dataChunkSize, 4);
+                    }
+                } else {
+                    if (pWav->onSeek(pWav->pUserData, 4, drwav_seek_origin_start)) {
+                        drwav_uint32 riffChunkSize32 = (drwav_uint32)riffChunkSize;
+                        pWav->onWrite(pWav->pUserData, &riffChunkSize32, 4);
+                    }
 
-                    pWav->msadpcm.delta[1] = (adaptationTable[((nibbles & 0x0F) >> 0)] * pWav->msadpcm.delta[1]) >> 8;
-                    if (pWav->msadpcm.delta[1] < 16) {
-                        pWav->msadpcm.delta[1] = 16;
+                    if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 4, drwav_seek_origin_start)) {
+                        drwav_uint32 dataChunkSize = (drwav_uint32)pWav->dataChunkDataSize;
+                        pWav->onWrite(pWav->pUserData, &dataChunkSize, 4);
                     }
+                }
+            } else if (pWav->container == drwav_container_riff) {
+                /* The "RIFF" chunk size. */
+                if (pWav->onSeek(pWav->pUserData, 4, drwav_seek_origin_start)) {
+                    drwav_uint32 riffChunkSize = drwav__riff_chunk_size_riff(pWav->dataChunkDataSize);
+                    pWav->onWrite(pWav->pUserData, &riffChunkSize, 4);
+                }
 
-                    pWav->msadpcm.prevFrames[1][0] = pWav->msadpcm.prevFrames[1][1];
-                    pWav->msadpcm.prevFrames[1][1] = newSample1;
+                /* the "data" chunk size. */
+                if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 4, drwav_seek_origin_start)) {
+                    drwav_uint32 dataChunkSize = drwav__data_chunk_size_riff(pWav->dataChunkDataSize);
+                    pWav->onWrite(pWav->pUserData, &dataChunkSize, 4);
+                }
+            } else {
+                /* The "RIFF" chunk size. */
+                if (pWav->onSeek(pWav->pUserData, 16, drwav_seek_origin_start)) {
+                    drwav_uint64 riffChunkSize = drwav__riff_chunk_size_w64(pWav->dataChunkDataSize);
+                    pWav->onWrite(pWav->pUserData, &riffChunkSize, 8);
+                }
 
-                    pWav->msadpcm.cachedFrames[2] = newSample0;
-                    pWav->msadpcm.cachedFrames[3] = newSample1;
-                    pWav->msadpcm.cachedFrameCount = 1;
+                /* The "data" chunk size. */
+                if (pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos + 16, drwav_seek_origin_start)) {
+                    drwav_uint64 dataChunkSize = drwav__data_chunk_size_w64(pWav->dataChunkDataSize);
+                    pWav->onWrite(pWav->pUserData, &dataChunkSize, 8);
                 }
             }
         }
+
+        /* Validation for sequential mode. */
+        if (pWav->isSequentialWrite) {
+            if (pWav->dataChunkDataSize != pWav->dataChunkDataSizeTargetWrite) {
+                result = DRWAV_INVALID_FILE;
+            }
+        }
     }
 
-    return totalFramesRead;
+#ifndef DR_WAV_NO_STDIO
+    /*
+    If we opened the file with drwav_open_file() we will want to close the file handle. We can know whether or not drwav_open_file()
+    was used by looking at the onRead and onSeek callbacks.
+    */
+    if (pWav->onRead == drwav__on_read_stdio || pWav->onWrite == drwav__on_write_stdio) {
+        fclose((FILE*)pWav->pUserData);
+    }
+
+    /* Opened with drwav_init_file_write_async(). This waits for the last of the data to be written. */
+    if (pWav->onWrite == drwav__on_write_async) {
+        drwav_result asyncResult = drwav__async_uninit((drwav__async_file*)pWav->pUserData, &pWav->allocationCallbacks);
+        if (result == DRWAV_SUCCESS) {
+            result = asyncResult;
+        }
+    }
+#endif
+
+#ifdef DRWAV_HAS_MMAP
+    /* Opened with drwav_init_file_mapped(). */
+    if (pWav->mapped.pData != NULL) {
+        drwav__unmap(pWav->mapped.pData, pWav->mapped.dataSize);
+        pWav->mapped.pData = NULL;
+    }
+#endif
+
+    return result;
 }
 
 
-static drwav_uint64 drwav_read_pcm_frames_s16__ima(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* pBufferOut)
+
+DRWAV_API size_t drwav_read_raw(drwav* pWav, size_t bytesToRead, void* pBufferOut)
 {
-    drwav_uint64 totalFramesRead = 0;
+    size_t bytesRead;
 
-    DRWAV_ASSERT(pWav != NULL);
-    DRWAV_ASSERT(framesToRead > 0);
-    DRWAV_ASSERT(pBufferOut != NULL);
+    if (pWav == NULL || bytesToRead == 0 || pBufferOut == NULL) {
+        return 0;
+    }
 
-    /* TODO: Lots of room for optimization here. */
+    if (bytesToRead > pWav->bytesRemaining) {
+        bytesToRead = (size_t)pWav->bytesRemaining;
+    }
 
-    while (framesToRead > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
-        /* If there are no cached samples we need to load a new block. */
-        if (pWav->ima.cachedFrameCount == 0 && pWav->ima.bytesRemainingInBlock == 0) {
-            if (pWav->channels == 1) {
-                /* Mono. */
-                drwav_uint8 header[4];
-                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
-                    return totalFramesRead;
-                }
-                pWav->ima.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+    bytesRead = pWav->onRead(pWav->pUserData, pBufferOut, bytesToRead);
 
-                pWav->ima.predictor[0] = drwav__bytes_to_s16(header + 0);
-                pWav->ima.stepIndex[0] = header[2];
-                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 1] = pWav->ima.predictor[0];
-                pWav->ima.cachedFrameCount = 1;
-            } else {
-                /* Stereo. */
-                drwav_uint8 header[8];
-                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
-                    return totalFramesRead;
-                }
-                pWav->ima.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+    pWav->bytesRemaining -= bytesRead;
+    return bytesRead;
+}
 
-                pWav->ima.predictor[0] = drwav__bytes_to_s16(header + 0);
-                pWav->ima.stepIndex[0] = header[2];
-                pWav->ima.predictor[1] = drwav__bytes_to_s16(header + 4);
-                pWav->ima.stepIndex[1] = header[6];
 
-                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 2] = pWav->ima.predictor[0];
-                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 1] = pWav->ima.predictor[1];
-                pWav->ima.cachedFrameCount = 1;
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_le(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
+{
+    drwav_uint32 bytesPerFrame;
+
+    if (pWav == NULL || framesToRead == 0 || pBufferOut == NULL) {
+        return 0;
+    }
+
+    /* Cannot use this function for compressed formats. */
+    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
+        return 0;
+    }
+
+    bytesPerFrame = drwav_get_bytes_per_pcm_frame(pWav);
+    if (bytesPerFrame == 0) {
+        return 0;
+    }
+
+    /* Don't try to read more samples than can potentially fit in the output buffer. */
+    if (framesToRead * bytesPerFrame > DRWAV_SIZE_MAX) {
+        framesToRead = DRWAV_SIZE_MAX / bytesPerFrame;
+    }
+
+    return drwav_read_raw(pWav, (size_t)(framesToRead * bytesPerFrame), pBufferOut) / bytesPerFrame;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_be(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
+{
+    drwav_uint64 framesRead = drwav_read_pcm_frames_le(pWav, framesToRead, pBufferOut);
+    drwav__bswap_samples(pBufferOut, framesRead*pWav->channels, drwav_get_bytes_per_pcm_frame(pWav)/pWav->channels, pWav->translatedFormatTag);
+
+    return framesRead;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut)
+{
+    if (drwav__is_little_endian()) {
+        return drwav_read_pcm_frames_le(pWav, framesToRead, pBufferOut);
+    } else {
+        return drwav_read_pcm_frames_be(pWav, framesToRead, pBufferOut);
+    }
+}
+
+
+static drwav_bool32 drwav__can_map_pcm_frames(drwav* pWav)
+{
+    return pWav->onRead == drwav__on_read_memory && pWav->onWrite == NULL && !drwav__is_compressed_format_tag(pWav->translatedFormatTag) && drwav__is_little_endian();
+}
+
+DRWAV_API drwav_uint64 drwav_map_pcm_frames(drwav* pWav, drwav_uint64 framesToMap, const void** ppFrames)
+{
+    drwav_uint32 bytesPerFrame;
+    drwav_uint64 framesAvailable;
+    size_t bytesInStream;
+
+    if (ppFrames == NULL) {
+        return 0;
+    }
+
+    *ppFrames = NULL;
+
+    if (pWav == NULL || !drwav__can_map_pcm_frames(pWav)) {
+        return 0;
+    }
+
+    bytesPerFrame = drwav_get_bytes_per_pcm_frame(pWav);
+    if (bytesPerFrame == 0) {
+        return 0;
+    }
+
+    /* The data chunk can claim more than the file holds if it's been truncated. */
+    bytesInStream   = pWav->memoryStream.dataSize - pWav->memoryStream.currentReadPos;
+    framesAvailable = drwav_min(pWav->bytesRemaining, bytesInStream) / bytesPerFrame;
+    if (framesToMap > framesAvailable) {
+        framesToMap = framesAvailable;
+    }
+
+    *ppFrames = pWav->memoryStream.data + pWav->memoryStream.currentReadPos;
+    pWav->memoryStream.currentReadPos += (size_t)(framesToMap * bytesPerFrame);
+    pWav->bytesRemaining              -= framesToMap * bytesPerFrame;
+#ifdef DRWAV_HAS_MMAP
+    drwav__mapped_prefetch(pWav);
+#endif
+
+    return framesToMap;
+}
+
+
+
+/* Discards whatever is left of the ADPCM block being decoded so the next read starts on a new one. */
+static void drwav__reset_adpcm_block(drwav* pWav)
+{
+    pWav->msadpcm.cachedFrameCount      = 0;
+    pWav->msadpcm.bytesRemainingInBlock = 0;
+    pWav->ima.cachedFrameCount          = 0;
+    pWav->ima.bytesRemainingInBlock     = 0;
+}
+
+static drwav_bool32 drwav__is_on_adpcm_block_boundary(drwav* pWav)
+{
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+        return pWav->msadpcm.cachedFrameCount == 0 && pWav->msadpcm.bytesRemainingInBlock == 0;
+    }
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM) {
+        return pWav->ima.cachedFrameCount == 0 && pWav->ima.bytesRemainingInBlock == 0;
+    }
+
+    return DRWAV_FALSE;
+}
+
+DRWAV_API drwav_bool32 drwav_seek_to_first_pcm_frame(drwav* pWav)
+{
+    if (pWav->onWrite != NULL) {
+        return DRWAV_FALSE; /* No seeking in write mode. */
+    }
+
+    if (!pWav->onSeek(pWav->pUserData, (int)pWav->dataChunkDataPos, drwav_seek_origin_start)) {
+        return DRWAV_FALSE;
+    }
+
+    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
+        pWav->compressed.iCurrentPCMFrame = 0;
+        drwav__reset_adpcm_block(pWav);
+    }
+    
+    pWav->bytesRemaining = pWav->dataChunkDataSize;
+    return DRWAV_TRUE;
+}
+
+DRWAV_API drwav_bool32 drwav_seek_to_pcm_frame(drwav* pWav, drwav_uint64 targetFrameIndex)
+{
+    /* Seeking should be compatible with wave files > 2GB. */
+
+    if (pWav == NULL || pWav->onSeek == NULL) {
+        return DRWAV_FALSE;
+    }
+
+    /* No seeking in write mode. */
+    if (pWav->onWrite != NULL) {
+        return DRWAV_FALSE;
+    }
+
+    /* If there are no samples, just return DRWAV_TRUE without doing anything. */
+    if (pWav->totalPCMFrameCount == 0) {
+        return DRWAV_TRUE;
+    }
+
+    /* Make sure the sample is clamped. */
+    if (targetFrameIndex >= pWav->totalPCMFrameCount) {
+        targetFrameIndex  = pWav->totalPCMFrameCount - 1;
+    }
+
+    /*
+    For compressed formats the blocks are independent, so we seek straight to the start of the block holding the target frame and then
+    decode forward from there. If the target is further on in the block currently being decoded we just keep decoding.
+    */
+    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
+        drwav_uint32 framesPerBlock = drwav_get_pcm_frames_per_block(pWav);
+        if (framesPerBlock > 0) {
+            drwav_uint64 iTargetBlock = targetFrameIndex / framesPerBlock;
+            if (targetFrameIndex < pWav->compressed.iCurrentPCMFrame || iTargetBlock != pWav->compressed.iCurrentPCMFrame / framesPerBlock) {
+                drwav_uint64 blockOffset = iTargetBlock * pWav->fmt.blockAlign;
+                if (!drwav__seek_from_start(pWav->onSeek, pWav->dataChunkDataPos + blockOffset, pWav->pUserData)) {
+                    return DRWAV_FALSE;
+                }
+
+                pWav->compressed.iCurrentPCMFrame = iTargetBlock * framesPerBlock;
+                pWav->bytesRemaining              = pWav->dataChunkDataSize - drwav_min(pWav->dataChunkDataSize, blockOffset);
+                drwav__reset_adpcm_block(pWav);
+            }
+        } else if (targetFrameIndex < pWav->compressed.iCurrentPCMFrame) {
+            if (!drwav_seek_to_first_pcm_frame(pWav)) {
+                return DRWAV_FALSE;
             }
         }
 
-        /* Output anything that's cached. */
-        while (framesToRead > 0 && pWav->ima.cachedFrameCount > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
-            drwav_uint32 iSample;
-            for (iSample = 0; iSample < pWav->channels; iSample += 1) {
-                pBufferOut[iSample] = (drwav_int16)pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + iSample];
+        if (targetFrameIndex > pWav->compressed.iCurrentPCMFrame) {
+            drwav_uint64 offsetInFrames = targetFrameIndex - pWav->compressed.iCurrentPCMFrame;
+
+            drwav_int16 devnull[2048];
+            while (offsetInFrames > 0) {
+                drwav_uint64 framesRead = 0;
+                drwav_uint64 framesToRead = offsetInFrames;
+                if (framesToRead > drwav_countof(devnull)/pWav->channels) {
+                    framesToRead = drwav_countof(devnull)/pWav->channels;
+                }
+
+                if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+                    framesRead = drwav_read_pcm_frames_s16__msadpcm(pWav, framesToRead, devnull);
+                } else if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM) {
+                    framesRead = drwav_read_pcm_frames_s16__ima(pWav, framesToRead, devnull);
+                } else {
+                    assert(DRWAV_FALSE);    /* If this assertion is triggered it means I've implemented a new compressed format but forgot to add a branch for it here. */
+                }
+
+                if (framesRead != framesToRead) {
+                    return DRWAV_FALSE;
+                }
+
+                offsetInFrames -= framesRead;
             }
+        }
+    } else {
+        drwav_uint64 totalSizeInBytes;
+        drwav_uint64 currentBytePos;
+        drwav_uint64 targetBytePos;
+        drwav_uint64 offset;
 
-            pBufferOut      += pWav->channels;
-            framesToRead    -= 1;
-            totalFramesRead += 1;
-            pWav->compressed.iCurrentPCMFrame += 1;
-            pWav->ima.cachedFrameCount -= 1;
+        totalSizeInBytes = pWav->totalPCMFrameCount * drwav_get_bytes_per_pcm_frame(pWav);
+        DRWAV_ASSERT(totalSizeInBytes >= pWav->bytesRemaining);
+
+        currentBytePos = totalSizeInBytes - pWav->bytesRemaining;
+        targetBytePos  = targetFrameIndex * drwav_get_bytes_per_pcm_frame(pWav);
+
+        if (currentBytePos < targetBytePos) {
+            /* Offset forwards. */
+            offset = (targetBytePos - currentBytePos);
+        } else {
+            /* Offset backwards. */
+            if (!drwav_seek_to_first_pcm_frame(pWav)) {
+                return DRWAV_FALSE;
+            }
+            offset = targetBytePos;
         }
 
-        if (framesToRead == 0) {
-            return totalFramesRead;
+        while (offset > 0) {
+            int offset32 = ((offset > INT_MAX) ? INT_MAX : (int)offset);
+            if (!pWav->onSeek(pWav->pUserData, offset32, drwav_seek_origin_current)) {
+                return DRWAV_FALSE;
+            }
+
+            pWav->bytesRemaining -= offset32;
+            offset -= offset32;
         }
+    }
 
-        /*
-        If there's nothing left in the cache, just go ahead and load more. If there's nothing left to load in the current block we just continue to the next
-        loop iteration which will trigger the loading of a new block.
-        */
-        if (pWav->ima.cachedFrameCount == 0) {
-            if (pWav->ima.bytesRemainingInBlock == 0) {
-                continue;
-            } else {
-                static drwav_int32 indexTable[16] = {
-                    -1, -1, -1, -1, 2, 4, 6, 8,
-                    -1, -1, -1, -1, 2, 4, 6, 8
-                };
-
-                static drwav_int32 stepTable[89] = {
-                    7,     8,     9,     10,    11,    12,    13,    14,    16,    17, 
-                    19,    21,    23,    25,    28,    31,    34,    37,    41,    45, 
-                    50,    55,    60,    66,    73,    80,    88,    97,    107,   118, 
-                    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
-                    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
-                    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066, 
-                    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
-                    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 
-                    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 
-                };
+    return DRWAV_TRUE;
+}
 
-                drwav_uint32 iChannel;
 
-                /*
-                From what I can tell with stereo streams, it looks like every 4 bytes (8 samples) is for one channel. So it goes 4 bytes for the
-                left channel, 4 bytes for the right channel.
-                */
-                pWav->ima.cachedFrameCount = 8;
-                for (iChannel = 0; iChannel < pWav->channels; ++iChannel) {
-                    drwav_uint32 iByte;
-                    drwav_uint8 nibbles[4];
-                    if (pWav->onRead(pWav->pUserData, &nibbles, 4) != 4) {
-                        pWav->ima.cachedFrameCount = 0;
-                        return totalFramesRead;
-                    }
-                    pWav->ima.bytesRemainingInBlock -= 4;
+DRWAV_API size_t drwav_write_raw(drwav* pWav, size_t bytesToWrite, const void* pData)
+{
+    size_t bytesWritten;
 
-                    for (iByte = 0; iByte < 4; ++iByte) {
-                        drwav_uint8 nibble0 = ((nibbles[iByte] & 0x0F) >> 0);
-                        drwav_uint8 nibble1 = ((nibbles[iByte] & 0xF0) >> 4);
+    if (pWav == NULL || bytesToWrite == 0 || pData == NULL) {
+        return 0;
+    }
+
+    bytesWritten = pWav->onWrite(pWav->pUserData, pData, bytesToWrite);
+    pWav->dataChunkDataSize += bytesWritten;
+
+    return bytesWritten;
+}
+
+
+DRWAV_API drwav_uint64 drwav_write_pcm_frames_le(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
+{
+    drwav_uint64 bytesToWrite;
+    drwav_uint64 bytesWritten;
+    const drwav_uint8* pRunningData;
+
+    if (pWav == NULL || framesToWrite == 0 || pData == NULL) {
+        return 0;
+    }
+
+    bytesToWrite = ((framesToWrite * pWav->channels * pWav->bitsPerSample) / 8);
+    if (bytesToWrite > DRWAV_SIZE_MAX) {
+        return 0;
+    }
+
+    bytesWritten = 0;
+    pRunningData = (const drwav_uint8*)pData;
+
+    while (bytesToWrite > 0) {
+        size_t bytesJustWritten;
+        drwav_uint64 bytesToWriteThisIteration;
+
+        bytesToWriteThisIteration = bytesToWrite;
+        DRWAV_ASSERT(bytesToWriteThisIteration <= DRWAV_SIZE_MAX);  /* <-- This is checked above. */
+
+        bytesJustWritten = drwav_write_raw(pWav, (size_t)bytesToWriteThisIteration, pRunningData);
+        if (bytesJustWritten == 0) {
+            break;
+        }
+
+        bytesToWrite -= bytesJustWritten;
+        bytesWritten += bytesJustWritten;
+        pRunningData += bytesJustWritten;
+    }
+
+    return (bytesWritten * 8) / pWav->bitsPerSample / pWav->channels;
+}
+
+DRWAV_API drwav_uint64 drwav_write_pcm_frames_be(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
+{
+    drwav_uint64 bytesToWrite;
+    drwav_uint64 bytesWritten;
+    drwav_uint32 bytesPerSample;
+    const drwav_uint8* pRunningData;
+
+    if (pWav == NULL || framesToWrite == 0 || pData == NULL) {
+        return 0;
+    }
+
+    bytesToWrite = ((framesToWrite * pWav->channels * pWav->bitsPerSample) / 8);
+    if (bytesToWrite > DRWAV_SIZE_MAX) {
+        return 0;
+    }
+
+    bytesWritten = 0;
+    pRunningData = (const drwav_uint8*)pData;
+
+    bytesPerSample = drwav_get_bytes_per_pcm_frame(pWav) / pWav->channels;
+    
+    while (bytesToWrite > 0) {
+        drwav_uint8 temp[4096];
+        drwav_uint32 sampleCount;
+        size_t bytesJustWritten;
+        drwav_uint64 bytesToWriteThisIteration;
+
+        bytesToWriteThisIteration = bytesToWrite;
+        DRWAV_ASSERT(bytesToWriteThisIteration <= DRWAV_SIZE_MAX);  /* <-- This is checked above. */
+
+        /*
+        WAV files are always little-endian. We need to byte swap on big-endian architectures. Since our input buffer is read-only we need
+        to use an intermediary buffer for the conversion.
+        */
+        sampleCount = sizeof(temp)/bytesPerSample;
+
+        if (bytesToWriteThisIteration > ((drwav_uint64)sampleCount)*bytesPerSample) {
+            bytesToWriteThisIteration = ((drwav_uint64)sampleCount)*bytesPerSample;
+        }
+
+        DRWAV_COPY_MEMORY(temp, pRunningData, (size_t)bytesToWriteThisIteration);
+        drwav__bswap_samples(temp, sampleCount, bytesPerSample, pWav->translatedFormatTag);
+
+        bytesJustWritten = drwav_write_raw(pWav, (size_t)bytesToWriteThisIteration, temp);
+        if (bytesJustWritten == 0) {
+            break;
+        }
+
+        bytesToWrite -= bytesJustWritten;
+        bytesWritten += bytesJustWritten;
+        pRunningData += bytesJustWritten;
+    }
+
+    return (bytesWritten * 8) / pWav->bitsPerSample / pWav->channels;
+}
+
+DRWAV_API drwav_uint64 drwav_write_pcm_frames(drwav* pWav, drwav_uint64 framesToWrite, const void* pData)
+{
+    if (drwav__is_little_endian()) {
+        return drwav_write_pcm_frames_le(pWav, framesToWrite, pData);
+    } else {
+        return drwav_write_pcm_frames_be(pWav, framesToWrite, pData);
+    }
+}
+
+
+static const drwav_int32 g_drwavMsadpcmAdaptationTable[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614, 
+    768, 614, 512, 409, 307, 230, 230, 230 
+};
+static const drwav_int32 g_drwavMsadpcmCoeff1Table[7] = { 256, 512, 0, 192, 240, 460,  392 };
+static const drwav_int32 g_drwavMsadpcmCoeff2Table[7] = { 0,  -256, 0, 64,  0,  -208, -232 };
+
+static const drwav_int32 g_drwavImaIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const drwav_int32 g_drwavImaStepTable[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17, 
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45, 
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118, 
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066, 
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 
+};
+
+/* Decodes one 4-bit MS-ADPCM code for a channel. pPrevFrames holds the channel's previous two samples, the most recent last. */
+static DRWAV_INLINE drwav_int32 drwav__msadpcm_decode_nibble(drwav_uint8 nibble, drwav_uint16 predictor, drwav_int32* pDelta, drwav_int32* pPrevFrames)
+{
+    drwav_int32 signedNibble = (nibble & 0x08) ? (drwav_int32)nibble - 16 : (drwav_int32)nibble;
+    drwav_int32 newSample;
+
+    newSample  = ((pPrevFrames[1] * g_drwavMsadpcmCoeff1Table[predictor]) + (pPrevFrames[0] * g_drwavMsadpcmCoeff2Table[predictor])) >> 8;
+    newSample += signedNibble * (*pDelta);
+    newSample  = drwav_clamp(newSample, -32768, 32767);
+
+    *pDelta = (g_drwavMsadpcmAdaptationTable[nibble] * (*pDelta)) >> 8;
+    if (*pDelta < 16) {
+        *pDelta = 16;
+    }
+
+    pPrevFrames[0] = pPrevFrames[1];
+    pPrevFrames[1] = newSample;
+
+    return newSample;
+}
+
+/* Decodes one 4-bit IMA ADPCM code for a channel. */
+static DRWAV_INLINE drwav_int32 drwav__ima_decode_nibble(drwav_uint8 nibble, drwav_int32* pPredictor, drwav_int32* pStepIndex)
+{
+    drwav_int32 step = g_drwavImaStepTable[*pStepIndex];
+
+    drwav_int32     diff  = step >> 3;
+    if (nibble & 1) diff += step >> 2;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 4) diff += step;
+    if (nibble & 8) diff  = -diff;
+
+    *pPredictor = drwav_clamp(*pPredictor + diff, -32768, 32767);
+    *pStepIndex = drwav_clamp(*pStepIndex + g_drwavImaIndexTable[nibble], 0, (drwav_int32)drwav_countof(g_drwavImaStepTable)-1);
+
+    return *pPredictor;
+}
+
+static drwav_uint64 drwav_read_pcm_frames_s16__msadpcm(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* pBufferOut)
+{
+    drwav_uint64 totalFramesRead = 0;
+
+    DRWAV_ASSERT(pWav != NULL);
+    DRWAV_ASSERT(framesToRead > 0);
+    DRWAV_ASSERT(pBufferOut != NULL);
+
+    /* TODO: Lots of room for optimization here. */
+
+    while (framesToRead > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
+        /* If there are no cached frames we need to load a new block. */
+        if (pWav->msadpcm.cachedFrameCount == 0 && pWav->msadpcm.bytesRemainingInBlock == 0) {
+            if (pWav->channels == 1) {
+                /* Mono. */
+                drwav_uint8 header[7];
+                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
+                    return totalFramesRead;
+                }
+                pWav->msadpcm.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+
+                pWav->msadpcm.predictor[0]     = header[0];
+                pWav->msadpcm.delta[0]         = drwav__bytes_to_s16(header + 1);
+                pWav->msadpcm.prevFrames[0][1] = (drwav_int32)drwav__bytes_to_s16(header + 3);
+                pWav->msadpcm.prevFrames[0][0] = (drwav_int32)drwav__bytes_to_s16(header + 5);
+                pWav->msadpcm.cachedFrames[2]  = pWav->msadpcm.prevFrames[0][0];
+                pWav->msadpcm.cachedFrames[3]  = pWav->msadpcm.prevFrames[0][1];
+                pWav->msadpcm.cachedFrameCount = 2;
+            } else {
+                /* Stereo. */
+                drwav_uint8 header[14];
+                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
+                    return totalFramesRead;
+                }
+                pWav->msadpcm.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+
+                pWav->msadpcm.predictor[0] = header[0];
+                pWav->msadpcm.predictor[1] = header[1];
+                pWav->msadpcm.delta[0] = drwav__bytes_to_s16(header + 2);
+                pWav->msadpcm.delta[1] = drwav__bytes_to_s16(header + 4);
+                pWav->msadpcm.prevFrames[0][1] = (drwav_int32)drwav__bytes_to_s16(header + 6);
+                pWav->msadpcm.prevFrames[1][1] = (drwav_int32)drwav__bytes_to_s16(header + 8);
+                pWav->msadpcm.prevFrames[0][0] = (drwav_int32)drwav__bytes_to_s16(header + 10);
+                pWav->msadpcm.prevFrames[1][0] = (drwav_int32)drwav__bytes_to_s16(header + 12);
+
+                pWav->msadpcm.cachedFrames[0] = pWav->msadpcm.prevFrames[0][0];
+                pWav->msadpcm.cachedFrames[1] = pWav->msadpcm.prevFrames[1][0];
+                pWav->msadpcm.cachedFrames[2] = pWav->msadpcm.prevFrames[0][1];
+                pWav->msadpcm.cachedFrames[3] = pWav->msadpcm.prevFrames[1][1];
+                pWav->msadpcm.cachedFrameCount = 2;
+            }
+        }
+
+        /* Output anything that's cached. */
+        while (framesToRead > 0 && pWav->msadpcm.cachedFrameCount > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
+            drwav_uint32 iSample = 0;
+            for (iSample = 0; iSample < pWav->channels; iSample += 1) {
+                pBufferOut[iSample] = (drwav_int16)pWav->msadpcm.cachedFrames[(drwav_countof(pWav->msadpcm.cachedFrames) - (pWav->msadpcm.cachedFrameCount*pWav->channels)) + iSample];
+            }
+
+            pBufferOut      += pWav->channels;
+            framesToRead    -= 1;
+            totalFramesRead += 1;
+            pWav->compressed.iCurrentPCMFrame += 1;
+            pWav->msadpcm.cachedFrameCount -= 1;
+        }
+
+        if (framesToRead == 0) {
+            return totalFramesRead;
+        }
+
+
+        /*
+        If there's nothing left in the cache, just go ahead and load more. If there's nothing left to load in the current block we just continue to the next
+        loop iteration which will trigger the loading of a new block.
+        */
+        if (pWav->msadpcm.cachedFrameCount == 0) {
+            if (pWav->msadpcm.bytesRemainingInBlock == 0) {
+                continue;
+            } else {
+                drwav_uint8 nibbles;
+
+                if (pWav->onRead(pWav->pUserData, &nibbles, 1) != 1) {
+                    return totalFramesRead;
+                }
+                pWav->msadpcm.bytesRemainingInBlock -= 1;
+
+                if (pWav->channels == 1) {
+                    /* Mono. */
+                    pWav->msadpcm.cachedFrames[2] = drwav__msadpcm_decode_nibble((nibbles & 0xF0) >> 4, pWav->msadpcm.predictor[0], &pWav->msadpcm.delta[0], pWav->msadpcm.prevFrames[0]);
+                    pWav->msadpcm.cachedFrames[3] = drwav__msadpcm_decode_nibble((nibbles & 0x0F) >> 0, pWav->msadpcm.predictor[0], &pWav->msadpcm.delta[0], pWav->msadpcm.prevFrames[0]);
+                    pWav->msadpcm.cachedFrameCount = 2;
+                } else {
+                    /* Stereo. Left, then right. */
+                    pWav->msadpcm.cachedFrames[2] = drwav__msadpcm_decode_nibble((nibbles & 0xF0) >> 4, pWav->msadpcm.predictor[0], &pWav->msadpcm.delta[0], pWav->msadpcm.prevFrames[0]);
+                    pWav->msadpcm.cachedFrames[3] = drwav__msadpcm_decode_nibble((nibbles & 0x0F) >> 0, pWav->msadpcm.predictor[1], &pWav->msadpcm.delta[1], pWav->msadpcm.prevFrames[1]);
+                    pWav->msadpcm.cachedFrameCount = 1;
+                }
+            }
+        }
+    }
+
+    return totalFramesRead;
+}
+
+
+static drwav_uint64 drwav_read_pcm_frames_s16__ima(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* pBufferOut)
+{
+    drwav_uint64 totalFramesRead = 0;
+
+    DRWAV_ASSERT(pWav != NULL);
+    DRWAV_ASSERT(framesToRead > 0);
+    DRWAV_ASSERT(pBufferOut != NULL);
+
+    /* TODO: Lots of room for optimization here. */
+
+    while (framesToRead > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
+        /* If there are no cached samples we need to load a new block. */
+        if (pWav->ima.cachedFrameCount == 0 && pWav->ima.bytesRemainingInBlock == 0) {
+            if (pWav->channels == 1) {
+                /* Mono. */
+                drwav_uint8 header[4];
+                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
+                    return totalFramesRead;
+                }
+                pWav->ima.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+
+                pWav->ima.predictor[0] = drwav__bytes_to_s16(header + 0);
+                pWav->ima.stepIndex[0] = header[2];
+                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 1] = pWav->ima.predictor[0];
+                pWav->ima.cachedFrameCount = 1;
+            } else {
+                /* Stereo. */
+                drwav_uint8 header[8];
+                if (pWav->onRead(pWav->pUserData, header, sizeof(header)) != sizeof(header)) {
+                    return totalFramesRead;
+                }
+                pWav->ima.bytesRemainingInBlock = pWav->fmt.blockAlign - sizeof(header);
+
+                pWav->ima.predictor[0] = drwav__bytes_to_s16(header + 0);
+                pWav->ima.stepIndex[0] = header[2];
+                pWav->ima.predictor[1] = drwav__bytes_to_s16(header + 4);
+                pWav->ima.stepIndex[1] = header[6];
+
+                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 2] = pWav->ima.predictor[0];
+                pWav->ima.cachedFrames[drwav_countof(pWav->ima.cachedFrames) - 1] = pWav->ima.predictor[1];
+                pWav->ima.cachedFrameCount = 1;
+            }
+        }
+
+        /* Output anything that's cached. */
+        while (framesToRead > 0 && pWav->ima.cachedFrameCount > 0 && pWav->compressed.iCurrentPCMFrame < pWav->totalPCMFrameCount) {
+            drwav_uint32 iSample;
+            for (iSample = 0; iSample < pWav->channels; iSample += 1) {
+                pBufferOut[iSample] = (drwav_int16)pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + iSample];
+            }
+
+            pBufferOut      += pWav->channels;
+            framesToRead    -= 1;
+            totalFramesRead += 1;
+            pWav->compressed.iCurrentPCMFrame += 1;
+            pWav->ima.cachedFrameCount -= 1;
+        }
+
+        if (framesToRead == 0) {
+            return totalFramesRead;
+        }
+
+        /*
+        If there's nothing left in the cache, just go ahead and load more. If there's nothing left to load in the current block we just continue to the next
+        loop iteration which will trigger the loading of a new block.
+        */
+        if (pWav->ima.cachedFrameCount == 0) {
+            if (pWav->ima.bytesRemainingInBlock == 0) {
+                continue;
+            } else {
+                drwav_uint32 iChannel;
+
+                /*
+                From what I can tell with stereo streams, it looks like every 4 bytes (8 samples) is for one channel. So it goes 4 bytes for the
+                left channel, 4 bytes for the right channel.
+                */
+                pWav->ima.cachedFrameCount = 8;
+                for (iChannel = 0; iChannel < pWav->channels; ++iChannel) {
+                    drwav_uint32 iByte;
+                    drwav_uint8 nibbles[4];
+                    if (pWav->onRead(pWav->pUserData, &nibbles, 4) != 4) {
+                        pWav->ima.cachedFrameCount = 0;
+                        return totalFramesRead;
+                    }
+                    pWav->ima.bytesRemainingInBlock -= 4;
+
+                    for (iByte = 0; iByte < 4; ++iByte) {
+                        drwav_uint8 nibble0 = ((nibbles[iByte] & 0x0F) >> 0);
+                        drwav_uint8 nibble1 = ((nibbles[iByte] & 0xF0) >> 4);
+
+                        pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + (iByte*2+0)*pWav->channels + iChannel] = drwav__ima_decode_nibble(nibble0, &pWav->ima.predictor[iChannel], &pWav->ima.stepIndex[iChannel]);
+                        pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + (iByte*2+1)*pWav->channels + iChannel] = drwav__ima_decode_nibble(nibble1, &pWav->ima.predictor[iChannel], &pWav->ima.stepIndex[iChannel]);
+                    }
+                }
+            }
+        }
+    }
+
+    return totalFramesRead;
+}
+
+/* The number of PCM frames held by an ADPCM block of the given size. Only the last block in the stream can be smaller than blockAlign. */
+static drwav_uint32 drwav__adpcm_frames_in_block(const drwav* pWav, size_t blockSize)
+{
+    size_t channels = pWav->channels;
+
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+        /* The header holds the first two frames. After that each byte is two samples. */
+        if (channels == 0 || blockSize < 7*channels) {
+            return 0;
+        }
+        return 2 + (drwav_uint32)(((blockSize - 7*channels) * 2) / channels);
+    }
+
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM) {
+        /* The header holds the first frame. After that it's groups of 8 frames, 4 bytes per channel. */
+        if (channels == 0 || blockSize < 4*channels) {
+            return 0;
+        }
+        return 1 + (drwav_uint32)(((blockSize - 4*channels) / (4*channels)) * 8);
+    }
+
+    return 0;
+}
+
+/*
+Decodes the first frameCount frames of a whole MS-ADPCM block. Unlike drwav_read_pcm_frames_s16__msadpcm() this doesn't touch the
+decoder state, so any number of blocks can be decoded at the same time. Frames that can't be decoded because the block is corrupt
+are output as silence.
+*/
+static void drwav__decode_msadpcm_block(const drwav* pWav, const drwav_uint8* pBlock, size_t blockSize, drwav_uint32 frameCount, drwav_int16* pFramesOut)
+{
+    drwav_uint32 channels    = pWav->channels;
+    drwav_uint32 sampleCount = frameCount * channels;
+    drwav_uint32 iSample     = 0;
+    drwav_uint16 predictor[2];
+    drwav_int32  delta[2];
+    drwav_int32  prevFrames[2][2];
+    drwav_uint32 iChannel;
+    size_t iByte;
+
+    if (frameCount > drwav__adpcm_frames_in_block(pWav, blockSize)) {
+        frameCount  = drwav__adpcm_frames_in_block(pWav, blockSize);
+    }
+
+    for (iChannel = 0; iChannel < channels; iChannel += 1) {
+        predictor[iChannel]     = pBlock[iChannel];
+        delta[iChannel]         = drwav__bytes_to_s16(pBlock + channels*1 + iChannel*2);
+        prevFrames[iChannel][1] = drwav__bytes_to_s16(pBlock + channels*3 + iChannel*2);
+        prevFrames[iChannel][0] = drwav__bytes_to_s16(pBlock + channels*5 + iChannel*2);
+
+        if (predictor[iChannel] >= drwav_countof(g_drwavMsadpcmCoeff1Table)) {
+            frameCount = 0;
+        }
+    }
+
+    /* The header's two frames, oldest first. */
+    for (iChannel = 0; iChannel < channels && iSample < frameCount*channels; iChannel += 1) {
+        pFramesOut[iSample++] = (drwav_int16)prevFrames[iChannel][0];
+    }
+    for (iChannel = 0; iChannel < channels && iSample < frameCount*channels; iChannel += 1) {
+        pFramesOut[iSample++] = (drwav_int16)prevFrames[iChannel][1];
+    }
+
+    /* The high nibble comes first. In stereo streams that's the left channel and the low nibble is the right. */
+    for (iByte = 7*channels; iByte < blockSize && iSample < frameCount*channels; iByte += 1) {
+        drwav_uint32 c0 = (iSample + 0) % channels;
+        drwav_uint32 c1 = (iSample + 1) % channels;
+        pFramesOut[iSample++] = (drwav_int16)drwav__msadpcm_decode_nibble((pBlock[iByte] & 0xF0) >> 4, predictor[c0], &delta[c0], prevFrames[c0]);
+        pFramesOut[iSample++] = (drwav_int16)drwav__msadpcm_decode_nibble((pBlock[iByte] & 0x0F) >> 0, predictor[c1], &delta[c1], prevFrames[c1]);
+    }
+
+    for (; iSample < sampleCount; iSample += 1) {
+        pFramesOut[iSample] = 0;
+    }
+}
+
+/* As above, for IMA ADPCM. */
+static void drwav__decode_ima_block(const drwav* pWav, const drwav_uint8* pBlock, size_t blockSize, drwav_uint32 frameCount, drwav_int16* pFramesOut)
+{
+    drwav_uint32 channels    = pWav->channels;
+    drwav_uint32 sampleCount = frameCount * channels;
+    drwav_int32  predictor[2];
+    drwav_int32  stepIndex[2];
+    drwav_uint32 iChannel;
+    drwav_uint32 iFrame;
+    size_t iGroup;
+
+    if (frameCount > drwav__adpcm_frames_in_block(pWav, blockSize)) {
+        frameCount  = drwav__adpcm_frames_in_block(pWav, blockSize);
+    }
+
+    for (iChannel = 0; iChannel < channels; iChannel += 1) {
+        predictor[iChannel] = drwav__bytes_to_s16(pBlock + iChannel*4);
+        stepIndex[iChannel] = drwav_clamp(pBlock[iChannel*4 + 2], 0, (drwav_int32)drwav_countof(g_drwavImaStepTable)-1);
+
+        if (frameCount > 0) {
+            pFramesOut[iChannel] = (drwav_int16)predictor[iChannel];
+        }
+    }
+
+    /* Each group is 4 bytes for the left channel and then 4 for the right, low nibble first. */
+    for (iGroup = 0, iFrame = 1; iFrame < frameCount; iGroup += 1, iFrame += 8) {
+        for (iChannel = 0; iChannel < channels; iChannel += 1) {
+            const drwav_uint8* pNibbles = pBlock + 4*channels + (iGroup*channels + iChannel)*4;
+            drwav_uint32 iNibble;
+
+            for (iNibble = 0; iNibble < 8 && iFrame + iNibble < frameCount; iNibble += 1) {
+                drwav_uint8 nibble = (iNibble & 1) ? (pNibbles[iNibble >> 1] >> 4) : (pNibbles[iNibble >> 1] & 0x0F);
+                pFramesOut[(iFrame + iNibble)*channels + iChannel] = (drwav_int16)drwav__ima_decode_nibble(nibble, &predictor[iChannel], &stepIndex[iChannel]);
+            }
+        }
+    }
+
+    for (iFrame = frameCount*channels; iFrame < sampleCount; iFrame += 1) {
+        pFramesOut[iFrame] = 0;
+    }
+}
+
+DRWAV_API drwav_uint32 drwav_get_pcm_frames_per_block(drwav* pWav)
+{
+    if (pWav == NULL) {
+        return 0;
+    }
+
+    return drwav__adpcm_frames_in_block(pWav, pWav->fmt.blockAlign);
+}
+
+typedef struct
+{
+    const drwav* pWav;
+    const drwav_uint8* pBlocks;
+    size_t blocksSize;
+    drwav_uint32 framesPerBlock;
+    drwav_uint64 frameCount;
+    drwav_int16* pFramesOut;
+} drwav__adpcm_block_jobs;
+
+static void drwav__decode_adpcm_block_job(void* pJobData, drwav_uint32 iJob)
+{
+    const drwav__adpcm_block_jobs* pJobs = (const drwav__adpcm_block_jobs*)pJobData;
+    size_t       blockOffset = (size_t)iJob * pJobs->pWav->fmt.blockAlign;
+    size_t       blockSize   = drwav_min(pJobs->pWav->fmt.blockAlign, pJobs->blocksSize - blockOffset);
+    drwav_uint64 iFirstFrame = (drwav_uint64)iJob * pJobs->framesPerBlock;
+    drwav_uint32 frameCount  = (drwav_uint32)drwav_min(pJobs->framesPerBlock, pJobs->frameCount - iFirstFrame);
+    drwav_int16* pFramesOut  = pJobs->pFramesOut + iFirstFrame*pJobs->pWav->channels;
+
+    if (pJobs->pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+        drwav__decode_msadpcm_block(pJobs->pWav, pJobs->pBlocks + blockOffset, blockSize, frameCount, pFramesOut);
+    } else {
+        drwav__decode_ima_block(pJobs->pWav, pJobs->pBlocks + blockOffset, blockSize, frameCount, pFramesOut);
+    }
+}
+
+DRWAV_API drwav_uint64 drwav_read_adpcm_blocks_s16(drwav* pWav, drwav_uint64 blockCount, drwav_int16* pBufferOut, drwav_run_jobs_proc onRunJobs, void* pUserData)
+{
+    drwav__adpcm_block_jobs jobs;
+    drwav_uint8* pAllocatedBlocks = NULL;
+    drwav_uint64 framesRemaining;
+    drwav_uint32 blockAlign;
+    drwav_uint64 blockOffset;
+    drwav_uint32 jobCount;
+    size_t bytesToRead;
+    size_t bytesRead;
+
+    if (pWav == NULL || pBufferOut == NULL || blockCount == 0 || pWav->onWrite != NULL) {
+        return 0;
+    }
+
+    jobs.framesPerBlock = drwav_get_pcm_frames_per_block(pWav);
+    if (jobs.framesPerBlock == 0 || !drwav__is_on_adpcm_block_boundary(pWav) || (pWav->compressed.iCurrentPCMFrame % jobs.framesPerBlock) != 0) {
+        return 0;
+    }
+
+    if (pWav->compressed.iCurrentPCMFrame >= pWav->totalPCMFrameCount) {
+        return 0;
+    }
+    framesRemaining = pWav->totalPCMFrameCount - pWav->compressed.iCurrentPCMFrame;
+
+    blockAlign = pWav->fmt.blockAlign;
+    blockCount = drwav_min(blockCount, (framesRemaining + jobs.framesPerBlock - 1) / jobs.framesPerBlock);
+    blockCount = drwav_min(blockCount, 0xFFFFFFFF);
+    blockCount = drwav_min(blockCount, DRWAV_SIZE_MAX / blockAlign);
+    bytesToRead = (size_t)blockCount * blockAlign;
+
+    /* Don't read past the end of the data chunk. Whatever follows it isn't audio. */
+    blockOffset = (pWav->compressed.iCurrentPCMFrame / jobs.framesPerBlock) * blockAlign;
+    if (blockOffset >= pWav->dataChunkDataSize) {
+        return 0;
+    }
+    bytesToRead = (size_t)drwav_min(bytesToRead, pWav->dataChunkDataSize - blockOffset);
+
+    if (pWav->onRead == drwav__on_read_memory) {
+        /* Decode straight out of memory. */
+        bytesRead    = drwav_min(bytesToRead, pWav->memoryStream.dataSize - pWav->memoryStream.currentReadPos);
+        jobs.pBlocks = pWav->memoryStream.data + pWav->memoryStream.currentReadPos;
+        pWav->memoryStream.currentReadPos += bytesRead;
+    #ifdef DRWAV_HAS_MMAP
+        drwav__mapped_prefetch(pWav);
+    #endif
+    } else {
+        pAllocatedBlocks = (drwav_uint8*)drwav__malloc_from_callbacks(bytesToRead, &pWav->allocationCallbacks);
+        if (pAllocatedBlocks == NULL) {
+            return 0;
+        }
+
+        bytesRead    = pWav->onRead(pWav->pUserData, pAllocatedBlocks, bytesToRead);
+        jobs.pBlocks = pAllocatedBlocks;
+    }
+
+    /* Only the last block can be cut short, if the stream has been truncated. */
+    jobs.pWav       = pWav;
+    jobs.blocksSize = bytesRead;
+    jobs.frameCount = (drwav_uint64)(bytesRead / blockAlign) * jobs.framesPerBlock + drwav__adpcm_frames_in_block(pWav, bytesRead % blockAlign);
+    jobs.frameCount = drwav_min(jobs.frameCount, framesRemaining);
+    jobs.pFramesOut = pBufferOut;
+    jobCount = (drwav_uint32)((jobs.frameCount + jobs.framesPerBlock - 1) / jobs.framesPerBlock);
+
+    if (jobCount > 0) {
+        if (onRunJobs != NULL) {
+            onRunJobs(pUserData, drwav__decode_adpcm_block_job, &jobs, jobCount);
+        } else {
+            drwav_uint32 iJob;
+            for (iJob = 0; iJob < jobCount; iJob += 1) {
+                drwav__decode_adpcm_block_job(&jobs, iJob);
+            }
+        }
+    }
+
+    drwav__free_from_callbacks(pAllocatedBlocks, &pWav->allocationCallbacks);
+
+    pWav->compressed.iCurrentPCMFrame += jobs.frameCount;
+    pWav->bytesRemaining              = pWav->dataChunkDataSize - (blockOffset + bytesRead);
+
+    return jobs.frameCount;
+}
+
+
+#ifndef DR_WAV_NO_CONVERSION_API
+static unsigned short g_drwavAlawTable[256] = {
+    0xEA80, 0xEB80, 0xE880, 0xE980, 0xEE80, 0xEF80, 0xEC80, 0xED80, 0xE280, 0xE380, 0xE080, 0xE180, 0xE680, 0xE780, 0xE480, 0xE580, 
+    0xF540, 0xF5C0, 0xF440, 0xF4C0, 0xF740, 0xF7C0, 0xF640, 0xF6C0, 0xF140, 0xF1C0, 0xF040, 0xF0C0, 0xF340, 0xF3C0, 0xF240, 0xF2C0, 
+    0xAA00, 0xAE00, 0xA200, 0xA600, 0xBA00, 0xBE00, 0xB200, 0xB600, 0x8A00, 0x8E00, 0x8200, 0x8600, 0x9A00, 0x9E00, 0x9200, 0x9600, 
+    0xD500, 0xD700, 0xD100, 0xD300, 0xDD00, 0xDF00, 0xD900, 0xDB00, 0xC500, 0xC700, 0xC100, 0xC300, 0xCD00, 0xCF00, 0xC900, 0xCB00, 
+    0xFEA8, 0xFEB8, 0xFE88, 0xFE98, 0xFEE8, 0xFEF8, 0xFEC8, 0xFED8, 0xFE28, 0xFE38, 0xFE08, 0xFE18, 0xFE68, 0xFE78, 0xFE48, 0xFE58, 
+    0xFFA8, 0xFFB8, 0xFF88, 0xFF98, 0xFFE8, 0xFFF8, 0xFFC8, 0xFFD8, 0xFF28, 0xFF38, 0xFF08, 0xFF18, 0xFF68, 0xFF78, 0xFF48, 0xFF58, 
+    0xFAA0, 0xFAE0, 0xFA20, 0xFA60, 0xFBA0, 0xFBE0, 0xFB20, 0xFB60, 0xF8A0, 0xF8E0, 0xF820, 0xF860, 0xF9A0, 0xF9E0, 0xF920, 0xF960, 
+    0xFD50, 0xFD70, 0xFD10, 0xFD30, 0xFDD0, 0xFDF0, 0xFD90, 0xFDB0, 0xFC50, 0xFC70, 0xFC10, 0xFC30, 0xFCD0, 0xFCF0, 0xFC90, 0xFCB0, 
+    0x1580, 0x1480, 0x1780, 0x1680, 0x1180, 0x1080, 0x1380, 0x1280, 0x1D80, 0x1C80, 0x1F80, 0x1E80, 0x1980, 0x1880, 0x1B80, 0x1A80, 
+    0x0AC0, 0x0A40, 0x0BC0, 0x0B40, 0x08C0, 0x0840, 0x09C0, 0x0940, 0x0EC0, 0x0E40, 0x0FC0, 0x0F40, 0x0CC0, 0x0C40, 0x0DC0, 0x0D40, 
+    0x5600, 0x5200, 0x5E00, 0x5A00, 0x4600, 0x4200, 0x4E00, 0x4A00, 0x7600, 0x7200, 0x7E00, 0x7A00, 0x6600, 0x6200, 0x6E00, 0x6A00, 
+    0x2B00, 0x2900, 0x2F00, 0x2D00, 0x2300, 0x2100, 0x2700, 0x2500, 0x3B00, 0x3900, 0x3F00, 0x3D00, 0x3300, 0x3100, 0x3700, 0x3500, 
+    0x0158, 0x0148, 0x0178, 0x0168, 0x0118, 0x0108, 0x0138, 0x0128, 0x01D8, 0x01C8, 0x01F8, 0x01E8, 0x0198, 0x0188, 0x01B8, 0x01A8, 
+    0x0058, 0x0048, 0x0078, 0x0068, 0x0018, 0x0008, 0x0038, 0x0028, 0x00D8, 0x00C8, 0x00F8, 0x00E8, 0x0098, 0x0088, 0x00B8, 0x00A8, 
+    0x0560, 0x0520, 0x05E0, 0x05A0, 0x0460, 0x0420, 0x04E0, 0x04A0, 0x0760, 0x0720, 0x07E0, 0x07A0, 0x0660, 0x0620, 0x06E0, 0x06A0, 
+    0x02B0, 0x0290, 0x02F0, 0x02D0, 0x0230, 0x0210, 0x0270, 0x0250, 0x03B0, 0x0390, 0x03F0, 0x03D0, 0x0330, 0x0310, 0x0370, 0x0350
+};
+
+static unsigned short g_drwavMulawTable[256] = {
+    0x8284, 0x8684, 0x8A84, 0x8E84, 0x9284, 0x9684, 0x9A84, 0x9E84, 0xA284, 0xA684, 0xAA84, 0xAE84, 0xB284, 0xB684, 0xBA84, 0xBE84, 
+    0xC184, 0xC384, 0xC584, 0xC784, 0xC984, 0xCB84, 0xCD84, 0xCF84, 0xD184, 0xD384, 0xD584, 0xD784, 0xD984, 0xDB84, 0xDD84, 0xDF84, 
+    0xE104, 0xE204, 0xE304, 0xE404, 0xE504, 0xE604, 0xE704, 0xE804, 0xE904, 0xEA04, 0xEB04, 0xEC04, 0xED04, 0xEE04, 0xEF04, 0xF004, 
+    0xF0C4, 0xF144, 0xF1C4, 0xF244, 0xF2C4, 0xF344, 0xF3C4, 0xF444, 0xF4C4, 0xF544, 0xF5C4, 0xF644, 0xF6C4, 0xF744, 0xF7C4, 0xF844, 
+    0xF8A4, 0xF8E4, 0xF924, 0xF964, 0xF9A4, 0xF9E4, 0xFA24, 0xFA64, 0xFAA4, 0xFAE4, 0xFB24, 0xFB64, 0xFBA4, 0xFBE4, 0xFC24, 0xFC64, 
+    0xFC94, 0xFCB4, 0xFCD4, 0xFCF4, 0xFD14, 0xFD34, 0xFD54, 0xFD74, 0xFD94, 0xFDB4, 0xFDD4, 0xFDF4, 0xFE14, 0xFE34, 0xFE54, 0xFE74, 
+    0xFE8C, 0xFE9C, 0xFEAC, 0xFEBC, 0xFECC, 0xFEDC, 0xFEEC, 0xFEFC, 0xFF0C, 0xFF1C, 0xFF2C, 0xFF3C, 0xFF4C, 0xFF5C, 0xFF6C, 0xFF7C, 
+    0xFF88, 0xFF90, 0xFF98, 0xFFA0, 0xFFA8, 0xFFB0, 0xFFB8, 0xFFC0, 0xFFC8, 0xFFD0, 0xFFD8, 0xFFE0, 0xFFE8, 0xFFF0, 0xFFF8, 0x0000, 
+    0x7D7C, 0x797C, 0x757C, 0x717C, 0x6D7C, 0x697C, 0x657C, 0x617C, 0x5D7C, 0x597C, 0x557C, 0x517C, 0x4D7C, 0x497C, 0x457C, 0x417C, 
+    0x3E7C, 0x3C7C, 0x3A7C, 0x387C, 0x367C, 0x347C, 0x327C, 0x307C, 0x2E7C, 0x2C7C, 0x2A7C, 0x287C, 0x267C, 0x247C, 0x227C, 0x207C, 
+    0x1EFC, 0x1DFC, 0x1CFC, 0x1BFC, 0x1AFC, 0x19FC, 0x18FC, 0x17FC, 0x16FC, 0x15FC, 0x14FC, 0x13FC, 0x12FC, 0x11FC, 0x10FC, 0x0FFC, 
+    0x0F3C, 0x0EBC, 0x0E3C, 0x0DBC, 0x0D3C, 0x0CBC, 0x0C3C, 0x0BBC, 0x0B3C, 0x0ABC, 0x0A3C, 0x09BC, 0x093C, 0x08BC, 0x083C, 0x07BC, 
+    0x075C, 0x071C, 0x06DC, 0x069C, 0x065C, 0x061C, 0x05DC, 0x059C, 0x055C, 0x051C, 0x04DC, 0x049C, 0x045C, 0x041C, 0x03DC, 0x039C, 
+    0x036C, 0x034C, 0x032C, 0x030C, 0x02EC, 0x02CC, 0x02AC, 0x028C, 0x026C, 0x024C, 0x022C, 0x020C, 0x01EC, 0x01CC, 0x01AC, 0x018C, 
+    0x0174, 0x0164, 0x0154, 0x0144, 0x0134, 0x0124, 0x0114, 0x0104, 0x00F4, 0x00E4, 0x00D4, 0x00C4, 0x00B4, 0x00A4, 0x0094, 0x0084, 
+    0x0078, 0x0070, 0x0068, 0x0060, 0x0058, 0x0050, 0x0048, 0x0040, 0x0038, 0x0030, 0x0028, 0x0020, 0x0018, 0x0010, 0x0008, 0x0000
+};
+
+static DRWAV_INLINE drwav_int16 drwav__alaw_to_s16(drwav_uint8 sampleIn)
+{
+    return (short)g_drwavAlawTable[sampleIn];
+}
+
+static DRWAV_INLINE drwav_int16 drwav__mulaw_to_s16(drwav_uint8 sampleIn)
+{
+    return (short)g_drwavMulawTable[sampleIn];
+}
+
+
+/*
+SIMD Conversion Kernels
+
+Each kernel converts as many whole vectors as it can from the start of the buffer and returns the number of samples it converted.
+The public drwav_*_to_*() functions convert the remainder with their scalar loop. The kernels give exactly the same results as the
+scalar code, with the exception of NaN inputs where the scalar code's behaviour is undefined anyway.
+*/
+#if defined(DRWAV_SUPPORT_SSE2)
+static drwav_bool32 drwav__gIsSSE2Supported = DRWAV_FALSE;
+#endif
+#if defined(DRWAV_SUPPORT_AVX2)
+static drwav_bool32 drwav__gIsAVX2Supported = DRWAV_FALSE;
+#endif
+#if defined(DRWAV_SUPPORT_NEON)
+static drwav_bool32 drwav__gIsNEONSupported = DRWAV_FALSE;
+#endif
+
+DRWAV_NO_THREAD_SANITIZE static void drwav__init_cpu_caps(void)
+{
+    /* Every thread that races through here stores the same values, so there's nothing to synchronize. */
+    static drwav_bool32 isCPUCapsInitialized = DRWAV_FALSE;
+
+    if (!isCPUCapsInitialized) {
+    #if defined(DRWAV_SUPPORT_SSE2)
+        drwav__gIsSSE2Supported = (cpu_features() & CPU_FEATURE_SSE2) != 0;
+    #endif
+    #if defined(DRWAV_SUPPORT_AVX2)
+        drwav__gIsAVX2Supported = (cpu_features() & CPU_FEATURE_AVX2) != 0;
+    #endif
+    #if defined(DRWAV_SUPPORT_NEON)
+        drwav__gIsNEONSupported = (cpu_features() & CPU_FEATURE_NEON) != 0;   /* NEON is only compiled in when the compiler is targeting it. */
+    #endif
+        isCPUCapsInitialized = DRWAV_TRUE;
+    }
+}
+
+
+#if defined(DRWAV_SUPPORT_SSE2)
+/* Per-lane left shift of 16-bit lanes by 0..7, one bit of the shift at a time. */
+static DRWAV_INLINE __m128i drwav__sllv_epi16__sse2(__m128i x, __m128i shift)
+{
+    __m128i m;
+
+    m = _mm_cmpeq_epi16(_mm_and_si128(shift, _mm_set1_epi16(1)), _mm_set1_epi16(1));
+    x = _mm_or_si128(_mm_and_si128(m, _mm_slli_epi16(x, 1)), _mm_andnot_si128(m, x));
+    m = _mm_cmpeq_epi16(_mm_and_si128(shift, _mm_set1_epi16(2)), _mm_set1_epi16(2));
+    x = _mm_or_si128(_mm_and_si128(m, _mm_slli_epi16(x, 2)), _mm_andnot_si128(m, x));
+    m = _mm_cmpeq_epi16(_mm_and_si128(shift, _mm_set1_epi16(4)), _mm_set1_epi16(4));
+    x = _mm_or_si128(_mm_and_si128(m, _mm_slli_epi16(x, 4)), _mm_andnot_si128(m, x));
+
+    return x;
+}
+
+/* The 8 A-law codes in the low bytes of each lane to s16. This is the G.711 expansion, which is what g_drwavAlawTable holds. */
+static DRWAV_INLINE __m128i drwav__alaw_to_s16__sse2(__m128i a)
+{
+    __m128i t;
+    __m128i seg;
+    __m128i neg;
+
+    a   = _mm_xor_si128(a, _mm_set1_epi16(0x55));
+    t   = _mm_slli_epi16(_mm_and_si128(a, _mm_set1_epi16(0x0F)), 4);
+    seg = _mm_and_si128(_mm_srli_epi16(a, 4), _mm_set1_epi16(0x07));
+    t   = _mm_add_epi16(t, _mm_set1_epi16(0x108));
+    t   = _mm_sub_epi16(t, _mm_and_si128(_mm_cmpeq_epi16(seg, _mm_setzero_si128()), _mm_set1_epi16(0x100)));   /* Segment 0 adds 8 instead of 0x108. */
+    t   = drwav__sllv_epi16__sse2(t, _mm_subs_epu16(seg, _mm_set1_epi16(1)));
+    neg = _mm_cmpeq_epi16(_mm_and_si128(a, _mm_set1_epi16(0x80)), _mm_setzero_si128());
+
+    return _mm_sub_epi16(_mm_xor_si128(t, neg), neg);
+}
+
+/* As above, for mu-law and g_drwavMulawTable. */
+static DRWAV_INLINE __m128i drwav__mulaw_to_s16__sse2(__m128i u)
+{
+    __m128i t;
+    __m128i neg;
+
+    u   = _mm_xor_si128(u, _mm_set1_epi16(0xFF));
+    t   = _mm_add_epi16(_mm_slli_epi16(_mm_and_si128(u, _mm_set1_epi16(0x0F)), 3), _mm_set1_epi16(0x84));
+    t   = drwav__sllv_epi16__sse2(t, _mm_and_si128(_mm_srli_epi16(u, 4), _mm_set1_epi16(0x07)));
+    t   = _mm_sub_epi16(t, _mm_set1_epi16(0x84));
+    neg = _mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16(0x80)), _mm_set1_epi16(0x80));
+
+    return _mm_sub_epi16(_mm_xor_si128(t, neg), neg);
+}
+
+static DRWAV_INLINE __m128i drwav__load_u8x8__sse2(const drwav_uint8* pIn)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)pIn), _mm_setzero_si128());
+}
+
+/* 4 packed 24-bit samples to the same thing drwav_s24_to_s32() outputs. This reads 16 bytes, 4 more than it uses. */
+static DRWAV_INLINE __m128i drwav__s24_to_s32__sse2(const drwav_uint8* pIn)
+{
+    __m128i x = _mm_loadu_si128((const __m128i*)pIn);
+    __m128i a = _mm_unpacklo_epi32(x, _mm_srli_si128(x, 3));
+    __m128i b = _mm_unpacklo_epi32(_mm_srli_si128(x, 6), _mm_srli_si128(x, 9));
+    return _mm_slli_epi32(_mm_unpacklo_epi64(a, b), 8);
+}
+
+static DRWAV_INLINE __m128i drwav__f32_to_s16_epi32__sse2(__m128 x)
+{
+    __m128 c = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1)), _mm_set1_ps(1));
+    c = _mm_add_ps(c, _mm_set1_ps(1));
+    return _mm_sub_epi32(_mm_cvttps_epi32(_mm_mul_ps(c, _mm_set1_ps(32767.5f))), _mm_set1_epi32(32768));
+}
+
+static DRWAV_INLINE __m128i drwav__f64_to_s16_epi32__sse2(__m128d x)
+{
+    __m128d c = _mm_min_pd(_mm_max_pd(x, _mm_set1_pd(-1)), _mm_set1_pd(1));
+    c = _mm_add_pd(c, _mm_set1_pd(1));
+    return _mm_sub_epi32(_mm_cvttpd_epi32(_mm_mul_pd(c, _mm_set1_pd(32767.5))), _mm_set1_epi32(32768));
+}
+
+static DRWAV_INLINE void drwav__store_s16_as_f32__sse2(float* pOut, __m128i x)
+{
+    _mm_storeu_ps(pOut + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), _mm_set1_ps(0.000030517578125f)));
+    _mm_storeu_ps(pOut + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), _mm_set1_ps(0.000030517578125f)));
+}
+
+static DRWAV_INLINE void drwav__store_s16_as_s32__sse2(drwav_int32* pOut, __m128i x)
+{
+    _mm_storeu_si128((__m128i*)(pOut + 0), _mm_unpacklo_epi16(_mm_setzero_si128(), x));
+    _mm_storeu_si128((__m128i*)(pOut + 4), _mm_unpackhi_epi16(_mm_setzero_si128(), x));
+}
+
+
+static size_t drwav_u8_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(pIn + i)), _mm_set1_epi8((char)0x80));
+        _mm_storeu_si128((__m128i*)(pOut + i + 0), _mm_unpacklo_epi8(_mm_setzero_si128(), x));
+        _mm_storeu_si128((__m128i*)(pOut + i + 8), _mm_unpackhi_epi8(_mm_setzero_si128(), x));
+    }
+    return i;
+}
+
+static size_t drwav_s24_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 28 <= sampleCount*3; i += 8) {
+        __m128i a = _mm_srai_epi32(drwav__s24_to_s32__sse2(pIn + i*3 +  0), 16);
+        __m128i b = _mm_srai_epi32(drwav__s24_to_s32__sse2(pIn + i*3 + 12), 16);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+    return i;
+}
+
+static size_t drwav_s32_to_s16__sse2(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 0)), 16);
+        __m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 4)), 16);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+    return i;
+}
+
+static size_t drwav_f32_to_s16__sse2(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i a = drwav__f32_to_s16_epi32__sse2(_mm_loadu_ps(pIn + i + 0));
+        __m128i b = drwav__f32_to_s16_epi32__sse2(_mm_loadu_ps(pIn + i + 4));
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+    return i;
+}
+
+static size_t drwav_f64_to_s16__sse2(drwav_int16* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i a = _mm_unpacklo_epi64(drwav__f64_to_s16_epi32__sse2(_mm_loadu_pd(pIn + i + 0)), drwav__f64_to_s16_epi32__sse2(_mm_loadu_pd(pIn + i + 2)));
+        __m128i b = _mm_unpacklo_epi64(drwav__f64_to_s16_epi32__sse2(_mm_loadu_pd(pIn + i + 4)), drwav__f64_to_s16_epi32__sse2(_mm_loadu_pd(pIn + i + 6)));
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+    return i;
+}
+
+static size_t drwav_alaw_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm_storeu_si128((__m128i*)(pOut + i), drwav__alaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_mulaw_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm_storeu_si128((__m128i*)(pOut + i), drwav__mulaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_u8_to_f32__sse2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+#ifdef DR_WAV_LIBSNDFILE_COMPAT
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#else
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i x = drwav__load_u8x8__sse2(pIn + i);
+        _mm_storeu_ps(pOut + i + 0, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(x, _mm_setzero_si128())), _mm_set1_ps(0.00784313725490196078f)), _mm_set1_ps(1)));
+        _mm_storeu_ps(pOut + i + 4, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(x, _mm_setzero_si128())), _mm_set1_ps(0.00784313725490196078f)), _mm_set1_ps(1)));
+    }
+    return i;
+#endif
+}
+
+static size_t drwav_s16_to_f32__sse2(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__sse2(pOut + i, _mm_loadu_si128((const __m128i*)(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_s24_to_f32__sse2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 16 <= sampleCount*3; i += 4) {
+        __m128i x = _mm_srai_epi32(drwav__s24_to_s32__sse2(pIn + i*3), 8);
+        _mm_storeu_ps(pOut + i, _mm_mul_ps(_mm_cvtepi32_ps(x), _mm_set1_ps(0.00000011920928955078125f)));
+    }
+    return i;
+}
+
+static size_t drwav_s32_to_f32__sse2(float* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(pIn + i));
+        _mm_storeu_ps(pOut + i, _mm_mul_ps(_mm_cvtepi32_ps(x), _mm_set1_ps(0.0000000004656612873077392578125f)));
+    }
+    return i;
+}
+
+static size_t drwav_f64_to_f32__sse2(float* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_ps(pOut + i, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(pIn + i + 0)), _mm_cvtpd_ps(_mm_loadu_pd(pIn + i + 2))));
+    }
+    return i;
+}
+
+static size_t drwav_alaw_to_f32__sse2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__sse2(pOut + i, drwav__alaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_mulaw_to_f32__sse2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__sse2(pOut + i, drwav__mulaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_u8_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(pIn + i)), _mm_set1_epi8((char)0x80));
+        drwav__store_s16_as_s32__sse2(pOut + i + 0, _mm_unpacklo_epi8(_mm_setzero_si128(), x));
+        drwav__store_s16_as_s32__sse2(pOut + i + 8, _mm_unpackhi_epi8(_mm_setzero_si128(), x));
+    }
+    return i;
+}
+
+static size_t drwav_s16_to_s32__sse2(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__sse2(pOut + i, _mm_loadu_si128((const __m128i*)(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_s24_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 16 <= sampleCount*3; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), drwav__s24_to_s32__sse2(pIn + i*3));
+    }
+    return i;
+}
+
+static size_t drwav_f32_to_s32__sse2(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    /* Scaling by 2^31 is exact in single precision, so this truncates the same value the scalar code computes in double precision. */
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + i), _mm_set1_ps(2147483648.0f))));
+    }
+    return i;
+}
+
+static size_t drwav_f64_to_s32__sse2(drwav_int32* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        __m128i a = _mm_cvttpd_epi32(_mm_mul_pd(_mm_loadu_pd(pIn + i + 0), _mm_set1_pd(2147483648.0)));
+        __m128i b = _mm_cvttpd_epi32(_mm_mul_pd(_mm_loadu_pd(pIn + i + 2), _mm_set1_pd(2147483648.0)));
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_unpacklo_epi64(a, b));
+    }
+    return i;
+}
+
+static size_t drwav_alaw_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__sse2(pOut + i, drwav__alaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+
+static size_t drwav_mulaw_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__sse2(pOut + i, drwav__mulaw_to_s16__sse2(drwav__load_u8x8__sse2(pIn + i)));
+    }
+    return i;
+}
+#endif  /* SSE2 */
+
+
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__sllv_epi16__avx2(__m256i x, __m256i shift)
+{
+    x = _mm256_blendv_epi8(x, _mm256_slli_epi16(x, 1), _mm256_cmpeq_epi16(_mm256_and_si256(shift, _mm256_set1_epi16(1)), _mm256_set1_epi16(1)));
+    x = _mm256_blendv_epi8(x, _mm256_slli_epi16(x, 2), _mm256_cmpeq_epi16(_mm256_and_si256(shift, _mm256_set1_epi16(2)), _mm256_set1_epi16(2)));
+    x = _mm256_blendv_epi8(x, _mm256_slli_epi16(x, 4), _mm256_cmpeq_epi16(_mm256_and_si256(shift, _mm256_set1_epi16(4)), _mm256_set1_epi16(4)));
+    return x;
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__alaw_to_s16__avx2(__m256i a)
+{
+    __m256i t;
+    __m256i seg;
+    __m256i neg;
+
+    a   = _mm256_xor_si256(a, _mm256_set1_epi16(0x55));
+    t   = _mm256_slli_epi16(_mm256_and_si256(a, _mm256_set1_epi16(0x0F)), 4);
+    seg = _mm256_and_si256(_mm256_srli_epi16(a, 4), _mm256_set1_epi16(0x07));
+    t   = _mm256_add_epi16(t, _mm256_set1_epi16(0x108));
+    t   = _mm256_sub_epi16(t, _mm256_and_si256(_mm256_cmpeq_epi16(seg, _mm256_setzero_si256()), _mm256_set1_epi16(0x100)));
+    t   = drwav__sllv_epi16__avx2(t, _mm256_subs_epu16(seg, _mm256_set1_epi16(1)));
+    neg = _mm256_cmpeq_epi16(_mm256_and_si256(a, _mm256_set1_epi16(0x80)), _mm256_setzero_si256());
+
+    return _mm256_sub_epi16(_mm256_xor_si256(t, neg), neg);
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__mulaw_to_s16__avx2(__m256i u)
+{
+    __m256i t;
+    __m256i neg;
+
+    u   = _mm256_xor_si256(u, _mm256_set1_epi16(0xFF));
+    t   = _mm256_add_epi16(_mm256_slli_epi16(_mm256_and_si256(u, _mm256_set1_epi16(0x0F)), 3), _mm256_set1_epi16(0x84));
+    t   = drwav__sllv_epi16__avx2(t, _mm256_and_si256(_mm256_srli_epi16(u, 4), _mm256_set1_epi16(0x07)));
+    t   = _mm256_sub_epi16(t, _mm256_set1_epi16(0x84));
+    neg = _mm256_cmpeq_epi16(_mm256_and_si256(u, _mm256_set1_epi16(0x80)), _mm256_set1_epi16(0x80));
+
+    return _mm256_sub_epi16(_mm256_xor_si256(t, neg), neg);
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__load_u8x16__avx2(const drwav_uint8* pIn)
+{
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)pIn));
+}
+
+/* 8 packed 24-bit samples, 4 per lane. This reads 28 bytes, 4 more than it uses. */
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__s24_to_s32__avx2(const drwav_uint8* pIn)
+{
+    __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)pIn)), _mm_loadu_si128((const __m128i*)(pIn + 12)), 1);
+    return _mm256_shuffle_epi8(x, _mm256_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11));
+}
+
+/* Packs two vectors of 8 x s32 that fit in 16 bits into 16 x s16 in order. */
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__packs_epi32__avx2(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m256i drwav__f32_to_s16_epi32__avx2(__m256 x)
+{
+    __m256 c = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1)), _mm256_set1_ps(1));
+    c = _mm256_add_ps(c, _mm256_set1_ps(1));
+    return _mm256_sub_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(c, _mm256_set1_ps(32767.5f))), _mm256_set1_epi32(32768));
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE __m128i drwav__f64_to_s16_epi32__avx2(__m256d x)
+{
+    __m256d c = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-1)), _mm256_set1_pd(1));
+    c = _mm256_add_pd(c, _mm256_set1_pd(1));
+    return _mm_sub_epi32(_mm256_cvttpd_epi32(_mm256_mul_pd(c, _mm256_set1_pd(32767.5))), _mm_set1_epi32(32768));
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE void drwav__store_s16_as_f32__avx2(float* pOut, __m256i x)
+{
+    _mm256_storeu_ps(pOut + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x))),      _mm256_set1_ps(0.000030517578125f)));
+    _mm256_storeu_ps(pOut + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1))), _mm256_set1_ps(0.000030517578125f)));
+}
+
+DRWAV_TARGET_AVX2 static DRWAV_INLINE void drwav__store_s16_as_s32__avx2(drwav_int32* pOut, __m256i x)
+{
+    _mm256_storeu_si256((__m256i*)(pOut + 0), _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)),      16));
+    _mm256_storeu_si256((__m256i*)(pOut + 8), _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1)), 16));
+}
+
+
+DRWAV_TARGET_AVX2 static size_t drwav_u8_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m256i x = _mm256_slli_epi16(drwav__load_u8x16__avx2(pIn + i), 8);
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_xor_si256(x, _mm256_set1_epi16((short)0x8000)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s24_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 52 <= sampleCount*3; i += 16) {
+        __m256i a = _mm256_srai_epi32(drwav__s24_to_s32__avx2(pIn + i*3 +  0), 16);
+        __m256i b = _mm256_srai_epi32(drwav__s24_to_s32__avx2(pIn + i*3 + 24), 16);
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__packs_epi32__avx2(a, b));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s32_to_s16__avx2(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m256i a = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i*)(pIn + i + 0)), 16);
+        __m256i b = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i*)(pIn + i + 8)), 16);
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__packs_epi32__avx2(a, b));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_f32_to_s16__avx2(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m256i a = drwav__f32_to_s16_epi32__avx2(_mm256_loadu_ps(pIn + i + 0));
+        __m256i b = drwav__f32_to_s16_epi32__avx2(_mm256_loadu_ps(pIn + i + 8));
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__packs_epi32__avx2(a, b));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_f64_to_s16__avx2(drwav_int16* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i a = drwav__f64_to_s16_epi32__avx2(_mm256_loadu_pd(pIn + i + 0));
+        __m128i b = drwav__f64_to_s16_epi32__avx2(_mm256_loadu_pd(pIn + i + 4));
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_alaw_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__alaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_mulaw_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__mulaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_u8_to_f32__avx2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+#ifdef DR_WAV_LIBSNDFILE_COMPAT
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#else
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pIn + i))));
+        _mm256_storeu_ps(pOut + i, _mm256_sub_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.00784313725490196078f)), _mm256_set1_ps(1)));
+    }
+    return i;
+#endif
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s16_to_f32__avx2(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_f32__avx2(pOut + i, _mm256_loadu_si256((const __m256i*)(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s24_to_f32__avx2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 28 <= sampleCount*3; i += 8) {
+        __m256i x = _mm256_srai_epi32(drwav__s24_to_s32__avx2(pIn + i*3), 8);
+        _mm256_storeu_ps(pOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(0.00000011920928955078125f)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s32_to_f32__avx2(float* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(pIn + i));
+        _mm256_storeu_ps(pOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(0.0000000004656612873077392578125f)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_f64_to_f32__avx2(float* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm_storeu_ps(pOut + i + 0, _mm256_cvtpd_ps(_mm256_loadu_pd(pIn + i + 0)));
+        _mm_storeu_ps(pOut + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(pIn + i + 4)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_alaw_to_f32__avx2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_f32__avx2(pOut + i, drwav__alaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_mulaw_to_f32__avx2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_f32__avx2(pOut + i, drwav__mulaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_u8_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256i x = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pIn + i)));
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_slli_epi32(_mm256_sub_epi32(x, _mm256_set1_epi32(128)), 24));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s16_to_s32__avx2(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_s32__avx2(pOut + i, _mm256_loadu_si256((const __m256i*)(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_s24_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i*3 + 28 <= sampleCount*3; i += 8) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__s24_to_s32__avx2(pIn + i*3));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_f32_to_s32__avx2(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(pIn + i), _mm256_set1_ps(2147483648.0f))));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_f64_to_s32__avx2(drwav_int32* pOut, const double* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm_storeu_si128((__m128i*)(pOut + i + 0), _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_loadu_pd(pIn + i + 0), _mm256_set1_pd(2147483648.0))));
+        _mm_storeu_si128((__m128i*)(pOut + i + 4), _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_loadu_pd(pIn + i + 4), _mm256_set1_pd(2147483648.0))));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_alaw_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_s32__avx2(pOut + i, drwav__alaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+
+DRWAV_TARGET_AVX2 static size_t drwav_mulaw_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        drwav__store_s16_as_s32__avx2(pOut + i, drwav__mulaw_to_s16__avx2(drwav__load_u8x16__avx2(pIn + i)));
+    }
+    return i;
+}
+#endif  /* AVX2 */
+
+
+#if defined(DRWAV_SUPPORT_NEON)
+static DRWAV_INLINE int16x8_t drwav__alaw_to_s16__neon(uint16x8_t a)
+{
+    uint16x8_t t;
+    uint16x8_t seg;
+    int16x8_t  r;
+
+    a   = veorq_u16(a, vdupq_n_u16(0x55));
+    t   = vshlq_n_u16(vandq_u16(a, vdupq_n_u16(0x0F)), 4);
+    seg = vandq_u16(vshrq_n_u16(a, 4), vdupq_n_u16(0x07));
+    t   = vaddq_u16(t, vdupq_n_u16(0x108));
+    t   = vsubq_u16(t, vandq_u16(vceqq_u16(seg, vdupq_n_u16(0)), vdupq_n_u16(0x100)));
+    t   = vshlq_u16(t, vreinterpretq_s16_u16(vqsubq_u16(seg, vdupq_n_u16(1))));
+    r   = vreinterpretq_s16_u16(t);
+
+    return vbslq_s16(vceqq_u16(vandq_u16(a, vdupq_n_u16(0x80)), vdupq_n_u16(0)), vnegq_s16(r), r);
+}
+
+static DRWAV_INLINE int16x8_t drwav__mulaw_to_s16__neon(uint16x8_t u)
+{
+    uint16x8_t t;
+    int16x8_t  r;
+
+    u = veorq_u16(u, vdupq_n_u16(0xFF));
+    t = vaddq_u16(vshlq_n_u16(vandq_u16(u, vdupq_n_u16(0x0F)), 3), vdupq_n_u16(0x84));
+    t = vshlq_u16(t, vreinterpretq_s16_u16(vandq_u16(vshrq_n_u16(u, 4), vdupq_n_u16(0x07))));
+    r = vreinterpretq_s16_u16(vsubq_u16(t, vdupq_n_u16(0x84)));
+
+    return vbslq_s16(vceqq_u16(vandq_u16(u, vdupq_n_u16(0x80)), vdupq_n_u16(0x80)), vnegq_s16(r), r);
+}
+
+static DRWAV_INLINE int32x4_t drwav__f32_to_s16_s32__neon(float32x4_t x)
+{
+    float32x4_t c = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-1)), vdupq_n_f32(1));
+    c = vaddq_f32(c, vdupq_n_f32(1));
+    return vsubq_s32(vcvtq_s32_f32(vmulq_n_f32(c, 32767.5f)), vdupq_n_s32(32768));
+}
+
+static DRWAV_INLINE void drwav__store_s16_as_f32__neon(float* pOut, int16x8_t x)
+{
+    vst1q_f32(pOut + 0, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),  0.000030517578125f));
+    vst1q_f32(pOut + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), 0.000030517578125f));
+}
+
+static DRWAV_INLINE void drwav__store_s16_as_s32__neon(drwav_int32* pOut, int16x8_t x)
+{
+    vst1q_s32(pOut + 0, vshll_n_s16(vget_low_s16(x),  16));
+    vst1q_s32(pOut + 4, vshll_n_s16(vget_high_s16(x), 16));
+}
+
+/* 16 packed 24-bit samples, deinterleaved by the load, to what drwav_s24_to_s32() outputs. */
+static DRWAV_INLINE void drwav__s24_to_s32__neon(const drwav_uint8* pIn, int32x4_t x[4])
+{
+    uint8x16x3_t b  = vld3q_u8(pIn);
+    uint8x16x2_t lo = vzipq_u8(vdupq_n_u8(0), b.val[0]);   /* 16-bit (b0 << 8) */
+    uint8x16x2_t hi = vzipq_u8(b.val[1], b.val[2]);        /* 16-bit (b1 | b2 << 8) */
+    uint16x8x2_t x0 = vzipq_u16(vreinterpretq_u16_u8(lo.val[0]), vreinterpretq_u16_u8(hi.val[0]));
+    uint16x8x2_t x1 = vzipq_u16(vreinterpretq_u16_u8(lo.val[1]), vreinterpretq_u16_u8(hi.val[1]));
+    x[0] = vreinterpretq_s32_u16(x0.val[0]);
+    x[1] = vreinterpretq_s32_u16(x0.val[1]);
+    x[2] = vreinterpretq_s32_u16(x1.val[0]);
+    x[3] = vreinterpretq_s32_u16(x1.val[1]);
+}
+
+
+static size_t drwav_u8_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        uint8x16_t x = vld1q_u8(pIn + i);
+        vst1q_s16(pOut + i + 0, vreinterpretq_s16_u16(veorq_u16(vshll_n_u8(vget_low_u8(x),  8), vdupq_n_u16(0x8000))));
+        vst1q_s16(pOut + i + 8, vreinterpretq_s16_u16(veorq_u16(vshll_n_u8(vget_high_u8(x), 8), vdupq_n_u16(0x8000))));
+    }
+    return i;
+}
+
+static size_t drwav_s24_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        uint8x16x3_t b = vld3q_u8(pIn + i*3);
+        uint8x16x2_t x = vzipq_u8(b.val[1], b.val[2]);     /* The top 16 bits of each sample. */
+        vst1q_s16(pOut + i + 0, vreinterpretq_s16_u8(x.val[0]));
+        vst1q_s16(pOut + i + 8, vreinterpretq_s16_u8(x.val[1]));
+    }
+    return i;
+}
+
+static size_t drwav_s32_to_s16__neon(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, vcombine_s16(vshrn_n_s32(vld1q_s32(pIn + i + 0), 16), vshrn_n_s32(vld1q_s32(pIn + i + 4), 16)));
+    }
+    return i;
+}
+
+static size_t drwav_f32_to_s16__neon(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        int32x4_t a = drwav__f32_to_s16_s32__neon(vld1q_f32(pIn + i + 0));
+        int32x4_t b = drwav__f32_to_s16_s32__neon(vld1q_f32(pIn + i + 4));
+        vst1q_s16(pOut + i, vcombine_s16(vmovn_s32(a), vmovn_s32(b)));
+    }
+    return i;
+}
+
+static size_t drwav_f64_to_s16__neon(drwav_int16* pOut, const double* pIn, size_t sampleCount)
+{
+#if defined(DRWAV_ARM64)
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        float64x2_t a = vminq_f64(vmaxq_f64(vld1q_f64(pIn + i + 0), vdupq_n_f64(-1)), vdupq_n_f64(1));
+        float64x2_t b = vminq_f64(vmaxq_f64(vld1q_f64(pIn + i + 2), vdupq_n_f64(-1)), vdupq_n_f64(1));
+        int32x4_t   r;
+        a = vmulq_n_f64(vaddq_f64(a, vdupq_n_f64(1)), 32767.5);
+        b = vmulq_n_f64(vaddq_f64(b, vdupq_n_f64(1)), 32767.5);
+        r = vcombine_s32(vmovn_s64(vcvtq_s64_f64(a)), vmovn_s64(vcvtq_s64_f64(b)));
+        vst1_s16(pOut + i, vmovn_s32(vsubq_s32(r, vdupq_n_s32(32768))));
+    }
+    return i;
+#else
+    /* 32-bit ARM has no double precision vectors. */
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#endif
+}
+
+static size_t drwav_alaw_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, drwav__alaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
+}
+
+static size_t drwav_mulaw_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, drwav__mulaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
+}
+
+static size_t drwav_u8_to_f32__neon(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+#ifdef DR_WAV_LIBSNDFILE_COMPAT
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#else
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        uint16x8_t x = vmovl_u8(vld1_u8(pIn + i));
+        vst1q_f32(pOut + i + 0, vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(x))),  0.00784313725490196078f), vdupq_n_f32(1)));
+        vst1q_f32(pOut + i + 4, vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(x))), 0.00784313725490196078f), vdupq_n_f32(1)));
+    }
+    return i;
+#endif
+}
 
-                        drwav_int32 step      = stepTable[pWav->ima.stepIndex[iChannel]];
-                        drwav_int32 predictor = pWav->ima.predictor[iChannel];
+static size_t drwav_s16_to_f32__neon(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__neon(pOut + i, vld1q_s16(pIn + i));
+    }
+    return i;
+}
 
-                        drwav_int32      diff  = step >> 3;
-                        if (nibble0 & 1) diff += step >> 2;
-                        if (nibble0 & 2) diff += step >> 1;
-                        if (nibble0 & 4) diff += step;
-                        if (nibble0 & 8) diff  = -diff;
+static size_t drwav_s24_to_f32__neon(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        int32x4_t x[4];
+        int j;
+        drwav__s24_to_s32__neon(pIn + i*3, x);
+        for (j = 0; j < 4; j += 1) {
+            vst1q_f32(pOut + i + j*4, vmulq_n_f32(vcvtq_f32_s32(vshrq_n_s32(x[j], 8)), 0.00000011920928955078125f));
+        }
+    }
+    return i;
+}
 
-                        predictor = drwav_clamp(predictor + diff, -32768, 32767);
-                        pWav->ima.predictor[iChannel] = predictor;
-                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble0], 0, (drwav_int32)drwav_countof(stepTable)-1);
-                        pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + (iByte*2+0)*pWav->channels + iChannel] = predictor;
+static size_t drwav_s32_to_f32__neon(float* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        vst1q_f32(pOut + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(pIn + i)), 0.0000000004656612873077392578125f));
+    }
+    return i;
+}
 
+static size_t drwav_f64_to_f32__neon(float* pOut, const double* pIn, size_t sampleCount)
+{
+#if defined(DRWAV_ARM64)
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        vst1q_f32(pOut + i, vcombine_f32(vcvt_f32_f64(vld1q_f64(pIn + i + 0)), vcvt_f32_f64(vld1q_f64(pIn + i + 2))));
+    }
+    return i;
+#else
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#endif
+}
 
-                        step      = stepTable[pWav->ima.stepIndex[iChannel]];
-                        predictor = pWav->ima.predictor[iChannel];
+static size_t drwav_alaw_to_f32__neon(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__neon(pOut + i, drwav__alaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
+}
 
-                                         diff  = step >> 3;
-                        if (nibble1 & 1) diff += step >> 2;
-                        if (nibble1 & 2) diff += step >> 1;
-                        if (nibble1 & 4) diff += step;
-                        if (nibble1 & 8) diff  = -diff;
+static size_t drwav_mulaw_to_f32__neon(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_f32__neon(pOut + i, drwav__mulaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
+}
 
-                        predictor = drwav_clamp(predictor + diff, -32768, 32767);
-                        pWav->ima.predictor[iChannel] = predictor;
-                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble1], 0, (drwav_int32)drwav_countof(stepTable)-1);
-                        pWav->ima.cachedFrames[(drwav_countof(pWav->ima.cachedFrames) - (pWav->ima.cachedFrameCount*pWav->channels)) + (iByte*2+1)*pWav->channels + iChannel] = predictor;
-                    }
-                }
-            }
-        }
+static size_t drwav_u8_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        uint16x8_t x = vmovl_u8(veor_u8(vld1_u8(pIn + i), vdup_n_u8(0x80)));
+        vst1q_s32(pOut + i + 0, vreinterpretq_s32_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(x)),  24)));
+        vst1q_s32(pOut + i + 4, vreinterpretq_s32_u32(vshlq_n_u32(vmovl_u16(vget_high_u16(x)), 24)));
     }
+    return i;
+}
 
-    return totalFramesRead;
+static size_t drwav_s16_to_s32__neon(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__neon(pOut + i, vld1q_s16(pIn + i));
+    }
+    return i;
 }
 
+static size_t drwav_s24_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        int32x4_t x[4];
+        drwav__s24_to_s32__neon(pIn + i*3, x);
+        vst1q_s32(pOut + i +  0, x[0]);
+        vst1q_s32(pOut + i +  4, x[1]);
+        vst1q_s32(pOut + i +  8, x[2]);
+        vst1q_s32(pOut + i + 12, x[3]);
+    }
+    return i;
+}
 
-#ifndef DR_WAV_NO_CONVERSION_API
-static unsigned short g_drwavAlawTable[256] = {
-    0xEA80, 0xEB80, 0xE880, 0xE980, 0xEE80, 0xEF80, 0xEC80, 0xED80, 0xE280, 0xE380, 0xE080, 0xE180, 0xE680, 0xE780, 0xE480, 0xE580, 
-    0xF540, 0xF5C0, 0xF440, 0xF4C0, 0xF740, 0xF7C0, 0xF640, 0xF6C0, 0xF140, 0xF1C0, 0xF040, 0xF0C0, 0xF340, 0xF3C0, 0xF240, 0xF2C0, 
-    0xAA00, 0xAE00, 0xA200, 0xA600, 0xBA00, 0xBE00, 0xB200, 0xB600, 0x8A00, 0x8E00, 0x8200, 0x8600, 0x9A00, 0x9E00, 0x9200, 0x9600, 
-    0xD500, 0xD700, 0xD100, 0xD300, 0xDD00, 0xDF00, 0xD900, 0xDB00, 0xC500, 0xC700, 0xC100, 0xC300, 0xCD00, 0xCF00, 0xC900, 0xCB00, 
-    0xFEA8, 0xFEB8, 0xFE88, 0xFE98, 0xFEE8, 0xFEF8, 0xFEC8, 0xFED8, 0xFE28, 0xFE38, 0xFE08, 0xFE18, 0xFE68, 0xFE78, 0xFE48, 0xFE58, 
-    0xFFA8, 0xFFB8, 0xFF88, 0xFF98, 0xFFE8, 0xFFF8, 0xFFC8, 0xFFD8, 0xFF28, 0xFF38, 0xFF08, 0xFF18, 0xFF68, 0xFF78, 0xFF48, 0xFF58, 
-    0xFAA0, 0xFAE0, 0xFA20, 0xFA60, 0xFBA0, 0xFBE0, 0xFB20, 0xFB60, 0xF8A0, 0xF8E0, 0xF820, 0xF860, 0xF9A0, 0xF9E0, 0xF920, 0xF960, 
-    0xFD50, 0xFD70, 0xFD10, 0xFD30, 0xFDD0, 0xFDF0, 0xFD90, 0xFDB0, 0xFC50, 0xFC70, 0xFC10, 0xFC30, 0xFCD0, 0xFCF0, 0xFC90, 0xFCB0, 
-    0x1580, 0x1480, 0x1780, 0x1680, 0x1180, 0x1080, 0x1380, 0x1280, 0x1D80, 0x1C80, 0x1F80, 0x1E80, 0x1980, 0x1880, 0x1B80, 0x1A80, 
-    0x0AC0, 0x0A40, 0x0BC0, 0x0B40, 0x08C0, 0x0840, 0x09C0, 0x0940, 0x0EC0, 0x0E40, 0x0FC0, 0x0F40, 0x0CC0, 0x0C40, 0x0DC0, 0x0D40, 
-    0x5600, 0x5200, 0x5E00, 0x5A00, 0x4600, 0x4200, 0x4E00, 0x4A00, 0x7600, 0x7200, 0x7E00, 0x7A00, 0x6600, 0x6200, 0x6E00, 0x6A00, 
-    0x2B00, 0x2900, 0x2F00, 0x2D00, 0x2300, 0x2100, 0x2700, 0x2500, 0x3B00, 0x3900, 0x3F00, 0x3D00, 0x3300, 0x3100, 0x3700, 0x3500, 
-    0x0158, 0x0148, 0x0178, 0x0168, 0x0118, 0x0108, 0x0138, 0x0128, 0x01D8, 0x01C8, 0x01F8, 0x01E8, 0x0198, 0x0188, 0x01B8, 0x01A8, 
-    0x0058, 0x0048, 0x0078, 0x0068, 0x0018, 0x0008, 0x0038, 0x0028, 0x00D8, 0x00C8, 0x00F8, 0x00E8, 0x0098, 0x0088, 0x00B8, 0x00A8, 
-    0x0560, 0x0520, 0x05E0, 0x05A0, 0x0460, 0x0420, 0x04E0, 0x04A0, 0x0760, 0x0720, 0x07E0, 0x07A0, 0x0660, 0x0620, 0x06E0, 0x06A0, 
-    0x02B0, 0x0290, 0x02F0, 0x02D0, 0x0230, 0x0210, 0x0270, 0x0250, 0x03B0, 0x0390, 0x03F0, 0x03D0, 0x0330, 0x0310, 0x0370, 0x0350
-};
+static size_t drwav_f32_to_s32__neon(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        vst1q_s32(pOut + i, vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn + i), 2147483648.0f)));
+    }
+    return i;
+}
 
-static unsigned short g_drwavMulawTable[256] = {
-    0x8284, 0x8684, 0x8A84, 0x8E84, 0x9284, 0x9684, 0x9A84, 0x9E84, 0xA284, 0xA684, 0xAA84, 0xAE84, 0xB284, 0xB684, 0xBA84, 0xBE84, 
-    0xC184, 0xC384, 0xC584, 0xC784, 0xC984, 0xCB84, 0xCD84, 0xCF84, 0xD184, 0xD384, 0xD584, 0xD784, 0xD984, 0xDB84, 0xDD84, 0xDF84, 
-    0xE104, 0xE204, 0xE304, 0xE404, 0xE504, 0xE604, 0xE704, 0xE804, 0xE904, 0xEA04, 0xEB04, 0xEC04, 0xED04, 0xEE04, 0xEF04, 0xF004, 
-    0xF0C4, 0xF144, 0xF1C4, 0xF244, 0xF2C4, 0xF344, 0xF3C4, 0xF444, 0xF4C4, 0xF544, 0xF5C4, 0xF644, 0xF6C4, 0xF744, 0xF7C4, 0xF844, 
-    0xF8A4, 0xF8E4, 0xF924, 0xF964, 0xF9A4, 0xF9E4, 0xFA24, 0xFA64, 0xFAA4, 0xFAE4, 0xFB24, 0xFB64, 0xFBA4, 0xFBE4, 0xFC24, 0xFC64, 
-    0xFC94, 0xFCB4, 0xFCD4, 0xFCF4, 0xFD14, 0xFD34, 0xFD54, 0xFD74, 0xFD94, 0xFDB4, 0xFDD4, 0xFDF4, 0xFE14, 0xFE34, 0xFE54, 0xFE74, 
-    0xFE8C, 0xFE9C, 0xFEAC, 0xFEBC, 0xFECC, 0xFEDC, 0xFEEC, 0xFEFC, 0xFF0C, 0xFF1C, 0xFF2C, 0xFF3C, 0xFF4C, 0xFF5C, 0xFF6C, 0xFF7C, 
-    0xFF88, 0xFF90, 0xFF98, 0xFFA0, 0xFFA8, 0xFFB0, 0xFFB8, 0xFFC0, 0xFFC8, 0xFFD0, 0xFFD8, 0xFFE0, 0xFFE8, 0xFFF0, 0xFFF8, 0x0000, 
-    0x7D7C, 0x797C, 0x757C, 0x717C, 0x6D7C, 0x697C, 0x657C, 0x617C, 0x5D7C, 0x597C, 0x557C, 0x517C, 0x4D7C, 0x497C, 0x457C, 0x417C, 
-    0x3E7C, 0x3C7C, 0x3A7C, 0x387C, 0x367C, 0x347C, 0x327C, 0x307C, 0x2E7C, 0x2C7C, 0x2A7C, 0x287C, 0x267C, 0x247C, 0x227C, 0x207C, 
-    0x1EFC, 0x1DFC, 0x1CFC, 0x1BFC, 0x1AFC, 0x19FC, 0x18FC, 0x17FC, 0x16FC, 0x15FC, 0x14FC, 0x13FC, 0x12FC, 0x11FC, 0x10FC, 0x0FFC, 
-    0x0F3C, 0x0EBC, 0x0E3C, 0x0DBC, 0x0D3C, 0x0CBC, 0x0C3C, 0x0BBC, 0x0B3C, 0x0ABC, 0x0A3C, 0x09BC, 0x093C, 0x08BC, 0x083C, 0x07BC, 
-    0x075C, 0x071C, 0x06DC, 0x069C, 0x065C, 0x061C, 0x05DC, 0x059C, 0x055C, 0x051C, 0x04DC, 0x049C, 0x045C, 0x041C, 0x03DC, 0x039C, 
-    0x036C, 0x034C, 0x032C, 0x030C, 0x02EC, 0x02CC, 0x02AC, 0x028C, 0x026C, 0x024C, 0x022C, 0x020C, 0x01EC, 0x01CC, 0x01AC, 0x018C, 
-    0x0174, 0x0164, 0x0154, 0x0144, 0x0134, 0x0124, 0x0114, 0x0104, 0x00F4, 0x00E4, 0x00D4, 0x00C4, 0x00B4, 0x00A4, 0x0094, 0x0084, 
-    0x0078, 0x0070, 0x0068, 0x0060, 0x0058, 0x0050, 0x0048, 0x0040, 0x0038, 0x0030, 0x0028, 0x0020, 0x0018, 0x0010, 0x0008, 0x0000
-};
+static size_t drwav_f64_to_s32__neon(drwav_int32* pOut, const double* pIn, size_t sampleCount)
+{
+#if defined(DRWAV_ARM64)
+    /* Saturating like the scalar conversion does on ARM. */
+    size_t i;
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        int64x2_t a = vcvtq_s64_f64(vmulq_n_f64(vld1q_f64(pIn + i + 0), 2147483648.0));
+        int64x2_t b = vcvtq_s64_f64(vmulq_n_f64(vld1q_f64(pIn + i + 2), 2147483648.0));
+        vst1q_s32(pOut + i, vcombine_s32(vqmovn_s64(a), vqmovn_s64(b)));
+    }
+    return i;
+#else
+    (void)pOut;
+    (void)pIn;
+    (void)sampleCount;
+    return 0;
+#endif
+}
 
-static DRWAV_INLINE drwav_int16 drwav__alaw_to_s16(drwav_uint8 sampleIn)
+static size_t drwav_alaw_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
-    return (short)g_drwavAlawTable[sampleIn];
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__neon(pOut + i, drwav__alaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
 }
 
-static DRWAV_INLINE drwav_int16 drwav__mulaw_to_s16(drwav_uint8 sampleIn)
+static size_t drwav_mulaw_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
-    return (short)g_drwavMulawTable[sampleIn];
+    size_t i;
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__store_s16_as_s32__neon(pOut + i, drwav__mulaw_to_s16__neon(vmovl_u8(vld1_u8(pIn + i))));
+    }
+    return i;
 }
+#endif  /* NEON */
+
+
+/*
+drwav_<conversion>__simd() runs the widest kernel the CPU supports for that conversion and returns the number of samples it
+converted, which is 0 when there's no SIMD support.
+*/
+#if defined(DRWAV_SUPPORT_AVX2)
+    #define DRWAV_SIMD_DISPATCH_AVX2(name) if (drwav__gIsAVX2Supported) { return drwav_##name##__avx2(pOut, pIn, sampleCount); }
+#else
+    #define DRWAV_SIMD_DISPATCH_AVX2(name)
+#endif
+#if defined(DRWAV_SUPPORT_SSE2)
+    #define DRWAV_SIMD_DISPATCH_SSE2(name) if (drwav__gIsSSE2Supported) { return drwav_##name##__sse2(pOut, pIn, sampleCount); }
+#else
+    #define DRWAV_SIMD_DISPATCH_SSE2(name)
+#endif
+#if defined(DRWAV_SUPPORT_NEON)
+    #define DRWAV_SIMD_DISPATCH_NEON(name) if (drwav__gIsNEONSupported) { return drwav_##name##__neon(pOut, pIn, sampleCount); }
+#else
+    #define DRWAV_SIMD_DISPATCH_NEON(name)
+#endif
+
+#define DRWAV_DEFINE_SIMD_DISPATCH(name, OutType, InType) \
+static size_t drwav_##name##__simd(OutType* pOut, const InType* pIn, size_t sampleCount) \
+{ \
+    drwav__init_cpu_caps(); \
+    DRWAV_SIMD_DISPATCH_AVX2(name) \
+    DRWAV_SIMD_DISPATCH_SSE2(name) \
+    DRWAV_SIMD_DISPATCH_NEON(name) \
+    (void)pOut; \
+    (void)pIn; \
+    (void)sampleCount; \
+    return 0; \
+}
+
+DRWAV_DEFINE_SIMD_DISPATCH(u8_to_s16,    drwav_int16, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(s24_to_s16,   drwav_int16, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(s32_to_s16,   drwav_int16, drwav_int32)
+DRWAV_DEFINE_SIMD_DISPATCH(f32_to_s16,   drwav_int16, float)
+DRWAV_DEFINE_SIMD_DISPATCH(f64_to_s16,   drwav_int16, double)
+DRWAV_DEFINE_SIMD_DISPATCH(alaw_to_s16,  drwav_int16, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(mulaw_to_s16, drwav_int16, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(u8_to_f32,    float,       drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(s16_to_f32,   float,       drwav_int16)
+DRWAV_DEFINE_SIMD_DISPATCH(s24_to_f32,   float,       drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(s32_to_f32,   float,       drwav_int32)
+DRWAV_DEFINE_SIMD_DISPATCH(f64_to_f32,   float,       double)
+DRWAV_DEFINE_SIMD_DISPATCH(alaw_to_f32,  float,       drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(mulaw_to_f32, float,       drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(u8_to_s32,    drwav_int32, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(s16_to_s32,   drwav_int32, drwav_int16)
+DRWAV_DEFINE_SIMD_DISPATCH(s24_to_s32,   drwav_int32, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(f32_to_s32,   drwav_int32, float)
+DRWAV_DEFINE_SIMD_DISPATCH(f64_to_s32,   drwav_int32, double)
+DRWAV_DEFINE_SIMD_DISPATCH(alaw_to_s32,  drwav_int32, drwav_uint8)
+DRWAV_DEFINE_SIMD_DISPATCH(mulaw_to_s32, drwav_int32, drwav_uint8)
 
 
 
@@ -4077,6 +6323,23 @@ static void drwav__ieee_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t
     }
 }
 
+/*
+The source for the conversion functions: straight out of memory in blocks of DRWAV_MAPPED_CHUNK_SIZE when drwav_map_pcm_frames()
+can be used, otherwise read into the caller's scratch buffer. *ppData points at the frames read either way.
+*/
+static drwav_uint64 drwav__read_pcm_frames_for_conversion(drwav* pWav, drwav_uint64 framesToRead, drwav_uint32 bytesPerFrame, drwav_uint8* pScratch, size_t scratchSize, const drwav_uint8** ppData)
+{
+    if (drwav__can_map_pcm_frames(pWav)) {
+        const void* pFrames;
+        drwav_uint64 framesRead = drwav_map_pcm_frames(pWav, drwav_min(framesToRead, DRWAV_MAPPED_CHUNK_SIZE/bytesPerFrame), &pFrames);
+        *ppData = (const drwav_uint8*)pFrames;
+        return framesRead;
+    }
+
+    *ppData = pScratch;
+    return drwav_read_pcm_frames(pWav, drwav_min(framesToRead, scratchSize/bytesPerFrame), pScratch);
+}
+
 static drwav_uint64 drwav_read_pcm_frames_s16__pcm(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* pBufferOut)
 {
     drwav_uint32 bytesPerFrame;
@@ -4096,12 +6359,13 @@ static drwav_uint64 drwav_read_pcm_frames_s16__pcm(drwav* pWav, drwav_uint64 fra
     totalFramesRead = 0;
     
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__pcm_to_s16(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
+        drwav__pcm_to_s16(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4124,12 +6388,13 @@ static drwav_uint64 drwav_read_pcm_frames_s16__ieee(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
     
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__ieee_to_s16(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
+        drwav__ieee_to_s16(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4152,12 +6417,13 @@ static drwav_uint64 drwav_read_pcm_frames_s16__alaw(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
     
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_alaw_to_s16(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_alaw_to_s16(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4180,12 +6446,13 @@ static drwav_uint64 drwav_read_pcm_frames_s16__mulaw(drwav* pWav, drwav_uint64 f
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_mulaw_to_s16(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_mulaw_to_s16(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4258,7 +6525,7 @@ DRWAV_API void drwav_u8_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t
 {
     int r;
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_u8_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         int x = pIn[i];
         r = x << 8;
         r = r - 32768;
@@ -4270,7 +6537,7 @@ DRWAV_API void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_
 {
     int r;
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_s24_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         int x = ((int)(((unsigned int)(((const drwav_uint8*)pIn)[i*3+0]) << 8) | ((unsigned int)(((const drwav_uint8*)pIn)[i*3+1]) << 16) | ((unsigned int)(((const drwav_uint8*)pIn)[i*3+2])) << 24)) >> 8;
         r = x >> 8;
         pOut[i] = (short)r;
@@ -4281,7 +6548,7 @@ DRWAV_API void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_
 {
     int r;
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_s32_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         int x = pIn[i];
         r = x >> 16;
         pOut[i] = (short)r;
@@ -4292,7 +6559,7 @@ DRWAV_API void drwav_f32_to_s16(drwav_int16* pOut, const float* pIn, size_t samp
 {
     int r;
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_f32_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         float x = pIn[i];
         float c;
         c = ((x < -1) ? -1 : ((x > 1) ? 1 : x));
@@ -4307,7 +6574,7 @@ DRWAV_API void drwav_f64_to_s16(drwav_int16* pOut, const double* pIn, size_t sam
 {
     int r;
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_f64_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         double x = pIn[i];
         double c;
         c = ((x < -1) ? -1 : ((x > 1) ? 1 : x));
@@ -4321,7 +6588,7 @@ DRWAV_API void drwav_f64_to_s16(drwav_int16* pOut, const double* pIn, size_t sam
 DRWAV_API void drwav_alaw_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_alaw_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         pOut[i] = drwav__alaw_to_s16(pIn[i]);
     }
 }
@@ -4329,7 +6596,7 @@ DRWAV_API void drwav_alaw_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size
 DRWAV_API void drwav_mulaw_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     size_t i;
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_mulaw_to_s16__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         pOut[i] = drwav__mulaw_to_s16(pIn[i]);
     }
 }
@@ -4417,12 +6684,13 @@ static drwav_uint64 drwav_read_pcm_frames_f32__pcm(drwav* pWav, drwav_uint64 fra
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__pcm_to_f32(pBufferOut, sampleData, (size_t)framesRead*pWav->channels, bytesPerFrame/pWav->channels);
+        drwav__pcm_to_f32(pBufferOut, pSampleData, (size_t)framesRead*pWav->channels, bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4499,12 +6767,13 @@ static drwav_uint64 drwav_read_pcm_frames_f32__ieee(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__ieee_to_f32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
+        drwav__ieee_to_f32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4526,12 +6795,13 @@ static drwav_uint64 drwav_read_pcm_frames_f32__alaw(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_alaw_to_f32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_alaw_to_f32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4554,12 +6824,13 @@ static drwav_uint64 drwav_read_pcm_frames_f32__mulaw(drwav* pWav, drwav_uint64 f
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_mulaw_to_f32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_mulaw_to_f32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4647,12 +6918,12 @@ DRWAV_API void drwav_u8_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampl
         *pOut++ = (pIn[i] / 256.0f) * 2 - 1;
     }
 #else
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_u8_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         float x = pIn[i];
         x = x * 0.00784313725490196078f;    /* 0..255 to 0..2 */
         x = x - 1;                          /* 0..2 to -1..1 */
 
-        *pOut++ = x;
+        pOut[i] = x;
     }
 #endif
 }
@@ -4665,8 +6936,8 @@ DRWAV_API void drwav_s16_to_f32(float* pOut, const drwav_int16* pIn, size_t samp
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = pIn[i] * 0.000030517578125f;
+    for (i = drwav_s16_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = pIn[i] * 0.000030517578125f;
     }
 }
 
@@ -4678,9 +6949,9 @@ DRWAV_API void drwav_s24_to_f32(float* pOut, const drwav_uint8* pIn, size_t samp
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_s24_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         double x = (double)(((drwav_int32)(((drwav_uint32)(pIn[i*3+0]) << 8) | ((drwav_uint32)(pIn[i*3+1]) << 16) | ((drwav_uint32)(pIn[i*3+2])) << 24)) >> 8);
-        *pOut++ = (float)(x * 0.00000011920928955078125);
+        pOut[i] = (float)(x * 0.00000011920928955078125);
     }
 }
 
@@ -4691,8 +6962,8 @@ DRWAV_API void drwav_s32_to_f32(float* pOut, const drwav_int32* pIn, size_t samp
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (float)(pIn[i] / 2147483648.0);
+    for (i = drwav_s32_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = (float)(pIn[i] / 2147483648.0);
     }
 }
 
@@ -4704,8 +6975,8 @@ DRWAV_API void drwav_f64_to_f32(float* pOut, const double* pIn, size_t sampleCou
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (float)pIn[i];
+    for (i = drwav_f64_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = (float)pIn[i];
     }
 }
 
@@ -4717,8 +6988,8 @@ DRWAV_API void drwav_alaw_to_f32(float* pOut, const drwav_uint8* pIn, size_t sam
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = drwav__alaw_to_s16(pIn[i]) / 32768.0f;
+    for (i = drwav_alaw_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = drwav__alaw_to_s16(pIn[i]) / 32768.0f;
     }
 }
 
@@ -4730,8 +7001,8 @@ DRWAV_API void drwav_mulaw_to_f32(float* pOut, const drwav_uint8* pIn, size_t sa
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = drwav__mulaw_to_s16(pIn[i]) / 32768.0f;
+    for (i = drwav_mulaw_to_f32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = drwav__mulaw_to_s16(pIn[i]) / 32768.0f;
     }
 }
 
@@ -4823,12 +7094,13 @@ static drwav_uint64 drwav_read_pcm_frames_s32__pcm(drwav* pWav, drwav_uint64 fra
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__pcm_to_s32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
+        drwav__pcm_to_s32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4899,12 +7171,13 @@ static drwav_uint64 drwav_read_pcm_frames_s32__ieee(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav__ieee_to_s32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
+        drwav__ieee_to_s32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels), bytesPerFrame/pWav->channels);
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4927,12 +7200,13 @@ static drwav_uint64 drwav_read_pcm_frames_s32__alaw(drwav* pWav, drwav_uint64 fr
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_alaw_to_s32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_alaw_to_s32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -4955,12 +7229,13 @@ static drwav_uint64 drwav_read_pcm_frames_s32__mulaw(drwav* pWav, drwav_uint64 f
     totalFramesRead = 0;
 
     while (framesToRead > 0) {
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame), sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_pcm_frames_for_conversion(pWav, framesToRead, bytesPerFrame, sampleData, sizeof(sampleData), &pSampleData);
         if (framesRead == 0) {
             break;
         }
 
-        drwav_mulaw_to_s32(pBufferOut, sampleData, (size_t)(framesRead*pWav->channels));
+        drwav_mulaw_to_s32(pBufferOut, pSampleData, (size_t)(framesRead*pWav->channels));
 
         pBufferOut      += framesRead*pWav->channels;
         framesToRead    -= framesRead;
@@ -5038,8 +7313,8 @@ DRWAV_API void drwav_u8_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = ((int)pIn[i] - 128) << 24;
+    for (i = drwav_u8_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = ((int)pIn[i] - 128) << 24;
     }
 }
 
@@ -5051,8 +7326,8 @@ DRWAV_API void drwav_s16_to_s32(drwav_int32* pOut, const drwav_int16* pIn, size_
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = pIn[i] << 16;
+    for (i = drwav_s16_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = pIn[i] << 16;
     }
 }
 
@@ -5064,13 +7339,13 @@ DRWAV_API void drwav_s24_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
+    for (i = drwav_s24_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
         unsigned int s0 = pIn[i*3 + 0];
         unsigned int s1 = pIn[i*3 + 1];
         unsigned int s2 = pIn[i*3 + 2];
 
         drwav_int32 sample32 = (drwav_int32)((s0 << 8) | (s1 << 16) | (s2 << 24));
-        *pOut++ = sample32;
+        pOut[i] = sample32;
     }
 }
 
@@ -5082,8 +7357,8 @@ DRWAV_API void drwav_f32_to_s32(drwav_int32* pOut, const float* pIn, size_t samp
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (drwav_int32)(2147483648.0 * pIn[i]);
+    for (i = drwav_f32_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = (drwav_int32)(2147483648.0 * pIn[i]);
     }
 }
 
@@ -5095,8 +7370,8 @@ DRWAV_API void drwav_f64_to_s32(drwav_int32* pOut, const double* pIn, size_t sam
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (drwav_int32)(2147483648.0 * pIn[i]);
+    for (i = drwav_f64_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = (drwav_int32)(2147483648.0 * pIn[i]);
     }
 }
 
@@ -5108,8 +7383,8 @@ DRWAV_API void drwav_alaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = ((drwav_int32)drwav__alaw_to_s16(pIn[i])) << 16;
+    for (i = drwav_alaw_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = ((drwav_int32)drwav__alaw_to_s16(pIn[i])) << 16;
     }
 }
 
@@ -5121,9 +7396,301 @@ DRWAV_API void drwav_mulaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, siz
         return;
     }
 
-    for (i= 0; i < sampleCount; ++i) {
-        *pOut++ = ((drwav_int32)drwav__mulaw_to_s16(pIn[i])) << 16;
+    for (i = drwav_mulaw_to_s32__simd(pOut, pIn, sampleCount); i < sampleCount; ++i) {
+        pOut[i] = ((drwav_int32)drwav__mulaw_to_s16(pIn[i])) << 16;
+    }
+}
+
+/*
+Deinterleaving for the planar read functions. Channel c of frame i goes to ppOut[c][outOffset + i]. Like the conversion kernels the
+SIMD kernels return how many frames they did, and the rest is done by the scalar loop. 32-bit samples are moved as uint32 in the scalar
+code so floats are copied bit for bit.
+*/
+#if defined(DRWAV_SUPPORT_SSE2)
+static size_t drwav__deinterleave_u32__sse2(void* const* ppOut, size_t outOffset, const drwav_uint32* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t i = 0;
+
+    if (channels == 2) {
+        float* pOut0 = (float*)ppOut[0] + outOffset;
+        float* pOut1 = (float*)ppOut[1] + outOffset;
+        for (; i + 4 <= frameCount; i += 4) {
+            __m128 a = _mm_loadu_ps((const float*)pIn + i*2 + 0);
+            __m128 b = _mm_loadu_ps((const float*)pIn + i*2 + 4);
+            _mm_storeu_ps(pOut0 + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(pOut1 + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    } else if (channels == 4 || channels == 8) {
+        /* A 4x4 transpose per group of 4 channels. */
+        drwav_uint32 iGroup;
+        for (; i + 4 <= frameCount; i += 4) {
+            for (iGroup = 0; iGroup < channels; iGroup += 4) {
+                __m128 r0 = _mm_loadu_ps((const float*)pIn + (i + 0)*channels + iGroup);
+                __m128 r1 = _mm_loadu_ps((const float*)pIn + (i + 1)*channels + iGroup);
+                __m128 r2 = _mm_loadu_ps((const float*)pIn + (i + 2)*channels + iGroup);
+                __m128 r3 = _mm_loadu_ps((const float*)pIn + (i + 3)*channels + iGroup);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _mm_storeu_ps((float*)ppOut[iGroup + 0] + outOffset + i, r0);
+                _mm_storeu_ps((float*)ppOut[iGroup + 1] + outOffset + i, r1);
+                _mm_storeu_ps((float*)ppOut[iGroup + 2] + outOffset + i, r2);
+                _mm_storeu_ps((float*)ppOut[iGroup + 3] + outOffset + i, r3);
+            }
+        }
+    } else if (channels == 6) {
+        /* Four frames are 6 vectors. Channels 0-3 are a 4x4 transpose once the odd frames are shuffled into line, and 4-5 are two shuffles. */
+        for (; i + 4 <= frameCount; i += 4) {
+            const float* pFrames = (const float*)pIn + i*6;
+            __m128 v0 = _mm_loadu_ps(pFrames +  0);
+            __m128 v1 = _mm_loadu_ps(pFrames +  4);
+            __m128 v2 = _mm_loadu_ps(pFrames +  8);
+            __m128 v3 = _mm_loadu_ps(pFrames + 12);
+            __m128 v4 = _mm_loadu_ps(pFrames + 16);
+            __m128 v5 = _mm_loadu_ps(pFrames + 20);
+            __m128 r0 = v0;
+            __m128 r1 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128 r2 = v3;
+            __m128 r3 = _mm_shuffle_ps(v4, v5, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128 a  = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(3, 2, 1, 0));
+            __m128 b  = _mm_shuffle_ps(v4, v5, _MM_SHUFFLE(3, 2, 1, 0));
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps((float*)ppOut[0] + outOffset + i, r0);
+            _mm_storeu_ps((float*)ppOut[1] + outOffset + i, r1);
+            _mm_storeu_ps((float*)ppOut[2] + outOffset + i, r2);
+            _mm_storeu_ps((float*)ppOut[3] + outOffset + i, r3);
+            _mm_storeu_ps((float*)ppOut[4] + outOffset + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps((float*)ppOut[5] + outOffset + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    }
+
+    return i;
+}
+
+static size_t drwav__deinterleave_s16__sse2(drwav_int16* const* ppOut, size_t outOffset, const drwav_int16* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t i = 0;
+
+    if (channels == 2) {
+        /* Sign extend each half of the 32-bit lanes and pack them back down. */
+        for (; i + 8 <= frameCount; i += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(pIn + i*2 + 0));
+            __m128i b = _mm_loadu_si128((const __m128i*)(pIn + i*2 + 8));
+            __m128i l = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+            __m128i r = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+            _mm_storeu_si128((__m128i*)(ppOut[0] + outOffset + i), l);
+            _mm_storeu_si128((__m128i*)(ppOut[1] + outOffset + i), r);
+        }
+    }
+
+    return i;
+}
+#endif  /* SSE2 */
+
+#if defined(DRWAV_SUPPORT_NEON)
+static size_t drwav__deinterleave_u32__neon(void* const* ppOut, size_t outOffset, const drwav_uint32* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t i = 0;
+    drwav_uint32 c;
+
+    if (channels == 2) {
+        for (; i + 4 <= frameCount; i += 4) {
+            uint32x4x2_t v = vld2q_u32(pIn + i*2);
+            vst1q_u32((drwav_uint32*)ppOut[0] + outOffset + i, v.val[0]);
+            vst1q_u32((drwav_uint32*)ppOut[1] + outOffset + i, v.val[1]);
+        }
+    } else if (channels == 4) {
+        for (; i + 4 <= frameCount; i += 4) {
+            uint32x4x4_t v = vld4q_u32(pIn + i*4);
+            for (c = 0; c < 4; c += 1) {
+                vst1q_u32((drwav_uint32*)ppOut[c] + outOffset + i, v.val[c]);
+            }
+        }
+    } else if (channels == 6) {
+        /* vld3q on two frames gives lane pairs of channels c and c+3, which an unzip of the next two frames sorts out. */
+        for (; i + 4 <= frameCount; i += 4) {
+            uint32x4x3_t a = vld3q_u32(pIn + i*6 +  0);
+            uint32x4x3_t b = vld3q_u32(pIn + i*6 + 12);
+            for (c = 0; c < 3; c += 1) {
+                uint32x4x2_t u = vuzpq_u32(a.val[c], b.val[c]);
+                vst1q_u32((drwav_uint32*)ppOut[c + 0] + outOffset + i, u.val[0]);
+                vst1q_u32((drwav_uint32*)ppOut[c + 3] + outOffset + i, u.val[1]);
+            }
+        }
+    } else if (channels == 8) {
+        for (; i + 4 <= frameCount; i += 4) {
+            uint32x4x4_t a = vld4q_u32(pIn + i*8 +  0);
+            uint32x4x4_t b = vld4q_u32(pIn + i*8 + 16);
+            for (c = 0; c < 4; c += 1) {
+                uint32x4x2_t u = vuzpq_u32(a.val[c], b.val[c]);
+                vst1q_u32((drwav_uint32*)ppOut[c + 0] + outOffset + i, u.val[0]);
+                vst1q_u32((drwav_uint32*)ppOut[c + 4] + outOffset + i, u.val[1]);
+            }
+        }
+    }
+
+    return i;
+}
+
+static size_t drwav__deinterleave_s16__neon(drwav_int16* const* ppOut, size_t outOffset, const drwav_int16* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t i = 0;
+
+    if (channels == 2) {
+        for (; i + 8 <= frameCount; i += 8) {
+            int16x8x2_t v = vld2q_s16(pIn + i*2);
+            vst1q_s16(ppOut[0] + outOffset + i, v.val[0]);
+            vst1q_s16(ppOut[1] + outOffset + i, v.val[1]);
+        }
+    }
+
+    return i;
+}
+#endif  /* NEON */
+
+static void drwav__deinterleave_u32(void* const* ppOut, size_t outOffset, const drwav_uint32* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t iFirstFrame = 0;
+    size_t iFrame;
+    drwav_uint32 iChannel;
+
+    drwav__init_cpu_caps();
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        iFirstFrame = drwav__deinterleave_u32__sse2(ppOut, outOffset, pIn, frameCount, channels);
+    }
+#endif
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        iFirstFrame = drwav__deinterleave_u32__neon(ppOut, outOffset, pIn, frameCount, channels);
+    }
+#endif
+
+    for (iChannel = 0; iChannel < channels; iChannel += 1) {
+        drwav_uint32* pOut = (drwav_uint32*)ppOut[iChannel] + outOffset;
+        for (iFrame = iFirstFrame; iFrame < frameCount; iFrame += 1) {
+            pOut[iFrame] = pIn[iFrame*channels + iChannel];
+        }
+    }
+}
+
+static void drwav__deinterleave_s16(drwav_int16* const* ppOut, size_t outOffset, const drwav_int16* pIn, size_t frameCount, drwav_uint32 channels)
+{
+    size_t iFirstFrame = 0;
+    size_t iFrame;
+    drwav_uint32 iChannel;
+
+    drwav__init_cpu_caps();
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        iFirstFrame = drwav__deinterleave_s16__sse2(ppOut, outOffset, pIn, frameCount, channels);
+    }
+#endif
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        iFirstFrame = drwav__deinterleave_s16__neon(ppOut, outOffset, pIn, frameCount, channels);
+    }
+#endif
+
+    for (iChannel = 0; iChannel < channels; iChannel += 1) {
+        drwav_int16* pOut = ppOut[iChannel] + outOffset;
+        for (iFrame = iFirstFrame; iFrame < frameCount; iFrame += 1) {
+            pOut[iFrame] = pIn[iFrame*channels + iChannel];
+        }
+    }
+}
+
+/*
+The planar readers convert a small block of interleaved frames at a time with the interleaved readers and deinterleave it while it's
+still in cache. The block needs to be able to hold at least one frame of any stream.
+*/
+#if DRWAV_MAX_CHANNELS > 2048
+#define DRWAV_PLANAR_BLOCK_SIZE_IN_SAMPLES  DRWAV_MAX_CHANNELS
+#else
+#define DRWAV_PLANAR_BLOCK_SIZE_IN_SAMPLES  2048
+#endif
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32_planar(drwav* pWav, drwav_uint64 framesToRead, float* const* ppFramesOut)
+{
+    float samples[DRWAV_PLANAR_BLOCK_SIZE_IN_SAMPLES];
+    drwav_uint64 totalFramesRead = 0;
+    drwav_uint64 framesPerBlock;
+
+    if (pWav == NULL || framesToRead == 0 || ppFramesOut == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    /* Don't try to read more samples than can potentially fit in the output buffers. */
+    if (framesToRead * sizeof(float) > DRWAV_SIZE_MAX) {
+        framesToRead = DRWAV_SIZE_MAX / sizeof(float);
+    }
+
+    framesPerBlock = drwav_countof(samples) / pWav->channels;
+    while (totalFramesRead < framesToRead) {
+        drwav_uint64 framesRead = drwav_read_pcm_frames_f32(pWav, drwav_min(framesPerBlock, framesToRead - totalFramesRead), samples);
+        if (framesRead == 0) {
+            break;
+        }
+
+        drwav__deinterleave_u32((void* const*)ppFramesOut, (size_t)totalFramesRead, (const drwav_uint32*)samples, (size_t)framesRead, pWav->channels);
+        totalFramesRead += framesRead;
+    }
+
+    return totalFramesRead;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_s32_planar(drwav* pWav, drwav_uint64 framesToRead, drwav_int32* const* ppFramesOut)
+{
+    drwav_int32 samples[DRWAV_PLANAR_BLOCK_SIZE_IN_SAMPLES];
+    drwav_uint64 totalFramesRead = 0;
+    drwav_uint64 framesPerBlock;
+
+    if (pWav == NULL || framesToRead == 0 || ppFramesOut == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    if (framesToRead * sizeof(drwav_int32) > DRWAV_SIZE_MAX) {
+        framesToRead = DRWAV_SIZE_MAX / sizeof(drwav_int32);
+    }
+
+    framesPerBlock = drwav_countof(samples) / pWav->channels;
+    while (totalFramesRead < framesToRead) {
+        drwav_uint64 framesRead = drwav_read_pcm_frames_s32(pWav, drwav_min(framesPerBlock, framesToRead - totalFramesRead), samples);
+        if (framesRead == 0) {
+            break;
+        }
+
+        drwav__deinterleave_u32((void* const*)ppFramesOut, (size_t)totalFramesRead, (const drwav_uint32*)samples, (size_t)framesRead, pWav->channels);
+        totalFramesRead += framesRead;
+    }
+
+    return totalFramesRead;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_s16_planar(drwav* pWav, drwav_uint64 framesToRead, drwav_int16* const* ppFramesOut)
+{
+    drwav_int16 samples[DRWAV_PLANAR_BLOCK_SIZE_IN_SAMPLES];
+    drwav_uint64 totalFramesRead = 0;
+    drwav_uint64 framesPerBlock;
+
+    if (pWav == NULL || framesToRead == 0 || ppFramesOut == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    if (framesToRead * sizeof(drwav_int16) > DRWAV_SIZE_MAX) {
+        framesToRead = DRWAV_SIZE_MAX / sizeof(drwav_int16);
+    }
+
+    framesPerBlock = drwav_countof(samples) / pWav->channels;
+    while (totalFramesRead < framesToRead) {
+        drwav_uint64 framesRead = drwav_read_pcm_frames_s16(pWav, drwav_min(framesPerBlock, framesToRead - totalFramesRead), samples);
+        if (framesRead == 0) {
+            break;
+        }
+
+        drwav__deinterleave_s16(ppFramesOut, (size_t)totalFramesRead, samples, (size_t)framesRead, pWav->channels);
+        totalFramesRead += framesRead;
     }
+
+    return totalFramesRead;
 }
 
 
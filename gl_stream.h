@@ -0,0 +1,288 @@
+/* gl_stream.h - texture streaming through a ring of pixel unpack
+ * buffers, on top of glad.h.
+ *
+ * glTexSubImage2D() from client memory has to copy the pixels before
+ * returning, and on some drivers waits for the GPU to finish with the
+ * texture first. Streaming through a pixel unpack buffer lets the call
+ * return at once and the copy happen on the GPU's time.
+ *
+ * With GL 4.4 or GL_ARB_buffer_storage, one buffer holding @count
+ * slots is mapped persistently and coherently at creation, and stays
+ * mapped. Each upload goes into the next slot, after waiting on the
+ * fence set when that slot was last used, so with three slots the CPU
+ * writes one frame while the GPU reads the ones before it. Without it,
+ * the buffer is orphaned with glBufferData() and mapped again for each
+ * upload, which drivers mostly handle by handing out fresh memory.
+ *
+ *    s = gl_stream_new(pitch * height, 3);
+ *    ...
+ *    glBindTexture(GL_TEXTURE_2D, texture);
+ *    gl_stream_tex_sub_image_2d(s, GL_TEXTURE_2D, 0, 0, 0, width, height,
+ *          GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, pixels, pitch, 4);
+ *
+ * or, to have the pixels produced straight into the buffer:
+ *
+ *    void *dst = gl_stream_begin(s, size);
+ *    ... write up to size bytes to dst
+ *    offset = gl_stream_end(s);
+ *    glTexSubImage2D(..., (const void*)offset);
+ *    gl_stream_done(s);
+ *
+ * Between gl_stream_end() and gl_stream_done() the buffer is bound to
+ * GL_PIXEL_UNPACK_BUFFER; gl_stream_done() unbinds it again.
+ *
+ * gladLoadGL() must have been called for the current context, which
+ * must stay current for everything here. One C file must define
+ * GL_STREAM_IMPLEMENTATION before including this. */
+
+#ifndef __GL_STREAM_H__
+#define __GL_STREAM_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "glad.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct gl_stream gl_stream_t;
+
+/**
+ * gl_stream_new:
+ * @size                    : largest upload, in bytes
+ * @count                   : slots in the persistent ring, 0 for 3
+ *
+ * Create the buffer, persistently mapped if GL_ARB_buffer_storage is
+ * there.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+gl_stream_t *gl_stream_new(size_t size, unsigned count);
+
+/* Waits for nothing; deleting the buffer and fences is enough. */
+void gl_stream_free(gl_stream_t *s);
+
+/* Whether the buffer is persistently mapped, rather than orphaned and
+ * mapped for each upload. */
+bool gl_stream_is_persistent(gl_stream_t *s);
+
+/**
+ * gl_stream_begin:
+ * @s                       : pointer to stream object
+ * @size                    : bytes about to be written
+ *
+ * Get memory to write the next upload to, waiting for the GPU to be
+ * done with the slot if need be.
+ *
+ * Returns: pointer to write to, or NULL if @size is too large or the
+ * buffer couldn't be mapped.
+ */
+void *gl_stream_begin(gl_stream_t *s, size_t size);
+
+/* Finish writing, and bind the buffer to GL_PIXEL_UNPACK_BUFFER.
+ * Returns the offset in the buffer to pass as the pixels pointer. */
+size_t gl_stream_end(gl_stream_t *s);
+
+/* Call once the commands reading the upload have been issued. */
+void gl_stream_done(gl_stream_t *s);
+
+/**
+ * gl_stream_tex_sub_image_2d:
+ * @s                       : pointer to stream object
+ * @target                  : as for glTexSubImage2D()
+ * @level                   : as for glTexSubImage2D()
+ * @x                       : as for glTexSubImage2D()
+ * @y                       : as for glTexSubImage2D()
+ * @width                   : as for glTexSubImage2D()
+ * @height                  : as for glTexSubImage2D()
+ * @format                  : as for glTexSubImage2D()
+ * @type                    : as for glTexSubImage2D()
+ * @pixels                  : rows of @width texels
+ * @pitch                   : bytes from one row of @pixels to the next
+ * @bpp                     : bytes per texel
+ *
+ * Copy @pixels into the buffer and upload them to the bound texture
+ * from there. Expects the default unpack state (no row length or skip,
+ * alignment 4).
+ *
+ * Returns: true (1) if the upload was issued, false (0) if it doesn't
+ * fit or the buffer couldn't be mapped.
+ */
+bool gl_stream_tex_sub_image_2d(gl_stream_t *s, GLenum target, GLint level,
+      GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type,
+      const void *pixels, size_t pitch, unsigned bpp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef GL_STREAM_IMPLEMENTATION
+#undef GL_STREAM_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#define GL_STREAM_MAX_COUNT 8
+
+struct gl_stream
+{
+   GLuint buffer;
+   size_t size;           /* of each slot */
+   unsigned count;        /* slots, 1 when orphaning */
+   unsigned slot;         /* being written, or next to be */
+   bool persistent;
+   unsigned char *map;    /* the whole persistent mapping, or the slot being written */
+   GLsync fences[GL_STREAM_MAX_COUNT];
+};
+
+gl_stream_t *gl_stream_new(size_t size, unsigned count)
+{
+   gl_stream_t *s;
+
+   if (!size)
+      return NULL;
+   if (!(s = (gl_stream_t*)calloc(1, sizeof(*s))))
+      return NULL;
+   /* keeps slot offsets, and so rows, 4-byte aligned */
+   s->size  = (size + 63) & ~(size_t)63;
+   s->count = count ? count : 3;
+   if (s->count > GL_STREAM_MAX_COUNT)
+      s->count = GL_STREAM_MAX_COUNT;
+
+   glGenBuffers(1, &s->buffer);
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s->buffer);
+   if (GLAD_GL_ARB_buffer_storage && glBufferStorage)
+   {
+      GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      glBufferStorage(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)(s->size * s->count), NULL, flags);
+      s->map = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0,
+            (GLsizeiptr)(s->size * s->count), flags);
+      if (s->map)
+         s->persistent = true;
+      else
+      {
+         /* immutable storage can't be orphaned; start again */
+         glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+         glDeleteBuffers(1, &s->buffer);
+         glGenBuffers(1, &s->buffer);
+         glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s->buffer);
+      }
+   }
+   if (!s->persistent)
+   {
+      s->count = 1;
+      glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)s->size, NULL, GL_STREAM_DRAW);
+   }
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+   return s;
+}
+
+void gl_stream_free(gl_stream_t *s)
+{
+   unsigned i;
+
+   if (!s)
+      return;
+   for (i = 0; i < s->count; i++)
+      if (s->fences[i])
+         glDeleteSync(s->fences[i]);
+   if (s->persistent)
+   {
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s->buffer);
+      glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+   }
+   glDeleteBuffers(1, &s->buffer);
+   free(s);
+}
+
+bool gl_stream_is_persistent(gl_stream_t *s)
+{
+   return s->persistent;
+}
+
+void *gl_stream_begin(gl_stream_t *s, size_t size)
+{
+   void *map;
+
+   if (size > s->size)
+      return NULL;
+
+   if (s->persistent)
+   {
+      GLsync fence = s->fences[s->slot];
+      if (fence)
+      {
+         /* the first wait flushes, so that the fence is sure to signal */
+         GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+         while (glClientWaitSync(fence, flags, 1000000000) == GL_TIMEOUT_EXPIRED)
+            flags = 0;
+         glDeleteSync(fence);
+         s->fences[s->slot] = NULL;
+      }
+      return s->map + s->slot * s->size;
+   }
+
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s->buffer);
+   glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)s->size, NULL, GL_STREAM_DRAW);
+   map = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)size,
+         GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+   return map;
+}
+
+size_t gl_stream_end(gl_stream_t *s)
+{
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s->buffer);
+   if (s->persistent)
+      return s->slot * s->size;
+   glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+   return 0;
+}
+
+void gl_stream_done(gl_stream_t *s)
+{
+   if (s->persistent)
+   {
+      s->fences[s->slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      s->slot            = (s->slot + 1) % s->count;
+   }
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+bool gl_stream_tex_sub_image_2d(gl_stream_t *s, GLenum target, GLint level,
+      GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type,
+      const void *pixels, size_t pitch, unsigned bpp)
+{
+   size_t row = (size_t)width * bpp;
+   size_t dst_pitch = (row + 3) & ~(size_t)3;
+   unsigned char *dst;
+   size_t offset;
+
+   if (width <= 0 || height <= 0)
+      return true;
+   if (!(dst = (unsigned char*)gl_stream_begin(s, dst_pitch * (size_t)height)))
+      return false;
+
+   if (pitch == dst_pitch)
+      memcpy(dst, pixels, dst_pitch * (size_t)(height - 1) + row);
+   else
+   {
+      const unsigned char *src = (const unsigned char*)pixels;
+      GLsizei i;
+      for (i = 0; i < height; i++)
+         memcpy(dst + i * dst_pitch, src + i * pitch, row);
+   }
+
+   offset = gl_stream_end(s);
+   glTexSubImage2D(target, level, x, y, width, height, format, type,
+         (const void*)offset);
+   gl_stream_done(s);
+   return true;
+}
+
+#endif
@@ -7,16 +7,16 @@
     APIs: gl=4.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=4.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=4.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.3&extensions=GL_ARB_buffer_storage
 */
 
 #include <stdio.h>
@@ -1174,6 +1174,8 @@ PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+int GLAD_GL_ARB_buffer_storage = 0;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -2140,9 +2142,13 @@ static void load_GL_VERSION_4_3(GLADloadproc load) {
 	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
 	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
 }
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
 	free_exts();
 	return 1;
 }
@@ -2229,6 +2235,4700 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* Lazy loading: every pointer starts out as a stub that looks its
+ * function up, stores it over itself and calls it, so that only the
+ * functions used are ever looked up. */
+typedef void (APIENTRYP GLADlazyproc)(void);
+
+struct gladLazyProc {
+    const char *name;
+    GLADlazyproc *ptr;
+    GLADlazyproc stub;
+};
+
+struct gladGLLazyContext {
+    GLADloadproc load;
+    struct gladGLversionStruct version;
+    int flags[17];
+    GLADlazyproc procs[914];
+};
+
+static GLADloadproc glad_lazy_load;
+static gladGLLazyContext *glad_lazy_current;
+
+static void glad_lazy_resolve(int index);
+
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) {
+    glad_lazy_resolve(0);
+    glad_glAccum(op, value);
+}
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    glad_lazy_resolve(1);
+    glad_glActiveShaderProgram(pipeline, program);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+    glad_lazy_resolve(2);
+    glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+    glad_lazy_resolve(3);
+    glad_glAlphaFunc(func, ref);
+}
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+    glad_lazy_resolve(4);
+    return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY glad_lazy_glArrayElement(GLint i) {
+    glad_lazy_resolve(5);
+    glad_glArrayElement(i);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+    glad_lazy_resolve(6);
+    glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBegin(GLenum mode) {
+    glad_lazy_resolve(7);
+    glad_glBegin(mode);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+    glad_lazy_resolve(8);
+    glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+    glad_lazy_resolve(9);
+    glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    glad_lazy_resolve(10);
+    glad_glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+    glad_lazy_resolve(11);
+    glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    glad_lazy_resolve(12);
+    glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+    glad_lazy_resolve(13);
+    glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    glad_lazy_resolve(14);
+    glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_lazy_resolve(15);
+    glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    glad_lazy_resolve(16);
+    glad_glBindFragDataLocation(program, color, name);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    glad_lazy_resolve(17);
+    glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    glad_lazy_resolve(18);
+    glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    glad_lazy_resolve(19);
+    glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) {
+    glad_lazy_resolve(20);
+    glad_glBindProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    glad_lazy_resolve(21);
+    glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+    glad_lazy_resolve(22);
+    glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+    glad_lazy_resolve(23);
+    glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+    glad_lazy_resolve(24);
+    glad_glBindTransformFeedback(target, id);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+    glad_lazy_resolve(25);
+    glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    glad_lazy_resolve(26);
+    glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+    glad_lazy_resolve(27);
+    glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_lazy_resolve(28);
+    glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+    glad_lazy_resolve(29);
+    glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    glad_lazy_resolve(30);
+    glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    glad_lazy_resolve(31);
+    glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+    glad_lazy_resolve(32);
+    glad_glBlendEquationi(buf, mode);
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    glad_lazy_resolve(33);
+    glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    glad_lazy_resolve(34);
+    glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    glad_lazy_resolve(35);
+    glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    glad_lazy_resolve(36);
+    glad_glBlendFunci(buf, src, dst);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    glad_lazy_resolve(37);
+    glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    glad_lazy_resolve(38);
+    glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    glad_lazy_resolve(39);
+    glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCallList(GLuint list) {
+    glad_lazy_resolve(40);
+    glad_glCallList(list);
+}
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+    glad_lazy_resolve(41);
+    glad_glCallLists(n, type, lists);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+    glad_lazy_resolve(42);
+    return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+    glad_lazy_resolve(43);
+    glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+    glad_lazy_resolve(44);
+    glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_lazy_resolve(45);
+    glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    glad_lazy_resolve(46);
+    glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    glad_lazy_resolve(47);
+    glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    glad_lazy_resolve(48);
+    glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    glad_lazy_resolve(49);
+    glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    glad_lazy_resolve(50);
+    glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    glad_lazy_resolve(51);
+    glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_lazy_resolve(52);
+    glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+    glad_lazy_resolve(53);
+    glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) {
+    glad_lazy_resolve(54);
+    glad_glClearDepthf(d);
+}
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) {
+    glad_lazy_resolve(55);
+    glad_glClearIndex(c);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+    glad_lazy_resolve(56);
+    glad_glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) {
+    glad_lazy_resolve(57);
+    glad_glClientActiveTexture(texture);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_lazy_resolve(58);
+    return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+    glad_lazy_resolve(59);
+    glad_glClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    glad_lazy_resolve(60);
+    glad_glColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) {
+    glad_lazy_resolve(61);
+    glad_glColor3bv(v);
+}
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    glad_lazy_resolve(62);
+    glad_glColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) {
+    glad_lazy_resolve(63);
+    glad_glColor3dv(v);
+}
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    glad_lazy_resolve(64);
+    glad_glColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) {
+    glad_lazy_resolve(65);
+    glad_glColor3fv(v);
+}
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) {
+    glad_lazy_resolve(66);
+    glad_glColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) {
+    glad_lazy_resolve(67);
+    glad_glColor3iv(v);
+}
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+    glad_lazy_resolve(68);
+    glad_glColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) {
+    glad_lazy_resolve(69);
+    glad_glColor3sv(v);
+}
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    glad_lazy_resolve(70);
+    glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) {
+    glad_lazy_resolve(71);
+    glad_glColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+    glad_lazy_resolve(72);
+    glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) {
+    glad_lazy_resolve(73);
+    glad_glColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+    glad_lazy_resolve(74);
+    glad_glColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) {
+    glad_lazy_resolve(75);
+    glad_glColor3usv(v);
+}
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    glad_lazy_resolve(76);
+    glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) {
+    glad_lazy_resolve(77);
+    glad_glColor4bv(v);
+}
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    glad_lazy_resolve(78);
+    glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) {
+    glad_lazy_resolve(79);
+    glad_glColor4dv(v);
+}
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_lazy_resolve(80);
+    glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) {
+    glad_lazy_resolve(81);
+    glad_glColor4fv(v);
+}
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    glad_lazy_resolve(82);
+    glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) {
+    glad_lazy_resolve(83);
+    glad_glColor4iv(v);
+}
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    glad_lazy_resolve(84);
+    glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) {
+    glad_lazy_resolve(85);
+    glad_glColor4sv(v);
+}
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    glad_lazy_resolve(86);
+    glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) {
+    glad_lazy_resolve(87);
+    glad_glColor4ubv(v);
+}
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    glad_lazy_resolve(88);
+    glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) {
+    glad_lazy_resolve(89);
+    glad_glColor4uiv(v);
+}
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    glad_lazy_resolve(90);
+    glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) {
+    glad_lazy_resolve(91);
+    glad_glColor4usv(v);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    glad_lazy_resolve(92);
+    glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    glad_lazy_resolve(93);
+    glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) {
+    glad_lazy_resolve(94);
+    glad_glColorMaterial(face, mode);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+    glad_lazy_resolve(95);
+    glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+    glad_lazy_resolve(96);
+    glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+    glad_lazy_resolve(97);
+    glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+    glad_lazy_resolve(98);
+    glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(99);
+    glad_glColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+    glad_lazy_resolve(100);
+    glad_glCompileShader(shader);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(101);
+    glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(102);
+    glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(103);
+    glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(104);
+    glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(105);
+    glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    glad_lazy_resolve(106);
+    glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    glad_lazy_resolve(107);
+    glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    glad_lazy_resolve(108);
+    glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    glad_lazy_resolve(109);
+    glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    glad_lazy_resolve(110);
+    glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    glad_lazy_resolve(111);
+    glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    glad_lazy_resolve(112);
+    glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(113);
+    glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(114);
+    glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+    glad_lazy_resolve(115);
+    return glad_glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+    glad_lazy_resolve(116);
+    return glad_glCreateShader(type);
+}
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    glad_lazy_resolve(117);
+    return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+    glad_lazy_resolve(118);
+    glad_glCullFace(mode);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    glad_lazy_resolve(119);
+    glad_glDebugMessageCallback(callback, userParam);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    glad_lazy_resolve(120);
+    glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    glad_lazy_resolve(121);
+    glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    glad_lazy_resolve(122);
+    glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    glad_lazy_resolve(123);
+    glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) {
+    glad_lazy_resolve(124);
+    glad_glDeleteLists(list, range);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+    glad_lazy_resolve(125);
+    glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    glad_lazy_resolve(126);
+    glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    glad_lazy_resolve(127);
+    glad_glDeleteQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    glad_lazy_resolve(128);
+    glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    glad_lazy_resolve(129);
+    glad_glDeleteSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+    glad_lazy_resolve(130);
+    glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+    glad_lazy_resolve(131);
+    glad_glDeleteSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    glad_lazy_resolve(132);
+    glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    glad_lazy_resolve(133);
+    glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    glad_lazy_resolve(134);
+    glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+    glad_lazy_resolve(135);
+    glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+    glad_lazy_resolve(136);
+    glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+    glad_lazy_resolve(137);
+    glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    glad_lazy_resolve(138);
+    glad_glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    glad_lazy_resolve(139);
+    glad_glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) {
+    glad_lazy_resolve(140);
+    glad_glDepthRangef(n, f);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+    glad_lazy_resolve(141);
+    glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+    glad_lazy_resolve(142);
+    glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) {
+    glad_lazy_resolve(143);
+    glad_glDisableClientState(array);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+    glad_lazy_resolve(144);
+    glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+    glad_lazy_resolve(145);
+    glad_glDisablei(target, index);
+}
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    glad_lazy_resolve(146);
+    glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) {
+    glad_lazy_resolve(147);
+    glad_glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    glad_lazy_resolve(148);
+    glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    glad_lazy_resolve(149);
+    glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    glad_lazy_resolve(150);
+    glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    glad_lazy_resolve(151);
+    glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+    glad_lazy_resolve(152);
+    glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    glad_lazy_resolve(153);
+    glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    glad_lazy_resolve(154);
+    glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    glad_lazy_resolve(155);
+    glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    glad_lazy_resolve(156);
+    glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    glad_lazy_resolve(157);
+    glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    glad_lazy_resolve(158);
+    glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    glad_lazy_resolve(159);
+    glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    glad_lazy_resolve(160);
+    glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(161);
+    glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    glad_lazy_resolve(162);
+    glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    glad_lazy_resolve(163);
+    glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    glad_lazy_resolve(164);
+    glad_glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    glad_lazy_resolve(165);
+    glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    glad_lazy_resolve(166);
+    glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    glad_lazy_resolve(167);
+    glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) {
+    glad_lazy_resolve(168);
+    glad_glEdgeFlag(flag);
+}
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(169);
+    glad_glEdgeFlagPointer(stride, pointer);
+}
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) {
+    glad_lazy_resolve(170);
+    glad_glEdgeFlagv(flag);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+    glad_lazy_resolve(171);
+    glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) {
+    glad_lazy_resolve(172);
+    glad_glEnableClientState(array);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+    glad_lazy_resolve(173);
+    glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+    glad_lazy_resolve(174);
+    glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glEnd(void) {
+    glad_lazy_resolve(175);
+    glad_glEnd();
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+    glad_lazy_resolve(176);
+    glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glEndList(void) {
+    glad_lazy_resolve(177);
+    glad_glEndList();
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+    glad_lazy_resolve(178);
+    glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+    glad_lazy_resolve(179);
+    glad_glEndQueryIndexed(target, index);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+    glad_lazy_resolve(180);
+    glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) {
+    glad_lazy_resolve(181);
+    glad_glEvalCoord1d(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) {
+    glad_lazy_resolve(182);
+    glad_glEvalCoord1dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) {
+    glad_lazy_resolve(183);
+    glad_glEvalCoord1f(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) {
+    glad_lazy_resolve(184);
+    glad_glEvalCoord1fv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+    glad_lazy_resolve(185);
+    glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) {
+    glad_lazy_resolve(186);
+    glad_glEvalCoord2dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+    glad_lazy_resolve(187);
+    glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) {
+    glad_lazy_resolve(188);
+    glad_glEvalCoord2fv(u);
+}
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    glad_lazy_resolve(189);
+    glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    glad_lazy_resolve(190);
+    glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) {
+    glad_lazy_resolve(191);
+    glad_glEvalPoint1(i);
+}
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) {
+    glad_lazy_resolve(192);
+    glad_glEvalPoint2(i, j);
+}
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+    glad_lazy_resolve(193);
+    glad_glFeedbackBuffer(size, type, buffer);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+    glad_lazy_resolve(194);
+    return glad_glFenceSync(condition, flags);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+    glad_lazy_resolve(195);
+    glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+    glad_lazy_resolve(196);
+    glad_glFlush();
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    glad_lazy_resolve(197);
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(198);
+    glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) {
+    glad_lazy_resolve(199);
+    glad_glFogCoordd(coord);
+}
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) {
+    glad_lazy_resolve(200);
+    glad_glFogCoorddv(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) {
+    glad_lazy_resolve(201);
+    glad_glFogCoordf(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) {
+    glad_lazy_resolve(202);
+    glad_glFogCoordfv(coord);
+}
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) {
+    glad_lazy_resolve(203);
+    glad_glFogf(pname, param);
+}
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(204);
+    glad_glFogfv(pname, params);
+}
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) {
+    glad_lazy_resolve(205);
+    glad_glFogi(pname, param);
+}
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) {
+    glad_lazy_resolve(206);
+    glad_glFogiv(pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_lazy_resolve(207);
+    glad_glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    glad_lazy_resolve(208);
+    glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    glad_lazy_resolve(209);
+    glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_lazy_resolve(210);
+    glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_lazy_resolve(211);
+    glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    glad_lazy_resolve(212);
+    glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    glad_lazy_resolve(213);
+    glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+    glad_lazy_resolve(214);
+    glad_glFrontFace(mode);
+}
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    glad_lazy_resolve(215);
+    glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+    glad_lazy_resolve(216);
+    glad_glGenBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    glad_lazy_resolve(217);
+    glad_glGenFramebuffers(n, framebuffers);
+}
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) {
+    glad_lazy_resolve(218);
+    return glad_glGenLists(range);
+}
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    glad_lazy_resolve(219);
+    glad_glGenProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+    glad_lazy_resolve(220);
+    glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    glad_lazy_resolve(221);
+    glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+    glad_lazy_resolve(222);
+    glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+    glad_lazy_resolve(223);
+    glad_glGenTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    glad_lazy_resolve(224);
+    glad_glGenTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    glad_lazy_resolve(225);
+    glad_glGenVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+    glad_lazy_resolve(226);
+    glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    glad_lazy_resolve(227);
+    glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    glad_lazy_resolve(228);
+    glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) {
+    glad_lazy_resolve(229);
+    glad_glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) {
+    glad_lazy_resolve(230);
+    glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    glad_lazy_resolve(231);
+    glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    glad_lazy_resolve(232);
+    glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    glad_lazy_resolve(233);
+    glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    glad_lazy_resolve(234);
+    glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    glad_lazy_resolve(235);
+    glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    glad_lazy_resolve(236);
+    glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    glad_lazy_resolve(237);
+    glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+    glad_lazy_resolve(238);
+    return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    glad_lazy_resolve(239);
+    glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+    glad_lazy_resolve(240);
+    glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    glad_lazy_resolve(241);
+    glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(242);
+    glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    glad_lazy_resolve(243);
+    glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    glad_lazy_resolve(244);
+    glad_glGetBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+    glad_lazy_resolve(245);
+    glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    glad_lazy_resolve(246);
+    glad_glGetCompressedTexImage(target, level, img);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    glad_lazy_resolve(247);
+    return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    glad_lazy_resolve(248);
+    glad_glGetDoublei_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+    glad_lazy_resolve(249);
+    glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+    glad_lazy_resolve(250);
+    return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    glad_lazy_resolve(251);
+    glad_glGetFloati_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+    glad_lazy_resolve(252);
+    glad_glGetFloatv(pname, data);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    glad_lazy_resolve(253);
+    return glad_glGetFragDataIndex(program, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    glad_lazy_resolve(254);
+    return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    glad_lazy_resolve(255);
+    glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(256);
+    glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    glad_lazy_resolve(257);
+    glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+    glad_lazy_resolve(258);
+    glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    glad_lazy_resolve(259);
+    glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+    glad_lazy_resolve(260);
+    glad_glGetIntegerv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params) {
+    glad_lazy_resolve(261);
+    glad_glGetInternalformati64v(target, internalformat, pname, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params) {
+    glad_lazy_resolve(262);
+    glad_glGetInternalformativ(target, internalformat, pname, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(263);
+    glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+    glad_lazy_resolve(264);
+    glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+    glad_lazy_resolve(265);
+    glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+    glad_lazy_resolve(266);
+    glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+    glad_lazy_resolve(267);
+    glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(268);
+    glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+    glad_lazy_resolve(269);
+    glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    glad_lazy_resolve(270);
+    glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    glad_lazy_resolve(271);
+    glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    glad_lazy_resolve(272);
+    glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+    glad_lazy_resolve(273);
+    glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+    glad_lazy_resolve(274);
+    glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+    glad_lazy_resolve(275);
+    glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+    glad_lazy_resolve(276);
+    glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) {
+    glad_lazy_resolve(277);
+    glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    glad_lazy_resolve(278);
+    glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_lazy_resolve(279);
+    glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    glad_lazy_resolve(280);
+    glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_lazy_resolve(281);
+    glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    glad_lazy_resolve(282);
+    glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_lazy_resolve(283);
+    return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_lazy_resolve(284);
+    return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_lazy_resolve(285);
+    return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    glad_lazy_resolve(286);
+    glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params) {
+    glad_lazy_resolve(287);
+    glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+}
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    glad_lazy_resolve(288);
+    glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    glad_lazy_resolve(289);
+    glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    glad_lazy_resolve(290);
+    glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    glad_lazy_resolve(291);
+    glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    glad_lazy_resolve(292);
+    glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    glad_lazy_resolve(293);
+    glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    glad_lazy_resolve(294);
+    glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(295);
+    glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(296);
+    glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    glad_lazy_resolve(297);
+    glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    glad_lazy_resolve(298);
+    glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(299);
+    glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    glad_lazy_resolve(300);
+    glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_lazy_resolve(301);
+    glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    glad_lazy_resolve(302);
+    glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    glad_lazy_resolve(303);
+    glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    glad_lazy_resolve(304);
+    glad_glGetShaderiv(shader, pname, params);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+    glad_lazy_resolve(305);
+    return glad_glGetString(name);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+    glad_lazy_resolve(306);
+    return glad_glGetStringi(name, index);
+}
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    glad_lazy_resolve(307);
+    return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    glad_lazy_resolve(308);
+    return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+    glad_lazy_resolve(309);
+    glad_glGetSynciv(sync, pname, bufSize, length, values);
+}
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(310);
+    glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(311);
+    glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+    glad_lazy_resolve(312);
+    glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(313);
+    glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+    glad_lazy_resolve(314);
+    glad_glGetTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    glad_lazy_resolve(315);
+    glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(316);
+    glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    glad_lazy_resolve(317);
+    glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(318);
+    glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    glad_lazy_resolve(319);
+    glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(320);
+    glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_lazy_resolve(321);
+    glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    glad_lazy_resolve(322);
+    glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    glad_lazy_resolve(323);
+    return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    glad_lazy_resolve(324);
+    glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+    glad_lazy_resolve(325);
+    return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    glad_lazy_resolve(326);
+    glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    glad_lazy_resolve(327);
+    glad_glGetUniformdv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    glad_lazy_resolve(328);
+    glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    glad_lazy_resolve(329);
+    glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    glad_lazy_resolve(330);
+    glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    glad_lazy_resolve(331);
+    glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    glad_lazy_resolve(332);
+    glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    glad_lazy_resolve(333);
+    glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    glad_lazy_resolve(334);
+    glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    glad_lazy_resolve(335);
+    glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    glad_lazy_resolve(336);
+    glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    glad_lazy_resolve(337);
+    glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+    glad_lazy_resolve(338);
+    glad_glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) {
+    glad_lazy_resolve(339);
+    glad_glIndexMask(mask);
+}
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(340);
+    glad_glIndexPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) {
+    glad_lazy_resolve(341);
+    glad_glIndexd(c);
+}
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) {
+    glad_lazy_resolve(342);
+    glad_glIndexdv(c);
+}
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) {
+    glad_lazy_resolve(343);
+    glad_glIndexf(c);
+}
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) {
+    glad_lazy_resolve(344);
+    glad_glIndexfv(c);
+}
+static void APIENTRY glad_lazy_glIndexi(GLint c) {
+    glad_lazy_resolve(345);
+    glad_glIndexi(c);
+}
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) {
+    glad_lazy_resolve(346);
+    glad_glIndexiv(c);
+}
+static void APIENTRY glad_lazy_glIndexs(GLshort c) {
+    glad_lazy_resolve(347);
+    glad_glIndexs(c);
+}
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) {
+    glad_lazy_resolve(348);
+    glad_glIndexsv(c);
+}
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) {
+    glad_lazy_resolve(349);
+    glad_glIndexub(c);
+}
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) {
+    glad_lazy_resolve(350);
+    glad_glIndexubv(c);
+}
+static void APIENTRY glad_lazy_glInitNames(void) {
+    glad_lazy_resolve(351);
+    glad_glInitNames();
+}
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(352);
+    glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+    glad_lazy_resolve(353);
+    glad_glInvalidateBufferData(buffer);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    glad_lazy_resolve(354);
+    glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    glad_lazy_resolve(355);
+    glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(356);
+    glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+    glad_lazy_resolve(357);
+    glad_glInvalidateTexImage(texture, level);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_lazy_resolve(358);
+    glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+    glad_lazy_resolve(359);
+    return glad_glIsBuffer(buffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+    glad_lazy_resolve(360);
+    return glad_glIsEnabled(cap);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+    glad_lazy_resolve(361);
+    return glad_glIsEnabledi(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+    glad_lazy_resolve(362);
+    return glad_glIsFramebuffer(framebuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) {
+    glad_lazy_resolve(363);
+    return glad_glIsList(list);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+    glad_lazy_resolve(364);
+    return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) {
+    glad_lazy_resolve(365);
+    return glad_glIsProgramPipeline(pipeline);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+    glad_lazy_resolve(366);
+    return glad_glIsQuery(id);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+    glad_lazy_resolve(367);
+    return glad_glIsRenderbuffer(renderbuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+    glad_lazy_resolve(368);
+    return glad_glIsSampler(sampler);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+    glad_lazy_resolve(369);
+    return glad_glIsShader(shader);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+    glad_lazy_resolve(370);
+    return glad_glIsSync(sync);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+    glad_lazy_resolve(371);
+    return glad_glIsTexture(texture);
+}
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) {
+    glad_lazy_resolve(372);
+    return glad_glIsTransformFeedback(id);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+    glad_lazy_resolve(373);
+    return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) {
+    glad_lazy_resolve(374);
+    glad_glLightModelf(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(375);
+    glad_glLightModelfv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) {
+    glad_lazy_resolve(376);
+    glad_glLightModeli(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) {
+    glad_lazy_resolve(377);
+    glad_glLightModeliv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(378);
+    glad_glLightf(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(379);
+    glad_glLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+    glad_lazy_resolve(380);
+    glad_glLighti(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(381);
+    glad_glLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) {
+    glad_lazy_resolve(382);
+    glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+    glad_lazy_resolve(383);
+    glad_glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+    glad_lazy_resolve(384);
+    glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glListBase(GLuint base) {
+    glad_lazy_resolve(385);
+    glad_glListBase(base);
+}
+static void APIENTRY glad_lazy_glLoadIdentity(void) {
+    glad_lazy_resolve(386);
+    glad_glLoadIdentity();
+}
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) {
+    glad_lazy_resolve(387);
+    glad_glLoadMatrixd(m);
+}
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) {
+    glad_lazy_resolve(388);
+    glad_glLoadMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLoadName(GLuint name) {
+    glad_lazy_resolve(389);
+    glad_glLoadName(name);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+    glad_lazy_resolve(390);
+    glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+    glad_lazy_resolve(391);
+    glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+    glad_lazy_resolve(392);
+    glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+    glad_lazy_resolve(393);
+    glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+    glad_lazy_resolve(394);
+    glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+    glad_lazy_resolve(395);
+    glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+    glad_lazy_resolve(396);
+    glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+    glad_lazy_resolve(397);
+    return glad_glMapBuffer(target, access);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    glad_lazy_resolve(398);
+    return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    glad_lazy_resolve(399);
+    glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    glad_lazy_resolve(400);
+    glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    glad_lazy_resolve(401);
+    glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    glad_lazy_resolve(402);
+    glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(403);
+    glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(404);
+    glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+    glad_lazy_resolve(405);
+    glad_glMateriali(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(406);
+    glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) {
+    glad_lazy_resolve(407);
+    glad_glMatrixMode(mode);
+}
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) {
+    glad_lazy_resolve(408);
+    glad_glMemoryBarrier(barriers);
+}
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) {
+    glad_lazy_resolve(409);
+    glad_glMinSampleShading(value);
+}
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) {
+    glad_lazy_resolve(410);
+    glad_glMultMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) {
+    glad_lazy_resolve(411);
+    glad_glMultMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) {
+    glad_lazy_resolve(412);
+    glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) {
+    glad_lazy_resolve(413);
+    glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    glad_lazy_resolve(414);
+    glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    glad_lazy_resolve(415);
+    glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    glad_lazy_resolve(416);
+    glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    glad_lazy_resolve(417);
+    glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    glad_lazy_resolve(418);
+    glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+    glad_lazy_resolve(419);
+    glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+    glad_lazy_resolve(420);
+    glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+    glad_lazy_resolve(421);
+    glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+    glad_lazy_resolve(422);
+    glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+    glad_lazy_resolve(423);
+    glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+    glad_lazy_resolve(424);
+    glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+    glad_lazy_resolve(425);
+    glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+    glad_lazy_resolve(426);
+    glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    glad_lazy_resolve(427);
+    glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+    glad_lazy_resolve(428);
+    glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    glad_lazy_resolve(429);
+    glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+    glad_lazy_resolve(430);
+    glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    glad_lazy_resolve(431);
+    glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+    glad_lazy_resolve(432);
+    glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    glad_lazy_resolve(433);
+    glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+    glad_lazy_resolve(434);
+    glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    glad_lazy_resolve(435);
+    glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+    glad_lazy_resolve(436);
+    glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    glad_lazy_resolve(437);
+    glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+    glad_lazy_resolve(438);
+    glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    glad_lazy_resolve(439);
+    glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+    glad_lazy_resolve(440);
+    glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    glad_lazy_resolve(441);
+    glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+    glad_lazy_resolve(442);
+    glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    glad_lazy_resolve(443);
+    glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+    glad_lazy_resolve(444);
+    glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    glad_lazy_resolve(445);
+    glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+    glad_lazy_resolve(446);
+    glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    glad_lazy_resolve(447);
+    glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+    glad_lazy_resolve(448);
+    glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    glad_lazy_resolve(449);
+    glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+    glad_lazy_resolve(450);
+    glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_lazy_resolve(451);
+    glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(452);
+    glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_lazy_resolve(453);
+    glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(454);
+    glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_lazy_resolve(455);
+    glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(456);
+    glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_lazy_resolve(457);
+    glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(458);
+    glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) {
+    glad_lazy_resolve(459);
+    glad_glNewList(list, mode);
+}
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    glad_lazy_resolve(460);
+    glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) {
+    glad_lazy_resolve(461);
+    glad_glNormal3bv(v);
+}
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    glad_lazy_resolve(462);
+    glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) {
+    glad_lazy_resolve(463);
+    glad_glNormal3dv(v);
+}
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    glad_lazy_resolve(464);
+    glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) {
+    glad_lazy_resolve(465);
+    glad_glNormal3fv(v);
+}
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+    glad_lazy_resolve(466);
+    glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) {
+    glad_lazy_resolve(467);
+    glad_glNormal3iv(v);
+}
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+    glad_lazy_resolve(468);
+    glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) {
+    glad_lazy_resolve(469);
+    glad_glNormal3sv(v);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+    glad_lazy_resolve(470);
+    glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(471);
+    glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(472);
+    glad_glNormalPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    glad_lazy_resolve(473);
+    glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    glad_lazy_resolve(474);
+    glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    glad_lazy_resolve(475);
+    glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) {
+    glad_lazy_resolve(476);
+    glad_glPassThrough(token);
+}
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    glad_lazy_resolve(477);
+    glad_glPatchParameterfv(pname, values);
+}
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) {
+    glad_lazy_resolve(478);
+    glad_glPatchParameteri(pname, value);
+}
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+    glad_lazy_resolve(479);
+    glad_glPauseTransformFeedback();
+}
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+    glad_lazy_resolve(480);
+    glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+    glad_lazy_resolve(481);
+    glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+    glad_lazy_resolve(482);
+    glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+    glad_lazy_resolve(483);
+    glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+    glad_lazy_resolve(484);
+    glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+    glad_lazy_resolve(485);
+    glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) {
+    glad_lazy_resolve(486);
+    glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    glad_lazy_resolve(487);
+    glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+    glad_lazy_resolve(488);
+    glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(489);
+    glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+    glad_lazy_resolve(490);
+    glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+    glad_lazy_resolve(491);
+    glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+    glad_lazy_resolve(492);
+    glad_glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+    glad_lazy_resolve(493);
+    glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+    glad_lazy_resolve(494);
+    glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) {
+    glad_lazy_resolve(495);
+    glad_glPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glPopAttrib(void) {
+    glad_lazy_resolve(496);
+    glad_glPopAttrib();
+}
+static void APIENTRY glad_lazy_glPopClientAttrib(void) {
+    glad_lazy_resolve(497);
+    glad_glPopClientAttrib();
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+    glad_lazy_resolve(498);
+    glad_glPopDebugGroup();
+}
+static void APIENTRY glad_lazy_glPopMatrix(void) {
+    glad_lazy_resolve(499);
+    glad_glPopMatrix();
+}
+static void APIENTRY glad_lazy_glPopName(void) {
+    glad_lazy_resolve(500);
+    glad_glPopName();
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+    glad_lazy_resolve(501);
+    glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+    glad_lazy_resolve(502);
+    glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    glad_lazy_resolve(503);
+    glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    glad_lazy_resolve(504);
+    glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    glad_lazy_resolve(505);
+    glad_glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(506);
+    glad_glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    glad_lazy_resolve(507);
+    glad_glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(508);
+    glad_glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    glad_lazy_resolve(509);
+    glad_glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(510);
+    glad_glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    glad_lazy_resolve(511);
+    glad_glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(512);
+    glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    glad_lazy_resolve(513);
+    glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(514);
+    glad_glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    glad_lazy_resolve(515);
+    glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(516);
+    glad_glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    glad_lazy_resolve(517);
+    glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(518);
+    glad_glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    glad_lazy_resolve(519);
+    glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(520);
+    glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    glad_lazy_resolve(521);
+    glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(522);
+    glad_glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_lazy_resolve(523);
+    glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(524);
+    glad_glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_lazy_resolve(525);
+    glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(526);
+    glad_glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_lazy_resolve(527);
+    glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(528);
+    glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    glad_lazy_resolve(529);
+    glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(530);
+    glad_glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_lazy_resolve(531);
+    glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(532);
+    glad_glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_lazy_resolve(533);
+    glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(534);
+    glad_glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_lazy_resolve(535);
+    glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(536);
+    glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(537);
+    glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(538);
+    glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(539);
+    glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(540);
+    glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(541);
+    glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(542);
+    glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(543);
+    glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(544);
+    glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(545);
+    glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(546);
+    glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(547);
+    glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(548);
+    glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(549);
+    glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(550);
+    glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(551);
+    glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(552);
+    glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(553);
+    glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(554);
+    glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+    glad_lazy_resolve(555);
+    glad_glProvokingVertex(mode);
+}
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) {
+    glad_lazy_resolve(556);
+    glad_glPushAttrib(mask);
+}
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) {
+    glad_lazy_resolve(557);
+    glad_glPushClientAttrib(mask);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    glad_lazy_resolve(558);
+    glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPushMatrix(void) {
+    glad_lazy_resolve(559);
+    glad_glPushMatrix();
+}
+static void APIENTRY glad_lazy_glPushName(GLuint name) {
+    glad_lazy_resolve(560);
+    glad_glPushName(name);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+    glad_lazy_resolve(561);
+    glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+    glad_lazy_resolve(562);
+    glad_glRasterPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) {
+    glad_lazy_resolve(563);
+    glad_glRasterPos2dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+    glad_lazy_resolve(564);
+    glad_glRasterPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) {
+    glad_lazy_resolve(565);
+    glad_glRasterPos2fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) {
+    glad_lazy_resolve(566);
+    glad_glRasterPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) {
+    glad_lazy_resolve(567);
+    glad_glRasterPos2iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) {
+    glad_lazy_resolve(568);
+    glad_glRasterPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) {
+    glad_lazy_resolve(569);
+    glad_glRasterPos2sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(570);
+    glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) {
+    glad_lazy_resolve(571);
+    glad_glRasterPos3dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(572);
+    glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) {
+    glad_lazy_resolve(573);
+    glad_glRasterPos3fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+    glad_lazy_resolve(574);
+    glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) {
+    glad_lazy_resolve(575);
+    glad_glRasterPos3iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+    glad_lazy_resolve(576);
+    glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) {
+    glad_lazy_resolve(577);
+    glad_glRasterPos3sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_lazy_resolve(578);
+    glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) {
+    glad_lazy_resolve(579);
+    glad_glRasterPos4dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_lazy_resolve(580);
+    glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) {
+    glad_lazy_resolve(581);
+    glad_glRasterPos4fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    glad_lazy_resolve(582);
+    glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) {
+    glad_lazy_resolve(583);
+    glad_glRasterPos4iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_lazy_resolve(584);
+    glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) {
+    glad_lazy_resolve(585);
+    glad_glRasterPos4sv(v);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+    glad_lazy_resolve(586);
+    glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    glad_lazy_resolve(587);
+    glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    glad_lazy_resolve(588);
+    glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+    glad_lazy_resolve(589);
+    glad_glRectdv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    glad_lazy_resolve(590);
+    glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+    glad_lazy_resolve(591);
+    glad_glRectfv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    glad_lazy_resolve(592);
+    glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) {
+    glad_lazy_resolve(593);
+    glad_glRectiv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    glad_lazy_resolve(594);
+    glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+    glad_lazy_resolve(595);
+    glad_glRectsv(v1, v2);
+}
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+    glad_lazy_resolve(596);
+    glad_glReleaseShaderCompiler();
+}
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) {
+    glad_lazy_resolve(597);
+    return glad_glRenderMode(mode);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(598);
+    glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(599);
+    glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+    glad_lazy_resolve(600);
+    glad_glResumeTransformFeedback();
+}
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(601);
+    glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(602);
+    glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+    glad_lazy_resolve(603);
+    glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    glad_lazy_resolve(604);
+    glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    glad_lazy_resolve(605);
+    glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    glad_lazy_resolve(606);
+    glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(607);
+    glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    glad_lazy_resolve(608);
+    glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    glad_lazy_resolve(609);
+    glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    glad_lazy_resolve(610);
+    glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(611);
+    glad_glScaled(x, y, z);
+}
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(612);
+    glad_glScalef(x, y, z);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(613);
+    glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    glad_lazy_resolve(614);
+    glad_glScissorArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(615);
+    glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(616);
+    glad_glScissorIndexedv(index, v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    glad_lazy_resolve(617);
+    glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) {
+    glad_lazy_resolve(618);
+    glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    glad_lazy_resolve(619);
+    glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) {
+    glad_lazy_resolve(620);
+    glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    glad_lazy_resolve(621);
+    glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) {
+    glad_lazy_resolve(622);
+    glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+    glad_lazy_resolve(623);
+    glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) {
+    glad_lazy_resolve(624);
+    glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    glad_lazy_resolve(625);
+    glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) {
+    glad_lazy_resolve(626);
+    glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    glad_lazy_resolve(627);
+    glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) {
+    glad_lazy_resolve(628);
+    glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    glad_lazy_resolve(629);
+    glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) {
+    glad_lazy_resolve(630);
+    glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    glad_lazy_resolve(631);
+    glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) {
+    glad_lazy_resolve(632);
+    glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    glad_lazy_resolve(633);
+    glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    glad_lazy_resolve(634);
+    glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(635);
+    glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+    glad_lazy_resolve(636);
+    glad_glSelectBuffer(size, buffer);
+}
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) {
+    glad_lazy_resolve(637);
+    glad_glShadeModel(mode);
+}
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length) {
+    glad_lazy_resolve(638);
+    glad_glShaderBinary(count, shaders, binaryformat, binary, length);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    glad_lazy_resolve(639);
+    glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    glad_lazy_resolve(640);
+    glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    glad_lazy_resolve(641);
+    glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    glad_lazy_resolve(642);
+    glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+    glad_lazy_resolve(643);
+    glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    glad_lazy_resolve(644);
+    glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    glad_lazy_resolve(645);
+    glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    glad_lazy_resolve(646);
+    glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    glad_lazy_resolve(647);
+    glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_lazy_resolve(648);
+    glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) {
+    glad_lazy_resolve(649);
+    glad_glTexCoord1d(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) {
+    glad_lazy_resolve(650);
+    glad_glTexCoord1dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) {
+    glad_lazy_resolve(651);
+    glad_glTexCoord1f(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) {
+    glad_lazy_resolve(652);
+    glad_glTexCoord1fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) {
+    glad_lazy_resolve(653);
+    glad_glTexCoord1i(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) {
+    glad_lazy_resolve(654);
+    glad_glTexCoord1iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) {
+    glad_lazy_resolve(655);
+    glad_glTexCoord1s(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) {
+    glad_lazy_resolve(656);
+    glad_glTexCoord1sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+    glad_lazy_resolve(657);
+    glad_glTexCoord2d(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) {
+    glad_lazy_resolve(658);
+    glad_glTexCoord2dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+    glad_lazy_resolve(659);
+    glad_glTexCoord2f(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) {
+    glad_lazy_resolve(660);
+    glad_glTexCoord2fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) {
+    glad_lazy_resolve(661);
+    glad_glTexCoord2i(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) {
+    glad_lazy_resolve(662);
+    glad_glTexCoord2iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) {
+    glad_lazy_resolve(663);
+    glad_glTexCoord2s(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) {
+    glad_lazy_resolve(664);
+    glad_glTexCoord2sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    glad_lazy_resolve(665);
+    glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) {
+    glad_lazy_resolve(666);
+    glad_glTexCoord3dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    glad_lazy_resolve(667);
+    glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) {
+    glad_lazy_resolve(668);
+    glad_glTexCoord3fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+    glad_lazy_resolve(669);
+    glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) {
+    glad_lazy_resolve(670);
+    glad_glTexCoord3iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+    glad_lazy_resolve(671);
+    glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) {
+    glad_lazy_resolve(672);
+    glad_glTexCoord3sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    glad_lazy_resolve(673);
+    glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) {
+    glad_lazy_resolve(674);
+    glad_glTexCoord4dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    glad_lazy_resolve(675);
+    glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) {
+    glad_lazy_resolve(676);
+    glad_glTexCoord4fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    glad_lazy_resolve(677);
+    glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) {
+    glad_lazy_resolve(678);
+    glad_glTexCoord4iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    glad_lazy_resolve(679);
+    glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) {
+    glad_lazy_resolve(680);
+    glad_glTexCoord4sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+    glad_lazy_resolve(681);
+    glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(682);
+    glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+    glad_lazy_resolve(683);
+    glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(684);
+    glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+    glad_lazy_resolve(685);
+    glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(686);
+    glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+    glad_lazy_resolve(687);
+    glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    glad_lazy_resolve(688);
+    glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(689);
+    glad_glTexCoordPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(690);
+    glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(691);
+    glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    glad_lazy_resolve(692);
+    glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(693);
+    glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+    glad_lazy_resolve(694);
+    glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+    glad_lazy_resolve(695);
+    glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(696);
+    glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(697);
+    glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+    glad_lazy_resolve(698);
+    glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(699);
+    glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(700);
+    glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(701);
+    glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_lazy_resolve(702);
+    glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(703);
+    glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_lazy_resolve(704);
+    glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(705);
+    glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    glad_lazy_resolve(706);
+    glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    glad_lazy_resolve(707);
+    glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    glad_lazy_resolve(708);
+    glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_lazy_resolve(709);
+    glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    glad_lazy_resolve(710);
+    glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    glad_lazy_resolve(711);
+    glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(712);
+    glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_lazy_resolve(713);
+    glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_lazy_resolve(714);
+    glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_lazy_resolve(715);
+    glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(716);
+    glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(717);
+    glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    glad_lazy_resolve(718);
+    glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    glad_lazy_resolve(719);
+    glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    glad_lazy_resolve(720);
+    glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(721);
+    glad_glTranslated(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(722);
+    glad_glTranslatef(x, y, z);
+}
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) {
+    glad_lazy_resolve(723);
+    glad_glUniform1d(location, x);
+}
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(724);
+    glad_glUniform1dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+    glad_lazy_resolve(725);
+    glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(726);
+    glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+    glad_lazy_resolve(727);
+    glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(728);
+    glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+    glad_lazy_resolve(729);
+    glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(730);
+    glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    glad_lazy_resolve(731);
+    glad_glUniform2d(location, x, y);
+}
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(732);
+    glad_glUniform2dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    glad_lazy_resolve(733);
+    glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(734);
+    glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+    glad_lazy_resolve(735);
+    glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(736);
+    glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    glad_lazy_resolve(737);
+    glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(738);
+    glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(739);
+    glad_glUniform3d(location, x, y, z);
+}
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(740);
+    glad_glUniform3dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_lazy_resolve(741);
+    glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(742);
+    glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_lazy_resolve(743);
+    glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(744);
+    glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_lazy_resolve(745);
+    glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(746);
+    glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_lazy_resolve(747);
+    glad_glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_lazy_resolve(748);
+    glad_glUniform4dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_lazy_resolve(749);
+    glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_lazy_resolve(750);
+    glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_lazy_resolve(751);
+    glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    glad_lazy_resolve(752);
+    glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_lazy_resolve(753);
+    glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_lazy_resolve(754);
+    glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    glad_lazy_resolve(755);
+    glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(756);
+    glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(757);
+    glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(758);
+    glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(759);
+    glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(760);
+    glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(761);
+    glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(762);
+    glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(763);
+    glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(764);
+    glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(765);
+    glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(766);
+    glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(767);
+    glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(768);
+    glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(769);
+    glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(770);
+    glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(771);
+    glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_lazy_resolve(772);
+    glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_lazy_resolve(773);
+    glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    glad_lazy_resolve(774);
+    glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+    glad_lazy_resolve(775);
+    return glad_glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+    glad_lazy_resolve(776);
+    glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    glad_lazy_resolve(777);
+    glad_glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+    glad_lazy_resolve(778);
+    glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) {
+    glad_lazy_resolve(779);
+    glad_glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) {
+    glad_lazy_resolve(780);
+    glad_glVertex2d(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) {
+    glad_lazy_resolve(781);
+    glad_glVertex2dv(v);
+}
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) {
+    glad_lazy_resolve(782);
+    glad_glVertex2f(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) {
+    glad_lazy_resolve(783);
+    glad_glVertex2fv(v);
+}
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) {
+    glad_lazy_resolve(784);
+    glad_glVertex2i(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) {
+    glad_lazy_resolve(785);
+    glad_glVertex2iv(v);
+}
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) {
+    glad_lazy_resolve(786);
+    glad_glVertex2s(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) {
+    glad_lazy_resolve(787);
+    glad_glVertex2sv(v);
+}
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(788);
+    glad_glVertex3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) {
+    glad_lazy_resolve(789);
+    glad_glVertex3dv(v);
+}
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(790);
+    glad_glVertex3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) {
+    glad_lazy_resolve(791);
+    glad_glVertex3fv(v);
+}
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) {
+    glad_lazy_resolve(792);
+    glad_glVertex3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) {
+    glad_lazy_resolve(793);
+    glad_glVertex3iv(v);
+}
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+    glad_lazy_resolve(794);
+    glad_glVertex3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) {
+    glad_lazy_resolve(795);
+    glad_glVertex3sv(v);
+}
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_lazy_resolve(796);
+    glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) {
+    glad_lazy_resolve(797);
+    glad_glVertex4dv(v);
+}
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_lazy_resolve(798);
+    glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) {
+    glad_lazy_resolve(799);
+    glad_glVertex4fv(v);
+}
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+    glad_lazy_resolve(800);
+    glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) {
+    glad_lazy_resolve(801);
+    glad_glVertex4iv(v);
+}
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_lazy_resolve(802);
+    glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) {
+    glad_lazy_resolve(803);
+    glad_glVertex4sv(v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+    glad_lazy_resolve(804);
+    glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(805);
+    glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+    glad_lazy_resolve(806);
+    glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    glad_lazy_resolve(807);
+    glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+    glad_lazy_resolve(808);
+    glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(809);
+    glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_lazy_resolve(810);
+    glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(811);
+    glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    glad_lazy_resolve(812);
+    glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    glad_lazy_resolve(813);
+    glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    glad_lazy_resolve(814);
+    glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(815);
+    glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(816);
+    glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(817);
+    glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(818);
+    glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    glad_lazy_resolve(819);
+    glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    glad_lazy_resolve(820);
+    glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(821);
+    glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    glad_lazy_resolve(822);
+    glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(823);
+    glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(824);
+    glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    glad_lazy_resolve(825);
+    glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    glad_lazy_resolve(826);
+    glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(827);
+    glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    glad_lazy_resolve(828);
+    glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    glad_lazy_resolve(829);
+    glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_lazy_resolve(830);
+    glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(831);
+    glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_lazy_resolve(832);
+    glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    glad_lazy_resolve(833);
+    glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(834);
+    glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_lazy_resolve(835);
+    glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(836);
+    glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    glad_lazy_resolve(837);
+    glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(838);
+    glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    glad_lazy_resolve(839);
+    glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    glad_lazy_resolve(840);
+    glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    glad_lazy_resolve(841);
+    glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    glad_lazy_resolve(842);
+    glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+    glad_lazy_resolve(843);
+    glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(844);
+    glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+    glad_lazy_resolve(845);
+    glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(846);
+    glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    glad_lazy_resolve(847);
+    glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(848);
+    glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    glad_lazy_resolve(849);
+    glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(850);
+    glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    glad_lazy_resolve(851);
+    glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(852);
+    glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    glad_lazy_resolve(853);
+    glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(854);
+    glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    glad_lazy_resolve(855);
+    glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    glad_lazy_resolve(856);
+    glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    glad_lazy_resolve(857);
+    glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    glad_lazy_resolve(858);
+    glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    glad_lazy_resolve(859);
+    glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    glad_lazy_resolve(860);
+    glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    glad_lazy_resolve(861);
+    glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    glad_lazy_resolve(862);
+    glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_lazy_resolve(863);
+    glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(864);
+    glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+    glad_lazy_resolve(865);
+    glad_glVertexAttribL1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(866);
+    glad_glVertexAttribL1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_lazy_resolve(867);
+    glad_glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(868);
+    glad_glVertexAttribL2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(869);
+    glad_glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(870);
+    glad_glVertexAttribL3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_lazy_resolve(871);
+    glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    glad_lazy_resolve(872);
+    glad_glVertexAttribL4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_lazy_resolve(873);
+    glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(874);
+    glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_lazy_resolve(875);
+    glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_lazy_resolve(876);
+    glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_lazy_resolve(877);
+    glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_lazy_resolve(878);
+    glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_lazy_resolve(879);
+    glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_lazy_resolve(880);
+    glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_lazy_resolve(881);
+    glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_lazy_resolve(882);
+    glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(883);
+    glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    glad_lazy_resolve(884);
+    glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+    glad_lazy_resolve(885);
+    glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+    glad_lazy_resolve(886);
+    glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+    glad_lazy_resolve(887);
+    glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+    glad_lazy_resolve(888);
+    glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+    glad_lazy_resolve(889);
+    glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+    glad_lazy_resolve(890);
+    glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_lazy_resolve(891);
+    glad_glVertexPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_lazy_resolve(892);
+    glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    glad_lazy_resolve(893);
+    glad_glViewportArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    glad_lazy_resolve(894);
+    glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    glad_lazy_resolve(895);
+    glad_glViewportIndexedfv(index, v);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_lazy_resolve(896);
+    glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+    glad_lazy_resolve(897);
+    glad_glWindowPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) {
+    glad_lazy_resolve(898);
+    glad_glWindowPos2dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+    glad_lazy_resolve(899);
+    glad_glWindowPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) {
+    glad_lazy_resolve(900);
+    glad_glWindowPos2fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) {
+    glad_lazy_resolve(901);
+    glad_glWindowPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) {
+    glad_lazy_resolve(902);
+    glad_glWindowPos2iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) {
+    glad_lazy_resolve(903);
+    glad_glWindowPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) {
+    glad_lazy_resolve(904);
+    glad_glWindowPos2sv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_lazy_resolve(905);
+    glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) {
+    glad_lazy_resolve(906);
+    glad_glWindowPos3dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_lazy_resolve(907);
+    glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) {
+    glad_lazy_resolve(908);
+    glad_glWindowPos3fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+    glad_lazy_resolve(909);
+    glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) {
+    glad_lazy_resolve(910);
+    glad_glWindowPos3iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+    glad_lazy_resolve(911);
+    glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) {
+    glad_lazy_resolve(912);
+    glad_glWindowPos3sv(v);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    glad_lazy_resolve(913);
+    glad_glBufferStorage(target, size, data, flags);
+}
+static const struct gladLazyProc glad_lazy_procs[] = {
+	{ "glAccum", (GLADlazyproc*)&glad_glAccum, (GLADlazyproc)glad_lazy_glAccum },
+	{ "glActiveShaderProgram", (GLADlazyproc*)&glad_glActiveShaderProgram, (GLADlazyproc)glad_lazy_glActiveShaderProgram },
+	{ "glActiveTexture", (GLADlazyproc*)&glad_glActiveTexture, (GLADlazyproc)glad_lazy_glActiveTexture },
+	{ "glAlphaFunc", (GLADlazyproc*)&glad_glAlphaFunc, (GLADlazyproc)glad_lazy_glAlphaFunc },
+	{ "glAreTexturesResident", (GLADlazyproc*)&glad_glAreTexturesResident, (GLADlazyproc)glad_lazy_glAreTexturesResident },
+	{ "glArrayElement", (GLADlazyproc*)&glad_glArrayElement, (GLADlazyproc)glad_lazy_glArrayElement },
+	{ "glAttachShader", (GLADlazyproc*)&glad_glAttachShader, (GLADlazyproc)glad_lazy_glAttachShader },
+	{ "glBegin", (GLADlazyproc*)&glad_glBegin, (GLADlazyproc)glad_lazy_glBegin },
+	{ "glBeginConditionalRender", (GLADlazyproc*)&glad_glBeginConditionalRender, (GLADlazyproc)glad_lazy_glBeginConditionalRender },
+	{ "glBeginQuery", (GLADlazyproc*)&glad_glBeginQuery, (GLADlazyproc)glad_lazy_glBeginQuery },
+	{ "glBeginQueryIndexed", (GLADlazyproc*)&glad_glBeginQueryIndexed, (GLADlazyproc)glad_lazy_glBeginQueryIndexed },
+	{ "glBeginTransformFeedback", (GLADlazyproc*)&glad_glBeginTransformFeedback, (GLADlazyproc)glad_lazy_glBeginTransformFeedback },
+	{ "glBindAttribLocation", (GLADlazyproc*)&glad_glBindAttribLocation, (GLADlazyproc)glad_lazy_glBindAttribLocation },
+	{ "glBindBuffer", (GLADlazyproc*)&glad_glBindBuffer, (GLADlazyproc)glad_lazy_glBindBuffer },
+	{ "glBindBufferBase", (GLADlazyproc*)&glad_glBindBufferBase, (GLADlazyproc)glad_lazy_glBindBufferBase },
+	{ "glBindBufferRange", (GLADlazyproc*)&glad_glBindBufferRange, (GLADlazyproc)glad_lazy_glBindBufferRange },
+	{ "glBindFragDataLocation", (GLADlazyproc*)&glad_glBindFragDataLocation, (GLADlazyproc)glad_lazy_glBindFragDataLocation },
+	{ "glBindFragDataLocationIndexed", (GLADlazyproc*)&glad_glBindFragDataLocationIndexed, (GLADlazyproc)glad_lazy_glBindFragDataLocationIndexed },
+	{ "glBindFramebuffer", (GLADlazyproc*)&glad_glBindFramebuffer, (GLADlazyproc)glad_lazy_glBindFramebuffer },
+	{ "glBindImageTexture", (GLADlazyproc*)&glad_glBindImageTexture, (GLADlazyproc)glad_lazy_glBindImageTexture },
+	{ "glBindProgramPipeline", (GLADlazyproc*)&glad_glBindProgramPipeline, (GLADlazyproc)glad_lazy_glBindProgramPipeline },
+	{ "glBindRenderbuffer", (GLADlazyproc*)&glad_glBindRenderbuffer, (GLADlazyproc)glad_lazy_glBindRenderbuffer },
+	{ "glBindSampler", (GLADlazyproc*)&glad_glBindSampler, (GLADlazyproc)glad_lazy_glBindSampler },
+	{ "glBindTexture", (GLADlazyproc*)&glad_glBindTexture, (GLADlazyproc)glad_lazy_glBindTexture },
+	{ "glBindTransformFeedback", (GLADlazyproc*)&glad_glBindTransformFeedback, (GLADlazyproc)glad_lazy_glBindTransformFeedback },
+	{ "glBindVertexArray", (GLADlazyproc*)&glad_glBindVertexArray, (GLADlazyproc)glad_lazy_glBindVertexArray },
+	{ "glBindVertexBuffer", (GLADlazyproc*)&glad_glBindVertexBuffer, (GLADlazyproc)glad_lazy_glBindVertexBuffer },
+	{ "glBitmap", (GLADlazyproc*)&glad_glBitmap, (GLADlazyproc)glad_lazy_glBitmap },
+	{ "glBlendColor", (GLADlazyproc*)&glad_glBlendColor, (GLADlazyproc)glad_lazy_glBlendColor },
+	{ "glBlendEquation", (GLADlazyproc*)&glad_glBlendEquation, (GLADlazyproc)glad_lazy_glBlendEquation },
+	{ "glBlendEquationSeparate", (GLADlazyproc*)&glad_glBlendEquationSeparate, (GLADlazyproc)glad_lazy_glBlendEquationSeparate },
+	{ "glBlendEquationSeparatei", (GLADlazyproc*)&glad_glBlendEquationSeparatei, (GLADlazyproc)glad_lazy_glBlendEquationSeparatei },
+	{ "glBlendEquationi", (GLADlazyproc*)&glad_glBlendEquationi, (GLADlazyproc)glad_lazy_glBlendEquationi },
+	{ "glBlendFunc", (GLADlazyproc*)&glad_glBlendFunc, (GLADlazyproc)glad_lazy_glBlendFunc },
+	{ "glBlendFuncSeparate", (GLADlazyproc*)&glad_glBlendFuncSeparate, (GLADlazyproc)glad_lazy_glBlendFuncSeparate },
+	{ "glBlendFuncSeparatei", (GLADlazyproc*)&glad_glBlendFuncSeparatei, (GLADlazyproc)glad_lazy_glBlendFuncSeparatei },
+	{ "glBlendFunci", (GLADlazyproc*)&glad_glBlendFunci, (GLADlazyproc)glad_lazy_glBlendFunci },
+	{ "glBlitFramebuffer", (GLADlazyproc*)&glad_glBlitFramebuffer, (GLADlazyproc)glad_lazy_glBlitFramebuffer },
+	{ "glBufferData", (GLADlazyproc*)&glad_glBufferData, (GLADlazyproc)glad_lazy_glBufferData },
+	{ "glBufferSubData", (GLADlazyproc*)&glad_glBufferSubData, (GLADlazyproc)glad_lazy_glBufferSubData },
+	{ "glCallList", (GLADlazyproc*)&glad_glCallList, (GLADlazyproc)glad_lazy_glCallList },
+	{ "glCallLists", (GLADlazyproc*)&glad_glCallLists, (GLADlazyproc)glad_lazy_glCallLists },
+	{ "glCheckFramebufferStatus", (GLADlazyproc*)&glad_glCheckFramebufferStatus, (GLADlazyproc)glad_lazy_glCheckFramebufferStatus },
+	{ "glClampColor", (GLADlazyproc*)&glad_glClampColor, (GLADlazyproc)glad_lazy_glClampColor },
+	{ "glClear", (GLADlazyproc*)&glad_glClear, (GLADlazyproc)glad_lazy_glClear },
+	{ "glClearAccum", (GLADlazyproc*)&glad_glClearAccum, (GLADlazyproc)glad_lazy_glClearAccum },
+	{ "glClearBufferData", (GLADlazyproc*)&glad_glClearBufferData, (GLADlazyproc)glad_lazy_glClearBufferData },
+	{ "glClearBufferSubData", (GLADlazyproc*)&glad_glClearBufferSubData, (GLADlazyproc)glad_lazy_glClearBufferSubData },
+	{ "glClearBufferfi", (GLADlazyproc*)&glad_glClearBufferfi, (GLADlazyproc)glad_lazy_glClearBufferfi },
+	{ "glClearBufferfv", (GLADlazyproc*)&glad_glClearBufferfv, (GLADlazyproc)glad_lazy_glClearBufferfv },
+	{ "glClearBufferiv", (GLADlazyproc*)&glad_glClearBufferiv, (GLADlazyproc)glad_lazy_glClearBufferiv },
+	{ "glClearBufferuiv", (GLADlazyproc*)&glad_glClearBufferuiv, (GLADlazyproc)glad_lazy_glClearBufferuiv },
+	{ "glClearColor", (GLADlazyproc*)&glad_glClearColor, (GLADlazyproc)glad_lazy_glClearColor },
+	{ "glClearDepth", (GLADlazyproc*)&glad_glClearDepth, (GLADlazyproc)glad_lazy_glClearDepth },
+	{ "glClearDepthf", (GLADlazyproc*)&glad_glClearDepthf, (GLADlazyproc)glad_lazy_glClearDepthf },
+	{ "glClearIndex", (GLADlazyproc*)&glad_glClearIndex, (GLADlazyproc)glad_lazy_glClearIndex },
+	{ "glClearStencil", (GLADlazyproc*)&glad_glClearStencil, (GLADlazyproc)glad_lazy_glClearStencil },
+	{ "glClientActiveTexture", (GLADlazyproc*)&glad_glClientActiveTexture, (GLADlazyproc)glad_lazy_glClientActiveTexture },
+	{ "glClientWaitSync", (GLADlazyproc*)&glad_glClientWaitSync, (GLADlazyproc)glad_lazy_glClientWaitSync },
+	{ "glClipPlane", (GLADlazyproc*)&glad_glClipPlane, (GLADlazyproc)glad_lazy_glClipPlane },
+	{ "glColor3b", (GLADlazyproc*)&glad_glColor3b, (GLADlazyproc)glad_lazy_glColor3b },
+	{ "glColor3bv", (GLADlazyproc*)&glad_glColor3bv, (GLADlazyproc)glad_lazy_glColor3bv },
+	{ "glColor3d", (GLADlazyproc*)&glad_glColor3d, (GLADlazyproc)glad_lazy_glColor3d },
+	{ "glColor3dv", (GLADlazyproc*)&glad_glColor3dv, (GLADlazyproc)glad_lazy_glColor3dv },
+	{ "glColor3f", (GLADlazyproc*)&glad_glColor3f, (GLADlazyproc)glad_lazy_glColor3f },
+	{ "glColor3fv", (GLADlazyproc*)&glad_glColor3fv, (GLADlazyproc)glad_lazy_glColor3fv },
+	{ "glColor3i", (GLADlazyproc*)&glad_glColor3i, (GLADlazyproc)glad_lazy_glColor3i },
+	{ "glColor3iv", (GLADlazyproc*)&glad_glColor3iv, (GLADlazyproc)glad_lazy_glColor3iv },
+	{ "glColor3s", (GLADlazyproc*)&glad_glColor3s, (GLADlazyproc)glad_lazy_glColor3s },
+	{ "glColor3sv", (GLADlazyproc*)&glad_glColor3sv, (GLADlazyproc)glad_lazy_glColor3sv },
+	{ "glColor3ub", (GLADlazyproc*)&glad_glColor3ub, (GLADlazyproc)glad_lazy_glColor3ub },
+	{ "glColor3ubv", (GLADlazyproc*)&glad_glColor3ubv, (GLADlazyproc)glad_lazy_glColor3ubv },
+	{ "glColor3ui", (GLADlazyproc*)&glad_glColor3ui, (GLADlazyproc)glad_lazy_glColor3ui },
+	{ "glColor3uiv", (GLADlazyproc*)&glad_glColor3uiv, (GLADlazyproc)glad_lazy_glColor3uiv },
+	{ "glColor3us", (GLADlazyproc*)&glad_glColor3us, (GLADlazyproc)glad_lazy_glColor3us },
+	{ "glColor3usv", (GLADlazyproc*)&glad_glColor3usv, (GLADlazyproc)glad_lazy_glColor3usv },
+	{ "glColor4b", (GLADlazyproc*)&glad_glColor4b, (GLADlazyproc)glad_lazy_glColor4b },
+	{ "glColor4bv", (GLADlazyproc*)&glad_glColor4bv, (GLADlazyproc)glad_lazy_glColor4bv },
+	{ "glColor4d", (GLADlazyproc*)&glad_glColor4d, (GLADlazyproc)glad_lazy_glColor4d },
+	{ "glColor4dv", (GLADlazyproc*)&glad_glColor4dv, (GLADlazyproc)glad_lazy_glColor4dv },
+	{ "glColor4f", (GLADlazyproc*)&glad_glColor4f, (GLADlazyproc)glad_lazy_glColor4f },
+	{ "glColor4fv", (GLADlazyproc*)&glad_glColor4fv, (GLADlazyproc)glad_lazy_glColor4fv },
+	{ "glColor4i", (GLADlazyproc*)&glad_glColor4i, (GLADlazyproc)glad_lazy_glColor4i },
+	{ "glColor4iv", (GLADlazyproc*)&glad_glColor4iv, (GLADlazyproc)glad_lazy_glColor4iv },
+	{ "glColor4s", (GLADlazyproc*)&glad_glColor4s, (GLADlazyproc)glad_lazy_glColor4s },
+	{ "glColor4sv", (GLADlazyproc*)&glad_glColor4sv, (GLADlazyproc)glad_lazy_glColor4sv },
+	{ "glColor4ub", (GLADlazyproc*)&glad_glColor4ub, (GLADlazyproc)glad_lazy_glColor4ub },
+	{ "glColor4ubv", (GLADlazyproc*)&glad_glColor4ubv, (GLADlazyproc)glad_lazy_glColor4ubv },
+	{ "glColor4ui", (GLADlazyproc*)&glad_glColor4ui, (GLADlazyproc)glad_lazy_glColor4ui },
+	{ "glColor4uiv", (GLADlazyproc*)&glad_glColor4uiv, (GLADlazyproc)glad_lazy_glColor4uiv },
+	{ "glColor4us", (GLADlazyproc*)&glad_glColor4us, (GLADlazyproc)glad_lazy_glColor4us },
+	{ "glColor4usv", (GLADlazyproc*)&glad_glColor4usv, (GLADlazyproc)glad_lazy_glColor4usv },
+	{ "glColorMask", (GLADlazyproc*)&glad_glColorMask, (GLADlazyproc)glad_lazy_glColorMask },
+	{ "glColorMaski", (GLADlazyproc*)&glad_glColorMaski, (GLADlazyproc)glad_lazy_glColorMaski },
+	{ "glColorMaterial", (GLADlazyproc*)&glad_glColorMaterial, (GLADlazyproc)glad_lazy_glColorMaterial },
+	{ "glColorP3ui", (GLADlazyproc*)&glad_glColorP3ui, (GLADlazyproc)glad_lazy_glColorP3ui },
+	{ "glColorP3uiv", (GLADlazyproc*)&glad_glColorP3uiv, (GLADlazyproc)glad_lazy_glColorP3uiv },
+	{ "glColorP4ui", (GLADlazyproc*)&glad_glColorP4ui, (GLADlazyproc)glad_lazy_glColorP4ui },
+	{ "glColorP4uiv", (GLADlazyproc*)&glad_glColorP4uiv, (GLADlazyproc)glad_lazy_glColorP4uiv },
+	{ "glColorPointer", (GLADlazyproc*)&glad_glColorPointer, (GLADlazyproc)glad_lazy_glColorPointer },
+	{ "glCompileShader", (GLADlazyproc*)&glad_glCompileShader, (GLADlazyproc)glad_lazy_glCompileShader },
+	{ "glCompressedTexImage1D", (GLADlazyproc*)&glad_glCompressedTexImage1D, (GLADlazyproc)glad_lazy_glCompressedTexImage1D },
+	{ "glCompressedTexImage2D", (GLADlazyproc*)&glad_glCompressedTexImage2D, (GLADlazyproc)glad_lazy_glCompressedTexImage2D },
+	{ "glCompressedTexImage3D", (GLADlazyproc*)&glad_glCompressedTexImage3D, (GLADlazyproc)glad_lazy_glCompressedTexImage3D },
+	{ "glCompressedTexSubImage1D", (GLADlazyproc*)&glad_glCompressedTexSubImage1D, (GLADlazyproc)glad_lazy_glCompressedTexSubImage1D },
+	{ "glCompressedTexSubImage2D", (GLADlazyproc*)&glad_glCompressedTexSubImage2D, (GLADlazyproc)glad_lazy_glCompressedTexSubImage2D },
+	{ "glCompressedTexSubImage3D", (GLADlazyproc*)&glad_glCompressedTexSubImage3D, (GLADlazyproc)glad_lazy_glCompressedTexSubImage3D },
+	{ "glCopyBufferSubData", (GLADlazyproc*)&glad_glCopyBufferSubData, (GLADlazyproc)glad_lazy_glCopyBufferSubData },
+	{ "glCopyImageSubData", (GLADlazyproc*)&glad_glCopyImageSubData, (GLADlazyproc)glad_lazy_glCopyImageSubData },
+	{ "glCopyPixels", (GLADlazyproc*)&glad_glCopyPixels, (GLADlazyproc)glad_lazy_glCopyPixels },
+	{ "glCopyTexImage1D", (GLADlazyproc*)&glad_glCopyTexImage1D, (GLADlazyproc)glad_lazy_glCopyTexImage1D },
+	{ "glCopyTexImage2D", (GLADlazyproc*)&glad_glCopyTexImage2D, (GLADlazyproc)glad_lazy_glCopyTexImage2D },
+	{ "glCopyTexSubImage1D", (GLADlazyproc*)&glad_glCopyTexSubImage1D, (GLADlazyproc)glad_lazy_glCopyTexSubImage1D },
+	{ "glCopyTexSubImage2D", (GLADlazyproc*)&glad_glCopyTexSubImage2D, (GLADlazyproc)glad_lazy_glCopyTexSubImage2D },
+	{ "glCopyTexSubImage3D", (GLADlazyproc*)&glad_glCopyTexSubImage3D, (GLADlazyproc)glad_lazy_glCopyTexSubImage3D },
+	{ "glCreateProgram", (GLADlazyproc*)&glad_glCreateProgram, (GLADlazyproc)glad_lazy_glCreateProgram },
+	{ "glCreateShader", (GLADlazyproc*)&glad_glCreateShader, (GLADlazyproc)glad_lazy_glCreateShader },
+	{ "glCreateShaderProgramv", (GLADlazyproc*)&glad_glCreateShaderProgramv, (GLADlazyproc)glad_lazy_glCreateShaderProgramv },
+	{ "glCullFace", (GLADlazyproc*)&glad_glCullFace, (GLADlazyproc)glad_lazy_glCullFace },
+	{ "glDebugMessageCallback", (GLADlazyproc*)&glad_glDebugMessageCallback, (GLADlazyproc)glad_lazy_glDebugMessageCallback },
+	{ "glDebugMessageControl", (GLADlazyproc*)&glad_glDebugMessageControl, (GLADlazyproc)glad_lazy_glDebugMessageControl },
+	{ "glDebugMessageInsert", (GLADlazyproc*)&glad_glDebugMessageInsert, (GLADlazyproc)glad_lazy_glDebugMessageInsert },
+	{ "glDeleteBuffers", (GLADlazyproc*)&glad_glDeleteBuffers, (GLADlazyproc)glad_lazy_glDeleteBuffers },
+	{ "glDeleteFramebuffers", (GLADlazyproc*)&glad_glDeleteFramebuffers, (GLADlazyproc)glad_lazy_glDeleteFramebuffers },
+	{ "glDeleteLists", (GLADlazyproc*)&glad_glDeleteLists, (GLADlazyproc)glad_lazy_glDeleteLists },
+	{ "glDeleteProgram", (GLADlazyproc*)&glad_glDeleteProgram, (GLADlazyproc)glad_lazy_glDeleteProgram },
+	{ "glDeleteProgramPipelines", (GLADlazyproc*)&glad_glDeleteProgramPipelines, (GLADlazyproc)glad_lazy_glDeleteProgramPipelines },
+	{ "glDeleteQueries", (GLADlazyproc*)&glad_glDeleteQueries, (GLADlazyproc)glad_lazy_glDeleteQueries },
+	{ "glDeleteRenderbuffers", (GLADlazyproc*)&glad_glDeleteRenderbuffers, (GLADlazyproc)glad_lazy_glDeleteRenderbuffers },
+	{ "glDeleteSamplers", (GLADlazyproc*)&glad_glDeleteSamplers, (GLADlazyproc)glad_lazy_glDeleteSamplers },
+	{ "glDeleteShader", (GLADlazyproc*)&glad_glDeleteShader, (GLADlazyproc)glad_lazy_glDeleteShader },
+	{ "glDeleteSync", (GLADlazyproc*)&glad_glDeleteSync, (GLADlazyproc)glad_lazy_glDeleteSync },
+	{ "glDeleteTextures", (GLADlazyproc*)&glad_glDeleteTextures, (GLADlazyproc)glad_lazy_glDeleteTextures },
+	{ "glDeleteTransformFeedbacks", (GLADlazyproc*)&glad_glDeleteTransformFeedbacks, (GLADlazyproc)glad_lazy_glDeleteTransformFeedbacks },
+	{ "glDeleteVertexArrays", (GLADlazyproc*)&glad_glDeleteVertexArrays, (GLADlazyproc)glad_lazy_glDeleteVertexArrays },
+	{ "glDepthFunc", (GLADlazyproc*)&glad_glDepthFunc, (GLADlazyproc)glad_lazy_glDepthFunc },
+	{ "glDepthMask", (GLADlazyproc*)&glad_glDepthMask, (GLADlazyproc)glad_lazy_glDepthMask },
+	{ "glDepthRange", (GLADlazyproc*)&glad_glDepthRange, (GLADlazyproc)glad_lazy_glDepthRange },
+	{ "glDepthRangeArrayv", (GLADlazyproc*)&glad_glDepthRangeArrayv, (GLADlazyproc)glad_lazy_glDepthRangeArrayv },
+	{ "glDepthRangeIndexed", (GLADlazyproc*)&glad_glDepthRangeIndexed, (GLADlazyproc)glad_lazy_glDepthRangeIndexed },
+	{ "glDepthRangef", (GLADlazyproc*)&glad_glDepthRangef, (GLADlazyproc)glad_lazy_glDepthRangef },
+	{ "glDetachShader", (GLADlazyproc*)&glad_glDetachShader, (GLADlazyproc)glad_lazy_glDetachShader },
+	{ "glDisable", (GLADlazyproc*)&glad_glDisable, (GLADlazyproc)glad_lazy_glDisable },
+	{ "glDisableClientState", (GLADlazyproc*)&glad_glDisableClientState, (GLADlazyproc)glad_lazy_glDisableClientState },
+	{ "glDisableVertexAttribArray", (GLADlazyproc*)&glad_glDisableVertexAttribArray, (GLADlazyproc)glad_lazy_glDisableVertexAttribArray },
+	{ "glDisablei", (GLADlazyproc*)&glad_glDisablei, (GLADlazyproc)glad_lazy_glDisablei },
+	{ "glDispatchCompute", (GLADlazyproc*)&glad_glDispatchCompute, (GLADlazyproc)glad_lazy_glDispatchCompute },
+	{ "glDispatchComputeIndirect", (GLADlazyproc*)&glad_glDispatchComputeIndirect, (GLADlazyproc)glad_lazy_glDispatchComputeIndirect },
+	{ "glDrawArrays", (GLADlazyproc*)&glad_glDrawArrays, (GLADlazyproc)glad_lazy_glDrawArrays },
+	{ "glDrawArraysIndirect", (GLADlazyproc*)&glad_glDrawArraysIndirect, (GLADlazyproc)glad_lazy_glDrawArraysIndirect },
+	{ "glDrawArraysInstanced", (GLADlazyproc*)&glad_glDrawArraysInstanced, (GLADlazyproc)glad_lazy_glDrawArraysInstanced },
+	{ "glDrawArraysInstancedBaseInstance", (GLADlazyproc*)&glad_glDrawArraysInstancedBaseInstance, (GLADlazyproc)glad_lazy_glDrawArraysInstancedBaseInstance },
+	{ "glDrawBuffer", (GLADlazyproc*)&glad_glDrawBuffer, (GLADlazyproc)glad_lazy_glDrawBuffer },
+	{ "glDrawBuffers", (GLADlazyproc*)&glad_glDrawBuffers, (GLADlazyproc)glad_lazy_glDrawBuffers },
+	{ "glDrawElements", (GLADlazyproc*)&glad_glDrawElements, (GLADlazyproc)glad_lazy_glDrawElements },
+	{ "glDrawElementsBaseVertex", (GLADlazyproc*)&glad_glDrawElementsBaseVertex, (GLADlazyproc)glad_lazy_glDrawElementsBaseVertex },
+	{ "glDrawElementsIndirect", (GLADlazyproc*)&glad_glDrawElementsIndirect, (GLADlazyproc)glad_lazy_glDrawElementsIndirect },
+	{ "glDrawElementsInstanced", (GLADlazyproc*)&glad_glDrawElementsInstanced, (GLADlazyproc)glad_lazy_glDrawElementsInstanced },
+	{ "glDrawElementsInstancedBaseInstance", (GLADlazyproc*)&glad_glDrawElementsInstancedBaseInstance, (GLADlazyproc)glad_lazy_glDrawElementsInstancedBaseInstance },
+	{ "glDrawElementsInstancedBaseVertex", (GLADlazyproc*)&glad_glDrawElementsInstancedBaseVertex, (GLADlazyproc)glad_lazy_glDrawElementsInstancedBaseVertex },
+	{ "glDrawElementsInstancedBaseVertexBaseInstance", (GLADlazyproc*)&glad_glDrawElementsInstancedBaseVertexBaseInstance, (GLADlazyproc)glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance },
+	{ "glDrawPixels", (GLADlazyproc*)&glad_glDrawPixels, (GLADlazyproc)glad_lazy_glDrawPixels },
+	{ "glDrawRangeElements", (GLADlazyproc*)&glad_glDrawRangeElements, (GLADlazyproc)glad_lazy_glDrawRangeElements },
+	{ "glDrawRangeElementsBaseVertex", (GLADlazyproc*)&glad_glDrawRangeElementsBaseVertex, (GLADlazyproc)glad_lazy_glDrawRangeElementsBaseVertex },
+	{ "glDrawTransformFeedback", (GLADlazyproc*)&glad_glDrawTransformFeedback, (GLADlazyproc)glad_lazy_glDrawTransformFeedback },
+	{ "glDrawTransformFeedbackInstanced", (GLADlazyproc*)&glad_glDrawTransformFeedbackInstanced, (GLADlazyproc)glad_lazy_glDrawTransformFeedbackInstanced },
+	{ "glDrawTransformFeedbackStream", (GLADlazyproc*)&glad_glDrawTransformFeedbackStream, (GLADlazyproc)glad_lazy_glDrawTransformFeedbackStream },
+	{ "glDrawTransformFeedbackStreamInstanced", (GLADlazyproc*)&glad_glDrawTransformFeedbackStreamInstanced, (GLADlazyproc)glad_lazy_glDrawTransformFeedbackStreamInstanced },
+	{ "glEdgeFlag", (GLADlazyproc*)&glad_glEdgeFlag, (GLADlazyproc)glad_lazy_glEdgeFlag },
+	{ "glEdgeFlagPointer", (GLADlazyproc*)&glad_glEdgeFlagPointer, (GLADlazyproc)glad_lazy_glEdgeFlagPointer },
+	{ "glEdgeFlagv", (GLADlazyproc*)&glad_glEdgeFlagv, (GLADlazyproc)glad_lazy_glEdgeFlagv },
+	{ "glEnable", (GLADlazyproc*)&glad_glEnable, (GLADlazyproc)glad_lazy_glEnable },
+	{ "glEnableClientState", (GLADlazyproc*)&glad_glEnableClientState, (GLADlazyproc)glad_lazy_glEnableClientState },
+	{ "glEnableVertexAttribArray", (GLADlazyproc*)&glad_glEnableVertexAttribArray, (GLADlazyproc)glad_lazy_glEnableVertexAttribArray },
+	{ "glEnablei", (GLADlazyproc*)&glad_glEnablei, (GLADlazyproc)glad_lazy_glEnablei },
+	{ "glEnd", (GLADlazyproc*)&glad_glEnd, (GLADlazyproc)glad_lazy_glEnd },
+	{ "glEndConditionalRender", (GLADlazyproc*)&glad_glEndConditionalRender, (GLADlazyproc)glad_lazy_glEndConditionalRender },
+	{ "glEndList", (GLADlazyproc*)&glad_glEndList, (GLADlazyproc)glad_lazy_glEndList },
+	{ "glEndQuery", (GLADlazyproc*)&glad_glEndQuery, (GLADlazyproc)glad_lazy_glEndQuery },
+	{ "glEndQueryIndexed", (GLADlazyproc*)&glad_glEndQueryIndexed, (GLADlazyproc)glad_lazy_glEndQueryIndexed },
+	{ "glEndTransformFeedback", (GLADlazyproc*)&glad_glEndTransformFeedback, (GLADlazyproc)glad_lazy_glEndTransformFeedback },
+	{ "glEvalCoord1d", (GLADlazyproc*)&glad_glEvalCoord1d, (GLADlazyproc)glad_lazy_glEvalCoord1d },
+	{ "glEvalCoord1dv", (GLADlazyproc*)&glad_glEvalCoord1dv, (GLADlazyproc)glad_lazy_glEvalCoord1dv },
+	{ "glEvalCoord1f", (GLADlazyproc*)&glad_glEvalCoord1f, (GLADlazyproc)glad_lazy_glEvalCoord1f },
+	{ "glEvalCoord1fv", (GLADlazyproc*)&glad_glEvalCoord1fv, (GLADlazyproc)glad_lazy_glEvalCoord1fv },
+	{ "glEvalCoord2d", (GLADlazyproc*)&glad_glEvalCoord2d, (GLADlazyproc)glad_lazy_glEvalCoord2d },
+	{ "glEvalCoord2dv", (GLADlazyproc*)&glad_glEvalCoord2dv, (GLADlazyproc)glad_lazy_glEvalCoord2dv },
+	{ "glEvalCoord2f", (GLADlazyproc*)&glad_glEvalCoord2f, (GLADlazyproc)glad_lazy_glEvalCoord2f },
+	{ "glEvalCoord2fv", (GLADlazyproc*)&glad_glEvalCoord2fv, (GLADlazyproc)glad_lazy_glEvalCoord2fv },
+	{ "glEvalMesh1", (GLADlazyproc*)&glad_glEvalMesh1, (GLADlazyproc)glad_lazy_glEvalMesh1 },
+	{ "glEvalMesh2", (GLADlazyproc*)&glad_glEvalMesh2, (GLADlazyproc)glad_lazy_glEvalMesh2 },
+	{ "glEvalPoint1", (GLADlazyproc*)&glad_glEvalPoint1, (GLADlazyproc)glad_lazy_glEvalPoint1 },
+	{ "glEvalPoint2", (GLADlazyproc*)&glad_glEvalPoint2, (GLADlazyproc)glad_lazy_glEvalPoint2 },
+	{ "glFeedbackBuffer", (GLADlazyproc*)&glad_glFeedbackBuffer, (GLADlazyproc)glad_lazy_glFeedbackBuffer },
+	{ "glFenceSync", (GLADlazyproc*)&glad_glFenceSync, (GLADlazyproc)glad_lazy_glFenceSync },
+	{ "glFinish", (GLADlazyproc*)&glad_glFinish, (GLADlazyproc)glad_lazy_glFinish },
+	{ "glFlush", (GLADlazyproc*)&glad_glFlush, (GLADlazyproc)glad_lazy_glFlush },
+	{ "glFlushMappedBufferRange", (GLADlazyproc*)&glad_glFlushMappedBufferRange, (GLADlazyproc)glad_lazy_glFlushMappedBufferRange },
+	{ "glFogCoordPointer", (GLADlazyproc*)&glad_glFogCoordPointer, (GLADlazyproc)glad_lazy_glFogCoordPointer },
+	{ "glFogCoordd", (GLADlazyproc*)&glad_glFogCoordd, (GLADlazyproc)glad_lazy_glFogCoordd },
+	{ "glFogCoorddv", (GLADlazyproc*)&glad_glFogCoorddv, (GLADlazyproc)glad_lazy_glFogCoorddv },
+	{ "glFogCoordf", (GLADlazyproc*)&glad_glFogCoordf, (GLADlazyproc)glad_lazy_glFogCoordf },
+	{ "glFogCoordfv", (GLADlazyproc*)&glad_glFogCoordfv, (GLADlazyproc)glad_lazy_glFogCoordfv },
+	{ "glFogf", (GLADlazyproc*)&glad_glFogf, (GLADlazyproc)glad_lazy_glFogf },
+	{ "glFogfv", (GLADlazyproc*)&glad_glFogfv, (GLADlazyproc)glad_lazy_glFogfv },
+	{ "glFogi", (GLADlazyproc*)&glad_glFogi, (GLADlazyproc)glad_lazy_glFogi },
+	{ "glFogiv", (GLADlazyproc*)&glad_glFogiv, (GLADlazyproc)glad_lazy_glFogiv },
+	{ "glFramebufferParameteri", (GLADlazyproc*)&glad_glFramebufferParameteri, (GLADlazyproc)glad_lazy_glFramebufferParameteri },
+	{ "glFramebufferRenderbuffer", (GLADlazyproc*)&glad_glFramebufferRenderbuffer, (GLADlazyproc)glad_lazy_glFramebufferRenderbuffer },
+	{ "glFramebufferTexture", (GLADlazyproc*)&glad_glFramebufferTexture, (GLADlazyproc)glad_lazy_glFramebufferTexture },
+	{ "glFramebufferTexture1D", (GLADlazyproc*)&glad_glFramebufferTexture1D, (GLADlazyproc)glad_lazy_glFramebufferTexture1D },
+	{ "glFramebufferTexture2D", (GLADlazyproc*)&glad_glFramebufferTexture2D, (GLADlazyproc)glad_lazy_glFramebufferTexture2D },
+	{ "glFramebufferTexture3D", (GLADlazyproc*)&glad_glFramebufferTexture3D, (GLADlazyproc)glad_lazy_glFramebufferTexture3D },
+	{ "glFramebufferTextureLayer", (GLADlazyproc*)&glad_glFramebufferTextureLayer, (GLADlazyproc)glad_lazy_glFramebufferTextureLayer },
+	{ "glFrontFace", (GLADlazyproc*)&glad_glFrontFace, (GLADlazyproc)glad_lazy_glFrontFace },
+	{ "glFrustum", (GLADlazyproc*)&glad_glFrustum, (GLADlazyproc)glad_lazy_glFrustum },
+	{ "glGenBuffers", (GLADlazyproc*)&glad_glGenBuffers, (GLADlazyproc)glad_lazy_glGenBuffers },
+	{ "glGenFramebuffers", (GLADlazyproc*)&glad_glGenFramebuffers, (GLADlazyproc)glad_lazy_glGenFramebuffers },
+	{ "glGenLists", (GLADlazyproc*)&glad_glGenLists, (GLADlazyproc)glad_lazy_glGenLists },
+	{ "glGenProgramPipelines", (GLADlazyproc*)&glad_glGenProgramPipelines, (GLADlazyproc)glad_lazy_glGenProgramPipelines },
+	{ "glGenQueries", (GLADlazyproc*)&glad_glGenQueries, (GLADlazyproc)glad_lazy_glGenQueries },
+	{ "glGenRenderbuffers", (GLADlazyproc*)&glad_glGenRenderbuffers, (GLADlazyproc)glad_lazy_glGenRenderbuffers },
+	{ "glGenSamplers", (GLADlazyproc*)&glad_glGenSamplers, (GLADlazyproc)glad_lazy_glGenSamplers },
+	{ "glGenTextures", (GLADlazyproc*)&glad_glGenTextures, (GLADlazyproc)glad_lazy_glGenTextures },
+	{ "glGenTransformFeedbacks", (GLADlazyproc*)&glad_glGenTransformFeedbacks, (GLADlazyproc)glad_lazy_glGenTransformFeedbacks },
+	{ "glGenVertexArrays", (GLADlazyproc*)&glad_glGenVertexArrays, (GLADlazyproc)glad_lazy_glGenVertexArrays },
+	{ "glGenerateMipmap", (GLADlazyproc*)&glad_glGenerateMipmap, (GLADlazyproc)glad_lazy_glGenerateMipmap },
+	{ "glGetActiveAtomicCounterBufferiv", (GLADlazyproc*)&glad_glGetActiveAtomicCounterBufferiv, (GLADlazyproc)glad_lazy_glGetActiveAtomicCounterBufferiv },
+	{ "glGetActiveAttrib", (GLADlazyproc*)&glad_glGetActiveAttrib, (GLADlazyproc)glad_lazy_glGetActiveAttrib },
+	{ "glGetActiveSubroutineName", (GLADlazyproc*)&glad_glGetActiveSubroutineName, (GLADlazyproc)glad_lazy_glGetActiveSubroutineName },
+	{ "glGetActiveSubroutineUniformName", (GLADlazyproc*)&glad_glGetActiveSubroutineUniformName, (GLADlazyproc)glad_lazy_glGetActiveSubroutineUniformName },
+	{ "glGetActiveSubroutineUniformiv", (GLADlazyproc*)&glad_glGetActiveSubroutineUniformiv, (GLADlazyproc)glad_lazy_glGetActiveSubroutineUniformiv },
+	{ "glGetActiveUniform", (GLADlazyproc*)&glad_glGetActiveUniform, (GLADlazyproc)glad_lazy_glGetActiveUniform },
+	{ "glGetActiveUniformBlockName", (GLADlazyproc*)&glad_glGetActiveUniformBlockName, (GLADlazyproc)glad_lazy_glGetActiveUniformBlockName },
+	{ "glGetActiveUniformBlockiv", (GLADlazyproc*)&glad_glGetActiveUniformBlockiv, (GLADlazyproc)glad_lazy_glGetActiveUniformBlockiv },
+	{ "glGetActiveUniformName", (GLADlazyproc*)&glad_glGetActiveUniformName, (GLADlazyproc)glad_lazy_glGetActiveUniformName },
+	{ "glGetActiveUniformsiv", (GLADlazyproc*)&glad_glGetActiveUniformsiv, (GLADlazyproc)glad_lazy_glGetActiveUniformsiv },
+	{ "glGetAttachedShaders", (GLADlazyproc*)&glad_glGetAttachedShaders, (GLADlazyproc)glad_lazy_glGetAttachedShaders },
+	{ "glGetAttribLocation", (GLADlazyproc*)&glad_glGetAttribLocation, (GLADlazyproc)glad_lazy_glGetAttribLocation },
+	{ "glGetBooleani_v", (GLADlazyproc*)&glad_glGetBooleani_v, (GLADlazyproc)glad_lazy_glGetBooleani_v },
+	{ "glGetBooleanv", (GLADlazyproc*)&glad_glGetBooleanv, (GLADlazyproc)glad_lazy_glGetBooleanv },
+	{ "glGetBufferParameteri64v", (GLADlazyproc*)&glad_glGetBufferParameteri64v, (GLADlazyproc)glad_lazy_glGetBufferParameteri64v },
+	{ "glGetBufferParameteriv", (GLADlazyproc*)&glad_glGetBufferParameteriv, (GLADlazyproc)glad_lazy_glGetBufferParameteriv },
+	{ "glGetBufferPointerv", (GLADlazyproc*)&glad_glGetBufferPointerv, (GLADlazyproc)glad_lazy_glGetBufferPointerv },
+	{ "glGetBufferSubData", (GLADlazyproc*)&glad_glGetBufferSubData, (GLADlazyproc)glad_lazy_glGetBufferSubData },
+	{ "glGetClipPlane", (GLADlazyproc*)&glad_glGetClipPlane, (GLADlazyproc)glad_lazy_glGetClipPlane },
+	{ "glGetCompressedTexImage", (GLADlazyproc*)&glad_glGetCompressedTexImage, (GLADlazyproc)glad_lazy_glGetCompressedTexImage },
+	{ "glGetDebugMessageLog", (GLADlazyproc*)&glad_glGetDebugMessageLog, (GLADlazyproc)glad_lazy_glGetDebugMessageLog },
+	{ "glGetDoublei_v", (GLADlazyproc*)&glad_glGetDoublei_v, (GLADlazyproc)glad_lazy_glGetDoublei_v },
+	{ "glGetDoublev", (GLADlazyproc*)&glad_glGetDoublev, (GLADlazyproc)glad_lazy_glGetDoublev },
+	{ "glGetError", (GLADlazyproc*)&glad_glGetError, (GLADlazyproc)glad_lazy_glGetError },
+	{ "glGetFloati_v", (GLADlazyproc*)&glad_glGetFloati_v, (GLADlazyproc)glad_lazy_glGetFloati_v },
+	{ "glGetFloatv", (GLADlazyproc*)&glad_glGetFloatv, (GLADlazyproc)glad_lazy_glGetFloatv },
+	{ "glGetFragDataIndex", (GLADlazyproc*)&glad_glGetFragDataIndex, (GLADlazyproc)glad_lazy_glGetFragDataIndex },
+	{ "glGetFragDataLocation", (GLADlazyproc*)&glad_glGetFragDataLocation, (GLADlazyproc)glad_lazy_glGetFragDataLocation },
+	{ "glGetFramebufferAttachmentParameteriv", (GLADlazyproc*)&glad_glGetFramebufferAttachmentParameteriv, (GLADlazyproc)glad_lazy_glGetFramebufferAttachmentParameteriv },
+	{ "glGetFramebufferParameteriv", (GLADlazyproc*)&glad_glGetFramebufferParameteriv, (GLADlazyproc)glad_lazy_glGetFramebufferParameteriv },
+	{ "glGetInteger64i_v", (GLADlazyproc*)&glad_glGetInteger64i_v, (GLADlazyproc)glad_lazy_glGetInteger64i_v },
+	{ "glGetInteger64v", (GLADlazyproc*)&glad_glGetInteger64v, (GLADlazyproc)glad_lazy_glGetInteger64v },
+	{ "glGetIntegeri_v", (GLADlazyproc*)&glad_glGetIntegeri_v, (GLADlazyproc)glad_lazy_glGetIntegeri_v },
+	{ "glGetIntegerv", (GLADlazyproc*)&glad_glGetIntegerv, (GLADlazyproc)glad_lazy_glGetIntegerv },
+	{ "glGetInternalformati64v", (GLADlazyproc*)&glad_glGetInternalformati64v, (GLADlazyproc)glad_lazy_glGetInternalformati64v },
+	{ "glGetInternalformativ", (GLADlazyproc*)&glad_glGetInternalformativ, (GLADlazyproc)glad_lazy_glGetInternalformativ },
+	{ "glGetLightfv", (GLADlazyproc*)&glad_glGetLightfv, (GLADlazyproc)glad_lazy_glGetLightfv },
+	{ "glGetLightiv", (GLADlazyproc*)&glad_glGetLightiv, (GLADlazyproc)glad_lazy_glGetLightiv },
+	{ "glGetMapdv", (GLADlazyproc*)&glad_glGetMapdv, (GLADlazyproc)glad_lazy_glGetMapdv },
+	{ "glGetMapfv", (GLADlazyproc*)&glad_glGetMapfv, (GLADlazyproc)glad_lazy_glGetMapfv },
+	{ "glGetMapiv", (GLADlazyproc*)&glad_glGetMapiv, (GLADlazyproc)glad_lazy_glGetMapiv },
+	{ "glGetMaterialfv", (GLADlazyproc*)&glad_glGetMaterialfv, (GLADlazyproc)glad_lazy_glGetMaterialfv },
+	{ "glGetMaterialiv", (GLADlazyproc*)&glad_glGetMaterialiv, (GLADlazyproc)glad_lazy_glGetMaterialiv },
+	{ "glGetMultisamplefv", (GLADlazyproc*)&glad_glGetMultisamplefv, (GLADlazyproc)glad_lazy_glGetMultisamplefv },
+	{ "glGetObjectLabel", (GLADlazyproc*)&glad_glGetObjectLabel, (GLADlazyproc)glad_lazy_glGetObjectLabel },
+	{ "glGetObjectPtrLabel", (GLADlazyproc*)&glad_glGetObjectPtrLabel, (GLADlazyproc)glad_lazy_glGetObjectPtrLabel },
+	{ "glGetPixelMapfv", (GLADlazyproc*)&glad_glGetPixelMapfv, (GLADlazyproc)glad_lazy_glGetPixelMapfv },
+	{ "glGetPixelMapuiv", (GLADlazyproc*)&glad_glGetPixelMapuiv, (GLADlazyproc)glad_lazy_glGetPixelMapuiv },
+	{ "glGetPixelMapusv", (GLADlazyproc*)&glad_glGetPixelMapusv, (GLADlazyproc)glad_lazy_glGetPixelMapusv },
+	{ "glGetPointerv", (GLADlazyproc*)&glad_glGetPointerv, (GLADlazyproc)glad_lazy_glGetPointerv },
+	{ "glGetPolygonStipple", (GLADlazyproc*)&glad_glGetPolygonStipple, (GLADlazyproc)glad_lazy_glGetPolygonStipple },
+	{ "glGetProgramBinary", (GLADlazyproc*)&glad_glGetProgramBinary, (GLADlazyproc)glad_lazy_glGetProgramBinary },
+	{ "glGetProgramInfoLog", (GLADlazyproc*)&glad_glGetProgramInfoLog, (GLADlazyproc)glad_lazy_glGetProgramInfoLog },
+	{ "glGetProgramInterfaceiv", (GLADlazyproc*)&glad_glGetProgramInterfaceiv, (GLADlazyproc)glad_lazy_glGetProgramInterfaceiv },
+	{ "glGetProgramPipelineInfoLog", (GLADlazyproc*)&glad_glGetProgramPipelineInfoLog, (GLADlazyproc)glad_lazy_glGetProgramPipelineInfoLog },
+	{ "glGetProgramPipelineiv", (GLADlazyproc*)&glad_glGetProgramPipelineiv, (GLADlazyproc)glad_lazy_glGetProgramPipelineiv },
+	{ "glGetProgramResourceIndex", (GLADlazyproc*)&glad_glGetProgramResourceIndex, (GLADlazyproc)glad_lazy_glGetProgramResourceIndex },
+	{ "glGetProgramResourceLocation", (GLADlazyproc*)&glad_glGetProgramResourceLocation, (GLADlazyproc)glad_lazy_glGetProgramResourceLocation },
+	{ "glGetProgramResourceLocationIndex", (GLADlazyproc*)&glad_glGetProgramResourceLocationIndex, (GLADlazyproc)glad_lazy_glGetProgramResourceLocationIndex },
+	{ "glGetProgramResourceName", (GLADlazyproc*)&glad_glGetProgramResourceName, (GLADlazyproc)glad_lazy_glGetProgramResourceName },
+	{ "glGetProgramResourceiv", (GLADlazyproc*)&glad_glGetProgramResourceiv, (GLADlazyproc)glad_lazy_glGetProgramResourceiv },
+	{ "glGetProgramStageiv", (GLADlazyproc*)&glad_glGetProgramStageiv, (GLADlazyproc)glad_lazy_glGetProgramStageiv },
+	{ "glGetProgramiv", (GLADlazyproc*)&glad_glGetProgramiv, (GLADlazyproc)glad_lazy_glGetProgramiv },
+	{ "glGetQueryIndexediv", (GLADlazyproc*)&glad_glGetQueryIndexediv, (GLADlazyproc)glad_lazy_glGetQueryIndexediv },
+	{ "glGetQueryObjecti64v", (GLADlazyproc*)&glad_glGetQueryObjecti64v, (GLADlazyproc)glad_lazy_glGetQueryObjecti64v },
+	{ "glGetQueryObjectiv", (GLADlazyproc*)&glad_glGetQueryObjectiv, (GLADlazyproc)glad_lazy_glGetQueryObjectiv },
+	{ "glGetQueryObjectui64v", (GLADlazyproc*)&glad_glGetQueryObjectui64v, (GLADlazyproc)glad_lazy_glGetQueryObjectui64v },
+	{ "glGetQueryObjectuiv", (GLADlazyproc*)&glad_glGetQueryObjectuiv, (GLADlazyproc)glad_lazy_glGetQueryObjectuiv },
+	{ "glGetQueryiv", (GLADlazyproc*)&glad_glGetQueryiv, (GLADlazyproc)glad_lazy_glGetQueryiv },
+	{ "glGetRenderbufferParameteriv", (GLADlazyproc*)&glad_glGetRenderbufferParameteriv, (GLADlazyproc)glad_lazy_glGetRenderbufferParameteriv },
+	{ "glGetSamplerParameterIiv", (GLADlazyproc*)&glad_glGetSamplerParameterIiv, (GLADlazyproc)glad_lazy_glGetSamplerParameterIiv },
+	{ "glGetSamplerParameterIuiv", (GLADlazyproc*)&glad_glGetSamplerParameterIuiv, (GLADlazyproc)glad_lazy_glGetSamplerParameterIuiv },
+	{ "glGetSamplerParameterfv", (GLADlazyproc*)&glad_glGetSamplerParameterfv, (GLADlazyproc)glad_lazy_glGetSamplerParameterfv },
+	{ "glGetSamplerParameteriv", (GLADlazyproc*)&glad_glGetSamplerParameteriv, (GLADlazyproc)glad_lazy_glGetSamplerParameteriv },
+	{ "glGetShaderInfoLog", (GLADlazyproc*)&glad_glGetShaderInfoLog, (GLADlazyproc)glad_lazy_glGetShaderInfoLog },
+	{ "glGetShaderPrecisionFormat", (GLADlazyproc*)&glad_glGetShaderPrecisionFormat, (GLADlazyproc)glad_lazy_glGetShaderPrecisionFormat },
+	{ "glGetShaderSource", (GLADlazyproc*)&glad_glGetShaderSource, (GLADlazyproc)glad_lazy_glGetShaderSource },
+	{ "glGetShaderiv", (GLADlazyproc*)&glad_glGetShaderiv, (GLADlazyproc)glad_lazy_glGetShaderiv },
+	{ "glGetString", (GLADlazyproc*)&glad_glGetString, (GLADlazyproc)glad_lazy_glGetString },
+	{ "glGetStringi", (GLADlazyproc*)&glad_glGetStringi, (GLADlazyproc)glad_lazy_glGetStringi },
+	{ "glGetSubroutineIndex", (GLADlazyproc*)&glad_glGetSubroutineIndex, (GLADlazyproc)glad_lazy_glGetSubroutineIndex },
+	{ "glGetSubroutineUniformLocation", (GLADlazyproc*)&glad_glGetSubroutineUniformLocation, (GLADlazyproc)glad_lazy_glGetSubroutineUniformLocation },
+	{ "glGetSynciv", (GLADlazyproc*)&glad_glGetSynciv, (GLADlazyproc)glad_lazy_glGetSynciv },
+	{ "glGetTexEnvfv", (GLADlazyproc*)&glad_glGetTexEnvfv, (GLADlazyproc)glad_lazy_glGetTexEnvfv },
+	{ "glGetTexEnviv", (GLADlazyproc*)&glad_glGetTexEnviv, (GLADlazyproc)glad_lazy_glGetTexEnviv },
+	{ "glGetTexGendv", (GLADlazyproc*)&glad_glGetTexGendv, (GLADlazyproc)glad_lazy_glGetTexGendv },
+	{ "glGetTexGenfv", (GLADlazyproc*)&glad_glGetTexGenfv, (GLADlazyproc)glad_lazy_glGetTexGenfv },
+	{ "glGetTexGeniv", (GLADlazyproc*)&glad_glGetTexGeniv, (GLADlazyproc)glad_lazy_glGetTexGeniv },
+	{ "glGetTexImage", (GLADlazyproc*)&glad_glGetTexImage, (GLADlazyproc)glad_lazy_glGetTexImage },
+	{ "glGetTexLevelParameterfv", (GLADlazyproc*)&glad_glGetTexLevelParameterfv, (GLADlazyproc)glad_lazy_glGetTexLevelParameterfv },
+	{ "glGetTexLevelParameteriv", (GLADlazyproc*)&glad_glGetTexLevelParameteriv, (GLADlazyproc)glad_lazy_glGetTexLevelParameteriv },
+	{ "glGetTexParameterIiv", (GLADlazyproc*)&glad_glGetTexParameterIiv, (GLADlazyproc)glad_lazy_glGetTexParameterIiv },
+	{ "glGetTexParameterIuiv", (GLADlazyproc*)&glad_glGetTexParameterIuiv, (GLADlazyproc)glad_lazy_glGetTexParameterIuiv },
+	{ "glGetTexParameterfv", (GLADlazyproc*)&glad_glGetTexParameterfv, (GLADlazyproc)glad_lazy_glGetTexParameterfv },
+	{ "glGetTexParameteriv", (GLADlazyproc*)&glad_glGetTexParameteriv, (GLADlazyproc)glad_lazy_glGetTexParameteriv },
+	{ "glGetTransformFeedbackVarying", (GLADlazyproc*)&glad_glGetTransformFeedbackVarying, (GLADlazyproc)glad_lazy_glGetTransformFeedbackVarying },
+	{ "glGetUniformBlockIndex", (GLADlazyproc*)&glad_glGetUniformBlockIndex, (GLADlazyproc)glad_lazy_glGetUniformBlockIndex },
+	{ "glGetUniformIndices", (GLADlazyproc*)&glad_glGetUniformIndices, (GLADlazyproc)glad_lazy_glGetUniformIndices },
+	{ "glGetUniformLocation", (GLADlazyproc*)&glad_glGetUniformLocation, (GLADlazyproc)glad_lazy_glGetUniformLocation },
+	{ "glGetUniformSubroutineuiv", (GLADlazyproc*)&glad_glGetUniformSubroutineuiv, (GLADlazyproc)glad_lazy_glGetUniformSubroutineuiv },
+	{ "glGetUniformdv", (GLADlazyproc*)&glad_glGetUniformdv, (GLADlazyproc)glad_lazy_glGetUniformdv },
+	{ "glGetUniformfv", (GLADlazyproc*)&glad_glGetUniformfv, (GLADlazyproc)glad_lazy_glGetUniformfv },
+	{ "glGetUniformiv", (GLADlazyproc*)&glad_glGetUniformiv, (GLADlazyproc)glad_lazy_glGetUniformiv },
+	{ "glGetUniformuiv", (GLADlazyproc*)&glad_glGetUniformuiv, (GLADlazyproc)glad_lazy_glGetUniformuiv },
+	{ "glGetVertexAttribIiv", (GLADlazyproc*)&glad_glGetVertexAttribIiv, (GLADlazyproc)glad_lazy_glGetVertexAttribIiv },
+	{ "glGetVertexAttribIuiv", (GLADlazyproc*)&glad_glGetVertexAttribIuiv, (GLADlazyproc)glad_lazy_glGetVertexAttribIuiv },
+	{ "glGetVertexAttribLdv", (GLADlazyproc*)&glad_glGetVertexAttribLdv, (GLADlazyproc)glad_lazy_glGetVertexAttribLdv },
+	{ "glGetVertexAttribPointerv", (GLADlazyproc*)&glad_glGetVertexAttribPointerv, (GLADlazyproc)glad_lazy_glGetVertexAttribPointerv },
+	{ "glGetVertexAttribdv", (GLADlazyproc*)&glad_glGetVertexAttribdv, (GLADlazyproc)glad_lazy_glGetVertexAttribdv },
+	{ "glGetVertexAttribfv", (GLADlazyproc*)&glad_glGetVertexAttribfv, (GLADlazyproc)glad_lazy_glGetVertexAttribfv },
+	{ "glGetVertexAttribiv", (GLADlazyproc*)&glad_glGetVertexAttribiv, (GLADlazyproc)glad_lazy_glGetVertexAttribiv },
+	{ "glHint", (GLADlazyproc*)&glad_glHint, (GLADlazyproc)glad_lazy_glHint },
+	{ "glIndexMask", (GLADlazyproc*)&glad_glIndexMask, (GLADlazyproc)glad_lazy_glIndexMask },
+	{ "glIndexPointer", (GLADlazyproc*)&glad_glIndexPointer, (GLADlazyproc)glad_lazy_glIndexPointer },
+	{ "glIndexd", (GLADlazyproc*)&glad_glIndexd, (GLADlazyproc)glad_lazy_glIndexd },
+	{ "glIndexdv", (GLADlazyproc*)&glad_glIndexdv, (GLADlazyproc)glad_lazy_glIndexdv },
+	{ "glIndexf", (GLADlazyproc*)&glad_glIndexf, (GLADlazyproc)glad_lazy_glIndexf },
+	{ "glIndexfv", (GLADlazyproc*)&glad_glIndexfv, (GLADlazyproc)glad_lazy_glIndexfv },
+	{ "glIndexi", (GLADlazyproc*)&glad_glIndexi, (GLADlazyproc)glad_lazy_glIndexi },
+	{ "glIndexiv", (GLADlazyproc*)&glad_glIndexiv, (GLADlazyproc)glad_lazy_glIndexiv },
+	{ "glIndexs", (GLADlazyproc*)&glad_glIndexs, (GLADlazyproc)glad_lazy_glIndexs },
+	{ "glIndexsv", (GLADlazyproc*)&glad_glIndexsv, (GLADlazyproc)glad_lazy_glIndexsv },
+	{ "glIndexub", (GLADlazyproc*)&glad_glIndexub, (GLADlazyproc)glad_lazy_glIndexub },
+	{ "glIndexubv", (GLADlazyproc*)&glad_glIndexubv, (GLADlazyproc)glad_lazy_glIndexubv },
+	{ "glInitNames", (GLADlazyproc*)&glad_glInitNames, (GLADlazyproc)glad_lazy_glInitNames },
+	{ "glInterleavedArrays", (GLADlazyproc*)&glad_glInterleavedArrays, (GLADlazyproc)glad_lazy_glInterleavedArrays },
+	{ "glInvalidateBufferData", (GLADlazyproc*)&glad_glInvalidateBufferData, (GLADlazyproc)glad_lazy_glInvalidateBufferData },
+	{ "glInvalidateBufferSubData", (GLADlazyproc*)&glad_glInvalidateBufferSubData, (GLADlazyproc)glad_lazy_glInvalidateBufferSubData },
+	{ "glInvalidateFramebuffer", (GLADlazyproc*)&glad_glInvalidateFramebuffer, (GLADlazyproc)glad_lazy_glInvalidateFramebuffer },
+	{ "glInvalidateSubFramebuffer", (GLADlazyproc*)&glad_glInvalidateSubFramebuffer, (GLADlazyproc)glad_lazy_glInvalidateSubFramebuffer },
+	{ "glInvalidateTexImage", (GLADlazyproc*)&glad_glInvalidateTexImage, (GLADlazyproc)glad_lazy_glInvalidateTexImage },
+	{ "glInvalidateTexSubImage", (GLADlazyproc*)&glad_glInvalidateTexSubImage, (GLADlazyproc)glad_lazy_glInvalidateTexSubImage },
+	{ "glIsBuffer", (GLADlazyproc*)&glad_glIsBuffer, (GLADlazyproc)glad_lazy_glIsBuffer },
+	{ "glIsEnabled", (GLADlazyproc*)&glad_glIsEnabled, (GLADlazyproc)glad_lazy_glIsEnabled },
+	{ "glIsEnabledi", (GLADlazyproc*)&glad_glIsEnabledi, (GLADlazyproc)glad_lazy_glIsEnabledi },
+	{ "glIsFramebuffer", (GLADlazyproc*)&glad_glIsFramebuffer, (GLADlazyproc)glad_lazy_glIsFramebuffer },
+	{ "glIsList", (GLADlazyproc*)&glad_glIsList, (GLADlazyproc)glad_lazy_glIsList },
+	{ "glIsProgram", (GLADlazyproc*)&glad_glIsProgram, (GLADlazyproc)glad_lazy_glIsProgram },
+	{ "glIsProgramPipeline", (GLADlazyproc*)&glad_glIsProgramPipeline, (GLADlazyproc)glad_lazy_glIsProgramPipeline },
+	{ "glIsQuery", (GLADlazyproc*)&glad_glIsQuery, (GLADlazyproc)glad_lazy_glIsQuery },
+	{ "glIsRenderbuffer", (GLADlazyproc*)&glad_glIsRenderbuffer, (GLADlazyproc)glad_lazy_glIsRenderbuffer },
+	{ "glIsSampler", (GLADlazyproc*)&glad_glIsSampler, (GLADlazyproc)glad_lazy_glIsSampler },
+	{ "glIsShader", (GLADlazyproc*)&glad_glIsShader, (GLADlazyproc)glad_lazy_glIsShader },
+	{ "glIsSync", (GLADlazyproc*)&glad_glIsSync, (GLADlazyproc)glad_lazy_glIsSync },
+	{ "glIsTexture", (GLADlazyproc*)&glad_glIsTexture, (GLADlazyproc)glad_lazy_glIsTexture },
+	{ "glIsTransformFeedback", (GLADlazyproc*)&glad_glIsTransformFeedback, (GLADlazyproc)glad_lazy_glIsTransformFeedback },
+	{ "glIsVertexArray", (GLADlazyproc*)&glad_glIsVertexArray, (GLADlazyproc)glad_lazy_glIsVertexArray },
+	{ "glLightModelf", (GLADlazyproc*)&glad_glLightModelf, (GLADlazyproc)glad_lazy_glLightModelf },
+	{ "glLightModelfv", (GLADlazyproc*)&glad_glLightModelfv, (GLADlazyproc)glad_lazy_glLightModelfv },
+	{ "glLightModeli", (GLADlazyproc*)&glad_glLightModeli, (GLADlazyproc)glad_lazy_glLightModeli },
+	{ "glLightModeliv", (GLADlazyproc*)&glad_glLightModeliv, (GLADlazyproc)glad_lazy_glLightModeliv },
+	{ "glLightf", (GLADlazyproc*)&glad_glLightf, (GLADlazyproc)glad_lazy_glLightf },
+	{ "glLightfv", (GLADlazyproc*)&glad_glLightfv, (GLADlazyproc)glad_lazy_glLightfv },
+	{ "glLighti", (GLADlazyproc*)&glad_glLighti, (GLADlazyproc)glad_lazy_glLighti },
+	{ "glLightiv", (GLADlazyproc*)&glad_glLightiv, (GLADlazyproc)glad_lazy_glLightiv },
+	{ "glLineStipple", (GLADlazyproc*)&glad_glLineStipple, (GLADlazyproc)glad_lazy_glLineStipple },
+	{ "glLineWidth", (GLADlazyproc*)&glad_glLineWidth, (GLADlazyproc)glad_lazy_glLineWidth },
+	{ "glLinkProgram", (GLADlazyproc*)&glad_glLinkProgram, (GLADlazyproc)glad_lazy_glLinkProgram },
+	{ "glListBase", (GLADlazyproc*)&glad_glListBase, (GLADlazyproc)glad_lazy_glListBase },
+	{ "glLoadIdentity", (GLADlazyproc*)&glad_glLoadIdentity, (GLADlazyproc)glad_lazy_glLoadIdentity },
+	{ "glLoadMatrixd", (GLADlazyproc*)&glad_glLoadMatrixd, (GLADlazyproc)glad_lazy_glLoadMatrixd },
+	{ "glLoadMatrixf", (GLADlazyproc*)&glad_glLoadMatrixf, (GLADlazyproc)glad_lazy_glLoadMatrixf },
+	{ "glLoadName", (GLADlazyproc*)&glad_glLoadName, (GLADlazyproc)glad_lazy_glLoadName },
+	{ "glLoadTransposeMatrixd", (GLADlazyproc*)&glad_glLoadTransposeMatrixd, (GLADlazyproc)glad_lazy_glLoadTransposeMatrixd },
+	{ "glLoadTransposeMatrixf", (GLADlazyproc*)&glad_glLoadTransposeMatrixf, (GLADlazyproc)glad_lazy_glLoadTransposeMatrixf },
+	{ "glLogicOp", (GLADlazyproc*)&glad_glLogicOp, (GLADlazyproc)glad_lazy_glLogicOp },
+	{ "glMap1d", (GLADlazyproc*)&glad_glMap1d, (GLADlazyproc)glad_lazy_glMap1d },
+	{ "glMap1f", (GLADlazyproc*)&glad_glMap1f, (GLADlazyproc)glad_lazy_glMap1f },
+	{ "glMap2d", (GLADlazyproc*)&glad_glMap2d, (GLADlazyproc)glad_lazy_glMap2d },
+	{ "glMap2f", (GLADlazyproc*)&glad_glMap2f, (GLADlazyproc)glad_lazy_glMap2f },
+	{ "glMapBuffer", (GLADlazyproc*)&glad_glMapBuffer, (GLADlazyproc)glad_lazy_glMapBuffer },
+	{ "glMapBufferRange", (GLADlazyproc*)&glad_glMapBufferRange, (GLADlazyproc)glad_lazy_glMapBufferRange },
+	{ "glMapGrid1d", (GLADlazyproc*)&glad_glMapGrid1d, (GLADlazyproc)glad_lazy_glMapGrid1d },
+	{ "glMapGrid1f", (GLADlazyproc*)&glad_glMapGrid1f, (GLADlazyproc)glad_lazy_glMapGrid1f },
+	{ "glMapGrid2d", (GLADlazyproc*)&glad_glMapGrid2d, (GLADlazyproc)glad_lazy_glMapGrid2d },
+	{ "glMapGrid2f", (GLADlazyproc*)&glad_glMapGrid2f, (GLADlazyproc)glad_lazy_glMapGrid2f },
+	{ "glMaterialf", (GLADlazyproc*)&glad_glMaterialf, (GLADlazyproc)glad_lazy_glMaterialf },
+	{ "glMaterialfv", (GLADlazyproc*)&glad_glMaterialfv, (GLADlazyproc)glad_lazy_glMaterialfv },
+	{ "glMateriali", (GLADlazyproc*)&glad_glMateriali, (GLADlazyproc)glad_lazy_glMateriali },
+	{ "glMaterialiv", (GLADlazyproc*)&glad_glMaterialiv, (GLADlazyproc)glad_lazy_glMaterialiv },
+	{ "glMatrixMode", (GLADlazyproc*)&glad_glMatrixMode, (GLADlazyproc)glad_lazy_glMatrixMode },
+	{ "glMemoryBarrier", (GLADlazyproc*)&glad_glMemoryBarrier, (GLADlazyproc)glad_lazy_glMemoryBarrier },
+	{ "glMinSampleShading", (GLADlazyproc*)&glad_glMinSampleShading, (GLADlazyproc)glad_lazy_glMinSampleShading },
+	{ "glMultMatrixd", (GLADlazyproc*)&glad_glMultMatrixd, (GLADlazyproc)glad_lazy_glMultMatrixd },
+	{ "glMultMatrixf", (GLADlazyproc*)&glad_glMultMatrixf, (GLADlazyproc)glad_lazy_glMultMatrixf },
+	{ "glMultTransposeMatrixd", (GLADlazyproc*)&glad_glMultTransposeMatrixd, (GLADlazyproc)glad_lazy_glMultTransposeMatrixd },
+	{ "glMultTransposeMatrixf", (GLADlazyproc*)&glad_glMultTransposeMatrixf, (GLADlazyproc)glad_lazy_glMultTransposeMatrixf },
+	{ "glMultiDrawArrays", (GLADlazyproc*)&glad_glMultiDrawArrays, (GLADlazyproc)glad_lazy_glMultiDrawArrays },
+	{ "glMultiDrawArraysIndirect", (GLADlazyproc*)&glad_glMultiDrawArraysIndirect, (GLADlazyproc)glad_lazy_glMultiDrawArraysIndirect },
+	{ "glMultiDrawElements", (GLADlazyproc*)&glad_glMultiDrawElements, (GLADlazyproc)glad_lazy_glMultiDrawElements },
+	{ "glMultiDrawElementsBaseVertex", (GLADlazyproc*)&glad_glMultiDrawElementsBaseVertex, (GLADlazyproc)glad_lazy_glMultiDrawElementsBaseVertex },
+	{ "glMultiDrawElementsIndirect", (GLADlazyproc*)&glad_glMultiDrawElementsIndirect, (GLADlazyproc)glad_lazy_glMultiDrawElementsIndirect },
+	{ "glMultiTexCoord1d", (GLADlazyproc*)&glad_glMultiTexCoord1d, (GLADlazyproc)glad_lazy_glMultiTexCoord1d },
+	{ "glMultiTexCoord1dv", (GLADlazyproc*)&glad_glMultiTexCoord1dv, (GLADlazyproc)glad_lazy_glMultiTexCoord1dv },
+	{ "glMultiTexCoord1f", (GLADlazyproc*)&glad_glMultiTexCoord1f, (GLADlazyproc)glad_lazy_glMultiTexCoord1f },
+	{ "glMultiTexCoord1fv", (GLADlazyproc*)&glad_glMultiTexCoord1fv, (GLADlazyproc)glad_lazy_glMultiTexCoord1fv },
+	{ "glMultiTexCoord1i", (GLADlazyproc*)&glad_glMultiTexCoord1i, (GLADlazyproc)glad_lazy_glMultiTexCoord1i },
+	{ "glMultiTexCoord1iv", (GLADlazyproc*)&glad_glMultiTexCoord1iv, (GLADlazyproc)glad_lazy_glMultiTexCoord1iv },
+	{ "glMultiTexCoord1s", (GLADlazyproc*)&glad_glMultiTexCoord1s, (GLADlazyproc)glad_lazy_glMultiTexCoord1s },
+	{ "glMultiTexCoord1sv", (GLADlazyproc*)&glad_glMultiTexCoord1sv, (GLADlazyproc)glad_lazy_glMultiTexCoord1sv },
+	{ "glMultiTexCoord2d", (GLADlazyproc*)&glad_glMultiTexCoord2d, (GLADlazyproc)glad_lazy_glMultiTexCoord2d },
+	{ "glMultiTexCoord2dv", (GLADlazyproc*)&glad_glMultiTexCoord2dv, (GLADlazyproc)glad_lazy_glMultiTexCoord2dv },
+	{ "glMultiTexCoord2f", (GLADlazyproc*)&glad_glMultiTexCoord2f, (GLADlazyproc)glad_lazy_glMultiTexCoord2f },
+	{ "glMultiTexCoord2fv", (GLADlazyproc*)&glad_glMultiTexCoord2fv, (GLADlazyproc)glad_lazy_glMultiTexCoord2fv },
+	{ "glMultiTexCoord2i", (GLADlazyproc*)&glad_glMultiTexCoord2i, (GLADlazyproc)glad_lazy_glMultiTexCoord2i },
+	{ "glMultiTexCoord2iv", (GLADlazyproc*)&glad_glMultiTexCoord2iv, (GLADlazyproc)glad_lazy_glMultiTexCoord2iv },
+	{ "glMultiTexCoord2s", (GLADlazyproc*)&glad_glMultiTexCoord2s, (GLADlazyproc)glad_lazy_glMultiTexCoord2s },
+	{ "glMultiTexCoord2sv", (GLADlazyproc*)&glad_glMultiTexCoord2sv, (GLADlazyproc)glad_lazy_glMultiTexCoord2sv },
+	{ "glMultiTexCoord3d", (GLADlazyproc*)&glad_glMultiTexCoord3d, (GLADlazyproc)glad_lazy_glMultiTexCoord3d },
+	{ "glMultiTexCoord3dv", (GLADlazyproc*)&glad_glMultiTexCoord3dv, (GLADlazyproc)glad_lazy_glMultiTexCoord3dv },
+	{ "glMultiTexCoord3f", (GLADlazyproc*)&glad_glMultiTexCoord3f, (GLADlazyproc)glad_lazy_glMultiTexCoord3f },
+	{ "glMultiTexCoord3fv", (GLADlazyproc*)&glad_glMultiTexCoord3fv, (GLADlazyproc)glad_lazy_glMultiTexCoord3fv },
+	{ "glMultiTexCoord3i", (GLADlazyproc*)&glad_glMultiTexCoord3i, (GLADlazyproc)glad_lazy_glMultiTexCoord3i },
+	{ "glMultiTexCoord3iv", (GLADlazyproc*)&glad_glMultiTexCoord3iv, (GLADlazyproc)glad_lazy_glMultiTexCoord3iv },
+	{ "glMultiTexCoord3s", (GLADlazyproc*)&glad_glMultiTexCoord3s, (GLADlazyproc)glad_lazy_glMultiTexCoord3s },
+	{ "glMultiTexCoord3sv", (GLADlazyproc*)&glad_glMultiTexCoord3sv, (GLADlazyproc)glad_lazy_glMultiTexCoord3sv },
+	{ "glMultiTexCoord4d", (GLADlazyproc*)&glad_glMultiTexCoord4d, (GLADlazyproc)glad_lazy_glMultiTexCoord4d },
+	{ "glMultiTexCoord4dv", (GLADlazyproc*)&glad_glMultiTexCoord4dv, (GLADlazyproc)glad_lazy_glMultiTexCoord4dv },
+	{ "glMultiTexCoord4f", (GLADlazyproc*)&glad_glMultiTexCoord4f, (GLADlazyproc)glad_lazy_glMultiTexCoord4f },
+	{ "glMultiTexCoord4fv", (GLADlazyproc*)&glad_glMultiTexCoord4fv, (GLADlazyproc)glad_lazy_glMultiTexCoord4fv },
+	{ "glMultiTexCoord4i", (GLADlazyproc*)&glad_glMultiTexCoord4i, (GLADlazyproc)glad_lazy_glMultiTexCoord4i },
+	{ "glMultiTexCoord4iv", (GLADlazyproc*)&glad_glMultiTexCoord4iv, (GLADlazyproc)glad_lazy_glMultiTexCoord4iv },
+	{ "glMultiTexCoord4s", (GLADlazyproc*)&glad_glMultiTexCoord4s, (GLADlazyproc)glad_lazy_glMultiTexCoord4s },
+	{ "glMultiTexCoord4sv", (GLADlazyproc*)&glad_glMultiTexCoord4sv, (GLADlazyproc)glad_lazy_glMultiTexCoord4sv },
+	{ "glMultiTexCoordP1ui", (GLADlazyproc*)&glad_glMultiTexCoordP1ui, (GLADlazyproc)glad_lazy_glMultiTexCoordP1ui },
+	{ "glMultiTexCoordP1uiv", (GLADlazyproc*)&glad_glMultiTexCoordP1uiv, (GLADlazyproc)glad_lazy_glMultiTexCoordP1uiv },
+	{ "glMultiTexCoordP2ui", (GLADlazyproc*)&glad_glMultiTexCoordP2ui, (GLADlazyproc)glad_lazy_glMultiTexCoordP2ui },
+	{ "glMultiTexCoordP2uiv", (GLADlazyproc*)&glad_glMultiTexCoordP2uiv, (GLADlazyproc)glad_lazy_glMultiTexCoordP2uiv },
+	{ "glMultiTexCoordP3ui", (GLADlazyproc*)&glad_glMultiTexCoordP3ui, (GLADlazyproc)glad_lazy_glMultiTexCoordP3ui },
+	{ "glMultiTexCoordP3uiv", (GLADlazyproc*)&glad_glMultiTexCoordP3uiv, (GLADlazyproc)glad_lazy_glMultiTexCoordP3uiv },
+	{ "glMultiTexCoordP4ui", (GLADlazyproc*)&glad_glMultiTexCoordP4ui, (GLADlazyproc)glad_lazy_glMultiTexCoordP4ui },
+	{ "glMultiTexCoordP4uiv", (GLADlazyproc*)&glad_glMultiTexCoordP4uiv, (GLADlazyproc)glad_lazy_glMultiTexCoordP4uiv },
+	{ "glNewList", (GLADlazyproc*)&glad_glNewList, (GLADlazyproc)glad_lazy_glNewList },
+	{ "glNormal3b", (GLADlazyproc*)&glad_glNormal3b, (GLADlazyproc)glad_lazy_glNormal3b },
+	{ "glNormal3bv", (GLADlazyproc*)&glad_glNormal3bv, (GLADlazyproc)glad_lazy_glNormal3bv },
+	{ "glNormal3d", (GLADlazyproc*)&glad_glNormal3d, (GLADlazyproc)glad_lazy_glNormal3d },
+	{ "glNormal3dv", (GLADlazyproc*)&glad_glNormal3dv, (GLADlazyproc)glad_lazy_glNormal3dv },
+	{ "glNormal3f", (GLADlazyproc*)&glad_glNormal3f, (GLADlazyproc)glad_lazy_glNormal3f },
+	{ "glNormal3fv", (GLADlazyproc*)&glad_glNormal3fv, (GLADlazyproc)glad_lazy_glNormal3fv },
+	{ "glNormal3i", (GLADlazyproc*)&glad_glNormal3i, (GLADlazyproc)glad_lazy_glNormal3i },
+	{ "glNormal3iv", (GLADlazyproc*)&glad_glNormal3iv, (GLADlazyproc)glad_lazy_glNormal3iv },
+	{ "glNormal3s", (GLADlazyproc*)&glad_glNormal3s, (GLADlazyproc)glad_lazy_glNormal3s },
+	{ "glNormal3sv", (GLADlazyproc*)&glad_glNormal3sv, (GLADlazyproc)glad_lazy_glNormal3sv },
+	{ "glNormalP3ui", (GLADlazyproc*)&glad_glNormalP3ui, (GLADlazyproc)glad_lazy_glNormalP3ui },
+	{ "glNormalP3uiv", (GLADlazyproc*)&glad_glNormalP3uiv, (GLADlazyproc)glad_lazy_glNormalP3uiv },
+	{ "glNormalPointer", (GLADlazyproc*)&glad_glNormalPointer, (GLADlazyproc)glad_lazy_glNormalPointer },
+	{ "glObjectLabel", (GLADlazyproc*)&glad_glObjectLabel, (GLADlazyproc)glad_lazy_glObjectLabel },
+	{ "glObjectPtrLabel", (GLADlazyproc*)&glad_glObjectPtrLabel, (GLADlazyproc)glad_lazy_glObjectPtrLabel },
+	{ "glOrtho", (GLADlazyproc*)&glad_glOrtho, (GLADlazyproc)glad_lazy_glOrtho },
+	{ "glPassThrough", (GLADlazyproc*)&glad_glPassThrough, (GLADlazyproc)glad_lazy_glPassThrough },
+	{ "glPatchParameterfv", (GLADlazyproc*)&glad_glPatchParameterfv, (GLADlazyproc)glad_lazy_glPatchParameterfv },
+	{ "glPatchParameteri", (GLADlazyproc*)&glad_glPatchParameteri, (GLADlazyproc)glad_lazy_glPatchParameteri },
+	{ "glPauseTransformFeedback", (GLADlazyproc*)&glad_glPauseTransformFeedback, (GLADlazyproc)glad_lazy_glPauseTransformFeedback },
+	{ "glPixelMapfv", (GLADlazyproc*)&glad_glPixelMapfv, (GLADlazyproc)glad_lazy_glPixelMapfv },
+	{ "glPixelMapuiv", (GLADlazyproc*)&glad_glPixelMapuiv, (GLADlazyproc)glad_lazy_glPixelMapuiv },
+	{ "glPixelMapusv", (GLADlazyproc*)&glad_glPixelMapusv, (GLADlazyproc)glad_lazy_glPixelMapusv },
+	{ "glPixelStoref", (GLADlazyproc*)&glad_glPixelStoref, (GLADlazyproc)glad_lazy_glPixelStoref },
+	{ "glPixelStorei", (GLADlazyproc*)&glad_glPixelStorei, (GLADlazyproc)glad_lazy_glPixelStorei },
+	{ "glPixelTransferf", (GLADlazyproc*)&glad_glPixelTransferf, (GLADlazyproc)glad_lazy_glPixelTransferf },
+	{ "glPixelTransferi", (GLADlazyproc*)&glad_glPixelTransferi, (GLADlazyproc)glad_lazy_glPixelTransferi },
+	{ "glPixelZoom", (GLADlazyproc*)&glad_glPixelZoom, (GLADlazyproc)glad_lazy_glPixelZoom },
+	{ "glPointParameterf", (GLADlazyproc*)&glad_glPointParameterf, (GLADlazyproc)glad_lazy_glPointParameterf },
+	{ "glPointParameterfv", (GLADlazyproc*)&glad_glPointParameterfv, (GLADlazyproc)glad_lazy_glPointParameterfv },
+	{ "glPointParameteri", (GLADlazyproc*)&glad_glPointParameteri, (GLADlazyproc)glad_lazy_glPointParameteri },
+	{ "glPointParameteriv", (GLADlazyproc*)&glad_glPointParameteriv, (GLADlazyproc)glad_lazy_glPointParameteriv },
+	{ "glPointSize", (GLADlazyproc*)&glad_glPointSize, (GLADlazyproc)glad_lazy_glPointSize },
+	{ "glPolygonMode", (GLADlazyproc*)&glad_glPolygonMode, (GLADlazyproc)glad_lazy_glPolygonMode },
+	{ "glPolygonOffset", (GLADlazyproc*)&glad_glPolygonOffset, (GLADlazyproc)glad_lazy_glPolygonOffset },
+	{ "glPolygonStipple", (GLADlazyproc*)&glad_glPolygonStipple, (GLADlazyproc)glad_lazy_glPolygonStipple },
+	{ "glPopAttrib", (GLADlazyproc*)&glad_glPopAttrib, (GLADlazyproc)glad_lazy_glPopAttrib },
+	{ "glPopClientAttrib", (GLADlazyproc*)&glad_glPopClientAttrib, (GLADlazyproc)glad_lazy_glPopClientAttrib },
+	{ "glPopDebugGroup", (GLADlazyproc*)&glad_glPopDebugGroup, (GLADlazyproc)glad_lazy_glPopDebugGroup },
+	{ "glPopMatrix", (GLADlazyproc*)&glad_glPopMatrix, (GLADlazyproc)glad_lazy_glPopMatrix },
+	{ "glPopName", (GLADlazyproc*)&glad_glPopName, (GLADlazyproc)glad_lazy_glPopName },
+	{ "glPrimitiveRestartIndex", (GLADlazyproc*)&glad_glPrimitiveRestartIndex, (GLADlazyproc)glad_lazy_glPrimitiveRestartIndex },
+	{ "glPrioritizeTextures", (GLADlazyproc*)&glad_glPrioritizeTextures, (GLADlazyproc)glad_lazy_glPrioritizeTextures },
+	{ "glProgramBinary", (GLADlazyproc*)&glad_glProgramBinary, (GLADlazyproc)glad_lazy_glProgramBinary },
+	{ "glProgramParameteri", (GLADlazyproc*)&glad_glProgramParameteri, (GLADlazyproc)glad_lazy_glProgramParameteri },
+	{ "glProgramUniform1d", (GLADlazyproc*)&glad_glProgramUniform1d, (GLADlazyproc)glad_lazy_glProgramUniform1d },
+	{ "glProgramUniform1dv", (GLADlazyproc*)&glad_glProgramUniform1dv, (GLADlazyproc)glad_lazy_glProgramUniform1dv },
+	{ "glProgramUniform1f", (GLADlazyproc*)&glad_glProgramUniform1f, (GLADlazyproc)glad_lazy_glProgramUniform1f },
+	{ "glProgramUniform1fv", (GLADlazyproc*)&glad_glProgramUniform1fv, (GLADlazyproc)glad_lazy_glProgramUniform1fv },
+	{ "glProgramUniform1i", (GLADlazyproc*)&glad_glProgramUniform1i, (GLADlazyproc)glad_lazy_glProgramUniform1i },
+	{ "glProgramUniform1iv", (GLADlazyproc*)&glad_glProgramUniform1iv, (GLADlazyproc)glad_lazy_glProgramUniform1iv },
+	{ "glProgramUniform1ui", (GLADlazyproc*)&glad_glProgramUniform1ui, (GLADlazyproc)glad_lazy_glProgramUniform1ui },
+	{ "glProgramUniform1uiv", (GLADlazyproc*)&glad_glProgramUniform1uiv, (GLADlazyproc)glad_lazy_glProgramUniform1uiv },
+	{ "glProgramUniform2d", (GLADlazyproc*)&glad_glProgramUniform2d, (GLADlazyproc)glad_lazy_glProgramUniform2d },
+	{ "glProgramUniform2dv", (GLADlazyproc*)&glad_glProgramUniform2dv, (GLADlazyproc)glad_lazy_glProgramUniform2dv },
+	{ "glProgramUniform2f", (GLADlazyproc*)&glad_glProgramUniform2f, (GLADlazyproc)glad_lazy_glProgramUniform2f },
+	{ "glProgramUniform2fv", (GLADlazyproc*)&glad_glProgramUniform2fv, (GLADlazyproc)glad_lazy_glProgramUniform2fv },
+	{ "glProgramUniform2i", (GLADlazyproc*)&glad_glProgramUniform2i, (GLADlazyproc)glad_lazy_glProgramUniform2i },
+	{ "glProgramUniform2iv", (GLADlazyproc*)&glad_glProgramUniform2iv, (GLADlazyproc)glad_lazy_glProgramUniform2iv },
+	{ "glProgramUniform2ui", (GLADlazyproc*)&glad_glProgramUniform2ui, (GLADlazyproc)glad_lazy_glProgramUniform2ui },
+	{ "glProgramUniform2uiv", (GLADlazyproc*)&glad_glProgramUniform2uiv, (GLADlazyproc)glad_lazy_glProgramUniform2uiv },
+	{ "glProgramUniform3d", (GLADlazyproc*)&glad_glProgramUniform3d, (GLADlazyproc)glad_lazy_glProgramUniform3d },
+	{ "glProgramUniform3dv", (GLADlazyproc*)&glad_glProgramUniform3dv, (GLADlazyproc)glad_lazy_glProgramUniform3dv },
+	{ "glProgramUniform3f", (GLADlazyproc*)&glad_glProgramUniform3f, (GLADlazyproc)glad_lazy_glProgramUniform3f },
+	{ "glProgramUniform3fv", (GLADlazyproc*)&glad_glProgramUniform3fv, (GLADlazyproc)glad_lazy_glProgramUniform3fv },
+	{ "glProgramUniform3i", (GLADlazyproc*)&glad_glProgramUniform3i, (GLADlazyproc)glad_lazy_glProgramUniform3i },
+	{ "glProgramUniform3iv", (GLADlazyproc*)&glad_glProgramUniform3iv, (GLADlazyproc)glad_lazy_glProgramUniform3iv },
+	{ "glProgramUniform3ui", (GLADlazyproc*)&glad_glProgramUniform3ui, (GLADlazyproc)glad_lazy_glProgramUniform3ui },
+	{ "glProgramUniform3uiv", (GLADlazyproc*)&glad_glProgramUniform3uiv, (GLADlazyproc)glad_lazy_glProgramUniform3uiv },
+	{ "glProgramUniform4d", (GLADlazyproc*)&glad_glProgramUniform4d, (GLADlazyproc)glad_lazy_glProgramUniform4d },
+	{ "glProgramUniform4dv", (GLADlazyproc*)&glad_glProgramUniform4dv, (GLADlazyproc)glad_lazy_glProgramUniform4dv },
+	{ "glProgramUniform4f", (GLADlazyproc*)&glad_glProgramUniform4f, (GLADlazyproc)glad_lazy_glProgramUniform4f },
+	{ "glProgramUniform4fv", (GLADlazyproc*)&glad_glProgramUniform4fv, (GLADlazyproc)glad_lazy_glProgramUniform4fv },
+	{ "glProgramUniform4i", (GLADlazyproc*)&glad_glProgramUniform4i, (GLADlazyproc)glad_lazy_glProgramUniform4i },
+	{ "glProgramUniform4iv", (GLADlazyproc*)&glad_glProgramUniform4iv, (GLADlazyproc)glad_lazy_glProgramUniform4iv },
+	{ "glProgramUniform4ui", (GLADlazyproc*)&glad_glProgramUniform4ui, (GLADlazyproc)glad_lazy_glProgramUniform4ui },
+	{ "glProgramUniform4uiv", (GLADlazyproc*)&glad_glProgramUniform4uiv, (GLADlazyproc)glad_lazy_glProgramUniform4uiv },
+	{ "glProgramUniformMatrix2dv", (GLADlazyproc*)&glad_glProgramUniformMatrix2dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2dv },
+	{ "glProgramUniformMatrix2fv", (GLADlazyproc*)&glad_glProgramUniformMatrix2fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2fv },
+	{ "glProgramUniformMatrix2x3dv", (GLADlazyproc*)&glad_glProgramUniformMatrix2x3dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2x3dv },
+	{ "glProgramUniformMatrix2x3fv", (GLADlazyproc*)&glad_glProgramUniformMatrix2x3fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2x3fv },
+	{ "glProgramUniformMatrix2x4dv", (GLADlazyproc*)&glad_glProgramUniformMatrix2x4dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2x4dv },
+	{ "glProgramUniformMatrix2x4fv", (GLADlazyproc*)&glad_glProgramUniformMatrix2x4fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix2x4fv },
+	{ "glProgramUniformMatrix3dv", (GLADlazyproc*)&glad_glProgramUniformMatrix3dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3dv },
+	{ "glProgramUniformMatrix3fv", (GLADlazyproc*)&glad_glProgramUniformMatrix3fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3fv },
+	{ "glProgramUniformMatrix3x2dv", (GLADlazyproc*)&glad_glProgramUniformMatrix3x2dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3x2dv },
+	{ "glProgramUniformMatrix3x2fv", (GLADlazyproc*)&glad_glProgramUniformMatrix3x2fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3x2fv },
+	{ "glProgramUniformMatrix3x4dv", (GLADlazyproc*)&glad_glProgramUniformMatrix3x4dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3x4dv },
+	{ "glProgramUniformMatrix3x4fv", (GLADlazyproc*)&glad_glProgramUniformMatrix3x4fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix3x4fv },
+	{ "glProgramUniformMatrix4dv", (GLADlazyproc*)&glad_glProgramUniformMatrix4dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4dv },
+	{ "glProgramUniformMatrix4fv", (GLADlazyproc*)&glad_glProgramUniformMatrix4fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4fv },
+	{ "glProgramUniformMatrix4x2dv", (GLADlazyproc*)&glad_glProgramUniformMatrix4x2dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4x2dv },
+	{ "glProgramUniformMatrix4x2fv", (GLADlazyproc*)&glad_glProgramUniformMatrix4x2fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4x2fv },
+	{ "glProgramUniformMatrix4x3dv", (GLADlazyproc*)&glad_glProgramUniformMatrix4x3dv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4x3dv },
+	{ "glProgramUniformMatrix4x3fv", (GLADlazyproc*)&glad_glProgramUniformMatrix4x3fv, (GLADlazyproc)glad_lazy_glProgramUniformMatrix4x3fv },
+	{ "glProvokingVertex", (GLADlazyproc*)&glad_glProvokingVertex, (GLADlazyproc)glad_lazy_glProvokingVertex },
+	{ "glPushAttrib", (GLADlazyproc*)&glad_glPushAttrib, (GLADlazyproc)glad_lazy_glPushAttrib },
+	{ "glPushClientAttrib", (GLADlazyproc*)&glad_glPushClientAttrib, (GLADlazyproc)glad_lazy_glPushClientAttrib },
+	{ "glPushDebugGroup", (GLADlazyproc*)&glad_glPushDebugGroup, (GLADlazyproc)glad_lazy_glPushDebugGroup },
+	{ "glPushMatrix", (GLADlazyproc*)&glad_glPushMatrix, (GLADlazyproc)glad_lazy_glPushMatrix },
+	{ "glPushName", (GLADlazyproc*)&glad_glPushName, (GLADlazyproc)glad_lazy_glPushName },
+	{ "glQueryCounter", (GLADlazyproc*)&glad_glQueryCounter, (GLADlazyproc)glad_lazy_glQueryCounter },
+	{ "glRasterPos2d", (GLADlazyproc*)&glad_glRasterPos2d, (GLADlazyproc)glad_lazy_glRasterPos2d },
+	{ "glRasterPos2dv", (GLADlazyproc*)&glad_glRasterPos2dv, (GLADlazyproc)glad_lazy_glRasterPos2dv },
+	{ "glRasterPos2f", (GLADlazyproc*)&glad_glRasterPos2f, (GLADlazyproc)glad_lazy_glRasterPos2f },
+	{ "glRasterPos2fv", (GLADlazyproc*)&glad_glRasterPos2fv, (GLADlazyproc)glad_lazy_glRasterPos2fv },
+	{ "glRasterPos2i", (GLADlazyproc*)&glad_glRasterPos2i, (GLADlazyproc)glad_lazy_glRasterPos2i },
+	{ "glRasterPos2iv", (GLADlazyproc*)&glad_glRasterPos2iv, (GLADlazyproc)glad_lazy_glRasterPos2iv },
+	{ "glRasterPos2s", (GLADlazyproc*)&glad_glRasterPos2s, (GLADlazyproc)glad_lazy_glRasterPos2s },
+	{ "glRasterPos2sv", (GLADlazyproc*)&glad_glRasterPos2sv, (GLADlazyproc)glad_lazy_glRasterPos2sv },
+	{ "glRasterPos3d", (GLADlazyproc*)&glad_glRasterPos3d, (GLADlazyproc)glad_lazy_glRasterPos3d },
+	{ "glRasterPos3dv", (GLADlazyproc*)&glad_glRasterPos3dv, (GLADlazyproc)glad_lazy_glRasterPos3dv },
+	{ "glRasterPos3f", (GLADlazyproc*)&glad_glRasterPos3f, (GLADlazyproc)glad_lazy_glRasterPos3f },
+	{ "glRasterPos3fv", (GLADlazyproc*)&glad_glRasterPos3fv, (GLADlazyproc)glad_lazy_glRasterPos3fv },
+	{ "glRasterPos3i", (GLADlazyproc*)&glad_glRasterPos3i, (GLADlazyproc)glad_lazy_glRasterPos3i },
+	{ "glRasterPos3iv", (GLADlazyproc*)&glad_glRasterPos3iv, (GLADlazyproc)glad_lazy_glRasterPos3iv },
+	{ "glRasterPos3s", (GLADlazyproc*)&glad_glRasterPos3s, (GLADlazyproc)glad_lazy_glRasterPos3s },
+	{ "glRasterPos3sv", (GLADlazyproc*)&glad_glRasterPos3sv, (GLADlazyproc)glad_lazy_glRasterPos3sv },
+	{ "glRasterPos4d", (GLADlazyproc*)&glad_glRasterPos4d, (GLADlazyproc)glad_lazy_glRasterPos4d },
+	{ "glRasterPos4dv", (GLADlazyproc*)&glad_glRasterPos4dv, (GLADlazyproc)glad_lazy_glRasterPos4dv },
+	{ "glRasterPos4f", (GLADlazyproc*)&glad_glRasterPos4f, (GLADlazyproc)glad_lazy_glRasterPos4f },
+	{ "glRasterPos4fv", (GLADlazyproc*)&glad_glRasterPos4fv, (GLADlazyproc)glad_lazy_glRasterPos4fv },
+	{ "glRasterPos4i", (GLADlazyproc*)&glad_glRasterPos4i, (GLADlazyproc)glad_lazy_glRasterPos4i },
+	{ "glRasterPos4iv", (GLADlazyproc*)&glad_glRasterPos4iv, (GLADlazyproc)glad_lazy_glRasterPos4iv },
+	{ "glRasterPos4s", (GLADlazyproc*)&glad_glRasterPos4s, (GLADlazyproc)glad_lazy_glRasterPos4s },
+	{ "glRasterPos4sv", (GLADlazyproc*)&glad_glRasterPos4sv, (GLADlazyproc)glad_lazy_glRasterPos4sv },
+	{ "glReadBuffer", (GLADlazyproc*)&glad_glReadBuffer, (GLADlazyproc)glad_lazy_glReadBuffer },
+	{ "glReadPixels", (GLADlazyproc*)&glad_glReadPixels, (GLADlazyproc)glad_lazy_glReadPixels },
+	{ "glRectd", (GLADlazyproc*)&glad_glRectd, (GLADlazyproc)glad_lazy_glRectd },
+	{ "glRectdv", (GLADlazyproc*)&glad_glRectdv, (GLADlazyproc)glad_lazy_glRectdv },
+	{ "glRectf", (GLADlazyproc*)&glad_glRectf, (GLADlazyproc)glad_lazy_glRectf },
+	{ "glRectfv", (GLADlazyproc*)&glad_glRectfv, (GLADlazyproc)glad_lazy_glRectfv },
+	{ "glRecti", (GLADlazyproc*)&glad_glRecti, (GLADlazyproc)glad_lazy_glRecti },
+	{ "glRectiv", (GLADlazyproc*)&glad_glRectiv, (GLADlazyproc)glad_lazy_glRectiv },
+	{ "glRects", (GLADlazyproc*)&glad_glRects, (GLADlazyproc)glad_lazy_glRects },
+	{ "glRectsv", (GLADlazyproc*)&glad_glRectsv, (GLADlazyproc)glad_lazy_glRectsv },
+	{ "glReleaseShaderCompiler", (GLADlazyproc*)&glad_glReleaseShaderCompiler, (GLADlazyproc)glad_lazy_glReleaseShaderCompiler },
+	{ "glRenderMode", (GLADlazyproc*)&glad_glRenderMode, (GLADlazyproc)glad_lazy_glRenderMode },
+	{ "glRenderbufferStorage", (GLADlazyproc*)&glad_glRenderbufferStorage, (GLADlazyproc)glad_lazy_glRenderbufferStorage },
+	{ "glRenderbufferStorageMultisample", (GLADlazyproc*)&glad_glRenderbufferStorageMultisample, (GLADlazyproc)glad_lazy_glRenderbufferStorageMultisample },
+	{ "glResumeTransformFeedback", (GLADlazyproc*)&glad_glResumeTransformFeedback, (GLADlazyproc)glad_lazy_glResumeTransformFeedback },
+	{ "glRotated", (GLADlazyproc*)&glad_glRotated, (GLADlazyproc)glad_lazy_glRotated },
+	{ "glRotatef", (GLADlazyproc*)&glad_glRotatef, (GLADlazyproc)glad_lazy_glRotatef },
+	{ "glSampleCoverage", (GLADlazyproc*)&glad_glSampleCoverage, (GLADlazyproc)glad_lazy_glSampleCoverage },
+	{ "glSampleMaski", (GLADlazyproc*)&glad_glSampleMaski, (GLADlazyproc)glad_lazy_glSampleMaski },
+	{ "glSamplerParameterIiv", (GLADlazyproc*)&glad_glSamplerParameterIiv, (GLADlazyproc)glad_lazy_glSamplerParameterIiv },
+	{ "glSamplerParameterIuiv", (GLADlazyproc*)&glad_glSamplerParameterIuiv, (GLADlazyproc)glad_lazy_glSamplerParameterIuiv },
+	{ "glSamplerParameterf", (GLADlazyproc*)&glad_glSamplerParameterf, (GLADlazyproc)glad_lazy_glSamplerParameterf },
+	{ "glSamplerParameterfv", (GLADlazyproc*)&glad_glSamplerParameterfv, (GLADlazyproc)glad_lazy_glSamplerParameterfv },
+	{ "glSamplerParameteri", (GLADlazyproc*)&glad_glSamplerParameteri, (GLADlazyproc)glad_lazy_glSamplerParameteri },
+	{ "glSamplerParameteriv", (GLADlazyproc*)&glad_glSamplerParameteriv, (GLADlazyproc)glad_lazy_glSamplerParameteriv },
+	{ "glScaled", (GLADlazyproc*)&glad_glScaled, (GLADlazyproc)glad_lazy_glScaled },
+	{ "glScalef", (GLADlazyproc*)&glad_glScalef, (GLADlazyproc)glad_lazy_glScalef },
+	{ "glScissor", (GLADlazyproc*)&glad_glScissor, (GLADlazyproc)glad_lazy_glScissor },
+	{ "glScissorArrayv", (GLADlazyproc*)&glad_glScissorArrayv, (GLADlazyproc)glad_lazy_glScissorArrayv },
+	{ "glScissorIndexed", (GLADlazyproc*)&glad_glScissorIndexed, (GLADlazyproc)glad_lazy_glScissorIndexed },
+	{ "glScissorIndexedv", (GLADlazyproc*)&glad_glScissorIndexedv, (GLADlazyproc)glad_lazy_glScissorIndexedv },
+	{ "glSecondaryColor3b", (GLADlazyproc*)&glad_glSecondaryColor3b, (GLADlazyproc)glad_lazy_glSecondaryColor3b },
+	{ "glSecondaryColor3bv", (GLADlazyproc*)&glad_glSecondaryColor3bv, (GLADlazyproc)glad_lazy_glSecondaryColor3bv },
+	{ "glSecondaryColor3d", (GLADlazyproc*)&glad_glSecondaryColor3d, (GLADlazyproc)glad_lazy_glSecondaryColor3d },
+	{ "glSecondaryColor3dv", (GLADlazyproc*)&glad_glSecondaryColor3dv, (GLADlazyproc)glad_lazy_glSecondaryColor3dv },
+	{ "glSecondaryColor3f", (GLADlazyproc*)&glad_glSecondaryColor3f, (GLADlazyproc)glad_lazy_glSecondaryColor3f },
+	{ "glSecondaryColor3fv", (GLADlazyproc*)&glad_glSecondaryColor3fv, (GLADlazyproc)glad_lazy_glSecondaryColor3fv },
+	{ "glSecondaryColor3i", (GLADlazyproc*)&glad_glSecondaryColor3i, (GLADlazyproc)glad_lazy_glSecondaryColor3i },
+	{ "glSecondaryColor3iv", (GLADlazyproc*)&glad_glSecondaryColor3iv, (GLADlazyproc)glad_lazy_glSecondaryColor3iv },
+	{ "glSecondaryColor3s", (GLADlazyproc*)&glad_glSecondaryColor3s, (GLADlazyproc)glad_lazy_glSecondaryColor3s },
+	{ "glSecondaryColor3sv", (GLADlazyproc*)&glad_glSecondaryColor3sv, (GLADlazyproc)glad_lazy_glSecondaryColor3sv },
+	{ "glSecondaryColor3ub", (GLADlazyproc*)&glad_glSecondaryColor3ub, (GLADlazyproc)glad_lazy_glSecondaryColor3ub },
+	{ "glSecondaryColor3ubv", (GLADlazyproc*)&glad_glSecondaryColor3ubv, (GLADlazyproc)glad_lazy_glSecondaryColor3ubv },
+	{ "glSecondaryColor3ui", (GLADlazyproc*)&glad_glSecondaryColor3ui, (GLADlazyproc)glad_lazy_glSecondaryColor3ui },
+	{ "glSecondaryColor3uiv", (GLADlazyproc*)&glad_glSecondaryColor3uiv, (GLADlazyproc)glad_lazy_glSecondaryColor3uiv },
+	{ "glSecondaryColor3us", (GLADlazyproc*)&glad_glSecondaryColor3us, (GLADlazyproc)glad_lazy_glSecondaryColor3us },
+	{ "glSecondaryColor3usv", (GLADlazyproc*)&glad_glSecondaryColor3usv, (GLADlazyproc)glad_lazy_glSecondaryColor3usv },
+	{ "glSecondaryColorP3ui", (GLADlazyproc*)&glad_glSecondaryColorP3ui, (GLADlazyproc)glad_lazy_glSecondaryColorP3ui },
+	{ "glSecondaryColorP3uiv", (GLADlazyproc*)&glad_glSecondaryColorP3uiv, (GLADlazyproc)glad_lazy_glSecondaryColorP3uiv },
+	{ "glSecondaryColorPointer", (GLADlazyproc*)&glad_glSecondaryColorPointer, (GLADlazyproc)glad_lazy_glSecondaryColorPointer },
+	{ "glSelectBuffer", (GLADlazyproc*)&glad_glSelectBuffer, (GLADlazyproc)glad_lazy_glSelectBuffer },
+	{ "glShadeModel", (GLADlazyproc*)&glad_glShadeModel, (GLADlazyproc)glad_lazy_glShadeModel },
+	{ "glShaderBinary", (GLADlazyproc*)&glad_glShaderBinary, (GLADlazyproc)glad_lazy_glShaderBinary },
+	{ "glShaderSource", (GLADlazyproc*)&glad_glShaderSource, (GLADlazyproc)glad_lazy_glShaderSource },
+	{ "glShaderStorageBlockBinding", (GLADlazyproc*)&glad_glShaderStorageBlockBinding, (GLADlazyproc)glad_lazy_glShaderStorageBlockBinding },
+	{ "glStencilFunc", (GLADlazyproc*)&glad_glStencilFunc, (GLADlazyproc)glad_lazy_glStencilFunc },
+	{ "glStencilFuncSeparate", (GLADlazyproc*)&glad_glStencilFuncSeparate, (GLADlazyproc)glad_lazy_glStencilFuncSeparate },
+	{ "glStencilMask", (GLADlazyproc*)&glad_glStencilMask, (GLADlazyproc)glad_lazy_glStencilMask },
+	{ "glStencilMaskSeparate", (GLADlazyproc*)&glad_glStencilMaskSeparate, (GLADlazyproc)glad_lazy_glStencilMaskSeparate },
+	{ "glStencilOp", (GLADlazyproc*)&glad_glStencilOp, (GLADlazyproc)glad_lazy_glStencilOp },
+	{ "glStencilOpSeparate", (GLADlazyproc*)&glad_glStencilOpSeparate, (GLADlazyproc)glad_lazy_glStencilOpSeparate },
+	{ "glTexBuffer", (GLADlazyproc*)&glad_glTexBuffer, (GLADlazyproc)glad_lazy_glTexBuffer },
+	{ "glTexBufferRange", (GLADlazyproc*)&glad_glTexBufferRange, (GLADlazyproc)glad_lazy_glTexBufferRange },
+	{ "glTexCoord1d", (GLADlazyproc*)&glad_glTexCoord1d, (GLADlazyproc)glad_lazy_glTexCoord1d },
+	{ "glTexCoord1dv", (GLADlazyproc*)&glad_glTexCoord1dv, (GLADlazyproc)glad_lazy_glTexCoord1dv },
+	{ "glTexCoord1f", (GLADlazyproc*)&glad_glTexCoord1f, (GLADlazyproc)glad_lazy_glTexCoord1f },
+	{ "glTexCoord1fv", (GLADlazyproc*)&glad_glTexCoord1fv, (GLADlazyproc)glad_lazy_glTexCoord1fv },
+	{ "glTexCoord1i", (GLADlazyproc*)&glad_glTexCoord1i, (GLADlazyproc)glad_lazy_glTexCoord1i },
+	{ "glTexCoord1iv", (GLADlazyproc*)&glad_glTexCoord1iv, (GLADlazyproc)glad_lazy_glTexCoord1iv },
+	{ "glTexCoord1s", (GLADlazyproc*)&glad_glTexCoord1s, (GLADlazyproc)glad_lazy_glTexCoord1s },
+	{ "glTexCoord1sv", (GLADlazyproc*)&glad_glTexCoord1sv, (GLADlazyproc)glad_lazy_glTexCoord1sv },
+	{ "glTexCoord2d", (GLADlazyproc*)&glad_glTexCoord2d, (GLADlazyproc)glad_lazy_glTexCoord2d },
+	{ "glTexCoord2dv", (GLADlazyproc*)&glad_glTexCoord2dv, (GLADlazyproc)glad_lazy_glTexCoord2dv },
+	{ "glTexCoord2f", (GLADlazyproc*)&glad_glTexCoord2f, (GLADlazyproc)glad_lazy_glTexCoord2f },
+	{ "glTexCoord2fv", (GLADlazyproc*)&glad_glTexCoord2fv, (GLADlazyproc)glad_lazy_glTexCoord2fv },
+	{ "glTexCoord2i", (GLADlazyproc*)&glad_glTexCoord2i, (GLADlazyproc)glad_lazy_glTexCoord2i },
+	{ "glTexCoord2iv", (GLADlazyproc*)&glad_glTexCoord2iv, (GLADlazyproc)glad_lazy_glTexCoord2iv },
+	{ "glTexCoord2s", (GLADlazyproc*)&glad_glTexCoord2s, (GLADlazyproc)glad_lazy_glTexCoord2s },
+	{ "glTexCoord2sv", (GLADlazyproc*)&glad_glTexCoord2sv, (GLADlazyproc)glad_lazy_glTexCoord2sv },
+	{ "glTexCoord3d", (GLADlazyproc*)&glad_glTexCoord3d, (GLADlazyproc)glad_lazy_glTexCoord3d },
+	{ "glTexCoord3dv", (GLADlazyproc*)&glad_glTexCoord3dv, (GLADlazyproc)glad_lazy_glTexCoord3dv },
+	{ "glTexCoord3f", (GLADlazyproc*)&glad_glTexCoord3f, (GLADlazyproc)glad_lazy_glTexCoord3f },
+	{ "glTexCoord3fv", (GLADlazyproc*)&glad_glTexCoord3fv, (GLADlazyproc)glad_lazy_glTexCoord3fv },
+	{ "glTexCoord3i", (GLADlazyproc*)&glad_glTexCoord3i, (GLADlazyproc)glad_lazy_glTexCoord3i },
+	{ "glTexCoord3iv", (GLADlazyproc*)&glad_glTexCoord3iv, (GLADlazyproc)glad_lazy_glTexCoord3iv },
+	{ "glTexCoord3s", (GLADlazyproc*)&glad_glTexCoord3s, (GLADlazyproc)glad_lazy_glTexCoord3s },
+	{ "glTexCoord3sv", (GLADlazyproc*)&glad_glTexCoord3sv, (GLADlazyproc)glad_lazy_glTexCoord3sv },
+	{ "glTexCoord4d", (GLADlazyproc*)&glad_glTexCoord4d, (GLADlazyproc)glad_lazy_glTexCoord4d },
+	{ "glTexCoord4dv", (GLADlazyproc*)&glad_glTexCoord4dv, (GLADlazyproc)glad_lazy_glTexCoord4dv },
+	{ "glTexCoord4f", (GLADlazyproc*)&glad_glTexCoord4f, (GLADlazyproc)glad_lazy_glTexCoord4f },
+	{ "glTexCoord4fv", (GLADlazyproc*)&glad_glTexCoord4fv, (GLADlazyproc)glad_lazy_glTexCoord4fv },
+	{ "glTexCoord4i", (GLADlazyproc*)&glad_glTexCoord4i, (GLADlazyproc)glad_lazy_glTexCoord4i },
+	{ "glTexCoord4iv", (GLADlazyproc*)&glad_glTexCoord4iv, (GLADlazyproc)glad_lazy_glTexCoord4iv },
+	{ "glTexCoord4s", (GLADlazyproc*)&glad_glTexCoord4s, (GLADlazyproc)glad_lazy_glTexCoord4s },
+	{ "glTexCoord4sv", (GLADlazyproc*)&glad_glTexCoord4sv, (GLADlazyproc)glad_lazy_glTexCoord4sv },
+	{ "glTexCoordP1ui", (GLADlazyproc*)&glad_glTexCoordP1ui, (GLADlazyproc)glad_lazy_glTexCoordP1ui },
+	{ "glTexCoordP1uiv", (GLADlazyproc*)&glad_glTexCoordP1uiv, (GLADlazyproc)glad_lazy_glTexCoordP1uiv },
+	{ "glTexCoordP2ui", (GLADlazyproc*)&glad_glTexCoordP2ui, (GLADlazyproc)glad_lazy_glTexCoordP2ui },
+	{ "glTexCoordP2uiv", (GLADlazyproc*)&glad_glTexCoordP2uiv, (GLADlazyproc)glad_lazy_glTexCoordP2uiv },
+	{ "glTexCoordP3ui", (GLADlazyproc*)&glad_glTexCoordP3ui, (GLADlazyproc)glad_lazy_glTexCoordP3ui },
+	{ "glTexCoordP3uiv", (GLADlazyproc*)&glad_glTexCoordP3uiv, (GLADlazyproc)glad_lazy_glTexCoordP3uiv },
+	{ "glTexCoordP4ui", (GLADlazyproc*)&glad_glTexCoordP4ui, (GLADlazyproc)glad_lazy_glTexCoordP4ui },
+	{ "glTexCoordP4uiv", (GLADlazyproc*)&glad_glTexCoordP4uiv, (GLADlazyproc)glad_lazy_glTexCoordP4uiv },
+	{ "glTexCoordPointer", (GLADlazyproc*)&glad_glTexCoordPointer, (GLADlazyproc)glad_lazy_glTexCoordPointer },
+	{ "glTexEnvf", (GLADlazyproc*)&glad_glTexEnvf, (GLADlazyproc)glad_lazy_glTexEnvf },
+	{ "glTexEnvfv", (GLADlazyproc*)&glad_glTexEnvfv, (GLADlazyproc)glad_lazy_glTexEnvfv },
+	{ "glTexEnvi", (GLADlazyproc*)&glad_glTexEnvi, (GLADlazyproc)glad_lazy_glTexEnvi },
+	{ "glTexEnviv", (GLADlazyproc*)&glad_glTexEnviv, (GLADlazyproc)glad_lazy_glTexEnviv },
+	{ "glTexGend", (GLADlazyproc*)&glad_glTexGend, (GLADlazyproc)glad_lazy_glTexGend },
+	{ "glTexGendv", (GLADlazyproc*)&glad_glTexGendv, (GLADlazyproc)glad_lazy_glTexGendv },
+	{ "glTexGenf", (GLADlazyproc*)&glad_glTexGenf, (GLADlazyproc)glad_lazy_glTexGenf },
+	{ "glTexGenfv", (GLADlazyproc*)&glad_glTexGenfv, (GLADlazyproc)glad_lazy_glTexGenfv },
+	{ "glTexGeni", (GLADlazyproc*)&glad_glTexGeni, (GLADlazyproc)glad_lazy_glTexGeni },
+	{ "glTexGeniv", (GLADlazyproc*)&glad_glTexGeniv, (GLADlazyproc)glad_lazy_glTexGeniv },
+	{ "glTexImage1D", (GLADlazyproc*)&glad_glTexImage1D, (GLADlazyproc)glad_lazy_glTexImage1D },
+	{ "glTexImage2D", (GLADlazyproc*)&glad_glTexImage2D, (GLADlazyproc)glad_lazy_glTexImage2D },
+	{ "glTexImage2DMultisample", (GLADlazyproc*)&glad_glTexImage2DMultisample, (GLADlazyproc)glad_lazy_glTexImage2DMultisample },
+	{ "glTexImage3D", (GLADlazyproc*)&glad_glTexImage3D, (GLADlazyproc)glad_lazy_glTexImage3D },
+	{ "glTexImage3DMultisample", (GLADlazyproc*)&glad_glTexImage3DMultisample, (GLADlazyproc)glad_lazy_glTexImage3DMultisample },
+	{ "glTexParameterIiv", (GLADlazyproc*)&glad_glTexParameterIiv, (GLADlazyproc)glad_lazy_glTexParameterIiv },
+	{ "glTexParameterIuiv", (GLADlazyproc*)&glad_glTexParameterIuiv, (GLADlazyproc)glad_lazy_glTexParameterIuiv },
+	{ "glTexParameterf", (GLADlazyproc*)&glad_glTexParameterf, (GLADlazyproc)glad_lazy_glTexParameterf },
+	{ "glTexParameterfv", (GLADlazyproc*)&glad_glTexParameterfv, (GLADlazyproc)glad_lazy_glTexParameterfv },
+	{ "glTexParameteri", (GLADlazyproc*)&glad_glTexParameteri, (GLADlazyproc)glad_lazy_glTexParameteri },
+	{ "glTexParameteriv", (GLADlazyproc*)&glad_glTexParameteriv, (GLADlazyproc)glad_lazy_glTexParameteriv },
+	{ "glTexStorage1D", (GLADlazyproc*)&glad_glTexStorage1D, (GLADlazyproc)glad_lazy_glTexStorage1D },
+	{ "glTexStorage2D", (GLADlazyproc*)&glad_glTexStorage2D, (GLADlazyproc)glad_lazy_glTexStorage2D },
+	{ "glTexStorage2DMultisample", (GLADlazyproc*)&glad_glTexStorage2DMultisample, (GLADlazyproc)glad_lazy_glTexStorage2DMultisample },
+	{ "glTexStorage3D", (GLADlazyproc*)&glad_glTexStorage3D, (GLADlazyproc)glad_lazy_glTexStorage3D },
+	{ "glTexStorage3DMultisample", (GLADlazyproc*)&glad_glTexStorage3DMultisample, (GLADlazyproc)glad_lazy_glTexStorage3DMultisample },
+	{ "glTexSubImage1D", (GLADlazyproc*)&glad_glTexSubImage1D, (GLADlazyproc)glad_lazy_glTexSubImage1D },
+	{ "glTexSubImage2D", (GLADlazyproc*)&glad_glTexSubImage2D, (GLADlazyproc)glad_lazy_glTexSubImage2D },
+	{ "glTexSubImage3D", (GLADlazyproc*)&glad_glTexSubImage3D, (GLADlazyproc)glad_lazy_glTexSubImage3D },
+	{ "glTextureView", (GLADlazyproc*)&glad_glTextureView, (GLADlazyproc)glad_lazy_glTextureView },
+	{ "glTransformFeedbackVaryings", (GLADlazyproc*)&glad_glTransformFeedbackVaryings, (GLADlazyproc)glad_lazy_glTransformFeedbackVaryings },
+	{ "glTranslated", (GLADlazyproc*)&glad_glTranslated, (GLADlazyproc)glad_lazy_glTranslated },
+	{ "glTranslatef", (GLADlazyproc*)&glad_glTranslatef, (GLADlazyproc)glad_lazy_glTranslatef },
+	{ "glUniform1d", (GLADlazyproc*)&glad_glUniform1d, (GLADlazyproc)glad_lazy_glUniform1d },
+	{ "glUniform1dv", (GLADlazyproc*)&glad_glUniform1dv, (GLADlazyproc)glad_lazy_glUniform1dv },
+	{ "glUniform1f", (GLADlazyproc*)&glad_glUniform1f, (GLADlazyproc)glad_lazy_glUniform1f },
+	{ "glUniform1fv", (GLADlazyproc*)&glad_glUniform1fv, (GLADlazyproc)glad_lazy_glUniform1fv },
+	{ "glUniform1i", (GLADlazyproc*)&glad_glUniform1i, (GLADlazyproc)glad_lazy_glUniform1i },
+	{ "glUniform1iv", (GLADlazyproc*)&glad_glUniform1iv, (GLADlazyproc)glad_lazy_glUniform1iv },
+	{ "glUniform1ui", (GLADlazyproc*)&glad_glUniform1ui, (GLADlazyproc)glad_lazy_glUniform1ui },
+	{ "glUniform1uiv", (GLADlazyproc*)&glad_glUniform1uiv, (GLADlazyproc)glad_lazy_glUniform1uiv },
+	{ "glUniform2d", (GLADlazyproc*)&glad_glUniform2d, (GLADlazyproc)glad_lazy_glUniform2d },
+	{ "glUniform2dv", (GLADlazyproc*)&glad_glUniform2dv, (GLADlazyproc)glad_lazy_glUniform2dv },
+	{ "glUniform2f", (GLADlazyproc*)&glad_glUniform2f, (GLADlazyproc)glad_lazy_glUniform2f },
+	{ "glUniform2fv", (GLADlazyproc*)&glad_glUniform2fv, (GLADlazyproc)glad_lazy_glUniform2fv },
+	{ "glUniform2i", (GLADlazyproc*)&glad_glUniform2i, (GLADlazyproc)glad_lazy_glUniform2i },
+	{ "glUniform2iv", (GLADlazyproc*)&glad_glUniform2iv, (GLADlazyproc)glad_lazy_glUniform2iv },
+	{ "glUniform2ui", (GLADlazyproc*)&glad_glUniform2ui, (GLADlazyproc)glad_lazy_glUniform2ui },
+	{ "glUniform2uiv", (GLADlazyproc*)&glad_glUniform2uiv, (GLADlazyproc)glad_lazy_glUniform2uiv },
+	{ "glUniform3d", (GLADlazyproc*)&glad_glUniform3d, (GLADlazyproc)glad_lazy_glUniform3d },
+	{ "glUniform3dv", (GLADlazyproc*)&glad_glUniform3dv, (GLADlazyproc)glad_lazy_glUniform3dv },
+	{ "glUniform3f", (GLADlazyproc*)&glad_glUniform3f, (GLADlazyproc)glad_lazy_glUniform3f },
+	{ "glUniform3fv", (GLADlazyproc*)&glad_glUniform3fv, (GLADlazyproc)glad_lazy_glUniform3fv },
+	{ "glUniform3i", (GLADlazyproc*)&glad_glUniform3i, (GLADlazyproc)glad_lazy_glUniform3i },
+	{ "glUniform3iv", (GLADlazyproc*)&glad_glUniform3iv, (GLADlazyproc)glad_lazy_glUniform3iv },
+	{ "glUniform3ui", (GLADlazyproc*)&glad_glUniform3ui, (GLADlazyproc)glad_lazy_glUniform3ui },
+	{ "glUniform3uiv", (GLADlazyproc*)&glad_glUniform3uiv, (GLADlazyproc)glad_lazy_glUniform3uiv },
+	{ "glUniform4d", (GLADlazyproc*)&glad_glUniform4d, (GLADlazyproc)glad_lazy_glUniform4d },
+	{ "glUniform4dv", (GLADlazyproc*)&glad_glUniform4dv, (GLADlazyproc)glad_lazy_glUniform4dv },
+	{ "glUniform4f", (GLADlazyproc*)&glad_glUniform4f, (GLADlazyproc)glad_lazy_glUniform4f },
+	{ "glUniform4fv", (GLADlazyproc*)&glad_glUniform4fv, (GLADlazyproc)glad_lazy_glUniform4fv },
+	{ "glUniform4i", (GLADlazyproc*)&glad_glUniform4i, (GLADlazyproc)glad_lazy_glUniform4i },
+	{ "glUniform4iv", (GLADlazyproc*)&glad_glUniform4iv, (GLADlazyproc)glad_lazy_glUniform4iv },
+	{ "glUniform4ui", (GLADlazyproc*)&glad_glUniform4ui, (GLADlazyproc)glad_lazy_glUniform4ui },
+	{ "glUniform4uiv", (GLADlazyproc*)&glad_glUniform4uiv, (GLADlazyproc)glad_lazy_glUniform4uiv },
+	{ "glUniformBlockBinding", (GLADlazyproc*)&glad_glUniformBlockBinding, (GLADlazyproc)glad_lazy_glUniformBlockBinding },
+	{ "glUniformMatrix2dv", (GLADlazyproc*)&glad_glUniformMatrix2dv, (GLADlazyproc)glad_lazy_glUniformMatrix2dv },
+	{ "glUniformMatrix2fv", (GLADlazyproc*)&glad_glUniformMatrix2fv, (GLADlazyproc)glad_lazy_glUniformMatrix2fv },
+	{ "glUniformMatrix2x3dv", (GLADlazyproc*)&glad_glUniformMatrix2x3dv, (GLADlazyproc)glad_lazy_glUniformMatrix2x3dv },
+	{ "glUniformMatrix2x3fv", (GLADlazyproc*)&glad_glUniformMatrix2x3fv, (GLADlazyproc)glad_lazy_glUniformMatrix2x3fv },
+	{ "glUniformMatrix2x4dv", (GLADlazyproc*)&glad_glUniformMatrix2x4dv, (GLADlazyproc)glad_lazy_glUniformMatrix2x4dv },
+	{ "glUniformMatrix2x4fv", (GLADlazyproc*)&glad_glUniformMatrix2x4fv, (GLADlazyproc)glad_lazy_glUniformMatrix2x4fv },
+	{ "glUniformMatrix3dv", (GLADlazyproc*)&glad_glUniformMatrix3dv, (GLADlazyproc)glad_lazy_glUniformMatrix3dv },
+	{ "glUniformMatrix3fv", (GLADlazyproc*)&glad_glUniformMatrix3fv, (GLADlazyproc)glad_lazy_glUniformMatrix3fv },
+	{ "glUniformMatrix3x2dv", (GLADlazyproc*)&glad_glUniformMatrix3x2dv, (GLADlazyproc)glad_lazy_glUniformMatrix3x2dv },
+	{ "glUniformMatrix3x2fv", (GLADlazyproc*)&glad_glUniformMatrix3x2fv, (GLADlazyproc)glad_lazy_glUniformMatrix3x2fv },
+	{ "glUniformMatrix3x4dv", (GLADlazyproc*)&glad_glUniformMatrix3x4dv, (GLADlazyproc)glad_lazy_glUniformMatrix3x4dv },
+	{ "glUniformMatrix3x4fv", (GLADlazyproc*)&glad_glUniformMatrix3x4fv, (GLADlazyproc)glad_lazy_glUniformMatrix3x4fv },
+	{ "glUniformMatrix4dv", (GLADlazyproc*)&glad_glUniformMatrix4dv, (GLADlazyproc)glad_lazy_glUniformMatrix4dv },
+	{ "glUniformMatrix4fv", (GLADlazyproc*)&glad_glUniformMatrix4fv, (GLADlazyproc)glad_lazy_glUniformMatrix4fv },
+	{ "glUniformMatrix4x2dv", (GLADlazyproc*)&glad_glUniformMatrix4x2dv, (GLADlazyproc)glad_lazy_glUniformMatrix4x2dv },
+	{ "glUniformMatrix4x2fv", (GLADlazyproc*)&glad_glUniformMatrix4x2fv, (GLADlazyproc)glad_lazy_glUniformMatrix4x2fv },
+	{ "glUniformMatrix4x3dv", (GLADlazyproc*)&glad_glUniformMatrix4x3dv, (GLADlazyproc)glad_lazy_glUniformMatrix4x3dv },
+	{ "glUniformMatrix4x3fv", (GLADlazyproc*)&glad_glUniformMatrix4x3fv, (GLADlazyproc)glad_lazy_glUniformMatrix4x3fv },
+	{ "glUniformSubroutinesuiv", (GLADlazyproc*)&glad_glUniformSubroutinesuiv, (GLADlazyproc)glad_lazy_glUniformSubroutinesuiv },
+	{ "glUnmapBuffer", (GLADlazyproc*)&glad_glUnmapBuffer, (GLADlazyproc)glad_lazy_glUnmapBuffer },
+	{ "glUseProgram", (GLADlazyproc*)&glad_glUseProgram, (GLADlazyproc)glad_lazy_glUseProgram },
+	{ "glUseProgramStages", (GLADlazyproc*)&glad_glUseProgramStages, (GLADlazyproc)glad_lazy_glUseProgramStages },
+	{ "glValidateProgram", (GLADlazyproc*)&glad_glValidateProgram, (GLADlazyproc)glad_lazy_glValidateProgram },
+	{ "glValidateProgramPipeline", (GLADlazyproc*)&glad_glValidateProgramPipeline, (GLADlazyproc)glad_lazy_glValidateProgramPipeline },
+	{ "glVertex2d", (GLADlazyproc*)&glad_glVertex2d, (GLADlazyproc)glad_lazy_glVertex2d },
+	{ "glVertex2dv", (GLADlazyproc*)&glad_glVertex2dv, (GLADlazyproc)glad_lazy_glVertex2dv },
+	{ "glVertex2f", (GLADlazyproc*)&glad_glVertex2f, (GLADlazyproc)glad_lazy_glVertex2f },
+	{ "glVertex2fv", (GLADlazyproc*)&glad_glVertex2fv, (GLADlazyproc)glad_lazy_glVertex2fv },
+	{ "glVertex2i", (GLADlazyproc*)&glad_glVertex2i, (GLADlazyproc)glad_lazy_glVertex2i },
+	{ "glVertex2iv", (GLADlazyproc*)&glad_glVertex2iv, (GLADlazyproc)glad_lazy_glVertex2iv },
+	{ "glVertex2s", (GLADlazyproc*)&glad_glVertex2s, (GLADlazyproc)glad_lazy_glVertex2s },
+	{ "glVertex2sv", (GLADlazyproc*)&glad_glVertex2sv, (GLADlazyproc)glad_lazy_glVertex2sv },
+	{ "glVertex3d", (GLADlazyproc*)&glad_glVertex3d, (GLADlazyproc)glad_lazy_glVertex3d },
+	{ "glVertex3dv", (GLADlazyproc*)&glad_glVertex3dv, (GLADlazyproc)glad_lazy_glVertex3dv },
+	{ "glVertex3f", (GLADlazyproc*)&glad_glVertex3f, (GLADlazyproc)glad_lazy_glVertex3f },
+	{ "glVertex3fv", (GLADlazyproc*)&glad_glVertex3fv, (GLADlazyproc)glad_lazy_glVertex3fv },
+	{ "glVertex3i", (GLADlazyproc*)&glad_glVertex3i, (GLADlazyproc)glad_lazy_glVertex3i },
+	{ "glVertex3iv", (GLADlazyproc*)&glad_glVertex3iv, (GLADlazyproc)glad_lazy_glVertex3iv },
+	{ "glVertex3s", (GLADlazyproc*)&glad_glVertex3s, (GLADlazyproc)glad_lazy_glVertex3s },
+	{ "glVertex3sv", (GLADlazyproc*)&glad_glVertex3sv, (GLADlazyproc)glad_lazy_glVertex3sv },
+	{ "glVertex4d", (GLADlazyproc*)&glad_glVertex4d, (GLADlazyproc)glad_lazy_glVertex4d },
+	{ "glVertex4dv", (GLADlazyproc*)&glad_glVertex4dv, (GLADlazyproc)glad_lazy_glVertex4dv },
+	{ "glVertex4f", (GLADlazyproc*)&glad_glVertex4f, (GLADlazyproc)glad_lazy_glVertex4f },
+	{ "glVertex4fv", (GLADlazyproc*)&glad_glVertex4fv, (GLADlazyproc)glad_lazy_glVertex4fv },
+	{ "glVertex4i", (GLADlazyproc*)&glad_glVertex4i, (GLADlazyproc)glad_lazy_glVertex4i },
+	{ "glVertex4iv", (GLADlazyproc*)&glad_glVertex4iv, (GLADlazyproc)glad_lazy_glVertex4iv },
+	{ "glVertex4s", (GLADlazyproc*)&glad_glVertex4s, (GLADlazyproc)glad_lazy_glVertex4s },
+	{ "glVertex4sv", (GLADlazyproc*)&glad_glVertex4sv, (GLADlazyproc)glad_lazy_glVertex4sv },
+	{ "glVertexAttrib1d", (GLADlazyproc*)&glad_glVertexAttrib1d, (GLADlazyproc)glad_lazy_glVertexAttrib1d },
+	{ "glVertexAttrib1dv", (GLADlazyproc*)&glad_glVertexAttrib1dv, (GLADlazyproc)glad_lazy_glVertexAttrib1dv },
+	{ "glVertexAttrib1f", (GLADlazyproc*)&glad_glVertexAttrib1f, (GLADlazyproc)glad_lazy_glVertexAttrib1f },
+	{ "glVertexAttrib1fv", (GLADlazyproc*)&glad_glVertexAttrib1fv, (GLADlazyproc)glad_lazy_glVertexAttrib1fv },
+	{ "glVertexAttrib1s", (GLADlazyproc*)&glad_glVertexAttrib1s, (GLADlazyproc)glad_lazy_glVertexAttrib1s },
+	{ "glVertexAttrib1sv", (GLADlazyproc*)&glad_glVertexAttrib1sv, (GLADlazyproc)glad_lazy_glVertexAttrib1sv },
+	{ "glVertexAttrib2d", (GLADlazyproc*)&glad_glVertexAttrib2d, (GLADlazyproc)glad_lazy_glVertexAttrib2d },
+	{ "glVertexAttrib2dv", (GLADlazyproc*)&glad_glVertexAttrib2dv, (GLADlazyproc)glad_lazy_glVertexAttrib2dv },
+	{ "glVertexAttrib2f", (GLADlazyproc*)&glad_glVertexAttrib2f, (GLADlazyproc)glad_lazy_glVertexAttrib2f },
+	{ "glVertexAttrib2fv", (GLADlazyproc*)&glad_glVertexAttrib2fv, (GLADlazyproc)glad_lazy_glVertexAttrib2fv },
+	{ "glVertexAttrib2s", (GLADlazyproc*)&glad_glVertexAttrib2s, (GLADlazyproc)glad_lazy_glVertexAttrib2s },
+	{ "glVertexAttrib2sv", (GLADlazyproc*)&glad_glVertexAttrib2sv, (GLADlazyproc)glad_lazy_glVertexAttrib2sv },
+	{ "glVertexAttrib3d", (GLADlazyproc*)&glad_glVertexAttrib3d, (GLADlazyproc)glad_lazy_glVertexAttrib3d },
+	{ "glVertexAttrib3dv", (GLADlazyproc*)&glad_glVertexAttrib3dv, (GLADlazyproc)glad_lazy_glVertexAttrib3dv },
+	{ "glVertexAttrib3f", (GLADlazyproc*)&glad_glVertexAttrib3f, (GLADlazyproc)glad_lazy_glVertexAttrib3f },
+	{ "glVertexAttrib3fv", (GLADlazyproc*)&glad_glVertexAttrib3fv, (GLADlazyproc)glad_lazy_glVertexAttrib3fv },
+	{ "glVertexAttrib3s", (GLADlazyproc*)&glad_glVertexAttrib3s, (GLADlazyproc)glad_lazy_glVertexAttrib3s },
+	{ "glVertexAttrib3sv", (GLADlazyproc*)&glad_glVertexAttrib3sv, (GLADlazyproc)glad_lazy_glVertexAttrib3sv },
+	{ "glVertexAttrib4Nbv", (GLADlazyproc*)&glad_glVertexAttrib4Nbv, (GLADlazyproc)glad_lazy_glVertexAttrib4Nbv },
+	{ "glVertexAttrib4Niv", (GLADlazyproc*)&glad_glVertexAttrib4Niv, (GLADlazyproc)glad_lazy_glVertexAttrib4Niv },
+	{ "glVertexAttrib4Nsv", (GLADlazyproc*)&glad_glVertexAttrib4Nsv, (GLADlazyproc)glad_lazy_glVertexAttrib4Nsv },
+	{ "glVertexAttrib4Nub", (GLADlazyproc*)&glad_glVertexAttrib4Nub, (GLADlazyproc)glad_lazy_glVertexAttrib4Nub },
+	{ "glVertexAttrib4Nubv", (GLADlazyproc*)&glad_glVertexAttrib4Nubv, (GLADlazyproc)glad_lazy_glVertexAttrib4Nubv },
+	{ "glVertexAttrib4Nuiv", (GLADlazyproc*)&glad_glVertexAttrib4Nuiv, (GLADlazyproc)glad_lazy_glVertexAttrib4Nuiv },
+	{ "glVertexAttrib4Nusv", (GLADlazyproc*)&glad_glVertexAttrib4Nusv, (GLADlazyproc)glad_lazy_glVertexAttrib4Nusv },
+	{ "glVertexAttrib4bv", (GLADlazyproc*)&glad_glVertexAttrib4bv, (GLADlazyproc)glad_lazy_glVertexAttrib4bv },
+	{ "glVertexAttrib4d", (GLADlazyproc*)&glad_glVertexAttrib4d, (GLADlazyproc)glad_lazy_glVertexAttrib4d },
+	{ "glVertexAttrib4dv", (GLADlazyproc*)&glad_glVertexAttrib4dv, (GLADlazyproc)glad_lazy_glVertexAttrib4dv },
+	{ "glVertexAttrib4f", (GLADlazyproc*)&glad_glVertexAttrib4f, (GLADlazyproc)glad_lazy_glVertexAttrib4f },
+	{ "glVertexAttrib4fv", (GLADlazyproc*)&glad_glVertexAttrib4fv, (GLADlazyproc)glad_lazy_glVertexAttrib4fv },
+	{ "glVertexAttrib4iv", (GLADlazyproc*)&glad_glVertexAttrib4iv, (GLADlazyproc)glad_lazy_glVertexAttrib4iv },
+	{ "glVertexAttrib4s", (GLADlazyproc*)&glad_glVertexAttrib4s, (GLADlazyproc)glad_lazy_glVertexAttrib4s },
+	{ "glVertexAttrib4sv", (GLADlazyproc*)&glad_glVertexAttrib4sv, (GLADlazyproc)glad_lazy_glVertexAttrib4sv },
+	{ "glVertexAttrib4ubv", (GLADlazyproc*)&glad_glVertexAttrib4ubv, (GLADlazyproc)glad_lazy_glVertexAttrib4ubv },
+	{ "glVertexAttrib4uiv", (GLADlazyproc*)&glad_glVertexAttrib4uiv, (GLADlazyproc)glad_lazy_glVertexAttrib4uiv },
+	{ "glVertexAttrib4usv", (GLADlazyproc*)&glad_glVertexAttrib4usv, (GLADlazyproc)glad_lazy_glVertexAttrib4usv },
+	{ "glVertexAttribBinding", (GLADlazyproc*)&glad_glVertexAttribBinding, (GLADlazyproc)glad_lazy_glVertexAttribBinding },
+	{ "glVertexAttribDivisor", (GLADlazyproc*)&glad_glVertexAttribDivisor, (GLADlazyproc)glad_lazy_glVertexAttribDivisor },
+	{ "glVertexAttribFormat", (GLADlazyproc*)&glad_glVertexAttribFormat, (GLADlazyproc)glad_lazy_glVertexAttribFormat },
+	{ "glVertexAttribI1i", (GLADlazyproc*)&glad_glVertexAttribI1i, (GLADlazyproc)glad_lazy_glVertexAttribI1i },
+	{ "glVertexAttribI1iv", (GLADlazyproc*)&glad_glVertexAttribI1iv, (GLADlazyproc)glad_lazy_glVertexAttribI1iv },
+	{ "glVertexAttribI1ui", (GLADlazyproc*)&glad_glVertexAttribI1ui, (GLADlazyproc)glad_lazy_glVertexAttribI1ui },
+	{ "glVertexAttribI1uiv", (GLADlazyproc*)&glad_glVertexAttribI1uiv, (GLADlazyproc)glad_lazy_glVertexAttribI1uiv },
+	{ "glVertexAttribI2i", (GLADlazyproc*)&glad_glVertexAttribI2i, (GLADlazyproc)glad_lazy_glVertexAttribI2i },
+	{ "glVertexAttribI2iv", (GLADlazyproc*)&glad_glVertexAttribI2iv, (GLADlazyproc)glad_lazy_glVertexAttribI2iv },
+	{ "glVertexAttribI2ui", (GLADlazyproc*)&glad_glVertexAttribI2ui, (GLADlazyproc)glad_lazy_glVertexAttribI2ui },
+	{ "glVertexAttribI2uiv", (GLADlazyproc*)&glad_glVertexAttribI2uiv, (GLADlazyproc)glad_lazy_glVertexAttribI2uiv },
+	{ "glVertexAttribI3i", (GLADlazyproc*)&glad_glVertexAttribI3i, (GLADlazyproc)glad_lazy_glVertexAttribI3i },
+	{ "glVertexAttribI3iv", (GLADlazyproc*)&glad_glVertexAttribI3iv, (GLADlazyproc)glad_lazy_glVertexAttribI3iv },
+	{ "glVertexAttribI3ui", (GLADlazyproc*)&glad_glVertexAttribI3ui, (GLADlazyproc)glad_lazy_glVertexAttribI3ui },
+	{ "glVertexAttribI3uiv", (GLADlazyproc*)&glad_glVertexAttribI3uiv, (GLADlazyproc)glad_lazy_glVertexAttribI3uiv },
+	{ "glVertexAttribI4bv", (GLADlazyproc*)&glad_glVertexAttribI4bv, (GLADlazyproc)glad_lazy_glVertexAttribI4bv },
+	{ "glVertexAttribI4i", (GLADlazyproc*)&glad_glVertexAttribI4i, (GLADlazyproc)glad_lazy_glVertexAttribI4i },
+	{ "glVertexAttribI4iv", (GLADlazyproc*)&glad_glVertexAttribI4iv, (GLADlazyproc)glad_lazy_glVertexAttribI4iv },
+	{ "glVertexAttribI4sv", (GLADlazyproc*)&glad_glVertexAttribI4sv, (GLADlazyproc)glad_lazy_glVertexAttribI4sv },
+	{ "glVertexAttribI4ubv", (GLADlazyproc*)&glad_glVertexAttribI4ubv, (GLADlazyproc)glad_lazy_glVertexAttribI4ubv },
+	{ "glVertexAttribI4ui", (GLADlazyproc*)&glad_glVertexAttribI4ui, (GLADlazyproc)glad_lazy_glVertexAttribI4ui },
+	{ "glVertexAttribI4uiv", (GLADlazyproc*)&glad_glVertexAttribI4uiv, (GLADlazyproc)glad_lazy_glVertexAttribI4uiv },
+	{ "glVertexAttribI4usv", (GLADlazyproc*)&glad_glVertexAttribI4usv, (GLADlazyproc)glad_lazy_glVertexAttribI4usv },
+	{ "glVertexAttribIFormat", (GLADlazyproc*)&glad_glVertexAttribIFormat, (GLADlazyproc)glad_lazy_glVertexAttribIFormat },
+	{ "glVertexAttribIPointer", (GLADlazyproc*)&glad_glVertexAttribIPointer, (GLADlazyproc)glad_lazy_glVertexAttribIPointer },
+	{ "glVertexAttribL1d", (GLADlazyproc*)&glad_glVertexAttribL1d, (GLADlazyproc)glad_lazy_glVertexAttribL1d },
+	{ "glVertexAttribL1dv", (GLADlazyproc*)&glad_glVertexAttribL1dv, (GLADlazyproc)glad_lazy_glVertexAttribL1dv },
+	{ "glVertexAttribL2d", (GLADlazyproc*)&glad_glVertexAttribL2d, (GLADlazyproc)glad_lazy_glVertexAttribL2d },
+	{ "glVertexAttribL2dv", (GLADlazyproc*)&glad_glVertexAttribL2dv, (GLADlazyproc)glad_lazy_glVertexAttribL2dv },
+	{ "glVertexAttribL3d", (GLADlazyproc*)&glad_glVertexAttribL3d, (GLADlazyproc)glad_lazy_glVertexAttribL3d },
+	{ "glVertexAttribL3dv", (GLADlazyproc*)&glad_glVertexAttribL3dv, (GLADlazyproc)glad_lazy_glVertexAttribL3dv },
+	{ "glVertexAttribL4d", (GLADlazyproc*)&glad_glVertexAttribL4d, (GLADlazyproc)glad_lazy_glVertexAttribL4d },
+	{ "glVertexAttribL4dv", (GLADlazyproc*)&glad_glVertexAttribL4dv, (GLADlazyproc)glad_lazy_glVertexAttribL4dv },
+	{ "glVertexAttribLFormat", (GLADlazyproc*)&glad_glVertexAttribLFormat, (GLADlazyproc)glad_lazy_glVertexAttribLFormat },
+	{ "glVertexAttribLPointer", (GLADlazyproc*)&glad_glVertexAttribLPointer, (GLADlazyproc)glad_lazy_glVertexAttribLPointer },
+	{ "glVertexAttribP1ui", (GLADlazyproc*)&glad_glVertexAttribP1ui, (GLADlazyproc)glad_lazy_glVertexAttribP1ui },
+	{ "glVertexAttribP1uiv", (GLADlazyproc*)&glad_glVertexAttribP1uiv, (GLADlazyproc)glad_lazy_glVertexAttribP1uiv },
+	{ "glVertexAttribP2ui", (GLADlazyproc*)&glad_glVertexAttribP2ui, (GLADlazyproc)glad_lazy_glVertexAttribP2ui },
+	{ "glVertexAttribP2uiv", (GLADlazyproc*)&glad_glVertexAttribP2uiv, (GLADlazyproc)glad_lazy_glVertexAttribP2uiv },
+	{ "glVertexAttribP3ui", (GLADlazyproc*)&glad_glVertexAttribP3ui, (GLADlazyproc)glad_lazy_glVertexAttribP3ui },
+	{ "glVertexAttribP3uiv", (GLADlazyproc*)&glad_glVertexAttribP3uiv, (GLADlazyproc)glad_lazy_glVertexAttribP3uiv },
+	{ "glVertexAttribP4ui", (GLADlazyproc*)&glad_glVertexAttribP4ui, (GLADlazyproc)glad_lazy_glVertexAttribP4ui },
+	{ "glVertexAttribP4uiv", (GLADlazyproc*)&glad_glVertexAttribP4uiv, (GLADlazyproc)glad_lazy_glVertexAttribP4uiv },
+	{ "glVertexAttribPointer", (GLADlazyproc*)&glad_glVertexAttribPointer, (GLADlazyproc)glad_lazy_glVertexAttribPointer },
+	{ "glVertexBindingDivisor", (GLADlazyproc*)&glad_glVertexBindingDivisor, (GLADlazyproc)glad_lazy_glVertexBindingDivisor },
+	{ "glVertexP2ui", (GLADlazyproc*)&glad_glVertexP2ui, (GLADlazyproc)glad_lazy_glVertexP2ui },
+	{ "glVertexP2uiv", (GLADlazyproc*)&glad_glVertexP2uiv, (GLADlazyproc)glad_lazy_glVertexP2uiv },
+	{ "glVertexP3ui", (GLADlazyproc*)&glad_glVertexP3ui, (GLADlazyproc)glad_lazy_glVertexP3ui },
+	{ "glVertexP3uiv", (GLADlazyproc*)&glad_glVertexP3uiv, (GLADlazyproc)glad_lazy_glVertexP3uiv },
+	{ "glVertexP4ui", (GLADlazyproc*)&glad_glVertexP4ui, (GLADlazyproc)glad_lazy_glVertexP4ui },
+	{ "glVertexP4uiv", (GLADlazyproc*)&glad_glVertexP4uiv, (GLADlazyproc)glad_lazy_glVertexP4uiv },
+	{ "glVertexPointer", (GLADlazyproc*)&glad_glVertexPointer, (GLADlazyproc)glad_lazy_glVertexPointer },
+	{ "glViewport", (GLADlazyproc*)&glad_glViewport, (GLADlazyproc)glad_lazy_glViewport },
+	{ "glViewportArrayv", (GLADlazyproc*)&glad_glViewportArrayv, (GLADlazyproc)glad_lazy_glViewportArrayv },
+	{ "glViewportIndexedf", (GLADlazyproc*)&glad_glViewportIndexedf, (GLADlazyproc)glad_lazy_glViewportIndexedf },
+	{ "glViewportIndexedfv", (GLADlazyproc*)&glad_glViewportIndexedfv, (GLADlazyproc)glad_lazy_glViewportIndexedfv },
+	{ "glWaitSync", (GLADlazyproc*)&glad_glWaitSync, (GLADlazyproc)glad_lazy_glWaitSync },
+	{ "glWindowPos2d", (GLADlazyproc*)&glad_glWindowPos2d, (GLADlazyproc)glad_lazy_glWindowPos2d },
+	{ "glWindowPos2dv", (GLADlazyproc*)&glad_glWindowPos2dv, (GLADlazyproc)glad_lazy_glWindowPos2dv },
+	{ "glWindowPos2f", (GLADlazyproc*)&glad_glWindowPos2f, (GLADlazyproc)glad_lazy_glWindowPos2f },
+	{ "glWindowPos2fv", (GLADlazyproc*)&glad_glWindowPos2fv, (GLADlazyproc)glad_lazy_glWindowPos2fv },
+	{ "glWindowPos2i", (GLADlazyproc*)&glad_glWindowPos2i, (GLADlazyproc)glad_lazy_glWindowPos2i },
+	{ "glWindowPos2iv", (GLADlazyproc*)&glad_glWindowPos2iv, (GLADlazyproc)glad_lazy_glWindowPos2iv },
+	{ "glWindowPos2s", (GLADlazyproc*)&glad_glWindowPos2s, (GLADlazyproc)glad_lazy_glWindowPos2s },
+	{ "glWindowPos2sv", (GLADlazyproc*)&glad_glWindowPos2sv, (GLADlazyproc)glad_lazy_glWindowPos2sv },
+	{ "glWindowPos3d", (GLADlazyproc*)&glad_glWindowPos3d, (GLADlazyproc)glad_lazy_glWindowPos3d },
+	{ "glWindowPos3dv", (GLADlazyproc*)&glad_glWindowPos3dv, (GLADlazyproc)glad_lazy_glWindowPos3dv },
+	{ "glWindowPos3f", (GLADlazyproc*)&glad_glWindowPos3f, (GLADlazyproc)glad_lazy_glWindowPos3f },
+	{ "glWindowPos3fv", (GLADlazyproc*)&glad_glWindowPos3fv, (GLADlazyproc)glad_lazy_glWindowPos3fv },
+	{ "glWindowPos3i", (GLADlazyproc*)&glad_glWindowPos3i, (GLADlazyproc)glad_lazy_glWindowPos3i },
+	{ "glWindowPos3iv", (GLADlazyproc*)&glad_glWindowPos3iv, (GLADlazyproc)glad_lazy_glWindowPos3iv },
+	{ "glWindowPos3s", (GLADlazyproc*)&glad_glWindowPos3s, (GLADlazyproc)glad_lazy_glWindowPos3s },
+	{ "glWindowPos3sv", (GLADlazyproc*)&glad_glWindowPos3sv, (GLADlazyproc)glad_lazy_glWindowPos3sv },
+	{ "glBufferStorage", (GLADlazyproc*)&glad_glBufferStorage, (GLADlazyproc)glad_lazy_glBufferStorage },
+};
+static int *const glad_lazy_flags[] = {
+	&GLAD_GL_VERSION_1_0,
+	&GLAD_GL_VERSION_1_1,
+	&GLAD_GL_VERSION_1_2,
+	&GLAD_GL_VERSION_1_3,
+	&GLAD_GL_VERSION_1_4,
+	&GLAD_GL_VERSION_1_5,
+	&GLAD_GL_VERSION_2_0,
+	&GLAD_GL_VERSION_2_1,
+	&GLAD_GL_VERSION_3_0,
+	&GLAD_GL_VERSION_3_1,
+	&GLAD_GL_VERSION_3_2,
+	&GLAD_GL_VERSION_3_3,
+	&GLAD_GL_VERSION_4_0,
+	&GLAD_GL_VERSION_4_1,
+	&GLAD_GL_VERSION_4_2,
+	&GLAD_GL_VERSION_4_3,
+	&GLAD_GL_ARB_buffer_storage,
+};
+
+static void glad_lazy_resolve(int index) {
+    const struct gladLazyProc *proc = &glad_lazy_procs[index];
+    /* left NULL if missing, as gladLoadGLLoader() would */
+    *proc->ptr = glad_lazy_load != NULL ? (GLADlazyproc)glad_lazy_load(proc->name) : NULL;
+}
+
+static void glad_lazy_stub_all(void) {
+    size_t i;
+    for (i = 0; i < sizeof(glad_lazy_procs) / sizeof(glad_lazy_procs[0]); i++) {
+        *glad_lazy_procs[i].ptr = glad_lazy_procs[i].stub;
+    }
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+    glad_lazy_load = load;
+    glad_lazy_stub_all();
+    GLVersion.major = 0; GLVersion.minor = 0;
+    if(glGetString(GL_VERSION) == NULL) return 0;
+    find_coreGL();
+    if (!find_extensionsGL()) return 0;
+    return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLazy(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoaderLazy(&get_proc);
+    }
+
+    return status;
+}
+
+gladGLLazyContext *gladLazyContextCreate(void) {
+    return (gladGLLazyContext*)calloc(1, sizeof(gladGLLazyContext));
+}
+
+void gladLazyContextDestroy(gladGLLazyContext *context) {
+    if (context == glad_lazy_current) {
+        glad_lazy_current = NULL;
+    }
+    free(context);
+}
+
+void gladLazyMakeCurrent(gladGLLazyContext *context) {
+    size_t i;
+    const size_t num_procs = sizeof(glad_lazy_procs) / sizeof(glad_lazy_procs[0]);
+    const size_t num_flags = sizeof(glad_lazy_flags) / sizeof(glad_lazy_flags[0]);
+    gladGLLazyContext *old = glad_lazy_current;
+
+    if (context == old) return;
+    if (old != NULL) {
+        old->load = glad_lazy_load;
+        old->version = GLVersion;
+        for (i = 0; i < num_flags; i++) {
+            old->flags[i] = *glad_lazy_flags[i];
+        }
+        /* stubs are kept as NULL, so nothing unresolved is carried over */
+        for (i = 0; i < num_procs; i++) {
+            old->procs[i] = *glad_lazy_procs[i].ptr == glad_lazy_procs[i].stub ? NULL : *glad_lazy_procs[i].ptr;
+        }
+    }
+
+    glad_lazy_current = context;
+    if (context == NULL || context->load == NULL) {
+        /* not loaded yet; gladLoadGLLoaderLazy() is next */
+        return;
+    }
+    glad_lazy_load = context->load;
+    GLVersion = context->version;
+    for (i = 0; i < num_flags; i++) {
+        *glad_lazy_flags[i] = context->flags[i];
+    }
+    for (i = 0; i < num_procs; i++) {
+        *glad_lazy_procs[i].ptr = context->procs[i] != NULL ? context->procs[i] : glad_lazy_procs[i].stub;
+    }
+}
+
@@ -7,16 +7,16 @@
     APIs: gl=4.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=4.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=4.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.3&extensions=GL_ARB_buffer_storage
 */
 
 
@@ -91,6 +91,23 @@ GLAPI struct gladGLversionStruct GLVersion;
 GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
+
+/* Like gladLoadGL() and gladLoadGLLoader(), but only the version and
+ * extensions are found up front: every function pointer is set to a stub
+ * that looks the function up on its first call. Pointers are never NULL
+ * before then, so check the GLAD_GL_* flags rather than the pointers. */
+GLAPI int gladLoadGLLazy(void);
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* A cache of the pointers looked up for one context, for drivers whose
+ * pointers differ from context to context. Make one current right after
+ * its GL context, then the first time call gladLoadGLLoaderLazy(); after
+ * that, making it current again brings back what was looked up, and
+ * whatever wasn't is a stub again. */
+typedef struct gladGLLazyContext gladGLLazyContext;
+GLAPI gladGLLazyContext *gladLazyContextCreate(void);
+GLAPI void gladLazyContextDestroy(gladGLLazyContext *context);
+GLAPI void gladLazyMakeCurrent(gladGLLazyContext *context);
 GLAPI void* get_proc(const char *namez);
 GLAPI int open_gl(void);
 GLAPI void close_gl(void);
@@ -1875,6 +1892,13 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_MAX_VERTEX_ATTRIB_BINDINGS 0x82DA
 #define GL_VERTEX_BINDING_BUFFER 0x8F4F
 #define GL_DISPLAY_LIST 0x82E7
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
 GLAPI int GLAD_GL_VERSION_1_0;
@@ -4678,6 +4702,13 @@ typedef void (APIENTRYP PFNGLGETOBJECTPTRLABELPROC)(const void *ptr, GLsizei buf
 GLAPI PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel;
 #define glGetObjectPtrLabel glad_glGetObjectPtrLabel
 #endif
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+GLAPI int GLAD_GL_ARB_buffer_storage;
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
+#endif
 
 #ifdef __cplusplus
 }
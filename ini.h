@@ -19,10 +19,17 @@ typedef struct ini_t ini_t;
 
 ini_t* ini_create( void* memctx );
 ini_t* ini_load( char const* data, void* memctx );
+ini_t* ini_load_lazy( char const* data, void* memctx );
 
 int ini_save( ini_t const* ini, char* data, int size );
+int ini_save_patch( ini_t const* ini, char const* original, char* data, int size );
 void ini_destroy( ini_t* ini );
 
+int ini_dirty( ini_t const* ini );
+int ini_section_dirty( ini_t const* ini, int section );
+int ini_property_dirty( ini_t const* ini, int section, int property );
+void ini_dirty_clear( ini_t* ini );
+
 int ini_section_count( ini_t const* ini );
 char const* ini_section_name( ini_t const* ini, int section );
 
@@ -159,11 +166,12 @@ If no custom allocator is defined, ini.h will default to `malloc` and `free` fro
 
 ### Custom C runtime function
 
-The library makes use of three additional functions from the C runtime library, and for full flexibility, it allows you 
+The library makes use of four additional functions from the C runtime library, and for full flexibility, it allows you 
 to substitute them for your own. Here's an example:
 
     #define INI_IMPLEMENTATION
     #define INI_MEMCPY( dst, src, cnt ) ( my_memcpy_func( dst, src, cnt ) )
+    #define INI_MEMCMP( s1, s2, cnt ) ( my_memcmp_func( s1, s2, cnt ) )
     #define INI_STRLEN( s ) ( my_strlen_func( s ) )
     #define INI_STRNICMP( s1, s2, cnt ) ( my_strnicmp_func( s1, s2, cnt ) )
     #include "ini.h"
@@ -192,6 +200,23 @@ The instance can be manipulated with other API calls to enumerate sections/prope
 longer needed, it can be destroyed by calling `ini_destroy`. `memctx` is a pointer to user defined data which will be 
 passed through to the custom INI_MALLOC/INI_FREE calls. It can be NULL if no user defined data is needed.
 
+All names and values are stored in a few large blocks, usually just one sized from `data`, rather than being allocated 
+one by one, and sections and properties are entered into a hash table so that `ini_find_section` and `ini_find_property` 
+take the same time however many there are. Trailing whitespace is removed from property names, as it is from values.
+
+
+ini_load_lazy
+-------------
+
+    ini_t* ini_load_lazy( char const* data, void* memctx )
+
+Like `ini_load`, but only finds the sections in `data` up front. The properties of each section are parsed the first 
+time anything asks for them, so a program which only looks at a few sections of a large file does not pay for the rest.
+`data` is not copied, and must stay unchanged until `ini_destroy` is called. Because the `ini_t const*` functions may 
+parse a section, they must not be called on the same instance from several threads at once. The same goes for an 
+instance from `ini_load` after a section or property has been removed or renamed, as the next lookup rebuilds the hash 
+table.
+
 
 ini_save
 --------
@@ -205,6 +230,46 @@ required, only part of the ini-file string will be written. `ini_save` still ret
 written had the buffer been large enough.
 
 
+ini_save_patch
+--------------
+
+    int ini_save_patch( ini_t const* ini, char const* original, char* data, int size )
+
+Like `ini_save`, but instead of writing the whole ini file afresh, it patches `original`, which must be the text that 
+`ini` was loaded from, with the changes made since loading. Comments, blank lines, spacing and the order of the file are
+kept. Changed names and values are replaced where they are, removed properties and sections lose their lines, 
+properties added to a loaded section go after its last property, and added sections go at the end. With nothing 
+changed, the result is `original` itself. `original` stays the reference for every call, so keep it around, rather than
+the text from a previous `ini_save_patch`, and the result still has all the changes. If `original` is NULL, this is the 
+same as `ini_save`.
+
+
+ini_dirty
+---------
+
+    int ini_dirty( ini_t const* ini )
+    int ini_section_dirty( ini_t const* ini, int section )
+    int ini_property_dirty( ini_t const* ini, int section, int property )
+    void ini_dirty_clear( ini_t* ini )
+
+`ini_dirty` returns non-zero if anything has been added, removed or changed since the ini was created or loaded, or
+since the last call to `ini_dirty_clear`. `ini_section_dirty` does the same for the name and properties of one section, 
+and `ini_property_dirty` for one property. Setting a value to the one it already has is not counted as a change. 
+
+A program which saves settings as they are changed can use these to coalesce the writes, saving only once nothing has
+changed for a little while, for example from a timer on whichever thread owns the `ini_t`:
+
+    if( ini_dirty( ini ) && now - last_change > 500 )
+        {
+        int size = ini_save_patch( ini, original, NULL, 0 );
+        char* data = (char*) malloc( size );
+        ini_save_patch( ini, original, data, size );
+        write_settings_file( data, size - 1 );
+        free( data );
+        ini_dirty_clear( ini );
+        }
+
+
 ini_destroy
 -----------
 
@@ -273,8 +338,9 @@ ini_find_section
 
 Finds the section with the specified name, and returns its index. `name_length` specifies the number of characters in
 `name`, which does not have to be zero-terminated. If `name_length` is zero, the length is determined automatically, but
-in this case `name` has to be zero-terminated. If no section with the specified name could be found, the value
-`INI_NOT_FOUND` is returned.
+in this case `name` has to be zero-terminated. Names are compared whole, ignoring case. If several sections have the 
+specified name, the one with the lowest index is returned. If no section with the specified name could be found, the 
+value `INI_NOT_FOUND` is returned.
 
 
 ini_find_property
@@ -284,7 +350,8 @@ ini_find_property
 
 Finds the property with the specified name, within the section with the specified index, and returns the index of the 
 property. `name_length` specifies the number of characters in `name`, which does not have to be zero-terminated. If 
-`name_length` is zero, the length is determined automatically, but in this case `name` has to be zero-terminated. If no 
+`name_length` is zero, the length is determined automatically, but in this case `name` has to be zero-terminated. Names 
+are compared whole, ignoring case, and the lowest index is returned if several properties have the specified name. If no 
 property with the specified name could be found within the specified section, the value `INI_NOT_FOUND` is  returned.
 `section` must be non-negative and less than the value returned by `ini_section_count`, or `ini_find_property` will 
 return `INI_NOT_FOUND`. The defined constant `INI_GLOBAL_SECTION` can be used to indicate the global section.
@@ -336,7 +403,8 @@ the value returned by `ini_section_count`, and `property` must be non-negative a
 `ini_property_count`. The defined constant `INI_GLOBAL_SECTION` can be used to indicate the global section. Note that 
 removing a property will shuffle property indices within the specified section, so that property indices you may have 
 stored will no longer indicate the same property as it did before the remove. Use the find functions to update your 
-indices.
+indices. The memory used by removed sections and properties, and by replaced names and values, is only released by
+`ini_destroy`.
 
 
 ini_section_name_set
@@ -386,6 +454,7 @@ the length is determined automatically, but in this case `value` has to be zero-
 #undef INI_IMPLEMENTATION
 
 #define INITIAL_CAPACITY ( 256 )
+#define INI_BLOCK_SIZE ( 4096 )
 
 #undef _CRT_NONSTDC_NO_DEPRECATE 
 #define _CRT_NONSTDC_NO_DEPRECATE 
@@ -404,6 +473,11 @@ the length is determined automatically, but in this case `value` has to be zero-
     #define INI_MEMCPY( dst, src, cnt ) ( memcpy( dst, src, cnt ) )
 #endif 
 
+#ifndef INI_MEMCMP
+    #include <string.h>
+    #define INI_MEMCMP( s1, s2, cnt ) ( memcmp( s1, s2, cnt ) )
+#endif 
+
 #ifndef INI_STRLEN
     #include <string.h>
     #define INI_STRLEN( s ) ( strlen( s ) )
@@ -420,20 +494,51 @@ the length is determined automatically, but in this case `value` has to be zero-
 #endif 
 
 
-struct ini_internal_section_t
+/* All strings, and the property arrays of each section, are carved out of a list of large blocks which are only freed
+   by ini_destroy. Strings that are replaced are not reclaimed until then. */
+struct ini_internal_block_t
     {
-    char name[ 32 ];
-    char* name_large;
+    struct ini_internal_block_t* next;
+    size_t size;
+    size_t used;
     };
 
 
 struct ini_internal_property_t
     {
+    char* name;
+    int name_length;
+    char* value;
+    int value_length;
+    int value_capacity;
+    int source; /* offset in the loaded text, or -1 if added since */
+    int changed; /* INI_INTERNAL_NAME_CHANGED and INI_INTERNAL_VALUE_CHANGED, relative to the loaded text */
+    unsigned int modified; /* ini->generation when last changed, or 0 */
+    };
+
+
+struct ini_internal_section_t
+    {
+    char* name;
+    int name_length;
+    struct ini_internal_property_t* properties;
+    int property_count;
+    int property_capacity;
+    char const* pending; /* for ini_load_lazy, the unparsed properties of the section, or NULL once parsed */
+    int source; /* offset of the header in the loaded text, INI_INTERNAL_SOURCE_START or -1 */
+    int changed; /* INI_INTERNAL_NAME_CHANGED */
+    unsigned int modified;
+    };
+
+
+/* Open addressing hash table mapping section names to section indices, and section index + property name to property
+   indices. Only the first of several equal names is entered, so lookups find the lowest index as a linear search would.
+   A slot with section < 0 is empty, and property < 0 marks a section entry. */
+struct ini_internal_entry_t
+    {
+    unsigned int hash;
     int section;
-    char name[ 32 ];
-    char* name_large;
-    char value[ 64 ];
-    char* value_large;
+    int property;
     };
 
 
@@ -443,134 +548,485 @@ struct ini_t
     int section_capacity;
     int section_count;
 
-    struct ini_internal_property_t* properties;
-    int property_capacity;
-    int property_count;
+    struct ini_internal_entry_t* index;
+    int index_capacity;
+    int index_count;
+    int index_dirty; /* set when a remove or rename invalidates the index, which is then rebuilt by the next lookup */
+
+    struct ini_internal_block_t* blocks;
+
+    char const* source; /* the text being loaded, which ini_load_lazy keeps using */
+
+    /* incremented by every change, and the value it had at the last ini_dirty_clear */
+    unsigned int generation;
+    unsigned int saved_generation;
 
     void* memctx;
     };
 
 
-static int ini_internal_property_index( ini_t const* ini, int section, int property )
+#define INI_INTERNAL_SOURCE_START ( -2 ) /* the global section of a loaded text, which has no header */
+#define INI_INTERNAL_NAME_CHANGED ( 1 )
+#define INI_INTERNAL_VALUE_CHANGED ( 2 )
+
+
+static struct ini_internal_block_t* ini_internal_block_add( ini_t* ini, size_t size )
     {
+    struct ini_internal_block_t* block;
+
+    block = (struct ini_internal_block_t*) INI_MALLOC( ini->memctx, sizeof( *block ) + size );
+    block->size = size;
+    block->used = 0;
+
+    /* an allocation too big for a normal block gets one of its own, behind the one still being filled */
+    if( ini->blocks && size > INI_BLOCK_SIZE )
+        {
+        block->next = ini->blocks->next;
+        ini->blocks->next = block;
+        }
+    else
+        {
+        block->next = ini->blocks;
+        ini->blocks = block;
+        }
+    return block;
+    }
+
+
+static void* ini_internal_alloc( ini_t* ini, size_t size, size_t align )
+    {
+    struct ini_internal_block_t* block;
+    size_t pad;
+    char* data;
+
+    block = ini->blocks;
+    if( block )
+        {
+        data = (char*)( block + 1 ) + block->used;
+        pad = ( align - ( (size_t) data & ( align - 1 ) ) ) & ( align - 1 );
+        if( block->size - block->used >= size + pad ) 
+            {
+            block->used += size + pad;
+            return data + pad;
+            }
+        }
+
+    block = ini_internal_block_add( ini, size + align > INI_BLOCK_SIZE ? size + align : INI_BLOCK_SIZE );
+    data = (char*)( block + 1 );
+    pad = ( align - ( (size_t) data & ( align - 1 ) ) ) & ( align - 1 );
+    block->used = size + pad;
+    return data + pad;
+    }
+
+
+static char* ini_internal_string( ini_t* ini, char const* str, int length )
+    {
+    char* copy;
+
+    copy = (char*) ini_internal_alloc( ini, (size_t) length + 1, 1 );
+    INI_MEMCPY( copy, str, (size_t) length );
+    copy[ length ] = '\0';
+    return copy;
+    }
+
+
+static unsigned int ini_internal_hash( char const* name, int length )
+    {
+    unsigned int hash;
+    unsigned int c;
     int i;
+
+    hash = 2166136261u;
+    for( i = 0; i < length; ++i )
+        {
+        c = (unsigned char) name[ i ];
+        if( c >= 'A' && c <= 'Z' ) c += 'a' - 'A';
+        hash = ( hash ^ c ) * 16777619u;
+        }
+    return hash;
+    }
+
+
+static unsigned int ini_internal_property_hash( unsigned int name_hash, int section )
+    {
+    return name_hash ^ ( (unsigned int) section + 1u ) * 2654435761u;
+    }
+
+
+static int ini_internal_names_equal( char const* a, int a_length, char const* b, int b_length )
+    {
+    return a_length == b_length && ( a_length == 0 || INI_STRNICMP( a, b, (size_t) a_length ) == 0 );
+    }
+
+
+/* Returns the slot holding the given key, or the empty slot where it would go */
+static struct ini_internal_entry_t* ini_internal_index_slot( ini_t const* ini, unsigned int hash, int section, 
+    int property, char const* name, int length )
+    {
+    struct ini_internal_entry_t* entry;
+    struct ini_internal_section_t const* s;
+    unsigned int mask;
+    unsigned int i;
+
+    mask = (unsigned int) ini->index_capacity - 1;
+    for( i = hash & mask; ; i = ( i + 1 ) & mask )
+        {
+        entry = &ini->index[ i ];
+        if( entry->section < 0 ) return entry;
+        if( entry->hash != hash ) continue;
+        if( property < 0 )
+            {
+            if( entry->property >= 0 ) continue;
+            s = &ini->sections[ entry->section ];
+            if( ini_internal_names_equal( name, length, s->name, s->name_length ) ) return entry;
+            }
+        else
+            {
+            if( entry->property < 0 || entry->section != section ) continue;
+            s = &ini->sections[ section ];
+            if( ini_internal_names_equal( name, length, s->properties[ entry->property ].name, 
+                s->properties[ entry->property ].name_length ) ) return entry;
+            }
+        }
+    }
+
+
+static void ini_internal_index_rebuild( ini_t* ini, int capacity );
+
+
+/* Enters a section (property < 0) or a property into the index, unless an equal name is already there */
+static void ini_internal_index_add( ini_t* ini, int section, int property )
+    {
+    struct ini_internal_entry_t* entry;
+    struct ini_internal_section_t const* s;
+    char const* name;
+    int length;
+    unsigned int hash;
+
+    if( ini->index_dirty ) return;
+    if( ( ini->index_count + 1 ) * 2 > ini->index_capacity )
+        {
+        ini_internal_index_rebuild( ini, ini->index_capacity * 2 );
+        return; /* the rebuild has already entered it */
+        }
+
+    s = &ini->sections[ section ];
+    name = property < 0 ? s->name : s->properties[ property ].name;
+    length = property < 0 ? s->name_length : s->properties[ property ].name_length;
+    hash = ini_internal_hash( name, length );
+    if( property >= 0 ) hash = ini_internal_property_hash( hash, section );
+    entry = ini_internal_index_slot( ini, hash, section, property, name, length );
+    if( entry->section < 0 )
+        {
+        entry->hash = hash;
+        entry->section = section;
+        entry->property = property;
+        ++ini->index_count;
+        }
+    }
+
+
+static void ini_internal_index_rebuild( ini_t* ini, int capacity )
+    {
+    int entries;
+    int s;
     int p;
+    int i;
 
-    if( ini && section >= 0 && section < ini->section_count )
+    entries = ini->section_count;
+    for( s = 0; s < ini->section_count; ++s ) entries += ini->sections[ s ].property_count;
+    while( capacity < entries * 2 + 2 ) capacity *= 2;
+
+    if( capacity != ini->index_capacity )
+        {
+        if( ini->index ) INI_FREE( ini->memctx, ini->index );
+        ini->index = (struct ini_internal_entry_t*) INI_MALLOC( ini->memctx, capacity * sizeof( ini->index[ 0 ] ) );
+        ini->index_capacity = capacity;
+        }
+    for( i = 0; i < capacity; ++i ) ini->index[ i ].section = -1;
+    ini->index_count = 0;
+    ini->index_dirty = 0;
+
+    for( s = 0; s < ini->section_count; ++s )
+        {
+        ini_internal_index_add( ini, s, -1 );
+        for( p = 0; p < ini->sections[ s ].property_count; ++p )
+            ini_internal_index_add( ini, s, p );
+        }
+    }
+
+
+/* source is the offset of the property in the loaded text, or -1 for one added through the API */
+static int ini_internal_property_add( ini_t* ini, int section, char const* name, int name_length, 
+    char const* value, int value_length, int source )
+    {
+    struct ini_internal_section_t* s;
+    struct ini_internal_property_t* new_properties;
+    struct ini_internal_property_t* property;
+
+    s = &ini->sections[ section ];
+    if( s->property_count >= s->property_capacity )
+        {
+        s->property_capacity = s->property_capacity ? s->property_capacity * 2 : 8;
+        new_properties = (struct ini_internal_property_t*) ini_internal_alloc( ini, 
+            s->property_capacity * sizeof( s->properties[ 0 ] ), sizeof( void* ) );
+        if( s->property_count ) 
+            INI_MEMCPY( new_properties, s->properties, s->property_count * sizeof( s->properties[ 0 ] ) );
+        s->properties = new_properties;
+        }
+
+    property = &s->properties[ s->property_count ];
+    property->name = ini_internal_string( ini, name, name_length );
+    property->name_length = name_length;
+    property->value = ini_internal_string( ini, value, value_length );
+    property->value_length = value_length;
+    property->value_capacity = value_length;
+    property->source = source;
+    property->changed = 0;
+    property->modified = 0;
+    if( source < 0 ) property->modified = s->modified = ++ini->generation;
+    ++s->property_count;
+    ini_internal_index_add( ini, section, s->property_count - 1 );
+    return s->property_count - 1;
+    }
+
+
+/* source is the offset of the section header in the loaded text, INI_INTERNAL_SOURCE_START for the global section of 
+   a loaded text, or -1 */
+static int ini_internal_section_add( ini_t* ini, char const* name, int length, int source )
+    {
+    struct ini_internal_section_t* new_sections;
+    struct ini_internal_section_t* section;
+
+    if( ini->section_count >= ini->section_capacity )
+        {
+        ini->section_capacity *= 2;
+        new_sections = (struct ini_internal_section_t*) INI_MALLOC( ini->memctx, 
+            ini->section_capacity * sizeof( ini->sections[ 0 ] ) );
+        INI_MEMCPY( new_sections, ini->sections, ini->section_count * sizeof( ini->sections[ 0 ] ) );
+        INI_FREE( ini->memctx, ini->sections );
+        ini->sections = new_sections;
+        }
+
+    section = &ini->sections[ ini->section_count ];
+    section->name = ini_internal_string( ini, name, length );
+    section->name_length = length;
+    section->properties = 0;
+    section->property_count = 0;
+    section->property_capacity = 0;
+    section->pending = 0;
+    section->source = source;
+    section->changed = 0;
+    section->modified = 0;
+    ++ini->section_count;
+    ini_internal_index_add( ini, ini->section_count - 1, -1 );
+    return ini->section_count - 1;
+    }
+
+
+#define INI_INTERNAL_TOKEN_END 0
+#define INI_INTERNAL_TOKEN_SECTION 1
+#define INI_INTERNAL_TOKEN_PROPERTY 2
+
+struct ini_internal_token_t
+    {
+    char const* start;
+    char const* name;
+    int name_length;
+    char const* value; /* properties only */
+    int value_length;
+    char const* end; /* after the ']' of a section header, and at the '\n' or terminator ending a property */
+    };
+
+
+/* Finds the next section header or property at or after ptr, skipping whitespace, comments and anything else which is
+   neither. With properties set to 0, properties are skipped as well, which is faster. Returns one of the 
+   INI_INTERNAL_TOKEN_ values. For INI_INTERNAL_TOKEN_END, token->start points to the terminator. */
+static int ini_internal_token( char const* ptr, struct ini_internal_token_t* token, int properties )
+    {
+    char const* end;
+
+    while( *ptr )
         {
-        p = 0;
-        for( i = 0; i < ini->property_count; ++i )
+        /* trim leading whitespace */
+        while( *ptr && *ptr <= ' ' )
+            ++ptr;
+
+        /* done? */
+        if( !*ptr ) break;
+
+        /* section */
+        if( *ptr == '[' )
             {
-            if( ini->properties[ i ].section == section )
+            end = ptr + 1;
+            while( *end && *end != ']' && *end != '\n' )
+                ++end;
+            if( *end == ']' ) 
                 {
-                if( p == property ) return i;
-                ++p;
+                token->start = ptr;
+                token->name = ptr + 1;
+                token->name_length = (int)( end - ptr - 1 );
+                token->end = end + 1;
+                return INI_INTERNAL_TOKEN_SECTION;
+                }
+            ptr = end; /* not a section header, so it is ignored */
+            }
+        /* comment, or a property we are only skipping over */
+        else if( *ptr == ';' || !properties )
+            {
+            while( *ptr && *ptr != '\n' )
+                ++ptr;
+            }
+        /* property */
+        else
+            {
+            token->start = ptr;
+            while( *ptr && *ptr != '=' && *ptr != '\n' )
+                ++ptr;
+
+            if( *ptr == '=' )
+                {
+                /* names are looked up whole, so "name = value" has to give "name" */
+                end = ptr;
+                while( end > token->start && end[ -1 ] <= ' ' )
+                    --end;
+                token->name = token->start;
+                token->name_length = (int)( end - token->start );
+                ++ptr;
+                while( *ptr && *ptr <= ' ' && *ptr != '\n' ) 
+                    ptr++;
+                token->value = ptr;
+                while( *ptr && *ptr != '\n' )
+                    ++ptr;
+                end = ptr;
+                while( end > token->value && end[ -1 ] <= ' ' )
+                    --end;
+                token->value_length = (int)( end - token->value );
+                token->end = ptr;
+                return INI_INTERNAL_TOKEN_PROPERTY;
                 }
             }
         }
 
-    return INI_NOT_FOUND;
+    token->start = ptr;
+    return INI_INTERNAL_TOKEN_END;
     }
 
 
-ini_t* ini_create( void* memctx )
+/* Parses the properties following a section header, or at the start of the data for the global section, and adds them
+   to section s if add is set. Stops at the next section header and returns a pointer to its '[', or to the terminator. */
+static char const* ini_internal_parse_section( ini_t* ini, int s, char const* ptr, int add )
+    {
+    struct ini_internal_token_t token;
+
+    while( ini_internal_token( ptr, &token, add ) == INI_INTERNAL_TOKEN_PROPERTY )
+        {
+        ini_internal_property_add( ini, s, token.name, token.name_length, token.value, token.value_length, 
+            (int)( token.start - ini->source ) );
+        ptr = token.end;
+        }
+
+    return token.start;
+    }
+
+
+/* Returns the section, parsing its properties first if it was loaded by ini_load_lazy and has not been accessed yet */
+static struct ini_internal_section_t* ini_internal_section( ini_t const* ini, int section )
+    {
+    ini_t* mutable_ini;
+    char const* pending;
+
+    if( ini->sections[ section ].pending )
+        {
+        mutable_ini = (ini_t*) ini;
+        pending = mutable_ini->sections[ section ].pending;
+        mutable_ini->sections[ section ].pending = 0;
+        ini_internal_parse_section( mutable_ini, section, pending, 1 );
+        }
+
+    return &ini->sections[ section ];
+    }
+
+
+static ini_t* ini_internal_create( void* memctx, size_t reserve, int source )
     {
     ini_t* ini;
 
     ini = (ini_t*) INI_MALLOC( memctx, sizeof( ini_t ) );
     ini->memctx = memctx;
+    ini->blocks = 0;
+    if( reserve ) ini_internal_block_add( ini, reserve );
     ini->sections = (struct ini_internal_section_t*) INI_MALLOC( ini->memctx, INITIAL_CAPACITY * sizeof( ini->sections[ 0 ] ) );
     ini->section_capacity = INITIAL_CAPACITY;
-    ini->section_count = 1; /* global section */
-    ini->sections[ 0 ].name[ 0 ] = '\0'; 
-    ini->sections[ 0 ].name_large = 0;
-    ini->properties = (struct ini_internal_property_t*) INI_MALLOC( ini->memctx, INITIAL_CAPACITY * sizeof( ini->properties[ 0 ] ) );
-    ini->property_capacity = INITIAL_CAPACITY;
-    ini->property_count = 0;
+    ini->section_count = 0;
+    ini->index = 0;
+    ini->index_capacity = 0;
+    ini->index_count = 0;
+    ini->source = 0;
+    ini->generation = 0;
+    ini->saved_generation = 0;
+    ini_internal_index_rebuild( ini, INITIAL_CAPACITY );
+    ini_internal_section_add( ini, "", 0, source ); /* global section */
     return ini;
     }
 
 
-ini_t* ini_load( char const* data, void* memctx )
+static ini_t* ini_internal_load( char const* data, void* memctx, int lazy )
     {
     ini_t* ini;
     char const* ptr;
+    struct ini_internal_token_t token;
     int s;
-    char const* start;
-    char const* start2;
-    int l;
 
-    ini = ini_create( memctx );
+    /* the strings take up no more room than the text they come from, so this is usually the only block needed */
+    ini = ini_internal_create( memctx, data ? INI_STRLEN( data ) + INI_BLOCK_SIZE : 0, 
+        data ? INI_INTERNAL_SOURCE_START : -1 );
 
     ptr = data;
     if( ptr )
         {
-        s = 0;
-        while( *ptr )
+        ini->source = data;
+        if( lazy ) ini->sections[ 0 ].pending = ptr;
+        ptr = ini_internal_parse_section( ini, 0, ptr, !lazy );
+        while( ini_internal_token( ptr, &token, 0 ) == INI_INTERNAL_TOKEN_SECTION )
             {
-            /* trim leading whitespace */
-            while( *ptr && *ptr <=' ' )
-                ++ptr;
-            
-            /* done? */
-            if( !*ptr ) break;
+            s = ini_internal_section_add( ini, token.name, token.name_length, (int)( token.start - data ) );
+            if( lazy ) ini->sections[ s ].pending = token.end;
+            ptr = ini_internal_parse_section( ini, s, token.end, !lazy );
+            }
+        }
 
-            /* comment */
-            else if( *ptr == ';' )
-                {
-                while( *ptr && *ptr !='\n' )
-                    ++ptr;
-                }
-            /* section */
-            else if( *ptr == '[' )
-                {
-                ++ptr;
-                start = ptr;
-                while( *ptr && *ptr !=']' && *ptr != '\n' )
-                    ++ptr;
+    return ini;
+    }
 
-                if( *ptr == ']' )
-                    {
-                    s = ini_section_add( ini, start, (int)( ptr - start) );
-                    ++ptr;
-                    }
-                }
-            /* property */
-            else
-                {
-                start = ptr;
-                while( *ptr && *ptr !='=' && *ptr != '\n' )
-                    ++ptr;
 
-                if( *ptr == '=' )
-                    {
-                    l = (int)( ptr - start);
-                    ++ptr;
-                    while( *ptr && *ptr <= ' ' && *ptr != '\n' ) 
-                        ptr++;
-                    start2 = ptr;
-                    while( *ptr && *ptr != '\n' )
-                        ++ptr;
-                    while( *(--ptr) <= ' ' ) 
-                        (void)ptr;
-                    ptr++;
-                    ini_property_add( ini, s, start, l, start2, (int)( ptr - start2) );
-                    }
-                }
-            }
-        }   
+ini_t* ini_create( void* memctx )
+    {
+    return ini_internal_create( memctx, 0, -1 );
+    }
 
-    return ini;
+
+ini_t* ini_load( char const* data, void* memctx )
+    {
+    return ini_internal_load( data, memctx, 0 );
+    }
+
+
+ini_t* ini_load_lazy( char const* data, void* memctx )
+    {
+    return ini_internal_load( data, memctx, 1 );
     }
 
 
 int ini_save( ini_t const* ini, char* data, int size )
     {
+    struct ini_internal_section_t const* section;
+    struct ini_internal_property_t const* property;
     int s;
     int p;
     int i;
     int l;
-    char* n;
+    char const* n;
     int pos;
 
     if( ini )
@@ -578,8 +1034,9 @@ int ini_save( ini_t const* ini, char* data, int size )
         pos = 0;
         for( s = 0; s < ini->section_count; ++s )
             {
-            n = ini->sections[ s ].name_large ? ini->sections[ s ].name_large : ini->sections[ s ].name;
-            l = (int) INI_STRLEN( n );
+            section = ini_internal_section( ini, s );
+            n = section->name;
+            l = section->name_length;
             if( l > 0 )
                 {
                 if( data && pos < size ) data[ pos ] = '[';
@@ -595,29 +1052,27 @@ int ini_save( ini_t const* ini, char* data, int size )
                 ++pos;
                 }
 
-            for( p = 0; p < ini->property_count; ++p )
+            for( p = 0; p < section->property_count; ++p )
                 {
-                if( ini->properties[ p ].section == s )
+                property = &section->properties[ p ];
+                n = property->name;
+                l = property->name_length;
+                for( i = 0; i < l; ++i )
                     {
-                    n = ini->properties[ p ].name_large ? ini->properties[ p ].name_large : ini->properties[ p ].name;
-                    l = (int) INI_STRLEN( n );
-                    for( i = 0; i < l; ++i )
-                        {
-                        if( data && pos < size ) data[ pos ] = n[ i ];
-                        ++pos;
-                        }
-                    if( data && pos < size ) data[ pos ] = '=';
+                    if( data && pos < size ) data[ pos ] = n[ i ];
                     ++pos;
-                    n = ini->properties[ p ].value_large ? ini->properties[ p ].value_large : ini->properties[ p ].value;
-                    l = (int) INI_STRLEN( n );
-                    for( i = 0; i < l; ++i )
-                        {
-                        if( data && pos < size ) data[ pos ] = n[ i ];
-                        ++pos;
-                        }
-                    if( data && pos < size ) data[ pos ] = '\n';
+                    }
+                if( data && pos < size ) data[ pos ] = '=';
+                ++pos;
+                n = property->value;
+                l = property->value_length;
+                for( i = 0; i < l; ++i )
+                    {
+                    if( data && pos < size ) data[ pos ] = n[ i ];
                     ++pos;
                     }
+                if( data && pos < size ) data[ pos ] = '\n';
+                ++pos;
                 }
 
             if( pos > 0 )
@@ -637,20 +1092,315 @@ int ini_save( ini_t const* ini, char* data, int size )
     }
 
 
-void ini_destroy( ini_t* ini )
+struct ini_internal_output_t
+    {
+    char* data;
+    int size;
+    int pos;
+    char last; /* the last character written, or 0 */
+    };
+
+
+static void ini_internal_put( struct ini_internal_output_t* out, char const* str, int length )
+    {
+    int count;
+
+    if( length <= 0 ) return;
+    if( out->data && out->pos < out->size )
+        {
+        count = out->size - out->pos < length ? out->size - out->pos : length;
+        INI_MEMCPY( out->data + out->pos, str, (size_t) count );
+        }
+    out->pos += length;
+    out->last = str[ length - 1 ];
+    }
+
+
+/* Writes the properties added to a section since it was loaded */
+static void ini_internal_put_added( ini_t const* ini, int section, struct ini_internal_output_t* out )
     {
+    struct ini_internal_property_t const* property;
+    int p;
+
+    for( p = 0; p < ini->sections[ section ].property_count; ++p )
+        {
+        property = &ini->sections[ section ].properties[ p ];
+        if( property->source >= 0 ) continue;
+        if( out->pos > 0 && out->last != '\n' ) ini_internal_put( out, "\n", 1 );
+        ini_internal_put( out, property->name, property->name_length );
+        ini_internal_put( out, "=", 1 );
+        ini_internal_put( out, property->value, property->value_length );
+        ini_internal_put( out, "\n", 1 );
+        }
+    }
+
+
+struct ini_internal_patch_item_t
+    {
+    int source;
+    int section;
+    int property; /* -1 for a section header */
+    };
+
+
+int ini_save_patch( ini_t const* ini, char const* original, char* data, int size )
+    {
+    struct ini_internal_output_t out;
+    struct ini_internal_patch_item_t* items;
+    struct ini_internal_patch_item_t item;
+    struct ini_internal_token_t token;
+    struct ini_internal_section_t const* section;
+    struct ini_internal_property_t const* property;
+    char const* ptr;
+    char const* insert;
+    char const* line;
+    char const* rest;
+    char const* eol;
+    int current;
+    int found;
+    int count;
+    int type;
+    int gap;
+    int s;
+    int p;
     int i;
+    int j;
+    int k;
+
+    if( !ini ) return 0;
+    if( !original ) return ini_save( ini, data, size );
+
+    /* everything still there from the original text, in the order it appears there */
+    count = 0;
+    for( s = 0; s < ini->section_count; ++s )
+        {
+        section = ini_internal_section( ini, s );
+        if( section->source >= 0 ) ++count;
+        for( p = 0; p < section->property_count; ++p )
+            if( section->properties[ p ].source >= 0 ) ++count;
+        }
+    items = (struct ini_internal_patch_item_t*) INI_MALLOC( ini->memctx, ( count + 1 ) * sizeof( items[ 0 ] ) );
+    count = 0;
+    for( s = 0; s < ini->section_count; ++s )
+        {
+        section = &ini->sections[ s ];
+        if( section->source >= 0 ) 
+            {
+            items[ count ].source = section->source;
+            items[ count ].section = s;
+            items[ count++ ].property = -1;
+            }
+        for( p = 0; p < section->property_count; ++p )
+            {
+            if( section->properties[ p ].source < 0 ) continue;
+            items[ count ].source = section->properties[ p ].source;
+            items[ count ].section = s;
+            items[ count++ ].property = p;
+            }
+        }
+    for( gap = count / 2; gap > 0; gap /= 2 )
+        {
+        for( i = gap; i < count; ++i )
+            {
+            item = items[ i ];
+            for( j = i; j >= gap && items[ j - gap ].source > item.source; j -= gap )
+                items[ j ] = items[ j - gap ];
+            items[ j ] = item;
+            }
+        }
+
+    out.data = data;
+    out.size = size;
+    out.pos = 0;
+    out.last = 0;
+
+    /* the section the text being walked belongs to, or -1 if it has been removed */
+    current = -1;
+    for( s = 0; s < ini->section_count; ++s )
+        if( ini->sections[ s ].source == INI_INTERNAL_SOURCE_START ) current = s;
+
+    /* the global section has no header to rename, so a name given to it needs one adding */
+    if( current >= 0 && ini->sections[ current ].name_length > 0 )
+        {
+        ini_internal_put( &out, "[", 1 );
+        ini_internal_put( &out, ini->sections[ current ].name, ini->sections[ current ].name_length );
+        ini_internal_put( &out, "]\n", 2 );
+        }
+
+    /* the text up to ptr has been dealt with, and properties added to the current section go at insert */
+    ptr = original;
+    insert = original;
+    k = 0;
+    for( ; ; )
+        {
+        type = ini_internal_token( ptr, &token, 1 );
+        found = -1;
+        if( type != INI_INTERNAL_TOKEN_END )
+            {
+            while( k < count && items[ k ].source < (int)( token.start - original ) ) ++k;
+            if( k < count && items[ k ].source == (int)( token.start - original ) ) found = k;
+            }
+
+        if( type != INI_INTERNAL_TOKEN_PROPERTY )
+            {
+            if( current >= 0 )
+                {
+                ini_internal_put( &out, ptr, (int)( insert - ptr ) );
+                ptr = insert;
+                ini_internal_put_added( ini, current, &out );
+                }
+            if( type == INI_INTERNAL_TOKEN_END ) break;
+            current = found >= 0 ? items[ found ].section : -1;
+            }
+
+        /* the start of the line the token is on, or NULL if something other than whitespace comes before it */
+        line = token.start;
+        while( line > ptr && ( line[ -1 ] == ' ' || line[ -1 ] == '\t' ) ) 
+            --line;
+        if( line != original && line[ -1 ] != '\n' ) line = 0;
+
+        if( type == INI_INTERNAL_TOKEN_SECTION )
+            {
+            rest = token.end;
+            while( *rest == ' ' || *rest == '\t' || *rest == '\r' )
+                ++rest;
+            if( found >= 0 )
+                {
+                section = &ini->sections[ items[ found ].section ];
+                ini_internal_put( &out, ptr, (int)( token.start - ptr ) );
+                if( section->changed )
+                    {
+                    ini_internal_put( &out, "[", 1 );
+                    ini_internal_put( &out, section->name, section->name_length );
+                    ini_internal_put( &out, "]", 1 );
+                    }
+                else
+                    {
+                    ini_internal_put( &out, token.start, (int)( token.end - token.start ) );
+                    }
+                ptr = token.end;
+                }
+            else if( line && ( *rest == '\n' || !*rest ) )
+                {
+                /* a removed section takes its header line with it, but not the comments around it */
+                ini_internal_put( &out, ptr, (int)( line - ptr ) );
+                ptr = *rest ? rest + 1 : rest;
+                }
+            else
+                {
+                ini_internal_put( &out, ptr, (int)( token.start - ptr ) );
+                ptr = token.end;
+                }
+            insert = *rest == '\n' ? rest + 1 : token.end;
+            }
+        else
+            {
+            eol = *token.end == '\n' ? token.end + 1 : token.end;
+            if( found >= 0 )
+                {
+                /* only the name and value are replaced, keeping the spacing and anything else on the line */
+                property = &ini->sections[ items[ found ].section ].properties[ items[ found ].property ];
+                ini_internal_put( &out, ptr, (int)( token.start - ptr ) );
+                if( property->changed & INI_INTERNAL_NAME_CHANGED )
+                    ini_internal_put( &out, property->name, property->name_length );
+                else
+                    ini_internal_put( &out, token.name, token.name_length );
+                ini_internal_put( &out, token.name + token.name_length, (int)( token.value - token.name - token.name_length ) );
+                if( property->changed & INI_INTERNAL_VALUE_CHANGED )
+                    ini_internal_put( &out, property->value, property->value_length );
+                else
+                    ini_internal_put( &out, token.value, token.value_length );
+                ptr = token.value + token.value_length;
+                }
+            else if( line )
+                {
+                ini_internal_put( &out, ptr, (int)( line - ptr ) );
+                ptr = eol;
+                }
+            else
+                {
+                ini_internal_put( &out, ptr, (int)( token.start - ptr ) );
+                ptr = token.end;
+                }
+            insert = eol;
+            }
+        }
+    ini_internal_put( &out, ptr, (int) INI_STRLEN( ptr ) );
+    INI_FREE( ini->memctx, items );
+
+    /* sections added since loading go at the end, as ini_save would write them */
+    for( s = 0; s < ini->section_count; ++s )
+        {
+        section = &ini->sections[ s ];
+        if( section->source != -1 ) continue;
+        if( out.pos > 0 && out.last != '\n' ) ini_internal_put( &out, "\n", 1 );
+        if( out.pos > 0 ) ini_internal_put( &out, "\n", 1 );
+        if( section->name_length > 0 )
+            {
+            ini_internal_put( &out, "[", 1 );
+            ini_internal_put( &out, section->name, section->name_length );
+            ini_internal_put( &out, "]\n", 2 );
+            }
+        ini_internal_put_added( ini, s, &out );
+        }
+
+    if( data && out.pos < size ) data[ out.pos ] = '\0';
+    ++out.pos;
+
+    return out.pos;
+    }
+
+
+int ini_dirty( ini_t const* ini )
+    {
+    if( ini ) return ini->generation != ini->saved_generation;
+    return 0;
+    }
+
+
+int ini_section_dirty( ini_t const* ini, int section )
+    {
+    if( ini && section >= 0 && section < ini->section_count )
+        return ini->sections[ section ].modified > ini->saved_generation;
+
+    return 0;
+    }
+
+
+int ini_property_dirty( ini_t const* ini, int section, int property )
+    {
+    struct ini_internal_section_t const* s;
+
+    if( ini && section >= 0 && section < ini->section_count )
+        {
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
+            return s->properties[ property ].modified > ini->saved_generation;
+        }
+
+    return 0;
+    }
+
+
+void ini_dirty_clear( ini_t* ini )
+    {
+    if( ini ) ini->saved_generation = ini->generation;
+    }
+
+
+void ini_destroy( ini_t* ini )
+    {
+    struct ini_internal_block_t* block;
+    struct ini_internal_block_t* next;
 
     if( ini )
         {
-        for( i = 0; i < ini->property_count; ++i )
+        for( block = ini->blocks; block; block = next )
             {
-            if( ini->properties[ i ].value_large ) INI_FREE( ini->memctx, ini->properties[ i ].value_large );
-            if( ini->properties[ i ].name_large ) INI_FREE( ini->memctx, ini->properties[ i ].name_large );
+            next = block->next;
+            INI_FREE( ini->memctx, block );
             }
-        for( i = 0; i < ini->section_count; ++i )
-            if( ini->sections[ i ].name_large ) INI_FREE( ini->memctx, ini->sections[ i ].name_large );
-        INI_FREE( ini->memctx, ini->properties );
+        INI_FREE( ini->memctx, ini->index );
         INI_FREE( ini->memctx, ini->sections );
         INI_FREE( ini->memctx, ini );
         }
@@ -667,7 +1417,7 @@ int ini_section_count( ini_t const* ini )
 char const* ini_section_name( ini_t const* ini, int section )
     {
     if( ini && section >= 0 && section < ini->section_count )
-        return ini->sections[ section ].name_large ? ini->sections[ section ].name_large : ini->sections[ section ].name;
+        return ini->sections[ section ].name;
 
     return NULL;
     }
@@ -675,18 +1425,8 @@ char const* ini_section_name( ini_t const* ini, int section )
 
 int ini_property_count( ini_t const* ini, int section )
     {
-    int i;
-    int count;
-
-    if( ini )
-        {
-        count = 0;
-        for( i = 0; i < ini->property_count; ++i )
-            {
-            if( ini->properties[ i ].section == section ) ++count;
-            }
-        return count;
-        }
+    if( ini && section >= 0 && section < ini->section_count )
+        return ini_internal_section( ini, section )->property_count;
 
     return 0;
     }
@@ -694,13 +1434,13 @@ int ini_property_count( ini_t const* ini, int section )
 
 char const* ini_property_name( ini_t const* ini, int section, int property )
     {
-    int p;
+    struct ini_internal_section_t const* s;
 
     if( ini && section >= 0 && section < ini->section_count )
         {
-        p = ini_internal_property_index( ini, section, property );
-        if( p != INI_NOT_FOUND )
-            return ini->properties[ p ].name_large ? ini->properties[ p ].name_large : ini->properties[ p ].name;
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
+            return s->properties[ property ].name;
         }
 
     return NULL;
@@ -709,13 +1449,13 @@ char const* ini_property_name( ini_t const* ini, int section, int property )
 
 char const* ini_property_value( ini_t const* ini, int section, int property )
     {
-    int p;
+    struct ini_internal_section_t const* s;
 
     if( ini && section >= 0 && section < ini->section_count )
         {
-        p = ini_internal_property_index( ini, section, property );
-        if( p != INI_NOT_FOUND )
-            return ini->properties[ p ].value_large ? ini->properties[ p ].value_large : ini->properties[ p ].value;
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
+            return s->properties[ property ].value;
         }
 
     return NULL;
@@ -724,18 +1464,14 @@ char const* ini_property_value( ini_t const* ini, int section, int property )
 
 int ini_find_section( ini_t const* ini, char const* name, int name_length )
     {
-    int i;
+    struct ini_internal_entry_t const* entry;
 
     if( ini && name )
         {
         if( name_length <= 0 ) name_length = (int) INI_STRLEN( name );
-        for( i = 0; i < ini->section_count; ++i )
-            {
-            char const* const other = 
-                ini->sections[ i ].name_large ? ini->sections[ i ].name_large : ini->sections[ i ].name;
-            if( INI_STRNICMP( name, other, name_length ) == 0 )
-                return i;
-            }
+        if( ini->index_dirty ) ini_internal_index_rebuild( (ini_t*) ini, ini->index_capacity );
+        entry = ini_internal_index_slot( ini, ini_internal_hash( name, name_length ), -1, -1, name, name_length );
+        if( entry->section >= 0 ) return entry->section;
         }
 
     return INI_NOT_FOUND;
@@ -744,24 +1480,16 @@ int ini_find_section( ini_t const* ini, char const* name, int name_length )
 
 int ini_find_property( ini_t const* ini, int section, char const* name, int name_length )
     {
-    int i;
-    int c;
+    struct ini_internal_entry_t const* entry;
 
     if( ini && name && section >= 0 && section < ini->section_count)
         {
         if( name_length <= 0 ) name_length = (int) INI_STRLEN( name );
-        c = 0;
-        for( i = 0; i < ini->property_capacity; ++i )
-            {
-            if( ini->properties[ i ].section == section )
-                {
-                char const* const other = 
-                    ini->properties[ i ].name_large ? ini->properties[ i ].name_large : ini->properties[ i ].name;
-                if( INI_STRNICMP( name, other, name_length ) == 0 )
-                    return c;
-                ++c;
-                }
-            }
+        ini_internal_section( ini, section );
+        if( ini->index_dirty ) ini_internal_index_rebuild( (ini_t*) ini, ini->index_capacity );
+        entry = ini_internal_index_slot( ini, ini_internal_property_hash( ini_internal_hash( name, name_length ), 
+            section ), section, 0, name, name_length );
+        if( entry->section >= 0 ) return entry->property;
         }
 
     return INI_NOT_FOUND;
@@ -770,134 +1498,55 @@ int ini_find_property( ini_t const* ini, int section, char const* name, int name
 
 int ini_section_add( ini_t* ini, char const* name, int length )
     {
-    struct ini_internal_section_t* new_sections;
-    
+    int s;
+
     if( ini && name )
         {
         if( length <= 0 ) length = (int) INI_STRLEN( name );
-        if( ini->section_count >= ini->section_capacity )
-            {
-            ini->section_capacity *= 2;
-            new_sections = (struct ini_internal_section_t*) INI_MALLOC( ini->memctx, 
-                ini->section_capacity * sizeof( ini->sections[ 0 ] ) );
-            INI_MEMCPY( new_sections, ini->sections, ini->section_count * sizeof( ini->sections[ 0 ] ) );
-            INI_FREE( ini->memctx, ini->sections );
-            ini->sections = new_sections;
-            }
-
-        ini->sections[ ini->section_count ].name_large = 0;
-        if( length + 1 >= sizeof( ini->sections[ 0 ].name ) )
-            {
-            ini->sections[ ini->section_count ].name_large = (char*) INI_MALLOC( ini->memctx, (size_t) length + 1 );
-            INI_MEMCPY( ini->sections[ ini->section_count ].name_large, name, (size_t) length );
-            ini->sections[ ini->section_count ].name_large[ length ] = '\0';
-            }
-        else
-            {
-            INI_MEMCPY( ini->sections[ ini->section_count ].name, name, (size_t) length );
-            ini->sections[ ini->section_count ].name[ length ] = '\0';
-            }
-
-        return ini->section_count++;
+        s = ini_internal_section_add( ini, name, length, -1 );
+        ini->sections[ s ].modified = ++ini->generation;
+        return s;
         }
+
     return INI_NOT_FOUND;
     }
 
 
 void ini_property_add( ini_t* ini, int section, char const* name, int name_length, char const* value, int value_length )
     {
-    struct ini_internal_property_t* new_properties;
-
     if( ini && name && section >= 0 && section < ini->section_count )
         {
         if( name_length <= 0 ) name_length = (int) INI_STRLEN( name );
         if( value_length <= 0 ) value_length = (int) INI_STRLEN( value );
-
-        if( ini->property_count >= ini->property_capacity )
-            {
-
-            ini->property_capacity *= 2;
-            new_properties = (struct ini_internal_property_t*) INI_MALLOC( ini->memctx, 
-                ini->property_capacity * sizeof( ini->properties[ 0 ] ) );
-            INI_MEMCPY( new_properties, ini->properties, ini->property_count * sizeof( ini->properties[ 0 ] ) );
-            INI_FREE( ini->memctx, ini->properties );
-            ini->properties = new_properties;
-            }
-        
-        ini->properties[ ini->property_count ].section = section;
-        ini->properties[ ini->property_count ].name_large = 0;
-        ini->properties[ ini->property_count ].value_large = 0;
-
-        if( name_length + 1 >= sizeof( ini->properties[ 0 ].name ) )
-            {
-            ini->properties[ ini->property_count ].name_large = (char*) INI_MALLOC( ini->memctx, (size_t) name_length + 1 );
-            INI_MEMCPY( ini->properties[ ini->property_count ].name_large, name, (size_t) name_length );
-            ini->properties[ ini->property_count ].name_large[ name_length ] = '\0';
-            }
-        else
-            {
-            INI_MEMCPY( ini->properties[ ini->property_count ].name, name, (size_t) name_length );
-            ini->properties[ ini->property_count ].name[ name_length ] = '\0';
-            }
-
-        if( value_length + 1 >= sizeof( ini->properties[ 0 ].value ) )
-            {
-            ini->properties[ ini->property_count ].value_large = (char*) INI_MALLOC( ini->memctx, (size_t) value_length + 1 );
-            INI_MEMCPY( ini->properties[ ini->property_count ].value_large, value, (size_t) value_length );
-            ini->properties[ ini->property_count ].value_large[ value_length ] = '\0';
-            }
-        else
-            {
-            INI_MEMCPY( ini->properties[ ini->property_count ].value, value, (size_t) value_length );
-            ini->properties[ ini->property_count ].value[ value_length ] = '\0';
-            }
-
-        ++ini->property_count;
+        ini_internal_section( ini, section );
+        ini_internal_property_add( ini, section, name, name_length, value, value_length, -1 );
         }
     }
 
 
 void ini_section_remove( ini_t* ini, int section )
     {
-    int p;
-
     if( ini && section >= 0 && section < ini->section_count )
         {
-        if( ini->sections[ section ].name_large ) INI_FREE( ini->memctx, ini->sections[ section ].name_large );
-        for( p = ini->property_count - 1; p >= 0; --p ) 
-            {
-            if( ini->properties[ p ].section == section )
-                {
-                if( ini->properties[ p ].value_large ) INI_FREE( ini->memctx, ini->properties[ p ].value_large );
-                if( ini->properties[ p ].name_large ) INI_FREE( ini->memctx, ini->properties[ p ].name_large );
-                ini->properties[ p ] = ini->properties[ --ini->property_count ];
-                }
-            }
-
-        ini->sections[ section ] = ini->sections[ --ini->section_count  ];
-        
-        for( p = 0; p < ini->property_count; ++p ) 
-            {
-            if( ini->properties[ p ].section == ini->section_count )
-                ini->properties[ p ].section = section;
-            }
+        ini->sections[ section ] = ini->sections[ --ini->section_count ];
+        ini->index_dirty = 1;
+        ++ini->generation;
         }
     }
 
 
 void ini_property_remove( ini_t* ini, int section, int property )
     {
-    int p;
+    struct ini_internal_section_t* s;
 
     if( ini && section >= 0 && section < ini->section_count )
         {
-        p = ini_internal_property_index( ini, section, property );
-        if( p != INI_NOT_FOUND )
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
             {
-            if( ini->properties[ p ].value_large ) INI_FREE( ini->memctx, ini->properties[ p ].value_large );
-            if( ini->properties[ p ].name_large ) INI_FREE( ini->memctx, ini->properties[ p ].name_large );
-            ini->properties[ p ] = ini->properties[ --ini->property_count  ];
-            return;
+            s->properties[ property ] = s->properties[ --s->property_count ];
+            ini->index_dirty = 1;
+            s->modified = ++ini->generation;
             }
         }
     }
@@ -908,48 +1557,30 @@ void ini_section_name_set( ini_t* ini, int section, char const* name, int length
     if( ini && name && section >= 0 && section < ini->section_count )
         {
         if( length <= 0 ) length = (int) INI_STRLEN( name );
-        if( ini->sections[ section ].name_large ) INI_FREE( ini->memctx, ini->sections[ section ].name_large );
-        ini->sections[ section ].name_large = 0;
-        
-        if( length + 1 >= sizeof( ini->sections[ 0 ].name ) )
-            {
-            ini->sections[ section ].name_large = (char*) INI_MALLOC( ini->memctx, (size_t) length + 1 );
-            INI_MEMCPY( ini->sections[ section ].name_large, name, (size_t) length );
-            ini->sections[ section ].name_large[ length ] = '\0';
-            }
-        else
-            {
-            INI_MEMCPY( ini->sections[ section ].name, name, (size_t) length );
-            ini->sections[ section ].name[ length ] = '\0';
-            }
+        ini->sections[ section ].name = ini_internal_string( ini, name, length );
+        ini->sections[ section ].name_length = length;
+        ini->sections[ section ].changed = INI_INTERNAL_NAME_CHANGED;
+        ini->sections[ section ].modified = ++ini->generation;
+        ini->index_dirty = 1;
         }
     }
 
 
 void ini_property_name_set( ini_t* ini, int section, int property, char const* name, int length )
     {
-    int p;
+    struct ini_internal_section_t* s;
 
     if( ini && name && section >= 0 && section < ini->section_count )
         {
         if( length <= 0 ) length = (int) INI_STRLEN( name );
-        p = ini_internal_property_index( ini, section, property );
-        if( p != INI_NOT_FOUND )
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
             {
-            if( ini->properties[ p ].name_large ) INI_FREE( ini->memctx, ini->properties[ p ].name_large );
-            ini->properties[ ini->property_count ].name_large = 0;
-
-            if( length + 1 >= sizeof( ini->properties[ 0 ].name ) )
-                {
-                ini->properties[ p ].name_large = (char*) INI_MALLOC( ini->memctx, (size_t) length + 1 );
-                INI_MEMCPY( ini->properties[ p ].name_large, name, (size_t) length );
-                ini->properties[ p ].name_large[ length ] = '\0';
-                }
-            else
-                {
-                INI_MEMCPY( ini->properties[ p ].name, name, (size_t) length );
-                ini->properties[ p ].name[ length ] = '\0';
-                }
+            s->properties[ property ].name = ini_internal_string( ini, name, length );
+            s->properties[ property ].name_length = length;
+            s->properties[ property ].changed |= INI_INTERNAL_NAME_CHANGED;
+            s->properties[ property ].modified = s->modified = ++ini->generation;
+            ini->index_dirty = 1;
             }
         }
     }
@@ -957,28 +1588,31 @@ void ini_property_name_set( ini_t* ini, int section, int property, char const* n
 
 void ini_property_value_set( ini_t* ini, int section, int property, char const* value, int length )
     {
-    int p;
+    struct ini_internal_section_t* s;
+    struct ini_internal_property_t* p;
 
     if( ini && value && section >= 0 && section < ini->section_count )
         {
         if( length <= 0 ) length = (int) INI_STRLEN( value );
-        p = ini_internal_property_index( ini, section, property );
-        if( p != INI_NOT_FOUND )
+        s = ini_internal_section( ini, section );
+        if( property >= 0 && property < s->property_count )
             {
-            if( ini->properties[ p ].value_large ) INI_FREE( ini->memctx, ini->properties[ p ].value_large );
-            ini->properties[ ini->property_count ].value_large = 0;
+            /* setting the value it already has is not a change */
+            p = &s->properties[ property ];
+            if( length == p->value_length && ( length == 0 || INI_MEMCMP( p->value, value, (size_t) length ) == 0 ) )
+                return;
 
-            if( length + 1 >= sizeof( ini->properties[ 0 ].value ) )
-                {
-                ini->properties[ p ].value_large = (char*) INI_MALLOC( ini->memctx, (size_t) length + 1 );
-                INI_MEMCPY( ini->properties[ p ].value_large, value, (size_t) length );
-                ini->properties[ p ].value_large[ length ] = '\0';
-                }
-            else
+            /* reuse the old string if the new value fits */
+            if( length > p->value_capacity )
                 {
-                INI_MEMCPY( ini->properties[ p ].value, value, (size_t) length );
-                ini->properties[ p ].value[ length ] = '\0';
+                p->value = (char*) ini_internal_alloc( ini, (size_t) length + 1, 1 );
+                p->value_capacity = length;
                 }
+            INI_MEMCPY( p->value, value, (size_t) length );
+            p->value[ length ] = '\0';
+            p->value_length = length;
+            p->changed |= INI_INTERNAL_VALUE_CHANGED;
+            p->modified = s->modified = ++ini->generation;
             }
         }
     }
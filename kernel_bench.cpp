@@ -0,0 +1,491 @@
+// Times the hot loops of the libraries in this tree one at a time, on one
+// pinned thread, and prints cycles per unit of work (sample, or byte for
+// sha256, or multiply-add for the TDStretch search) and GB/s of input
+// and output for each. With -json, also writes the results in a form
+// that can be kept and compared between builds.
+//
+//     kernel_bench [-cpu n] [-nopin] [-reps n] [-ms n] [-json file] [name...]
+//
+// Names select the kernels whose names contain any of them. Cycles are TSC
+// cycles read with Xbyak::util::Clock, which on current CPUs count at a
+// fixed rate rather than with the core clock, so fix the CPU frequency for
+// stable numbers. The median of -reps repetitions of about -ms milliseconds
+// each is reported, after a warmup of the same length. CPU_FEATURES (see
+// cpu_features.h) selects which SIMD kernels are measured.
+//
+// Build with the tree's root, gme, SoundTouch and rubberband directories in
+// the include path, linking Blip_Buffer.cpp, Fir_Resampler.cpp,
+// blargg_tables.cpp, sha256.c, the SoundTouch library and the rubberband
+// library.
+
+#define XBYAK_NO_OP_NAMES
+#include "xbyak_util.h"
+#include "cpu_features.h"
+
+#define RESAMPLER_IMPLEMENTATION
+#include "resampler.h"
+#define DR_WAV_IMPLEMENTATION
+#include "dr_wav.h"
+#include "sha256.h"
+
+#include "Blip_Buffer.h"
+#include "Fir_Resampler.h"
+#include "TDStretch.h"
+#include "dsp/FFT.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#if defined (_WIN32)
+	#include <windows.h>
+#else
+	#include <time.h>
+	#if defined (__linux__)
+		#include <sched.h>
+	#endif
+#endif
+
+// Normally defined by Music_Emu.cpp, which isn't needed here
+BLARGG_THREAD_LOCAL int blargg_no_alloc_depth;
+
+static double now_ns()
+{
+#if defined (_WIN32)
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency( &freq );
+	QueryPerformanceCounter( &count );
+	return (double) count.QuadPart * 1e9 / (double) freq.QuadPart;
+#else
+	timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+#endif
+}
+
+// Pins the calling thread to CPU n, or if n is negative, to the one it's on.
+// Returns the CPU, or -1 if the thread couldn't be pinned.
+static int pin_thread( int n )
+{
+#if defined (_WIN32)
+	if ( n < 0 )
+		n = (int) GetCurrentProcessorNumber();
+	SetThreadPriority( GetCurrentThread(), THREAD_PRIORITY_HIGHEST );
+	if ( !SetThreadAffinityMask( GetCurrentThread(), (DWORD_PTR) 1 << n ) )
+		return -1;
+	return n;
+#elif defined (__linux__)
+	if ( n < 0 )
+		n = sched_getcpu();
+	cpu_set_t set;
+	CPU_ZERO( &set );
+	CPU_SET( n, &set );
+	if ( n < 0 || sched_setaffinity( 0, sizeof set, &set ) )
+		return -1;
+	return n;
+#else
+	(void) n;
+	return -1;
+#endif
+}
+
+// Aligned for the SIMD kernels that need it, and filled with noise
+template<class T>
+class Bench_Buffer {
+public:
+	explicit Bench_Buffer( size_t n ) : mem( n * sizeof (T) + 64 )
+	{
+		data = (T*) (((size_t) &mem [0] + 63) & ~(size_t) 63);
+		memset( data, 0, n * sizeof (T) );
+	}
+	T* data;
+	operator T* () { return data; }
+private:
+	std::vector<unsigned char> mem;
+};
+
+static void fill_noise( float* out, size_t n, float scale = 0.5f )
+{
+	unsigned r = 1;
+	for ( size_t i = 0; i < n; i++ )
+	{
+		r = r * 1664525 + 1013904223;
+		out [i] = ((int) (r >> 8 & 0xFFFF) - 0x8000) * (scale / 0x8000);
+	}
+}
+
+static void fill_noise( short* out, size_t n )
+{
+	unsigned r = 1;
+	for ( size_t i = 0; i < n; i++ )
+	{
+		r = r * 1664525 + 1013904223;
+		out [i] = (short) (r >> 12);
+	}
+}
+
+// One kernel, with its input set up by the constructor. run() always does
+// the same work: 'units' samples (or bytes), touching 'bytes' bytes of input
+// and output.
+class Kernel {
+public:
+	const char* name;
+	const char* unit;
+	double units;
+	double bytes;
+	Kernel( const char* n, const char* u = "sample" ) : name( n ), unit( u ), units( 0 ), bytes( 0 ) { }
+	virtual ~Kernel() { }
+	virtual void run() = 0;
+};
+
+// Blip_Buffer::read_samples(): integrate, high-pass and clamp
+class Blip_Read : public Kernel {
+	enum { frame = 4096 };
+	Blip_Buffer buf;
+	Bench_Buffer<blip_sample_t> out;
+	int stereo;
+public:
+	Blip_Read( const char* name, int stereo_ ) : Kernel( name ), out( frame * 2 ), stereo( stereo_ )
+	{
+		if ( buf.set_sample_rate( 44100, 1000 ) )
+			exit( EXIT_FAILURE );
+		buf.clock_rate( 44100 ); // one clock per sample
+		units = frame;
+		bytes = frame * (sizeof (blip_sample_t) + sizeof (Blip_Buffer::buf_t_));
+	}
+	void run()
+	{
+		buf.end_frame( frame );
+		buf.read_samples( out, frame, stereo );
+	}
+};
+
+// Fir_Resampler<24> stereo, 48 kHz to 32 kHz as used by Effects_Buffer
+class Fir_Read : public Kernel {
+	enum { in_frames = 2048 };
+	Fir_Resampler<24> r;
+	Bench_Buffer<short> out;
+	std::vector<short> noise;
+public:
+	Fir_Read() : Kernel( "Fir_Resampler.read" ), out( in_frames * 4 ), noise( in_frames * 2 )
+	{
+		if ( r.buffer_size( in_frames * 4 ) )
+			exit( EXIT_FAILURE );
+		r.time_ratio( 48000.0 / 32000, 0.990 );
+		fill_noise( &noise [0], noise.size() );
+		units = in_frames;
+		bytes = in_frames * 2 * sizeof (short) * (1 + 32000.0 / 48000);
+	}
+	void run()
+	{
+		memcpy( r.buffer(), &noise [0], noise.size() * sizeof (short) );
+		r.write( noise.size() );
+		r.read( out, r.avail() );
+	}
+};
+
+// resampler_sinc_process(), stereo 44.1 kHz to 48 kHz at the given quality
+class Sinc_Process : public Kernel {
+	enum { in_frames = 4096 };
+	void* re;
+	Bench_Buffer<float> in;
+	Bench_Buffer<float> out;
+public:
+	Sinc_Process( const char* name, enum resampler_quality quality ) : Kernel( name ),
+			in( in_frames * 2 ), out( in_frames * 2 * 2 )
+	{
+		resampler_sinc_config config;
+		resampler_sinc_config_preset( &config, quality, 2 );
+		re = resampler_sinc_init_config( &config );
+		if ( !re )
+			exit( EXIT_FAILURE );
+		fill_noise( in, in_frames * 2 );
+		units = in_frames;
+		bytes = in_frames * 2 * sizeof (float) * (1 + 48000.0 / 44100);
+	}
+	~Sinc_Process() { resampler_sinc_free( re ); }
+	void run()
+	{
+		resampler_data data;
+		data.data_in = in;
+		data.data_out = out;
+		data.input_frames = in_frames;
+		data.output_frames = 0;
+		data.ratio = 48000.0 / 44100;
+		resampler_sinc_process( re, &data );
+	}
+};
+
+// Gets at the protected search of TDStretch so it can be timed alone. Pointers
+// to members named through a derived class may be applied to any TDStretch.
+struct TDStretch_Access : soundtouch::TDStretch {
+	typedef int (soundtouch::TDStretch::*seek_t)( const soundtouch::SAMPLETYPE* );
+	static seek_t seek_full() { return &TDStretch_Access::seekBestOverlapPositionFull; }
+	static int soundtouch::TDStretch::* seek_length() { return &TDStretch_Access::seekLength; }
+	static int soundtouch::TDStretch::* overlap_length() { return &TDStretch_Access::overlapLength; }
+};
+
+// TDStretch's best overlap search, using whichever calcCrossCorr() it picked
+class TDStretch_Seek : public Kernel {
+	soundtouch::TDStretch* td;
+	std::vector<soundtouch::SAMPLETYPE> in;
+	int offset;
+public:
+	TDStretch_Seek() : Kernel( "TDStretch.seek", "mac" ), offset( 0 )
+	{
+		td = soundtouch::TDStretch::newInstance();
+		td->setChannels( 2 );
+		td->setParameters( 44100 );
+		td->enableQuickSeek( false );
+		int seek = td->*TDStretch_Access::seek_length();
+		int overlap = td->*TDStretch_Access::overlap_length();
+		in.resize( (seek + overlap + 16) * 2 );
+		for ( size_t i = 0; i < in.size(); i++ )
+			in [i] = (soundtouch::SAMPLETYPE) (10000 * sin( i * 0.01 ) + (i * 7919 % 1000));
+		units = (double) seek * overlap * 2;
+		bytes = (double) (seek + overlap) * 2 * sizeof (soundtouch::SAMPLETYPE);
+	}
+	~TDStretch_Seek() { delete td; }
+	void run()
+	{
+		// alternate between positions of both alignments
+		offset ^= 2;
+		(td->*TDStretch_Access::seek_full())( &in [offset] );
+	}
+};
+
+// One forward and one inverse rubberband FFT of the given size
+class Rubberband_FFT : public Kernel {
+	RubberBand::FFT fft;
+	Bench_Buffer<float> in, re, im;
+	int size;
+public:
+	Rubberband_FFT( const char* name, int size_ ) : Kernel( name ), fft( size_ ),
+			in( size_ ), re( size_ / 2 + 1 ), im( size_ / 2 + 1 ), size( size_ )
+	{
+		fft.initFloat();
+		fill_noise( in, size );
+		units = size;
+		bytes = 4.0 * size * sizeof (float);
+	}
+	void run()
+	{
+		fft.forward( in, re, im );
+		fft.inverse( re, im, in );
+	}
+};
+
+// sha256_update() over 1 MB
+class Sha256_Update : public Kernel {
+	enum { size = 1 << 20 };
+	std::vector<BYTE> data;
+public:
+	Sha256_Update() : Kernel( "sha256.update", "byte" ), data( size )
+	{
+		for ( size_t i = 0; i < data.size(); i++ )
+			data [i] = (BYTE) (i * 7919 >> 3);
+		units = size;
+		bytes = size;
+	}
+	void run()
+	{
+		SHA256_CTX ctx;
+		sha256_init( &ctx );
+		sha256_update( &ctx, &data [0], data.size() );
+	}
+};
+
+// dr_wav's f32 to s16 and s16 to f32 conversions
+class Drwav_F32_To_S16 : public Kernel {
+	enum { count = 65536 };
+	Bench_Buffer<float> in;
+	Bench_Buffer<drwav_int16> out;
+public:
+	Drwav_F32_To_S16() : Kernel( "drwav.f32_to_s16" ), in( count ), out( count )
+	{
+		fill_noise( in, count, 1.2f ); // some out of range, to be clamped
+		units = count;
+		bytes = count * (sizeof (float) + sizeof (drwav_int16));
+	}
+	void run() { drwav_f32_to_s16( out, in, count ); }
+};
+
+class Drwav_S16_To_F32 : public Kernel {
+	enum { count = 65536 };
+	Bench_Buffer<drwav_int16> in;
+	Bench_Buffer<float> out;
+public:
+	Drwav_S16_To_F32() : Kernel( "drwav.s16_to_f32" ), in( count ), out( count )
+	{
+		fill_noise( in.data, count );
+		units = count;
+		bytes = count * (sizeof (float) + sizeof (drwav_int16));
+	}
+	void run() { drwav_s16_to_f32( out, in, count ); }
+};
+
+struct Result {
+	const Kernel* kernel;
+	long runs;          // per repetition
+	double cycles;      // per run, median
+	double ns;          // per run, median
+};
+
+static double median( std::vector<double>& v )
+{
+	std::sort( v.begin(), v.end() );
+	size_t n = v.size();
+	return n & 1 ? v [n / 2] : (v [n / 2 - 1] + v [n / 2]) / 2;
+}
+
+static Result measure( Kernel& k, int reps, double rep_ns )
+{
+	// warm up, and find how many runs take about rep_ns
+	long runs = 1;
+	double start = now_ns();
+	for ( ;; )
+	{
+		double t = now_ns();
+		for ( long i = 0; i < runs; i++ )
+			k.run();
+		t = now_ns() - t;
+		if ( t < rep_ns / 2 )
+			runs *= 2;
+		else if ( now_ns() - start >= rep_ns )
+			break;
+	}
+
+	std::vector<double> cycles, ns;
+	for ( int r = 0; r < reps; r++ )
+	{
+		Xbyak::util::Clock clock;
+		double t = now_ns();
+		clock.begin();
+		for ( long i = 0; i < runs; i++ )
+			k.run();
+		clock.end();
+		t = now_ns() - t;
+		cycles.push_back( (double) clock.getClock() / runs );
+		ns.push_back( t / runs );
+	}
+
+	Result res;
+	res.kernel = &k;
+	res.runs = runs;
+	res.cycles = median( cycles );
+	res.ns = median( ns );
+	return res;
+}
+
+static void write_json( FILE* out, std::vector<Result> const& results, int cpu )
+{
+	unsigned features = cpu_features();
+	fprintf( out, "{\n  \"cpu\": %d,\n  \"cpu_features\": [", cpu );
+	int first = 1;
+	for ( size_t i = 0; i < sizeof cpu_feature_names / sizeof cpu_feature_names [0]; i++ )
+	{
+		if ( features & cpu_feature_names [i].feature )
+		{
+			fprintf( out, "%s\"%s\"", first ? "" : ", ", cpu_feature_names [i].name );
+			first = 0;
+		}
+	}
+	fprintf( out, "],\n  \"kernels\": [\n" );
+	for ( size_t i = 0; i < results.size(); i++ )
+	{
+		Result const& r = results [i];
+		fprintf( out, "    { \"name\": \"%s\", \"unit\": \"%s\", \"units_per_run\": %.0f, "
+				"\"runs\": %ld, \"ns_per_run\": %.1f, \"cycles_per_run\": %.1f, "
+				"\"cycles_per_unit\": %.4f, \"gb_per_sec\": %.3f }%s\n",
+				r.kernel->name, r.kernel->unit, r.kernel->units, r.runs, r.ns, r.cycles,
+				r.cycles / r.kernel->units, r.kernel->bytes / r.ns,
+				i + 1 < results.size() ? "," : "" );
+	}
+	fprintf( out, "  ]\n}\n" );
+}
+
+int main( int argc, char** argv )
+{
+	int cpu = -1;
+	int pin = 1;
+	int reps = 11;
+	double rep_ms = 20;
+	const char* json = NULL;
+	std::vector<const char*> names;
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( !strcmp( argv [i], "-cpu" ) && i + 1 < argc )
+			cpu = atoi( argv [++i] );
+		else if ( !strcmp( argv [i], "-nopin" ) )
+			pin = 0;
+		else if ( !strcmp( argv [i], "-reps" ) && i + 1 < argc )
+			reps = std::max( 1, atoi( argv [++i] ) );
+		else if ( !strcmp( argv [i], "-ms" ) && i + 1 < argc )
+			rep_ms = std::max( 1.0, atof( argv [++i] ) );
+		else if ( !strcmp( argv [i], "-json" ) && i + 1 < argc )
+			json = argv [++i];
+		else if ( argv [i] [0] == '-' )
+		{
+			fprintf( stderr, "usage: %s [-cpu n] [-nopin] [-reps n] [-ms n] [-json file] [name...]\n", argv [0] );
+			return EXIT_FAILURE;
+		}
+		else
+			names.push_back( argv [i] );
+	}
+
+	if ( pin )
+	{
+		cpu = pin_thread( cpu );
+		if ( cpu < 0 )
+			fprintf( stderr, "Couldn't pin thread; timings may be noisy\n" );
+	}
+
+	std::vector<Kernel*> kernels;
+	kernels.push_back( new Blip_Read( "Blip_Buffer.read", 0 ) );
+	kernels.push_back( new Blip_Read( "Blip_Buffer.read_stereo", 1 ) );
+	kernels.push_back( new Fir_Read );
+	kernels.push_back( new Sinc_Process( "resampler_sinc.normal", RESAMPLER_QUALITY_NORMAL ) );
+	kernels.push_back( new Sinc_Process( "resampler_sinc.highest", RESAMPLER_QUALITY_HIGHEST ) );
+	kernels.push_back( new TDStretch_Seek );
+	kernels.push_back( new Rubberband_FFT( "rubberband.fft_2048", 2048 ) );
+	kernels.push_back( new Sha256_Update );
+	kernels.push_back( new Drwav_F32_To_S16 );
+	kernels.push_back( new Drwav_S16_To_F32 );
+
+	printf( "%-26s %12s %14s %10s\n", "kernel", "ns/run", "cycles/unit", "GB/s" );
+	std::vector<Result> results;
+	for ( size_t i = 0; i < kernels.size(); i++ )
+	{
+		Kernel& k = *kernels [i];
+		int wanted = names.empty();
+		for ( size_t n = 0; n < names.size(); n++ )
+			wanted |= strstr( k.name, names [n] ) != NULL;
+		if ( !wanted )
+			continue;
+
+		Result r = measure( k, reps, rep_ms * 1e6 );
+		results.push_back( r );
+		printf( "%-26s %12.1f %10.3f/%-4s %9.3f\n", k.name, r.ns, r.cycles / k.units,
+				k.unit, k.bytes / r.ns );
+		fflush( stdout );
+	}
+
+	if ( json )
+	{
+		FILE* out = fopen( json, "w" );
+		if ( !out )
+		{
+			perror( json );
+			return EXIT_FAILURE;
+		}
+		write_json( out, results, cpu );
+		fclose( out );
+	}
+
+	for ( size_t i = 0; i < kernels.size(); i++ )
+		delete kernels [i];
+	return 0;
+}
@@ -195,18 +195,126 @@ eff_adr_mode(int dis_mode, int pfx_adr)
 }
 
 
-/* 
+/*
+ * ud_pfx_kind
+ *    Classifies each byte value as one of the legacy prefixes, a rex
+ *    prefix (only meaningful in 64bit mode) or not a prefix at all, so
+ *    that the prefix bytes of an instruction can be scanned with a single
+ *    table lookup per byte.
+ */
+enum ud_pfx_kind {
+  PFX_NONE, PFX_CS, PFX_SS, PFX_DS, PFX_ES, PFX_FS, PFX_GS,
+  PFX_ADR, PFX_LOCK, PFX_OPR, PFX_F2, PFX_F3, PFX_REX
+};
+
+static const uint8_t ud_pfx_kind[256] = {
+  /* 0x00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x20 */ 0, 0, 0, 0, 0, 0, PFX_ES, 0, 0, 0, 0, 0, 0, 0, PFX_CS, 0,
+  /* 0x30 */ 0, 0, 0, 0, 0, 0, PFX_SS, 0, 0, 0, 0, 0, 0, 0, PFX_DS, 0,
+  /* 0x40 */ PFX_REX, PFX_REX, PFX_REX, PFX_REX,
+             PFX_REX, PFX_REX, PFX_REX, PFX_REX,
+             PFX_REX, PFX_REX, PFX_REX, PFX_REX,
+             PFX_REX, PFX_REX, PFX_REX, PFX_REX,
+  /* 0x50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x60 */ 0, 0, 0, 0, PFX_FS, PFX_GS, PFX_OPR, PFX_ADR,
+             0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xa0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xb0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xc0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xd0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xe0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0xf0 */ PFX_LOCK, 0, PFX_F2, PFX_F3, 0, 0, 0, 0,
+             0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+/*
+ * is_prefix
+ *    Returns non-zero if the byte continues the prefix sequence in the
+ *    current mode.
+ */
+static inline int
+is_prefix(const struct ud *u, uint8_t curr)
+{
+  uint8_t kind = ud_pfx_kind[curr];
+  return kind != PFX_NONE && (kind != PFX_REX || u->dis_mode == 64);
+}
+
+
+/*
+ * apply_prefix
+ *    Records a single legacy prefix byte.
+ */
+static inline void
+apply_prefix(struct ud *u, uint8_t curr)
+{
+  switch (ud_pfx_kind[curr])
+  {
+  case PFX_CS:   u->pfx_seg  = UD_R_CS; break;
+  case PFX_SS:   u->pfx_seg  = UD_R_SS; break;
+  case PFX_DS:   u->pfx_seg  = UD_R_DS; break;
+  case PFX_ES:   u->pfx_seg  = UD_R_ES; break;
+  case PFX_FS:   u->pfx_seg  = UD_R_FS; break;
+  case PFX_GS:   u->pfx_seg  = UD_R_GS; break;
+  case PFX_ADR:  u->pfx_adr  = 0x67;    break; /* adress-size override */
+  case PFX_LOCK: u->pfx_lock = 0xF0;    break;
+  case PFX_OPR:  u->pfx_opr  = 0x66;    break;
+  case PFX_F2:   u->pfx_str  = 0xf2;    break;
+  case PFX_F3:   u->pfx_str  = 0xf3;    break;
+  default:                              break; /* rex, see below */
+  }
+}
+
+
+/*
  * decode_prefixes
  *
  *  Extracts instruction prefixes.
+ *
+ *  When decoding from a buffer the prefix run is first scanned in place,
+ *  which for most instructions is a single table lookup, and the bytes
+ *  are consumed in one step. Anything out of the ordinary (running into
+ *  the end of the buffer or the max instruction length) falls back to
+ *  reading byte by byte, which reports the error.
  */
 static int 
 decode_prefixes(struct ud *u)
 {
-  int done = 0;
   uint8_t curr = 0, last = 0;
   UD_RETURN_ON_ERROR(u);
 
+  if (u->inp_buf != NULL && u->inp_end == 0 &&
+      u->inp_buf_index < u->inp_buf_size) {
+    const uint8_t *ptr = u->inp_buf + u->inp_buf_index;
+    size_t avail = u->inp_buf_size - u->inp_buf_index;
+    size_t n = 0;
+
+    if (avail > MAX_INSN_LENGTH - 1 - u->inp_ctr) {
+      avail = MAX_INSN_LENGTH - 1 - u->inp_ctr;
+    }
+    while (n < avail && is_prefix(u, ptr[n])) {
+      ++n;
+    }
+    if (n < avail) {
+      size_t i;
+      for (i = 0; i < n; ++i) {
+        apply_prefix(u, ptr[i]);
+      }
+      /* rex prefixes in 64bit mode, must be the last prefix */
+      if (n > 0 && u->dis_mode == 64 && (ptr[n - 1] & 0xF0) == 0x40) {
+        u->pfx_rex = ptr[n - 1];
+      }
+      u->inp_curr = ptr[n];
+      u->inp_ctr += n + 1;
+      u->inp_buf_index += n + 1;
+      return 0;
+    }
+  }
+
   do {
     last = curr;
     curr = inp_next(u); 
@@ -214,48 +322,8 @@ decode_prefixes(struct ud *u)
     if (u->inp_ctr == MAX_INSN_LENGTH) {
       UD_RETURN_WITH_ERROR(u, "max instruction length");
     }
-   
-    switch (curr)  
-    {
-    case 0x2E: 
-      u->pfx_seg = UD_R_CS; 
-      break;
-    case 0x36:     
-      u->pfx_seg = UD_R_SS; 
-      break;
-    case 0x3E: 
-      u->pfx_seg = UD_R_DS; 
-      break;
-    case 0x26: 
-      u->pfx_seg = UD_R_ES; 
-      break;
-    case 0x64: 
-      u->pfx_seg = UD_R_FS; 
-      break;
-    case 0x65: 
-      u->pfx_seg = UD_R_GS; 
-      break;
-    case 0x67: /* adress-size override prefix */ 
-      u->pfx_adr = 0x67;
-      break;
-    case 0xF0: 
-      u->pfx_lock = 0xF0;
-      break;
-    case 0x66: 
-      u->pfx_opr = 0x66;
-      break;
-    case 0xF2:
-      u->pfx_str = 0xf2;
-      break;
-    case 0xF3:
-      u->pfx_str = 0xf3;
-      break;
-    default:
-      /* consume if rex */
-      done = (u->dis_mode == 64 && (curr & 0xF0) == 0x40) ? 0 : 1;
-      break;
-    }
-  } while (!done);
+    apply_prefix(u, curr);
+  } while (is_prefix(u, curr));
   /* rex prefixes in 64bit mode, must be the last prefix */
   if (u->dis_mode == 64 && (last & 0xF0) == 0x40) {
     u->pfx_rex = last;  
@@ -297,7 +365,7 @@ static int resolve_mnemonic( struct ud* u )
 {
   /* resolve 3dnow weirdness. */
   if ( u->mnemonic == UD_I3dnow ) {
-    u->mnemonic = ud_itab[ u->le->table[ inp_curr( u )  ] ].mnemonic;
+    u->mnemonic = ud_itab[ ud_lookup_table(u->le, inp_curr( u )) ].mnemonic;
   }
   /* SWAPGS is only valid in 64bits mode */
   if ( u->mnemonic == UD_Iswapgs && u->dis_mode != 64 ) {
@@ -799,14 +867,14 @@ static int
 decode_operands(struct ud* u)
 {
   decode_operand(u, &u->operand[0],
-                    u->itab_entry->operand1.type,
-                    u->itab_entry->operand1.size);
+                    u->itab_form->operand1.type,
+                    u->itab_form->operand1.size);
   decode_operand(u, &u->operand[1],
-                    u->itab_entry->operand2.type,
-                    u->itab_entry->operand2.size);
+                    u->itab_form->operand2.type,
+                    u->itab_form->operand2.size);
   decode_operand(u, &u->operand[2],
-                    u->itab_entry->operand3.type,
-                    u->itab_entry->operand3.size);
+                    u->itab_form->operand3.type,
+                    u->itab_form->operand3.size);
   return 0;
 }
     
@@ -829,6 +897,7 @@ clear_insn(register struct ud* u)
   u->pfx_str   = 0;
   u->mnemonic  = UD_Inone;
   u->itab_entry = NULL;
+  u->itab_form = NULL;
   u->have_modrm = 0;
   u->br_far    = 0;
 
@@ -842,7 +911,7 @@ static inline int
 resolve_pfx_str(struct ud* u)
 {
   if (u->pfx_str == 0xf3) {
-    if (P_STR(u->itab_entry->prefix)) {
+    if (P_STR(u->itab_form->prefix)) {
         u->pfx_rep  = 0xf3;
     } else {
         u->pfx_repe = 0xf3;
@@ -865,7 +934,7 @@ resolve_mode( struct ud* u )
   if ( u->dis_mode == 64 ) {  /* set 64bit-mode flags */
 
     /* Check validity of  instruction m64 */
-    if ( P_INV64( u->itab_entry->prefix ) ) {
+    if ( P_INV64( u->itab_form->prefix ) ) {
       UDERR(u, "instruction invalid in 64bits\n");
       return -1;
     }
@@ -874,12 +943,12 @@ resolve_mode( struct ud* u )
      * instruction hard-coded in the opcode map.
      */
     u->pfx_rex = ( u->pfx_rex & 0x40 ) | 
-                 ( u->pfx_rex & REX_PFX_MASK( u->itab_entry->prefix ) ); 
+                 ( u->pfx_rex & REX_PFX_MASK( u->itab_form->prefix ) ); 
 
     /* whether this instruction has a default operand size of 
      * 64bit, also hardcoded into the opcode map.
      */
-    default64 = P_DEF64( u->itab_entry->prefix ); 
+    default64 = P_DEF64( u->itab_form->prefix ); 
     /* calculate effective operand size */
     if ( REX_W( u->pfx_rex ) ) {
         u->opr_mode = 64;
@@ -912,6 +981,7 @@ decode_insn(struct ud *u, uint16_t ptr)
 {
   UD_ASSERT((ptr & 0x8000) == 0);
   u->itab_entry = &ud_itab[ ptr ];
+  u->itab_form = &ud_itab_form[ u->itab_entry->form ];
   u->mnemonic = u->itab_entry->mnemonic;
   return (resolve_pfx_str(u)  == 0 &&
           resolve_mode(u)     == 0 &&
@@ -936,13 +1006,13 @@ decode_3dnow(struct ud* u)
 {
   uint16_t ptr;
   UD_ASSERT(u->le->type == UD_TAB__OPC_3DNOW);
-  UD_ASSERT(u->le->table[0xc] != 0);
-  decode_insn(u, u->le->table[0xc]);
+  UD_ASSERT(ud_lookup_table(u->le, 0xc) != 0);
+  decode_insn(u, ud_lookup_table(u->le, 0xc));
   inp_next(u); 
   if (u->error) {
     return -1;
   }
-  ptr = u->le->table[inp_curr(u)]; 
+  ptr = ud_lookup_table(u->le, inp_curr(u)); 
   UD_ASSERT((ptr & 0x8000) == 0);
   u->mnemonic = ud_itab[ptr].mnemonic;
   return 0;
@@ -964,10 +1034,10 @@ decode_ssepfx(struct ud *u)
     pfx = u->pfx_opr;
   }
   idx = ((pfx & 0xf) + 1) / 2;
-  if (u->le->table[idx] == 0) {
+  if (ud_lookup_table(u->le, idx) == 0) {
     idx = 0;
   }
-  if (idx && u->le->table[idx] != 0) {
+  if (idx && ud_lookup_table(u->le, idx) != 0) {
     /*
      * "Consume" the prefix as a part of the opcode, so it is no
      * longer exported as an instruction prefix.
@@ -982,7 +1052,7 @@ decode_ssepfx(struct ud *u)
         u->pfx_opr = 0;
     }
   }
-  return decode_ext(u, u->le->table[idx]);
+  return decode_ext(u, ud_lookup_table(u->le, idx));
 }
 
 
@@ -1026,7 +1096,7 @@ decode_ext(struct ud *u, uint16_t ptr)
     case UD_TAB__OPC_VENDOR:
       if (u->vendor == UD_VENDOR_ANY) {
         /* choose a valid entry */
-        idx = (u->le->table[idx] != 0) ? 0 : 1;
+        idx = (ud_lookup_table(u->le, idx) != 0) ? 0 : 1;
       } else if (u->vendor == UD_VENDOR_AMD) {
         idx = 0;
       } else {
@@ -1046,7 +1116,7 @@ decode_ext(struct ud *u, uint16_t ptr)
       break;
   }
 
-  return decode_ext(u, u->le->table[idx]);
+  return decode_ext(u, ud_lookup_table(u->le, idx));
 }
 
 
@@ -1057,7 +1127,7 @@ decode_opcode(struct ud *u)
   UD_ASSERT(u->le->type == UD_TAB__OPC_TABLE);
   UD_RETURN_ON_ERROR(u);
   u->primary_opcode = inp_curr(u);
-  ptr = u->le->table[inp_curr(u)];
+  ptr = ud_lookup_table(u->le, inp_curr(u));
   if (ptr & 0x8000) {
     u->le = &ud_lookup_table_list[ptr & ~0x8000];
     if (u->le->type == UD_TAB__OPC_TABLE) {
@@ -1088,13 +1158,14 @@ ud_decode(struct ud *u)
     clear_insn(u);
     /* mark the sequence of bytes as invalid. */
     u->itab_entry = &ud_itab[0]; /* entry 0 is invalid */
+    u->itab_form = &ud_itab_form[0];
     u->mnemonic = u->itab_entry->mnemonic;
   } 
 
     /* maybe this stray segment override byte
      * should be spewed out?
      */
-    if ( !P_SEG( u->itab_entry->prefix ) && 
+    if ( !P_SEG( u->itab_form->prefix ) && 
             u->operand[0].type != UD_OP_MEM &&
             u->operand[1].type != UD_OP_MEM )
         u->pfx_seg = 0;
@@ -152,27 +152,39 @@ Mx_reg_size(enum ud_operand_size size)
  */
 struct ud_itab_entry_operand 
 {
-  enum ud_operand_code type;
-  enum ud_operand_size size;
+  uint16_t type;  /* enum ud_operand_code */
+  uint16_t size;  /* enum ud_operand_size */
 };
 
 
-/* A single entry in an instruction table. 
- *(internal use only)
+/* The operands and prefix flags of an instruction table entry. Entries
+ * with the same operand form share one of these.
+ * (internal use only)
  */
-struct ud_itab_entry 
+struct ud_itab_form
 {
-  enum ud_mnemonic_code         mnemonic;
   struct ud_itab_entry_operand  operand1;
   struct ud_itab_entry_operand  operand2;
   struct ud_itab_entry_operand  operand3;
   uint32_t                      prefix;
 };
 
+
+/* A single entry in an instruction table, packed into 32 bits.
+ * (internal use only)
+ */
+struct ud_itab_entry 
+{
+  uint16_t                      mnemonic;  /* enum ud_mnemonic_code */
+  uint16_t                      form;      /* index into ud_itab_form */
+};
+
+/* A lookup table, stored at `offset` in ud_itab_tables.
+ * (internal use only)
+ */
 struct ud_lookup_table_list_entry {
-    const uint16_t *table;
-    enum ud_table_type type;
-    const char *meta;
+    uint16_t offset;
+    uint16_t type;  /* enum ud_table_type */
 };
      
 
@@ -183,8 +195,17 @@ ud_opcode_field_sext(uint8_t primary_opcode)
   return (primary_opcode & 0x02) != 0;
 }
 
-extern struct ud_itab_entry ud_itab[];
-extern struct ud_lookup_table_list_entry ud_lookup_table_list[];
+extern const struct ud_itab_entry ud_itab[];
+extern const struct ud_itab_form ud_itab_form[];
+extern const uint16_t ud_itab_tables[];
+extern const struct ud_lookup_table_list_entry ud_lookup_table_list[];
+
+/* Returns the idx'th element of the lookup table. */
+static inline uint16_t
+ud_lookup_table(const struct ud_lookup_table_list_entry *le, unsigned int idx)
+{
+  return ud_itab_tables[le->offset + idx];
+}
 
 #endif /* UD_DECODE_H */
 
@@ -60,6 +60,10 @@ extern unsigned int ud_decode(struct ud*);
 
 extern unsigned int ud_disassemble(struct ud*);
 
+extern size_t ud_decode_batch(struct ud*, struct ud_insn_rec*, size_t);
+
+extern const char* ud_format_rec(struct ud*, const struct ud_insn_rec*);
+
 extern void ud_translate_intel(struct ud*);
 
 extern void ud_translate_att(struct ud*);
@@ -97,6 +101,15 @@ extern void ud_set_sym_resolver(struct ud *u,
                                                         uint64_t addr,
                                                         int64_t *offset));
 
+extern void ud_symtab_init(struct ud_symtab*, struct ud_symbol*, size_t);
+
+extern const char* ud_symtab_lookup(const struct ud_symtab*, uint64_t addr,
+                                    int64_t *offset, size_t *hint);
+
+extern void ud_set_symtab(struct ud*, const struct ud_symtab*);
+
+extern size_t ud_decode_regions(const struct ud*, struct ud_region*, size_t);
+
 /* ========================================================================== */
 
 #ifdef __cplusplus
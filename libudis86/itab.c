@@ -3,429 +3,358 @@
 
 #define GROUP(n) (0x8000 | (n))
 
-
-static const uint16_t ud_itab__1[] = {
+/*
+ * ud_itab_tables -- all opcode lookup tables, back to back. Table 0, the
+ * one-byte opcode map, is at offset 0 and is indexed directly by the first
+ * opcode byte.
+ */
+const uint16_t ud_itab_tables[] = {
+  /* 0000: UD_TAB__OPC_TABLE, table0 */
+  /*  0 */           1,           2,           3,           4,
+  /*  4 */           5,           6,    GROUP(1),    GROUP(2),
+  /*  8 */           9,          10,          11,          12,
+  /*  c */          13,          14,    GROUP(3),    GROUP(4),
+  /* 10 */         628,         629,         630,         631,
+  /* 14 */         632,         633,  GROUP(563),  GROUP(564),
+  /* 18 */         636,         637,         638,         639,
+  /* 1c */         640,         641,  GROUP(565),  GROUP(566),
+  /* 20 */         644,         645,         646,         647,
+  /* 24 */         648,         649,           0,  GROUP(567),
+  /* 28 */         651,         652,         653,         654,
+  /* 2c */         655,         656,           0,  GROUP(568),
+  /* 30 */         658,         659,         660,         661,
+  /* 34 */         662,         663,           0,  GROUP(569),
+  /* 38 */         665,         666,         667,         668,
+  /* 3c */         669,         670,           0,  GROUP(570),
+  /* 40 */         672,         673,         674,         675,
+  /* 44 */         676,         677,         678,         679,
+  /* 48 */         680,         681,         682,         683,
+  /* 4c */         684,         685,         686,         687,
+  /* 50 */         688,         689,         690,         691,
+  /* 54 */         692,         693,         694,         695,
+  /* 58 */         696,         697,         698,         699,
+  /* 5c */         700,         701,         702,         703,
+  /* 60 */  GROUP(571),  GROUP(574),  GROUP(577),  GROUP(578),
+  /* 64 */           0,           0,           0,           0,
+  /* 68 */         711,         712,         713,         714,
+  /* 6c */         715,  GROUP(579),         718,  GROUP(580),
+  /* 70 */         721,         722,         723,         724,
+  /* 74 */         725,         726,         727,         728,
+  /* 78 */         729,         730,         731,         732,
+  /* 7c */         733,         734,         735,         736,
+  /* 80 */  GROUP(581),  GROUP(582),  GROUP(583),  GROUP(592),
+  /* 84 */         769,         770,         771,         772,
+  /* 88 */         773,         774,         775,         776,
+  /* 8c */         777,         778,         779,  GROUP(593),
+  /* 90 */         781,         782,         783,         784,
+  /* 94 */         785,         786,         787,         788,
+  /* 98 */  GROUP(594),  GROUP(595),  GROUP(596),         796,
+  /* 9c */  GROUP(597),  GROUP(601),         806,         807,
+  /* a0 */         808,         809,         810,         811,
+  /* a4 */         812,  GROUP(605),         816,  GROUP(606),
+  /* a8 */         820,         821,         822,  GROUP(607),
+  /* ac */         826,  GROUP(608),         830,  GROUP(609),
+  /* b0 */         834,         835,         836,         837,
+  /* b4 */         838,         839,         840,         841,
+  /* b8 */         842,         843,         844,         845,
+  /* bc */         846,         847,         848,         849,
+  /* c0 */  GROUP(610),  GROUP(611),         866,         867,
+  /* c4 */  GROUP(612),  GROUP(613),  GROUP(614),  GROUP(615),
+  /* c8 */         872,         873,         874,         875,
+  /* cc */         876,         877,  GROUP(616),  GROUP(617),
+  /* d0 */  GROUP(618),  GROUP(619),  GROUP(620),  GROUP(621),
+  /* d4 */  GROUP(622),  GROUP(623),  GROUP(624),         917,
+  /* d8 */  GROUP(625),  GROUP(700),  GROUP(762),  GROUP(806),
+  /* dc */  GROUP(865),  GROUP(940),  GROUP(998), GROUP(1066),
+  /* e0 */        1395,        1396,        1397, GROUP(1126),
+  /* e4 */        1401,        1402,        1403,        1404,
+  /* e8 */        1405,        1406, GROUP(1127),        1408,
+  /* ec */        1409,        1410,        1411,        1412,
+  /* f0 */        1413,        1414,        1415,        1416,
+  /* f4 */        1417,        1418, GROUP(1128), GROUP(1129),
+  /* f8 */        1435,        1436,        1437,        1438,
+  /* fc */        1439,        1440, GROUP(1130), GROUP(1131),
+  /* 0001: UD_TAB__OPC_MODE, /m */
   /*  0 */           7,           0,
-};
-
-static const uint16_t ud_itab__2[] = {
+  /* 0002: UD_TAB__OPC_MODE, /m */
   /*  0 */           8,           0,
-};
-
-static const uint16_t ud_itab__3[] = {
+  /* 0003: UD_TAB__OPC_MODE, /m */
   /*  0 */          15,           0,
-};
-
-static const uint16_t ud_itab__6[] = {
+  /* 0004: UD_TAB__OPC_TABLE, 0f */
+  /*  0 */    GROUP(5),   GROUP(12),   GROUP(87),   GROUP(88),
+  /*  4 */           0,   GROUP(89),   GROUP(90),   GROUP(91),
+  /*  8 */   GROUP(92),   GROUP(93),           0,   GROUP(94),
+  /*  c */           0,   GROUP(95),  GROUP(104),  GROUP(105),
+  /* 10 */  GROUP(106),  GROUP(107),  GROUP(108),  GROUP(118),
+  /* 14 */  GROUP(119),  GROUP(120),  GROUP(121),  GROUP(129),
+  /* 18 */  GROUP(130),  GROUP(135),  GROUP(136),  GROUP(137),
+  /* 1c */  GROUP(138),  GROUP(139),  GROUP(140),  GROUP(141),
+  /* 20 */  GROUP(142),  GROUP(143),  GROUP(144),  GROUP(145),
+  /* 24 */           0,           0,           0,           0,
+  /* 28 */  GROUP(146),  GROUP(147),  GROUP(148),  GROUP(149),
+  /* 2c */  GROUP(150),  GROUP(151),  GROUP(152),  GROUP(153),
+  /* 30 */  GROUP(154),  GROUP(155),  GROUP(156),  GROUP(157),
+  /* 34 */  GROUP(158),  GROUP(161),           0,  GROUP(164),
+  /* 38 */  GROUP(165),           0,  GROUP(225),           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 40 */  GROUP(252),  GROUP(253),  GROUP(254),  GROUP(255),
+  /* 44 */  GROUP(256),  GROUP(257),  GROUP(258),  GROUP(259),
+  /* 48 */  GROUP(260),  GROUP(261),  GROUP(262),  GROUP(263),
+  /* 4c */  GROUP(264),  GROUP(265),  GROUP(266),  GROUP(267),
+  /* 50 */  GROUP(268),  GROUP(269),  GROUP(270),  GROUP(271),
+  /* 54 */  GROUP(272),  GROUP(273),  GROUP(274),  GROUP(275),
+  /* 58 */  GROUP(276),  GROUP(277),  GROUP(278),  GROUP(279),
+  /* 5c */  GROUP(280),  GROUP(281),  GROUP(282),  GROUP(283),
+  /* 60 */  GROUP(284),  GROUP(285),  GROUP(286),  GROUP(287),
+  /* 64 */  GROUP(288),  GROUP(289),  GROUP(290),  GROUP(291),
+  /* 68 */  GROUP(292),  GROUP(293),  GROUP(294),  GROUP(295),
+  /* 6c */  GROUP(296),  GROUP(297),  GROUP(298),  GROUP(299),
+  /* 70 */  GROUP(300),  GROUP(301),  GROUP(305),  GROUP(309),
+  /* 74 */  GROUP(314),  GROUP(315),  GROUP(316),  GROUP(317),
+  /* 78 */  GROUP(318),  GROUP(320),           0,           0,
+  /* 7c */  GROUP(322),  GROUP(323),  GROUP(324),  GROUP(325),
+  /* 80 */  GROUP(326),  GROUP(327),  GROUP(328),  GROUP(329),
+  /* 84 */  GROUP(330),  GROUP(331),  GROUP(332),  GROUP(333),
+  /* 88 */  GROUP(334),  GROUP(335),  GROUP(336),  GROUP(337),
+  /* 8c */  GROUP(338),  GROUP(339),  GROUP(340),  GROUP(341),
+  /* 90 */  GROUP(342),  GROUP(343),  GROUP(344),  GROUP(345),
+  /* 94 */  GROUP(346),  GROUP(347),  GROUP(348),  GROUP(349),
+  /* 98 */  GROUP(350),  GROUP(351),  GROUP(352),  GROUP(353),
+  /* 9c */  GROUP(354),  GROUP(355),  GROUP(356),  GROUP(357),
+  /* a0 */  GROUP(358),  GROUP(359),  GROUP(360),  GROUP(361),
+  /* a4 */  GROUP(362),  GROUP(363),  GROUP(364),  GROUP(375),
+  /* a8 */  GROUP(395),  GROUP(396),  GROUP(397),  GROUP(398),
+  /* ac */  GROUP(399),  GROUP(400),  GROUP(401),  GROUP(469),
+  /* b0 */  GROUP(470),  GROUP(471),  GROUP(472),  GROUP(473),
+  /* b4 */  GROUP(474),  GROUP(475),  GROUP(476),  GROUP(477),
+  /* b8 */  GROUP(478),           0,  GROUP(479),  GROUP(484),
+  /* bc */  GROUP(485),  GROUP(486),  GROUP(487),  GROUP(488),
+  /* c0 */  GROUP(489),  GROUP(490),  GROUP(491),  GROUP(492),
+  /* c4 */  GROUP(493),  GROUP(494),  GROUP(495),  GROUP(496),
+  /* c8 */  GROUP(505),  GROUP(506),  GROUP(507),  GROUP(508),
+  /* cc */  GROUP(509),  GROUP(510),  GROUP(511),  GROUP(512),
+  /* d0 */  GROUP(513),  GROUP(514),  GROUP(515),  GROUP(516),
+  /* d4 */  GROUP(517),  GROUP(518),  GROUP(519),  GROUP(520),
+  /* d8 */  GROUP(521),  GROUP(522),  GROUP(523),  GROUP(524),
+  /* dc */  GROUP(525),  GROUP(526),  GROUP(527),  GROUP(528),
+  /* e0 */  GROUP(529),  GROUP(530),  GROUP(531),  GROUP(532),
+  /* e4 */  GROUP(533),  GROUP(534),  GROUP(535),  GROUP(536),
+  /* e8 */  GROUP(537),  GROUP(538),  GROUP(539),  GROUP(540),
+  /* ec */  GROUP(541),  GROUP(542),  GROUP(543),  GROUP(544),
+  /* f0 */  GROUP(545),  GROUP(546),  GROUP(547),  GROUP(548),
+  /* f4 */  GROUP(549),  GROUP(550),  GROUP(551),  GROUP(552),
+  /* f8 */  GROUP(556),  GROUP(557),  GROUP(558),  GROUP(559),
+  /* fc */  GROUP(560),  GROUP(561),  GROUP(562),           0,
+  /* 0005: UD_TAB__OPC_REG, /reg */
+  /*  0 */    GROUP(6),    GROUP(7),    GROUP(8),    GROUP(9),
+  /*  4 */   GROUP(10),   GROUP(11),           0,           0,
+  /* 0006: UD_TAB__OPC_SSE, /sse */
   /*  0 */          16,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__7[] = {
+  /* 0007: UD_TAB__OPC_SSE, /sse */
   /*  0 */          17,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__8[] = {
+  /* 0008: UD_TAB__OPC_SSE, /sse */
   /*  0 */          18,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__9[] = {
+  /* 0009: UD_TAB__OPC_SSE, /sse */
   /*  0 */          19,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__10[] = {
+  /* 0010: UD_TAB__OPC_SSE, /sse */
   /*  0 */          20,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__11[] = {
+  /* 0011: UD_TAB__OPC_SSE, /sse */
   /*  0 */          21,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__5[] = {
-  /*  0 */    GROUP(6),    GROUP(7),    GROUP(8),    GROUP(9),
-  /*  4 */   GROUP(10),   GROUP(11),           0,           0,
-};
-
-static const uint16_t ud_itab__15[] = {
-  /*  0 */          22,           0,
-};
-
-static const uint16_t ud_itab__14[] = {
+  /* 0012: UD_TAB__OPC_MOD, /mod */
+  /*  0 */   GROUP(13),   GROUP(28),
+  /* 0013: UD_TAB__OPC_REG, /reg */
+  /*  0 */   GROUP(14),   GROUP(16),   GROUP(18),   GROUP(20),
+  /*  4 */   GROUP(22),           0,   GROUP(24),   GROUP(26),
+  /* 0014: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(15),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__17[] = {
-  /*  0 */          23,           0,
-};
-
-static const uint16_t ud_itab__16[] = {
+  /* 0015: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          22,           0,
+  /* 0016: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(17),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__19[] = {
-  /*  0 */          24,           0,
-};
-
-static const uint16_t ud_itab__18[] = {
+  /* 0017: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          23,           0,
+  /* 0018: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(19),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__21[] = {
-  /*  0 */          25,           0,
-};
-
-static const uint16_t ud_itab__20[] = {
+  /* 0019: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          24,           0,
+  /* 0020: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(21),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__23[] = {
-  /*  0 */          26,           0,
-};
-
-static const uint16_t ud_itab__22[] = {
+  /* 0021: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          25,           0,
+  /* 0022: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(23),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__25[] = {
-  /*  0 */          27,           0,
-};
-
-static const uint16_t ud_itab__24[] = {
+  /* 0023: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          26,           0,
+  /* 0024: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(25),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__27[] = {
-  /*  0 */          28,           0,
-};
-
-static const uint16_t ud_itab__26[] = {
+  /* 0025: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          27,           0,
+  /* 0026: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(27),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__13[] = {
-  /*  0 */   GROUP(14),   GROUP(16),   GROUP(18),   GROUP(20),
-  /*  4 */   GROUP(22),           0,   GROUP(24),   GROUP(26),
-};
-
-static const uint16_t ud_itab__32[] = {
-  /*  0 */           0,          29,           0,
-};
-
-static const uint16_t ud_itab__31[] = {
-  /*  0 */           0,   GROUP(32),
-};
-
-static const uint16_t ud_itab__30[] = {
+  /* 0027: UD_TAB__OPC_MOD, /mod */
+  /*  0 */          28,           0,
+  /* 0028: UD_TAB__OPC_REG, /reg */
+  /*  0 */   GROUP(29),   GROUP(42),   GROUP(47),   GROUP(52),
+  /*  4 */   GROUP(77),           0,   GROUP(79),   GROUP(81),
+  /* 0029: UD_TAB__OPC_RM, /rm */
+  /*  0 */           0,   GROUP(30),   GROUP(33),   GROUP(36),
+  /*  4 */   GROUP(39),           0,           0,           0,
+  /* 0030: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(31),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__35[] = {
-  /*  0 */           0,          30,           0,
-};
-
-static const uint16_t ud_itab__34[] = {
-  /*  0 */           0,   GROUP(35),
-};
-
-static const uint16_t ud_itab__33[] = {
+  /* 0031: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(32),
+  /* 0032: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,          29,           0,
+  /* 0033: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(34),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__38[] = {
-  /*  0 */           0,          31,           0,
-};
-
-static const uint16_t ud_itab__37[] = {
-  /*  0 */           0,   GROUP(38),
-};
-
-static const uint16_t ud_itab__36[] = {
+  /* 0034: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(35),
+  /* 0035: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,          30,           0,
+  /* 0036: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(37),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__41[] = {
-  /*  0 */           0,          32,           0,
-};
-
-static const uint16_t ud_itab__40[] = {
-  /*  0 */           0,   GROUP(41),
-};
-
-static const uint16_t ud_itab__39[] = {
+  /* 0037: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(38),
+  /* 0038: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,          31,           0,
+  /* 0039: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(40),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__29[] = {
-  /*  0 */           0,   GROUP(30),   GROUP(33),   GROUP(36),
-  /*  4 */   GROUP(39),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__44[] = {
-  /*  0 */           0,          33,
-};
-
-static const uint16_t ud_itab__43[] = {
+  /* 0040: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(41),
+  /* 0041: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,          32,           0,
+  /* 0042: UD_TAB__OPC_RM, /rm */
+  /*  0 */   GROUP(43),   GROUP(45),           0,           0,
+  /*  4 */           0,           0,           0,           0,
+  /* 0043: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(44),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__46[] = {
-  /*  0 */           0,          34,
-};
-
-static const uint16_t ud_itab__45[] = {
+  /* 0044: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          33,
+  /* 0045: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(46),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__42[] = {
-  /*  0 */   GROUP(43),   GROUP(45),           0,           0,
+  /* 0046: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          34,
+  /* 0047: UD_TAB__OPC_RM, /rm */
+  /*  0 */   GROUP(48),   GROUP(50),           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__49[] = {
-  /*  0 */           0,          35,
-};
-
-static const uint16_t ud_itab__48[] = {
+  /* 0048: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(49),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__51[] = {
-  /*  0 */           0,          36,
-};
-
-static const uint16_t ud_itab__50[] = {
+  /* 0049: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          35,
+  /* 0050: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(51),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__47[] = {
-  /*  0 */   GROUP(48),   GROUP(50),           0,           0,
-  /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__55[] = {
-  /*  0 */          37,           0,           0,
-};
-
-static const uint16_t ud_itab__54[] = {
-  /*  0 */           0,   GROUP(55),
-};
-
-static const uint16_t ud_itab__53[] = {
-  /*  0 */   GROUP(54),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__58[] = {
-  /*  0 */          38,           0,           0,
-};
-
-static const uint16_t ud_itab__57[] = {
-  /*  0 */           0,   GROUP(58),
-};
-
-static const uint16_t ud_itab__56[] = {
-  /*  0 */   GROUP(57),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__61[] = {
-  /*  0 */          39,           0,           0,
-};
-
-static const uint16_t ud_itab__60[] = {
-  /*  0 */           0,   GROUP(61),
-};
-
-static const uint16_t ud_itab__59[] = {
+  /* 0051: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          36,
+  /* 0052: UD_TAB__OPC_RM, /rm */
+  /*  0 */   GROUP(53),   GROUP(56),   GROUP(59),   GROUP(62),
+  /*  4 */   GROUP(65),   GROUP(68),   GROUP(71),   GROUP(74),
+  /* 0053: UD_TAB__OPC_SSE, /sse */
+  /*  0 */   GROUP(54),           0,           0,           0,
+  /* 0054: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(55),
+  /* 0055: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          37,           0,           0,
+  /* 0056: UD_TAB__OPC_SSE, /sse */
+  /*  0 */   GROUP(57),           0,           0,           0,
+  /* 0057: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(58),
+  /* 0058: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          38,           0,           0,
+  /* 0059: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(60),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__64[] = {
-  /*  0 */          40,           0,           0,
-};
-
-static const uint16_t ud_itab__63[] = {
-  /*  0 */           0,   GROUP(64),
-};
-
-static const uint16_t ud_itab__62[] = {
+  /* 0060: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(61),
+  /* 0061: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          39,           0,           0,
+  /* 0062: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(63),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__67[] = {
-  /*  0 */          41,           0,           0,
-};
-
-static const uint16_t ud_itab__66[] = {
-  /*  0 */           0,   GROUP(67),
-};
-
-static const uint16_t ud_itab__65[] = {
+  /* 0063: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(64),
+  /* 0064: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          40,           0,           0,
+  /* 0065: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(66),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__70[] = {
-  /*  0 */          42,           0,           0,
-};
-
-static const uint16_t ud_itab__69[] = {
-  /*  0 */           0,   GROUP(70),
-};
-
-static const uint16_t ud_itab__68[] = {
+  /* 0066: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(67),
+  /* 0067: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          41,           0,           0,
+  /* 0068: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(69),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__73[] = {
-  /*  0 */          43,           0,           0,
-};
-
-static const uint16_t ud_itab__72[] = {
-  /*  0 */           0,   GROUP(73),
-};
-
-static const uint16_t ud_itab__71[] = {
+  /* 0069: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(70),
+  /* 0070: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          42,           0,           0,
+  /* 0071: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(72),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__76[] = {
-  /*  0 */          44,           0,           0,
-};
-
-static const uint16_t ud_itab__75[] = {
-  /*  0 */           0,   GROUP(76),
-};
-
-static const uint16_t ud_itab__74[] = {
+  /* 0072: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(73),
+  /* 0073: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          43,           0,           0,
+  /* 0074: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(75),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__52[] = {
-  /*  0 */   GROUP(53),   GROUP(56),   GROUP(59),   GROUP(62),
-  /*  4 */   GROUP(65),   GROUP(68),   GROUP(71),   GROUP(74),
-};
-
-static const uint16_t ud_itab__78[] = {
-  /*  0 */           0,          45,
-};
-
-static const uint16_t ud_itab__77[] = {
+  /* 0075: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(76),
+  /* 0076: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          44,           0,           0,
+  /* 0077: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(78),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__80[] = {
-  /*  0 */           0,          46,
-};
-
-static const uint16_t ud_itab__79[] = {
+  /* 0078: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          45,
+  /* 0079: UD_TAB__OPC_SSE, /sse */
   /*  0 */   GROUP(80),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__83[] = {
-  /*  0 */           0,          47,
-};
-
-static const uint16_t ud_itab__82[] = {
-  /*  0 */   GROUP(83),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__86[] = {
-  /*  0 */          48,           0,           0,
-};
-
-static const uint16_t ud_itab__85[] = {
-  /*  0 */           0,   GROUP(86),
-};
-
-static const uint16_t ud_itab__84[] = {
-  /*  0 */   GROUP(85),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__81[] = {
+  /* 0080: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          46,
+  /* 0081: UD_TAB__OPC_RM, /rm */
   /*  0 */   GROUP(82),   GROUP(84),           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__28[] = {
-  /*  0 */   GROUP(29),   GROUP(42),   GROUP(47),   GROUP(52),
-  /*  4 */   GROUP(77),           0,   GROUP(79),   GROUP(81),
-};
-
-static const uint16_t ud_itab__12[] = {
-  /*  0 */   GROUP(13),   GROUP(28),
-};
-
-static const uint16_t ud_itab__87[] = {
+  /* 0082: UD_TAB__OPC_SSE, /sse */
+  /*  0 */   GROUP(83),           0,           0,           0,
+  /* 0083: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,          47,
+  /* 0084: UD_TAB__OPC_SSE, /sse */
+  /*  0 */   GROUP(85),           0,           0,           0,
+  /* 0085: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,   GROUP(86),
+  /* 0086: UD_TAB__OPC_VENDOR, amd */
+  /*  0 */          48,           0,           0,
+  /* 0087: UD_TAB__OPC_SSE, /sse */
   /*  0 */          49,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__88[] = {
+  /* 0088: UD_TAB__OPC_SSE, /sse */
   /*  0 */          50,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__89[] = {
+  /* 0089: UD_TAB__OPC_SSE, /sse */
   /*  0 */          51,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__90[] = {
+  /* 0090: UD_TAB__OPC_SSE, /sse */
   /*  0 */          52,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__91[] = {
+  /* 0091: UD_TAB__OPC_SSE, /sse */
   /*  0 */          53,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__92[] = {
+  /* 0092: UD_TAB__OPC_SSE, /sse */
   /*  0 */          54,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__93[] = {
+  /* 0093: UD_TAB__OPC_SSE, /sse */
   /*  0 */          55,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__94[] = {
+  /* 0094: UD_TAB__OPC_SSE, /sse */
   /*  0 */          56,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__96[] = {
+  /* 0095: UD_TAB__OPC_REG, /reg */
+  /*  0 */   GROUP(96),   GROUP(97),   GROUP(98),   GROUP(99),
+  /*  4 */  GROUP(100),  GROUP(101),  GROUP(102),  GROUP(103),
+  /* 0096: UD_TAB__OPC_SSE, /sse */
   /*  0 */          57,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__97[] = {
+  /* 0097: UD_TAB__OPC_SSE, /sse */
   /*  0 */          58,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__98[] = {
+  /* 0098: UD_TAB__OPC_SSE, /sse */
   /*  0 */          59,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__99[] = {
+  /* 0099: UD_TAB__OPC_SSE, /sse */
   /*  0 */          60,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__100[] = {
+  /* 0100: UD_TAB__OPC_SSE, /sse */
   /*  0 */          61,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__101[] = {
+  /* 0101: UD_TAB__OPC_SSE, /sse */
   /*  0 */          62,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__102[] = {
+  /* 0102: UD_TAB__OPC_SSE, /sse */
   /*  0 */          63,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__103[] = {
+  /* 0103: UD_TAB__OPC_SSE, /sse */
   /*  0 */          64,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__95[] = {
-  /*  0 */   GROUP(96),   GROUP(97),   GROUP(98),   GROUP(99),
-  /*  4 */  GROUP(100),  GROUP(101),  GROUP(102),  GROUP(103),
-};
-
-static const uint16_t ud_itab__104[] = {
+  /* 0104: UD_TAB__OPC_SSE, /sse */
   /*  0 */          65,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__105[] = {
+  /* 0105: UD_TAB__OPC_3DNOW, /3dnow */
   /*  0 */           0,           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
   /*  8 */           0,           0,           0,           0,
@@ -490,507 +419,334 @@ static const uint16_t ud_itab__105[] = {
   /* f4 */           0,           0,           0,           0,
   /* f8 */           0,           0,           0,           0,
   /* fc */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__106[] = {
+  /* 0106: UD_TAB__OPC_SSE, /sse */
   /*  0 */          90,          91,          92,          93,
-};
-
-static const uint16_t ud_itab__107[] = {
+  /* 0107: UD_TAB__OPC_SSE, /sse */
   /*  0 */          94,          95,          96,          97,
-};
-
-static const uint16_t ud_itab__110[] = {
+  /* 0108: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(109),  GROUP(114),
+  /* 0109: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(110),  GROUP(111),  GROUP(112),  GROUP(113),
+  /* 0110: UD_TAB__OPC_MOD, /mod */
   /*  0 */          98,           0,
-};
-
-static const uint16_t ud_itab__111[] = {
+  /* 0111: UD_TAB__OPC_MOD, /mod */
   /*  0 */          99,           0,
-};
-
-static const uint16_t ud_itab__112[] = {
+  /* 0112: UD_TAB__OPC_MOD, /mod */
   /*  0 */         100,           0,
-};
-
-static const uint16_t ud_itab__113[] = {
+  /* 0113: UD_TAB__OPC_MOD, /mod */
   /*  0 */         101,           0,
-};
-
-static const uint16_t ud_itab__109[] = {
-  /*  0 */  GROUP(110),  GROUP(111),  GROUP(112),  GROUP(113),
-};
-
-static const uint16_t ud_itab__115[] = {
+  /* 0114: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(115),  GROUP(116),  GROUP(117),           0,
+  /* 0115: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         102,
-};
-
-static const uint16_t ud_itab__116[] = {
+  /* 0116: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         103,
-};
-
-static const uint16_t ud_itab__117[] = {
+  /* 0117: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         104,
-};
-
-static const uint16_t ud_itab__114[] = {
-  /*  0 */  GROUP(115),  GROUP(116),  GROUP(117),           0,
-};
-
-static const uint16_t ud_itab__108[] = {
-  /*  0 */  GROUP(109),  GROUP(114),
-};
-
-static const uint16_t ud_itab__118[] = {
+  /* 0118: UD_TAB__OPC_SSE, /sse */
   /*  0 */         105,           0,           0,         106,
-};
-
-static const uint16_t ud_itab__119[] = {
+  /* 0119: UD_TAB__OPC_SSE, /sse */
   /*  0 */         107,           0,           0,         108,
-};
-
-static const uint16_t ud_itab__120[] = {
+  /* 0120: UD_TAB__OPC_SSE, /sse */
   /*  0 */         109,           0,           0,         110,
-};
-
-static const uint16_t ud_itab__123[] = {
+  /* 0121: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(122),  GROUP(126),
+  /* 0122: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(123),           0,  GROUP(124),  GROUP(125),
+  /* 0123: UD_TAB__OPC_MOD, /mod */
   /*  0 */         111,           0,
-};
-
-static const uint16_t ud_itab__124[] = {
+  /* 0124: UD_TAB__OPC_MOD, /mod */
   /*  0 */         112,           0,
-};
-
-static const uint16_t ud_itab__125[] = {
+  /* 0125: UD_TAB__OPC_MOD, /mod */
   /*  0 */         113,           0,
-};
-
-static const uint16_t ud_itab__122[] = {
-  /*  0 */  GROUP(123),           0,  GROUP(124),  GROUP(125),
-};
-
-static const uint16_t ud_itab__127[] = {
+  /* 0126: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(127),           0,  GROUP(128),           0,
+  /* 0127: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         114,
-};
-
-static const uint16_t ud_itab__128[] = {
+  /* 0128: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         115,
-};
-
-static const uint16_t ud_itab__126[] = {
-  /*  0 */  GROUP(127),           0,  GROUP(128),           0,
-};
-
-static const uint16_t ud_itab__121[] = {
-  /*  0 */  GROUP(122),  GROUP(126),
-};
-
-static const uint16_t ud_itab__129[] = {
+  /* 0129: UD_TAB__OPC_SSE, /sse */
   /*  0 */         116,           0,           0,         117,
-};
-
-static const uint16_t ud_itab__131[] = {
+  /* 0130: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(131),  GROUP(132),  GROUP(133),  GROUP(134),
+  /*  4 */           0,           0,           0,           0,
+  /* 0131: UD_TAB__OPC_SSE, /sse */
   /*  0 */         118,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__132[] = {
+  /* 0132: UD_TAB__OPC_SSE, /sse */
   /*  0 */         119,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__133[] = {
+  /* 0133: UD_TAB__OPC_SSE, /sse */
   /*  0 */         120,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__134[] = {
+  /* 0134: UD_TAB__OPC_SSE, /sse */
   /*  0 */         121,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__130[] = {
-  /*  0 */  GROUP(131),  GROUP(132),  GROUP(133),  GROUP(134),
-  /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__135[] = {
+  /* 0135: UD_TAB__OPC_SSE, /sse */
   /*  0 */         122,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__136[] = {
+  /* 0136: UD_TAB__OPC_SSE, /sse */
   /*  0 */         123,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__137[] = {
+  /* 0137: UD_TAB__OPC_SSE, /sse */
   /*  0 */         124,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__138[] = {
+  /* 0138: UD_TAB__OPC_SSE, /sse */
   /*  0 */         125,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__139[] = {
+  /* 0139: UD_TAB__OPC_SSE, /sse */
   /*  0 */         126,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__140[] = {
+  /* 0140: UD_TAB__OPC_SSE, /sse */
   /*  0 */         127,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__141[] = {
+  /* 0141: UD_TAB__OPC_SSE, /sse */
   /*  0 */         128,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__142[] = {
+  /* 0142: UD_TAB__OPC_SSE, /sse */
   /*  0 */         129,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__143[] = {
+  /* 0143: UD_TAB__OPC_SSE, /sse */
   /*  0 */         130,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__144[] = {
+  /* 0144: UD_TAB__OPC_SSE, /sse */
   /*  0 */         131,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__145[] = {
+  /* 0145: UD_TAB__OPC_SSE, /sse */
   /*  0 */         132,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__146[] = {
+  /* 0146: UD_TAB__OPC_SSE, /sse */
   /*  0 */         133,           0,           0,         134,
-};
-
-static const uint16_t ud_itab__147[] = {
+  /* 0147: UD_TAB__OPC_SSE, /sse */
   /*  0 */         135,           0,           0,         136,
-};
-
-static const uint16_t ud_itab__148[] = {
+  /* 0148: UD_TAB__OPC_SSE, /sse */
   /*  0 */         137,         138,         139,         140,
-};
-
-static const uint16_t ud_itab__149[] = {
+  /* 0149: UD_TAB__OPC_SSE, /sse */
   /*  0 */         141,           0,           0,         142,
-};
-
-static const uint16_t ud_itab__150[] = {
+  /* 0150: UD_TAB__OPC_SSE, /sse */
   /*  0 */         143,         144,         145,         146,
-};
-
-static const uint16_t ud_itab__151[] = {
+  /* 0151: UD_TAB__OPC_SSE, /sse */
   /*  0 */         147,         148,         149,         150,
-};
-
-static const uint16_t ud_itab__152[] = {
+  /* 0152: UD_TAB__OPC_SSE, /sse */
   /*  0 */         151,           0,           0,         152,
-};
-
-static const uint16_t ud_itab__153[] = {
+  /* 0153: UD_TAB__OPC_SSE, /sse */
   /*  0 */         153,           0,           0,         154,
-};
-
-static const uint16_t ud_itab__154[] = {
+  /* 0154: UD_TAB__OPC_SSE, /sse */
   /*  0 */         155,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__155[] = {
+  /* 0155: UD_TAB__OPC_SSE, /sse */
   /*  0 */         156,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__156[] = {
+  /* 0156: UD_TAB__OPC_SSE, /sse */
   /*  0 */         157,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__157[] = {
+  /* 0157: UD_TAB__OPC_SSE, /sse */
   /*  0 */         158,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__160[] = {
-  /*  0 */           0,         160,           0,
-};
-
-static const uint16_t ud_itab__159[] = {
-  /*  0 */         159,  GROUP(160),
-};
-
-static const uint16_t ud_itab__158[] = {
+  /* 0158: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(159),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__163[] = {
-  /*  0 */           0,         162,           0,
-};
-
-static const uint16_t ud_itab__162[] = {
-  /*  0 */         161,  GROUP(163),
-};
-
-static const uint16_t ud_itab__161[] = {
+  /* 0159: UD_TAB__OPC_MODE, /m */
+  /*  0 */         159,  GROUP(160),
+  /* 0160: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         160,           0,
+  /* 0161: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(162),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__164[] = {
+  /* 0162: UD_TAB__OPC_MODE, /m */
+  /*  0 */         161,  GROUP(163),
+  /* 0163: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         162,           0,
+  /* 0164: UD_TAB__OPC_SSE, /sse */
   /*  0 */         163,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__166[] = {
+  /* 0165: UD_TAB__OPC_TABLE, 38 */
+  /*  0 */  GROUP(166),  GROUP(167),  GROUP(168),  GROUP(169),
+  /*  4 */  GROUP(170),  GROUP(171),  GROUP(172),  GROUP(173),
+  /*  8 */  GROUP(174),  GROUP(175),  GROUP(176),  GROUP(177),
+  /*  c */           0,           0,           0,           0,
+  /* 10 */  GROUP(178),           0,           0,           0,
+  /* 14 */  GROUP(179),  GROUP(180),           0,  GROUP(181),
+  /* 18 */           0,           0,           0,           0,
+  /* 1c */  GROUP(182),  GROUP(183),  GROUP(184),           0,
+  /* 20 */  GROUP(185),  GROUP(186),  GROUP(187),  GROUP(188),
+  /* 24 */  GROUP(189),  GROUP(190),           0,           0,
+  /* 28 */  GROUP(191),  GROUP(192),  GROUP(193),  GROUP(194),
+  /* 2c */           0,           0,           0,           0,
+  /* 30 */  GROUP(195),  GROUP(196),  GROUP(197),  GROUP(198),
+  /* 34 */  GROUP(199),  GROUP(200),           0,  GROUP(201),
+  /* 38 */  GROUP(202),  GROUP(203),  GROUP(204),  GROUP(205),
+  /* 3c */  GROUP(206),  GROUP(207),  GROUP(208),  GROUP(209),
+  /* 40 */  GROUP(210),  GROUP(211),           0,           0,
+  /* 44 */           0,           0,           0,           0,
+  /* 48 */           0,           0,           0,           0,
+  /* 4c */           0,           0,           0,           0,
+  /* 50 */           0,           0,           0,           0,
+  /* 54 */           0,           0,           0,           0,
+  /* 58 */           0,           0,           0,           0,
+  /* 5c */           0,           0,           0,           0,
+  /* 60 */           0,           0,           0,           0,
+  /* 64 */           0,           0,           0,           0,
+  /* 68 */           0,           0,           0,           0,
+  /* 6c */           0,           0,           0,           0,
+  /* 70 */           0,           0,           0,           0,
+  /* 74 */           0,           0,           0,           0,
+  /* 78 */           0,           0,           0,           0,
+  /* 7c */           0,           0,           0,           0,
+  /* 80 */  GROUP(212),  GROUP(215),           0,           0,
+  /* 84 */           0,           0,           0,           0,
+  /* 88 */           0,           0,           0,           0,
+  /* 8c */           0,           0,           0,           0,
+  /* 90 */           0,           0,           0,           0,
+  /* 94 */           0,           0,           0,           0,
+  /* 98 */           0,           0,           0,           0,
+  /* 9c */           0,           0,           0,           0,
+  /* a0 */           0,           0,           0,           0,
+  /* a4 */           0,           0,           0,           0,
+  /* a8 */           0,           0,           0,           0,
+  /* ac */           0,           0,           0,           0,
+  /* b0 */           0,           0,           0,           0,
+  /* b4 */           0,           0,           0,           0,
+  /* b8 */           0,           0,           0,           0,
+  /* bc */           0,           0,           0,           0,
+  /* c0 */           0,           0,           0,           0,
+  /* c4 */           0,           0,           0,           0,
+  /* c8 */           0,           0,           0,           0,
+  /* cc */           0,           0,           0,           0,
+  /* d0 */           0,           0,           0,           0,
+  /* d4 */           0,           0,           0,           0,
+  /* d8 */           0,           0,           0,  GROUP(218),
+  /* dc */  GROUP(219),  GROUP(220),  GROUP(221),  GROUP(222),
+  /* e0 */           0,           0,           0,           0,
+  /* e4 */           0,           0,           0,           0,
+  /* e8 */           0,           0,           0,           0,
+  /* ec */           0,           0,           0,           0,
+  /* f0 */  GROUP(223),  GROUP(224),           0,           0,
+  /* f4 */           0,           0,           0,           0,
+  /* f8 */           0,           0,           0,           0,
+  /* fc */           0,           0,           0,           0,
+  /* 0166: UD_TAB__OPC_SSE, /sse */
   /*  0 */         164,           0,           0,         165,
-};
-
-static const uint16_t ud_itab__167[] = {
+  /* 0167: UD_TAB__OPC_SSE, /sse */
   /*  0 */         166,           0,           0,         167,
-};
-
-static const uint16_t ud_itab__168[] = {
+  /* 0168: UD_TAB__OPC_SSE, /sse */
   /*  0 */         168,           0,           0,         169,
-};
-
-static const uint16_t ud_itab__169[] = {
+  /* 0169: UD_TAB__OPC_SSE, /sse */
   /*  0 */         170,           0,           0,         171,
-};
-
-static const uint16_t ud_itab__170[] = {
+  /* 0170: UD_TAB__OPC_SSE, /sse */
   /*  0 */         172,           0,           0,         173,
-};
-
-static const uint16_t ud_itab__171[] = {
+  /* 0171: UD_TAB__OPC_SSE, /sse */
   /*  0 */         174,           0,           0,         175,
-};
-
-static const uint16_t ud_itab__172[] = {
+  /* 0172: UD_TAB__OPC_SSE, /sse */
   /*  0 */         176,           0,           0,         177,
-};
-
-static const uint16_t ud_itab__173[] = {
+  /* 0173: UD_TAB__OPC_SSE, /sse */
   /*  0 */         178,           0,           0,         179,
-};
-
-static const uint16_t ud_itab__174[] = {
+  /* 0174: UD_TAB__OPC_SSE, /sse */
   /*  0 */         180,           0,           0,         181,
-};
-
-static const uint16_t ud_itab__175[] = {
+  /* 0175: UD_TAB__OPC_SSE, /sse */
   /*  0 */         182,           0,           0,         183,
-};
-
-static const uint16_t ud_itab__176[] = {
+  /* 0176: UD_TAB__OPC_SSE, /sse */
   /*  0 */         184,           0,           0,         185,
-};
-
-static const uint16_t ud_itab__177[] = {
+  /* 0177: UD_TAB__OPC_SSE, /sse */
   /*  0 */         186,           0,           0,         187,
-};
-
-static const uint16_t ud_itab__178[] = {
+  /* 0178: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         188,
-};
-
-static const uint16_t ud_itab__179[] = {
+  /* 0179: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         189,
-};
-
-static const uint16_t ud_itab__180[] = {
+  /* 0180: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         190,
-};
-
-static const uint16_t ud_itab__181[] = {
+  /* 0181: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         191,
-};
-
-static const uint16_t ud_itab__182[] = {
+  /* 0182: UD_TAB__OPC_SSE, /sse */
   /*  0 */         192,           0,           0,         193,
-};
-
-static const uint16_t ud_itab__183[] = {
+  /* 0183: UD_TAB__OPC_SSE, /sse */
   /*  0 */         194,           0,           0,         195,
-};
-
-static const uint16_t ud_itab__184[] = {
+  /* 0184: UD_TAB__OPC_SSE, /sse */
   /*  0 */         196,           0,           0,         197,
-};
-
-static const uint16_t ud_itab__185[] = {
+  /* 0185: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         198,
-};
-
-static const uint16_t ud_itab__186[] = {
+  /* 0186: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         199,
-};
-
-static const uint16_t ud_itab__187[] = {
+  /* 0187: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         200,
-};
-
-static const uint16_t ud_itab__188[] = {
+  /* 0188: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         201,
-};
-
-static const uint16_t ud_itab__189[] = {
+  /* 0189: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         202,
-};
-
-static const uint16_t ud_itab__190[] = {
+  /* 0190: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         203,
-};
-
-static const uint16_t ud_itab__191[] = {
+  /* 0191: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         204,
-};
-
-static const uint16_t ud_itab__192[] = {
+  /* 0192: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         205,
-};
-
-static const uint16_t ud_itab__193[] = {
+  /* 0193: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         206,
-};
-
-static const uint16_t ud_itab__194[] = {
+  /* 0194: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         207,
-};
-
-static const uint16_t ud_itab__195[] = {
+  /* 0195: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         208,
-};
-
-static const uint16_t ud_itab__196[] = {
+  /* 0196: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         209,
-};
-
-static const uint16_t ud_itab__197[] = {
+  /* 0197: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         210,
-};
-
-static const uint16_t ud_itab__198[] = {
+  /* 0198: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         211,
-};
-
-static const uint16_t ud_itab__199[] = {
+  /* 0199: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         212,
-};
-
-static const uint16_t ud_itab__200[] = {
+  /* 0200: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         213,
-};
-
-static const uint16_t ud_itab__201[] = {
+  /* 0201: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         214,
-};
-
-static const uint16_t ud_itab__202[] = {
+  /* 0202: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         215,
-};
-
-static const uint16_t ud_itab__203[] = {
+  /* 0203: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         216,
-};
-
-static const uint16_t ud_itab__204[] = {
+  /* 0204: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         217,
-};
-
-static const uint16_t ud_itab__205[] = {
+  /* 0205: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         218,
-};
-
-static const uint16_t ud_itab__206[] = {
+  /* 0206: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         219,
-};
-
-static const uint16_t ud_itab__207[] = {
+  /* 0207: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         220,
-};
-
-static const uint16_t ud_itab__208[] = {
+  /* 0208: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         221,
-};
-
-static const uint16_t ud_itab__209[] = {
+  /* 0209: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         222,
-};
-
-static const uint16_t ud_itab__210[] = {
+  /* 0210: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         223,
-};
-
-static const uint16_t ud_itab__211[] = {
+  /* 0211: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         224,
-};
-
-static const uint16_t ud_itab__214[] = {
-  /*  0 */           0,         225,           0,
-};
-
-static const uint16_t ud_itab__213[] = {
-  /*  0 */           0,  GROUP(214),
-};
-
-static const uint16_t ud_itab__212[] = {
+  /* 0212: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,  GROUP(213),
-};
-
-static const uint16_t ud_itab__217[] = {
-  /*  0 */           0,         226,           0,
-};
-
-static const uint16_t ud_itab__216[] = {
-  /*  0 */           0,  GROUP(217),
-};
-
-static const uint16_t ud_itab__215[] = {
+  /* 0213: UD_TAB__OPC_MODE, /m */
+  /*  0 */           0,  GROUP(214),
+  /* 0214: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         225,           0,
+  /* 0215: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,  GROUP(216),
-};
-
-static const uint16_t ud_itab__218[] = {
+  /* 0216: UD_TAB__OPC_MODE, /m */
+  /*  0 */           0,  GROUP(217),
+  /* 0217: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         226,           0,
+  /* 0218: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         227,
-};
-
-static const uint16_t ud_itab__219[] = {
+  /* 0219: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         228,
-};
-
-static const uint16_t ud_itab__220[] = {
+  /* 0220: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         229,
-};
-
-static const uint16_t ud_itab__221[] = {
+  /* 0221: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         230,
-};
-
-static const uint16_t ud_itab__222[] = {
+  /* 0222: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         231,
-};
-
-static const uint16_t ud_itab__223[] = {
+  /* 0223: UD_TAB__OPC_SSE, /sse */
   /*  0 */         232,         233,           0,           0,
-};
-
-static const uint16_t ud_itab__224[] = {
+  /* 0224: UD_TAB__OPC_SSE, /sse */
   /*  0 */         234,         235,           0,           0,
-};
-
-static const uint16_t ud_itab__165[] = {
-  /*  0 */  GROUP(166),  GROUP(167),  GROUP(168),  GROUP(169),
-  /*  4 */  GROUP(170),  GROUP(171),  GROUP(172),  GROUP(173),
-  /*  8 */  GROUP(174),  GROUP(175),  GROUP(176),  GROUP(177),
-  /*  c */           0,           0,           0,           0,
-  /* 10 */  GROUP(178),           0,           0,           0,
-  /* 14 */  GROUP(179),  GROUP(180),           0,  GROUP(181),
+  /* 0225: UD_TAB__OPC_TABLE, 3a */
+  /*  0 */           0,           0,           0,           0,
+  /*  4 */           0,           0,           0,           0,
+  /*  8 */  GROUP(226),  GROUP(227),  GROUP(228),  GROUP(229),
+  /*  c */  GROUP(230),  GROUP(231),  GROUP(232),  GROUP(233),
+  /* 10 */           0,           0,           0,           0,
+  /* 14 */  GROUP(234),  GROUP(235),  GROUP(236),  GROUP(238),
   /* 18 */           0,           0,           0,           0,
-  /* 1c */  GROUP(182),  GROUP(183),  GROUP(184),           0,
-  /* 20 */  GROUP(185),  GROUP(186),  GROUP(187),  GROUP(188),
-  /* 24 */  GROUP(189),  GROUP(190),           0,           0,
-  /* 28 */  GROUP(191),  GROUP(192),  GROUP(193),  GROUP(194),
+  /* 1c */           0,           0,           0,           0,
+  /* 20 */  GROUP(239),  GROUP(240),  GROUP(241),           0,
+  /* 24 */           0,           0,           0,           0,
+  /* 28 */           0,           0,           0,           0,
   /* 2c */           0,           0,           0,           0,
-  /* 30 */  GROUP(195),  GROUP(196),  GROUP(197),  GROUP(198),
-  /* 34 */  GROUP(199),  GROUP(200),           0,  GROUP(201),
-  /* 38 */  GROUP(202),  GROUP(203),  GROUP(204),  GROUP(205),
-  /* 3c */  GROUP(206),  GROUP(207),  GROUP(208),  GROUP(209),
-  /* 40 */  GROUP(210),  GROUP(211),           0,           0,
-  /* 44 */           0,           0,           0,           0,
+  /* 30 */           0,           0,           0,           0,
+  /* 34 */           0,           0,           0,           0,
+  /* 38 */           0,           0,           0,           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 40 */  GROUP(243),  GROUP(244),  GROUP(245),           0,
+  /* 44 */  GROUP(246),           0,           0,           0,
   /* 48 */           0,           0,           0,           0,
   /* 4c */           0,           0,           0,           0,
   /* 50 */           0,           0,           0,           0,
   /* 54 */           0,           0,           0,           0,
   /* 58 */           0,           0,           0,           0,
   /* 5c */           0,           0,           0,           0,
-  /* 60 */           0,           0,           0,           0,
+  /* 60 */  GROUP(247),  GROUP(248),  GROUP(249),  GROUP(250),
   /* 64 */           0,           0,           0,           0,
   /* 68 */           0,           0,           0,           0,
   /* 6c */           0,           0,           0,           0,
@@ -998,7 +754,7 @@ static const uint16_t ud_itab__165[] = {
   /* 74 */           0,           0,           0,           0,
   /* 78 */           0,           0,           0,           0,
   /* 7c */           0,           0,           0,           0,
-  /* 80 */  GROUP(212),  GROUP(215),           0,           0,
+  /* 80 */           0,           0,           0,           0,
   /* 84 */           0,           0,           0,           0,
   /* 88 */           0,           0,           0,           0,
   /* 8c */           0,           0,           0,           0,
@@ -1020,5148 +776,3133 @@ static const uint16_t ud_itab__165[] = {
   /* cc */           0,           0,           0,           0,
   /* d0 */           0,           0,           0,           0,
   /* d4 */           0,           0,           0,           0,
-  /* d8 */           0,           0,           0,  GROUP(218),
-  /* dc */  GROUP(219),  GROUP(220),  GROUP(221),  GROUP(222),
+  /* d8 */           0,           0,           0,           0,
+  /* dc */           0,           0,           0,  GROUP(251),
   /* e0 */           0,           0,           0,           0,
   /* e4 */           0,           0,           0,           0,
   /* e8 */           0,           0,           0,           0,
   /* ec */           0,           0,           0,           0,
-  /* f0 */  GROUP(223),  GROUP(224),           0,           0,
+  /* f0 */           0,           0,           0,           0,
   /* f4 */           0,           0,           0,           0,
   /* f8 */           0,           0,           0,           0,
   /* fc */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__226[] = {
+  /* 0226: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         236,
-};
-
-static const uint16_t ud_itab__227[] = {
+  /* 0227: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         237,
-};
-
-static const uint16_t ud_itab__228[] = {
+  /* 0228: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         238,
-};
-
-static const uint16_t ud_itab__229[] = {
+  /* 0229: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         239,
-};
-
-static const uint16_t ud_itab__230[] = {
+  /* 0230: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         240,
-};
-
-static const uint16_t ud_itab__231[] = {
+  /* 0231: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         241,
-};
-
-static const uint16_t ud_itab__232[] = {
+  /* 0232: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         242,
-};
-
-static const uint16_t ud_itab__233[] = {
+  /* 0233: UD_TAB__OPC_SSE, /sse */
   /*  0 */         243,           0,           0,         244,
-};
-
-static const uint16_t ud_itab__234[] = {
+  /* 0234: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         245,
-};
-
-static const uint16_t ud_itab__235[] = {
+  /* 0235: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         246,
-};
-
-static const uint16_t ud_itab__237[] = {
-  /*  0 */         247,         248,         249,
-};
-
-static const uint16_t ud_itab__236[] = {
+  /* 0236: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,  GROUP(237),
-};
-
-static const uint16_t ud_itab__238[] = {
+  /* 0237: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */         247,         248,         249,
+  /* 0238: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         250,
-};
-
-static const uint16_t ud_itab__239[] = {
+  /* 0239: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         251,
-};
-
-static const uint16_t ud_itab__240[] = {
+  /* 0240: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         252,
-};
-
-static const uint16_t ud_itab__242[] = {
-  /*  0 */         253,         254,         255,
-};
-
-static const uint16_t ud_itab__241[] = {
+  /* 0241: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,  GROUP(242),
-};
-
-static const uint16_t ud_itab__243[] = {
+  /* 0242: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */         253,         254,         255,
+  /* 0243: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         256,
-};
-
-static const uint16_t ud_itab__244[] = {
+  /* 0244: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         257,
-};
-
-static const uint16_t ud_itab__245[] = {
+  /* 0245: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         258,
-};
-
-static const uint16_t ud_itab__246[] = {
+  /* 0246: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         259,
-};
-
-static const uint16_t ud_itab__247[] = {
+  /* 0247: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         260,
-};
-
-static const uint16_t ud_itab__248[] = {
+  /* 0248: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         261,
-};
-
-static const uint16_t ud_itab__249[] = {
+  /* 0249: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         262,
-};
-
-static const uint16_t ud_itab__250[] = {
+  /* 0250: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         263,
-};
-
-static const uint16_t ud_itab__251[] = {
+  /* 0251: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         264,
-};
-
-static const uint16_t ud_itab__225[] = {
-  /*  0 */           0,           0,           0,           0,
-  /*  4 */           0,           0,           0,           0,
-  /*  8 */  GROUP(226),  GROUP(227),  GROUP(228),  GROUP(229),
-  /*  c */  GROUP(230),  GROUP(231),  GROUP(232),  GROUP(233),
-  /* 10 */           0,           0,           0,           0,
-  /* 14 */  GROUP(234),  GROUP(235),  GROUP(236),  GROUP(238),
-  /* 18 */           0,           0,           0,           0,
-  /* 1c */           0,           0,           0,           0,
-  /* 20 */  GROUP(239),  GROUP(240),  GROUP(241),           0,
-  /* 24 */           0,           0,           0,           0,
-  /* 28 */           0,           0,           0,           0,
-  /* 2c */           0,           0,           0,           0,
-  /* 30 */           0,           0,           0,           0,
-  /* 34 */           0,           0,           0,           0,
-  /* 38 */           0,           0,           0,           0,
-  /* 3c */           0,           0,           0,           0,
-  /* 40 */  GROUP(243),  GROUP(244),  GROUP(245),           0,
-  /* 44 */  GROUP(246),           0,           0,           0,
-  /* 48 */           0,           0,           0,           0,
-  /* 4c */           0,           0,           0,           0,
-  /* 50 */           0,           0,           0,           0,
-  /* 54 */           0,           0,           0,           0,
-  /* 58 */           0,           0,           0,           0,
-  /* 5c */           0,           0,           0,           0,
-  /* 60 */  GROUP(247),  GROUP(248),  GROUP(249),  GROUP(250),
-  /* 64 */           0,           0,           0,           0,
-  /* 68 */           0,           0,           0,           0,
-  /* 6c */           0,           0,           0,           0,
-  /* 70 */           0,           0,           0,           0,
-  /* 74 */           0,           0,           0,           0,
-  /* 78 */           0,           0,           0,           0,
-  /* 7c */           0,           0,           0,           0,
-  /* 80 */           0,           0,           0,           0,
-  /* 84 */           0,           0,           0,           0,
-  /* 88 */           0,           0,           0,           0,
-  /* 8c */           0,           0,           0,           0,
-  /* 90 */           0,           0,           0,           0,
-  /* 94 */           0,           0,           0,           0,
-  /* 98 */           0,           0,           0,           0,
-  /* 9c */           0,           0,           0,           0,
-  /* a0 */           0,           0,           0,           0,
-  /* a4 */           0,           0,           0,           0,
-  /* a8 */           0,           0,           0,           0,
-  /* ac */           0,           0,           0,           0,
-  /* b0 */           0,           0,           0,           0,
-  /* b4 */           0,           0,           0,           0,
-  /* b8 */           0,           0,           0,           0,
-  /* bc */           0,           0,           0,           0,
-  /* c0 */           0,           0,           0,           0,
-  /* c4 */           0,           0,           0,           0,
-  /* c8 */           0,           0,           0,           0,
-  /* cc */           0,           0,           0,           0,
-  /* d0 */           0,           0,           0,           0,
-  /* d4 */           0,           0,           0,           0,
-  /* d8 */           0,           0,           0,           0,
-  /* dc */           0,           0,           0,  GROUP(251),
-  /* e0 */           0,           0,           0,           0,
-  /* e4 */           0,           0,           0,           0,
-  /* e8 */           0,           0,           0,           0,
-  /* ec */           0,           0,           0,           0,
-  /* f0 */           0,           0,           0,           0,
-  /* f4 */           0,           0,           0,           0,
-  /* f8 */           0,           0,           0,           0,
-  /* fc */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__252[] = {
+  /* 0252: UD_TAB__OPC_SSE, /sse */
   /*  0 */         265,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__253[] = {
+  /* 0253: UD_TAB__OPC_SSE, /sse */
   /*  0 */         266,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__254[] = {
+  /* 0254: UD_TAB__OPC_SSE, /sse */
   /*  0 */         267,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__255[] = {
+  /* 0255: UD_TAB__OPC_SSE, /sse */
   /*  0 */         268,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__256[] = {
+  /* 0256: UD_TAB__OPC_SSE, /sse */
   /*  0 */         269,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__257[] = {
+  /* 0257: UD_TAB__OPC_SSE, /sse */
   /*  0 */         270,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__258[] = {
+  /* 0258: UD_TAB__OPC_SSE, /sse */
   /*  0 */         271,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__259[] = {
+  /* 0259: UD_TAB__OPC_SSE, /sse */
   /*  0 */         272,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__260[] = {
+  /* 0260: UD_TAB__OPC_SSE, /sse */
   /*  0 */         273,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__261[] = {
+  /* 0261: UD_TAB__OPC_SSE, /sse */
   /*  0 */         274,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__262[] = {
+  /* 0262: UD_TAB__OPC_SSE, /sse */
   /*  0 */         275,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__263[] = {
+  /* 0263: UD_TAB__OPC_SSE, /sse */
   /*  0 */         276,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__264[] = {
+  /* 0264: UD_TAB__OPC_SSE, /sse */
   /*  0 */         277,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__265[] = {
+  /* 0265: UD_TAB__OPC_SSE, /sse */
   /*  0 */         278,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__266[] = {
+  /* 0266: UD_TAB__OPC_SSE, /sse */
   /*  0 */         279,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__267[] = {
+  /* 0267: UD_TAB__OPC_SSE, /sse */
   /*  0 */         280,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__268[] = {
+  /* 0268: UD_TAB__OPC_SSE, /sse */
   /*  0 */         281,           0,           0,         282,
-};
-
-static const uint16_t ud_itab__269[] = {
+  /* 0269: UD_TAB__OPC_SSE, /sse */
   /*  0 */         283,         284,         285,         286,
-};
-
-static const uint16_t ud_itab__270[] = {
+  /* 0270: UD_TAB__OPC_SSE, /sse */
   /*  0 */         287,           0,         288,           0,
-};
-
-static const uint16_t ud_itab__271[] = {
+  /* 0271: UD_TAB__OPC_SSE, /sse */
   /*  0 */         289,           0,         290,           0,
-};
-
-static const uint16_t ud_itab__272[] = {
+  /* 0272: UD_TAB__OPC_SSE, /sse */
   /*  0 */         291,           0,           0,         292,
-};
-
-static const uint16_t ud_itab__273[] = {
+  /* 0273: UD_TAB__OPC_SSE, /sse */
   /*  0 */         293,           0,           0,         294,
-};
-
-static const uint16_t ud_itab__274[] = {
+  /* 0274: UD_TAB__OPC_SSE, /sse */
   /*  0 */         295,           0,           0,         296,
-};
-
-static const uint16_t ud_itab__275[] = {
+  /* 0275: UD_TAB__OPC_SSE, /sse */
   /*  0 */         297,           0,           0,         298,
-};
-
-static const uint16_t ud_itab__276[] = {
+  /* 0276: UD_TAB__OPC_SSE, /sse */
   /*  0 */         299,         300,         301,         302,
-};
-
-static const uint16_t ud_itab__277[] = {
+  /* 0277: UD_TAB__OPC_SSE, /sse */
   /*  0 */         303,         304,         305,         306,
-};
-
-static const uint16_t ud_itab__278[] = {
+  /* 0278: UD_TAB__OPC_SSE, /sse */
   /*  0 */         307,         308,         309,         310,
-};
-
-static const uint16_t ud_itab__279[] = {
+  /* 0279: UD_TAB__OPC_SSE, /sse */
   /*  0 */         311,           0,         312,         313,
-};
-
-static const uint16_t ud_itab__280[] = {
+  /* 0280: UD_TAB__OPC_SSE, /sse */
   /*  0 */         314,         315,         316,         317,
-};
-
-static const uint16_t ud_itab__281[] = {
+  /* 0281: UD_TAB__OPC_SSE, /sse */
   /*  0 */         318,         319,         320,         321,
-};
-
-static const uint16_t ud_itab__282[] = {
+  /* 0282: UD_TAB__OPC_SSE, /sse */
   /*  0 */         322,         323,         324,         325,
-};
-
-static const uint16_t ud_itab__283[] = {
+  /* 0283: UD_TAB__OPC_SSE, /sse */
   /*  0 */         326,         327,         328,         329,
-};
-
-static const uint16_t ud_itab__284[] = {
+  /* 0284: UD_TAB__OPC_SSE, /sse */
   /*  0 */         330,           0,           0,         331,
-};
-
-static const uint16_t ud_itab__285[] = {
+  /* 0285: UD_TAB__OPC_SSE, /sse */
   /*  0 */         332,           0,           0,         333,
-};
-
-static const uint16_t ud_itab__286[] = {
+  /* 0286: UD_TAB__OPC_SSE, /sse */
   /*  0 */         334,           0,           0,         335,
-};
-
-static const uint16_t ud_itab__287[] = {
+  /* 0287: UD_TAB__OPC_SSE, /sse */
   /*  0 */         336,           0,           0,         337,
-};
-
-static const uint16_t ud_itab__288[] = {
+  /* 0288: UD_TAB__OPC_SSE, /sse */
   /*  0 */         338,           0,           0,         339,
-};
-
-static const uint16_t ud_itab__289[] = {
+  /* 0289: UD_TAB__OPC_SSE, /sse */
   /*  0 */         340,           0,           0,         341,
-};
-
-static const uint16_t ud_itab__290[] = {
+  /* 0290: UD_TAB__OPC_SSE, /sse */
   /*  0 */         342,           0,           0,         343,
-};
-
-static const uint16_t ud_itab__291[] = {
+  /* 0291: UD_TAB__OPC_SSE, /sse */
   /*  0 */         344,           0,           0,         345,
-};
-
-static const uint16_t ud_itab__292[] = {
+  /* 0292: UD_TAB__OPC_SSE, /sse */
   /*  0 */         346,           0,           0,         347,
-};
-
-static const uint16_t ud_itab__293[] = {
+  /* 0293: UD_TAB__OPC_SSE, /sse */
   /*  0 */         348,           0,           0,         349,
-};
-
-static const uint16_t ud_itab__294[] = {
+  /* 0294: UD_TAB__OPC_SSE, /sse */
   /*  0 */         350,           0,           0,         351,
-};
-
-static const uint16_t ud_itab__295[] = {
+  /* 0295: UD_TAB__OPC_SSE, /sse */
   /*  0 */         352,           0,           0,         353,
-};
-
-static const uint16_t ud_itab__296[] = {
+  /* 0296: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         354,
-};
-
-static const uint16_t ud_itab__297[] = {
+  /* 0297: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         355,
-};
-
-static const uint16_t ud_itab__298[] = {
+  /* 0298: UD_TAB__OPC_SSE, /sse */
   /*  0 */         356,           0,           0,         357,
-};
-
-static const uint16_t ud_itab__299[] = {
+  /* 0299: UD_TAB__OPC_SSE, /sse */
   /*  0 */         358,           0,         359,         360,
-};
-
-static const uint16_t ud_itab__300[] = {
+  /* 0300: UD_TAB__OPC_SSE, /sse */
   /*  0 */         361,         362,         363,         364,
-};
-
-static const uint16_t ud_itab__302[] = {
+  /* 0301: UD_TAB__OPC_REG, /reg */
+  /*  0 */           0,           0,  GROUP(302),           0,
+  /*  4 */  GROUP(303),           0,  GROUP(304),           0,
+  /* 0302: UD_TAB__OPC_SSE, /sse */
   /*  0 */         365,           0,           0,         366,
-};
-
-static const uint16_t ud_itab__303[] = {
+  /* 0303: UD_TAB__OPC_SSE, /sse */
   /*  0 */         367,           0,           0,         368,
-};
-
-static const uint16_t ud_itab__304[] = {
+  /* 0304: UD_TAB__OPC_SSE, /sse */
   /*  0 */         369,           0,           0,         370,
-};
-
-static const uint16_t ud_itab__301[] = {
-  /*  0 */           0,           0,  GROUP(302),           0,
-  /*  4 */  GROUP(303),           0,  GROUP(304),           0,
-};
-
-static const uint16_t ud_itab__306[] = {
-  /*  0 */         371,           0,           0,         372,
-};
-
-static const uint16_t ud_itab__307[] = {
-  /*  0 */         373,           0,           0,         374,
-};
-
-static const uint16_t ud_itab__308[] = {
-  /*  0 */         375,           0,           0,         376,
-};
-
-static const uint16_t ud_itab__305[] = {
+  /* 0305: UD_TAB__OPC_REG, /reg */
   /*  0 */           0,           0,  GROUP(306),           0,
-  /*  4 */  GROUP(307),           0,  GROUP(308),           0,
-};
-
-static const uint16_t ud_itab__310[] = {
+  /*  4 */  GROUP(307),           0,  GROUP(308),           0,
+  /* 0306: UD_TAB__OPC_SSE, /sse */
+  /*  0 */         371,           0,           0,         372,
+  /* 0307: UD_TAB__OPC_SSE, /sse */
+  /*  0 */         373,           0,           0,         374,
+  /* 0308: UD_TAB__OPC_SSE, /sse */
+  /*  0 */         375,           0,           0,         376,
+  /* 0309: UD_TAB__OPC_REG, /reg */
+  /*  0 */           0,           0,  GROUP(310),  GROUP(311),
+  /*  4 */           0,           0,  GROUP(312),  GROUP(313),
+  /* 0310: UD_TAB__OPC_SSE, /sse */
   /*  0 */         377,           0,           0,         378,
-};
-
-static const uint16_t ud_itab__311[] = {
+  /* 0311: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         379,
-};
-
-static const uint16_t ud_itab__312[] = {
+  /* 0312: UD_TAB__OPC_SSE, /sse */
   /*  0 */         380,           0,           0,         381,
-};
-
-static const uint16_t ud_itab__313[] = {
+  /* 0313: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,           0,         382,
-};
-
-static const uint16_t ud_itab__309[] = {
-  /*  0 */           0,           0,  GROUP(310),  GROUP(311),
-  /*  4 */           0,           0,  GROUP(312),  GROUP(313),
-};
-
-static const uint16_t ud_itab__314[] = {
+  /* 0314: UD_TAB__OPC_SSE, /sse */
   /*  0 */         383,           0,           0,         384,
-};
-
-static const uint16_t ud_itab__315[] = {
+  /* 0315: UD_TAB__OPC_SSE, /sse */
   /*  0 */         385,           0,           0,         386,
-};
-
-static const uint16_t ud_itab__316[] = {
+  /* 0316: UD_TAB__OPC_SSE, /sse */
   /*  0 */         387,           0,           0,         388,
-};
-
-static const uint16_t ud_itab__317[] = {
+  /* 0317: UD_TAB__OPC_SSE, /sse */
   /*  0 */         389,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__319[] = {
-  /*  0 */           0,         390,           0,
-};
-
-static const uint16_t ud_itab__318[] = {
+  /* 0318: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(319),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__321[] = {
-  /*  0 */           0,         391,           0,
-};
-
-static const uint16_t ud_itab__320[] = {
+  /* 0319: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         390,           0,
+  /* 0320: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(321),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__322[] = {
+  /* 0321: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         391,           0,
+  /* 0322: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         392,           0,         393,
-};
-
-static const uint16_t ud_itab__323[] = {
+  /* 0323: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         394,           0,         395,
-};
-
-static const uint16_t ud_itab__324[] = {
+  /* 0324: UD_TAB__OPC_SSE, /sse */
   /*  0 */         396,           0,         397,         398,
-};
-
-static const uint16_t ud_itab__325[] = {
+  /* 0325: UD_TAB__OPC_SSE, /sse */
   /*  0 */         399,           0,         400,         401,
-};
-
-static const uint16_t ud_itab__326[] = {
+  /* 0326: UD_TAB__OPC_SSE, /sse */
   /*  0 */         402,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__327[] = {
+  /* 0327: UD_TAB__OPC_SSE, /sse */
   /*  0 */         403,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__328[] = {
+  /* 0328: UD_TAB__OPC_SSE, /sse */
   /*  0 */         404,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__329[] = {
+  /* 0329: UD_TAB__OPC_SSE, /sse */
   /*  0 */         405,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__330[] = {
+  /* 0330: UD_TAB__OPC_SSE, /sse */
   /*  0 */         406,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__331[] = {
+  /* 0331: UD_TAB__OPC_SSE, /sse */
   /*  0 */         407,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__332[] = {
+  /* 0332: UD_TAB__OPC_SSE, /sse */
   /*  0 */         408,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__333[] = {
+  /* 0333: UD_TAB__OPC_SSE, /sse */
   /*  0 */         409,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__334[] = {
+  /* 0334: UD_TAB__OPC_SSE, /sse */
   /*  0 */         410,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__335[] = {
+  /* 0335: UD_TAB__OPC_SSE, /sse */
   /*  0 */         411,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__336[] = {
+  /* 0336: UD_TAB__OPC_SSE, /sse */
   /*  0 */         412,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__337[] = {
+  /* 0337: UD_TAB__OPC_SSE, /sse */
   /*  0 */         413,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__338[] = {
+  /* 0338: UD_TAB__OPC_SSE, /sse */
   /*  0 */         414,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__339[] = {
+  /* 0339: UD_TAB__OPC_SSE, /sse */
   /*  0 */         415,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__340[] = {
+  /* 0340: UD_TAB__OPC_SSE, /sse */
   /*  0 */         416,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__341[] = {
+  /* 0341: UD_TAB__OPC_SSE, /sse */
   /*  0 */         417,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__342[] = {
+  /* 0342: UD_TAB__OPC_SSE, /sse */
   /*  0 */         418,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__343[] = {
+  /* 0343: UD_TAB__OPC_SSE, /sse */
   /*  0 */         419,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__344[] = {
+  /* 0344: UD_TAB__OPC_SSE, /sse */
   /*  0 */         420,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__345[] = {
+  /* 0345: UD_TAB__OPC_SSE, /sse */
   /*  0 */         421,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__346[] = {
+  /* 0346: UD_TAB__OPC_SSE, /sse */
   /*  0 */         422,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__347[] = {
+  /* 0347: UD_TAB__OPC_SSE, /sse */
   /*  0 */         423,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__348[] = {
+  /* 0348: UD_TAB__OPC_SSE, /sse */
   /*  0 */         424,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__349[] = {
+  /* 0349: UD_TAB__OPC_SSE, /sse */
   /*  0 */         425,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__350[] = {
+  /* 0350: UD_TAB__OPC_SSE, /sse */
   /*  0 */         426,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__351[] = {
+  /* 0351: UD_TAB__OPC_SSE, /sse */
   /*  0 */         427,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__352[] = {
+  /* 0352: UD_TAB__OPC_SSE, /sse */
   /*  0 */         428,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__353[] = {
+  /* 0353: UD_TAB__OPC_SSE, /sse */
   /*  0 */         429,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__354[] = {
+  /* 0354: UD_TAB__OPC_SSE, /sse */
   /*  0 */         430,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__355[] = {
+  /* 0355: UD_TAB__OPC_SSE, /sse */
   /*  0 */         431,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__356[] = {
+  /* 0356: UD_TAB__OPC_SSE, /sse */
   /*  0 */         432,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__357[] = {
+  /* 0357: UD_TAB__OPC_SSE, /sse */
   /*  0 */         433,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__358[] = {
+  /* 0358: UD_TAB__OPC_SSE, /sse */
   /*  0 */         434,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__359[] = {
+  /* 0359: UD_TAB__OPC_SSE, /sse */
   /*  0 */         435,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__360[] = {
+  /* 0360: UD_TAB__OPC_SSE, /sse */
   /*  0 */         436,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__361[] = {
+  /* 0361: UD_TAB__OPC_SSE, /sse */
   /*  0 */         437,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__362[] = {
+  /* 0362: UD_TAB__OPC_SSE, /sse */
   /*  0 */         438,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__363[] = {
+  /* 0363: UD_TAB__OPC_SSE, /sse */
   /*  0 */         439,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__368[] = {
-  /*  0 */           0,         440,
-};
-
-static const uint16_t ud_itab__367[] = {
-  /*  0 */  GROUP(368),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__366[] = {
+  /* 0364: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,  GROUP(365),
+  /* 0365: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(366),  GROUP(369),  GROUP(372),           0,
+  /*  4 */           0,           0,           0,           0,
+  /* 0366: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(367),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__371[] = {
-  /*  0 */           0,         441,
-};
-
-static const uint16_t ud_itab__370[] = {
-  /*  0 */  GROUP(371),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__369[] = {
+  /* 0367: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(368),           0,           0,           0,
+  /* 0368: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         440,
+  /* 0369: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(370),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__374[] = {
-  /*  0 */           0,         442,
-};
-
-static const uint16_t ud_itab__373[] = {
-  /*  0 */  GROUP(374),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__372[] = {
+  /* 0370: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(371),           0,           0,           0,
+  /* 0371: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         441,
+  /* 0372: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(373),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__365[] = {
-  /*  0 */  GROUP(366),  GROUP(369),  GROUP(372),           0,
-  /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__364[] = {
-  /*  0 */           0,  GROUP(365),
-};
-
-static const uint16_t ud_itab__379[] = {
-  /*  0 */           0,         443,
-};
-
-static const uint16_t ud_itab__378[] = {
-  /*  0 */  GROUP(379),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__377[] = {
+  /* 0373: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(374),           0,           0,           0,
+  /* 0374: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         442,
+  /* 0375: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,  GROUP(376),
+  /* 0376: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(377),  GROUP(380),  GROUP(383),  GROUP(386),
+  /*  4 */  GROUP(389),  GROUP(392),           0,           0,
+  /* 0377: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(378),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__382[] = {
-  /*  0 */           0,         444,
-};
-
-static const uint16_t ud_itab__381[] = {
-  /*  0 */  GROUP(382),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__380[] = {
+  /* 0378: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(379),           0,           0,           0,
+  /* 0379: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         443,
+  /* 0380: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(381),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__385[] = {
-  /*  0 */           0,         445,
-};
-
-static const uint16_t ud_itab__384[] = {
-  /*  0 */  GROUP(385),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__383[] = {
+  /* 0381: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(382),           0,           0,           0,
+  /* 0382: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         444,
+  /* 0383: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(384),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__388[] = {
-  /*  0 */           0,         446,
-};
-
-static const uint16_t ud_itab__387[] = {
-  /*  0 */  GROUP(388),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__386[] = {
+  /* 0384: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(385),           0,           0,           0,
+  /* 0385: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         445,
+  /* 0386: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(387),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__391[] = {
-  /*  0 */           0,         447,
-};
-
-static const uint16_t ud_itab__390[] = {
-  /*  0 */  GROUP(391),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__389[] = {
+  /* 0387: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(388),           0,           0,           0,
+  /* 0388: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         446,
+  /* 0389: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(390),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__394[] = {
-  /*  0 */           0,         448,
-};
-
-static const uint16_t ud_itab__393[] = {
-  /*  0 */  GROUP(394),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__392[] = {
+  /* 0390: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(391),           0,           0,           0,
+  /* 0391: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         447,
+  /* 0392: UD_TAB__OPC_RM, /rm */
   /*  0 */  GROUP(393),           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__376[] = {
-  /*  0 */  GROUP(377),  GROUP(380),  GROUP(383),  GROUP(386),
-  /*  4 */  GROUP(389),  GROUP(392),           0,           0,
-};
-
-static const uint16_t ud_itab__375[] = {
-  /*  0 */           0,  GROUP(376),
-};
-
-static const uint16_t ud_itab__395[] = {
+  /* 0393: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(394),           0,           0,           0,
+  /* 0394: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         448,
+  /* 0395: UD_TAB__OPC_SSE, /sse */
   /*  0 */         449,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__396[] = {
+  /* 0396: UD_TAB__OPC_SSE, /sse */
   /*  0 */         450,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__397[] = {
+  /* 0397: UD_TAB__OPC_SSE, /sse */
   /*  0 */         451,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__398[] = {
+  /* 0398: UD_TAB__OPC_SSE, /sse */
   /*  0 */         452,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__399[] = {
+  /* 0399: UD_TAB__OPC_SSE, /sse */
   /*  0 */         453,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__400[] = {
+  /* 0400: UD_TAB__OPC_SSE, /sse */
   /*  0 */         454,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__404[] = {
-  /*  0 */         455,           0,
-};
-
-static const uint16_t ud_itab__403[] = {
-  /*  0 */  GROUP(404),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__406[] = {
-  /*  0 */         456,           0,
-};
-
-static const uint16_t ud_itab__405[] = {
+  /* 0401: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(402),  GROUP(417),
+  /* 0402: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(403),  GROUP(405),  GROUP(407),  GROUP(409),
+  /*  4 */  GROUP(411),  GROUP(413),           0,  GROUP(415),
+  /* 0403: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(404),           0,           0,           0,
+  /* 0404: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         455,           0,
+  /* 0405: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(406),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__408[] = {
-  /*  0 */         457,           0,
-};
-
-static const uint16_t ud_itab__407[] = {
+  /* 0406: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         456,           0,
+  /* 0407: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(408),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__410[] = {
-  /*  0 */         458,           0,
-};
-
-static const uint16_t ud_itab__409[] = {
+  /* 0408: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         457,           0,
+  /* 0409: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(410),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__412[] = {
-  /*  0 */         459,           0,
-};
-
-static const uint16_t ud_itab__411[] = {
+  /* 0410: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         458,           0,
+  /* 0411: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(412),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__414[] = {
-  /*  0 */         460,           0,
-};
-
-static const uint16_t ud_itab__413[] = {
+  /* 0412: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         459,           0,
+  /* 0413: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(414),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__416[] = {
-  /*  0 */         461,           0,
-};
-
-static const uint16_t ud_itab__415[] = {
+  /* 0414: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         460,           0,
+  /* 0415: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(416),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__402[] = {
-  /*  0 */  GROUP(403),  GROUP(405),  GROUP(407),  GROUP(409),
-  /*  4 */  GROUP(411),  GROUP(413),           0,  GROUP(415),
-};
-
-static const uint16_t ud_itab__420[] = {
-  /*  0 */           0,         462,
-};
-
-static const uint16_t ud_itab__419[] = {
+  /* 0416: UD_TAB__OPC_MOD, /mod */
+  /*  0 */         461,           0,
+  /* 0417: UD_TAB__OPC_REG, /reg */
+  /*  0 */           0,           0,           0,           0,
+  /*  4 */           0,  GROUP(418),  GROUP(435),  GROUP(452),
+  /* 0418: UD_TAB__OPC_RM, /rm */
+  /*  0 */  GROUP(419),  GROUP(421),  GROUP(423),  GROUP(425),
+  /*  4 */  GROUP(427),  GROUP(429),  GROUP(431),  GROUP(433),
+  /* 0419: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(420),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__422[] = {
-  /*  0 */           0,         463,
-};
-
-static const uint16_t ud_itab__421[] = {
+  /* 0420: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         462,
+  /* 0421: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(422),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__424[] = {
-  /*  0 */           0,         464,
-};
-
-static const uint16_t ud_itab__423[] = {
+  /* 0422: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         463,
+  /* 0423: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(424),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__426[] = {
-  /*  0 */           0,         465,
-};
-
-static const uint16_t ud_itab__425[] = {
+  /* 0424: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         464,
+  /* 0425: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(426),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__428[] = {
-  /*  0 */           0,         466,
-};
-
-static const uint16_t ud_itab__427[] = {
+  /* 0426: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         465,
+  /* 0427: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(428),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__430[] = {
-  /*  0 */           0,         467,
-};
-
-static const uint16_t ud_itab__429[] = {
+  /* 0428: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         466,
+  /* 0429: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(430),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__432[] = {
-  /*  0 */           0,         468,
-};
-
-static const uint16_t ud_itab__431[] = {
+  /* 0430: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         467,
+  /* 0431: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(432),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__434[] = {
-  /*  0 */           0,         469,
-};
-
-static const uint16_t ud_itab__433[] = {
+  /* 0432: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         468,
+  /* 0433: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(434),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__418[] = {
-  /*  0 */  GROUP(419),  GROUP(421),  GROUP(423),  GROUP(425),
-  /*  4 */  GROUP(427),  GROUP(429),  GROUP(431),  GROUP(433),
-};
-
-static const uint16_t ud_itab__437[] = {
-  /*  0 */           0,         470,
-};
-
-static const uint16_t ud_itab__436[] = {
+  /* 0434: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         469,
+  /* 0435: UD_TAB__OPC_RM, /rm */
+  /*  0 */  GROUP(436),  GROUP(438),  GROUP(440),  GROUP(442),
+  /*  4 */  GROUP(444),  GROUP(446),  GROUP(448),  GROUP(450),
+  /* 0436: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(437),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__439[] = {
-  /*  0 */           0,         471,
-};
-
-static const uint16_t ud_itab__438[] = {
+  /* 0437: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         470,
+  /* 0438: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(439),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__441[] = {
-  /*  0 */           0,         472,
-};
-
-static const uint16_t ud_itab__440[] = {
+  /* 0439: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         471,
+  /* 0440: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(441),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__443[] = {
-  /*  0 */           0,         473,
-};
-
-static const uint16_t ud_itab__442[] = {
+  /* 0441: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         472,
+  /* 0442: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(443),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__445[] = {
-  /*  0 */           0,         474,
-};
-
-static const uint16_t ud_itab__444[] = {
+  /* 0443: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         473,
+  /* 0444: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(445),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__447[] = {
-  /*  0 */           0,         475,
-};
-
-static const uint16_t ud_itab__446[] = {
+  /* 0445: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         474,
+  /* 0446: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(447),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__449[] = {
-  /*  0 */           0,         476,
-};
-
-static const uint16_t ud_itab__448[] = {
+  /* 0447: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         475,
+  /* 0448: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(449),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__451[] = {
-  /*  0 */           0,         477,
-};
-
-static const uint16_t ud_itab__450[] = {
+  /* 0449: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         476,
+  /* 0450: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(451),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__435[] = {
-  /*  0 */  GROUP(436),  GROUP(438),  GROUP(440),  GROUP(442),
-  /*  4 */  GROUP(444),  GROUP(446),  GROUP(448),  GROUP(450),
-};
-
-static const uint16_t ud_itab__454[] = {
-  /*  0 */           0,         478,
-};
-
-static const uint16_t ud_itab__453[] = {
+  /* 0451: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         477,
+  /* 0452: UD_TAB__OPC_RM, /rm */
+  /*  0 */  GROUP(453),  GROUP(455),  GROUP(457),  GROUP(459),
+  /*  4 */  GROUP(461),  GROUP(463),  GROUP(465),  GROUP(467),
+  /* 0453: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(454),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__456[] = {
-  /*  0 */           0,         479,
-};
-
-static const uint16_t ud_itab__455[] = {
+  /* 0454: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         478,
+  /* 0455: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(456),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__458[] = {
-  /*  0 */           0,         480,
-};
-
-static const uint16_t ud_itab__457[] = {
+  /* 0456: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         479,
+  /* 0457: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(458),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__460[] = {
-  /*  0 */           0,         481,
-};
-
-static const uint16_t ud_itab__459[] = {
+  /* 0458: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         480,
+  /* 0459: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(460),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__462[] = {
-  /*  0 */           0,         482,
-};
-
-static const uint16_t ud_itab__461[] = {
+  /* 0460: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         481,
+  /* 0461: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(462),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__464[] = {
-  /*  0 */           0,         483,
-};
-
-static const uint16_t ud_itab__463[] = {
+  /* 0462: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         482,
+  /* 0463: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(464),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__466[] = {
-  /*  0 */           0,         484,
-};
-
-static const uint16_t ud_itab__465[] = {
+  /* 0464: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         483,
+  /* 0465: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(466),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__468[] = {
-  /*  0 */           0,         485,
-};
-
-static const uint16_t ud_itab__467[] = {
+  /* 0466: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         484,
+  /* 0467: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(468),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__452[] = {
-  /*  0 */  GROUP(453),  GROUP(455),  GROUP(457),  GROUP(459),
-  /*  4 */  GROUP(461),  GROUP(463),  GROUP(465),  GROUP(467),
-};
-
-static const uint16_t ud_itab__417[] = {
-  /*  0 */           0,           0,           0,           0,
-  /*  4 */           0,  GROUP(418),  GROUP(435),  GROUP(452),
-};
-
-static const uint16_t ud_itab__401[] = {
-  /*  0 */  GROUP(402),  GROUP(417),
-};
-
-static const uint16_t ud_itab__469[] = {
+  /* 0468: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         485,
+  /* 0469: UD_TAB__OPC_SSE, /sse */
   /*  0 */         486,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__470[] = {
+  /* 0470: UD_TAB__OPC_SSE, /sse */
   /*  0 */         487,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__471[] = {
+  /* 0471: UD_TAB__OPC_SSE, /sse */
   /*  0 */         488,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__472[] = {
+  /* 0472: UD_TAB__OPC_SSE, /sse */
   /*  0 */         489,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__473[] = {
+  /* 0473: UD_TAB__OPC_SSE, /sse */
   /*  0 */         490,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__474[] = {
+  /* 0474: UD_TAB__OPC_SSE, /sse */
   /*  0 */         491,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__475[] = {
+  /* 0475: UD_TAB__OPC_SSE, /sse */
   /*  0 */         492,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__476[] = {
+  /* 0476: UD_TAB__OPC_SSE, /sse */
   /*  0 */         493,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__477[] = {
+  /* 0477: UD_TAB__OPC_SSE, /sse */
   /*  0 */         494,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__478[] = {
+  /* 0478: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,           0,         495,           0,
-};
-
-static const uint16_t ud_itab__480[] = {
+  /* 0479: UD_TAB__OPC_REG, /reg */
+  /*  0 */           0,           0,           0,           0,
+  /*  4 */  GROUP(480),  GROUP(481),  GROUP(482),  GROUP(483),
+  /* 0480: UD_TAB__OPC_SSE, /sse */
   /*  0 */         496,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__481[] = {
+  /* 0481: UD_TAB__OPC_SSE, /sse */
   /*  0 */         497,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__482[] = {
+  /* 0482: UD_TAB__OPC_SSE, /sse */
   /*  0 */         498,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__483[] = {
+  /* 0483: UD_TAB__OPC_SSE, /sse */
   /*  0 */         499,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__479[] = {
-  /*  0 */           0,           0,           0,           0,
-  /*  4 */  GROUP(480),  GROUP(481),  GROUP(482),  GROUP(483),
-};
-
-static const uint16_t ud_itab__484[] = {
+  /* 0484: UD_TAB__OPC_SSE, /sse */
   /*  0 */         500,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__485[] = {
+  /* 0485: UD_TAB__OPC_SSE, /sse */
   /*  0 */         501,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__486[] = {
+  /* 0486: UD_TAB__OPC_SSE, /sse */
   /*  0 */         502,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__487[] = {
+  /* 0487: UD_TAB__OPC_SSE, /sse */
   /*  0 */         503,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__488[] = {
+  /* 0488: UD_TAB__OPC_SSE, /sse */
   /*  0 */         504,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__489[] = {
+  /* 0489: UD_TAB__OPC_SSE, /sse */
   /*  0 */         505,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__490[] = {
+  /* 0490: UD_TAB__OPC_SSE, /sse */
   /*  0 */         506,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__491[] = {
+  /* 0491: UD_TAB__OPC_SSE, /sse */
   /*  0 */         507,         508,         509,         510,
-};
-
-static const uint16_t ud_itab__492[] = {
+  /* 0492: UD_TAB__OPC_SSE, /sse */
   /*  0 */         511,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__493[] = {
+  /* 0493: UD_TAB__OPC_SSE, /sse */
   /*  0 */         512,           0,           0,         513,
-};
-
-static const uint16_t ud_itab__494[] = {
+  /* 0494: UD_TAB__OPC_SSE, /sse */
   /*  0 */         514,           0,           0,         515,
-};
-
-static const uint16_t ud_itab__495[] = {
+  /* 0495: UD_TAB__OPC_SSE, /sse */
   /*  0 */         516,           0,           0,         517,
-};
-
-static const uint16_t ud_itab__498[] = {
-  /*  0 */         518,         519,         520,
-};
-
-static const uint16_t ud_itab__497[] = {
+  /* 0496: UD_TAB__OPC_REG, /reg */
+  /*  0 */           0,  GROUP(497),           0,           0,
+  /*  4 */           0,           0,  GROUP(499),  GROUP(503),
+  /* 0497: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(498),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__500[] = {
+  /* 0498: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */         518,         519,         520,
+  /* 0499: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(500),           0,  GROUP(501),  GROUP(502),
+  /* 0500: UD_TAB__OPC_VENDOR, intel */
   /*  0 */           0,         521,           0,
-};
-
-static const uint16_t ud_itab__501[] = {
+  /* 0501: UD_TAB__OPC_VENDOR, intel */
   /*  0 */           0,         522,           0,
-};
-
-static const uint16_t ud_itab__502[] = {
+  /* 0502: UD_TAB__OPC_VENDOR, intel */
   /*  0 */           0,         523,           0,
-};
-
-static const uint16_t ud_itab__499[] = {
-  /*  0 */  GROUP(500),           0,  GROUP(501),  GROUP(502),
-};
-
-static const uint16_t ud_itab__504[] = {
-  /*  0 */           0,         524,           0,
-};
-
-static const uint16_t ud_itab__503[] = {
+  /* 0503: UD_TAB__OPC_SSE, /sse */
   /*  0 */  GROUP(504),           0,           0,           0,
-};
-
-static const uint16_t ud_itab__496[] = {
-  /*  0 */           0,  GROUP(497),           0,           0,
-  /*  4 */           0,           0,  GROUP(499),  GROUP(503),
-};
-
-static const uint16_t ud_itab__505[] = {
+  /* 0504: UD_TAB__OPC_VENDOR, intel */
+  /*  0 */           0,         524,           0,
+  /* 0505: UD_TAB__OPC_SSE, /sse */
   /*  0 */         525,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__506[] = {
+  /* 0506: UD_TAB__OPC_SSE, /sse */
   /*  0 */         526,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__507[] = {
+  /* 0507: UD_TAB__OPC_SSE, /sse */
   /*  0 */         527,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__508[] = {
+  /* 0508: UD_TAB__OPC_SSE, /sse */
   /*  0 */         528,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__509[] = {
+  /* 0509: UD_TAB__OPC_SSE, /sse */
   /*  0 */         529,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__510[] = {
+  /* 0510: UD_TAB__OPC_SSE, /sse */
   /*  0 */         530,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__511[] = {
+  /* 0511: UD_TAB__OPC_SSE, /sse */
   /*  0 */         531,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__512[] = {
+  /* 0512: UD_TAB__OPC_SSE, /sse */
   /*  0 */         532,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__513[] = {
+  /* 0513: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         533,           0,         534,
-};
-
-static const uint16_t ud_itab__514[] = {
+  /* 0514: UD_TAB__OPC_SSE, /sse */
   /*  0 */         535,           0,           0,         536,
-};
-
-static const uint16_t ud_itab__515[] = {
+  /* 0515: UD_TAB__OPC_SSE, /sse */
   /*  0 */         537,           0,           0,         538,
-};
-
-static const uint16_t ud_itab__516[] = {
+  /* 0516: UD_TAB__OPC_SSE, /sse */
   /*  0 */         539,           0,           0,         540,
-};
-
-static const uint16_t ud_itab__517[] = {
+  /* 0517: UD_TAB__OPC_SSE, /sse */
   /*  0 */         541,           0,           0,         542,
-};
-
-static const uint16_t ud_itab__518[] = {
+  /* 0518: UD_TAB__OPC_SSE, /sse */
   /*  0 */         543,           0,           0,         544,
-};
-
-static const uint16_t ud_itab__519[] = {
+  /* 0519: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         545,         546,         547,
-};
-
-static const uint16_t ud_itab__520[] = {
+  /* 0520: UD_TAB__OPC_SSE, /sse */
   /*  0 */         548,           0,           0,         549,
-};
-
-static const uint16_t ud_itab__521[] = {
+  /* 0521: UD_TAB__OPC_SSE, /sse */
   /*  0 */         550,           0,           0,         551,
-};
-
-static const uint16_t ud_itab__522[] = {
+  /* 0522: UD_TAB__OPC_SSE, /sse */
   /*  0 */         552,           0,           0,         553,
-};
-
-static const uint16_t ud_itab__523[] = {
+  /* 0523: UD_TAB__OPC_SSE, /sse */
   /*  0 */         554,           0,           0,         555,
-};
-
-static const uint16_t ud_itab__524[] = {
+  /* 0524: UD_TAB__OPC_SSE, /sse */
   /*  0 */         556,           0,           0,         557,
-};
-
-static const uint16_t ud_itab__525[] = {
+  /* 0525: UD_TAB__OPC_SSE, /sse */
   /*  0 */         558,           0,           0,         559,
-};
-
-static const uint16_t ud_itab__526[] = {
+  /* 0526: UD_TAB__OPC_SSE, /sse */
   /*  0 */         560,           0,           0,         561,
-};
-
-static const uint16_t ud_itab__527[] = {
+  /* 0527: UD_TAB__OPC_SSE, /sse */
   /*  0 */         562,           0,           0,         563,
-};
-
-static const uint16_t ud_itab__528[] = {
+  /* 0528: UD_TAB__OPC_SSE, /sse */
   /*  0 */         564,           0,           0,         565,
-};
-
-static const uint16_t ud_itab__529[] = {
+  /* 0529: UD_TAB__OPC_SSE, /sse */
   /*  0 */         566,           0,           0,         567,
-};
-
-static const uint16_t ud_itab__530[] = {
+  /* 0530: UD_TAB__OPC_SSE, /sse */
   /*  0 */         568,           0,           0,         569,
-};
-
-static const uint16_t ud_itab__531[] = {
+  /* 0531: UD_TAB__OPC_SSE, /sse */
   /*  0 */         570,           0,           0,         571,
-};
-
-static const uint16_t ud_itab__532[] = {
+  /* 0532: UD_TAB__OPC_SSE, /sse */
   /*  0 */         572,           0,           0,         573,
-};
-
-static const uint16_t ud_itab__533[] = {
+  /* 0533: UD_TAB__OPC_SSE, /sse */
   /*  0 */         574,           0,           0,         575,
-};
-
-static const uint16_t ud_itab__534[] = {
+  /* 0534: UD_TAB__OPC_SSE, /sse */
   /*  0 */         576,           0,           0,         577,
-};
-
-static const uint16_t ud_itab__535[] = {
+  /* 0535: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         578,         579,         580,
-};
-
-static const uint16_t ud_itab__536[] = {
+  /* 0536: UD_TAB__OPC_SSE, /sse */
   /*  0 */         581,           0,           0,         582,
-};
-
-static const uint16_t ud_itab__537[] = {
+  /* 0537: UD_TAB__OPC_SSE, /sse */
   /*  0 */         583,           0,           0,         584,
-};
-
-static const uint16_t ud_itab__538[] = {
+  /* 0538: UD_TAB__OPC_SSE, /sse */
   /*  0 */         585,           0,           0,         586,
-};
-
-static const uint16_t ud_itab__539[] = {
+  /* 0539: UD_TAB__OPC_SSE, /sse */
   /*  0 */         587,           0,           0,         588,
-};
-
-static const uint16_t ud_itab__540[] = {
+  /* 0540: UD_TAB__OPC_SSE, /sse */
   /*  0 */         589,           0,           0,         590,
-};
-
-static const uint16_t ud_itab__541[] = {
+  /* 0541: UD_TAB__OPC_SSE, /sse */
   /*  0 */         591,           0,           0,         592,
-};
-
-static const uint16_t ud_itab__542[] = {
+  /* 0542: UD_TAB__OPC_SSE, /sse */
   /*  0 */         593,           0,           0,         594,
-};
-
-static const uint16_t ud_itab__543[] = {
+  /* 0543: UD_TAB__OPC_SSE, /sse */
   /*  0 */         595,           0,           0,         596,
-};
-
-static const uint16_t ud_itab__544[] = {
+  /* 0544: UD_TAB__OPC_SSE, /sse */
   /*  0 */         597,           0,           0,         598,
-};
-
-static const uint16_t ud_itab__545[] = {
+  /* 0545: UD_TAB__OPC_SSE, /sse */
   /*  0 */           0,         599,           0,           0,
-};
-
-static const uint16_t ud_itab__546[] = {
+  /* 0546: UD_TAB__OPC_SSE, /sse */
   /*  0 */         600,           0,           0,         601,
-};
-
-static const uint16_t ud_itab__547[] = {
+  /* 0547: UD_TAB__OPC_SSE, /sse */
   /*  0 */         602,           0,           0,         603,
-};
-
-static const uint16_t ud_itab__548[] = {
+  /* 0548: UD_TAB__OPC_SSE, /sse */
   /*  0 */         604,           0,           0,         605,
-};
-
-static const uint16_t ud_itab__549[] = {
+  /* 0549: UD_TAB__OPC_SSE, /sse */
   /*  0 */         606,           0,           0,         607,
-};
-
-static const uint16_t ud_itab__550[] = {
+  /* 0550: UD_TAB__OPC_SSE, /sse */
   /*  0 */         608,           0,           0,         609,
-};
-
-static const uint16_t ud_itab__551[] = {
+  /* 0551: UD_TAB__OPC_SSE, /sse */
   /*  0 */         610,           0,           0,         611,
-};
-
-static const uint16_t ud_itab__554[] = {
+  /* 0552: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,  GROUP(553),
+  /* 0553: UD_TAB__OPC_SSE, /sse */
+  /*  0 */  GROUP(554),           0,           0,  GROUP(555),
+  /* 0554: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         612,
-};
-
-static const uint16_t ud_itab__555[] = {
+  /* 0555: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         613,
-};
-
-static const uint16_t ud_itab__553[] = {
-  /*  0 */  GROUP(554),           0,           0,  GROUP(555),
-};
-
-static const uint16_t ud_itab__552[] = {
-  /*  0 */           0,  GROUP(553),
-};
-
-static const uint16_t ud_itab__556[] = {
+  /* 0556: UD_TAB__OPC_SSE, /sse */
   /*  0 */         614,           0,           0,         615,
-};
-
-static const uint16_t ud_itab__557[] = {
+  /* 0557: UD_TAB__OPC_SSE, /sse */
   /*  0 */         616,           0,           0,         617,
-};
-
-static const uint16_t ud_itab__558[] = {
+  /* 0558: UD_TAB__OPC_SSE, /sse */
   /*  0 */         618,           0,           0,         619,
-};
-
-static const uint16_t ud_itab__559[] = {
+  /* 0559: UD_TAB__OPC_SSE, /sse */
   /*  0 */         620,           0,           0,         621,
-};
-
-static const uint16_t ud_itab__560[] = {
+  /* 0560: UD_TAB__OPC_SSE, /sse */
   /*  0 */         622,           0,           0,         623,
-};
-
-static const uint16_t ud_itab__561[] = {
+  /* 0561: UD_TAB__OPC_SSE, /sse */
   /*  0 */         624,           0,           0,         625,
-};
-
-static const uint16_t ud_itab__562[] = {
+  /* 0562: UD_TAB__OPC_SSE, /sse */
   /*  0 */         626,           0,           0,         627,
-};
-
-static const uint16_t ud_itab__4[] = {
-  /*  0 */    GROUP(5),   GROUP(12),   GROUP(87),   GROUP(88),
-  /*  4 */           0,   GROUP(89),   GROUP(90),   GROUP(91),
-  /*  8 */   GROUP(92),   GROUP(93),           0,   GROUP(94),
-  /*  c */           0,   GROUP(95),  GROUP(104),  GROUP(105),
-  /* 10 */  GROUP(106),  GROUP(107),  GROUP(108),  GROUP(118),
-  /* 14 */  GROUP(119),  GROUP(120),  GROUP(121),  GROUP(129),
-  /* 18 */  GROUP(130),  GROUP(135),  GROUP(136),  GROUP(137),
-  /* 1c */  GROUP(138),  GROUP(139),  GROUP(140),  GROUP(141),
-  /* 20 */  GROUP(142),  GROUP(143),  GROUP(144),  GROUP(145),
-  /* 24 */           0,           0,           0,           0,
-  /* 28 */  GROUP(146),  GROUP(147),  GROUP(148),  GROUP(149),
-  /* 2c */  GROUP(150),  GROUP(151),  GROUP(152),  GROUP(153),
-  /* 30 */  GROUP(154),  GROUP(155),  GROUP(156),  GROUP(157),
-  /* 34 */  GROUP(158),  GROUP(161),           0,  GROUP(164),
-  /* 38 */  GROUP(165),           0,  GROUP(225),           0,
-  /* 3c */           0,           0,           0,           0,
-  /* 40 */  GROUP(252),  GROUP(253),  GROUP(254),  GROUP(255),
-  /* 44 */  GROUP(256),  GROUP(257),  GROUP(258),  GROUP(259),
-  /* 48 */  GROUP(260),  GROUP(261),  GROUP(262),  GROUP(263),
-  /* 4c */  GROUP(264),  GROUP(265),  GROUP(266),  GROUP(267),
-  /* 50 */  GROUP(268),  GROUP(269),  GROUP(270),  GROUP(271),
-  /* 54 */  GROUP(272),  GROUP(273),  GROUP(274),  GROUP(275),
-  /* 58 */  GROUP(276),  GROUP(277),  GROUP(278),  GROUP(279),
-  /* 5c */  GROUP(280),  GROUP(281),  GROUP(282),  GROUP(283),
-  /* 60 */  GROUP(284),  GROUP(285),  GROUP(286),  GROUP(287),
-  /* 64 */  GROUP(288),  GROUP(289),  GROUP(290),  GROUP(291),
-  /* 68 */  GROUP(292),  GROUP(293),  GROUP(294),  GROUP(295),
-  /* 6c */  GROUP(296),  GROUP(297),  GROUP(298),  GROUP(299),
-  /* 70 */  GROUP(300),  GROUP(301),  GROUP(305),  GROUP(309),
-  /* 74 */  GROUP(314),  GROUP(315),  GROUP(316),  GROUP(317),
-  /* 78 */  GROUP(318),  GROUP(320),           0,           0,
-  /* 7c */  GROUP(322),  GROUP(323),  GROUP(324),  GROUP(325),
-  /* 80 */  GROUP(326),  GROUP(327),  GROUP(328),  GROUP(329),
-  /* 84 */  GROUP(330),  GROUP(331),  GROUP(332),  GROUP(333),
-  /* 88 */  GROUP(334),  GROUP(335),  GROUP(336),  GROUP(337),
-  /* 8c */  GROUP(338),  GROUP(339),  GROUP(340),  GROUP(341),
-  /* 90 */  GROUP(342),  GROUP(343),  GROUP(344),  GROUP(345),
-  /* 94 */  GROUP(346),  GROUP(347),  GROUP(348),  GROUP(349),
-  /* 98 */  GROUP(350),  GROUP(351),  GROUP(352),  GROUP(353),
-  /* 9c */  GROUP(354),  GROUP(355),  GROUP(356),  GROUP(357),
-  /* a0 */  GROUP(358),  GROUP(359),  GROUP(360),  GROUP(361),
-  /* a4 */  GROUP(362),  GROUP(363),  GROUP(364),  GROUP(375),
-  /* a8 */  GROUP(395),  GROUP(396),  GROUP(397),  GROUP(398),
-  /* ac */  GROUP(399),  GROUP(400),  GROUP(401),  GROUP(469),
-  /* b0 */  GROUP(470),  GROUP(471),  GROUP(472),  GROUP(473),
-  /* b4 */  GROUP(474),  GROUP(475),  GROUP(476),  GROUP(477),
-  /* b8 */  GROUP(478),           0,  GROUP(479),  GROUP(484),
-  /* bc */  GROUP(485),  GROUP(486),  GROUP(487),  GROUP(488),
-  /* c0 */  GROUP(489),  GROUP(490),  GROUP(491),  GROUP(492),
-  /* c4 */  GROUP(493),  GROUP(494),  GROUP(495),  GROUP(496),
-  /* c8 */  GROUP(505),  GROUP(506),  GROUP(507),  GROUP(508),
-  /* cc */  GROUP(509),  GROUP(510),  GROUP(511),  GROUP(512),
-  /* d0 */  GROUP(513),  GROUP(514),  GROUP(515),  GROUP(516),
-  /* d4 */  GROUP(517),  GROUP(518),  GROUP(519),  GROUP(520),
-  /* d8 */  GROUP(521),  GROUP(522),  GROUP(523),  GROUP(524),
-  /* dc */  GROUP(525),  GROUP(526),  GROUP(527),  GROUP(528),
-  /* e0 */  GROUP(529),  GROUP(530),  GROUP(531),  GROUP(532),
-  /* e4 */  GROUP(533),  GROUP(534),  GROUP(535),  GROUP(536),
-  /* e8 */  GROUP(537),  GROUP(538),  GROUP(539),  GROUP(540),
-  /* ec */  GROUP(541),  GROUP(542),  GROUP(543),  GROUP(544),
-  /* f0 */  GROUP(545),  GROUP(546),  GROUP(547),  GROUP(548),
-  /* f4 */  GROUP(549),  GROUP(550),  GROUP(551),  GROUP(552),
-  /* f8 */  GROUP(556),  GROUP(557),  GROUP(558),  GROUP(559),
-  /* fc */  GROUP(560),  GROUP(561),  GROUP(562),           0,
-};
-
-static const uint16_t ud_itab__563[] = {
+  /* 0563: UD_TAB__OPC_MODE, /m */
   /*  0 */         634,           0,
-};
-
-static const uint16_t ud_itab__564[] = {
+  /* 0564: UD_TAB__OPC_MODE, /m */
   /*  0 */         635,           0,
-};
-
-static const uint16_t ud_itab__565[] = {
+  /* 0565: UD_TAB__OPC_MODE, /m */
   /*  0 */         642,           0,
-};
-
-static const uint16_t ud_itab__566[] = {
+  /* 0566: UD_TAB__OPC_MODE, /m */
   /*  0 */         643,           0,
-};
-
-static const uint16_t ud_itab__567[] = {
+  /* 0567: UD_TAB__OPC_MODE, /m */
   /*  0 */         650,           0,
-};
-
-static const uint16_t ud_itab__568[] = {
+  /* 0568: UD_TAB__OPC_MODE, /m */
   /*  0 */         657,           0,
-};
-
-static const uint16_t ud_itab__569[] = {
+  /* 0569: UD_TAB__OPC_MODE, /m */
   /*  0 */         664,           0,
-};
-
-static const uint16_t ud_itab__570[] = {
+  /* 0570: UD_TAB__OPC_MODE, /m */
   /*  0 */         671,           0,
-};
-
-static const uint16_t ud_itab__572[] = {
+  /* 0571: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */  GROUP(572),  GROUP(573),           0,
+  /* 0572: UD_TAB__OPC_MODE, /m */
   /*  0 */         704,           0,
-};
-
-static const uint16_t ud_itab__573[] = {
+  /* 0573: UD_TAB__OPC_MODE, /m */
   /*  0 */         705,           0,
-};
-
-static const uint16_t ud_itab__571[] = {
-  /*  0 */  GROUP(572),  GROUP(573),           0,
-};
-
-static const uint16_t ud_itab__575[] = {
-  /*  0 */         706,           0,
-};
-
-static const uint16_t ud_itab__576[] = {
-  /*  0 */         707,           0,
-};
-
-static const uint16_t ud_itab__574[] = {
+  /* 0574: UD_TAB__OPC_OSIZE, /o */
   /*  0 */  GROUP(575),  GROUP(576),           0,
-};
-
-static const uint16_t ud_itab__577[] = {
+  /* 0575: UD_TAB__OPC_MODE, /m */
+  /*  0 */         706,           0,
+  /* 0576: UD_TAB__OPC_MODE, /m */
+  /*  0 */         707,           0,
+  /* 0577: UD_TAB__OPC_MODE, /m */
   /*  0 */         708,           0,
-};
-
-static const uint16_t ud_itab__578[] = {
+  /* 0578: UD_TAB__OPC_MODE, /m */
   /*  0 */         709,         710,
-};
-
-static const uint16_t ud_itab__579[] = {
+  /* 0579: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         716,         717,           0,
-};
-
-static const uint16_t ud_itab__580[] = {
+  /* 0580: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         719,         720,           0,
-};
-
-static const uint16_t ud_itab__581[] = {
+  /* 0581: UD_TAB__OPC_REG, /reg */
   /*  0 */         737,         738,         739,         740,
   /*  4 */         741,         742,         743,         744,
-};
-
-static const uint16_t ud_itab__582[] = {
+  /* 0582: UD_TAB__OPC_REG, /reg */
   /*  0 */         745,         746,         747,         748,
   /*  4 */         749,         750,         751,         752,
-};
-
-static const uint16_t ud_itab__584[] = {
+  /* 0583: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(584),  GROUP(585),  GROUP(586),  GROUP(587),
+  /*  4 */  GROUP(588),  GROUP(589),  GROUP(590),  GROUP(591),
+  /* 0584: UD_TAB__OPC_MODE, /m */
   /*  0 */         753,           0,
-};
-
-static const uint16_t ud_itab__585[] = {
+  /* 0585: UD_TAB__OPC_MODE, /m */
   /*  0 */         754,           0,
-};
-
-static const uint16_t ud_itab__586[] = {
+  /* 0586: UD_TAB__OPC_MODE, /m */
   /*  0 */         755,           0,
-};
-
-static const uint16_t ud_itab__587[] = {
+  /* 0587: UD_TAB__OPC_MODE, /m */
   /*  0 */         756,           0,
-};
-
-static const uint16_t ud_itab__588[] = {
+  /* 0588: UD_TAB__OPC_MODE, /m */
   /*  0 */         757,           0,
-};
-
-static const uint16_t ud_itab__589[] = {
+  /* 0589: UD_TAB__OPC_MODE, /m */
   /*  0 */         758,           0,
-};
-
-static const uint16_t ud_itab__590[] = {
+  /* 0590: UD_TAB__OPC_MODE, /m */
   /*  0 */         759,           0,
-};
-
-static const uint16_t ud_itab__591[] = {
+  /* 0591: UD_TAB__OPC_MODE, /m */
   /*  0 */         760,           0,
-};
-
-static const uint16_t ud_itab__583[] = {
-  /*  0 */  GROUP(584),  GROUP(585),  GROUP(586),  GROUP(587),
-  /*  4 */  GROUP(588),  GROUP(589),  GROUP(590),  GROUP(591),
-};
-
-static const uint16_t ud_itab__592[] = {
+  /* 0592: UD_TAB__OPC_REG, /reg */
   /*  0 */         761,         762,         763,         764,
   /*  4 */         765,         766,         767,         768,
-};
-
-static const uint16_t ud_itab__593[] = {
+  /* 0593: UD_TAB__OPC_REG, /reg */
   /*  0 */         780,           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__594[] = {
+  /* 0594: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         789,         790,         791,
-};
-
-static const uint16_t ud_itab__595[] = {
+  /* 0595: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         792,         793,         794,
-};
-
-static const uint16_t ud_itab__596[] = {
+  /* 0596: UD_TAB__OPC_MODE, /m */
   /*  0 */         795,           0,
-};
-
-static const uint16_t ud_itab__598[] = {
+  /* 0597: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */  GROUP(598),  GROUP(599),  GROUP(600),
+  /* 0598: UD_TAB__OPC_MODE, /m */
   /*  0 */         797,         798,
-};
-
-static const uint16_t ud_itab__599[] = {
+  /* 0599: UD_TAB__OPC_MODE, /m */
   /*  0 */         799,         800,
-};
-
-static const uint16_t ud_itab__600[] = {
+  /* 0600: UD_TAB__OPC_MODE, /m */
   /*  0 */           0,         801,
-};
-
-static const uint16_t ud_itab__597[] = {
-  /*  0 */  GROUP(598),  GROUP(599),  GROUP(600),
-};
-
-static const uint16_t ud_itab__602[] = {
+  /* 0601: UD_TAB__OPC_OSIZE, /o */
+  /*  0 */  GROUP(602),  GROUP(603),  GROUP(604),
+  /* 0602: UD_TAB__OPC_MODE, /m */
   /*  0 */         802,           0,
-};
-
-static const uint16_t ud_itab__603[] = {
+  /* 0603: UD_TAB__OPC_MODE, /m */
   /*  0 */         803,         804,
-};
-
-static const uint16_t ud_itab__604[] = {
+  /* 0604: UD_TAB__OPC_MODE, /m */
   /*  0 */           0,         805,
-};
-
-static const uint16_t ud_itab__601[] = {
-  /*  0 */  GROUP(602),  GROUP(603),  GROUP(604),
-};
-
-static const uint16_t ud_itab__605[] = {
+  /* 0605: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         813,         814,         815,
-};
-
-static const uint16_t ud_itab__606[] = {
+  /* 0606: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         817,         818,         819,
-};
-
-static const uint16_t ud_itab__607[] = {
+  /* 0607: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         823,         824,         825,
-};
-
-static const uint16_t ud_itab__608[] = {
+  /* 0608: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         827,         828,         829,
-};
-
-static const uint16_t ud_itab__609[] = {
+  /* 0609: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         831,         832,         833,
-};
-
-static const uint16_t ud_itab__610[] = {
+  /* 0610: UD_TAB__OPC_REG, /reg */
   /*  0 */         850,         851,         852,         853,
   /*  4 */         854,         855,         856,         857,
-};
-
-static const uint16_t ud_itab__611[] = {
+  /* 0611: UD_TAB__OPC_REG, /reg */
   /*  0 */         858,         859,         860,         861,
   /*  4 */         862,         863,         864,         865,
-};
-
-static const uint16_t ud_itab__612[] = {
+  /* 0612: UD_TAB__OPC_MODE, /m */
   /*  0 */         868,           0,
-};
-
-static const uint16_t ud_itab__613[] = {
+  /* 0613: UD_TAB__OPC_MODE, /m */
   /*  0 */         869,           0,
-};
-
-static const uint16_t ud_itab__614[] = {
+  /* 0614: UD_TAB__OPC_REG, /reg */
   /*  0 */         870,           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__615[] = {
+  /* 0615: UD_TAB__OPC_REG, /reg */
   /*  0 */         871,           0,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__616[] = {
+  /* 0616: UD_TAB__OPC_MODE, /m */
   /*  0 */         878,           0,
-};
-
-static const uint16_t ud_itab__617[] = {
+  /* 0617: UD_TAB__OPC_OSIZE, /o */
   /*  0 */         879,         880,         881,
-};
-
-static const uint16_t ud_itab__618[] = {
+  /* 0618: UD_TAB__OPC_REG, /reg */
   /*  0 */         882,         883,         884,         885,
   /*  4 */         886,         887,         888,         889,
-};
-
-static const uint16_t ud_itab__619[] = {
+  /* 0619: UD_TAB__OPC_REG, /reg */
   /*  0 */         890,         891,         892,         893,
   /*  4 */         894,         895,         896,         897,
-};
-
-static const uint16_t ud_itab__620[] = {
+  /* 0620: UD_TAB__OPC_REG, /reg */
   /*  0 */         898,         899,         900,         901,
   /*  4 */         902,         903,         904,         905,
-};
-
-static const uint16_t ud_itab__621[] = {
+  /* 0621: UD_TAB__OPC_REG, /reg */
   /*  0 */         906,         907,         908,         909,
   /*  4 */         910,         911,         912,         913,
-};
-
-static const uint16_t ud_itab__622[] = {
+  /* 0622: UD_TAB__OPC_MODE, /m */
   /*  0 */         914,           0,
-};
-
-static const uint16_t ud_itab__623[] = {
+  /* 0623: UD_TAB__OPC_MODE, /m */
   /*  0 */         915,           0,
-};
-
-static const uint16_t ud_itab__624[] = {
+  /* 0624: UD_TAB__OPC_MODE, /m */
   /*  0 */         916,           0,
-};
-
-static const uint16_t ud_itab__627[] = {
+  /* 0625: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(626),  GROUP(635),
+  /* 0626: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(627),  GROUP(628),  GROUP(629),  GROUP(630),
+  /*  4 */  GROUP(631),  GROUP(632),  GROUP(633),  GROUP(634),
+  /* 0627: UD_TAB__OPC_MOD, /mod */
   /*  0 */         918,           0,
-};
-
-static const uint16_t ud_itab__628[] = {
+  /* 0628: UD_TAB__OPC_MOD, /mod */
   /*  0 */         919,           0,
-};
-
-static const uint16_t ud_itab__629[] = {
+  /* 0629: UD_TAB__OPC_MOD, /mod */
   /*  0 */         920,           0,
-};
-
-static const uint16_t ud_itab__630[] = {
+  /* 0630: UD_TAB__OPC_MOD, /mod */
   /*  0 */         921,           0,
-};
-
-static const uint16_t ud_itab__631[] = {
+  /* 0631: UD_TAB__OPC_MOD, /mod */
   /*  0 */         922,           0,
-};
-
-static const uint16_t ud_itab__632[] = {
+  /* 0632: UD_TAB__OPC_MOD, /mod */
   /*  0 */         923,           0,
-};
-
-static const uint16_t ud_itab__633[] = {
+  /* 0633: UD_TAB__OPC_MOD, /mod */
   /*  0 */         924,           0,
-};
-
-static const uint16_t ud_itab__634[] = {
+  /* 0634: UD_TAB__OPC_MOD, /mod */
   /*  0 */         925,           0,
-};
-
-static const uint16_t ud_itab__626[] = {
-  /*  0 */  GROUP(627),  GROUP(628),  GROUP(629),  GROUP(630),
-  /*  4 */  GROUP(631),  GROUP(632),  GROUP(633),  GROUP(634),
-};
-
-static const uint16_t ud_itab__636[] = {
+  /* 0635: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(636),  GROUP(637),  GROUP(638),  GROUP(639),
+  /*  4 */  GROUP(640),  GROUP(641),  GROUP(642),  GROUP(643),
+  /*  8 */  GROUP(644),  GROUP(645),  GROUP(646),  GROUP(647),
+  /*  c */  GROUP(648),  GROUP(649),  GROUP(650),  GROUP(651),
+  /* 10 */  GROUP(652),  GROUP(653),  GROUP(654),  GROUP(655),
+  /* 14 */  GROUP(656),  GROUP(657),  GROUP(658),  GROUP(659),
+  /* 18 */  GROUP(660),  GROUP(661),  GROUP(662),  GROUP(663),
+  /* 1c */  GROUP(664),  GROUP(665),  GROUP(666),  GROUP(667),
+  /* 20 */  GROUP(668),  GROUP(669),  GROUP(670),  GROUP(671),
+  /* 24 */  GROUP(672),  GROUP(673),  GROUP(674),  GROUP(675),
+  /* 28 */  GROUP(676),  GROUP(677),  GROUP(678),  GROUP(679),
+  /* 2c */  GROUP(680),  GROUP(681),  GROUP(682),  GROUP(683),
+  /* 30 */  GROUP(684),  GROUP(685),  GROUP(686),  GROUP(687),
+  /* 34 */  GROUP(688),  GROUP(689),  GROUP(690),  GROUP(691),
+  /* 38 */  GROUP(692),  GROUP(693),  GROUP(694),  GROUP(695),
+  /* 3c */  GROUP(696),  GROUP(697),  GROUP(698),  GROUP(699),
+  /* 0636: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         926,
-};
-
-static const uint16_t ud_itab__637[] = {
+  /* 0637: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         927,
-};
-
-static const uint16_t ud_itab__638[] = {
+  /* 0638: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         928,
-};
-
-static const uint16_t ud_itab__639[] = {
+  /* 0639: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         929,
-};
-
-static const uint16_t ud_itab__640[] = {
+  /* 0640: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         930,
-};
-
-static const uint16_t ud_itab__641[] = {
+  /* 0641: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         931,
-};
-
-static const uint16_t ud_itab__642[] = {
+  /* 0642: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         932,
-};
-
-static const uint16_t ud_itab__643[] = {
+  /* 0643: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         933,
-};
-
-static const uint16_t ud_itab__644[] = {
+  /* 0644: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         934,
-};
-
-static const uint16_t ud_itab__645[] = {
+  /* 0645: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         935,
-};
-
-static const uint16_t ud_itab__646[] = {
+  /* 0646: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         936,
-};
-
-static const uint16_t ud_itab__647[] = {
+  /* 0647: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         937,
-};
-
-static const uint16_t ud_itab__648[] = {
+  /* 0648: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         938,
-};
-
-static const uint16_t ud_itab__649[] = {
+  /* 0649: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         939,
-};
-
-static const uint16_t ud_itab__650[] = {
+  /* 0650: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         940,
-};
-
-static const uint16_t ud_itab__651[] = {
+  /* 0651: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         941,
-};
-
-static const uint16_t ud_itab__652[] = {
+  /* 0652: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         942,
-};
-
-static const uint16_t ud_itab__653[] = {
+  /* 0653: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         943,
-};
-
-static const uint16_t ud_itab__654[] = {
+  /* 0654: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         944,
-};
-
-static const uint16_t ud_itab__655[] = {
+  /* 0655: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         945,
-};
-
-static const uint16_t ud_itab__656[] = {
+  /* 0656: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         946,
-};
-
-static const uint16_t ud_itab__657[] = {
+  /* 0657: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         947,
-};
-
-static const uint16_t ud_itab__658[] = {
+  /* 0658: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         948,
-};
-
-static const uint16_t ud_itab__659[] = {
+  /* 0659: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         949,
-};
-
-static const uint16_t ud_itab__660[] = {
+  /* 0660: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         950,
-};
-
-static const uint16_t ud_itab__661[] = {
+  /* 0661: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         951,
-};
-
-static const uint16_t ud_itab__662[] = {
+  /* 0662: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         952,
-};
-
-static const uint16_t ud_itab__663[] = {
+  /* 0663: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         953,
-};
-
-static const uint16_t ud_itab__664[] = {
+  /* 0664: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         954,
-};
-
-static const uint16_t ud_itab__665[] = {
+  /* 0665: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         955,
-};
-
-static const uint16_t ud_itab__666[] = {
+  /* 0666: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         956,
-};
-
-static const uint16_t ud_itab__667[] = {
+  /* 0667: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         957,
-};
-
-static const uint16_t ud_itab__668[] = {
+  /* 0668: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         958,
-};
-
-static const uint16_t ud_itab__669[] = {
+  /* 0669: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         959,
-};
-
-static const uint16_t ud_itab__670[] = {
+  /* 0670: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         960,
-};
-
-static const uint16_t ud_itab__671[] = {
+  /* 0671: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         961,
-};
-
-static const uint16_t ud_itab__672[] = {
+  /* 0672: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         962,
-};
-
-static const uint16_t ud_itab__673[] = {
+  /* 0673: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         963,
-};
-
-static const uint16_t ud_itab__674[] = {
+  /* 0674: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         964,
-};
-
-static const uint16_t ud_itab__675[] = {
+  /* 0675: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         965,
-};
-
-static const uint16_t ud_itab__676[] = {
+  /* 0676: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         966,
-};
-
-static const uint16_t ud_itab__677[] = {
+  /* 0677: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         967,
-};
-
-static const uint16_t ud_itab__678[] = {
+  /* 0678: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         968,
-};
-
-static const uint16_t ud_itab__679[] = {
+  /* 0679: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         969,
-};
-
-static const uint16_t ud_itab__680[] = {
+  /* 0680: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         970,
-};
-
-static const uint16_t ud_itab__681[] = {
+  /* 0681: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         971,
-};
-
-static const uint16_t ud_itab__682[] = {
+  /* 0682: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         972,
-};
-
-static const uint16_t ud_itab__683[] = {
+  /* 0683: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         973,
-};
-
-static const uint16_t ud_itab__684[] = {
+  /* 0684: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         974,
-};
-
-static const uint16_t ud_itab__685[] = {
+  /* 0685: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         975,
-};
-
-static const uint16_t ud_itab__686[] = {
+  /* 0686: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         976,
-};
-
-static const uint16_t ud_itab__687[] = {
+  /* 0687: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         977,
-};
-
-static const uint16_t ud_itab__688[] = {
+  /* 0688: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         978,
-};
-
-static const uint16_t ud_itab__689[] = {
-  /*  0 */           0,         979,
-};
-
-static const uint16_t ud_itab__690[] = {
+  /* 0689: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,         979,
+  /* 0690: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         980,
-};
-
-static const uint16_t ud_itab__691[] = {
+  /* 0691: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         981,
-};
-
-static const uint16_t ud_itab__692[] = {
+  /* 0692: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         982,
-};
-
-static const uint16_t ud_itab__693[] = {
+  /* 0693: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         983,
-};
-
-static const uint16_t ud_itab__694[] = {
+  /* 0694: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         984,
-};
-
-static const uint16_t ud_itab__695[] = {
+  /* 0695: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         985,
-};
-
-static const uint16_t ud_itab__696[] = {
+  /* 0696: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         986,
-};
-
-static const uint16_t ud_itab__697[] = {
+  /* 0697: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         987,
-};
-
-static const uint16_t ud_itab__698[] = {
+  /* 0698: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         988,
-};
-
-static const uint16_t ud_itab__699[] = {
+  /* 0699: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         989,
-};
-
-static const uint16_t ud_itab__635[] = {
-  /*  0 */  GROUP(636),  GROUP(637),  GROUP(638),  GROUP(639),
-  /*  4 */  GROUP(640),  GROUP(641),  GROUP(642),  GROUP(643),
-  /*  8 */  GROUP(644),  GROUP(645),  GROUP(646),  GROUP(647),
-  /*  c */  GROUP(648),  GROUP(649),  GROUP(650),  GROUP(651),
-  /* 10 */  GROUP(652),  GROUP(653),  GROUP(654),  GROUP(655),
-  /* 14 */  GROUP(656),  GROUP(657),  GROUP(658),  GROUP(659),
-  /* 18 */  GROUP(660),  GROUP(661),  GROUP(662),  GROUP(663),
-  /* 1c */  GROUP(664),  GROUP(665),  GROUP(666),  GROUP(667),
-  /* 20 */  GROUP(668),  GROUP(669),  GROUP(670),  GROUP(671),
-  /* 24 */  GROUP(672),  GROUP(673),  GROUP(674),  GROUP(675),
-  /* 28 */  GROUP(676),  GROUP(677),  GROUP(678),  GROUP(679),
-  /* 2c */  GROUP(680),  GROUP(681),  GROUP(682),  GROUP(683),
-  /* 30 */  GROUP(684),  GROUP(685),  GROUP(686),  GROUP(687),
-  /* 34 */  GROUP(688),  GROUP(689),  GROUP(690),  GROUP(691),
-  /* 38 */  GROUP(692),  GROUP(693),  GROUP(694),  GROUP(695),
-  /* 3c */  GROUP(696),  GROUP(697),  GROUP(698),  GROUP(699),
-};
-
-static const uint16_t ud_itab__625[] = {
-  /*  0 */  GROUP(626),  GROUP(635),
-};
-
-static const uint16_t ud_itab__702[] = {
+  /* 0700: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(701),  GROUP(709),
+  /* 0701: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(702),           0,  GROUP(703),  GROUP(704),
+  /*  4 */  GROUP(705),  GROUP(706),  GROUP(707),  GROUP(708),
+  /* 0702: UD_TAB__OPC_MOD, /mod */
   /*  0 */         990,           0,
-};
-
-static const uint16_t ud_itab__703[] = {
+  /* 0703: UD_TAB__OPC_MOD, /mod */
   /*  0 */         991,           0,
-};
-
-static const uint16_t ud_itab__704[] = {
+  /* 0704: UD_TAB__OPC_MOD, /mod */
   /*  0 */         992,           0,
-};
-
-static const uint16_t ud_itab__705[] = {
+  /* 0705: UD_TAB__OPC_MOD, /mod */
   /*  0 */         993,           0,
-};
-
-static const uint16_t ud_itab__706[] = {
+  /* 0706: UD_TAB__OPC_MOD, /mod */
   /*  0 */         994,           0,
-};
-
-static const uint16_t ud_itab__707[] = {
+  /* 0707: UD_TAB__OPC_MOD, /mod */
   /*  0 */         995,           0,
-};
-
-static const uint16_t ud_itab__708[] = {
+  /* 0708: UD_TAB__OPC_MOD, /mod */
   /*  0 */         996,           0,
-};
-
-static const uint16_t ud_itab__701[] = {
-  /*  0 */  GROUP(702),           0,  GROUP(703),  GROUP(704),
-  /*  4 */  GROUP(705),  GROUP(706),  GROUP(707),  GROUP(708),
-};
-
-static const uint16_t ud_itab__710[] = {
+  /* 0709: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(710),  GROUP(711),  GROUP(712),  GROUP(713),
+  /*  4 */  GROUP(714),  GROUP(715),  GROUP(716),  GROUP(717),
+  /*  8 */  GROUP(718),  GROUP(719),  GROUP(720),  GROUP(721),
+  /*  c */  GROUP(722),  GROUP(723),  GROUP(724),  GROUP(725),
+  /* 10 */  GROUP(726),           0,           0,           0,
+  /* 14 */           0,           0,           0,           0,
+  /* 18 */  GROUP(727),  GROUP(728),  GROUP(729),  GROUP(730),
+  /* 1c */  GROUP(731),  GROUP(732),  GROUP(733),  GROUP(734),
+  /* 20 */  GROUP(735),  GROUP(736),           0,           0,
+  /* 24 */  GROUP(737),  GROUP(738),           0,           0,
+  /* 28 */  GROUP(739),  GROUP(740),  GROUP(741),  GROUP(742),
+  /* 2c */  GROUP(743),  GROUP(744),  GROUP(745),           0,
+  /* 30 */  GROUP(746),  GROUP(747),  GROUP(748),  GROUP(749),
+  /* 34 */  GROUP(750),  GROUP(751),  GROUP(752),  GROUP(753),
+  /* 38 */  GROUP(754),  GROUP(755),  GROUP(756),  GROUP(757),
+  /* 3c */  GROUP(758),  GROUP(759),  GROUP(760),  GROUP(761),
+  /* 0710: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         997,
-};
-
-static const uint16_t ud_itab__711[] = {
+  /* 0711: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         998,
-};
-
-static const uint16_t ud_itab__712[] = {
+  /* 0712: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,         999,
-};
-
-static const uint16_t ud_itab__713[] = {
+  /* 0713: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1000,
-};
-
-static const uint16_t ud_itab__714[] = {
+  /* 0714: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1001,
-};
-
-static const uint16_t ud_itab__715[] = {
+  /* 0715: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1002,
-};
-
-static const uint16_t ud_itab__716[] = {
+  /* 0716: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1003,
-};
-
-static const uint16_t ud_itab__717[] = {
+  /* 0717: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1004,
-};
-
-static const uint16_t ud_itab__718[] = {
+  /* 0718: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1005,
-};
-
-static const uint16_t ud_itab__719[] = {
+  /* 0719: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1006,
-};
-
-static const uint16_t ud_itab__720[] = {
+  /* 0720: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1007,
-};
-
-static const uint16_t ud_itab__721[] = {
+  /* 0721: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1008,
-};
-
-static const uint16_t ud_itab__722[] = {
+  /* 0722: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1009,
-};
-
-static const uint16_t ud_itab__723[] = {
+  /* 0723: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1010,
-};
-
-static const uint16_t ud_itab__724[] = {
+  /* 0724: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1011,
-};
-
-static const uint16_t ud_itab__725[] = {
+  /* 0725: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1012,
-};
-
-static const uint16_t ud_itab__726[] = {
+  /* 0726: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1013,
-};
-
-static const uint16_t ud_itab__727[] = {
+  /* 0727: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1014,
-};
-
-static const uint16_t ud_itab__728[] = {
+  /* 0728: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1015,
-};
-
-static const uint16_t ud_itab__729[] = {
+  /* 0729: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1016,
-};
-
-static const uint16_t ud_itab__730[] = {
+  /* 0730: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1017,
-};
-
-static const uint16_t ud_itab__731[] = {
+  /* 0731: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1018,
-};
-
-static const uint16_t ud_itab__732[] = {
+  /* 0732: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1019,
-};
-
-static const uint16_t ud_itab__733[] = {
+  /* 0733: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1020,
-};
-
-static const uint16_t ud_itab__734[] = {
+  /* 0734: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1021,
-};
-
-static const uint16_t ud_itab__735[] = {
+  /* 0735: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1022,
-};
-
-static const uint16_t ud_itab__736[] = {
+  /* 0736: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1023,
-};
-
-static const uint16_t ud_itab__737[] = {
+  /* 0737: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1024,
-};
-
-static const uint16_t ud_itab__738[] = {
+  /* 0738: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1025,
-};
-
-static const uint16_t ud_itab__739[] = {
+  /* 0739: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1026,
-};
-
-static const uint16_t ud_itab__740[] = {
+  /* 0740: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1027,
-};
-
-static const uint16_t ud_itab__741[] = {
+  /* 0741: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1028,
-};
-
-static const uint16_t ud_itab__742[] = {
+  /* 0742: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1029,
-};
-
-static const uint16_t ud_itab__743[] = {
+  /* 0743: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1030,
-};
-
-static const uint16_t ud_itab__744[] = {
+  /* 0744: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1031,
-};
-
-static const uint16_t ud_itab__745[] = {
+  /* 0745: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1032,
-};
-
-static const uint16_t ud_itab__746[] = {
+  /* 0746: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1033,
-};
-
-static const uint16_t ud_itab__747[] = {
+  /* 0747: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1034,
-};
-
-static const uint16_t ud_itab__748[] = {
+  /* 0748: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1035,
-};
-
-static const uint16_t ud_itab__749[] = {
+  /* 0749: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1036,
-};
-
-static const uint16_t ud_itab__750[] = {
+  /* 0750: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1037,
-};
-
-static const uint16_t ud_itab__751[] = {
+  /* 0751: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1038,
-};
-
-static const uint16_t ud_itab__752[] = {
+  /* 0752: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1039,
-};
-
-static const uint16_t ud_itab__753[] = {
+  /* 0753: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1040,
-};
-
-static const uint16_t ud_itab__754[] = {
+  /* 0754: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1041,
-};
-
-static const uint16_t ud_itab__755[] = {
+  /* 0755: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1042,
-};
-
-static const uint16_t ud_itab__756[] = {
+  /* 0756: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1043,
-};
-
-static const uint16_t ud_itab__757[] = {
+  /* 0757: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1044,
-};
-
-static const uint16_t ud_itab__758[] = {
+  /* 0758: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1045,
-};
-
-static const uint16_t ud_itab__759[] = {
+  /* 0759: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1046,
-};
-
-static const uint16_t ud_itab__760[] = {
+  /* 0760: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1047,
-};
-
-static const uint16_t ud_itab__761[] = {
+  /* 0761: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1048,
-};
-
-static const uint16_t ud_itab__709[] = {
-  /*  0 */  GROUP(710),  GROUP(711),  GROUP(712),  GROUP(713),
-  /*  4 */  GROUP(714),  GROUP(715),  GROUP(716),  GROUP(717),
-  /*  8 */  GROUP(718),  GROUP(719),  GROUP(720),  GROUP(721),
-  /*  c */  GROUP(722),  GROUP(723),  GROUP(724),  GROUP(725),
-  /* 10 */  GROUP(726),           0,           0,           0,
-  /* 14 */           0,           0,           0,           0,
-  /* 18 */  GROUP(727),  GROUP(728),  GROUP(729),  GROUP(730),
-  /* 1c */  GROUP(731),  GROUP(732),  GROUP(733),  GROUP(734),
-  /* 20 */  GROUP(735),  GROUP(736),           0,           0,
-  /* 24 */  GROUP(737),  GROUP(738),           0,           0,
-  /* 28 */  GROUP(739),  GROUP(740),  GROUP(741),  GROUP(742),
-  /* 2c */  GROUP(743),  GROUP(744),  GROUP(745),           0,
-  /* 30 */  GROUP(746),  GROUP(747),  GROUP(748),  GROUP(749),
-  /* 34 */  GROUP(750),  GROUP(751),  GROUP(752),  GROUP(753),
-  /* 38 */  GROUP(754),  GROUP(755),  GROUP(756),  GROUP(757),
-  /* 3c */  GROUP(758),  GROUP(759),  GROUP(760),  GROUP(761),
-};
-
-static const uint16_t ud_itab__700[] = {
-  /*  0 */  GROUP(701),  GROUP(709),
-};
-
-static const uint16_t ud_itab__764[] = {
+  /* 0762: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(763),  GROUP(772),
+  /* 0763: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(764),  GROUP(765),  GROUP(766),  GROUP(767),
+  /*  4 */  GROUP(768),  GROUP(769),  GROUP(770),  GROUP(771),
+  /* 0764: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1049,           0,
-};
-
-static const uint16_t ud_itab__765[] = {
+  /* 0765: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1050,           0,
-};
-
-static const uint16_t ud_itab__766[] = {
+  /* 0766: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1051,           0,
-};
-
-static const uint16_t ud_itab__767[] = {
+  /* 0767: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1052,           0,
-};
-
-static const uint16_t ud_itab__768[] = {
+  /* 0768: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1053,           0,
-};
-
-static const uint16_t ud_itab__769[] = {
+  /* 0769: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1054,           0,
-};
-
-static const uint16_t ud_itab__770[] = {
+  /* 0770: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1055,           0,
-};
-
-static const uint16_t ud_itab__771[] = {
+  /* 0771: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1056,           0,
-};
-
-static const uint16_t ud_itab__763[] = {
-  /*  0 */  GROUP(764),  GROUP(765),  GROUP(766),  GROUP(767),
-  /*  4 */  GROUP(768),  GROUP(769),  GROUP(770),  GROUP(771),
-};
-
-static const uint16_t ud_itab__773[] = {
+  /* 0772: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(773),  GROUP(774),  GROUP(775),  GROUP(776),
+  /*  4 */  GROUP(777),  GROUP(778),  GROUP(779),  GROUP(780),
+  /*  8 */  GROUP(781),  GROUP(782),  GROUP(783),  GROUP(784),
+  /*  c */  GROUP(785),  GROUP(786),  GROUP(787),  GROUP(788),
+  /* 10 */  GROUP(789),  GROUP(790),  GROUP(791),  GROUP(792),
+  /* 14 */  GROUP(793),  GROUP(794),  GROUP(795),  GROUP(796),
+  /* 18 */  GROUP(797),  GROUP(798),  GROUP(799),  GROUP(800),
+  /* 1c */  GROUP(801),  GROUP(802),  GROUP(803),  GROUP(804),
+  /* 20 */           0,           0,           0,           0,
+  /* 24 */           0,           0,           0,           0,
+  /* 28 */           0,  GROUP(805),           0,           0,
+  /* 2c */           0,           0,           0,           0,
+  /* 30 */           0,           0,           0,           0,
+  /* 34 */           0,           0,           0,           0,
+  /* 38 */           0,           0,           0,           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 0773: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1057,
-};
-
-static const uint16_t ud_itab__774[] = {
+  /* 0774: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1058,
-};
-
-static const uint16_t ud_itab__775[] = {
+  /* 0775: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1059,
-};
-
-static const uint16_t ud_itab__776[] = {
+  /* 0776: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1060,
-};
-
-static const uint16_t ud_itab__777[] = {
+  /* 0777: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1061,
-};
-
-static const uint16_t ud_itab__778[] = {
-  /*  0 */           0,        1062,
-};
-
-static const uint16_t ud_itab__779[] = {
+  /* 0778: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1062,
+  /* 0779: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1063,
-};
-
-static const uint16_t ud_itab__780[] = {
+  /* 0780: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1064,
-};
-
-static const uint16_t ud_itab__781[] = {
+  /* 0781: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1065,
-};
-
-static const uint16_t ud_itab__782[] = {
+  /* 0782: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1066,
-};
-
-static const uint16_t ud_itab__783[] = {
+  /* 0783: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1067,
-};
-
-static const uint16_t ud_itab__784[] = {
+  /* 0784: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1068,
-};
-
-static const uint16_t ud_itab__785[] = {
+  /* 0785: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1069,
-};
-
-static const uint16_t ud_itab__786[] = {
+  /* 0786: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1070,
-};
-
-static const uint16_t ud_itab__787[] = {
+  /* 0787: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1071,
-};
-
-static const uint16_t ud_itab__788[] = {
+  /* 0788: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1072,
-};
-
-static const uint16_t ud_itab__789[] = {
+  /* 0789: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1073,
-};
-
-static const uint16_t ud_itab__790[] = {
+  /* 0790: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1074,
-};
-
-static const uint16_t ud_itab__791[] = {
+  /* 0791: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1075,
-};
-
-static const uint16_t ud_itab__792[] = {
+  /* 0792: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1076,
-};
-
-static const uint16_t ud_itab__793[] = {
+  /* 0793: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1077,
-};
-
-static const uint16_t ud_itab__794[] = {
+  /* 0794: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1078,
-};
-
-static const uint16_t ud_itab__795[] = {
+  /* 0795: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1079,
-};
-
-static const uint16_t ud_itab__796[] = {
+  /* 0796: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1080,
-};
-
-static const uint16_t ud_itab__797[] = {
+  /* 0797: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1081,
-};
-
-static const uint16_t ud_itab__798[] = {
+  /* 0798: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1082,
-};
-
-static const uint16_t ud_itab__799[] = {
+  /* 0799: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1083,
-};
-
-static const uint16_t ud_itab__800[] = {
+  /* 0800: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1084,
-};
-
-static const uint16_t ud_itab__801[] = {
+  /* 0801: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1085,
-};
-
-static const uint16_t ud_itab__802[] = {
+  /* 0802: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1086,
-};
-
-static const uint16_t ud_itab__803[] = {
+  /* 0803: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1087,
-};
-
-static const uint16_t ud_itab__804[] = {
+  /* 0804: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1088,
-};
-
-static const uint16_t ud_itab__805[] = {
+  /* 0805: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1089,
-};
-
-static const uint16_t ud_itab__772[] = {
-  /*  0 */  GROUP(773),  GROUP(774),  GROUP(775),  GROUP(776),
-  /*  4 */  GROUP(777),  GROUP(778),  GROUP(779),  GROUP(780),
-  /*  8 */  GROUP(781),  GROUP(782),  GROUP(783),  GROUP(784),
-  /*  c */  GROUP(785),  GROUP(786),  GROUP(787),  GROUP(788),
-  /* 10 */  GROUP(789),  GROUP(790),  GROUP(791),  GROUP(792),
-  /* 14 */  GROUP(793),  GROUP(794),  GROUP(795),  GROUP(796),
-  /* 18 */  GROUP(797),  GROUP(798),  GROUP(799),  GROUP(800),
-  /* 1c */  GROUP(801),  GROUP(802),  GROUP(803),  GROUP(804),
-  /* 20 */           0,           0,           0,           0,
-  /* 24 */           0,           0,           0,           0,
-  /* 28 */           0,  GROUP(805),           0,           0,
-  /* 2c */           0,           0,           0,           0,
-  /* 30 */           0,           0,           0,           0,
-  /* 34 */           0,           0,           0,           0,
-  /* 38 */           0,           0,           0,           0,
-  /* 3c */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__762[] = {
-  /*  0 */  GROUP(763),  GROUP(772),
-};
-
-static const uint16_t ud_itab__808[] = {
+  /* 0806: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(807),  GROUP(814),
+  /* 0807: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(808),  GROUP(809),  GROUP(810),  GROUP(811),
+  /*  4 */           0,  GROUP(812),           0,  GROUP(813),
+  /* 0808: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1090,           0,
-};
-
-static const uint16_t ud_itab__809[] = {
+  /* 0809: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1091,           0,
-};
-
-static const uint16_t ud_itab__810[] = {
+  /* 0810: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1092,           0,
-};
-
-static const uint16_t ud_itab__811[] = {
+  /* 0811: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1093,           0,
-};
-
-static const uint16_t ud_itab__812[] = {
+  /* 0812: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1094,           0,
-};
-
-static const uint16_t ud_itab__813[] = {
+  /* 0813: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1095,           0,
-};
-
-static const uint16_t ud_itab__807[] = {
-  /*  0 */  GROUP(808),  GROUP(809),  GROUP(810),  GROUP(811),
-  /*  4 */           0,  GROUP(812),           0,  GROUP(813),
-};
-
-static const uint16_t ud_itab__815[] = {
+  /* 0814: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(815),  GROUP(816),  GROUP(817),  GROUP(818),
+  /*  4 */  GROUP(819),  GROUP(820),  GROUP(821),  GROUP(822),
+  /*  8 */  GROUP(823),  GROUP(824),  GROUP(825),  GROUP(826),
+  /*  c */  GROUP(827),  GROUP(828),  GROUP(829),  GROUP(830),
+  /* 10 */  GROUP(831),  GROUP(832),  GROUP(833),  GROUP(834),
+  /* 14 */  GROUP(835),  GROUP(836),  GROUP(837),  GROUP(838),
+  /* 18 */  GROUP(839),  GROUP(840),  GROUP(841),  GROUP(842),
+  /* 1c */  GROUP(843),  GROUP(844),  GROUP(845),  GROUP(846),
+  /* 20 */           0,           0,  GROUP(847),  GROUP(848),
+  /* 24 */           0,           0,           0,           0,
+  /* 28 */  GROUP(849),  GROUP(850),  GROUP(851),  GROUP(852),
+  /* 2c */  GROUP(853),  GROUP(854),  GROUP(855),  GROUP(856),
+  /* 30 */  GROUP(857),  GROUP(858),  GROUP(859),  GROUP(860),
+  /* 34 */  GROUP(861),  GROUP(862),  GROUP(863),  GROUP(864),
+  /* 38 */           0,           0,           0,           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 0815: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1096,
-};
-
-static const uint16_t ud_itab__816[] = {
+  /* 0816: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1097,
-};
-
-static const uint16_t ud_itab__817[] = {
+  /* 0817: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1098,
-};
-
-static const uint16_t ud_itab__818[] = {
+  /* 0818: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1099,
-};
-
-static const uint16_t ud_itab__819[] = {
+  /* 0819: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1100,
-};
-
-static const uint16_t ud_itab__820[] = {
+  /* 0820: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1101,
-};
-
-static const uint16_t ud_itab__821[] = {
+  /* 0821: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1102,
-};
-
-static const uint16_t ud_itab__822[] = {
+  /* 0822: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1103,
-};
-
-static const uint16_t ud_itab__823[] = {
+  /* 0823: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1104,
-};
-
-static const uint16_t ud_itab__824[] = {
+  /* 0824: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1105,
-};
-
-static const uint16_t ud_itab__825[] = {
+  /* 0825: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1106,
-};
-
-static const uint16_t ud_itab__826[] = {
+  /* 0826: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1107,
-};
-
-static const uint16_t ud_itab__827[] = {
+  /* 0827: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1108,
-};
-
-static const uint16_t ud_itab__828[] = {
+  /* 0828: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1109,
-};
-
-static const uint16_t ud_itab__829[] = {
+  /* 0829: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1110,
-};
-
-static const uint16_t ud_itab__830[] = {
+  /* 0830: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1111,
-};
-
-static const uint16_t ud_itab__831[] = {
+  /* 0831: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1112,
-};
-
-static const uint16_t ud_itab__832[] = {
+  /* 0832: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1113,
-};
-
-static const uint16_t ud_itab__833[] = {
+  /* 0833: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1114,
-};
-
-static const uint16_t ud_itab__834[] = {
+  /* 0834: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1115,
-};
-
-static const uint16_t ud_itab__835[] = {
+  /* 0835: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1116,
-};
-
-static const uint16_t ud_itab__836[] = {
+  /* 0836: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1117,
-};
-
-static const uint16_t ud_itab__837[] = {
+  /* 0837: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1118,
-};
-
-static const uint16_t ud_itab__838[] = {
+  /* 0838: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1119,
-};
-
-static const uint16_t ud_itab__839[] = {
+  /* 0839: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1120,
-};
-
-static const uint16_t ud_itab__840[] = {
+  /* 0840: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1121,
-};
-
-static const uint16_t ud_itab__841[] = {
+  /* 0841: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1122,
-};
-
-static const uint16_t ud_itab__842[] = {
+  /* 0842: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1123,
-};
-
-static const uint16_t ud_itab__843[] = {
+  /* 0843: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1124,
-};
-
-static const uint16_t ud_itab__844[] = {
+  /* 0844: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1125,
-};
-
-static const uint16_t ud_itab__845[] = {
+  /* 0845: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1126,
-};
-
-static const uint16_t ud_itab__846[] = {
+  /* 0846: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1127,
-};
-
-static const uint16_t ud_itab__847[] = {
+  /* 0847: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1128,
-};
-
-static const uint16_t ud_itab__848[] = {
+  /* 0848: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1129,
-};
-
-static const uint16_t ud_itab__849[] = {
+  /* 0849: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1130,
-};
-
-static const uint16_t ud_itab__850[] = {
+  /* 0850: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1131,
-};
-
-static const uint16_t ud_itab__851[] = {
+  /* 0851: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1132,
-};
-
-static const uint16_t ud_itab__852[] = {
+  /* 0852: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1133,
-};
-
-static const uint16_t ud_itab__853[] = {
+  /* 0853: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1134,
-};
-
-static const uint16_t ud_itab__854[] = {
+  /* 0854: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1135,
-};
-
-static const uint16_t ud_itab__855[] = {
+  /* 0855: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1136,
-};
-
-static const uint16_t ud_itab__856[] = {
+  /* 0856: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1137,
-};
-
-static const uint16_t ud_itab__857[] = {
+  /* 0857: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1138,
-};
-
-static const uint16_t ud_itab__858[] = {
+  /* 0858: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1139,
-};
-
-static const uint16_t ud_itab__859[] = {
+  /* 0859: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1140,
-};
-
-static const uint16_t ud_itab__860[] = {
+  /* 0860: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1141,
-};
-
-static const uint16_t ud_itab__861[] = {
+  /* 0861: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1142,
-};
-
-static const uint16_t ud_itab__862[] = {
+  /* 0862: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1143,
-};
-
-static const uint16_t ud_itab__863[] = {
+  /* 0863: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1144,
-};
-
-static const uint16_t ud_itab__864[] = {
+  /* 0864: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1145,
-};
-
-static const uint16_t ud_itab__814[] = {
-  /*  0 */  GROUP(815),  GROUP(816),  GROUP(817),  GROUP(818),
-  /*  4 */  GROUP(819),  GROUP(820),  GROUP(821),  GROUP(822),
-  /*  8 */  GROUP(823),  GROUP(824),  GROUP(825),  GROUP(826),
-  /*  c */  GROUP(827),  GROUP(828),  GROUP(829),  GROUP(830),
-  /* 10 */  GROUP(831),  GROUP(832),  GROUP(833),  GROUP(834),
-  /* 14 */  GROUP(835),  GROUP(836),  GROUP(837),  GROUP(838),
-  /* 18 */  GROUP(839),  GROUP(840),  GROUP(841),  GROUP(842),
-  /* 1c */  GROUP(843),  GROUP(844),  GROUP(845),  GROUP(846),
-  /* 20 */           0,           0,  GROUP(847),  GROUP(848),
-  /* 24 */           0,           0,           0,           0,
-  /* 28 */  GROUP(849),  GROUP(850),  GROUP(851),  GROUP(852),
-  /* 2c */  GROUP(853),  GROUP(854),  GROUP(855),  GROUP(856),
-  /* 30 */  GROUP(857),  GROUP(858),  GROUP(859),  GROUP(860),
-  /* 34 */  GROUP(861),  GROUP(862),  GROUP(863),  GROUP(864),
-  /* 38 */           0,           0,           0,           0,
-  /* 3c */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__806[] = {
-  /*  0 */  GROUP(807),  GROUP(814),
-};
-
-static const uint16_t ud_itab__867[] = {
+  /* 0865: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(866),  GROUP(875),
+  /* 0866: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(867),  GROUP(868),  GROUP(869),  GROUP(870),
+  /*  4 */  GROUP(871),  GROUP(872),  GROUP(873),  GROUP(874),
+  /* 0867: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1146,           0,
-};
-
-static const uint16_t ud_itab__868[] = {
+  /* 0868: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1147,           0,
-};
-
-static const uint16_t ud_itab__869[] = {
+  /* 0869: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1148,           0,
-};
-
-static const uint16_t ud_itab__870[] = {
+  /* 0870: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1149,           0,
-};
-
-static const uint16_t ud_itab__871[] = {
+  /* 0871: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1150,           0,
-};
-
-static const uint16_t ud_itab__872[] = {
+  /* 0872: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1151,           0,
-};
-
-static const uint16_t ud_itab__873[] = {
+  /* 0873: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1152,           0,
-};
-
-static const uint16_t ud_itab__874[] = {
+  /* 0874: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1153,           0,
-};
-
-static const uint16_t ud_itab__866[] = {
-  /*  0 */  GROUP(867),  GROUP(868),  GROUP(869),  GROUP(870),
-  /*  4 */  GROUP(871),  GROUP(872),  GROUP(873),  GROUP(874),
-};
-
-static const uint16_t ud_itab__876[] = {
+  /* 0875: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(876),  GROUP(877),  GROUP(878),  GROUP(879),
+  /*  4 */  GROUP(880),  GROUP(881),  GROUP(882),  GROUP(883),
+  /*  8 */  GROUP(884),  GROUP(885),  GROUP(886),  GROUP(887),
+  /*  c */  GROUP(888),  GROUP(889),  GROUP(890),  GROUP(891),
+  /* 10 */  GROUP(892),  GROUP(893),  GROUP(894),  GROUP(895),
+  /* 14 */  GROUP(896),  GROUP(897),  GROUP(898),  GROUP(899),
+  /* 18 */  GROUP(900),  GROUP(901),  GROUP(902),  GROUP(903),
+  /* 1c */  GROUP(904),  GROUP(905),  GROUP(906),  GROUP(907),
+  /* 20 */  GROUP(908),  GROUP(909),  GROUP(910),  GROUP(911),
+  /* 24 */  GROUP(912),  GROUP(913),  GROUP(914),  GROUP(915),
+  /* 28 */  GROUP(916),  GROUP(917),  GROUP(918),  GROUP(919),
+  /* 2c */  GROUP(920),  GROUP(921),  GROUP(922),  GROUP(923),
+  /* 30 */  GROUP(924),  GROUP(925),  GROUP(926),  GROUP(927),
+  /* 34 */  GROUP(928),  GROUP(929),  GROUP(930),  GROUP(931),
+  /* 38 */  GROUP(932),  GROUP(933),  GROUP(934),  GROUP(935),
+  /* 3c */  GROUP(936),  GROUP(937),  GROUP(938),  GROUP(939),
+  /* 0876: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1154,
-};
-
-static const uint16_t ud_itab__877[] = {
+  /* 0877: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1155,
-};
-
-static const uint16_t ud_itab__878[] = {
+  /* 0878: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1156,
-};
-
-static const uint16_t ud_itab__879[] = {
+  /* 0879: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1157,
-};
-
-static const uint16_t ud_itab__880[] = {
+  /* 0880: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1158,
-};
-
-static const uint16_t ud_itab__881[] = {
+  /* 0881: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1159,
-};
-
-static const uint16_t ud_itab__882[] = {
+  /* 0882: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1160,
-};
-
-static const uint16_t ud_itab__883[] = {
+  /* 0883: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1161,
-};
-
-static const uint16_t ud_itab__884[] = {
+  /* 0884: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1162,
-};
-
-static const uint16_t ud_itab__885[] = {
+  /* 0885: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1163,
-};
-
-static const uint16_t ud_itab__886[] = {
+  /* 0886: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1164,
-};
-
-static const uint16_t ud_itab__887[] = {
+  /* 0887: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1165,
-};
-
-static const uint16_t ud_itab__888[] = {
+  /* 0888: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1166,
-};
-
-static const uint16_t ud_itab__889[] = {
+  /* 0889: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1167,
-};
-
-static const uint16_t ud_itab__890[] = {
+  /* 0890: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1168,
-};
-
-static const uint16_t ud_itab__891[] = {
+  /* 0891: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1169,
-};
-
-static const uint16_t ud_itab__892[] = {
+  /* 0892: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1170,
-};
-
-static const uint16_t ud_itab__893[] = {
+  /* 0893: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1171,
-};
-
-static const uint16_t ud_itab__894[] = {
+  /* 0894: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1172,
-};
-
-static const uint16_t ud_itab__895[] = {
+  /* 0895: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1173,
-};
-
-static const uint16_t ud_itab__896[] = {
+  /* 0896: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1174,
-};
-
-static const uint16_t ud_itab__897[] = {
+  /* 0897: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1175,
-};
-
-static const uint16_t ud_itab__898[] = {
+  /* 0898: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1176,
-};
-
-static const uint16_t ud_itab__899[] = {
+  /* 0899: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1177,
-};
-
-static const uint16_t ud_itab__900[] = {
+  /* 0900: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1178,
-};
-
-static const uint16_t ud_itab__901[] = {
+  /* 0901: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1179,
-};
-
-static const uint16_t ud_itab__902[] = {
+  /* 0902: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1180,
-};
-
-static const uint16_t ud_itab__903[] = {
+  /* 0903: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1181,
-};
-
-static const uint16_t ud_itab__904[] = {
+  /* 0904: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1182,
-};
-
-static const uint16_t ud_itab__905[] = {
+  /* 0905: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1183,
-};
-
-static const uint16_t ud_itab__906[] = {
+  /* 0906: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1184,
-};
-
-static const uint16_t ud_itab__907[] = {
+  /* 0907: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1185,
-};
-
-static const uint16_t ud_itab__908[] = {
+  /* 0908: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1186,
-};
-
-static const uint16_t ud_itab__909[] = {
+  /* 0909: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1187,
-};
-
-static const uint16_t ud_itab__910[] = {
+  /* 0910: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1188,
-};
-
-static const uint16_t ud_itab__911[] = {
+  /* 0911: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1189,
-};
-
-static const uint16_t ud_itab__912[] = {
+  /* 0912: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1190,
-};
-
-static const uint16_t ud_itab__913[] = {
+  /* 0913: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1191,
-};
-
-static const uint16_t ud_itab__914[] = {
+  /* 0914: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1192,
-};
-
-static const uint16_t ud_itab__915[] = {
+  /* 0915: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1193,
-};
-
-static const uint16_t ud_itab__916[] = {
+  /* 0916: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1194,
-};
-
-static const uint16_t ud_itab__917[] = {
+  /* 0917: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1195,
-};
-
-static const uint16_t ud_itab__918[] = {
+  /* 0918: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1196,
-};
-
-static const uint16_t ud_itab__919[] = {
+  /* 0919: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1197,
-};
-
-static const uint16_t ud_itab__920[] = {
+  /* 0920: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1198,
-};
-
-static const uint16_t ud_itab__921[] = {
+  /* 0921: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1199,
-};
-
-static const uint16_t ud_itab__922[] = {
+  /* 0922: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1200,
-};
-
-static const uint16_t ud_itab__923[] = {
+  /* 0923: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1201,
-};
-
-static const uint16_t ud_itab__924[] = {
+  /* 0924: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1202,
-};
-
-static const uint16_t ud_itab__925[] = {
+  /* 0925: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1203,
-};
-
-static const uint16_t ud_itab__926[] = {
+  /* 0926: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1204,
-};
-
-static const uint16_t ud_itab__927[] = {
+  /* 0927: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1205,
-};
-
-static const uint16_t ud_itab__928[] = {
+  /* 0928: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1206,
-};
-
-static const uint16_t ud_itab__929[] = {
+  /* 0929: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1207,
-};
-
-static const uint16_t ud_itab__930[] = {
+  /* 0930: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1208,
-};
-
-static const uint16_t ud_itab__931[] = {
+  /* 0931: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1209,
-};
-
-static const uint16_t ud_itab__932[] = {
+  /* 0932: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1210,
-};
-
-static const uint16_t ud_itab__933[] = {
+  /* 0933: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1211,
-};
-
-static const uint16_t ud_itab__934[] = {
+  /* 0934: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1212,
-};
-
-static const uint16_t ud_itab__935[] = {
+  /* 0935: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1213,
-};
-
-static const uint16_t ud_itab__936[] = {
+  /* 0936: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1214,
-};
-
-static const uint16_t ud_itab__937[] = {
+  /* 0937: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1215,
-};
-
-static const uint16_t ud_itab__938[] = {
+  /* 0938: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1216,
-};
-
-static const uint16_t ud_itab__939[] = {
+  /* 0939: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1217,
-};
-
-static const uint16_t ud_itab__875[] = {
-  /*  0 */  GROUP(876),  GROUP(877),  GROUP(878),  GROUP(879),
-  /*  4 */  GROUP(880),  GROUP(881),  GROUP(882),  GROUP(883),
-  /*  8 */  GROUP(884),  GROUP(885),  GROUP(886),  GROUP(887),
-  /*  c */  GROUP(888),  GROUP(889),  GROUP(890),  GROUP(891),
-  /* 10 */  GROUP(892),  GROUP(893),  GROUP(894),  GROUP(895),
-  /* 14 */  GROUP(896),  GROUP(897),  GROUP(898),  GROUP(899),
-  /* 18 */  GROUP(900),  GROUP(901),  GROUP(902),  GROUP(903),
-  /* 1c */  GROUP(904),  GROUP(905),  GROUP(906),  GROUP(907),
-  /* 20 */  GROUP(908),  GROUP(909),  GROUP(910),  GROUP(911),
-  /* 24 */  GROUP(912),  GROUP(913),  GROUP(914),  GROUP(915),
-  /* 28 */  GROUP(916),  GROUP(917),  GROUP(918),  GROUP(919),
-  /* 2c */  GROUP(920),  GROUP(921),  GROUP(922),  GROUP(923),
-  /* 30 */  GROUP(924),  GROUP(925),  GROUP(926),  GROUP(927),
-  /* 34 */  GROUP(928),  GROUP(929),  GROUP(930),  GROUP(931),
-  /* 38 */  GROUP(932),  GROUP(933),  GROUP(934),  GROUP(935),
-  /* 3c */  GROUP(936),  GROUP(937),  GROUP(938),  GROUP(939),
-};
-
-static const uint16_t ud_itab__865[] = {
-  /*  0 */  GROUP(866),  GROUP(875),
-};
-
-static const uint16_t ud_itab__942[] = {
+  /* 0940: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(941),  GROUP(949),
+  /* 0941: UD_TAB__OPC_REG, /reg */
+  /*  0 */  GROUP(942),  GROUP(943),  GROUP(944),  GROUP(945),
+  /*  4 */  GROUP(946),           0,  GROUP(947),  GROUP(948),
+  /* 0942: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1218,           0,
-};
-
-static const uint16_t ud_itab__943[] = {
+  /* 0943: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1219,           0,
-};
-
-static const uint16_t ud_itab__944[] = {
+  /* 0944: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1220,           0,
-};
-
-static const uint16_t ud_itab__945[] = {
+  /* 0945: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1221,           0,
-};
-
-static const uint16_t ud_itab__946[] = {
+  /* 0946: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1222,           0,
-};
-
-static const uint16_t ud_itab__947[] = {
+  /* 0947: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1223,           0,
-};
-
-static const uint16_t ud_itab__948[] = {
+  /* 0948: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1224,           0,
-};
-
-static const uint16_t ud_itab__941[] = {
-  /*  0 */  GROUP(942),  GROUP(943),  GROUP(944),  GROUP(945),
-  /*  4 */  GROUP(946),           0,  GROUP(947),  GROUP(948),
-};
-
-static const uint16_t ud_itab__950[] = {
+  /* 0949: UD_TAB__OPC_X87, /x87 */
+  /*  0 */  GROUP(950),  GROUP(951),  GROUP(952),  GROUP(953),
+  /*  4 */  GROUP(954),  GROUP(955),  GROUP(956),  GROUP(957),
+  /*  8 */  GROUP(958),  GROUP(959),  GROUP(960),  GROUP(961),
+  /*  c */  GROUP(962),  GROUP(963),  GROUP(964),  GROUP(965),
+  /* 10 */  GROUP(966),  GROUP(967),  GROUP(968),  GROUP(969),
+  /* 14 */  GROUP(970),  GROUP(971),  GROUP(972),  GROUP(973),
+  /* 18 */  GROUP(974),  GROUP(975),  GROUP(976),  GROUP(977),
+  /* 1c */  GROUP(978),  GROUP(979),  GROUP(980),  GROUP(981),
+  /* 20 */  GROUP(982),  GROUP(983),  GROUP(984),  GROUP(985),
+  /* 24 */  GROUP(986),  GROUP(987),  GROUP(988),  GROUP(989),
+  /* 28 */  GROUP(990),  GROUP(991),  GROUP(992),  GROUP(993),
+  /* 2c */  GROUP(994),  GROUP(995),  GROUP(996),  GROUP(997),
+  /* 30 */           0,           0,           0,           0,
+  /* 34 */           0,           0,           0,           0,
+  /* 38 */           0,           0,           0,           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 0950: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1225,
-};
-
-static const uint16_t ud_itab__951[] = {
+  /* 0951: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1226,
-};
-
-static const uint16_t ud_itab__952[] = {
+  /* 0952: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1227,
-};
-
-static const uint16_t ud_itab__953[] = {
+  /* 0953: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1228,
-};
-
-static const uint16_t ud_itab__954[] = {
+  /* 0954: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1229,
-};
-
-static const uint16_t ud_itab__955[] = {
+  /* 0955: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1230,
-};
-
-static const uint16_t ud_itab__956[] = {
+  /* 0956: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1231,
-};
-
-static const uint16_t ud_itab__957[] = {
+  /* 0957: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1232,
-};
-
-static const uint16_t ud_itab__958[] = {
+  /* 0958: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1233,
-};
-
-static const uint16_t ud_itab__959[] = {
+  /* 0959: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1234,
-};
-
-static const uint16_t ud_itab__960[] = {
+  /* 0960: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1235,
-};
-
-static const uint16_t ud_itab__961[] = {
+  /* 0961: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1236,
-};
-
-static const uint16_t ud_itab__962[] = {
+  /* 0962: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1237,
-};
-
-static const uint16_t ud_itab__963[] = {
+  /* 0963: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1238,
-};
-
-static const uint16_t ud_itab__964[] = {
+  /* 0964: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1239,
-};
-
-static const uint16_t ud_itab__965[] = {
+  /* 0965: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1240,
-};
-
-static const uint16_t ud_itab__966[] = {
+  /* 0966: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1241,
-};
-
-static const uint16_t ud_itab__967[] = {
+  /* 0967: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1242,
-};
-
-static const uint16_t ud_itab__968[] = {
+  /* 0968: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1243,
-};
-
-static const uint16_t ud_itab__969[] = {
+  /* 0969: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1244,
-};
-
-static const uint16_t ud_itab__970[] = {
+  /* 0970: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1245,
-};
-
-static const uint16_t ud_itab__971[] = {
+  /* 0971: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1246,
-};
-
-static const uint16_t ud_itab__972[] = {
+  /* 0972: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1247,
-};
-
-static const uint16_t ud_itab__973[] = {
+  /* 0973: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1248,
-};
-
-static const uint16_t ud_itab__974[] = {
+  /* 0974: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1249,
-};
-
-static const uint16_t ud_itab__975[] = {
+  /* 0975: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1250,
-};
-
-static const uint16_t ud_itab__976[] = {
-  /*  0 */           0,        1251,
-};
-
-static const uint16_t ud_itab__977[] = {
+  /* 0976: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1251,
+  /* 0977: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1252,
-};
-
-static const uint16_t ud_itab__978[] = {
+  /* 0978: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1253,
-};
-
-static const uint16_t ud_itab__979[] = {
+  /* 0979: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1254,
-};
-
-static const uint16_t ud_itab__980[] = {
+  /* 0980: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1255,
-};
-
-static const uint16_t ud_itab__981[] = {
+  /* 0981: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1256,
-};
-
-static const uint16_t ud_itab__982[] = {
+  /* 0982: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1257,
-};
-
-static const uint16_t ud_itab__983[] = {
+  /* 0983: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1258,
-};
-
-static const uint16_t ud_itab__984[] = {
+  /* 0984: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1259,
-};
-
-static const uint16_t ud_itab__985[] = {
+  /* 0985: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1260,
-};
-
-static const uint16_t ud_itab__986[] = {
+  /* 0986: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1261,
-};
-
-static const uint16_t ud_itab__987[] = {
+  /* 0987: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1262,
-};
-
-static const uint16_t ud_itab__988[] = {
+  /* 0988: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1263,
-};
-
-static const uint16_t ud_itab__989[] = {
+  /* 0989: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1264,
-};
-
-static const uint16_t ud_itab__990[] = {
+  /* 0990: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1265,
-};
-
-static const uint16_t ud_itab__991[] = {
+  /* 0991: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1266,
-};
-
-static const uint16_t ud_itab__992[] = {
+  /* 0992: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1267,
-};
-
-static const uint16_t ud_itab__993[] = {
+  /* 0993: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1268,
-};
-
-static const uint16_t ud_itab__994[] = {
+  /* 0994: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1269,
-};
-
-static const uint16_t ud_itab__995[] = {
+  /* 0995: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1270,
-};
-
-static const uint16_t ud_itab__996[] = {
+  /* 0996: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1271,
-};
-
-static const uint16_t ud_itab__997[] = {
+  /* 0997: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1272,
-};
-
-static const uint16_t ud_itab__949[] = {
-  /*  0 */  GROUP(950),  GROUP(951),  GROUP(952),  GROUP(953),
-  /*  4 */  GROUP(954),  GROUP(955),  GROUP(956),  GROUP(957),
-  /*  8 */  GROUP(958),  GROUP(959),  GROUP(960),  GROUP(961),
-  /*  c */  GROUP(962),  GROUP(963),  GROUP(964),  GROUP(965),
-  /* 10 */  GROUP(966),  GROUP(967),  GROUP(968),  GROUP(969),
-  /* 14 */  GROUP(970),  GROUP(971),  GROUP(972),  GROUP(973),
-  /* 18 */  GROUP(974),  GROUP(975),  GROUP(976),  GROUP(977),
-  /* 1c */  GROUP(978),  GROUP(979),  GROUP(980),  GROUP(981),
-  /* 20 */  GROUP(982),  GROUP(983),  GROUP(984),  GROUP(985),
-  /* 24 */  GROUP(986),  GROUP(987),  GROUP(988),  GROUP(989),
-  /* 28 */  GROUP(990),  GROUP(991),  GROUP(992),  GROUP(993),
-  /* 2c */  GROUP(994),  GROUP(995),  GROUP(996),  GROUP(997),
-  /* 30 */           0,           0,           0,           0,
-  /* 34 */           0,           0,           0,           0,
-  /* 38 */           0,           0,           0,           0,
-  /* 3c */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__940[] = {
-  /*  0 */  GROUP(941),  GROUP(949),
-};
-
-static const uint16_t ud_itab__1000[] = {
+  /* 0998: UD_TAB__OPC_MOD, /mod */
+  /*  0 */  GROUP(999), GROUP(1008),
+  /* 0999: UD_TAB__OPC_REG, /reg */
+  /*  0 */ GROUP(1000), GROUP(1001), GROUP(1002), GROUP(1003),
+  /*  4 */ GROUP(1004), GROUP(1005), GROUP(1006), GROUP(1007),
+  /* 1000: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1273,           0,
-};
-
-static const uint16_t ud_itab__1001[] = {
+  /* 1001: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1274,           0,
-};
-
-static const uint16_t ud_itab__1002[] = {
+  /* 1002: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1275,           0,
-};
-
-static const uint16_t ud_itab__1003[] = {
+  /* 1003: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1276,           0,
-};
-
-static const uint16_t ud_itab__1004[] = {
+  /* 1004: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1277,           0,
-};
-
-static const uint16_t ud_itab__1005[] = {
+  /* 1005: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1278,           0,
-};
-
-static const uint16_t ud_itab__1006[] = {
+  /* 1006: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1279,           0,
-};
-
-static const uint16_t ud_itab__1007[] = {
+  /* 1007: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1280,           0,
-};
-
-static const uint16_t ud_itab__999[] = {
-  /*  0 */ GROUP(1000), GROUP(1001), GROUP(1002), GROUP(1003),
-  /*  4 */ GROUP(1004), GROUP(1005), GROUP(1006), GROUP(1007),
-};
-
-static const uint16_t ud_itab__1009[] = {
+  /* 1008: UD_TAB__OPC_X87, /x87 */
+  /*  0 */ GROUP(1009), GROUP(1010), GROUP(1011), GROUP(1012),
+  /*  4 */ GROUP(1013), GROUP(1014), GROUP(1015), GROUP(1016),
+  /*  8 */ GROUP(1017), GROUP(1018), GROUP(1019), GROUP(1020),
+  /*  c */ GROUP(1021), GROUP(1022), GROUP(1023), GROUP(1024),
+  /* 10 */ GROUP(1025), GROUP(1026), GROUP(1027), GROUP(1028),
+  /* 14 */ GROUP(1029), GROUP(1030), GROUP(1031), GROUP(1032),
+  /* 18 */           0, GROUP(1033),           0,           0,
+  /* 1c */           0,           0,           0,           0,
+  /* 20 */ GROUP(1034), GROUP(1035), GROUP(1036), GROUP(1037),
+  /* 24 */ GROUP(1038), GROUP(1039), GROUP(1040), GROUP(1041),
+  /* 28 */ GROUP(1042), GROUP(1043), GROUP(1044), GROUP(1045),
+  /* 2c */ GROUP(1046), GROUP(1047), GROUP(1048), GROUP(1049),
+  /* 30 */ GROUP(1050), GROUP(1051), GROUP(1052), GROUP(1053),
+  /* 34 */ GROUP(1054), GROUP(1055), GROUP(1056), GROUP(1057),
+  /* 38 */ GROUP(1058), GROUP(1059), GROUP(1060), GROUP(1061),
+  /* 3c */ GROUP(1062), GROUP(1063), GROUP(1064), GROUP(1065),
+  /* 1009: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1281,
-};
-
-static const uint16_t ud_itab__1010[] = {
+  /* 1010: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1282,
-};
-
-static const uint16_t ud_itab__1011[] = {
+  /* 1011: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1283,
-};
-
-static const uint16_t ud_itab__1012[] = {
+  /* 1012: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1284,
-};
-
-static const uint16_t ud_itab__1013[] = {
+  /* 1013: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1285,
-};
-
-static const uint16_t ud_itab__1014[] = {
+  /* 1014: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1286,
-};
-
-static const uint16_t ud_itab__1015[] = {
+  /* 1015: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1287,
-};
-
-static const uint16_t ud_itab__1016[] = {
+  /* 1016: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1288,
-};
-
-static const uint16_t ud_itab__1017[] = {
+  /* 1017: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1289,
-};
-
-static const uint16_t ud_itab__1018[] = {
+  /* 1018: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1290,
-};
-
-static const uint16_t ud_itab__1019[] = {
+  /* 1019: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1291,
-};
-
-static const uint16_t ud_itab__1020[] = {
+  /* 1020: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1292,
-};
-
-static const uint16_t ud_itab__1021[] = {
+  /* 1021: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1293,
-};
-
-static const uint16_t ud_itab__1022[] = {
+  /* 1022: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1294,
-};
-
-static const uint16_t ud_itab__1023[] = {
+  /* 1023: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1295,
-};
-
-static const uint16_t ud_itab__1024[] = {
+  /* 1024: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1296,
-};
-
-static const uint16_t ud_itab__1025[] = {
+  /* 1025: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1297,
-};
-
-static const uint16_t ud_itab__1026[] = {
+  /* 1026: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1298,
-};
-
-static const uint16_t ud_itab__1027[] = {
+  /* 1027: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1299,
-};
-
-static const uint16_t ud_itab__1028[] = {
+  /* 1028: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1300,
-};
-
-static const uint16_t ud_itab__1029[] = {
+  /* 1029: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1301,
-};
-
-static const uint16_t ud_itab__1030[] = {
+  /* 1030: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1302,
-};
-
-static const uint16_t ud_itab__1031[] = {
+  /* 1031: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1303,
-};
-
-static const uint16_t ud_itab__1032[] = {
+  /* 1032: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1304,
-};
-
-static const uint16_t ud_itab__1033[] = {
+  /* 1033: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1305,
-};
-
-static const uint16_t ud_itab__1034[] = {
+  /* 1034: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1306,
-};
-
-static const uint16_t ud_itab__1035[] = {
+  /* 1035: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1307,
-};
-
-static const uint16_t ud_itab__1036[] = {
+  /* 1036: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1308,
-};
-
-static const uint16_t ud_itab__1037[] = {
+  /* 1037: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1309,
-};
-
-static const uint16_t ud_itab__1038[] = {
+  /* 1038: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1310,
-};
-
-static const uint16_t ud_itab__1039[] = {
+  /* 1039: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1311,
-};
-
-static const uint16_t ud_itab__1040[] = {
+  /* 1040: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1312,
-};
-
-static const uint16_t ud_itab__1041[] = {
+  /* 1041: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1313,
-};
-
-static const uint16_t ud_itab__1042[] = {
+  /* 1042: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1314,
-};
-
-static const uint16_t ud_itab__1043[] = {
+  /* 1043: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1315,
-};
-
-static const uint16_t ud_itab__1044[] = {
+  /* 1044: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1316,
-};
-
-static const uint16_t ud_itab__1045[] = {
+  /* 1045: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1317,
-};
-
-static const uint16_t ud_itab__1046[] = {
+  /* 1046: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1318,
-};
-
-static const uint16_t ud_itab__1047[] = {
+  /* 1047: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1319,
-};
-
-static const uint16_t ud_itab__1048[] = {
-  /*  0 */           0,        1320,
-};
-
-static const uint16_t ud_itab__1049[] = {
-  /*  0 */           0,        1321,
-};
-
-static const uint16_t ud_itab__1050[] = {
-  /*  0 */           0,        1322,
-};
-
-static const uint16_t ud_itab__1051[] = {
-  /*  0 */           0,        1323,
-};
-
-static const uint16_t ud_itab__1052[] = {
-  /*  0 */           0,        1324,
-};
-
-static const uint16_t ud_itab__1053[] = {
-  /*  0 */           0,        1325,
-};
-
-static const uint16_t ud_itab__1054[] = {
-  /*  0 */           0,        1326,
-};
-
-static const uint16_t ud_itab__1055[] = {
-  /*  0 */           0,        1327,
-};
-
-static const uint16_t ud_itab__1056[] = {
-  /*  0 */           0,        1328,
-};
-
-static const uint16_t ud_itab__1057[] = {
-  /*  0 */           0,        1329,
-};
-
-static const uint16_t ud_itab__1058[] = {
-  /*  0 */           0,        1330,
-};
-
-static const uint16_t ud_itab__1059[] = {
-  /*  0 */           0,        1331,
-};
-
-static const uint16_t ud_itab__1060[] = {
-  /*  0 */           0,        1332,
-};
-
-static const uint16_t ud_itab__1061[] = {
-  /*  0 */           0,        1333,
-};
-
-static const uint16_t ud_itab__1062[] = {
-  /*  0 */           0,        1334,
-};
-
-static const uint16_t ud_itab__1063[] = {
-  /*  0 */           0,        1335,
-};
-
-static const uint16_t ud_itab__1064[] = {
-  /*  0 */           0,        1336,
-};
-
-static const uint16_t ud_itab__1065[] = {
-  /*  0 */           0,        1337,
-};
-
-static const uint16_t ud_itab__1008[] = {
-  /*  0 */ GROUP(1009), GROUP(1010), GROUP(1011), GROUP(1012),
-  /*  4 */ GROUP(1013), GROUP(1014), GROUP(1015), GROUP(1016),
-  /*  8 */ GROUP(1017), GROUP(1018), GROUP(1019), GROUP(1020),
-  /*  c */ GROUP(1021), GROUP(1022), GROUP(1023), GROUP(1024),
-  /* 10 */ GROUP(1025), GROUP(1026), GROUP(1027), GROUP(1028),
-  /* 14 */ GROUP(1029), GROUP(1030), GROUP(1031), GROUP(1032),
-  /* 18 */           0, GROUP(1033),           0,           0,
-  /* 1c */           0,           0,           0,           0,
-  /* 20 */ GROUP(1034), GROUP(1035), GROUP(1036), GROUP(1037),
-  /* 24 */ GROUP(1038), GROUP(1039), GROUP(1040), GROUP(1041),
-  /* 28 */ GROUP(1042), GROUP(1043), GROUP(1044), GROUP(1045),
-  /* 2c */ GROUP(1046), GROUP(1047), GROUP(1048), GROUP(1049),
-  /* 30 */ GROUP(1050), GROUP(1051), GROUP(1052), GROUP(1053),
-  /* 34 */ GROUP(1054), GROUP(1055), GROUP(1056), GROUP(1057),
-  /* 38 */ GROUP(1058), GROUP(1059), GROUP(1060), GROUP(1061),
-  /* 3c */ GROUP(1062), GROUP(1063), GROUP(1064), GROUP(1065),
-};
-
-static const uint16_t ud_itab__998[] = {
-  /*  0 */  GROUP(999), GROUP(1008),
-};
-
-static const uint16_t ud_itab__1068[] = {
+  /* 1048: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1320,
+  /* 1049: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1321,
+  /* 1050: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1322,
+  /* 1051: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1323,
+  /* 1052: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1324,
+  /* 1053: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1325,
+  /* 1054: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1326,
+  /* 1055: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1327,
+  /* 1056: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1328,
+  /* 1057: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1329,
+  /* 1058: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1330,
+  /* 1059: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1331,
+  /* 1060: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1332,
+  /* 1061: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1333,
+  /* 1062: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1334,
+  /* 1063: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1335,
+  /* 1064: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1336,
+  /* 1065: UD_TAB__OPC_MOD, /mod */
+  /*  0 */           0,        1337,
+  /* 1066: UD_TAB__OPC_MOD, /mod */
+  /*  0 */ GROUP(1067), GROUP(1076),
+  /* 1067: UD_TAB__OPC_REG, /reg */
+  /*  0 */ GROUP(1068), GROUP(1069), GROUP(1070), GROUP(1071),
+  /*  4 */ GROUP(1072), GROUP(1073), GROUP(1074), GROUP(1075),
+  /* 1068: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1338,           0,
-};
-
-static const uint16_t ud_itab__1069[] = {
+  /* 1069: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1339,           0,
-};
-
-static const uint16_t ud_itab__1070[] = {
+  /* 1070: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1340,           0,
-};
-
-static const uint16_t ud_itab__1071[] = {
+  /* 1071: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1341,           0,
-};
-
-static const uint16_t ud_itab__1072[] = {
+  /* 1072: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1342,           0,
-};
-
-static const uint16_t ud_itab__1073[] = {
+  /* 1073: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1343,           0,
-};
-
-static const uint16_t ud_itab__1074[] = {
+  /* 1074: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1344,           0,
-};
-
-static const uint16_t ud_itab__1075[] = {
+  /* 1075: UD_TAB__OPC_MOD, /mod */
   /*  0 */        1345,           0,
-};
-
-static const uint16_t ud_itab__1067[] = {
-  /*  0 */ GROUP(1068), GROUP(1069), GROUP(1070), GROUP(1071),
-  /*  4 */ GROUP(1072), GROUP(1073), GROUP(1074), GROUP(1075),
-};
-
-static const uint16_t ud_itab__1077[] = {
+  /* 1076: UD_TAB__OPC_X87, /x87 */
+  /*  0 */ GROUP(1077), GROUP(1078), GROUP(1079), GROUP(1080),
+  /*  4 */ GROUP(1081), GROUP(1082), GROUP(1083), GROUP(1084),
+  /*  8 */ GROUP(1085), GROUP(1086), GROUP(1087), GROUP(1088),
+  /*  c */ GROUP(1089), GROUP(1090), GROUP(1091), GROUP(1092),
+  /* 10 */ GROUP(1093), GROUP(1094), GROUP(1095), GROUP(1096),
+  /* 14 */ GROUP(1097), GROUP(1098), GROUP(1099), GROUP(1100),
+  /* 18 */ GROUP(1101), GROUP(1102), GROUP(1103), GROUP(1104),
+  /* 1c */ GROUP(1105), GROUP(1106), GROUP(1107), GROUP(1108),
+  /* 20 */ GROUP(1109),           0,           0,           0,
+  /* 24 */           0,           0,           0,           0,
+  /* 28 */ GROUP(1110), GROUP(1111), GROUP(1112), GROUP(1113),
+  /* 2c */ GROUP(1114), GROUP(1115), GROUP(1116), GROUP(1117),
+  /* 30 */ GROUP(1118), GROUP(1119), GROUP(1120), GROUP(1121),
+  /* 34 */ GROUP(1122), GROUP(1123), GROUP(1124), GROUP(1125),
+  /* 38 */           0,           0,           0,           0,
+  /* 3c */           0,           0,           0,           0,
+  /* 1077: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1346,
-};
-
-static const uint16_t ud_itab__1078[] = {
+  /* 1078: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1347,
-};
-
-static const uint16_t ud_itab__1079[] = {
+  /* 1079: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1348,
-};
-
-static const uint16_t ud_itab__1080[] = {
+  /* 1080: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1349,
-};
-
-static const uint16_t ud_itab__1081[] = {
+  /* 1081: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1350,
-};
-
-static const uint16_t ud_itab__1082[] = {
+  /* 1082: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1351,
-};
-
-static const uint16_t ud_itab__1083[] = {
+  /* 1083: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1352,
-};
-
-static const uint16_t ud_itab__1084[] = {
+  /* 1084: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1353,
-};
-
-static const uint16_t ud_itab__1085[] = {
+  /* 1085: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1354,
-};
-
-static const uint16_t ud_itab__1086[] = {
+  /* 1086: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1355,
-};
-
-static const uint16_t ud_itab__1087[] = {
+  /* 1087: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1356,
-};
-
-static const uint16_t ud_itab__1088[] = {
+  /* 1088: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1357,
-};
-
-static const uint16_t ud_itab__1089[] = {
+  /* 1089: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1358,
-};
-
-static const uint16_t ud_itab__1090[] = {
+  /* 1090: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1359,
-};
-
-static const uint16_t ud_itab__1091[] = {
+  /* 1091: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1360,
-};
-
-static const uint16_t ud_itab__1092[] = {
+  /* 1092: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1361,
-};
-
-static const uint16_t ud_itab__1093[] = {
+  /* 1093: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1362,
-};
-
-static const uint16_t ud_itab__1094[] = {
+  /* 1094: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1363,
-};
-
-static const uint16_t ud_itab__1095[] = {
+  /* 1095: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1364,
-};
-
-static const uint16_t ud_itab__1096[] = {
+  /* 1096: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1365,
-};
-
-static const uint16_t ud_itab__1097[] = {
+  /* 1097: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1366,
-};
-
-static const uint16_t ud_itab__1098[] = {
+  /* 1098: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1367,
-};
-
-static const uint16_t ud_itab__1099[] = {
+  /* 1099: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1368,
-};
-
-static const uint16_t ud_itab__1100[] = {
+  /* 1100: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1369,
-};
-
-static const uint16_t ud_itab__1101[] = {
+  /* 1101: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1370,
-};
-
-static const uint16_t ud_itab__1102[] = {
+  /* 1102: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1371,
-};
-
-static const uint16_t ud_itab__1103[] = {
+  /* 1103: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1372,
-};
-
-static const uint16_t ud_itab__1104[] = {
+  /* 1104: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1373,
-};
-
-static const uint16_t ud_itab__1105[] = {
+  /* 1105: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1374,
-};
-
-static const uint16_t ud_itab__1106[] = {
+  /* 1106: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1375,
-};
-
-static const uint16_t ud_itab__1107[] = {
+  /* 1107: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1376,
-};
-
-static const uint16_t ud_itab__1108[] = {
+  /* 1108: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1377,
-};
-
-static const uint16_t ud_itab__1109[] = {
+  /* 1109: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1378,
-};
-
-static const uint16_t ud_itab__1110[] = {
+  /* 1110: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1379,
-};
-
-static const uint16_t ud_itab__1111[] = {
+  /* 1111: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1380,
-};
-
-static const uint16_t ud_itab__1112[] = {
+  /* 1112: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1381,
-};
-
-static const uint16_t ud_itab__1113[] = {
+  /* 1113: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1382,
-};
-
-static const uint16_t ud_itab__1114[] = {
+  /* 1114: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1383,
-};
-
-static const uint16_t ud_itab__1115[] = {
+  /* 1115: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1384,
-};
-
-static const uint16_t ud_itab__1116[] = {
+  /* 1116: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1385,
-};
-
-static const uint16_t ud_itab__1117[] = {
+  /* 1117: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1386,
-};
-
-static const uint16_t ud_itab__1118[] = {
+  /* 1118: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1387,
-};
-
-static const uint16_t ud_itab__1119[] = {
+  /* 1119: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1388,
-};
-
-static const uint16_t ud_itab__1120[] = {
+  /* 1120: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1389,
-};
-
-static const uint16_t ud_itab__1121[] = {
+  /* 1121: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1390,
-};
-
-static const uint16_t ud_itab__1122[] = {
+  /* 1122: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1391,
-};
-
-static const uint16_t ud_itab__1123[] = {
+  /* 1123: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1392,
-};
-
-static const uint16_t ud_itab__1124[] = {
+  /* 1124: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1393,
-};
-
-static const uint16_t ud_itab__1125[] = {
+  /* 1125: UD_TAB__OPC_MOD, /mod */
   /*  0 */           0,        1394,
-};
-
-static const uint16_t ud_itab__1076[] = {
-  /*  0 */ GROUP(1077), GROUP(1078), GROUP(1079), GROUP(1080),
-  /*  4 */ GROUP(1081), GROUP(1082), GROUP(1083), GROUP(1084),
-  /*  8 */ GROUP(1085), GROUP(1086), GROUP(1087), GROUP(1088),
-  /*  c */ GROUP(1089), GROUP(1090), GROUP(1091), GROUP(1092),
-  /* 10 */ GROUP(1093), GROUP(1094), GROUP(1095), GROUP(1096),
-  /* 14 */ GROUP(1097), GROUP(1098), GROUP(1099), GROUP(1100),
-  /* 18 */ GROUP(1101), GROUP(1102), GROUP(1103), GROUP(1104),
-  /* 1c */ GROUP(1105), GROUP(1106), GROUP(1107), GROUP(1108),
-  /* 20 */ GROUP(1109),           0,           0,           0,
-  /* 24 */           0,           0,           0,           0,
-  /* 28 */ GROUP(1110), GROUP(1111), GROUP(1112), GROUP(1113),
-  /* 2c */ GROUP(1114), GROUP(1115), GROUP(1116), GROUP(1117),
-  /* 30 */ GROUP(1118), GROUP(1119), GROUP(1120), GROUP(1121),
-  /* 34 */ GROUP(1122), GROUP(1123), GROUP(1124), GROUP(1125),
-  /* 38 */           0,           0,           0,           0,
-  /* 3c */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__1066[] = {
-  /*  0 */ GROUP(1067), GROUP(1076),
-};
-
-static const uint16_t ud_itab__1126[] = {
+  /* 1126: UD_TAB__OPC_ASIZE, /a */
   /*  0 */        1398,        1399,        1400,
-};
-
-static const uint16_t ud_itab__1127[] = {
+  /* 1127: UD_TAB__OPC_MODE, /m */
   /*  0 */        1407,           0,
-};
-
-static const uint16_t ud_itab__1128[] = {
+  /* 1128: UD_TAB__OPC_REG, /reg */
   /*  0 */        1419,        1420,        1421,        1422,
   /*  4 */        1423,        1424,        1425,        1426,
-};
-
-static const uint16_t ud_itab__1129[] = {
+  /* 1129: UD_TAB__OPC_REG, /reg */
   /*  0 */        1427,        1428,        1429,        1430,
   /*  4 */        1431,        1432,        1433,        1434,
-};
-
-static const uint16_t ud_itab__1130[] = {
+  /* 1130: UD_TAB__OPC_REG, /reg */
   /*  0 */        1441,        1442,           0,           0,
   /*  4 */           0,           0,           0,           0,
-};
-
-static const uint16_t ud_itab__1132[] = {
-  /*  0 */        1445,        1446,
-};
-
-static const uint16_t ud_itab__1131[] = {
+  /* 1131: UD_TAB__OPC_REG, /reg */
   /*  0 */        1443,        1444, GROUP(1132),        1447,
   /*  4 */        1448,        1449,        1450,           0,
-};
-
-const uint16_t ud_itab__0[] = {
-  /*  0 */           1,           2,           3,           4,
-  /*  4 */           5,           6,    GROUP(1),    GROUP(2),
-  /*  8 */           9,          10,          11,          12,
-  /*  c */          13,          14,    GROUP(3),    GROUP(4),
-  /* 10 */         628,         629,         630,         631,
-  /* 14 */         632,         633,  GROUP(563),  GROUP(564),
-  /* 18 */         636,         637,         638,         639,
-  /* 1c */         640,         641,  GROUP(565),  GROUP(566),
-  /* 20 */         644,         645,         646,         647,
-  /* 24 */         648,         649,           0,  GROUP(567),
-  /* 28 */         651,         652,         653,         654,
-  /* 2c */         655,         656,           0,  GROUP(568),
-  /* 30 */         658,         659,         660,         661,
-  /* 34 */         662,         663,           0,  GROUP(569),
-  /* 38 */         665,         666,         667,         668,
-  /* 3c */         669,         670,           0,  GROUP(570),
-  /* 40 */         672,         673,         674,         675,
-  /* 44 */         676,         677,         678,         679,
-  /* 48 */         680,         681,         682,         683,
-  /* 4c */         684,         685,         686,         687,
-  /* 50 */         688,         689,         690,         691,
-  /* 54 */         692,         693,         694,         695,
-  /* 58 */         696,         697,         698,         699,
-  /* 5c */         700,         701,         702,         703,
-  /* 60 */  GROUP(571),  GROUP(574),  GROUP(577),  GROUP(578),
-  /* 64 */           0,           0,           0,           0,
-  /* 68 */         711,         712,         713,         714,
-  /* 6c */         715,  GROUP(579),         718,  GROUP(580),
-  /* 70 */         721,         722,         723,         724,
-  /* 74 */         725,         726,         727,         728,
-  /* 78 */         729,         730,         731,         732,
-  /* 7c */         733,         734,         735,         736,
-  /* 80 */  GROUP(581),  GROUP(582),  GROUP(583),  GROUP(592),
-  /* 84 */         769,         770,         771,         772,
-  /* 88 */         773,         774,         775,         776,
-  /* 8c */         777,         778,         779,  GROUP(593),
-  /* 90 */         781,         782,         783,         784,
-  /* 94 */         785,         786,         787,         788,
-  /* 98 */  GROUP(594),  GROUP(595),  GROUP(596),         796,
-  /* 9c */  GROUP(597),  GROUP(601),         806,         807,
-  /* a0 */         808,         809,         810,         811,
-  /* a4 */         812,  GROUP(605),         816,  GROUP(606),
-  /* a8 */         820,         821,         822,  GROUP(607),
-  /* ac */         826,  GROUP(608),         830,  GROUP(609),
-  /* b0 */         834,         835,         836,         837,
-  /* b4 */         838,         839,         840,         841,
-  /* b8 */         842,         843,         844,         845,
-  /* bc */         846,         847,         848,         849,
-  /* c0 */  GROUP(610),  GROUP(611),         866,         867,
-  /* c4 */  GROUP(612),  GROUP(613),  GROUP(614),  GROUP(615),
-  /* c8 */         872,         873,         874,         875,
-  /* cc */         876,         877,  GROUP(616),  GROUP(617),
-  /* d0 */  GROUP(618),  GROUP(619),  GROUP(620),  GROUP(621),
-  /* d4 */  GROUP(622),  GROUP(623),  GROUP(624),         917,
-  /* d8 */  GROUP(625),  GROUP(700),  GROUP(762),  GROUP(806),
-  /* dc */  GROUP(865),  GROUP(940),  GROUP(998), GROUP(1066),
-  /* e0 */        1395,        1396,        1397, GROUP(1126),
-  /* e4 */        1401,        1402,        1403,        1404,
-  /* e8 */        1405,        1406, GROUP(1127),        1408,
-  /* ec */        1409,        1410,        1411,        1412,
-  /* f0 */        1413,        1414,        1415,        1416,
-  /* f4 */        1417,        1418, GROUP(1128), GROUP(1129),
-  /* f8 */        1435,        1436,        1437,        1438,
-  /* fc */        1439,        1440, GROUP(1130), GROUP(1131),
+  /* 1132: UD_TAB__OPC_MODE, /m */
+  /*  0 */        1445,        1446,
 };
 
 
-struct ud_lookup_table_list_entry ud_lookup_table_list[] = {
-    /* 000 */ { ud_itab__0, UD_TAB__OPC_TABLE, "table0" },
-    /* 001 */ { ud_itab__1, UD_TAB__OPC_MODE, "/m" },
-    /* 002 */ { ud_itab__2, UD_TAB__OPC_MODE, "/m" },
-    /* 003 */ { ud_itab__3, UD_TAB__OPC_MODE, "/m" },
-    /* 004 */ { ud_itab__4, UD_TAB__OPC_TABLE, "0f" },
-    /* 005 */ { ud_itab__5, UD_TAB__OPC_REG, "/reg" },
-    /* 006 */ { ud_itab__6, UD_TAB__OPC_SSE, "/sse" },
-    /* 007 */ { ud_itab__7, UD_TAB__OPC_SSE, "/sse" },
-    /* 008 */ { ud_itab__8, UD_TAB__OPC_SSE, "/sse" },
-    /* 009 */ { ud_itab__9, UD_TAB__OPC_SSE, "/sse" },
-    /* 010 */ { ud_itab__10, UD_TAB__OPC_SSE, "/sse" },
-    /* 011 */ { ud_itab__11, UD_TAB__OPC_SSE, "/sse" },
-    /* 012 */ { ud_itab__12, UD_TAB__OPC_MOD, "/mod" },
-    /* 013 */ { ud_itab__13, UD_TAB__OPC_REG, "/reg" },
-    /* 014 */ { ud_itab__14, UD_TAB__OPC_SSE, "/sse" },
-    /* 015 */ { ud_itab__15, UD_TAB__OPC_MOD, "/mod" },
-    /* 016 */ { ud_itab__16, UD_TAB__OPC_SSE, "/sse" },
-    /* 017 */ { ud_itab__17, UD_TAB__OPC_MOD, "/mod" },
-    /* 018 */ { ud_itab__18, UD_TAB__OPC_SSE, "/sse" },
-    /* 019 */ { ud_itab__19, UD_TAB__OPC_MOD, "/mod" },
-    /* 020 */ { ud_itab__20, UD_TAB__OPC_SSE, "/sse" },
-    /* 021 */ { ud_itab__21, UD_TAB__OPC_MOD, "/mod" },
-    /* 022 */ { ud_itab__22, UD_TAB__OPC_SSE, "/sse" },
-    /* 023 */ { ud_itab__23, UD_TAB__OPC_MOD, "/mod" },
-    /* 024 */ { ud_itab__24, UD_TAB__OPC_SSE, "/sse" },
-    /* 025 */ { ud_itab__25, UD_TAB__OPC_MOD, "/mod" },
-    /* 026 */ { ud_itab__26, UD_TAB__OPC_SSE, "/sse" },
-    /* 027 */ { ud_itab__27, UD_TAB__OPC_MOD, "/mod" },
-    /* 028 */ { ud_itab__28, UD_TAB__OPC_REG, "/reg" },
-    /* 029 */ { ud_itab__29, UD_TAB__OPC_RM, "/rm" },
-    /* 030 */ { ud_itab__30, UD_TAB__OPC_SSE, "/sse" },
-    /* 031 */ { ud_itab__31, UD_TAB__OPC_MOD, "/mod" },
-    /* 032 */ { ud_itab__32, UD_TAB__OPC_VENDOR, "intel" },
-    /* 033 */ { ud_itab__33, UD_TAB__OPC_SSE, "/sse" },
-    /* 034 */ { ud_itab__34, UD_TAB__OPC_MOD, "/mod" },
-    /* 035 */ { ud_itab__35, UD_TAB__OPC_VENDOR, "intel" },
-    /* 036 */ { ud_itab__36, UD_TAB__OPC_SSE, "/sse" },
-    /* 037 */ { ud_itab__37, UD_TAB__OPC_MOD, "/mod" },
-    /* 038 */ { ud_itab__38, UD_TAB__OPC_VENDOR, "intel" },
-    /* 039 */ { ud_itab__39, UD_TAB__OPC_SSE, "/sse" },
-    /* 040 */ { ud_itab__40, UD_TAB__OPC_MOD, "/mod" },
-    /* 041 */ { ud_itab__41, UD_TAB__OPC_VENDOR, "intel" },
-    /* 042 */ { ud_itab__42, UD_TAB__OPC_RM, "/rm" },
-    /* 043 */ { ud_itab__43, UD_TAB__OPC_SSE, "/sse" },
-    /* 044 */ { ud_itab__44, UD_TAB__OPC_MOD, "/mod" },
-    /* 045 */ { ud_itab__45, UD_TAB__OPC_SSE, "/sse" },
-    /* 046 */ { ud_itab__46, UD_TAB__OPC_MOD, "/mod" },
-    /* 047 */ { ud_itab__47, UD_TAB__OPC_RM, "/rm" },
-    /* 048 */ { ud_itab__48, UD_TAB__OPC_SSE, "/sse" },
-    /* 049 */ { ud_itab__49, UD_TAB__OPC_MOD, "/mod" },
-    /* 050 */ { ud_itab__50, UD_TAB__OPC_SSE, "/sse" },
-    /* 051 */ { ud_itab__51, UD_TAB__OPC_MOD, "/mod" },
-    /* 052 */ { ud_itab__52, UD_TAB__OPC_RM, "/rm" },
-    /* 053 */ { ud_itab__53, UD_TAB__OPC_SSE, "/sse" },
-    /* 054 */ { ud_itab__54, UD_TAB__OPC_MOD, "/mod" },
-    /* 055 */ { ud_itab__55, UD_TAB__OPC_VENDOR, "amd" },
-    /* 056 */ { ud_itab__56, UD_TAB__OPC_SSE, "/sse" },
-    /* 057 */ { ud_itab__57, UD_TAB__OPC_MOD, "/mod" },
-    /* 058 */ { ud_itab__58, UD_TAB__OPC_VENDOR, "amd" },
-    /* 059 */ { ud_itab__59, UD_TAB__OPC_SSE, "/sse" },
-    /* 060 */ { ud_itab__60, UD_TAB__OPC_MOD, "/mod" },
-    /* 061 */ { ud_itab__61, UD_TAB__OPC_VENDOR, "amd" },
-    /* 062 */ { ud_itab__62, UD_TAB__OPC_SSE, "/sse" },
-    /* 063 */ { ud_itab__63, UD_TAB__OPC_MOD, "/mod" },
-    /* 064 */ { ud_itab__64, UD_TAB__OPC_VENDOR, "amd" },
-    /* 065 */ { ud_itab__65, UD_TAB__OPC_SSE, "/sse" },
-    /* 066 */ { ud_itab__66, UD_TAB__OPC_MOD, "/mod" },
-    /* 067 */ { ud_itab__67, UD_TAB__OPC_VENDOR, "amd" },
-    /* 068 */ { ud_itab__68, UD_TAB__OPC_SSE, "/sse" },
-    /* 069 */ { ud_itab__69, UD_TAB__OPC_MOD, "/mod" },
-    /* 070 */ { ud_itab__70, UD_TAB__OPC_VENDOR, "amd" },
-    /* 071 */ { ud_itab__71, UD_TAB__OPC_SSE, "/sse" },
-    /* 072 */ { ud_itab__72, UD_TAB__OPC_MOD, "/mod" },
-    /* 073 */ { ud_itab__73, UD_TAB__OPC_VENDOR, "amd" },
-    /* 074 */ { ud_itab__74, UD_TAB__OPC_SSE, "/sse" },
-    /* 075 */ { ud_itab__75, UD_TAB__OPC_MOD, "/mod" },
-    /* 076 */ { ud_itab__76, UD_TAB__OPC_VENDOR, "amd" },
-    /* 077 */ { ud_itab__77, UD_TAB__OPC_SSE, "/sse" },
-    /* 078 */ { ud_itab__78, UD_TAB__OPC_MOD, "/mod" },
-    /* 079 */ { ud_itab__79, UD_TAB__OPC_SSE, "/sse" },
-    /* 080 */ { ud_itab__80, UD_TAB__OPC_MOD, "/mod" },
-    /* 081 */ { ud_itab__81, UD_TAB__OPC_RM, "/rm" },
-    /* 082 */ { ud_itab__82, UD_TAB__OPC_SSE, "/sse" },
-    /* 083 */ { ud_itab__83, UD_TAB__OPC_MOD, "/mod" },
-    /* 084 */ { ud_itab__84, UD_TAB__OPC_SSE, "/sse" },
-    /* 085 */ { ud_itab__85, UD_TAB__OPC_MOD, "/mod" },
-    /* 086 */ { ud_itab__86, UD_TAB__OPC_VENDOR, "amd" },
-    /* 087 */ { ud_itab__87, UD_TAB__OPC_SSE, "/sse" },
-    /* 088 */ { ud_itab__88, UD_TAB__OPC_SSE, "/sse" },
-    /* 089 */ { ud_itab__89, UD_TAB__OPC_SSE, "/sse" },
-    /* 090 */ { ud_itab__90, UD_TAB__OPC_SSE, "/sse" },
-    /* 091 */ { ud_itab__91, UD_TAB__OPC_SSE, "/sse" },
-    /* 092 */ { ud_itab__92, UD_TAB__OPC_SSE, "/sse" },
-    /* 093 */ { ud_itab__93, UD_TAB__OPC_SSE, "/sse" },
-    /* 094 */ { ud_itab__94, UD_TAB__OPC_SSE, "/sse" },
-    /* 095 */ { ud_itab__95, UD_TAB__OPC_REG, "/reg" },
-    /* 096 */ { ud_itab__96, UD_TAB__OPC_SSE, "/sse" },
-    /* 097 */ { ud_itab__97, UD_TAB__OPC_SSE, "/sse" },
-    /* 098 */ { ud_itab__98, UD_TAB__OPC_SSE, "/sse" },
-    /* 099 */ { ud_itab__99, UD_TAB__OPC_SSE, "/sse" },
-    /* 100 */ { ud_itab__100, UD_TAB__OPC_SSE, "/sse" },
-    /* 101 */ { ud_itab__101, UD_TAB__OPC_SSE, "/sse" },
-    /* 102 */ { ud_itab__102, UD_TAB__OPC_SSE, "/sse" },
-    /* 103 */ { ud_itab__103, UD_TAB__OPC_SSE, "/sse" },
-    /* 104 */ { ud_itab__104, UD_TAB__OPC_SSE, "/sse" },
-    /* 105 */ { ud_itab__105, UD_TAB__OPC_3DNOW, "/3dnow" },
-    /* 106 */ { ud_itab__106, UD_TAB__OPC_SSE, "/sse" },
-    /* 107 */ { ud_itab__107, UD_TAB__OPC_SSE, "/sse" },
-    /* 108 */ { ud_itab__108, UD_TAB__OPC_MOD, "/mod" },
-    /* 109 */ { ud_itab__109, UD_TAB__OPC_SSE, "/sse" },
-    /* 110 */ { ud_itab__110, UD_TAB__OPC_MOD, "/mod" },
-    /* 111 */ { ud_itab__111, UD_TAB__OPC_MOD, "/mod" },
-    /* 112 */ { ud_itab__112, UD_TAB__OPC_MOD, "/mod" },
-    /* 113 */ { ud_itab__113, UD_TAB__OPC_MOD, "/mod" },
-    /* 114 */ { ud_itab__114, UD_TAB__OPC_SSE, "/sse" },
-    /* 115 */ { ud_itab__115, UD_TAB__OPC_MOD, "/mod" },
-    /* 116 */ { ud_itab__116, UD_TAB__OPC_MOD, "/mod" },
-    /* 117 */ { ud_itab__117, UD_TAB__OPC_MOD, "/mod" },
-    /* 118 */ { ud_itab__118, UD_TAB__OPC_SSE, "/sse" },
-    /* 119 */ { ud_itab__119, UD_TAB__OPC_SSE, "/sse" },
-    /* 120 */ { ud_itab__120, UD_TAB__OPC_SSE, "/sse" },
-    /* 121 */ { ud_itab__121, UD_TAB__OPC_MOD, "/mod" },
-    /* 122 */ { ud_itab__122, UD_TAB__OPC_SSE, "/sse" },
-    /* 123 */ { ud_itab__123, UD_TAB__OPC_MOD, "/mod" },
-    /* 124 */ { ud_itab__124, UD_TAB__OPC_MOD, "/mod" },
-    /* 125 */ { ud_itab__125, UD_TAB__OPC_MOD, "/mod" },
-    /* 126 */ { ud_itab__126, UD_TAB__OPC_SSE, "/sse" },
-    /* 127 */ { ud_itab__127, UD_TAB__OPC_MOD, "/mod" },
-    /* 128 */ { ud_itab__128, UD_TAB__OPC_MOD, "/mod" },
-    /* 129 */ { ud_itab__129, UD_TAB__OPC_SSE, "/sse" },
-    /* 130 */ { ud_itab__130, UD_TAB__OPC_REG, "/reg" },
-    /* 131 */ { ud_itab__131, UD_TAB__OPC_SSE, "/sse" },
-    /* 132 */ { ud_itab__132, UD_TAB__OPC_SSE, "/sse" },
-    /* 133 */ { ud_itab__133, UD_TAB__OPC_SSE, "/sse" },
-    /* 134 */ { ud_itab__134, UD_TAB__OPC_SSE, "/sse" },
-    /* 135 */ { ud_itab__135, UD_TAB__OPC_SSE, "/sse" },
-    /* 136 */ { ud_itab__136, UD_TAB__OPC_SSE, "/sse" },
-    /* 137 */ { ud_itab__137, UD_TAB__OPC_SSE, "/sse" },
-    /* 138 */ { ud_itab__138, UD_TAB__OPC_SSE, "/sse" },
-    /* 139 */ { ud_itab__139, UD_TAB__OPC_SSE, "/sse" },
-    /* 140 */ { ud_itab__140, UD_TAB__OPC_SSE, "/sse" },
-    /* 141 */ { ud_itab__141, UD_TAB__OPC_SSE, "/sse" },
-    /* 142 */ { ud_itab__142, UD_TAB__OPC_SSE, "/sse" },
-    /* 143 */ { ud_itab__143, UD_TAB__OPC_SSE, "/sse" },
-    /* 144 */ { ud_itab__144, UD_TAB__OPC_SSE, "/sse" },
-    /* 145 */ { ud_itab__145, UD_TAB__OPC_SSE, "/sse" },
-    /* 146 */ { ud_itab__146, UD_TAB__OPC_SSE, "/sse" },
-    /* 147 */ { ud_itab__147, UD_TAB__OPC_SSE, "/sse" },
-    /* 148 */ { ud_itab__148, UD_TAB__OPC_SSE, "/sse" },
-    /* 149 */ { ud_itab__149, UD_TAB__OPC_SSE, "/sse" },
-    /* 150 */ { ud_itab__150, UD_TAB__OPC_SSE, "/sse" },
-    /* 151 */ { ud_itab__151, UD_TAB__OPC_SSE, "/sse" },
-    /* 152 */ { ud_itab__152, UD_TAB__OPC_SSE, "/sse" },
-    /* 153 */ { ud_itab__153, UD_TAB__OPC_SSE, "/sse" },
-    /* 154 */ { ud_itab__154, UD_TAB__OPC_SSE, "/sse" },
-    /* 155 */ { ud_itab__155, UD_TAB__OPC_SSE, "/sse" },
-    /* 156 */ { ud_itab__156, UD_TAB__OPC_SSE, "/sse" },
-    /* 157 */ { ud_itab__157, UD_TAB__OPC_SSE, "/sse" },
-    /* 158 */ { ud_itab__158, UD_TAB__OPC_SSE, "/sse" },
-    /* 159 */ { ud_itab__159, UD_TAB__OPC_MODE, "/m" },
-    /* 160 */ { ud_itab__160, UD_TAB__OPC_VENDOR, "intel" },
-    /* 161 */ { ud_itab__161, UD_TAB__OPC_SSE, "/sse" },
-    /* 162 */ { ud_itab__162, UD_TAB__OPC_MODE, "/m" },
-    /* 163 */ { ud_itab__163, UD_TAB__OPC_VENDOR, "intel" },
-    /* 164 */ { ud_itab__164, UD_TAB__OPC_SSE, "/sse" },
-    /* 165 */ { ud_itab__165, UD_TAB__OPC_TABLE, "38" },
-    /* 166 */ { ud_itab__166, UD_TAB__OPC_SSE, "/sse" },
-    /* 167 */ { ud_itab__167, UD_TAB__OPC_SSE, "/sse" },
-    /* 168 */ { ud_itab__168, UD_TAB__OPC_SSE, "/sse" },
-    /* 169 */ { ud_itab__169, UD_TAB__OPC_SSE, "/sse" },
-    /* 170 */ { ud_itab__170, UD_TAB__OPC_SSE, "/sse" },
-    /* 171 */ { ud_itab__171, UD_TAB__OPC_SSE, "/sse" },
-    /* 172 */ { ud_itab__172, UD_TAB__OPC_SSE, "/sse" },
-    /* 173 */ { ud_itab__173, UD_TAB__OPC_SSE, "/sse" },
-    /* 174 */ { ud_itab__174, UD_TAB__OPC_SSE, "/sse" },
-    /* 175 */ { ud_itab__175, UD_TAB__OPC_SSE, "/sse" },
-    /* 176 */ { ud_itab__176, UD_TAB__OPC_SSE, "/sse" },
-    /* 177 */ { ud_itab__177, UD_TAB__OPC_SSE, "/sse" },
-    /* 178 */ { ud_itab__178, UD_TAB__OPC_SSE, "/sse" },
-    /* 179 */ { ud_itab__179, UD_TAB__OPC_SSE, "/sse" },
-    /* 180 */ { ud_itab__180, UD_TAB__OPC_SSE, "/sse" },
-    /* 181 */ { ud_itab__181, UD_TAB__OPC_SSE, "/sse" },
-    /* 182 */ { ud_itab__182, UD_TAB__OPC_SSE, "/sse" },
-    /* 183 */ { ud_itab__183, UD_TAB__OPC_SSE, "/sse" },
-    /* 184 */ { ud_itab__184, UD_TAB__OPC_SSE, "/sse" },
-    /* 185 */ { ud_itab__185, UD_TAB__OPC_SSE, "/sse" },
-    /* 186 */ { ud_itab__186, UD_TAB__OPC_SSE, "/sse" },
-    /* 187 */ { ud_itab__187, UD_TAB__OPC_SSE, "/sse" },
-    /* 188 */ { ud_itab__188, UD_TAB__OPC_SSE, "/sse" },
-    /* 189 */ { ud_itab__189, UD_TAB__OPC_SSE, "/sse" },
-    /* 190 */ { ud_itab__190, UD_TAB__OPC_SSE, "/sse" },
-    /* 191 */ { ud_itab__191, UD_TAB__OPC_SSE, "/sse" },
-    /* 192 */ { ud_itab__192, UD_TAB__OPC_SSE, "/sse" },
-    /* 193 */ { ud_itab__193, UD_TAB__OPC_SSE, "/sse" },
-    /* 194 */ { ud_itab__194, UD_TAB__OPC_SSE, "/sse" },
-    /* 195 */ { ud_itab__195, UD_TAB__OPC_SSE, "/sse" },
-    /* 196 */ { ud_itab__196, UD_TAB__OPC_SSE, "/sse" },
-    /* 197 */ { ud_itab__197, UD_TAB__OPC_SSE, "/sse" },
-    /* 198 */ { ud_itab__198, UD_TAB__OPC_SSE, "/sse" },
-    /* 199 */ { ud_itab__199, UD_TAB__OPC_SSE, "/sse" },
-    /* 200 */ { ud_itab__200, UD_TAB__OPC_SSE, "/sse" },
-    /* 201 */ { ud_itab__201, UD_TAB__OPC_SSE, "/sse" },
-    /* 202 */ { ud_itab__202, UD_TAB__OPC_SSE, "/sse" },
-    /* 203 */ { ud_itab__203, UD_TAB__OPC_SSE, "/sse" },
-    /* 204 */ { ud_itab__204, UD_TAB__OPC_SSE, "/sse" },
-    /* 205 */ { ud_itab__205, UD_TAB__OPC_SSE, "/sse" },
-    /* 206 */ { ud_itab__206, UD_TAB__OPC_SSE, "/sse" },
-    /* 207 */ { ud_itab__207, UD_TAB__OPC_SSE, "/sse" },
-    /* 208 */ { ud_itab__208, UD_TAB__OPC_SSE, "/sse" },
-    /* 209 */ { ud_itab__209, UD_TAB__OPC_SSE, "/sse" },
-    /* 210 */ { ud_itab__210, UD_TAB__OPC_SSE, "/sse" },
-    /* 211 */ { ud_itab__211, UD_TAB__OPC_SSE, "/sse" },
-    /* 212 */ { ud_itab__212, UD_TAB__OPC_SSE, "/sse" },
-    /* 213 */ { ud_itab__213, UD_TAB__OPC_MODE, "/m" },
-    /* 214 */ { ud_itab__214, UD_TAB__OPC_VENDOR, "intel" },
-    /* 215 */ { ud_itab__215, UD_TAB__OPC_SSE, "/sse" },
-    /* 216 */ { ud_itab__216, UD_TAB__OPC_MODE, "/m" },
-    /* 217 */ { ud_itab__217, UD_TAB__OPC_VENDOR, "intel" },
-    /* 218 */ { ud_itab__218, UD_TAB__OPC_SSE, "/sse" },
-    /* 219 */ { ud_itab__219, UD_TAB__OPC_SSE, "/sse" },
-    /* 220 */ { ud_itab__220, UD_TAB__OPC_SSE, "/sse" },
-    /* 221 */ { ud_itab__221, UD_TAB__OPC_SSE, "/sse" },
-    /* 222 */ { ud_itab__222, UD_TAB__OPC_SSE, "/sse" },
-    /* 223 */ { ud_itab__223, UD_TAB__OPC_SSE, "/sse" },
-    /* 224 */ { ud_itab__224, UD_TAB__OPC_SSE, "/sse" },
-    /* 225 */ { ud_itab__225, UD_TAB__OPC_TABLE, "3a" },
-    /* 226 */ { ud_itab__226, UD_TAB__OPC_SSE, "/sse" },
-    /* 227 */ { ud_itab__227, UD_TAB__OPC_SSE, "/sse" },
-    /* 228 */ { ud_itab__228, UD_TAB__OPC_SSE, "/sse" },
-    /* 229 */ { ud_itab__229, UD_TAB__OPC_SSE, "/sse" },
-    /* 230 */ { ud_itab__230, UD_TAB__OPC_SSE, "/sse" },
-    /* 231 */ { ud_itab__231, UD_TAB__OPC_SSE, "/sse" },
-    /* 232 */ { ud_itab__232, UD_TAB__OPC_SSE, "/sse" },
-    /* 233 */ { ud_itab__233, UD_TAB__OPC_SSE, "/sse" },
-    /* 234 */ { ud_itab__234, UD_TAB__OPC_SSE, "/sse" },
-    /* 235 */ { ud_itab__235, UD_TAB__OPC_SSE, "/sse" },
-    /* 236 */ { ud_itab__236, UD_TAB__OPC_SSE, "/sse" },
-    /* 237 */ { ud_itab__237, UD_TAB__OPC_OSIZE, "/o" },
-    /* 238 */ { ud_itab__238, UD_TAB__OPC_SSE, "/sse" },
-    /* 239 */ { ud_itab__239, UD_TAB__OPC_SSE, "/sse" },
-    /* 240 */ { ud_itab__240, UD_TAB__OPC_SSE, "/sse" },
-    /* 241 */ { ud_itab__241, UD_TAB__OPC_SSE, "/sse" },
-    /* 242 */ { ud_itab__242, UD_TAB__OPC_OSIZE, "/o" },
-    /* 243 */ { ud_itab__243, UD_TAB__OPC_SSE, "/sse" },
-    /* 244 */ { ud_itab__244, UD_TAB__OPC_SSE, "/sse" },
-    /* 245 */ { ud_itab__245, UD_TAB__OPC_SSE, "/sse" },
-    /* 246 */ { ud_itab__246, UD_TAB__OPC_SSE, "/sse" },
-    /* 247 */ { ud_itab__247, UD_TAB__OPC_SSE, "/sse" },
-    /* 248 */ { ud_itab__248, UD_TAB__OPC_SSE, "/sse" },
-    /* 249 */ { ud_itab__249, UD_TAB__OPC_SSE, "/sse" },
-    /* 250 */ { ud_itab__250, UD_TAB__OPC_SSE, "/sse" },
-    /* 251 */ { ud_itab__251, UD_TAB__OPC_SSE, "/sse" },
-    /* 252 */ { ud_itab__252, UD_TAB__OPC_SSE, "/sse" },
-    /* 253 */ { ud_itab__253, UD_TAB__OPC_SSE, "/sse" },
-    /* 254 */ { ud_itab__254, UD_TAB__OPC_SSE, "/sse" },
-    /* 255 */ { ud_itab__255, UD_TAB__OPC_SSE, "/sse" },
-    /* 256 */ { ud_itab__256, UD_TAB__OPC_SSE, "/sse" },
-    /* 257 */ { ud_itab__257, UD_TAB__OPC_SSE, "/sse" },
-    /* 258 */ { ud_itab__258, UD_TAB__OPC_SSE, "/sse" },
-    /* 259 */ { ud_itab__259, UD_TAB__OPC_SSE, "/sse" },
-    /* 260 */ { ud_itab__260, UD_TAB__OPC_SSE, "/sse" },
-    /* 261 */ { ud_itab__261, UD_TAB__OPC_SSE, "/sse" },
-    /* 262 */ { ud_itab__262, UD_TAB__OPC_SSE, "/sse" },
-    /* 263 */ { ud_itab__263, UD_TAB__OPC_SSE, "/sse" },
-    /* 264 */ { ud_itab__264, UD_TAB__OPC_SSE, "/sse" },
-    /* 265 */ { ud_itab__265, UD_TAB__OPC_SSE, "/sse" },
-    /* 266 */ { ud_itab__266, UD_TAB__OPC_SSE, "/sse" },
-    /* 267 */ { ud_itab__267, UD_TAB__OPC_SSE, "/sse" },
-    /* 268 */ { ud_itab__268, UD_TAB__OPC_SSE, "/sse" },
-    /* 269 */ { ud_itab__269, UD_TAB__OPC_SSE, "/sse" },
-    /* 270 */ { ud_itab__270, UD_TAB__OPC_SSE, "/sse" },
-    /* 271 */ { ud_itab__271, UD_TAB__OPC_SSE, "/sse" },
-    /* 272 */ { ud_itab__272, UD_TAB__OPC_SSE, "/sse" },
-    /* 273 */ { ud_itab__273, UD_TAB__OPC_SSE, "/sse" },
-    /* 274 */ { ud_itab__274, UD_TAB__OPC_SSE, "/sse" },
-    /* 275 */ { ud_itab__275, UD_TAB__OPC_SSE, "/sse" },
-    /* 276 */ { ud_itab__276, UD_TAB__OPC_SSE, "/sse" },
-    /* 277 */ { ud_itab__277, UD_TAB__OPC_SSE, "/sse" },
-    /* 278 */ { ud_itab__278, UD_TAB__OPC_SSE, "/sse" },
-    /* 279 */ { ud_itab__279, UD_TAB__OPC_SSE, "/sse" },
-    /* 280 */ { ud_itab__280, UD_TAB__OPC_SSE, "/sse" },
-    /* 281 */ { ud_itab__281, UD_TAB__OPC_SSE, "/sse" },
-    /* 282 */ { ud_itab__282, UD_TAB__OPC_SSE, "/sse" },
-    /* 283 */ { ud_itab__283, UD_TAB__OPC_SSE, "/sse" },
-    /* 284 */ { ud_itab__284, UD_TAB__OPC_SSE, "/sse" },
-    /* 285 */ { ud_itab__285, UD_TAB__OPC_SSE, "/sse" },
-    /* 286 */ { ud_itab__286, UD_TAB__OPC_SSE, "/sse" },
-    /* 287 */ { ud_itab__287, UD_TAB__OPC_SSE, "/sse" },
-    /* 288 */ { ud_itab__288, UD_TAB__OPC_SSE, "/sse" },
-    /* 289 */ { ud_itab__289, UD_TAB__OPC_SSE, "/sse" },
-    /* 290 */ { ud_itab__290, UD_TAB__OPC_SSE, "/sse" },
-    /* 291 */ { ud_itab__291, UD_TAB__OPC_SSE, "/sse" },
-    /* 292 */ { ud_itab__292, UD_TAB__OPC_SSE, "/sse" },
-    /* 293 */ { ud_itab__293, UD_TAB__OPC_SSE, "/sse" },
-    /* 294 */ { ud_itab__294, UD_TAB__OPC_SSE, "/sse" },
-    /* 295 */ { ud_itab__295, UD_TAB__OPC_SSE, "/sse" },
-    /* 296 */ { ud_itab__296, UD_TAB__OPC_SSE, "/sse" },
-    /* 297 */ { ud_itab__297, UD_TAB__OPC_SSE, "/sse" },
-    /* 298 */ { ud_itab__298, UD_TAB__OPC_SSE, "/sse" },
-    /* 299 */ { ud_itab__299, UD_TAB__OPC_SSE, "/sse" },
-    /* 300 */ { ud_itab__300, UD_TAB__OPC_SSE, "/sse" },
-    /* 301 */ { ud_itab__301, UD_TAB__OPC_REG, "/reg" },
-    /* 302 */ { ud_itab__302, UD_TAB__OPC_SSE, "/sse" },
-    /* 303 */ { ud_itab__303, UD_TAB__OPC_SSE, "/sse" },
-    /* 304 */ { ud_itab__304, UD_TAB__OPC_SSE, "/sse" },
-    /* 305 */ { ud_itab__305, UD_TAB__OPC_REG, "/reg" },
-    /* 306 */ { ud_itab__306, UD_TAB__OPC_SSE, "/sse" },
-    /* 307 */ { ud_itab__307, UD_TAB__OPC_SSE, "/sse" },
-    /* 308 */ { ud_itab__308, UD_TAB__OPC_SSE, "/sse" },
-    /* 309 */ { ud_itab__309, UD_TAB__OPC_REG, "/reg" },
-    /* 310 */ { ud_itab__310, UD_TAB__OPC_SSE, "/sse" },
-    /* 311 */ { ud_itab__311, UD_TAB__OPC_SSE, "/sse" },
-    /* 312 */ { ud_itab__312, UD_TAB__OPC_SSE, "/sse" },
-    /* 313 */ { ud_itab__313, UD_TAB__OPC_SSE, "/sse" },
-    /* 314 */ { ud_itab__314, UD_TAB__OPC_SSE, "/sse" },
-    /* 315 */ { ud_itab__315, UD_TAB__OPC_SSE, "/sse" },
-    /* 316 */ { ud_itab__316, UD_TAB__OPC_SSE, "/sse" },
-    /* 317 */ { ud_itab__317, UD_TAB__OPC_SSE, "/sse" },
-    /* 318 */ { ud_itab__318, UD_TAB__OPC_SSE, "/sse" },
-    /* 319 */ { ud_itab__319, UD_TAB__OPC_VENDOR, "intel" },
-    /* 320 */ { ud_itab__320, UD_TAB__OPC_SSE, "/sse" },
-    /* 321 */ { ud_itab__321, UD_TAB__OPC_VENDOR, "intel" },
-    /* 322 */ { ud_itab__322, UD_TAB__OPC_SSE, "/sse" },
-    /* 323 */ { ud_itab__323, UD_TAB__OPC_SSE, "/sse" },
-    /* 324 */ { ud_itab__324, UD_TAB__OPC_SSE, "/sse" },
-    /* 325 */ { ud_itab__325, UD_TAB__OPC_SSE, "/sse" },
-    /* 326 */ { ud_itab__326, UD_TAB__OPC_SSE, "/sse" },
-    /* 327 */ { ud_itab__327, UD_TAB__OPC_SSE, "/sse" },
-    /* 328 */ { ud_itab__328, UD_TAB__OPC_SSE, "/sse" },
-    /* 329 */ { ud_itab__329, UD_TAB__OPC_SSE, "/sse" },
-    /* 330 */ { ud_itab__330, UD_TAB__OPC_SSE, "/sse" },
-    /* 331 */ { ud_itab__331, UD_TAB__OPC_SSE, "/sse" },
-    /* 332 */ { ud_itab__332, UD_TAB__OPC_SSE, "/sse" },
-    /* 333 */ { ud_itab__333, UD_TAB__OPC_SSE, "/sse" },
-    /* 334 */ { ud_itab__334, UD_TAB__OPC_SSE, "/sse" },
-    /* 335 */ { ud_itab__335, UD_TAB__OPC_SSE, "/sse" },
-    /* 336 */ { ud_itab__336, UD_TAB__OPC_SSE, "/sse" },
-    /* 337 */ { ud_itab__337, UD_TAB__OPC_SSE, "/sse" },
-    /* 338 */ { ud_itab__338, UD_TAB__OPC_SSE, "/sse" },
-    /* 339 */ { ud_itab__339, UD_TAB__OPC_SSE, "/sse" },
-    /* 340 */ { ud_itab__340, UD_TAB__OPC_SSE, "/sse" },
-    /* 341 */ { ud_itab__341, UD_TAB__OPC_SSE, "/sse" },
-    /* 342 */ { ud_itab__342, UD_TAB__OPC_SSE, "/sse" },
-    /* 343 */ { ud_itab__343, UD_TAB__OPC_SSE, "/sse" },
-    /* 344 */ { ud_itab__344, UD_TAB__OPC_SSE, "/sse" },
-    /* 345 */ { ud_itab__345, UD_TAB__OPC_SSE, "/sse" },
-    /* 346 */ { ud_itab__346, UD_TAB__OPC_SSE, "/sse" },
-    /* 347 */ { ud_itab__347, UD_TAB__OPC_SSE, "/sse" },
-    /* 348 */ { ud_itab__348, UD_TAB__OPC_SSE, "/sse" },
-    /* 349 */ { ud_itab__349, UD_TAB__OPC_SSE, "/sse" },
-    /* 350 */ { ud_itab__350, UD_TAB__OPC_SSE, "/sse" },
-    /* 351 */ { ud_itab__351, UD_TAB__OPC_SSE, "/sse" },
-    /* 352 */ { ud_itab__352, UD_TAB__OPC_SSE, "/sse" },
-    /* 353 */ { ud_itab__353, UD_TAB__OPC_SSE, "/sse" },
-    /* 354 */ { ud_itab__354, UD_TAB__OPC_SSE, "/sse" },
-    /* 355 */ { ud_itab__355, UD_TAB__OPC_SSE, "/sse" },
-    /* 356 */ { ud_itab__356, UD_TAB__OPC_SSE, "/sse" },
-    /* 357 */ { ud_itab__357, UD_TAB__OPC_SSE, "/sse" },
-    /* 358 */ { ud_itab__358, UD_TAB__OPC_SSE, "/sse" },
-    /* 359 */ { ud_itab__359, UD_TAB__OPC_SSE, "/sse" },
-    /* 360 */ { ud_itab__360, UD_TAB__OPC_SSE, "/sse" },
-    /* 361 */ { ud_itab__361, UD_TAB__OPC_SSE, "/sse" },
-    /* 362 */ { ud_itab__362, UD_TAB__OPC_SSE, "/sse" },
-    /* 363 */ { ud_itab__363, UD_TAB__OPC_SSE, "/sse" },
-    /* 364 */ { ud_itab__364, UD_TAB__OPC_MOD, "/mod" },
-    /* 365 */ { ud_itab__365, UD_TAB__OPC_REG, "/reg" },
-    /* 366 */ { ud_itab__366, UD_TAB__OPC_RM, "/rm" },
-    /* 367 */ { ud_itab__367, UD_TAB__OPC_SSE, "/sse" },
-    /* 368 */ { ud_itab__368, UD_TAB__OPC_MOD, "/mod" },
-    /* 369 */ { ud_itab__369, UD_TAB__OPC_RM, "/rm" },
-    /* 370 */ { ud_itab__370, UD_TAB__OPC_SSE, "/sse" },
-    /* 371 */ { ud_itab__371, UD_TAB__OPC_MOD, "/mod" },
-    /* 372 */ { ud_itab__372, UD_TAB__OPC_RM, "/rm" },
-    /* 373 */ { ud_itab__373, UD_TAB__OPC_SSE, "/sse" },
-    /* 374 */ { ud_itab__374, UD_TAB__OPC_MOD, "/mod" },
-    /* 375 */ { ud_itab__375, UD_TAB__OPC_MOD, "/mod" },
-    /* 376 */ { ud_itab__376, UD_TAB__OPC_REG, "/reg" },
-    /* 377 */ { ud_itab__377, UD_TAB__OPC_RM, "/rm" },
-    /* 378 */ { ud_itab__378, UD_TAB__OPC_SSE, "/sse" },
-    /* 379 */ { ud_itab__379, UD_TAB__OPC_MOD, "/mod" },
-    /* 380 */ { ud_itab__380, UD_TAB__OPC_RM, "/rm" },
-    /* 381 */ { ud_itab__381, UD_TAB__OPC_SSE, "/sse" },
-    /* 382 */ { ud_itab__382, UD_TAB__OPC_MOD, "/mod" },
-    /* 383 */ { ud_itab__383, UD_TAB__OPC_RM, "/rm" },
-    /* 384 */ { ud_itab__384, UD_TAB__OPC_SSE, "/sse" },
-    /* 385 */ { ud_itab__385, UD_TAB__OPC_MOD, "/mod" },
-    /* 386 */ { ud_itab__386, UD_TAB__OPC_RM, "/rm" },
-    /* 387 */ { ud_itab__387, UD_TAB__OPC_SSE, "/sse" },
-    /* 388 */ { ud_itab__388, UD_TAB__OPC_MOD, "/mod" },
-    /* 389 */ { ud_itab__389, UD_TAB__OPC_RM, "/rm" },
-    /* 390 */ { ud_itab__390, UD_TAB__OPC_SSE, "/sse" },
-    /* 391 */ { ud_itab__391, UD_TAB__OPC_MOD, "/mod" },
-    /* 392 */ { ud_itab__392, UD_TAB__OPC_RM, "/rm" },
-    /* 393 */ { ud_itab__393, UD_TAB__OPC_SSE, "/sse" },
-    /* 394 */ { ud_itab__394, UD_TAB__OPC_MOD, "/mod" },
-    /* 395 */ { ud_itab__395, UD_TAB__OPC_SSE, "/sse" },
-    /* 396 */ { ud_itab__396, UD_TAB__OPC_SSE, "/sse" },
-    /* 397 */ { ud_itab__397, UD_TAB__OPC_SSE, "/sse" },
-    /* 398 */ { ud_itab__398, UD_TAB__OPC_SSE, "/sse" },
-    /* 399 */ { ud_itab__399, UD_TAB__OPC_SSE, "/sse" },
-    /* 400 */ { ud_itab__400, UD_TAB__OPC_SSE, "/sse" },
-    /* 401 */ { ud_itab__401, UD_TAB__OPC_MOD, "/mod" },
-    /* 402 */ { ud_itab__402, UD_TAB__OPC_REG, "/reg" },
-    /* 403 */ { ud_itab__403, UD_TAB__OPC_SSE, "/sse" },
-    /* 404 */ { ud_itab__404, UD_TAB__OPC_MOD, "/mod" },
-    /* 405 */ { ud_itab__405, UD_TAB__OPC_SSE, "/sse" },
-    /* 406 */ { ud_itab__406, UD_TAB__OPC_MOD, "/mod" },
-    /* 407 */ { ud_itab__407, UD_TAB__OPC_SSE, "/sse" },
-    /* 408 */ { ud_itab__408, UD_TAB__OPC_MOD, "/mod" },
-    /* 409 */ { ud_itab__409, UD_TAB__OPC_SSE, "/sse" },
-    /* 410 */ { ud_itab__410, UD_TAB__OPC_MOD, "/mod" },
-    /* 411 */ { ud_itab__411, UD_TAB__OPC_SSE, "/sse" },
-    /* 412 */ { ud_itab__412, UD_TAB__OPC_MOD, "/mod" },
-    /* 413 */ { ud_itab__413, UD_TAB__OPC_SSE, "/sse" },
-    /* 414 */ { ud_itab__414, UD_TAB__OPC_MOD, "/mod" },
-    /* 415 */ { ud_itab__415, UD_TAB__OPC_SSE, "/sse" },
-    /* 416 */ { ud_itab__416, UD_TAB__OPC_MOD, "/mod" },
-    /* 417 */ { ud_itab__417, UD_TAB__OPC_REG, "/reg" },
-    /* 418 */ { ud_itab__418, UD_TAB__OPC_RM, "/rm" },
-    /* 419 */ { ud_itab__419, UD_TAB__OPC_SSE, "/sse" },
-    /* 420 */ { ud_itab__420, UD_TAB__OPC_MOD, "/mod" },
-    /* 421 */ { ud_itab__421, UD_TAB__OPC_SSE, "/sse" },
-    /* 422 */ { ud_itab__422, UD_TAB__OPC_MOD, "/mod" },
-    /* 423 */ { ud_itab__423, UD_TAB__OPC_SSE, "/sse" },
-    /* 424 */ { ud_itab__424, UD_TAB__OPC_MOD, "/mod" },
-    /* 425 */ { ud_itab__425, UD_TAB__OPC_SSE, "/sse" },
-    /* 426 */ { ud_itab__426, UD_TAB__OPC_MOD, "/mod" },
-    /* 427 */ { ud_itab__427, UD_TAB__OPC_SSE, "/sse" },
-    /* 428 */ { ud_itab__428, UD_TAB__OPC_MOD, "/mod" },
-    /* 429 */ { ud_itab__429, UD_TAB__OPC_SSE, "/sse" },
-    /* 430 */ { ud_itab__430, UD_TAB__OPC_MOD, "/mod" },
-    /* 431 */ { ud_itab__431, UD_TAB__OPC_SSE, "/sse" },
-    /* 432 */ { ud_itab__432, UD_TAB__OPC_MOD, "/mod" },
-    /* 433 */ { ud_itab__433, UD_TAB__OPC_SSE, "/sse" },
-    /* 434 */ { ud_itab__434, UD_TAB__OPC_MOD, "/mod" },
-    /* 435 */ { ud_itab__435, UD_TAB__OPC_RM, "/rm" },
-    /* 436 */ { ud_itab__436, UD_TAB__OPC_SSE, "/sse" },
-    /* 437 */ { ud_itab__437, UD_TAB__OPC_MOD, "/mod" },
-    /* 438 */ { ud_itab__438, UD_TAB__OPC_SSE, "/sse" },
-    /* 439 */ { ud_itab__439, UD_TAB__OPC_MOD, "/mod" },
-    /* 440 */ { ud_itab__440, UD_TAB__OPC_SSE, "/sse" },
-    /* 441 */ { ud_itab__441, UD_TAB__OPC_MOD, "/mod" },
-    /* 442 */ { ud_itab__442, UD_TAB__OPC_SSE, "/sse" },
-    /* 443 */ { ud_itab__443, UD_TAB__OPC_MOD, "/mod" },
-    /* 444 */ { ud_itab__444, UD_TAB__OPC_SSE, "/sse" },
-    /* 445 */ { ud_itab__445, UD_TAB__OPC_MOD, "/mod" },
-    /* 446 */ { ud_itab__446, UD_TAB__OPC_SSE, "/sse" },
-    /* 447 */ { ud_itab__447, UD_TAB__OPC_MOD, "/mod" },
-    /* 448 */ { ud_itab__448, UD_TAB__OPC_SSE, "/sse" },
-    /* 449 */ { ud_itab__449, UD_TAB__OPC_MOD, "/mod" },
-    /* 450 */ { ud_itab__450, UD_TAB__OPC_SSE, "/sse" },
-    /* 451 */ { ud_itab__451, UD_TAB__OPC_MOD, "/mod" },
-    /* 452 */ { ud_itab__452, UD_TAB__OPC_RM, "/rm" },
-    /* 453 */ { ud_itab__453, UD_TAB__OPC_SSE, "/sse" },
-    /* 454 */ { ud_itab__454, UD_TAB__OPC_MOD, "/mod" },
-    /* 455 */ { ud_itab__455, UD_TAB__OPC_SSE, "/sse" },
-    /* 456 */ { ud_itab__456, UD_TAB__OPC_MOD, "/mod" },
-    /* 457 */ { ud_itab__457, UD_TAB__OPC_SSE, "/sse" },
-    /* 458 */ { ud_itab__458, UD_TAB__OPC_MOD, "/mod" },
-    /* 459 */ { ud_itab__459, UD_TAB__OPC_SSE, "/sse" },
-    /* 460 */ { ud_itab__460, UD_TAB__OPC_MOD, "/mod" },
-    /* 461 */ { ud_itab__461, UD_TAB__OPC_SSE, "/sse" },
-    /* 462 */ { ud_itab__462, UD_TAB__OPC_MOD, "/mod" },
-    /* 463 */ { ud_itab__463, UD_TAB__OPC_SSE, "/sse" },
-    /* 464 */ { ud_itab__464, UD_TAB__OPC_MOD, "/mod" },
-    /* 465 */ { ud_itab__465, UD_TAB__OPC_SSE, "/sse" },
-    /* 466 */ { ud_itab__466, UD_TAB__OPC_MOD, "/mod" },
-    /* 467 */ { ud_itab__467, UD_TAB__OPC_SSE, "/sse" },
-    /* 468 */ { ud_itab__468, UD_TAB__OPC_MOD, "/mod" },
-    /* 469 */ { ud_itab__469, UD_TAB__OPC_SSE, "/sse" },
-    /* 470 */ { ud_itab__470, UD_TAB__OPC_SSE, "/sse" },
-    /* 471 */ { ud_itab__471, UD_TAB__OPC_SSE, "/sse" },
-    /* 472 */ { ud_itab__472, UD_TAB__OPC_SSE, "/sse" },
-    /* 473 */ { ud_itab__473, UD_TAB__OPC_SSE, "/sse" },
-    /* 474 */ { ud_itab__474, UD_TAB__OPC_SSE, "/sse" },
-    /* 475 */ { ud_itab__475, UD_TAB__OPC_SSE, "/sse" },
-    /* 476 */ { ud_itab__476, UD_TAB__OPC_SSE, "/sse" },
-    /* 477 */ { ud_itab__477, UD_TAB__OPC_SSE, "/sse" },
-    /* 478 */ { ud_itab__478, UD_TAB__OPC_SSE, "/sse" },
-    /* 479 */ { ud_itab__479, UD_TAB__OPC_REG, "/reg" },
-    /* 480 */ { ud_itab__480, UD_TAB__OPC_SSE, "/sse" },
-    /* 481 */ { ud_itab__481, UD_TAB__OPC_SSE, "/sse" },
-    /* 482 */ { ud_itab__482, UD_TAB__OPC_SSE, "/sse" },
-    /* 483 */ { ud_itab__483, UD_TAB__OPC_SSE, "/sse" },
-    /* 484 */ { ud_itab__484, UD_TAB__OPC_SSE, "/sse" },
-    /* 485 */ { ud_itab__485, UD_TAB__OPC_SSE, "/sse" },
-    /* 486 */ { ud_itab__486, UD_TAB__OPC_SSE, "/sse" },
-    /* 487 */ { ud_itab__487, UD_TAB__OPC_SSE, "/sse" },
-    /* 488 */ { ud_itab__488, UD_TAB__OPC_SSE, "/sse" },
-    /* 489 */ { ud_itab__489, UD_TAB__OPC_SSE, "/sse" },
-    /* 490 */ { ud_itab__490, UD_TAB__OPC_SSE, "/sse" },
-    /* 491 */ { ud_itab__491, UD_TAB__OPC_SSE, "/sse" },
-    /* 492 */ { ud_itab__492, UD_TAB__OPC_SSE, "/sse" },
-    /* 493 */ { ud_itab__493, UD_TAB__OPC_SSE, "/sse" },
-    /* 494 */ { ud_itab__494, UD_TAB__OPC_SSE, "/sse" },
-    /* 495 */ { ud_itab__495, UD_TAB__OPC_SSE, "/sse" },
-    /* 496 */ { ud_itab__496, UD_TAB__OPC_REG, "/reg" },
-    /* 497 */ { ud_itab__497, UD_TAB__OPC_SSE, "/sse" },
-    /* 498 */ { ud_itab__498, UD_TAB__OPC_OSIZE, "/o" },
-    /* 499 */ { ud_itab__499, UD_TAB__OPC_SSE, "/sse" },
-    /* 500 */ { ud_itab__500, UD_TAB__OPC_VENDOR, "intel" },
-    /* 501 */ { ud_itab__501, UD_TAB__OPC_VENDOR, "intel" },
-    /* 502 */ { ud_itab__502, UD_TAB__OPC_VENDOR, "intel" },
-    /* 503 */ { ud_itab__503, UD_TAB__OPC_SSE, "/sse" },
-    /* 504 */ { ud_itab__504, UD_TAB__OPC_VENDOR, "intel" },
-    /* 505 */ { ud_itab__505, UD_TAB__OPC_SSE, "/sse" },
-    /* 506 */ { ud_itab__506, UD_TAB__OPC_SSE, "/sse" },
-    /* 507 */ { ud_itab__507, UD_TAB__OPC_SSE, "/sse" },
-    /* 508 */ { ud_itab__508, UD_TAB__OPC_SSE, "/sse" },
-    /* 509 */ { ud_itab__509, UD_TAB__OPC_SSE, "/sse" },
-    /* 510 */ { ud_itab__510, UD_TAB__OPC_SSE, "/sse" },
-    /* 511 */ { ud_itab__511, UD_TAB__OPC_SSE, "/sse" },
-    /* 512 */ { ud_itab__512, UD_TAB__OPC_SSE, "/sse" },
-    /* 513 */ { ud_itab__513, UD_TAB__OPC_SSE, "/sse" },
-    /* 514 */ { ud_itab__514, UD_TAB__OPC_SSE, "/sse" },
-    /* 515 */ { ud_itab__515, UD_TAB__OPC_SSE, "/sse" },
-    /* 516 */ { ud_itab__516, UD_TAB__OPC_SSE, "/sse" },
-    /* 517 */ { ud_itab__517, UD_TAB__OPC_SSE, "/sse" },
-    /* 518 */ { ud_itab__518, UD_TAB__OPC_SSE, "/sse" },
-    /* 519 */ { ud_itab__519, UD_TAB__OPC_SSE, "/sse" },
-    /* 520 */ { ud_itab__520, UD_TAB__OPC_SSE, "/sse" },
-    /* 521 */ { ud_itab__521, UD_TAB__OPC_SSE, "/sse" },
-    /* 522 */ { ud_itab__522, UD_TAB__OPC_SSE, "/sse" },
-    /* 523 */ { ud_itab__523, UD_TAB__OPC_SSE, "/sse" },
-    /* 524 */ { ud_itab__524, UD_TAB__OPC_SSE, "/sse" },
-    /* 525 */ { ud_itab__525, UD_TAB__OPC_SSE, "/sse" },
-    /* 526 */ { ud_itab__526, UD_TAB__OPC_SSE, "/sse" },
-    /* 527 */ { ud_itab__527, UD_TAB__OPC_SSE, "/sse" },
-    /* 528 */ { ud_itab__528, UD_TAB__OPC_SSE, "/sse" },
-    /* 529 */ { ud_itab__529, UD_TAB__OPC_SSE, "/sse" },
-    /* 530 */ { ud_itab__530, UD_TAB__OPC_SSE, "/sse" },
-    /* 531 */ { ud_itab__531, UD_TAB__OPC_SSE, "/sse" },
-    /* 532 */ { ud_itab__532, UD_TAB__OPC_SSE, "/sse" },
-    /* 533 */ { ud_itab__533, UD_TAB__OPC_SSE, "/sse" },
-    /* 534 */ { ud_itab__534, UD_TAB__OPC_SSE, "/sse" },
-    /* 535 */ { ud_itab__535, UD_TAB__OPC_SSE, "/sse" },
-    /* 536 */ { ud_itab__536, UD_TAB__OPC_SSE, "/sse" },
-    /* 537 */ { ud_itab__537, UD_TAB__OPC_SSE, "/sse" },
-    /* 538 */ { ud_itab__538, UD_TAB__OPC_SSE, "/sse" },
-    /* 539 */ { ud_itab__539, UD_TAB__OPC_SSE, "/sse" },
-    /* 540 */ { ud_itab__540, UD_TAB__OPC_SSE, "/sse" },
-    /* 541 */ { ud_itab__541, UD_TAB__OPC_SSE, "/sse" },
-    /* 542 */ { ud_itab__542, UD_TAB__OPC_SSE, "/sse" },
-    /* 543 */ { ud_itab__543, UD_TAB__OPC_SSE, "/sse" },
-    /* 544 */ { ud_itab__544, UD_TAB__OPC_SSE, "/sse" },
-    /* 545 */ { ud_itab__545, UD_TAB__OPC_SSE, "/sse" },
-    /* 546 */ { ud_itab__546, UD_TAB__OPC_SSE, "/sse" },
-    /* 547 */ { ud_itab__547, UD_TAB__OPC_SSE, "/sse" },
-    /* 548 */ { ud_itab__548, UD_TAB__OPC_SSE, "/sse" },
-    /* 549 */ { ud_itab__549, UD_TAB__OPC_SSE, "/sse" },
-    /* 550 */ { ud_itab__550, UD_TAB__OPC_SSE, "/sse" },
-    /* 551 */ { ud_itab__551, UD_TAB__OPC_SSE, "/sse" },
-    /* 552 */ { ud_itab__552, UD_TAB__OPC_MOD, "/mod" },
-    /* 553 */ { ud_itab__553, UD_TAB__OPC_SSE, "/sse" },
-    /* 554 */ { ud_itab__554, UD_TAB__OPC_MOD, "/mod" },
-    /* 555 */ { ud_itab__555, UD_TAB__OPC_MOD, "/mod" },
-    /* 556 */ { ud_itab__556, UD_TAB__OPC_SSE, "/sse" },
-    /* 557 */ { ud_itab__557, UD_TAB__OPC_SSE, "/sse" },
-    /* 558 */ { ud_itab__558, UD_TAB__OPC_SSE, "/sse" },
-    /* 559 */ { ud_itab__559, UD_TAB__OPC_SSE, "/sse" },
-    /* 560 */ { ud_itab__560, UD_TAB__OPC_SSE, "/sse" },
-    /* 561 */ { ud_itab__561, UD_TAB__OPC_SSE, "/sse" },
-    /* 562 */ { ud_itab__562, UD_TAB__OPC_SSE, "/sse" },
-    /* 563 */ { ud_itab__563, UD_TAB__OPC_MODE, "/m" },
-    /* 564 */ { ud_itab__564, UD_TAB__OPC_MODE, "/m" },
-    /* 565 */ { ud_itab__565, UD_TAB__OPC_MODE, "/m" },
-    /* 566 */ { ud_itab__566, UD_TAB__OPC_MODE, "/m" },
-    /* 567 */ { ud_itab__567, UD_TAB__OPC_MODE, "/m" },
-    /* 568 */ { ud_itab__568, UD_TAB__OPC_MODE, "/m" },
-    /* 569 */ { ud_itab__569, UD_TAB__OPC_MODE, "/m" },
-    /* 570 */ { ud_itab__570, UD_TAB__OPC_MODE, "/m" },
-    /* 571 */ { ud_itab__571, UD_TAB__OPC_OSIZE, "/o" },
-    /* 572 */ { ud_itab__572, UD_TAB__OPC_MODE, "/m" },
-    /* 573 */ { ud_itab__573, UD_TAB__OPC_MODE, "/m" },
-    /* 574 */ { ud_itab__574, UD_TAB__OPC_OSIZE, "/o" },
-    /* 575 */ { ud_itab__575, UD_TAB__OPC_MODE, "/m" },
-    /* 576 */ { ud_itab__576, UD_TAB__OPC_MODE, "/m" },
-    /* 577 */ { ud_itab__577, UD_TAB__OPC_MODE, "/m" },
-    /* 578 */ { ud_itab__578, UD_TAB__OPC_MODE, "/m" },
-    /* 579 */ { ud_itab__579, UD_TAB__OPC_OSIZE, "/o" },
-    /* 580 */ { ud_itab__580, UD_TAB__OPC_OSIZE, "/o" },
-    /* 581 */ { ud_itab__581, UD_TAB__OPC_REG, "/reg" },
-    /* 582 */ { ud_itab__582, UD_TAB__OPC_REG, "/reg" },
-    /* 583 */ { ud_itab__583, UD_TAB__OPC_REG, "/reg" },
-    /* 584 */ { ud_itab__584, UD_TAB__OPC_MODE, "/m" },
-    /* 585 */ { ud_itab__585, UD_TAB__OPC_MODE, "/m" },
-    /* 586 */ { ud_itab__586, UD_TAB__OPC_MODE, "/m" },
-    /* 587 */ { ud_itab__587, UD_TAB__OPC_MODE, "/m" },
-    /* 588 */ { ud_itab__588, UD_TAB__OPC_MODE, "/m" },
-    /* 589 */ { ud_itab__589, UD_TAB__OPC_MODE, "/m" },
-    /* 590 */ { ud_itab__590, UD_TAB__OPC_MODE, "/m" },
-    /* 591 */ { ud_itab__591, UD_TAB__OPC_MODE, "/m" },
-    /* 592 */ { ud_itab__592, UD_TAB__OPC_REG, "/reg" },
-    /* 593 */ { ud_itab__593, UD_TAB__OPC_REG, "/reg" },
-    /* 594 */ { ud_itab__594, UD_TAB__OPC_OSIZE, "/o" },
-    /* 595 */ { ud_itab__595, UD_TAB__OPC_OSIZE, "/o" },
-    /* 596 */ { ud_itab__596, UD_TAB__OPC_MODE, "/m" },
-    /* 597 */ { ud_itab__597, UD_TAB__OPC_OSIZE, "/o" },
-    /* 598 */ { ud_itab__598, UD_TAB__OPC_MODE, "/m" },
-    /* 599 */ { ud_itab__599, UD_TAB__OPC_MODE, "/m" },
-    /* 600 */ { ud_itab__600, UD_TAB__OPC_MODE, "/m" },
-    /* 601 */ { ud_itab__601, UD_TAB__OPC_OSIZE, "/o" },
-    /* 602 */ { ud_itab__602, UD_TAB__OPC_MODE, "/m" },
-    /* 603 */ { ud_itab__603, UD_TAB__OPC_MODE, "/m" },
-    /* 604 */ { ud_itab__604, UD_TAB__OPC_MODE, "/m" },
-    /* 605 */ { ud_itab__605, UD_TAB__OPC_OSIZE, "/o" },
-    /* 606 */ { ud_itab__606, UD_TAB__OPC_OSIZE, "/o" },
-    /* 607 */ { ud_itab__607, UD_TAB__OPC_OSIZE, "/o" },
-    /* 608 */ { ud_itab__608, UD_TAB__OPC_OSIZE, "/o" },
-    /* 609 */ { ud_itab__609, UD_TAB__OPC_OSIZE, "/o" },
-    /* 610 */ { ud_itab__610, UD_TAB__OPC_REG, "/reg" },
-    /* 611 */ { ud_itab__611, UD_TAB__OPC_REG, "/reg" },
-    /* 612 */ { ud_itab__612, UD_TAB__OPC_MODE, "/m" },
-    /* 613 */ { ud_itab__613, UD_TAB__OPC_MODE, "/m" },
-    /* 614 */ { ud_itab__614, UD_TAB__OPC_REG, "/reg" },
-    /* 615 */ { ud_itab__615, UD_TAB__OPC_REG, "/reg" },
-    /* 616 */ { ud_itab__616, UD_TAB__OPC_MODE, "/m" },
-    /* 617 */ { ud_itab__617, UD_TAB__OPC_OSIZE, "/o" },
-    /* 618 */ { ud_itab__618, UD_TAB__OPC_REG, "/reg" },
-    /* 619 */ { ud_itab__619, UD_TAB__OPC_REG, "/reg" },
-    /* 620 */ { ud_itab__620, UD_TAB__OPC_REG, "/reg" },
-    /* 621 */ { ud_itab__621, UD_TAB__OPC_REG, "/reg" },
-    /* 622 */ { ud_itab__622, UD_TAB__OPC_MODE, "/m" },
-    /* 623 */ { ud_itab__623, UD_TAB__OPC_MODE, "/m" },
-    /* 624 */ { ud_itab__624, UD_TAB__OPC_MODE, "/m" },
-    /* 625 */ { ud_itab__625, UD_TAB__OPC_MOD, "/mod" },
-    /* 626 */ { ud_itab__626, UD_TAB__OPC_REG, "/reg" },
-    /* 627 */ { ud_itab__627, UD_TAB__OPC_MOD, "/mod" },
-    /* 628 */ { ud_itab__628, UD_TAB__OPC_MOD, "/mod" },
-    /* 629 */ { ud_itab__629, UD_TAB__OPC_MOD, "/mod" },
-    /* 630 */ { ud_itab__630, UD_TAB__OPC_MOD, "/mod" },
-    /* 631 */ { ud_itab__631, UD_TAB__OPC_MOD, "/mod" },
-    /* 632 */ { ud_itab__632, UD_TAB__OPC_MOD, "/mod" },
-    /* 633 */ { ud_itab__633, UD_TAB__OPC_MOD, "/mod" },
-    /* 634 */ { ud_itab__634, UD_TAB__OPC_MOD, "/mod" },
-    /* 635 */ { ud_itab__635, UD_TAB__OPC_X87, "/x87" },
-    /* 636 */ { ud_itab__636, UD_TAB__OPC_MOD, "/mod" },
-    /* 637 */ { ud_itab__637, UD_TAB__OPC_MOD, "/mod" },
-    /* 638 */ { ud_itab__638, UD_TAB__OPC_MOD, "/mod" },
-    /* 639 */ { ud_itab__639, UD_TAB__OPC_MOD, "/mod" },
-    /* 640 */ { ud_itab__640, UD_TAB__OPC_MOD, "/mod" },
-    /* 641 */ { ud_itab__641, UD_TAB__OPC_MOD, "/mod" },
-    /* 642 */ { ud_itab__642, UD_TAB__OPC_MOD, "/mod" },
-    /* 643 */ { ud_itab__643, UD_TAB__OPC_MOD, "/mod" },
-    /* 644 */ { ud_itab__644, UD_TAB__OPC_MOD, "/mod" },
-    /* 645 */ { ud_itab__645, UD_TAB__OPC_MOD, "/mod" },
-    /* 646 */ { ud_itab__646, UD_TAB__OPC_MOD, "/mod" },
-    /* 647 */ { ud_itab__647, UD_TAB__OPC_MOD, "/mod" },
-    /* 648 */ { ud_itab__648, UD_TAB__OPC_MOD, "/mod" },
-    /* 649 */ { ud_itab__649, UD_TAB__OPC_MOD, "/mod" },
-    /* 650 */ { ud_itab__650, UD_TAB__OPC_MOD, "/mod" },
-    /* 651 */ { ud_itab__651, UD_TAB__OPC_MOD, "/mod" },
-    /* 652 */ { ud_itab__652, UD_TAB__OPC_MOD, "/mod" },
-    /* 653 */ { ud_itab__653, UD_TAB__OPC_MOD, "/mod" },
-    /* 654 */ { ud_itab__654, UD_TAB__OPC_MOD, "/mod" },
-    /* 655 */ { ud_itab__655, UD_TAB__OPC_MOD, "/mod" },
-    /* 656 */ { ud_itab__656, UD_TAB__OPC_MOD, "/mod" },
-    /* 657 */ { ud_itab__657, UD_TAB__OPC_MOD, "/mod" },
-    /* 658 */ { ud_itab__658, UD_TAB__OPC_MOD, "/mod" },
-    /* 659 */ { ud_itab__659, UD_TAB__OPC_MOD, "/mod" },
-    /* 660 */ { ud_itab__660, UD_TAB__OPC_MOD, "/mod" },
-    /* 661 */ { ud_itab__661, UD_TAB__OPC_MOD, "/mod" },
-    /* 662 */ { ud_itab__662, UD_TAB__OPC_MOD, "/mod" },
-    /* 663 */ { ud_itab__663, UD_TAB__OPC_MOD, "/mod" },
-    /* 664 */ { ud_itab__664, UD_TAB__OPC_MOD, "/mod" },
-    /* 665 */ { ud_itab__665, UD_TAB__OPC_MOD, "/mod" },
-    /* 666 */ { ud_itab__666, UD_TAB__OPC_MOD, "/mod" },
-    /* 667 */ { ud_itab__667, UD_TAB__OPC_MOD, "/mod" },
-    /* 668 */ { ud_itab__668, UD_TAB__OPC_MOD, "/mod" },
-    /* 669 */ { ud_itab__669, UD_TAB__OPC_MOD, "/mod" },
-    /* 670 */ { ud_itab__670, UD_TAB__OPC_MOD, "/mod" },
-    /* 671 */ { ud_itab__671, UD_TAB__OPC_MOD, "/mod" },
-    /* 672 */ { ud_itab__672, UD_TAB__OPC_MOD, "/mod" },
-    /* 673 */ { ud_itab__673, UD_TAB__OPC_MOD, "/mod" },
-    /* 674 */ { ud_itab__674, UD_TAB__OPC_MOD, "/mod" },
-    /* 675 */ { ud_itab__675, UD_TAB__OPC_MOD, "/mod" },
-    /* 676 */ { ud_itab__676, UD_TAB__OPC_MOD, "/mod" },
-    /* 677 */ { ud_itab__677, UD_TAB__OPC_MOD, "/mod" },
-    /* 678 */ { ud_itab__678, UD_TAB__OPC_MOD, "/mod" },
-    /* 679 */ { ud_itab__679, UD_TAB__OPC_MOD, "/mod" },
-    /* 680 */ { ud_itab__680, UD_TAB__OPC_MOD, "/mod" },
-    /* 681 */ { ud_itab__681, UD_TAB__OPC_MOD, "/mod" },
-    /* 682 */ { ud_itab__682, UD_TAB__OPC_MOD, "/mod" },
-    /* 683 */ { ud_itab__683, UD_TAB__OPC_MOD, "/mod" },
-    /* 684 */ { ud_itab__684, UD_TAB__OPC_MOD, "/mod" },
-    /* 685 */ { ud_itab__685, UD_TAB__OPC_MOD, "/mod" },
-    /* 686 */ { ud_itab__686, UD_TAB__OPC_MOD, "/mod" },
-    /* 687 */ { ud_itab__687, UD_TAB__OPC_MOD, "/mod" },
-    /* 688 */ { ud_itab__688, UD_TAB__OPC_MOD, "/mod" },
-    /* 689 */ { ud_itab__689, UD_TAB__OPC_MOD, "/mod" },
-    /* 690 */ { ud_itab__690, UD_TAB__OPC_MOD, "/mod" },
-    /* 691 */ { ud_itab__691, UD_TAB__OPC_MOD, "/mod" },
-    /* 692 */ { ud_itab__692, UD_TAB__OPC_MOD, "/mod" },
-    /* 693 */ { ud_itab__693, UD_TAB__OPC_MOD, "/mod" },
-    /* 694 */ { ud_itab__694, UD_TAB__OPC_MOD, "/mod" },
-    /* 695 */ { ud_itab__695, UD_TAB__OPC_MOD, "/mod" },
-    /* 696 */ { ud_itab__696, UD_TAB__OPC_MOD, "/mod" },
-    /* 697 */ { ud_itab__697, UD_TAB__OPC_MOD, "/mod" },
-    /* 698 */ { ud_itab__698, UD_TAB__OPC_MOD, "/mod" },
-    /* 699 */ { ud_itab__699, UD_TAB__OPC_MOD, "/mod" },
-    /* 700 */ { ud_itab__700, UD_TAB__OPC_MOD, "/mod" },
-    /* 701 */ { ud_itab__701, UD_TAB__OPC_REG, "/reg" },
-    /* 702 */ { ud_itab__702, UD_TAB__OPC_MOD, "/mod" },
-    /* 703 */ { ud_itab__703, UD_TAB__OPC_MOD, "/mod" },
-    /* 704 */ { ud_itab__704, UD_TAB__OPC_MOD, "/mod" },
-    /* 705 */ { ud_itab__705, UD_TAB__OPC_MOD, "/mod" },
-    /* 706 */ { ud_itab__706, UD_TAB__OPC_MOD, "/mod" },
-    /* 707 */ { ud_itab__707, UD_TAB__OPC_MOD, "/mod" },
-    /* 708 */ { ud_itab__708, UD_TAB__OPC_MOD, "/mod" },
-    /* 709 */ { ud_itab__709, UD_TAB__OPC_X87, "/x87" },
-    /* 710 */ { ud_itab__710, UD_TAB__OPC_MOD, "/mod" },
-    /* 711 */ { ud_itab__711, UD_TAB__OPC_MOD, "/mod" },
-    /* 712 */ { ud_itab__712, UD_TAB__OPC_MOD, "/mod" },
-    /* 713 */ { ud_itab__713, UD_TAB__OPC_MOD, "/mod" },
-    /* 714 */ { ud_itab__714, UD_TAB__OPC_MOD, "/mod" },
-    /* 715 */ { ud_itab__715, UD_TAB__OPC_MOD, "/mod" },
-    /* 716 */ { ud_itab__716, UD_TAB__OPC_MOD, "/mod" },
-    /* 717 */ { ud_itab__717, UD_TAB__OPC_MOD, "/mod" },
-    /* 718 */ { ud_itab__718, UD_TAB__OPC_MOD, "/mod" },
-    /* 719 */ { ud_itab__719, UD_TAB__OPC_MOD, "/mod" },
-    /* 720 */ { ud_itab__720, UD_TAB__OPC_MOD, "/mod" },
-    /* 721 */ { ud_itab__721, UD_TAB__OPC_MOD, "/mod" },
-    /* 722 */ { ud_itab__722, UD_TAB__OPC_MOD, "/mod" },
-    /* 723 */ { ud_itab__723, UD_TAB__OPC_MOD, "/mod" },
-    /* 724 */ { ud_itab__724, UD_TAB__OPC_MOD, "/mod" },
-    /* 725 */ { ud_itab__725, UD_TAB__OPC_MOD, "/mod" },
-    /* 726 */ { ud_itab__726, UD_TAB__OPC_MOD, "/mod" },
-    /* 727 */ { ud_itab__727, UD_TAB__OPC_MOD, "/mod" },
-    /* 728 */ { ud_itab__728, UD_TAB__OPC_MOD, "/mod" },
-    /* 729 */ { ud_itab__729, UD_TAB__OPC_MOD, "/mod" },
-    /* 730 */ { ud_itab__730, UD_TAB__OPC_MOD, "/mod" },
-    /* 731 */ { ud_itab__731, UD_TAB__OPC_MOD, "/mod" },
-    /* 732 */ { ud_itab__732, UD_TAB__OPC_MOD, "/mod" },
-    /* 733 */ { ud_itab__733, UD_TAB__OPC_MOD, "/mod" },
-    /* 734 */ { ud_itab__734, UD_TAB__OPC_MOD, "/mod" },
-    /* 735 */ { ud_itab__735, UD_TAB__OPC_MOD, "/mod" },
-    /* 736 */ { ud_itab__736, UD_TAB__OPC_MOD, "/mod" },
-    /* 737 */ { ud_itab__737, UD_TAB__OPC_MOD, "/mod" },
-    /* 738 */ { ud_itab__738, UD_TAB__OPC_MOD, "/mod" },
-    /* 739 */ { ud_itab__739, UD_TAB__OPC_MOD, "/mod" },
-    /* 740 */ { ud_itab__740, UD_TAB__OPC_MOD, "/mod" },
-    /* 741 */ { ud_itab__741, UD_TAB__OPC_MOD, "/mod" },
-    /* 742 */ { ud_itab__742, UD_TAB__OPC_MOD, "/mod" },
-    /* 743 */ { ud_itab__743, UD_TAB__OPC_MOD, "/mod" },
-    /* 744 */ { ud_itab__744, UD_TAB__OPC_MOD, "/mod" },
-    /* 745 */ { ud_itab__745, UD_TAB__OPC_MOD, "/mod" },
-    /* 746 */ { ud_itab__746, UD_TAB__OPC_MOD, "/mod" },
-    /* 747 */ { ud_itab__747, UD_TAB__OPC_MOD, "/mod" },
-    /* 748 */ { ud_itab__748, UD_TAB__OPC_MOD, "/mod" },
-    /* 749 */ { ud_itab__749, UD_TAB__OPC_MOD, "/mod" },
-    /* 750 */ { ud_itab__750, UD_TAB__OPC_MOD, "/mod" },
-    /* 751 */ { ud_itab__751, UD_TAB__OPC_MOD, "/mod" },
-    /* 752 */ { ud_itab__752, UD_TAB__OPC_MOD, "/mod" },
-    /* 753 */ { ud_itab__753, UD_TAB__OPC_MOD, "/mod" },
-    /* 754 */ { ud_itab__754, UD_TAB__OPC_MOD, "/mod" },
-    /* 755 */ { ud_itab__755, UD_TAB__OPC_MOD, "/mod" },
-    /* 756 */ { ud_itab__756, UD_TAB__OPC_MOD, "/mod" },
-    /* 757 */ { ud_itab__757, UD_TAB__OPC_MOD, "/mod" },
-    /* 758 */ { ud_itab__758, UD_TAB__OPC_MOD, "/mod" },
-    /* 759 */ { ud_itab__759, UD_TAB__OPC_MOD, "/mod" },
-    /* 760 */ { ud_itab__760, UD_TAB__OPC_MOD, "/mod" },
-    /* 761 */ { ud_itab__761, UD_TAB__OPC_MOD, "/mod" },
-    /* 762 */ { ud_itab__762, UD_TAB__OPC_MOD, "/mod" },
-    /* 763 */ { ud_itab__763, UD_TAB__OPC_REG, "/reg" },
-    /* 764 */ { ud_itab__764, UD_TAB__OPC_MOD, "/mod" },
-    /* 765 */ { ud_itab__765, UD_TAB__OPC_MOD, "/mod" },
-    /* 766 */ { ud_itab__766, UD_TAB__OPC_MOD, "/mod" },
-    /* 767 */ { ud_itab__767, UD_TAB__OPC_MOD, "/mod" },
-    /* 768 */ { ud_itab__768, UD_TAB__OPC_MOD, "/mod" },
-    /* 769 */ { ud_itab__769, UD_TAB__OPC_MOD, "/mod" },
-    /* 770 */ { ud_itab__770, UD_TAB__OPC_MOD, "/mod" },
-    /* 771 */ { ud_itab__771, UD_TAB__OPC_MOD, "/mod" },
-    /* 772 */ { ud_itab__772, UD_TAB__OPC_X87, "/x87" },
-    /* 773 */ { ud_itab__773, UD_TAB__OPC_MOD, "/mod" },
-    /* 774 */ { ud_itab__774, UD_TAB__OPC_MOD, "/mod" },
-    /* 775 */ { ud_itab__775, UD_TAB__OPC_MOD, "/mod" },
-    /* 776 */ { ud_itab__776, UD_TAB__OPC_MOD, "/mod" },
-    /* 777 */ { ud_itab__777, UD_TAB__OPC_MOD, "/mod" },
-    /* 778 */ { ud_itab__778, UD_TAB__OPC_MOD, "/mod" },
-    /* 779 */ { ud_itab__779, UD_TAB__OPC_MOD, "/mod" },
-    /* 780 */ { ud_itab__780, UD_TAB__OPC_MOD, "/mod" },
-    /* 781 */ { ud_itab__781, UD_TAB__OPC_MOD, "/mod" },
-    /* 782 */ { ud_itab__782, UD_TAB__OPC_MOD, "/mod" },
-    /* 783 */ { ud_itab__783, UD_TAB__OPC_MOD, "/mod" },
-    /* 784 */ { ud_itab__784, UD_TAB__OPC_MOD, "/mod" },
-    /* 785 */ { ud_itab__785, UD_TAB__OPC_MOD, "/mod" },
-    /* 786 */ { ud_itab__786, UD_TAB__OPC_MOD, "/mod" },
-    /* 787 */ { ud_itab__787, UD_TAB__OPC_MOD, "/mod" },
-    /* 788 */ { ud_itab__788, UD_TAB__OPC_MOD, "/mod" },
-    /* 789 */ { ud_itab__789, UD_TAB__OPC_MOD, "/mod" },
-    /* 790 */ { ud_itab__790, UD_TAB__OPC_MOD, "/mod" },
-    /* 791 */ { ud_itab__791, UD_TAB__OPC_MOD, "/mod" },
-    /* 792 */ { ud_itab__792, UD_TAB__OPC_MOD, "/mod" },
-    /* 793 */ { ud_itab__793, UD_TAB__OPC_MOD, "/mod" },
-    /* 794 */ { ud_itab__794, UD_TAB__OPC_MOD, "/mod" },
-    /* 795 */ { ud_itab__795, UD_TAB__OPC_MOD, "/mod" },
-    /* 796 */ { ud_itab__796, UD_TAB__OPC_MOD, "/mod" },
-    /* 797 */ { ud_itab__797, UD_TAB__OPC_MOD, "/mod" },
-    /* 798 */ { ud_itab__798, UD_TAB__OPC_MOD, "/mod" },
-    /* 799 */ { ud_itab__799, UD_TAB__OPC_MOD, "/mod" },
-    /* 800 */ { ud_itab__800, UD_TAB__OPC_MOD, "/mod" },
-    /* 801 */ { ud_itab__801, UD_TAB__OPC_MOD, "/mod" },
-    /* 802 */ { ud_itab__802, UD_TAB__OPC_MOD, "/mod" },
-    /* 803 */ { ud_itab__803, UD_TAB__OPC_MOD, "/mod" },
-    /* 804 */ { ud_itab__804, UD_TAB__OPC_MOD, "/mod" },
-    /* 805 */ { ud_itab__805, UD_TAB__OPC_MOD, "/mod" },
-    /* 806 */ { ud_itab__806, UD_TAB__OPC_MOD, "/mod" },
-    /* 807 */ { ud_itab__807, UD_TAB__OPC_REG, "/reg" },
-    /* 808 */ { ud_itab__808, UD_TAB__OPC_MOD, "/mod" },
-    /* 809 */ { ud_itab__809, UD_TAB__OPC_MOD, "/mod" },
-    /* 810 */ { ud_itab__810, UD_TAB__OPC_MOD, "/mod" },
-    /* 811 */ { ud_itab__811, UD_TAB__OPC_MOD, "/mod" },
-    /* 812 */ { ud_itab__812, UD_TAB__OPC_MOD, "/mod" },
-    /* 813 */ { ud_itab__813, UD_TAB__OPC_MOD, "/mod" },
-    /* 814 */ { ud_itab__814, UD_TAB__OPC_X87, "/x87" },
-    /* 815 */ { ud_itab__815, UD_TAB__OPC_MOD, "/mod" },
-    /* 816 */ { ud_itab__816, UD_TAB__OPC_MOD, "/mod" },
-    /* 817 */ { ud_itab__817, UD_TAB__OPC_MOD, "/mod" },
-    /* 818 */ { ud_itab__818, UD_TAB__OPC_MOD, "/mod" },
-    /* 819 */ { ud_itab__819, UD_TAB__OPC_MOD, "/mod" },
-    /* 820 */ { ud_itab__820, UD_TAB__OPC_MOD, "/mod" },
-    /* 821 */ { ud_itab__821, UD_TAB__OPC_MOD, "/mod" },
-    /* 822 */ { ud_itab__822, UD_TAB__OPC_MOD, "/mod" },
-    /* 823 */ { ud_itab__823, UD_TAB__OPC_MOD, "/mod" },
-    /* 824 */ { ud_itab__824, UD_TAB__OPC_MOD, "/mod" },
-    /* 825 */ { ud_itab__825, UD_TAB__OPC_MOD, "/mod" },
-    /* 826 */ { ud_itab__826, UD_TAB__OPC_MOD, "/mod" },
-    /* 827 */ { ud_itab__827, UD_TAB__OPC_MOD, "/mod" },
-    /* 828 */ { ud_itab__828, UD_TAB__OPC_MOD, "/mod" },
-    /* 829 */ { ud_itab__829, UD_TAB__OPC_MOD, "/mod" },
-    /* 830 */ { ud_itab__830, UD_TAB__OPC_MOD, "/mod" },
-    /* 831 */ { ud_itab__831, UD_TAB__OPC_MOD, "/mod" },
-    /* 832 */ { ud_itab__832, UD_TAB__OPC_MOD, "/mod" },
-    /* 833 */ { ud_itab__833, UD_TAB__OPC_MOD, "/mod" },
-    /* 834 */ { ud_itab__834, UD_TAB__OPC_MOD, "/mod" },
-    /* 835 */ { ud_itab__835, UD_TAB__OPC_MOD, "/mod" },
-    /* 836 */ { ud_itab__836, UD_TAB__OPC_MOD, "/mod" },
-    /* 837 */ { ud_itab__837, UD_TAB__OPC_MOD, "/mod" },
-    /* 838 */ { ud_itab__838, UD_TAB__OPC_MOD, "/mod" },
-    /* 839 */ { ud_itab__839, UD_TAB__OPC_MOD, "/mod" },
-    /* 840 */ { ud_itab__840, UD_TAB__OPC_MOD, "/mod" },
-    /* 841 */ { ud_itab__841, UD_TAB__OPC_MOD, "/mod" },
-    /* 842 */ { ud_itab__842, UD_TAB__OPC_MOD, "/mod" },
-    /* 843 */ { ud_itab__843, UD_TAB__OPC_MOD, "/mod" },
-    /* 844 */ { ud_itab__844, UD_TAB__OPC_MOD, "/mod" },
-    /* 845 */ { ud_itab__845, UD_TAB__OPC_MOD, "/mod" },
-    /* 846 */ { ud_itab__846, UD_TAB__OPC_MOD, "/mod" },
-    /* 847 */ { ud_itab__847, UD_TAB__OPC_MOD, "/mod" },
-    /* 848 */ { ud_itab__848, UD_TAB__OPC_MOD, "/mod" },
-    /* 849 */ { ud_itab__849, UD_TAB__OPC_MOD, "/mod" },
-    /* 850 */ { ud_itab__850, UD_TAB__OPC_MOD, "/mod" },
-    /* 851 */ { ud_itab__851, UD_TAB__OPC_MOD, "/mod" },
-    /* 852 */ { ud_itab__852, UD_TAB__OPC_MOD, "/mod" },
-    /* 853 */ { ud_itab__853, UD_TAB__OPC_MOD, "/mod" },
-    /* 854 */ { ud_itab__854, UD_TAB__OPC_MOD, "/mod" },
-    /* 855 */ { ud_itab__855, UD_TAB__OPC_MOD, "/mod" },
-    /* 856 */ { ud_itab__856, UD_TAB__OPC_MOD, "/mod" },
-    /* 857 */ { ud_itab__857, UD_TAB__OPC_MOD, "/mod" },
-    /* 858 */ { ud_itab__858, UD_TAB__OPC_MOD, "/mod" },
-    /* 859 */ { ud_itab__859, UD_TAB__OPC_MOD, "/mod" },
-    /* 860 */ { ud_itab__860, UD_TAB__OPC_MOD, "/mod" },
-    /* 861 */ { ud_itab__861, UD_TAB__OPC_MOD, "/mod" },
-    /* 862 */ { ud_itab__862, UD_TAB__OPC_MOD, "/mod" },
-    /* 863 */ { ud_itab__863, UD_TAB__OPC_MOD, "/mod" },
-    /* 864 */ { ud_itab__864, UD_TAB__OPC_MOD, "/mod" },
-    /* 865 */ { ud_itab__865, UD_TAB__OPC_MOD, "/mod" },
-    /* 866 */ { ud_itab__866, UD_TAB__OPC_REG, "/reg" },
-    /* 867 */ { ud_itab__867, UD_TAB__OPC_MOD, "/mod" },
-    /* 868 */ { ud_itab__868, UD_TAB__OPC_MOD, "/mod" },
-    /* 869 */ { ud_itab__869, UD_TAB__OPC_MOD, "/mod" },
-    /* 870 */ { ud_itab__870, UD_TAB__OPC_MOD, "/mod" },
-    /* 871 */ { ud_itab__871, UD_TAB__OPC_MOD, "/mod" },
-    /* 872 */ { ud_itab__872, UD_TAB__OPC_MOD, "/mod" },
-    /* 873 */ { ud_itab__873, UD_TAB__OPC_MOD, "/mod" },
-    /* 874 */ { ud_itab__874, UD_TAB__OPC_MOD, "/mod" },
-    /* 875 */ { ud_itab__875, UD_TAB__OPC_X87, "/x87" },
-    /* 876 */ { ud_itab__876, UD_TAB__OPC_MOD, "/mod" },
-    /* 877 */ { ud_itab__877, UD_TAB__OPC_MOD, "/mod" },
-    /* 878 */ { ud_itab__878, UD_TAB__OPC_MOD, "/mod" },
-    /* 879 */ { ud_itab__879, UD_TAB__OPC_MOD, "/mod" },
-    /* 880 */ { ud_itab__880, UD_TAB__OPC_MOD, "/mod" },
-    /* 881 */ { ud_itab__881, UD_TAB__OPC_MOD, "/mod" },
-    /* 882 */ { ud_itab__882, UD_TAB__OPC_MOD, "/mod" },
-    /* 883 */ { ud_itab__883, UD_TAB__OPC_MOD, "/mod" },
-    /* 884 */ { ud_itab__884, UD_TAB__OPC_MOD, "/mod" },
-    /* 885 */ { ud_itab__885, UD_TAB__OPC_MOD, "/mod" },
-    /* 886 */ { ud_itab__886, UD_TAB__OPC_MOD, "/mod" },
-    /* 887 */ { ud_itab__887, UD_TAB__OPC_MOD, "/mod" },
-    /* 888 */ { ud_itab__888, UD_TAB__OPC_MOD, "/mod" },
-    /* 889 */ { ud_itab__889, UD_TAB__OPC_MOD, "/mod" },
-    /* 890 */ { ud_itab__890, UD_TAB__OPC_MOD, "/mod" },
-    /* 891 */ { ud_itab__891, UD_TAB__OPC_MOD, "/mod" },
-    /* 892 */ { ud_itab__892, UD_TAB__OPC_MOD, "/mod" },
-    /* 893 */ { ud_itab__893, UD_TAB__OPC_MOD, "/mod" },
-    /* 894 */ { ud_itab__894, UD_TAB__OPC_MOD, "/mod" },
-    /* 895 */ { ud_itab__895, UD_TAB__OPC_MOD, "/mod" },
-    /* 896 */ { ud_itab__896, UD_TAB__OPC_MOD, "/mod" },
-    /* 897 */ { ud_itab__897, UD_TAB__OPC_MOD, "/mod" },
-    /* 898 */ { ud_itab__898, UD_TAB__OPC_MOD, "/mod" },
-    /* 899 */ { ud_itab__899, UD_TAB__OPC_MOD, "/mod" },
-    /* 900 */ { ud_itab__900, UD_TAB__OPC_MOD, "/mod" },
-    /* 901 */ { ud_itab__901, UD_TAB__OPC_MOD, "/mod" },
-    /* 902 */ { ud_itab__902, UD_TAB__OPC_MOD, "/mod" },
-    /* 903 */ { ud_itab__903, UD_TAB__OPC_MOD, "/mod" },
-    /* 904 */ { ud_itab__904, UD_TAB__OPC_MOD, "/mod" },
-    /* 905 */ { ud_itab__905, UD_TAB__OPC_MOD, "/mod" },
-    /* 906 */ { ud_itab__906, UD_TAB__OPC_MOD, "/mod" },
-    /* 907 */ { ud_itab__907, UD_TAB__OPC_MOD, "/mod" },
-    /* 908 */ { ud_itab__908, UD_TAB__OPC_MOD, "/mod" },
-    /* 909 */ { ud_itab__909, UD_TAB__OPC_MOD, "/mod" },
-    /* 910 */ { ud_itab__910, UD_TAB__OPC_MOD, "/mod" },
-    /* 911 */ { ud_itab__911, UD_TAB__OPC_MOD, "/mod" },
-    /* 912 */ { ud_itab__912, UD_TAB__OPC_MOD, "/mod" },
-    /* 913 */ { ud_itab__913, UD_TAB__OPC_MOD, "/mod" },
-    /* 914 */ { ud_itab__914, UD_TAB__OPC_MOD, "/mod" },
-    /* 915 */ { ud_itab__915, UD_TAB__OPC_MOD, "/mod" },
-    /* 916 */ { ud_itab__916, UD_TAB__OPC_MOD, "/mod" },
-    /* 917 */ { ud_itab__917, UD_TAB__OPC_MOD, "/mod" },
-    /* 918 */ { ud_itab__918, UD_TAB__OPC_MOD, "/mod" },
-    /* 919 */ { ud_itab__919, UD_TAB__OPC_MOD, "/mod" },
-    /* 920 */ { ud_itab__920, UD_TAB__OPC_MOD, "/mod" },
-    /* 921 */ { ud_itab__921, UD_TAB__OPC_MOD, "/mod" },
-    /* 922 */ { ud_itab__922, UD_TAB__OPC_MOD, "/mod" },
-    /* 923 */ { ud_itab__923, UD_TAB__OPC_MOD, "/mod" },
-    /* 924 */ { ud_itab__924, UD_TAB__OPC_MOD, "/mod" },
-    /* 925 */ { ud_itab__925, UD_TAB__OPC_MOD, "/mod" },
-    /* 926 */ { ud_itab__926, UD_TAB__OPC_MOD, "/mod" },
-    /* 927 */ { ud_itab__927, UD_TAB__OPC_MOD, "/mod" },
-    /* 928 */ { ud_itab__928, UD_TAB__OPC_MOD, "/mod" },
-    /* 929 */ { ud_itab__929, UD_TAB__OPC_MOD, "/mod" },
-    /* 930 */ { ud_itab__930, UD_TAB__OPC_MOD, "/mod" },
-    /* 931 */ { ud_itab__931, UD_TAB__OPC_MOD, "/mod" },
-    /* 932 */ { ud_itab__932, UD_TAB__OPC_MOD, "/mod" },
-    /* 933 */ { ud_itab__933, UD_TAB__OPC_MOD, "/mod" },
-    /* 934 */ { ud_itab__934, UD_TAB__OPC_MOD, "/mod" },
-    /* 935 */ { ud_itab__935, UD_TAB__OPC_MOD, "/mod" },
-    /* 936 */ { ud_itab__936, UD_TAB__OPC_MOD, "/mod" },
-    /* 937 */ { ud_itab__937, UD_TAB__OPC_MOD, "/mod" },
-    /* 938 */ { ud_itab__938, UD_TAB__OPC_MOD, "/mod" },
-    /* 939 */ { ud_itab__939, UD_TAB__OPC_MOD, "/mod" },
-    /* 940 */ { ud_itab__940, UD_TAB__OPC_MOD, "/mod" },
-    /* 941 */ { ud_itab__941, UD_TAB__OPC_REG, "/reg" },
-    /* 942 */ { ud_itab__942, UD_TAB__OPC_MOD, "/mod" },
-    /* 943 */ { ud_itab__943, UD_TAB__OPC_MOD, "/mod" },
-    /* 944 */ { ud_itab__944, UD_TAB__OPC_MOD, "/mod" },
-    /* 945 */ { ud_itab__945, UD_TAB__OPC_MOD, "/mod" },
-    /* 946 */ { ud_itab__946, UD_TAB__OPC_MOD, "/mod" },
-    /* 947 */ { ud_itab__947, UD_TAB__OPC_MOD, "/mod" },
-    /* 948 */ { ud_itab__948, UD_TAB__OPC_MOD, "/mod" },
-    /* 949 */ { ud_itab__949, UD_TAB__OPC_X87, "/x87" },
-    /* 950 */ { ud_itab__950, UD_TAB__OPC_MOD, "/mod" },
-    /* 951 */ { ud_itab__951, UD_TAB__OPC_MOD, "/mod" },
-    /* 952 */ { ud_itab__952, UD_TAB__OPC_MOD, "/mod" },
-    /* 953 */ { ud_itab__953, UD_TAB__OPC_MOD, "/mod" },
-    /* 954 */ { ud_itab__954, UD_TAB__OPC_MOD, "/mod" },
-    /* 955 */ { ud_itab__955, UD_TAB__OPC_MOD, "/mod" },
-    /* 956 */ { ud_itab__956, UD_TAB__OPC_MOD, "/mod" },
-    /* 957 */ { ud_itab__957, UD_TAB__OPC_MOD, "/mod" },
-    /* 958 */ { ud_itab__958, UD_TAB__OPC_MOD, "/mod" },
-    /* 959 */ { ud_itab__959, UD_TAB__OPC_MOD, "/mod" },
-    /* 960 */ { ud_itab__960, UD_TAB__OPC_MOD, "/mod" },
-    /* 961 */ { ud_itab__961, UD_TAB__OPC_MOD, "/mod" },
-    /* 962 */ { ud_itab__962, UD_TAB__OPC_MOD, "/mod" },
-    /* 963 */ { ud_itab__963, UD_TAB__OPC_MOD, "/mod" },
-    /* 964 */ { ud_itab__964, UD_TAB__OPC_MOD, "/mod" },
-    /* 965 */ { ud_itab__965, UD_TAB__OPC_MOD, "/mod" },
-    /* 966 */ { ud_itab__966, UD_TAB__OPC_MOD, "/mod" },
-    /* 967 */ { ud_itab__967, UD_TAB__OPC_MOD, "/mod" },
-    /* 968 */ { ud_itab__968, UD_TAB__OPC_MOD, "/mod" },
-    /* 969 */ { ud_itab__969, UD_TAB__OPC_MOD, "/mod" },
-    /* 970 */ { ud_itab__970, UD_TAB__OPC_MOD, "/mod" },
-    /* 971 */ { ud_itab__971, UD_TAB__OPC_MOD, "/mod" },
-    /* 972 */ { ud_itab__972, UD_TAB__OPC_MOD, "/mod" },
-    /* 973 */ { ud_itab__973, UD_TAB__OPC_MOD, "/mod" },
-    /* 974 */ { ud_itab__974, UD_TAB__OPC_MOD, "/mod" },
-    /* 975 */ { ud_itab__975, UD_TAB__OPC_MOD, "/mod" },
-    /* 976 */ { ud_itab__976, UD_TAB__OPC_MOD, "/mod" },
-    /* 977 */ { ud_itab__977, UD_TAB__OPC_MOD, "/mod" },
-    /* 978 */ { ud_itab__978, UD_TAB__OPC_MOD, "/mod" },
-    /* 979 */ { ud_itab__979, UD_TAB__OPC_MOD, "/mod" },
-    /* 980 */ { ud_itab__980, UD_TAB__OPC_MOD, "/mod" },
-    /* 981 */ { ud_itab__981, UD_TAB__OPC_MOD, "/mod" },
-    /* 982 */ { ud_itab__982, UD_TAB__OPC_MOD, "/mod" },
-    /* 983 */ { ud_itab__983, UD_TAB__OPC_MOD, "/mod" },
-    /* 984 */ { ud_itab__984, UD_TAB__OPC_MOD, "/mod" },
-    /* 985 */ { ud_itab__985, UD_TAB__OPC_MOD, "/mod" },
-    /* 986 */ { ud_itab__986, UD_TAB__OPC_MOD, "/mod" },
-    /* 987 */ { ud_itab__987, UD_TAB__OPC_MOD, "/mod" },
-    /* 988 */ { ud_itab__988, UD_TAB__OPC_MOD, "/mod" },
-    /* 989 */ { ud_itab__989, UD_TAB__OPC_MOD, "/mod" },
-    /* 990 */ { ud_itab__990, UD_TAB__OPC_MOD, "/mod" },
-    /* 991 */ { ud_itab__991, UD_TAB__OPC_MOD, "/mod" },
-    /* 992 */ { ud_itab__992, UD_TAB__OPC_MOD, "/mod" },
-    /* 993 */ { ud_itab__993, UD_TAB__OPC_MOD, "/mod" },
-    /* 994 */ { ud_itab__994, UD_TAB__OPC_MOD, "/mod" },
-    /* 995 */ { ud_itab__995, UD_TAB__OPC_MOD, "/mod" },
-    /* 996 */ { ud_itab__996, UD_TAB__OPC_MOD, "/mod" },
-    /* 997 */ { ud_itab__997, UD_TAB__OPC_MOD, "/mod" },
-    /* 998 */ { ud_itab__998, UD_TAB__OPC_MOD, "/mod" },
-    /* 999 */ { ud_itab__999, UD_TAB__OPC_REG, "/reg" },
-    /* 1000 */ { ud_itab__1000, UD_TAB__OPC_MOD, "/mod" },
-    /* 1001 */ { ud_itab__1001, UD_TAB__OPC_MOD, "/mod" },
-    /* 1002 */ { ud_itab__1002, UD_TAB__OPC_MOD, "/mod" },
-    /* 1003 */ { ud_itab__1003, UD_TAB__OPC_MOD, "/mod" },
-    /* 1004 */ { ud_itab__1004, UD_TAB__OPC_MOD, "/mod" },
-    /* 1005 */ { ud_itab__1005, UD_TAB__OPC_MOD, "/mod" },
-    /* 1006 */ { ud_itab__1006, UD_TAB__OPC_MOD, "/mod" },
-    /* 1007 */ { ud_itab__1007, UD_TAB__OPC_MOD, "/mod" },
-    /* 1008 */ { ud_itab__1008, UD_TAB__OPC_X87, "/x87" },
-    /* 1009 */ { ud_itab__1009, UD_TAB__OPC_MOD, "/mod" },
-    /* 1010 */ { ud_itab__1010, UD_TAB__OPC_MOD, "/mod" },
-    /* 1011 */ { ud_itab__1011, UD_TAB__OPC_MOD, "/mod" },
-    /* 1012 */ { ud_itab__1012, UD_TAB__OPC_MOD, "/mod" },
-    /* 1013 */ { ud_itab__1013, UD_TAB__OPC_MOD, "/mod" },
-    /* 1014 */ { ud_itab__1014, UD_TAB__OPC_MOD, "/mod" },
-    /* 1015 */ { ud_itab__1015, UD_TAB__OPC_MOD, "/mod" },
-    /* 1016 */ { ud_itab__1016, UD_TAB__OPC_MOD, "/mod" },
-    /* 1017 */ { ud_itab__1017, UD_TAB__OPC_MOD, "/mod" },
-    /* 1018 */ { ud_itab__1018, UD_TAB__OPC_MOD, "/mod" },
-    /* 1019 */ { ud_itab__1019, UD_TAB__OPC_MOD, "/mod" },
-    /* 1020 */ { ud_itab__1020, UD_TAB__OPC_MOD, "/mod" },
-    /* 1021 */ { ud_itab__1021, UD_TAB__OPC_MOD, "/mod" },
-    /* 1022 */ { ud_itab__1022, UD_TAB__OPC_MOD, "/mod" },
-    /* 1023 */ { ud_itab__1023, UD_TAB__OPC_MOD, "/mod" },
-    /* 1024 */ { ud_itab__1024, UD_TAB__OPC_MOD, "/mod" },
-    /* 1025 */ { ud_itab__1025, UD_TAB__OPC_MOD, "/mod" },
-    /* 1026 */ { ud_itab__1026, UD_TAB__OPC_MOD, "/mod" },
-    /* 1027 */ { ud_itab__1027, UD_TAB__OPC_MOD, "/mod" },
-    /* 1028 */ { ud_itab__1028, UD_TAB__OPC_MOD, "/mod" },
-    /* 1029 */ { ud_itab__1029, UD_TAB__OPC_MOD, "/mod" },
-    /* 1030 */ { ud_itab__1030, UD_TAB__OPC_MOD, "/mod" },
-    /* 1031 */ { ud_itab__1031, UD_TAB__OPC_MOD, "/mod" },
-    /* 1032 */ { ud_itab__1032, UD_TAB__OPC_MOD, "/mod" },
-    /* 1033 */ { ud_itab__1033, UD_TAB__OPC_MOD, "/mod" },
-    /* 1034 */ { ud_itab__1034, UD_TAB__OPC_MOD, "/mod" },
-    /* 1035 */ { ud_itab__1035, UD_TAB__OPC_MOD, "/mod" },
-    /* 1036 */ { ud_itab__1036, UD_TAB__OPC_MOD, "/mod" },
-    /* 1037 */ { ud_itab__1037, UD_TAB__OPC_MOD, "/mod" },
-    /* 1038 */ { ud_itab__1038, UD_TAB__OPC_MOD, "/mod" },
-    /* 1039 */ { ud_itab__1039, UD_TAB__OPC_MOD, "/mod" },
-    /* 1040 */ { ud_itab__1040, UD_TAB__OPC_MOD, "/mod" },
-    /* 1041 */ { ud_itab__1041, UD_TAB__OPC_MOD, "/mod" },
-    /* 1042 */ { ud_itab__1042, UD_TAB__OPC_MOD, "/mod" },
-    /* 1043 */ { ud_itab__1043, UD_TAB__OPC_MOD, "/mod" },
-    /* 1044 */ { ud_itab__1044, UD_TAB__OPC_MOD, "/mod" },
-    /* 1045 */ { ud_itab__1045, UD_TAB__OPC_MOD, "/mod" },
-    /* 1046 */ { ud_itab__1046, UD_TAB__OPC_MOD, "/mod" },
-    /* 1047 */ { ud_itab__1047, UD_TAB__OPC_MOD, "/mod" },
-    /* 1048 */ { ud_itab__1048, UD_TAB__OPC_MOD, "/mod" },
-    /* 1049 */ { ud_itab__1049, UD_TAB__OPC_MOD, "/mod" },
-    /* 1050 */ { ud_itab__1050, UD_TAB__OPC_MOD, "/mod" },
-    /* 1051 */ { ud_itab__1051, UD_TAB__OPC_MOD, "/mod" },
-    /* 1052 */ { ud_itab__1052, UD_TAB__OPC_MOD, "/mod" },
-    /* 1053 */ { ud_itab__1053, UD_TAB__OPC_MOD, "/mod" },
-    /* 1054 */ { ud_itab__1054, UD_TAB__OPC_MOD, "/mod" },
-    /* 1055 */ { ud_itab__1055, UD_TAB__OPC_MOD, "/mod" },
-    /* 1056 */ { ud_itab__1056, UD_TAB__OPC_MOD, "/mod" },
-    /* 1057 */ { ud_itab__1057, UD_TAB__OPC_MOD, "/mod" },
-    /* 1058 */ { ud_itab__1058, UD_TAB__OPC_MOD, "/mod" },
-    /* 1059 */ { ud_itab__1059, UD_TAB__OPC_MOD, "/mod" },
-    /* 1060 */ { ud_itab__1060, UD_TAB__OPC_MOD, "/mod" },
-    /* 1061 */ { ud_itab__1061, UD_TAB__OPC_MOD, "/mod" },
-    /* 1062 */ { ud_itab__1062, UD_TAB__OPC_MOD, "/mod" },
-    /* 1063 */ { ud_itab__1063, UD_TAB__OPC_MOD, "/mod" },
-    /* 1064 */ { ud_itab__1064, UD_TAB__OPC_MOD, "/mod" },
-    /* 1065 */ { ud_itab__1065, UD_TAB__OPC_MOD, "/mod" },
-    /* 1066 */ { ud_itab__1066, UD_TAB__OPC_MOD, "/mod" },
-    /* 1067 */ { ud_itab__1067, UD_TAB__OPC_REG, "/reg" },
-    /* 1068 */ { ud_itab__1068, UD_TAB__OPC_MOD, "/mod" },
-    /* 1069 */ { ud_itab__1069, UD_TAB__OPC_MOD, "/mod" },
-    /* 1070 */ { ud_itab__1070, UD_TAB__OPC_MOD, "/mod" },
-    /* 1071 */ { ud_itab__1071, UD_TAB__OPC_MOD, "/mod" },
-    /* 1072 */ { ud_itab__1072, UD_TAB__OPC_MOD, "/mod" },
-    /* 1073 */ { ud_itab__1073, UD_TAB__OPC_MOD, "/mod" },
-    /* 1074 */ { ud_itab__1074, UD_TAB__OPC_MOD, "/mod" },
-    /* 1075 */ { ud_itab__1075, UD_TAB__OPC_MOD, "/mod" },
-    /* 1076 */ { ud_itab__1076, UD_TAB__OPC_X87, "/x87" },
-    /* 1077 */ { ud_itab__1077, UD_TAB__OPC_MOD, "/mod" },
-    /* 1078 */ { ud_itab__1078, UD_TAB__OPC_MOD, "/mod" },
-    /* 1079 */ { ud_itab__1079, UD_TAB__OPC_MOD, "/mod" },
-    /* 1080 */ { ud_itab__1080, UD_TAB__OPC_MOD, "/mod" },
-    /* 1081 */ { ud_itab__1081, UD_TAB__OPC_MOD, "/mod" },
-    /* 1082 */ { ud_itab__1082, UD_TAB__OPC_MOD, "/mod" },
-    /* 1083 */ { ud_itab__1083, UD_TAB__OPC_MOD, "/mod" },
-    /* 1084 */ { ud_itab__1084, UD_TAB__OPC_MOD, "/mod" },
-    /* 1085 */ { ud_itab__1085, UD_TAB__OPC_MOD, "/mod" },
-    /* 1086 */ { ud_itab__1086, UD_TAB__OPC_MOD, "/mod" },
-    /* 1087 */ { ud_itab__1087, UD_TAB__OPC_MOD, "/mod" },
-    /* 1088 */ { ud_itab__1088, UD_TAB__OPC_MOD, "/mod" },
-    /* 1089 */ { ud_itab__1089, UD_TAB__OPC_MOD, "/mod" },
-    /* 1090 */ { ud_itab__1090, UD_TAB__OPC_MOD, "/mod" },
-    /* 1091 */ { ud_itab__1091, UD_TAB__OPC_MOD, "/mod" },
-    /* 1092 */ { ud_itab__1092, UD_TAB__OPC_MOD, "/mod" },
-    /* 1093 */ { ud_itab__1093, UD_TAB__OPC_MOD, "/mod" },
-    /* 1094 */ { ud_itab__1094, UD_TAB__OPC_MOD, "/mod" },
-    /* 1095 */ { ud_itab__1095, UD_TAB__OPC_MOD, "/mod" },
-    /* 1096 */ { ud_itab__1096, UD_TAB__OPC_MOD, "/mod" },
-    /* 1097 */ { ud_itab__1097, UD_TAB__OPC_MOD, "/mod" },
-    /* 1098 */ { ud_itab__1098, UD_TAB__OPC_MOD, "/mod" },
-    /* 1099 */ { ud_itab__1099, UD_TAB__OPC_MOD, "/mod" },
-    /* 1100 */ { ud_itab__1100, UD_TAB__OPC_MOD, "/mod" },
-    /* 1101 */ { ud_itab__1101, UD_TAB__OPC_MOD, "/mod" },
-    /* 1102 */ { ud_itab__1102, UD_TAB__OPC_MOD, "/mod" },
-    /* 1103 */ { ud_itab__1103, UD_TAB__OPC_MOD, "/mod" },
-    /* 1104 */ { ud_itab__1104, UD_TAB__OPC_MOD, "/mod" },
-    /* 1105 */ { ud_itab__1105, UD_TAB__OPC_MOD, "/mod" },
-    /* 1106 */ { ud_itab__1106, UD_TAB__OPC_MOD, "/mod" },
-    /* 1107 */ { ud_itab__1107, UD_TAB__OPC_MOD, "/mod" },
-    /* 1108 */ { ud_itab__1108, UD_TAB__OPC_MOD, "/mod" },
-    /* 1109 */ { ud_itab__1109, UD_TAB__OPC_MOD, "/mod" },
-    /* 1110 */ { ud_itab__1110, UD_TAB__OPC_MOD, "/mod" },
-    /* 1111 */ { ud_itab__1111, UD_TAB__OPC_MOD, "/mod" },
-    /* 1112 */ { ud_itab__1112, UD_TAB__OPC_MOD, "/mod" },
-    /* 1113 */ { ud_itab__1113, UD_TAB__OPC_MOD, "/mod" },
-    /* 1114 */ { ud_itab__1114, UD_TAB__OPC_MOD, "/mod" },
-    /* 1115 */ { ud_itab__1115, UD_TAB__OPC_MOD, "/mod" },
-    /* 1116 */ { ud_itab__1116, UD_TAB__OPC_MOD, "/mod" },
-    /* 1117 */ { ud_itab__1117, UD_TAB__OPC_MOD, "/mod" },
-    /* 1118 */ { ud_itab__1118, UD_TAB__OPC_MOD, "/mod" },
-    /* 1119 */ { ud_itab__1119, UD_TAB__OPC_MOD, "/mod" },
-    /* 1120 */ { ud_itab__1120, UD_TAB__OPC_MOD, "/mod" },
-    /* 1121 */ { ud_itab__1121, UD_TAB__OPC_MOD, "/mod" },
-    /* 1122 */ { ud_itab__1122, UD_TAB__OPC_MOD, "/mod" },
-    /* 1123 */ { ud_itab__1123, UD_TAB__OPC_MOD, "/mod" },
-    /* 1124 */ { ud_itab__1124, UD_TAB__OPC_MOD, "/mod" },
-    /* 1125 */ { ud_itab__1125, UD_TAB__OPC_MOD, "/mod" },
-    /* 1126 */ { ud_itab__1126, UD_TAB__OPC_ASIZE, "/a" },
-    /* 1127 */ { ud_itab__1127, UD_TAB__OPC_MODE, "/m" },
-    /* 1128 */ { ud_itab__1128, UD_TAB__OPC_REG, "/reg" },
-    /* 1129 */ { ud_itab__1129, UD_TAB__OPC_REG, "/reg" },
-    /* 1130 */ { ud_itab__1130, UD_TAB__OPC_REG, "/reg" },
-    /* 1131 */ { ud_itab__1131, UD_TAB__OPC_REG, "/reg" },
-    /* 1132 */ { ud_itab__1132, UD_TAB__OPC_MODE, "/m" },
+const struct ud_lookup_table_list_entry ud_lookup_table_list[] = {
+    /* 000 */ {     0, UD_TAB__OPC_TABLE }, /* table0 */
+    /* 001 */ {   256, UD_TAB__OPC_MODE }, /* /m */
+    /* 002 */ {   258, UD_TAB__OPC_MODE }, /* /m */
+    /* 003 */ {   260, UD_TAB__OPC_MODE }, /* /m */
+    /* 004 */ {   262, UD_TAB__OPC_TABLE }, /* 0f */
+    /* 005 */ {   518, UD_TAB__OPC_REG }, /* /reg */
+    /* 006 */ {   526, UD_TAB__OPC_SSE }, /* /sse */
+    /* 007 */ {   530, UD_TAB__OPC_SSE }, /* /sse */
+    /* 008 */ {   534, UD_TAB__OPC_SSE }, /* /sse */
+    /* 009 */ {   538, UD_TAB__OPC_SSE }, /* /sse */
+    /* 010 */ {   542, UD_TAB__OPC_SSE }, /* /sse */
+    /* 011 */ {   546, UD_TAB__OPC_SSE }, /* /sse */
+    /* 012 */ {   550, UD_TAB__OPC_MOD }, /* /mod */
+    /* 013 */ {   552, UD_TAB__OPC_REG }, /* /reg */
+    /* 014 */ {   560, UD_TAB__OPC_SSE }, /* /sse */
+    /* 015 */ {   564, UD_TAB__OPC_MOD }, /* /mod */
+    /* 016 */ {   566, UD_TAB__OPC_SSE }, /* /sse */
+    /* 017 */ {   570, UD_TAB__OPC_MOD }, /* /mod */
+    /* 018 */ {   572, UD_TAB__OPC_SSE }, /* /sse */
+    /* 019 */ {   576, UD_TAB__OPC_MOD }, /* /mod */
+    /* 020 */ {   578, UD_TAB__OPC_SSE }, /* /sse */
+    /* 021 */ {   582, UD_TAB__OPC_MOD }, /* /mod */
+    /* 022 */ {   584, UD_TAB__OPC_SSE }, /* /sse */
+    /* 023 */ {   588, UD_TAB__OPC_MOD }, /* /mod */
+    /* 024 */ {   590, UD_TAB__OPC_SSE }, /* /sse */
+    /* 025 */ {   594, UD_TAB__OPC_MOD }, /* /mod */
+    /* 026 */ {   596, UD_TAB__OPC_SSE }, /* /sse */
+    /* 027 */ {   600, UD_TAB__OPC_MOD }, /* /mod */
+    /* 028 */ {   602, UD_TAB__OPC_REG }, /* /reg */
+    /* 029 */ {   610, UD_TAB__OPC_RM }, /* /rm */
+    /* 030 */ {   618, UD_TAB__OPC_SSE }, /* /sse */
+    /* 031 */ {   622, UD_TAB__OPC_MOD }, /* /mod */
+    /* 032 */ {   624, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 033 */ {   627, UD_TAB__OPC_SSE }, /* /sse */
+    /* 034 */ {   631, UD_TAB__OPC_MOD }, /* /mod */
+    /* 035 */ {   633, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 036 */ {   636, UD_TAB__OPC_SSE }, /* /sse */
+    /* 037 */ {   640, UD_TAB__OPC_MOD }, /* /mod */
+    /* 038 */ {   642, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 039 */ {   645, UD_TAB__OPC_SSE }, /* /sse */
+    /* 040 */ {   649, UD_TAB__OPC_MOD }, /* /mod */
+    /* 041 */ {   651, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 042 */ {   654, UD_TAB__OPC_RM }, /* /rm */
+    /* 043 */ {   662, UD_TAB__OPC_SSE }, /* /sse */
+    /* 044 */ {   666, UD_TAB__OPC_MOD }, /* /mod */
+    /* 045 */ {   668, UD_TAB__OPC_SSE }, /* /sse */
+    /* 046 */ {   672, UD_TAB__OPC_MOD }, /* /mod */
+    /* 047 */ {   674, UD_TAB__OPC_RM }, /* /rm */
+    /* 048 */ {   682, UD_TAB__OPC_SSE }, /* /sse */
+    /* 049 */ {   686, UD_TAB__OPC_MOD }, /* /mod */
+    /* 050 */ {   688, UD_TAB__OPC_SSE }, /* /sse */
+    /* 051 */ {   692, UD_TAB__OPC_MOD }, /* /mod */
+    /* 052 */ {   694, UD_TAB__OPC_RM }, /* /rm */
+    /* 053 */ {   702, UD_TAB__OPC_SSE }, /* /sse */
+    /* 054 */ {   706, UD_TAB__OPC_MOD }, /* /mod */
+    /* 055 */ {   708, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 056 */ {   711, UD_TAB__OPC_SSE }, /* /sse */
+    /* 057 */ {   715, UD_TAB__OPC_MOD }, /* /mod */
+    /* 058 */ {   717, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 059 */ {   720, UD_TAB__OPC_SSE }, /* /sse */
+    /* 060 */ {   724, UD_TAB__OPC_MOD }, /* /mod */
+    /* 061 */ {   726, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 062 */ {   729, UD_TAB__OPC_SSE }, /* /sse */
+    /* 063 */ {   733, UD_TAB__OPC_MOD }, /* /mod */
+    /* 064 */ {   735, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 065 */ {   738, UD_TAB__OPC_SSE }, /* /sse */
+    /* 066 */ {   742, UD_TAB__OPC_MOD }, /* /mod */
+    /* 067 */ {   744, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 068 */ {   747, UD_TAB__OPC_SSE }, /* /sse */
+    /* 069 */ {   751, UD_TAB__OPC_MOD }, /* /mod */
+    /* 070 */ {   753, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 071 */ {   756, UD_TAB__OPC_SSE }, /* /sse */
+    /* 072 */ {   760, UD_TAB__OPC_MOD }, /* /mod */
+    /* 073 */ {   762, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 074 */ {   765, UD_TAB__OPC_SSE }, /* /sse */
+    /* 075 */ {   769, UD_TAB__OPC_MOD }, /* /mod */
+    /* 076 */ {   771, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 077 */ {   774, UD_TAB__OPC_SSE }, /* /sse */
+    /* 078 */ {   778, UD_TAB__OPC_MOD }, /* /mod */
+    /* 079 */ {   780, UD_TAB__OPC_SSE }, /* /sse */
+    /* 080 */ {   784, UD_TAB__OPC_MOD }, /* /mod */
+    /* 081 */ {   786, UD_TAB__OPC_RM }, /* /rm */
+    /* 082 */ {   794, UD_TAB__OPC_SSE }, /* /sse */
+    /* 083 */ {   798, UD_TAB__OPC_MOD }, /* /mod */
+    /* 084 */ {   800, UD_TAB__OPC_SSE }, /* /sse */
+    /* 085 */ {   804, UD_TAB__OPC_MOD }, /* /mod */
+    /* 086 */ {   806, UD_TAB__OPC_VENDOR }, /* amd */
+    /* 087 */ {   809, UD_TAB__OPC_SSE }, /* /sse */
+    /* 088 */ {   813, UD_TAB__OPC_SSE }, /* /sse */
+    /* 089 */ {   817, UD_TAB__OPC_SSE }, /* /sse */
+    /* 090 */ {   821, UD_TAB__OPC_SSE }, /* /sse */
+    /* 091 */ {   825, UD_TAB__OPC_SSE }, /* /sse */
+    /* 092 */ {   829, UD_TAB__OPC_SSE }, /* /sse */
+    /* 093 */ {   833, UD_TAB__OPC_SSE }, /* /sse */
+    /* 094 */ {   837, UD_TAB__OPC_SSE }, /* /sse */
+    /* 095 */ {   841, UD_TAB__OPC_REG }, /* /reg */
+    /* 096 */ {   849, UD_TAB__OPC_SSE }, /* /sse */
+    /* 097 */ {   853, UD_TAB__OPC_SSE }, /* /sse */
+    /* 098 */ {   857, UD_TAB__OPC_SSE }, /* /sse */
+    /* 099 */ {   861, UD_TAB__OPC_SSE }, /* /sse */
+    /* 100 */ {   865, UD_TAB__OPC_SSE }, /* /sse */
+    /* 101 */ {   869, UD_TAB__OPC_SSE }, /* /sse */
+    /* 102 */ {   873, UD_TAB__OPC_SSE }, /* /sse */
+    /* 103 */ {   877, UD_TAB__OPC_SSE }, /* /sse */
+    /* 104 */ {   881, UD_TAB__OPC_SSE }, /* /sse */
+    /* 105 */ {   885, UD_TAB__OPC_3DNOW }, /* /3dnow */
+    /* 106 */ {  1141, UD_TAB__OPC_SSE }, /* /sse */
+    /* 107 */ {  1145, UD_TAB__OPC_SSE }, /* /sse */
+    /* 108 */ {  1149, UD_TAB__OPC_MOD }, /* /mod */
+    /* 109 */ {  1151, UD_TAB__OPC_SSE }, /* /sse */
+    /* 110 */ {  1155, UD_TAB__OPC_MOD }, /* /mod */
+    /* 111 */ {  1157, UD_TAB__OPC_MOD }, /* /mod */
+    /* 112 */ {  1159, UD_TAB__OPC_MOD }, /* /mod */
+    /* 113 */ {  1161, UD_TAB__OPC_MOD }, /* /mod */
+    /* 114 */ {  1163, UD_TAB__OPC_SSE }, /* /sse */
+    /* 115 */ {  1167, UD_TAB__OPC_MOD }, /* /mod */
+    /* 116 */ {  1169, UD_TAB__OPC_MOD }, /* /mod */
+    /* 117 */ {  1171, UD_TAB__OPC_MOD }, /* /mod */
+    /* 118 */ {  1173, UD_TAB__OPC_SSE }, /* /sse */
+    /* 119 */ {  1177, UD_TAB__OPC_SSE }, /* /sse */
+    /* 120 */ {  1181, UD_TAB__OPC_SSE }, /* /sse */
+    /* 121 */ {  1185, UD_TAB__OPC_MOD }, /* /mod */
+    /* 122 */ {  1187, UD_TAB__OPC_SSE }, /* /sse */
+    /* 123 */ {  1191, UD_TAB__OPC_MOD }, /* /mod */
+    /* 124 */ {  1193, UD_TAB__OPC_MOD }, /* /mod */
+    /* 125 */ {  1195, UD_TAB__OPC_MOD }, /* /mod */
+    /* 126 */ {  1197, UD_TAB__OPC_SSE }, /* /sse */
+    /* 127 */ {  1201, UD_TAB__OPC_MOD }, /* /mod */
+    /* 128 */ {  1203, UD_TAB__OPC_MOD }, /* /mod */
+    /* 129 */ {  1205, UD_TAB__OPC_SSE }, /* /sse */
+    /* 130 */ {  1209, UD_TAB__OPC_REG }, /* /reg */
+    /* 131 */ {  1217, UD_TAB__OPC_SSE }, /* /sse */
+    /* 132 */ {  1221, UD_TAB__OPC_SSE }, /* /sse */
+    /* 133 */ {  1225, UD_TAB__OPC_SSE }, /* /sse */
+    /* 134 */ {  1229, UD_TAB__OPC_SSE }, /* /sse */
+    /* 135 */ {  1233, UD_TAB__OPC_SSE }, /* /sse */
+    /* 136 */ {  1237, UD_TAB__OPC_SSE }, /* /sse */
+    /* 137 */ {  1241, UD_TAB__OPC_SSE }, /* /sse */
+    /* 138 */ {  1245, UD_TAB__OPC_SSE }, /* /sse */
+    /* 139 */ {  1249, UD_TAB__OPC_SSE }, /* /sse */
+    /* 140 */ {  1253, UD_TAB__OPC_SSE }, /* /sse */
+    /* 141 */ {  1257, UD_TAB__OPC_SSE }, /* /sse */
+    /* 142 */ {  1261, UD_TAB__OPC_SSE }, /* /sse */
+    /* 143 */ {  1265, UD_TAB__OPC_SSE }, /* /sse */
+    /* 144 */ {  1269, UD_TAB__OPC_SSE }, /* /sse */
+    /* 145 */ {  1273, UD_TAB__OPC_SSE }, /* /sse */
+    /* 146 */ {  1277, UD_TAB__OPC_SSE }, /* /sse */
+    /* 147 */ {  1281, UD_TAB__OPC_SSE }, /* /sse */
+    /* 148 */ {  1285, UD_TAB__OPC_SSE }, /* /sse */
+    /* 149 */ {  1289, UD_TAB__OPC_SSE }, /* /sse */
+    /* 150 */ {  1293, UD_TAB__OPC_SSE }, /* /sse */
+    /* 151 */ {  1297, UD_TAB__OPC_SSE }, /* /sse */
+    /* 152 */ {  1301, UD_TAB__OPC_SSE }, /* /sse */
+    /* 153 */ {  1305, UD_TAB__OPC_SSE }, /* /sse */
+    /* 154 */ {  1309, UD_TAB__OPC_SSE }, /* /sse */
+    /* 155 */ {  1313, UD_TAB__OPC_SSE }, /* /sse */
+    /* 156 */ {  1317, UD_TAB__OPC_SSE }, /* /sse */
+    /* 157 */ {  1321, UD_TAB__OPC_SSE }, /* /sse */
+    /* 158 */ {  1325, UD_TAB__OPC_SSE }, /* /sse */
+    /* 159 */ {  1329, UD_TAB__OPC_MODE }, /* /m */
+    /* 160 */ {  1331, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 161 */ {  1334, UD_TAB__OPC_SSE }, /* /sse */
+    /* 162 */ {  1338, UD_TAB__OPC_MODE }, /* /m */
+    /* 163 */ {  1340, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 164 */ {  1343, UD_TAB__OPC_SSE }, /* /sse */
+    /* 165 */ {  1347, UD_TAB__OPC_TABLE }, /* 38 */
+    /* 166 */ {  1603, UD_TAB__OPC_SSE }, /* /sse */
+    /* 167 */ {  1607, UD_TAB__OPC_SSE }, /* /sse */
+    /* 168 */ {  1611, UD_TAB__OPC_SSE }, /* /sse */
+    /* 169 */ {  1615, UD_TAB__OPC_SSE }, /* /sse */
+    /* 170 */ {  1619, UD_TAB__OPC_SSE }, /* /sse */
+    /* 171 */ {  1623, UD_TAB__OPC_SSE }, /* /sse */
+    /* 172 */ {  1627, UD_TAB__OPC_SSE }, /* /sse */
+    /* 173 */ {  1631, UD_TAB__OPC_SSE }, /* /sse */
+    /* 174 */ {  1635, UD_TAB__OPC_SSE }, /* /sse */
+    /* 175 */ {  1639, UD_TAB__OPC_SSE }, /* /sse */
+    /* 176 */ {  1643, UD_TAB__OPC_SSE }, /* /sse */
+    /* 177 */ {  1647, UD_TAB__OPC_SSE }, /* /sse */
+    /* 178 */ {  1651, UD_TAB__OPC_SSE }, /* /sse */
+    /* 179 */ {  1655, UD_TAB__OPC_SSE }, /* /sse */
+    /* 180 */ {  1659, UD_TAB__OPC_SSE }, /* /sse */
+    /* 181 */ {  1663, UD_TAB__OPC_SSE }, /* /sse */
+    /* 182 */ {  1667, UD_TAB__OPC_SSE }, /* /sse */
+    /* 183 */ {  1671, UD_TAB__OPC_SSE }, /* /sse */
+    /* 184 */ {  1675, UD_TAB__OPC_SSE }, /* /sse */
+    /* 185 */ {  1679, UD_TAB__OPC_SSE }, /* /sse */
+    /* 186 */ {  1683, UD_TAB__OPC_SSE }, /* /sse */
+    /* 187 */ {  1687, UD_TAB__OPC_SSE }, /* /sse */
+    /* 188 */ {  1691, UD_TAB__OPC_SSE }, /* /sse */
+    /* 189 */ {  1695, UD_TAB__OPC_SSE }, /* /sse */
+    /* 190 */ {  1699, UD_TAB__OPC_SSE }, /* /sse */
+    /* 191 */ {  1703, UD_TAB__OPC_SSE }, /* /sse */
+    /* 192 */ {  1707, UD_TAB__OPC_SSE }, /* /sse */
+    /* 193 */ {  1711, UD_TAB__OPC_SSE }, /* /sse */
+    /* 194 */ {  1715, UD_TAB__OPC_SSE }, /* /sse */
+    /* 195 */ {  1719, UD_TAB__OPC_SSE }, /* /sse */
+    /* 196 */ {  1723, UD_TAB__OPC_SSE }, /* /sse */
+    /* 197 */ {  1727, UD_TAB__OPC_SSE }, /* /sse */
+    /* 198 */ {  1731, UD_TAB__OPC_SSE }, /* /sse */
+    /* 199 */ {  1735, UD_TAB__OPC_SSE }, /* /sse */
+    /* 200 */ {  1739, UD_TAB__OPC_SSE }, /* /sse */
+    /* 201 */ {  1743, UD_TAB__OPC_SSE }, /* /sse */
+    /* 202 */ {  1747, UD_TAB__OPC_SSE }, /* /sse */
+    /* 203 */ {  1751, UD_TAB__OPC_SSE }, /* /sse */
+    /* 204 */ {  1755, UD_TAB__OPC_SSE }, /* /sse */
+    /* 205 */ {  1759, UD_TAB__OPC_SSE }, /* /sse */
+    /* 206 */ {  1763, UD_TAB__OPC_SSE }, /* /sse */
+    /* 207 */ {  1767, UD_TAB__OPC_SSE }, /* /sse */
+    /* 208 */ {  1771, UD_TAB__OPC_SSE }, /* /sse */
+    /* 209 */ {  1775, UD_TAB__OPC_SSE }, /* /sse */
+    /* 210 */ {  1779, UD_TAB__OPC_SSE }, /* /sse */
+    /* 211 */ {  1783, UD_TAB__OPC_SSE }, /* /sse */
+    /* 212 */ {  1787, UD_TAB__OPC_SSE }, /* /sse */
+    /* 213 */ {  1791, UD_TAB__OPC_MODE }, /* /m */
+    /* 214 */ {  1793, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 215 */ {  1796, UD_TAB__OPC_SSE }, /* /sse */
+    /* 216 */ {  1800, UD_TAB__OPC_MODE }, /* /m */
+    /* 217 */ {  1802, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 218 */ {  1805, UD_TAB__OPC_SSE }, /* /sse */
+    /* 219 */ {  1809, UD_TAB__OPC_SSE }, /* /sse */
+    /* 220 */ {  1813, UD_TAB__OPC_SSE }, /* /sse */
+    /* 221 */ {  1817, UD_TAB__OPC_SSE }, /* /sse */
+    /* 222 */ {  1821, UD_TAB__OPC_SSE }, /* /sse */
+    /* 223 */ {  1825, UD_TAB__OPC_SSE }, /* /sse */
+    /* 224 */ {  1829, UD_TAB__OPC_SSE }, /* /sse */
+    /* 225 */ {  1833, UD_TAB__OPC_TABLE }, /* 3a */
+    /* 226 */ {  2089, UD_TAB__OPC_SSE }, /* /sse */
+    /* 227 */ {  2093, UD_TAB__OPC_SSE }, /* /sse */
+    /* 228 */ {  2097, UD_TAB__OPC_SSE }, /* /sse */
+    /* 229 */ {  2101, UD_TAB__OPC_SSE }, /* /sse */
+    /* 230 */ {  2105, UD_TAB__OPC_SSE }, /* /sse */
+    /* 231 */ {  2109, UD_TAB__OPC_SSE }, /* /sse */
+    /* 232 */ {  2113, UD_TAB__OPC_SSE }, /* /sse */
+    /* 233 */ {  2117, UD_TAB__OPC_SSE }, /* /sse */
+    /* 234 */ {  2121, UD_TAB__OPC_SSE }, /* /sse */
+    /* 235 */ {  2125, UD_TAB__OPC_SSE }, /* /sse */
+    /* 236 */ {  2129, UD_TAB__OPC_SSE }, /* /sse */
+    /* 237 */ {  2133, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 238 */ {  2136, UD_TAB__OPC_SSE }, /* /sse */
+    /* 239 */ {  2140, UD_TAB__OPC_SSE }, /* /sse */
+    /* 240 */ {  2144, UD_TAB__OPC_SSE }, /* /sse */
+    /* 241 */ {  2148, UD_TAB__OPC_SSE }, /* /sse */
+    /* 242 */ {  2152, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 243 */ {  2155, UD_TAB__OPC_SSE }, /* /sse */
+    /* 244 */ {  2159, UD_TAB__OPC_SSE }, /* /sse */
+    /* 245 */ {  2163, UD_TAB__OPC_SSE }, /* /sse */
+    /* 246 */ {  2167, UD_TAB__OPC_SSE }, /* /sse */
+    /* 247 */ {  2171, UD_TAB__OPC_SSE }, /* /sse */
+    /* 248 */ {  2175, UD_TAB__OPC_SSE }, /* /sse */
+    /* 249 */ {  2179, UD_TAB__OPC_SSE }, /* /sse */
+    /* 250 */ {  2183, UD_TAB__OPC_SSE }, /* /sse */
+    /* 251 */ {  2187, UD_TAB__OPC_SSE }, /* /sse */
+    /* 252 */ {  2191, UD_TAB__OPC_SSE }, /* /sse */
+    /* 253 */ {  2195, UD_TAB__OPC_SSE }, /* /sse */
+    /* 254 */ {  2199, UD_TAB__OPC_SSE }, /* /sse */
+    /* 255 */ {  2203, UD_TAB__OPC_SSE }, /* /sse */
+    /* 256 */ {  2207, UD_TAB__OPC_SSE }, /* /sse */
+    /* 257 */ {  2211, UD_TAB__OPC_SSE }, /* /sse */
+    /* 258 */ {  2215, UD_TAB__OPC_SSE }, /* /sse */
+    /* 259 */ {  2219, UD_TAB__OPC_SSE }, /* /sse */
+    /* 260 */ {  2223, UD_TAB__OPC_SSE }, /* /sse */
+    /* 261 */ {  2227, UD_TAB__OPC_SSE }, /* /sse */
+    /* 262 */ {  2231, UD_TAB__OPC_SSE }, /* /sse */
+    /* 263 */ {  2235, UD_TAB__OPC_SSE }, /* /sse */
+    /* 264 */ {  2239, UD_TAB__OPC_SSE }, /* /sse */
+    /* 265 */ {  2243, UD_TAB__OPC_SSE }, /* /sse */
+    /* 266 */ {  2247, UD_TAB__OPC_SSE }, /* /sse */
+    /* 267 */ {  2251, UD_TAB__OPC_SSE }, /* /sse */
+    /* 268 */ {  2255, UD_TAB__OPC_SSE }, /* /sse */
+    /* 269 */ {  2259, UD_TAB__OPC_SSE }, /* /sse */
+    /* 270 */ {  2263, UD_TAB__OPC_SSE }, /* /sse */
+    /* 271 */ {  2267, UD_TAB__OPC_SSE }, /* /sse */
+    /* 272 */ {  2271, UD_TAB__OPC_SSE }, /* /sse */
+    /* 273 */ {  2275, UD_TAB__OPC_SSE }, /* /sse */
+    /* 274 */ {  2279, UD_TAB__OPC_SSE }, /* /sse */
+    /* 275 */ {  2283, UD_TAB__OPC_SSE }, /* /sse */
+    /* 276 */ {  2287, UD_TAB__OPC_SSE }, /* /sse */
+    /* 277 */ {  2291, UD_TAB__OPC_SSE }, /* /sse */
+    /* 278 */ {  2295, UD_TAB__OPC_SSE }, /* /sse */
+    /* 279 */ {  2299, UD_TAB__OPC_SSE }, /* /sse */
+    /* 280 */ {  2303, UD_TAB__OPC_SSE }, /* /sse */
+    /* 281 */ {  2307, UD_TAB__OPC_SSE }, /* /sse */
+    /* 282 */ {  2311, UD_TAB__OPC_SSE }, /* /sse */
+    /* 283 */ {  2315, UD_TAB__OPC_SSE }, /* /sse */
+    /* 284 */ {  2319, UD_TAB__OPC_SSE }, /* /sse */
+    /* 285 */ {  2323, UD_TAB__OPC_SSE }, /* /sse */
+    /* 286 */ {  2327, UD_TAB__OPC_SSE }, /* /sse */
+    /* 287 */ {  2331, UD_TAB__OPC_SSE }, /* /sse */
+    /* 288 */ {  2335, UD_TAB__OPC_SSE }, /* /sse */
+    /* 289 */ {  2339, UD_TAB__OPC_SSE }, /* /sse */
+    /* 290 */ {  2343, UD_TAB__OPC_SSE }, /* /sse */
+    /* 291 */ {  2347, UD_TAB__OPC_SSE }, /* /sse */
+    /* 292 */ {  2351, UD_TAB__OPC_SSE }, /* /sse */
+    /* 293 */ {  2355, UD_TAB__OPC_SSE }, /* /sse */
+    /* 294 */ {  2359, UD_TAB__OPC_SSE }, /* /sse */
+    /* 295 */ {  2363, UD_TAB__OPC_SSE }, /* /sse */
+    /* 296 */ {  2367, UD_TAB__OPC_SSE }, /* /sse */
+    /* 297 */ {  2371, UD_TAB__OPC_SSE }, /* /sse */
+    /* 298 */ {  2375, UD_TAB__OPC_SSE }, /* /sse */
+    /* 299 */ {  2379, UD_TAB__OPC_SSE }, /* /sse */
+    /* 300 */ {  2383, UD_TAB__OPC_SSE }, /* /sse */
+    /* 301 */ {  2387, UD_TAB__OPC_REG }, /* /reg */
+    /* 302 */ {  2395, UD_TAB__OPC_SSE }, /* /sse */
+    /* 303 */ {  2399, UD_TAB__OPC_SSE }, /* /sse */
+    /* 304 */ {  2403, UD_TAB__OPC_SSE }, /* /sse */
+    /* 305 */ {  2407, UD_TAB__OPC_REG }, /* /reg */
+    /* 306 */ {  2415, UD_TAB__OPC_SSE }, /* /sse */
+    /* 307 */ {  2419, UD_TAB__OPC_SSE }, /* /sse */
+    /* 308 */ {  2423, UD_TAB__OPC_SSE }, /* /sse */
+    /* 309 */ {  2427, UD_TAB__OPC_REG }, /* /reg */
+    /* 310 */ {  2435, UD_TAB__OPC_SSE }, /* /sse */
+    /* 311 */ {  2439, UD_TAB__OPC_SSE }, /* /sse */
+    /* 312 */ {  2443, UD_TAB__OPC_SSE }, /* /sse */
+    /* 313 */ {  2447, UD_TAB__OPC_SSE }, /* /sse */
+    /* 314 */ {  2451, UD_TAB__OPC_SSE }, /* /sse */
+    /* 315 */ {  2455, UD_TAB__OPC_SSE }, /* /sse */
+    /* 316 */ {  2459, UD_TAB__OPC_SSE }, /* /sse */
+    /* 317 */ {  2463, UD_TAB__OPC_SSE }, /* /sse */
+    /* 318 */ {  2467, UD_TAB__OPC_SSE }, /* /sse */
+    /* 319 */ {  2471, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 320 */ {  2474, UD_TAB__OPC_SSE }, /* /sse */
+    /* 321 */ {  2478, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 322 */ {  2481, UD_TAB__OPC_SSE }, /* /sse */
+    /* 323 */ {  2485, UD_TAB__OPC_SSE }, /* /sse */
+    /* 324 */ {  2489, UD_TAB__OPC_SSE }, /* /sse */
+    /* 325 */ {  2493, UD_TAB__OPC_SSE }, /* /sse */
+    /* 326 */ {  2497, UD_TAB__OPC_SSE }, /* /sse */
+    /* 327 */ {  2501, UD_TAB__OPC_SSE }, /* /sse */
+    /* 328 */ {  2505, UD_TAB__OPC_SSE }, /* /sse */
+    /* 329 */ {  2509, UD_TAB__OPC_SSE }, /* /sse */
+    /* 330 */ {  2513, UD_TAB__OPC_SSE }, /* /sse */
+    /* 331 */ {  2517, UD_TAB__OPC_SSE }, /* /sse */
+    /* 332 */ {  2521, UD_TAB__OPC_SSE }, /* /sse */
+    /* 333 */ {  2525, UD_TAB__OPC_SSE }, /* /sse */
+    /* 334 */ {  2529, UD_TAB__OPC_SSE }, /* /sse */
+    /* 335 */ {  2533, UD_TAB__OPC_SSE }, /* /sse */
+    /* 336 */ {  2537, UD_TAB__OPC_SSE }, /* /sse */
+    /* 337 */ {  2541, UD_TAB__OPC_SSE }, /* /sse */
+    /* 338 */ {  2545, UD_TAB__OPC_SSE }, /* /sse */
+    /* 339 */ {  2549, UD_TAB__OPC_SSE }, /* /sse */
+    /* 340 */ {  2553, UD_TAB__OPC_SSE }, /* /sse */
+    /* 341 */ {  2557, UD_TAB__OPC_SSE }, /* /sse */
+    /* 342 */ {  2561, UD_TAB__OPC_SSE }, /* /sse */
+    /* 343 */ {  2565, UD_TAB__OPC_SSE }, /* /sse */
+    /* 344 */ {  2569, UD_TAB__OPC_SSE }, /* /sse */
+    /* 345 */ {  2573, UD_TAB__OPC_SSE }, /* /sse */
+    /* 346 */ {  2577, UD_TAB__OPC_SSE }, /* /sse */
+    /* 347 */ {  2581, UD_TAB__OPC_SSE }, /* /sse */
+    /* 348 */ {  2585, UD_TAB__OPC_SSE }, /* /sse */
+    /* 349 */ {  2589, UD_TAB__OPC_SSE }, /* /sse */
+    /* 350 */ {  2593, UD_TAB__OPC_SSE }, /* /sse */
+    /* 351 */ {  2597, UD_TAB__OPC_SSE }, /* /sse */
+    /* 352 */ {  2601, UD_TAB__OPC_SSE }, /* /sse */
+    /* 353 */ {  2605, UD_TAB__OPC_SSE }, /* /sse */
+    /* 354 */ {  2609, UD_TAB__OPC_SSE }, /* /sse */
+    /* 355 */ {  2613, UD_TAB__OPC_SSE }, /* /sse */
+    /* 356 */ {  2617, UD_TAB__OPC_SSE }, /* /sse */
+    /* 357 */ {  2621, UD_TAB__OPC_SSE }, /* /sse */
+    /* 358 */ {  2625, UD_TAB__OPC_SSE }, /* /sse */
+    /* 359 */ {  2629, UD_TAB__OPC_SSE }, /* /sse */
+    /* 360 */ {  2633, UD_TAB__OPC_SSE }, /* /sse */
+    /* 361 */ {  2637, UD_TAB__OPC_SSE }, /* /sse */
+    /* 362 */ {  2641, UD_TAB__OPC_SSE }, /* /sse */
+    /* 363 */ {  2645, UD_TAB__OPC_SSE }, /* /sse */
+    /* 364 */ {  2649, UD_TAB__OPC_MOD }, /* /mod */
+    /* 365 */ {  2651, UD_TAB__OPC_REG }, /* /reg */
+    /* 366 */ {  2659, UD_TAB__OPC_RM }, /* /rm */
+    /* 367 */ {  2667, UD_TAB__OPC_SSE }, /* /sse */
+    /* 368 */ {  2671, UD_TAB__OPC_MOD }, /* /mod */
+    /* 369 */ {  2673, UD_TAB__OPC_RM }, /* /rm */
+    /* 370 */ {  2681, UD_TAB__OPC_SSE }, /* /sse */
+    /* 371 */ {  2685, UD_TAB__OPC_MOD }, /* /mod */
+    /* 372 */ {  2687, UD_TAB__OPC_RM }, /* /rm */
+    /* 373 */ {  2695, UD_TAB__OPC_SSE }, /* /sse */
+    /* 374 */ {  2699, UD_TAB__OPC_MOD }, /* /mod */
+    /* 375 */ {  2701, UD_TAB__OPC_MOD }, /* /mod */
+    /* 376 */ {  2703, UD_TAB__OPC_REG }, /* /reg */
+    /* 377 */ {  2711, UD_TAB__OPC_RM }, /* /rm */
+    /* 378 */ {  2719, UD_TAB__OPC_SSE }, /* /sse */
+    /* 379 */ {  2723, UD_TAB__OPC_MOD }, /* /mod */
+    /* 380 */ {  2725, UD_TAB__OPC_RM }, /* /rm */
+    /* 381 */ {  2733, UD_TAB__OPC_SSE }, /* /sse */
+    /* 382 */ {  2737, UD_TAB__OPC_MOD }, /* /mod */
+    /* 383 */ {  2739, UD_TAB__OPC_RM }, /* /rm */
+    /* 384 */ {  2747, UD_TAB__OPC_SSE }, /* /sse */
+    /* 385 */ {  2751, UD_TAB__OPC_MOD }, /* /mod */
+    /* 386 */ {  2753, UD_TAB__OPC_RM }, /* /rm */
+    /* 387 */ {  2761, UD_TAB__OPC_SSE }, /* /sse */
+    /* 388 */ {  2765, UD_TAB__OPC_MOD }, /* /mod */
+    /* 389 */ {  2767, UD_TAB__OPC_RM }, /* /rm */
+    /* 390 */ {  2775, UD_TAB__OPC_SSE }, /* /sse */
+    /* 391 */ {  2779, UD_TAB__OPC_MOD }, /* /mod */
+    /* 392 */ {  2781, UD_TAB__OPC_RM }, /* /rm */
+    /* 393 */ {  2789, UD_TAB__OPC_SSE }, /* /sse */
+    /* 394 */ {  2793, UD_TAB__OPC_MOD }, /* /mod */
+    /* 395 */ {  2795, UD_TAB__OPC_SSE }, /* /sse */
+    /* 396 */ {  2799, UD_TAB__OPC_SSE }, /* /sse */
+    /* 397 */ {  2803, UD_TAB__OPC_SSE }, /* /sse */
+    /* 398 */ {  2807, UD_TAB__OPC_SSE }, /* /sse */
+    /* 399 */ {  2811, UD_TAB__OPC_SSE }, /* /sse */
+    /* 400 */ {  2815, UD_TAB__OPC_SSE }, /* /sse */
+    /* 401 */ {  2819, UD_TAB__OPC_MOD }, /* /mod */
+    /* 402 */ {  2821, UD_TAB__OPC_REG }, /* /reg */
+    /* 403 */ {  2829, UD_TAB__OPC_SSE }, /* /sse */
+    /* 404 */ {  2833, UD_TAB__OPC_MOD }, /* /mod */
+    /* 405 */ {  2835, UD_TAB__OPC_SSE }, /* /sse */
+    /* 406 */ {  2839, UD_TAB__OPC_MOD }, /* /mod */
+    /* 407 */ {  2841, UD_TAB__OPC_SSE }, /* /sse */
+    /* 408 */ {  2845, UD_TAB__OPC_MOD }, /* /mod */
+    /* 409 */ {  2847, UD_TAB__OPC_SSE }, /* /sse */
+    /* 410 */ {  2851, UD_TAB__OPC_MOD }, /* /mod */
+    /* 411 */ {  2853, UD_TAB__OPC_SSE }, /* /sse */
+    /* 412 */ {  2857, UD_TAB__OPC_MOD }, /* /mod */
+    /* 413 */ {  2859, UD_TAB__OPC_SSE }, /* /sse */
+    /* 414 */ {  2863, UD_TAB__OPC_MOD }, /* /mod */
+    /* 415 */ {  2865, UD_TAB__OPC_SSE }, /* /sse */
+    /* 416 */ {  2869, UD_TAB__OPC_MOD }, /* /mod */
+    /* 417 */ {  2871, UD_TAB__OPC_REG }, /* /reg */
+    /* 418 */ {  2879, UD_TAB__OPC_RM }, /* /rm */
+    /* 419 */ {  2887, UD_TAB__OPC_SSE }, /* /sse */
+    /* 420 */ {  2891, UD_TAB__OPC_MOD }, /* /mod */
+    /* 421 */ {  2893, UD_TAB__OPC_SSE }, /* /sse */
+    /* 422 */ {  2897, UD_TAB__OPC_MOD }, /* /mod */
+    /* 423 */ {  2899, UD_TAB__OPC_SSE }, /* /sse */
+    /* 424 */ {  2903, UD_TAB__OPC_MOD }, /* /mod */
+    /* 425 */ {  2905, UD_TAB__OPC_SSE }, /* /sse */
+    /* 426 */ {  2909, UD_TAB__OPC_MOD }, /* /mod */
+    /* 427 */ {  2911, UD_TAB__OPC_SSE }, /* /sse */
+    /* 428 */ {  2915, UD_TAB__OPC_MOD }, /* /mod */
+    /* 429 */ {  2917, UD_TAB__OPC_SSE }, /* /sse */
+    /* 430 */ {  2921, UD_TAB__OPC_MOD }, /* /mod */
+    /* 431 */ {  2923, UD_TAB__OPC_SSE }, /* /sse */
+    /* 432 */ {  2927, UD_TAB__OPC_MOD }, /* /mod */
+    /* 433 */ {  2929, UD_TAB__OPC_SSE }, /* /sse */
+    /* 434 */ {  2933, UD_TAB__OPC_MOD }, /* /mod */
+    /* 435 */ {  2935, UD_TAB__OPC_RM }, /* /rm */
+    /* 436 */ {  2943, UD_TAB__OPC_SSE }, /* /sse */
+    /* 437 */ {  2947, UD_TAB__OPC_MOD }, /* /mod */
+    /* 438 */ {  2949, UD_TAB__OPC_SSE }, /* /sse */
+    /* 439 */ {  2953, UD_TAB__OPC_MOD }, /* /mod */
+    /* 440 */ {  2955, UD_TAB__OPC_SSE }, /* /sse */
+    /* 441 */ {  2959, UD_TAB__OPC_MOD }, /* /mod */
+    /* 442 */ {  2961, UD_TAB__OPC_SSE }, /* /sse */
+    /* 443 */ {  2965, UD_TAB__OPC_MOD }, /* /mod */
+    /* 444 */ {  2967, UD_TAB__OPC_SSE }, /* /sse */
+    /* 445 */ {  2971, UD_TAB__OPC_MOD }, /* /mod */
+    /* 446 */ {  2973, UD_TAB__OPC_SSE }, /* /sse */
+    /* 447 */ {  2977, UD_TAB__OPC_MOD }, /* /mod */
+    /* 448 */ {  2979, UD_TAB__OPC_SSE }, /* /sse */
+    /* 449 */ {  2983, UD_TAB__OPC_MOD }, /* /mod */
+    /* 450 */ {  2985, UD_TAB__OPC_SSE }, /* /sse */
+    /* 451 */ {  2989, UD_TAB__OPC_MOD }, /* /mod */
+    /* 452 */ {  2991, UD_TAB__OPC_RM }, /* /rm */
+    /* 453 */ {  2999, UD_TAB__OPC_SSE }, /* /sse */
+    /* 454 */ {  3003, UD_TAB__OPC_MOD }, /* /mod */
+    /* 455 */ {  3005, UD_TAB__OPC_SSE }, /* /sse */
+    /* 456 */ {  3009, UD_TAB__OPC_MOD }, /* /mod */
+    /* 457 */ {  3011, UD_TAB__OPC_SSE }, /* /sse */
+    /* 458 */ {  3015, UD_TAB__OPC_MOD }, /* /mod */
+    /* 459 */ {  3017, UD_TAB__OPC_SSE }, /* /sse */
+    /* 460 */ {  3021, UD_TAB__OPC_MOD }, /* /mod */
+    /* 461 */ {  3023, UD_TAB__OPC_SSE }, /* /sse */
+    /* 462 */ {  3027, UD_TAB__OPC_MOD }, /* /mod */
+    /* 463 */ {  3029, UD_TAB__OPC_SSE }, /* /sse */
+    /* 464 */ {  3033, UD_TAB__OPC_MOD }, /* /mod */
+    /* 465 */ {  3035, UD_TAB__OPC_SSE }, /* /sse */
+    /* 466 */ {  3039, UD_TAB__OPC_MOD }, /* /mod */
+    /* 467 */ {  3041, UD_TAB__OPC_SSE }, /* /sse */
+    /* 468 */ {  3045, UD_TAB__OPC_MOD }, /* /mod */
+    /* 469 */ {  3047, UD_TAB__OPC_SSE }, /* /sse */
+    /* 470 */ {  3051, UD_TAB__OPC_SSE }, /* /sse */
+    /* 471 */ {  3055, UD_TAB__OPC_SSE }, /* /sse */
+    /* 472 */ {  3059, UD_TAB__OPC_SSE }, /* /sse */
+    /* 473 */ {  3063, UD_TAB__OPC_SSE }, /* /sse */
+    /* 474 */ {  3067, UD_TAB__OPC_SSE }, /* /sse */
+    /* 475 */ {  3071, UD_TAB__OPC_SSE }, /* /sse */
+    /* 476 */ {  3075, UD_TAB__OPC_SSE }, /* /sse */
+    /* 477 */ {  3079, UD_TAB__OPC_SSE }, /* /sse */
+    /* 478 */ {  3083, UD_TAB__OPC_SSE }, /* /sse */
+    /* 479 */ {  3087, UD_TAB__OPC_REG }, /* /reg */
+    /* 480 */ {  3095, UD_TAB__OPC_SSE }, /* /sse */
+    /* 481 */ {  3099, UD_TAB__OPC_SSE }, /* /sse */
+    /* 482 */ {  3103, UD_TAB__OPC_SSE }, /* /sse */
+    /* 483 */ {  3107, UD_TAB__OPC_SSE }, /* /sse */
+    /* 484 */ {  3111, UD_TAB__OPC_SSE }, /* /sse */
+    /* 485 */ {  3115, UD_TAB__OPC_SSE }, /* /sse */
+    /* 486 */ {  3119, UD_TAB__OPC_SSE }, /* /sse */
+    /* 487 */ {  3123, UD_TAB__OPC_SSE }, /* /sse */
+    /* 488 */ {  3127, UD_TAB__OPC_SSE }, /* /sse */
+    /* 489 */ {  3131, UD_TAB__OPC_SSE }, /* /sse */
+    /* 490 */ {  3135, UD_TAB__OPC_SSE }, /* /sse */
+    /* 491 */ {  3139, UD_TAB__OPC_SSE }, /* /sse */
+    /* 492 */ {  3143, UD_TAB__OPC_SSE }, /* /sse */
+    /* 493 */ {  3147, UD_TAB__OPC_SSE }, /* /sse */
+    /* 494 */ {  3151, UD_TAB__OPC_SSE }, /* /sse */
+    /* 495 */ {  3155, UD_TAB__OPC_SSE }, /* /sse */
+    /* 496 */ {  3159, UD_TAB__OPC_REG }, /* /reg */
+    /* 497 */ {  3167, UD_TAB__OPC_SSE }, /* /sse */
+    /* 498 */ {  3171, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 499 */ {  3174, UD_TAB__OPC_SSE }, /* /sse */
+    /* 500 */ {  3178, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 501 */ {  3181, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 502 */ {  3184, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 503 */ {  3187, UD_TAB__OPC_SSE }, /* /sse */
+    /* 504 */ {  3191, UD_TAB__OPC_VENDOR }, /* intel */
+    /* 505 */ {  3194, UD_TAB__OPC_SSE }, /* /sse */
+    /* 506 */ {  3198, UD_TAB__OPC_SSE }, /* /sse */
+    /* 507 */ {  3202, UD_TAB__OPC_SSE }, /* /sse */
+    /* 508 */ {  3206, UD_TAB__OPC_SSE }, /* /sse */
+    /* 509 */ {  3210, UD_TAB__OPC_SSE }, /* /sse */
+    /* 510 */ {  3214, UD_TAB__OPC_SSE }, /* /sse */
+    /* 511 */ {  3218, UD_TAB__OPC_SSE }, /* /sse */
+    /* 512 */ {  3222, UD_TAB__OPC_SSE }, /* /sse */
+    /* 513 */ {  3226, UD_TAB__OPC_SSE }, /* /sse */
+    /* 514 */ {  3230, UD_TAB__OPC_SSE }, /* /sse */
+    /* 515 */ {  3234, UD_TAB__OPC_SSE }, /* /sse */
+    /* 516 */ {  3238, UD_TAB__OPC_SSE }, /* /sse */
+    /* 517 */ {  3242, UD_TAB__OPC_SSE }, /* /sse */
+    /* 518 */ {  3246, UD_TAB__OPC_SSE }, /* /sse */
+    /* 519 */ {  3250, UD_TAB__OPC_SSE }, /* /sse */
+    /* 520 */ {  3254, UD_TAB__OPC_SSE }, /* /sse */
+    /* 521 */ {  3258, UD_TAB__OPC_SSE }, /* /sse */
+    /* 522 */ {  3262, UD_TAB__OPC_SSE }, /* /sse */
+    /* 523 */ {  3266, UD_TAB__OPC_SSE }, /* /sse */
+    /* 524 */ {  3270, UD_TAB__OPC_SSE }, /* /sse */
+    /* 525 */ {  3274, UD_TAB__OPC_SSE }, /* /sse */
+    /* 526 */ {  3278, UD_TAB__OPC_SSE }, /* /sse */
+    /* 527 */ {  3282, UD_TAB__OPC_SSE }, /* /sse */
+    /* 528 */ {  3286, UD_TAB__OPC_SSE }, /* /sse */
+    /* 529 */ {  3290, UD_TAB__OPC_SSE }, /* /sse */
+    /* 530 */ {  3294, UD_TAB__OPC_SSE }, /* /sse */
+    /* 531 */ {  3298, UD_TAB__OPC_SSE }, /* /sse */
+    /* 532 */ {  3302, UD_TAB__OPC_SSE }, /* /sse */
+    /* 533 */ {  3306, UD_TAB__OPC_SSE }, /* /sse */
+    /* 534 */ {  3310, UD_TAB__OPC_SSE }, /* /sse */
+    /* 535 */ {  3314, UD_TAB__OPC_SSE }, /* /sse */
+    /* 536 */ {  3318, UD_TAB__OPC_SSE }, /* /sse */
+    /* 537 */ {  3322, UD_TAB__OPC_SSE }, /* /sse */
+    /* 538 */ {  3326, UD_TAB__OPC_SSE }, /* /sse */
+    /* 539 */ {  3330, UD_TAB__OPC_SSE }, /* /sse */
+    /* 540 */ {  3334, UD_TAB__OPC_SSE }, /* /sse */
+    /* 541 */ {  3338, UD_TAB__OPC_SSE }, /* /sse */
+    /* 542 */ {  3342, UD_TAB__OPC_SSE }, /* /sse */
+    /* 543 */ {  3346, UD_TAB__OPC_SSE }, /* /sse */
+    /* 544 */ {  3350, UD_TAB__OPC_SSE }, /* /sse */
+    /* 545 */ {  3354, UD_TAB__OPC_SSE }, /* /sse */
+    /* 546 */ {  3358, UD_TAB__OPC_SSE }, /* /sse */
+    /* 547 */ {  3362, UD_TAB__OPC_SSE }, /* /sse */
+    /* 548 */ {  3366, UD_TAB__OPC_SSE }, /* /sse */
+    /* 549 */ {  3370, UD_TAB__OPC_SSE }, /* /sse */
+    /* 550 */ {  3374, UD_TAB__OPC_SSE }, /* /sse */
+    /* 551 */ {  3378, UD_TAB__OPC_SSE }, /* /sse */
+    /* 552 */ {  3382, UD_TAB__OPC_MOD }, /* /mod */
+    /* 553 */ {  3384, UD_TAB__OPC_SSE }, /* /sse */
+    /* 554 */ {  3388, UD_TAB__OPC_MOD }, /* /mod */
+    /* 555 */ {  3390, UD_TAB__OPC_MOD }, /* /mod */
+    /* 556 */ {  3392, UD_TAB__OPC_SSE }, /* /sse */
+    /* 557 */ {  3396, UD_TAB__OPC_SSE }, /* /sse */
+    /* 558 */ {  3400, UD_TAB__OPC_SSE }, /* /sse */
+    /* 559 */ {  3404, UD_TAB__OPC_SSE }, /* /sse */
+    /* 560 */ {  3408, UD_TAB__OPC_SSE }, /* /sse */
+    /* 561 */ {  3412, UD_TAB__OPC_SSE }, /* /sse */
+    /* 562 */ {  3416, UD_TAB__OPC_SSE }, /* /sse */
+    /* 563 */ {  3420, UD_TAB__OPC_MODE }, /* /m */
+    /* 564 */ {  3422, UD_TAB__OPC_MODE }, /* /m */
+    /* 565 */ {  3424, UD_TAB__OPC_MODE }, /* /m */
+    /* 566 */ {  3426, UD_TAB__OPC_MODE }, /* /m */
+    /* 567 */ {  3428, UD_TAB__OPC_MODE }, /* /m */
+    /* 568 */ {  3430, UD_TAB__OPC_MODE }, /* /m */
+    /* 569 */ {  3432, UD_TAB__OPC_MODE }, /* /m */
+    /* 570 */ {  3434, UD_TAB__OPC_MODE }, /* /m */
+    /* 571 */ {  3436, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 572 */ {  3439, UD_TAB__OPC_MODE }, /* /m */
+    /* 573 */ {  3441, UD_TAB__OPC_MODE }, /* /m */
+    /* 574 */ {  3443, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 575 */ {  3446, UD_TAB__OPC_MODE }, /* /m */
+    /* 576 */ {  3448, UD_TAB__OPC_MODE }, /* /m */
+    /* 577 */ {  3450, UD_TAB__OPC_MODE }, /* /m */
+    /* 578 */ {  3452, UD_TAB__OPC_MODE }, /* /m */
+    /* 579 */ {  3454, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 580 */ {  3457, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 581 */ {  3460, UD_TAB__OPC_REG }, /* /reg */
+    /* 582 */ {  3468, UD_TAB__OPC_REG }, /* /reg */
+    /* 583 */ {  3476, UD_TAB__OPC_REG }, /* /reg */
+    /* 584 */ {  3484, UD_TAB__OPC_MODE }, /* /m */
+    /* 585 */ {  3486, UD_TAB__OPC_MODE }, /* /m */
+    /* 586 */ {  3488, UD_TAB__OPC_MODE }, /* /m */
+    /* 587 */ {  3490, UD_TAB__OPC_MODE }, /* /m */
+    /* 588 */ {  3492, UD_TAB__OPC_MODE }, /* /m */
+    /* 589 */ {  3494, UD_TAB__OPC_MODE }, /* /m */
+    /* 590 */ {  3496, UD_TAB__OPC_MODE }, /* /m */
+    /* 591 */ {  3498, UD_TAB__OPC_MODE }, /* /m */
+    /* 592 */ {  3500, UD_TAB__OPC_REG }, /* /reg */
+    /* 593 */ {  3508, UD_TAB__OPC_REG }, /* /reg */
+    /* 594 */ {  3516, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 595 */ {  3519, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 596 */ {  3522, UD_TAB__OPC_MODE }, /* /m */
+    /* 597 */ {  3524, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 598 */ {  3527, UD_TAB__OPC_MODE }, /* /m */
+    /* 599 */ {  3529, UD_TAB__OPC_MODE }, /* /m */
+    /* 600 */ {  3531, UD_TAB__OPC_MODE }, /* /m */
+    /* 601 */ {  3533, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 602 */ {  3536, UD_TAB__OPC_MODE }, /* /m */
+    /* 603 */ {  3538, UD_TAB__OPC_MODE }, /* /m */
+    /* 604 */ {  3540, UD_TAB__OPC_MODE }, /* /m */
+    /* 605 */ {  3542, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 606 */ {  3545, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 607 */ {  3548, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 608 */ {  3551, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 609 */ {  3554, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 610 */ {  3557, UD_TAB__OPC_REG }, /* /reg */
+    /* 611 */ {  3565, UD_TAB__OPC_REG }, /* /reg */
+    /* 612 */ {  3573, UD_TAB__OPC_MODE }, /* /m */
+    /* 613 */ {  3575, UD_TAB__OPC_MODE }, /* /m */
+    /* 614 */ {  3577, UD_TAB__OPC_REG }, /* /reg */
+    /* 615 */ {  3585, UD_TAB__OPC_REG }, /* /reg */
+    /* 616 */ {  3593, UD_TAB__OPC_MODE }, /* /m */
+    /* 617 */ {  3595, UD_TAB__OPC_OSIZE }, /* /o */
+    /* 618 */ {  3598, UD_TAB__OPC_REG }, /* /reg */
+    /* 619 */ {  3606, UD_TAB__OPC_REG }, /* /reg */
+    /* 620 */ {  3614, UD_TAB__OPC_REG }, /* /reg */
+    /* 621 */ {  3622, UD_TAB__OPC_REG }, /* /reg */
+    /* 622 */ {  3630, UD_TAB__OPC_MODE }, /* /m */
+    /* 623 */ {  3632, UD_TAB__OPC_MODE }, /* /m */
+    /* 624 */ {  3634, UD_TAB__OPC_MODE }, /* /m */
+    /* 625 */ {  3636, UD_TAB__OPC_MOD }, /* /mod */
+    /* 626 */ {  3638, UD_TAB__OPC_REG }, /* /reg */
+    /* 627 */ {  3646, UD_TAB__OPC_MOD }, /* /mod */
+    /* 628 */ {  3648, UD_TAB__OPC_MOD }, /* /mod */
+    /* 629 */ {  3650, UD_TAB__OPC_MOD }, /* /mod */
+    /* 630 */ {  3652, UD_TAB__OPC_MOD }, /* /mod */
+    /* 631 */ {  3654, UD_TAB__OPC_MOD }, /* /mod */
+    /* 632 */ {  3656, UD_TAB__OPC_MOD }, /* /mod */
+    /* 633 */ {  3658, UD_TAB__OPC_MOD }, /* /mod */
+    /* 634 */ {  3660, UD_TAB__OPC_MOD }, /* /mod */
+    /* 635 */ {  3662, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 636 */ {  3726, UD_TAB__OPC_MOD }, /* /mod */
+    /* 637 */ {  3728, UD_TAB__OPC_MOD }, /* /mod */
+    /* 638 */ {  3730, UD_TAB__OPC_MOD }, /* /mod */
+    /* 639 */ {  3732, UD_TAB__OPC_MOD }, /* /mod */
+    /* 640 */ {  3734, UD_TAB__OPC_MOD }, /* /mod */
+    /* 641 */ {  3736, UD_TAB__OPC_MOD }, /* /mod */
+    /* 642 */ {  3738, UD_TAB__OPC_MOD }, /* /mod */
+    /* 643 */ {  3740, UD_TAB__OPC_MOD }, /* /mod */
+    /* 644 */ {  3742, UD_TAB__OPC_MOD }, /* /mod */
+    /* 645 */ {  3744, UD_TAB__OPC_MOD }, /* /mod */
+    /* 646 */ {  3746, UD_TAB__OPC_MOD }, /* /mod */
+    /* 647 */ {  3748, UD_TAB__OPC_MOD }, /* /mod */
+    /* 648 */ {  3750, UD_TAB__OPC_MOD }, /* /mod */
+    /* 649 */ {  3752, UD_TAB__OPC_MOD }, /* /mod */
+    /* 650 */ {  3754, UD_TAB__OPC_MOD }, /* /mod */
+    /* 651 */ {  3756, UD_TAB__OPC_MOD }, /* /mod */
+    /* 652 */ {  3758, UD_TAB__OPC_MOD }, /* /mod */
+    /* 653 */ {  3760, UD_TAB__OPC_MOD }, /* /mod */
+    /* 654 */ {  3762, UD_TAB__OPC_MOD }, /* /mod */
+    /* 655 */ {  3764, UD_TAB__OPC_MOD }, /* /mod */
+    /* 656 */ {  3766, UD_TAB__OPC_MOD }, /* /mod */
+    /* 657 */ {  3768, UD_TAB__OPC_MOD }, /* /mod */
+    /* 658 */ {  3770, UD_TAB__OPC_MOD }, /* /mod */
+    /* 659 */ {  3772, UD_TAB__OPC_MOD }, /* /mod */
+    /* 660 */ {  3774, UD_TAB__OPC_MOD }, /* /mod */
+    /* 661 */ {  3776, UD_TAB__OPC_MOD }, /* /mod */
+    /* 662 */ {  3778, UD_TAB__OPC_MOD }, /* /mod */
+    /* 663 */ {  3780, UD_TAB__OPC_MOD }, /* /mod */
+    /* 664 */ {  3782, UD_TAB__OPC_MOD }, /* /mod */
+    /* 665 */ {  3784, UD_TAB__OPC_MOD }, /* /mod */
+    /* 666 */ {  3786, UD_TAB__OPC_MOD }, /* /mod */
+    /* 667 */ {  3788, UD_TAB__OPC_MOD }, /* /mod */
+    /* 668 */ {  3790, UD_TAB__OPC_MOD }, /* /mod */
+    /* 669 */ {  3792, UD_TAB__OPC_MOD }, /* /mod */
+    /* 670 */ {  3794, UD_TAB__OPC_MOD }, /* /mod */
+    /* 671 */ {  3796, UD_TAB__OPC_MOD }, /* /mod */
+    /* 672 */ {  3798, UD_TAB__OPC_MOD }, /* /mod */
+    /* 673 */ {  3800, UD_TAB__OPC_MOD }, /* /mod */
+    /* 674 */ {  3802, UD_TAB__OPC_MOD }, /* /mod */
+    /* 675 */ {  3804, UD_TAB__OPC_MOD }, /* /mod */
+    /* 676 */ {  3806, UD_TAB__OPC_MOD }, /* /mod */
+    /* 677 */ {  3808, UD_TAB__OPC_MOD }, /* /mod */
+    /* 678 */ {  3810, UD_TAB__OPC_MOD }, /* /mod */
+    /* 679 */ {  3812, UD_TAB__OPC_MOD }, /* /mod */
+    /* 680 */ {  3814, UD_TAB__OPC_MOD }, /* /mod */
+    /* 681 */ {  3816, UD_TAB__OPC_MOD }, /* /mod */
+    /* 682 */ {  3818, UD_TAB__OPC_MOD }, /* /mod */
+    /* 683 */ {  3820, UD_TAB__OPC_MOD }, /* /mod */
+    /* 684 */ {  3822, UD_TAB__OPC_MOD }, /* /mod */
+    /* 685 */ {  3824, UD_TAB__OPC_MOD }, /* /mod */
+    /* 686 */ {  3826, UD_TAB__OPC_MOD }, /* /mod */
+    /* 687 */ {  3828, UD_TAB__OPC_MOD }, /* /mod */
+    /* 688 */ {  3830, UD_TAB__OPC_MOD }, /* /mod */
+    /* 689 */ {  3832, UD_TAB__OPC_MOD }, /* /mod */
+    /* 690 */ {  3834, UD_TAB__OPC_MOD }, /* /mod */
+    /* 691 */ {  3836, UD_TAB__OPC_MOD }, /* /mod */
+    /* 692 */ {  3838, UD_TAB__OPC_MOD }, /* /mod */
+    /* 693 */ {  3840, UD_TAB__OPC_MOD }, /* /mod */
+    /* 694 */ {  3842, UD_TAB__OPC_MOD }, /* /mod */
+    /* 695 */ {  3844, UD_TAB__OPC_MOD }, /* /mod */
+    /* 696 */ {  3846, UD_TAB__OPC_MOD }, /* /mod */
+    /* 697 */ {  3848, UD_TAB__OPC_MOD }, /* /mod */
+    /* 698 */ {  3850, UD_TAB__OPC_MOD }, /* /mod */
+    /* 699 */ {  3852, UD_TAB__OPC_MOD }, /* /mod */
+    /* 700 */ {  3854, UD_TAB__OPC_MOD }, /* /mod */
+    /* 701 */ {  3856, UD_TAB__OPC_REG }, /* /reg */
+    /* 702 */ {  3864, UD_TAB__OPC_MOD }, /* /mod */
+    /* 703 */ {  3866, UD_TAB__OPC_MOD }, /* /mod */
+    /* 704 */ {  3868, UD_TAB__OPC_MOD }, /* /mod */
+    /* 705 */ {  3870, UD_TAB__OPC_MOD }, /* /mod */
+    /* 706 */ {  3872, UD_TAB__OPC_MOD }, /* /mod */
+    /* 707 */ {  3874, UD_TAB__OPC_MOD }, /* /mod */
+    /* 708 */ {  3876, UD_TAB__OPC_MOD }, /* /mod */
+    /* 709 */ {  3878, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 710 */ {  3942, UD_TAB__OPC_MOD }, /* /mod */
+    /* 711 */ {  3944, UD_TAB__OPC_MOD }, /* /mod */
+    /* 712 */ {  3946, UD_TAB__OPC_MOD }, /* /mod */
+    /* 713 */ {  3948, UD_TAB__OPC_MOD }, /* /mod */
+    /* 714 */ {  3950, UD_TAB__OPC_MOD }, /* /mod */
+    /* 715 */ {  3952, UD_TAB__OPC_MOD }, /* /mod */
+    /* 716 */ {  3954, UD_TAB__OPC_MOD }, /* /mod */
+    /* 717 */ {  3956, UD_TAB__OPC_MOD }, /* /mod */
+    /* 718 */ {  3958, UD_TAB__OPC_MOD }, /* /mod */
+    /* 719 */ {  3960, UD_TAB__OPC_MOD }, /* /mod */
+    /* 720 */ {  3962, UD_TAB__OPC_MOD }, /* /mod */
+    /* 721 */ {  3964, UD_TAB__OPC_MOD }, /* /mod */
+    /* 722 */ {  3966, UD_TAB__OPC_MOD }, /* /mod */
+    /* 723 */ {  3968, UD_TAB__OPC_MOD }, /* /mod */
+    /* 724 */ {  3970, UD_TAB__OPC_MOD }, /* /mod */
+    /* 725 */ {  3972, UD_TAB__OPC_MOD }, /* /mod */
+    /* 726 */ {  3974, UD_TAB__OPC_MOD }, /* /mod */
+    /* 727 */ {  3976, UD_TAB__OPC_MOD }, /* /mod */
+    /* 728 */ {  3978, UD_TAB__OPC_MOD }, /* /mod */
+    /* 729 */ {  3980, UD_TAB__OPC_MOD }, /* /mod */
+    /* 730 */ {  3982, UD_TAB__OPC_MOD }, /* /mod */
+    /* 731 */ {  3984, UD_TAB__OPC_MOD }, /* /mod */
+    /* 732 */ {  3986, UD_TAB__OPC_MOD }, /* /mod */
+    /* 733 */ {  3988, UD_TAB__OPC_MOD }, /* /mod */
+    /* 734 */ {  3990, UD_TAB__OPC_MOD }, /* /mod */
+    /* 735 */ {  3992, UD_TAB__OPC_MOD }, /* /mod */
+    /* 736 */ {  3994, UD_TAB__OPC_MOD }, /* /mod */
+    /* 737 */ {  3996, UD_TAB__OPC_MOD }, /* /mod */
+    /* 738 */ {  3998, UD_TAB__OPC_MOD }, /* /mod */
+    /* 739 */ {  4000, UD_TAB__OPC_MOD }, /* /mod */
+    /* 740 */ {  4002, UD_TAB__OPC_MOD }, /* /mod */
+    /* 741 */ {  4004, UD_TAB__OPC_MOD }, /* /mod */
+    /* 742 */ {  4006, UD_TAB__OPC_MOD }, /* /mod */
+    /* 743 */ {  4008, UD_TAB__OPC_MOD }, /* /mod */
+    /* 744 */ {  4010, UD_TAB__OPC_MOD }, /* /mod */
+    /* 745 */ {  4012, UD_TAB__OPC_MOD }, /* /mod */
+    /* 746 */ {  4014, UD_TAB__OPC_MOD }, /* /mod */
+    /* 747 */ {  4016, UD_TAB__OPC_MOD }, /* /mod */
+    /* 748 */ {  4018, UD_TAB__OPC_MOD }, /* /mod */
+    /* 749 */ {  4020, UD_TAB__OPC_MOD }, /* /mod */
+    /* 750 */ {  4022, UD_TAB__OPC_MOD }, /* /mod */
+    /* 751 */ {  4024, UD_TAB__OPC_MOD }, /* /mod */
+    /* 752 */ {  4026, UD_TAB__OPC_MOD }, /* /mod */
+    /* 753 */ {  4028, UD_TAB__OPC_MOD }, /* /mod */
+    /* 754 */ {  4030, UD_TAB__OPC_MOD }, /* /mod */
+    /* 755 */ {  4032, UD_TAB__OPC_MOD }, /* /mod */
+    /* 756 */ {  4034, UD_TAB__OPC_MOD }, /* /mod */
+    /* 757 */ {  4036, UD_TAB__OPC_MOD }, /* /mod */
+    /* 758 */ {  4038, UD_TAB__OPC_MOD }, /* /mod */
+    /* 759 */ {  4040, UD_TAB__OPC_MOD }, /* /mod */
+    /* 760 */ {  4042, UD_TAB__OPC_MOD }, /* /mod */
+    /* 761 */ {  4044, UD_TAB__OPC_MOD }, /* /mod */
+    /* 762 */ {  4046, UD_TAB__OPC_MOD }, /* /mod */
+    /* 763 */ {  4048, UD_TAB__OPC_REG }, /* /reg */
+    /* 764 */ {  4056, UD_TAB__OPC_MOD }, /* /mod */
+    /* 765 */ {  4058, UD_TAB__OPC_MOD }, /* /mod */
+    /* 766 */ {  4060, UD_TAB__OPC_MOD }, /* /mod */
+    /* 767 */ {  4062, UD_TAB__OPC_MOD }, /* /mod */
+    /* 768 */ {  4064, UD_TAB__OPC_MOD }, /* /mod */
+    /* 769 */ {  4066, UD_TAB__OPC_MOD }, /* /mod */
+    /* 770 */ {  4068, UD_TAB__OPC_MOD }, /* /mod */
+    /* 771 */ {  4070, UD_TAB__OPC_MOD }, /* /mod */
+    /* 772 */ {  4072, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 773 */ {  4136, UD_TAB__OPC_MOD }, /* /mod */
+    /* 774 */ {  4138, UD_TAB__OPC_MOD }, /* /mod */
+    /* 775 */ {  4140, UD_TAB__OPC_MOD }, /* /mod */
+    /* 776 */ {  4142, UD_TAB__OPC_MOD }, /* /mod */
+    /* 777 */ {  4144, UD_TAB__OPC_MOD }, /* /mod */
+    /* 778 */ {  4146, UD_TAB__OPC_MOD }, /* /mod */
+    /* 779 */ {  4148, UD_TAB__OPC_MOD }, /* /mod */
+    /* 780 */ {  4150, UD_TAB__OPC_MOD }, /* /mod */
+    /* 781 */ {  4152, UD_TAB__OPC_MOD }, /* /mod */
+    /* 782 */ {  4154, UD_TAB__OPC_MOD }, /* /mod */
+    /* 783 */ {  4156, UD_TAB__OPC_MOD }, /* /mod */
+    /* 784 */ {  4158, UD_TAB__OPC_MOD }, /* /mod */
+    /* 785 */ {  4160, UD_TAB__OPC_MOD }, /* /mod */
+    /* 786 */ {  4162, UD_TAB__OPC_MOD }, /* /mod */
+    /* 787 */ {  4164, UD_TAB__OPC_MOD }, /* /mod */
+    /* 788 */ {  4166, UD_TAB__OPC_MOD }, /* /mod */
+    /* 789 */ {  4168, UD_TAB__OPC_MOD }, /* /mod */
+    /* 790 */ {  4170, UD_TAB__OPC_MOD }, /* /mod */
+    /* 791 */ {  4172, UD_TAB__OPC_MOD }, /* /mod */
+    /* 792 */ {  4174, UD_TAB__OPC_MOD }, /* /mod */
+    /* 793 */ {  4176, UD_TAB__OPC_MOD }, /* /mod */
+    /* 794 */ {  4178, UD_TAB__OPC_MOD }, /* /mod */
+    /* 795 */ {  4180, UD_TAB__OPC_MOD }, /* /mod */
+    /* 796 */ {  4182, UD_TAB__OPC_MOD }, /* /mod */
+    /* 797 */ {  4184, UD_TAB__OPC_MOD }, /* /mod */
+    /* 798 */ {  4186, UD_TAB__OPC_MOD }, /* /mod */
+    /* 799 */ {  4188, UD_TAB__OPC_MOD }, /* /mod */
+    /* 800 */ {  4190, UD_TAB__OPC_MOD }, /* /mod */
+    /* 801 */ {  4192, UD_TAB__OPC_MOD }, /* /mod */
+    /* 802 */ {  4194, UD_TAB__OPC_MOD }, /* /mod */
+    /* 803 */ {  4196, UD_TAB__OPC_MOD }, /* /mod */
+    /* 804 */ {  4198, UD_TAB__OPC_MOD }, /* /mod */
+    /* 805 */ {  4200, UD_TAB__OPC_MOD }, /* /mod */
+    /* 806 */ {  4202, UD_TAB__OPC_MOD }, /* /mod */
+    /* 807 */ {  4204, UD_TAB__OPC_REG }, /* /reg */
+    /* 808 */ {  4212, UD_TAB__OPC_MOD }, /* /mod */
+    /* 809 */ {  4214, UD_TAB__OPC_MOD }, /* /mod */
+    /* 810 */ {  4216, UD_TAB__OPC_MOD }, /* /mod */
+    /* 811 */ {  4218, UD_TAB__OPC_MOD }, /* /mod */
+    /* 812 */ {  4220, UD_TAB__OPC_MOD }, /* /mod */
+    /* 813 */ {  4222, UD_TAB__OPC_MOD }, /* /mod */
+    /* 814 */ {  4224, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 815 */ {  4288, UD_TAB__OPC_MOD }, /* /mod */
+    /* 816 */ {  4290, UD_TAB__OPC_MOD }, /* /mod */
+    /* 817 */ {  4292, UD_TAB__OPC_MOD }, /* /mod */
+    /* 818 */ {  4294, UD_TAB__OPC_MOD }, /* /mod */
+    /* 819 */ {  4296, UD_TAB__OPC_MOD }, /* /mod */
+    /* 820 */ {  4298, UD_TAB__OPC_MOD }, /* /mod */
+    /* 821 */ {  4300, UD_TAB__OPC_MOD }, /* /mod */
+    /* 822 */ {  4302, UD_TAB__OPC_MOD }, /* /mod */
+    /* 823 */ {  4304, UD_TAB__OPC_MOD }, /* /mod */
+    /* 824 */ {  4306, UD_TAB__OPC_MOD }, /* /mod */
+    /* 825 */ {  4308, UD_TAB__OPC_MOD }, /* /mod */
+    /* 826 */ {  4310, UD_TAB__OPC_MOD }, /* /mod */
+    /* 827 */ {  4312, UD_TAB__OPC_MOD }, /* /mod */
+    /* 828 */ {  4314, UD_TAB__OPC_MOD }, /* /mod */
+    /* 829 */ {  4316, UD_TAB__OPC_MOD }, /* /mod */
+    /* 830 */ {  4318, UD_TAB__OPC_MOD }, /* /mod */
+    /* 831 */ {  4320, UD_TAB__OPC_MOD }, /* /mod */
+    /* 832 */ {  4322, UD_TAB__OPC_MOD }, /* /mod */
+    /* 833 */ {  4324, UD_TAB__OPC_MOD }, /* /mod */
+    /* 834 */ {  4326, UD_TAB__OPC_MOD }, /* /mod */
+    /* 835 */ {  4328, UD_TAB__OPC_MOD }, /* /mod */
+    /* 836 */ {  4330, UD_TAB__OPC_MOD }, /* /mod */
+    /* 837 */ {  4332, UD_TAB__OPC_MOD }, /* /mod */
+    /* 838 */ {  4334, UD_TAB__OPC_MOD }, /* /mod */
+    /* 839 */ {  4336, UD_TAB__OPC_MOD }, /* /mod */
+    /* 840 */ {  4338, UD_TAB__OPC_MOD }, /* /mod */
+    /* 841 */ {  4340, UD_TAB__OPC_MOD }, /* /mod */
+    /* 842 */ {  4342, UD_TAB__OPC_MOD }, /* /mod */
+    /* 843 */ {  4344, UD_TAB__OPC_MOD }, /* /mod */
+    /* 844 */ {  4346, UD_TAB__OPC_MOD }, /* /mod */
+    /* 845 */ {  4348, UD_TAB__OPC_MOD }, /* /mod */
+    /* 846 */ {  4350, UD_TAB__OPC_MOD }, /* /mod */
+    /* 847 */ {  4352, UD_TAB__OPC_MOD }, /* /mod */
+    /* 848 */ {  4354, UD_TAB__OPC_MOD }, /* /mod */
+    /* 849 */ {  4356, UD_TAB__OPC_MOD }, /* /mod */
+    /* 850 */ {  4358, UD_TAB__OPC_MOD }, /* /mod */
+    /* 851 */ {  4360, UD_TAB__OPC_MOD }, /* /mod */
+    /* 852 */ {  4362, UD_TAB__OPC_MOD }, /* /mod */
+    /* 853 */ {  4364, UD_TAB__OPC_MOD }, /* /mod */
+    /* 854 */ {  4366, UD_TAB__OPC_MOD }, /* /mod */
+    /* 855 */ {  4368, UD_TAB__OPC_MOD }, /* /mod */
+    /* 856 */ {  4370, UD_TAB__OPC_MOD }, /* /mod */
+    /* 857 */ {  4372, UD_TAB__OPC_MOD }, /* /mod */
+    /* 858 */ {  4374, UD_TAB__OPC_MOD }, /* /mod */
+    /* 859 */ {  4376, UD_TAB__OPC_MOD }, /* /mod */
+    /* 860 */ {  4378, UD_TAB__OPC_MOD }, /* /mod */
+    /* 861 */ {  4380, UD_TAB__OPC_MOD }, /* /mod */
+    /* 862 */ {  4382, UD_TAB__OPC_MOD }, /* /mod */
+    /* 863 */ {  4384, UD_TAB__OPC_MOD }, /* /mod */
+    /* 864 */ {  4386, UD_TAB__OPC_MOD }, /* /mod */
+    /* 865 */ {  4388, UD_TAB__OPC_MOD }, /* /mod */
+    /* 866 */ {  4390, UD_TAB__OPC_REG }, /* /reg */
+    /* 867 */ {  4398, UD_TAB__OPC_MOD }, /* /mod */
+    /* 868 */ {  4400, UD_TAB__OPC_MOD }, /* /mod */
+    /* 869 */ {  4402, UD_TAB__OPC_MOD }, /* /mod */
+    /* 870 */ {  4404, UD_TAB__OPC_MOD }, /* /mod */
+    /* 871 */ {  4406, UD_TAB__OPC_MOD }, /* /mod */
+    /* 872 */ {  4408, UD_TAB__OPC_MOD }, /* /mod */
+    /* 873 */ {  4410, UD_TAB__OPC_MOD }, /* /mod */
+    /* 874 */ {  4412, UD_TAB__OPC_MOD }, /* /mod */
+    /* 875 */ {  4414, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 876 */ {  4478, UD_TAB__OPC_MOD }, /* /mod */
+    /* 877 */ {  4480, UD_TAB__OPC_MOD }, /* /mod */
+    /* 878 */ {  4482, UD_TAB__OPC_MOD }, /* /mod */
+    /* 879 */ {  4484, UD_TAB__OPC_MOD }, /* /mod */
+    /* 880 */ {  4486, UD_TAB__OPC_MOD }, /* /mod */
+    /* 881 */ {  4488, UD_TAB__OPC_MOD }, /* /mod */
+    /* 882 */ {  4490, UD_TAB__OPC_MOD }, /* /mod */
+    /* 883 */ {  4492, UD_TAB__OPC_MOD }, /* /mod */
+    /* 884 */ {  4494, UD_TAB__OPC_MOD }, /* /mod */
+    /* 885 */ {  4496, UD_TAB__OPC_MOD }, /* /mod */
+    /* 886 */ {  4498, UD_TAB__OPC_MOD }, /* /mod */
+    /* 887 */ {  4500, UD_TAB__OPC_MOD }, /* /mod */
+    /* 888 */ {  4502, UD_TAB__OPC_MOD }, /* /mod */
+    /* 889 */ {  4504, UD_TAB__OPC_MOD }, /* /mod */
+    /* 890 */ {  4506, UD_TAB__OPC_MOD }, /* /mod */
+    /* 891 */ {  4508, UD_TAB__OPC_MOD }, /* /mod */
+    /* 892 */ {  4510, UD_TAB__OPC_MOD }, /* /mod */
+    /* 893 */ {  4512, UD_TAB__OPC_MOD }, /* /mod */
+    /* 894 */ {  4514, UD_TAB__OPC_MOD }, /* /mod */
+    /* 895 */ {  4516, UD_TAB__OPC_MOD }, /* /mod */
+    /* 896 */ {  4518, UD_TAB__OPC_MOD }, /* /mod */
+    /* 897 */ {  4520, UD_TAB__OPC_MOD }, /* /mod */
+    /* 898 */ {  4522, UD_TAB__OPC_MOD }, /* /mod */
+    /* 899 */ {  4524, UD_TAB__OPC_MOD }, /* /mod */
+    /* 900 */ {  4526, UD_TAB__OPC_MOD }, /* /mod */
+    /* 901 */ {  4528, UD_TAB__OPC_MOD }, /* /mod */
+    /* 902 */ {  4530, UD_TAB__OPC_MOD }, /* /mod */
+    /* 903 */ {  4532, UD_TAB__OPC_MOD }, /* /mod */
+    /* 904 */ {  4534, UD_TAB__OPC_MOD }, /* /mod */
+    /* 905 */ {  4536, UD_TAB__OPC_MOD }, /* /mod */
+    /* 906 */ {  4538, UD_TAB__OPC_MOD }, /* /mod */
+    /* 907 */ {  4540, UD_TAB__OPC_MOD }, /* /mod */
+    /* 908 */ {  4542, UD_TAB__OPC_MOD }, /* /mod */
+    /* 909 */ {  4544, UD_TAB__OPC_MOD }, /* /mod */
+    /* 910 */ {  4546, UD_TAB__OPC_MOD }, /* /mod */
+    /* 911 */ {  4548, UD_TAB__OPC_MOD }, /* /mod */
+    /* 912 */ {  4550, UD_TAB__OPC_MOD }, /* /mod */
+    /* 913 */ {  4552, UD_TAB__OPC_MOD }, /* /mod */
+    /* 914 */ {  4554, UD_TAB__OPC_MOD }, /* /mod */
+    /* 915 */ {  4556, UD_TAB__OPC_MOD }, /* /mod */
+    /* 916 */ {  4558, UD_TAB__OPC_MOD }, /* /mod */
+    /* 917 */ {  4560, UD_TAB__OPC_MOD }, /* /mod */
+    /* 918 */ {  4562, UD_TAB__OPC_MOD }, /* /mod */
+    /* 919 */ {  4564, UD_TAB__OPC_MOD }, /* /mod */
+    /* 920 */ {  4566, UD_TAB__OPC_MOD }, /* /mod */
+    /* 921 */ {  4568, UD_TAB__OPC_MOD }, /* /mod */
+    /* 922 */ {  4570, UD_TAB__OPC_MOD }, /* /mod */
+    /* 923 */ {  4572, UD_TAB__OPC_MOD }, /* /mod */
+    /* 924 */ {  4574, UD_TAB__OPC_MOD }, /* /mod */
+    /* 925 */ {  4576, UD_TAB__OPC_MOD }, /* /mod */
+    /* 926 */ {  4578, UD_TAB__OPC_MOD }, /* /mod */
+    /* 927 */ {  4580, UD_TAB__OPC_MOD }, /* /mod */
+    /* 928 */ {  4582, UD_TAB__OPC_MOD }, /* /mod */
+    /* 929 */ {  4584, UD_TAB__OPC_MOD }, /* /mod */
+    /* 930 */ {  4586, UD_TAB__OPC_MOD }, /* /mod */
+    /* 931 */ {  4588, UD_TAB__OPC_MOD }, /* /mod */
+    /* 932 */ {  4590, UD_TAB__OPC_MOD }, /* /mod */
+    /* 933 */ {  4592, UD_TAB__OPC_MOD }, /* /mod */
+    /* 934 */ {  4594, UD_TAB__OPC_MOD }, /* /mod */
+    /* 935 */ {  4596, UD_TAB__OPC_MOD }, /* /mod */
+    /* 936 */ {  4598, UD_TAB__OPC_MOD }, /* /mod */
+    /* 937 */ {  4600, UD_TAB__OPC_MOD }, /* /mod */
+    /* 938 */ {  4602, UD_TAB__OPC_MOD }, /* /mod */
+    /* 939 */ {  4604, UD_TAB__OPC_MOD }, /* /mod */
+    /* 940 */ {  4606, UD_TAB__OPC_MOD }, /* /mod */
+    /* 941 */ {  4608, UD_TAB__OPC_REG }, /* /reg */
+    /* 942 */ {  4616, UD_TAB__OPC_MOD }, /* /mod */
+    /* 943 */ {  4618, UD_TAB__OPC_MOD }, /* /mod */
+    /* 944 */ {  4620, UD_TAB__OPC_MOD }, /* /mod */
+    /* 945 */ {  4622, UD_TAB__OPC_MOD }, /* /mod */
+    /* 946 */ {  4624, UD_TAB__OPC_MOD }, /* /mod */
+    /* 947 */ {  4626, UD_TAB__OPC_MOD }, /* /mod */
+    /* 948 */ {  4628, UD_TAB__OPC_MOD }, /* /mod */
+    /* 949 */ {  4630, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 950 */ {  4694, UD_TAB__OPC_MOD }, /* /mod */
+    /* 951 */ {  4696, UD_TAB__OPC_MOD }, /* /mod */
+    /* 952 */ {  4698, UD_TAB__OPC_MOD }, /* /mod */
+    /* 953 */ {  4700, UD_TAB__OPC_MOD }, /* /mod */
+    /* 954 */ {  4702, UD_TAB__OPC_MOD }, /* /mod */
+    /* 955 */ {  4704, UD_TAB__OPC_MOD }, /* /mod */
+    /* 956 */ {  4706, UD_TAB__OPC_MOD }, /* /mod */
+    /* 957 */ {  4708, UD_TAB__OPC_MOD }, /* /mod */
+    /* 958 */ {  4710, UD_TAB__OPC_MOD }, /* /mod */
+    /* 959 */ {  4712, UD_TAB__OPC_MOD }, /* /mod */
+    /* 960 */ {  4714, UD_TAB__OPC_MOD }, /* /mod */
+    /* 961 */ {  4716, UD_TAB__OPC_MOD }, /* /mod */
+    /* 962 */ {  4718, UD_TAB__OPC_MOD }, /* /mod */
+    /* 963 */ {  4720, UD_TAB__OPC_MOD }, /* /mod */
+    /* 964 */ {  4722, UD_TAB__OPC_MOD }, /* /mod */
+    /* 965 */ {  4724, UD_TAB__OPC_MOD }, /* /mod */
+    /* 966 */ {  4726, UD_TAB__OPC_MOD }, /* /mod */
+    /* 967 */ {  4728, UD_TAB__OPC_MOD }, /* /mod */
+    /* 968 */ {  4730, UD_TAB__OPC_MOD }, /* /mod */
+    /* 969 */ {  4732, UD_TAB__OPC_MOD }, /* /mod */
+    /* 970 */ {  4734, UD_TAB__OPC_MOD }, /* /mod */
+    /* 971 */ {  4736, UD_TAB__OPC_MOD }, /* /mod */
+    /* 972 */ {  4738, UD_TAB__OPC_MOD }, /* /mod */
+    /* 973 */ {  4740, UD_TAB__OPC_MOD }, /* /mod */
+    /* 974 */ {  4742, UD_TAB__OPC_MOD }, /* /mod */
+    /* 975 */ {  4744, UD_TAB__OPC_MOD }, /* /mod */
+    /* 976 */ {  4746, UD_TAB__OPC_MOD }, /* /mod */
+    /* 977 */ {  4748, UD_TAB__OPC_MOD }, /* /mod */
+    /* 978 */ {  4750, UD_TAB__OPC_MOD }, /* /mod */
+    /* 979 */ {  4752, UD_TAB__OPC_MOD }, /* /mod */
+    /* 980 */ {  4754, UD_TAB__OPC_MOD }, /* /mod */
+    /* 981 */ {  4756, UD_TAB__OPC_MOD }, /* /mod */
+    /* 982 */ {  4758, UD_TAB__OPC_MOD }, /* /mod */
+    /* 983 */ {  4760, UD_TAB__OPC_MOD }, /* /mod */
+    /* 984 */ {  4762, UD_TAB__OPC_MOD }, /* /mod */
+    /* 985 */ {  4764, UD_TAB__OPC_MOD }, /* /mod */
+    /* 986 */ {  4766, UD_TAB__OPC_MOD }, /* /mod */
+    /* 987 */ {  4768, UD_TAB__OPC_MOD }, /* /mod */
+    /* 988 */ {  4770, UD_TAB__OPC_MOD }, /* /mod */
+    /* 989 */ {  4772, UD_TAB__OPC_MOD }, /* /mod */
+    /* 990 */ {  4774, UD_TAB__OPC_MOD }, /* /mod */
+    /* 991 */ {  4776, UD_TAB__OPC_MOD }, /* /mod */
+    /* 992 */ {  4778, UD_TAB__OPC_MOD }, /* /mod */
+    /* 993 */ {  4780, UD_TAB__OPC_MOD }, /* /mod */
+    /* 994 */ {  4782, UD_TAB__OPC_MOD }, /* /mod */
+    /* 995 */ {  4784, UD_TAB__OPC_MOD }, /* /mod */
+    /* 996 */ {  4786, UD_TAB__OPC_MOD }, /* /mod */
+    /* 997 */ {  4788, UD_TAB__OPC_MOD }, /* /mod */
+    /* 998 */ {  4790, UD_TAB__OPC_MOD }, /* /mod */
+    /* 999 */ {  4792, UD_TAB__OPC_REG }, /* /reg */
+    /* 1000 */ {  4800, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1001 */ {  4802, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1002 */ {  4804, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1003 */ {  4806, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1004 */ {  4808, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1005 */ {  4810, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1006 */ {  4812, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1007 */ {  4814, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1008 */ {  4816, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 1009 */ {  4880, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1010 */ {  4882, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1011 */ {  4884, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1012 */ {  4886, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1013 */ {  4888, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1014 */ {  4890, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1015 */ {  4892, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1016 */ {  4894, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1017 */ {  4896, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1018 */ {  4898, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1019 */ {  4900, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1020 */ {  4902, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1021 */ {  4904, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1022 */ {  4906, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1023 */ {  4908, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1024 */ {  4910, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1025 */ {  4912, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1026 */ {  4914, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1027 */ {  4916, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1028 */ {  4918, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1029 */ {  4920, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1030 */ {  4922, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1031 */ {  4924, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1032 */ {  4926, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1033 */ {  4928, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1034 */ {  4930, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1035 */ {  4932, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1036 */ {  4934, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1037 */ {  4936, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1038 */ {  4938, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1039 */ {  4940, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1040 */ {  4942, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1041 */ {  4944, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1042 */ {  4946, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1043 */ {  4948, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1044 */ {  4950, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1045 */ {  4952, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1046 */ {  4954, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1047 */ {  4956, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1048 */ {  4958, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1049 */ {  4960, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1050 */ {  4962, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1051 */ {  4964, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1052 */ {  4966, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1053 */ {  4968, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1054 */ {  4970, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1055 */ {  4972, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1056 */ {  4974, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1057 */ {  4976, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1058 */ {  4978, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1059 */ {  4980, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1060 */ {  4982, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1061 */ {  4984, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1062 */ {  4986, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1063 */ {  4988, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1064 */ {  4990, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1065 */ {  4992, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1066 */ {  4994, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1067 */ {  4996, UD_TAB__OPC_REG }, /* /reg */
+    /* 1068 */ {  5004, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1069 */ {  5006, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1070 */ {  5008, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1071 */ {  5010, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1072 */ {  5012, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1073 */ {  5014, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1074 */ {  5016, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1075 */ {  5018, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1076 */ {  5020, UD_TAB__OPC_X87 }, /* /x87 */
+    /* 1077 */ {  5084, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1078 */ {  5086, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1079 */ {  5088, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1080 */ {  5090, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1081 */ {  5092, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1082 */ {  5094, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1083 */ {  5096, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1084 */ {  5098, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1085 */ {  5100, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1086 */ {  5102, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1087 */ {  5104, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1088 */ {  5106, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1089 */ {  5108, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1090 */ {  5110, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1091 */ {  5112, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1092 */ {  5114, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1093 */ {  5116, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1094 */ {  5118, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1095 */ {  5120, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1096 */ {  5122, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1097 */ {  5124, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1098 */ {  5126, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1099 */ {  5128, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1100 */ {  5130, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1101 */ {  5132, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1102 */ {  5134, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1103 */ {  5136, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1104 */ {  5138, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1105 */ {  5140, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1106 */ {  5142, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1107 */ {  5144, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1108 */ {  5146, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1109 */ {  5148, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1110 */ {  5150, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1111 */ {  5152, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1112 */ {  5154, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1113 */ {  5156, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1114 */ {  5158, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1115 */ {  5160, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1116 */ {  5162, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1117 */ {  5164, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1118 */ {  5166, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1119 */ {  5168, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1120 */ {  5170, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1121 */ {  5172, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1122 */ {  5174, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1123 */ {  5176, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1124 */ {  5178, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1125 */ {  5180, UD_TAB__OPC_MOD }, /* /mod */
+    /* 1126 */ {  5182, UD_TAB__OPC_ASIZE }, /* /a */
+    /* 1127 */ {  5185, UD_TAB__OPC_MODE }, /* /m */
+    /* 1128 */ {  5187, UD_TAB__OPC_REG }, /* /reg */
+    /* 1129 */ {  5195, UD_TAB__OPC_REG }, /* /reg */
+    /* 1130 */ {  5203, UD_TAB__OPC_REG }, /* /reg */
+    /* 1131 */ {  5211, UD_TAB__OPC_REG }, /* /reg */
+    /* 1132 */ {  5219, UD_TAB__OPC_MODE }, /* /m */
 };
 
 /* itab entry operand definitions (for readability) */
@@ -6294,1458 +4035,1684 @@ struct ud_lookup_table_list_entry ud_lookup_table_list[] = {
 #define O_sIv     { OP_sI,       SZ_V     }
 #define O_sIz     { OP_sI,       SZ_Z     }
 
-struct ud_itab_entry ud_itab[] = {
-  /* 0000 */ { UD_Iinvalid, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0001 */ { UD_Iadd, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0002 */ { UD_Iadd, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0003 */ { UD_Iadd, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0004 */ { UD_Iadd, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0005 */ { UD_Iadd, O_AL, O_Ib, O_NONE, P_none },
-  /* 0006 */ { UD_Iadd, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0007 */ { UD_Ipush, O_ES, O_NONE, O_NONE, P_inv64 },
-  /* 0008 */ { UD_Ipop, O_ES, O_NONE, O_NONE, P_inv64 },
-  /* 0009 */ { UD_Ior, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0010 */ { UD_Ior, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0011 */ { UD_Ior, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0012 */ { UD_Ior, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0013 */ { UD_Ior, O_AL, O_Ib, O_NONE, P_none },
-  /* 0014 */ { UD_Ior, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0015 */ { UD_Ipush, O_CS, O_NONE, O_NONE, P_inv64 },
-  /* 0016 */ { UD_Isldt, O_MwRv, O_NONE, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0017 */ { UD_Istr, O_MwRv, O_NONE, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0018 */ { UD_Illdt, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0019 */ { UD_Iltr, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0020 */ { UD_Iverr, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0021 */ { UD_Iverw, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0022 */ { UD_Isgdt, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0023 */ { UD_Isidt, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0024 */ { UD_Ilgdt, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0025 */ { UD_Ilidt, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0026 */ { UD_Ismsw, O_MwRv, O_NONE, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0027 */ { UD_Ilmsw, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0028 */ { UD_Iinvlpg, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0029 */ { UD_Ivmcall, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0030 */ { UD_Ivmlaunch, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0031 */ { UD_Ivmresume, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0032 */ { UD_Ivmxoff, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0033 */ { UD_Imonitor, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0034 */ { UD_Imwait, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0035 */ { UD_Ixgetbv, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0036 */ { UD_Ixsetbv, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0037 */ { UD_Ivmrun, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0038 */ { UD_Ivmmcall, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0039 */ { UD_Ivmload, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0040 */ { UD_Ivmsave, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0041 */ { UD_Istgi, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0042 */ { UD_Iclgi, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0043 */ { UD_Iskinit, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0044 */ { UD_Iinvlpga, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0045 */ { UD_Ismsw, O_MwRv, O_NONE, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0046 */ { UD_Ilmsw, O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0047 */ { UD_Iswapgs, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0048 */ { UD_Irdtscp, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0049 */ { UD_Ilar, O_Gv, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0050 */ { UD_Ilsl, O_Gv, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0051 */ { UD_Isyscall, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0052 */ { UD_Iclts, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0053 */ { UD_Isysret, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0054 */ { UD_Iinvd, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0055 */ { UD_Iwbinvd, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0056 */ { UD_Iud2, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0057 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0058 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0059 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0060 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0061 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0062 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0063 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0064 */ { UD_Iprefetch, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0065 */ { UD_Ifemms, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0066 */ { UD_Ipi2fw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0067 */ { UD_Ipi2fd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0068 */ { UD_Ipf2iw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0069 */ { UD_Ipf2id, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0070 */ { UD_Ipfnacc, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0071 */ { UD_Ipfpnacc, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0072 */ { UD_Ipfcmpge, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0073 */ { UD_Ipfmin, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0074 */ { UD_Ipfrcp, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0075 */ { UD_Ipfrsqrt, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0076 */ { UD_Ipfsub, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0077 */ { UD_Ipfadd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0078 */ { UD_Ipfcmpgt, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0079 */ { UD_Ipfmax, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0080 */ { UD_Ipfrcpit1, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0081 */ { UD_Ipfrsqit1, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0082 */ { UD_Ipfsubr, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0083 */ { UD_Ipfacc, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0084 */ { UD_Ipfcmpeq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0085 */ { UD_Ipfmul, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0086 */ { UD_Ipfrcpit2, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0087 */ { UD_Ipmulhrw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0088 */ { UD_Ipswapd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0089 */ { UD_Ipavgusb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0090 */ { UD_Imovups, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0091 */ { UD_Imovsd, O_V, O_W, O_NONE, P_str|P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0092 */ { UD_Imovss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0093 */ { UD_Imovupd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0094 */ { UD_Imovups, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0095 */ { UD_Imovsd, O_W, O_V, O_NONE, P_str|P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0096 */ { UD_Imovss, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0097 */ { UD_Imovupd, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0098 */ { UD_Imovlps, O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0099 */ { UD_Imovddup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0100 */ { UD_Imovsldup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0101 */ { UD_Imovlpd, O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0102 */ { UD_Imovhlps, O_V, O_U, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0103 */ { UD_Imovddup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0104 */ { UD_Imovsldup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0105 */ { UD_Imovlps, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0106 */ { UD_Imovlpd, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0107 */ { UD_Iunpcklps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0108 */ { UD_Iunpcklpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0109 */ { UD_Iunpckhps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0110 */ { UD_Iunpckhpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0111 */ { UD_Imovhps, O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0112 */ { UD_Imovshdup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0113 */ { UD_Imovhpd, O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0114 */ { UD_Imovlhps, O_V, O_U, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0115 */ { UD_Imovshdup, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0116 */ { UD_Imovhps, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0117 */ { UD_Imovhpd, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0118 */ { UD_Iprefetchnta, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0119 */ { UD_Iprefetcht0, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0120 */ { UD_Iprefetcht1, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0121 */ { UD_Iprefetcht2, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0122 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0123 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0124 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0125 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0126 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0127 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0128 */ { UD_Inop, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0129 */ { UD_Imov, O_R, O_C, O_NONE, P_rexr|P_rexw|P_rexb },
-  /* 0130 */ { UD_Imov, O_R, O_D, O_NONE, P_rexr|P_rexw|P_rexb },
-  /* 0131 */ { UD_Imov, O_C, O_R, O_NONE, P_rexr|P_rexw|P_rexb },
-  /* 0132 */ { UD_Imov, O_D, O_R, O_NONE, P_rexr|P_rexw|P_rexb },
-  /* 0133 */ { UD_Imovaps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0134 */ { UD_Imovapd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0135 */ { UD_Imovaps, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0136 */ { UD_Imovapd, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0137 */ { UD_Icvtpi2ps, O_V, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0138 */ { UD_Icvtsi2sd, O_V, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0139 */ { UD_Icvtsi2ss, O_V, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0140 */ { UD_Icvtpi2pd, O_V, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0141 */ { UD_Imovntps, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0142 */ { UD_Imovntpd, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0143 */ { UD_Icvttps2pi, O_P, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0144 */ { UD_Icvttsd2si, O_Gy, O_W, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0145 */ { UD_Icvttss2si, O_Gy, O_W, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0146 */ { UD_Icvttpd2pi, O_P, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0147 */ { UD_Icvtps2pi, O_P, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0148 */ { UD_Icvtsd2si, O_Gy, O_W, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0149 */ { UD_Icvtss2si, O_Gy, O_W, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0150 */ { UD_Icvtpd2pi, O_P, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0151 */ { UD_Iucomiss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0152 */ { UD_Iucomisd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0153 */ { UD_Icomiss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0154 */ { UD_Icomisd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0155 */ { UD_Iwrmsr, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0156 */ { UD_Irdtsc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0157 */ { UD_Irdmsr, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0158 */ { UD_Irdpmc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0159 */ { UD_Isysenter, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0160 */ { UD_Isysenter, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0161 */ { UD_Isysexit, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0162 */ { UD_Isysexit, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0163 */ { UD_Igetsec, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0164 */ { UD_Ipshufb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0165 */ { UD_Ipshufb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0166 */ { UD_Iphaddw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0167 */ { UD_Iphaddw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0168 */ { UD_Iphaddd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0169 */ { UD_Iphaddd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0170 */ { UD_Iphaddsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0171 */ { UD_Iphaddsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0172 */ { UD_Ipmaddubsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0173 */ { UD_Ipmaddubsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0174 */ { UD_Iphsubw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0175 */ { UD_Iphsubw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0176 */ { UD_Iphsubd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0177 */ { UD_Iphsubd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0178 */ { UD_Iphsubsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0179 */ { UD_Iphsubsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0180 */ { UD_Ipsignb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0181 */ { UD_Ipsignb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0182 */ { UD_Ipsignw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0183 */ { UD_Ipsignw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0184 */ { UD_Ipsignd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0185 */ { UD_Ipsignd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0186 */ { UD_Ipmulhrsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0187 */ { UD_Ipmulhrsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0188 */ { UD_Ipblendvb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0189 */ { UD_Iblendvps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0190 */ { UD_Iblendvpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0191 */ { UD_Iptest, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0192 */ { UD_Ipabsb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0193 */ { UD_Ipabsb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0194 */ { UD_Ipabsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0195 */ { UD_Ipabsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0196 */ { UD_Ipabsd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0197 */ { UD_Ipabsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0198 */ { UD_Ipmovsxbw, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0199 */ { UD_Ipmovsxbd, O_V, O_MdU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0200 */ { UD_Ipmovsxbq, O_V, O_MwU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0201 */ { UD_Ipmovsxwd, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0202 */ { UD_Ipmovsxwq, O_V, O_MdU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0203 */ { UD_Ipmovsxdq, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0204 */ { UD_Ipmuldq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0205 */ { UD_Ipcmpeqq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0206 */ { UD_Imovntdqa, O_V, O_Mo, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0207 */ { UD_Ipackusdw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0208 */ { UD_Ipmovzxbw, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0209 */ { UD_Ipmovzxbd, O_V, O_MdU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0210 */ { UD_Ipmovzxbq, O_V, O_MwU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0211 */ { UD_Ipmovzxwd, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0212 */ { UD_Ipmovzxwq, O_V, O_MdU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0213 */ { UD_Ipmovzxdq, O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0214 */ { UD_Ipcmpgtq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0215 */ { UD_Ipminsb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0216 */ { UD_Ipminsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0217 */ { UD_Ipminuw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0218 */ { UD_Ipminud, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0219 */ { UD_Ipmaxsb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0220 */ { UD_Ipmaxsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0221 */ { UD_Ipmaxuw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0222 */ { UD_Ipmaxud, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0223 */ { UD_Ipmulld, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0224 */ { UD_Iphminposuw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0225 */ { UD_Iinvept, O_Gq, O_Mo, O_NONE, P_none },
-  /* 0226 */ { UD_Iinvvpid, O_Gq, O_Mo, O_NONE, P_none },
-  /* 0227 */ { UD_Iaesimc, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0228 */ { UD_Iaesenc, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0229 */ { UD_Iaesenclast, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0230 */ { UD_Iaesdec, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0231 */ { UD_Iaesdeclast, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0232 */ { UD_Imovbe, O_Gv, O_Mv, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0233 */ { UD_Icrc32, O_Gy, O_Eb, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0234 */ { UD_Imovbe, O_Mv, O_Gv, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0235 */ { UD_Icrc32, O_Gy, O_Ev, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0236 */ { UD_Iroundps, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0237 */ { UD_Iroundpd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0238 */ { UD_Iroundss, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0239 */ { UD_Iroundsd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0240 */ { UD_Iblendps, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0241 */ { UD_Iblendpd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0242 */ { UD_Ipblendw, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0243 */ { UD_Ipalignr, O_P, O_Q, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0244 */ { UD_Ipalignr, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0245 */ { UD_Ipextrb, O_MbRv, O_V, O_Ib, P_aso|P_rexx|P_rexr|P_rexb|P_def64 },
-  /* 0246 */ { UD_Ipextrw, O_MwRd, O_V, O_Ib, P_aso|P_rexx|P_rexr|P_rexb },
-  /* 0247 */ { UD_Ipextrd, O_Ed, O_V, O_Ib, P_aso|P_rexr|P_rexx|P_rexw|P_rexb },
-  /* 0248 */ { UD_Ipextrd, O_Ed, O_V, O_Ib, P_aso|P_rexr|P_rexx|P_rexw|P_rexb },
-  /* 0249 */ { UD_Ipextrq, O_Eq, O_V, O_Ib, P_aso|P_rexr|P_rexw|P_rexb|P_def64 },
-  /* 0250 */ { UD_Iextractps, O_MdRy, O_V, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0251 */ { UD_Ipinsrb, O_V, O_MbRd, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0252 */ { UD_Iinsertps, O_V, O_Md, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0253 */ { UD_Ipinsrd, O_V, O_Ed, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0254 */ { UD_Ipinsrd, O_V, O_Ed, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0255 */ { UD_Ipinsrq, O_V, O_Eq, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0256 */ { UD_Idpps, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0257 */ { UD_Idppd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0258 */ { UD_Impsadbw, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0259 */ { UD_Ipclmulqdq, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0260 */ { UD_Ipcmpestrm, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0261 */ { UD_Ipcmpestri, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0262 */ { UD_Ipcmpistrm, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0263 */ { UD_Ipcmpistri, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0264 */ { UD_Iaeskeygenassist, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0265 */ { UD_Icmovo, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0266 */ { UD_Icmovno, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0267 */ { UD_Icmovb, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0268 */ { UD_Icmovae, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0269 */ { UD_Icmovz, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0270 */ { UD_Icmovnz, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0271 */ { UD_Icmovbe, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0272 */ { UD_Icmova, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0273 */ { UD_Icmovs, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0274 */ { UD_Icmovns, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0275 */ { UD_Icmovp, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0276 */ { UD_Icmovnp, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0277 */ { UD_Icmovl, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0278 */ { UD_Icmovge, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0279 */ { UD_Icmovle, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0280 */ { UD_Icmovg, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0281 */ { UD_Imovmskps, O_Gd, O_U, O_NONE, P_oso|P_rexr|P_rexb },
-  /* 0282 */ { UD_Imovmskpd, O_Gd, O_U, O_NONE, P_oso|P_rexr|P_rexb },
-  /* 0283 */ { UD_Isqrtps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0284 */ { UD_Isqrtsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0285 */ { UD_Isqrtss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0286 */ { UD_Isqrtpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0287 */ { UD_Irsqrtps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0288 */ { UD_Irsqrtss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0289 */ { UD_Ircpps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0290 */ { UD_Ircpss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0291 */ { UD_Iandps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0292 */ { UD_Iandpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0293 */ { UD_Iandnps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0294 */ { UD_Iandnpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0295 */ { UD_Iorps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0296 */ { UD_Iorpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0297 */ { UD_Ixorps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0298 */ { UD_Ixorpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0299 */ { UD_Iaddps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0300 */ { UD_Iaddsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0301 */ { UD_Iaddss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0302 */ { UD_Iaddpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0303 */ { UD_Imulps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0304 */ { UD_Imulsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0305 */ { UD_Imulss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0306 */ { UD_Imulpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0307 */ { UD_Icvtps2pd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0308 */ { UD_Icvtsd2ss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0309 */ { UD_Icvtss2sd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0310 */ { UD_Icvtpd2ps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0311 */ { UD_Icvtdq2ps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0312 */ { UD_Icvttps2dq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0313 */ { UD_Icvtps2dq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0314 */ { UD_Isubps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0315 */ { UD_Isubsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0316 */ { UD_Isubss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0317 */ { UD_Isubpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0318 */ { UD_Iminps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0319 */ { UD_Iminsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0320 */ { UD_Iminss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0321 */ { UD_Iminpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0322 */ { UD_Idivps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0323 */ { UD_Idivsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0324 */ { UD_Idivss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0325 */ { UD_Idivpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0326 */ { UD_Imaxps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0327 */ { UD_Imaxsd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0328 */ { UD_Imaxss, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0329 */ { UD_Imaxpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0330 */ { UD_Ipunpcklbw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0331 */ { UD_Ipunpcklbw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0332 */ { UD_Ipunpcklwd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0333 */ { UD_Ipunpcklwd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0334 */ { UD_Ipunpckldq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0335 */ { UD_Ipunpckldq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0336 */ { UD_Ipacksswb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0337 */ { UD_Ipacksswb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0338 */ { UD_Ipcmpgtb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0339 */ { UD_Ipcmpgtb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0340 */ { UD_Ipcmpgtw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0341 */ { UD_Ipcmpgtw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0342 */ { UD_Ipcmpgtd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0343 */ { UD_Ipcmpgtd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0344 */ { UD_Ipackuswb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0345 */ { UD_Ipackuswb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0346 */ { UD_Ipunpckhbw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0347 */ { UD_Ipunpckhbw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0348 */ { UD_Ipunpckhwd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0349 */ { UD_Ipunpckhwd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0350 */ { UD_Ipunpckhdq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0351 */ { UD_Ipunpckhdq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0352 */ { UD_Ipackssdw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0353 */ { UD_Ipackssdw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0354 */ { UD_Ipunpcklqdq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0355 */ { UD_Ipunpckhqdq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0356 */ { UD_Imovd, O_P, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0357 */ { UD_Imovd, O_V, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0358 */ { UD_Imovq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0359 */ { UD_Imovdqu, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0360 */ { UD_Imovdqa, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0361 */ { UD_Ipshufw, O_P, O_Q, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0362 */ { UD_Ipshuflw, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0363 */ { UD_Ipshufhw, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0364 */ { UD_Ipshufd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0365 */ { UD_Ipsrlw, O_N, O_Ib, O_NONE, P_none },
-  /* 0366 */ { UD_Ipsrlw, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0367 */ { UD_Ipsraw, O_N, O_Ib, O_NONE, P_none },
-  /* 0368 */ { UD_Ipsraw, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0369 */ { UD_Ipsllw, O_N, O_Ib, O_NONE, P_none },
-  /* 0370 */ { UD_Ipsllw, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0371 */ { UD_Ipsrld, O_N, O_Ib, O_NONE, P_none },
-  /* 0372 */ { UD_Ipsrld, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0373 */ { UD_Ipsrad, O_N, O_Ib, O_NONE, P_none },
-  /* 0374 */ { UD_Ipsrad, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0375 */ { UD_Ipslld, O_N, O_Ib, O_NONE, P_none },
-  /* 0376 */ { UD_Ipslld, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0377 */ { UD_Ipsrlq, O_N, O_Ib, O_NONE, P_none },
-  /* 0378 */ { UD_Ipsrlq, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0379 */ { UD_Ipsrldq, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0380 */ { UD_Ipsllq, O_N, O_Ib, O_NONE, P_none },
-  /* 0381 */ { UD_Ipsllq, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0382 */ { UD_Ipslldq, O_U, O_Ib, O_NONE, P_rexb },
-  /* 0383 */ { UD_Ipcmpeqb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0384 */ { UD_Ipcmpeqb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0385 */ { UD_Ipcmpeqw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0386 */ { UD_Ipcmpeqw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0387 */ { UD_Ipcmpeqd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0388 */ { UD_Ipcmpeqd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0389 */ { UD_Iemms, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0390 */ { UD_Ivmread, O_Ey, O_Gy, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 0391 */ { UD_Ivmwrite, O_Gy, O_Ey, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 0392 */ { UD_Ihaddps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0393 */ { UD_Ihaddpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0394 */ { UD_Ihsubps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0395 */ { UD_Ihsubpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0396 */ { UD_Imovd, O_Ey, O_P, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0397 */ { UD_Imovq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0398 */ { UD_Imovd, O_Ey, O_V, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0399 */ { UD_Imovq, O_Q, O_P, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0400 */ { UD_Imovdqu, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0401 */ { UD_Imovdqa, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0402 */ { UD_Ijo, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0403 */ { UD_Ijno, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0404 */ { UD_Ijb, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0405 */ { UD_Ijae, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0406 */ { UD_Ijz, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0407 */ { UD_Ijnz, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0408 */ { UD_Ijbe, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0409 */ { UD_Ija, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0410 */ { UD_Ijs, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0411 */ { UD_Ijns, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0412 */ { UD_Ijp, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0413 */ { UD_Ijnp, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0414 */ { UD_Ijl, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0415 */ { UD_Ijge, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0416 */ { UD_Ijle, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0417 */ { UD_Ijg, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0418 */ { UD_Iseto, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0419 */ { UD_Isetno, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0420 */ { UD_Isetb, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0421 */ { UD_Isetae, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0422 */ { UD_Isetz, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0423 */ { UD_Isetnz, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0424 */ { UD_Isetbe, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0425 */ { UD_Iseta, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0426 */ { UD_Isets, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0427 */ { UD_Isetns, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0428 */ { UD_Isetp, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0429 */ { UD_Isetnp, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0430 */ { UD_Isetl, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0431 */ { UD_Isetge, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0432 */ { UD_Isetle, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0433 */ { UD_Isetg, O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0434 */ { UD_Ipush, O_FS, O_NONE, O_NONE, P_none },
-  /* 0435 */ { UD_Ipop, O_FS, O_NONE, O_NONE, P_none },
-  /* 0436 */ { UD_Icpuid, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0437 */ { UD_Ibt, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0438 */ { UD_Ishld, O_Ev, O_Gv, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0439 */ { UD_Ishld, O_Ev, O_Gv, O_CL, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0440 */ { UD_Imontmul, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0441 */ { UD_Ixsha1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0442 */ { UD_Ixsha256, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0443 */ { UD_Ixstore, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0444 */ { UD_Ixcryptecb, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0445 */ { UD_Ixcryptcbc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0446 */ { UD_Ixcryptctr, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0447 */ { UD_Ixcryptcfb, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0448 */ { UD_Ixcryptofb, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0449 */ { UD_Ipush, O_GS, O_NONE, O_NONE, P_none },
-  /* 0450 */ { UD_Ipop, O_GS, O_NONE, O_NONE, P_none },
-  /* 0451 */ { UD_Irsm, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0452 */ { UD_Ibts, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0453 */ { UD_Ishrd, O_Ev, O_Gv, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0454 */ { UD_Ishrd, O_Ev, O_Gv, O_CL, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0455 */ { UD_Ifxsave, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0456 */ { UD_Ifxrstor, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0457 */ { UD_Ildmxcsr, O_Md, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0458 */ { UD_Istmxcsr, O_Md, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0459 */ { UD_Ixsave, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0460 */ { UD_Ixrstor, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0461 */ { UD_Iclflush, O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0462 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0463 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0464 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0465 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0466 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0467 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0468 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0469 */ { UD_Ilfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0470 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0471 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0472 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0473 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0474 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0475 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0476 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0477 */ { UD_Imfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0478 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0479 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0480 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0481 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0482 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0483 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0484 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0485 */ { UD_Isfence, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0486 */ { UD_Iimul, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0487 */ { UD_Icmpxchg, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0488 */ { UD_Icmpxchg, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0489 */ { UD_Ilss, O_Gv, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0490 */ { UD_Ibtr, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0491 */ { UD_Ilfs, O_Gz, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0492 */ { UD_Ilgs, O_Gz, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0493 */ { UD_Imovzx, O_Gv, O_Eb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0494 */ { UD_Imovzx, O_Gy, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0495 */ { UD_Ipopcnt, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
-  /* 0496 */ { UD_Ibt, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0497 */ { UD_Ibts, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0498 */ { UD_Ibtr, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0499 */ { UD_Ibtc, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0500 */ { UD_Ibtc, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0501 */ { UD_Ibsf, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0502 */ { UD_Ibsr, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0503 */ { UD_Imovsx, O_Gv, O_Eb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0504 */ { UD_Imovsx, O_Gy, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0505 */ { UD_Ixadd, O_Eb, O_Gb, O_NONE, P_aso|P_oso|P_rexr|P_rexx|P_rexb },
-  /* 0506 */ { UD_Ixadd, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0507 */ { UD_Icmpps, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0508 */ { UD_Icmpsd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0509 */ { UD_Icmpss, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0510 */ { UD_Icmppd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0511 */ { UD_Imovnti, O_M, O_Gy, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0512 */ { UD_Ipinsrw, O_P, O_MwRy, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 0513 */ { UD_Ipinsrw, O_V, O_MwRy, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 0514 */ { UD_Ipextrw, O_Gd, O_N, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0515 */ { UD_Ipextrw, O_Gd, O_U, O_Ib, P_aso|P_rexr|P_rexb },
-  /* 0516 */ { UD_Ishufps, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0517 */ { UD_Ishufpd, O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0518 */ { UD_Icmpxchg8b, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0519 */ { UD_Icmpxchg8b, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0520 */ { UD_Icmpxchg16b, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0521 */ { UD_Ivmptrld, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0522 */ { UD_Ivmxon, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0523 */ { UD_Ivmclear, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0524 */ { UD_Ivmptrst, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0525 */ { UD_Ibswap, O_R0y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0526 */ { UD_Ibswap, O_R1y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0527 */ { UD_Ibswap, O_R2y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0528 */ { UD_Ibswap, O_R3y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0529 */ { UD_Ibswap, O_R4y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0530 */ { UD_Ibswap, O_R5y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0531 */ { UD_Ibswap, O_R6y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0532 */ { UD_Ibswap, O_R7y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0533 */ { UD_Iaddsubps, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0534 */ { UD_Iaddsubpd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0535 */ { UD_Ipsrlw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0536 */ { UD_Ipsrlw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0537 */ { UD_Ipsrld, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0538 */ { UD_Ipsrld, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0539 */ { UD_Ipsrlq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0540 */ { UD_Ipsrlq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0541 */ { UD_Ipaddq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0542 */ { UD_Ipaddq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0543 */ { UD_Ipmullw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0544 */ { UD_Ipmullw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0545 */ { UD_Imovdq2q, O_P, O_U, O_NONE, P_aso|P_rexb },
-  /* 0546 */ { UD_Imovq2dq, O_V, O_N, O_NONE, P_aso|P_rexr },
-  /* 0547 */ { UD_Imovq, O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0548 */ { UD_Ipmovmskb, O_Gd, O_N, O_NONE, P_oso|P_rexr|P_rexb },
-  /* 0549 */ { UD_Ipmovmskb, O_Gd, O_U, O_NONE, P_rexr|P_rexb },
-  /* 0550 */ { UD_Ipsubusb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0551 */ { UD_Ipsubusb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0552 */ { UD_Ipsubusw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0553 */ { UD_Ipsubusw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0554 */ { UD_Ipminub, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0555 */ { UD_Ipminub, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0556 */ { UD_Ipand, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0557 */ { UD_Ipand, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0558 */ { UD_Ipaddusb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0559 */ { UD_Ipaddusb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0560 */ { UD_Ipaddusw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0561 */ { UD_Ipaddusw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0562 */ { UD_Ipmaxub, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0563 */ { UD_Ipmaxub, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0564 */ { UD_Ipandn, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0565 */ { UD_Ipandn, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0566 */ { UD_Ipavgb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0567 */ { UD_Ipavgb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0568 */ { UD_Ipsraw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0569 */ { UD_Ipsraw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0570 */ { UD_Ipsrad, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0571 */ { UD_Ipsrad, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0572 */ { UD_Ipavgw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0573 */ { UD_Ipavgw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0574 */ { UD_Ipmulhuw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0575 */ { UD_Ipmulhuw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0576 */ { UD_Ipmulhw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0577 */ { UD_Ipmulhw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0578 */ { UD_Icvtpd2dq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0579 */ { UD_Icvtdq2pd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0580 */ { UD_Icvttpd2dq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0581 */ { UD_Imovntq, O_M, O_P, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0582 */ { UD_Imovntdq, O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0583 */ { UD_Ipsubsb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0584 */ { UD_Ipsubsb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0585 */ { UD_Ipsubsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0586 */ { UD_Ipsubsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0587 */ { UD_Ipminsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0588 */ { UD_Ipminsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0589 */ { UD_Ipor, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0590 */ { UD_Ipor, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0591 */ { UD_Ipaddsb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0592 */ { UD_Ipaddsb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0593 */ { UD_Ipaddsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0594 */ { UD_Ipaddsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0595 */ { UD_Ipmaxsw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0596 */ { UD_Ipmaxsw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0597 */ { UD_Ipxor, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0598 */ { UD_Ipxor, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0599 */ { UD_Ilddqu, O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0600 */ { UD_Ipsllw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0601 */ { UD_Ipsllw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0602 */ { UD_Ipslld, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0603 */ { UD_Ipslld, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0604 */ { UD_Ipsllq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0605 */ { UD_Ipsllq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0606 */ { UD_Ipmuludq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0607 */ { UD_Ipmuludq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0608 */ { UD_Ipmaddwd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0609 */ { UD_Ipmaddwd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0610 */ { UD_Ipsadbw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0611 */ { UD_Ipsadbw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0612 */ { UD_Imaskmovq, O_P, O_N, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0613 */ { UD_Imaskmovdqu, O_V, O_U, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0614 */ { UD_Ipsubb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0615 */ { UD_Ipsubb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0616 */ { UD_Ipsubw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0617 */ { UD_Ipsubw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0618 */ { UD_Ipsubd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0619 */ { UD_Ipsubd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0620 */ { UD_Ipsubq, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0621 */ { UD_Ipsubq, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0622 */ { UD_Ipaddb, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0623 */ { UD_Ipaddb, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0624 */ { UD_Ipaddw, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0625 */ { UD_Ipaddw, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0626 */ { UD_Ipaddd, O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0627 */ { UD_Ipaddd, O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0628 */ { UD_Iadc, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0629 */ { UD_Iadc, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0630 */ { UD_Iadc, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0631 */ { UD_Iadc, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0632 */ { UD_Iadc, O_AL, O_Ib, O_NONE, P_none },
-  /* 0633 */ { UD_Iadc, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0634 */ { UD_Ipush, O_SS, O_NONE, O_NONE, P_inv64 },
-  /* 0635 */ { UD_Ipop, O_SS, O_NONE, O_NONE, P_inv64 },
-  /* 0636 */ { UD_Isbb, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0637 */ { UD_Isbb, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0638 */ { UD_Isbb, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0639 */ { UD_Isbb, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0640 */ { UD_Isbb, O_AL, O_Ib, O_NONE, P_none },
-  /* 0641 */ { UD_Isbb, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0642 */ { UD_Ipush, O_DS, O_NONE, O_NONE, P_inv64 },
-  /* 0643 */ { UD_Ipop, O_DS, O_NONE, O_NONE, P_inv64 },
-  /* 0644 */ { UD_Iand, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0645 */ { UD_Iand, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0646 */ { UD_Iand, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0647 */ { UD_Iand, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0648 */ { UD_Iand, O_AL, O_Ib, O_NONE, P_none },
-  /* 0649 */ { UD_Iand, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0650 */ { UD_Idaa, O_NONE, O_NONE, O_NONE, P_inv64 },
-  /* 0651 */ { UD_Isub, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0652 */ { UD_Isub, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0653 */ { UD_Isub, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0654 */ { UD_Isub, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0655 */ { UD_Isub, O_AL, O_Ib, O_NONE, P_none },
-  /* 0656 */ { UD_Isub, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0657 */ { UD_Idas, O_NONE, O_NONE, O_NONE, P_inv64 },
-  /* 0658 */ { UD_Ixor, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0659 */ { UD_Ixor, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0660 */ { UD_Ixor, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0661 */ { UD_Ixor, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0662 */ { UD_Ixor, O_AL, O_Ib, O_NONE, P_none },
-  /* 0663 */ { UD_Ixor, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0664 */ { UD_Iaaa, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0665 */ { UD_Icmp, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0666 */ { UD_Icmp, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0667 */ { UD_Icmp, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0668 */ { UD_Icmp, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0669 */ { UD_Icmp, O_AL, O_Ib, O_NONE, P_none },
-  /* 0670 */ { UD_Icmp, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0671 */ { UD_Iaas, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0672 */ { UD_Iinc, O_R0z, O_NONE, O_NONE, P_oso },
-  /* 0673 */ { UD_Iinc, O_R1z, O_NONE, O_NONE, P_oso },
-  /* 0674 */ { UD_Iinc, O_R2z, O_NONE, O_NONE, P_oso },
-  /* 0675 */ { UD_Iinc, O_R3z, O_NONE, O_NONE, P_oso },
-  /* 0676 */ { UD_Iinc, O_R4z, O_NONE, O_NONE, P_oso },
-  /* 0677 */ { UD_Iinc, O_R5z, O_NONE, O_NONE, P_oso },
-  /* 0678 */ { UD_Iinc, O_R6z, O_NONE, O_NONE, P_oso },
-  /* 0679 */ { UD_Iinc, O_R7z, O_NONE, O_NONE, P_oso },
-  /* 0680 */ { UD_Idec, O_R0z, O_NONE, O_NONE, P_oso },
-  /* 0681 */ { UD_Idec, O_R1z, O_NONE, O_NONE, P_oso },
-  /* 0682 */ { UD_Idec, O_R2z, O_NONE, O_NONE, P_oso },
-  /* 0683 */ { UD_Idec, O_R3z, O_NONE, O_NONE, P_oso },
-  /* 0684 */ { UD_Idec, O_R4z, O_NONE, O_NONE, P_oso },
-  /* 0685 */ { UD_Idec, O_R5z, O_NONE, O_NONE, P_oso },
-  /* 0686 */ { UD_Idec, O_R6z, O_NONE, O_NONE, P_oso },
-  /* 0687 */ { UD_Idec, O_R7z, O_NONE, O_NONE, P_oso },
-  /* 0688 */ { UD_Ipush, O_R0v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0689 */ { UD_Ipush, O_R1v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0690 */ { UD_Ipush, O_R2v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0691 */ { UD_Ipush, O_R3v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0692 */ { UD_Ipush, O_R4v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0693 */ { UD_Ipush, O_R5v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0694 */ { UD_Ipush, O_R6v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0695 */ { UD_Ipush, O_R7v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0696 */ { UD_Ipop, O_R0v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0697 */ { UD_Ipop, O_R1v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0698 */ { UD_Ipop, O_R2v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0699 */ { UD_Ipop, O_R3v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0700 */ { UD_Ipop, O_R4v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0701 */ { UD_Ipop, O_R5v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0702 */ { UD_Ipop, O_R6v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0703 */ { UD_Ipop, O_R7v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
-  /* 0704 */ { UD_Ipusha, O_NONE, O_NONE, O_NONE, P_oso|P_inv64 },
-  /* 0705 */ { UD_Ipushad, O_NONE, O_NONE, O_NONE, P_oso|P_inv64 },
-  /* 0706 */ { UD_Ipopa, O_NONE, O_NONE, O_NONE, P_oso|P_inv64 },
-  /* 0707 */ { UD_Ipopad, O_NONE, O_NONE, O_NONE, P_oso|P_inv64 },
-  /* 0708 */ { UD_Ibound, O_Gv, O_M, O_NONE, P_aso|P_oso },
-  /* 0709 */ { UD_Iarpl, O_Ew, O_Gw, O_NONE, P_aso },
-  /* 0710 */ { UD_Imovsxd, O_Gq, O_Ed, O_NONE, P_aso|P_oso|P_rexw|P_rexx|P_rexr|P_rexb },
-  /* 0711 */ { UD_Ipush, O_sIz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0712 */ { UD_Iimul, O_Gv, O_Ev, O_Iz, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0713 */ { UD_Ipush, O_sIb, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0714 */ { UD_Iimul, O_Gv, O_Ev, O_sIb, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0715 */ { UD_Iinsb, O_NONE, O_NONE, O_NONE, P_str|P_seg },
-  /* 0716 */ { UD_Iinsw, O_NONE, O_NONE, O_NONE, P_str|P_oso|P_seg },
-  /* 0717 */ { UD_Iinsd, O_NONE, O_NONE, O_NONE, P_str|P_oso|P_seg },
-  /* 0718 */ { UD_Ioutsb, O_NONE, O_NONE, O_NONE, P_str|P_seg },
-  /* 0719 */ { UD_Ioutsw, O_NONE, O_NONE, O_NONE, P_str|P_oso|P_seg },
-  /* 0720 */ { UD_Ioutsd, O_NONE, O_NONE, O_NONE, P_str|P_oso|P_seg },
-  /* 0721 */ { UD_Ijo, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0722 */ { UD_Ijno, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0723 */ { UD_Ijb, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0724 */ { UD_Ijae, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0725 */ { UD_Ijz, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0726 */ { UD_Ijnz, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0727 */ { UD_Ijbe, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0728 */ { UD_Ija, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0729 */ { UD_Ijs, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0730 */ { UD_Ijns, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0731 */ { UD_Ijp, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0732 */ { UD_Ijnp, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0733 */ { UD_Ijl, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0734 */ { UD_Ijge, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0735 */ { UD_Ijle, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0736 */ { UD_Ijg, O_Jb, O_NONE, O_NONE, P_none },
-  /* 0737 */ { UD_Iadd, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0738 */ { UD_Ior, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0739 */ { UD_Iadc, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0740 */ { UD_Isbb, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0741 */ { UD_Iand, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0742 */ { UD_Isub, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0743 */ { UD_Ixor, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0744 */ { UD_Icmp, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0745 */ { UD_Iadd, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0746 */ { UD_Ior, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0747 */ { UD_Iadc, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0748 */ { UD_Isbb, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0749 */ { UD_Iand, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0750 */ { UD_Isub, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0751 */ { UD_Ixor, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0752 */ { UD_Icmp, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0753 */ { UD_Iadd, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0754 */ { UD_Ior, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0755 */ { UD_Iadc, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0756 */ { UD_Isbb, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0757 */ { UD_Iand, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0758 */ { UD_Isub, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0759 */ { UD_Ixor, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0760 */ { UD_Icmp, O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
-  /* 0761 */ { UD_Iadd, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0762 */ { UD_Ior, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0763 */ { UD_Iadc, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0764 */ { UD_Isbb, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0765 */ { UD_Iand, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0766 */ { UD_Isub, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0767 */ { UD_Ixor, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0768 */ { UD_Icmp, O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0769 */ { UD_Itest, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0770 */ { UD_Itest, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0771 */ { UD_Ixchg, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0772 */ { UD_Ixchg, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0773 */ { UD_Imov, O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0774 */ { UD_Imov, O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0775 */ { UD_Imov, O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0776 */ { UD_Imov, O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0777 */ { UD_Imov, O_MwRv, O_S, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0778 */ { UD_Ilea, O_Gv, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0779 */ { UD_Imov, O_S, O_MwRv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0780 */ { UD_Ipop, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 0781 */ { UD_Ixchg, O_R0v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0782 */ { UD_Ixchg, O_R1v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0783 */ { UD_Ixchg, O_R2v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0784 */ { UD_Ixchg, O_R3v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0785 */ { UD_Ixchg, O_R4v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0786 */ { UD_Ixchg, O_R5v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0787 */ { UD_Ixchg, O_R6v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0788 */ { UD_Ixchg, O_R7v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0789 */ { UD_Icbw, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0790 */ { UD_Icwde, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0791 */ { UD_Icdqe, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0792 */ { UD_Icwd, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0793 */ { UD_Icdq, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0794 */ { UD_Icqo, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0795 */ { UD_Icall, O_Av, O_NONE, O_NONE, P_oso },
-  /* 0796 */ { UD_Iwait, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0797 */ { UD_Ipushfw, O_NONE, O_NONE, O_NONE, P_oso },
-  /* 0798 */ { UD_Ipushfw, O_NONE, O_NONE, O_NONE, P_oso|P_rexw|P_def64 },
-  /* 0799 */ { UD_Ipushfd, O_NONE, O_NONE, O_NONE, P_oso },
-  /* 0800 */ { UD_Ipushfq, O_NONE, O_NONE, O_NONE, P_oso|P_rexw|P_def64 },
-  /* 0801 */ { UD_Ipushfq, O_NONE, O_NONE, O_NONE, P_oso|P_rexw|P_def64 },
-  /* 0802 */ { UD_Ipopfw, O_NONE, O_NONE, O_NONE, P_oso },
-  /* 0803 */ { UD_Ipopfd, O_NONE, O_NONE, O_NONE, P_oso },
-  /* 0804 */ { UD_Ipopfq, O_NONE, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0805 */ { UD_Ipopfq, O_NONE, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 0806 */ { UD_Isahf, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0807 */ { UD_Ilahf, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0808 */ { UD_Imov, O_AL, O_Ob, O_NONE, P_none },
-  /* 0809 */ { UD_Imov, O_rAX, O_Ov, O_NONE, P_aso|P_oso|P_rexw },
-  /* 0810 */ { UD_Imov, O_Ob, O_AL, O_NONE, P_none },
-  /* 0811 */ { UD_Imov, O_Ov, O_rAX, O_NONE, P_aso|P_oso|P_rexw },
-  /* 0812 */ { UD_Imovsb, O_NONE, O_NONE, O_NONE, P_str|P_seg },
-  /* 0813 */ { UD_Imovsw, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0814 */ { UD_Imovsd, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0815 */ { UD_Imovsq, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0816 */ { UD_Icmpsb, O_NONE, O_NONE, O_NONE, P_strz|P_seg },
-  /* 0817 */ { UD_Icmpsw, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw|P_seg },
-  /* 0818 */ { UD_Icmpsd, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw|P_seg },
-  /* 0819 */ { UD_Icmpsq, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw|P_seg },
-  /* 0820 */ { UD_Itest, O_AL, O_Ib, O_NONE, P_none },
-  /* 0821 */ { UD_Itest, O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
-  /* 0822 */ { UD_Istosb, O_NONE, O_NONE, O_NONE, P_str|P_seg },
-  /* 0823 */ { UD_Istosw, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0824 */ { UD_Istosd, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0825 */ { UD_Istosq, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0826 */ { UD_Ilodsb, O_NONE, O_NONE, O_NONE, P_str|P_seg },
-  /* 0827 */ { UD_Ilodsw, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0828 */ { UD_Ilodsd, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0829 */ { UD_Ilodsq, O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
-  /* 0830 */ { UD_Iscasb, O_NONE, O_NONE, O_NONE, P_strz },
-  /* 0831 */ { UD_Iscasw, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw },
-  /* 0832 */ { UD_Iscasd, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw },
-  /* 0833 */ { UD_Iscasq, O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw },
-  /* 0834 */ { UD_Imov, O_R0b, O_Ib, O_NONE, P_rexb },
-  /* 0835 */ { UD_Imov, O_R1b, O_Ib, O_NONE, P_rexb },
-  /* 0836 */ { UD_Imov, O_R2b, O_Ib, O_NONE, P_rexb },
-  /* 0837 */ { UD_Imov, O_R3b, O_Ib, O_NONE, P_rexb },
-  /* 0838 */ { UD_Imov, O_R4b, O_Ib, O_NONE, P_rexb },
-  /* 0839 */ { UD_Imov, O_R5b, O_Ib, O_NONE, P_rexb },
-  /* 0840 */ { UD_Imov, O_R6b, O_Ib, O_NONE, P_rexb },
-  /* 0841 */ { UD_Imov, O_R7b, O_Ib, O_NONE, P_rexb },
-  /* 0842 */ { UD_Imov, O_R0v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0843 */ { UD_Imov, O_R1v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0844 */ { UD_Imov, O_R2v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0845 */ { UD_Imov, O_R3v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0846 */ { UD_Imov, O_R4v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0847 */ { UD_Imov, O_R5v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0848 */ { UD_Imov, O_R6v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0849 */ { UD_Imov, O_R7v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
-  /* 0850 */ { UD_Irol, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0851 */ { UD_Iror, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0852 */ { UD_Ircl, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0853 */ { UD_Ircr, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0854 */ { UD_Ishl, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0855 */ { UD_Ishr, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0856 */ { UD_Ishl, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0857 */ { UD_Isar, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0858 */ { UD_Irol, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0859 */ { UD_Iror, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0860 */ { UD_Ircl, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0861 */ { UD_Ircr, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0862 */ { UD_Ishl, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0863 */ { UD_Ishr, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0864 */ { UD_Ishl, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0865 */ { UD_Isar, O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0866 */ { UD_Iret, O_Iw, O_NONE, O_NONE, P_none },
-  /* 0867 */ { UD_Iret, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0868 */ { UD_Iles, O_Gv, O_M, O_NONE, P_aso|P_oso },
-  /* 0869 */ { UD_Ilds, O_Gv, O_M, O_NONE, P_aso|P_oso },
-  /* 0870 */ { UD_Imov, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0871 */ { UD_Imov, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0872 */ { UD_Ienter, O_Iw, O_Ib, O_NONE, P_def64 },
-  /* 0873 */ { UD_Ileave, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0874 */ { UD_Iretf, O_Iw, O_NONE, O_NONE, P_none },
-  /* 0875 */ { UD_Iretf, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0876 */ { UD_Iint3, O_NONE, O_NONE, O_NONE, P_none },
-  /* 0877 */ { UD_Iint, O_Ib, O_NONE, O_NONE, P_none },
-  /* 0878 */ { UD_Iinto, O_NONE, O_NONE, O_NONE, P_inv64 },
-  /* 0879 */ { UD_Iiretw, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0880 */ { UD_Iiretd, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0881 */ { UD_Iiretq, O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
-  /* 0882 */ { UD_Irol, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0883 */ { UD_Iror, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0884 */ { UD_Ircl, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0885 */ { UD_Ircr, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0886 */ { UD_Ishl, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0887 */ { UD_Ishr, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0888 */ { UD_Ishl, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0889 */ { UD_Isar, O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0890 */ { UD_Irol, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0891 */ { UD_Iror, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0892 */ { UD_Ircl, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0893 */ { UD_Ircr, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0894 */ { UD_Ishl, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0895 */ { UD_Ishr, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0896 */ { UD_Ishl, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0897 */ { UD_Isar, O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0898 */ { UD_Irol, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0899 */ { UD_Iror, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0900 */ { UD_Ircl, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0901 */ { UD_Ircr, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0902 */ { UD_Ishl, O_Eb, O_CL, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0903 */ { UD_Ishr, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0904 */ { UD_Ishl, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0905 */ { UD_Isar, O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0906 */ { UD_Irol, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0907 */ { UD_Iror, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0908 */ { UD_Ircl, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0909 */ { UD_Ircr, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0910 */ { UD_Ishl, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0911 */ { UD_Ishr, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0912 */ { UD_Ishl, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0913 */ { UD_Isar, O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 0914 */ { UD_Iaam, O_Ib, O_NONE, O_NONE, P_none },
-  /* 0915 */ { UD_Iaad, O_Ib, O_NONE, O_NONE, P_none },
-  /* 0916 */ { UD_Isalc, O_NONE, O_NONE, O_NONE, P_inv64 },
-  /* 0917 */ { UD_Ixlatb, O_NONE, O_NONE, O_NONE, P_rexw|P_seg },
-  /* 0918 */ { UD_Ifadd, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0919 */ { UD_Ifmul, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0920 */ { UD_Ifcom, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0921 */ { UD_Ifcomp, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0922 */ { UD_Ifsub, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0923 */ { UD_Ifsubr, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0924 */ { UD_Ifdiv, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0925 */ { UD_Ifdivr, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0926 */ { UD_Ifadd, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0927 */ { UD_Ifadd, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0928 */ { UD_Ifadd, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0929 */ { UD_Ifadd, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0930 */ { UD_Ifadd, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0931 */ { UD_Ifadd, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0932 */ { UD_Ifadd, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0933 */ { UD_Ifadd, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0934 */ { UD_Ifmul, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0935 */ { UD_Ifmul, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0936 */ { UD_Ifmul, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0937 */ { UD_Ifmul, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0938 */ { UD_Ifmul, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0939 */ { UD_Ifmul, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0940 */ { UD_Ifmul, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0941 */ { UD_Ifmul, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0942 */ { UD_Ifcom, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0943 */ { UD_Ifcom, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0944 */ { UD_Ifcom, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0945 */ { UD_Ifcom, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0946 */ { UD_Ifcom, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0947 */ { UD_Ifcom, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0948 */ { UD_Ifcom, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0949 */ { UD_Ifcom, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0950 */ { UD_Ifcomp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0951 */ { UD_Ifcomp, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0952 */ { UD_Ifcomp, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0953 */ { UD_Ifcomp, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0954 */ { UD_Ifcomp, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0955 */ { UD_Ifcomp, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0956 */ { UD_Ifcomp, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0957 */ { UD_Ifcomp, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0958 */ { UD_Ifsub, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0959 */ { UD_Ifsub, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0960 */ { UD_Ifsub, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0961 */ { UD_Ifsub, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0962 */ { UD_Ifsub, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0963 */ { UD_Ifsub, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0964 */ { UD_Ifsub, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0965 */ { UD_Ifsub, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0966 */ { UD_Ifsubr, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0967 */ { UD_Ifsubr, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0968 */ { UD_Ifsubr, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0969 */ { UD_Ifsubr, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0970 */ { UD_Ifsubr, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0971 */ { UD_Ifsubr, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0972 */ { UD_Ifsubr, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0973 */ { UD_Ifsubr, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0974 */ { UD_Ifdiv, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0975 */ { UD_Ifdiv, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0976 */ { UD_Ifdiv, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0977 */ { UD_Ifdiv, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0978 */ { UD_Ifdiv, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0979 */ { UD_Ifdiv, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0980 */ { UD_Ifdiv, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0981 */ { UD_Ifdiv, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0982 */ { UD_Ifdivr, O_ST0, O_ST0, O_NONE, P_none },
-  /* 0983 */ { UD_Ifdivr, O_ST0, O_ST1, O_NONE, P_none },
-  /* 0984 */ { UD_Ifdivr, O_ST0, O_ST2, O_NONE, P_none },
-  /* 0985 */ { UD_Ifdivr, O_ST0, O_ST3, O_NONE, P_none },
-  /* 0986 */ { UD_Ifdivr, O_ST0, O_ST4, O_NONE, P_none },
-  /* 0987 */ { UD_Ifdivr, O_ST0, O_ST5, O_NONE, P_none },
-  /* 0988 */ { UD_Ifdivr, O_ST0, O_ST6, O_NONE, P_none },
-  /* 0989 */ { UD_Ifdivr, O_ST0, O_ST7, O_NONE, P_none },
-  /* 0990 */ { UD_Ifld, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0991 */ { UD_Ifst, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0992 */ { UD_Ifstp, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0993 */ { UD_Ifldenv, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0994 */ { UD_Ifldcw, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0995 */ { UD_Ifnstenv, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0996 */ { UD_Ifnstcw, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 0997 */ { UD_Ifld, O_ST0, O_NONE, O_NONE, P_none },
-  /* 0998 */ { UD_Ifld, O_ST1, O_NONE, O_NONE, P_none },
-  /* 0999 */ { UD_Ifld, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1000 */ { UD_Ifld, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1001 */ { UD_Ifld, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1002 */ { UD_Ifld, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1003 */ { UD_Ifld, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1004 */ { UD_Ifld, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1005 */ { UD_Ifxch, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1006 */ { UD_Ifxch, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1007 */ { UD_Ifxch, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1008 */ { UD_Ifxch, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1009 */ { UD_Ifxch, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1010 */ { UD_Ifxch, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1011 */ { UD_Ifxch, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1012 */ { UD_Ifxch, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1013 */ { UD_Ifnop, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1014 */ { UD_Ifstp1, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1015 */ { UD_Ifstp1, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1016 */ { UD_Ifstp1, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1017 */ { UD_Ifstp1, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1018 */ { UD_Ifstp1, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1019 */ { UD_Ifstp1, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1020 */ { UD_Ifstp1, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1021 */ { UD_Ifstp1, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1022 */ { UD_Ifchs, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1023 */ { UD_Ifabs, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1024 */ { UD_Iftst, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1025 */ { UD_Ifxam, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1026 */ { UD_Ifld1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1027 */ { UD_Ifldl2t, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1028 */ { UD_Ifldl2e, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1029 */ { UD_Ifldpi, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1030 */ { UD_Ifldlg2, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1031 */ { UD_Ifldln2, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1032 */ { UD_Ifldz, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1033 */ { UD_If2xm1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1034 */ { UD_Ifyl2x, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1035 */ { UD_Ifptan, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1036 */ { UD_Ifpatan, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1037 */ { UD_Ifxtract, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1038 */ { UD_Ifprem1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1039 */ { UD_Ifdecstp, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1040 */ { UD_Ifincstp, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1041 */ { UD_Ifprem, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1042 */ { UD_Ifyl2xp1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1043 */ { UD_Ifsqrt, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1044 */ { UD_Ifsincos, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1045 */ { UD_Ifrndint, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1046 */ { UD_Ifscale, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1047 */ { UD_Ifsin, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1048 */ { UD_Ifcos, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1049 */ { UD_Ifiadd, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1050 */ { UD_Ifimul, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1051 */ { UD_Ificom, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1052 */ { UD_Ificomp, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1053 */ { UD_Ifisub, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1054 */ { UD_Ifisubr, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1055 */ { UD_Ifidiv, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1056 */ { UD_Ifidivr, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1057 */ { UD_Ifcmovb, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1058 */ { UD_Ifcmovb, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1059 */ { UD_Ifcmovb, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1060 */ { UD_Ifcmovb, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1061 */ { UD_Ifcmovb, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1062 */ { UD_Ifcmovb, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1063 */ { UD_Ifcmovb, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1064 */ { UD_Ifcmovb, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1065 */ { UD_Ifcmove, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1066 */ { UD_Ifcmove, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1067 */ { UD_Ifcmove, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1068 */ { UD_Ifcmove, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1069 */ { UD_Ifcmove, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1070 */ { UD_Ifcmove, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1071 */ { UD_Ifcmove, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1072 */ { UD_Ifcmove, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1073 */ { UD_Ifcmovbe, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1074 */ { UD_Ifcmovbe, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1075 */ { UD_Ifcmovbe, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1076 */ { UD_Ifcmovbe, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1077 */ { UD_Ifcmovbe, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1078 */ { UD_Ifcmovbe, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1079 */ { UD_Ifcmovbe, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1080 */ { UD_Ifcmovbe, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1081 */ { UD_Ifcmovu, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1082 */ { UD_Ifcmovu, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1083 */ { UD_Ifcmovu, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1084 */ { UD_Ifcmovu, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1085 */ { UD_Ifcmovu, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1086 */ { UD_Ifcmovu, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1087 */ { UD_Ifcmovu, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1088 */ { UD_Ifcmovu, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1089 */ { UD_Ifucompp, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1090 */ { UD_Ifild, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1091 */ { UD_Ifisttp, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1092 */ { UD_Ifist, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1093 */ { UD_Ifistp, O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1094 */ { UD_Ifld, O_Mt, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1095 */ { UD_Ifstp, O_Mt, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1096 */ { UD_Ifcmovnb, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1097 */ { UD_Ifcmovnb, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1098 */ { UD_Ifcmovnb, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1099 */ { UD_Ifcmovnb, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1100 */ { UD_Ifcmovnb, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1101 */ { UD_Ifcmovnb, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1102 */ { UD_Ifcmovnb, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1103 */ { UD_Ifcmovnb, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1104 */ { UD_Ifcmovne, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1105 */ { UD_Ifcmovne, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1106 */ { UD_Ifcmovne, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1107 */ { UD_Ifcmovne, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1108 */ { UD_Ifcmovne, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1109 */ { UD_Ifcmovne, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1110 */ { UD_Ifcmovne, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1111 */ { UD_Ifcmovne, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1112 */ { UD_Ifcmovnbe, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1113 */ { UD_Ifcmovnbe, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1114 */ { UD_Ifcmovnbe, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1115 */ { UD_Ifcmovnbe, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1116 */ { UD_Ifcmovnbe, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1117 */ { UD_Ifcmovnbe, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1118 */ { UD_Ifcmovnbe, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1119 */ { UD_Ifcmovnbe, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1120 */ { UD_Ifcmovnu, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1121 */ { UD_Ifcmovnu, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1122 */ { UD_Ifcmovnu, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1123 */ { UD_Ifcmovnu, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1124 */ { UD_Ifcmovnu, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1125 */ { UD_Ifcmovnu, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1126 */ { UD_Ifcmovnu, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1127 */ { UD_Ifcmovnu, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1128 */ { UD_Ifclex, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1129 */ { UD_Ifninit, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1130 */ { UD_Ifucomi, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1131 */ { UD_Ifucomi, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1132 */ { UD_Ifucomi, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1133 */ { UD_Ifucomi, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1134 */ { UD_Ifucomi, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1135 */ { UD_Ifucomi, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1136 */ { UD_Ifucomi, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1137 */ { UD_Ifucomi, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1138 */ { UD_Ifcomi, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1139 */ { UD_Ifcomi, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1140 */ { UD_Ifcomi, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1141 */ { UD_Ifcomi, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1142 */ { UD_Ifcomi, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1143 */ { UD_Ifcomi, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1144 */ { UD_Ifcomi, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1145 */ { UD_Ifcomi, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1146 */ { UD_Ifadd, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1147 */ { UD_Ifmul, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1148 */ { UD_Ifcom, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1149 */ { UD_Ifcomp, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1150 */ { UD_Ifsub, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1151 */ { UD_Ifsubr, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1152 */ { UD_Ifdiv, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1153 */ { UD_Ifdivr, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1154 */ { UD_Ifadd, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1155 */ { UD_Ifadd, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1156 */ { UD_Ifadd, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1157 */ { UD_Ifadd, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1158 */ { UD_Ifadd, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1159 */ { UD_Ifadd, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1160 */ { UD_Ifadd, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1161 */ { UD_Ifadd, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1162 */ { UD_Ifmul, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1163 */ { UD_Ifmul, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1164 */ { UD_Ifmul, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1165 */ { UD_Ifmul, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1166 */ { UD_Ifmul, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1167 */ { UD_Ifmul, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1168 */ { UD_Ifmul, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1169 */ { UD_Ifmul, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1170 */ { UD_Ifcom2, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1171 */ { UD_Ifcom2, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1172 */ { UD_Ifcom2, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1173 */ { UD_Ifcom2, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1174 */ { UD_Ifcom2, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1175 */ { UD_Ifcom2, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1176 */ { UD_Ifcom2, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1177 */ { UD_Ifcom2, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1178 */ { UD_Ifcomp3, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1179 */ { UD_Ifcomp3, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1180 */ { UD_Ifcomp3, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1181 */ { UD_Ifcomp3, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1182 */ { UD_Ifcomp3, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1183 */ { UD_Ifcomp3, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1184 */ { UD_Ifcomp3, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1185 */ { UD_Ifcomp3, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1186 */ { UD_Ifsubr, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1187 */ { UD_Ifsubr, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1188 */ { UD_Ifsubr, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1189 */ { UD_Ifsubr, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1190 */ { UD_Ifsubr, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1191 */ { UD_Ifsubr, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1192 */ { UD_Ifsubr, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1193 */ { UD_Ifsubr, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1194 */ { UD_Ifsub, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1195 */ { UD_Ifsub, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1196 */ { UD_Ifsub, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1197 */ { UD_Ifsub, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1198 */ { UD_Ifsub, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1199 */ { UD_Ifsub, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1200 */ { UD_Ifsub, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1201 */ { UD_Ifsub, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1202 */ { UD_Ifdivr, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1203 */ { UD_Ifdivr, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1204 */ { UD_Ifdivr, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1205 */ { UD_Ifdivr, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1206 */ { UD_Ifdivr, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1207 */ { UD_Ifdivr, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1208 */ { UD_Ifdivr, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1209 */ { UD_Ifdivr, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1210 */ { UD_Ifdiv, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1211 */ { UD_Ifdiv, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1212 */ { UD_Ifdiv, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1213 */ { UD_Ifdiv, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1214 */ { UD_Ifdiv, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1215 */ { UD_Ifdiv, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1216 */ { UD_Ifdiv, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1217 */ { UD_Ifdiv, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1218 */ { UD_Ifld, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1219 */ { UD_Ifisttp, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1220 */ { UD_Ifst, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1221 */ { UD_Ifstp, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1222 */ { UD_Ifrstor, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1223 */ { UD_Ifnsave, O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1224 */ { UD_Ifnstsw, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1225 */ { UD_Iffree, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1226 */ { UD_Iffree, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1227 */ { UD_Iffree, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1228 */ { UD_Iffree, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1229 */ { UD_Iffree, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1230 */ { UD_Iffree, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1231 */ { UD_Iffree, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1232 */ { UD_Iffree, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1233 */ { UD_Ifxch4, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1234 */ { UD_Ifxch4, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1235 */ { UD_Ifxch4, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1236 */ { UD_Ifxch4, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1237 */ { UD_Ifxch4, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1238 */ { UD_Ifxch4, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1239 */ { UD_Ifxch4, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1240 */ { UD_Ifxch4, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1241 */ { UD_Ifst, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1242 */ { UD_Ifst, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1243 */ { UD_Ifst, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1244 */ { UD_Ifst, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1245 */ { UD_Ifst, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1246 */ { UD_Ifst, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1247 */ { UD_Ifst, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1248 */ { UD_Ifst, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1249 */ { UD_Ifstp, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1250 */ { UD_Ifstp, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1251 */ { UD_Ifstp, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1252 */ { UD_Ifstp, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1253 */ { UD_Ifstp, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1254 */ { UD_Ifstp, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1255 */ { UD_Ifstp, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1256 */ { UD_Ifstp, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1257 */ { UD_Ifucom, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1258 */ { UD_Ifucom, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1259 */ { UD_Ifucom, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1260 */ { UD_Ifucom, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1261 */ { UD_Ifucom, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1262 */ { UD_Ifucom, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1263 */ { UD_Ifucom, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1264 */ { UD_Ifucom, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1265 */ { UD_Ifucomp, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1266 */ { UD_Ifucomp, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1267 */ { UD_Ifucomp, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1268 */ { UD_Ifucomp, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1269 */ { UD_Ifucomp, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1270 */ { UD_Ifucomp, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1271 */ { UD_Ifucomp, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1272 */ { UD_Ifucomp, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1273 */ { UD_Ifiadd, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1274 */ { UD_Ifimul, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1275 */ { UD_Ificom, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1276 */ { UD_Ificomp, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1277 */ { UD_Ifisub, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1278 */ { UD_Ifisubr, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1279 */ { UD_Ifidiv, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1280 */ { UD_Ifidivr, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1281 */ { UD_Ifaddp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1282 */ { UD_Ifaddp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1283 */ { UD_Ifaddp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1284 */ { UD_Ifaddp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1285 */ { UD_Ifaddp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1286 */ { UD_Ifaddp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1287 */ { UD_Ifaddp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1288 */ { UD_Ifaddp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1289 */ { UD_Ifmulp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1290 */ { UD_Ifmulp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1291 */ { UD_Ifmulp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1292 */ { UD_Ifmulp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1293 */ { UD_Ifmulp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1294 */ { UD_Ifmulp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1295 */ { UD_Ifmulp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1296 */ { UD_Ifmulp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1297 */ { UD_Ifcomp5, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1298 */ { UD_Ifcomp5, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1299 */ { UD_Ifcomp5, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1300 */ { UD_Ifcomp5, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1301 */ { UD_Ifcomp5, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1302 */ { UD_Ifcomp5, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1303 */ { UD_Ifcomp5, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1304 */ { UD_Ifcomp5, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1305 */ { UD_Ifcompp, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1306 */ { UD_Ifsubrp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1307 */ { UD_Ifsubrp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1308 */ { UD_Ifsubrp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1309 */ { UD_Ifsubrp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1310 */ { UD_Ifsubrp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1311 */ { UD_Ifsubrp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1312 */ { UD_Ifsubrp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1313 */ { UD_Ifsubrp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1314 */ { UD_Ifsubp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1315 */ { UD_Ifsubp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1316 */ { UD_Ifsubp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1317 */ { UD_Ifsubp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1318 */ { UD_Ifsubp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1319 */ { UD_Ifsubp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1320 */ { UD_Ifsubp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1321 */ { UD_Ifsubp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1322 */ { UD_Ifdivrp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1323 */ { UD_Ifdivrp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1324 */ { UD_Ifdivrp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1325 */ { UD_Ifdivrp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1326 */ { UD_Ifdivrp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1327 */ { UD_Ifdivrp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1328 */ { UD_Ifdivrp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1329 */ { UD_Ifdivrp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1330 */ { UD_Ifdivp, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1331 */ { UD_Ifdivp, O_ST1, O_ST0, O_NONE, P_none },
-  /* 1332 */ { UD_Ifdivp, O_ST2, O_ST0, O_NONE, P_none },
-  /* 1333 */ { UD_Ifdivp, O_ST3, O_ST0, O_NONE, P_none },
-  /* 1334 */ { UD_Ifdivp, O_ST4, O_ST0, O_NONE, P_none },
-  /* 1335 */ { UD_Ifdivp, O_ST5, O_ST0, O_NONE, P_none },
-  /* 1336 */ { UD_Ifdivp, O_ST6, O_ST0, O_NONE, P_none },
-  /* 1337 */ { UD_Ifdivp, O_ST7, O_ST0, O_NONE, P_none },
-  /* 1338 */ { UD_Ifild, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1339 */ { UD_Ifisttp, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1340 */ { UD_Ifist, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1341 */ { UD_Ifistp, O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1342 */ { UD_Ifbld, O_Mt, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1343 */ { UD_Ifild, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1344 */ { UD_Ifbstp, O_Mt, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1345 */ { UD_Ifistp, O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
-  /* 1346 */ { UD_Iffreep, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1347 */ { UD_Iffreep, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1348 */ { UD_Iffreep, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1349 */ { UD_Iffreep, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1350 */ { UD_Iffreep, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1351 */ { UD_Iffreep, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1352 */ { UD_Iffreep, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1353 */ { UD_Iffreep, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1354 */ { UD_Ifxch7, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1355 */ { UD_Ifxch7, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1356 */ { UD_Ifxch7, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1357 */ { UD_Ifxch7, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1358 */ { UD_Ifxch7, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1359 */ { UD_Ifxch7, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1360 */ { UD_Ifxch7, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1361 */ { UD_Ifxch7, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1362 */ { UD_Ifstp8, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1363 */ { UD_Ifstp8, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1364 */ { UD_Ifstp8, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1365 */ { UD_Ifstp8, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1366 */ { UD_Ifstp8, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1367 */ { UD_Ifstp8, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1368 */ { UD_Ifstp8, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1369 */ { UD_Ifstp8, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1370 */ { UD_Ifstp9, O_ST0, O_NONE, O_NONE, P_none },
-  /* 1371 */ { UD_Ifstp9, O_ST1, O_NONE, O_NONE, P_none },
-  /* 1372 */ { UD_Ifstp9, O_ST2, O_NONE, O_NONE, P_none },
-  /* 1373 */ { UD_Ifstp9, O_ST3, O_NONE, O_NONE, P_none },
-  /* 1374 */ { UD_Ifstp9, O_ST4, O_NONE, O_NONE, P_none },
-  /* 1375 */ { UD_Ifstp9, O_ST5, O_NONE, O_NONE, P_none },
-  /* 1376 */ { UD_Ifstp9, O_ST6, O_NONE, O_NONE, P_none },
-  /* 1377 */ { UD_Ifstp9, O_ST7, O_NONE, O_NONE, P_none },
-  /* 1378 */ { UD_Ifnstsw, O_AX, O_NONE, O_NONE, P_none },
-  /* 1379 */ { UD_Ifucomip, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1380 */ { UD_Ifucomip, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1381 */ { UD_Ifucomip, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1382 */ { UD_Ifucomip, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1383 */ { UD_Ifucomip, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1384 */ { UD_Ifucomip, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1385 */ { UD_Ifucomip, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1386 */ { UD_Ifucomip, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1387 */ { UD_Ifcomip, O_ST0, O_ST0, O_NONE, P_none },
-  /* 1388 */ { UD_Ifcomip, O_ST0, O_ST1, O_NONE, P_none },
-  /* 1389 */ { UD_Ifcomip, O_ST0, O_ST2, O_NONE, P_none },
-  /* 1390 */ { UD_Ifcomip, O_ST0, O_ST3, O_NONE, P_none },
-  /* 1391 */ { UD_Ifcomip, O_ST0, O_ST4, O_NONE, P_none },
-  /* 1392 */ { UD_Ifcomip, O_ST0, O_ST5, O_NONE, P_none },
-  /* 1393 */ { UD_Ifcomip, O_ST0, O_ST6, O_NONE, P_none },
-  /* 1394 */ { UD_Ifcomip, O_ST0, O_ST7, O_NONE, P_none },
-  /* 1395 */ { UD_Iloopne, O_Jb, O_NONE, O_NONE, P_none },
-  /* 1396 */ { UD_Iloope, O_Jb, O_NONE, O_NONE, P_none },
-  /* 1397 */ { UD_Iloop, O_Jb, O_NONE, O_NONE, P_none },
-  /* 1398 */ { UD_Ijcxz, O_Jb, O_NONE, O_NONE, P_aso },
-  /* 1399 */ { UD_Ijecxz, O_Jb, O_NONE, O_NONE, P_aso },
-  /* 1400 */ { UD_Ijrcxz, O_Jb, O_NONE, O_NONE, P_aso },
-  /* 1401 */ { UD_Iin, O_AL, O_Ib, O_NONE, P_none },
-  /* 1402 */ { UD_Iin, O_eAX, O_Ib, O_NONE, P_oso },
-  /* 1403 */ { UD_Iout, O_Ib, O_AL, O_NONE, P_none },
-  /* 1404 */ { UD_Iout, O_Ib, O_eAX, O_NONE, P_oso },
-  /* 1405 */ { UD_Icall, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 1406 */ { UD_Ijmp, O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
-  /* 1407 */ { UD_Ijmp, O_Av, O_NONE, O_NONE, P_oso },
-  /* 1408 */ { UD_Ijmp, O_Jb, O_NONE, O_NONE, P_def64 },
-  /* 1409 */ { UD_Iin, O_AL, O_DX, O_NONE, P_none },
-  /* 1410 */ { UD_Iin, O_eAX, O_DX, O_NONE, P_oso },
-  /* 1411 */ { UD_Iout, O_DX, O_AL, O_NONE, P_none },
-  /* 1412 */ { UD_Iout, O_DX, O_eAX, O_NONE, P_oso },
-  /* 1413 */ { UD_Ilock, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1414 */ { UD_Iint1, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1415 */ { UD_Irepne, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1416 */ { UD_Irep, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1417 */ { UD_Ihlt, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1418 */ { UD_Icmc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1419 */ { UD_Itest, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1420 */ { UD_Itest, O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1421 */ { UD_Inot, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1422 */ { UD_Ineg, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1423 */ { UD_Imul, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1424 */ { UD_Iimul, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1425 */ { UD_Idiv, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1426 */ { UD_Iidiv, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1427 */ { UD_Itest, O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1428 */ { UD_Itest, O_Ev, O_Iz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1429 */ { UD_Inot, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1430 */ { UD_Ineg, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1431 */ { UD_Imul, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1432 */ { UD_Iimul, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1433 */ { UD_Idiv, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1434 */ { UD_Iidiv, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1435 */ { UD_Iclc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1436 */ { UD_Istc, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1437 */ { UD_Icli, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1438 */ { UD_Isti, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1439 */ { UD_Icld, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1440 */ { UD_Istd, O_NONE, O_NONE, O_NONE, P_none },
-  /* 1441 */ { UD_Iinc, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1442 */ { UD_Idec, O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1443 */ { UD_Iinc, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1444 */ { UD_Idec, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1445 */ { UD_Icall, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1446 */ { UD_Icall, O_Eq, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 1447 */ { UD_Icall, O_Fv, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1448 */ { UD_Ijmp, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
-  /* 1449 */ { UD_Ijmp, O_Fv, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
-  /* 1450 */ { UD_Ipush, O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
+/* operand and prefix forms, shared between itab entries */
+const struct ud_itab_form ud_itab_form[] = {
+  /* 000 */ { O_NONE, O_NONE, O_NONE, P_none },
+  /* 001 */ { O_Eb, O_Gb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 002 */ { O_Ev, O_Gv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 003 */ { O_Gb, O_Eb, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 004 */ { O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 005 */ { O_AL, O_Ib, O_NONE, P_none },
+  /* 006 */ { O_rAX, O_sIz, O_NONE, P_oso|P_rexw },
+  /* 007 */ { O_ES, O_NONE, O_NONE, P_inv64 },
+  /* 008 */ { O_CS, O_NONE, O_NONE, P_inv64 },
+  /* 009 */ { O_MwRv, O_NONE, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 010 */ { O_Ew, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 011 */ { O_M, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 012 */ { O_Gv, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 013 */ { O_M, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 014 */ { O_P, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 015 */ { O_V, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 016 */ { O_V, O_W, O_NONE, P_str|P_aso|P_rexr|P_rexx|P_rexb },
+  /* 017 */ { O_W, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 018 */ { O_W, O_V, O_NONE, P_str|P_aso|P_rexr|P_rexx|P_rexb },
+  /* 019 */ { O_V, O_M, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 020 */ { O_V, O_U, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 021 */ { O_M, O_V, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 022 */ { O_R, O_C, O_NONE, P_rexr|P_rexw|P_rexb },
+  /* 023 */ { O_R, O_D, O_NONE, P_rexr|P_rexw|P_rexb },
+  /* 024 */ { O_C, O_R, O_NONE, P_rexr|P_rexw|P_rexb },
+  /* 025 */ { O_D, O_R, O_NONE, P_rexr|P_rexw|P_rexb },
+  /* 026 */ { O_V, O_Q, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 027 */ { O_V, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 028 */ { O_P, O_W, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 029 */ { O_Gy, O_W, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 030 */ { O_V, O_W, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 031 */ { O_V, O_MqU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 032 */ { O_V, O_MdU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 033 */ { O_V, O_MwU, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 034 */ { O_V, O_Mo, O_NONE, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 035 */ { O_Gq, O_Mo, O_NONE, P_none },
+  /* 036 */ { O_Gv, O_Mv, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 037 */ { O_Gy, O_Eb, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 038 */ { O_Mv, O_Gv, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 039 */ { O_Gy, O_Ev, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 040 */ { O_V, O_W, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 041 */ { O_P, O_Q, O_Ib, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 042 */ { O_MbRv, O_V, O_Ib, P_aso|P_rexx|P_rexr|P_rexb|P_def64 },
+  /* 043 */ { O_MwRd, O_V, O_Ib, P_aso|P_rexx|P_rexr|P_rexb },
+  /* 044 */ { O_Ed, O_V, O_Ib, P_aso|P_rexr|P_rexx|P_rexw|P_rexb },
+  /* 045 */ { O_Eq, O_V, O_Ib, P_aso|P_rexr|P_rexw|P_rexb|P_def64 },
+  /* 046 */ { O_MdRy, O_V, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 047 */ { O_V, O_MbRd, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 048 */ { O_V, O_Md, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 049 */ { O_V, O_Ed, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 050 */ { O_V, O_Eq, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 051 */ { O_V, O_W, O_Ib, P_aso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 052 */ { O_Gd, O_U, O_NONE, P_oso|P_rexr|P_rexb },
+  /* 053 */ { O_P, O_Ey, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 054 */ { O_N, O_Ib, O_NONE, P_none },
+  /* 055 */ { O_U, O_Ib, O_NONE, P_rexb },
+  /* 056 */ { O_Ey, O_Gy, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 057 */ { O_Gy, O_Ey, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 058 */ { O_Ey, O_P, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 059 */ { O_Ey, O_V, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 060 */ { O_Q, O_P, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 061 */ { O_Jz, O_NONE, O_NONE, P_oso|P_def64 },
+  /* 062 */ { O_Eb, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 063 */ { O_FS, O_NONE, O_NONE, P_none },
+  /* 064 */ { O_Ev, O_Gv, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 065 */ { O_Ev, O_Gv, O_CL, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 066 */ { O_GS, O_NONE, O_NONE, P_none },
+  /* 067 */ { O_Md, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 068 */ { O_Gv, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 069 */ { O_Gz, O_M, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 070 */ { O_Gv, O_Eb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 071 */ { O_Gy, O_Ew, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 072 */ { O_Gv, O_Ev, O_NONE, P_aso|P_oso|P_rexr|P_rexw|P_rexx|P_rexb },
+  /* 073 */ { O_Ev, O_Ib, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 074 */ { O_Eb, O_Gb, O_NONE, P_aso|P_oso|P_rexr|P_rexx|P_rexb },
+  /* 075 */ { O_M, O_Gy, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 076 */ { O_P, O_MwRy, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 077 */ { O_V, O_MwRy, O_Ib, P_aso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 078 */ { O_Gd, O_N, O_Ib, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 079 */ { O_Gd, O_U, O_Ib, P_aso|P_rexr|P_rexb },
+  /* 080 */ { O_Mq, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 081 */ { O_R0y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 082 */ { O_R1y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 083 */ { O_R2y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 084 */ { O_R3y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 085 */ { O_R4y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 086 */ { O_R5y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 087 */ { O_R6y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 088 */ { O_R7y, O_NONE, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 089 */ { O_P, O_U, O_NONE, P_aso|P_rexb },
+  /* 090 */ { O_V, O_N, O_NONE, P_aso|P_rexr },
+  /* 091 */ { O_Gd, O_N, O_NONE, P_oso|P_rexr|P_rexb },
+  /* 092 */ { O_Gd, O_U, O_NONE, P_rexr|P_rexb },
+  /* 093 */ { O_M, O_P, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 094 */ { O_P, O_N, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 095 */ { O_SS, O_NONE, O_NONE, P_inv64 },
+  /* 096 */ { O_DS, O_NONE, O_NONE, P_inv64 },
+  /* 097 */ { O_NONE, O_NONE, O_NONE, P_inv64 },
+  /* 098 */ { O_R0z, O_NONE, O_NONE, P_oso },
+  /* 099 */ { O_R1z, O_NONE, O_NONE, P_oso },
+  /* 100 */ { O_R2z, O_NONE, O_NONE, P_oso },
+  /* 101 */ { O_R3z, O_NONE, O_NONE, P_oso },
+  /* 102 */ { O_R4z, O_NONE, O_NONE, P_oso },
+  /* 103 */ { O_R5z, O_NONE, O_NONE, P_oso },
+  /* 104 */ { O_R6z, O_NONE, O_NONE, P_oso },
+  /* 105 */ { O_R7z, O_NONE, O_NONE, P_oso },
+  /* 106 */ { O_R0v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 107 */ { O_R1v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 108 */ { O_R2v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 109 */ { O_R3v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 110 */ { O_R4v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 111 */ { O_R5v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 112 */ { O_R6v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 113 */ { O_R7v, O_NONE, O_NONE, P_oso|P_rexb|P_def64 },
+  /* 114 */ { O_NONE, O_NONE, O_NONE, P_oso|P_inv64 },
+  /* 115 */ { O_Gv, O_M, O_NONE, P_aso|P_oso },
+  /* 116 */ { O_Ew, O_Gw, O_NONE, P_aso },
+  /* 117 */ { O_Gq, O_Ed, O_NONE, P_aso|P_oso|P_rexw|P_rexx|P_rexr|P_rexb },
+  /* 118 */ { O_sIz, O_NONE, O_NONE, P_oso|P_def64 },
+  /* 119 */ { O_Gv, O_Ev, O_Iz, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 120 */ { O_sIb, O_NONE, O_NONE, P_oso|P_def64 },
+  /* 121 */ { O_Gv, O_Ev, O_sIb, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 122 */ { O_NONE, O_NONE, O_NONE, P_str|P_seg },
+  /* 123 */ { O_NONE, O_NONE, O_NONE, P_str|P_oso|P_seg },
+  /* 124 */ { O_Jb, O_NONE, O_NONE, P_none },
+  /* 125 */ { O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 126 */ { O_Eb, O_Ib, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 127 */ { O_Ev, O_sIz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 128 */ { O_Eb, O_Ib, O_NONE, P_aso|P_rexr|P_rexx|P_rexb|P_inv64 },
+  /* 129 */ { O_Ev, O_sIb, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 130 */ { O_MwRv, O_S, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 131 */ { O_S, O_MwRv, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 132 */ { O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 133 */ { O_R0v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 134 */ { O_R1v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 135 */ { O_R2v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 136 */ { O_R3v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 137 */ { O_R4v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 138 */ { O_R5v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 139 */ { O_R6v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 140 */ { O_R7v, O_rAX, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 141 */ { O_NONE, O_NONE, O_NONE, P_oso|P_rexw },
+  /* 142 */ { O_Av, O_NONE, O_NONE, P_oso },
+  /* 143 */ { O_NONE, O_NONE, O_NONE, P_oso },
+  /* 144 */ { O_NONE, O_NONE, O_NONE, P_oso|P_rexw|P_def64 },
+  /* 145 */ { O_NONE, O_NONE, O_NONE, P_oso|P_def64 },
+  /* 146 */ { O_AL, O_Ob, O_NONE, P_none },
+  /* 147 */ { O_rAX, O_Ov, O_NONE, P_aso|P_oso|P_rexw },
+  /* 148 */ { O_Ob, O_AL, O_NONE, P_none },
+  /* 149 */ { O_Ov, O_rAX, O_NONE, P_aso|P_oso|P_rexw },
+  /* 150 */ { O_NONE, O_NONE, O_NONE, P_str|P_seg|P_oso|P_rexw },
+  /* 151 */ { O_NONE, O_NONE, O_NONE, P_strz|P_seg },
+  /* 152 */ { O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw|P_seg },
+  /* 153 */ { O_NONE, O_NONE, O_NONE, P_strz },
+  /* 154 */ { O_NONE, O_NONE, O_NONE, P_strz|P_oso|P_rexw },
+  /* 155 */ { O_R0b, O_Ib, O_NONE, P_rexb },
+  /* 156 */ { O_R1b, O_Ib, O_NONE, P_rexb },
+  /* 157 */ { O_R2b, O_Ib, O_NONE, P_rexb },
+  /* 158 */ { O_R3b, O_Ib, O_NONE, P_rexb },
+  /* 159 */ { O_R4b, O_Ib, O_NONE, P_rexb },
+  /* 160 */ { O_R5b, O_Ib, O_NONE, P_rexb },
+  /* 161 */ { O_R6b, O_Ib, O_NONE, P_rexb },
+  /* 162 */ { O_R7b, O_Ib, O_NONE, P_rexb },
+  /* 163 */ { O_R0v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 164 */ { O_R1v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 165 */ { O_R2v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 166 */ { O_R3v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 167 */ { O_R4v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 168 */ { O_R5v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 169 */ { O_R6v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 170 */ { O_R7v, O_Iv, O_NONE, P_oso|P_rexw|P_rexb },
+  /* 171 */ { O_Iw, O_NONE, O_NONE, P_none },
+  /* 172 */ { O_Iw, O_Ib, O_NONE, P_def64 },
+  /* 173 */ { O_Ib, O_NONE, O_NONE, P_none },
+  /* 174 */ { O_Eb, O_I1, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 175 */ { O_Ev, O_I1, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 176 */ { O_Eb, O_CL, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 177 */ { O_Eb, O_CL, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 178 */ { O_Ev, O_CL, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 179 */ { O_NONE, O_NONE, O_NONE, P_rexw|P_seg },
+  /* 180 */ { O_Md, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 181 */ { O_ST0, O_ST0, O_NONE, P_none },
+  /* 182 */ { O_ST0, O_ST1, O_NONE, P_none },
+  /* 183 */ { O_ST0, O_ST2, O_NONE, P_none },
+  /* 184 */ { O_ST0, O_ST3, O_NONE, P_none },
+  /* 185 */ { O_ST0, O_ST4, O_NONE, P_none },
+  /* 186 */ { O_ST0, O_ST5, O_NONE, P_none },
+  /* 187 */ { O_ST0, O_ST6, O_NONE, P_none },
+  /* 188 */ { O_ST0, O_ST7, O_NONE, P_none },
+  /* 189 */ { O_Mw, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 190 */ { O_ST0, O_NONE, O_NONE, P_none },
+  /* 191 */ { O_ST1, O_NONE, O_NONE, P_none },
+  /* 192 */ { O_ST2, O_NONE, O_NONE, P_none },
+  /* 193 */ { O_ST3, O_NONE, O_NONE, P_none },
+  /* 194 */ { O_ST4, O_NONE, O_NONE, P_none },
+  /* 195 */ { O_ST5, O_NONE, O_NONE, P_none },
+  /* 196 */ { O_ST6, O_NONE, O_NONE, P_none },
+  /* 197 */ { O_ST7, O_NONE, O_NONE, P_none },
+  /* 198 */ { O_Mt, O_NONE, O_NONE, P_aso|P_rexr|P_rexx|P_rexb },
+  /* 199 */ { O_ST1, O_ST0, O_NONE, P_none },
+  /* 200 */ { O_ST2, O_ST0, O_NONE, P_none },
+  /* 201 */ { O_ST3, O_ST0, O_NONE, P_none },
+  /* 202 */ { O_ST4, O_ST0, O_NONE, P_none },
+  /* 203 */ { O_ST5, O_ST0, O_NONE, P_none },
+  /* 204 */ { O_ST6, O_ST0, O_NONE, P_none },
+  /* 205 */ { O_ST7, O_ST0, O_NONE, P_none },
+  /* 206 */ { O_AX, O_NONE, O_NONE, P_none },
+  /* 207 */ { O_Jb, O_NONE, O_NONE, P_aso },
+  /* 208 */ { O_eAX, O_Ib, O_NONE, P_oso },
+  /* 209 */ { O_Ib, O_AL, O_NONE, P_none },
+  /* 210 */ { O_Ib, O_eAX, O_NONE, P_oso },
+  /* 211 */ { O_Jb, O_NONE, O_NONE, P_def64 },
+  /* 212 */ { O_AL, O_DX, O_NONE, P_none },
+  /* 213 */ { O_eAX, O_DX, O_NONE, P_oso },
+  /* 214 */ { O_DX, O_AL, O_NONE, P_none },
+  /* 215 */ { O_DX, O_eAX, O_NONE, P_oso },
+  /* 216 */ { O_Eb, O_NONE, O_NONE, P_aso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 217 */ { O_Ev, O_Iz, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 218 */ { O_Ev, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+  /* 219 */ { O_Eq, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb|P_def64 },
+  /* 220 */ { O_Fv, O_NONE, O_NONE, P_aso|P_oso|P_rexw|P_rexr|P_rexx|P_rexb },
+};
+
+
+const struct ud_itab_entry ud_itab[] = {
+  /* 0000 */ { UD_Iinvalid, 0 },
+  /* 0001 */ { UD_Iadd, 1 },
+  /* 0002 */ { UD_Iadd, 2 },
+  /* 0003 */ { UD_Iadd, 3 },
+  /* 0004 */ { UD_Iadd, 4 },
+  /* 0005 */ { UD_Iadd, 5 },
+  /* 0006 */ { UD_Iadd, 6 },
+  /* 0007 */ { UD_Ipush, 7 },
+  /* 0008 */ { UD_Ipop, 7 },
+  /* 0009 */ { UD_Ior, 1 },
+  /* 0010 */ { UD_Ior, 2 },
+  /* 0011 */ { UD_Ior, 3 },
+  /* 0012 */ { UD_Ior, 4 },
+  /* 0013 */ { UD_Ior, 5 },
+  /* 0014 */ { UD_Ior, 6 },
+  /* 0015 */ { UD_Ipush, 8 },
+  /* 0016 */ { UD_Isldt, 9 },
+  /* 0017 */ { UD_Istr, 9 },
+  /* 0018 */ { UD_Illdt, 10 },
+  /* 0019 */ { UD_Iltr, 10 },
+  /* 0020 */ { UD_Iverr, 10 },
+  /* 0021 */ { UD_Iverw, 10 },
+  /* 0022 */ { UD_Isgdt, 11 },
+  /* 0023 */ { UD_Isidt, 11 },
+  /* 0024 */ { UD_Ilgdt, 11 },
+  /* 0025 */ { UD_Ilidt, 11 },
+  /* 0026 */ { UD_Ismsw, 9 },
+  /* 0027 */ { UD_Ilmsw, 10 },
+  /* 0028 */ { UD_Iinvlpg, 11 },
+  /* 0029 */ { UD_Ivmcall, 0 },
+  /* 0030 */ { UD_Ivmlaunch, 0 },
+  /* 0031 */ { UD_Ivmresume, 0 },
+  /* 0032 */ { UD_Ivmxoff, 0 },
+  /* 0033 */ { UD_Imonitor, 0 },
+  /* 0034 */ { UD_Imwait, 0 },
+  /* 0035 */ { UD_Ixgetbv, 0 },
+  /* 0036 */ { UD_Ixsetbv, 0 },
+  /* 0037 */ { UD_Ivmrun, 0 },
+  /* 0038 */ { UD_Ivmmcall, 0 },
+  /* 0039 */ { UD_Ivmload, 0 },
+  /* 0040 */ { UD_Ivmsave, 0 },
+  /* 0041 */ { UD_Istgi, 0 },
+  /* 0042 */ { UD_Iclgi, 0 },
+  /* 0043 */ { UD_Iskinit, 0 },
+  /* 0044 */ { UD_Iinvlpga, 0 },
+  /* 0045 */ { UD_Ismsw, 9 },
+  /* 0046 */ { UD_Ilmsw, 10 },
+  /* 0047 */ { UD_Iswapgs, 0 },
+  /* 0048 */ { UD_Irdtscp, 0 },
+  /* 0049 */ { UD_Ilar, 12 },
+  /* 0050 */ { UD_Ilsl, 12 },
+  /* 0051 */ { UD_Isyscall, 0 },
+  /* 0052 */ { UD_Iclts, 0 },
+  /* 0053 */ { UD_Isysret, 0 },
+  /* 0054 */ { UD_Iinvd, 0 },
+  /* 0055 */ { UD_Iwbinvd, 0 },
+  /* 0056 */ { UD_Iud2, 0 },
+  /* 0057 */ { UD_Iprefetch, 13 },
+  /* 0058 */ { UD_Iprefetch, 13 },
+  /* 0059 */ { UD_Iprefetch, 13 },
+  /* 0060 */ { UD_Iprefetch, 13 },
+  /* 0061 */ { UD_Iprefetch, 13 },
+  /* 0062 */ { UD_Iprefetch, 13 },
+  /* 0063 */ { UD_Iprefetch, 13 },
+  /* 0064 */ { UD_Iprefetch, 13 },
+  /* 0065 */ { UD_Ifemms, 0 },
+  /* 0066 */ { UD_Ipi2fw, 14 },
+  /* 0067 */ { UD_Ipi2fd, 14 },
+  /* 0068 */ { UD_Ipf2iw, 14 },
+  /* 0069 */ { UD_Ipf2id, 14 },
+  /* 0070 */ { UD_Ipfnacc, 14 },
+  /* 0071 */ { UD_Ipfpnacc, 14 },
+  /* 0072 */ { UD_Ipfcmpge, 14 },
+  /* 0073 */ { UD_Ipfmin, 14 },
+  /* 0074 */ { UD_Ipfrcp, 14 },
+  /* 0075 */ { UD_Ipfrsqrt, 14 },
+  /* 0076 */ { UD_Ipfsub, 14 },
+  /* 0077 */ { UD_Ipfadd, 14 },
+  /* 0078 */ { UD_Ipfcmpgt, 14 },
+  /* 0079 */ { UD_Ipfmax, 14 },
+  /* 0080 */ { UD_Ipfrcpit1, 14 },
+  /* 0081 */ { UD_Ipfrsqit1, 14 },
+  /* 0082 */ { UD_Ipfsubr, 14 },
+  /* 0083 */ { UD_Ipfacc, 14 },
+  /* 0084 */ { UD_Ipfcmpeq, 14 },
+  /* 0085 */ { UD_Ipfmul, 14 },
+  /* 0086 */ { UD_Ipfrcpit2, 14 },
+  /* 0087 */ { UD_Ipmulhrw, 14 },
+  /* 0088 */ { UD_Ipswapd, 14 },
+  /* 0089 */ { UD_Ipavgusb, 14 },
+  /* 0090 */ { UD_Imovups, 15 },
+  /* 0091 */ { UD_Imovsd, 16 },
+  /* 0092 */ { UD_Imovss, 15 },
+  /* 0093 */ { UD_Imovupd, 15 },
+  /* 0094 */ { UD_Imovups, 17 },
+  /* 0095 */ { UD_Imovsd, 18 },
+  /* 0096 */ { UD_Imovss, 17 },
+  /* 0097 */ { UD_Imovupd, 17 },
+  /* 0098 */ { UD_Imovlps, 19 },
+  /* 0099 */ { UD_Imovddup, 15 },
+  /* 0100 */ { UD_Imovsldup, 15 },
+  /* 0101 */ { UD_Imovlpd, 19 },
+  /* 0102 */ { UD_Imovhlps, 20 },
+  /* 0103 */ { UD_Imovddup, 15 },
+  /* 0104 */ { UD_Imovsldup, 15 },
+  /* 0105 */ { UD_Imovlps, 21 },
+  /* 0106 */ { UD_Imovlpd, 21 },
+  /* 0107 */ { UD_Iunpcklps, 15 },
+  /* 0108 */ { UD_Iunpcklpd, 15 },
+  /* 0109 */ { UD_Iunpckhps, 15 },
+  /* 0110 */ { UD_Iunpckhpd, 15 },
+  /* 0111 */ { UD_Imovhps, 19 },
+  /* 0112 */ { UD_Imovshdup, 15 },
+  /* 0113 */ { UD_Imovhpd, 19 },
+  /* 0114 */ { UD_Imovlhps, 20 },
+  /* 0115 */ { UD_Imovshdup, 15 },
+  /* 0116 */ { UD_Imovhps, 21 },
+  /* 0117 */ { UD_Imovhpd, 21 },
+  /* 0118 */ { UD_Iprefetchnta, 13 },
+  /* 0119 */ { UD_Iprefetcht0, 13 },
+  /* 0120 */ { UD_Iprefetcht1, 13 },
+  /* 0121 */ { UD_Iprefetcht2, 13 },
+  /* 0122 */ { UD_Inop, 11 },
+  /* 0123 */ { UD_Inop, 11 },
+  /* 0124 */ { UD_Inop, 11 },
+  /* 0125 */ { UD_Inop, 11 },
+  /* 0126 */ { UD_Inop, 11 },
+  /* 0127 */ { UD_Inop, 11 },
+  /* 0128 */ { UD_Inop, 11 },
+  /* 0129 */ { UD_Imov, 22 },
+  /* 0130 */ { UD_Imov, 23 },
+  /* 0131 */ { UD_Imov, 24 },
+  /* 0132 */ { UD_Imov, 25 },
+  /* 0133 */ { UD_Imovaps, 15 },
+  /* 0134 */ { UD_Imovapd, 15 },
+  /* 0135 */ { UD_Imovaps, 17 },
+  /* 0136 */ { UD_Imovapd, 17 },
+  /* 0137 */ { UD_Icvtpi2ps, 26 },
+  /* 0138 */ { UD_Icvtsi2sd, 27 },
+  /* 0139 */ { UD_Icvtsi2ss, 27 },
+  /* 0140 */ { UD_Icvtpi2pd, 26 },
+  /* 0141 */ { UD_Imovntps, 21 },
+  /* 0142 */ { UD_Imovntpd, 21 },
+  /* 0143 */ { UD_Icvttps2pi, 28 },
+  /* 0144 */ { UD_Icvttsd2si, 29 },
+  /* 0145 */ { UD_Icvttss2si, 29 },
+  /* 0146 */ { UD_Icvttpd2pi, 28 },
+  /* 0147 */ { UD_Icvtps2pi, 28 },
+  /* 0148 */ { UD_Icvtsd2si, 29 },
+  /* 0149 */ { UD_Icvtss2si, 29 },
+  /* 0150 */ { UD_Icvtpd2pi, 28 },
+  /* 0151 */ { UD_Iucomiss, 15 },
+  /* 0152 */ { UD_Iucomisd, 15 },
+  /* 0153 */ { UD_Icomiss, 15 },
+  /* 0154 */ { UD_Icomisd, 15 },
+  /* 0155 */ { UD_Iwrmsr, 0 },
+  /* 0156 */ { UD_Irdtsc, 0 },
+  /* 0157 */ { UD_Irdmsr, 0 },
+  /* 0158 */ { UD_Irdpmc, 0 },
+  /* 0159 */ { UD_Isysenter, 0 },
+  /* 0160 */ { UD_Isysenter, 0 },
+  /* 0161 */ { UD_Isysexit, 0 },
+  /* 0162 */ { UD_Isysexit, 0 },
+  /* 0163 */ { UD_Igetsec, 0 },
+  /* 0164 */ { UD_Ipshufb, 14 },
+  /* 0165 */ { UD_Ipshufb, 15 },
+  /* 0166 */ { UD_Iphaddw, 14 },
+  /* 0167 */ { UD_Iphaddw, 15 },
+  /* 0168 */ { UD_Iphaddd, 14 },
+  /* 0169 */ { UD_Iphaddd, 15 },
+  /* 0170 */ { UD_Iphaddsw, 14 },
+  /* 0171 */ { UD_Iphaddsw, 15 },
+  /* 0172 */ { UD_Ipmaddubsw, 14 },
+  /* 0173 */ { UD_Ipmaddubsw, 15 },
+  /* 0174 */ { UD_Iphsubw, 14 },
+  /* 0175 */ { UD_Iphsubw, 15 },
+  /* 0176 */ { UD_Iphsubd, 14 },
+  /* 0177 */ { UD_Iphsubd, 15 },
+  /* 0178 */ { UD_Iphsubsw, 14 },
+  /* 0179 */ { UD_Iphsubsw, 15 },
+  /* 0180 */ { UD_Ipsignb, 14 },
+  /* 0181 */ { UD_Ipsignb, 15 },
+  /* 0182 */ { UD_Ipsignw, 14 },
+  /* 0183 */ { UD_Ipsignw, 15 },
+  /* 0184 */ { UD_Ipsignd, 14 },
+  /* 0185 */ { UD_Ipsignd, 15 },
+  /* 0186 */ { UD_Ipmulhrsw, 14 },
+  /* 0187 */ { UD_Ipmulhrsw, 15 },
+  /* 0188 */ { UD_Ipblendvb, 15 },
+  /* 0189 */ { UD_Iblendvps, 15 },
+  /* 0190 */ { UD_Iblendvpd, 15 },
+  /* 0191 */ { UD_Iptest, 30 },
+  /* 0192 */ { UD_Ipabsb, 14 },
+  /* 0193 */ { UD_Ipabsb, 15 },
+  /* 0194 */ { UD_Ipabsw, 14 },
+  /* 0195 */ { UD_Ipabsw, 15 },
+  /* 0196 */ { UD_Ipabsd, 14 },
+  /* 0197 */ { UD_Ipabsd, 15 },
+  /* 0198 */ { UD_Ipmovsxbw, 31 },
+  /* 0199 */ { UD_Ipmovsxbd, 32 },
+  /* 0200 */ { UD_Ipmovsxbq, 33 },
+  /* 0201 */ { UD_Ipmovsxwd, 31 },
+  /* 0202 */ { UD_Ipmovsxwq, 32 },
+  /* 0203 */ { UD_Ipmovsxdq, 31 },
+  /* 0204 */ { UD_Ipmuldq, 15 },
+  /* 0205 */ { UD_Ipcmpeqq, 30 },
+  /* 0206 */ { UD_Imovntdqa, 34 },
+  /* 0207 */ { UD_Ipackusdw, 30 },
+  /* 0208 */ { UD_Ipmovzxbw, 31 },
+  /* 0209 */ { UD_Ipmovzxbd, 32 },
+  /* 0210 */ { UD_Ipmovzxbq, 33 },
+  /* 0211 */ { UD_Ipmovzxwd, 31 },
+  /* 0212 */ { UD_Ipmovzxwq, 32 },
+  /* 0213 */ { UD_Ipmovzxdq, 31 },
+  /* 0214 */ { UD_Ipcmpgtq, 30 },
+  /* 0215 */ { UD_Ipminsb, 15 },
+  /* 0216 */ { UD_Ipminsd, 15 },
+  /* 0217 */ { UD_Ipminuw, 15 },
+  /* 0218 */ { UD_Ipminud, 15 },
+  /* 0219 */ { UD_Ipmaxsb, 15 },
+  /* 0220 */ { UD_Ipmaxsd, 15 },
+  /* 0221 */ { UD_Ipmaxuw, 15 },
+  /* 0222 */ { UD_Ipmaxud, 15 },
+  /* 0223 */ { UD_Ipmulld, 15 },
+  /* 0224 */ { UD_Iphminposuw, 15 },
+  /* 0225 */ { UD_Iinvept, 35 },
+  /* 0226 */ { UD_Iinvvpid, 35 },
+  /* 0227 */ { UD_Iaesimc, 15 },
+  /* 0228 */ { UD_Iaesenc, 15 },
+  /* 0229 */ { UD_Iaesenclast, 15 },
+  /* 0230 */ { UD_Iaesdec, 15 },
+  /* 0231 */ { UD_Iaesdeclast, 15 },
+  /* 0232 */ { UD_Imovbe, 36 },
+  /* 0233 */ { UD_Icrc32, 37 },
+  /* 0234 */ { UD_Imovbe, 38 },
+  /* 0235 */ { UD_Icrc32, 39 },
+  /* 0236 */ { UD_Iroundps, 40 },
+  /* 0237 */ { UD_Iroundpd, 40 },
+  /* 0238 */ { UD_Iroundss, 40 },
+  /* 0239 */ { UD_Iroundsd, 40 },
+  /* 0240 */ { UD_Iblendps, 40 },
+  /* 0241 */ { UD_Iblendpd, 40 },
+  /* 0242 */ { UD_Ipblendw, 40 },
+  /* 0243 */ { UD_Ipalignr, 41 },
+  /* 0244 */ { UD_Ipalignr, 40 },
+  /* 0245 */ { UD_Ipextrb, 42 },
+  /* 0246 */ { UD_Ipextrw, 43 },
+  /* 0247 */ { UD_Ipextrd, 44 },
+  /* 0248 */ { UD_Ipextrd, 44 },
+  /* 0249 */ { UD_Ipextrq, 45 },
+  /* 0250 */ { UD_Iextractps, 46 },
+  /* 0251 */ { UD_Ipinsrb, 47 },
+  /* 0252 */ { UD_Iinsertps, 48 },
+  /* 0253 */ { UD_Ipinsrd, 49 },
+  /* 0254 */ { UD_Ipinsrd, 49 },
+  /* 0255 */ { UD_Ipinsrq, 50 },
+  /* 0256 */ { UD_Idpps, 40 },
+  /* 0257 */ { UD_Idppd, 40 },
+  /* 0258 */ { UD_Impsadbw, 40 },
+  /* 0259 */ { UD_Ipclmulqdq, 40 },
+  /* 0260 */ { UD_Ipcmpestrm, 51 },
+  /* 0261 */ { UD_Ipcmpestri, 51 },
+  /* 0262 */ { UD_Ipcmpistrm, 51 },
+  /* 0263 */ { UD_Ipcmpistri, 51 },
+  /* 0264 */ { UD_Iaeskeygenassist, 40 },
+  /* 0265 */ { UD_Icmovo, 4 },
+  /* 0266 */ { UD_Icmovno, 4 },
+  /* 0267 */ { UD_Icmovb, 4 },
+  /* 0268 */ { UD_Icmovae, 4 },
+  /* 0269 */ { UD_Icmovz, 4 },
+  /* 0270 */ { UD_Icmovnz, 4 },
+  /* 0271 */ { UD_Icmovbe, 4 },
+  /* 0272 */ { UD_Icmova, 4 },
+  /* 0273 */ { UD_Icmovs, 4 },
+  /* 0274 */ { UD_Icmovns, 4 },
+  /* 0275 */ { UD_Icmovp, 4 },
+  /* 0276 */ { UD_Icmovnp, 4 },
+  /* 0277 */ { UD_Icmovl, 4 },
+  /* 0278 */ { UD_Icmovge, 4 },
+  /* 0279 */ { UD_Icmovle, 4 },
+  /* 0280 */ { UD_Icmovg, 4 },
+  /* 0281 */ { UD_Imovmskps, 52 },
+  /* 0282 */ { UD_Imovmskpd, 52 },
+  /* 0283 */ { UD_Isqrtps, 15 },
+  /* 0284 */ { UD_Isqrtsd, 15 },
+  /* 0285 */ { UD_Isqrtss, 15 },
+  /* 0286 */ { UD_Isqrtpd, 15 },
+  /* 0287 */ { UD_Irsqrtps, 15 },
+  /* 0288 */ { UD_Irsqrtss, 15 },
+  /* 0289 */ { UD_Ircpps, 15 },
+  /* 0290 */ { UD_Ircpss, 15 },
+  /* 0291 */ { UD_Iandps, 15 },
+  /* 0292 */ { UD_Iandpd, 15 },
+  /* 0293 */ { UD_Iandnps, 15 },
+  /* 0294 */ { UD_Iandnpd, 15 },
+  /* 0295 */ { UD_Iorps, 15 },
+  /* 0296 */ { UD_Iorpd, 15 },
+  /* 0297 */ { UD_Ixorps, 15 },
+  /* 0298 */ { UD_Ixorpd, 15 },
+  /* 0299 */ { UD_Iaddps, 15 },
+  /* 0300 */ { UD_Iaddsd, 15 },
+  /* 0301 */ { UD_Iaddss, 15 },
+  /* 0302 */ { UD_Iaddpd, 15 },
+  /* 0303 */ { UD_Imulps, 15 },
+  /* 0304 */ { UD_Imulsd, 15 },
+  /* 0305 */ { UD_Imulss, 15 },
+  /* 0306 */ { UD_Imulpd, 15 },
+  /* 0307 */ { UD_Icvtps2pd, 15 },
+  /* 0308 */ { UD_Icvtsd2ss, 15 },
+  /* 0309 */ { UD_Icvtss2sd, 15 },
+  /* 0310 */ { UD_Icvtpd2ps, 15 },
+  /* 0311 */ { UD_Icvtdq2ps, 15 },
+  /* 0312 */ { UD_Icvttps2dq, 15 },
+  /* 0313 */ { UD_Icvtps2dq, 15 },
+  /* 0314 */ { UD_Isubps, 15 },
+  /* 0315 */ { UD_Isubsd, 15 },
+  /* 0316 */ { UD_Isubss, 15 },
+  /* 0317 */ { UD_Isubpd, 15 },
+  /* 0318 */ { UD_Iminps, 15 },
+  /* 0319 */ { UD_Iminsd, 15 },
+  /* 0320 */ { UD_Iminss, 15 },
+  /* 0321 */ { UD_Iminpd, 15 },
+  /* 0322 */ { UD_Idivps, 15 },
+  /* 0323 */ { UD_Idivsd, 15 },
+  /* 0324 */ { UD_Idivss, 15 },
+  /* 0325 */ { UD_Idivpd, 15 },
+  /* 0326 */ { UD_Imaxps, 15 },
+  /* 0327 */ { UD_Imaxsd, 15 },
+  /* 0328 */ { UD_Imaxss, 15 },
+  /* 0329 */ { UD_Imaxpd, 15 },
+  /* 0330 */ { UD_Ipunpcklbw, 14 },
+  /* 0331 */ { UD_Ipunpcklbw, 15 },
+  /* 0332 */ { UD_Ipunpcklwd, 14 },
+  /* 0333 */ { UD_Ipunpcklwd, 15 },
+  /* 0334 */ { UD_Ipunpckldq, 14 },
+  /* 0335 */ { UD_Ipunpckldq, 15 },
+  /* 0336 */ { UD_Ipacksswb, 14 },
+  /* 0337 */ { UD_Ipacksswb, 15 },
+  /* 0338 */ { UD_Ipcmpgtb, 14 },
+  /* 0339 */ { UD_Ipcmpgtb, 15 },
+  /* 0340 */ { UD_Ipcmpgtw, 14 },
+  /* 0341 */ { UD_Ipcmpgtw, 15 },
+  /* 0342 */ { UD_Ipcmpgtd, 14 },
+  /* 0343 */ { UD_Ipcmpgtd, 15 },
+  /* 0344 */ { UD_Ipackuswb, 14 },
+  /* 0345 */ { UD_Ipackuswb, 15 },
+  /* 0346 */ { UD_Ipunpckhbw, 14 },
+  /* 0347 */ { UD_Ipunpckhbw, 15 },
+  /* 0348 */ { UD_Ipunpckhwd, 14 },
+  /* 0349 */ { UD_Ipunpckhwd, 15 },
+  /* 0350 */ { UD_Ipunpckhdq, 14 },
+  /* 0351 */ { UD_Ipunpckhdq, 15 },
+  /* 0352 */ { UD_Ipackssdw, 14 },
+  /* 0353 */ { UD_Ipackssdw, 15 },
+  /* 0354 */ { UD_Ipunpcklqdq, 15 },
+  /* 0355 */ { UD_Ipunpckhqdq, 15 },
+  /* 0356 */ { UD_Imovd, 53 },
+  /* 0357 */ { UD_Imovd, 27 },
+  /* 0358 */ { UD_Imovq, 14 },
+  /* 0359 */ { UD_Imovdqu, 15 },
+  /* 0360 */ { UD_Imovdqa, 15 },
+  /* 0361 */ { UD_Ipshufw, 41 },
+  /* 0362 */ { UD_Ipshuflw, 40 },
+  /* 0363 */ { UD_Ipshufhw, 40 },
+  /* 0364 */ { UD_Ipshufd, 40 },
+  /* 0365 */ { UD_Ipsrlw, 54 },
+  /* 0366 */ { UD_Ipsrlw, 55 },
+  /* 0367 */ { UD_Ipsraw, 54 },
+  /* 0368 */ { UD_Ipsraw, 55 },
+  /* 0369 */ { UD_Ipsllw, 54 },
+  /* 0370 */ { UD_Ipsllw, 55 },
+  /* 0371 */ { UD_Ipsrld, 54 },
+  /* 0372 */ { UD_Ipsrld, 55 },
+  /* 0373 */ { UD_Ipsrad, 54 },
+  /* 0374 */ { UD_Ipsrad, 55 },
+  /* 0375 */ { UD_Ipslld, 54 },
+  /* 0376 */ { UD_Ipslld, 55 },
+  /* 0377 */ { UD_Ipsrlq, 54 },
+  /* 0378 */ { UD_Ipsrlq, 55 },
+  /* 0379 */ { UD_Ipsrldq, 55 },
+  /* 0380 */ { UD_Ipsllq, 54 },
+  /* 0381 */ { UD_Ipsllq, 55 },
+  /* 0382 */ { UD_Ipslldq, 55 },
+  /* 0383 */ { UD_Ipcmpeqb, 14 },
+  /* 0384 */ { UD_Ipcmpeqb, 15 },
+  /* 0385 */ { UD_Ipcmpeqw, 14 },
+  /* 0386 */ { UD_Ipcmpeqw, 15 },
+  /* 0387 */ { UD_Ipcmpeqd, 14 },
+  /* 0388 */ { UD_Ipcmpeqd, 15 },
+  /* 0389 */ { UD_Iemms, 0 },
+  /* 0390 */ { UD_Ivmread, 56 },
+  /* 0391 */ { UD_Ivmwrite, 57 },
+  /* 0392 */ { UD_Ihaddps, 15 },
+  /* 0393 */ { UD_Ihaddpd, 15 },
+  /* 0394 */ { UD_Ihsubps, 15 },
+  /* 0395 */ { UD_Ihsubpd, 15 },
+  /* 0396 */ { UD_Imovd, 58 },
+  /* 0397 */ { UD_Imovq, 15 },
+  /* 0398 */ { UD_Imovd, 59 },
+  /* 0399 */ { UD_Imovq, 60 },
+  /* 0400 */ { UD_Imovdqu, 17 },
+  /* 0401 */ { UD_Imovdqa, 17 },
+  /* 0402 */ { UD_Ijo, 61 },
+  /* 0403 */ { UD_Ijno, 61 },
+  /* 0404 */ { UD_Ijb, 61 },
+  /* 0405 */ { UD_Ijae, 61 },
+  /* 0406 */ { UD_Ijz, 61 },
+  /* 0407 */ { UD_Ijnz, 61 },
+  /* 0408 */ { UD_Ijbe, 61 },
+  /* 0409 */ { UD_Ija, 61 },
+  /* 0410 */ { UD_Ijs, 61 },
+  /* 0411 */ { UD_Ijns, 61 },
+  /* 0412 */ { UD_Ijp, 61 },
+  /* 0413 */ { UD_Ijnp, 61 },
+  /* 0414 */ { UD_Ijl, 61 },
+  /* 0415 */ { UD_Ijge, 61 },
+  /* 0416 */ { UD_Ijle, 61 },
+  /* 0417 */ { UD_Ijg, 61 },
+  /* 0418 */ { UD_Iseto, 62 },
+  /* 0419 */ { UD_Isetno, 62 },
+  /* 0420 */ { UD_Isetb, 62 },
+  /* 0421 */ { UD_Isetae, 62 },
+  /* 0422 */ { UD_Isetz, 62 },
+  /* 0423 */ { UD_Isetnz, 62 },
+  /* 0424 */ { UD_Isetbe, 62 },
+  /* 0425 */ { UD_Iseta, 62 },
+  /* 0426 */ { UD_Isets, 62 },
+  /* 0427 */ { UD_Isetns, 62 },
+  /* 0428 */ { UD_Isetp, 62 },
+  /* 0429 */ { UD_Isetnp, 62 },
+  /* 0430 */ { UD_Isetl, 62 },
+  /* 0431 */ { UD_Isetge, 62 },
+  /* 0432 */ { UD_Isetle, 62 },
+  /* 0433 */ { UD_Isetg, 62 },
+  /* 0434 */ { UD_Ipush, 63 },
+  /* 0435 */ { UD_Ipop, 63 },
+  /* 0436 */ { UD_Icpuid, 0 },
+  /* 0437 */ { UD_Ibt, 2 },
+  /* 0438 */ { UD_Ishld, 64 },
+  /* 0439 */ { UD_Ishld, 65 },
+  /* 0440 */ { UD_Imontmul, 0 },
+  /* 0441 */ { UD_Ixsha1, 0 },
+  /* 0442 */ { UD_Ixsha256, 0 },
+  /* 0443 */ { UD_Ixstore, 0 },
+  /* 0444 */ { UD_Ixcryptecb, 0 },
+  /* 0445 */ { UD_Ixcryptcbc, 0 },
+  /* 0446 */ { UD_Ixcryptctr, 0 },
+  /* 0447 */ { UD_Ixcryptcfb, 0 },
+  /* 0448 */ { UD_Ixcryptofb, 0 },
+  /* 0449 */ { UD_Ipush, 66 },
+  /* 0450 */ { UD_Ipop, 66 },
+  /* 0451 */ { UD_Irsm, 0 },
+  /* 0452 */ { UD_Ibts, 2 },
+  /* 0453 */ { UD_Ishrd, 64 },
+  /* 0454 */ { UD_Ishrd, 65 },
+  /* 0455 */ { UD_Ifxsave, 13 },
+  /* 0456 */ { UD_Ifxrstor, 13 },
+  /* 0457 */ { UD_Ildmxcsr, 67 },
+  /* 0458 */ { UD_Istmxcsr, 67 },
+  /* 0459 */ { UD_Ixsave, 13 },
+  /* 0460 */ { UD_Ixrstor, 13 },
+  /* 0461 */ { UD_Iclflush, 13 },
+  /* 0462 */ { UD_Ilfence, 0 },
+  /* 0463 */ { UD_Ilfence, 0 },
+  /* 0464 */ { UD_Ilfence, 0 },
+  /* 0465 */ { UD_Ilfence, 0 },
+  /* 0466 */ { UD_Ilfence, 0 },
+  /* 0467 */ { UD_Ilfence, 0 },
+  /* 0468 */ { UD_Ilfence, 0 },
+  /* 0469 */ { UD_Ilfence, 0 },
+  /* 0470 */ { UD_Imfence, 0 },
+  /* 0471 */ { UD_Imfence, 0 },
+  /* 0472 */ { UD_Imfence, 0 },
+  /* 0473 */ { UD_Imfence, 0 },
+  /* 0474 */ { UD_Imfence, 0 },
+  /* 0475 */ { UD_Imfence, 0 },
+  /* 0476 */ { UD_Imfence, 0 },
+  /* 0477 */ { UD_Imfence, 0 },
+  /* 0478 */ { UD_Isfence, 0 },
+  /* 0479 */ { UD_Isfence, 0 },
+  /* 0480 */ { UD_Isfence, 0 },
+  /* 0481 */ { UD_Isfence, 0 },
+  /* 0482 */ { UD_Isfence, 0 },
+  /* 0483 */ { UD_Isfence, 0 },
+  /* 0484 */ { UD_Isfence, 0 },
+  /* 0485 */ { UD_Isfence, 0 },
+  /* 0486 */ { UD_Iimul, 4 },
+  /* 0487 */ { UD_Icmpxchg, 1 },
+  /* 0488 */ { UD_Icmpxchg, 2 },
+  /* 0489 */ { UD_Ilss, 68 },
+  /* 0490 */ { UD_Ibtr, 2 },
+  /* 0491 */ { UD_Ilfs, 69 },
+  /* 0492 */ { UD_Ilgs, 69 },
+  /* 0493 */ { UD_Imovzx, 70 },
+  /* 0494 */ { UD_Imovzx, 71 },
+  /* 0495 */ { UD_Ipopcnt, 72 },
+  /* 0496 */ { UD_Ibt, 73 },
+  /* 0497 */ { UD_Ibts, 73 },
+  /* 0498 */ { UD_Ibtr, 73 },
+  /* 0499 */ { UD_Ibtc, 73 },
+  /* 0500 */ { UD_Ibtc, 2 },
+  /* 0501 */ { UD_Ibsf, 4 },
+  /* 0502 */ { UD_Ibsr, 4 },
+  /* 0503 */ { UD_Imovsx, 70 },
+  /* 0504 */ { UD_Imovsx, 71 },
+  /* 0505 */ { UD_Ixadd, 74 },
+  /* 0506 */ { UD_Ixadd, 2 },
+  /* 0507 */ { UD_Icmpps, 40 },
+  /* 0508 */ { UD_Icmpsd, 40 },
+  /* 0509 */ { UD_Icmpss, 40 },
+  /* 0510 */ { UD_Icmppd, 40 },
+  /* 0511 */ { UD_Imovnti, 75 },
+  /* 0512 */ { UD_Ipinsrw, 76 },
+  /* 0513 */ { UD_Ipinsrw, 77 },
+  /* 0514 */ { UD_Ipextrw, 78 },
+  /* 0515 */ { UD_Ipextrw, 79 },
+  /* 0516 */ { UD_Ishufps, 40 },
+  /* 0517 */ { UD_Ishufpd, 40 },
+  /* 0518 */ { UD_Icmpxchg8b, 11 },
+  /* 0519 */ { UD_Icmpxchg8b, 11 },
+  /* 0520 */ { UD_Icmpxchg16b, 11 },
+  /* 0521 */ { UD_Ivmptrld, 80 },
+  /* 0522 */ { UD_Ivmxon, 80 },
+  /* 0523 */ { UD_Ivmclear, 80 },
+  /* 0524 */ { UD_Ivmptrst, 80 },
+  /* 0525 */ { UD_Ibswap, 81 },
+  /* 0526 */ { UD_Ibswap, 82 },
+  /* 0527 */ { UD_Ibswap, 83 },
+  /* 0528 */ { UD_Ibswap, 84 },
+  /* 0529 */ { UD_Ibswap, 85 },
+  /* 0530 */ { UD_Ibswap, 86 },
+  /* 0531 */ { UD_Ibswap, 87 },
+  /* 0532 */ { UD_Ibswap, 88 },
+  /* 0533 */ { UD_Iaddsubps, 15 },
+  /* 0534 */ { UD_Iaddsubpd, 15 },
+  /* 0535 */ { UD_Ipsrlw, 14 },
+  /* 0536 */ { UD_Ipsrlw, 15 },
+  /* 0537 */ { UD_Ipsrld, 14 },
+  /* 0538 */ { UD_Ipsrld, 15 },
+  /* 0539 */ { UD_Ipsrlq, 14 },
+  /* 0540 */ { UD_Ipsrlq, 15 },
+  /* 0541 */ { UD_Ipaddq, 14 },
+  /* 0542 */ { UD_Ipaddq, 15 },
+  /* 0543 */ { UD_Ipmullw, 14 },
+  /* 0544 */ { UD_Ipmullw, 15 },
+  /* 0545 */ { UD_Imovdq2q, 89 },
+  /* 0546 */ { UD_Imovq2dq, 90 },
+  /* 0547 */ { UD_Imovq, 17 },
+  /* 0548 */ { UD_Ipmovmskb, 91 },
+  /* 0549 */ { UD_Ipmovmskb, 92 },
+  /* 0550 */ { UD_Ipsubusb, 14 },
+  /* 0551 */ { UD_Ipsubusb, 15 },
+  /* 0552 */ { UD_Ipsubusw, 14 },
+  /* 0553 */ { UD_Ipsubusw, 15 },
+  /* 0554 */ { UD_Ipminub, 14 },
+  /* 0555 */ { UD_Ipminub, 15 },
+  /* 0556 */ { UD_Ipand, 14 },
+  /* 0557 */ { UD_Ipand, 15 },
+  /* 0558 */ { UD_Ipaddusb, 14 },
+  /* 0559 */ { UD_Ipaddusb, 15 },
+  /* 0560 */ { UD_Ipaddusw, 14 },
+  /* 0561 */ { UD_Ipaddusw, 15 },
+  /* 0562 */ { UD_Ipmaxub, 14 },
+  /* 0563 */ { UD_Ipmaxub, 15 },
+  /* 0564 */ { UD_Ipandn, 14 },
+  /* 0565 */ { UD_Ipandn, 15 },
+  /* 0566 */ { UD_Ipavgb, 14 },
+  /* 0567 */ { UD_Ipavgb, 15 },
+  /* 0568 */ { UD_Ipsraw, 14 },
+  /* 0569 */ { UD_Ipsraw, 15 },
+  /* 0570 */ { UD_Ipsrad, 14 },
+  /* 0571 */ { UD_Ipsrad, 15 },
+  /* 0572 */ { UD_Ipavgw, 14 },
+  /* 0573 */ { UD_Ipavgw, 15 },
+  /* 0574 */ { UD_Ipmulhuw, 14 },
+  /* 0575 */ { UD_Ipmulhuw, 15 },
+  /* 0576 */ { UD_Ipmulhw, 14 },
+  /* 0577 */ { UD_Ipmulhw, 15 },
+  /* 0578 */ { UD_Icvtpd2dq, 15 },
+  /* 0579 */ { UD_Icvtdq2pd, 15 },
+  /* 0580 */ { UD_Icvttpd2dq, 15 },
+  /* 0581 */ { UD_Imovntq, 93 },
+  /* 0582 */ { UD_Imovntdq, 21 },
+  /* 0583 */ { UD_Ipsubsb, 14 },
+  /* 0584 */ { UD_Ipsubsb, 15 },
+  /* 0585 */ { UD_Ipsubsw, 14 },
+  /* 0586 */ { UD_Ipsubsw, 15 },
+  /* 0587 */ { UD_Ipminsw, 14 },
+  /* 0588 */ { UD_Ipminsw, 15 },
+  /* 0589 */ { UD_Ipor, 14 },
+  /* 0590 */ { UD_Ipor, 15 },
+  /* 0591 */ { UD_Ipaddsb, 14 },
+  /* 0592 */ { UD_Ipaddsb, 15 },
+  /* 0593 */ { UD_Ipaddsw, 14 },
+  /* 0594 */ { UD_Ipaddsw, 15 },
+  /* 0595 */ { UD_Ipmaxsw, 14 },
+  /* 0596 */ { UD_Ipmaxsw, 15 },
+  /* 0597 */ { UD_Ipxor, 14 },
+  /* 0598 */ { UD_Ipxor, 15 },
+  /* 0599 */ { UD_Ilddqu, 19 },
+  /* 0600 */ { UD_Ipsllw, 14 },
+  /* 0601 */ { UD_Ipsllw, 15 },
+  /* 0602 */ { UD_Ipslld, 14 },
+  /* 0603 */ { UD_Ipslld, 15 },
+  /* 0604 */ { UD_Ipsllq, 14 },
+  /* 0605 */ { UD_Ipsllq, 15 },
+  /* 0606 */ { UD_Ipmuludq, 14 },
+  /* 0607 */ { UD_Ipmuludq, 15 },
+  /* 0608 */ { UD_Ipmaddwd, 14 },
+  /* 0609 */ { UD_Ipmaddwd, 15 },
+  /* 0610 */ { UD_Ipsadbw, 14 },
+  /* 0611 */ { UD_Ipsadbw, 15 },
+  /* 0612 */ { UD_Imaskmovq, 94 },
+  /* 0613 */ { UD_Imaskmovdqu, 20 },
+  /* 0614 */ { UD_Ipsubb, 14 },
+  /* 0615 */ { UD_Ipsubb, 15 },
+  /* 0616 */ { UD_Ipsubw, 14 },
+  /* 0617 */ { UD_Ipsubw, 15 },
+  /* 0618 */ { UD_Ipsubd, 14 },
+  /* 0619 */ { UD_Ipsubd, 15 },
+  /* 0620 */ { UD_Ipsubq, 14 },
+  /* 0621 */ { UD_Ipsubq, 15 },
+  /* 0622 */ { UD_Ipaddb, 14 },
+  /* 0623 */ { UD_Ipaddb, 15 },
+  /* 0624 */ { UD_Ipaddw, 14 },
+  /* 0625 */ { UD_Ipaddw, 15 },
+  /* 0626 */ { UD_Ipaddd, 14 },
+  /* 0627 */ { UD_Ipaddd, 15 },
+  /* 0628 */ { UD_Iadc, 1 },
+  /* 0629 */ { UD_Iadc, 2 },
+  /* 0630 */ { UD_Iadc, 3 },
+  /* 0631 */ { UD_Iadc, 4 },
+  /* 0632 */ { UD_Iadc, 5 },
+  /* 0633 */ { UD_Iadc, 6 },
+  /* 0634 */ { UD_Ipush, 95 },
+  /* 0635 */ { UD_Ipop, 95 },
+  /* 0636 */ { UD_Isbb, 1 },
+  /* 0637 */ { UD_Isbb, 2 },
+  /* 0638 */ { UD_Isbb, 3 },
+  /* 0639 */ { UD_Isbb, 4 },
+  /* 0640 */ { UD_Isbb, 5 },
+  /* 0641 */ { UD_Isbb, 6 },
+  /* 0642 */ { UD_Ipush, 96 },
+  /* 0643 */ { UD_Ipop, 96 },
+  /* 0644 */ { UD_Iand, 1 },
+  /* 0645 */ { UD_Iand, 2 },
+  /* 0646 */ { UD_Iand, 3 },
+  /* 0647 */ { UD_Iand, 4 },
+  /* 0648 */ { UD_Iand, 5 },
+  /* 0649 */ { UD_Iand, 6 },
+  /* 0650 */ { UD_Idaa, 97 },
+  /* 0651 */ { UD_Isub, 1 },
+  /* 0652 */ { UD_Isub, 2 },
+  /* 0653 */ { UD_Isub, 3 },
+  /* 0654 */ { UD_Isub, 4 },
+  /* 0655 */ { UD_Isub, 5 },
+  /* 0656 */ { UD_Isub, 6 },
+  /* 0657 */ { UD_Idas, 97 },
+  /* 0658 */ { UD_Ixor, 1 },
+  /* 0659 */ { UD_Ixor, 2 },
+  /* 0660 */ { UD_Ixor, 3 },
+  /* 0661 */ { UD_Ixor, 4 },
+  /* 0662 */ { UD_Ixor, 5 },
+  /* 0663 */ { UD_Ixor, 6 },
+  /* 0664 */ { UD_Iaaa, 0 },
+  /* 0665 */ { UD_Icmp, 1 },
+  /* 0666 */ { UD_Icmp, 2 },
+  /* 0667 */ { UD_Icmp, 3 },
+  /* 0668 */ { UD_Icmp, 4 },
+  /* 0669 */ { UD_Icmp, 5 },
+  /* 0670 */ { UD_Icmp, 6 },
+  /* 0671 */ { UD_Iaas, 0 },
+  /* 0672 */ { UD_Iinc, 98 },
+  /* 0673 */ { UD_Iinc, 99 },
+  /* 0674 */ { UD_Iinc, 100 },
+  /* 0675 */ { UD_Iinc, 101 },
+  /* 0676 */ { UD_Iinc, 102 },
+  /* 0677 */ { UD_Iinc, 103 },
+  /* 0678 */ { UD_Iinc, 104 },
+  /* 0679 */ { UD_Iinc, 105 },
+  /* 0680 */ { UD_Idec, 98 },
+  /* 0681 */ { UD_Idec, 99 },
+  /* 0682 */ { UD_Idec, 100 },
+  /* 0683 */ { UD_Idec, 101 },
+  /* 0684 */ { UD_Idec, 102 },
+  /* 0685 */ { UD_Idec, 103 },
+  /* 0686 */ { UD_Idec, 104 },
+  /* 0687 */ { UD_Idec, 105 },
+  /* 0688 */ { UD_Ipush, 106 },
+  /* 0689 */ { UD_Ipush, 107 },
+  /* 0690 */ { UD_Ipush, 108 },
+  /* 0691 */ { UD_Ipush, 109 },
+  /* 0692 */ { UD_Ipush, 110 },
+  /* 0693 */ { UD_Ipush, 111 },
+  /* 0694 */ { UD_Ipush, 112 },
+  /* 0695 */ { UD_Ipush, 113 },
+  /* 0696 */ { UD_Ipop, 106 },
+  /* 0697 */ { UD_Ipop, 107 },
+  /* 0698 */ { UD_Ipop, 108 },
+  /* 0699 */ { UD_Ipop, 109 },
+  /* 0700 */ { UD_Ipop, 110 },
+  /* 0701 */ { UD_Ipop, 111 },
+  /* 0702 */ { UD_Ipop, 112 },
+  /* 0703 */ { UD_Ipop, 113 },
+  /* 0704 */ { UD_Ipusha, 114 },
+  /* 0705 */ { UD_Ipushad, 114 },
+  /* 0706 */ { UD_Ipopa, 114 },
+  /* 0707 */ { UD_Ipopad, 114 },
+  /* 0708 */ { UD_Ibound, 115 },
+  /* 0709 */ { UD_Iarpl, 116 },
+  /* 0710 */ { UD_Imovsxd, 117 },
+  /* 0711 */ { UD_Ipush, 118 },
+  /* 0712 */ { UD_Iimul, 119 },
+  /* 0713 */ { UD_Ipush, 120 },
+  /* 0714 */ { UD_Iimul, 121 },
+  /* 0715 */ { UD_Iinsb, 122 },
+  /* 0716 */ { UD_Iinsw, 123 },
+  /* 0717 */ { UD_Iinsd, 123 },
+  /* 0718 */ { UD_Ioutsb, 122 },
+  /* 0719 */ { UD_Ioutsw, 123 },
+  /* 0720 */ { UD_Ioutsd, 123 },
+  /* 0721 */ { UD_Ijo, 124 },
+  /* 0722 */ { UD_Ijno, 124 },
+  /* 0723 */ { UD_Ijb, 124 },
+  /* 0724 */ { UD_Ijae, 124 },
+  /* 0725 */ { UD_Ijz, 124 },
+  /* 0726 */ { UD_Ijnz, 124 },
+  /* 0727 */ { UD_Ijbe, 124 },
+  /* 0728 */ { UD_Ija, 124 },
+  /* 0729 */ { UD_Ijs, 124 },
+  /* 0730 */ { UD_Ijns, 124 },
+  /* 0731 */ { UD_Ijp, 124 },
+  /* 0732 */ { UD_Ijnp, 124 },
+  /* 0733 */ { UD_Ijl, 124 },
+  /* 0734 */ { UD_Ijge, 124 },
+  /* 0735 */ { UD_Ijle, 124 },
+  /* 0736 */ { UD_Ijg, 124 },
+  /* 0737 */ { UD_Iadd, 125 },
+  /* 0738 */ { UD_Ior, 125 },
+  /* 0739 */ { UD_Iadc, 125 },
+  /* 0740 */ { UD_Isbb, 125 },
+  /* 0741 */ { UD_Iand, 126 },
+  /* 0742 */ { UD_Isub, 125 },
+  /* 0743 */ { UD_Ixor, 125 },
+  /* 0744 */ { UD_Icmp, 125 },
+  /* 0745 */ { UD_Iadd, 127 },
+  /* 0746 */ { UD_Ior, 127 },
+  /* 0747 */ { UD_Iadc, 127 },
+  /* 0748 */ { UD_Isbb, 127 },
+  /* 0749 */ { UD_Iand, 127 },
+  /* 0750 */ { UD_Isub, 127 },
+  /* 0751 */ { UD_Ixor, 127 },
+  /* 0752 */ { UD_Icmp, 127 },
+  /* 0753 */ { UD_Iadd, 128 },
+  /* 0754 */ { UD_Ior, 125 },
+  /* 0755 */ { UD_Iadc, 128 },
+  /* 0756 */ { UD_Isbb, 128 },
+  /* 0757 */ { UD_Iand, 128 },
+  /* 0758 */ { UD_Isub, 128 },
+  /* 0759 */ { UD_Ixor, 128 },
+  /* 0760 */ { UD_Icmp, 128 },
+  /* 0761 */ { UD_Iadd, 129 },
+  /* 0762 */ { UD_Ior, 129 },
+  /* 0763 */ { UD_Iadc, 129 },
+  /* 0764 */ { UD_Isbb, 129 },
+  /* 0765 */ { UD_Iand, 129 },
+  /* 0766 */ { UD_Isub, 129 },
+  /* 0767 */ { UD_Ixor, 129 },
+  /* 0768 */ { UD_Icmp, 129 },
+  /* 0769 */ { UD_Itest, 1 },
+  /* 0770 */ { UD_Itest, 2 },
+  /* 0771 */ { UD_Ixchg, 1 },
+  /* 0772 */ { UD_Ixchg, 2 },
+  /* 0773 */ { UD_Imov, 1 },
+  /* 0774 */ { UD_Imov, 2 },
+  /* 0775 */ { UD_Imov, 3 },
+  /* 0776 */ { UD_Imov, 4 },
+  /* 0777 */ { UD_Imov, 130 },
+  /* 0778 */ { UD_Ilea, 68 },
+  /* 0779 */ { UD_Imov, 131 },
+  /* 0780 */ { UD_Ipop, 132 },
+  /* 0781 */ { UD_Ixchg, 133 },
+  /* 0782 */ { UD_Ixchg, 134 },
+  /* 0783 */ { UD_Ixchg, 135 },
+  /* 0784 */ { UD_Ixchg, 136 },
+  /* 0785 */ { UD_Ixchg, 137 },
+  /* 0786 */ { UD_Ixchg, 138 },
+  /* 0787 */ { UD_Ixchg, 139 },
+  /* 0788 */ { UD_Ixchg, 140 },
+  /* 0789 */ { UD_Icbw, 141 },
+  /* 0790 */ { UD_Icwde, 141 },
+  /* 0791 */ { UD_Icdqe, 141 },
+  /* 0792 */ { UD_Icwd, 141 },
+  /* 0793 */ { UD_Icdq, 141 },
+  /* 0794 */ { UD_Icqo, 141 },
+  /* 0795 */ { UD_Icall, 142 },
+  /* 0796 */ { UD_Iwait, 0 },
+  /* 0797 */ { UD_Ipushfw, 143 },
+  /* 0798 */ { UD_Ipushfw, 144 },
+  /* 0799 */ { UD_Ipushfd, 143 },
+  /* 0800 */ { UD_Ipushfq, 144 },
+  /* 0801 */ { UD_Ipushfq, 144 },
+  /* 0802 */ { UD_Ipopfw, 143 },
+  /* 0803 */ { UD_Ipopfd, 143 },
+  /* 0804 */ { UD_Ipopfq, 145 },
+  /* 0805 */ { UD_Ipopfq, 145 },
+  /* 0806 */ { UD_Isahf, 0 },
+  /* 0807 */ { UD_Ilahf, 0 },
+  /* 0808 */ { UD_Imov, 146 },
+  /* 0809 */ { UD_Imov, 147 },
+  /* 0810 */ { UD_Imov, 148 },
+  /* 0811 */ { UD_Imov, 149 },
+  /* 0812 */ { UD_Imovsb, 122 },
+  /* 0813 */ { UD_Imovsw, 150 },
+  /* 0814 */ { UD_Imovsd, 150 },
+  /* 0815 */ { UD_Imovsq, 150 },
+  /* 0816 */ { UD_Icmpsb, 151 },
+  /* 0817 */ { UD_Icmpsw, 152 },
+  /* 0818 */ { UD_Icmpsd, 152 },
+  /* 0819 */ { UD_Icmpsq, 152 },
+  /* 0820 */ { UD_Itest, 5 },
+  /* 0821 */ { UD_Itest, 6 },
+  /* 0822 */ { UD_Istosb, 122 },
+  /* 0823 */ { UD_Istosw, 150 },
+  /* 0824 */ { UD_Istosd, 150 },
+  /* 0825 */ { UD_Istosq, 150 },
+  /* 0826 */ { UD_Ilodsb, 122 },
+  /* 0827 */ { UD_Ilodsw, 150 },
+  /* 0828 */ { UD_Ilodsd, 150 },
+  /* 0829 */ { UD_Ilodsq, 150 },
+  /* 0830 */ { UD_Iscasb, 153 },
+  /* 0831 */ { UD_Iscasw, 154 },
+  /* 0832 */ { UD_Iscasd, 154 },
+  /* 0833 */ { UD_Iscasq, 154 },
+  /* 0834 */ { UD_Imov, 155 },
+  /* 0835 */ { UD_Imov, 156 },
+  /* 0836 */ { UD_Imov, 157 },
+  /* 0837 */ { UD_Imov, 158 },
+  /* 0838 */ { UD_Imov, 159 },
+  /* 0839 */ { UD_Imov, 160 },
+  /* 0840 */ { UD_Imov, 161 },
+  /* 0841 */ { UD_Imov, 162 },
+  /* 0842 */ { UD_Imov, 163 },
+  /* 0843 */ { UD_Imov, 164 },
+  /* 0844 */ { UD_Imov, 165 },
+  /* 0845 */ { UD_Imov, 166 },
+  /* 0846 */ { UD_Imov, 167 },
+  /* 0847 */ { UD_Imov, 168 },
+  /* 0848 */ { UD_Imov, 169 },
+  /* 0849 */ { UD_Imov, 170 },
+  /* 0850 */ { UD_Irol, 126 },
+  /* 0851 */ { UD_Iror, 126 },
+  /* 0852 */ { UD_Ircl, 126 },
+  /* 0853 */ { UD_Ircr, 126 },
+  /* 0854 */ { UD_Ishl, 126 },
+  /* 0855 */ { UD_Ishr, 126 },
+  /* 0856 */ { UD_Ishl, 126 },
+  /* 0857 */ { UD_Isar, 126 },
+  /* 0858 */ { UD_Irol, 73 },
+  /* 0859 */ { UD_Iror, 73 },
+  /* 0860 */ { UD_Ircl, 73 },
+  /* 0861 */ { UD_Ircr, 73 },
+  /* 0862 */ { UD_Ishl, 73 },
+  /* 0863 */ { UD_Ishr, 73 },
+  /* 0864 */ { UD_Ishl, 73 },
+  /* 0865 */ { UD_Isar, 73 },
+  /* 0866 */ { UD_Iret, 171 },
+  /* 0867 */ { UD_Iret, 0 },
+  /* 0868 */ { UD_Iles, 115 },
+  /* 0869 */ { UD_Ilds, 115 },
+  /* 0870 */ { UD_Imov, 126 },
+  /* 0871 */ { UD_Imov, 127 },
+  /* 0872 */ { UD_Ienter, 172 },
+  /* 0873 */ { UD_Ileave, 0 },
+  /* 0874 */ { UD_Iretf, 171 },
+  /* 0875 */ { UD_Iretf, 0 },
+  /* 0876 */ { UD_Iint3, 0 },
+  /* 0877 */ { UD_Iint, 173 },
+  /* 0878 */ { UD_Iinto, 97 },
+  /* 0879 */ { UD_Iiretw, 141 },
+  /* 0880 */ { UD_Iiretd, 141 },
+  /* 0881 */ { UD_Iiretq, 141 },
+  /* 0882 */ { UD_Irol, 174 },
+  /* 0883 */ { UD_Iror, 174 },
+  /* 0884 */ { UD_Ircl, 174 },
+  /* 0885 */ { UD_Ircr, 174 },
+  /* 0886 */ { UD_Ishl, 174 },
+  /* 0887 */ { UD_Ishr, 174 },
+  /* 0888 */ { UD_Ishl, 174 },
+  /* 0889 */ { UD_Isar, 174 },
+  /* 0890 */ { UD_Irol, 175 },
+  /* 0891 */ { UD_Iror, 175 },
+  /* 0892 */ { UD_Ircl, 175 },
+  /* 0893 */ { UD_Ircr, 175 },
+  /* 0894 */ { UD_Ishl, 175 },
+  /* 0895 */ { UD_Ishr, 175 },
+  /* 0896 */ { UD_Ishl, 175 },
+  /* 0897 */ { UD_Isar, 175 },
+  /* 0898 */ { UD_Irol, 176 },
+  /* 0899 */ { UD_Iror, 176 },
+  /* 0900 */ { UD_Ircl, 176 },
+  /* 0901 */ { UD_Ircr, 176 },
+  /* 0902 */ { UD_Ishl, 177 },
+  /* 0903 */ { UD_Ishr, 176 },
+  /* 0904 */ { UD_Ishl, 176 },
+  /* 0905 */ { UD_Isar, 176 },
+  /* 0906 */ { UD_Irol, 178 },
+  /* 0907 */ { UD_Iror, 178 },
+  /* 0908 */ { UD_Ircl, 178 },
+  /* 0909 */ { UD_Ircr, 178 },
+  /* 0910 */ { UD_Ishl, 178 },
+  /* 0911 */ { UD_Ishr, 178 },
+  /* 0912 */ { UD_Ishl, 178 },
+  /* 0913 */ { UD_Isar, 178 },
+  /* 0914 */ { UD_Iaam, 173 },
+  /* 0915 */ { UD_Iaad, 173 },
+  /* 0916 */ { UD_Isalc, 97 },
+  /* 0917 */ { UD_Ixlatb, 179 },
+  /* 0918 */ { UD_Ifadd, 180 },
+  /* 0919 */ { UD_Ifmul, 180 },
+  /* 0920 */ { UD_Ifcom, 180 },
+  /* 0921 */ { UD_Ifcomp, 180 },
+  /* 0922 */ { UD_Ifsub, 180 },
+  /* 0923 */ { UD_Ifsubr, 180 },
+  /* 0924 */ { UD_Ifdiv, 180 },
+  /* 0925 */ { UD_Ifdivr, 180 },
+  /* 0926 */ { UD_Ifadd, 181 },
+  /* 0927 */ { UD_Ifadd, 182 },
+  /* 0928 */ { UD_Ifadd, 183 },
+  /* 0929 */ { UD_Ifadd, 184 },
+  /* 0930 */ { UD_Ifadd, 185 },
+  /* 0931 */ { UD_Ifadd, 186 },
+  /* 0932 */ { UD_Ifadd, 187 },
+  /* 0933 */ { UD_Ifadd, 188 },
+  /* 0934 */ { UD_Ifmul, 181 },
+  /* 0935 */ { UD_Ifmul, 182 },
+  /* 0936 */ { UD_Ifmul, 183 },
+  /* 0937 */ { UD_Ifmul, 184 },
+  /* 0938 */ { UD_Ifmul, 185 },
+  /* 0939 */ { UD_Ifmul, 186 },
+  /* 0940 */ { UD_Ifmul, 187 },
+  /* 0941 */ { UD_Ifmul, 188 },
+  /* 0942 */ { UD_Ifcom, 181 },
+  /* 0943 */ { UD_Ifcom, 182 },
+  /* 0944 */ { UD_Ifcom, 183 },
+  /* 0945 */ { UD_Ifcom, 184 },
+  /* 0946 */ { UD_Ifcom, 185 },
+  /* 0947 */ { UD_Ifcom, 186 },
+  /* 0948 */ { UD_Ifcom, 187 },
+  /* 0949 */ { UD_Ifcom, 188 },
+  /* 0950 */ { UD_Ifcomp, 181 },
+  /* 0951 */ { UD_Ifcomp, 182 },
+  /* 0952 */ { UD_Ifcomp, 183 },
+  /* 0953 */ { UD_Ifcomp, 184 },
+  /* 0954 */ { UD_Ifcomp, 185 },
+  /* 0955 */ { UD_Ifcomp, 186 },
+  /* 0956 */ { UD_Ifcomp, 187 },
+  /* 0957 */ { UD_Ifcomp, 188 },
+  /* 0958 */ { UD_Ifsub, 181 },
+  /* 0959 */ { UD_Ifsub, 182 },
+  /* 0960 */ { UD_Ifsub, 183 },
+  /* 0961 */ { UD_Ifsub, 184 },
+  /* 0962 */ { UD_Ifsub, 185 },
+  /* 0963 */ { UD_Ifsub, 186 },
+  /* 0964 */ { UD_Ifsub, 187 },
+  /* 0965 */ { UD_Ifsub, 188 },
+  /* 0966 */ { UD_Ifsubr, 181 },
+  /* 0967 */ { UD_Ifsubr, 182 },
+  /* 0968 */ { UD_Ifsubr, 183 },
+  /* 0969 */ { UD_Ifsubr, 184 },
+  /* 0970 */ { UD_Ifsubr, 185 },
+  /* 0971 */ { UD_Ifsubr, 186 },
+  /* 0972 */ { UD_Ifsubr, 187 },
+  /* 0973 */ { UD_Ifsubr, 188 },
+  /* 0974 */ { UD_Ifdiv, 181 },
+  /* 0975 */ { UD_Ifdiv, 182 },
+  /* 0976 */ { UD_Ifdiv, 183 },
+  /* 0977 */ { UD_Ifdiv, 184 },
+  /* 0978 */ { UD_Ifdiv, 185 },
+  /* 0979 */ { UD_Ifdiv, 186 },
+  /* 0980 */ { UD_Ifdiv, 187 },
+  /* 0981 */ { UD_Ifdiv, 188 },
+  /* 0982 */ { UD_Ifdivr, 181 },
+  /* 0983 */ { UD_Ifdivr, 182 },
+  /* 0984 */ { UD_Ifdivr, 183 },
+  /* 0985 */ { UD_Ifdivr, 184 },
+  /* 0986 */ { UD_Ifdivr, 185 },
+  /* 0987 */ { UD_Ifdivr, 186 },
+  /* 0988 */ { UD_Ifdivr, 187 },
+  /* 0989 */ { UD_Ifdivr, 188 },
+  /* 0990 */ { UD_Ifld, 180 },
+  /* 0991 */ { UD_Ifst, 180 },
+  /* 0992 */ { UD_Ifstp, 180 },
+  /* 0993 */ { UD_Ifldenv, 11 },
+  /* 0994 */ { UD_Ifldcw, 189 },
+  /* 0995 */ { UD_Ifnstenv, 11 },
+  /* 0996 */ { UD_Ifnstcw, 189 },
+  /* 0997 */ { UD_Ifld, 190 },
+  /* 0998 */ { UD_Ifld, 191 },
+  /* 0999 */ { UD_Ifld, 192 },
+  /* 1000 */ { UD_Ifld, 193 },
+  /* 1001 */ { UD_Ifld, 194 },
+  /* 1002 */ { UD_Ifld, 195 },
+  /* 1003 */ { UD_Ifld, 196 },
+  /* 1004 */ { UD_Ifld, 197 },
+  /* 1005 */ { UD_Ifxch, 181 },
+  /* 1006 */ { UD_Ifxch, 182 },
+  /* 1007 */ { UD_Ifxch, 183 },
+  /* 1008 */ { UD_Ifxch, 184 },
+  /* 1009 */ { UD_Ifxch, 185 },
+  /* 1010 */ { UD_Ifxch, 186 },
+  /* 1011 */ { UD_Ifxch, 187 },
+  /* 1012 */ { UD_Ifxch, 188 },
+  /* 1013 */ { UD_Ifnop, 0 },
+  /* 1014 */ { UD_Ifstp1, 190 },
+  /* 1015 */ { UD_Ifstp1, 191 },
+  /* 1016 */ { UD_Ifstp1, 192 },
+  /* 1017 */ { UD_Ifstp1, 193 },
+  /* 1018 */ { UD_Ifstp1, 194 },
+  /* 1019 */ { UD_Ifstp1, 195 },
+  /* 1020 */ { UD_Ifstp1, 196 },
+  /* 1021 */ { UD_Ifstp1, 197 },
+  /* 1022 */ { UD_Ifchs, 0 },
+  /* 1023 */ { UD_Ifabs, 0 },
+  /* 1024 */ { UD_Iftst, 0 },
+  /* 1025 */ { UD_Ifxam, 0 },
+  /* 1026 */ { UD_Ifld1, 0 },
+  /* 1027 */ { UD_Ifldl2t, 0 },
+  /* 1028 */ { UD_Ifldl2e, 0 },
+  /* 1029 */ { UD_Ifldpi, 0 },
+  /* 1030 */ { UD_Ifldlg2, 0 },
+  /* 1031 */ { UD_Ifldln2, 0 },
+  /* 1032 */ { UD_Ifldz, 0 },
+  /* 1033 */ { UD_If2xm1, 0 },
+  /* 1034 */ { UD_Ifyl2x, 0 },
+  /* 1035 */ { UD_Ifptan, 0 },
+  /* 1036 */ { UD_Ifpatan, 0 },
+  /* 1037 */ { UD_Ifxtract, 0 },
+  /* 1038 */ { UD_Ifprem1, 0 },
+  /* 1039 */ { UD_Ifdecstp, 0 },
+  /* 1040 */ { UD_Ifincstp, 0 },
+  /* 1041 */ { UD_Ifprem, 0 },
+  /* 1042 */ { UD_Ifyl2xp1, 0 },
+  /* 1043 */ { UD_Ifsqrt, 0 },
+  /* 1044 */ { UD_Ifsincos, 0 },
+  /* 1045 */ { UD_Ifrndint, 0 },
+  /* 1046 */ { UD_Ifscale, 0 },
+  /* 1047 */ { UD_Ifsin, 0 },
+  /* 1048 */ { UD_Ifcos, 0 },
+  /* 1049 */ { UD_Ifiadd, 180 },
+  /* 1050 */ { UD_Ifimul, 180 },
+  /* 1051 */ { UD_Ificom, 180 },
+  /* 1052 */ { UD_Ificomp, 180 },
+  /* 1053 */ { UD_Ifisub, 180 },
+  /* 1054 */ { UD_Ifisubr, 180 },
+  /* 1055 */ { UD_Ifidiv, 180 },
+  /* 1056 */ { UD_Ifidivr, 180 },
+  /* 1057 */ { UD_Ifcmovb, 181 },
+  /* 1058 */ { UD_Ifcmovb, 182 },
+  /* 1059 */ { UD_Ifcmovb, 183 },
+  /* 1060 */ { UD_Ifcmovb, 184 },
+  /* 1061 */ { UD_Ifcmovb, 185 },
+  /* 1062 */ { UD_Ifcmovb, 186 },
+  /* 1063 */ { UD_Ifcmovb, 187 },
+  /* 1064 */ { UD_Ifcmovb, 188 },
+  /* 1065 */ { UD_Ifcmove, 181 },
+  /* 1066 */ { UD_Ifcmove, 182 },
+  /* 1067 */ { UD_Ifcmove, 183 },
+  /* 1068 */ { UD_Ifcmove, 184 },
+  /* 1069 */ { UD_Ifcmove, 185 },
+  /* 1070 */ { UD_Ifcmove, 186 },
+  /* 1071 */ { UD_Ifcmove, 187 },
+  /* 1072 */ { UD_Ifcmove, 188 },
+  /* 1073 */ { UD_Ifcmovbe, 181 },
+  /* 1074 */ { UD_Ifcmovbe, 182 },
+  /* 1075 */ { UD_Ifcmovbe, 183 },
+  /* 1076 */ { UD_Ifcmovbe, 184 },
+  /* 1077 */ { UD_Ifcmovbe, 185 },
+  /* 1078 */ { UD_Ifcmovbe, 186 },
+  /* 1079 */ { UD_Ifcmovbe, 187 },
+  /* 1080 */ { UD_Ifcmovbe, 188 },
+  /* 1081 */ { UD_Ifcmovu, 181 },
+  /* 1082 */ { UD_Ifcmovu, 182 },
+  /* 1083 */ { UD_Ifcmovu, 183 },
+  /* 1084 */ { UD_Ifcmovu, 184 },
+  /* 1085 */ { UD_Ifcmovu, 185 },
+  /* 1086 */ { UD_Ifcmovu, 186 },
+  /* 1087 */ { UD_Ifcmovu, 187 },
+  /* 1088 */ { UD_Ifcmovu, 188 },
+  /* 1089 */ { UD_Ifucompp, 0 },
+  /* 1090 */ { UD_Ifild, 180 },
+  /* 1091 */ { UD_Ifisttp, 180 },
+  /* 1092 */ { UD_Ifist, 180 },
+  /* 1093 */ { UD_Ifistp, 180 },
+  /* 1094 */ { UD_Ifld, 198 },
+  /* 1095 */ { UD_Ifstp, 198 },
+  /* 1096 */ { UD_Ifcmovnb, 181 },
+  /* 1097 */ { UD_Ifcmovnb, 182 },
+  /* 1098 */ { UD_Ifcmovnb, 183 },
+  /* 1099 */ { UD_Ifcmovnb, 184 },
+  /* 1100 */ { UD_Ifcmovnb, 185 },
+  /* 1101 */ { UD_Ifcmovnb, 186 },
+  /* 1102 */ { UD_Ifcmovnb, 187 },
+  /* 1103 */ { UD_Ifcmovnb, 188 },
+  /* 1104 */ { UD_Ifcmovne, 181 },
+  /* 1105 */ { UD_Ifcmovne, 182 },
+  /* 1106 */ { UD_Ifcmovne, 183 },
+  /* 1107 */ { UD_Ifcmovne, 184 },
+  /* 1108 */ { UD_Ifcmovne, 185 },
+  /* 1109 */ { UD_Ifcmovne, 186 },
+  /* 1110 */ { UD_Ifcmovne, 187 },
+  /* 1111 */ { UD_Ifcmovne, 188 },
+  /* 1112 */ { UD_Ifcmovnbe, 181 },
+  /* 1113 */ { UD_Ifcmovnbe, 182 },
+  /* 1114 */ { UD_Ifcmovnbe, 183 },
+  /* 1115 */ { UD_Ifcmovnbe, 184 },
+  /* 1116 */ { UD_Ifcmovnbe, 185 },
+  /* 1117 */ { UD_Ifcmovnbe, 186 },
+  /* 1118 */ { UD_Ifcmovnbe, 187 },
+  /* 1119 */ { UD_Ifcmovnbe, 188 },
+  /* 1120 */ { UD_Ifcmovnu, 181 },
+  /* 1121 */ { UD_Ifcmovnu, 182 },
+  /* 1122 */ { UD_Ifcmovnu, 183 },
+  /* 1123 */ { UD_Ifcmovnu, 184 },
+  /* 1124 */ { UD_Ifcmovnu, 185 },
+  /* 1125 */ { UD_Ifcmovnu, 186 },
+  /* 1126 */ { UD_Ifcmovnu, 187 },
+  /* 1127 */ { UD_Ifcmovnu, 188 },
+  /* 1128 */ { UD_Ifclex, 0 },
+  /* 1129 */ { UD_Ifninit, 0 },
+  /* 1130 */ { UD_Ifucomi, 181 },
+  /* 1131 */ { UD_Ifucomi, 182 },
+  /* 1132 */ { UD_Ifucomi, 183 },
+  /* 1133 */ { UD_Ifucomi, 184 },
+  /* 1134 */ { UD_Ifucomi, 185 },
+  /* 1135 */ { UD_Ifucomi, 186 },
+  /* 1136 */ { UD_Ifucomi, 187 },
+  /* 1137 */ { UD_Ifucomi, 188 },
+  /* 1138 */ { UD_Ifcomi, 181 },
+  /* 1139 */ { UD_Ifcomi, 182 },
+  /* 1140 */ { UD_Ifcomi, 183 },
+  /* 1141 */ { UD_Ifcomi, 184 },
+  /* 1142 */ { UD_Ifcomi, 185 },
+  /* 1143 */ { UD_Ifcomi, 186 },
+  /* 1144 */ { UD_Ifcomi, 187 },
+  /* 1145 */ { UD_Ifcomi, 188 },
+  /* 1146 */ { UD_Ifadd, 80 },
+  /* 1147 */ { UD_Ifmul, 80 },
+  /* 1148 */ { UD_Ifcom, 80 },
+  /* 1149 */ { UD_Ifcomp, 80 },
+  /* 1150 */ { UD_Ifsub, 80 },
+  /* 1151 */ { UD_Ifsubr, 80 },
+  /* 1152 */ { UD_Ifdiv, 80 },
+  /* 1153 */ { UD_Ifdivr, 80 },
+  /* 1154 */ { UD_Ifadd, 181 },
+  /* 1155 */ { UD_Ifadd, 199 },
+  /* 1156 */ { UD_Ifadd, 200 },
+  /* 1157 */ { UD_Ifadd, 201 },
+  /* 1158 */ { UD_Ifadd, 202 },
+  /* 1159 */ { UD_Ifadd, 203 },
+  /* 1160 */ { UD_Ifadd, 204 },
+  /* 1161 */ { UD_Ifadd, 205 },
+  /* 1162 */ { UD_Ifmul, 181 },
+  /* 1163 */ { UD_Ifmul, 199 },
+  /* 1164 */ { UD_Ifmul, 200 },
+  /* 1165 */ { UD_Ifmul, 201 },
+  /* 1166 */ { UD_Ifmul, 202 },
+  /* 1167 */ { UD_Ifmul, 203 },
+  /* 1168 */ { UD_Ifmul, 204 },
+  /* 1169 */ { UD_Ifmul, 205 },
+  /* 1170 */ { UD_Ifcom2, 190 },
+  /* 1171 */ { UD_Ifcom2, 191 },
+  /* 1172 */ { UD_Ifcom2, 192 },
+  /* 1173 */ { UD_Ifcom2, 193 },
+  /* 1174 */ { UD_Ifcom2, 194 },
+  /* 1175 */ { UD_Ifcom2, 195 },
+  /* 1176 */ { UD_Ifcom2, 196 },
+  /* 1177 */ { UD_Ifcom2, 197 },
+  /* 1178 */ { UD_Ifcomp3, 190 },
+  /* 1179 */ { UD_Ifcomp3, 191 },
+  /* 1180 */ { UD_Ifcomp3, 192 },
+  /* 1181 */ { UD_Ifcomp3, 193 },
+  /* 1182 */ { UD_Ifcomp3, 194 },
+  /* 1183 */ { UD_Ifcomp3, 195 },
+  /* 1184 */ { UD_Ifcomp3, 196 },
+  /* 1185 */ { UD_Ifcomp3, 197 },
+  /* 1186 */ { UD_Ifsubr, 181 },
+  /* 1187 */ { UD_Ifsubr, 199 },
+  /* 1188 */ { UD_Ifsubr, 200 },
+  /* 1189 */ { UD_Ifsubr, 201 },
+  /* 1190 */ { UD_Ifsubr, 202 },
+  /* 1191 */ { UD_Ifsubr, 203 },
+  /* 1192 */ { UD_Ifsubr, 204 },
+  /* 1193 */ { UD_Ifsubr, 205 },
+  /* 1194 */ { UD_Ifsub, 181 },
+  /* 1195 */ { UD_Ifsub, 199 },
+  /* 1196 */ { UD_Ifsub, 200 },
+  /* 1197 */ { UD_Ifsub, 201 },
+  /* 1198 */ { UD_Ifsub, 202 },
+  /* 1199 */ { UD_Ifsub, 203 },
+  /* 1200 */ { UD_Ifsub, 204 },
+  /* 1201 */ { UD_Ifsub, 205 },
+  /* 1202 */ { UD_Ifdivr, 181 },
+  /* 1203 */ { UD_Ifdivr, 199 },
+  /* 1204 */ { UD_Ifdivr, 200 },
+  /* 1205 */ { UD_Ifdivr, 201 },
+  /* 1206 */ { UD_Ifdivr, 202 },
+  /* 1207 */ { UD_Ifdivr, 203 },
+  /* 1208 */ { UD_Ifdivr, 204 },
+  /* 1209 */ { UD_Ifdivr, 205 },
+  /* 1210 */ { UD_Ifdiv, 181 },
+  /* 1211 */ { UD_Ifdiv, 199 },
+  /* 1212 */ { UD_Ifdiv, 200 },
+  /* 1213 */ { UD_Ifdiv, 201 },
+  /* 1214 */ { UD_Ifdiv, 202 },
+  /* 1215 */ { UD_Ifdiv, 203 },
+  /* 1216 */ { UD_Ifdiv, 204 },
+  /* 1217 */ { UD_Ifdiv, 205 },
+  /* 1218 */ { UD_Ifld, 80 },
+  /* 1219 */ { UD_Ifisttp, 80 },
+  /* 1220 */ { UD_Ifst, 80 },
+  /* 1221 */ { UD_Ifstp, 80 },
+  /* 1222 */ { UD_Ifrstor, 11 },
+  /* 1223 */ { UD_Ifnsave, 11 },
+  /* 1224 */ { UD_Ifnstsw, 189 },
+  /* 1225 */ { UD_Iffree, 190 },
+  /* 1226 */ { UD_Iffree, 191 },
+  /* 1227 */ { UD_Iffree, 192 },
+  /* 1228 */ { UD_Iffree, 193 },
+  /* 1229 */ { UD_Iffree, 194 },
+  /* 1230 */ { UD_Iffree, 195 },
+  /* 1231 */ { UD_Iffree, 196 },
+  /* 1232 */ { UD_Iffree, 197 },
+  /* 1233 */ { UD_Ifxch4, 190 },
+  /* 1234 */ { UD_Ifxch4, 191 },
+  /* 1235 */ { UD_Ifxch4, 192 },
+  /* 1236 */ { UD_Ifxch4, 193 },
+  /* 1237 */ { UD_Ifxch4, 194 },
+  /* 1238 */ { UD_Ifxch4, 195 },
+  /* 1239 */ { UD_Ifxch4, 196 },
+  /* 1240 */ { UD_Ifxch4, 197 },
+  /* 1241 */ { UD_Ifst, 190 },
+  /* 1242 */ { UD_Ifst, 191 },
+  /* 1243 */ { UD_Ifst, 192 },
+  /* 1244 */ { UD_Ifst, 193 },
+  /* 1245 */ { UD_Ifst, 194 },
+  /* 1246 */ { UD_Ifst, 195 },
+  /* 1247 */ { UD_Ifst, 196 },
+  /* 1248 */ { UD_Ifst, 197 },
+  /* 1249 */ { UD_Ifstp, 190 },
+  /* 1250 */ { UD_Ifstp, 191 },
+  /* 1251 */ { UD_Ifstp, 192 },
+  /* 1252 */ { UD_Ifstp, 193 },
+  /* 1253 */ { UD_Ifstp, 194 },
+  /* 1254 */ { UD_Ifstp, 195 },
+  /* 1255 */ { UD_Ifstp, 196 },
+  /* 1256 */ { UD_Ifstp, 197 },
+  /* 1257 */ { UD_Ifucom, 190 },
+  /* 1258 */ { UD_Ifucom, 191 },
+  /* 1259 */ { UD_Ifucom, 192 },
+  /* 1260 */ { UD_Ifucom, 193 },
+  /* 1261 */ { UD_Ifucom, 194 },
+  /* 1262 */ { UD_Ifucom, 195 },
+  /* 1263 */ { UD_Ifucom, 196 },
+  /* 1264 */ { UD_Ifucom, 197 },
+  /* 1265 */ { UD_Ifucomp, 190 },
+  /* 1266 */ { UD_Ifucomp, 191 },
+  /* 1267 */ { UD_Ifucomp, 192 },
+  /* 1268 */ { UD_Ifucomp, 193 },
+  /* 1269 */ { UD_Ifucomp, 194 },
+  /* 1270 */ { UD_Ifucomp, 195 },
+  /* 1271 */ { UD_Ifucomp, 196 },
+  /* 1272 */ { UD_Ifucomp, 197 },
+  /* 1273 */ { UD_Ifiadd, 189 },
+  /* 1274 */ { UD_Ifimul, 189 },
+  /* 1275 */ { UD_Ificom, 189 },
+  /* 1276 */ { UD_Ificomp, 189 },
+  /* 1277 */ { UD_Ifisub, 189 },
+  /* 1278 */ { UD_Ifisubr, 189 },
+  /* 1279 */ { UD_Ifidiv, 189 },
+  /* 1280 */ { UD_Ifidivr, 189 },
+  /* 1281 */ { UD_Ifaddp, 181 },
+  /* 1282 */ { UD_Ifaddp, 199 },
+  /* 1283 */ { UD_Ifaddp, 200 },
+  /* 1284 */ { UD_Ifaddp, 201 },
+  /* 1285 */ { UD_Ifaddp, 202 },
+  /* 1286 */ { UD_Ifaddp, 203 },
+  /* 1287 */ { UD_Ifaddp, 204 },
+  /* 1288 */ { UD_Ifaddp, 205 },
+  /* 1289 */ { UD_Ifmulp, 181 },
+  /* 1290 */ { UD_Ifmulp, 199 },
+  /* 1291 */ { UD_Ifmulp, 200 },
+  /* 1292 */ { UD_Ifmulp, 201 },
+  /* 1293 */ { UD_Ifmulp, 202 },
+  /* 1294 */ { UD_Ifmulp, 203 },
+  /* 1295 */ { UD_Ifmulp, 204 },
+  /* 1296 */ { UD_Ifmulp, 205 },
+  /* 1297 */ { UD_Ifcomp5, 190 },
+  /* 1298 */ { UD_Ifcomp5, 191 },
+  /* 1299 */ { UD_Ifcomp5, 192 },
+  /* 1300 */ { UD_Ifcomp5, 193 },
+  /* 1301 */ { UD_Ifcomp5, 194 },
+  /* 1302 */ { UD_Ifcomp5, 195 },
+  /* 1303 */ { UD_Ifcomp5, 196 },
+  /* 1304 */ { UD_Ifcomp5, 197 },
+  /* 1305 */ { UD_Ifcompp, 0 },
+  /* 1306 */ { UD_Ifsubrp, 181 },
+  /* 1307 */ { UD_Ifsubrp, 199 },
+  /* 1308 */ { UD_Ifsubrp, 200 },
+  /* 1309 */ { UD_Ifsubrp, 201 },
+  /* 1310 */ { UD_Ifsubrp, 202 },
+  /* 1311 */ { UD_Ifsubrp, 203 },
+  /* 1312 */ { UD_Ifsubrp, 204 },
+  /* 1313 */ { UD_Ifsubrp, 205 },
+  /* 1314 */ { UD_Ifsubp, 181 },
+  /* 1315 */ { UD_Ifsubp, 199 },
+  /* 1316 */ { UD_Ifsubp, 200 },
+  /* 1317 */ { UD_Ifsubp, 201 },
+  /* 1318 */ { UD_Ifsubp, 202 },
+  /* 1319 */ { UD_Ifsubp, 203 },
+  /* 1320 */ { UD_Ifsubp, 204 },
+  /* 1321 */ { UD_Ifsubp, 205 },
+  /* 1322 */ { UD_Ifdivrp, 181 },
+  /* 1323 */ { UD_Ifdivrp, 199 },
+  /* 1324 */ { UD_Ifdivrp, 200 },
+  /* 1325 */ { UD_Ifdivrp, 201 },
+  /* 1326 */ { UD_Ifdivrp, 202 },
+  /* 1327 */ { UD_Ifdivrp, 203 },
+  /* 1328 */ { UD_Ifdivrp, 204 },
+  /* 1329 */ { UD_Ifdivrp, 205 },
+  /* 1330 */ { UD_Ifdivp, 181 },
+  /* 1331 */ { UD_Ifdivp, 199 },
+  /* 1332 */ { UD_Ifdivp, 200 },
+  /* 1333 */ { UD_Ifdivp, 201 },
+  /* 1334 */ { UD_Ifdivp, 202 },
+  /* 1335 */ { UD_Ifdivp, 203 },
+  /* 1336 */ { UD_Ifdivp, 204 },
+  /* 1337 */ { UD_Ifdivp, 205 },
+  /* 1338 */ { UD_Ifild, 189 },
+  /* 1339 */ { UD_Ifisttp, 189 },
+  /* 1340 */ { UD_Ifist, 189 },
+  /* 1341 */ { UD_Ifistp, 189 },
+  /* 1342 */ { UD_Ifbld, 198 },
+  /* 1343 */ { UD_Ifild, 80 },
+  /* 1344 */ { UD_Ifbstp, 198 },
+  /* 1345 */ { UD_Ifistp, 80 },
+  /* 1346 */ { UD_Iffreep, 190 },
+  /* 1347 */ { UD_Iffreep, 191 },
+  /* 1348 */ { UD_Iffreep, 192 },
+  /* 1349 */ { UD_Iffreep, 193 },
+  /* 1350 */ { UD_Iffreep, 194 },
+  /* 1351 */ { UD_Iffreep, 195 },
+  /* 1352 */ { UD_Iffreep, 196 },
+  /* 1353 */ { UD_Iffreep, 197 },
+  /* 1354 */ { UD_Ifxch7, 190 },
+  /* 1355 */ { UD_Ifxch7, 191 },
+  /* 1356 */ { UD_Ifxch7, 192 },
+  /* 1357 */ { UD_Ifxch7, 193 },
+  /* 1358 */ { UD_Ifxch7, 194 },
+  /* 1359 */ { UD_Ifxch7, 195 },
+  /* 1360 */ { UD_Ifxch7, 196 },
+  /* 1361 */ { UD_Ifxch7, 197 },
+  /* 1362 */ { UD_Ifstp8, 190 },
+  /* 1363 */ { UD_Ifstp8, 191 },
+  /* 1364 */ { UD_Ifstp8, 192 },
+  /* 1365 */ { UD_Ifstp8, 193 },
+  /* 1366 */ { UD_Ifstp8, 194 },
+  /* 1367 */ { UD_Ifstp8, 195 },
+  /* 1368 */ { UD_Ifstp8, 196 },
+  /* 1369 */ { UD_Ifstp8, 197 },
+  /* 1370 */ { UD_Ifstp9, 190 },
+  /* 1371 */ { UD_Ifstp9, 191 },
+  /* 1372 */ { UD_Ifstp9, 192 },
+  /* 1373 */ { UD_Ifstp9, 193 },
+  /* 1374 */ { UD_Ifstp9, 194 },
+  /* 1375 */ { UD_Ifstp9, 195 },
+  /* 1376 */ { UD_Ifstp9, 196 },
+  /* 1377 */ { UD_Ifstp9, 197 },
+  /* 1378 */ { UD_Ifnstsw, 206 },
+  /* 1379 */ { UD_Ifucomip, 181 },
+  /* 1380 */ { UD_Ifucomip, 182 },
+  /* 1381 */ { UD_Ifucomip, 183 },
+  /* 1382 */ { UD_Ifucomip, 184 },
+  /* 1383 */ { UD_Ifucomip, 185 },
+  /* 1384 */ { UD_Ifucomip, 186 },
+  /* 1385 */ { UD_Ifucomip, 187 },
+  /* 1386 */ { UD_Ifucomip, 188 },
+  /* 1387 */ { UD_Ifcomip, 181 },
+  /* 1388 */ { UD_Ifcomip, 182 },
+  /* 1389 */ { UD_Ifcomip, 183 },
+  /* 1390 */ { UD_Ifcomip, 184 },
+  /* 1391 */ { UD_Ifcomip, 185 },
+  /* 1392 */ { UD_Ifcomip, 186 },
+  /* 1393 */ { UD_Ifcomip, 187 },
+  /* 1394 */ { UD_Ifcomip, 188 },
+  /* 1395 */ { UD_Iloopne, 124 },
+  /* 1396 */ { UD_Iloope, 124 },
+  /* 1397 */ { UD_Iloop, 124 },
+  /* 1398 */ { UD_Ijcxz, 207 },
+  /* 1399 */ { UD_Ijecxz, 207 },
+  /* 1400 */ { UD_Ijrcxz, 207 },
+  /* 1401 */ { UD_Iin, 5 },
+  /* 1402 */ { UD_Iin, 208 },
+  /* 1403 */ { UD_Iout, 209 },
+  /* 1404 */ { UD_Iout, 210 },
+  /* 1405 */ { UD_Icall, 61 },
+  /* 1406 */ { UD_Ijmp, 61 },
+  /* 1407 */ { UD_Ijmp, 142 },
+  /* 1408 */ { UD_Ijmp, 211 },
+  /* 1409 */ { UD_Iin, 212 },
+  /* 1410 */ { UD_Iin, 213 },
+  /* 1411 */ { UD_Iout, 214 },
+  /* 1412 */ { UD_Iout, 215 },
+  /* 1413 */ { UD_Ilock, 0 },
+  /* 1414 */ { UD_Iint1, 0 },
+  /* 1415 */ { UD_Irepne, 0 },
+  /* 1416 */ { UD_Irep, 0 },
+  /* 1417 */ { UD_Ihlt, 0 },
+  /* 1418 */ { UD_Icmc, 0 },
+  /* 1419 */ { UD_Itest, 126 },
+  /* 1420 */ { UD_Itest, 126 },
+  /* 1421 */ { UD_Inot, 216 },
+  /* 1422 */ { UD_Ineg, 216 },
+  /* 1423 */ { UD_Imul, 216 },
+  /* 1424 */ { UD_Iimul, 216 },
+  /* 1425 */ { UD_Idiv, 216 },
+  /* 1426 */ { UD_Iidiv, 216 },
+  /* 1427 */ { UD_Itest, 127 },
+  /* 1428 */ { UD_Itest, 217 },
+  /* 1429 */ { UD_Inot, 218 },
+  /* 1430 */ { UD_Ineg, 218 },
+  /* 1431 */ { UD_Imul, 218 },
+  /* 1432 */ { UD_Iimul, 218 },
+  /* 1433 */ { UD_Idiv, 218 },
+  /* 1434 */ { UD_Iidiv, 218 },
+  /* 1435 */ { UD_Iclc, 0 },
+  /* 1436 */ { UD_Istc, 0 },
+  /* 1437 */ { UD_Icli, 0 },
+  /* 1438 */ { UD_Isti, 0 },
+  /* 1439 */ { UD_Icld, 0 },
+  /* 1440 */ { UD_Istd, 0 },
+  /* 1441 */ { UD_Iinc, 216 },
+  /* 1442 */ { UD_Idec, 216 },
+  /* 1443 */ { UD_Iinc, 218 },
+  /* 1444 */ { UD_Idec, 218 },
+  /* 1445 */ { UD_Icall, 218 },
+  /* 1446 */ { UD_Icall, 219 },
+  /* 1447 */ { UD_Icall, 220 },
+  /* 1448 */ { UD_Ijmp, 132 },
+  /* 1449 */ { UD_Ijmp, 220 },
+  /* 1450 */ { UD_Ipush, 132 },
 };
 
 
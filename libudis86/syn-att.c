@@ -126,7 +126,7 @@ ud_translate_att(struct ud *u)
   int star = 0;
 
   /* check if P_OSO prefix is used */
-  if (! P_OSO(u->itab_entry->prefix) && u->pfx_opr) {
+  if (! P_OSO(u->itab_form->prefix) && u->pfx_opr) {
   switch (u->dis_mode) {
     case 16: 
       ud_asmprintf(u, "o32 ");
@@ -139,7 +139,7 @@ ud_translate_att(struct ud *u)
   }
 
   /* check if P_ASO prefix was used */
-  if (! P_ASO(u->itab_entry->prefix) && u->pfx_adr) {
+  if (! P_ASO(u->itab_form->prefix) && u->pfx_adr) {
   switch (u->dis_mode) {
     case 16: 
       ud_asmprintf(u, "a32 ");
@@ -125,7 +125,7 @@ extern void
 ud_translate_intel(struct ud* u)
 {
   /* check if P_OSO prefix is used */
-  if (!P_OSO(u->itab_entry->prefix) && u->pfx_opr) {
+  if (!P_OSO(u->itab_form->prefix) && u->pfx_opr) {
     switch (u->dis_mode) {
     case 16: ud_asmprintf(u, "o32 "); break;
     case 32:
@@ -134,7 +134,7 @@ ud_translate_intel(struct ud* u)
   }
 
   /* check if P_ASO prefix was used */
-  if (!P_ASO(u->itab_entry->prefix) && u->pfx_adr) {
+  if (!P_ASO(u->itab_form->prefix) && u->pfx_adr) {
     switch (u->dis_mode) {
     case 16: ud_asmprintf(u, "a32 "); break;
     case 32: ud_asmprintf(u, "a16 "); break;
@@ -198,6 +198,13 @@ struct ud
    */
   const char* (*sym_resolver)(struct ud*, uint64_t addr, int64_t *offset);
 
+  /*
+   * Symbol table used by the built-in resolver (see ud_set_symtab), and
+   * the index of the last symbol found, tried first on the next lookup.
+   */
+  const struct ud_symtab *symtab;
+  size_t    symtab_hint;
+
   uint8_t   dis_mode;
   uint64_t  pc;
   uint8_t   vendor;
@@ -221,8 +228,64 @@ struct ud
   uint8_t   modrm;
   uint8_t   primary_opcode;
   void *    user_opaque_data;
-  struct ud_itab_entry * itab_entry;
-  struct ud_lookup_table_list_entry *le;
+  const struct ud_itab_entry * itab_entry;
+  const struct ud_itab_form * itab_form;
+  const struct ud_lookup_table_list_entry *le;
+};
+
+/* -----------------------------------------------------------------------------
+ * struct ud_insn_rec - Compact record of a decoded instruction, as filled in
+ * by ud_decode_batch(). It carries the instruction bytes so that it can be
+ * formatted later with ud_format_rec(), independently of the input source.
+ * -----------------------------------------------------------------------------
+ */
+struct ud_insn_rec
+{
+  uint64_t  offset;     /* program counter of the instruction */
+  uint16_t  mnemonic;   /* enum ud_mnemonic_code */
+  uint8_t   len;        /* number of bytes decoded */
+  uint8_t   error;      /* non-zero if the bytes are not a valid instruction */
+  uint8_t   bytes[15];  /* the instruction bytes, max instruction length */
+};
+
+/* -----------------------------------------------------------------------------
+ * struct ud_symbol - A symbol for the built-in resolver. A size of zero
+ * means the symbol extends up to the next one.
+ * -----------------------------------------------------------------------------
+ */
+struct ud_symbol
+{
+  uint64_t    addr;
+  uint64_t    size;
+  const char* name;
+};
+
+/* -----------------------------------------------------------------------------
+ * struct ud_symtab - A table of symbols sorted by address, set up with
+ * ud_symtab_init(). It is never modified by lookups, so one table can be
+ * shared by any number of ud objects on any number of threads.
+ * -----------------------------------------------------------------------------
+ */
+struct ud_symtab
+{
+  const struct ud_symbol* syms;
+  size_t      count;
+};
+
+/* -----------------------------------------------------------------------------
+ * struct ud_region - A region of code for ud_decode_regions(). The decoded
+ * instructions are stored in `recs`, up to `max_recs` of them, and `count`
+ * is set to the number stored.
+ * -----------------------------------------------------------------------------
+ */
+struct ud_region
+{
+  const uint8_t*      buf;
+  size_t              size;
+  uint64_t            pc;
+  struct ud_insn_rec* recs;
+  size_t              max_recs;
+  size_t              count;
 };
 
 /* -----------------------------------------------------------------------------
@@ -234,6 +297,10 @@ typedef enum ud_mnemonic_code ud_mnemonic_code_t;
 
 typedef struct ud             ud_t;
 typedef struct ud_operand     ud_operand_t;
+typedef struct ud_insn_rec    ud_insn_rec_t;
+typedef struct ud_symbol      ud_symbol_t;
+typedef struct ud_symtab      ud_symtab_t;
+typedef struct ud_region      ud_region_t;
 
 #define UD_SYN_INTEL          ud_translate_intel
 #define UD_SYN_ATT            ud_translate_att
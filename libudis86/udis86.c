@@ -79,6 +79,82 @@ ud_disassemble(struct ud* u)
 }
 
 
+/* =============================================================================
+ * ud_decode_batch
+ *    Decodes up to `max` instructions from the input into `recs`, without
+ *    translating them, and returns the number of records filled in. A zero
+ *    means end of input. Use ud_format_rec() to format a record on demand.
+ * =============================================================================
+ */
+extern size_t
+ud_decode_batch(struct ud* u, struct ud_insn_rec* recs, size_t max)
+{
+  size_t n = 0;
+  while (n < max && !u->inp_end) {
+    struct ud_insn_rec *rec = &recs[n];
+    unsigned int len = ud_decode(u);
+    if (len == 0) {
+      break;
+    }
+    if (len > sizeof(rec->bytes)) {
+      len = sizeof(rec->bytes);
+    }
+    rec->offset   = u->insn_offset;
+    rec->mnemonic = (uint16_t) u->mnemonic;
+    rec->len      = (uint8_t) len;
+    rec->error    = u->error;
+    memcpy(rec->bytes, ud_insn_ptr(u), len);
+    ++n;
+  }
+  return n;
+}
+
+
+/* =============================================================================
+ * ud_format_rec
+ *    Re-decodes a record filled in by ud_decode_batch() and translates it
+ *    with the current syntax, returning the assembly text. The mode, vendor,
+ *    syntax and symbol resolver of `u` are used; its input and program
+ *    counter are left as they were, so formatting may be interleaved with
+ *    batch decoding. The operand and mnemonic accessors describe the
+ *    formatted record until the next decode.
+ * =============================================================================
+ */
+extern const char*
+ud_format_rec(struct ud* u, const struct ud_insn_rec* rec)
+{
+  int (*inp_hook)(struct ud*) = u->inp_hook;
+#ifndef __UD_STANDALONE__
+  FILE* inp_file = u->inp_file;
+#endif /* __UD_STANDALONE__ */
+  const uint8_t* inp_buf = u->inp_buf;
+  size_t inp_buf_size = u->inp_buf_size;
+  size_t inp_buf_index = u->inp_buf_index;
+  uint8_t inp_curr = u->inp_curr;
+  size_t inp_ctr = u->inp_ctr;
+  int inp_end = u->inp_end;
+  uint64_t pc = u->pc;
+
+  ud_set_input_buffer(u, rec->bytes, rec->len);
+  u->pc = rec->offset;
+  u->asm_buf[0] = '\0';
+  if (ud_decode(u) > 0 && u->translator != NULL) {
+    u->translator(u);
+  }
+
+  u->inp_hook = inp_hook;
+  UD_NON_STANDALONE(u->inp_file = inp_file);
+  u->inp_buf = inp_buf;
+  u->inp_buf_size = inp_buf_size;
+  u->inp_buf_index = inp_buf_index;
+  u->inp_curr = inp_curr;
+  u->inp_ctr = inp_ctr;
+  u->inp_end = inp_end;
+  u->pc = pc;
+  return u->asm_buf;
+}
+
+
 /* =============================================================================
  * ud_set_mode() - Set Disassemly Mode.
  * =============================================================================
@@ -454,4 +530,147 @@ ud_input_end(const struct ud *u)
   return u->inp_end;
 }
 
+/* =============================================================================
+ * ud_symtab_init
+ *    Sorts `count` symbols by address and sets up `tab` to refer to them.
+ *    The symbols are not copied and must stay alive as long as the table.
+ * =============================================================================
+ */
+void
+ud_symtab_init(struct ud_symtab *tab, struct ud_symbol *syms, size_t count)
+{
+  size_t gap = 1, i, j;
+
+  /* shell sort, so as not to depend on the C library */
+  while (gap < count / 3) {
+    gap = gap * 3 + 1;
+  }
+  for (; gap > 0; gap /= 3) {
+    for (i = gap; i < count; ++i) {
+      struct ud_symbol sym = syms[i];
+      for (j = i; j >= gap && syms[j - gap].addr > sym.addr; j -= gap) {
+        syms[j] = syms[j - gap];
+      }
+      syms[j] = sym;
+    }
+  }
+  tab->syms  = syms;
+  tab->count = count;
+}
+
+
+/*
+ * symtab_covers
+ *    Returns non-zero if addr lies between the ith symbol and the next.
+ */
+static int
+symtab_covers(const struct ud_symtab *tab, size_t i, uint64_t addr)
+{
+  return i < tab->count && tab->syms[i].addr <= addr &&
+         (i + 1 == tab->count || addr < tab->syms[i + 1].addr);
+}
+
+
+/* =============================================================================
+ * ud_symtab_lookup
+ *    Returns the name of the symbol containing addr, and its offset from
+ *    the start of the symbol, or NULL if there is no such symbol. If `hint`
+ *    is not NULL, it gives the index of the symbol to try first and is
+ *    updated with the index found, which makes runs of nearby lookups
+ *    cheap. The table itself is only read, so lookups on the same table
+ *    may run concurrently as long as each thread uses its own hint.
+ * =============================================================================
+ */
+const char*
+ud_symtab_lookup(const struct ud_symtab *tab, uint64_t addr,
+                 int64_t *offset, size_t *hint)
+{
+  const struct ud_symbol *sym;
+  size_t i = hint ? *hint : 0;
+
+  if (tab == NULL || tab->count == 0 || addr < tab->syms[0].addr) {
+    return NULL;
+  }
+  if (!symtab_covers(tab, i, addr)) {
+    if (hint && symtab_covers(tab, i + 1, addr)) {
+      ++i;
+    } else {
+      /* find the last symbol at or below addr */
+      size_t lo = 0, hi = tab->count - 1;
+      while (lo < hi) {
+        size_t mid = lo + (hi - lo + 1) / 2;
+        if (tab->syms[mid].addr <= addr) {
+          lo = mid;
+        } else {
+          hi = mid - 1;
+        }
+      }
+      i = lo;
+    }
+  }
+  if (hint) {
+    *hint = i;
+  }
+  sym = &tab->syms[i];
+  if (sym->size != 0 && addr - sym->addr >= sym->size) {
+    return NULL;
+  }
+  *offset = (int64_t) (addr - sym->addr);
+  return sym->name;
+}
+
+
+/*
+ * symtab_resolver
+ *    Symbol resolver installed by ud_set_symtab.
+ */
+static const char*
+symtab_resolver(struct ud *u, uint64_t addr, int64_t *offset)
+{
+  return ud_symtab_lookup(u->symtab, addr, offset, &u->symtab_hint);
+}
+
+
+/* =============================================================================
+ * ud_set_symtab
+ *    Resolve relative targets through a symbol table, in place of a
+ *    resolver set with ud_set_sym_resolver. The lookup cache is kept in the
+ *    ud object, so one table may be shared between threads, each with its
+ *    own ud object. A NULL table resets symbol resolution.
+ * =============================================================================
+ */
+void
+ud_set_symtab(struct ud *u, const struct ud_symtab *tab)
+{
+  u->symtab = tab;
+  u->symtab_hint = 0;
+  u->sym_resolver = (tab != NULL) ? symtab_resolver : NULL;
+}
+
+
+/* =============================================================================
+ * ud_decode_regions
+ *    Decodes each of `n` regions with ud_decode_batch(), using a private
+ *    copy of `proto` for its mode, vendor and syntax settings, and returns
+ *    the total number of instructions decoded. `proto` is not modified, so
+ *    a module can be disassembled on several threads by giving each one a
+ *    slice of the regions with the same `proto`.
+ * =============================================================================
+ */
+size_t
+ud_decode_regions(const struct ud *proto, struct ud_region *regions, size_t n)
+{
+  size_t i, total = 0;
+  for (i = 0; i < n; ++i) {
+    struct ud u = *proto;
+    ud_set_asm_buffer(&u, NULL, 0);
+    ud_set_input_buffer(&u, regions[i].buf, regions[i].size);
+    ud_set_pc(&u, regions[i].pc);
+    regions[i].count = ud_decode_batch(&u, regions[i].recs,
+                                       regions[i].max_recs);
+    total += regions[i].count;
+  }
+  return total;
+}
+
 /* vim:set ts=2 sw=2 expandtab */
@@ -87,6 +87,46 @@ MH_STATUS;
 // MH_QueueEnableHook or MH_QueueDisableHook.
 #define MH_ALL_HOOKS NULL
 
+// Can be passed to MH_CreateHookEx or MH_CreateHooks. The hook is enabled and
+// disabled without suspending the other threads, if the target function has
+// a hot patch prologue: at least 5 bytes of padding above it and a first
+// instruction of 2 bytes or more (not ending an aligned 8-byte word), such
+// as "mov edi, edi". Otherwise the hook is created as usual.
+#define MH_HOOK_ATOMIC 0x0001
+
+// A hook to be created by MH_CreateHooks.
+typedef struct _MH_HOOK_DESC
+{
+    LPVOID    pTarget;      // [in]  A pointer to the target function.
+    LPVOID    pDetour;      // [in]  A pointer to the detour function.
+    LPVOID   *ppOriginal;   // [out] A pointer to the trampoline function.
+                            //       This member can be NULL.
+    UINT      flags;        // [in]  MH_HOOK_* flags, or 0.
+    MH_STATUS status;       // [out] The result of creating this hook.
+}
+MH_HOOK_DESC;
+
+// Switches an enabled hook between its detour and the original function, as
+// returned by MH_GetHookSwitch.
+typedef struct _MH_HOOK_SWITCH
+{
+    LPVOID *ppRelayTarget;
+    LPVOID  pDetour;
+    LPVOID  pOriginal;
+}
+MH_HOOK_SWITCH;
+
+// The counters of an instrumentation hook, as returned by
+// MH_GetInstrumentCounters.
+typedef struct _MH_INSTRUMENT_COUNTERS
+{
+    LPVOID pTarget;         // A pointer to the target function.
+    UINT64 callCount;       // The number of calls made, in all threads.
+    UINT64 cycleCount;      // The time stamp counter cycles spent in the calls
+                            // that have returned, including nested calls.
+}
+MH_INSTRUMENT_COUNTERS;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -110,6 +150,26 @@ extern "C" {
     //                    This parameter can be NULL.
     MH_STATUS WINAPI MH_CreateHook(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal);
 
+    // Creates a Hook for the specified target function, in disabled state.
+    // Parameters:
+    //   pTarget    [in]  A pointer to the target function, which will be
+    //                    overridden by the detour function.
+    //   pDetour    [in]  A pointer to the detour function, which will override
+    //                    the target function.
+    //   ppOriginal [out] A pointer to the trampoline function, which will be
+    //                    used to call the original target function.
+    //                    This parameter can be NULL.
+    //   flags      [in]  MH_HOOK_* flags, or 0.
+    MH_STATUS WINAPI MH_CreateHookEx(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal, UINT flags);
+
+    // Creates Hooks for several target functions in one go, in disabled state.
+    // The status of each is stored in it, and the first that is not MH_OK is
+    // returned.
+    // Parameters:
+    //   pHooks [in, out] An array of the hooks to create.
+    //   count  [in]      The number of hooks in the array.
+    MH_STATUS WINAPI MH_CreateHooks(MH_HOOK_DESC *pHooks, UINT count);
+
     // Creates a Hook for the specified API function, in disabled state.
     // Parameters:
     //   pszModule  [in]  A pointer to the loaded module name which contains the
@@ -206,9 +266,53 @@ extern "C" {
     //                queued to be disabled.
     MH_STATUS WINAPI MH_QueueDisableHook(LPVOID pTarget);
 
-    // Applies all queued changes in one go.
+    // Applies all queued changes in one go, suspending the other threads
+    // only once. If the memory protection of any target can't be changed,
+    // no change is applied.
     MH_STATUS WINAPI MH_ApplyQueued(VOID);
 
+    // Gets the switch of an already created hook, which stays valid until
+    // the hook is removed.
+    // Parameters:
+    //   pTarget [in]  A pointer to the target function.
+    //   pSwitch [out] The switch of the hook.
+    MH_STATUS WINAPI MH_GetHookSwitch(LPVOID pTarget, MH_HOOK_SWITCH *pSwitch);
+
+    // Sends the calls to an enabled hook to its detour function or, while it
+    // is switched off, straight to the original function. Unlike
+    // MH_EnableHook/MH_DisableHook this doesn't take the global lock or
+    // suspend any threads, so it may be called at any time from any thread.
+    // Hooks are switched on when created.
+    // Parameters:
+    //   pSwitch [in] The switch of the hook, from MH_GetHookSwitch.
+    //   on      [in] TRUE for the detour, FALSE for the original function.
+    VOID WINAPI MH_SetHookSwitch(const MH_HOOK_SWITCH *pSwitch, BOOL on);
+
+    // Creates an instrumentation Hook for the specified target function, in
+    // disabled state. Instead of calling a detour function, it counts the
+    // calls to the target and the time stamp counter cycles spent in them,
+    // in per-thread counters, and then runs the original function. It is
+    // enabled and disabled like any other hook.
+    // Calls up to 64 deep in one thread are timed by making them return
+    // through the hook, so an exception leaving the target function or a
+    // longjmp out of it is not supported. The functions the hook itself
+    // calls (GetLastError, SetLastError, TlsGetValue, TlsSetValue) must not
+    // be instrumented.
+    // Parameters:
+    //   pTarget [in] A pointer to the target function.
+    //   flags   [in] MH_HOOK_* flags, or 0.
+    MH_STATUS WINAPI MH_CreateInstrumentHook(LPVOID pTarget, UINT flags);
+
+    // Gets the counters of all the instrumentation hooks, added up over the
+    // threads. The other threads keep running, so the counters of the calls
+    // in progress may be a little behind.
+    // Parameters:
+    //   pCounters [out]     An array to receive the counters.
+    //   pCount    [in, out] The size of the array on input, and the number of
+    //                       instrumentation hooks on output. If that is
+    //                       larger, only the first ones are stored.
+    MH_STATUS WINAPI MH_GetInstrumentCounters(MH_INSTRUMENT_COUNTERS *pCounters, UINT *pCount);
+
     // Translates the MH_STATUS to its name as a string.
     const char * WINAPI MH_StatusToString(MH_STATUS status);
 
@@ -29,10 +29,15 @@
 #include <windows.h>
 #include "buffer.h"
 
+// Size of each memory region. (= allocation granularity of VirtualAlloc)
+// Regions are reserved whole, so that they don't cut the address space into
+// unusable pieces, and committed one block at a time.
+#define MEMORY_REGION_SIZE 0x10000
+
 // Size of each memory block. (= page size of VirtualAlloc)
 #define MEMORY_BLOCK_SIZE 0x1000
 
-// Max range for seeking a memory block. (= 1024MB)
+// Max range for seeking a memory region. (= 1024MB)
 #define MAX_MEMORY_RANGE 0x40000000
 
 // Memory protection flags to check the executable address.
@@ -49,38 +54,58 @@ typedef struct _MEMORY_SLOT
     };
 } MEMORY_SLOT, *PMEMORY_SLOT;
 
-// Memory block info. Placed at the head of each block.
-typedef struct _MEMORY_BLOCK
+// Memory region info. Placed at the head of each region.
+typedef struct _MEMORY_REGION
 {
-    struct _MEMORY_BLOCK *pNext;
+    struct _MEMORY_REGION *pNext;
     PMEMORY_SLOT pFree;         // First element of the free slot list.
     UINT usedCount;
-} MEMORY_BLOCK, *PMEMORY_BLOCK;
+    UINT committedSize;         // Bytes committed from the head of the region.
+} MEMORY_REGION, *PMEMORY_REGION;
 
 //-------------------------------------------------------------------------
 // Global Variables:
 //-------------------------------------------------------------------------
 
-// First element of the memory block list.
-PMEMORY_BLOCK g_pMemoryBlocks;
+// First element of the memory region list.
+PMEMORY_REGION g_pMemoryRegions;
+
+// Committed regions found by IsExecutableAddress(), while caching is on.
+#define REGION_CACHE_SIZE 4
+static MEMORY_BASIC_INFORMATION g_regionCache[REGION_CACHE_SIZE];
+static UINT g_regionCacheCount = 0;
+static BOOL g_isRegionCacheOn = FALSE;
+
+#if defined(_M_X64) || defined(__x86_64__)
+// Address range and allocation granularity of the process.
+static ULONG_PTR g_minAppAddr;
+static ULONG_PTR g_maxAppAddr;
+static DWORD     g_allocationGranularity;
+#endif
 
 //-------------------------------------------------------------------------
 VOID InitializeBuffer(VOID)
 {
-    // Nothing to do for now.
+#if defined(_M_X64) || defined(__x86_64__)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    g_minAppAddr = (ULONG_PTR)si.lpMinimumApplicationAddress;
+    g_maxAppAddr = (ULONG_PTR)si.lpMaximumApplicationAddress;
+    g_allocationGranularity = si.dwAllocationGranularity;
+#endif
 }
 
 //-------------------------------------------------------------------------
 VOID UninitializeBuffer(VOID)
 {
-    PMEMORY_BLOCK pBlock = g_pMemoryBlocks;
-    g_pMemoryBlocks = NULL;
+    PMEMORY_REGION pRegion = g_pMemoryRegions;
+    g_pMemoryRegions = NULL;
 
-    while (pBlock)
+    while (pRegion)
     {
-        PMEMORY_BLOCK pNext = pBlock->pNext;
-        VirtualFree(pBlock, 0, MEM_RELEASE);
-        pBlock = pNext;
+        PMEMORY_REGION pNext = pRegion->pNext;
+        VirtualFree(pRegion, 0, MEM_RELEASE);
+        pRegion = pNext;
     }
 }
 
@@ -148,17 +173,70 @@ static LPVOID FindNextFreeRegion(LPVOID pAddress, LPVOID pMaxAddr, DWORD dwAlloc
 #endif
 
 //-------------------------------------------------------------------------
-static PMEMORY_BLOCK GetMemoryBlock(LPVOID pOrigin)
+// Commits the next block of a region and adds its slots to the free list.
+static BOOL CommitMemoryBlock(PMEMORY_REGION pRegion)
 {
-    PMEMORY_BLOCK pBlock;
-#if defined(_M_X64) || defined(__x86_64__)
-    ULONG_PTR minAddr;
-    ULONG_PTR maxAddr;
+    PMEMORY_SLOT pSlot;
+    PMEMORY_SLOT pEnd;
+    LPBYTE pBlock = (LPBYTE)pRegion + pRegion->committedSize;
 
-    SYSTEM_INFO si;
-    GetSystemInfo(&si);
-    minAddr = (ULONG_PTR)si.lpMinimumApplicationAddress;
-    maxAddr = (ULONG_PTR)si.lpMaximumApplicationAddress;
+    if (pRegion->committedSize >= MEMORY_REGION_SIZE)
+        return FALSE;
+
+    if (VirtualAlloc(pBlock, MEMORY_BLOCK_SIZE, MEM_COMMIT, PAGE_EXECUTE_READWRITE) == NULL)
+        return FALSE;
+
+    pRegion->committedSize += MEMORY_BLOCK_SIZE;
+
+    // Build a linked list of all the slots, skipping the region info.
+    pSlot = (PMEMORY_SLOT)pBlock;
+    if (pSlot == (PMEMORY_SLOT)pRegion)
+        pSlot++;
+    pEnd = (PMEMORY_SLOT)(pBlock + MEMORY_BLOCK_SIZE);
+    do
+    {
+        pSlot->pNext = pRegion->pFree;
+        pRegion->pFree = pSlot;
+        pSlot++;
+    } while (pSlot < pEnd);
+
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------
+// Reserves a region at pAddress (or anywhere if NULL) and commits its first
+// block, which holds the region info.
+static PMEMORY_REGION AllocateMemoryRegion(LPVOID pAddress)
+{
+    PMEMORY_REGION pRegion = (PMEMORY_REGION)VirtualAlloc(
+        pAddress, MEMORY_REGION_SIZE, MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+    if (pRegion == NULL)
+        return NULL;
+
+    if (VirtualAlloc(pRegion, MEMORY_BLOCK_SIZE, MEM_COMMIT, PAGE_EXECUTE_READWRITE) == NULL)
+    {
+        VirtualFree(pRegion, 0, MEM_RELEASE);
+        return NULL;
+    }
+
+    pRegion->pFree = NULL;
+    pRegion->usedCount = 0;
+    pRegion->committedSize = 0;
+    CommitMemoryBlock(pRegion);
+
+    pRegion->pNext = g_pMemoryRegions;
+    g_pMemoryRegions = pRegion;
+
+    return pRegion;
+}
+
+//-------------------------------------------------------------------------
+static PMEMORY_REGION GetMemoryRegion(LPVOID pOrigin)
+{
+    PMEMORY_REGION pRegion;
+#if defined(_M_X64) || defined(__x86_64__)
+    ULONG_PTR minAddr = g_minAppAddr;
+    ULONG_PTR maxAddr = g_maxAppAddr;
 
     // pOrigin ± 512MB
     if ((ULONG_PTR)pOrigin > MAX_MEMORY_RANGE && minAddr < (ULONG_PTR)pOrigin - MAX_MEMORY_RANGE)
@@ -167,94 +245,76 @@ static PMEMORY_BLOCK GetMemoryBlock(LPVOID pOrigin)
     if (maxAddr > (ULONG_PTR)pOrigin + MAX_MEMORY_RANGE)
         maxAddr = (ULONG_PTR)pOrigin + MAX_MEMORY_RANGE;
 
-    // Make room for MEMORY_BLOCK_SIZE bytes.
-    maxAddr -= MEMORY_BLOCK_SIZE - 1;
+    // Make room for MEMORY_REGION_SIZE bytes.
+    maxAddr -= MEMORY_REGION_SIZE - 1;
 #endif
 
-    // Look the registered blocks for a reachable one.
-    for (pBlock = g_pMemoryBlocks; pBlock != NULL; pBlock = pBlock->pNext)
+    // Look the registered regions for a reachable one. The regions already
+    // reserved are tried first, so the address space is only searched when
+    // all of those within reach are full.
+    for (pRegion = g_pMemoryRegions; pRegion != NULL; pRegion = pRegion->pNext)
     {
 #if defined(_M_X64) || defined(__x86_64__)
-        // Ignore the blocks too far.
-        if ((ULONG_PTR)pBlock < minAddr || (ULONG_PTR)pBlock >= maxAddr)
+        // Ignore the regions too far.
+        if ((ULONG_PTR)pRegion < minAddr || (ULONG_PTR)pRegion >= maxAddr)
             continue;
 #endif
-        // The block has at least one unused slot.
-        if (pBlock->pFree != NULL)
-            return pBlock;
+        // The region has at least one unused slot, or room to commit more.
+        if (pRegion->pFree != NULL || CommitMemoryBlock(pRegion))
+            return pRegion;
     }
 
 #if defined(_M_X64) || defined(__x86_64__)
-    // Alloc a new block above if not found.
+    // Alloc a new region above if not found.
     {
         LPVOID pAlloc = pOrigin;
         while ((ULONG_PTR)pAlloc >= minAddr)
         {
-            pAlloc = FindPrevFreeRegion(pAlloc, (LPVOID)minAddr, si.dwAllocationGranularity);
+            pAlloc = FindPrevFreeRegion(pAlloc, (LPVOID)minAddr, g_allocationGranularity);
             if (pAlloc == NULL)
                 break;
 
-            pBlock = (PMEMORY_BLOCK)VirtualAlloc(
-                pAlloc, MEMORY_BLOCK_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-            if (pBlock != NULL)
+            pRegion = AllocateMemoryRegion(pAlloc);
+            if (pRegion != NULL)
                 break;
         }
     }
 
-    // Alloc a new block below if not found.
-    if (pBlock == NULL)
+    // Alloc a new region below if not found.
+    if (pRegion == NULL)
     {
         LPVOID pAlloc = pOrigin;
         while ((ULONG_PTR)pAlloc <= maxAddr)
         {
-            pAlloc = FindNextFreeRegion(pAlloc, (LPVOID)maxAddr, si.dwAllocationGranularity);
+            pAlloc = FindNextFreeRegion(pAlloc, (LPVOID)maxAddr, g_allocationGranularity);
             if (pAlloc == NULL)
                 break;
 
-            pBlock = (PMEMORY_BLOCK)VirtualAlloc(
-                pAlloc, MEMORY_BLOCK_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-            if (pBlock != NULL)
+            pRegion = AllocateMemoryRegion(pAlloc);
+            if (pRegion != NULL)
                 break;
         }
     }
 #else
-    // In x86 mode, a memory block can be placed anywhere.
-    pBlock = (PMEMORY_BLOCK)VirtualAlloc(
-        NULL, MEMORY_BLOCK_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+    // In x86 mode, a memory region can be placed anywhere.
+    pRegion = AllocateMemoryRegion(NULL);
 #endif
 
-    if (pBlock != NULL)
-    {
-        // Build a linked list of all the slots.
-        PMEMORY_SLOT pSlot = (PMEMORY_SLOT)pBlock + 1;
-        pBlock->pFree = NULL;
-        pBlock->usedCount = 0;
-        do
-        {
-            pSlot->pNext = pBlock->pFree;
-            pBlock->pFree = pSlot;
-            pSlot++;
-        } while ((ULONG_PTR)pSlot - (ULONG_PTR)pBlock <= MEMORY_BLOCK_SIZE - MEMORY_SLOT_SIZE);
-
-        pBlock->pNext = g_pMemoryBlocks;
-        g_pMemoryBlocks = pBlock;
-    }
-
-    return pBlock;
+    return pRegion;
 }
 
 //-------------------------------------------------------------------------
 LPVOID AllocateBuffer(LPVOID pOrigin)
 {
-    PMEMORY_SLOT  pSlot;
-    PMEMORY_BLOCK pBlock = GetMemoryBlock(pOrigin);
-    if (pBlock == NULL)
+    PMEMORY_SLOT   pSlot;
+    PMEMORY_REGION pRegion = GetMemoryRegion(pOrigin);
+    if (pRegion == NULL)
         return NULL;
 
     // Remove an unused slot from the list.
-    pSlot = pBlock->pFree;
-    pBlock->pFree = pSlot->pNext;
-    pBlock->usedCount++;
+    pSlot = pRegion->pFree;
+    pRegion->pFree = pSlot->pNext;
+    pRegion->usedCount++;
 #ifdef _DEBUG
     // Fill the slot with INT3 for debugging.
     memset(pSlot, 0xCC, sizeof(MEMORY_SLOT));
@@ -265,13 +325,13 @@ LPVOID AllocateBuffer(LPVOID pOrigin)
 //-------------------------------------------------------------------------
 VOID FreeBuffer(LPVOID pBuffer)
 {
-    PMEMORY_BLOCK pBlock = g_pMemoryBlocks;
-    PMEMORY_BLOCK pPrev = NULL;
-    ULONG_PTR pTargetBlock = ((ULONG_PTR)pBuffer / MEMORY_BLOCK_SIZE) * MEMORY_BLOCK_SIZE;
+    PMEMORY_REGION pRegion = g_pMemoryRegions;
+    PMEMORY_REGION pPrev = NULL;
+    ULONG_PTR pTargetRegion = ((ULONG_PTR)pBuffer / MEMORY_REGION_SIZE) * MEMORY_REGION_SIZE;
 
-    while (pBlock != NULL)
+    while (pRegion != NULL)
     {
-        if ((ULONG_PTR)pBlock == pTargetBlock)
+        if ((ULONG_PTR)pRegion == pTargetRegion)
         {
             PMEMORY_SLOT pSlot = (PMEMORY_SLOT)pBuffer;
 #ifdef _DEBUG
@@ -279,34 +339,59 @@ VOID FreeBuffer(LPVOID pBuffer)
             memset(pSlot, 0x00, sizeof(*pSlot));
 #endif
             // Restore the released slot to the list.
-            pSlot->pNext = pBlock->pFree;
-            pBlock->pFree = pSlot;
-            pBlock->usedCount--;
+            pSlot->pNext = pRegion->pFree;
+            pRegion->pFree = pSlot;
+            pRegion->usedCount--;
 
             // Free if unused.
-            if (pBlock->usedCount == 0)
+            if (pRegion->usedCount == 0)
             {
                 if (pPrev)
-                    pPrev->pNext = pBlock->pNext;
+                    pPrev->pNext = pRegion->pNext;
                 else
-                    g_pMemoryBlocks = pBlock->pNext;
+                    g_pMemoryRegions = pRegion->pNext;
 
-                VirtualFree(pBlock, 0, MEM_RELEASE);
+                VirtualFree(pRegion, 0, MEM_RELEASE);
             }
 
             break;
         }
 
-        pPrev = pBlock;
-        pBlock = pBlock->pNext;
+        pPrev = pRegion;
+        pRegion = pRegion->pNext;
     }
 }
 
+//-------------------------------------------------------------------------
+VOID CacheExecutableRegions(BOOL enable)
+{
+    g_isRegionCacheOn  = enable;
+    g_regionCacheCount = 0;
+}
+
 //-------------------------------------------------------------------------
 BOOL IsExecutableAddress(LPVOID pAddress)
 {
     MEMORY_BASIC_INFORMATION mi;
-    VirtualQuery(pAddress, &mi, sizeof(mi));
+    UINT i;
+
+    for (i = 0; i < g_regionCacheCount && i < REGION_CACHE_SIZE; ++i)
+    {
+        PMEMORY_BASIC_INFORMATION pCached = &g_regionCache[i];
+        if ((LPBYTE)pAddress >= (LPBYTE)pCached->BaseAddress
+            && (LPBYTE)pAddress < (LPBYTE)pCached->BaseAddress + pCached->RegionSize)
+        {
+            return (pCached->Protect & PAGE_EXECUTE_FLAGS) != 0;
+        }
+    }
+
+    if (VirtualQuery(pAddress, &mi, sizeof(mi)) == 0)
+        return FALSE;
+
+    // Only committed regions are kept, since the free ones may be taken by
+    // AllocateBuffer() in the meantime.
+    if (g_isRegionCacheOn && mi.State == MEM_COMMIT)
+        g_regionCache[g_regionCacheCount++ % REGION_CACHE_SIZE] = mi;
 
     return (mi.State == MEM_COMMIT && (mi.Protect & PAGE_EXECUTE_FLAGS));
 }
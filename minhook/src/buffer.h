@@ -29,14 +29,11 @@
 #pragma once
 
 // Size of each memory slot.
-#if defined(_M_X64) || defined(__x86_64__)
-    #define MEMORY_SLOT_SIZE 64
-#else
-    #define MEMORY_SLOT_SIZE 32
-#endif
+#define MEMORY_SLOT_SIZE 64
 
 VOID   InitializeBuffer(VOID);
 VOID   UninitializeBuffer(VOID);
 LPVOID AllocateBuffer(LPVOID pOrigin);
 VOID   FreeBuffer(LPVOID pBuffer);
 BOOL   IsExecutableAddress(LPVOID pAddress);
+VOID   CacheExecutableRegions(BOOL enable);
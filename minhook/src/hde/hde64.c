@@ -334,4 +334,82 @@ unsigned int hde64_disasm(const void *code, hde64s *hs)
     return (unsigned int)hs->len;
 }
 
+unsigned int hde64_length(const void *code)
+{
+    uint8_t *p = (uint8_t *)code, *ht = hde64_length_table;
+    uint8_t x, c, k, cflags, opcode, pref = 0, op64 = 0;
+    unsigned int len;
+
+    for (x = 16; x; x--) {
+        if (!(k = hde64_prefix_table[c = *p++]))
+            break;
+        pref |= k;
+    }
+
+    if ((c & 0xf0) == 0x40) {
+        if ((c & 0x08) && (*p & 0xf8) == 0xb8)
+            op64++;
+        if (((c = *p++) & 0xf0) == 0x40)
+            goto length_done;
+    }
+
+    if ((opcode = c) == 0x0f) {
+        opcode = *p++;
+        ht += 256;
+    } else if (c >= 0xa0 && c <= 0xa3) {
+        op64++;
+        if (pref & PRE_67)
+            pref |= PRE_66;
+        else
+            pref &= ~PRE_66;
+    }
+
+    cflags = ht[opcode];
+
+    if (cflags & C_MODRM) {
+        uint8_t modrm = *p;
+
+        /* mov to/from control and debug registers */
+        if (ht != hde64_length_table && (opcode & 0xfc) == 0x20)
+            modrm |= 0xc0;
+
+        k = hde64_modrm_table[((pref & PRE_67) ? 256 : 0) + modrm];
+        if ((k & 0x80) && (p[1] & 7) == 5)
+            k = 6;
+        p += k & 0x7f;
+
+        if (!(modrm & 0x30)) {
+            if (opcode == 0xf6)
+                cflags |= C_IMM8;
+            else if (opcode == 0xf7)
+                cflags |= C_IMM_P66;
+        }
+    }
+
+    if (cflags & C_IMM_P66) {
+        if (cflags & C_REL32) {
+            p += (pref & PRE_66) ? 2 : 4;
+            goto length_done;
+        }
+        p += op64 ? 8 : (pref & PRE_66) ? 2 : 4;
+    }
+
+    if (cflags & C_IMM16)
+        p += 2;
+    if (cflags & C_IMM8)
+        p++;
+
+    if (cflags & C_REL32)
+        p += 4;
+    else if (cflags & C_REL8)
+        p++;
+
+  length_done:
+
+    if ((len = (unsigned int)(p - (uint8_t *)code)) > 15)
+        len = 15;
+
+    return len;
+}
+
 #endif // defined(_M_X64) || defined(__x86_64__)
@@ -105,6 +105,11 @@ extern "C" {
 /* __cdecl */
 unsigned int hde64_disasm(const void *code, hde64s *hs);
 
+/* __cdecl */
+/* Same length as hde64_disasm, without decoding the details or checking
+ * for errors. */
+unsigned int hde64_length(const void *code);
+
 #ifdef __cplusplus
 }
 #endif
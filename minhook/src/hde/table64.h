@@ -72,3 +72,106 @@ unsigned char hde64_table[] = {
   0x00,0xb4,0xff,0x00,0xb5,0xff,0x00,0xc3,0x01,0x00,0xc7,0xff,0xbf,0xe7,0x08,
   0x00,0xf0,0x02,0x00
 };
+
+/* hde64_table resolved for hde64_length: the flags of each one-byte and
+ * then each 0f-prefixed opcode, with groups looked up and errors replaced
+ * by the flags hde64_disasm falls back to. */
+unsigned char hde64_length_table[] = {
+  0x01,0x01,0x01,0x01,0x02,0x10,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x10,0x00,
+  0x00,0x01,0x01,0x01,0x01,0x02,0x10,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x10,
+  0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x10,0x00,0x00,0x01,0x01,0x01,0x01,0x02,
+  0x10,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x10,0x00,0x00,0x01,0x01,0x01,0x01,
+  0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x10,
+  0x11,0x02,0x03,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x03,0x11,0x00,0x03,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x00,
+  0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x03,0x03,0x04,
+  0x00,0x00,0x00,0x03,0x11,0x06,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x01,0x01,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x20,
+  0x20,0x20,0x20,0x02,0x02,0x02,0x02,0x50,0x50,0x00,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x00,0x03,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x03,0x03,0x03,0x03,0x01,0x01,0x01,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x50,0x50,0x50,0x50,0x50,0x50,
+  0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x01,
+  0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x03,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x03,0x01,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x00
+};
+
+/* Prefixes for hde64_length: 0x80 for any prefix, with PRE_66 or PRE_67. */
+unsigned char hde64_prefix_table[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x88,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x80,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00
+};
+
+/* Bytes taken by the ModR/M byte, SIB byte and displacement, without and
+ * then with the 67 prefix. 0x80 is set if a SIB base of 5 means disp32. */
+unsigned char hde64_modrm_table[] = {
+  0x01,0x01,0x01,0x01,0x82,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x05,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x82,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x05,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x82,
+  0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x05,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x82,0x05,0x01,0x01,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x05,0x05,0x05,0x05,0x86,0x05,0x05,
+  0x05,0x05,0x05,0x05,0x05,0x86,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x86,0x05,
+  0x05,0x05,0x05,0x05,0x05,0x05,0x86,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x86,
+  0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x86,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+  0x86,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x86,0x05,0x05,0x05,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x82,0x01,0x03,0x01,0x01,0x01,0x01,0x01,0x82,0x01,
+  0x03,0x01,0x01,0x01,0x01,0x01,0x82,0x01,0x03,0x01,0x01,0x01,0x01,0x01,0x82,
+  0x01,0x03,0x01,0x01,0x01,0x01,0x01,0x82,0x01,0x03,0x01,0x01,0x01,0x01,0x01,
+  0x82,0x01,0x03,0x01,0x01,0x01,0x01,0x01,0x82,0x01,0x03,0x01,0x01,0x01,0x01,
+  0x01,0x82,0x01,0x03,0x01,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x84,0x03,
+  0x03,0x03,0x03,0x03,0x03,0x03,0x84,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x84,
+  0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x84,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+  0x84,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x84,0x03,0x03,0x03,0x03,0x03,0x03,
+  0x03,0x84,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x84,0x03,0x03,0x03,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x01,0x01
+};
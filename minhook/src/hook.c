@@ -33,6 +33,7 @@
 #include "../include/MinHook.h"
 #include "buffer.h"
 #include "trampoline.h"
+#include "instrument.h"
 
 #ifndef ARRAYSIZE
     #define ARRAYSIZE(A) (sizeof(A)/sizeof((A)[0]))
@@ -61,13 +62,18 @@
 typedef struct _HOOK_ENTRY
 {
     LPVOID pTarget;             // Address of the target function.
-    LPVOID pDetour;             // Address of the detour or relay function.
+    LPVOID pDetour;             // Address of the relay function.
+    LPVOID pDetourFunc;         // Address of the detour function itself.
     LPVOID pTrampoline;         // Address of the trampoline function.
+    LPVOID *ppRelayTarget;      // Pointer the relay function jumps through.
+    LPVOID pInstrument;         // Instrumentation thunk used as the detour, or NULL.
     UINT8  backup[8];           // Original prologue of the target function.
 
     UINT8  patchAbove  : 1;     // Uses the hot patch area.
     UINT8  isEnabled   : 1;     // Enabled.
     UINT8  queueEnable : 1;     // Queued for enabling/disabling when != isEnabled.
+    UINT8  atomicPatch : 1;     // Switched by one atomic write, without freezing threads.
+    UINT8  paddingPatched : 1;  // The long jump of an atomic hook is in the padding.
 
     UINT   nIP : 4;             // Count of the instruction boundaries.
     UINT8  oldIPs[8];           // Instruction boundaries of the target function.
@@ -82,6 +88,73 @@ typedef struct _FROZEN_THREADS
     UINT    size;           // Actual number of data items
 } FROZEN_THREADS, *PFROZEN_THREADS;
 
+// Code to be patched by EnableHooksLL(), and the range of memory its
+// protection is changed with.
+typedef struct _HOOK_PATCH
+{
+    UINT   pos;             // Position of the hook entry.
+    LPBYTE pAddress;        // Start of the patch.
+    SIZE_T size;            // Size of the patch.
+} HOOK_PATCH, *PHOOK_PATCH;
+
+typedef struct _PATCH_RANGE
+{
+    LPBYTE pAddress;        // Start of the range.
+    SIZE_T size;            // Size of the range.
+    DWORD  oldProtect;      // Protection to restore.
+} PATCH_RANGE, *PPATCH_RANGE;
+
+// The parts of the SYSTEM_PROCESS_INFORMATION and SYSTEM_THREAD_INFORMATION
+// layouts documented in winternl.h, for EnumerateThreads().
+#define MH_SYSTEM_PROCESS_INFORMATION_CLASS 5
+#define MH_STATUS_INFO_LENGTH_MISMATCH      ((LONG)0xC0000004L)
+
+typedef LONG (NTAPI *NTQUERYSYSTEMINFORMATION)(UINT, PVOID, ULONG, PULONG);
+
+typedef struct _MH_SYSTEM_THREAD_INFORMATION
+{
+    LARGE_INTEGER Reserved1[3];
+    ULONG         Reserved2;
+    PVOID         StartAddress;
+    HANDLE        UniqueProcess;
+    HANDLE        UniqueThread;
+    LONG          Priority;
+    LONG          BasePriority;
+    ULONG         Reserved3;
+    ULONG         ThreadState;
+    ULONG         WaitReason;
+} MH_SYSTEM_THREAD_INFORMATION, *PMH_SYSTEM_THREAD_INFORMATION;
+
+typedef struct _MH_SYSTEM_PROCESS_INFORMATION
+{
+    ULONG         NextEntryOffset;
+    ULONG         NumberOfThreads;
+    BYTE          Reserved1[48];
+    USHORT        ImageNameLength;
+    USHORT        ImageNameMaximumLength;
+    PWSTR         ImageNameBuffer;
+    LONG          BasePriority;
+    HANDLE        UniqueProcessId;
+    PVOID         Reserved2;
+    ULONG         HandleCount;
+    ULONG         SessionId;
+    PVOID         Reserved3;
+    SIZE_T        PeakVirtualSize;
+    SIZE_T        VirtualSize;
+    ULONG         Reserved4;
+    SIZE_T        PeakWorkingSetSize;
+    SIZE_T        WorkingSetSize;
+    PVOID         Reserved5;
+    SIZE_T        QuotaPagedPoolUsage;
+    PVOID         Reserved6;
+    SIZE_T        QuotaNonPagedPoolUsage;
+    SIZE_T        PagefileUsage;
+    SIZE_T        PeakPagefileUsage;
+    SIZE_T        PrivatePageCount;
+    LARGE_INTEGER Reserved7[6];
+    // Followed by NumberOfThreads MH_SYSTEM_THREAD_INFORMATION.
+} MH_SYSTEM_PROCESS_INFORMATION, *PMH_SYSTEM_PROCESS_INFORMATION;
+
 //-------------------------------------------------------------------------
 // Global Variables:
 //-------------------------------------------------------------------------
@@ -98,52 +171,151 @@ struct
     PHOOK_ENTRY pItems;     // Data heap
     UINT        capacity;   // Size of allocated data heap, items
     UINT        size;       // Actual number of data items
+    UINT       *pIndex;     // Hash index of the items by target, positions + 1
+    UINT        indexSize;  // Size of the index, a power of two
 } g_hooks;
 
 //-------------------------------------------------------------------------
-// Returns INVALID_HOOK_POS if not found.
-static UINT FindHookEntry(LPVOID pTarget)
+static UINT HashTarget(LPVOID pTarget)
 {
-    UINT i;
-    for (i = 0; i < g_hooks.size; ++i)
+    // Fibonacci hashing, which spreads aligned addresses well.
+    return (UINT)(((UINT64)(ULONG_PTR)pTarget * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+//-------------------------------------------------------------------------
+// Returns the index slot of pTarget, or the empty slot it would go in.
+static UINT FindIndexSlot(LPVOID pTarget)
+{
+    UINT mask = g_hooks.indexSize - 1;
+    UINT slot = HashTarget(pTarget) & mask;
+
+    while (g_hooks.pIndex[slot] != 0
+        && g_hooks.pItems[g_hooks.pIndex[slot] - 1].pTarget != pTarget)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+//-------------------------------------------------------------------------
+static VOID RemoveIndexSlot(UINT slot)
+{
+    UINT mask = g_hooks.indexSize - 1;
+    UINT next = slot;
+
+    // Shift back the following entries that would no longer be found across
+    // the hole, instead of leaving a deleted marker.
+    for (;;)
     {
-        if ((ULONG_PTR)pTarget == (ULONG_PTR)g_hooks.pItems[i].pTarget)
-            return i;
+        UINT home;
+
+        next = (next + 1) & mask;
+        if (g_hooks.pIndex[next] == 0)
+            break;
+
+        home = HashTarget(g_hooks.pItems[g_hooks.pIndex[next] - 1].pTarget) & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            g_hooks.pIndex[slot] = g_hooks.pIndex[next];
+            slot = next;
+        }
     }
 
-    return INVALID_HOOK_POS;
+    g_hooks.pIndex[slot] = 0;
 }
 
 //-------------------------------------------------------------------------
-static PHOOK_ENTRY AddHookEntry()
+// Returns INVALID_HOOK_POS if not found.
+static UINT FindHookEntry(LPVOID pTarget)
 {
+    UINT slot;
+
+    if (g_hooks.pIndex == NULL)
+        return INVALID_HOOK_POS;
+
+    slot = FindIndexSlot(pTarget);
+    if (g_hooks.pIndex[slot] == 0)
+        return INVALID_HOOK_POS;
+
+    return g_hooks.pIndex[slot] - 1;
+}
+
+//-------------------------------------------------------------------------
+// Makes room for count more entries, keeping the index at most half full.
+static BOOL ReserveHookEntries(UINT count)
+{
+    UINT capacity = (g_hooks.capacity != 0) ? g_hooks.capacity : INITIAL_HOOK_CAPACITY;
+    UINT i;
+
+    while (capacity < g_hooks.size + count)
+        capacity *= 2;
+
     if (g_hooks.pItems == NULL)
     {
-        g_hooks.capacity = INITIAL_HOOK_CAPACITY;
         g_hooks.pItems = (PHOOK_ENTRY)HeapAlloc(
-            g_hHeap, 0, g_hooks.capacity * sizeof(HOOK_ENTRY));
+            g_hHeap, 0, capacity * sizeof(HOOK_ENTRY));
         if (g_hooks.pItems == NULL)
-            return NULL;
+            return FALSE;
+
+        g_hooks.capacity = capacity;
     }
-    else if (g_hooks.size >= g_hooks.capacity)
+    else if (capacity > g_hooks.capacity)
     {
         PHOOK_ENTRY p = (PHOOK_ENTRY)HeapReAlloc(
-            g_hHeap, 0, g_hooks.pItems, (g_hooks.capacity * 2) * sizeof(HOOK_ENTRY));
+            g_hHeap, 0, g_hooks.pItems, capacity * sizeof(HOOK_ENTRY));
         if (p == NULL)
-            return NULL;
+            return FALSE;
 
-        g_hooks.capacity *= 2;
+        g_hooks.capacity = capacity;
         g_hooks.pItems = p;
     }
 
-    return &g_hooks.pItems[g_hooks.size++];
+    if (g_hooks.indexSize < g_hooks.capacity * 2)
+    {
+        UINT *p = (UINT *)HeapAlloc(
+            g_hHeap, HEAP_ZERO_MEMORY, (g_hooks.capacity * 2) * sizeof(UINT));
+        if (p == NULL)
+            return FALSE;
+
+        if (g_hooks.pIndex != NULL)
+            HeapFree(g_hHeap, 0, g_hooks.pIndex);
+
+        g_hooks.pIndex = p;
+        g_hooks.indexSize = g_hooks.capacity * 2;
+
+        for (i = 0; i < g_hooks.size; ++i)
+            g_hooks.pIndex[FindIndexSlot(g_hooks.pItems[i].pTarget)] = i + 1;
+    }
+
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------
+static PHOOK_ENTRY AddHookEntry(LPVOID pTarget)
+{
+    PHOOK_ENTRY pHook;
+
+    if (!ReserveHookEntries(1))
+        return NULL;
+
+    pHook = &g_hooks.pItems[g_hooks.size];
+    pHook->pTarget = pTarget;
+    g_hooks.pIndex[FindIndexSlot(pTarget)] = ++g_hooks.size;
+
+    return pHook;
 }
 
 //-------------------------------------------------------------------------
 static void DeleteHookEntry(UINT pos)
 {
+    RemoveIndexSlot(FindIndexSlot(g_hooks.pItems[pos].pTarget));
+
     if (pos < g_hooks.size - 1)
+    {
         g_hooks.pItems[pos] = g_hooks.pItems[g_hooks.size - 1];
+        g_hooks.pIndex[FindIndexSlot(g_hooks.pItems[pos].pTarget)] = pos + 1;
+    }
 
     g_hooks.size--;
 
@@ -173,11 +345,9 @@ static DWORD_PTR FindOldIP(PHOOK_ENTRY pHook, DWORD_PTR ip)
             return (DWORD_PTR)pHook->pTarget + pHook->oldIPs[i];
     }
 
-#if defined(_M_X64) || defined(__x86_64__)
     // Check relay function.
     if (ip == (DWORD_PTR)pHook->pDetour)
         return (DWORD_PTR)pHook->pTarget;
-#endif
 
     return 0;
 }
@@ -243,7 +413,9 @@ static void ProcessThreadIPs(HANDLE hThread, UINT pos, UINT action)
             enable = pHook->queueEnable;
             break;
         }
-        if (pHook->isEnabled == enable)
+        // A thread may still be on the long jump of an atomic hook that has
+        // been disabled, which is about to be removed.
+        if (pHook->isEnabled == enable && (enable || !pHook->paddingPatched))
             continue;
 
         if (enable)
@@ -259,10 +431,121 @@ static void ProcessThreadIPs(HANDLE hThread, UINT pos, UINT action)
     }
 }
 
+//-------------------------------------------------------------------------
+static BOOL AddThreadId(PFROZEN_THREADS pThreads, DWORD threadId)
+{
+    if (pThreads->pItems == NULL)
+    {
+        pThreads->capacity = INITIAL_THREAD_CAPACITY;
+        pThreads->pItems
+            = (LPDWORD)HeapAlloc(g_hHeap, 0, pThreads->capacity * sizeof(DWORD));
+        if (pThreads->pItems == NULL)
+            return FALSE;
+    }
+    else if (pThreads->size >= pThreads->capacity)
+    {
+        LPDWORD p = (LPDWORD)HeapReAlloc(
+            g_hHeap, 0, pThreads->pItems, (pThreads->capacity * 2) * sizeof(DWORD));
+        if (p == NULL)
+            return FALSE;
+
+        pThreads->capacity *= 2;
+        pThreads->pItems = p;
+    }
+    pThreads->pItems[pThreads->size++] = threadId;
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------
+// Lists the threads of this process from one NtQuerySystemInformation()
+// call, which is much quicker than walking a toolhelp snapshot of the whole
+// system. Returns FALSE if it isn't available.
+static BOOL EnumerateThreadsNt(PFROZEN_THREADS pThreads)
+{
+    static NTQUERYSYSTEMINFORMATION pNtQuerySystemInformation = NULL;
+    static BOOL resolved = FALSE;
+
+    ULONG  bufferSize = 0x40000;
+    LPBYTE pBuffer;
+    LONG   status;
+    BOOL   result = FALSE;
+
+    if (!resolved)
+    {
+        HMODULE hNtdll = GetModuleHandleW(L"ntdll.dll");
+        if (hNtdll != NULL)
+        {
+            pNtQuerySystemInformation = (NTQUERYSYSTEMINFORMATION)GetProcAddress(
+                hNtdll, "NtQuerySystemInformation");
+        }
+        resolved = TRUE;
+    }
+
+    if (pNtQuerySystemInformation == NULL)
+        return FALSE;
+
+    for (;;)
+    {
+        ULONG needed = 0;
+
+        pBuffer = (LPBYTE)HeapAlloc(g_hHeap, 0, bufferSize);
+        if (pBuffer == NULL)
+            return FALSE;
+
+        status = pNtQuerySystemInformation(
+            MH_SYSTEM_PROCESS_INFORMATION_CLASS, pBuffer, bufferSize, &needed);
+        if (status != MH_STATUS_INFO_LENGTH_MISMATCH)
+            break;
+
+        // Leave room for processes and threads started in the meantime.
+        HeapFree(g_hHeap, 0, pBuffer);
+        bufferSize = (needed > bufferSize ? needed : bufferSize) + 0x10000;
+    }
+
+    if (status >= 0)
+    {
+        PMH_SYSTEM_PROCESS_INFORMATION pProcess = (PMH_SYSTEM_PROCESS_INFORMATION)pBuffer;
+        DWORD processId = GetCurrentProcessId();
+        DWORD threadId  = GetCurrentThreadId();
+
+        for (;;)
+        {
+            if ((DWORD)(ULONG_PTR)pProcess->UniqueProcessId == processId)
+            {
+                PMH_SYSTEM_THREAD_INFORMATION pThread
+                    = (PMH_SYSTEM_THREAD_INFORMATION)(pProcess + 1);
+                ULONG i;
+
+                for (i = 0; i < pProcess->NumberOfThreads; ++i)
+                {
+                    DWORD id = (DWORD)(ULONG_PTR)pThread[i].UniqueThread;
+                    if (id != threadId && !AddThreadId(pThreads, id))
+                        break;
+                }
+                result = TRUE;
+                break;
+            }
+
+            if (pProcess->NextEntryOffset == 0)
+                break;
+
+            pProcess = (PMH_SYSTEM_PROCESS_INFORMATION)((LPBYTE)pProcess + pProcess->NextEntryOffset);
+        }
+    }
+
+    HeapFree(g_hHeap, 0, pBuffer);
+    return result;
+}
+
 //-------------------------------------------------------------------------
 static VOID EnumerateThreads(PFROZEN_THREADS pThreads)
 {
-    HANDLE hSnapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    HANDLE hSnapshot;
+
+    if (EnumerateThreadsNt(pThreads))
+        return;
+
+    hSnapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
     if (hSnapshot != INVALID_HANDLE_VALUE)
     {
         THREADENTRY32 te;
@@ -275,25 +558,8 @@ static VOID EnumerateThreads(PFROZEN_THREADS pThreads)
                     && te.th32OwnerProcessID == GetCurrentProcessId()
                     && te.th32ThreadID != GetCurrentThreadId())
                 {
-                    if (pThreads->pItems == NULL)
-                    {
-                        pThreads->capacity = INITIAL_THREAD_CAPACITY;
-                        pThreads->pItems
-                            = (LPDWORD)HeapAlloc(g_hHeap, 0, pThreads->capacity * sizeof(DWORD));
-                        if (pThreads->pItems == NULL)
-                            break;
-                    }
-                    else if (pThreads->size >= pThreads->capacity)
-                    {
-                        LPDWORD p = (LPDWORD)HeapReAlloc(
-                            g_hHeap, 0, pThreads->pItems, (pThreads->capacity * 2) * sizeof(DWORD));
-                        if (p == NULL)
-                            break;
-
-                        pThreads->capacity *= 2;
-                        pThreads->pItems = p;
-                    }
-                    pThreads->pItems[pThreads->size++] = te.th32ThreadID;
+                    if (!AddThreadId(pThreads, te.th32ThreadID))
+                        break;
                 }
 
                 te.dwSize = sizeof(THREADENTRY32);
@@ -348,23 +614,72 @@ static VOID Unfreeze(PFROZEN_THREADS pThreads)
 }
 
 //-------------------------------------------------------------------------
-static MH_STATUS EnableHookLL(UINT pos, BOOL enable)
+static VOID GetPatchRange(PHOOK_ENTRY pHook, LPBYTE *ppPatchTarget, SIZE_T *pPatchSize)
 {
-    PHOOK_ENTRY pHook = &g_hooks.pItems[pos];
-    DWORD  oldProtect;
-    SIZE_T patchSize    = sizeof(JMP_REL);
-    LPBYTE pPatchTarget = (LPBYTE)pHook->pTarget;
+    *ppPatchTarget = (LPBYTE)pHook->pTarget;
+    *pPatchSize    = sizeof(JMP_REL);
 
     if (pHook->patchAbove)
     {
-        pPatchTarget -= sizeof(JMP_REL);
-        patchSize    += sizeof(JMP_REL_SHORT);
+        *ppPatchTarget -= sizeof(JMP_REL);
+        *pPatchSize    += sizeof(JMP_REL_SHORT);
     }
+}
 
-    if (!VirtualProtect(pPatchTarget, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect))
-        return MH_ERROR_MEMORY_PROTECT;
+//-------------------------------------------------------------------------
+// Replaces the two bytes at pAddress by a locked write of the aligned 8-byte
+// word holding them, so that a thread running the code sees either the old
+// or the new instruction.
+static VOID WriteAtomic2(LPBYTE pAddress, const UINT8 *pBytes)
+{
+    LONG64 volatile *pWord = (LONG64 volatile *)((ULONG_PTR)pAddress & ~(ULONG_PTR)7);
+    UINT   offset = (UINT)((ULONG_PTR)pAddress & 7);
+    LONG64 oldWord;
+    LONG64 newWord;
 
-    if (enable)
+    do
+    {
+        oldWord = *pWord;
+        newWord = oldWord;
+        memcpy((LPBYTE)&newWord + offset, pBytes, 2);
+    } while (InterlockedCompareExchange64(pWord, newWord, oldWord) != oldWord);
+}
+
+//-------------------------------------------------------------------------
+// Writes the patch of a hook, which must already be writable.
+static VOID WritePatch(PHOOK_ENTRY pHook, BOOL enable)
+{
+    LPBYTE pPatchTarget;
+    SIZE_T patchSize;
+
+    GetPatchRange(pHook, &pPatchTarget, &patchSize);
+
+    if (pHook->atomicPatch)
+    {
+        // The long jump in the padding is written once and left there, so
+        // that only the short jump at the target is ever switched. The relay
+        // it points to doesn't move.
+        if (enable && !pHook->paddingPatched)
+        {
+            PJMP_REL pJmp = (PJMP_REL)pPatchTarget;
+            pJmp->opcode = 0xE9;
+            pJmp->operand = (UINT32)((LPBYTE)pHook->pDetour - (pPatchTarget + sizeof(JMP_REL)));
+            pHook->paddingPatched = TRUE;
+        }
+
+        if (enable)
+        {
+            UINT8 shortJmp[2];
+            shortJmp[0] = 0xEB;
+            shortJmp[1] = (UINT8)(0 - (sizeof(JMP_REL_SHORT) + sizeof(JMP_REL)));
+            WriteAtomic2((LPBYTE)pHook->pTarget, shortJmp);
+        }
+        else
+        {
+            WriteAtomic2((LPBYTE)pHook->pTarget, pHook->backup + sizeof(JMP_REL));
+        }
+    }
+    else if (enable)
     {
         PJMP_REL pJmp = (PJMP_REL)pPatchTarget;
         pJmp->opcode = 0xE9;
@@ -379,56 +694,220 @@ static MH_STATUS EnableHookLL(UINT pos, BOOL enable)
     }
     else
     {
-        if (pHook->patchAbove)
-            memcpy(pPatchTarget, pHook->backup, sizeof(JMP_REL) + sizeof(JMP_REL_SHORT));
-        else
-            memcpy(pPatchTarget, pHook->backup, sizeof(JMP_REL));
+        memcpy(pPatchTarget, pHook->backup, patchSize);
     }
 
+    pHook->isEnabled   = enable;
+    pHook->queueEnable = enable;
+}
+
+//-------------------------------------------------------------------------
+static MH_STATUS EnableHookLL(UINT pos, BOOL enable)
+{
+    PHOOK_ENTRY pHook = &g_hooks.pItems[pos];
+    DWORD  oldProtect;
+    SIZE_T patchSize;
+    LPBYTE pPatchTarget;
+
+    GetPatchRange(pHook, &pPatchTarget, &patchSize);
+
+    if (!VirtualProtect(pPatchTarget, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect))
+        return MH_ERROR_MEMORY_PROTECT;
+
+    WritePatch(pHook, enable);
+
     VirtualProtect(pPatchTarget, patchSize, oldProtect, &oldProtect);
 
     // Just-in-case measure.
     FlushInstructionCache(GetCurrentProcess(), pPatchTarget, patchSize);
 
-    pHook->isEnabled   = enable;
-    pHook->queueEnable = enable;
+    return MH_OK;
+}
+
+//-------------------------------------------------------------------------
+// Puts back the padding above a disabled atomic hook. The threads must be
+// frozen, since one may have taken the short jump just before it went away.
+static MH_STATUS RestorePaddingLL(UINT pos)
+{
+    PHOOK_ENTRY pHook = &g_hooks.pItems[pos];
+    DWORD  oldProtect;
+    LPBYTE pPadding = (LPBYTE)pHook->pTarget - sizeof(JMP_REL);
+
+    if (!VirtualProtect(pPadding, sizeof(JMP_REL), PAGE_EXECUTE_READWRITE, &oldProtect))
+        return MH_ERROR_MEMORY_PROTECT;
+
+    memcpy(pPadding, pHook->backup, sizeof(JMP_REL));
+    pHook->paddingPatched = FALSE;
+
+    VirtualProtect(pPadding, sizeof(JMP_REL), oldProtect, &oldProtect);
+
+    FlushInstructionCache(GetCurrentProcess(), pPadding, sizeof(JMP_REL));
 
     return MH_OK;
 }
 
 //-------------------------------------------------------------------------
-static MH_STATUS EnableAllHooksLL(BOOL enable)
+// Enables or disables all the hooks that action changes as one transaction:
+// the threads are frozen once, each run of patches lying in one region of
+// memory with the same protection is made writable and flushed once, and if
+// any protection can't be changed no hook is touched. The threads are left
+// running if all the hooks changed are atomic.
+static MH_STATUS EnableHooksLL(UINT action)
 {
-    MH_STATUS status = MH_OK;
-    UINT i, first = INVALID_HOOK_POS;
+    MH_STATUS      status = MH_OK;
+    PHOOK_PATCH    pPatches;
+    PPATCH_RANGE   pRanges;
+    FROZEN_THREADS threads;
+    BOOL freeze = FALSE;
+    UINT i, j, gap, count = 0, rangeCount = 0, protectedCount;
 
     for (i = 0; i < g_hooks.size; ++i)
     {
-        if (g_hooks.pItems[i].isEnabled != enable)
+        PHOOK_ENTRY pHook = &g_hooks.pItems[i];
+        BOOL enable = (action == ACTION_APPLY_QUEUED) ? pHook->queueEnable : (action == ACTION_ENABLE);
+        if (pHook->isEnabled != enable)
         {
-            first = i;
-            break;
+            count++;
+            if (!pHook->atomicPatch)
+                freeze = TRUE;
         }
     }
 
-    if (first != INVALID_HOOK_POS)
+    if (count == 0)
+        return MH_OK;
+
+    pPatches = (PHOOK_PATCH)HeapAlloc(g_hHeap, 0, count * sizeof(HOOK_PATCH));
+    pRanges  = (PPATCH_RANGE)HeapAlloc(g_hHeap, 0, count * sizeof(PATCH_RANGE));
+    if (pPatches == NULL || pRanges == NULL)
     {
-        FROZEN_THREADS threads;
-        Freeze(&threads, ALL_HOOKS_POS, enable ? ACTION_ENABLE : ACTION_DISABLE);
+        if (pPatches != NULL)
+            HeapFree(g_hHeap, 0, pPatches);
+        if (pRanges != NULL)
+            HeapFree(g_hHeap, 0, pRanges);
+        return MH_ERROR_MEMORY_ALLOC;
+    }
 
-        for (i = first; i < g_hooks.size; ++i)
+    for (i = 0, j = 0; i < g_hooks.size; ++i)
+    {
+        PHOOK_ENTRY pHook = &g_hooks.pItems[i];
+        BOOL enable = (action == ACTION_APPLY_QUEUED) ? pHook->queueEnable : (action == ACTION_ENABLE);
+        if (pHook->isEnabled != enable)
         {
-            if (g_hooks.pItems[i].isEnabled != enable)
-            {
-                status = EnableHookLL(i, enable);
-                if (status != MH_OK)
-                    break;
-            }
+            pPatches[j].pos = i;
+            GetPatchRange(pHook, &pPatches[j].pAddress, &pPatches[j].size);
+            j++;
+        }
+    }
+
+    // Shell sort the patches by address, so that neighbours can share a range.
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; ++i)
+        {
+            HOOK_PATCH patch = pPatches[i];
+            for (j = i; j >= gap && pPatches[j - gap].pAddress > patch.pAddress; j -= gap)
+                pPatches[j] = pPatches[j - gap];
+            pPatches[j] = patch;
+        }
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        MEMORY_BASIC_INFORMATION mbi;
+        LPBYTE pRegionEnd = NULL;
+        LPBYTE pStart = pPatches[i].pAddress;
+        LPBYTE pEnd = pPatches[i].pAddress + pPatches[i].size;
+
+        if (VirtualQuery(pPatches[i].pAddress, &mbi, sizeof(mbi)) != 0)
+            pRegionEnd = (LPBYTE)mbi.BaseAddress + mbi.RegionSize;
+
+        // Take in the following patches in the same region.
+        while (i + 1 < count
+            && pPatches[i + 1].pAddress + pPatches[i + 1].size <= pRegionEnd)
+        {
+            ++i;
+            if (pPatches[i].pAddress + pPatches[i].size > pEnd)
+                pEnd = pPatches[i].pAddress + pPatches[i].size;
+        }
+
+        pRanges[rangeCount].pAddress = pStart;
+        pRanges[rangeCount].size     = (SIZE_T)(pEnd - pStart);
+        rangeCount++;
+    }
+
+    if (freeze)
+        Freeze(&threads, ALL_HOOKS_POS, action);
+
+    for (protectedCount = 0; protectedCount < rangeCount; ++protectedCount)
+    {
+        PPATCH_RANGE pRange = &pRanges[protectedCount];
+        if (!VirtualProtect(pRange->pAddress, pRange->size, PAGE_EXECUTE_READWRITE, &pRange->oldProtect))
+        {
+            status = MH_ERROR_MEMORY_PROTECT;
+            break;
         }
+    }
 
+    if (status == MH_OK)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            PHOOK_ENTRY pHook = &g_hooks.pItems[pPatches[i].pos];
+            WritePatch(pHook, (action == ACTION_APPLY_QUEUED) ? pHook->queueEnable : (action == ACTION_ENABLE));
+        }
+    }
+
+    // Restore the ranges made writable, all of them or up to the failure.
+    for (j = 0; j < protectedCount; ++j)
+    {
+        DWORD oldProtect;
+        VirtualProtect(pRanges[j].pAddress, pRanges[j].size, pRanges[j].oldProtect, &oldProtect);
+        if (status == MH_OK)
+            FlushInstructionCache(GetCurrentProcess(), pRanges[j].pAddress, pRanges[j].size);
+    }
+
+    if (freeze)
         Unfreeze(&threads);
+
+    HeapFree(g_hHeap, 0, pPatches);
+    HeapFree(g_hHeap, 0, pRanges);
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+static MH_STATUS EnableAllHooksLL(BOOL enable)
+{
+    return EnableHooksLL(enable ? ACTION_ENABLE : ACTION_DISABLE);
+}
+
+//-------------------------------------------------------------------------
+// Puts back the padding above all the disabled atomic hooks.
+static MH_STATUS RestoreAllPaddingLL(VOID)
+{
+    MH_STATUS      status = MH_OK;
+    FROZEN_THREADS threads;
+    UINT i;
+
+    for (i = 0; i < g_hooks.size; ++i)
+    {
+        if (g_hooks.pItems[i].paddingPatched)
+            break;
+    }
+
+    if (i == g_hooks.size)
+        return MH_OK;
+
+    Freeze(&threads, ALL_HOOKS_POS, ACTION_DISABLE);
+
+    for (; i < g_hooks.size && status == MH_OK; ++i)
+    {
+        if (g_hooks.pItems[i].paddingPatched)
+            status = RestorePaddingLL(i);
     }
 
+    Unfreeze(&threads);
+
     return status;
 }
 
@@ -502,6 +981,8 @@ MH_STATUS WINAPI MH_Uninitialize(VOID)
     if (g_hHeap != NULL)
     {
         status = EnableAllHooksLL(FALSE);
+        if (status == MH_OK)
+            status = RestoreAllPaddingLL();
         if (status == MH_OK)
         {
             // Free the internal function buffer.
@@ -510,15 +991,19 @@ MH_STATUS WINAPI MH_Uninitialize(VOID)
             // memory leak without HeapFree.
 
             UninitializeBuffer();
+            UninitializeInstrument();
 
             HeapFree(g_hHeap, 0, g_hooks.pItems);
+            HeapFree(g_hHeap, 0, g_hooks.pIndex);
             HeapDestroy(g_hHeap);
 
             g_hHeap = NULL;
 
-            g_hooks.pItems   = NULL;
-            g_hooks.capacity = 0;
-            g_hooks.size     = 0;
+            g_hooks.pItems    = NULL;
+            g_hooks.capacity  = 0;
+            g_hooks.size      = 0;
+            g_hooks.pIndex    = NULL;
+            g_hooks.indexSize = 0;
         }
     }
     else
@@ -532,92 +1017,148 @@ MH_STATUS WINAPI MH_Uninitialize(VOID)
 }
 
 //-------------------------------------------------------------------------
-MH_STATUS WINAPI MH_CreateHook(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal)
+static MH_STATUS CreateHookLL(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal, UINT flags)
 {
     MH_STATUS status = MH_OK;
 
-    EnterSpinLock();
-
-    if (g_hHeap != NULL)
+    if (IsExecutableAddress(pTarget) && IsExecutableAddress(pDetour))
     {
-        if (IsExecutableAddress(pTarget) && IsExecutableAddress(pDetour))
+        UINT pos = FindHookEntry(pTarget);
+        if (pos == INVALID_HOOK_POS)
         {
-            UINT pos = FindHookEntry(pTarget);
-            if (pos == INVALID_HOOK_POS)
+            LPVOID pBuffer = AllocateBuffer(pTarget);
+            if (pBuffer != NULL)
             {
-                LPVOID pBuffer = AllocateBuffer(pTarget);
-                if (pBuffer != NULL)
-                {
-                    TRAMPOLINE ct;
+                TRAMPOLINE ct;
 
-                    ct.pTarget     = pTarget;
-                    ct.pDetour     = pDetour;
-                    ct.pTrampoline = pBuffer;
-                    if (CreateTrampolineFunction(&ct))
+                ct.pTarget     = pTarget;
+                ct.pDetour     = pDetour;
+                ct.pTrampoline = pBuffer;
+                ct.atomicPatch = (flags & MH_HOOK_ATOMIC) != 0;
+                if (CreateTrampolineFunction(&ct))
+                {
+                    PHOOK_ENTRY pHook = AddHookEntry(ct.pTarget);
+                    if (pHook != NULL)
                     {
-                        PHOOK_ENTRY pHook = AddHookEntry();
-                        if (pHook != NULL)
+                        pHook->pDetour       = ct.pRelay;
+                        pHook->pDetourFunc   = ct.pDetour;
+                        pHook->pTrampoline   = ct.pTrampoline;
+                        pHook->ppRelayTarget = ct.ppRelayTarget;
+                        pHook->pInstrument   = NULL;
+                        pHook->patchAbove    = ct.patchAbove;
+                        pHook->isEnabled     = FALSE;
+                        pHook->queueEnable   = FALSE;
+                        pHook->atomicPatch   = ct.atomicPatch;
+                        pHook->paddingPatched = FALSE;
+                        pHook->nIP           = ct.nIP;
+                        memcpy(pHook->oldIPs, ct.oldIPs, ARRAYSIZE(ct.oldIPs));
+                        memcpy(pHook->newIPs, ct.newIPs, ARRAYSIZE(ct.newIPs));
+
+                        // Back up the target function.
+
+                        if (ct.patchAbove)
                         {
-                            pHook->pTarget     = ct.pTarget;
-#if defined(_M_X64) || defined(__x86_64__)
-                            pHook->pDetour     = ct.pRelay;
-#else
-                            pHook->pDetour     = ct.pDetour;
-#endif
-                            pHook->pTrampoline = ct.pTrampoline;
-                            pHook->patchAbove  = ct.patchAbove;
-                            pHook->isEnabled   = FALSE;
-                            pHook->queueEnable = FALSE;
-                            pHook->nIP         = ct.nIP;
-                            memcpy(pHook->oldIPs, ct.oldIPs, ARRAYSIZE(ct.oldIPs));
-                            memcpy(pHook->newIPs, ct.newIPs, ARRAYSIZE(ct.newIPs));
-
-                            // Back up the target function.
-
-                            if (ct.patchAbove)
-                            {
-                                memcpy(
-                                    pHook->backup,
-                                    (LPBYTE)pTarget - sizeof(JMP_REL),
-                                    sizeof(JMP_REL) + sizeof(JMP_REL_SHORT));
-                            }
-                            else
-                            {
-                                memcpy(pHook->backup, pTarget, sizeof(JMP_REL));
-                            }
-
-                            if (ppOriginal != NULL)
-                                *ppOriginal = pHook->pTrampoline;
+                            memcpy(
+                                pHook->backup,
+                                (LPBYTE)pTarget - sizeof(JMP_REL),
+                                sizeof(JMP_REL) + sizeof(JMP_REL_SHORT));
                         }
                         else
                         {
-                            status = MH_ERROR_MEMORY_ALLOC;
+                            memcpy(pHook->backup, pTarget, sizeof(JMP_REL));
                         }
+
+                        if (ppOriginal != NULL)
+                            *ppOriginal = pHook->pTrampoline;
                     }
                     else
                     {
-                        status = MH_ERROR_UNSUPPORTED_FUNCTION;
-                    }
-
-                    if (status != MH_OK)
-                    {
-                        FreeBuffer(pBuffer);
+                        status = MH_ERROR_MEMORY_ALLOC;
                     }
                 }
                 else
                 {
-                    status = MH_ERROR_MEMORY_ALLOC;
+                    status = MH_ERROR_UNSUPPORTED_FUNCTION;
+                }
+
+                if (status != MH_OK)
+                {
+                    FreeBuffer(pBuffer);
                 }
             }
             else
             {
-                status = MH_ERROR_ALREADY_CREATED;
+                status = MH_ERROR_MEMORY_ALLOC;
             }
         }
         else
         {
-            status = MH_ERROR_NOT_EXECUTABLE;
+            status = MH_ERROR_ALREADY_CREATED;
+        }
+    }
+    else
+    {
+        status = MH_ERROR_NOT_EXECUTABLE;
+    }
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_CreateHook(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal)
+{
+    return MH_CreateHookEx(pTarget, pDetour, ppOriginal, 0);
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_CreateHookEx(LPVOID pTarget, LPVOID pDetour, LPVOID *ppOriginal, UINT flags)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
+
+    if (g_hHeap != NULL)
+    {
+        status = CreateHookLL(pTarget, pDetour, ppOriginal, flags);
+    }
+    else
+    {
+        status = MH_ERROR_NOT_INITIALIZED;
+    }
+
+    LeaveSpinLock();
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_CreateHooks(MH_HOOK_DESC *pHooks, UINT count)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
+
+    if (g_hHeap != NULL)
+    {
+        UINT i;
+
+        // Grow the entries once for all of them. If that fails, the hooks
+        // that still fit are created one by one.
+        ReserveHookEntries(count);
+
+        // Targets and detours tend to share a few code sections, which are
+        // then queried once for the whole batch.
+        CacheExecutableRegions(TRUE);
+
+        for (i = 0; i < count; ++i)
+        {
+            pHooks[i].status = CreateHookLL(
+                pHooks[i].pTarget, pHooks[i].pDetour, pHooks[i].ppOriginal, pHooks[i].flags);
+            if (status == MH_OK)
+                status = pHooks[i].status;
         }
+
+        CacheExecutableRegions(FALSE);
     }
     else
     {
@@ -641,12 +1182,16 @@ MH_STATUS WINAPI MH_RemoveHook(LPVOID pTarget)
         UINT pos = FindHookEntry(pTarget);
         if (pos != INVALID_HOOK_POS)
         {
-            if (g_hooks.pItems[pos].isEnabled)
+            if (g_hooks.pItems[pos].isEnabled || g_hooks.pItems[pos].paddingPatched)
             {
                 FROZEN_THREADS threads;
                 Freeze(&threads, pos, ACTION_DISABLE);
 
-                status = EnableHookLL(pos, FALSE);
+                if (g_hooks.pItems[pos].isEnabled)
+                    status = EnableHookLL(pos, FALSE);
+
+                if (status == MH_OK && g_hooks.pItems[pos].paddingPatched)
+                    status = RestorePaddingLL(pos);
 
                 Unfreeze(&threads);
             }
@@ -654,6 +1199,8 @@ MH_STATUS WINAPI MH_RemoveHook(LPVOID pTarget)
             if (status == MH_OK)
             {
                 FreeBuffer(g_hooks.pItems[pos].pTrampoline);
+                if (g_hooks.pItems[pos].pInstrument != NULL)
+                    FreeInstrumentThunk(g_hooks.pItems[pos].pInstrument);
                 DeleteHookEntry(pos);
             }
         }
@@ -693,11 +1240,19 @@ static MH_STATUS EnableHook(LPVOID pTarget, BOOL enable)
             {
                 if (g_hooks.pItems[pos].isEnabled != enable)
                 {
-                    Freeze(&threads, pos, ACTION_ENABLE);
+                    if (g_hooks.pItems[pos].atomicPatch)
+                    {
+                        // No thread can see a half-written patch.
+                        status = EnableHookLL(pos, enable);
+                    }
+                    else
+                    {
+                        Freeze(&threads, pos, enable ? ACTION_ENABLE : ACTION_DISABLE);
 
-                    status = EnableHookLL(pos, enable);
+                        status = EnableHookLL(pos, enable);
 
-                    Unfreeze(&threads);
+                        Unfreeze(&threads);
+                    }
                 }
                 else
                 {
@@ -786,39 +1341,127 @@ MH_STATUS WINAPI MH_QueueDisableHook(LPVOID pTarget)
 MH_STATUS WINAPI MH_ApplyQueued(VOID)
 {
     MH_STATUS status = MH_OK;
-    UINT i, first = INVALID_HOOK_POS;
 
     EnterSpinLock();
 
     if (g_hHeap != NULL)
     {
-        for (i = 0; i < g_hooks.size; ++i)
+        status = EnableHooksLL(ACTION_APPLY_QUEUED);
+    }
+    else
+    {
+        status = MH_ERROR_NOT_INITIALIZED;
+    }
+
+    LeaveSpinLock();
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_GetHookSwitch(LPVOID pTarget, MH_HOOK_SWITCH *pSwitch)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
+
+    if (g_hHeap != NULL)
+    {
+        UINT pos = FindHookEntry(pTarget);
+        if (pos != INVALID_HOOK_POS)
         {
-            if (g_hooks.pItems[i].isEnabled != g_hooks.pItems[i].queueEnable)
+            pSwitch->ppRelayTarget = g_hooks.pItems[pos].ppRelayTarget;
+            pSwitch->pDetour       = g_hooks.pItems[pos].pDetourFunc;
+            pSwitch->pOriginal     = g_hooks.pItems[pos].pTrampoline;
+        }
+        else
+        {
+            status = MH_ERROR_NOT_CREATED;
+        }
+    }
+    else
+    {
+        status = MH_ERROR_NOT_INITIALIZED;
+    }
+
+    LeaveSpinLock();
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+VOID WINAPI MH_SetHookSwitch(const MH_HOOK_SWITCH *pSwitch, BOOL on)
+{
+    // An aligned pointer-sized store, which the relay function picks up on
+    // its next call without any thread having to be suspended.
+    InterlockedExchangePointer(pSwitch->ppRelayTarget, on ? pSwitch->pDetour : pSwitch->pOriginal);
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_CreateInstrumentHook(LPVOID pTarget, UINT flags)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
+
+    if (g_hHeap != NULL)
+    {
+        LPVOID pThunk = CreateInstrumentThunk(pTarget);
+        if (pThunk != NULL)
+        {
+            LPVOID pTrampoline;
+            status = CreateHookLL(pTarget, pThunk, &pTrampoline, flags);
+            if (status == MH_OK)
             {
-                first = i;
-                break;
+                SetInstrumentTrampoline(pThunk, pTrampoline);
+                g_hooks.pItems[FindHookEntry(pTarget)].pInstrument = pThunk;
+            }
+            else
+            {
+                FreeInstrumentThunk(pThunk);
             }
         }
+        else
+        {
+            status = MH_ERROR_MEMORY_ALLOC;
+        }
+    }
+    else
+    {
+        status = MH_ERROR_NOT_INITIALIZED;
+    }
+
+    LeaveSpinLock();
+
+    return status;
+}
+
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_GetInstrumentCounters(MH_INSTRUMENT_COUNTERS *pCounters, UINT *pCount)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
 
-        if (first != INVALID_HOOK_POS)
+    if (g_hHeap != NULL)
+    {
+        UINT i, count = 0;
+        for (i = 0; i < g_hooks.size; ++i)
         {
-            FROZEN_THREADS threads;
-            Freeze(&threads, ALL_HOOKS_POS, ACTION_APPLY_QUEUED);
+            PHOOK_ENTRY pHook = &g_hooks.pItems[i];
+            if (pHook->pInstrument == NULL)
+                continue;
 
-            for (i = first; i < g_hooks.size; ++i)
+            if (count < *pCount)
             {
-                PHOOK_ENTRY pHook = &g_hooks.pItems[i];
-                if (pHook->isEnabled != pHook->queueEnable)
-                {
-                    status = EnableHookLL(i, pHook->queueEnable);
-                    if (status != MH_OK)
-                        break;
-                }
+                pCounters[count].pTarget = pHook->pTarget;
+                GetInstrumentCounters(
+                    pHook->pInstrument, &pCounters[count].callCount, &pCounters[count].cycleCount);
             }
-
-            Unfreeze(&threads);
+            count++;
         }
+
+        *pCount = count;
     }
     else
     {
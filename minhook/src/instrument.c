@@ -0,0 +1,429 @@
+﻿/*
+ *  MinHook - The Minimalistic API Hooking Library for x64/x86
+ *  Copyright (C) 2009-2017 Tsuda Kageyu.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ *  TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ *  PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ *  OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <windows.h>
+#include <intrin.h>
+#include "buffer.h"
+#include "instrument.h"
+
+// Max number of the instrumented targets, whose counters are kept per thread
+// in chunks of INSTRUMENT_CHUNK_SIZE.
+#define INSTRUMENT_CHUNK_SIZE  256
+#define INSTRUMENT_MAX_CHUNKS  256
+
+// Max depth of the nested instrumented calls timed per thread. The calls
+// deeper than this are counted, but not timed.
+#define INSTRUMENT_STACK_DEPTH 64
+
+// Size of the code of a thunk, followed by its data.
+#define INSTRUMENT_CODE_SIZE   24
+
+// Thread local storage value while the data of the thread is allocated.
+#define INSTRUMENT_THREAD_BUSY ((PINSTRUMENT_THREAD)1)
+
+// Counters of an instrumented target in one thread.
+typedef struct _INSTRUMENT_COUNTERS
+{
+    UINT64 callCount;
+    UINT64 cycleCount;
+} INSTRUMENT_COUNTERS, *PINSTRUMENT_COUNTERS;
+
+// An instrumented call in progress.
+typedef struct _INSTRUMENT_FRAME
+{
+    PINSTRUMENT_COUNTERS pCounters;
+    LPVOID pReturn;             // Return address of the caller.
+    UINT64 start;               // Time stamp counter at the call.
+} INSTRUMENT_FRAME, *PINSTRUMENT_FRAME;
+
+// Per-thread data, in the thread local storage slot. Never freed until
+// UninitializeInstrument(), so that the counters outlive the thread.
+typedef struct _INSTRUMENT_THREAD
+{
+    struct _INSTRUMENT_THREAD *pNext;
+    UINT depth;
+    UINT busy;                  // Allocating, so instrumented calls are ignored.
+    INSTRUMENT_FRAME stack[INSTRUMENT_STACK_DEPTH];
+    PINSTRUMENT_COUNTERS pChunks[INSTRUMENT_MAX_CHUNKS];
+} INSTRUMENT_THREAD, *PINSTRUMENT_THREAD;
+
+// Instrumentation thunk, placed in a memory slot. The common entry code
+// reaches pTrampoline at offset INSTRUMENT_CODE_SIZE.
+typedef struct _INSTRUMENT
+{
+    UINT8  code[INSTRUMENT_CODE_SIZE];
+    LPVOID pTrampoline;
+    UINT   id;
+} INSTRUMENT, *PINSTRUMENT;
+
+#if defined(_M_X64) || defined(__x86_64__)
+// Code shared by the thunks, which load their INSTRUMENT into rax and jump
+// here. It saves the registers that may hold arguments, records the call and
+// jumps to the trampoline with the stack as the caller left it.
+static const UINT8 InstrumentEntry[] = {
+    0x51,                               // push rcx
+    0x52,                               // push rdx
+    0x41, 0x50,                         // push r8
+    0x41, 0x51,                         // push r9
+    0x50,                               // push rax
+    0x48, 0x83, 0xEC, 0x60,             // sub rsp, 0x60
+    0xF3, 0x0F, 0x7F, 0x44, 0x24, 0x20, // movdqu [rsp+0x20], xmm0
+    0xF3, 0x0F, 0x7F, 0x4C, 0x24, 0x30, // movdqu [rsp+0x30], xmm1
+    0xF3, 0x0F, 0x7F, 0x54, 0x24, 0x40, // movdqu [rsp+0x40], xmm2
+    0xF3, 0x0F, 0x7F, 0x5C, 0x24, 0x50, // movdqu [rsp+0x50], xmm3
+    0x48, 0x89, 0xC1,                   // mov rcx, rax
+    0x48, 0x8D, 0x94, 0x24, 0x88, 0x00, 0x00, 0x00, // lea rdx, [rsp+0x88]
+    0x48, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, // mov rax, InstrumentEnter
+    0xFF, 0xD0,                         // call rax
+    0xF3, 0x0F, 0x6F, 0x44, 0x24, 0x20, // movdqu xmm0, [rsp+0x20]
+    0xF3, 0x0F, 0x6F, 0x4C, 0x24, 0x30, // movdqu xmm1, [rsp+0x30]
+    0xF3, 0x0F, 0x6F, 0x54, 0x24, 0x40, // movdqu xmm2, [rsp+0x40]
+    0xF3, 0x0F, 0x6F, 0x5C, 0x24, 0x50, // movdqu xmm3, [rsp+0x50]
+    0x48, 0x83, 0xC4, 0x60,             // add rsp, 0x60
+    0x58,                               // pop rax
+    0x41, 0x59,                         // pop r9
+    0x41, 0x58,                         // pop r8
+    0x5A,                               // pop rdx
+    0x59,                               // pop rcx
+    0xFF, 0x60, INSTRUMENT_CODE_SIZE,   // jmp [rax+pTrampoline]
+};
+#define INSTRUMENT_ENTRY_CALL 0x30      // Offset of the InstrumentEnter address.
+
+// Code the instrumented calls return to. It saves the registers that may
+// hold return values, ends the call and returns to the caller.
+static const UINT8 InstrumentExit[] = {
+    0x50,                               // push rax (room for the return address)
+    0x50,                               // push rax
+    0x52,                               // push rdx
+    0x48, 0x83, 0xEC, 0x68,             // sub rsp, 0x68
+    0xF3, 0x0F, 0x7F, 0x44, 0x24, 0x20, // movdqu [rsp+0x20], xmm0
+    0xF3, 0x0F, 0x7F, 0x4C, 0x24, 0x30, // movdqu [rsp+0x30], xmm1
+    0xF3, 0x0F, 0x7F, 0x54, 0x24, 0x40, // movdqu [rsp+0x40], xmm2
+    0xF3, 0x0F, 0x7F, 0x5C, 0x24, 0x50, // movdqu [rsp+0x50], xmm3
+    0x48, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, // mov rax, InstrumentLeave
+    0xFF, 0xD0,                         // call rax
+    0x48, 0x89, 0x44, 0x24, 0x78,       // mov [rsp+0x78], rax
+    0xF3, 0x0F, 0x6F, 0x44, 0x24, 0x20, // movdqu xmm0, [rsp+0x20]
+    0xF3, 0x0F, 0x6F, 0x4C, 0x24, 0x30, // movdqu xmm1, [rsp+0x30]
+    0xF3, 0x0F, 0x6F, 0x54, 0x24, 0x40, // movdqu xmm2, [rsp+0x40]
+    0xF3, 0x0F, 0x6F, 0x5C, 0x24, 0x50, // movdqu xmm3, [rsp+0x50]
+    0x48, 0x83, 0xC4, 0x68,             // add rsp, 0x68
+    0x5A,                               // pop rdx
+    0x58,                               // pop rax
+    0xC3,                               // ret
+};
+#define INSTRUMENT_EXIT_CALL 0x21       // Offset of the InstrumentLeave address.
+#else
+// Code shared by the thunks, which push their INSTRUMENT and jump here. It
+// saves the registers that may hold arguments, records the call and returns
+// into the trampoline with the stack as the caller left it.
+static const UINT8 InstrumentEntry[] = {
+    0x50,                               // push eax
+    0x51,                               // push ecx
+    0x52,                               // push edx
+    0x8D, 0x44, 0x24, 0x10,             // lea eax, [esp+16]
+    0x50,                               // push eax
+    0xFF, 0x74, 0x24, 0x10,             // push dword ptr [esp+16]
+    0xB8, 0, 0, 0, 0,                   // mov eax, InstrumentEnter
+    0xFF, 0xD0,                         // call eax
+    0x5A,                               // pop edx
+    0x59,                               // pop ecx
+    0x58,                               // pop eax
+    0x50,                               // push eax
+    0x8B, 0x44, 0x24, 0x04,             // mov eax, [esp+4]
+    0x8B, 0x40, INSTRUMENT_CODE_SIZE,   // mov eax, [eax+pTrampoline]
+    0x89, 0x44, 0x24, 0x04,             // mov [esp+4], eax
+    0x58,                               // pop eax
+    0xC3,                               // ret
+};
+#define INSTRUMENT_ENTRY_CALL 0x0D      // Offset of the InstrumentEnter address.
+
+// Code the instrumented calls return to. It saves the registers that may
+// hold return values, ends the call and returns to the caller.
+static const UINT8 InstrumentExit[] = {
+    0x50,                               // push eax (room for the return address)
+    0x50,                               // push eax
+    0x52,                               // push edx
+    0x51,                               // push ecx
+    0xB8, 0, 0, 0, 0,                   // mov eax, InstrumentLeave
+    0xFF, 0xD0,                         // call eax
+    0x89, 0x44, 0x24, 0x0C,             // mov [esp+12], eax
+    0x59,                               // pop ecx
+    0x5A,                               // pop edx
+    0x58,                               // pop eax
+    0xC3,                               // ret
+};
+#define INSTRUMENT_EXIT_CALL 0x05       // Offset of the InstrumentLeave address.
+#endif
+
+//-------------------------------------------------------------------------
+// Global Variables:
+//-------------------------------------------------------------------------
+
+// Private heap of the thread data. If not NULL, the rest is initialized.
+static HANDLE g_hInstrumentHeap = NULL;
+
+// Thread local storage slot of the thread data.
+static DWORD g_instrumentTls = TLS_OUT_OF_INDEXES;
+
+// Page holding InstrumentEntry and InstrumentExit.
+static LPBYTE g_pInstrumentCode = NULL;
+
+// First element of the thread data list.
+static PINSTRUMENT_THREAD volatile g_pInstrumentThreads = NULL;
+
+// Number of the ids given to thunks so far. They are not reused.
+static UINT g_instrumentCount = 0;
+
+//-------------------------------------------------------------------------
+static PINSTRUMENT_THREAD GetInstrumentThread(VOID)
+{
+    PINSTRUMENT_THREAD pThread = (PINSTRUMENT_THREAD)TlsGetValue(g_instrumentTls);
+    if (pThread == INSTRUMENT_THREAD_BUSY)
+        return NULL;
+
+    if (pThread == NULL)
+    {
+        PINSTRUMENT_THREAD pHead;
+
+        // HeapAlloc itself may be instrumented.
+        TlsSetValue(g_instrumentTls, INSTRUMENT_THREAD_BUSY);
+        pThread = (PINSTRUMENT_THREAD)HeapAlloc(
+            g_hInstrumentHeap, HEAP_ZERO_MEMORY, sizeof(INSTRUMENT_THREAD));
+        TlsSetValue(g_instrumentTls, pThread);
+        if (pThread == NULL)
+            return NULL;
+
+        do
+        {
+            pHead = g_pInstrumentThreads;
+            pThread->pNext = pHead;
+        } while (InterlockedCompareExchangePointer(
+            (PVOID volatile *)&g_pInstrumentThreads, pThread, pHead) != pHead);
+    }
+
+    return pThread;
+}
+
+//-------------------------------------------------------------------------
+// Called by InstrumentEntry. Counts the call and, if it is timed, makes it
+// return to InstrumentExit.
+static VOID WINAPI InstrumentEnter(PINSTRUMENT pInstrument, LPVOID *ppReturn)
+{
+    // The target function may depend on the last error set by the caller.
+    DWORD lastError = GetLastError();
+    PINSTRUMENT_THREAD pThread = GetInstrumentThread();
+
+    if (pThread != NULL && !pThread->busy)
+    {
+        UINT chunk = pInstrument->id / INSTRUMENT_CHUNK_SIZE;
+        PINSTRUMENT_COUNTERS pCounters = pThread->pChunks[chunk];
+        if (pCounters == NULL)
+        {
+            pThread->busy = TRUE;
+            pCounters = (PINSTRUMENT_COUNTERS)HeapAlloc(
+                g_hInstrumentHeap, HEAP_ZERO_MEMORY, INSTRUMENT_CHUNK_SIZE * sizeof(INSTRUMENT_COUNTERS));
+            pThread->pChunks[chunk] = pCounters;
+            pThread->busy = FALSE;
+        }
+
+        if (pCounters != NULL)
+        {
+            pCounters += pInstrument->id % INSTRUMENT_CHUNK_SIZE;
+            pCounters->callCount++;
+
+            if (pThread->depth < INSTRUMENT_STACK_DEPTH)
+            {
+                PINSTRUMENT_FRAME pFrame = &pThread->stack[pThread->depth++];
+                pFrame->pCounters = pCounters;
+                pFrame->pReturn   = *ppReturn;
+                *ppReturn = g_pInstrumentCode + sizeof(InstrumentEntry);
+                pFrame->start = __rdtsc();
+            }
+        }
+    }
+
+    SetLastError(lastError);
+}
+
+//-------------------------------------------------------------------------
+// Called by InstrumentExit. Ends the innermost timed call and returns the
+// address to return to.
+static LPVOID WINAPI InstrumentLeave(VOID)
+{
+    UINT64 end = __rdtsc();
+    DWORD  lastError = GetLastError();
+    PINSTRUMENT_THREAD pThread = (PINSTRUMENT_THREAD)TlsGetValue(g_instrumentTls);
+    PINSTRUMENT_FRAME  pFrame = &pThread->stack[--pThread->depth];
+
+    pFrame->pCounters->cycleCount += end - pFrame->start;
+
+    SetLastError(lastError);
+
+    return pFrame->pReturn;
+}
+
+//-------------------------------------------------------------------------
+static BOOL InitializeInstrument(VOID)
+{
+    DWORD  oldProtect;
+    LPBYTE pCode;
+
+    if (g_hInstrumentHeap != NULL)
+        return TRUE;
+
+    g_instrumentTls = TlsAlloc();
+    if (g_instrumentTls == TLS_OUT_OF_INDEXES)
+        return FALSE;
+
+    pCode = (LPBYTE)VirtualAlloc(
+        NULL, sizeof(InstrumentEntry) + sizeof(InstrumentExit), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (pCode == NULL)
+    {
+        TlsFree(g_instrumentTls);
+        g_instrumentTls = TLS_OUT_OF_INDEXES;
+        return FALSE;
+    }
+
+    memcpy(pCode, InstrumentEntry, sizeof(InstrumentEntry));
+    memcpy(pCode + sizeof(InstrumentEntry), InstrumentExit, sizeof(InstrumentExit));
+    *(ULONG_PTR *)(pCode + INSTRUMENT_ENTRY_CALL) = (ULONG_PTR)InstrumentEnter;
+    *(ULONG_PTR *)(pCode + sizeof(InstrumentEntry) + INSTRUMENT_EXIT_CALL) = (ULONG_PTR)InstrumentLeave;
+
+    g_hInstrumentHeap = HeapCreate(0, 0, 0);
+    if (g_hInstrumentHeap == NULL
+        || !VirtualProtect(pCode, sizeof(InstrumentEntry) + sizeof(InstrumentExit), PAGE_EXECUTE_READ, &oldProtect))
+    {
+        if (g_hInstrumentHeap != NULL)
+            HeapDestroy(g_hInstrumentHeap);
+        g_hInstrumentHeap = NULL;
+        VirtualFree(pCode, 0, MEM_RELEASE);
+        TlsFree(g_instrumentTls);
+        g_instrumentTls = TLS_OUT_OF_INDEXES;
+        return FALSE;
+    }
+
+    g_pInstrumentCode = pCode;
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------
+VOID UninitializeInstrument(VOID)
+{
+    if (g_hInstrumentHeap == NULL)
+        return;
+
+    HeapDestroy(g_hInstrumentHeap);
+    VirtualFree(g_pInstrumentCode, 0, MEM_RELEASE);
+    TlsFree(g_instrumentTls);
+
+    g_hInstrumentHeap    = NULL;
+    g_pInstrumentCode    = NULL;
+    g_instrumentTls      = TLS_OUT_OF_INDEXES;
+    g_pInstrumentThreads = NULL;
+    g_instrumentCount    = 0;
+}
+
+//-------------------------------------------------------------------------
+LPVOID CreateInstrumentThunk(LPVOID pOrigin)
+{
+    PINSTRUMENT pInstrument;
+    LPBYTE      pCode;
+
+    if (!InitializeInstrument())
+        return NULL;
+
+    if (g_instrumentCount >= INSTRUMENT_CHUNK_SIZE * INSTRUMENT_MAX_CHUNKS)
+        return NULL;
+
+    pInstrument = (PINSTRUMENT)AllocateBuffer(pOrigin);
+    if (pInstrument == NULL)
+        return NULL;
+
+    pInstrument->pTrampoline = NULL;
+    pInstrument->id = g_instrumentCount++;
+
+    pCode = pInstrument->code;
+#if defined(_M_X64) || defined(__x86_64__)
+    // mov rax, pInstrument
+    pCode[0] = 0x48;
+    pCode[1] = 0xB8;
+    *(ULONG_PTR *)(pCode + 2) = (ULONG_PTR)pInstrument;
+    // jmp [rip+0]
+    pCode[10] = 0xFF;
+    pCode[11] = 0x25;
+    *(UINT32 *)(pCode + 12) = 0;
+    *(ULONG_PTR *)(pCode + 16) = (ULONG_PTR)g_pInstrumentCode;
+#else
+    // push pInstrument
+    pCode[0] = 0x68;
+    *(ULONG_PTR *)(pCode + 1) = (ULONG_PTR)pInstrument;
+    // jmp InstrumentEntry
+    pCode[5] = 0xE9;
+    *(UINT32 *)(pCode + 6) = (UINT32)(g_pInstrumentCode - (pCode + 10));
+#endif
+
+    return pInstrument;
+}
+
+//-------------------------------------------------------------------------
+VOID SetInstrumentTrampoline(LPVOID pThunk, LPVOID pTrampoline)
+{
+    ((PINSTRUMENT)pThunk)->pTrampoline = pTrampoline;
+}
+
+//-------------------------------------------------------------------------
+VOID FreeInstrumentThunk(LPVOID pThunk)
+{
+    // The counters of its id are left in the threads, unused.
+    FreeBuffer(pThunk);
+}
+
+//-------------------------------------------------------------------------
+VOID GetInstrumentCounters(LPVOID pThunk, UINT64 *pCallCount, UINT64 *pCycleCount)
+{
+    UINT id = ((PINSTRUMENT)pThunk)->id;
+    PINSTRUMENT_THREAD pThread;
+
+    *pCallCount  = 0;
+    *pCycleCount = 0;
+
+    // The counters are read while the threads are running, so those of the
+    // calls in progress may be caught half updated.
+    for (pThread = g_pInstrumentThreads; pThread != NULL; pThread = pThread->pNext)
+    {
+        PINSTRUMENT_COUNTERS pCounters = pThread->pChunks[id / INSTRUMENT_CHUNK_SIZE];
+        if (pCounters != NULL)
+        {
+            pCounters += id % INSTRUMENT_CHUNK_SIZE;
+            *pCallCount  += pCounters->callCount;
+            *pCycleCount += pCounters->cycleCount;
+        }
+    }
+}
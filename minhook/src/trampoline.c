@@ -45,12 +45,66 @@
 #include "trampoline.h"
 #include "buffer.h"
 
-// Maximum size of a trampoline function.
-#if defined(_M_X64) || defined(__x86_64__)
-    #define TRAMPOLINE_MAX_SIZE (MEMORY_SLOT_SIZE - sizeof(JMP_ABS))
+// Maximum size of a trampoline function, leaving room in the slot for the
+// relay function and the pointer it jumps through.
+#define TRAMPOLINE_MAX_SIZE (MEMORY_SLOT_SIZE - sizeof(JMP_IND) - sizeof(LPVOID))
+
+// Number of the decoded instructions cached, a power of two.
+#define DECODE_CACHE_SIZE 256
+
+// A decoded instruction, kept with its bytes so that a change of the code is
+// noticed.
+typedef struct _DECODED_INST
+{
+    LPBYTE pAddress;
+    UINT8  bytes[16];
+    HDE    hs;
+} DECODED_INST, *PDECODED_INST;
+
+//-------------------------------------------------------------------------
+// Global Variables:
+//-------------------------------------------------------------------------
+
+// Instructions decoded by earlier calls, by address. The same prologues are
+// analysed again when a hook is removed and created again, or when a target
+// can't be hooked and is tried again.
+static DECODED_INST g_decodeCache[DECODE_CACHE_SIZE];
+
+//-------------------------------------------------------------------------
+static UINT DecodeInstruction(LPBYTE pInst, HDE *pHs)
+{
+    ULONG_PTR     hash   = (ULONG_PTR)pInst ^ ((ULONG_PTR)pInst >> 8);
+    PDECODED_INST pEntry = &g_decodeCache[hash & (DECODE_CACHE_SIZE - 1)];
+
+    if (pEntry->pAddress == pInst)
+    {
+        UINT i;
+        for (i = 0; i < pEntry->hs.len && pEntry->bytes[i] == pInst[i]; ++i)
+            ;
+
+        if (i == pEntry->hs.len)
+        {
+            *pHs = pEntry->hs;
+            return pHs->len;
+        }
+    }
+
+    HDE_DISASM(pInst, pHs);
+
+    if (!(pHs->flags & F_ERROR) && pHs->len <= sizeof(pEntry->bytes))
+    {
+        pEntry->pAddress = pInst;
+        // Avoid using memcpy to reduce the footprint.
+#ifndef _MSC_VER
+        memcpy(pEntry->bytes, pInst, pHs->len);
 #else
-    #define TRAMPOLINE_MAX_SIZE MEMORY_SLOT_SIZE
+        __movsb(pEntry->bytes, pInst, pHs->len);
 #endif
+        pEntry->hs = *pHs;
+    }
+
+    return pHs->len;
+}
 
 //-------------------------------------------------------------------------
 static BOOL IsCodePadding(LPBYTE pInst, UINT size)
@@ -101,8 +155,11 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
     };
 #endif
 
+    JMP_IND   relay;
+
     UINT8     oldPos   = 0;
     UINT8     newPos   = 0;
+    UINT8     patchSize;        // Size of the code overwritten at the target.
     ULONG_PTR jmpDest  = 0;     // Destination address of an internal jump.
     BOOL      finished = FALSE; // Is the function completed?
 #if defined(_M_X64) || defined(__x86_64__)
@@ -112,6 +169,22 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
     ct->patchAbove = FALSE;
     ct->nIP        = 0;
 
+    // A hook switched atomically overwrites only the first instruction, of at
+    // least two bytes, with a short jump to a long jump in the padding above
+    // the function. The short jump must not span the end of an aligned 8-byte
+    // word, so that it can be written in one go.
+    if (ct->atomicPatch)
+    {
+        HDE hs;
+        DecodeInstruction((LPBYTE)ct->pTarget, &hs);
+        ct->atomicPatch = !(hs.flags & F_ERROR)
+            && hs.len >= sizeof(JMP_REL_SHORT)
+            && ((ULONG_PTR)ct->pTarget & 7) != 7
+            && IsExecutableAddress((LPBYTE)ct->pTarget - sizeof(JMP_REL))
+            && IsCodePadding((LPBYTE)ct->pTarget - sizeof(JMP_REL), sizeof(JMP_REL));
+    }
+    patchSize = ct->atomicPatch ? sizeof(JMP_REL_SHORT) : sizeof(JMP_REL);
+
     do
     {
         HDE       hs;
@@ -120,12 +193,12 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
         ULONG_PTR pOldInst = (ULONG_PTR)ct->pTarget     + oldPos;
         ULONG_PTR pNewInst = (ULONG_PTR)ct->pTrampoline + newPos;
 
-        copySize = HDE_DISASM((LPVOID)pOldInst, &hs);
+        copySize = DecodeInstruction((LPBYTE)pOldInst, &hs);
         if (hs.flags & F_ERROR)
             return FALSE;
 
         pCopySrc = (LPVOID)pOldInst;
-        if (oldPos >= sizeof(JMP_REL))
+        if (oldPos >= patchSize)
         {
             // The trampoline function is long enough.
             // Complete the function with the jump to the target function.
@@ -189,7 +262,7 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
 
             // Simply copy an internal jump.
             if ((ULONG_PTR)ct->pTarget <= dest
-                && dest < ((ULONG_PTR)ct->pTarget + sizeof(JMP_REL)))
+                && dest < ((ULONG_PTR)ct->pTarget + patchSize))
             {
                 if (jmpDest < dest)
                     jmpDest = dest;
@@ -223,7 +296,7 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
 
             // Simply copy an internal jump.
             if ((ULONG_PTR)ct->pTarget <= dest
-                && dest < ((ULONG_PTR)ct->pTarget + sizeof(JMP_REL)))
+                && dest < ((ULONG_PTR)ct->pTarget + patchSize))
             {
                 if (jmpDest < dest)
                     jmpDest = dest;
@@ -283,8 +356,13 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
     }
     while (!finished);
 
+    if (ct->atomicPatch)
+    {
+        // The padding was checked above.
+        ct->patchAbove = TRUE;
+    }
     // Is there enough place for a long jump?
-    if (oldPos < sizeof(JMP_REL)
+    else if (oldPos < sizeof(JMP_REL)
         && !IsCodePadding((LPBYTE)ct->pTarget + oldPos, sizeof(JMP_REL) - oldPos))
     {
         // Is there enough place for a short jump?
@@ -304,13 +382,20 @@ BOOL CreateTrampolineFunction(PTRAMPOLINE ct)
         ct->patchAbove = TRUE;
     }
 
-#if defined(_M_X64) || defined(__x86_64__)
-    // Create a relay function.
-    jmp.address = (ULONG_PTR)ct->pDetour;
-
+    // Create a relay function. It jumps through a pointer kept at the end of
+    // the slot, so that the hook can be switched by a single aligned store.
     ct->pRelay = (LPBYTE)ct->pTrampoline + newPos;
-    memcpy(ct->pRelay, &jmp, sizeof(jmp));
+    ct->ppRelayTarget = (LPVOID *)((LPBYTE)ct->pTrampoline + MEMORY_SLOT_SIZE - sizeof(LPVOID));
+    *ct->ppRelayTarget = ct->pDetour;
+
+    relay.opcode0 = 0xFF;
+    relay.opcode1 = 0x25;
+#if defined(_M_X64) || defined(__x86_64__)
+    relay.operand = (UINT32)((LPBYTE)ct->ppRelayTarget - ((LPBYTE)ct->pRelay + sizeof(relay)));
+#else
+    relay.operand = (UINT32)ct->ppRelayTarget;
 #endif
+    memcpy(ct->pRelay, &relay, sizeof(relay));
 
     return TRUE;
 }
@@ -46,6 +46,14 @@ typedef struct _JMP_REL
     UINT32 operand;     // Relative destination address
 } JMP_REL, *PJMP_REL, CALL_REL;
 
+// Indirect jump through a pointer, used for the relay function.
+typedef struct _JMP_IND
+{
+    UINT8  opcode0;     // FF25 xxxxxxxx: JMP [+6+xxxxxxxx] (x64) / JMP [xxxxxxxx] (x86)
+    UINT8  opcode1;
+    UINT32 operand;     // Relative (x64) or absolute (x86) address of the pointer
+} JMP_IND, *PJMP_IND;
+
 // 64-bit indirect absolute jump.
 typedef struct _JMP_ABS
 {
@@ -93,9 +101,9 @@ typedef struct _TRAMPOLINE
     LPVOID pDetour;         // [In] Address of the detour function.
     LPVOID pTrampoline;     // [In] Buffer address for the trampoline and relay function.
 
-#if defined(_M_X64) || defined(__x86_64__)
     LPVOID pRelay;          // [Out] Address of the relay function.
-#endif
+    LPVOID *ppRelayTarget;  // [Out] Address of the pointer the relay function jumps through.
+    BOOL   atomicPatch;     // [In, Out] Should/can the hook be switched by one atomic write?
     BOOL   patchAbove;      // [Out] Should use the hot patch area?
     UINT   nIP;             // [Out] Number of the instruction boundaries.
     UINT8  oldIPs[8];       // [Out] Instruction boundaries of the target function.
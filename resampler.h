@@ -27,13 +27,14 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
-#include <xmmintrin.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846264338327
 #endif
 
 
+/* data_in and data_out are interleaved, with one sample per channel
+* in each frame. ratio is the output rate over the input rate. */
 struct resampler_data
    {
 	  const float *data_in;
@@ -45,57 +46,199 @@ struct resampler_data
 	  double ratio;
    };
 
+enum resampler_quality
+{
+	RESAMPLER_QUALITY_DONTCARE = 0,
+	RESAMPLER_QUALITY_LOWEST,
+	RESAMPLER_QUALITY_LOWER,
+	RESAMPLER_QUALITY_NORMAL,
+	RESAMPLER_QUALITY_HIGHER,
+	RESAMPLER_QUALITY_HIGHEST
+};
+
+/* The filter built by resampler_sinc_init_config(). Fill it in with
+* resampler_sinc_config_preset() and then change what is needed.
+*
+* The filter is 2 * sidelobes taps long, rounded up to a multiple of
+* 4. cutoff is the passband edge as a fraction of the input Nyquist
+* frequency, and kaiser_beta trades the window's transition width
+* against its stopband attenuation. The coefficient table has
+* 1 << phase_bits rows, interpolated between in 1 << subphase_bits
+* steps; the two must add up to no more than 24. */
+struct resampler_sinc_config
+{
+	unsigned channels;
+	unsigned sidelobes;
+	double cutoff;
+	double kaiser_beta;
+	unsigned phase_bits;
+	unsigned subphase_bits;
+};
+
+void resampler_sinc_config_preset(struct resampler_sinc_config *config,
+	enum resampler_quality quality, unsigned channels);
+
+/* Returns NULL if the configuration is out of range or allocation
+* fails. resampler_sinc_init() is the same with the
+* RESAMPLER_QUALITY_NORMAL preset for stereo. */
+void *resampler_sinc_init_config(const struct resampler_sinc_config *config);
 void *resampler_sinc_init();
+
+/* Fix the conversion at input_rate to output_rate, and ignore
+* data->ratio from then on. The coefficients for every phase of the
+* conversion are computed up front, which saves interpolating them
+* for each output frame and is exact where data->ratio's phase
+* stepping is not. Setting either rate to 0 goes back to following
+* data->ratio. Returns false, and leaves the ratio following
+* data->ratio, if the rates reduce to more than
+* RESAMPLER_FIXED_MAX_PHASES output frames per cycle or allocation
+* fails. */
+#define RESAMPLER_FIXED_MAX_PHASES 8192
+bool resampler_sinc_set_fixed_ratio(void *re_, unsigned input_rate,
+	unsigned output_rate);
+
 void resampler_sinc_process(void *re_, struct resampler_data *data);
+
+/* The same for 16-bit interleaved samples, converted as each one is
+* read in and each output frame is written, so there is no separate
+* pass over the buffers to convert them. Output is rounded and
+* clipped to the 16-bit range. */
+struct resampler_data_s16
+{
+	const int16_t *data_in;
+	int16_t *data_out;
+
+	size_t input_frames;
+	size_t output_frames;
+
+	double ratio;
+};
+
+void resampler_sinc_process_s16(void *re_, struct resampler_data_s16 *data);
 void resampler_sinc_free(void *re_);
 
+/* Dynamic rate control, for keeping an audio output buffer that is
+* drained by the device clock at a steady fill level when the input
+* runs from another clock (such as the video frame rate).
+*
+* Call resampler_rate_control_update() once per resampler_sinc_process()
+* call with the device buffer's current fill and size, and pass the
+* ratio it returns as data->ratio. When the buffer is fuller than
+* target_fill, the ratio is lowered to produce fewer frames; when it
+* is emptier, raised. The change is proportional to the distance from
+* target_fill, up to max_deviation either way (so 0.005 allows up to
+* 0.5%, which is not audible as a pitch change), and is smoothed by a
+* one-pole filter with coefficient smoothing (1 for no smoothing).
+*
+* The resampler takes a new data->ratio on every call with no
+* recomputation, and keeps its phase from one call to the next, so
+* the ratio can change as often as needed without glitches. It must
+* not be in fixed ratio mode. */
+struct resampler_rate_control
+{
+	double ratio;
+	double max_deviation;
+	double target_fill;
+	double smoothing;
+	double adjust;
+};
+
+/* Sets target_fill to 0.5 and smoothing to 0.1, which can be changed
+* afterwards. */
+void resampler_rate_control_init(struct resampler_rate_control *rc,
+	double ratio, double max_deviation);
+double resampler_rate_control_update(struct resampler_rate_control *rc,
+	size_t buffer_fill, size_t buffer_size);
+
 #endif
 
 #ifdef RESAMPLER_IMPLEMENTATION
 #undef RESAMPLER_IMPLEMENTATION
 
-#define SINC_WINDOW_KAISER
-#define SINC_WINDOW_KAISER_BETA 5.5
-#define CUTOFF 0.825
-#define PHASE_BITS 8
-#define SUBPHASE_BITS 16
-#define SINC_COEFF_LERP 1
-#define SIDELOBES 8
-#define ENABLE_AVX 0
+/* The sinc kernel is built for every instruction set the target
+* architecture might have, and resampler_sinc_init() picks the widest
+* one the CPU supports, as reported by cpu_features() (so the
+* CPU_FEATURES environment variable can hold it back). Define
+* RESAMPLER_NO_SIMD to use only the plain C kernel, or
+* RESAMPLER_NO_AVX2 / RESAMPLER_NO_AVX512 to leave out the wider x86
+* kernels on compilers too old to build them. */
+#include "cpu_features.h"
 
-#if SINC_COEFF_LERP
-#define TAPS_MULT 2
-#else
-#define TAPS_MULT 1
+#if !defined(RESAMPLER_NO_SIMD) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define RESAMPLER_X86 1
+#include <immintrin.h>
+#elif !defined(RESAMPLER_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define RESAMPLER_NEON 1
+#include <arm_neon.h>
 #endif
 
-#define window_function(idx)  (kaiser_window_function(idx, SINC_WINDOW_KAISER_BETA))
+#if !defined(_MSC_VER) && !defined(__forceinline)
+#define __forceinline inline __attribute__((always_inline))
+#endif
 
-/* For the little amount of taps we're using,
-* SSE1 is faster than AVX for some reason.
-* AVX code is kept here though as by increasing number
-* of sinc taps, the AVX code is clearly faster than SSE1.
-*/
+/* GCC and Clang only allow AVX intrinsics in functions built for AVX,
+* where MSVC allows them anywhere. */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RESAMPLER_TARGET(isa)
+#else
+#define RESAMPLER_TARGET(isa) __attribute__((target(isa)))
+#endif
 
-#define PHASES (1 << (PHASE_BITS + SUBPHASE_BITS))
+#define SINC_COEFF_LERP 1
 
-#define TAPS (SIDELOBES * 2)
-#define SUBPHASE_MASK ((1 << SUBPHASE_BITS) - 1)
-#define SUBPHASE_MOD (1.0f / (1 << SUBPHASE_BITS))
+/* Input frames copied in at a time by the fixed ratio kernels. */
+#define SINC_FIXED_BLOCK 256
 
+#if SINC_COEFF_LERP
+#define TAPS_MULT 2
+#else
+#define TAPS_MULT 1
+#endif
 
 typedef struct rarch_sinc_resampler
 {
 	float *phase_table;
-	float *buffer_l;
-	float *buffer_r;
+	/* Two copies of the last taps input frames for each channel,
+	* one channel after another. */
+	float *buffers;
+	/* The coefficients for the current output frame, interpolated
+	* once and shared by all channels when there are more than two. */
+	float *window;
+	/* One output frame, before conversion to 16-bit. */
+	float *frame;
+	unsigned channels;
 	unsigned taps;
 	unsigned ptr;
 	uint32_t time;
-	/* A buffer for phase_table, buffer_l and buffer_r
-	* are created in a single calloc().
+	unsigned subphase_bits;
+	uint32_t phases;
+	uint32_t subphase_mask;
+	float subphase_mod;
+	double kaiser_beta;
+	double cutoff;
+	/* Set by resampler_sinc_set_fixed_ratio(): one row of
+	* coefficients for each of the fixed_out phases that an L/M
+	* conversion passes through, or NULL. time counts in 1/fixed_out
+	* of an input frame while it is set, and the history is kept in
+	* fixed_history instead of buffers; both are in the same
+	* allocation as fixed_table. */
+	float *fixed_table;
+	float *fixed_history;
+	uint32_t fixed_in;
+	uint32_t fixed_out;
+	/* A buffer for phase_table, buffers, window and frame
+	* are created in a single allocation.
 	* Ensure that we get as good cache locality as we can hope for. */
 	float *main_buffer;
+	/* The kernels chosen by resampler_sinc_init_config(). */
+	void (*process)(struct rarch_sinc_resampler *resamp,
+		struct resampler_data *data);
+	void (*process_fixed)(struct rarch_sinc_resampler *resamp,
+		struct resampler_data *data);
+	void (*process_s16)(struct rarch_sinc_resampler *resamp,
+		struct resampler_data_s16 *data);
+	void (*process_fixed_s16)(struct rarch_sinc_resampler *resamp,
+		struct resampler_data_s16 *data);
 } rarch_sinc_resampler_t;
 
 
@@ -159,93 +302,804 @@ void memalign_free(void *ptr)
 	free(p[-1]);
 }
 
-void resampler_sinc_process(void *re_, struct resampler_data *data)
+/* Conversion of 16-bit samples to and from the float the kernels
+* work in, as they are read into the history and as each output frame
+* is written. */
+static __forceinline int16_t sinc_float_to_s16(float v)
 {
-	size_t out_frames = 0;
-	rarch_sinc_resampler_t *resamp = (rarch_sinc_resampler_t*)re_;
-	uint32_t ratio = PHASES / data->ratio;
-	const float *input = data->data_in;
-	float *output = data->data_out;
-	size_t frames = data->input_frames;
+	v *= 32768.0f;
+	if (v >= 32767.0f)
+		return 32767;
+	if (v <= -32768.0f)
+		return -32768;
+	return (int16_t)(v + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+/* The parts of the process loops that depend on the sample format,
+* fmt being float (written in place) or s16 (each output frame
+* computed into frame, then converted). */
+#define SINC_SAMPLE_float float
+#define SINC_SAMPLE_s16 int16_t
+#define SINC_READ_float(x) (x)
+#define SINC_READ_s16(x) ((float)(x) * (1.0f / 32768.0f))
+#define SINC_FRAME_float
+#define SINC_FRAME_s16 float *frame = resamp->frame;
+#define SINC_DEST_float output
+#define SINC_DEST_s16 frame
+#define SINC_EMIT_float
+#define SINC_EMIT_s16 \
+			{ \
+				unsigned c_; \
+				for (c_ = 0; c_ < channels; c_++) \
+					output[c_] = sinc_float_to_s16(frame[c_]); \
+			}
+
+/* The part of resampler_sinc_process() common to every kernel:
+* pushing input frames into the history buffers and stepping the
+* phase. kernel() computes one output frame from the current buffer
+* position and phase. nch is the channel count, given as a constant
+* for the stereo kernels, and fmt the sample format. The resampler state is kept in locals
+* while running, as the compiler can't tell that the output stores
+* don't change it. */
+#define SINC_PROCESS_LOOP(kernel, nch, fmt) \
+	size_t out_frames = 0; \
+	uint32_t phases = resamp->phases; \
+	uint32_t ratio = phases / data->ratio; \
+	const SINC_SAMPLE_##fmt *input = data->data_in; \
+	SINC_SAMPLE_##fmt *output = data->data_out; \
+	size_t frames = data->input_frames; \
+	float *buffers = resamp->buffers; \
+	float *window = resamp->window; \
+	const float *table = resamp->phase_table; \
+	unsigned channels = (nch); \
+	unsigned taps = resamp->taps; \
+	unsigned stride = taps * 2; \
+	unsigned subphase_bits = resamp->subphase_bits; \
+	uint32_t subphase_mask = resamp->subphase_mask; \
+	float subphase_mod = resamp->subphase_mod; \
+	unsigned ptr = resamp->ptr; \
+	uint32_t time = resamp->time; \
+	SINC_FRAME_##fmt \
+	while (frames) \
+	{ \
+		while (frames && time >= phases) \
+		{ \
+			unsigned c; \
+			/* Push in reverse to make filter more obvious. */ \
+			if (!ptr) \
+				ptr = taps; \
+			ptr--; \
+			for (c = 0; c < channels; c++) \
+				buffers[c * stride + ptr + taps] = \
+					buffers[c * stride + ptr] = SINC_READ_##fmt(*input++); \
+			time -= phases; \
+			frames--; \
+		} \
+		while (time < phases) \
+		{ \
+			unsigned phase = time >> subphase_bits; \
+			const float *phase_table = table + phase * taps * TAPS_MULT; \
+			const float *delta_table = phase_table + taps; \
+			float delta = (float)(time & subphase_mask) * subphase_mod; \
+			kernel(buffers + ptr, stride, channels, phase_table, \
+				delta_table, delta, taps, window, SINC_DEST_##fmt); \
+			SINC_EMIT_##fmt \
+			output += channels; \
+			out_frames++; \
+			time += ratio; \
+		} \
+	} \
+	resamp->ptr = ptr; \
+	resamp->time = time; \
+	data->output_frames = out_frames;
+
+/* The same for a fixed ratio, which steps through the rows of
+* fixed_table in turn and has nothing to interpolate.
+*
+* Rather than push each input frame into the ring buffers just before
+* the kernel reads it back, which leaves the vector loads waiting on
+* the scalar stores, this copies input a block at a time into
+* fixed_history, after the last taps frames, oldest first. Each
+* output frame then reads taps frames ending at the newest one it
+* depends on, with the rows of fixed_table reversed to match. */
+#define SINC_PROCESS_FIXED_LOOP(kernel, nch, fmt) \
+	size_t out_frames = 0; \
+	uint32_t phases = resamp->fixed_out; \
+	uint32_t ratio = resamp->fixed_in; \
+	const SINC_SAMPLE_##fmt *input = data->data_in; \
+	SINC_SAMPLE_##fmt *output = data->data_out; \
+	size_t frames = data->input_frames; \
+	float *history = resamp->fixed_history; \
+	const float *table = resamp->fixed_table; \
+	unsigned channels = (nch); \
+	unsigned taps = resamp->taps; \
+	unsigned stride = taps + SINC_FIXED_BLOCK; \
+	uint32_t time = resamp->time; \
+	SINC_FRAME_##fmt \
+	while (frames) \
+	{ \
+		unsigned i, c; \
+		unsigned block = frames < SINC_FIXED_BLOCK ? \
+			(unsigned)frames : SINC_FIXED_BLOCK; \
+		unsigned pushed = 0; \
+		for (i = 0; i < block; i++) \
+			for (c = 0; c < channels; c++) \
+				history[c * stride + taps + i] = SINC_READ_##fmt(*input++); \
+		for (;;) \
+		{ \
+			while (time >= phases && pushed < block) \
+			{ \
+				time -= phases; \
+				pushed++; \
+			} \
+			if (time >= phases) \
+				break; \
+			kernel(history + pushed, stride, channels, table + time * taps, \
+				NULL, 0.0f, taps, NULL, SINC_DEST_##fmt); \
+			SINC_EMIT_##fmt \
+			output += channels; \
+			out_frames++; \
+			time += ratio; \
+		} \
+		for (c = 0; c < channels; c++) \
+			memmove(history + c * stride, history + c * stride + block, \
+				taps * sizeof(float)); \
+		frames -= block; \
+	} \
+	resamp->time = time; \
+	data->output_frames = out_frames;
+
+/* Every kernel has the same arguments. The stereo ones take the
+* channel count as given and compute the coefficients as they go;
+* the others interpolate them into window first, then use them for
+* each channel in turn. The fixed ratio ones are given their row of
+* coefficients as phase_table, and nothing to interpolate. */
+#define SINC_KERNEL_ARGS const float *buffers, unsigned stride, \
+	unsigned channels, const float *phase_table, \
+	const float *delta_table, float delta_, unsigned taps, \
+	float *window, float *output
+
+/* The process functions for one instruction set, built from its
+* kernels: general and fixed ratio, for stereo and any channels, for
+* float and for 16-bit samples (with data_t the resampler_data or
+* resampler_data_s16 to match). */
+#define SINC_DEFINE_PROCESS_FMT(isa, target, fmt, data_t) \
+target static void resampler_sinc_process_##fmt##_##isa##_stereo( \
+	rarch_sinc_resampler_t *resamp, struct data_t *data) \
+{ \
+	SINC_PROCESS_LOOP(sinc_kernel_##isa##_stereo, 2, fmt) \
+} \
+target static void resampler_sinc_process_##fmt##_##isa( \
+	rarch_sinc_resampler_t *resamp, struct data_t *data) \
+{ \
+	SINC_PROCESS_LOOP(sinc_kernel_##isa, resamp->channels, fmt) \
+} \
+target static void resampler_sinc_process_##fmt##_##isa##_fixed_stereo( \
+	rarch_sinc_resampler_t *resamp, struct data_t *data) \
+{ \
+	SINC_PROCESS_FIXED_LOOP(sinc_kernel_##isa##_fixed_stereo, 2, fmt) \
+} \
+target static void resampler_sinc_process_##fmt##_##isa##_fixed( \
+	rarch_sinc_resampler_t *resamp, struct data_t *data) \
+{ \
+	SINC_PROCESS_FIXED_LOOP(sinc_kernel_##isa##_fixed, resamp->channels, fmt) \
+}
+
+#define SINC_DEFINE_PROCESS(isa, target) \
+	SINC_DEFINE_PROCESS_FMT(isa, target, float, resampler_data) \
+	SINC_DEFINE_PROCESS_FMT(isa, target, s16, resampler_data_s16)
 
-	while (frames)
+static __forceinline void sinc_kernel_c_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	float sum_l = 0.0f;
+	float sum_r = 0.0f;
+	(void)channels;
+	(void)window;
+
+	for (i = 0; i < taps; i++)
 	{
-		while (frames && resamp->time >= PHASES)
-		{
-			/* Push in reverse to make filter more obvious. */
-			if (!resamp->ptr)
-				resamp->ptr = resamp->taps;
-			resamp->ptr--;
+		float _sinc = phase_table[i] + delta_table[i] * delta_;
+		sum_l += buffer_l[i] * _sinc;
+		sum_r += buffer_r[i] * _sinc;
+	}
 
-			resamp->buffer_l[resamp->ptr + resamp->taps] =
-				resamp->buffer_l[resamp->ptr] = *input++;
+	output[0] = sum_l;
+	output[1] = sum_r;
+}
 
-			resamp->buffer_r[resamp->ptr + resamp->taps] =
-				resamp->buffer_r[resamp->ptr] = *input++;
+static __forceinline void sinc_kernel_c_fixed_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	float sum_l = 0.0f;
+	float sum_r = 0.0f;
+	(void)channels;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
 
-			resamp->time -= PHASES;
-			frames--;
-		}
+	for (i = 0; i < taps; i++)
+	{
+		sum_l += buffer_l[i] * phase_table[i];
+		sum_r += buffer_r[i] * phase_table[i];
+	}
 
-		while (resamp->time < PHASES)
-		{
-			unsigned i;
-			__m128 sum;
-			const float *buffer_l = resamp->buffer_l + resamp->ptr;
-			const float *buffer_r = resamp->buffer_r + resamp->ptr;
-			unsigned taps = resamp->taps;
-			unsigned phase = resamp->time >> SUBPHASE_BITS;
-			const float *phase_table = resamp->phase_table + phase * taps * TAPS_MULT;
-			const float *delta_table = phase_table + taps;
-			__m128 delta = _mm_set1_ps((float)
-				(resamp->time & SUBPHASE_MASK) * SUBPHASE_MOD);
-
-			__m128 sum_l = _mm_setzero_ps();
-			__m128 sum_r = _mm_setzero_ps();
-
-			for (i = 0; i < taps; i += 4)
-			{
-				__m128 buf_l = _mm_loadu_ps(buffer_l + i);
-				__m128 buf_r = _mm_loadu_ps(buffer_r + i);
-				__m128 deltas = _mm_load_ps(delta_table + i);
-				__m128 _sinc = _mm_add_ps(_mm_load_ps(phase_table + i),
-					_mm_mul_ps(deltas, delta));
-				sum_l = _mm_add_ps(sum_l, _mm_mul_ps(buf_l, _sinc));
-				sum_r = _mm_add_ps(sum_r, _mm_mul_ps(buf_r, _sinc));
-			}
+	output[0] = sum_l;
+	output[1] = sum_r;
+}
 
-			/* Them annoying shuffles.
-			* sum_l = { l3, l2, l1, l0 }
-			* sum_r = { r3, r2, r1, r0 }
-			*/
+static __forceinline void sinc_kernel_c_fixed(SINC_KERNEL_ARGS)
+{
+	unsigned i, c;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
 
-			sum = _mm_add_ps(_mm_shuffle_ps(sum_l, sum_r,
-				_MM_SHUFFLE(1, 0, 1, 0)),
-				_mm_shuffle_ps(sum_l, sum_r, _MM_SHUFFLE(3, 2, 3, 2)));
+	for (c = 0; c < channels; c++)
+	{
+		const float *buffer = buffers + c * stride;
+		float sum = 0.0f;
+		for (i = 0; i < taps; i++)
+			sum += buffer[i] * phase_table[i];
+		output[c] = sum;
+	}
+}
+
+static __forceinline void sinc_kernel_c(SINC_KERNEL_ARGS)
+{
+	unsigned i;
 
-			/* sum   = { r1, r0, l1, l0 } + { r3, r2, l3, l2 }
-			* sum   = { R1, R0, L1, L0 }
-			*/
+	for (i = 0; i < taps; i++)
+		window[i] = phase_table[i] + delta_table[i] * delta_;
 
-			sum = _mm_add_ps(_mm_shuffle_ps(sum, sum, _MM_SHUFFLE(3, 3, 1, 1)), sum);
+	sinc_kernel_c_fixed(buffers, stride, channels, window,
+		NULL, 0.0f, taps, NULL, output);
+}
+
+SINC_DEFINE_PROCESS(c, )
 
-			/* sum   = {R1, R1, L1, L1 } + { R1, R0, L1, L0 }
-			* sum   = { X,  R,  X,  L }
-			*/
+#if RESAMPLER_X86
+/* Taps must be a multiple of 4 for the SSE and NEON kernels, 8 for
+* AVX2 and 16 for AVX-512. */
 
-			/* Store L */
-			_mm_store_ss(output + 0, sum);
+/* Sum each of two vectors of 4 and store them as an L, R pair. */
+static __forceinline void sinc_store_sse(__m128 sum_l, __m128 sum_r,
+	float *output)
+{
+	/* Them annoying shuffles.
+	* sum_l = { l3, l2, l1, l0 }
+	* sum_r = { r3, r2, r1, r0 }
+	*/
 
-			/* movehl { X, R, X, L } == { X, R, X, R } */
-			_mm_store_ss(output + 1, _mm_movehl_ps(sum, sum));
+	__m128 sum = _mm_add_ps(_mm_shuffle_ps(sum_l, sum_r,
+		_MM_SHUFFLE(1, 0, 1, 0)),
+		_mm_shuffle_ps(sum_l, sum_r, _MM_SHUFFLE(3, 2, 3, 2)));
 
-			output += 2;
-			out_frames++;
-			resamp->time += ratio;
-		}
+	/* sum   = { r1, r0, l1, l0 } + { r3, r2, l3, l2 }
+	* sum   = { R1, R0, L1, L0 }
+	*/
+
+	sum = _mm_add_ps(_mm_shuffle_ps(sum, sum, _MM_SHUFFLE(3, 3, 1, 1)), sum);
+
+	/* sum   = {R1, R1, L1, L1 } + { R1, R0, L1, L0 }
+	* sum   = { X,  R,  X,  L }
+	*/
+
+	/* Store L */
+	_mm_store_ss(output + 0, sum);
+
+	/* movehl { X, R, X, L } == { X, R, X, R } */
+	_mm_store_ss(output + 1, _mm_movehl_ps(sum, sum));
+}
+
+static __forceinline void sinc_kernel_sse_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m128 delta = _mm_set1_ps(delta_);
+	__m128 sum_l = _mm_setzero_ps();
+	__m128 sum_r = _mm_setzero_ps();
+	(void)channels;
+	(void)window;
+
+	for (i = 0; i < taps; i += 4)
+	{
+		__m128 buf_l = _mm_loadu_ps(buffer_l + i);
+		__m128 buf_r = _mm_loadu_ps(buffer_r + i);
+		__m128 deltas = _mm_load_ps(delta_table + i);
+		__m128 _sinc = _mm_add_ps(_mm_load_ps(phase_table + i),
+			_mm_mul_ps(deltas, delta));
+		sum_l = _mm_add_ps(sum_l, _mm_mul_ps(buf_l, _sinc));
+		sum_r = _mm_add_ps(sum_r, _mm_mul_ps(buf_r, _sinc));
 	}
 
-	data->output_frames = out_frames;
+	sinc_store_sse(sum_l, sum_r, output);
+}
+
+static __forceinline void sinc_kernel_sse_fixed_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m128 sum_l = _mm_setzero_ps();
+	__m128 sum_r = _mm_setzero_ps();
+	(void)channels;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (i = 0; i < taps; i += 4)
+	{
+		__m128 _sinc = _mm_load_ps(phase_table + i);
+		sum_l = _mm_add_ps(sum_l, _mm_mul_ps(_mm_loadu_ps(buffer_l + i), _sinc));
+		sum_r = _mm_add_ps(sum_r, _mm_mul_ps(_mm_loadu_ps(buffer_r + i), _sinc));
+	}
+
+	sinc_store_sse(sum_l, sum_r, output);
+}
+
+static __forceinline void sinc_kernel_sse_fixed(SINC_KERNEL_ARGS)
+{
+	unsigned i, c;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (c = 0; c < channels; c++)
+	{
+		const float *buffer = buffers + c * stride;
+		__m128 sum = _mm_setzero_ps();
+		for (i = 0; i < taps; i += 4)
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(buffer + i),
+				_mm_load_ps(phase_table + i)));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+		_mm_store_ss(output + c, sum);
+	}
+}
+
+static __forceinline void sinc_kernel_sse(SINC_KERNEL_ARGS)
+{
+	unsigned i;
+	__m128 delta = _mm_set1_ps(delta_);
+
+	for (i = 0; i < taps; i += 4)
+		_mm_store_ps(window + i, _mm_add_ps(_mm_load_ps(phase_table + i),
+			_mm_mul_ps(_mm_load_ps(delta_table + i), delta)));
+
+	sinc_kernel_sse_fixed(buffers, stride, channels, window,
+		NULL, 0.0f, taps, NULL, output);
+}
+
+SINC_DEFINE_PROCESS(sse, )
+
+#if !defined(RESAMPLER_NO_AVX2) || !defined(RESAMPLER_NO_AVX512)
+/* Sum each of two vectors of 8 and store them as an L, R pair. */
+RESAMPLER_TARGET("avx")
+static __forceinline void sinc_store_avx(__m256 sum_l, __m256 sum_r,
+	float *output)
+{
+	__m128 sum;
+
+	/* One horizontal add leaves { r, r, l, l } pairs in each half,
+	* then fold the halves. */
+	__m256 pairs = _mm256_hadd_ps(sum_l, sum_r);
+	sum = _mm_add_ps(_mm256_castps256_ps128(pairs),
+		_mm256_extractf128_ps(pairs, 1));
+
+	/* sum = { r23, r01, l23, l01 } */
+	sum = _mm_hadd_ps(sum, sum);
+	/* sum = { R, L, R, L } */
+
+	_mm_store_ss(output + 0, sum);
+	_mm_store_ss(output + 1, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+}
+
+/* Sum one vector of 8. */
+RESAMPLER_TARGET("avx")
+static __forceinline float sinc_sum_avx(__m256 v)
+{
+	__m128 sum = _mm_add_ps(_mm256_castps256_ps128(v),
+		_mm256_extractf128_ps(v, 1));
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(sum);
+}
+#endif
+
+#ifndef RESAMPLER_NO_AVX2
+RESAMPLER_TARGET("avx2,fma")
+static __forceinline void sinc_kernel_avx2_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m256 delta = _mm256_set1_ps(delta_);
+	__m256 sum_l = _mm256_setzero_ps();
+	__m256 sum_r = _mm256_setzero_ps();
+	(void)channels;
+	(void)window;
+
+	for (i = 0; i < taps; i += 8)
+	{
+		__m256 buf_l = _mm256_loadu_ps(buffer_l + i);
+		__m256 buf_r = _mm256_loadu_ps(buffer_r + i);
+		__m256 _sinc = _mm256_fmadd_ps(_mm256_load_ps(delta_table + i),
+			delta, _mm256_load_ps(phase_table + i));
+		sum_l = _mm256_fmadd_ps(buf_l, _sinc, sum_l);
+		sum_r = _mm256_fmadd_ps(buf_r, _sinc, sum_r);
+	}
+
+	sinc_store_avx(sum_l, sum_r, output);
+}
+
+RESAMPLER_TARGET("avx2,fma")
+static __forceinline void sinc_kernel_avx2_fixed_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m256 sum_l = _mm256_setzero_ps();
+	__m256 sum_r = _mm256_setzero_ps();
+	(void)channels;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (i = 0; i < taps; i += 8)
+	{
+		__m256 _sinc = _mm256_load_ps(phase_table + i);
+		sum_l = _mm256_fmadd_ps(_mm256_loadu_ps(buffer_l + i), _sinc, sum_l);
+		sum_r = _mm256_fmadd_ps(_mm256_loadu_ps(buffer_r + i), _sinc, sum_r);
+	}
+
+	sinc_store_avx(sum_l, sum_r, output);
+}
+
+RESAMPLER_TARGET("avx2,fma")
+static __forceinline void sinc_kernel_avx2_fixed(SINC_KERNEL_ARGS)
+{
+	unsigned i, c;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (c = 0; c < channels; c++)
+	{
+		const float *buffer = buffers + c * stride;
+		__m256 sum = _mm256_setzero_ps();
+		for (i = 0; i < taps; i += 8)
+			sum = _mm256_fmadd_ps(_mm256_loadu_ps(buffer + i),
+				_mm256_load_ps(phase_table + i), sum);
+		output[c] = sinc_sum_avx(sum);
+	}
+}
+
+RESAMPLER_TARGET("avx2,fma")
+static __forceinline void sinc_kernel_avx2(SINC_KERNEL_ARGS)
+{
+	unsigned i;
+	__m256 delta = _mm256_set1_ps(delta_);
+
+	for (i = 0; i < taps; i += 8)
+		_mm256_store_ps(window + i, _mm256_fmadd_ps(
+			_mm256_load_ps(delta_table + i), delta,
+			_mm256_load_ps(phase_table + i)));
+
+	sinc_kernel_avx2_fixed(buffers, stride, channels, window,
+		NULL, 0.0f, taps, NULL, output);
+}
+
+SINC_DEFINE_PROCESS(avx2, RESAMPLER_TARGET("avx2,fma"))
+#endif
+
+#ifndef RESAMPLER_NO_AVX512
+#if defined(__GNUC__) && !defined(__clang__)
+/* GCC 12 warns about its own AVX-512 headers outside -mavx512f. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+/* Fold the upper 256 bits onto the lower. */
+RESAMPLER_TARGET("avx512f")
+static __forceinline __m256 sinc_fold_avx512(__m512 v)
+{
+	v = _mm512_add_ps(v, _mm512_shuffle_f32x4(v, v, _MM_SHUFFLE(3, 2, 3, 2)));
+	return _mm512_castps512_ps256(v);
+}
+
+RESAMPLER_TARGET("avx512f")
+static __forceinline void sinc_kernel_avx512_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m512 delta = _mm512_set1_ps(delta_);
+	__m512 sum_l = _mm512_setzero_ps();
+	__m512 sum_r = _mm512_setzero_ps();
+	(void)channels;
+	(void)window;
+
+	for (i = 0; i < taps; i += 16)
+	{
+		__m512 buf_l = _mm512_loadu_ps(buffer_l + i);
+		__m512 buf_r = _mm512_loadu_ps(buffer_r + i);
+		__m512 _sinc = _mm512_fmadd_ps(_mm512_load_ps(delta_table + i),
+			delta, _mm512_load_ps(phase_table + i));
+		sum_l = _mm512_fmadd_ps(buf_l, _sinc, sum_l);
+		sum_r = _mm512_fmadd_ps(buf_r, _sinc, sum_r);
+	}
+
+	sinc_store_avx(sinc_fold_avx512(sum_l), sinc_fold_avx512(sum_r), output);
+}
+
+RESAMPLER_TARGET("avx512f")
+static __forceinline void sinc_kernel_avx512_fixed_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	__m512 sum_l = _mm512_setzero_ps();
+	__m512 sum_r = _mm512_setzero_ps();
+	(void)channels;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (i = 0; i < taps; i += 16)
+	{
+		__m512 _sinc = _mm512_load_ps(phase_table + i);
+		sum_l = _mm512_fmadd_ps(_mm512_loadu_ps(buffer_l + i), _sinc, sum_l);
+		sum_r = _mm512_fmadd_ps(_mm512_loadu_ps(buffer_r + i), _sinc, sum_r);
+	}
+
+	sinc_store_avx(sinc_fold_avx512(sum_l), sinc_fold_avx512(sum_r), output);
+}
+
+RESAMPLER_TARGET("avx512f")
+static __forceinline void sinc_kernel_avx512_fixed(SINC_KERNEL_ARGS)
+{
+	unsigned i, c;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (c = 0; c < channels; c++)
+	{
+		const float *buffer = buffers + c * stride;
+		__m512 sum = _mm512_setzero_ps();
+		for (i = 0; i < taps; i += 16)
+			sum = _mm512_fmadd_ps(_mm512_loadu_ps(buffer + i),
+				_mm512_load_ps(phase_table + i), sum);
+		output[c] = sinc_sum_avx(sinc_fold_avx512(sum));
+	}
+}
+
+RESAMPLER_TARGET("avx512f")
+static __forceinline void sinc_kernel_avx512(SINC_KERNEL_ARGS)
+{
+	unsigned i;
+	__m512 delta = _mm512_set1_ps(delta_);
+
+	for (i = 0; i < taps; i += 16)
+		_mm512_store_ps(window + i, _mm512_fmadd_ps(
+			_mm512_load_ps(delta_table + i), delta,
+			_mm512_load_ps(phase_table + i)));
+
+	sinc_kernel_avx512_fixed(buffers, stride, channels, window,
+		NULL, 0.0f, taps, NULL, output);
+}
+
+SINC_DEFINE_PROCESS(avx512, RESAMPLER_TARGET("avx512f"))
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+#endif
+
+#if RESAMPLER_NEON
+/* { l0 + l1 + l2 + l3, r0 + r1 + r2 + r3 } */
+static __forceinline void sinc_store_neon(float32x4_t sum_l,
+	float32x4_t sum_r, float *output)
+{
+	float32x2_t sum = vpadd_f32(
+		vadd_f32(vget_low_f32(sum_l), vget_high_f32(sum_l)),
+		vadd_f32(vget_low_f32(sum_r), vget_high_f32(sum_r)));
+	vst1_f32(output, sum);
+}
+
+static __forceinline void sinc_kernel_neon_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	float32x4_t sum_l = vdupq_n_f32(0.0f);
+	float32x4_t sum_r = vdupq_n_f32(0.0f);
+	(void)channels;
+	(void)window;
+
+	for (i = 0; i < taps; i += 4)
+	{
+		float32x4_t buf_l = vld1q_f32(buffer_l + i);
+		float32x4_t buf_r = vld1q_f32(buffer_r + i);
+		float32x4_t _sinc = vmlaq_n_f32(vld1q_f32(phase_table + i),
+			vld1q_f32(delta_table + i), delta_);
+		sum_l = vmlaq_f32(sum_l, buf_l, _sinc);
+		sum_r = vmlaq_f32(sum_r, buf_r, _sinc);
+	}
+
+	sinc_store_neon(sum_l, sum_r, output);
+}
+
+static __forceinline void sinc_kernel_neon_fixed_stereo(SINC_KERNEL_ARGS)
+{
+	const float *buffer_l = buffers;
+	const float *buffer_r = buffers + stride;
+	unsigned i;
+	float32x4_t sum_l = vdupq_n_f32(0.0f);
+	float32x4_t sum_r = vdupq_n_f32(0.0f);
+	(void)channels;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (i = 0; i < taps; i += 4)
+	{
+		float32x4_t _sinc = vld1q_f32(phase_table + i);
+		sum_l = vmlaq_f32(sum_l, vld1q_f32(buffer_l + i), _sinc);
+		sum_r = vmlaq_f32(sum_r, vld1q_f32(buffer_r + i), _sinc);
+	}
+
+	sinc_store_neon(sum_l, sum_r, output);
+}
+
+static __forceinline void sinc_kernel_neon_fixed(SINC_KERNEL_ARGS)
+{
+	unsigned i, c;
+	(void)delta_table;
+	(void)delta_;
+	(void)window;
+
+	for (c = 0; c < channels; c++)
+	{
+		const float *buffer = buffers + c * stride;
+		float32x4_t sum = vdupq_n_f32(0.0f);
+		float32x2_t half;
+		for (i = 0; i < taps; i += 4)
+			sum = vmlaq_f32(sum, vld1q_f32(buffer + i),
+				vld1q_f32(phase_table + i));
+		half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+		output[c] = vget_lane_f32(vpadd_f32(half, half), 0);
+	}
+}
+
+static __forceinline void sinc_kernel_neon(SINC_KERNEL_ARGS)
+{
+	unsigned i;
+
+	for (i = 0; i < taps; i += 4)
+		vst1q_f32(window + i, vmlaq_n_f32(vld1q_f32(phase_table + i),
+			vld1q_f32(delta_table + i), delta_));
+
+	sinc_kernel_neon_fixed(buffers, stride, channels, window,
+		NULL, 0.0f, taps, NULL, output);
+}
+
+SINC_DEFINE_PROCESS(neon, )
+#endif
+
+#define SINC_SELECT(isa) \
+	do { \
+		if (re->channels == 2) \
+		{ \
+			re->process = resampler_sinc_process_float_##isa##_stereo; \
+			re->process_fixed = resampler_sinc_process_float_##isa##_fixed_stereo; \
+			re->process_s16 = resampler_sinc_process_s16_##isa##_stereo; \
+			re->process_fixed_s16 = resampler_sinc_process_s16_##isa##_fixed_stereo; \
+		} \
+		else \
+		{ \
+			re->process = resampler_sinc_process_float_##isa; \
+			re->process_fixed = resampler_sinc_process_float_##isa##_fixed; \
+			re->process_s16 = resampler_sinc_process_s16_##isa; \
+			re->process_fixed_s16 = resampler_sinc_process_s16_##isa##_fixed; \
+		} \
+	} while (0)
+
+/* Pick the widest kernel the CPU has whose vector width divides the
+* number of taps, except that AVX-512 is only used for long filters.
+*
+* Measured on an AVX-512 capable x86-64 with GCC -O2, stereo,
+* ns per output frame, for 44.1 to 48 kHz and for 4x upsampling:
+*
+*                        44.1 -> 48 kHz              4x
+*   sidelobes  taps    C   SSE  AVX2  AVX-512    C   SSE  AVX2  AVX-512
+*       4        8     9    15   15      -       7     6     5      -
+*       8       16    15    15   14     17      14     7     6      7
+*      16       32    30    18   18     20      26    11     7      8
+*      32       64    57    25   23     23      50    18    11     10
+*
+* Close to 1:1 most of the time goes on waiting for each new input
+* frame's stores to reach the history buffer before the vector loads
+* can read it back, so the kernel width matters less than it does
+* when upsampling. AVX2 is never slower than SSE; AVX-512 only pays
+* for itself from 64 taps. */
+static void sinc_select_process(rarch_sinc_resampler_t *re)
+{
+	unsigned features = cpu_features();
+	SINC_SELECT(c);
+#if RESAMPLER_X86
+	if (re->taps % 4 == 0 && (features & CPU_FEATURE_SSE2))
+		SINC_SELECT(sse);
+#ifndef RESAMPLER_NO_AVX2
+	if (re->taps % 8 == 0 && (features & CPU_FEATURE_AVX2) && (features & CPU_FEATURE_FMA))
+		SINC_SELECT(avx2);
+#endif
+#ifndef RESAMPLER_NO_AVX512
+	if (re->taps % 16 == 0 && re->taps >= 64 && (features & CPU_FEATURE_AVX512F))
+		SINC_SELECT(avx512);
+#endif
+#elif RESAMPLER_NEON
+	if (re->taps % 4 == 0 && (features & CPU_FEATURE_NEON))
+		SINC_SELECT(neon);
+#endif
+	(void)features;
+}
+
+void resampler_sinc_process(void *re_, struct resampler_data *data)
+{
+	rarch_sinc_resampler_t *resamp = (rarch_sinc_resampler_t*)re_;
+	if (resamp->fixed_table)
+		resamp->process_fixed(resamp, data);
+	else
+		resamp->process(resamp, data);
+}
+
+void resampler_sinc_process_s16(void *re_, struct resampler_data_s16 *data)
+{
+	rarch_sinc_resampler_t *resamp = (rarch_sinc_resampler_t*)re_;
+	if (resamp->fixed_table)
+		resamp->process_fixed_s16(resamp, data);
+	else
+		resamp->process_s16(resamp, data);
+}
+
+void resampler_rate_control_init(struct resampler_rate_control *rc,
+	double ratio, double max_deviation)
+{
+	rc->ratio         = ratio;
+	rc->max_deviation = max_deviation;
+	rc->target_fill   = 0.5;
+	rc->smoothing     = 0.1;
+	rc->adjust        = 1.0;
+}
+
+double resampler_rate_control_update(struct resampler_rate_control *rc,
+	size_t buffer_fill, size_t buffer_size)
+{
+	double fill, range, error;
+
+	if (!buffer_size)
+		return rc->ratio * rc->adjust;
+
+	/* error is -1 with the buffer empty and 1 with it full, 0 at
+	* target_fill. */
+	fill  = (double)buffer_fill / buffer_size;
+	range = (fill > rc->target_fill) ?
+		1.0 - rc->target_fill : rc->target_fill;
+	error = (range > 0.0) ? (fill - rc->target_fill) / range : 0.0;
+	if (error > 1.0)
+		error = 1.0;
+	else if (error < -1.0)
+		error = -1.0;
+
+	rc->adjust += rc->smoothing *
+		((1.0 - rc->max_deviation * error) - rc->adjust);
+	return rc->ratio * rc->adjust;
 }
 
 
@@ -253,7 +1107,8 @@ static void sinc_init_table(rarch_sinc_resampler_t *resamp, double cutoff,
 	float *phase_table, int phases, int taps, bool calculate_delta)
 {
 	int i, j;
-	double    window_mod = window_function(0.0); /* Need to normalize w(0) to 1.0. */
+	double          beta = resamp->kaiser_beta;
+	double    window_mod = kaiser_window_function(0.0, beta); /* Need to normalize w(0) to 1.0. */
 	int           stride = calculate_delta ? 2 : 1;
 	double     sidelobes = taps / 2.0;
 
@@ -268,7 +1123,7 @@ static void sinc_init_table(rarch_sinc_resampler_t *resamp, double cutoff,
 			window_phase = 2.0 * window_phase - 1.0; /* [-1, 1) */
 			sinc_phase = sidelobes * window_phase;
 			val = cutoff * sinc(M_PI * sinc_phase * cutoff) *
-				window_function(window_phase) / window_mod;
+				kaiser_window_function(window_phase, beta) / window_mod;
 			phase_table[i * stride * taps + j] = val;
 		}
 	}
@@ -299,7 +1154,7 @@ static void sinc_init_table(rarch_sinc_resampler_t *resamp, double cutoff,
 			sinc_phase = sidelobes * window_phase;
 
 			val = cutoff * sinc(M_PI * sinc_phase * cutoff) *
-				window_function(window_phase) / window_mod;
+				kaiser_window_function(window_phase, beta) / window_mod;
 			delta = (val - phase_table[phase * stride * taps + j]);
 			phase_table[(phase * stride + 1) * taps + j] = delta;
 		}
@@ -310,22 +1165,166 @@ void resampler_sinc_free(void *data)
 {
 	rarch_sinc_resampler_t *resamp = (rarch_sinc_resampler_t*)data;
 	if (resamp)
+	{
+		memalign_free(resamp->fixed_table);
 		memalign_free(resamp->main_buffer);
+	}
 	free(resamp);
 }
 
-void *resampler_sinc_init()
+static uint32_t sinc_gcd(uint32_t a, uint32_t b)
+{
+	while (b)
+	{
+		uint32_t t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+bool resampler_sinc_set_fixed_ratio(void *re_, unsigned input_rate,
+	unsigned output_rate)
+{
+	rarch_sinc_resampler_t *re = (rarch_sinc_resampler_t*)re_;
+	uint32_t g, in, out;
+	unsigned t, j, c;
+	unsigned taps = re->taps;
+	unsigned stride = taps + SINC_FIXED_BLOCK;
+	float *table;
+	double window_mod, sidelobes;
+
+	/* Carry the position and history back to the ring buffers. */
+	if (re->fixed_table)
+	{
+		re->time = (uint32_t)(((uint64_t)re->time * re->phases
+			+ re->fixed_out / 2) / re->fixed_out);
+		re->ptr = 0;
+		for (c = 0; c < re->channels; c++)
+			for (j = 0; j < taps; j++)
+				re->buffers[c * 2 * taps + j] =
+					re->buffers[c * 2 * taps + j + taps] =
+					re->fixed_history[c * stride + taps - 1 - j];
+		memalign_free(re->fixed_table);
+		re->fixed_table = NULL;
+		re->fixed_history = NULL;
+	}
+
+	if (!input_rate || !output_rate)
+		return true;
+
+	g = sinc_gcd(input_rate, output_rate);
+	in = input_rate / g;
+	out = output_rate / g;
+	if (out > RESAMPLER_FIXED_MAX_PHASES)
+		return false;
+
+	table = (float*)memalign_alloc(128, sizeof(float) *
+		(out * taps + re->channels * stride));
+	if (!table)
+		return false;
+
+	/* As for sinc_init_table(), at each of the phases t / out, but
+	* with the taps in reverse. */
+	window_mod = kaiser_window_function(0.0, re->kaiser_beta);
+	sidelobes = taps / 2.0;
+	for (t = 0; t < out; t++)
+	{
+		for (j = 0; j < taps; j++)
+		{
+			double window_phase = (j + (double)t / out) / taps;
+			double sinc_phase;
+			window_phase = 2.0 * window_phase - 1.0;
+			sinc_phase = sidelobes * window_phase;
+			table[t * taps + taps - 1 - j] = re->cutoff *
+				sinc(M_PI * sinc_phase * re->cutoff) *
+				kaiser_window_function(window_phase, re->kaiser_beta) / window_mod;
+		}
+	}
+
+	re->fixed_history = table + out * taps;
+	for (c = 0; c < re->channels; c++)
+		for (j = 0; j < taps; j++)
+			re->fixed_history[c * stride + taps - 1 - j] =
+				re->buffers[c * 2 * taps + re->ptr + j];
+
+	re->time = (uint32_t)(((uint64_t)re->time * out
+		+ re->phases / 2) / re->phases);
+	re->fixed_table = table;
+	re->fixed_in = in;
+	re->fixed_out = out;
+	return true;
+}
+
+void resampler_sinc_config_preset(struct resampler_sinc_config *config,
+	enum resampler_quality quality, unsigned channels)
+{
+	config->channels = channels;
+
+	switch (quality)
+	{
+		case RESAMPLER_QUALITY_LOWEST:
+			config->sidelobes     = 2;
+			config->cutoff        = 0.70;
+			config->kaiser_beta   = 3.0;
+			config->phase_bits    = 6;
+			config->subphase_bits = 18;
+			break;
+		case RESAMPLER_QUALITY_LOWER:
+			config->sidelobes     = 4;
+			config->cutoff        = 0.75;
+			config->kaiser_beta   = 4.0;
+			config->phase_bits    = 7;
+			config->subphase_bits = 17;
+			break;
+		case RESAMPLER_QUALITY_HIGHER:
+			config->sidelobes     = 32;
+			config->cutoff        = 0.90;
+			config->kaiser_beta   = 10.5;
+			config->phase_bits    = 10;
+			config->subphase_bits = 14;
+			break;
+		case RESAMPLER_QUALITY_HIGHEST:
+			config->sidelobes     = 128;
+			config->cutoff        = 0.962;
+			config->kaiser_beta   = 14.5;
+			config->phase_bits    = 10;
+			config->subphase_bits = 14;
+			break;
+		case RESAMPLER_QUALITY_NORMAL:
+		case RESAMPLER_QUALITY_DONTCARE:
+		default:
+			config->sidelobes     = 8;
+			config->cutoff        = 0.825;
+			config->kaiser_beta   = 5.5;
+			config->phase_bits    = 8;
+			config->subphase_bits = 16;
+			break;
+	}
+}
+
+void *resampler_sinc_init_config(const struct resampler_sinc_config *config)
 {
 	double cutoff;
-	size_t phase_elems, elems;
-	rarch_sinc_resampler_t *re = (rarch_sinc_resampler_t*)
-		calloc(1, sizeof(*re));
+	size_t phase_elems, window_elems, buffer_elems, elems;
+	rarch_sinc_resampler_t *re = NULL;
+
+	if (!config->channels || !config->sidelobes ||
+		config->phase_bits + config->subphase_bits > 24)
+		return NULL;
 
+	re = (rarch_sinc_resampler_t*)calloc(1, sizeof(*re));
 	if (!re)
 		return NULL;
 
-	re->taps = TAPS;
-	cutoff = CUTOFF;
+	re->channels      = config->channels;
+	re->taps          = config->sidelobes * 2;
+	re->kaiser_beta   = config->kaiser_beta;
+	re->subphase_bits = config->subphase_bits;
+	re->phases        = 1u << (config->phase_bits + config->subphase_bits);
+	re->subphase_mask = (1u << config->subphase_bits) - 1;
+	re->subphase_mod  = 1.0f / (1 << config->subphase_bits);
+	cutoff = config->cutoff;
 	double bandwidth_mod = 1.0;
 	/* Downsampling, must lower cutoff, and extend number of
 	* taps accordingly to keep same stopband attenuation. */
@@ -337,19 +1336,28 @@ void *resampler_sinc_init()
 
 	re->taps = (re->taps + 3) & ~3;
 
-	phase_elems = ((1 << PHASE_BITS) * re->taps) * TAPS_MULT;
-	elems = phase_elems + 4 * re->taps;
+	/* window goes first, padded to keep the phase table aligned
+	* for the widest kernel. */
+	window_elems = (re->taps + 31) & ~31;
+	phase_elems = ((1 << config->phase_bits) * re->taps) * TAPS_MULT;
+	buffer_elems = 2 * re->taps * re->channels;
+	elems = window_elems + phase_elems + buffer_elems + re->channels;
 
 	re->main_buffer = (float*)memalign_alloc(128, sizeof(float) * elems);
 	if (!re->main_buffer)
 		goto error;
 
-	re->phase_table = re->main_buffer;
-	re->buffer_l = re->main_buffer + phase_elems;
-	re->buffer_r = re->buffer_l + 2 * re->taps;
+	re->window = re->main_buffer;
+	re->phase_table = re->window + window_elems;
+	re->buffers = re->phase_table + phase_elems;
+	re->frame = re->buffers + buffer_elems;
+	memset(re->window, 0, sizeof(float) * window_elems);
+	memset(re->buffers, 0, sizeof(float) * buffer_elems);
 
+	re->cutoff = cutoff;
 	sinc_init_table(re, cutoff, re->phase_table,
-		1 << PHASE_BITS, re->taps, SINC_COEFF_LERP);
+		1 << config->phase_bits, re->taps, SINC_COEFF_LERP);
+	sinc_select_process(re);
 	return re;
 
 error:
@@ -357,6 +1365,13 @@ error:
 	return NULL;
 }
 
+void *resampler_sinc_init()
+{
+	struct resampler_sinc_config config;
+	resampler_sinc_config_preset(&config, RESAMPLER_QUALITY_NORMAL, 2);
+	return resampler_sinc_init_config(&config);
+}
+
 #endif /* INI_IMPLEMENTATION */
 
 
@@ -0,0 +1,684 @@
+/* retro_arena.h - arena allocator shared by the audio, DSP and image
+ * libraries, with a current arena for each thread.
+ *
+ * SoundTouch, rubberband, gme, dr_wav and stb_image each take their
+ * memory from the C heap on their own, so many threads opening and
+ * processing streams at once contend on the heap. With this, each
+ * thread, or each stream, allocates from an arena of its own instead:
+ *
+ *    retro_arena_t *arena = retro_arena_create(0);
+ *    retro_arena_t *prev  = retro_arena_set(arena);
+ *    ... open, decode and process a stream ...
+ *    retro_arena_set(prev);
+ *    retro_arena_reset(arena);          ready for the next stream
+ *
+ * An arena carves blocks of power-of-two size classes from chunks it
+ * takes from the heap, and keeps freed blocks on a free list for each
+ * class to hand out again. Blocks too big for a class come from the
+ * heap, but still belong to the arena. retro_arena_reset() frees
+ * everything allocated from an arena at once, keeping its chunks, for
+ * when a stream is finished with.
+ *
+ * A block may be freed from any thread. It goes back to the arena it
+ * came from, which has a lock of its own, so threads using different
+ * arenas don't wait for one another. With no arena set, allocations
+ * come from the heap as before, with the same block header so that the
+ * two can be mixed.
+ *
+ * The libraries are hooked up when they are built:
+ *
+ *    stb_image.h          define STBI_RETRO_ARENA
+ *    stb_image_write.h    define STBIW_RETRO_ARENA
+ *    dr_wav.h             define DRWAV_RETRO_ARENA, or pass
+ *                         retro_arena_cb_malloc/realloc/free as the
+ *                         drwav_allocation_callbacks, with an arena as
+ *                         pUserData to use that one on any thread
+ *    gme                  define BLARGG_RETRO_ARENA in blargg_config.h
+ *    rubberband           define USE_RETRO_ARENA
+ *    SoundTouch           define SOUNDTOUCH_RETRO_ARENA, or pass
+ *                         retro_arena_cb_memalign and retro_arena_cb_free
+ *                         to soundtouch::setAllocator()
+ *
+ * and then need this header in their include path.
+ * retro_arena_get_stats() and retro_arena_get_total_stats() return
+ * allocation counters for telemetry.
+ *
+ * One file must define RETRO_ARENA_IMPLEMENTATION before including
+ * this. The thread's arena is in thread-local storage; define
+ * RETRO_ARENA_THREAD_LOCAL to the keyword for compilers this doesn't
+ * know. */
+
+#ifndef __RETRO_ARENA_H__
+#define __RETRO_ARENA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct retro_arena retro_arena_t;
+
+struct retro_arena_stats
+{
+   uint64_t allocs;        /* blocks allocated, and moved by realloc */
+   uint64_t frees;         /* blocks freed, not counting resets */
+   uint64_t heap_allocs;   /* of allocs, those from the heap */
+   uint64_t resets;
+   size_t bytes_in_use;    /* asked for by blocks not freed yet */
+   size_t peak_bytes;      /* the most bytes_in_use has been */
+   size_t chunk_bytes;     /* held in chunks */
+};
+
+/**
+ * retro_arena_create:
+ * @chunk_size              : bytes to take from the heap at a time, or 0
+ *                            for 256 KB. Blocks bigger than a quarter
+ *                            of this, or 1 MB, come from the heap.
+ *
+ * Create an arena. It takes no memory until the first allocation.
+ *
+ * Returns: the arena, or NULL if out of memory.
+ */
+retro_arena_t *retro_arena_create(size_t chunk_size);
+
+/* Free @arena and everything allocated from it. Its blocks must not be
+ * used or freed afterwards, and it mustn't be set for any thread. */
+void retro_arena_destroy(retro_arena_t *arena);
+
+/* Free everything allocated from @arena at once, keeping the chunks to
+ * allocate from again. Its blocks must not be used or freed
+ * afterwards. */
+void retro_arena_reset(retro_arena_t *arena);
+
+/* Make @arena the one the calling thread allocates from, or go back to
+ * the heap if it is NULL. Returns the one that was set before. */
+retro_arena_t *retro_arena_set(retro_arena_t *arena);
+
+/* The calling thread's arena, or NULL */
+retro_arena_t *retro_arena_get(void);
+
+/**
+ * retro_arena_alloc:
+ * @arena                   : arena to allocate from, or NULL for the heap
+ * @size                    : bytes to allocate, under 4 GB
+ * @alignment               : a power of two up to 4096, or 0. Blocks
+ *                            are aligned to at least 16 bytes, or
+ *                            malloc()'s alignment if from the heap.
+ *
+ * Returns: the block, to be freed with retro_arena_free(), or NULL if
+ * out of memory.
+ */
+void *retro_arena_alloc(retro_arena_t *arena, size_t size, size_t alignment);
+
+/* malloc(), calloc(), realloc() and free() with the calling thread's
+ * arena. A block may be freed on any thread, and realloc keeps it in
+ * the arena it came from, though not its alignment from
+ * retro_arena_memalign(). */
+void *retro_arena_malloc(size_t size);
+void *retro_arena_calloc(size_t count, size_t size);
+void *retro_arena_realloc(void *ptr, size_t size);
+void *retro_arena_memalign(size_t alignment, size_t size);
+void retro_arena_free(void *ptr);
+
+/* The same in the shape of the libraries' allocator callbacks, with
+ * @arena the one to allocate from, or NULL for the calling thread's.
+ * retro_arena_cb_malloc, _realloc and _free suit
+ * drwav_allocation_callbacks, and retro_arena_cb_memalign and
+ * retro_arena_cb_free soundtouch::setAllocator(). */
+void *retro_arena_cb_malloc(size_t size, void *arena);
+void *retro_arena_cb_realloc(void *ptr, size_t size, void *arena);
+void *retro_arena_cb_memalign(size_t size, size_t alignment, void *arena);
+void retro_arena_cb_free(void *ptr, void *arena);
+
+/* Counters of @arena, or with NULL, of allocations made with no arena.
+ * Safe to call from any thread. */
+void retro_arena_get_stats(retro_arena_t *arena,
+      struct retro_arena_stats *stats);
+
+/* Counters summed over all arenas and allocations made with no arena.
+ * The peak is the sum of the peaks. */
+void retro_arena_get_total_stats(struct retro_arena_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_ARENA_IMPLEMENTATION
+#undef RETRO_ARENA_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "rthreads.h"
+
+#if defined(RETRO_ARENA_THREAD_LOCAL)
+#elif defined(_MSC_VER)
+#define RETRO_ARENA_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define RETRO_ARENA_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define RETRO_ARENA_THREAD_LOCAL _Thread_local
+#else
+#define RETRO_ARENA_THREAD_LOCAL /* one arena for the whole program */
+#endif
+
+/* Blocks of class c take 32 << c bytes of a chunk, header included */
+#define RETRO_ARENA_CLASSES     16
+#define RETRO_ARENA_LARGE       0xFF
+#define RETRO_ARENA_HEADER      16
+#define RETRO_ARENA_MAX_ALIGN   4096
+#define RETRO_ARENA_MAX_SIZE    ((size_t)UINT32_MAX - 2 * RETRO_ARENA_MAX_ALIGN)
+#define RETRO_ARENA_CHUNK_SIZE  (256 * 1024)
+#define RETRO_ARENA_MAGIC       0xA7
+
+/* In the 16 bytes before every block */
+struct retro_arena_header
+{
+   retro_arena_t *arena;   /* NULL if from the heap with no arena */
+   uint32_t size;          /* bytes asked for */
+   uint16_t offset;        /* from the start of the memory to the block */
+   uint8_t cls;            /* size class, or RETRO_ARENA_LARGE */
+   uint8_t magic;
+};
+
+/* At the start of the memory of an arena's blocks from the heap, which
+ * it keeps a list of to free them on reset */
+struct retro_arena_large
+{
+   struct retro_arena_large *prev;
+   struct retro_arena_large *next;
+};
+
+#define RETRO_ARENA_LARGE_PREFIX 16
+
+struct retro_arena_chunk
+{
+   struct retro_arena_chunk *next;
+   uint8_t *data;          /* chunk_size bytes, 64 byte aligned */
+};
+
+struct retro_arena
+{
+   volatile uint32_t lock;
+
+   /* Chunks in the order they are carved; the chunks after chunk are
+    * left over from before a reset. */
+   struct retro_arena_chunk *chunks;
+   struct retro_arena_chunk *chunk;
+   size_t used;            /* bytes of chunk carved into blocks */
+   size_t chunk_size;
+   unsigned classes;       /* size classes in use */
+
+   void *free_list[RETRO_ARENA_CLASSES];
+   struct retro_arena_large *large;
+   struct retro_arena_stats stats;
+
+   /* in the list of all arenas */
+   retro_arena_t *prev;
+   retro_arena_t *next;
+};
+
+/* Allocations with no arena, and the list of arenas */
+static struct
+{
+   volatile uint32_t lock;
+   struct retro_arena_stats stats;
+   retro_arena_t *arenas;
+} retro_arena_heap;
+
+static RETRO_ARENA_THREAD_LOCAL retro_arena_t *retro_arena_current = NULL;
+
+static void retro_arena_lock(volatile uint32_t *lock)
+{
+   uint32_t expected = 0;
+   while (!satomic_compare_exchange(lock, &expected, 1))
+   {
+      expected = 0;
+      satomic_pause();
+   }
+}
+
+static void retro_arena_unlock(volatile uint32_t *lock)
+{
+   satomic_store(lock, 0);
+}
+
+static void retro_arena_count_alloc(struct retro_arena_stats *stats,
+      size_t size, int heap)
+{
+   stats->allocs++;
+   stats->heap_allocs  += heap;
+   stats->bytes_in_use += size;
+   if (stats->bytes_in_use > stats->peak_bytes)
+      stats->peak_bytes = stats->bytes_in_use;
+}
+
+static struct retro_arena_header *retro_arena_header_of(void *ptr)
+{
+   struct retro_arena_header *header = (struct retro_arena_header*)
+      ((uint8_t*)ptr - RETRO_ARENA_HEADER);
+   assert(header->magic == RETRO_ARENA_MAGIC); /* not ours, or freed */
+   return header;
+}
+
+/* Put a block with its header in the memory at @raw, after @prefix
+ * bytes, and return the block. */
+static void *retro_arena_place(uint8_t *raw, size_t prefix,
+      retro_arena_t *arena, size_t size, size_t alignment, unsigned cls)
+{
+   uintptr_t block = (uintptr_t)raw + prefix + RETRO_ARENA_HEADER;
+   struct retro_arena_header *header;
+
+   if (alignment > RETRO_ARENA_HEADER)
+      block = (block + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+   header         = (struct retro_arena_header*)(block - RETRO_ARENA_HEADER);
+   header->arena  = arena;
+   header->size   = (uint32_t)size;
+   header->offset = (uint16_t)(block - (uintptr_t)raw);
+   header->cls    = (uint8_t)cls;
+   header->magic  = RETRO_ARENA_MAGIC;
+   return (void*)block;
+}
+
+/* Move on to the next chunk, putting what is left of the current one
+ * on the free lists. Returns false (0) if out of memory. */
+static int retro_arena_next_chunk(retro_arena_t *arena)
+{
+   struct retro_arena_chunk *chunk = arena->chunk;
+   struct retro_arena_chunk *next;
+   unsigned cls;
+
+   if (chunk)
+   {
+      for (cls = arena->classes; cls-- > 0; )
+      {
+         while (arena->used + ((size_t)32 << cls) <= arena->chunk_size)
+         {
+            void *raw = chunk->data + arena->used;
+            *(void**)raw          = arena->free_list[cls];
+            arena->free_list[cls] = raw;
+            arena->used          += (size_t)32 << cls;
+         }
+      }
+      next = chunk->next;
+   }
+   else
+      next = arena->chunks;
+
+   if (!next)
+   {
+      next = (struct retro_arena_chunk*)malloc(
+            sizeof(*next) + 64 + arena->chunk_size);
+      if (!next)
+         return 0;
+      next->next = NULL;
+      next->data = (uint8_t*)(((uintptr_t)(next + 1) + 63) & ~(uintptr_t)63);
+      if (chunk)
+         chunk->next   = next;
+      else
+         arena->chunks = next;
+      arena->stats.chunk_bytes += arena->chunk_size;
+   }
+
+   arena->chunk = next;
+   arena->used  = 0;
+   return 1;
+}
+
+retro_arena_t *retro_arena_create(size_t chunk_size)
+{
+   retro_arena_t *arena = (retro_arena_t*)calloc(1, sizeof(*arena));
+
+   if (!arena)
+      return NULL;
+
+   if (!chunk_size)
+      chunk_size = RETRO_ARENA_CHUNK_SIZE;
+   arena->chunk_size = (chunk_size + 63) & ~(size_t)63;
+   while (arena->classes < RETRO_ARENA_CLASSES
+         && ((size_t)32 << arena->classes) <= arena->chunk_size / 4)
+      arena->classes++;
+
+   retro_arena_lock(&retro_arena_heap.lock);
+   arena->next = retro_arena_heap.arenas;
+   if (arena->next)
+      arena->next->prev = arena;
+   retro_arena_heap.arenas = arena;
+   retro_arena_unlock(&retro_arena_heap.lock);
+   return arena;
+}
+
+static void retro_arena_free_large(retro_arena_t *arena)
+{
+   struct retro_arena_large *large = arena->large;
+
+   while (large)
+   {
+      struct retro_arena_large *next = large->next;
+      free(large);
+      large = next;
+   }
+   arena->large = NULL;
+}
+
+void retro_arena_destroy(retro_arena_t *arena)
+{
+   struct retro_arena_chunk *chunk;
+
+   if (!arena)
+      return;
+
+   retro_arena_lock(&retro_arena_heap.lock);
+   if (arena->prev)
+      arena->prev->next = arena->next;
+   else
+      retro_arena_heap.arenas = arena->next;
+   if (arena->next)
+      arena->next->prev = arena->prev;
+   retro_arena_unlock(&retro_arena_heap.lock);
+
+   retro_arena_free_large(arena);
+   chunk = arena->chunks;
+   while (chunk)
+   {
+      struct retro_arena_chunk *next = chunk->next;
+      free(chunk);
+      chunk = next;
+   }
+   free(arena);
+}
+
+void retro_arena_reset(retro_arena_t *arena)
+{
+   retro_arena_lock(&arena->lock);
+   retro_arena_free_large(arena);
+   memset(arena->free_list, 0, sizeof(arena->free_list));
+   arena->chunk              = NULL;
+   arena->used               = 0;
+   arena->stats.bytes_in_use = 0;
+   arena->stats.resets++;
+   retro_arena_unlock(&arena->lock);
+}
+
+retro_arena_t *retro_arena_set(retro_arena_t *arena)
+{
+   retro_arena_t *prev = retro_arena_current;
+   retro_arena_current = arena;
+   return prev;
+}
+
+retro_arena_t *retro_arena_get(void)
+{
+   return retro_arena_current;
+}
+
+void *retro_arena_alloc(retro_arena_t *arena, size_t size, size_t alignment)
+{
+   size_t slack = alignment > RETRO_ARENA_HEADER ? alignment - 1 : 0;
+   size_t need  = RETRO_ARENA_HEADER + slack + size;
+   unsigned cls = 0;
+   uint8_t *raw;
+   void *block;
+
+   if ((alignment & (alignment - 1)) || alignment > RETRO_ARENA_MAX_ALIGN
+         || size > RETRO_ARENA_MAX_SIZE)
+      return NULL;
+
+   if (!arena)
+   {
+      if (!(raw = (uint8_t*)malloc(need)))
+         return NULL;
+      block = retro_arena_place(raw, 0, NULL, size, alignment,
+            RETRO_ARENA_LARGE);
+      retro_arena_lock(&retro_arena_heap.lock);
+      retro_arena_count_alloc(&retro_arena_heap.stats, size, 1);
+      retro_arena_unlock(&retro_arena_heap.lock);
+      return block;
+   }
+
+   while (cls < arena->classes && ((size_t)32 << cls) < need)
+      cls++;
+
+   if (cls == arena->classes)
+   {
+      struct retro_arena_large *large;
+
+      if (!(raw = (uint8_t*)malloc(RETRO_ARENA_LARGE_PREFIX + need)))
+         return NULL;
+      block = retro_arena_place(raw, RETRO_ARENA_LARGE_PREFIX, arena, size,
+            alignment, RETRO_ARENA_LARGE);
+      large = (struct retro_arena_large*)raw;
+
+      retro_arena_lock(&arena->lock);
+      large->prev = NULL;
+      large->next = arena->large;
+      if (large->next)
+         large->next->prev = large;
+      arena->large = large;
+      retro_arena_count_alloc(&arena->stats, size, 1);
+      retro_arena_unlock(&arena->lock);
+      return block;
+   }
+
+   retro_arena_lock(&arena->lock);
+   if (arena->free_list[cls])
+   {
+      raw                   = (uint8_t*)arena->free_list[cls];
+      arena->free_list[cls] = *(void**)raw;
+   }
+   else
+   {
+      if (!arena->chunk || arena->used + ((size_t)32 << cls) > arena->chunk_size)
+      {
+         if (!retro_arena_next_chunk(arena))
+         {
+            retro_arena_unlock(&arena->lock);
+            return NULL;
+         }
+      }
+      raw          = arena->chunk->data + arena->used;
+      arena->used += (size_t)32 << cls;
+   }
+   retro_arena_count_alloc(&arena->stats, size, 0);
+   retro_arena_unlock(&arena->lock);
+
+   return retro_arena_place(raw, 0, arena, size, alignment, cls);
+}
+
+void retro_arena_free(void *ptr)
+{
+   struct retro_arena_header *header;
+   retro_arena_t *arena;
+   uint8_t *raw;
+   unsigned cls;
+   size_t size;
+
+   if (!ptr)
+      return;
+
+   header        = retro_arena_header_of(ptr);
+   arena         = header->arena;
+   size          = header->size;
+   cls           = header->cls;
+   raw           = (uint8_t*)ptr - header->offset;
+   header->magic = 0;
+
+   if (!arena)
+   {
+      retro_arena_lock(&retro_arena_heap.lock);
+      retro_arena_heap.stats.frees++;
+      retro_arena_heap.stats.bytes_in_use -= size;
+      retro_arena_unlock(&retro_arena_heap.lock);
+      free(raw);
+      return;
+   }
+
+   retro_arena_lock(&arena->lock);
+   arena->stats.frees++;
+   arena->stats.bytes_in_use -= size;
+   if (cls == RETRO_ARENA_LARGE)
+   {
+      struct retro_arena_large *large = (struct retro_arena_large*)raw;
+      if (large->prev)
+         large->prev->next = large->next;
+      else
+         arena->large      = large->next;
+      if (large->next)
+         large->next->prev = large->prev;
+      retro_arena_unlock(&arena->lock);
+      free(raw);
+      return;
+   }
+   *(void**)raw          = arena->free_list[cls];
+   arena->free_list[cls] = raw;
+   retro_arena_unlock(&arena->lock);
+}
+
+/* realloc() of a block, or if @ptr is NULL, malloc() from @arena */
+static void *retro_arena_resize(retro_arena_t *arena, void *ptr, size_t size)
+{
+   struct retro_arena_header *header;
+   struct retro_arena_stats *stats;
+   volatile uint32_t *lock;
+   size_t old;
+   void *block;
+
+   if (!ptr)
+      return retro_arena_alloc(arena, size, 0);
+   if (!size)
+   {
+      retro_arena_free(ptr);
+      return NULL;
+   }
+   if (size > RETRO_ARENA_MAX_SIZE)
+      return NULL;
+
+   header = retro_arena_header_of(ptr);
+   arena  = header->arena;
+   old    = header->size;
+
+   if (!arena && header->offset == RETRO_ARENA_HEADER)
+   {
+      /* the heap can resize it, perhaps in place */
+      uint8_t *raw = (uint8_t*)realloc(header, RETRO_ARENA_HEADER + size);
+      if (!raw)
+         return NULL;
+      block = raw + RETRO_ARENA_HEADER;
+      ((struct retro_arena_header*)raw)->size = (uint32_t)size;
+      stats = &retro_arena_heap.stats;
+      lock  = &retro_arena_heap.lock;
+   }
+   else if (arena && header->cls != RETRO_ARENA_LARGE
+         && header->offset + size <= (size_t)32 << header->cls)
+   {
+      /* still fits */
+      block        = ptr;
+      header->size = (uint32_t)size;
+      stats        = &arena->stats;
+      lock         = &arena->lock;
+   }
+   else
+   {
+      if (!(block = retro_arena_alloc(arena, size, 0)))
+         return NULL;
+      memcpy(block, ptr, old < size ? old : size);
+      retro_arena_free(ptr);
+      return block;
+   }
+
+   retro_arena_lock(lock);
+   stats->bytes_in_use = stats->bytes_in_use - old + size;
+   if (stats->bytes_in_use > stats->peak_bytes)
+      stats->peak_bytes = stats->bytes_in_use;
+   retro_arena_unlock(lock);
+   return block;
+}
+
+void *retro_arena_malloc(size_t size)
+{
+   return retro_arena_alloc(retro_arena_current, size, 0);
+}
+
+void *retro_arena_calloc(size_t count, size_t size)
+{
+   void *block;
+
+   if (size && count > RETRO_ARENA_MAX_SIZE / size)
+      return NULL;
+   if ((block = retro_arena_alloc(retro_arena_current, count * size, 0)))
+      memset(block, 0, count * size);
+   return block;
+}
+
+void *retro_arena_realloc(void *ptr, size_t size)
+{
+   return retro_arena_resize(retro_arena_current, ptr, size);
+}
+
+void *retro_arena_memalign(size_t alignment, size_t size)
+{
+   return retro_arena_alloc(retro_arena_current, size, alignment);
+}
+
+void *retro_arena_cb_malloc(size_t size, void *arena)
+{
+   return retro_arena_alloc(arena ? (retro_arena_t*)arena
+         : retro_arena_current, size, 0);
+}
+
+void *retro_arena_cb_realloc(void *ptr, size_t size, void *arena)
+{
+   return retro_arena_resize(arena ? (retro_arena_t*)arena
+         : retro_arena_current, ptr, size);
+}
+
+void *retro_arena_cb_memalign(size_t size, size_t alignment, void *arena)
+{
+   return retro_arena_alloc(arena ? (retro_arena_t*)arena
+         : retro_arena_current, size, alignment);
+}
+
+void retro_arena_cb_free(void *ptr, void *arena)
+{
+   (void)arena;
+   retro_arena_free(ptr);
+}
+
+void retro_arena_get_stats(retro_arena_t *arena,
+      struct retro_arena_stats *stats)
+{
+   volatile uint32_t *lock = arena ? &arena->lock : &retro_arena_heap.lock;
+
+   retro_arena_lock(lock);
+   *stats = arena ? arena->stats : retro_arena_heap.stats;
+   retro_arena_unlock(lock);
+}
+
+void retro_arena_get_total_stats(struct retro_arena_stats *stats)
+{
+   retro_arena_t *arena;
+
+   retro_arena_lock(&retro_arena_heap.lock);
+   *stats = retro_arena_heap.stats;
+   for (arena = retro_arena_heap.arenas; arena; arena = arena->next)
+   {
+      retro_arena_lock(&arena->lock);
+      stats->allocs       += arena->stats.allocs;
+      stats->frees        += arena->stats.frees;
+      stats->heap_allocs  += arena->stats.heap_allocs;
+      stats->resets       += arena->stats.resets;
+      stats->bytes_in_use += arena->stats.bytes_in_use;
+      stats->peak_bytes   += arena->stats.peak_bytes;
+      stats->chunk_bytes  += arena->stats.chunk_bytes;
+      retro_arena_unlock(&arena->lock);
+   }
+   retro_arena_unlock(&retro_arena_heap.lock);
+}
+
+#endif
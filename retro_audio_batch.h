@@ -0,0 +1,157 @@
+/* retro_audio_batch.h - coalescing retro_audio_sample_t for libretro
+ * frontends.
+ *
+ * Cores that call retro_audio_sample_t once per stereo frame make the
+ * frontend run its whole audio path, dispatch, locking and conversion,
+ * 800 times a frame at 48 kHz. Give the core retro_audio_batch_sample()
+ * instead, and the frames are gathered in a buffer of the calling
+ * thread's own and handed to the frontend's batch callback all at once
+ * when retro_audio_batch_flush() is called after retro_run(), or when
+ * the buffer fills:
+ *
+ *    retro_set_audio_sample(retro_audio_batch_sample);
+ *    retro_set_audio_sample_batch(retro_audio_batch_samples);
+ *    retro_audio_batch_set_callback(audio_batch);  on each thread that runs the core
+ *    ...
+ *    retro_run();
+ *    retro_audio_batch_flush();
+ *
+ * retro_audio_batch_samples() flushes what's gathered before passing
+ * the core's own batches on, so cores that use both keep their order.
+ * The buffer is thread local, so a core run on another thread (for
+ * fast-forward, run-ahead or threaded video) needs nothing shared.
+ *
+ * What reaches the frontend is interleaved 16-bit frames, which
+ * resampler_sinc_process_s16() takes as they are, converting while it
+ * reads. For outputs that want floats, such as saudio_push(),
+ * retro_audio_batch_to_float() converts a whole batch in one pass, with
+ * SSE2 or NEON where there is one.
+ *
+ * One file must define RETRO_AUDIO_BATCH_IMPLEMENTATION before
+ * including this. Define RETRO_AUDIO_BATCH_FRAMES to change the size of
+ * the buffer, 2048 frames by default. */
+
+#ifndef __RETRO_AUDIO_BATCH_H__
+#define __RETRO_AUDIO_BATCH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Where this thread's frames go; NULL drops them. */
+void retro_audio_batch_set_callback(retro_audio_sample_batch_t callback);
+
+/* For retro_set_audio_sample() */
+void retro_audio_batch_sample(int16_t left, int16_t right);
+
+/* For retro_set_audio_sample_batch() */
+size_t retro_audio_batch_samples(const int16_t *data, size_t frames);
+
+/* Hand what's gathered to the callback; after each retro_run(). */
+void retro_audio_batch_flush(void);
+
+/**
+ * retro_audio_batch_to_float:
+ * @out                     : @samples floats
+ * @in                      : @samples 16-bit samples
+ * @samples                 : samples, so twice the frames for stereo
+ *
+ * Convert to floats from -1.0 to 1.0.
+ */
+void retro_audio_batch_to_float(float *out, const int16_t *in, size_t samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_AUDIO_BATCH_IMPLEMENTATION
+#undef RETRO_AUDIO_BATCH_IMPLEMENTATION
+
+#ifndef RETRO_AUDIO_BATCH_FRAMES
+#define RETRO_AUDIO_BATCH_FRAMES 2048
+#endif
+
+#if defined(_MSC_VER)
+#define RETRO_AUDIO_BATCH_TLS __declspec(thread)
+#else
+#define RETRO_AUDIO_BATCH_TLS __thread
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RETRO_AUDIO_BATCH_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define RETRO_AUDIO_BATCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+static RETRO_AUDIO_BATCH_TLS retro_audio_sample_batch_t retro_audio_batch_callback;
+static RETRO_AUDIO_BATCH_TLS size_t retro_audio_batch_count;
+static RETRO_AUDIO_BATCH_TLS int16_t retro_audio_batch_buffer[RETRO_AUDIO_BATCH_FRAMES * 2];
+
+void retro_audio_batch_set_callback(retro_audio_sample_batch_t callback)
+{
+   retro_audio_batch_callback = callback;
+   retro_audio_batch_count    = 0;
+}
+
+void retro_audio_batch_flush(void)
+{
+   if (retro_audio_batch_count && retro_audio_batch_callback)
+      retro_audio_batch_callback(retro_audio_batch_buffer, retro_audio_batch_count);
+   retro_audio_batch_count = 0;
+}
+
+void retro_audio_batch_sample(int16_t left, int16_t right)
+{
+   int16_t *frame = &retro_audio_batch_buffer[retro_audio_batch_count * 2];
+   frame[0]       = left;
+   frame[1]       = right;
+   if (++retro_audio_batch_count == RETRO_AUDIO_BATCH_FRAMES)
+      retro_audio_batch_flush();
+}
+
+size_t retro_audio_batch_samples(const int16_t *data, size_t frames)
+{
+   retro_audio_batch_flush();
+   if (!retro_audio_batch_callback)
+      return frames;
+   return retro_audio_batch_callback(data, frames);
+}
+
+void retro_audio_batch_to_float(float *out, const int16_t *in, size_t samples)
+{
+   size_t i = 0;
+
+#if defined(RETRO_AUDIO_BATCH_SSE2)
+   const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+   for (; i + 8 <= samples; i += 8)
+   {
+      __m128i s  = _mm_loadu_si128((const __m128i*)(in + i));
+      /* sign extend by unpacking into the high halves and shifting */
+      __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+      __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+      _mm_storeu_ps(out + i,     _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+      _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+   }
+#elif defined(RETRO_AUDIO_BATCH_NEON)
+   for (; i + 8 <= samples; i += 8)
+   {
+      int16x8_t s = vld1q_s16(in + i);
+      /* fixed point with 15 fraction bits is the same scaling */
+      vst1q_f32(out + i,     vcvtq_n_f32_s32(vmovl_s16(vget_low_s16(s)), 15));
+      vst1q_f32(out + i + 4, vcvtq_n_f32_s32(vmovl_s16(vget_high_s16(s)), 15));
+   }
+#endif
+   for (; i < samples; i++)
+      out[i] = (float)in[i] * (1.0f / 32768.0f);
+}
+
+#endif
@@ -0,0 +1,136 @@
+/* retro_audio_status.h - RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK
+ * for libretro frontends.
+ *
+ * A core given this callback hears before each retro_run() how full the
+ * frontend's audio buffer is, and whether it is likely to run dry before
+ * the next frame, and can skip rendering video for a frame to catch up
+ * instead of letting audio underrun. That only works if the numbers are
+ * right, so they're taken from the audio output itself:
+ *
+ *    occupancy        the push ring's fill, as a percentage of its size
+ *    underrun_likely  fewer frames queued for the speaker, ring and
+ *                     device buffer together, than the device will play
+ *                     during one video frame plus a margin
+ *
+ * With sokol_audio these come from saudio_ring_fill(),
+ * saudio_ring_frames() and saudio_latency_frames(); with SDL's queueing
+ * API, from SDL_GetQueuedAudioSize() and the device's buffer size.
+ * Include sokol_audio.h or SDL_audio.h first to get the helper for it.
+ *
+ * None of this changes the rate audio is produced at; keep the ring at
+ * its target fill with resampler_rate_control_update() from resampler.h,
+ * fed the same fill and size, and this only matters when the machine
+ * can't keep up at all.
+ *
+ * The state is a plain struct, so this is all inline. */
+
+#ifndef __RETRO_AUDIO_STATUS_H__
+#define __RETRO_AUDIO_STATUS_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define RETRO_AUDIO_STATUS_API static __inline
+#else
+#define RETRO_AUDIO_STATUS_API static inline
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct retro_audio_status
+{
+   retro_audio_buffer_status_callback_t callback;  /* NULL when the core hasn't set one */
+   double frames_per_video_frame;                  /* audio frames played per video frame */
+   double margin;                                  /* in video frames, 0.5 by default */
+};
+
+/**
+ * retro_audio_status_init:
+ * @status                  : state to set up
+ * @sample_rate             : of the audio output
+ * @fps                     : of the core, from retro_system_timing
+ *
+ * Zero @status before the first call. Call again with the new values
+ * when either changes.
+ */
+RETRO_AUDIO_STATUS_API void retro_audio_status_init(struct retro_audio_status *status,
+      double sample_rate, double fps)
+{
+   status->frames_per_video_frame = fps > 0.0 ? sample_rate / fps : 0.0;
+   if (status->margin <= 0.0)
+      status->margin = 0.5;
+}
+
+/* For the environment callback; a NULL @cb, or NULL callback in it,
+ * stops the reports. */
+RETRO_AUDIO_STATUS_API void retro_audio_status_set_callback(struct retro_audio_status *status,
+      const struct retro_audio_buffer_status_callback *cb)
+{
+   status->callback = cb ? cb->callback : NULL;
+}
+
+/**
+ * retro_audio_status_report:
+ * @status                  : state
+ * @active                  : false if audio is off, or the output is paused
+ * @fill                    : frames in the ring waiting to be played
+ * @size                    : size of the ring, in frames
+ * @queued                  : frames yet to reach the speaker, @fill included
+ *
+ * Tell the core, right before retro_run().
+ */
+RETRO_AUDIO_STATUS_API void retro_audio_status_report(struct retro_audio_status *status,
+      bool active, size_t fill, size_t size, size_t queued)
+{
+   unsigned occupancy;
+   bool underrun_likely;
+
+   if (!status->callback)
+      return;
+   if (!active || !size)
+   {
+      status->callback(false, 0, false);
+      return;
+   }
+   occupancy       = fill >= size ? 100 : (unsigned)(fill * 100 / size);
+   underrun_likely = (double)queued
+      < status->frames_per_video_frame * (1.0 + status->margin);
+   status->callback(true, occupancy, underrun_likely);
+}
+
+#ifdef SOKOL_AUDIO_INCLUDED
+/* For the main sokol_audio stream, pushed to with saudio_push(). */
+RETRO_AUDIO_STATUS_API void retro_audio_status_report_saudio(struct retro_audio_status *status,
+      bool active)
+{
+   int fill = saudio_ring_fill(), latency = saudio_latency_frames();
+   retro_audio_status_report(status, active,
+         fill > 0 ? (size_t)fill : 0, (size_t)saudio_ring_frames(),
+         latency > 0 ? (size_t)latency : 0);
+}
+#endif
+
+#ifdef SDL_audio_h_
+/* For a device opened with no callback, fed with SDL_QueueAudio().
+ * @size is how many frames the frontend lets queue up, @frame_bytes
+ * the size of one frame and @device_frames the obtained spec's samples. */
+RETRO_AUDIO_STATUS_API void retro_audio_status_report_sdl(struct retro_audio_status *status,
+      SDL_AudioDeviceID device, size_t size, size_t frame_bytes, size_t device_frames)
+{
+   size_t fill = frame_bytes ? SDL_GetQueuedAudioSize(device) / frame_bytes : 0;
+   retro_audio_status_report(status,
+         SDL_GetAudioDeviceStatus(device) == SDL_AUDIO_PLAYING,
+         fill, size, fill + device_frames);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,616 @@
+/* retro_audio_trace.h - end-to-end latency and buffer occupancy of a
+ * frontend's audio path.
+ *
+ * Audio from a core goes through several buffers before it is heard:
+ * whatever retro_audio_sample_batch_t hands it to, the resampler, a
+ * time stretcher if there is one, and the ring and device buffer of
+ * sokol_audio or SDL. Each adds latency, and sizing them by guesswork
+ * means either underruns or audio that lags the picture. This measures
+ * them while the frontend runs.
+ *
+ * Each buffer is a stage, registered in the order audio goes through
+ * them. Tell the trace how many frames go into each stage and how many
+ * come out of it:
+ *
+ *    trace  = retro_audio_trace_new(0);
+ *    core   = retro_audio_trace_add_stage(trace, "core", 44100.0);
+ *    sinc   = retro_audio_trace_add_stage(trace, "resampler", 48000.0);
+ *    ring   = retro_audio_trace_add_stage(trace, "saudio", 48000.0);
+ *    retro_audio_trace_set_ratio(trace, sinc, 48000.0 / 44100.0);
+ *    ...
+ *    retro_audio_trace_in(trace, core, frames);      in the batch callback
+ *    retro_audio_trace_out(trace, core, frames);     handed to the resampler
+ *    retro_audio_trace_in(trace, sinc, frames);
+ *    retro_audio_trace_out(trace, sinc, produced);
+ *    retro_audio_trace_in(trace, ring, produced);    and saudio_push()
+ *    retro_audio_trace_sync(trace, ring, saudio_ring_fill());
+ *
+ * Counts are turned into seconds of playback, so that stages at
+ * different rates add up, which gives each stage's occupancy. Every
+ * few milliseconds the frame at the end of a block entering the first
+ * stage is marked with the time, and followed from stage to stage; the
+ * time it leaves the last one is the measured end-to-end latency, and
+ * the time it spent in each, that stage's share. Jitter is the mean
+ * change in latency from one mark to the next, smoothed as in RFC 3550.
+ *
+ * The device plays audio some time after the last stage a frontend can
+ * see lets go of it; add that with retro_audio_trace_set_output_delay(),
+ * from saudio_latency_frames() for instance.
+ *
+ * Stages may be reported from any thread; a lock is held for a few
+ * dozen instructions per call. One file must define
+ * RETRO_AUDIO_TRACE_IMPLEMENTATION before including this, with
+ * rthreads.h built somewhere. */
+
+#ifndef __RETRO_AUDIO_TRACE_H__
+#define __RETRO_AUDIO_TRACE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETRO_AUDIO_TRACE_MAX_STAGES 8
+
+typedef struct retro_audio_trace retro_audio_trace_t;
+
+struct retro_audio_trace_stage_stats
+{
+   const char *name;
+   double rate;          /* frames per second it plays out at */
+   uint64_t frames_in;
+   uint64_t frames_out;
+   double fill_frames;   /* queued now, in output frames */
+   double fill_ms;       /* queued now */
+   double min_ms;        /* since the last reset */
+   double mean_ms;
+   double max_ms;
+   double resident_ms;   /* mean time a mark spent in the stage */
+};
+
+struct retro_audio_trace_stats
+{
+   uint64_t marks;       /* that made it through, since the last reset */
+   uint64_t dropped;     /* that were lost to a stage that never let go */
+   double latency_ms;    /* of the last one */
+   double min_ms;
+   double mean_ms;
+   double max_ms;
+   double jitter_ms;
+   double estimate_ms;   /* stage occupancy now, plus the output delay */
+};
+
+/**
+ * retro_audio_trace_new:
+ * @interval_us             : how often to mark a block, 0 for every 50ms
+ *
+ * Returns: new trace with no stages, or NULL if out of memory.
+ */
+retro_audio_trace_t *retro_audio_trace_new(unsigned interval_us);
+
+void retro_audio_trace_free(retro_audio_trace_t *trace);
+
+/**
+ * retro_audio_trace_add_stage:
+ * @trace                   : trace
+ * @name                    : for the reports; copied
+ * @rate                    : frames per second of playback, of what
+ *                            comes out of the stage
+ *
+ * Add a stage after the ones already added. Audio leaving a stage is
+ * taken to go into the next one.
+ *
+ * Returns: index of the stage, or -1 if there are already
+ * RETRO_AUDIO_TRACE_MAX_STAGES.
+ */
+int retro_audio_trace_add_stage(retro_audio_trace_t *trace,
+      const char *name, double rate);
+
+/* Change the rate of @stage, as in retro_audio_trace_add_stage(). */
+void retro_audio_trace_set_rate(retro_audio_trace_t *trace,
+      int stage, double rate);
+
+/**
+ * retro_audio_trace_set_ratio:
+ * @trace                   : trace
+ * @stage                   : stage
+ * @ratio                   : frames out per frame in; 1 by default
+ *
+ * For stages that change the number of frames: output rate over input
+ * rate for a resampler, and 1 / tempo for a time stretcher. Keep it up
+ * to date when dynamic rate control adjusts the resampler, or the
+ * occupancy of the stage drifts.
+ */
+void retro_audio_trace_set_ratio(retro_audio_trace_t *trace,
+      int stage, double ratio);
+
+/* @frames went into @stage, or came out of it. Report a block leaving
+ * one stage before it goes into the next. */
+void retro_audio_trace_in(retro_audio_trace_t *trace,
+      int stage, size_t frames);
+void retro_audio_trace_out(retro_audio_trace_t *trace,
+      int stage, size_t frames);
+
+/**
+ * retro_audio_trace_sync:
+ * @trace                   : trace
+ * @stage                   : stage
+ * @fill                    : frames in it now, in output frames
+ *
+ * For stages that drain out of sight, such as the ring sokol_audio's
+ * thread reads from, or SDL's queue: what came out is worked out from
+ * what went in and what's still there.
+ */
+void retro_audio_trace_sync(retro_audio_trace_t *trace,
+      int stage, double fill);
+
+/* Latency after the last stage, in the device or the OS mixer. */
+void retro_audio_trace_set_output_delay(retro_audio_trace_t *trace,
+      double ms);
+
+/* Clear the statistics. Marks on their way through are kept. */
+void retro_audio_trace_reset(retro_audio_trace_t *trace);
+
+void retro_audio_trace_get_stats(retro_audio_trace_t *trace,
+      struct retro_audio_trace_stats *stats);
+
+/**
+ * retro_audio_trace_get_stages:
+ * @trace                   : trace
+ * @stats                   : filled in, in the order the stages were added
+ * @max                     : size of @stats
+ *
+ * Returns: the number of entries filled in.
+ */
+unsigned retro_audio_trace_get_stages(retro_audio_trace_t *trace,
+      struct retro_audio_trace_stage_stats *stats, unsigned max);
+
+/* A line for the latency and one per stage, with a header, as text for
+ * an overlay. Returns the length, like snprintf(). */
+size_t retro_audio_trace_format_overlay(retro_audio_trace_t *trace,
+      char *buf, size_t size);
+
+/**
+ * retro_audio_trace_write_json:
+ * @trace                   : trace
+ * @file                    : file to write to
+ *
+ * Returns: true (1) if everything was written, false (0) otherwise.
+ */
+bool retro_audio_trace_write_json(retro_audio_trace_t *trace, FILE *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_AUDIO_TRACE_IMPLEMENTATION
+#undef RETRO_AUDIO_TRACE_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rthreads.h"
+
+/* Marks in a stage at once; with 50ms between them, enough for a
+ * stage that holds three seconds */
+#define RETRO_AUDIO_TRACE_MARKS 64
+
+struct retro_audio_trace_mark
+{
+   int64_t start_us;    /* entered the first stage */
+   int64_t entered_us;  /* entered this one */
+   double pos;          /* in the stage's input, in seconds */
+};
+
+struct retro_audio_trace_stage
+{
+   char name[32];
+   double rate;
+   double ratio;
+   /* Seconds of playback that went in and came out; the difference is
+    * what's queued */
+   double in_sec;
+   double out_sec;
+   uint64_t frames_in;
+   uint64_t frames_out;
+   double fill_min;
+   double fill_max;
+   double fill_sum;
+   uint64_t fill_count;
+   double resident_sum_us;
+   uint64_t resident_count;
+   struct retro_audio_trace_mark marks[RETRO_AUDIO_TRACE_MARKS];
+   unsigned mark_head;
+   unsigned mark_count;
+};
+
+struct retro_audio_trace
+{
+   slock_t *lock;
+   int64_t interval_us;
+   int64_t next_mark_us;
+   double output_delay_us;
+   uint64_t marks;
+   uint64_t dropped;
+   double last_us;
+   double min_us;
+   double max_us;
+   double sum_us;
+   double jitter_us;
+   unsigned count;
+   struct retro_audio_trace_stage stages[RETRO_AUDIO_TRACE_MAX_STAGES];
+};
+
+retro_audio_trace_t *retro_audio_trace_new(unsigned interval_us)
+{
+   retro_audio_trace_t *trace = (retro_audio_trace_t*)calloc(1, sizeof(*trace));
+   if (!trace)
+      return NULL;
+   trace->lock = slock_new();
+   if (!trace->lock)
+   {
+      free(trace);
+      return NULL;
+   }
+   trace->interval_us = interval_us ? interval_us : 50000;
+   return trace;
+}
+
+void retro_audio_trace_free(retro_audio_trace_t *trace)
+{
+   if (!trace)
+      return;
+   slock_free(trace->lock);
+   free(trace);
+}
+
+static void retro_audio_trace_clear_stage(struct retro_audio_trace_stage *s)
+{
+   s->fill_min        = 0.0;
+   s->fill_max        = 0.0;
+   s->fill_sum        = 0.0;
+   s->fill_count      = 0;
+   s->resident_sum_us = 0.0;
+   s->resident_count  = 0;
+}
+
+int retro_audio_trace_add_stage(retro_audio_trace_t *trace,
+      const char *name, double rate)
+{
+   struct retro_audio_trace_stage *s;
+   int index;
+
+   slock_lock(trace->lock);
+   if (trace->count >= RETRO_AUDIO_TRACE_MAX_STAGES)
+   {
+      slock_unlock(trace->lock);
+      return -1;
+   }
+   index = (int)trace->count++;
+   s     = &trace->stages[index];
+   memset(s, 0, sizeof(*s));
+   strncpy(s->name, name ? name : "", sizeof(s->name) - 1);
+   s->rate  = rate > 0.0 ? rate : 1.0;
+   s->ratio = 1.0;
+   slock_unlock(trace->lock);
+   return index;
+}
+
+void retro_audio_trace_set_rate(retro_audio_trace_t *trace,
+      int stage, double rate)
+{
+   if (stage < 0 || (unsigned)stage >= trace->count || rate <= 0.0)
+      return;
+   slock_lock(trace->lock);
+   trace->stages[stage].rate = rate;
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_set_ratio(retro_audio_trace_t *trace,
+      int stage, double ratio)
+{
+   if (stage < 0 || (unsigned)stage >= trace->count || ratio <= 0.0)
+      return;
+   slock_lock(trace->lock);
+   trace->stages[stage].ratio = ratio;
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_set_output_delay(retro_audio_trace_t *trace,
+      double ms)
+{
+   slock_lock(trace->lock);
+   trace->output_delay_us = ms > 0.0 ? ms * 1000.0 : 0.0;
+   slock_unlock(trace->lock);
+}
+
+static void retro_audio_trace_note_fill(struct retro_audio_trace_stage *s)
+{
+   double fill = s->in_sec - s->out_sec;
+   if (fill < 0.0)
+   {
+      /* A stale ratio let the count run ahead; start again from empty */
+      s->in_sec = s->out_sec;
+      fill      = 0.0;
+   }
+   if (!s->fill_count || fill < s->fill_min)
+      s->fill_min = fill;
+   if (fill > s->fill_max)
+      s->fill_max = fill;
+   s->fill_sum += fill;
+   s->fill_count++;
+}
+
+static void retro_audio_trace_push_mark(retro_audio_trace_t *trace,
+      struct retro_audio_trace_stage *s, int64_t start_us, int64_t now,
+      double pos)
+{
+   struct retro_audio_trace_mark *m;
+   if (s->mark_count >= RETRO_AUDIO_TRACE_MARKS)
+   {
+      trace->dropped++;
+      return;
+   }
+   m = &s->marks[(s->mark_head + s->mark_count++) % RETRO_AUDIO_TRACE_MARKS];
+   m->start_us   = start_us;
+   m->entered_us = now;
+   m->pos        = pos;
+}
+
+static void retro_audio_trace_add_latency(retro_audio_trace_t *trace,
+      double us)
+{
+   if (trace->marks)
+   {
+      double change = us - trace->last_us;
+      if (change < 0.0)
+         change = -change;
+      trace->jitter_us += (change - trace->jitter_us) / 16.0;
+   }
+   if (!trace->marks || us < trace->min_us)
+      trace->min_us = us;
+   if (us > trace->max_us)
+      trace->max_us = us;
+   trace->sum_us  += us;
+   trace->last_us  = us;
+   trace->marks++;
+}
+
+/* Move marks that @seconds of output carried past on to the next stage,
+ * or, from the last, into the latency statistics. */
+static void retro_audio_trace_advance(retro_audio_trace_t *trace,
+      int stage, double seconds)
+{
+   struct retro_audio_trace_stage *s    = &trace->stages[stage];
+   struct retro_audio_trace_stage *next = (unsigned)stage + 1 < trace->count
+      ? &trace->stages[stage + 1] : NULL;
+   double before = s->out_sec;
+   int64_t now;
+
+   s->out_sec += seconds;
+   s->frames_out += (uint64_t)(seconds * s->rate + 0.5);
+   retro_audio_trace_note_fill(s);
+   /* Allow for rounding, or a mark at the end of a block can miss it */
+   if (!s->mark_count || s->marks[s->mark_head].pos > s->out_sec + 1e-9)
+      return;
+
+   now = sthread_clock_us();
+   while (s->mark_count && s->marks[s->mark_head].pos <= s->out_sec + 1e-9)
+   {
+      struct retro_audio_trace_mark *m = &s->marks[s->mark_head];
+      double offset = m->pos - before;
+
+      s->resident_sum_us += (double)(now - m->entered_us);
+      s->resident_count++;
+      if (next)
+         retro_audio_trace_push_mark(trace, next, m->start_us, now,
+               next->in_sec + (offset > 0.0 ? offset : 0.0));
+      else
+         retro_audio_trace_add_latency(trace,
+               (double)(now - m->start_us) + trace->output_delay_us);
+      s->mark_head = (s->mark_head + 1) % RETRO_AUDIO_TRACE_MARKS;
+      s->mark_count--;
+   }
+}
+
+void retro_audio_trace_in(retro_audio_trace_t *trace,
+      int stage, size_t frames)
+{
+   struct retro_audio_trace_stage *s;
+
+   if (stage < 0 || (unsigned)stage >= trace->count || !frames)
+      return;
+   slock_lock(trace->lock);
+   s = &trace->stages[stage];
+   s->in_sec    += (double)frames * s->ratio / s->rate;
+   s->frames_in += frames;
+   retro_audio_trace_note_fill(s);
+   if (stage == 0)
+   {
+      int64_t now = sthread_clock_us();
+      if (now >= trace->next_mark_us)
+      {
+         retro_audio_trace_push_mark(trace, s, now, now, s->in_sec);
+         trace->next_mark_us = now + trace->interval_us;
+      }
+   }
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_out(retro_audio_trace_t *trace,
+      int stage, size_t frames)
+{
+   if (stage < 0 || (unsigned)stage >= trace->count || !frames)
+      return;
+   slock_lock(trace->lock);
+   retro_audio_trace_advance(trace, stage,
+         (double)frames / trace->stages[stage].rate);
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_sync(retro_audio_trace_t *trace,
+      int stage, double fill)
+{
+   struct retro_audio_trace_stage *s;
+   double drained;
+
+   if (stage < 0 || (unsigned)stage >= trace->count)
+      return;
+   slock_lock(trace->lock);
+   s       = &trace->stages[stage];
+   drained = s->in_sec - s->out_sec - (fill > 0.0 ? fill : 0.0) / s->rate;
+   if (drained > 0.0)
+      retro_audio_trace_advance(trace, stage, drained);
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_reset(retro_audio_trace_t *trace)
+{
+   unsigned i;
+
+   slock_lock(trace->lock);
+   for (i = 0; i < trace->count; i++)
+      retro_audio_trace_clear_stage(&trace->stages[i]);
+   trace->marks     = 0;
+   trace->dropped   = 0;
+   trace->last_us   = 0.0;
+   trace->min_us    = 0.0;
+   trace->max_us    = 0.0;
+   trace->sum_us    = 0.0;
+   trace->jitter_us = 0.0;
+   slock_unlock(trace->lock);
+}
+
+void retro_audio_trace_get_stats(retro_audio_trace_t *trace,
+      struct retro_audio_trace_stats *stats)
+{
+   double queued = 0.0;
+   unsigned i;
+
+   slock_lock(trace->lock);
+   for (i = 0; i < trace->count; i++)
+      queued += trace->stages[i].in_sec - trace->stages[i].out_sec;
+   stats->marks       = trace->marks;
+   stats->dropped     = trace->dropped;
+   stats->latency_ms  = trace->last_us / 1000.0;
+   stats->min_ms      = trace->min_us / 1000.0;
+   stats->mean_ms     = trace->marks ? trace->sum_us / trace->marks / 1000.0 : 0.0;
+   stats->max_ms      = trace->max_us / 1000.0;
+   stats->jitter_ms   = trace->jitter_us / 1000.0;
+   stats->estimate_ms = queued * 1000.0 + trace->output_delay_us / 1000.0;
+   slock_unlock(trace->lock);
+}
+
+unsigned retro_audio_trace_get_stages(retro_audio_trace_t *trace,
+      struct retro_audio_trace_stage_stats *stats, unsigned max)
+{
+   unsigned i, count;
+
+   slock_lock(trace->lock);
+   count = trace->count < max ? trace->count : max;
+   for (i = 0; i < count; i++)
+   {
+      const struct retro_audio_trace_stage *s = &trace->stages[i];
+      double fill = s->in_sec - s->out_sec;
+
+      stats[i].name        = s->name;
+      stats[i].rate        = s->rate;
+      stats[i].frames_in   = s->frames_in;
+      stats[i].frames_out  = s->frames_out;
+      stats[i].fill_frames = fill * s->rate;
+      stats[i].fill_ms     = fill * 1000.0;
+      stats[i].min_ms      = s->fill_min * 1000.0;
+      stats[i].mean_ms     = s->fill_count
+         ? s->fill_sum / s->fill_count * 1000.0 : 0.0;
+      stats[i].max_ms      = s->fill_max * 1000.0;
+      stats[i].resident_ms = s->resident_count
+         ? s->resident_sum_us / s->resident_count / 1000.0 : 0.0;
+   }
+   slock_unlock(trace->lock);
+   return count;
+}
+
+size_t retro_audio_trace_format_overlay(retro_audio_trace_t *trace,
+      char *buf, size_t size)
+{
+   struct retro_audio_trace_stage_stats stages[RETRO_AUDIO_TRACE_MAX_STAGES];
+   struct retro_audio_trace_stats stats;
+   unsigned i, count = retro_audio_trace_get_stages(trace, stages,
+         RETRO_AUDIO_TRACE_MAX_STAGES);
+   size_t len = 0;
+   int n;
+
+   retro_audio_trace_get_stats(trace, &stats);
+   n = snprintf(buf, size, "%-16s %8s %8s %8s %8s %8s\n",
+         "audio (ms)", "now", "min", "mean", "max", "jitter");
+   len += n > 0 ? (size_t)n : 0;
+   n = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+         "%-16s %8.1f %8.1f %8.1f %8.1f %8.2f\n", "latency",
+         stats.latency_ms, stats.min_ms, stats.mean_ms, stats.max_ms,
+         stats.jitter_ms);
+   len += n > 0 ? (size_t)n : 0;
+   for (i = 0; i < count; i++)
+   {
+      n = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+            "%-16.16s %8.1f %8.1f %8.1f %8.1f\n", stages[i].name,
+            stages[i].fill_ms, stages[i].min_ms, stages[i].mean_ms,
+            stages[i].max_ms);
+      len += n > 0 ? (size_t)n : 0;
+   }
+   return len;
+}
+
+static void retro_audio_trace_json_string(FILE *file, const char *s)
+{
+   fputc('"', file);
+   for (; *s; s++)
+   {
+      if (*s == '"' || *s == '\\')
+         fprintf(file, "\\%c", *s);
+      else if ((unsigned char)*s < 0x20)
+         fprintf(file, "\\u%04x", (unsigned char)*s);
+      else
+         fputc(*s, file);
+   }
+   fputc('"', file);
+}
+
+bool retro_audio_trace_write_json(retro_audio_trace_t *trace, FILE *file)
+{
+   struct retro_audio_trace_stage_stats stages[RETRO_AUDIO_TRACE_MAX_STAGES];
+   struct retro_audio_trace_stats stats;
+   unsigned i, count = retro_audio_trace_get_stages(trace, stages,
+         RETRO_AUDIO_TRACE_MAX_STAGES);
+
+   retro_audio_trace_get_stats(trace, &stats);
+   fprintf(file, "{\n  \"latency\": {\"marks\": %llu, \"dropped\": %llu, "
+         "\"last_ms\": %.3f, \"min_ms\": %.3f, \"mean_ms\": %.3f, "
+         "\"max_ms\": %.3f, \"jitter_ms\": %.3f, \"estimate_ms\": %.3f},\n"
+         "  \"stages\": [",
+         (unsigned long long)stats.marks, (unsigned long long)stats.dropped,
+         stats.latency_ms, stats.min_ms, stats.mean_ms, stats.max_ms,
+         stats.jitter_ms, stats.estimate_ms);
+   for (i = 0; i < count; i++)
+   {
+      fprintf(file, "%s\n    {\"name\": ", i ? "," : "");
+      retro_audio_trace_json_string(file, stages[i].name);
+      fprintf(file, ", \"rate\": %.3f, \"frames_in\": %llu, "
+            "\"frames_out\": %llu, \"fill_frames\": %.1f, \"fill_ms\": %.3f, "
+            "\"min_ms\": %.3f, \"mean_ms\": %.3f, \"max_ms\": %.3f, "
+            "\"resident_ms\": %.3f}",
+            stages[i].rate, (unsigned long long)stages[i].frames_in,
+            (unsigned long long)stages[i].frames_out, stages[i].fill_frames,
+            stages[i].fill_ms, stages[i].min_ms, stages[i].mean_ms,
+            stages[i].max_ms, stages[i].resident_ms);
+   }
+   fputs("\n  ]\n}\n", file);
+   return !ferror(file);
+}
+
+#endif
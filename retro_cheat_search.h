@@ -0,0 +1,759 @@
+/* retro_cheat_search.h - memory search for cheats and achievements in
+ * libretro frontends.
+ *
+ * A cheat search narrows down where in a core's memory a value lives:
+ * start with every value a candidate, then after each frame keep only
+ * those that, say, went down when the player lost a life. Comparing a
+ * byte at a time, each frame, over the memory a core lists with
+ * RETRO_ENVIRONMENT_SET_MEMORY_MAPS is too slow for memory of a few MB.
+ * Here candidates are kept as a bitset, a bit per value, and values
+ * are compared 64 at a time with AVX2 or NEON against a value or
+ * against a snapshot from the last filter:
+ *
+ *    RETRO_CHEAT_SEARCH_EQ, _NE, _LT, _GT         against @value
+ *    RETRO_CHEAT_SEARCH_CHANGED, _UNCHANGED,
+ *    RETRO_CHEAT_SEARCH_INCREASED, _DECREASED      against the snapshot
+ *    RETRO_CHEAT_SEARCH_DELTA                      went up by @value
+ *
+ * Comparisons are unsigned, and DELTA wraps around, so a value that
+ * went down by 1 went up by 0xFF (for bytes). Blocks of 64 values with
+ * no candidates left are skipped, and only blocks with candidates are
+ * copied into the snapshot, so a search gets cheaper as it narrows:
+ *
+ *    search = retro_cheat_search_new(&map, 1);
+ *    ...after retro_run(), each frame or when asked:
+ *    left = retro_cheat_search_filter(search, RETRO_CHEAT_SEARCH_DECREASED, 0);
+ *    ...then
+ *    n = retro_cheat_search_get_results(search, 0, results, 64);
+ *
+ * Values are 1, 2 or 4 bytes, at offsets that are a multiple of their
+ * size, as cores lay them out, in the byte order of their descriptor
+ * (RETRO_MEMDESC_BIGENDIAN). Read-only (RETRO_MEMDESC_CONST) areas and
+ * mirrors of the same memory are left out.
+ *
+ * The AVX2 kernel is used when cpu_features() reports it (so
+ * CPU_FEATURES=none holds it back), and the NEON one wherever the
+ * compiler targets NEON. Define RETRO_CHEAT_SEARCH_NO_SIMD to use only
+ * plain C.
+ *
+ * One file must define RETRO_CHEAT_SEARCH_IMPLEMENTATION before
+ * including this. */
+
+#ifndef __RETRO_CHEAT_SEARCH_H__
+#define __RETRO_CHEAT_SEARCH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum retro_cheat_search_op
+{
+   RETRO_CHEAT_SEARCH_EQ = 0,       /* == value */
+   RETRO_CHEAT_SEARCH_NE,           /* != value */
+   RETRO_CHEAT_SEARCH_LT,           /* <  value */
+   RETRO_CHEAT_SEARCH_GT,           /* >  value */
+   RETRO_CHEAT_SEARCH_CHANGED,      /* != snapshot */
+   RETRO_CHEAT_SEARCH_UNCHANGED,    /* == snapshot */
+   RETRO_CHEAT_SEARCH_INCREASED,    /* >  snapshot */
+   RETRO_CHEAT_SEARCH_DECREASED,    /* <  snapshot */
+   RETRO_CHEAT_SEARCH_DELTA         /* == snapshot + value */
+};
+
+typedef struct retro_cheat_search retro_cheat_search_t;
+
+struct retro_cheat_search_result
+{
+   size_t address;        /* in the core's address space */
+   const uint8_t *ptr;    /* to the value in the core's memory */
+   uint32_t value;        /* now */
+   uint32_t previous;     /* in the snapshot */
+};
+
+struct retro_cheat_search_stats
+{
+   size_t bytes;          /* memory searched */
+   size_t candidates;
+   size_t compared;       /* bytes compared by the last filter */
+   const char *kernel;    /* "avx2", "neon" or "c" */
+};
+
+/**
+ * retro_cheat_search_new:
+ * @map                     : from SET_MEMORY_MAPS; only read here
+ * @size                    : bytes in a value: 1, 2 or 4
+ *
+ * Starts a search with every value a candidate, and takes a snapshot.
+ *
+ * Returns: pointer to the new search if successful, otherwise NULL.
+ */
+retro_cheat_search_t *retro_cheat_search_new(const struct retro_memory_map *map,
+      unsigned size);
+
+void retro_cheat_search_free(retro_cheat_search_t *search);
+
+/* Makes every value a candidate again, and takes a snapshot. */
+void retro_cheat_search_reset(retro_cheat_search_t *search);
+
+/**
+ * retro_cheat_search_filter:
+ * @search                  : pointer to search object
+ * @op                      : what candidates must pass to stay
+ * @value                   : to compare with, or the delta; cut down
+ *                            to the size of a value
+ *
+ * Keeps the candidates whose values pass @op, and takes a snapshot of
+ * them for the next filter. Call after retro_run(), not during it.
+ *
+ * Returns: the number of candidates left.
+ */
+size_t retro_cheat_search_filter(retro_cheat_search_t *search,
+      enum retro_cheat_search_op op, uint32_t value);
+
+/* Candidates left. */
+size_t retro_cheat_search_count(retro_cheat_search_t *search);
+
+/* Fills in up to @max results for candidates from the @first-th on, in
+ * order of region and address. Returns how many it filled in. */
+size_t retro_cheat_search_get_results(retro_cheat_search_t *search,
+      size_t first, struct retro_cheat_search_result *results, size_t max);
+
+void retro_cheat_search_get_stats(retro_cheat_search_t *search,
+      struct retro_cheat_search_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_CHEAT_SEARCH_IMPLEMENTATION
+#undef RETRO_CHEAT_SEARCH_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(RETRO_CHEAT_SEARCH_NO_SIMD) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define RETRO_CHEAT_SEARCH_AVX2 1
+#include <immintrin.h>
+#include "cpu_features.h"
+#elif !defined(RETRO_CHEAT_SEARCH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define RETRO_CHEAT_SEARCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* GCC and Clang only allow AVX2 intrinsics in functions built for it,
+ * where MSVC allows them anywhere. */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RETRO_CHEAT_SEARCH_TARGET(isa)
+#else
+#define RETRO_CHEAT_SEARCH_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/* Values are compared a block of 64 at a time, a word of candidates. */
+#define RETRO_CHEAT_SEARCH_BLOCK 64
+
+struct retro_cheat_search_test
+{
+   enum retro_cheat_search_op op;
+   uint32_t value;
+   unsigned size;
+   bool swap;             /* values are big endian */
+};
+
+/* Filters @blocks blocks from @cur, clearing bits in @candidates of
+ * values that fail, and copies blocks with candidates left to @prev.
+ * Returns the number of candidates left. */
+typedef size_t (*retro_cheat_search_kernel_t)(const uint8_t *cur, uint8_t *prev,
+      uint64_t *candidates, size_t blocks, const struct retro_cheat_search_test *test);
+
+struct retro_cheat_search_region
+{
+   const uint8_t *ptr;
+   size_t len;
+   size_t start;          /* address of the first byte */
+   size_t disconnect;     /* address bits not connected to memory */
+   bool bigendian;
+   size_t values;
+   size_t blocks;
+   uint64_t *candidates;  /* a bit per value */
+   uint8_t *prev;         /* snapshot, in whole blocks */
+};
+
+struct retro_cheat_search
+{
+   struct retro_cheat_search_region *regions;
+   unsigned num_regions;
+   unsigned size;
+   size_t bytes;
+   size_t count;
+   size_t compared;
+   retro_cheat_search_kernel_t kernel;
+   const char *kernel_name;
+};
+
+static unsigned retro_cheat_search_popcount(uint64_t v)
+{
+#if defined(__GNUC__)
+   return (unsigned)__builtin_popcountll(v);
+#else
+   unsigned n = 0;
+   for (; v; v &= v - 1)
+      n++;
+   return n;
+#endif
+}
+
+static uint32_t retro_cheat_search_load(const uint8_t *p, unsigned size, bool bigendian)
+{
+   switch (size)
+   {
+      case 1:
+         return p[0];
+      case 2:
+         return bigendian ? (uint32_t)p[0] << 8 | p[1] : (uint32_t)p[1] << 8 | p[0];
+      default:
+         return bigendian
+            ? (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]
+            : (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0];
+   }
+}
+
+static bool retro_cheat_search_test_value(uint32_t cur, uint32_t prev,
+      const struct retro_cheat_search_test *test)
+{
+   uint32_t mask = test->size == 4 ? 0xFFFFFFFFu : (1u << (test->size * 8)) - 1;
+
+   switch (test->op)
+   {
+      case RETRO_CHEAT_SEARCH_EQ:        return cur == test->value;
+      case RETRO_CHEAT_SEARCH_NE:        return cur != test->value;
+      case RETRO_CHEAT_SEARCH_LT:        return cur <  test->value;
+      case RETRO_CHEAT_SEARCH_GT:        return cur >  test->value;
+      case RETRO_CHEAT_SEARCH_CHANGED:   return cur != prev;
+      case RETRO_CHEAT_SEARCH_UNCHANGED: return cur == prev;
+      case RETRO_CHEAT_SEARCH_INCREASED: return cur >  prev;
+      case RETRO_CHEAT_SEARCH_DECREASED: return cur <  prev;
+      case RETRO_CHEAT_SEARCH_DELTA:     return ((cur - prev) & mask) == test->value;
+   }
+   return false;
+}
+
+static size_t retro_cheat_search_kernel_c(const uint8_t *cur, uint8_t *prev,
+      uint64_t *candidates, size_t blocks, const struct retro_cheat_search_test *test)
+{
+   size_t block_bytes = RETRO_CHEAT_SEARCH_BLOCK * test->size;
+   size_t count = 0, b;
+
+   for (b = 0; b < blocks; b++, cur += block_bytes, prev += block_bytes)
+   {
+      uint64_t left = candidates[b];
+      unsigned i;
+
+      if (!left)
+         continue;
+      for (i = 0; i < RETRO_CHEAT_SEARCH_BLOCK; i++)
+      {
+         if (!(left >> i & 1))
+            continue;
+         if (!retro_cheat_search_test_value(
+                  retro_cheat_search_load(cur + i * test->size, test->size, test->swap),
+                  retro_cheat_search_load(prev + i * test->size, test->size, test->swap),
+                  test))
+            left &= ~((uint64_t)1 << i);
+      }
+      candidates[b] = left;
+      if (left)
+      {
+         memcpy(prev, cur, block_bytes);
+         count += retro_cheat_search_popcount(left);
+      }
+   }
+   return count;
+}
+
+#ifdef RETRO_CHEAT_SEARCH_AVX2
+/* Lanes of all ones where @cur passes; values are already in host order
+ * and @bias flips their sign bits, for unsigned compares. */
+#define RETRO_CHEAT_SEARCH_AVX2_TEST(name, eq, gt, sub)\
+RETRO_CHEAT_SEARCH_TARGET("avx2")\
+static __m256i name(__m256i cur, __m256i prev, __m256i value, __m256i bias,\
+      enum retro_cheat_search_op op)\
+{\
+   __m256i ones = _mm256_set1_epi32(-1);\
+   switch (op)\
+   {\
+      case RETRO_CHEAT_SEARCH_EQ:        return eq(cur, value);\
+      case RETRO_CHEAT_SEARCH_NE:        return _mm256_xor_si256(eq(cur, value), ones);\
+      case RETRO_CHEAT_SEARCH_LT:        return gt(_mm256_xor_si256(value, bias), _mm256_xor_si256(cur, bias));\
+      case RETRO_CHEAT_SEARCH_GT:        return gt(_mm256_xor_si256(cur, bias), _mm256_xor_si256(value, bias));\
+      case RETRO_CHEAT_SEARCH_CHANGED:   return _mm256_xor_si256(eq(cur, prev), ones);\
+      case RETRO_CHEAT_SEARCH_UNCHANGED: return eq(cur, prev);\
+      case RETRO_CHEAT_SEARCH_INCREASED: return gt(_mm256_xor_si256(cur, bias), _mm256_xor_si256(prev, bias));\
+      case RETRO_CHEAT_SEARCH_DECREASED: return gt(_mm256_xor_si256(prev, bias), _mm256_xor_si256(cur, bias));\
+      case RETRO_CHEAT_SEARCH_DELTA:     return eq(sub(cur, prev), value);\
+   }\
+   return _mm256_setzero_si256();\
+}
+
+RETRO_CHEAT_SEARCH_AVX2_TEST(retro_cheat_search_test8_avx2,
+      _mm256_cmpeq_epi8, _mm256_cmpgt_epi8, _mm256_sub_epi8)
+RETRO_CHEAT_SEARCH_AVX2_TEST(retro_cheat_search_test16_avx2,
+      _mm256_cmpeq_epi16, _mm256_cmpgt_epi16, _mm256_sub_epi16)
+RETRO_CHEAT_SEARCH_AVX2_TEST(retro_cheat_search_test32_avx2,
+      _mm256_cmpeq_epi32, _mm256_cmpgt_epi32, _mm256_sub_epi32)
+
+RETRO_CHEAT_SEARCH_TARGET("avx2")
+static size_t retro_cheat_search_kernel_avx2(const uint8_t *cur, uint8_t *prev,
+      uint64_t *candidates, size_t blocks, const struct retro_cheat_search_test *test)
+{
+   size_t block_bytes = RETRO_CHEAT_SEARCH_BLOCK * test->size;
+   size_t count = 0, b;
+   enum retro_cheat_search_op op = test->op;
+   __m256i value, bias, swap;
+
+   switch (test->size)
+   {
+      case 1:
+         value = _mm256_set1_epi8((char)test->value);
+         bias  = _mm256_set1_epi8((char)0x80);
+         swap  = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+         break;
+      case 2:
+         value = _mm256_set1_epi16((short)test->value);
+         bias  = _mm256_set1_epi16((short)0x8000);
+         swap  = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                  1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+         break;
+      default:
+         value = _mm256_set1_epi32((int)test->value);
+         bias  = _mm256_set1_epi32((int)0x80000000u);
+         swap  = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+         break;
+   }
+
+#define RETRO_CHEAT_SEARCH_AVX2_LOAD(c, p, offset)\
+   c = _mm256_loadu_si256((const __m256i*)(cur + (offset)));\
+   p = _mm256_loadu_si256((const __m256i*)(prev + (offset)));\
+   if (test->swap)\
+   {\
+      c = _mm256_shuffle_epi8(c, swap);\
+      p = _mm256_shuffle_epi8(p, swap);\
+   }
+
+   for (b = 0; b < blocks; b++, cur += block_bytes, prev += block_bytes)
+   {
+      uint64_t pass = 0;
+      unsigned i;
+      __m256i c, p, t0, t1;
+
+      if (!candidates[b])
+         continue;
+
+      switch (test->size)
+      {
+         case 1:
+            for (i = 0; i < 2; i++)
+            {
+               RETRO_CHEAT_SEARCH_AVX2_LOAD(c, p, i * 32)
+               t0    = retro_cheat_search_test8_avx2(c, p, value, bias, op);
+               pass |= (uint64_t)(uint32_t)_mm256_movemask_epi8(t0) << (i * 32);
+            }
+            break;
+         case 2:
+            for (i = 0; i < 2; i++)
+            {
+               RETRO_CHEAT_SEARCH_AVX2_LOAD(c, p, i * 64)
+               t0 = retro_cheat_search_test16_avx2(c, p, value, bias, op);
+               RETRO_CHEAT_SEARCH_AVX2_LOAD(c, p, i * 64 + 32)
+               t1 = retro_cheat_search_test16_avx2(c, p, value, bias, op);
+               /* a byte per value; packing works within 128-bit lanes */
+               t0    = _mm256_permute4x64_epi64(_mm256_packs_epi16(t0, t1), 0xD8);
+               pass |= (uint64_t)(uint32_t)_mm256_movemask_epi8(t0) << (i * 32);
+            }
+            break;
+         default:
+            for (i = 0; i < 8; i++)
+            {
+               RETRO_CHEAT_SEARCH_AVX2_LOAD(c, p, i * 32)
+               t0    = retro_cheat_search_test32_avx2(c, p, value, bias, op);
+               pass |= (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(t0)) << (i * 8);
+            }
+            break;
+      }
+#undef RETRO_CHEAT_SEARCH_AVX2_LOAD
+
+      candidates[b] &= pass;
+      if (candidates[b])
+      {
+         memcpy(prev, cur, block_bytes);
+         count += retro_cheat_search_popcount(candidates[b]);
+      }
+   }
+   return count;
+}
+#endif
+
+#ifdef RETRO_CHEAT_SEARCH_NEON
+#define RETRO_CHEAT_SEARCH_NEON_TEST(name, type, eq, gt, sub, not_)\
+static type name(type cur, type prev, type value, enum retro_cheat_search_op op)\
+{\
+   switch (op)\
+   {\
+      case RETRO_CHEAT_SEARCH_EQ:        return eq(cur, value);\
+      case RETRO_CHEAT_SEARCH_NE:        return not_(eq(cur, value));\
+      case RETRO_CHEAT_SEARCH_LT:        return gt(value, cur);\
+      case RETRO_CHEAT_SEARCH_GT:        return gt(cur, value);\
+      case RETRO_CHEAT_SEARCH_CHANGED:   return not_(eq(cur, prev));\
+      case RETRO_CHEAT_SEARCH_UNCHANGED: return eq(cur, prev);\
+      case RETRO_CHEAT_SEARCH_INCREASED: return gt(cur, prev);\
+      case RETRO_CHEAT_SEARCH_DECREASED: return gt(prev, cur);\
+      case RETRO_CHEAT_SEARCH_DELTA:     return eq(sub(cur, prev), value);\
+   }\
+   return eq(cur, cur);\
+}
+
+RETRO_CHEAT_SEARCH_NEON_TEST(retro_cheat_search_test8_neon, uint8x16_t,
+      vceqq_u8, vcgtq_u8, vsubq_u8, vmvnq_u8)
+RETRO_CHEAT_SEARCH_NEON_TEST(retro_cheat_search_test16_neon, uint16x8_t,
+      vceqq_u16, vcgtq_u16, vsubq_u16, vmvnq_u16)
+RETRO_CHEAT_SEARCH_NEON_TEST(retro_cheat_search_test32_neon, uint32x4_t,
+      vceqq_u32, vcgtq_u32, vsubq_u32, vmvnq_u32)
+
+/* A bit per lane of all ones or all zeros. */
+static unsigned retro_cheat_search_mask_neon(uint8x16_t t)
+{
+   static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128,
+                                        1, 2, 4, 8, 16, 32, 64, 128 };
+   uint8x8_t sum;
+
+   t   = vandq_u8(t, vld1q_u8(weights));
+   sum = vpadd_u8(vget_low_u8(t), vget_high_u8(t));
+   sum = vpadd_u8(sum, sum);
+   sum = vpadd_u8(sum, sum);
+   return vget_lane_u8(sum, 0) | (unsigned)vget_lane_u8(sum, 1) << 8;
+}
+
+static uint8x16_t retro_cheat_search_load_neon(const uint8_t *p, unsigned size, bool swap)
+{
+   uint8x16_t v = vld1q_u8(p);
+   if (swap)
+      v = size == 2 ? vrev16q_u8(v) : vrev32q_u8(v);
+   return v;
+}
+
+static size_t retro_cheat_search_kernel_neon(const uint8_t *cur, uint8_t *prev,
+      uint64_t *candidates, size_t blocks, const struct retro_cheat_search_test *test)
+{
+   size_t block_bytes = RETRO_CHEAT_SEARCH_BLOCK * test->size;
+   size_t count = 0, b;
+   enum retro_cheat_search_op op = test->op;
+   unsigned size = test->size;
+   bool swap = test->swap && size > 1;
+   uint8x16_t value8   = vdupq_n_u8((uint8_t)test->value);
+   uint16x8_t value16  = vdupq_n_u16((uint16_t)test->value);
+   uint32x4_t value32  = vdupq_n_u32(test->value);
+
+   for (b = 0; b < blocks; b++, cur += block_bytes, prev += block_bytes)
+   {
+      uint64_t pass = 0;
+      unsigned i, j;
+
+      if (!candidates[b])
+         continue;
+
+      /* 16 values at a time, narrowed to a byte each */
+      for (i = 0; i < RETRO_CHEAT_SEARCH_BLOCK / 16; i++)
+      {
+         const uint8_t *c = cur + i * 16 * size;
+         const uint8_t *p = prev + i * 16 * size;
+         uint8x16_t t;
+
+         switch (size)
+         {
+            case 1:
+               t = retro_cheat_search_test8_neon(vld1q_u8(c), vld1q_u8(p), value8, op);
+               break;
+            case 2:
+            {
+               uint16x8_t t16[2];
+               for (j = 0; j < 2; j++)
+                  t16[j] = retro_cheat_search_test16_neon(
+                        vreinterpretq_u16_u8(retro_cheat_search_load_neon(c + j * 16, 2, swap)),
+                        vreinterpretq_u16_u8(retro_cheat_search_load_neon(p + j * 16, 2, swap)),
+                        value16, op);
+               t = vcombine_u8(vmovn_u16(t16[0]), vmovn_u16(t16[1]));
+               break;
+            }
+            default:
+            {
+               uint16x4_t t32[4];
+               for (j = 0; j < 4; j++)
+                  t32[j] = vmovn_u32(retro_cheat_search_test32_neon(
+                        vreinterpretq_u32_u8(retro_cheat_search_load_neon(c + j * 16, 4, swap)),
+                        vreinterpretq_u32_u8(retro_cheat_search_load_neon(p + j * 16, 4, swap)),
+                        value32, op));
+               t = vcombine_u8(vmovn_u16(vcombine_u16(t32[0], t32[1])),
+                     vmovn_u16(vcombine_u16(t32[2], t32[3])));
+               break;
+            }
+         }
+         pass |= (uint64_t)retro_cheat_search_mask_neon(t) << (i * 16);
+      }
+
+      candidates[b] &= pass;
+      if (candidates[b])
+      {
+         memcpy(prev, cur, block_bytes);
+         count += retro_cheat_search_popcount(candidates[b]);
+      }
+   }
+   return count;
+}
+#endif
+
+/* Address of the byte at @offset in @region: the offset's bits fill
+ * the address bits that are connected, from the bottom up. */
+static size_t retro_cheat_search_address(const struct retro_cheat_search_region *region,
+      size_t offset)
+{
+   size_t address = 0, bit;
+
+   for (bit = 1; offset && bit; bit <<= 1)
+   {
+      if (region->disconnect & bit)
+         continue;
+      if (offset & 1)
+         address |= bit;
+      offset >>= 1;
+   }
+   return region->start + address;
+}
+
+static size_t retro_cheat_search_filter_region(retro_cheat_search_t *search,
+      struct retro_cheat_search_region *region, const struct retro_cheat_search_test *test)
+{
+   size_t block_bytes = RETRO_CHEAT_SEARCH_BLOCK * search->size;
+   size_t whole       = region->len / block_bytes;
+   size_t count;
+   uint8_t tail[RETRO_CHEAT_SEARCH_BLOCK * 4];
+
+   count = search->kernel(region->ptr, region->prev, region->candidates, whole, test);
+   if (whole < region->blocks)
+   {
+      /* the last block, padded out to a whole one; its bits past the
+       * end are never set */
+      memset(tail, 0, sizeof(tail));
+      memcpy(tail, region->ptr + whole * block_bytes, region->len - whole * block_bytes);
+      count += search->kernel(tail, region->prev + whole * block_bytes,
+            region->candidates + whole, 1, test);
+   }
+   return count;
+}
+
+retro_cheat_search_t *retro_cheat_search_new(const struct retro_memory_map *map,
+      unsigned size)
+{
+   unsigned i, j;
+   retro_cheat_search_t *search;
+
+   if (size != 1 && size != 2 && size != 4)
+      return NULL;
+   search = (retro_cheat_search_t*)calloc(1, sizeof(*search));
+   if (!search)
+      return NULL;
+   search->size = size;
+   search->regions = (struct retro_cheat_search_region*)calloc(
+         map->num_descriptors ? map->num_descriptors : 1, sizeof(*search->regions));
+   if (!search->regions)
+      goto error;
+
+   search->kernel      = retro_cheat_search_kernel_c;
+   search->kernel_name = "c";
+#if defined(RETRO_CHEAT_SEARCH_AVX2)
+   if (cpu_features() & CPU_FEATURE_AVX2)
+   {
+      search->kernel      = retro_cheat_search_kernel_avx2;
+      search->kernel_name = "avx2";
+   }
+#elif defined(RETRO_CHEAT_SEARCH_NEON)
+   search->kernel      = retro_cheat_search_kernel_neon;
+   search->kernel_name = "neon";
+#endif
+
+   for (i = 0; i < map->num_descriptors; i++)
+   {
+      const struct retro_memory_descriptor *desc = &map->descriptors[i];
+      struct retro_cheat_search_region *region;
+      const uint8_t *ptr;
+      size_t values;
+
+      if (!desc->ptr || desc->len < size || (desc->flags & RETRO_MEMDESC_CONST))
+         continue;
+      ptr    = (const uint8_t*)desc->ptr + desc->offset;
+      values = desc->len / size;
+      /* mirrors list the same memory again */
+      for (j = 0; j < search->num_regions; j++)
+         if (search->regions[j].ptr == ptr && search->regions[j].len == values * size)
+            break;
+      if (j < search->num_regions)
+         continue;
+
+      region             = &search->regions[search->num_regions++];
+      region->ptr        = ptr;
+      region->len        = values * size;
+      region->start      = desc->start;
+      region->disconnect = desc->disconnect;
+      region->bigendian  = (desc->flags & RETRO_MEMDESC_BIGENDIAN) != 0;
+      region->values     = values;
+      region->blocks     = (values + RETRO_CHEAT_SEARCH_BLOCK - 1) / RETRO_CHEAT_SEARCH_BLOCK;
+      region->candidates = (uint64_t*)malloc(region->blocks * sizeof(uint64_t));
+      region->prev       = (uint8_t*)calloc(region->blocks, RETRO_CHEAT_SEARCH_BLOCK * size);
+      if (!region->candidates || !region->prev)
+         goto error;
+      search->bytes     += region->len;
+   }
+
+   retro_cheat_search_reset(search);
+   return search;
+
+error:
+   retro_cheat_search_free(search);
+   return NULL;
+}
+
+void retro_cheat_search_free(retro_cheat_search_t *search)
+{
+   unsigned i;
+
+   if (!search)
+      return;
+   if (search->regions)
+   {
+      for (i = 0; i < search->num_regions; i++)
+      {
+         free(search->regions[i].candidates);
+         free(search->regions[i].prev);
+      }
+   }
+   free(search->regions);
+   free(search);
+}
+
+void retro_cheat_search_reset(retro_cheat_search_t *search)
+{
+   unsigned i;
+
+   search->count = 0;
+   for (i = 0; i < search->num_regions; i++)
+   {
+      struct retro_cheat_search_region *region = &search->regions[i];
+      size_t last = region->values % RETRO_CHEAT_SEARCH_BLOCK;
+
+      memset(region->candidates, 0xFF, region->blocks * sizeof(uint64_t));
+      if (last)
+         region->candidates[region->blocks - 1] = ((uint64_t)1 << last) - 1;
+      memcpy(region->prev, region->ptr, region->len);
+      search->count += region->values;
+   }
+   search->compared = search->bytes;
+}
+
+size_t retro_cheat_search_filter(retro_cheat_search_t *search,
+      enum retro_cheat_search_op op, uint32_t value)
+{
+   struct retro_cheat_search_test test;
+   size_t block_bytes = RETRO_CHEAT_SEARCH_BLOCK * search->size;
+   unsigned i;
+
+   test.op    = op;
+   test.size  = search->size;
+   test.value = search->size == 4 ? value : value & ((1u << (search->size * 8)) - 1);
+
+   search->count    = 0;
+   search->compared = 0;
+   for (i = 0; i < search->num_regions; i++)
+   {
+      struct retro_cheat_search_region *region = &search->regions[i];
+      size_t b;
+
+      for (b = 0; b < region->blocks; b++)
+         if (region->candidates[b])
+            search->compared += block_bytes;
+      test.swap      = region->bigendian && search->size > 1;
+      search->count += retro_cheat_search_filter_region(search, region, &test);
+   }
+   return search->count;
+}
+
+size_t retro_cheat_search_count(retro_cheat_search_t *search)
+{
+   return search->count;
+}
+
+size_t retro_cheat_search_get_results(retro_cheat_search_t *search,
+      size_t first, struct retro_cheat_search_result *results, size_t max)
+{
+   size_t n = 0;
+   unsigned i;
+
+   for (i = 0; i < search->num_regions && n < max; i++)
+   {
+      const struct retro_cheat_search_region *region = &search->regions[i];
+      size_t b;
+
+      for (b = 0; b < region->blocks && n < max; b++)
+      {
+         uint64_t bits = region->candidates[b];
+         unsigned count = retro_cheat_search_popcount(bits);
+         unsigned bit;
+
+         /* skip whole words before the first one asked for */
+         if (first >= count)
+         {
+            first -= count;
+            continue;
+         }
+         for (bit = 0; bit < RETRO_CHEAT_SEARCH_BLOCK && n < max; bit++)
+         {
+            struct retro_cheat_search_result *result;
+            size_t offset;
+
+            if (!(bits >> bit & 1))
+               continue;
+            if (first)
+            {
+               first--;
+               continue;
+            }
+            offset           = (b * RETRO_CHEAT_SEARCH_BLOCK + bit) * search->size;
+            result           = &results[n++];
+            result->address  = retro_cheat_search_address(region, offset);
+            result->ptr      = region->ptr + offset;
+            result->value    = retro_cheat_search_load(region->ptr + offset,
+                  search->size, region->bigendian);
+            result->previous = retro_cheat_search_load(region->prev + offset,
+                  search->size, region->bigendian);
+         }
+      }
+   }
+   return n;
+}
+
+void retro_cheat_search_get_stats(retro_cheat_search_t *search,
+      struct retro_cheat_search_stats *stats)
+{
+   stats->bytes      = search->bytes;
+   stats->candidates = search->count;
+   stats->compared   = search->compared;
+   stats->kernel     = search->kernel_name;
+}
+
+#endif
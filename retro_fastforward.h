@@ -0,0 +1,421 @@
+/* retro_fastforward.h - fast-forward for libretro frontends, limited by
+ * how fast the core runs rather than by the frontend.
+ *
+ * While fast-forwarding:
+ *
+ *  - Audio is off. RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE says so, and
+ *    retro_fastforward_audio_enabled() tells the frontend's audio
+ *    callbacks to drop what the core sends anyway, so that nothing is
+ *    resampled or queued.
+ *  - Video is on only for the frames that will be shown, about
+ *    @present_hz of them a second however fast the core runs, and
+ *    GET_AUDIO_VIDEO_ENABLE has it off for the others so the core can
+ *    skip rendering them.
+ *  - With @threaded, the core runs flat out on a thread of its own, and
+ *    retro_fastforward_run() on the frontend's thread only waits for
+ *    the next frame to show, which the core's video callback hands
+ *    over with retro_fastforward_capture(). Without it, run() runs the
+ *    core's frames itself until one is to be shown.
+ *  - A speed cap of @ratio times the core's frame rate is kept to, if
+ *    set, by sleeping between frames.
+ *
+ * The frontend calls retro_fastforward_run() in place of retro_run(),
+ * also when not fast-forwarding, and answers GET_FASTFORWARDING,
+ * GET_AUDIO_VIDEO_ENABLE and SET_FASTFORWARDING_OVERRIDE from here.
+ * With @threaded, the core's callbacks (environment, input, video and
+ * audio) come from the core thread while fast-forwarding, so input
+ * state must be safe to read from there, and only software rendered
+ * frames can be handed over; leave @threaded off for hardware
+ * rendered cores.
+ *
+ * One file must define RETRO_FASTFORWARD_IMPLEMENTATION before
+ * including this, with rthreads.h built somewhere. */
+
+#ifndef __RETRO_FASTFORWARD_H__
+#define __RETRO_FASTFORWARD_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct retro_fastforward retro_fastforward_t;
+
+struct retro_fastforward_config
+{
+   void (*run)(void);    /* the core's retro_run() */
+   double fps;           /* from retro_system_timing */
+   double present_hz;    /* frames to show a second while fast-forwarding, 0 for 60 */
+   float ratio;          /* speed cap in times @fps, 0 for none */
+   bool threaded;        /* run the core on its own thread while fast-forwarding */
+};
+
+/**
+ * retro_fastforward_new:
+ * @config                  : the core and how to fast-forward it
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+retro_fastforward_t *retro_fastforward_new(const struct retro_fastforward_config *config);
+
+/* Stops fast-forwarding first. */
+void retro_fastforward_free(retro_fastforward_t *ff);
+
+/**
+ * retro_fastforward_run:
+ * @ff                      : pointer to fast-forward object
+ *
+ * Run the core for one frame of the frontend: one frame when not
+ * fast-forwarding, as many as fit before the next frame is shown when
+ * fast-forwarding.
+ *
+ * Returns: true (1) if a frame handed over by the core thread is
+ * waiting in retro_fastforward_get_frame(), false (0) if the video
+ * callback presented as usual, or there's nothing new.
+ */
+bool retro_fastforward_run(retro_fastforward_t *ff);
+
+/**
+ * retro_fastforward_set:
+ * @ff                      : pointer to fast-forward object
+ * @on                      : whether to fast-forward
+ *
+ * For the frontend's hotkey; waits for the core thread to stop when
+ * turning it off.
+ *
+ * Returns: false (0) if the core holds the state with an override.
+ */
+bool retro_fastforward_set(retro_fastforward_t *ff, bool on);
+
+/* For RETRO_ENVIRONMENT_GET_FASTFORWARDING */
+bool retro_fastforward_active(retro_fastforward_t *ff);
+
+/* For RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE */
+int retro_fastforward_av_enable(retro_fastforward_t *ff);
+
+/* For RETRO_ENVIRONMENT_SET_FASTFORWARDING_OVERRIDE. Returns true, and
+ * with NULL just says it's supported. */
+bool retro_fastforward_override(retro_fastforward_t *ff,
+      const struct retro_fastforwarding_override *override);
+
+/* For the frontend's audio callbacks: false while fast-forwarding, when
+ * anything the core sends is to be dropped. */
+bool retro_fastforward_audio_enabled(retro_fastforward_t *ff);
+
+/**
+ * retro_fastforward_capture:
+ * @ff                      : pointer to fast-forward object
+ * @data                    : from retro_video_refresh_t
+ * @width                   : from retro_video_refresh_t
+ * @height                  : from retro_video_refresh_t
+ * @pitch                   : from retro_video_refresh_t
+ *
+ * For the frontend's video callback, first thing.
+ *
+ * Returns: true (1) if the frame was taken for the frontend thread, and
+ * the callback should return; false (0) if it should present the frame
+ * as usual.
+ */
+bool retro_fastforward_capture(retro_fastforward_t *ff, const void *data,
+      unsigned width, unsigned height, size_t pitch);
+
+/* The last frame handed over, after retro_fastforward_run() returned
+ * true; good until the next call to run(). */
+bool retro_fastforward_get_frame(retro_fastforward_t *ff, const void **data,
+      unsigned *width, unsigned *height, size_t *pitch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_FASTFORWARD_IMPLEMENTATION
+#undef RETRO_FASTFORWARD_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rthreads.h"
+
+struct retro_fastforward_frame
+{
+   void *data;
+   size_t capacity;
+   unsigned width, height;
+   size_t pitch;
+};
+
+struct retro_fastforward
+{
+   void (*run)(void);
+   double fps;
+   int64_t present_us;      /* between frames shown */
+   float ratio;
+   bool threaded;
+
+   bool active;
+   bool inhibit;            /* the core overrode the state */
+   int request;             /* from an override, for the next run(): -1 off, 1 on */
+   int av;                  /* for the frame being run */
+   int64_t next_present;    /* when the next frame is to be shown */
+   int64_t deadline;        /* earliest start of the next frame, with a cap */
+
+   /* core thread */
+   sthread_t *thread;
+   slock_t *lock;
+   scond_t *cond;
+   volatile uint32_t stop;
+   bool fresh;              /* ready holds a frame not yet taken */
+   /* the core thread writes to back, then swaps it with ready; run()
+    * swaps ready with front for the frontend to read */
+   struct retro_fastforward_frame frames[3];
+   unsigned back, ready, front;
+};
+
+#define RETRO_FASTFORWARD_AV_VIDEO 1
+#define RETRO_FASTFORWARD_AV_AUDIO 2
+
+/* Runs one frame while fast-forwarding, returning whether it had video. */
+static bool retro_fastforward_frame(retro_fastforward_t *ff)
+{
+   int64_t now = sthread_clock_us();
+   bool video  = now >= ff->next_present;
+
+   if (video)
+   {
+      ff->next_present += ff->present_us;
+      if (ff->next_present < now)
+         ff->next_present = now + ff->present_us;
+   }
+   ff->av = video ? RETRO_FASTFORWARD_AV_VIDEO : 0;
+   ff->run();
+
+   if (ff->ratio >= 1.0f && ff->fps > 0.0)
+   {
+      ff->deadline += (int64_t)(1000000.0 / (ff->fps * ff->ratio));
+      now = sthread_clock_us();
+      /* more than a few frames behind; stop trying to catch up */
+      if (ff->deadline < now - 100000)
+         ff->deadline = now;
+      else if (ff->deadline > now)
+         sthread_sleep_until(ff->deadline);
+   }
+   return video;
+}
+
+static void retro_fastforward_thread(void *data)
+{
+   retro_fastforward_t *ff = (retro_fastforward_t*)data;
+   while (!satomic_load(&ff->stop))
+      retro_fastforward_frame(ff);
+}
+
+static void retro_fastforward_start(retro_fastforward_t *ff)
+{
+   int64_t now      = sthread_clock_us();
+   ff->active       = true;
+   ff->next_present = now;
+   ff->deadline     = now;
+   ff->fresh        = false;
+   if (ff->threaded)
+   {
+      satomic_store(&ff->stop, 0);
+      ff->thread = sthread_create(retro_fastforward_thread, ff);
+   }
+}
+
+static void retro_fastforward_stop(retro_fastforward_t *ff)
+{
+   if (ff->thread)
+   {
+      satomic_store(&ff->stop, 1);
+      sthread_join(ff->thread);
+      ff->thread = NULL;
+   }
+   ff->active = false;
+   ff->av     = RETRO_FASTFORWARD_AV_VIDEO | RETRO_FASTFORWARD_AV_AUDIO;
+}
+
+retro_fastforward_t *retro_fastforward_new(const struct retro_fastforward_config *config)
+{
+   retro_fastforward_t *ff = (retro_fastforward_t*)calloc(1, sizeof(*ff));
+
+   if (!ff)
+      return NULL;
+   ff->run        = config->run;
+   ff->fps        = config->fps;
+   ff->present_us = (int64_t)(1000000.0 / (config->present_hz > 0.0 ? config->present_hz : 60.0));
+   ff->ratio      = config->ratio;
+   ff->threaded   = config->threaded;
+   ff->av         = RETRO_FASTFORWARD_AV_VIDEO | RETRO_FASTFORWARD_AV_AUDIO;
+   ff->back       = 0;
+   ff->ready      = 1;
+   ff->front      = 2;
+   if (ff->threaded)
+   {
+      ff->lock = slock_new();
+      ff->cond = scond_new();
+      if (!ff->lock || !ff->cond)
+      {
+         retro_fastforward_free(ff);
+         return NULL;
+      }
+   }
+   return ff;
+}
+
+void retro_fastforward_free(retro_fastforward_t *ff)
+{
+   unsigned i;
+
+   if (!ff)
+      return;
+   retro_fastforward_stop(ff);
+   for (i = 0; i < 3; i++)
+      free(ff->frames[i].data);
+   if (ff->cond)
+      scond_free(ff->cond);
+   if (ff->lock)
+      slock_free(ff->lock);
+   free(ff);
+}
+
+bool retro_fastforward_run(retro_fastforward_t *ff)
+{
+   bool fresh;
+
+   if (ff->request > 0 && !ff->active)
+      retro_fastforward_start(ff);
+   else if (ff->request < 0 && ff->active)
+      retro_fastforward_stop(ff);
+   ff->request = 0;
+
+   if (!ff->active)
+   {
+      ff->run();
+      return false;
+   }
+
+   if (!ff->thread)
+   {
+      /* frames without video until one is due, which is presented by
+       * the video callback as usual */
+      while (!retro_fastforward_frame(ff));
+      return false;
+   }
+
+   slock_lock(ff->lock);
+   if (!ff->fresh)
+      scond_wait_timeout(ff->cond, ff->lock, ff->present_us);
+   fresh = ff->fresh;
+   if (fresh)
+   {
+      unsigned swap = ff->front;
+      ff->front     = ff->ready;
+      ff->ready     = swap;
+      ff->fresh     = false;
+   }
+   slock_unlock(ff->lock);
+   return fresh;
+}
+
+bool retro_fastforward_set(retro_fastforward_t *ff, bool on)
+{
+   if (ff->inhibit)
+      return false;
+   if (on && !ff->active)
+      retro_fastforward_start(ff);
+   else if (!on && ff->active)
+      retro_fastforward_stop(ff);
+   return true;
+}
+
+bool retro_fastforward_active(retro_fastforward_t *ff)
+{
+   return ff->active;
+}
+
+int retro_fastforward_av_enable(retro_fastforward_t *ff)
+{
+   return ff->av;
+}
+
+bool retro_fastforward_override(retro_fastforward_t *ff,
+      const struct retro_fastforwarding_override *override)
+{
+   if (!override)
+      return true;
+   if (override->ratio >= 0.0f)
+      ff->ratio = override->ratio < 1.0f ? 0.0f : override->ratio;
+   /* called from within retro_run(), maybe on the core thread, so the
+    * state changes on the frontend thread's next run() */
+   ff->request = override->fastforward ? 1 : -1;
+   if (!override->fastforward && ff->thread)
+      satomic_store(&ff->stop, 1);
+   ff->inhibit = override->inhibit_toggle;
+   return true;
+}
+
+bool retro_fastforward_audio_enabled(retro_fastforward_t *ff)
+{
+   return !ff->active;
+}
+
+bool retro_fastforward_capture(retro_fastforward_t *ff, const void *data,
+      unsigned width, unsigned height, size_t pitch)
+{
+   struct retro_fastforward_frame *frame;
+   size_t size;
+
+   if (!ff->thread || !sthread_isself(ff->thread))
+      return false;
+   /* a dupe or a hardware frame; keep showing the last one */
+   if (!data || data == RETRO_HW_FRAME_BUFFER_VALID)
+      return true;
+
+   frame = &ff->frames[ff->back];
+   size  = pitch * height;
+   if (size > frame->capacity)
+   {
+      void *buf = realloc(frame->data, size);
+      if (!buf)
+         return true;
+      frame->data     = buf;
+      frame->capacity = size;
+   }
+   memcpy(frame->data, data, size);
+   frame->width  = width;
+   frame->height = height;
+   frame->pitch  = pitch;
+
+   slock_lock(ff->lock);
+   {
+      unsigned swap = ff->ready;
+      ff->ready     = ff->back;
+      ff->back      = swap;
+      ff->fresh     = true;
+   }
+   scond_signal(ff->cond);
+   slock_unlock(ff->lock);
+   return true;
+}
+
+bool retro_fastforward_get_frame(retro_fastforward_t *ff, const void **data,
+      unsigned *width, unsigned *height, size_t *pitch)
+{
+   const struct retro_fastforward_frame *frame = &ff->frames[ff->front];
+   if (!frame->data)
+      return false;
+   *data   = frame->data;
+   *width  = frame->width;
+   *height = frame->height;
+   *pitch  = frame->pitch;
+   return true;
+}
+
+#endif
@@ -0,0 +1,499 @@
+/* retro_perf.h - host side of the libretro perf interface, with
+ * per-frame latency histograms.
+ *
+ * retro_perf_get_callback() fills in the retro_perf_callback a frontend
+ * returns for RETRO_ENVIRONMENT_GET_PERF_INTERFACE. The core's counters
+ * measure in ticks of the cycle counter (rdtsc on x86, cntvct_el0 on
+ * AArch64, QueryPerformanceCounter or the monotonic clock elsewhere),
+ * which this converts to time by calibrating against the monotonic
+ * clock; the calibration is refined as it runs.
+ *
+ * Call retro_perf_frame_end() after each retro_run(). The time each
+ * registered counter accumulated during the frame then goes into its
+ * histogram, along with the frame time itself as the "frame" counter,
+ * so that the p50/p95/p99 of what a core does per frame can be read at
+ * any point, not only as totals at exit:
+ *
+ *    retro_perf_format_overlay(text, sizeof(text));  for drawing live
+ *    retro_perf_write_json(file);                      for tools
+ *
+ * Histogram buckets are quarter powers of two, so percentiles are good
+ * to within about 10%.
+ *
+ * State is global, as the libretro interface has no userdata. Cores may
+ * register counters from any thread; the rest is for the thread that
+ * runs the core. One file must define RETRO_PERF_IMPLEMENTATION before
+ * including this, with rthreads.h built somewhere. */
+
+#ifndef __RETRO_PERF_H__
+#define __RETRO_PERF_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETRO_PERF_MAX_COUNTERS 256
+
+struct retro_perf_stats
+{
+   const char *ident;
+   uint64_t frames;     /* frames the counter ran in */
+   uint64_t calls;      /* perf_stop() calls, in total */
+   double last_us;      /* in the last frame it ran in */
+   double mean_us;
+   double p50_us;
+   double p95_us;
+   double p99_us;
+   double max_us;
+};
+
+/* Calibrate the tick conversion, which takes about 10ms. Safe to call
+ * again; only the first call does anything. */
+void retro_perf_init(void);
+
+/* What to hand a core for RETRO_ENVIRONMENT_GET_PERF_INTERFACE */
+void retro_perf_get_callback(struct retro_perf_callback *cb);
+
+/* Ends a frame, adding each counter's time in it to its histogram. */
+void retro_perf_frame_end(void);
+
+/* Forget all counters, for when the core is unloaded. */
+void retro_perf_deinit(void);
+
+/* Clear the histograms, keeping the counters. */
+void retro_perf_reset(void);
+
+/**
+ * retro_perf_get_stats:
+ * @stats                   : filled in, "frame" first, then the counters
+ *                            in the order they were registered
+ * @max                     : size of @stats
+ *
+ * Returns: the number of entries filled in.
+ */
+unsigned retro_perf_get_stats(struct retro_perf_stats *stats, unsigned max);
+
+/* One line per counter, with a header, as text for an overlay.
+ * Returns the length, like snprintf(). */
+size_t retro_perf_format_overlay(char *buf, size_t size);
+
+/**
+ * retro_perf_write_json:
+ * @file                    : file to write to
+ *
+ * Write the stats and the histograms. Bucket bounds are in
+ * microseconds, and only buckets that aren't empty are written.
+ *
+ * Returns: true (1) if everything was written, false (0) otherwise.
+ */
+bool retro_perf_write_json(FILE *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_PERF_IMPLEMENTATION
+#undef RETRO_PERF_IMPLEMENTATION
+
+#include <string.h>
+
+#include "rthreads.h"
+#include "cpu_features.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define RETRO_PERF_RDTSC 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define RETRO_PERF_RDTSC 1
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+/* 4 buckets per power of two from 1ns, up to about 18 minutes */
+#define RETRO_PERF_BUCKETS 160
+
+struct retro_perf_entry
+{
+   struct retro_perf_counter *counter;  /* NULL for the frame itself */
+   const char *ident;
+   retro_perf_tick_t last_total;
+   retro_perf_tick_t last_calls;
+   uint64_t frames;
+   uint64_t sum_ns;
+   uint64_t last_ns;
+   uint64_t max_ns;
+   uint32_t buckets[RETRO_PERF_BUCKETS];
+};
+
+static struct
+{
+   volatile uint32_t lock;
+   volatile uint32_t count;
+   bool calibrated;
+   retro_perf_tick_t tick0;
+   int64_t us0;
+   double ns_per_tick;
+   int64_t next_calibration_us;
+   retro_perf_tick_t frame_start;
+   struct retro_perf_entry entries[RETRO_PERF_MAX_COUNTERS + 1];
+} retro_perf;
+
+static retro_time_t RETRO_CALLCONV retro_perf_get_time_usec(void)
+{
+   return (retro_time_t)sthread_clock_us();
+}
+
+static retro_perf_tick_t RETRO_CALLCONV retro_perf_get_counter(void)
+{
+#if RETRO_PERF_RDTSC
+   return (retro_perf_tick_t)__rdtsc();
+#elif defined(__GNUC__) && defined(__aarch64__)
+   uint64_t ticks;
+   __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r"(ticks));
+   return ticks;
+#elif defined(_WIN32)
+   LARGE_INTEGER ticks;
+   QueryPerformanceCounter(&ticks);
+   return (retro_perf_tick_t)ticks.QuadPart;
+#else
+   return (retro_perf_tick_t)sthread_clock_us() * 1000;
+#endif
+}
+
+static uint64_t RETRO_CALLCONV retro_perf_get_cpu_features(void)
+{
+   unsigned features = cpu_features();
+   uint64_t simd     = 0;
+#if CPU_FEATURES_X86
+   /* SSE2 is the least cpu_features reports, and implies these */
+   if (features & CPU_FEATURE_SSE2)
+      simd |= RETRO_SIMD_MMX | RETRO_SIMD_MMXEXT | RETRO_SIMD_CMOV
+         | RETRO_SIMD_SSE | RETRO_SIMD_SSE2;
+   if (features & CPU_FEATURE_SSSE3)
+      simd |= RETRO_SIMD_SSE3 | RETRO_SIMD_SSSE3;
+#endif
+   if (features & CPU_FEATURE_SSE41)
+      simd |= RETRO_SIMD_SSE4;
+   if (features & CPU_FEATURE_SSE42)
+      simd |= RETRO_SIMD_SSE42;
+   if (features & CPU_FEATURE_AVX)
+      simd |= RETRO_SIMD_AVX;
+   if (features & CPU_FEATURE_AVX2)
+      simd |= RETRO_SIMD_AVX2;
+   if (features & CPU_FEATURE_AES)
+      simd |= RETRO_SIMD_AES;
+   if (features & CPU_FEATURE_NEON)
+   {
+      simd |= RETRO_SIMD_NEON;
+#if defined(__aarch64__) || defined(_M_ARM64)
+      simd |= RETRO_SIMD_ASIMD;
+#endif
+   }
+   return simd;
+}
+
+static void retro_perf_lock(void)
+{
+   uint32_t expected = 0;
+   while (!satomic_compare_exchange(&retro_perf.lock, &expected, 1))
+   {
+      expected = 0;
+      satomic_pause();
+   }
+}
+
+static void retro_perf_unlock(void)
+{
+   satomic_store(&retro_perf.lock, 0);
+}
+
+static void RETRO_CALLCONV retro_perf_register(struct retro_perf_counter *counter)
+{
+   uint32_t i, count;
+
+   if (counter->registered)
+      return;
+   retro_perf_lock();
+   count = retro_perf.count;
+   for (i = 1; i < count; i++)
+      if (retro_perf.entries[i].counter == counter)
+         break;
+   if (i == count && count <= RETRO_PERF_MAX_COUNTERS)
+   {
+      struct retro_perf_entry *entry = &retro_perf.entries[count];
+      memset(entry, 0, sizeof(*entry));
+      entry->counter    = counter;
+      entry->ident      = counter->ident ? counter->ident : "?";
+      entry->last_total = counter->total;
+      entry->last_calls = counter->call_cnt;
+      satomic_store(&retro_perf.count, count + 1);
+   }
+   counter->registered = true;
+   retro_perf_unlock();
+}
+
+static void RETRO_CALLCONV retro_perf_start(struct retro_perf_counter *counter)
+{
+   counter->start = retro_perf_get_counter();
+}
+
+static void RETRO_CALLCONV retro_perf_stop(struct retro_perf_counter *counter)
+{
+   counter->total += retro_perf_get_counter() - counter->start;
+   counter->call_cnt++;
+}
+
+static void RETRO_CALLCONV retro_perf_log(void)
+{
+   char text[64 * (RETRO_PERF_MAX_COUNTERS + 2)];
+   retro_perf_format_overlay(text, sizeof(text));
+   fputs(text, stderr);
+}
+
+static void retro_perf_calibrate(void)
+{
+   retro_perf_tick_t ticks = retro_perf_get_counter();
+   int64_t us              = sthread_clock_us();
+   if (us > retro_perf.us0 && ticks > retro_perf.tick0)
+      retro_perf.ns_per_tick = (double)(us - retro_perf.us0) * 1000.0
+         / (double)(ticks - retro_perf.tick0);
+}
+
+void retro_perf_init(void)
+{
+   int64_t end;
+
+   if (retro_perf.calibrated)
+      return;
+   retro_perf.tick0 = retro_perf_get_counter();
+   retro_perf.us0   = sthread_clock_us();
+   end              = retro_perf.us0 + 10000;
+   while (sthread_clock_us() < end)
+      satomic_pause();
+   retro_perf_calibrate();
+   retro_perf.next_calibration_us = end + 1000000;
+   retro_perf.calibrated          = true;
+
+   retro_perf.entries[0].ident = "frame";
+   retro_perf.frame_start      = retro_perf_get_counter();
+   if (!retro_perf.count)
+      retro_perf.count = 1;
+}
+
+void retro_perf_get_callback(struct retro_perf_callback *cb)
+{
+   retro_perf_init();
+   cb->get_time_usec    = retro_perf_get_time_usec;
+   cb->get_cpu_features = retro_perf_get_cpu_features;
+   cb->get_perf_counter = retro_perf_get_counter;
+   cb->perf_register    = retro_perf_register;
+   cb->perf_start       = retro_perf_start;
+   cb->perf_stop        = retro_perf_stop;
+   cb->perf_log         = retro_perf_log;
+}
+
+static unsigned retro_perf_bucket(uint64_t ns)
+{
+   unsigned log2 = 0, bucket;
+   if (ns < 2)
+      return 0;
+   while ((ns >> log2) > 1)
+      log2++;
+   /* the two bits under the top one pick the quarter */
+   bucket = log2 * 4 + (unsigned)(log2 >= 2 ? (ns >> (log2 - 2)) & 3
+         : (ns << (2 - log2)) & 3);
+   return bucket < RETRO_PERF_BUCKETS ? bucket : RETRO_PERF_BUCKETS - 1;
+}
+
+/* Lower bound of a bucket, in ns */
+static double retro_perf_bucket_ns(unsigned bucket)
+{
+   double ns = (double)(1ull << (bucket / 4));
+   return ns + ns * (bucket % 4) / 4.0;
+}
+
+static void retro_perf_add(struct retro_perf_entry *entry, uint64_t ns)
+{
+   entry->frames++;
+   entry->sum_ns += ns;
+   entry->last_ns = ns;
+   if (ns > entry->max_ns)
+      entry->max_ns = ns;
+   entry->buckets[retro_perf_bucket(ns)]++;
+}
+
+void retro_perf_frame_end(void)
+{
+   retro_perf_tick_t now;
+   uint32_t i, count;
+
+   retro_perf_init();
+   now = retro_perf_get_counter();
+   if (sthread_clock_us() >= retro_perf.next_calibration_us)
+   {
+      retro_perf_calibrate();
+      retro_perf.next_calibration_us = sthread_clock_us() + 1000000;
+   }
+
+   retro_perf_add(&retro_perf.entries[0],
+         (uint64_t)((double)(now - retro_perf.frame_start) * retro_perf.ns_per_tick));
+   retro_perf.frame_start = now;
+
+   count = satomic_load(&retro_perf.count);
+   for (i = 1; i < count; i++)
+   {
+      struct retro_perf_entry *entry = &retro_perf.entries[i];
+      retro_perf_tick_t total = entry->counter->total;
+      retro_perf_tick_t calls = entry->counter->call_cnt;
+      if (calls == entry->last_calls)
+         continue;
+      retro_perf_add(entry,
+            (uint64_t)((double)(total - entry->last_total) * retro_perf.ns_per_tick));
+      entry->last_total = total;
+      entry->last_calls = calls;
+   }
+}
+
+void retro_perf_deinit(void)
+{
+   retro_perf_lock();
+   memset(&retro_perf.entries[0], 0, sizeof(retro_perf.entries[0]));
+   retro_perf.entries[0].ident = "frame";
+   satomic_store(&retro_perf.count, retro_perf.calibrated ? 1 : 0);
+   retro_perf_unlock();
+}
+
+void retro_perf_reset(void)
+{
+   uint32_t i, count = satomic_load(&retro_perf.count);
+   for (i = 0; i < count; i++)
+   {
+      struct retro_perf_entry *entry = &retro_perf.entries[i];
+      entry->frames = entry->sum_ns = entry->last_ns = entry->max_ns = 0;
+      memset(entry->buckets, 0, sizeof(entry->buckets));
+   }
+}
+
+static double retro_perf_percentile(const struct retro_perf_entry *entry, double p)
+{
+   uint64_t rank = (uint64_t)(p * (double)(entry->frames - 1)), seen = 0;
+   unsigned i;
+   for (i = 0; i < RETRO_PERF_BUCKETS; i++)
+   {
+      seen += entry->buckets[i];
+      if (seen > rank)
+      {
+         /* the middle of the bucket, but no further than the max */
+         double ns = (retro_perf_bucket_ns(i) + retro_perf_bucket_ns(i + 1)) / 2.0;
+         return (ns < (double)entry->max_ns ? ns : (double)entry->max_ns) / 1000.0;
+      }
+   }
+   return (double)entry->max_ns / 1000.0;
+}
+
+unsigned retro_perf_get_stats(struct retro_perf_stats *stats, unsigned max)
+{
+   uint32_t i, count = satomic_load(&retro_perf.count);
+
+   for (i = 0; i < count && i < max; i++)
+   {
+      const struct retro_perf_entry *entry = &retro_perf.entries[i];
+      struct retro_perf_stats *s = &stats[i];
+      memset(s, 0, sizeof(*s));
+      s->ident  = entry->ident;
+      s->frames = entry->frames;
+      s->calls  = entry->counter ? entry->counter->call_cnt : entry->frames;
+      if (!entry->frames)
+         continue;
+      s->last_us = (double)entry->last_ns / 1000.0;
+      s->mean_us = (double)entry->sum_ns / (double)entry->frames / 1000.0;
+      s->p50_us  = retro_perf_percentile(entry, 0.50);
+      s->p95_us  = retro_perf_percentile(entry, 0.95);
+      s->p99_us  = retro_perf_percentile(entry, 0.99);
+      s->max_us  = (double)entry->max_ns / 1000.0;
+   }
+   return i;
+}
+
+size_t retro_perf_format_overlay(char *buf, size_t size)
+{
+   struct retro_perf_stats stats[RETRO_PERF_MAX_COUNTERS + 1];
+   unsigned i, count = retro_perf_get_stats(stats, RETRO_PERF_MAX_COUNTERS + 1);
+   size_t len = 0;
+   int n;
+
+   n = snprintf(buf, size, "%-24s %9s %9s %9s %9s %9s\n",
+         "counter (us)", "last", "p50", "p95", "p99", "max");
+   len += n > 0 ? (size_t)n : 0;
+   for (i = 0; i < count; i++)
+   {
+      n = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+            "%-24.24s %9.1f %9.1f %9.1f %9.1f %9.1f\n", stats[i].ident,
+            stats[i].last_us, stats[i].p50_us, stats[i].p95_us,
+            stats[i].p99_us, stats[i].max_us);
+      len += n > 0 ? (size_t)n : 0;
+   }
+   return len;
+}
+
+static void retro_perf_json_string(FILE *file, const char *s)
+{
+   fputc('"', file);
+   for (; *s; s++)
+   {
+      if (*s == '"' || *s == '\\')
+         fprintf(file, "\\%c", *s);
+      else if ((unsigned char)*s < 0x20)
+         fprintf(file, "\\u%04x", (unsigned char)*s);
+      else
+         fputc(*s, file);
+   }
+   fputc('"', file);
+}
+
+bool retro_perf_write_json(FILE *file)
+{
+   struct retro_perf_stats stats[RETRO_PERF_MAX_COUNTERS + 1];
+   unsigned i, count = retro_perf_get_stats(stats, RETRO_PERF_MAX_COUNTERS + 1);
+
+   fprintf(file, "{\n  \"ns_per_tick\": %.6f,\n  \"counters\": [", retro_perf.ns_per_tick);
+   for (i = 0; i < count; i++)
+   {
+      const struct retro_perf_entry *entry = &retro_perf.entries[i];
+      bool first = true;
+      unsigned b;
+
+      fprintf(file, "%s\n    { \"ident\": ", i ? "," : "");
+      retro_perf_json_string(file, stats[i].ident);
+      fprintf(file, ", \"frames\": %llu, \"calls\": %llu, \"last_us\": %.3f, "
+            "\"mean_us\": %.3f, \"p50_us\": %.3f, \"p95_us\": %.3f, "
+            "\"p99_us\": %.3f, \"max_us\": %.3f,\n      \"histogram\": [",
+            (unsigned long long)stats[i].frames, (unsigned long long)stats[i].calls,
+            stats[i].last_us, stats[i].mean_us, stats[i].p50_us,
+            stats[i].p95_us, stats[i].p99_us, stats[i].max_us);
+      for (b = 0; b < RETRO_PERF_BUCKETS; b++)
+      {
+         if (!entry->buckets[b])
+            continue;
+         fprintf(file, "%s[%.3f, %.3f, %u]", first ? "" : ", ",
+               retro_perf_bucket_ns(b) / 1000.0, retro_perf_bucket_ns(b + 1) / 1000.0,
+               (unsigned)entry->buckets[b]);
+         first = false;
+      }
+      fprintf(file, "] }");
+   }
+   fprintf(file, "\n  ]\n}\n");
+   return !ferror(file);
+}
+
+#endif
@@ -0,0 +1,415 @@
+/* retro_rewind.h - rewind buffer of delta-compressed savestates.
+ *
+ * Keeping a whole retro_serialize() blob for every frame costs state
+ * size times frame rate, which for large-state cores is hundreds of
+ * megabytes a minute. Consecutive states mostly differ in a few places,
+ * so this keeps only the newest state in full, and for each one before
+ * it the XOR of it with the one after, compressed. Going back a frame
+ * XORs the newest delta into the full state.
+ *
+ * The deltas are coded as runs of zero words and runs of literal words,
+ * which is all an XOR of two similar states needs: unchanged regions,
+ * whole RAM banks in many cores, are passed over at memory speed, and
+ * coding never costs more than a few bytes over the raw size. They are
+ * kept in a fixed-size byte ring, oldest dropped first.
+ *
+ * Coding runs on an sthread_pool_t, so that the frame that pushes a
+ * state only pays for the serialize (into the buffer returned by
+ * retro_rewind_begin_push()). The next push or pop waits for it.
+ *
+ *    each frame, when not rewinding:
+ *       void *state = retro_rewind_begin_push(rw, size);
+ *       if (state && retro_serialize(state, size))
+ *          retro_rewind_end_push(rw);
+ *    each frame, when rewinding:
+ *       const void *state = retro_rewind_pop(rw, &size);
+ *       if (state)
+ *          retro_unserialize(state, size);
+ *
+ * One file must define RETRO_REWIND_IMPLEMENTATION before including
+ * this, with rthreads.h built somewhere. */
+
+#ifndef __RETRO_REWIND_H__
+#define __RETRO_REWIND_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rthreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct retro_rewind retro_rewind_t;
+
+struct retro_rewind_stats
+{
+   unsigned frames;       /* states that can be gone back to, newest included */
+   size_t state_size;
+   size_t used;           /* bytes of the ring holding deltas */
+   size_t capacity;
+   uint64_t raw_bytes;    /* of the states coded so far ... */
+   uint64_t coded_bytes;  /* ... and what they came to */
+};
+
+/**
+ * retro_rewind_new:
+ * @capacity                : bytes for deltas
+ * @pool                    : pool to code on, or NULL to code in
+ *                            retro_rewind_end_push()
+ *
+ * Returns: pointer to the new buffer if successful, otherwise NULL.
+ */
+retro_rewind_t *retro_rewind_new(size_t capacity, sthread_pool_t *pool);
+
+/* Waits for any coding in progress. */
+void retro_rewind_free(retro_rewind_t *rw);
+
+/**
+ * retro_rewind_begin_push:
+ * @rw                      : pointer to rewind buffer
+ * @size                    : from retro_serialize_size()
+ *
+ * Get a buffer to serialize the current state into. If @size is not
+ * the size of the states held, they are dropped.
+ *
+ * Returns: buffer of @size bytes, or NULL if out of memory.
+ */
+void *retro_rewind_begin_push(retro_rewind_t *rw, size_t size);
+
+/* Adds the state written to the buffer from retro_rewind_begin_push(). */
+void retro_rewind_end_push(retro_rewind_t *rw);
+
+/* Copies @state in, for callers that already have it serialized. */
+bool retro_rewind_push(retro_rewind_t *rw, const void *state, size_t size);
+
+/**
+ * retro_rewind_pop:
+ * @rw                      : pointer to rewind buffer
+ * @size                    : set to the size of the state
+ *
+ * Go back one state. The newest state pushed is dropped, and the one
+ * before it returned; the pointer is good until the next call.
+ *
+ * Returns: the state to unserialize, or NULL if there is none before
+ * the newest.
+ */
+const void *retro_rewind_pop(retro_rewind_t *rw, size_t *size);
+
+/* Drop every state, say on loading a state or content. */
+void retro_rewind_clear(retro_rewind_t *rw);
+
+void retro_rewind_get_stats(retro_rewind_t *rw, struct retro_rewind_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_REWIND_IMPLEMENTATION
+#undef RETRO_REWIND_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+/* A token word holds a zero run and a literal run, of up to this many
+ * words each; the literal words follow it. */
+#define RETRO_REWIND_MAX_RUN 0xffff
+
+struct retro_rewind
+{
+   sthread_pool_t *pool;
+   sthread_wait_group_t *group;
+   bool pending;          /* coding task submitted and not waited for */
+
+   size_t state_size;
+   size_t words;          /* state_size in 32-bit words, rounded up */
+   uint32_t *head;        /* the newest state */
+   uint32_t *next;        /* what's being pushed */
+   bool has_head;
+   uint32_t *scratch;     /* coded delta, before it goes into the ring */
+
+   /* entries are [u32 size][size bytes][u32 size], size a multiple of 4 */
+   uint8_t *ring;
+   size_t capacity;
+   size_t first;          /* start of the oldest entry */
+   size_t end;            /* end of the newest entry */
+   size_t wrap;           /* end of the data before offset 0, if wrapped */
+   bool wrapped;
+   unsigned count;
+   uint64_t raw_bytes, coded_bytes;
+};
+
+/* Codes a ^ b into out, returning the number of words written. out
+ * must have room for words + 2 * (words / RETRO_REWIND_MAX_RUN + 1). */
+static size_t retro_rewind_encode(const uint32_t *a, const uint32_t *b,
+      size_t words, uint32_t *out)
+{
+   size_t i = 0, n = 0;
+
+   while (i < words)
+   {
+      size_t zeros = 0, literals = 0, start;
+
+      /* whole unchanged blocks first, a cache line at a time */
+      while (i + 16 <= words && zeros + 16 <= RETRO_REWIND_MAX_RUN
+            && !memcmp(a + i, b + i, 64))
+      {
+         i     += 16;
+         zeros += 16;
+      }
+      while (i < words && zeros < RETRO_REWIND_MAX_RUN && a[i] == b[i])
+      {
+         i++;
+         zeros++;
+      }
+
+      /* literals until two zero words in a row, which are cheaper as a
+       * new token than as literals */
+      start = i;
+      while (i < words && literals < RETRO_REWIND_MAX_RUN)
+      {
+         if (a[i] == b[i] && (i + 1 == words || a[i + 1] == b[i + 1]))
+            break;
+         i++;
+         literals++;
+      }
+
+      out[n++] = (uint32_t)zeros | (uint32_t)literals << 16;
+      for (; start < i; start++)
+         out[n++] = a[start] ^ b[start];
+   }
+   return n;
+}
+
+/* XORs a coded delta into state. */
+static void retro_rewind_apply(uint32_t *state, const uint32_t *in, size_t n)
+{
+   const uint32_t *end = in + n;
+   while (in < end)
+   {
+      uint32_t token    = *in++;
+      uint32_t literals = token >> 16;
+      state += token & 0xffff;
+      while (literals--)
+         *state++ ^= *in++;
+   }
+}
+
+static void retro_rewind_drop_oldest(retro_rewind_t *rw)
+{
+   uint32_t size;
+   memcpy(&size, rw->ring + rw->first, 4);
+   rw->first += 8 + size;
+   if (rw->wrapped && rw->first == rw->wrap)
+   {
+      rw->first   = 0;
+      rw->wrapped = false;
+   }
+   if (!--rw->count)
+      rw->first = rw->end = 0;
+}
+
+/* Where an entry of n bytes goes, dropping old ones to make room; NULL
+ * if it can't fit even in an empty ring. */
+static uint8_t *retro_rewind_reserve(retro_rewind_t *rw, size_t n)
+{
+   if (n > rw->capacity)
+      return NULL;
+   for (;;)
+   {
+      if (!rw->count)
+         rw->first = rw->end = 0, rw->wrapped = false;
+      if (!rw->wrapped)
+      {
+         if (rw->end + n <= rw->capacity)
+            break;
+         if (n <= rw->first)
+         {
+            rw->wrap    = rw->end;
+            rw->end     = 0;
+            rw->wrapped = true;
+            break;
+         }
+      }
+      else if (rw->end + n <= rw->first)
+         break;
+      retro_rewind_drop_oldest(rw);
+   }
+   rw->end += n;
+   rw->count++;
+   return rw->ring + rw->end - n;
+}
+
+static void retro_rewind_task(void *data)
+{
+   retro_rewind_t *rw = (retro_rewind_t*)data;
+   uint32_t *swap;
+
+   if (rw->has_head)
+   {
+      size_t words = retro_rewind_encode(rw->head, rw->next, rw->words,
+            rw->scratch);
+      uint32_t size = (uint32_t)(words * 4);
+      uint8_t *entry = retro_rewind_reserve(rw, 8 + (size_t)size);
+      if (entry)
+      {
+         memcpy(entry, &size, 4);
+         memcpy(entry + 4, rw->scratch, size);
+         memcpy(entry + 4 + size, &size, 4);
+      }
+      else
+      {
+         /* a delta larger than the whole ring; start again from here */
+         rw->count = 0;
+         rw->first = rw->end = 0;
+         rw->wrapped = false;
+      }
+      rw->raw_bytes   += rw->state_size;
+      rw->coded_bytes += size;
+   }
+   swap        = rw->head;
+   rw->head    = rw->next;
+   rw->next    = swap;
+   rw->has_head = true;
+}
+
+static void retro_rewind_wait(retro_rewind_t *rw)
+{
+   if (rw->pending)
+   {
+      sthread_wait_group_wait(rw->pool, rw->group);
+      rw->pending = false;
+   }
+}
+
+retro_rewind_t *retro_rewind_new(size_t capacity, sthread_pool_t *pool)
+{
+   retro_rewind_t *rw = (retro_rewind_t*)calloc(1, sizeof(*rw));
+
+   if (!rw)
+      return NULL;
+   rw->pool     = pool;
+   rw->capacity = capacity & ~(size_t)3;
+   rw->ring     = (uint8_t*)malloc(rw->capacity ? rw->capacity : 1);
+   rw->group    = sthread_wait_group_new();
+   if (!rw->ring || !rw->group)
+   {
+      retro_rewind_free(rw);
+      return NULL;
+   }
+   return rw;
+}
+
+void retro_rewind_free(retro_rewind_t *rw)
+{
+   if (!rw)
+      return;
+   retro_rewind_wait(rw);
+   if (rw->group)
+      sthread_wait_group_free(rw->group);
+   free(rw->ring);
+   free(rw->head);
+   free(rw->next);
+   free(rw->scratch);
+   free(rw);
+}
+
+void retro_rewind_clear(retro_rewind_t *rw)
+{
+   retro_rewind_wait(rw);
+   rw->has_head = false;
+   rw->count    = 0;
+   rw->first    = rw->end = 0;
+   rw->wrapped  = false;
+}
+
+void *retro_rewind_begin_push(retro_rewind_t *rw, size_t size)
+{
+   retro_rewind_wait(rw);
+   if (size != rw->state_size || !rw->head)
+   {
+      size_t words = (size + 3) / 4;
+      retro_rewind_clear(rw);
+      free(rw->head);
+      free(rw->next);
+      free(rw->scratch);
+      rw->state_size = size;
+      rw->words      = words;
+      /* zeroed, so the padding to a whole word always matches */
+      rw->head       = (uint32_t*)calloc(words + 1, 4);
+      rw->next       = (uint32_t*)calloc(words + 1, 4);
+      rw->scratch    = (uint32_t*)malloc((words + 2 * (words / RETRO_REWIND_MAX_RUN + 1)) * 4);
+      if (!rw->head || !rw->next || !rw->scratch)
+      {
+         free(rw->head);
+         free(rw->next);
+         free(rw->scratch);
+         rw->head = rw->next = rw->scratch = NULL;
+         rw->state_size = rw->words = 0;
+         return NULL;
+      }
+   }
+   return rw->next;
+}
+
+void retro_rewind_end_push(retro_rewind_t *rw)
+{
+   if (sthread_pool_submit(rw->pool, retro_rewind_task, rw, rw->group))
+      rw->pending = rw->pool != NULL;
+}
+
+bool retro_rewind_push(retro_rewind_t *rw, const void *state, size_t size)
+{
+   void *buf = retro_rewind_begin_push(rw, size);
+   if (!buf)
+      return false;
+   memcpy(buf, state, size);
+   retro_rewind_end_push(rw);
+   return true;
+}
+
+const void *retro_rewind_pop(retro_rewind_t *rw, size_t *size)
+{
+   uint32_t coded;
+
+   retro_rewind_wait(rw);
+   if (!rw->has_head || !rw->count)
+      return NULL;
+
+   memcpy(&coded, rw->ring + rw->end - 4, 4);
+   rw->end -= 8 + coded;
+   retro_rewind_apply(rw->head, (const uint32_t*)(rw->ring + rw->end + 4), coded / 4);
+   if (rw->wrapped && rw->end == 0)
+   {
+      rw->end     = rw->wrap;
+      rw->wrapped = false;
+   }
+   if (!--rw->count)
+      rw->first = rw->end = 0;
+
+   *size = rw->state_size;
+   return rw->head;
+}
+
+void retro_rewind_get_stats(retro_rewind_t *rw, struct retro_rewind_stats *stats)
+{
+   retro_rewind_wait(rw);
+   memset(stats, 0, sizeof(*stats));
+   stats->frames      = rw->has_head ? rw->count + 1 : 0;
+   stats->state_size  = rw->state_size;
+   stats->capacity    = rw->capacity;
+   stats->raw_bytes   = rw->raw_bytes;
+   stats->coded_bytes = rw->coded_bytes;
+   if (!rw->count)
+      stats->used = 0;
+   else if (rw->wrapped)
+      stats->used = rw->wrap - rw->first + rw->end;
+   else
+      stats->used = rw->end - rw->first;
+}
+
+#endif
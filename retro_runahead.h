@@ -0,0 +1,367 @@
+/* retro_runahead.h - run-ahead input latency reduction for libretro
+ * frontends.
+ *
+ * A core that reads input late in a frame shows what it did with it
+ * one or more frames later. Run-ahead hides that by running the core
+ * @frames frames ahead each frame with the current input, showing the
+ * last of those, and going back:
+ *
+ *    run the real frame, audio only
+ *    retro_serialize()
+ *    run @frames - 1 frames with audio and video off
+ *    run one frame, video only, which is what's shown
+ *    retro_unserialize()
+ *
+ * With a second instance of the core, the real one just runs, with
+ * video off, and the second one is kept @frames frames ahead of it. As
+ * long as the input doesn't change, the second instance is already
+ * where the next displayed frame starts from, and only has to run one
+ * frame. Only when it does change is the state copied across and the
+ * frames ahead run again, so most frames skip the serialize round
+ * trip and the extra frames. The second instance is told to hard
+ * disable audio, and is never serialized from.
+ *
+ * State buffers come from a retro_state_pool, allocated up front to the
+ * core's retro_serialize_size() and only reallocated if that grows.
+ *
+ * The frontend calls retro_runahead_run() where it called retro_run(),
+ * and answers RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE with
+ * retro_runahead_av_enable(), from the environment callback of either
+ * instance. If a serialize fails, run-ahead turns itself off and runs
+ * frames plainly. One file must define RETRO_RUNAHEAD_IMPLEMENTATION
+ * before including this. */
+
+#ifndef __RETRO_RUNAHEAD_H__
+#define __RETRO_RUNAHEAD_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The entry points of one loaded instance of a core */
+struct retro_core_api
+{
+   void (*run)(void);
+   size_t (*serialize_size)(void);
+   bool (*serialize)(void *data, size_t size);
+   bool (*unserialize)(const void *data, size_t size);
+};
+
+typedef struct retro_state_pool retro_state_pool_t;
+typedef struct retro_runahead retro_runahead_t;
+
+/**
+ * retro_state_pool_new:
+ * @count                   : buffers in the pool
+ * @size                    : bytes in each, from retro_serialize_size()
+ *
+ * Returns: pointer to the new pool if successful, otherwise NULL.
+ */
+retro_state_pool_t *retro_state_pool_new(unsigned count, size_t size);
+void retro_state_pool_free(retro_state_pool_t *pool);
+
+/* Takes a buffer of at least @size bytes, growing every buffer if @size
+ * is more than they hold. Returns NULL if there's none free or growing
+ * failed. */
+void *retro_state_pool_acquire(retro_state_pool_t *pool, size_t size);
+void retro_state_pool_release(retro_state_pool_t *pool, void *state);
+
+struct retro_runahead_config
+{
+   struct retro_core_api core;
+
+   /* A second instance of the same core with the same content loaded,
+    * or NULL to run ahead with @core alone */
+   const struct retro_core_api *secondary;
+
+   unsigned frames;  /* frames to run ahead, 0 to run plainly */
+};
+
+/**
+ * retro_runahead_new:
+ * @config                  : the core, an optional second instance,
+ *                            and how far to run ahead
+ *
+ * Set up run-ahead for a core with its content loaded.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+retro_runahead_t *retro_runahead_new(const struct retro_runahead_config *config);
+void retro_runahead_free(retro_runahead_t *ra);
+
+/**
+ * retro_runahead_run:
+ * @ra                      : pointer to run-ahead object
+ * @input_changed           : whether the input polled for this frame
+ *                            differs from the last frame's
+ *
+ * Run one frame, in place of retro_run(). @input_changed only matters
+ * with a second instance; pass true if unsure.
+ */
+void retro_runahead_run(retro_runahead_t *ra, bool input_changed);
+
+/* The answer to RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE for the frame
+ * being run. */
+int retro_runahead_av_enable(retro_runahead_t *ra);
+
+/* Change how far to run ahead; 0 turns run-ahead off. */
+void retro_runahead_set_frames(retro_runahead_t *ra, unsigned frames);
+
+/* Call after anything that changes the core's state other than running
+ * it, such as loading a state or resetting, so that a second instance
+ * is brought back in line. Also turns run-ahead back on after a failed
+ * serialize. */
+void retro_runahead_reset(retro_runahead_t *ra);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_RUNAHEAD_IMPLEMENTATION
+#undef RETRO_RUNAHEAD_IMPLEMENTATION
+
+#include <stdlib.h>
+
+#define RETRO_AV_ENABLE_VIDEO      1
+#define RETRO_AV_ENABLE_AUDIO      2
+#define RETRO_AV_ENABLE_FAST_STATE 4
+#define RETRO_AV_ENABLE_HARD_AUDIO 8  /* hard disable audio */
+
+#define RETRO_STATE_POOL_MAX 16
+
+struct retro_state_pool
+{
+   unsigned count;
+   size_t size;
+   void *states[RETRO_STATE_POOL_MAX];
+   bool used[RETRO_STATE_POOL_MAX];
+};
+
+struct retro_runahead
+{
+   struct retro_core_api core;
+   struct retro_core_api secondary;
+   bool has_secondary;
+   bool in_sync;      /* the second instance is @frames ahead, on the last input */
+   bool failed;       /* serialize failed; running plainly until reset */
+   unsigned frames;
+   int av;            /* for the call being made */
+   retro_state_pool_t *pool;
+};
+
+retro_state_pool_t *retro_state_pool_new(unsigned count, size_t size)
+{
+   unsigned i;
+   retro_state_pool_t *pool = (retro_state_pool_t*)calloc(1, sizeof(*pool));
+
+   if (!pool)
+      return NULL;
+   pool->count = count < RETRO_STATE_POOL_MAX ? count : RETRO_STATE_POOL_MAX;
+   pool->size  = size;
+   for (i = 0; i < pool->count; i++)
+   {
+      if (size && !(pool->states[i] = malloc(size)))
+      {
+         retro_state_pool_free(pool);
+         return NULL;
+      }
+   }
+   return pool;
+}
+
+void retro_state_pool_free(retro_state_pool_t *pool)
+{
+   unsigned i;
+   if (!pool)
+      return;
+   for (i = 0; i < pool->count; i++)
+      free(pool->states[i]);
+   free(pool);
+}
+
+void *retro_state_pool_acquire(retro_state_pool_t *pool, size_t size)
+{
+   unsigned i;
+
+   /* grow them all at once, as the next state is likely as large */
+   if (size > pool->size)
+   {
+      for (i = 0; i < pool->count; i++)
+      {
+         void *state;
+         if (pool->used[i])
+            return NULL;
+         if (!(state = realloc(pool->states[i], size)))
+            return NULL;
+         pool->states[i] = state;
+      }
+      pool->size = size;
+   }
+
+   for (i = 0; i < pool->count; i++)
+   {
+      if (!pool->used[i])
+      {
+         pool->used[i] = true;
+         return pool->states[i];
+      }
+   }
+   return NULL;
+}
+
+void retro_state_pool_release(retro_state_pool_t *pool, void *state)
+{
+   unsigned i;
+   for (i = 0; i < pool->count; i++)
+      if (pool->states[i] == state)
+         pool->used[i] = false;
+}
+
+retro_runahead_t *retro_runahead_new(const struct retro_runahead_config *config)
+{
+   retro_runahead_t *ra = (retro_runahead_t*)calloc(1, sizeof(*ra));
+
+   if (!ra)
+      return NULL;
+   ra->core   = config->core;
+   ra->frames = config->frames;
+   ra->av     = RETRO_AV_ENABLE_VIDEO | RETRO_AV_ENABLE_AUDIO;
+   if (config->secondary)
+   {
+      ra->secondary     = *config->secondary;
+      ra->has_secondary = true;
+   }
+
+   /* one for the round trip, or the copy to the second instance */
+   ra->pool = retro_state_pool_new(1, ra->core.serialize_size());
+   if (!ra->pool)
+   {
+      free(ra);
+      return NULL;
+   }
+   return ra;
+}
+
+void retro_runahead_free(retro_runahead_t *ra)
+{
+   if (!ra)
+      return;
+   retro_state_pool_free(ra->pool);
+   free(ra);
+}
+
+int retro_runahead_av_enable(retro_runahead_t *ra)
+{
+   return ra->av;
+}
+
+void retro_runahead_set_frames(retro_runahead_t *ra, unsigned frames)
+{
+   if (frames != ra->frames)
+      ra->in_sync = false;
+   ra->frames = frames;
+}
+
+void retro_runahead_reset(retro_runahead_t *ra)
+{
+   ra->in_sync = false;
+   ra->failed  = false;
+}
+
+static void retro_runahead_call(retro_runahead_t *ra,
+      const struct retro_core_api *core, int av)
+{
+   ra->av = av;
+   core->run();
+}
+
+/* Serializes the real instance into a pool buffer; NULL on failure. */
+static void *retro_runahead_save(retro_runahead_t *ra, size_t *size)
+{
+   void *state;
+   int av = ra->av;
+
+   *size = ra->core.serialize_size();
+   if (!*size || !(state = retro_state_pool_acquire(ra->pool, *size)))
+      return NULL;
+   ra->av = av | RETRO_AV_ENABLE_FAST_STATE;
+   if (!ra->core.serialize(state, *size))
+   {
+      ra->av = av;
+      retro_state_pool_release(ra->pool, state);
+      return NULL;
+   }
+   ra->av = av;
+   return state;
+}
+
+static void retro_runahead_run_single(retro_runahead_t *ra)
+{
+   unsigned i;
+   size_t size;
+   void *state;
+
+   retro_runahead_call(ra, &ra->core, RETRO_AV_ENABLE_AUDIO);
+   if (!(state = retro_runahead_save(ra, &size)))
+   {
+      /* the real frame has run; show nothing new this once */
+      ra->failed = true;
+      return;
+   }
+   for (i = 1; i < ra->frames; i++)
+      retro_runahead_call(ra, &ra->core, 0);
+   retro_runahead_call(ra, &ra->core, RETRO_AV_ENABLE_VIDEO);
+
+   ra->av = RETRO_AV_ENABLE_FAST_STATE;
+   ra->core.unserialize(state, size);
+   retro_state_pool_release(ra->pool, state);
+}
+
+static void retro_runahead_run_secondary(retro_runahead_t *ra, bool input_changed)
+{
+   unsigned i;
+
+   retro_runahead_call(ra, &ra->core, RETRO_AV_ENABLE_AUDIO);
+
+   if (input_changed || !ra->in_sync)
+   {
+      size_t size;
+      void *state = retro_runahead_save(ra, &size);
+      if (!state)
+      {
+         ra->failed = true;
+         return;
+      }
+      ra->av = RETRO_AV_ENABLE_FAST_STATE | RETRO_AV_ENABLE_HARD_AUDIO;
+      ra->secondary.unserialize(state, size);
+      retro_state_pool_release(ra->pool, state);
+      for (i = 1; i < ra->frames; i++)
+         retro_runahead_call(ra, &ra->secondary, RETRO_AV_ENABLE_HARD_AUDIO);
+      ra->in_sync = true;
+   }
+   /* otherwise the second instance ran these frames last time, with
+    * the same input */
+   retro_runahead_call(ra, &ra->secondary,
+         RETRO_AV_ENABLE_VIDEO | RETRO_AV_ENABLE_HARD_AUDIO);
+}
+
+void retro_runahead_run(retro_runahead_t *ra, bool input_changed)
+{
+   if (!ra->frames || ra->failed)
+      retro_runahead_call(ra, &ra->core,
+            RETRO_AV_ENABLE_VIDEO | RETRO_AV_ENABLE_AUDIO);
+   else if (ra->has_secondary)
+      retro_runahead_run_secondary(ra, input_changed);
+   else
+      retro_runahead_run_single(ra);
+   ra->av = RETRO_AV_ENABLE_VIDEO | RETRO_AV_ENABLE_AUDIO;
+}
+
+#endif
@@ -0,0 +1,700 @@
+/* retro_scan.h - parallel content scanning for libretro frontends.
+ *
+ * Identifying files one at a time, by opening each with
+ * gme_identify_file(), stbi_info() or a WAV parser, leaves a scan of a
+ * big collection waiting on one read after another. Here a thread of
+ * the scan's own walks the directories and hands files out in batches
+ * to an sthread_pool_t. Each batch hints the system to read all of its
+ * files' headers at once, then reads only the first
+ * RETRO_SCAN_HEADER_SIZE bytes of each and passes them to identifier
+ * functions, in order, until one recognises the file:
+ *
+ *    retro_scan_identify_gme     game music, with gme_identify_header()
+ *    retro_scan_identify_image   images, with stbi_info_from_memory()
+ *    retro_scan_identify_wav     WAVE files, with drwav_init_memory()
+ *
+ * or any of the frontend's own. Recognised files come back through a
+ * queue, so the playlist can grow as the scan goes:
+ *
+ *    retro_scan_identify_t ids[] = { retro_scan_identify_gme,
+ *          retro_scan_identify_image, NULL };
+ *    scan = retro_scan_new(roots, 1, ids, pool);
+ *    ...each frame:
+ *    while ((entry = retro_scan_next(scan, 0)))
+ *       add entry->path to the playlist, then retro_scan_entry_free(entry)
+ *
+ * Files nothing recognises are left out. Track counts and lengths of
+ * music need the whole file, so get those later for what's been found
+ * with gme_index_files().
+ *
+ * One file must define RETRO_SCAN_IMPLEMENTATION before including
+ * this, with rthreads.h built somewhere. Each built-in identifier is
+ * only defined if its library's header (gme.h, stb_image.h or
+ * dr_wav.h) was included before that. Define RETRO_SCAN_HEADER_SIZE
+ * to change how much of each file is read, 16 KB by default; a JPEG
+ * whose size comes after a big EXIF block needs more. Strict C builds
+ * (-std=c99) only declare the POSIX functions the implementation uses
+ * if _POSIX_C_SOURCE is defined before the first system header; this
+ * defines it when it comes first, otherwise that file must. */
+
+#if defined(RETRO_SCAN_IMPLEMENTATION) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+/* for lstat(), which -std=c99 leaves undeclared otherwise */
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#ifndef __RETRO_SCAN_H__
+#define __RETRO_SCAN_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rthreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct retro_scan retro_scan_t;
+
+struct retro_scan_entry
+{
+   char *path;
+   const char *type;      /* static name from the identifier, e.g. "NSF" */
+   uint64_t size;         /* of the file, in bytes */
+   unsigned width;        /* images */
+   unsigned height;
+   unsigned channels;     /* image components, or sound channels */
+   unsigned sample_rate;  /* sound */
+   uint64_t frames;       /* sound length in sample frames, if known */
+};
+
+/* Looks at the first @size bytes of a file (all of it, if it's
+ * shorter) and fills in @entry, whose path and size are already set.
+ * Called on pool threads, several at once. Returns true if it
+ * recognised the file. */
+typedef bool (*retro_scan_identify_t)(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry);
+
+bool retro_scan_identify_gme(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry);
+bool retro_scan_identify_image(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry);
+bool retro_scan_identify_wav(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry);
+
+/**
+ * retro_scan_new:
+ * @roots                   : files or directories to scan, recursively
+ * @count                   : number of @roots
+ * @identify                : identifiers to try in order, ending with
+ *                            NULL; copied
+ * @pool                    : pool to read headers on, or NULL to read
+ *                            them on the scan's own thread
+ *
+ * Starts scanning.
+ *
+ * Returns: pointer to the new scan if successful, otherwise NULL.
+ */
+retro_scan_t *retro_scan_new(const char *const *roots, unsigned count,
+      const retro_scan_identify_t *identify, sthread_pool_t *pool);
+
+/* Stops the scan if it's still going, waits for its threads and frees
+ * it, along with entries not taken. */
+void retro_scan_free(retro_scan_t *scan);
+
+/**
+ * retro_scan_next:
+ * @scan                    : pointer to scan object
+ * @timeout_us              : longest time to wait for a file (in
+ *                            microseconds), 0 to not wait, or negative
+ *                            to wait for as long as it takes
+ *
+ * Takes the next file found. Only one thread may take entries.
+ *
+ * Returns: the entry, which the caller frees with
+ * retro_scan_entry_free(), or NULL if none came in time or the scan is
+ * over; retro_scan_finished() tells which.
+ */
+struct retro_scan_entry *retro_scan_next(retro_scan_t *scan,
+      int64_t timeout_us);
+
+/* True once every file has been looked at and every entry taken. */
+bool retro_scan_finished(retro_scan_t *scan);
+
+/* Files looked at so far, and how many of them were recognised. */
+void retro_scan_get_progress(retro_scan_t *scan, unsigned *files,
+      unsigned *found);
+
+void retro_scan_entry_free(struct retro_scan_entry *entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_SCAN_IMPLEMENTATION
+#undef RETRO_SCAN_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifndef RETRO_SCAN_HEADER_SIZE
+#define RETRO_SCAN_HEADER_SIZE 16384
+#endif
+
+/* Files per pool task. Large enough that the read-ahead hints for a
+ * batch overlap, small enough to spread a directory over the pool. */
+#define RETRO_SCAN_BATCH 32
+
+#define RETRO_SCAN_MAX_IDENTIFIERS 16
+
+/* Entries waiting to be taken; finders wait when it's full. */
+#define RETRO_SCAN_QUEUE_SIZE 1024
+
+struct retro_scan
+{
+   sthread_pool_t *pool;
+   sthread_wait_group_t *group;
+   sthread_t *walker;
+   mpsc_queue_t *results;
+   retro_scan_identify_t identify[RETRO_SCAN_MAX_IDENTIFIERS + 1];
+   char **roots;
+   unsigned root_count;
+   volatile uint32_t cancel;
+   volatile uint32_t files;
+   volatile uint32_t found;
+   bool finished;         /* end marker taken; consumer's own */
+   struct retro_scan_batch *batch;   /* being filled by the walker */
+};
+
+struct retro_scan_batch
+{
+   retro_scan_t *scan;
+   unsigned count;
+   char *paths[RETRO_SCAN_BATCH];
+   uint64_t sizes[RETRO_SCAN_BATCH];
+};
+
+/* Pushed after the last entry; never a real entry's address. */
+static char retro_scan_end_marker;
+
+static char *retro_scan_strdup(const char *s)
+{
+   size_t n = strlen(s) + 1;
+   char *copy = (char*)malloc(n);
+   if (copy)
+      memcpy(copy, s, n);
+   return copy;
+}
+
+static char *retro_scan_join(const char *dir, const char *name)
+{
+   size_t dn = strlen(dir), nn = strlen(name);
+   char *path = (char*)malloc(dn + nn + 2);
+   if (!path)
+      return NULL;
+   memcpy(path, dir, dn);
+   if (dn && dir[dn - 1] != '/' && dir[dn - 1] != '\\')
+      path[dn++] = '/';
+   memcpy(path + dn, name, nn + 1);
+   return path;
+}
+
+/* Waits for room rather than dropping what was found. */
+static void retro_scan_push(retro_scan_t *scan, void *item)
+{
+   while (!mpsc_queue_push(scan->results, item))
+   {
+      if (satomic_load(&scan->cancel))
+      {
+         if (item != &retro_scan_end_marker)
+            retro_scan_entry_free((struct retro_scan_entry*)item);
+         return;
+      }
+      sthread_sleep_us(1000);
+   }
+}
+
+static void retro_scan_identify_one(retro_scan_t *scan, const char *path,
+      uint64_t size, const uint8_t *header, size_t n)
+{
+   struct retro_scan_entry probe;
+   unsigned i;
+
+   memset(&probe, 0, sizeof(probe));
+   probe.size = size;
+
+   for (i = 0; scan->identify[i]; i++)
+   {
+      struct retro_scan_entry *entry;
+
+      if (!scan->identify[i](header, n, &probe))
+      {
+         memset(&probe, 0, sizeof(probe));
+         probe.size = size;
+         continue;
+      }
+
+      entry = (struct retro_scan_entry*)malloc(sizeof(*entry));
+      if (!entry)
+         return;
+      *entry      = probe;
+      entry->path = retro_scan_strdup(path);
+      if (!entry->path)
+      {
+         free(entry);
+         return;
+      }
+      satomic_fetch_add(&scan->found, 1);
+      retro_scan_push(scan, entry);
+      return;
+   }
+}
+
+static void retro_scan_batch_task(void *data)
+{
+   struct retro_scan_batch *batch = (struct retro_scan_batch*)data;
+   retro_scan_t *scan             = batch->scan;
+   uint8_t *header                = NULL;
+   unsigned i;
+
+   if (!satomic_load(&scan->cancel))
+      header = (uint8_t*)malloc(RETRO_SCAN_HEADER_SIZE);
+
+#if defined(_WIN32)
+   if (header)
+   {
+      for (i = 0; i < batch->count; i++)
+      {
+         wchar_t wpath[MAX_PATH * 2];
+         HANDLE file;
+         DWORD n = 0;
+
+         if (satomic_load(&scan->cancel))
+            break;
+         if (!MultiByteToWideChar(CP_UTF8, 0, batch->paths[i], -1, wpath,
+               (int)(sizeof(wpath) / sizeof(wpath[0]))))
+            continue;
+         file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL,
+               OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+         if (file == INVALID_HANDLE_VALUE)
+            continue;
+         if (ReadFile(file, header, RETRO_SCAN_HEADER_SIZE, &n, NULL))
+            retro_scan_identify_one(scan, batch->paths[i], batch->sizes[i],
+                  header, n);
+         CloseHandle(file);
+         satomic_fetch_add(&scan->files, 1);
+      }
+   }
+#else
+   if (header)
+   {
+      int fds[RETRO_SCAN_BATCH];
+
+      /* ask for every header first, so the reads below overlap */
+      for (i = 0; i < batch->count; i++)
+      {
+         fds[i] = open(batch->paths[i], O_RDONLY);
+#if defined(POSIX_FADV_WILLNEED)
+         if (fds[i] >= 0)
+            posix_fadvise(fds[i], 0, RETRO_SCAN_HEADER_SIZE,
+                  POSIX_FADV_WILLNEED);
+#endif
+      }
+
+      for (i = 0; i < batch->count; i++)
+      {
+         ssize_t n;
+
+         if (fds[i] < 0)
+            continue;
+         if (!satomic_load(&scan->cancel))
+         {
+            n = read(fds[i], header, RETRO_SCAN_HEADER_SIZE);
+            if (n >= 0)
+               retro_scan_identify_one(scan, batch->paths[i],
+                     batch->sizes[i], header, (size_t)n);
+            satomic_fetch_add(&scan->files, 1);
+         }
+         close(fds[i]);
+      }
+   }
+#endif
+
+   free(header);
+   for (i = 0; i < batch->count; i++)
+      free(batch->paths[i]);
+   free(batch);
+}
+
+static void retro_scan_flush_batch(retro_scan_t *scan)
+{
+   struct retro_scan_batch *batch = scan->batch;
+   unsigned i;
+
+   if (!batch || !batch->count)
+      return;
+   scan->batch = NULL;
+
+   if (sthread_pool_submit(scan->pool, retro_scan_batch_task, batch,
+         scan->group))
+      return;
+
+   /* no memory to queue it; drop the batch */
+   for (i = 0; i < batch->count; i++)
+      free(batch->paths[i]);
+   free(batch);
+}
+
+/* Takes ownership of path. */
+static void retro_scan_add_file(retro_scan_t *scan, char *path,
+      uint64_t size)
+{
+   struct retro_scan_batch *batch = scan->batch;
+
+   if (!batch)
+   {
+      batch = (struct retro_scan_batch*)malloc(sizeof(*batch));
+      if (!batch)
+      {
+         free(path);
+         return;
+      }
+      batch->scan  = scan;
+      batch->count = 0;
+      scan->batch  = batch;
+   }
+
+   batch->paths[batch->count] = path;
+   batch->sizes[batch->count] = size;
+   if (++batch->count == RETRO_SCAN_BATCH)
+      retro_scan_flush_batch(scan);
+}
+
+/* Adds path if it's a file, or everything under it if it's a
+ * directory. Takes ownership of path. */
+static void retro_scan_walk(retro_scan_t *scan, char *path)
+{
+#if defined(_WIN32)
+   wchar_t wpath[MAX_PATH * 2];
+   WIN32_FIND_DATAW find;
+   HANDLE handle;
+   DWORD attributes;
+   size_t n;
+
+   if (satomic_load(&scan->cancel) || !MultiByteToWideChar(CP_UTF8, 0,
+         path, -1, wpath, MAX_PATH * 2 - 3))
+   {
+      free(path);
+      return;
+   }
+
+   attributes = GetFileAttributesW(wpath);
+   if (attributes == INVALID_FILE_ATTRIBUTES)
+   {
+      free(path);
+      return;
+   }
+   if (!(attributes & FILE_ATTRIBUTE_DIRECTORY))
+   {
+      WIN32_FILE_ATTRIBUTE_DATA data;
+      uint64_t size = 0;
+      if (GetFileAttributesExW(wpath, GetFileExInfoStandard, &data))
+         size = (uint64_t)data.nFileSizeHigh << 32 | data.nFileSizeLow;
+      retro_scan_add_file(scan, path, size);
+      return;
+   }
+
+   n = wcslen(wpath);
+   if (n && wpath[n - 1] != L'/' && wpath[n - 1] != L'\\')
+      wpath[n++] = L'\\';
+   wpath[n++] = L'*';
+   wpath[n]   = 0;
+
+   handle = FindFirstFileW(wpath, &find);
+   if (handle != INVALID_HANDLE_VALUE)
+   {
+      do
+      {
+         char name[MAX_PATH * 3];
+         char *child;
+
+         if (!wcscmp(find.cFileName, L".") || !wcscmp(find.cFileName, L".."))
+            continue;
+         if (find.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            continue; /* don't follow links out of the tree, or round it */
+         if (!WideCharToMultiByte(CP_UTF8, 0, find.cFileName, -1, name,
+               sizeof(name), NULL, NULL))
+            continue;
+         child = retro_scan_join(path, name);
+         if (!child)
+            continue;
+
+         if (find.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            retro_scan_walk(scan, child);
+         else
+            retro_scan_add_file(scan, child,
+                  (uint64_t)find.nFileSizeHigh << 32 | find.nFileSizeLow);
+      } while (!satomic_load(&scan->cancel) && FindNextFileW(handle, &find));
+      FindClose(handle);
+   }
+   free(path);
+#else
+   struct stat st;
+   struct dirent *ent;
+   DIR *dir;
+
+   if (satomic_load(&scan->cancel) || stat(path, &st))
+   {
+      free(path);
+      return;
+   }
+   if (!S_ISDIR(st.st_mode))
+   {
+      if (S_ISREG(st.st_mode))
+         retro_scan_add_file(scan, path, (uint64_t)st.st_size);
+      else
+         free(path);
+      return;
+   }
+
+   dir = opendir(path);
+   if (dir)
+   {
+      while (!satomic_load(&scan->cancel) && (ent = readdir(dir)))
+      {
+         char *child;
+
+         if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, ".."))
+            continue;
+         child = retro_scan_join(path, ent->d_name);
+         if (!child)
+            continue;
+
+         /* don't follow links out of the tree, or round it */
+         if (lstat(child, &st) || S_ISLNK(st.st_mode))
+            free(child);
+         else if (S_ISDIR(st.st_mode))
+            retro_scan_walk(scan, child);
+         else if (S_ISREG(st.st_mode))
+            retro_scan_add_file(scan, child, (uint64_t)st.st_size);
+         else
+            free(child);
+      }
+      closedir(dir);
+   }
+   free(path);
+#endif
+}
+
+static void retro_scan_walker(void *data)
+{
+   retro_scan_t *scan = (retro_scan_t*)data;
+   unsigned i;
+
+   for (i = 0; i < scan->root_count; i++)
+   {
+      char *root = scan->roots[i];
+      scan->roots[i] = NULL;
+      retro_scan_walk(scan, root);
+   }
+   retro_scan_flush_batch(scan);
+
+   sthread_wait_group_wait(scan->pool, scan->group);
+   retro_scan_push(scan, &retro_scan_end_marker);
+}
+
+retro_scan_t *retro_scan_new(const char *const *roots, unsigned count,
+      const retro_scan_identify_t *identify, sthread_pool_t *pool)
+{
+   unsigned i;
+   retro_scan_t *scan = (retro_scan_t*)calloc(1, sizeof(*scan));
+   if (!scan)
+      return NULL;
+
+   scan->pool = pool;
+   for (i = 0; identify && identify[i] && i < RETRO_SCAN_MAX_IDENTIFIERS; i++)
+      scan->identify[i] = identify[i];
+
+   scan->roots = (char**)calloc(count ? count : 1, sizeof(*scan->roots));
+   if (!scan->roots)
+      goto error;
+   for (scan->root_count = 0; scan->root_count < count; scan->root_count++)
+      if (!(scan->roots[scan->root_count] =
+            retro_scan_strdup(roots[scan->root_count])))
+         goto error;
+
+   scan->group   = sthread_wait_group_new();
+   scan->results = mpsc_queue_new(RETRO_SCAN_QUEUE_SIZE, true);
+   if (!scan->group || !scan->results)
+      goto error;
+
+   scan->walker = sthread_create(retro_scan_walker, scan);
+   if (!scan->walker)
+      goto error;
+
+   return scan;
+
+error:
+   retro_scan_free(scan);
+   return NULL;
+}
+
+void retro_scan_free(retro_scan_t *scan)
+{
+   void *item;
+   unsigned i;
+
+   if (!scan)
+      return;
+
+   satomic_store(&scan->cancel, 1);
+   if (scan->walker)
+      sthread_join(scan->walker);
+
+   if (scan->results)
+   {
+      while (mpsc_queue_pop(scan->results, &item))
+         if (item != &retro_scan_end_marker)
+            retro_scan_entry_free((struct retro_scan_entry*)item);
+      mpsc_queue_free(scan->results);
+   }
+   if (scan->group)
+      sthread_wait_group_free(scan->group);
+   if (scan->roots)
+      for (i = 0; i < scan->root_count; i++)
+         free(scan->roots[i]);
+   free(scan->roots);
+   free(scan);
+}
+
+struct retro_scan_entry *retro_scan_next(retro_scan_t *scan,
+      int64_t timeout_us)
+{
+   void *item;
+
+   if (scan->finished)
+      return NULL;
+   if (timeout_us ? !mpsc_queue_pop_wait(scan->results, &item, timeout_us)
+         : !mpsc_queue_pop(scan->results, &item))
+      return NULL;
+   if (item == &retro_scan_end_marker)
+   {
+      scan->finished = true;
+      return NULL;
+   }
+   return (struct retro_scan_entry*)item;
+}
+
+bool retro_scan_finished(retro_scan_t *scan)
+{
+   return scan->finished;
+}
+
+void retro_scan_get_progress(retro_scan_t *scan, unsigned *files,
+      unsigned *found)
+{
+   if (files)
+      *files = satomic_load(&scan->files);
+   if (found)
+      *found = satomic_load(&scan->found);
+}
+
+void retro_scan_entry_free(struct retro_scan_entry *entry)
+{
+   if (!entry)
+      return;
+   free(entry->path);
+   free(entry);
+}
+
+#ifdef GME_H
+bool retro_scan_identify_gme(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry)
+{
+   const char *type;
+   if (size < 4)
+      return false;
+   type = gme_identify_header(header);
+   if (!*type)
+      return false;
+   entry->type = type;
+   return true;
+}
+#endif
+
+#ifdef STBI_INCLUDE_STB_IMAGE_H
+bool retro_scan_identify_image(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry)
+{
+   int x, y, comp;
+
+   if (!stbi_info_from_memory(header, (int)size, &x, &y, &comp))
+      return false;
+
+   entry->type = "image";
+   if (size >= 4 && !memcmp(header, "\x89PNG", 4))
+      entry->type = "PNG";
+   else if (size >= 2 && header[0] == 0xFF && header[1] == 0xD8)
+      entry->type = "JPEG";
+   else if (size >= 3 && !memcmp(header, "GIF", 3))
+      entry->type = "GIF";
+   else if (size >= 2 && !memcmp(header, "BM", 2))
+      entry->type = "BMP";
+
+   entry->width    = (unsigned)x;
+   entry->height   = (unsigned)y;
+   entry->channels = (unsigned)comp;
+   return true;
+}
+#endif
+
+#ifdef dr_wav_h
+bool retro_scan_identify_wav(const uint8_t *header, size_t size,
+      struct retro_scan_entry *entry)
+{
+   drwav wav;
+   uint64_t data_size;
+
+   if (!drwav_init_memory(&wav, header, size, NULL))
+      return false;
+
+   entry->type        = "WAV";
+   entry->channels    = wav.channels;
+   entry->sample_rate = wav.sampleRate;
+
+   /* only the header was read, so the frame count comes from the data
+    * chunk's size as the file gives it, less anything past the file's
+    * real end */
+   entry->frames = wav.totalPCMFrameCount;
+   data_size     = entry->size > wav.dataChunkDataPos
+         ? entry->size - wav.dataChunkDataPos : 0;
+   if (wav.channels && wav.bitsPerSample && wav.translatedFormatTag == DR_WAVE_FORMAT_PCM)
+   {
+      uint64_t most = data_size / (wav.channels * ((wav.bitsPerSample + 7) / 8));
+      if (entry->frames > most)
+         entry->frames = most;
+   }
+
+   drwav_uninit(&wav);
+   return true;
+}
+#endif
+
+#endif
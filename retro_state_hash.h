@@ -0,0 +1,533 @@
+/* retro_state_hash.h - incremental state hashing for netplay desync
+ * checks in libretro frontends.
+ *
+ * Hashing all of retro_serialize() with SHA-256 every frame costs far
+ * more than a desync check is worth. Here the memory a core lists with
+ * RETRO_ENVIRONMENT_SET_MEMORY_MAPS is split into 4 KB pages, each with
+ * a 64-bit XXH64 hash seeded by the page's number, and the state hash
+ * is the sum of the page hashes, so a frame only rehashes the pages
+ * that changed and adjusts the sum. Pages are read as stored, so peers
+ * must be of the same byte order, as they would be for netplay anyway.
+ *
+ * Which pages changed is found in one of two ways:
+ *
+ *    RETRO_STATE_HASH_COMPARE      each page is compared with a copy of
+ *                                  it from the last update, which costs
+ *                                  a pass over memory at memcmp speed
+ *    RETRO_STATE_HASH_WRITE_WATCH  pages are write protected after each
+ *                                  update, and the first write to one
+ *                                  marks it and opens it up again, so an
+ *                                  update only touches what was written
+ *                                  (Windows; elsewhere this compares)
+ *
+ * Write watching depends on the core only writing to its memory
+ * itself: a system call given a protected buffer fails instead of
+ * faulting, so it's not for cores that read files straight into their
+ * RAM. Frontends or cores that know what they wrote can add to either
+ * with retro_state_hash_mark().
+ *
+ * Read-only (RETRO_MEMDESC_CONST) areas and mirrors of the same memory
+ * are left out. What isn't in the memory maps, such as CPU registers,
+ * isn't covered; hash it on its own if the core exposes it small.
+ * Any number of cores can be hashed at once, one object each.
+ *
+ * One file must define RETRO_STATE_HASH_IMPLEMENTATION before
+ * including this. */
+
+#ifndef __RETRO_STATE_HASH_H__
+#define __RETRO_STATE_HASH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETRO_STATE_HASH_PAGE_SIZE 4096
+
+enum retro_state_hash_mode
+{
+   RETRO_STATE_HASH_COMPARE = 0,
+   RETRO_STATE_HASH_WRITE_WATCH
+};
+
+typedef struct retro_state_hash retro_state_hash_t;
+
+struct retro_state_hash_stats
+{
+   size_t bytes;          /* memory hashed */
+   unsigned pages;
+   unsigned dirty;        /* pages rehashed by the last update */
+   bool watching;         /* write watching is in use */
+};
+
+/**
+ * retro_state_hash_new:
+ * @map                     : from SET_MEMORY_MAPS; only read here
+ * @mode                    : how to find which pages changed
+ *
+ * Hashes everything once.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+retro_state_hash_t *retro_state_hash_new(const struct retro_memory_map *map,
+      enum retro_state_hash_mode mode);
+
+/* Takes write protection off again, first. */
+void retro_state_hash_free(retro_state_hash_t *hash);
+
+/* The hash of the current state, after rehashing what changed since
+ * the last call; after retro_run(). */
+uint64_t retro_state_hash_update(retro_state_hash_t *hash);
+
+/* Have the pages under @ptr to @ptr + @len rehashed next update. */
+void retro_state_hash_mark(retro_state_hash_t *hash, const void *ptr, size_t len);
+
+/* Rehash everything next update, as after loading a state. */
+void retro_state_hash_invalidate(retro_state_hash_t *hash);
+
+void retro_state_hash_get_stats(retro_state_hash_t *hash,
+      struct retro_state_hash_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_STATE_HASH_IMPLEMENTATION
+#undef RETRO_STATE_HASH_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+struct retro_state_hash_region
+{
+   uint8_t *ptr;
+   size_t len;
+   unsigned first;        /* number of its first page */
+   uint8_t *copy;         /* for comparing */
+};
+
+struct retro_state_hash
+{
+   struct retro_state_hash_region *regions;
+   unsigned num_regions;
+   unsigned num_pages;
+   size_t bytes;
+
+   uint64_t *hashes;      /* per page */
+   uint64_t sum;
+   volatile long *dirty;  /* a bit per page; set from write faults */
+   bool compare;
+   bool watching;
+   bool all;              /* rehash everything */
+   unsigned last_dirty;
+
+#ifdef _WIN32
+   size_t os_page;
+   struct retro_state_hash *next;
+#endif
+};
+
+#define RETRO_STATE_HASH_P1 0x9E3779B185EBCA87ull
+#define RETRO_STATE_HASH_P2 0xC2B2AE3D27D4EB4Full
+#define RETRO_STATE_HASH_P3 0x165667B19E3779F9ull
+#define RETRO_STATE_HASH_P4 0x85EBCA77C2B2AE63ull
+#define RETRO_STATE_HASH_P5 0x27D4EB2F165667C5ull
+
+static uint64_t retro_state_hash_rotl(uint64_t x, int r)
+{
+   return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t retro_state_hash_read64(const uint8_t *p)
+{
+   uint64_t v;
+   memcpy(&v, p, sizeof(v));
+   return v;
+}
+
+static uint64_t retro_state_hash_round(uint64_t acc, uint64_t input)
+{
+   acc += input * RETRO_STATE_HASH_P2;
+   return retro_state_hash_rotl(acc, 31) * RETRO_STATE_HASH_P1;
+}
+
+static uint64_t retro_state_hash_merge(uint64_t acc, uint64_t val)
+{
+   acc ^= retro_state_hash_round(0, val);
+   return acc * RETRO_STATE_HASH_P1 + RETRO_STATE_HASH_P4;
+}
+
+/* XXH64 */
+static uint64_t retro_state_hash_xxh64(const uint8_t *p, size_t len, uint64_t seed)
+{
+   const uint8_t *end = p + len;
+   uint64_t h;
+
+   if (len >= 32)
+   {
+      uint64_t v1 = seed + RETRO_STATE_HASH_P1 + RETRO_STATE_HASH_P2;
+      uint64_t v2 = seed + RETRO_STATE_HASH_P2;
+      uint64_t v3 = seed;
+      uint64_t v4 = seed - RETRO_STATE_HASH_P1;
+      do
+      {
+         v1 = retro_state_hash_round(v1, retro_state_hash_read64(p));
+         v2 = retro_state_hash_round(v2, retro_state_hash_read64(p + 8));
+         v3 = retro_state_hash_round(v3, retro_state_hash_read64(p + 16));
+         v4 = retro_state_hash_round(v4, retro_state_hash_read64(p + 24));
+         p += 32;
+      } while (p + 32 <= end);
+      h = retro_state_hash_rotl(v1, 1) + retro_state_hash_rotl(v2, 7)
+         + retro_state_hash_rotl(v3, 12) + retro_state_hash_rotl(v4, 18);
+      h = retro_state_hash_merge(h, v1);
+      h = retro_state_hash_merge(h, v2);
+      h = retro_state_hash_merge(h, v3);
+      h = retro_state_hash_merge(h, v4);
+   }
+   else
+      h = seed + RETRO_STATE_HASH_P5;
+
+   h += (uint64_t)len;
+   for (; p + 8 <= end; p += 8)
+   {
+      h ^= retro_state_hash_round(0, retro_state_hash_read64(p));
+      h  = retro_state_hash_rotl(h, 27) * RETRO_STATE_HASH_P1 + RETRO_STATE_HASH_P4;
+   }
+   if (p + 4 <= end)
+   {
+      uint32_t v;
+      memcpy(&v, p, sizeof(v));
+      h ^= (uint64_t)v * RETRO_STATE_HASH_P1;
+      h  = retro_state_hash_rotl(h, 23) * RETRO_STATE_HASH_P2 + RETRO_STATE_HASH_P3;
+      p += 4;
+   }
+   for (; p < end; p++)
+   {
+      h ^= (uint64_t)*p * RETRO_STATE_HASH_P5;
+      h  = retro_state_hash_rotl(h, 11) * RETRO_STATE_HASH_P1;
+   }
+
+   h ^= h >> 33;
+   h *= RETRO_STATE_HASH_P2;
+   h ^= h >> 29;
+   h *= RETRO_STATE_HASH_P3;
+   h ^= h >> 32;
+   return h;
+}
+
+static void retro_state_hash_set_dirty(retro_state_hash_t *hash, unsigned page)
+{
+#ifdef _WIN32
+   InterlockedOr(&hash->dirty[page / 32], (long)(1u << (page % 32)));
+#else
+   hash->dirty[page / 32] |= (long)(1u << (page % 32));
+#endif
+}
+
+/* Marks the pages of @region under @ptr to @ptr + @len. */
+static void retro_state_hash_mark_region(retro_state_hash_t *hash,
+      const struct retro_state_hash_region *region, const uint8_t *ptr, size_t len)
+{
+   size_t begin, end, i;
+
+   if (ptr + len <= region->ptr || ptr >= region->ptr + region->len)
+      return;
+   begin = ptr > region->ptr ? (size_t)(ptr - region->ptr) : 0;
+   end   = (size_t)(ptr + len - region->ptr);
+   if (end > region->len)
+      end = region->len;
+   for (i = begin / RETRO_STATE_HASH_PAGE_SIZE;
+         i * RETRO_STATE_HASH_PAGE_SIZE < end; i++)
+      retro_state_hash_set_dirty(hash, region->first + (unsigned)i);
+}
+
+#ifdef _WIN32
+/* Write watching: every object watching is on a list the fault handler
+ * looks through, and a region's OS pages are protected read-only
+ * between a write and the update after it. */
+static SRWLOCK retro_state_hash_lock = SRWLOCK_INIT;
+static retro_state_hash_t *retro_state_hash_watchers;
+static PVOID retro_state_hash_handler;
+
+static LONG CALLBACK retro_state_hash_fault(PEXCEPTION_POINTERS info)
+{
+   const EXCEPTION_RECORD *record = info->ExceptionRecord;
+   retro_state_hash_t *hash;
+   uint8_t *page  = NULL;
+   size_t os_page = 0;
+   bool found     = false;
+
+   if (record->ExceptionCode != EXCEPTION_ACCESS_VIOLATION
+         || record->NumberParameters < 2 || record->ExceptionInformation[0] != 1)
+      return EXCEPTION_CONTINUE_SEARCH;
+
+   AcquireSRWLockShared(&retro_state_hash_lock);
+   for (hash = retro_state_hash_watchers; hash; hash = hash->next)
+   {
+      unsigned i;
+      os_page = hash->os_page;
+      page    = (uint8_t*)(record->ExceptionInformation[1] & ~(ULONG_PTR)(os_page - 1));
+      for (i = 0; i < hash->num_regions; i++)
+      {
+         const struct retro_state_hash_region *region = &hash->regions[i];
+         if (page + os_page <= region->ptr || page >= region->ptr + region->len)
+            continue;
+         retro_state_hash_mark_region(hash, region, page, os_page);
+         found = true;
+      }
+   }
+   if (found)
+   {
+      DWORD old;
+      VirtualProtect(page, os_page, PAGE_READWRITE, &old);
+   }
+   ReleaseSRWLockShared(&retro_state_hash_lock);
+   return found ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+}
+
+/* Protects the OS pages under @ptr to @ptr + @len, or opens them up. */
+static bool retro_state_hash_protect(retro_state_hash_t *hash,
+      const uint8_t *ptr, size_t len, bool on)
+{
+   DWORD old;
+   ULONG_PTR begin = (ULONG_PTR)ptr & ~(ULONG_PTR)(hash->os_page - 1);
+   ULONG_PTR end   = ((ULONG_PTR)ptr + len + hash->os_page - 1) & ~(ULONG_PTR)(hash->os_page - 1);
+   return VirtualProtect((void*)begin, end - begin,
+         on ? PAGE_READONLY : PAGE_READWRITE, &old) != 0;
+}
+
+static bool retro_state_hash_watch(retro_state_hash_t *hash)
+{
+   SYSTEM_INFO system;
+   unsigned i;
+
+   GetSystemInfo(&system);
+   hash->os_page = system.dwPageSize;
+   for (i = 0; i < hash->num_regions; i++)
+   {
+      MEMORY_BASIC_INFORMATION mem;
+      /* only plain read-write memory; anything else is compared */
+      if (!VirtualQuery(hash->regions[i].ptr, &mem, sizeof(mem))
+            || mem.State != MEM_COMMIT || mem.Protect != PAGE_READWRITE)
+         return false;
+   }
+
+   AcquireSRWLockExclusive(&retro_state_hash_lock);
+   if (!retro_state_hash_handler)
+      retro_state_hash_handler = AddVectoredExceptionHandler(1, retro_state_hash_fault);
+   if (retro_state_hash_handler)
+   {
+      hash->next                = retro_state_hash_watchers;
+      retro_state_hash_watchers = hash;
+   }
+   ReleaseSRWLockExclusive(&retro_state_hash_lock);
+   return retro_state_hash_handler != NULL;
+}
+
+static void retro_state_hash_unwatch(retro_state_hash_t *hash)
+{
+   retro_state_hash_t **link;
+   unsigned i;
+
+   AcquireSRWLockExclusive(&retro_state_hash_lock);
+   for (link = &retro_state_hash_watchers; *link; link = &(*link)->next)
+   {
+      if (*link == hash)
+      {
+         *link = hash->next;
+         break;
+      }
+   }
+   for (i = 0; i < hash->num_regions; i++)
+      retro_state_hash_protect(hash, hash->regions[i].ptr, hash->regions[i].len, false);
+   ReleaseSRWLockExclusive(&retro_state_hash_lock);
+}
+#endif
+
+static void retro_state_hash_rehash(retro_state_hash_t *hash,
+      const struct retro_state_hash_region *region, size_t page)
+{
+   size_t offset = page * RETRO_STATE_HASH_PAGE_SIZE;
+   size_t len    = region->len - offset;
+   unsigned n    = region->first + (unsigned)page;
+
+   if (len > RETRO_STATE_HASH_PAGE_SIZE)
+      len = RETRO_STATE_HASH_PAGE_SIZE;
+#ifdef _WIN32
+   /* protect before reading, so that a write after this is seen */
+   if (hash->watching)
+      retro_state_hash_protect(hash, region->ptr + offset, len, true);
+#endif
+   if (region->copy)
+      memcpy(region->copy + offset, region->ptr + offset, len);
+   hash->sum      -= hash->hashes[n];
+   hash->hashes[n] = retro_state_hash_xxh64(region->ptr + offset, len, n);
+   hash->sum      += hash->hashes[n];
+   hash->last_dirty++;
+}
+
+retro_state_hash_t *retro_state_hash_new(const struct retro_memory_map *map,
+      enum retro_state_hash_mode mode)
+{
+   unsigned i, j;
+   retro_state_hash_t *hash = (retro_state_hash_t*)calloc(1, sizeof(*hash));
+
+   if (!hash)
+      return NULL;
+   hash->regions = (struct retro_state_hash_region*)calloc(
+         map->num_descriptors ? map->num_descriptors : 1, sizeof(*hash->regions));
+   if (!hash->regions)
+      goto error;
+
+   for (i = 0; i < map->num_descriptors; i++)
+   {
+      const struct retro_memory_descriptor *desc = &map->descriptors[i];
+      struct retro_state_hash_region *region;
+      uint8_t *ptr;
+
+      if (!desc->ptr || !desc->len || (desc->flags & RETRO_MEMDESC_CONST))
+         continue;
+      ptr = (uint8_t*)desc->ptr + desc->offset;
+      /* mirrors list the same memory again */
+      for (j = 0; j < hash->num_regions; j++)
+         if (hash->regions[j].ptr == ptr && hash->regions[j].len == desc->len)
+            break;
+      if (j < hash->num_regions)
+         continue;
+
+      region        = &hash->regions[hash->num_regions++];
+      region->ptr   = ptr;
+      region->len   = desc->len;
+      region->first = hash->num_pages;
+      hash->num_pages += (unsigned)((desc->len + RETRO_STATE_HASH_PAGE_SIZE - 1)
+            / RETRO_STATE_HASH_PAGE_SIZE);
+      hash->bytes   += desc->len;
+   }
+
+   hash->hashes = (uint64_t*)calloc(hash->num_pages + 1, sizeof(*hash->hashes));
+   hash->dirty  = (volatile long*)calloc(hash->num_pages / 32 + 1, sizeof(*hash->dirty));
+   if (!hash->hashes || !hash->dirty)
+      goto error;
+
+#ifdef _WIN32
+   if (mode == RETRO_STATE_HASH_WRITE_WATCH)
+      hash->watching = retro_state_hash_watch(hash);
+#else
+   (void)mode;
+#endif
+   hash->compare = !hash->watching;
+   if (hash->compare)
+   {
+      for (i = 0; i < hash->num_regions; i++)
+         if (!(hash->regions[i].copy = (uint8_t*)malloc(hash->regions[i].len)))
+            goto error;
+   }
+
+   hash->all = true;
+   retro_state_hash_update(hash);
+   return hash;
+
+error:
+   retro_state_hash_free(hash);
+   return NULL;
+}
+
+void retro_state_hash_free(retro_state_hash_t *hash)
+{
+   unsigned i;
+
+   if (!hash)
+      return;
+#ifdef _WIN32
+   if (hash->watching)
+      retro_state_hash_unwatch(hash);
+#endif
+   if (hash->regions)
+      for (i = 0; i < hash->num_regions; i++)
+         free(hash->regions[i].copy);
+   free(hash->regions);
+   free(hash->hashes);
+   free((void*)hash->dirty);
+   free(hash);
+}
+
+uint64_t retro_state_hash_update(retro_state_hash_t *hash)
+{
+   unsigned i;
+   bool all = hash->all;
+
+   hash->all        = false;
+   hash->last_dirty = 0;
+
+   for (i = 0; i < hash->num_regions; i++)
+   {
+      const struct retro_state_hash_region *region = &hash->regions[i];
+      size_t page, pages = (region->len + RETRO_STATE_HASH_PAGE_SIZE - 1)
+         / RETRO_STATE_HASH_PAGE_SIZE;
+
+      for (page = 0; page < pages; page++)
+      {
+         unsigned n   = region->first + (unsigned)page;
+         long bit     = (long)(1u << (n % 32));
+         bool changed = all;
+
+         if (hash->dirty[n / 32] & bit)
+         {
+#ifdef _WIN32
+            InterlockedAnd(&hash->dirty[n / 32], ~bit);
+#else
+            hash->dirty[n / 32] &= ~bit;
+#endif
+            changed = true;
+         }
+         else if (!changed && hash->compare)
+         {
+            size_t offset = page * RETRO_STATE_HASH_PAGE_SIZE;
+            size_t len    = region->len - offset;
+            if (len > RETRO_STATE_HASH_PAGE_SIZE)
+               len = RETRO_STATE_HASH_PAGE_SIZE;
+            changed = memcmp(region->copy + offset, region->ptr + offset, len) != 0;
+         }
+         if (!changed)
+            continue;
+
+         retro_state_hash_rehash(hash, region, page);
+      }
+   }
+
+   return retro_state_hash_rotl(hash->sum, 17) ^ (uint64_t)hash->bytes;
+}
+
+void retro_state_hash_mark(retro_state_hash_t *hash, const void *ptr, size_t len)
+{
+   unsigned i;
+   for (i = 0; i < hash->num_regions; i++)
+      retro_state_hash_mark_region(hash, &hash->regions[i], (const uint8_t*)ptr, len);
+}
+
+void retro_state_hash_invalidate(retro_state_hash_t *hash)
+{
+   hash->all = true;
+}
+
+void retro_state_hash_get_stats(retro_state_hash_t *hash,
+      struct retro_state_hash_stats *stats)
+{
+   stats->bytes    = hash->bytes;
+   stats->pages    = hash->num_pages;
+   stats->dirty    = hash->last_dirty;
+   stats->watching = hash->watching;
+}
+
+#endif
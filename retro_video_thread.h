@@ -0,0 +1,402 @@
+/* retro_video_thread.h - threaded video for libretro frontends.
+ *
+ * Running retro_run(), the upload and the present on one thread means
+ * every vsync wait, and every slow shader pass, is time the core isn't
+ * running. Here a render thread of its own owns the GL or Vulkan
+ * context and does all of that, and the core thread only hands it
+ * frames:
+ *
+ *    core thread                      render thread
+ *    retro_run()                      init(), making the context current
+ *      video_refresh                  wait for a frame, or one frame time
+ *        retro_video_thread_submit()  present(), repeating the last frame
+ *                                     if there's nothing new
+ *
+ * Frames go through a triple buffer whose three slots are swapped
+ * through a single atomic word, so neither thread ever waits on the
+ * other to hand one over; a frame not yet presented when the next
+ * arrives is replaced, unless @block is set, when the core thread
+ * waits for the render thread to take it and so runs at the display's
+ * rate, as it did before, but with the present overlapping the next
+ * frame. A condition variable is only used to let a thread sleep.
+ *
+ * Software frames are copied into the slot. Hardware rendered cores
+ * render into one of three framebuffers of the frontend's, the one
+ * retro_video_thread_slot() says, from
+ * retro_hw_render_callback.get_current_framebuffer; the core thread's
+ * context must share objects with the render thread's, and the
+ * frontend passes a fence (a GLsync, say) to wait on before reading it.
+ *
+ * For RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, the time passed to the
+ * core before each retro_run() is to be taken on the core thread with
+ * retro_video_thread_frame_time(), as it no longer waits on the
+ * display each frame.
+ *
+ * One file must define RETRO_VIDEO_THREAD_IMPLEMENTATION before
+ * including this, with rthreads.h built somewhere. */
+
+#ifndef __RETRO_VIDEO_THREAD_H__
+#define __RETRO_VIDEO_THREAD_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct retro_video_thread retro_video_thread_t;
+
+struct retro_video_thread_frame
+{
+   const void *data;     /* software frames, NULL for hardware ones */
+   unsigned width;
+   unsigned height;
+   size_t pitch;
+   unsigned slot;        /* hardware frames: which of the three framebuffers */
+   void *sync;           /* hardware frames: as given to submit_hw() */
+   bool fresh;           /* false if presented before */
+   int64_t time_us;      /* when it was submitted, on sthread_clock_us() */
+};
+
+struct retro_video_thread_config
+{
+   /* All on the render thread. init() makes the context current, and
+    * failing ends the thread; present() uploads, runs the shaders and
+    * swaps, and may block on vsync. */
+   bool (*init)(void *userdata);
+   void (*present)(void *userdata, const struct retro_video_thread_frame *frame);
+   void (*deinit)(void *userdata);
+   void *userdata;
+
+   double fps;           /* of the core, for how long to wait for a frame */
+   bool block;           /* the core thread waits for each frame to be taken */
+};
+
+struct retro_video_thread_stats
+{
+   uint32_t submitted;
+   uint32_t presented;   /* calls to present(), with repeats */
+   uint32_t dropped;     /* replaced before the render thread took them */
+   uint32_t repeated;
+   int64_t present_us;   /* average time between presents */
+};
+
+/**
+ * retro_video_thread_new:
+ * @config                  : callbacks and pacing
+ *
+ * Start the render thread, and wait for init() to finish.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL; if
+ * init() failed, it has been cleaned up after with deinit().
+ */
+retro_video_thread_t *retro_video_thread_new(const struct retro_video_thread_config *config);
+
+/* Stops the render thread, after a present in flight. */
+void retro_video_thread_free(retro_video_thread_t *vt);
+
+/* For the video callback, software frames; NULL @data repeats the last
+ * frame, and returns straight away. */
+void retro_video_thread_submit(retro_video_thread_t *vt, const void *data,
+      unsigned width, unsigned height, size_t pitch);
+
+/* For the video callback given RETRO_HW_FRAME_BUFFER_VALID: hands over
+ * the framebuffer of retro_video_thread_slot(), with a fence for the
+ * core's rendering into it. */
+void retro_video_thread_submit_hw(retro_video_thread_t *vt,
+      unsigned width, unsigned height, void *sync);
+
+/* The framebuffer, 0 to 2, for the core to render into next; from
+ * get_current_framebuffer, on the core thread. */
+unsigned retro_video_thread_slot(retro_video_thread_t *vt);
+
+/**
+ * retro_video_thread_frame_time:
+ * @vt                      : pointer to video thread object
+ * @reference               : from retro_frame_time_callback
+ *
+ * Time since the last call, for the frame time callback before
+ * retro_run(). The first call, and any after more than a few frames
+ * (after a pause, say), give @reference.
+ */
+retro_usec_t retro_video_thread_frame_time(retro_video_thread_t *vt,
+      retro_usec_t reference);
+
+void retro_video_thread_get_stats(retro_video_thread_t *vt,
+      struct retro_video_thread_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef RETRO_VIDEO_THREAD_IMPLEMENTATION
+#undef RETRO_VIDEO_THREAD_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rthreads.h"
+
+/* The mailbox holds the index of the slot last handed over, and this
+ * bit while the render thread hasn't taken it. */
+#define RETRO_VIDEO_THREAD_FRESH 4u
+
+struct retro_video_thread_slot
+{
+   struct retro_video_thread_frame frame;
+   void *data;
+   size_t capacity;
+};
+
+struct retro_video_thread
+{
+   struct retro_video_thread_config config;
+   int64_t frame_us;
+
+   sthread_t *thread;
+   slock_t *lock;
+   scond_t *cond;
+   volatile uint32_t quit;
+   volatile uint32_t started;   /* 1 running, 2 init() failed */
+
+   volatile uint32_t mailbox;
+   unsigned back;               /* the core thread's */
+   unsigned front;              /* the render thread's */
+   struct retro_video_thread_slot slots[3];
+
+   int64_t last_run;            /* for frame_time() */
+
+   volatile uint32_t submitted, presented, dropped, repeated;
+   int64_t first_present, last_present;
+};
+
+static uint32_t retro_video_thread_exchange(volatile uint32_t *ptr, uint32_t value)
+{
+   uint32_t expected = satomic_load(ptr);
+   while (!satomic_compare_exchange(ptr, &expected, value));
+   return expected;
+}
+
+static void retro_video_thread_wake(retro_video_thread_t *vt)
+{
+   slock_lock(vt->lock);
+   scond_broadcast(vt->cond);
+   slock_unlock(vt->lock);
+}
+
+static void retro_video_thread_loop(void *data)
+{
+   retro_video_thread_t *vt = (retro_video_thread_t*)data;
+   bool have = false;
+
+   if (vt->config.init && !vt->config.init(vt->config.userdata))
+   {
+      if (vt->config.deinit)
+         vt->config.deinit(vt->config.userdata);
+      satomic_store(&vt->started, 2);
+      retro_video_thread_wake(vt);
+      return;
+   }
+   satomic_store(&vt->started, 1);
+   retro_video_thread_wake(vt);
+
+   while (!satomic_load(&vt->quit))
+   {
+      struct retro_video_thread_frame *frame;
+      int64_t now;
+
+      if (!(satomic_load(&vt->mailbox) & RETRO_VIDEO_THREAD_FRESH))
+      {
+         slock_lock(vt->lock);
+         if (!(satomic_load(&vt->mailbox) & RETRO_VIDEO_THREAD_FRESH)
+               && !satomic_load(&vt->quit))
+            scond_wait_timeout(vt->cond, vt->lock, vt->frame_us);
+         slock_unlock(vt->lock);
+         if (satomic_load(&vt->quit))
+            break;
+      }
+
+      if (satomic_load(&vt->mailbox) & RETRO_VIDEO_THREAD_FRESH)
+      {
+         vt->front = retro_video_thread_exchange(&vt->mailbox, vt->front)
+            & ~RETRO_VIDEO_THREAD_FRESH;
+         vt->slots[vt->front].frame.fresh = true;
+         have = true;
+         if (vt->config.block)
+            retro_video_thread_wake(vt);
+      }
+      else if (have)
+      {
+         vt->slots[vt->front].frame.fresh = false;
+         satomic_fetch_add(&vt->repeated, 1);
+      }
+      else
+         continue;
+
+      frame = &vt->slots[vt->front].frame;
+      vt->config.present(vt->config.userdata, frame);
+
+      now = sthread_clock_us();
+      if (!satomic_fetch_add(&vt->presented, 1))
+         vt->first_present = now;
+      vt->last_present = now;
+   }
+
+   if (vt->config.deinit)
+      vt->config.deinit(vt->config.userdata);
+}
+
+retro_video_thread_t *retro_video_thread_new(const struct retro_video_thread_config *config)
+{
+   unsigned i;
+   retro_video_thread_t *vt = (retro_video_thread_t*)calloc(1, sizeof(*vt));
+
+   if (!vt)
+      return NULL;
+   vt->config   = *config;
+   vt->frame_us = (int64_t)(1000000.0 / (config->fps > 0.0 ? config->fps : 60.0));
+   vt->back     = 0;
+   vt->mailbox  = 1;
+   vt->front    = 2;
+   for (i = 0; i < 3; i++)
+      vt->slots[i].frame.slot = i;
+
+   if (!(vt->lock = slock_new()) || !(vt->cond = scond_new()))
+      goto error;
+   if (!(vt->thread = sthread_create(retro_video_thread_loop, vt)))
+      goto error;
+
+   slock_lock(vt->lock);
+   while (!satomic_load(&vt->started))
+      scond_wait(vt->cond, vt->lock);
+   slock_unlock(vt->lock);
+   if (satomic_load(&vt->started) != 1)
+      goto error;
+   return vt;
+
+error:
+   retro_video_thread_free(vt);
+   return NULL;
+}
+
+void retro_video_thread_free(retro_video_thread_t *vt)
+{
+   unsigned i;
+
+   if (!vt)
+      return;
+   if (vt->thread)
+   {
+      satomic_store(&vt->quit, 1);
+      retro_video_thread_wake(vt);
+      sthread_join(vt->thread);
+   }
+   for (i = 0; i < 3; i++)
+      free(vt->slots[i].data);
+   if (vt->cond)
+      scond_free(vt->cond);
+   if (vt->lock)
+      slock_free(vt->lock);
+   free(vt);
+}
+
+/* Hands the back slot over and takes the one it replaces. */
+static void retro_video_thread_publish(retro_video_thread_t *vt)
+{
+   uint32_t old;
+   struct retro_video_thread_frame *frame = &vt->slots[vt->back].frame;
+
+   frame->time_us = sthread_clock_us();
+   satomic_fetch_add(&vt->submitted, 1);
+
+   if (vt->config.block && (satomic_load(&vt->mailbox) & RETRO_VIDEO_THREAD_FRESH))
+   {
+      slock_lock(vt->lock);
+      while ((satomic_load(&vt->mailbox) & RETRO_VIDEO_THREAD_FRESH)
+            && !satomic_load(&vt->quit))
+         scond_wait(vt->cond, vt->lock);
+      slock_unlock(vt->lock);
+   }
+
+   old = retro_video_thread_exchange(&vt->mailbox,
+         vt->back | RETRO_VIDEO_THREAD_FRESH);
+   if (old & RETRO_VIDEO_THREAD_FRESH)
+      satomic_fetch_add(&vt->dropped, 1);
+   vt->back = old & ~RETRO_VIDEO_THREAD_FRESH;
+   retro_video_thread_wake(vt);
+}
+
+void retro_video_thread_submit(retro_video_thread_t *vt, const void *data,
+      unsigned width, unsigned height, size_t pitch)
+{
+   struct retro_video_thread_slot *slot = &vt->slots[vt->back];
+   size_t size                          = pitch * height;
+
+   if (!data)
+      return;
+   if (size > slot->capacity)
+   {
+      void *buf = realloc(slot->data, size);
+      if (!buf)
+         return;
+      slot->data     = buf;
+      slot->capacity = size;
+   }
+   memcpy(slot->data, data, size);
+   slot->frame.data   = slot->data;
+   slot->frame.width  = width;
+   slot->frame.height = height;
+   slot->frame.pitch  = pitch;
+   slot->frame.sync   = NULL;
+   retro_video_thread_publish(vt);
+}
+
+void retro_video_thread_submit_hw(retro_video_thread_t *vt,
+      unsigned width, unsigned height, void *sync)
+{
+   struct retro_video_thread_frame *frame = &vt->slots[vt->back].frame;
+
+   frame->data   = NULL;
+   frame->width  = width;
+   frame->height = height;
+   frame->pitch  = 0;
+   frame->sync   = sync;
+   retro_video_thread_publish(vt);
+}
+
+unsigned retro_video_thread_slot(retro_video_thread_t *vt)
+{
+   return vt->back;
+}
+
+retro_usec_t retro_video_thread_frame_time(retro_video_thread_t *vt,
+      retro_usec_t reference)
+{
+   int64_t now   = sthread_clock_us();
+   int64_t delta = now - vt->last_run;
+   bool first    = !vt->last_run;
+
+   vt->last_run = now;
+   if (first || delta <= 0 || (reference > 0 && delta > 4 * reference))
+      return reference;
+   return (retro_usec_t)delta;
+}
+
+void retro_video_thread_get_stats(retro_video_thread_t *vt,
+      struct retro_video_thread_stats *stats)
+{
+   stats->submitted  = satomic_load(&vt->submitted);
+   stats->presented  = satomic_load(&vt->presented);
+   stats->dropped    = satomic_load(&vt->dropped);
+   stats->repeated   = satomic_load(&vt->repeated);
+   stats->present_us = stats->presented > 1
+      ? (vt->last_present - vt->first_present) / (stats->presented - 1) : 0;
+}
+
+#endif
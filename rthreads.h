@@ -22,9 +22,29 @@
 
 #ifndef __RTHREADS_H__
 #define __RTHREADS_H__
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define STHREAD_INLINE __inline
+#elif defined(__GNUC__) && !defined(__cplusplus)
+#define STHREAD_INLINE __inline__
+#else
+#define STHREAD_INLINE inline
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define STHREAD_ATOMIC_GNUC 1
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#if defined(_M_IX86) || defined(_M_X64)
+#define STHREAD_ATOMIC_MSVC_X86 1
+#endif
+#else
+#error "rthreads.h: no atomic intrinsics known for this compiler"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -46,6 +66,61 @@ typedef struct scond scond_t;
  */
 sthread_t *sthread_create(void (*thread_func)(void*), void *userdata);
 
+enum sthread_priority
+{
+    STHREAD_PRIORITY_NORMAL = 0,
+    STHREAD_PRIORITY_LOWEST,
+    STHREAD_PRIORITY_LOW,
+    STHREAD_PRIORITY_HIGH,
+    STHREAD_PRIORITY_HIGHEST,
+    /* Above everything but other time critical threads; only for
+     * threads that do very little each time they wake, such as
+     * audio rendering. */
+    STHREAD_PRIORITY_TIME_CRITICAL
+};
+
+/* How sthread_create_ex() sets up a thread. Each setting is applied
+ * as far as the system allows, and one that can't be is ignored
+ * rather than failing the creation. */
+struct sthread_attr
+{
+    enum sthread_priority priority;
+    /* CPUs the thread may run on, bit n for CPU n, or 0 for any. */
+    uint64_t affinity_mask;
+    /* Bytes of stack to reserve, or 0 for the default. */
+    size_t stack_size;
+    /* UTF-8 name shown in debuggers and profilers, or NULL. */
+    const char *name;
+    /* On Windows, register the thread with the multimedia class
+     * scheduler as a "Pro Audio" task, which keeps it scheduled ahead
+     * of ordinary threads however busy the system is. */
+    bool pro_audio;
+};
+
+/**
+ * sthread_attr_init:
+ * @attr                    : pointer to thread attributes
+ *
+ * Set @attr to the defaults: normal priority on any CPU, with the
+ * default stack size, no name and no MMCSS registration.
+ */
+void sthread_attr_init(struct sthread_attr *attr);
+
+/**
+ * sthread_create_ex:
+ * @start_routine           : thread entry callback function
+ * @userdata                : pointer to userdata that will be made
+ *                            available in thread entry callback function
+ * @attr                    : thread attributes, or NULL for the defaults
+ *
+ * Create a new thread as given by @attr. The thread does not start
+ * running until its priority and affinity have been set.
+ *
+ * Returns: pointer to new thread if successful, otherwise NULL.
+ */
+sthread_t *sthread_create_ex(void (*thread_func)(void*), void *userdata,
+      const struct sthread_attr *attr);
+
 /**
  * sthread_detach:
  * @thread                  : pointer to thread object 
@@ -176,6 +251,335 @@ int scond_broadcast(scond_t *cond);
  **/
 void scond_signal(scond_t *cond);
 
+/**
+ * sthread_clock_us:
+ *
+ * Returns: the time in microseconds on a clock that never jumps or
+ * runs backwards, from an arbitrary starting point.
+ */
+int64_t sthread_clock_us(void);
+
+/**
+ * sthread_sleep_us:
+ * @us                      : time to sleep (in microseconds)
+ *
+ * Sleep for at least @us, on a high resolution timer where the system
+ * has one. Wakes up no more than about a millisecond late at worst.
+ */
+void sthread_sleep_us(int64_t us);
+
+/**
+ * sthread_sleep_until:
+ * @deadline_us             : time to wake up, on sthread_clock_us()
+ *
+ * Sleep until shortly before @deadline_us, then spin until it is
+ * reached, for pacing that is accurate to a few microseconds. Costs a
+ * little CPU time at the end of each sleep; use sthread_sleep_us()
+ * where that accuracy isn't needed.
+ */
+void sthread_sleep_until(int64_t deadline_us);
+
+/* A pool of worker threads for running short tasks, meant to be
+ * created once and shared by everything that has work to spread
+ * across cores, rather than each of them starting threads of its own.
+ * Each worker has its own queue: tasks submitted from a worker go on
+ * its queue, and a worker with nothing left on its queue takes tasks
+ * from the oldest end of the others'. Tasks submitted from any other
+ * thread go on a queue of their own, which the workers take from in
+ * the same way. */
+typedef struct sthread_pool sthread_pool_t;
+
+/* A count of tasks submitted and not yet finished, for waiting on a
+ * batch of tasks together. */
+typedef struct sthread_wait_group sthread_wait_group_t;
+
+/**
+ * sthread_pool_new:
+ * @num_threads             : number of worker threads, or 0 for one
+ *                            per CPU
+ *
+ * Create a thread pool and start its worker threads.
+ *
+ * Returns: pointer to new thread pool if successful, otherwise NULL.
+ */
+sthread_pool_t *sthread_pool_new(unsigned num_threads);
+
+/**
+ * sthread_pool_free:
+ * @pool                    : pointer to thread pool object
+ *
+ * Run any tasks still queued, then stop the worker threads and free
+ * the pool. No tasks may be submitted once this has been called.
+ */
+void sthread_pool_free(sthread_pool_t *pool);
+
+/**
+ * sthread_pool_num_threads:
+ * @pool                    : pointer to thread pool object
+ *
+ * Returns: the number of worker threads in @pool.
+ */
+unsigned sthread_pool_num_threads(sthread_pool_t *pool);
+
+/**
+ * sthread_pool_submit:
+ * @pool                    : pointer to thread pool object
+ * @func                    : task callback function
+ * @userdata                : pointer to userdata passed to @func
+ * @group                   : wait group to count the task in, or NULL
+ *
+ * Queue a call of @func(@userdata) on one of the worker threads. May
+ * be called from any thread, including from within a task. If @pool
+ * is NULL, @func is called on the calling thread before returning.
+ *
+ * Returns: true (1) if the task was queued or run, false (0) if
+ * memory for it could not be allocated.
+ */
+bool sthread_pool_submit(sthread_pool_t *pool, void (*func)(void*),
+      void *userdata, sthread_wait_group_t *group);
+
+/**
+ * sthread_wait_group_new:
+ *
+ * Create a wait group with a count of zero. Must be manually freed.
+ *
+ * Returns: pointer to new wait group if successful, otherwise NULL.
+ */
+sthread_wait_group_t *sthread_wait_group_new(void);
+
+/**
+ * sthread_wait_group_free:
+ * @group                   : pointer to wait group object
+ *
+ * Frees a wait group. Its tasks must all have finished.
+ */
+void sthread_wait_group_free(sthread_wait_group_t *group);
+
+/**
+ * sthread_wait_group_wait:
+ * @pool                    : pointer to thread pool object the tasks
+ *                            were submitted to
+ * @group                   : pointer to wait group object
+ *
+ * Wait until every task submitted with @group has finished. While
+ * waiting, the calling thread runs queued tasks from @pool (whether in
+ * @group or not) instead of blocking, so this may safely be called
+ * from within a task.
+ */
+void sthread_wait_group_wait(sthread_pool_t *pool,
+      sthread_wait_group_t *group);
+
+/* Atomic operations on 32-bit values shared between threads, with
+ * the compiler's own intrinsics. Loads acquire and stores release;
+ * the read-modify-write operations and satomic_fence() are full
+ * barriers. */
+static STHREAD_INLINE uint32_t satomic_load(const volatile uint32_t *ptr)
+{
+#if defined(STHREAD_ATOMIC_GNUC)
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#elif defined(STHREAD_ATOMIC_MSVC_X86)
+    /* x86 loads already have acquire semantics. */
+    uint32_t value = *ptr;
+    _ReadWriteBarrier();
+    return value;
+#else
+    return (uint32_t)_InterlockedOr((volatile long*)ptr, 0);
+#endif
+}
+
+static STHREAD_INLINE void satomic_store(volatile uint32_t *ptr, uint32_t value)
+{
+#if defined(STHREAD_ATOMIC_GNUC)
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#elif defined(STHREAD_ATOMIC_MSVC_X86)
+    _ReadWriteBarrier();
+    *ptr = value;
+#else
+    _InterlockedExchange((volatile long*)ptr, (long)value);
+#endif
+}
+
+/* Returns the value before adding @value. */
+static STHREAD_INLINE uint32_t satomic_fetch_add(volatile uint32_t *ptr,
+      uint32_t value)
+{
+#if defined(STHREAD_ATOMIC_GNUC)
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+#else
+    return (uint32_t)_InterlockedExchangeAdd((volatile long*)ptr, (long)value);
+#endif
+}
+
+/* Sets *@ptr to @desired if it is *@expected. Otherwise sets *@expected
+ * to the value found and returns false (0). */
+static STHREAD_INLINE bool satomic_compare_exchange(volatile uint32_t *ptr,
+      uint32_t *expected, uint32_t desired)
+{
+#if defined(STHREAD_ATOMIC_GNUC)
+    return __atomic_compare_exchange_n(ptr, expected, desired, false,
+          __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    uint32_t found = (uint32_t)_InterlockedCompareExchange(
+          (volatile long*)ptr, (long)desired, (long)*expected);
+    if (found == *expected)
+        return true;
+    *expected = found;
+    return false;
+#endif
+}
+
+static STHREAD_INLINE void satomic_fence(void)
+{
+#if defined(STHREAD_ATOMIC_GNUC)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#else
+    long dummy = 0;
+    _InterlockedOr(&dummy, 0);
+#endif
+}
+
+/* Hint to the CPU that the caller is spinning on a shared value. */
+static STHREAD_INLINE void satomic_pause(void)
+{
+#if defined(STHREAD_ATOMIC_GNUC) && (defined(__i386__) || defined(__x86_64__))
+    __builtin_ia32_pause();
+#elif defined(STHREAD_ATOMIC_MSVC_X86)
+    _mm_pause();
+#endif
+}
+
+/* Bounded queues of pointers for handing work from one thread to
+ * another without locking. spsc_queue_t has a single producer and a
+ * single consumer; mpsc_queue_t any number of producers and a single
+ * consumer. Pushing and popping never block: push fails when the
+ * queue is full and pop when it is empty. A queue created with
+ * @blocking set also lets the consumer sleep until something is
+ * pushed, at the cost of a full barrier on each push. */
+typedef struct spsc_queue spsc_queue_t;
+typedef struct mpsc_queue mpsc_queue_t;
+
+/**
+ * spsc_queue_new:
+ * @capacity                : minimum number of items the queue holds,
+ *                            rounded up to a power of two
+ * @blocking                : whether spsc_queue_pop_wait() may block
+ *
+ * Create a single producer, single consumer queue. Must be manually
+ * freed.
+ *
+ * Returns: pointer to new queue if successful, otherwise NULL.
+ */
+spsc_queue_t *spsc_queue_new(unsigned capacity, bool blocking);
+
+/**
+ * spsc_queue_free:
+ * @queue                   : pointer to queue object
+ *
+ * Frees a queue. Items still in it are not freed.
+ */
+void spsc_queue_free(spsc_queue_t *queue);
+
+/**
+ * spsc_queue_push:
+ * @queue                   : pointer to queue object
+ * @item                    : item to add
+ *
+ * Add an item to the queue. Only one thread may push to the queue.
+ *
+ * Returns: true (1) if the item was added, false (0) if the queue is
+ * full.
+ */
+bool spsc_queue_push(spsc_queue_t *queue, void *item);
+
+/**
+ * spsc_queue_pop:
+ * @queue                   : pointer to queue object
+ * @item                    : set to the item removed
+ *
+ * Remove the oldest item from the queue. Only one thread may pop
+ * from the queue.
+ *
+ * Returns: true (1) if an item was removed, false (0) if the queue is
+ * empty.
+ */
+bool spsc_queue_pop(spsc_queue_t *queue, void **item);
+
+/**
+ * spsc_queue_pop_wait:
+ * @queue                   : pointer to queue object
+ * @item                    : set to the item removed
+ * @timeout_us              : longest time to wait (in microseconds),
+ *                            or negative to wait for as long as it takes
+ *
+ * As spsc_queue_pop(), but if the queue is empty, spin briefly and then
+ * sleep until an item is pushed or @timeout_us elapses. A queue not
+ * created with @blocking set only spins.
+ *
+ * Returns: true (1) if an item was removed, false (0) on timeout.
+ */
+bool spsc_queue_pop_wait(spsc_queue_t *queue, void **item,
+      int64_t timeout_us);
+
+/**
+ * mpsc_queue_new:
+ * @capacity                : minimum number of items the queue holds,
+ *                            rounded up to a power of two
+ * @blocking                : whether mpsc_queue_pop_wait() may block
+ *
+ * Create a multiple producer, single consumer queue. Must be manually
+ * freed.
+ *
+ * Returns: pointer to new queue if successful, otherwise NULL.
+ */
+mpsc_queue_t *mpsc_queue_new(unsigned capacity, bool blocking);
+
+/**
+ * mpsc_queue_free:
+ * @queue                   : pointer to queue object
+ *
+ * Frees a queue. Items still in it are not freed.
+ */
+void mpsc_queue_free(mpsc_queue_t *queue);
+
+/**
+ * mpsc_queue_push:
+ * @queue                   : pointer to queue object
+ * @item                    : item to add
+ *
+ * Add an item to the queue. Any number of threads may push at once.
+ *
+ * Returns: true (1) if the item was added, false (0) if the queue is
+ * full.
+ */
+bool mpsc_queue_push(mpsc_queue_t *queue, void *item);
+
+/**
+ * mpsc_queue_pop:
+ * @queue                   : pointer to queue object
+ * @item                    : set to the item removed
+ *
+ * Remove the oldest item from the queue. Only one thread may pop
+ * from the queue.
+ *
+ * Returns: true (1) if an item was removed, false (0) if the queue is
+ * empty.
+ */
+bool mpsc_queue_pop(mpsc_queue_t *queue, void **item);
+
+/**
+ * mpsc_queue_pop_wait:
+ * @queue                   : pointer to queue object
+ * @item                    : set to the item removed
+ * @timeout_us              : longest time to wait (in microseconds),
+ *                            or negative to wait for as long as it takes
+ *
+ * As spsc_queue_pop_wait(), for an mpsc_queue_t.
+ *
+ * Returns: true (1) if an item was removed, false (0) on timeout.
+ */
+bool mpsc_queue_pop_wait(mpsc_queue_t *queue, void **item,
+      int64_t timeout_us);
+
 #ifdef __cplusplus
 }
 #endif
@@ -187,18 +591,35 @@ void scond_signal(scond_t *cond);
 
 /* with RETRO_WIN32_USE_PTHREADS, pthreads can be used even on win32. Maybe only supported in MSVC>=2005  */
 #define WIN32_LEAN_AND_MEAN
+/* Vista and later have slim reader/writer locks and condition variables,
+ * which lock, unlock, signal and wait without entering the kernel unless
+ * a thread actually has to block. Define _WIN32_WINNT below 0x0600 to
+ * build for older versions, with critical sections and the condition
+ * variable emulation below instead. */
 #ifndef _WIN32_WINNT
-#define _WIN32_WINNT 0x0500 /*_WIN32_WINNT_WIN2K */
+#define _WIN32_WINNT 0x0600 /*_WIN32_WINNT_VISTA */
+#endif
+#if _WIN32_WINNT >= 0x0600
+#define STHREAD_WIN32_SRW 1
 #endif
 #include <windows.h>
 #include <mmsystem.h>
+#include <stdlib.h>
+#include <string.h>
 
 struct thread_data
 {
     void(*func)(void*);
     void *userdata;
+    bool pro_audio;
 };
 
+typedef HANDLE (WINAPI *sthread_av_set_mm_thread_characteristics_t)(
+      LPCWSTR, LPDWORD);
+typedef BOOL (WINAPI *sthread_av_revert_mm_thread_characteristics_t)(
+      HANDLE);
+typedef HRESULT (WINAPI *sthread_set_thread_description_t)(HANDLE, PCWSTR);
+
 struct sthread
 {
     HANDLE thread;
@@ -206,9 +627,19 @@ struct sthread
 
 struct slock
 {
+#ifdef STHREAD_WIN32_SRW
+    SRWLOCK lock;
+#else
     CRITICAL_SECTION lock;
+#endif
 };
 
+#ifdef STHREAD_WIN32_SRW
+struct scond
+{
+    CONDITION_VARIABLE cond;
+};
+#else
 /* The syntax we'll use is mind-bending unless we use a struct. Plus, we might want to store more info later */
 /* This will be used as a linked list immplementing a queue of waiting threads */
 struct QueueEntry
@@ -243,17 +674,88 @@ struct scond
     /* used to control access to this scond, in case the user fails */
     CRITICAL_SECTION cs;
 };
+#endif
 
 static DWORD CALLBACK thread_wrap(void *data_)
 {
+    HMODULE avrt             = NULL;
+    HANDLE mmcss             = NULL;
     struct thread_data *data = (struct thread_data*)data_;
     if (!data)
         return 0;
+
+    /* avrt.dll is loaded here rather than linked so that nothing
+     * else needs it. */
+    if (data->pro_audio && (avrt = LoadLibraryA("avrt.dll")))
+    {
+        sthread_av_set_mm_thread_characteristics_t set =
+            (sthread_av_set_mm_thread_characteristics_t)
+            GetProcAddress(avrt, "AvSetMmThreadCharacteristicsW");
+        DWORD task_index = 0;
+        if (set)
+            mmcss = set(L"Pro Audio", &task_index);
+    }
+
     data->func(data->userdata);
+
+    if (mmcss)
+    {
+        sthread_av_revert_mm_thread_characteristics_t revert =
+            (sthread_av_revert_mm_thread_characteristics_t)
+            GetProcAddress(avrt, "AvRevertMmThreadCharacteristics");
+        if (revert)
+            revert(mmcss);
+    }
+    if (avrt)
+        FreeLibrary(avrt);
     free(data);
     return 0;
 }
 
+static int sthread_win32_priority(enum sthread_priority priority)
+{
+    switch (priority)
+    {
+        case STHREAD_PRIORITY_LOWEST:
+            return THREAD_PRIORITY_LOWEST;
+        case STHREAD_PRIORITY_LOW:
+            return THREAD_PRIORITY_BELOW_NORMAL;
+        case STHREAD_PRIORITY_HIGH:
+            return THREAD_PRIORITY_ABOVE_NORMAL;
+        case STHREAD_PRIORITY_HIGHEST:
+            return THREAD_PRIORITY_HIGHEST;
+        case STHREAD_PRIORITY_TIME_CRITICAL:
+            return THREAD_PRIORITY_TIME_CRITICAL;
+        case STHREAD_PRIORITY_NORMAL:
+        default:
+            break;
+    }
+    return THREAD_PRIORITY_NORMAL;
+}
+
+/* SetThreadDescription() is only in Windows 10 1607 and later. */
+static void sthread_win32_set_name(HANDLE thread, const char *name)
+{
+    wchar_t *wname = NULL;
+    int len;
+    sthread_set_thread_description_t set_description =
+        (sthread_set_thread_description_t)GetProcAddress(
+              GetModuleHandleA("kernel32.dll"), "SetThreadDescription");
+
+    if (!set_description)
+        return;
+
+    len = MultiByteToWideChar(CP_UTF8, 0, name, -1, NULL, 0);
+    if (len <= 0)
+        return;
+    wname = (wchar_t*)malloc(len * sizeof(*wname));
+    if (!wname)
+        return;
+    if (MultiByteToWideChar(CP_UTF8, 0, name, -1, wname, len) == len)
+        set_description(thread, wname);
+    free(wname);
+}
+
 /**
  * sthread_create:
  * @start_routine           : thread entry callback function
@@ -265,27 +767,82 @@ static DWORD CALLBACK thread_wrap(void *data_)
  * Returns: pointer to new thread if successful, otherwise NULL.
  */
 sthread_t *sthread_create(void(*thread_func)(void*), void *userdata)
+{
+    return sthread_create_ex(thread_func, userdata, NULL);
+}
+
+/**
+ * sthread_attr_init:
+ * @attr                    : pointer to thread attributes
+ *
+ * Set @attr to the defaults: normal priority on any CPU, with the
+ * default stack size, no name and no MMCSS registration.
+ */
+void sthread_attr_init(struct sthread_attr *attr)
+{
+    attr->priority      = STHREAD_PRIORITY_NORMAL;
+    attr->affinity_mask = 0;
+    attr->stack_size    = 0;
+    attr->name          = NULL;
+    attr->pro_audio     = false;
+}
+
+/**
+ * sthread_create_ex:
+ * @start_routine           : thread entry callback function
+ * @userdata                : pointer to userdata that will be made
+ *                            available in thread entry callback function
+ * @attr                    : thread attributes, or NULL for the defaults
+ *
+ * Create a new thread as given by @attr. The thread does not start
+ * running until its priority and affinity have been set.
+ *
+ * Returns: pointer to new thread if successful, otherwise NULL.
+ */
+sthread_t *sthread_create_ex(void(*thread_func)(void*), void *userdata,
+      const struct sthread_attr *attr)
 {
     bool thread_created = false;
     struct thread_data *data = NULL;
+    struct sthread_attr defaults;
     sthread_t *thread = (sthread_t*)calloc(1, sizeof(*thread));
 
     if (!thread)
         return NULL;
 
+    if (!attr)
+    {
+        sthread_attr_init(&defaults);
+        attr = &defaults;
+    }
+
     data = (struct thread_data*)calloc(1, sizeof(*data));
     if (!data)
         goto error;
 
     data->func = thread_func;
     data->userdata = userdata;
+    data->pro_audio = attr->pro_audio;
 
-    thread->thread = CreateThread(NULL, 0, thread_wrap, data, 0, NULL);
+    thread->thread = CreateThread(NULL, attr->stack_size, thread_wrap, data,
+          CREATE_SUSPENDED
+          | (attr->stack_size ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0),
+          NULL);
     thread_created = !!thread->thread;
 
     if (!thread_created)
         goto error;
 
+    if (attr->priority != STHREAD_PRIORITY_NORMAL)
+        SetThreadPriority(thread->thread,
+              sthread_win32_priority(attr->priority));
+    if (attr->affinity_mask)
+        SetThreadAffinityMask(thread->thread,
+              (DWORD_PTR)attr->affinity_mask);
+    if (attr->name)
+        sthread_win32_set_name(thread->thread, attr->name);
+
+    ResumeThread(thread->thread);
     return thread;
 
 error:
@@ -344,6 +901,38 @@ bool sthread_isself(sthread_t *thread)
     return GetCurrentThread() == thread->thread;
 }
 
+/* Raise the system timer resolution to 1 ms, once, so that timed
+ * waits don't round up to the default 15.6 ms tick. winmm.dll is
+ * loaded here rather than linked so that nothing else needs it. */
+static void sthread_win32_timer_period(void)
+{
+    static volatile uint32_t done = 0;
+    uint32_t expected             = 0;
+    HMODULE winmm;
+
+    if (satomic_load(&done) ||
+          !satomic_compare_exchange(&done, &expected, 1))
+        return;
+
+    winmm = LoadLibraryA("winmm.dll");
+    if (winmm)
+    {
+        typedef UINT (WINAPI *time_begin_period_t)(UINT);
+        time_begin_period_t time_begin_period = (time_begin_period_t)
+            GetProcAddress(winmm, "timeBeginPeriod");
+        if (time_begin_period)
+            time_begin_period(1);
+        /* winmm.dll stays loaded for as long as the period is in use. */
+    }
+}
+
+static unsigned sthread_cpu_count(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? info.dwNumberOfProcessors : 1;
+}
+
 /**
  * slock_new:
  *
@@ -358,7 +947,11 @@ slock_t *slock_new(void)
     slock_t      *lock = (slock_t*)calloc(1, sizeof(*lock));
     if (!lock)
         return NULL;
+#ifdef STHREAD_WIN32_SRW
+    InitializeSRWLock(&lock->lock);
+#else
     InitializeCriticalSection(&lock->lock);
+#endif
     mutex_created = true;
 
     if (!mutex_created)
@@ -381,7 +974,9 @@ void slock_free(slock_t *lock)
 {
     if (!lock)
         return;
+#ifndef STHREAD_WIN32_SRW
     DeleteCriticalSection(&lock->lock);
+#endif
     free(lock);
 }
 
@@ -397,7 +992,11 @@ void slock_lock(slock_t *lock)
 {
     if (!lock)
         return;
+#ifdef STHREAD_WIN32_SRW
+    AcquireSRWLockExclusive(&lock->lock);
+#else
     EnterCriticalSection(&lock->lock);
+#endif
 }
 
 /**
@@ -410,7 +1009,11 @@ void slock_unlock(slock_t *lock)
 {
     if (!lock)
         return;
+#ifdef STHREAD_WIN32_SRW
+    ReleaseSRWLockExclusive(&lock->lock);
+#else
     LeaveCriticalSection(&lock->lock);
+#endif
 }
 
 /**
@@ -428,6 +1031,10 @@ scond_t *scond_new(void)
 
     if (!cond)
         return NULL;
+#ifdef STHREAD_WIN32_SRW
+    InitializeConditionVariable(&cond->cond);
+    return cond;
+#else
     /* This is very complex because recreating condition variable semantics
      * with Win32 parts is not easy.
      *
@@ -471,6 +1078,7 @@ scond_t *scond_new(void)
 error:
     free(cond);
     return NULL;
+#endif
 }
 
 /**
@@ -483,12 +1091,24 @@ void scond_free(scond_t *cond)
 {
     if (!cond)
         return;
+#ifndef STHREAD_WIN32_SRW
     CloseHandle(cond->event);
     CloseHandle(cond->hot_potato);
     DeleteCriticalSection(&cond->cs);
+#endif
     free(cond);
 }
 
+#ifdef STHREAD_WIN32_SRW
+static bool _scond_wait_win32(scond_t *cond, slock_t *lock, DWORD dwMilliseconds)
+{
+    if (dwMilliseconds != INFINITE)
+        sthread_win32_timer_period();
+    /* Fails with ERROR_TIMEOUT when the time runs out. */
+    return SleepConditionVariableSRW(&cond->cond, &lock->lock,
+          dwMilliseconds, 0) != 0;
+}
+#else
 static bool _scond_wait_win32(scond_t *cond, slock_t *lock, DWORD dwMilliseconds)
 {
     struct QueueEntry myentry;
@@ -695,6 +1315,7 @@ static bool _scond_wait_win32(scond_t *cond, slock_t *lock, DWORD dwMilliseconds
     LeaveCriticalSection(&cond->cs);
     return true;
 }
+#endif
 
 
 /**
@@ -718,6 +1339,10 @@ void scond_wait(scond_t *cond, slock_t *lock)
  **/
 int scond_broadcast(scond_t *cond)
 {
+#ifdef STHREAD_WIN32_SRW
+    WakeAllConditionVariable(&cond->cond);
+    return 0;
+#else
     /* remember: we currently have mutex */
     if (cond->waiters == 0)
         return 0;
@@ -731,6 +1356,7 @@ int scond_broadcast(scond_t *cond)
     SetEvent(cond->hot_potato);
 
     return 0;
+#endif
 }
 
 /**
@@ -742,6 +1368,9 @@ int scond_broadcast(scond_t *cond)
  **/
 void scond_signal(scond_t *cond)
 {
+#ifdef STHREAD_WIN32_SRW
+    WakeConditionVariable(&cond->cond);
+#else
     /* Unfortunately, pthread_cond_signal does not require that the
      * lock be held in advance */
      /* To avoid stomping on the condvar from other threads, we need
@@ -771,6 +1400,7 @@ void scond_signal(scond_t *cond)
 
     /* Since there is now at least one pending waken, the potato must be in play */
     SetEvent(cond->hot_potato);
+#endif
 }
 
 /**
@@ -812,5 +1442,912 @@ bool scond_wait_timeout(scond_t *cond, slock_t *lock, int64_t timeout_us)
     return _scond_wait_win32(cond, lock, dwMilliseconds);
 }
 
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+/* How long before a deadline sthread_sleep_until() stops sleeping and
+ * starts spinning, with and without high resolution timers. */
+#define STHREAD_SPIN_US_HIGH_RES 500
+#define STHREAD_SPIN_US_LOW_RES  2000
+
+/* 1 if high resolution waitable timers (Windows 10 1803 and later)
+ * work, 2 if not, 0 until the first sleep finds out. */
+static volatile uint32_t sthread_win32_high_res = 0;
+
+/**
+ * sthread_clock_us:
+ *
+ * Returns: the time in microseconds on a clock that never jumps or
+ * runs backwards, from an arbitrary starting point.
+ */
+int64_t sthread_clock_us(void)
+{
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER now;
+
+    if (!frequency.QuadPart)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+
+    /* Split to keep the multiplication from overflowing. */
+    return (now.QuadPart / frequency.QuadPart) * 1000000
+        + (now.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+}
+
+static HANDLE sthread_win32_create_timer(void)
+{
+#ifdef STHREAD_WIN32_SRW
+    if (satomic_load(&sthread_win32_high_res) != 2)
+    {
+        HANDLE timer = CreateWaitableTimerExW(NULL, NULL,
+              CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        satomic_store(&sthread_win32_high_res, timer ? 1 : 2);
+        if (timer)
+            return timer;
+    }
+#else
+    satomic_store(&sthread_win32_high_res, 2);
+#endif
+
+    sthread_win32_timer_period();
+    return CreateWaitableTimer(NULL, TRUE, NULL);
+}
+
+/**
+ * sthread_sleep_us:
+ * @us                      : time to sleep (in microseconds)
+ *
+ * Sleep for at least @us, on a high resolution timer where the system
+ * has one. Wakes up no more than about a millisecond late at worst.
+ */
+void sthread_sleep_us(int64_t us)
+{
+    HANDLE timer;
+    LARGE_INTEGER due;
+
+    if (us <= 0)
+        return;
+
+    timer = sthread_win32_create_timer();
+    if (!timer)
+    {
+        Sleep((DWORD)((us + 999) / 1000));
+        return;
+    }
+
+    /* Negative for a time relative to now, in 100 ns units. */
+    due.QuadPart = -us * 10;
+    if (SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE))
+        WaitForSingleObject(timer, INFINITE);
+    CloseHandle(timer);
+}
+
+/**
+ * sthread_sleep_until:
+ * @deadline_us             : time to wake up, on sthread_clock_us()
+ *
+ * Sleep until shortly before @deadline_us, then spin until it is
+ * reached, for pacing that is accurate to a few microseconds. Costs a
+ * little CPU time at the end of each sleep; use sthread_sleep_us()
+ * where that accuracy isn't needed.
+ */
+void sthread_sleep_until(int64_t deadline_us)
+{
+    int64_t remaining = deadline_us - sthread_clock_us();
+    int64_t spin;
+
+    if (remaining <= 0)
+        return;
+
+    /* Find out which kind of timer there is before deciding. */
+    if (!satomic_load(&sthread_win32_high_res))
+        CloseHandle(sthread_win32_create_timer());
+
+    spin = satomic_load(&sthread_win32_high_res) == 1
+        ? STHREAD_SPIN_US_HIGH_RES : STHREAD_SPIN_US_LOW_RES;
+    if (remaining > spin)
+        sthread_sleep_us(remaining - spin);
+
+    while (sthread_clock_us() < deadline_us)
+        satomic_pause();
+}
+
+#if defined(_MSC_VER)
+#define STHREAD_POOL_TLS __declspec(thread)
+#else
+#define STHREAD_POOL_TLS __thread
+#endif
+
+struct sthread_pool_task
+{
+    void (*func)(void*);
+    void *userdata;
+    sthread_wait_group_t *group;
+};
+
+/* A ring of tasks, added at tail. The worker that owns it takes them
+ * back from tail, newest first while their data is likely still in its
+ * cache; everyone else takes them from head, oldest first. */
+struct sthread_pool_queue
+{
+    slock_t *lock;
+    struct sthread_pool_task *tasks;
+    unsigned capacity; /* always a power of two */
+    unsigned head;
+    unsigned tail;
+};
+
+struct sthread_pool_worker
+{
+    sthread_pool_t *pool;
+    sthread_t *thread;
+    unsigned index;
+};
+
+struct sthread_pool
+{
+    /* One queue for each worker, then one for tasks submitted from
+     * other threads. */
+    struct sthread_pool_queue *queues;
+    struct sthread_pool_worker *workers;
+    unsigned num_threads;
+
+    /* lock guards the rest. epoch changes whenever a task is queued or
+     * a wait group's count reaches zero, and threads that find nothing
+     * to run sleep on cond until it does. */
+    slock_t *lock;
+    scond_t *cond;
+    unsigned epoch;
+    unsigned sleepers;
+    bool shutdown;
+};
+
+struct sthread_wait_group
+{
+    slock_t *lock;
+    unsigned count;
+};
+
+/* The worker the calling thread is, if it is one. */
+static STHREAD_POOL_TLS struct sthread_pool_worker *sthread_pool_self = NULL;
+
+static bool sthread_pool_queue_init(struct sthread_pool_queue *queue)
+{
+    queue->capacity = 64;
+    queue->head     = 0;
+    queue->tail     = 0;
+    queue->lock     = slock_new();
+    queue->tasks    = (struct sthread_pool_task*)
+        malloc(queue->capacity * sizeof(*queue->tasks));
+    return queue->lock && queue->tasks;
+}
+
+static void sthread_pool_queue_deinit(struct sthread_pool_queue *queue)
+{
+    slock_free(queue->lock);
+    free(queue->tasks);
+}
+
+static bool sthread_pool_queue_push(struct sthread_pool_queue *queue,
+      const struct sthread_pool_task *task)
+{
+    slock_lock(queue->lock);
+
+    if (queue->tail - queue->head == queue->capacity)
+    {
+        unsigned i;
+        struct sthread_pool_task *tasks = (struct sthread_pool_task*)
+            malloc(queue->capacity * 2 * sizeof(*tasks));
+
+        if (!tasks)
+        {
+            slock_unlock(queue->lock);
+            return false;
+        }
+
+        for (i = 0; i < queue->capacity; i++)
+            tasks[i] = queue->tasks[(queue->head + i) & (queue->capacity - 1)];
+        free(queue->tasks);
+        queue->tasks     = tasks;
+        queue->head      = 0;
+        queue->tail      = queue->capacity;
+        queue->capacity *= 2;
+    }
+
+    queue->tasks[queue->tail++ & (queue->capacity - 1)] = *task;
+    slock_unlock(queue->lock);
+    return true;
+}
+
+static bool sthread_pool_queue_take(struct sthread_pool_queue *queue,
+      struct sthread_pool_task *task, bool newest)
+{
+    bool taken = false;
+
+    slock_lock(queue->lock);
+    if (queue->head != queue->tail)
+    {
+        if (newest)
+            *task = queue->tasks[--queue->tail & (queue->capacity - 1)];
+        else
+            *task = queue->tasks[queue->head++ & (queue->capacity - 1)];
+        taken = true;
+    }
+    slock_unlock(queue->lock);
+    return taken;
+}
+
+/* The queue a task submitted from the calling thread goes on. */
+static unsigned sthread_pool_self_index(sthread_pool_t *pool)
+{
+    struct sthread_pool_worker *self = sthread_pool_self;
+    if (self && self->pool == pool)
+        return self->index;
+    return pool->num_threads;
+}
+
+/* Find a task to run: from the calling worker's own queue, else from
+ * the others in turn, starting after its own. */
+static bool sthread_pool_take(sthread_pool_t *pool, unsigned self,
+      struct sthread_pool_task *task)
+{
+    unsigned i;
+    unsigned queues = pool->num_threads + 1;
+    unsigned first  = self;
+    unsigned count  = queues;
+
+    if (self < pool->num_threads)
+    {
+        if (sthread_pool_queue_take(&pool->queues[self], task, true))
+            return true;
+        first = self + 1;
+        count = queues - 1;
+    }
+
+    for (i = 0; i < count; i++)
+        if (sthread_pool_queue_take(&pool->queues[(first + i) % queues],
+                 task, false))
+            return true;
+
+    return false;
+}
+
+static unsigned sthread_pool_epoch(sthread_pool_t *pool)
+{
+    unsigned epoch;
+    slock_lock(pool->lock);
+    epoch = pool->epoch;
+    slock_unlock(pool->lock);
+    return epoch;
+}
+
+static void sthread_pool_wake(sthread_pool_t *pool, bool all)
+{
+    slock_lock(pool->lock);
+    pool->epoch++;
+    if (pool->sleepers)
+    {
+        if (all)
+            scond_broadcast(pool->cond);
+        else
+            scond_signal(pool->cond);
+    }
+    slock_unlock(pool->lock);
+}
+
+/* Sleep until epoch changes, having found nothing to run since reading
+ * it. Returns true if the pool is shutting down. */
+static bool sthread_pool_sleep(sthread_pool_t *pool, unsigned epoch)
+{
+    bool shutdown;
+
+    slock_lock(pool->lock);
+    while (pool->epoch == epoch && !pool->shutdown)
+    {
+        pool->sleepers++;
+        scond_wait(pool->cond, pool->lock);
+        pool->sleepers--;
+    }
+    shutdown = pool->shutdown;
+    slock_unlock(pool->lock);
+    return shutdown;
+}
+
+static void sthread_wait_group_done(sthread_pool_t *pool,
+      sthread_wait_group_t *group)
+{
+    bool done;
+
+    slock_lock(group->lock);
+    done = --group->count == 0;
+    slock_unlock(group->lock);
+
+    if (done && pool)
+        sthread_pool_wake(pool, true);
+}
+
+static void sthread_pool_run(sthread_pool_t *pool,
+      const struct sthread_pool_task *task)
+{
+    task->func(task->userdata);
+    if (task->group)
+        sthread_wait_group_done(pool, task->group);
+}
+
+static void sthread_pool_worker_main(void *data)
+{
+    struct sthread_pool_worker *worker = (struct sthread_pool_worker*)data;
+    sthread_pool_t *pool               = worker->pool;
+    bool shutdown                      = false;
+    struct sthread_pool_task task;
+
+    sthread_pool_self = worker;
+
+    for (;;)
+    {
+        unsigned epoch;
+
+        if (sthread_pool_take(pool, worker->index, &task))
+        {
+            sthread_pool_run(pool, &task);
+            continue;
+        }
+
+        /* Once shutting down, stop when there is nothing left to run. */
+        if (shutdown)
+            break;
+
+        /* Look once more after reading epoch, so that a task queued
+         * in between is either found now or changes epoch. */
+        epoch = sthread_pool_epoch(pool);
+        if (sthread_pool_take(pool, worker->index, &task))
+        {
+            sthread_pool_run(pool, &task);
+            continue;
+        }
+
+        shutdown = sthread_pool_sleep(pool, epoch);
+    }
+
+    sthread_pool_self = NULL;
+}
+
+/**
+ * sthread_pool_new:
+ * @num_threads             : number of worker threads, or 0 for one
+ *                            per CPU
+ *
+ * Create a thread pool and start its worker threads.
+ *
+ * Returns: pointer to new thread pool if successful, otherwise NULL.
+ */
+sthread_pool_t *sthread_pool_new(unsigned num_threads)
+{
+    unsigned i;
+    sthread_pool_t *pool = (sthread_pool_t*)calloc(1, sizeof(*pool));
+
+    if (!pool)
+        return NULL;
+
+    pool->lock = slock_new();
+    pool->cond = scond_new();
+    if (!pool->lock || !pool->cond)
+    {
+        slock_free(pool->lock);
+        scond_free(pool->cond);
+        free(pool);
+        return NULL;
+    }
+
+    pool->num_threads = num_threads ? num_threads : sthread_cpu_count();
+    pool->queues      = (struct sthread_pool_queue*)
+        calloc(pool->num_threads + 1, sizeof(*pool->queues));
+    pool->workers     = (struct sthread_pool_worker*)
+        calloc(pool->num_threads, sizeof(*pool->workers));
+    if (!pool->queues || !pool->workers)
+        goto error;
+
+    for (i = 0; i <= pool->num_threads; i++)
+        if (!sthread_pool_queue_init(&pool->queues[i]))
+            goto error;
+
+    for (i = 0; i < pool->num_threads; i++)
+    {
+        pool->workers[i].pool   = pool;
+        pool->workers[i].index  = i;
+        pool->workers[i].thread = sthread_create(sthread_pool_worker_main,
+              &pool->workers[i]);
+        if (!pool->workers[i].thread)
+            goto error;
+    }
+
+    return pool;
+
+error:
+    sthread_pool_free(pool);
+    return NULL;
+}
+
+/**
+ * sthread_pool_free:
+ * @pool                    : pointer to thread pool object
+ *
+ * Run any tasks still queued, then stop the worker threads and free
+ * the pool. No tasks may be submitted once this has been called.
+ */
+void sthread_pool_free(sthread_pool_t *pool)
+{
+    unsigned i;
+
+    if (!pool)
+        return;
+
+    slock_lock(pool->lock);
+    pool->shutdown = true;
+    scond_broadcast(pool->cond);
+    slock_unlock(pool->lock);
+
+    if (pool->workers)
+        for (i = 0; i < pool->num_threads; i++)
+            if (pool->workers[i].thread)
+                sthread_join(pool->workers[i].thread);
+
+    if (pool->queues)
+        for (i = 0; i <= pool->num_threads; i++)
+            sthread_pool_queue_deinit(&pool->queues[i]);
+
+    free(pool->workers);
+    free(pool->queues);
+    scond_free(pool->cond);
+    slock_free(pool->lock);
+    free(pool);
+}
+
+/**
+ * sthread_pool_num_threads:
+ * @pool                    : pointer to thread pool object
+ *
+ * Returns: the number of worker threads in @pool.
+ */
+unsigned sthread_pool_num_threads(sthread_pool_t *pool)
+{
+    return pool->num_threads;
+}
+
+/**
+ * sthread_pool_submit:
+ * @pool                    : pointer to thread pool object
+ * @func                    : task callback function
+ * @userdata                : pointer to userdata passed to @func
+ * @group                   : wait group to count the task in, or NULL
+ *
+ * Queue a call of @func(@userdata) on one of the worker threads. May
+ * be called from any thread, including from within a task. If @pool
+ * is NULL, @func is called on the calling thread before returning.
+ *
+ * Returns: true (1) if the task was queued or run, false (0) if
+ * memory for it could not be allocated.
+ */
+bool sthread_pool_submit(sthread_pool_t *pool, void (*func)(void*),
+      void *userdata, sthread_wait_group_t *group)
+{
+    struct sthread_pool_task task;
+
+    if (!pool)
+    {
+        func(userdata);
+        return true;
+    }
+
+    task.func     = func;
+    task.userdata = userdata;
+    task.group    = group;
+
+    if (group)
+    {
+        slock_lock(group->lock);
+        group->count++;
+        slock_unlock(group->lock);
+    }
+
+    if (!sthread_pool_queue_push(
+             &pool->queues[sthread_pool_self_index(pool)], &task))
+    {
+        if (group)
+            sthread_wait_group_done(pool, group);
+        return false;
+    }
+
+    sthread_pool_wake(pool, false);
+    return true;
+}
+
+/**
+ * sthread_wait_group_new:
+ *
+ * Create a wait group with a count of zero. Must be manually freed.
+ *
+ * Returns: pointer to new wait group if successful, otherwise NULL.
+ */
+sthread_wait_group_t *sthread_wait_group_new(void)
+{
+    sthread_wait_group_t *group = (sthread_wait_group_t*)
+        calloc(1, sizeof(*group));
+
+    if (!group)
+        return NULL;
+
+    group->lock = slock_new();
+    if (!group->lock)
+    {
+        free(group);
+        return NULL;
+    }
+
+    return group;
+}
+
+/**
+ * sthread_wait_group_free:
+ * @group                   : pointer to wait group object
+ *
+ * Frees a wait group. Its tasks must all have finished.
+ */
+void sthread_wait_group_free(sthread_wait_group_t *group)
+{
+    if (!group)
+        return;
+    slock_free(group->lock);
+    free(group);
+}
+
+static unsigned sthread_wait_group_count(sthread_wait_group_t *group)
+{
+    unsigned count;
+    slock_lock(group->lock);
+    count = group->count;
+    slock_unlock(group->lock);
+    return count;
+}
+
+/**
+ * sthread_wait_group_wait:
+ * @pool                    : pointer to thread pool object the tasks
+ *                            were submitted to
+ * @group                   : pointer to wait group object
+ *
+ * Wait until every task submitted with @group has finished. While
+ * waiting, the calling thread runs queued tasks from @pool (whether in
+ * @group or not) instead of blocking, so this may safely be called
+ * from within a task.
+ */
+void sthread_wait_group_wait(sthread_pool_t *pool,
+      sthread_wait_group_t *group)
+{
+    unsigned self;
+    struct sthread_pool_task task;
+
+    if (!pool)
+        return;
+
+    self = sthread_pool_self_index(pool);
+
+    for (;;)
+    {
+        unsigned epoch;
+
+        if (!sthread_wait_group_count(group))
+            return;
+
+        if (sthread_pool_take(pool, self, &task))
+        {
+            sthread_pool_run(pool, &task);
+            continue;
+        }
+
+        /* As in sthread_pool_worker_main(), except that the count
+         * reaching zero also changes epoch. */
+        epoch = sthread_pool_epoch(pool);
+        if (!sthread_wait_group_count(group))
+            return;
+
+        if (sthread_pool_take(pool, self, &task))
+        {
+            sthread_pool_run(pool, &task);
+            continue;
+        }
+
+        sthread_pool_sleep(pool, epoch);
+    }
+}
+
+/* Keeps the fields written by the producers and by the consumer on
+ * separate cache lines. */
+#define SQUEUE_CACHE_LINE 64
+
+/* Lets the consumer of a blocking queue sleep while it is empty.
+ * waiting is set while it might be asleep; a producer that sees it
+ * after pushing takes the lock to wake it. */
+struct squeue_waiter
+{
+    slock_t *lock;
+    scond_t *cond;
+    volatile uint32_t waiting;
+};
+
+static unsigned squeue_capacity(unsigned capacity)
+{
+    unsigned size = 2;
+    while (size < capacity)
+        size <<= 1;
+    return size;
+}
+
+static bool squeue_waiter_init(struct squeue_waiter *waiter, bool blocking)
+{
+    if (!blocking)
+        return true;
+    waiter->lock = slock_new();
+    waiter->cond = scond_new();
+    return waiter->lock && waiter->cond;
+}
+
+static void squeue_waiter_deinit(struct squeue_waiter *waiter)
+{
+    slock_free(waiter->lock);
+    scond_free(waiter->cond);
+}
+
+static void squeue_waiter_notify(struct squeue_waiter *waiter)
+{
+    if (!waiter->lock)
+        return;
+
+    /* The push must be visible before waiting is read again, or the
+     * consumer could check the queue and go to sleep in between. */
+    satomic_fence();
+    if (satomic_load(&waiter->waiting))
+    {
+        slock_lock(waiter->lock);
+        scond_signal(waiter->cond);
+        slock_unlock(waiter->lock);
+    }
+}
+
+/* The part of pop_wait common to both kinds of queue. */
+static bool squeue_pop_wait(void *queue, bool (*pop)(void*, void**),
+      struct squeue_waiter *waiter, void **item, int64_t timeout_us)
+{
+    unsigned i;
+    bool popped;
+
+    for (i = 0; i < 64; i++)
+    {
+        if (pop(queue, item))
+            return true;
+        satomic_pause();
+    }
+
+    if (!waiter->lock)
+        return pop(queue, item);
+
+    slock_lock(waiter->lock);
+    satomic_store(&waiter->waiting, 1);
+    satomic_fence();
+    while (!(popped = pop(queue, item)))
+    {
+        if (timeout_us < 0)
+            scond_wait(waiter->cond, waiter->lock);
+        else
+        {
+            scond_wait_timeout(waiter->cond, waiter->lock, timeout_us);
+            popped = pop(queue, item);
+            break;
+        }
+    }
+    satomic_store(&waiter->waiting, 0);
+    slock_unlock(waiter->lock);
+    return popped;
+}
+
+/* tail is written only by the producer and head only by the consumer.
+ * Each keeps a copy of the other's index, and reads the real one only
+ * when its copy says the queue is full or empty. */
+struct spsc_queue
+{
+    void **items;
+    uint32_t mask;
+    struct squeue_waiter waiter;
+    char pad0[SQUEUE_CACHE_LINE];
+    volatile uint32_t tail;
+    uint32_t head_cache;
+    char pad1[SQUEUE_CACHE_LINE - 2 * sizeof(uint32_t)];
+    volatile uint32_t head;
+    uint32_t tail_cache;
+    char pad2[SQUEUE_CACHE_LINE - 2 * sizeof(uint32_t)];
+};
+
+spsc_queue_t *spsc_queue_new(unsigned capacity, bool blocking)
+{
+    spsc_queue_t *queue = (spsc_queue_t*)calloc(1, sizeof(*queue));
+
+    if (!queue)
+        return NULL;
+
+    capacity     = squeue_capacity(capacity);
+    queue->mask  = capacity - 1;
+    queue->items = (void**)malloc(capacity * sizeof(*queue->items));
+    if (!queue->items || !squeue_waiter_init(&queue->waiter, blocking))
+    {
+        spsc_queue_free(queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+void spsc_queue_free(spsc_queue_t *queue)
+{
+    if (!queue)
+        return;
+    squeue_waiter_deinit(&queue->waiter);
+    free(queue->items);
+    free(queue);
+}
+
+bool spsc_queue_push(spsc_queue_t *queue, void *item)
+{
+    uint32_t tail = queue->tail;
+
+    if (tail - queue->head_cache > queue->mask)
+    {
+        queue->head_cache = satomic_load(&queue->head);
+        if (tail - queue->head_cache > queue->mask)
+            return false;
+    }
+
+    queue->items[tail & queue->mask] = item;
+    satomic_store(&queue->tail, tail + 1);
+    squeue_waiter_notify(&queue->waiter);
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue_t *queue, void **item)
+{
+    uint32_t head = queue->head;
+
+    if (head == queue->tail_cache)
+    {
+        queue->tail_cache = satomic_load(&queue->tail);
+        if (head == queue->tail_cache)
+            return false;
+    }
+
+    *item = queue->items[head & queue->mask];
+    satomic_store(&queue->head, head + 1);
+    return true;
+}
+
+static bool spsc_queue_pop_any(void *queue, void **item)
+{
+    return spsc_queue_pop((spsc_queue_t*)queue, item);
+}
+
+bool spsc_queue_pop_wait(spsc_queue_t *queue, void **item,
+      int64_t timeout_us)
+{
+    return squeue_pop_wait(queue, spsc_queue_pop_any, &queue->waiter,
+          item, timeout_us);
+}
+
+/* Each slot has a sequence number saying whose turn it is: equal to
+ * the position a producer would fill it at when it is free, and one
+ * more once it is filled. Producers claim positions by advancing tail,
+ * and the consumer hands the slot on to the position a lap later. */
+struct mpsc_slot
+{
+    volatile uint32_t sequence;
+    void *item;
+};
+
+struct mpsc_queue
+{
+    struct mpsc_slot *slots;
+    uint32_t mask;
+    struct squeue_waiter waiter;
+    char pad0[SQUEUE_CACHE_LINE];
+    volatile uint32_t tail;
+    char pad1[SQUEUE_CACHE_LINE - sizeof(uint32_t)];
+    uint32_t head;
+    char pad2[SQUEUE_CACHE_LINE - sizeof(uint32_t)];
+};
+
+mpsc_queue_t *mpsc_queue_new(unsigned capacity, bool blocking)
+{
+    unsigned i;
+    mpsc_queue_t *queue = (mpsc_queue_t*)calloc(1, sizeof(*queue));
+
+    if (!queue)
+        return NULL;
+
+    capacity     = squeue_capacity(capacity);
+    queue->mask  = capacity - 1;
+    queue->slots = (struct mpsc_slot*)malloc(capacity * sizeof(*queue->slots));
+    if (!queue->slots || !squeue_waiter_init(&queue->waiter, blocking))
+    {
+        mpsc_queue_free(queue);
+        return NULL;
+    }
+
+    for (i = 0; i < capacity; i++)
+        queue->slots[i].sequence = i;
+
+    return queue;
+}
+
+void mpsc_queue_free(mpsc_queue_t *queue)
+{
+    if (!queue)
+        return;
+    squeue_waiter_deinit(&queue->waiter);
+    free(queue->slots);
+    free(queue);
+}
+
+bool mpsc_queue_push(mpsc_queue_t *queue, void *item)
+{
+    struct mpsc_slot *slot;
+    uint32_t pos = satomic_load(&queue->tail);
+
+    for (;;)
+    {
+        int32_t diff;
+
+        slot = &queue->slots[pos & queue->mask];
+        diff = (int32_t)(satomic_load(&slot->sequence) - pos);
+        if (diff == 0)
+        {
+            if (satomic_compare_exchange(&queue->tail, &pos, pos + 1))
+                break;
+        }
+        else if (diff < 0)
+            return false; /* still holds the item from a lap ago */
+        else
+            pos = satomic_load(&queue->tail);
+    }
+
+    slot->item = item;
+    satomic_store(&slot->sequence, pos + 1);
+    squeue_waiter_notify(&queue->waiter);
+    return true;
+}
+
+bool mpsc_queue_pop(mpsc_queue_t *queue, void **item)
+{
+    uint32_t pos           = queue->head;
+    struct mpsc_slot *slot = &queue->slots[pos & queue->mask];
+
+    if ((int32_t)(satomic_load(&slot->sequence) - (pos + 1)) < 0)
+        return false;
+
+    *item = slot->item;
+    satomic_store(&slot->sequence, pos + queue->mask + 1);
+    queue->head = pos + 1;
+    return true;
+}
+
+static bool mpsc_queue_pop_any(void *queue, void **item)
+{
+    return mpsc_queue_pop((mpsc_queue_t*)queue, item);
+}
+
+bool mpsc_queue_pop_wait(mpsc_queue_t *queue, void **item,
+      int64_t timeout_us)
+{
+    return squeue_pop_wait(queue, mpsc_queue_pop_any, &queue->waiter,
+          item, timeout_us);
+}
+
 #endif
 #endif
\ No newline at end of file
@@ -12,7 +12,9 @@ RUBBERBAND_JNI_FILES := \
 
 RUBBERBAND_SRC_FILES := \
         $(RUBBERBAND_SRC_PATH)/base/Profiler.cpp \
+        $(RUBBERBAND_SRC_PATH)/base/Scavenger.cpp \
         $(RUBBERBAND_SRC_PATH)/system/Thread.cpp \
+        $(RUBBERBAND_SRC_PATH)/system/ThreadPool.cpp \
         $(RUBBERBAND_SRC_PATH)/system/Allocators.cpp \
         $(RUBBERBAND_SRC_PATH)/system/sysutils.cpp \
         $(RUBBERBAND_SRC_PATH)/system/VectorOpsComplex.cpp \
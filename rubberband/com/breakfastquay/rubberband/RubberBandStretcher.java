@@ -23,6 +23,8 @@
 
 package com.breakfastquay.rubberband;
 
+import java.nio.FloatBuffer;
+
 public class RubberBandStretcher
 {
     public RubberBandStretcher(int sampleRate, int channels,
@@ -77,6 +79,39 @@ public class RubberBandStretcher
 	return retrieve(output, 0, output[0].length);
     }
 
+    // These take one direct FloatBuffer per channel (for example from
+    // ByteBuffer.allocateDirect(...).order(ByteOrder.nativeOrder())
+    // .asFloatBuffer()), which the library reads and writes in place
+    // rather than copying.  As with the array versions, offset and n
+    // count floats from the start of each buffer, and the buffers'
+    // positions are neither used nor changed.  A buffer that is not
+    // direct or is too short causes an IllegalArgumentException.
+
+    public void study(FloatBuffer[] input, int offset, int n, boolean finalBlock) {
+	studyDirect(input, offset, n, finalBlock);
+    }
+    public void study(FloatBuffer[] input, boolean finalBlock) {
+	studyDirect(input, 0, input[0].capacity(), finalBlock);
+    }
+
+    public void process(FloatBuffer[] input, int offset, int n, boolean finalBlock) {
+	processDirect(input, offset, n, finalBlock);
+    }
+    public void process(FloatBuffer[] input, boolean finalBlock) {
+	processDirect(input, 0, input[0].capacity(), finalBlock);
+    }
+
+    public int retrieve(FloatBuffer[] output, int offset, int n) {
+	return retrieveDirect(output, offset, n);
+    }
+    public int retrieve(FloatBuffer[] output) {
+	return retrieveDirect(output, 0, output[0].capacity());
+    }
+
+    private native void studyDirect(FloatBuffer[] input, int offset, int n, boolean finalBlock);
+    private native void processDirect(FloatBuffer[] input, int offset, int n, boolean finalBlock);
+    private native int retrieveDirect(FloatBuffer[] output, int offset, int n);
+
     private native void initialise(int sampleRate, int channels, int options,
 				   double initialTimeRatio,
 				   double initialPitchScale);
@@ -84,6 +119,7 @@ public class RubberBandStretcher
 
     public static final int OptionProcessOffline       = 0x00000000;
     public static final int OptionProcessRealTime      = 0x00000001;
+    public static final int OptionProcessSmallBlocks   = 0x00000002;
 
     public static final int OptionStretchElastic       = 0x00000000;
     public static final int OptionStretchPrecise       = 0x00000010;
@@ -120,6 +156,8 @@ public class RubberBandStretcher
     public static final int OptionChannelsApart        = 0x00000000;
     public static final int OptionChannelsTogether     = 0x10000000;
 
+    public static final int OptionChannelsLinked       = 0x20000000;
+
     public static final int DefaultOptions             = 0x00000000;
     public static final int PercussiveOptions          = 0x00102000;
 
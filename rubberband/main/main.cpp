@@ -30,6 +30,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
 
 #include <fstream>
 
@@ -44,6 +47,8 @@
 #endif
 
 #include "base/Profiler.h"
+#include "base/RingBuffer.h"
+#include "system/Thread.h"
 
 using namespace std;
 using namespace RubberBand;
@@ -77,6 +82,531 @@ double tempo_convert(const char *str)
     else return 1.0;
 }
 
+static double
+now()
+{
+#ifdef _WIN32
+    RubberBand::
+#endif
+    timeval tv;
+    (void)gettimeofday(&tv, 0);
+    return double(tv.tv_sec) + double(tv.tv_usec) / 1000000.0;
+}
+
+// How to process each file, as given on the command line
+
+struct Settings
+{
+    RubberBandStretcher::Options options;
+    double ratio;
+    double duration;
+    double frequencyshift;
+    std::map<size_t, size_t> mapping;
+    int ibs;
+    int debug;
+    bool realtime;
+    bool quiet;
+    bool progress;
+};
+
+struct FileResult
+{
+    size_t countIn;
+    size_t countOut;
+    int sampleRate;
+    double ratio;
+    double seconds;
+
+    double inputSeconds() const {
+        return sampleRate ? double(countIn) / sampleRate : 0.0;
+    }
+};
+
+// Per-channel ring buffers between two stages of the file pipeline.
+// Each ring has one reading and one writing thread, so needs no lock;
+// the condition only lets a blocked side sleep until the other has
+// made progress.  Waits time out, so a missed signal costs at most a
+// short delay.
+
+class Pipe
+{
+public:
+    Pipe(size_t channels, int frames) :
+        m_changed("pipe"),
+        m_done(false) {
+        for (size_t c = 0; c < channels; ++c) {
+            m_rings.push_back(new RingBuffer<float>(frames));
+        }
+    }
+
+    ~Pipe() {
+        for (size_t c = 0; c < m_rings.size(); ++c) delete m_rings[c];
+    }
+
+    int getReadSpace() const {
+        int n = m_rings[0]->getReadSpace();
+        for (size_t c = 1; c < m_rings.size(); ++c) {
+            n = std::min(n, m_rings[c]->getReadSpace());
+        }
+        return n;
+    }
+
+    int getWriteSpace() const {
+        int n = m_rings[0]->getWriteSpace();
+        for (size_t c = 1; c < m_rings.size(); ++c) {
+            n = std::min(n, m_rings[c]->getWriteSpace());
+        }
+        return n;
+    }
+
+    void write(float *const *from, int n) {
+        for (size_t c = 0; c < m_rings.size(); ++c) m_rings[c]->write(from[c], n);
+        signal();
+    }
+
+    void read(float *const *to, int n) {
+        for (size_t c = 0; c < m_rings.size(); ++c) m_rings[c]->read(to[c], n);
+        signal();
+    }
+
+    // Called by the writing side after its last write
+    void setDone() {
+        MutexLocker locker(&m_doneMutex);
+        m_done = true;
+        signal();
+    }
+
+    bool isDone() {
+        MutexLocker locker(&m_doneMutex);
+        return m_done;
+    }
+
+    void wait() {
+        m_changed.lock();
+        m_changed.wait(10000);
+        m_changed.unlock();
+    }
+
+private:
+    void signal() {
+        m_changed.lock();
+        m_changed.signal();
+        m_changed.unlock();
+    }
+
+    std::vector<RingBuffer<float> *> m_rings;
+    Condition m_changed;
+    Mutex m_doneMutex;
+    bool m_done;
+};
+
+// Reads a sound file into a pipe, de-interleaving as it goes.  Runs
+// as its own thread, or is pumped with readBlock() where threads
+// aren't available.
+
+class FileReader : public Thread
+{
+public:
+    FileReader(SNDFILE *file, size_t channels, int block, Pipe &pipe) :
+        m_file(file), m_channels(channels), m_block(block), m_pipe(pipe),
+        m_fbuf(channels * block), m_bufs(channels) {
+        for (size_t c = 0; c < channels; ++c) m_bufs[c].resize(block);
+        for (size_t c = 0; c < channels; ++c) m_ptrs.push_back(&m_bufs[c][0]);
+    }
+
+    // Read one block, or mark the pipe done and return false at the
+    // end of the file.  Caller must make sure there is space.
+    bool readBlock() {
+        int count = int(sf_readf_float(m_file, &m_fbuf[0], m_block));
+        if (count <= 0) {
+            m_pipe.setDone();
+            return false;
+        }
+        for (size_t c = 0; c < m_channels; ++c) {
+            float *out = m_ptrs[c];
+            for (int i = 0; i < count; ++i) {
+                out[i] = m_fbuf[i * m_channels + c];
+            }
+        }
+        m_pipe.write(&m_ptrs[0], count);
+        return true;
+    }
+
+protected:
+    void run() {
+        do {
+            while (m_pipe.getWriteSpace() < m_block) m_pipe.wait();
+        } while (readBlock());
+    }
+
+private:
+    SNDFILE *m_file;
+    size_t m_channels;
+    int m_block;
+    Pipe &m_pipe;
+    std::vector<float> m_fbuf;
+    std::vector<std::vector<float> > m_bufs;
+    std::vector<float *> m_ptrs;
+};
+
+// Writes interleaved and clipped output from a pipe to a sound file,
+// until the pipe is done and empty.  Runs as its own thread, or is
+// pumped with writeAvailable().
+
+class FileWriter : public Thread
+{
+public:
+    FileWriter(SNDFILE *file, size_t channels, int block, Pipe &pipe) :
+        m_file(file), m_channels(channels), m_block(block), m_pipe(pipe),
+        m_failed(false), m_fbuf(channels * block), m_bufs(channels) {
+        for (size_t c = 0; c < channels; ++c) m_bufs[c].resize(block);
+        for (size_t c = 0; c < channels; ++c) m_ptrs.push_back(&m_bufs[c][0]);
+    }
+
+    // Write everything currently in the pipe
+    void writeAvailable() {
+        int n;
+        while ((n = m_pipe.getReadSpace()) > 0) {
+            if (n > m_block) n = m_block;
+            m_pipe.read(&m_ptrs[0], n);
+            for (size_t c = 0; c < m_channels; ++c) {
+                const float *in = m_ptrs[c];
+                for (int i = 0; i < n; ++i) {
+                    float value = in[i];
+                    if (value > 1.f) value = 1.f;
+                    if (value < -1.f) value = -1.f;
+                    m_fbuf[i * m_channels + c] = value;
+                }
+            }
+            // after a failure keep draining, so the producer can finish
+            if (!m_failed && sf_writef_float(m_file, &m_fbuf[0], n) != n) {
+                m_failed = true;
+            }
+        }
+    }
+
+    bool failed() const { return m_failed; }
+
+protected:
+    void run() {
+        while (true) {
+            bool done = m_pipe.isDone();
+            writeAvailable();
+            if (done) break;
+            m_pipe.wait();
+        }
+    }
+
+private:
+    SNDFILE *m_file;
+    size_t m_channels;
+    int m_block;
+    Pipe &m_pipe;
+    bool m_failed;
+    std::vector<float> m_fbuf;
+    std::vector<std::vector<float> > m_bufs;
+    std::vector<float *> m_ptrs;
+};
+
+// Frames held between pipeline stages
+static const int pipeFrames = 65536;
+
+static void
+showProgress(const Settings &s, size_t frame, sf_count_t frames, int &percent)
+{
+    if (!s.progress || frames <= 0) return;
+    int p = int((double(frame) * 100.0) / frames);
+    if (p > percent || frame == 0) {
+        percent = p;
+        cerr << "\r" << percent << "% ";
+    }
+}
+
+// Stream input through a pipe into study() or process(), one block
+// at a time, until the whole file has been passed in.  For process(),
+// output is retrieved into the output pipe as it becomes available.
+
+static void
+runPass(RubberBandStretcher &ts, SNDFILE *sndfile, const SF_INFO &sfinfo,
+        const Settings &s, bool studying, Pipe *output, FileWriter *writer,
+        FileResult &result)
+{
+    size_t channels = sfinfo.channels;
+    bool threaded = Thread::threadingAvailable();
+    int ibs = s.ibs;
+
+    Pipe input(channels, pipeFrames);
+    FileReader reader(sndfile, channels, ibs, input);
+    if (threaded) reader.start();
+
+    std::vector<std::vector<float> > bufs(channels, std::vector<float>(pipeFrames));
+    std::vector<float *> ptrs(channels);
+    for (size_t c = 0; c < channels; ++c) ptrs[c] = &bufs[c][0];
+
+    size_t frame = 0;
+    int percent = 0;
+
+    while (true) {
+
+        bool done = input.isDone();
+        int count = input.getReadSpace();
+
+        if (count < ibs && !done) {
+            if (threaded) input.wait();
+            else reader.readBlock();
+            continue;
+        }
+
+        bool final = done && count <= ibs;
+        if (count > ibs) count = ibs;
+        input.read(&ptrs[0], count);
+
+        if (s.debug > 2) {
+            cerr << "count = " << count << ", ibs = " << ibs << ", frame = " << frame << ", frames = " << sfinfo.frames << ", final = " << final << endl;
+        }
+
+        if (studying) {
+            ts.study(&ptrs[0], count, final);
+        } else {
+            ts.process(&ptrs[0], count, final);
+            result.countIn += count;
+
+            int avail = ts.available();
+            if (s.debug > 1) cerr << "available = " << avail << endl;
+
+            while (avail > 0) {
+                int n = std::min(avail, output->getWriteSpace());
+                if (n == 0) {
+                    if (threaded) output->wait();
+                    else writer->writeAvailable();
+                    continue;
+                }
+                n = std::min(n, pipeFrames);
+                ts.retrieve(&ptrs[0], n);
+                output->write(&ptrs[0], n);
+                result.countOut += n;
+                avail -= n;
+            }
+            if (!threaded) writer->writeAvailable();
+
+            if (frame == 0 && !s.realtime && s.progress) {
+                cerr << "Pass 2: Processing..." << endl;
+            }
+        }
+
+        showProgress(s, frame, sfinfo.frames, percent);
+        frame += count;
+
+        if (final) break;
+    }
+
+    if (threaded) reader.wait();
+}
+
+// Stretch one file into another through a reader thread, the
+// stretcher (whose channels run on the shared thread pool) and a
+// writer thread.
+
+static bool
+processFile(const char *fileName, const char *fileNameOut,
+            const Settings &s, FileResult &result)
+{
+    SNDFILE *sndfile;
+    SNDFILE *sndfileOut;
+    SF_INFO sfinfo;
+    SF_INFO sfinfoOut;
+    memset(&sfinfo, 0, sizeof(SF_INFO));
+
+    sndfile = sf_open(fileName, SFM_READ, &sfinfo);
+    if (!sndfile) {
+	cerr << "ERROR: Failed to open input file \"" << fileName << "\": "
+	     << sf_strerror(sndfile) << endl;
+	return false;
+    }
+
+    double ratio = s.ratio;
+
+    if (s.duration != 0.0) {
+        if (sfinfo.frames == 0 || sfinfo.samplerate == 0) {
+            cerr << "ERROR: File \"" << fileName << "\" lacks frame count or sample rate in header, cannot use --duration" << endl;
+            sf_close(sndfile);
+            return false;
+        }
+        double induration = double(sfinfo.frames) / double(sfinfo.samplerate);
+        if (induration != 0.0) ratio = s.duration / induration;
+    }
+
+    sfinfoOut.channels = sfinfo.channels;
+    sfinfoOut.format = sfinfo.format;
+    sfinfoOut.frames = int(sfinfo.frames * ratio + 0.1);
+    sfinfoOut.samplerate = sfinfo.samplerate;
+    sfinfoOut.sections = sfinfo.sections;
+    sfinfoOut.seekable = sfinfo.seekable;
+
+    sndfileOut = sf_open(fileNameOut, SFM_WRITE, &sfinfoOut) ;
+    if (!sndfileOut) {
+	cerr << "ERROR: Failed to open output file \"" << fileNameOut << "\" for writing: "
+	     << sf_strerror(sndfileOut) << endl;
+        sf_close(sndfile);
+	return false;
+    }
+
+    size_t channels = sfinfo.channels;
+
+    if (s.progress) {
+        cerr << "Using time ratio " << ratio;
+        cerr << " and frequency ratio " << s.frequencyshift << endl;
+    }
+
+    result.countIn = 0;
+    result.countOut = 0;
+    result.sampleRate = sfinfo.samplerate;
+    result.ratio = ratio;
+
+    double start = now();
+
+    RubberBandStretcher ts(sfinfo.samplerate, channels, s.options,
+                           ratio, s.frequencyshift);
+
+    ts.setExpectedInputDuration(sfinfo.frames);
+
+    sf_seek(sndfile, 0, SEEK_SET);
+
+    if (!s.realtime) {
+
+        if (s.progress) {
+            cerr << "Pass 1: Studying..." << endl;
+        }
+
+        runPass(ts, sndfile, sfinfo, s, true, 0, 0, result);
+
+        if (s.progress) {
+            cerr << "\rCalculating profile..." << endl;
+        }
+
+        sf_seek(sndfile, 0, SEEK_SET);
+    }
+
+    if (!s.mapping.empty()) {
+        ts.setKeyFrameMap(s.mapping);
+    }
+
+    bool threaded = Thread::threadingAvailable();
+    Pipe output(channels, pipeFrames);
+    FileWriter writer(sndfileOut, channels, s.ibs, output);
+    if (threaded) writer.start();
+
+    runPass(ts, sndfile, sfinfo, s, false, &output, &writer, result);
+
+    if (s.progress) {
+        cerr << "\r    " << endl;
+    }
+
+    std::vector<std::vector<float> > bufs(channels, std::vector<float>(pipeFrames));
+    std::vector<float *> ptrs(channels);
+    for (size_t c = 0; c < channels; ++c) ptrs[c] = &bufs[c][0];
+
+    int avail;
+
+    while ((avail = ts.available()) >= 0) {
+
+        if (s.debug > 1) {
+            cerr << "(completing) available = " << avail << endl;
+        }
+
+        if (avail > 0) {
+            int n = std::min(std::min(avail, output.getWriteSpace()), pipeFrames);
+            if (n == 0) {
+                if (threaded) output.wait();
+                else writer.writeAvailable();
+                continue;
+            }
+            ts.retrieve(&ptrs[0], n);
+            output.write(&ptrs[0], n);
+            result.countOut += n;
+        } else {
+            usleep(10000);
+        }
+    }
+
+    output.setDone();
+    if (threaded) writer.wait();
+    else writer.writeAvailable();
+
+    sf_close(sndfile);
+    sf_close(sndfileOut);
+
+    result.seconds = now() - start;
+
+    if (writer.failed()) {
+        cerr << "ERROR: Failed to write output file \"" << fileNameOut << "\"" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+struct FileJob
+{
+    std::string in;
+    std::string out;
+    bool ok;
+    FileResult result;
+};
+
+struct FileList
+{
+    std::vector<FileJob> jobs;
+    size_t next;
+    int failed;
+    Mutex mutex;
+};
+
+// Takes files from the list and processes them until none are left.
+// Several of these run at once for --parallel-files.
+
+class FileWorker : public Thread
+{
+public:
+    FileWorker(FileList &files, const Settings &settings) :
+        m_files(files), m_settings(settings) { }
+
+    void run() {
+        while (true) {
+            FileJob *job;
+            {
+                MutexLocker locker(&m_files.mutex);
+                if (m_files.next == m_files.jobs.size()) return;
+                job = &m_files.jobs[m_files.next++];
+            }
+
+            FileResult &r = job->result;
+            job->ok = processFile(job->in.c_str(), job->out.c_str(),
+                                  m_settings, r);
+
+            MutexLocker locker(&m_files.mutex);
+            if (!job->ok) {
+                ++m_files.failed;
+                continue;
+            }
+            if (m_settings.quiet) continue;
+
+            if (m_files.jobs.size() == 1) {
+                cerr << "in: " << r.countIn << ", out: " << r.countOut << ", ratio: " << float(r.countOut)/float(r.countIn) << ", ideal output: " << lrint(r.countIn * r.ratio) << ", error: " << abs(lrint(r.countIn * r.ratio) - int(r.countOut)) << endl;
+                cerr << "elapsed time: " << r.seconds << " sec, in frames/sec: " << r.countIn/r.seconds << ", out frames/sec: " << r.countOut/r.seconds << endl;
+            }
+            cerr << job->in << ": " << r.inputSeconds() << " sec of audio in "
+                 << r.seconds << " sec, "
+                 << (r.seconds > 0.0 ? r.inputSeconds() / r.seconds : 0.0)
+                 << "x real time" << endl;
+        }
+    }
+
+private:
+    FileList &m_files;
+    const Settings &m_settings;
+};
+
 int main(int argc, char **argv)
 {
     int c;
@@ -87,6 +617,7 @@ int main(int argc, char **argv)
     double frequencyshift = 1.0;
     int debug = 0;
     bool realtime = false;
+    bool smallblocks = false;
     bool precise = true;
     int threading = 0;
     bool lamination = true;
@@ -96,11 +627,14 @@ int main(int argc, char **argv)
     bool hqpitch = false;
     bool formant = false;
     bool together = false;
+    bool linked = false;
+    bool profile = false;
     bool crispchanged = false;
     int crispness = -1;
     bool help = false;
     bool version = false;
     bool quiet = false;
+    int parallel = 1;
 
     bool haveRatio = false;
 
@@ -133,6 +667,7 @@ int main(int argc, char **argv)
             { "crispness",     1, 0, 'c' },
             { "debug",         1, 0, 'd' },
             { "realtime",      0, 0, 'R' },
+            { "small-blocks",  0, 0, '*' },
             { "loose",         0, 0, 'L' },
             { "precise",       0, 0, 'P' },
             { "formant",       0, 0, 'F' },
@@ -140,6 +675,7 @@ int main(int argc, char **argv)
             { "no-transients", 0, 0, '1' },
             { "no-lamination", 0, 0, '2' },
             { "centre-focus",  0, 0, '7' },
+            { "linked-phase",  0, 0, '&' },
             { "window-long",   0, 0, '3' },
             { "window-short",  0, 0, '4' },
             { "bl-transients", 0, 0, '8' },
@@ -149,7 +685,9 @@ int main(int argc, char **argv)
             { "pitch-hq",      0, 0, '%' },
             { "threads",       0, 0, '@' },
             { "quiet",         0, 0, 'q' },
+            { "profile",       0, 0, '^' },
             { "timemap",       1, 0, 'M' },
+            { "parallel-files",1, 0, 'j' },
             { 0, 0, 0, 0 }
         };
 
@@ -168,6 +706,7 @@ int main(int argc, char **argv)
         case 'f': frequencyshift = atof(optarg); haveRatio = true; break;
         case 'd': debug = atoi(optarg); break;
         case 'R': realtime = true; break;
+        case '*': realtime = true; smallblocks = true; break;
         case 'L': precise = false; break;
         case 'P': precise = true; break;
 	case 'F': formant = true; break;
@@ -180,12 +719,15 @@ int main(int argc, char **argv)
         case '5': detector = PercussiveDetector; crispchanged = true; break;
         case '6': detector = SoftDetector; crispchanged = true; break;
         case '7': together = true; break;
+        case '&': linked = true; break;
         case '8': transients = BandLimitedTransients; crispchanged = true; break;
         case '9': smoothing = true; crispchanged = true; break;
         case '%': hqpitch = true; break;
         case 'c': crispness = atoi(optarg); break;
         case 'q': quiet = true; break;
+        case '^': profile = true; break;
         case 'M': mapfile = optarg; break;
+        case 'j': parallel = atoi(optarg); break;
         default:  help = true; break;
         }
     }
@@ -195,13 +737,17 @@ int main(int argc, char **argv)
         return 0;
     }
 
-    if (help || !haveRatio || optind + 2 != argc) {
+    if (help || !haveRatio || argc - optind < 2) {
         cerr << endl;
 	cerr << "Rubber Band" << endl;
         cerr << "An audio time-stretching and pitch-shifting library and utility program." << endl;
 	cerr << "Copyright 2007-2015 Particular Programs Ltd." << endl;
         cerr << endl;
 	cerr << "   Usage: " << argv[0] << " [options] <infile.wav> <outfile.wav>" << endl;
+	cerr << "      or: " << argv[0] << " [options] <infile.wav>... <outdir>" << endl;
+        cerr << endl;
+        cerr << "Given more than one input file, each is written to the output directory" << endl;
+        cerr << "under its own name." << endl;
         cerr << endl;
         cerr << "You must specify at least one of the following time and pitch ratio options." << endl;
         cerr << endl;
@@ -234,6 +780,8 @@ int main(int argc, char **argv)
         cerr << "  -L,    --loose          Relax timing in hope of better transient preservation" << endl;
         cerr << "  -P,    --precise        Ignored: The opposite of -L, this is default from 1.6" << endl;
         cerr << "  -R,    --realtime       Select realtime mode (implies --no-threads)" << endl;
+        cerr << "         --small-blocks   Realtime mode tuned for small blocks (implies -R" << endl;
+        cerr << "                          and --window-short; processes in 64-frame blocks)" << endl;
         cerr << "         --no-threads     No extra threads regardless of CPU and channel count" << endl;
         cerr << "         --threads        Assume multi-CPU even if only one CPU is identified" << endl;
         cerr << "         --no-transients  Disable phase resynchronisation at transients" << endl;
@@ -247,10 +795,14 @@ int main(int argc, char **argv)
         cerr << "         --pitch-hq       In RT mode, use a slower, higher quality pitch shift" << endl;
         cerr << "         --centre-focus   Preserve focus of centre material in stereo" << endl;
         cerr << "                          (at a cost in width and individual channel quality)" << endl;
+        cerr << "         --linked-phase   Take phases of all channels from the first, keeping" << endl;
+        cerr << "                          them in step (faster; not multithreaded)" << endl;
         cerr << endl;
         cerr << "  -d<N>, --debug <N>      Select debug level (N = 0,1,2,3); default 0, full 3" << endl;
         cerr << "                          (N.B. debug level 3 includes audible ticks in output)" << endl;
         cerr << "  -q,    --quiet          Suppress progress output" << endl;
+        cerr << "         --parallel-files <N>  Process up to N input files at once" << endl;
+        cerr << "         --profile        Report time spent in each part of the library" << endl;
         cerr << endl;
         cerr << "  -V,    --version        Show version number and exit" << endl;
         cerr << "  -h,    --help           Show this help" << endl;
@@ -337,50 +889,9 @@ int main(int argc, char **argv)
         }
     }
 
-    char *fileName = strdup(argv[optind++]);
-    char *fileNameOut = strdup(argv[optind++]);
-
-    SNDFILE *sndfile;
-    SNDFILE *sndfileOut;
-    SF_INFO sfinfo;
-    SF_INFO sfinfoOut;
-    memset(&sfinfo, 0, sizeof(SF_INFO));
-
-    sndfile = sf_open(fileName, SFM_READ, &sfinfo);
-    if (!sndfile) {
-	cerr << "ERROR: Failed to open input file \"" << fileName << "\": "
-	     << sf_strerror(sndfile) << endl;
-	return 1;
-    }
-
-    if (duration != 0.0) {
-        if (sfinfo.frames == 0 || sfinfo.samplerate == 0) {
-            cerr << "ERROR: File lacks frame count or sample rate in header, cannot use --duration" << endl;
-            return 1;
-        }
-        double induration = double(sfinfo.frames) / double(sfinfo.samplerate);
-        if (induration != 0.0) ratio = duration / induration;
-    }
-
-    sfinfoOut.channels = sfinfo.channels;
-    sfinfoOut.format = sfinfo.format;
-    sfinfoOut.frames = int(sfinfo.frames * ratio + 0.1);
-    sfinfoOut.samplerate = sfinfo.samplerate;
-    sfinfoOut.sections = sfinfo.sections;
-    sfinfoOut.seekable = sfinfo.seekable;
-
-    sndfileOut = sf_open(fileNameOut, SFM_WRITE, &sfinfoOut) ;
-    if (!sndfileOut) {
-	cerr << "ERROR: Failed to open output file \"" << fileNameOut << "\" for writing: "
-	     << sf_strerror(sndfileOut) << endl;
-	return 1;
-    }
-    
-    int ibs = 1024;
-    size_t channels = sfinfo.channels;
-
     RubberBandStretcher::Options options = 0;
     if (realtime)    options |= RubberBandStretcher::OptionProcessRealTime;
+    if (smallblocks) options |= RubberBandStretcher::OptionProcessSmallBlocks;
     if (precise)     options |= RubberBandStretcher::OptionStretchPrecise;
     if (!lamination) options |= RubberBandStretcher::OptionPhaseIndependent;
     if (longwin)     options |= RubberBandStretcher::OptionWindowLong;
@@ -389,6 +900,7 @@ int main(int argc, char **argv)
     if (formant)     options |= RubberBandStretcher::OptionFormantPreserved;
     if (hqpitch)     options |= RubberBandStretcher::OptionPitchHighQuality;
     if (together)    options |= RubberBandStretcher::OptionChannelsTogether;
+    if (linked)      options |= RubberBandStretcher::OptionChannelsLinked;
 
     switch (threading) {
     case 0:
@@ -430,219 +942,80 @@ int main(int argc, char **argv)
         frequencyshift *= pow(2.0, pitchshift / 12);
     }
 
-    cerr << "Using time ratio " << ratio;
-    cerr << " and frequency ratio " << frequencyshift << endl;
-
-#ifdef _WIN32
-    RubberBand::
-#endif
-    timeval tv;
-    (void)gettimeofday(&tv, 0);
+    Settings settings;
+    settings.options = options;
+    settings.ratio = ratio;
+    settings.duration = duration;
+    settings.frequencyshift = frequencyshift;
+    settings.mapping = mapping;
+    settings.ibs = (smallblocks ? 64 : 1024);
+    settings.debug = debug;
+    settings.realtime = realtime;
+    settings.quiet = quiet;
 
     RubberBandStretcher::setDefaultDebugLevel(debug);
+    if (profile) RubberBandStretcher::setProfilingEnabled(true);
 
-    RubberBandStretcher ts(sfinfo.samplerate, channels, options,
-                           ratio, frequencyshift);
+    // With two file arguments, the second is the output file; with
+    // more, the last is a directory to write outputs to, named as the
+    // inputs.
 
-    ts.setExpectedInputDuration(sfinfo.frames);
+    FileList files;
+    files.next = 0;
+    files.failed = 0;
 
-    float *fbuf = new float[channels * ibs];
-    float **ibuf = new float *[channels];
-    for (size_t i = 0; i < channels; ++i) ibuf[i] = new float[ibs];
-
-    int frame = 0;
-    int percent = 0;
+    int inputs = argc - optind - 1;
+    const char *outDir = argv[argc - 1];
 
-    sf_seek(sndfile, 0, SEEK_SET);
-
-    if (!realtime) {
-
-        if (!quiet) {
-            cerr << "Pass 1: Studying..." << endl;
-        }
-
-        while (frame < sfinfo.frames) {
-
-            int count = -1;
-
-            if ((count = sf_readf_float(sndfile, fbuf, ibs)) <= 0) break;
-        
-            for (size_t c = 0; c < channels; ++c) {
-                for (int i = 0; i < count; ++i) {
-                    float value = fbuf[i * channels + c];
-                    ibuf[c][i] = value;
-                }
-            }
-
-            bool final = (frame + ibs >= sfinfo.frames);
-
-            ts.study(ibuf, count, final);
-
-            int p = int((double(frame) * 100.0) / sfinfo.frames);
-            if (p > percent || frame == 0) {
-                percent = p;
-                if (!quiet) {
-                    cerr << "\r" << percent << "% ";
-                }
-            }
-
-            frame += ibs;
-        }
-
-        if (!quiet) {
-            cerr << "\rCalculating profile..." << endl;
+    for (int i = 0; i < inputs; ++i) {
+        FileJob job;
+        job.in = argv[optind + i];
+        if (inputs == 1) {
+            job.out = outDir;
+        } else {
+            std::string name = job.in;
+            std::string::size_type slash = name.find_last_of("/\\");
+            if (slash != std::string::npos) name = name.substr(slash + 1);
+            job.out = std::string(outDir) + "/" + name;
         }
-
-        sf_seek(sndfile, 0, SEEK_SET);
-    }
-
-    frame = 0;
-    percent = 0;
-
-    if (!mapping.empty()) {
-        ts.setKeyFrameMap(mapping);
+        job.ok = false;
+        files.jobs.push_back(job);
     }
-    
-    size_t countIn = 0, countOut = 0;
-
-    while (frame < sfinfo.frames) {
-
-        int count = -1;
-
-	if ((count = sf_readf_float(sndfile, fbuf, ibs)) < 0) break;
-        
-        countIn += count;
-
-        for (size_t c = 0; c < channels; ++c) {
-            for (int i = 0; i < count; ++i) {
-                float value = fbuf[i * channels + c];
-                ibuf[c][i] = value;
-            }
-        }
-
-        bool final = (frame + ibs >= sfinfo.frames);
-
-        if (debug > 2) {
-            cerr << "count = " << count << ", ibs = " << ibs << ", frame = " << frame << ", frames = " << sfinfo.frames << ", final = " << final << endl;
-        }
-
-        ts.process(ibuf, count, final);
 
-        int avail = ts.available();
-        if (debug > 1) cerr << "available = " << avail << endl;
+    // Progress is only shown for one file at a time
 
-        if (avail > 0) {
-            float **obf = new float *[channels];
-            for (size_t i = 0; i < channels; ++i) {
-                obf[i] = new float[avail];
-            }
-            ts.retrieve(obf, avail);
-            countOut += avail;
-            float *fobf = new float[channels * avail];
-            for (size_t c = 0; c < channels; ++c) {
-                for (int i = 0; i < avail; ++i) {
-                    float value = obf[c][i];
-                    if (value > 1.f) value = 1.f;
-                    if (value < -1.f) value = -1.f;
-                    fobf[i * channels + c] = value;
-                }
-            }
-//            cout << "fobf mean: ";
-//    double d = 0;
-//    for (int i = 0; i < avail; ++i) {
-//        d += fobf[i];
-//    }
-//    d /= avail;
-//    cout << d << endl;
-            sf_writef_float(sndfileOut, fobf, avail);
-            delete[] fobf;
-            for (size_t i = 0; i < channels; ++i) {
-                delete[] obf[i];
-            }
-            delete[] obf;
-        }
+    settings.progress = (!quiet && (parallel < 2 || inputs == 1));
 
-        if (frame == 0 && !realtime && !quiet) {
-            cerr << "Pass 2: Processing..." << endl;
-        }
-
-	int p = int((double(frame) * 100.0) / sfinfo.frames);
-	if (p > percent || frame == 0) {
-	    percent = p;
-            if (!quiet) {
-                cerr << "\r" << percent << "% ";
-            }
-	}
+    double start = now();
 
-        frame += ibs;
-    }
-
-    if (!quiet) {
-        cerr << "\r    " << endl;
-    }
-    int avail;
-
-    while ((avail = ts.available()) >= 0) {
-
-        if (debug > 1) {
-            cerr << "(completing) available = " << avail << endl;
+    if (parallel < 2 || inputs == 1 || !Thread::threadingAvailable()) {
+        FileWorker(files, settings).run();
+    } else {
+        std::vector<FileWorker *> workers;
+        for (int i = 0; i < parallel && i < inputs; ++i) {
+            workers.push_back(new FileWorker(files, settings));
+            workers[i]->start();
         }
-
-        if (avail > 0) {
-            float **obf = new float *[channels];
-            for (size_t i = 0; i < channels; ++i) {
-                obf[i] = new float[avail];
-            }
-            ts.retrieve(obf, avail);
-            countOut += avail;
-            float *fobf = new float[channels * avail];
-            for (size_t c = 0; c < channels; ++c) {
-                for (int i = 0; i < avail; ++i) {
-                    float value = obf[c][i];
-                    if (value > 1.f) value = 1.f;
-                    if (value < -1.f) value = -1.f;
-                    fobf[i * channels + c] = value;
-                }
-            }
-
-            sf_writef_float(sndfileOut, fobf, avail);
-            delete[] fobf;
-            for (size_t i = 0; i < channels; ++i) {
-                delete[] obf[i];
-            }
-            delete[] obf;
-        } else {
-            usleep(10000);
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i]->wait();
+            delete workers[i];
         }
     }
 
-    sf_close(sndfile);
-    sf_close(sndfileOut);
-
-    if (!quiet) {
-
-        cerr << "in: " << countIn << ", out: " << countOut << ", ratio: " << float(countOut)/float(countIn) << ", ideal output: " << lrint(countIn * ratio) << ", error: " << abs(lrint(countIn * ratio) - int(countOut)) << endl;
+    double sec = now() - start;
 
-#ifdef _WIN32
-        RubberBand::
-#endif
-        timeval etv;
-        (void)gettimeofday(&etv, 0);
-        
-        etv.tv_sec -= tv.tv_sec;
-        if (etv.tv_usec < tv.tv_usec) {
-            etv.tv_usec += 1000000;
-            etv.tv_sec -= 1;
+    if (!quiet && inputs > 1) {
+        double audio = 0.0;
+        for (size_t i = 0; i < files.jobs.size(); ++i) {
+            if (files.jobs[i].ok) audio += files.jobs[i].result.inputSeconds();
         }
-        etv.tv_usec -= tv.tv_usec;
-        
-        double sec = double(etv.tv_sec) + (double(etv.tv_usec) / 1000000.0);
-        cerr << "elapsed time: " << sec << " sec, in frames/sec: " << countIn/sec << ", out frames/sec: " << countOut/sec << endl;
+        cerr << "total: " << inputs - files.failed << " of " << inputs
+             << " file(s), " << audio << " sec of audio in " << sec
+             << " sec, " << (sec > 0.0 ? audio / sec : 0.0)
+             << "x real time" << endl;
     }
 
     RubberBand::Profiler::dump();
 
-    return 0;
+    return files.failed ? 1 : 0;
 }
-
-
@@ -81,6 +81,18 @@ public:
      *   \li \c OptionProcessRealTime - Run the stretcher in real-time
      *   mode.  In this mode only process() should be called, and the
      *   stretcher adjusts dynamically in response to the input audio.
+     *
+     *   The following flag may be combined with \c OptionProcessRealTime.
+     *
+     *   \li \c OptionProcessSmallBlocks - Spread the work for each
+     *   processing chunk across the process() calls that supply the
+     *   input for the next chunk, rather than doing all of it in the
+     *   call that completes the chunk's input.  This evens out the
+     *   time taken by each call when the host passes small blocks
+     *   (32 or 64 frames, say), at the cost of one further
+     *   processing increment of latency, which getLatency() includes.
+     *   It also selects \c OptionWindowShort unless \c
+     *   OptionWindowLong is given.
      * 
      * The Process setting is likely to depend on your architecture:
      * non-real-time operation on seekable files: Offline; real-time
@@ -174,11 +186,14 @@ public:
      * construction.
      *
      *   \li \c OptionThreadingAuto - Permit the stretcher to
-     *   determine its own threading model.  Usually this means using
-     *   one processing thread per audio channel in offline mode if
+     *   determine its own threading model.  Usually this means
+     *   processing the audio channels in parallel in offline mode if
      *   the stretcher is able to determine that more than one CPU is
      *   available, and one thread only in realtime mode.  This is the
-     *   defafult.
+     *   defafult.  The channels are processed by a pool of worker
+     *   threads, one per CPU, shared by all stretcher instances in the
+     *   process, so the number of threads does not grow with the
+     *   number of stretchers or channels.
      *
      *   \li \c OptionThreadingNever - Never use more than one thread.
      *  
@@ -270,12 +285,25 @@ public:
      *   setting).  This usually leads to better focus in the centre
      *   but a loss of stereo space and width.  Any channels beyond
      *   the first two are processed individually.
+     *
+     *   The following flag may be combined with either of the above.
+     *
+     *   \li \c OptionChannelsLinked - All channels (or mid and side,
+     *   with OptionChannelsTogether) are processed in step, and every
+     *   channel takes the phase advance for each frequency bin from
+     *   the first rather than calculating its own.  This preserves
+     *   the phase relationships between channels and saves some
+     *   processing time for each channel after the first, but as the
+     *   channels must be kept in step they are never processed on
+     *   separate threads.  The first channel should carry the most
+     *   representative signal for this to work well.
      */
     
     enum Option {
 
         OptionProcessOffline       = 0x00000000,
         OptionProcessRealTime      = 0x00000001,
+        OptionProcessSmallBlocks   = 0x00000002,
 
         OptionStretchElastic       = 0x00000000,
         OptionStretchPrecise       = 0x00000010,
@@ -312,6 +340,8 @@ public:
         OptionChannelsApart        = 0x00000000,
         OptionChannelsTogether     = 0x10000000,
 
+        OptionChannelsLinked       = 0x20000000,
+
         // n.b. Options is int, so we must stop before 0x80000000
     };
 
@@ -507,6 +537,39 @@ public:
      */
     void setMaxProcessSize(size_t samples);
 
+    /**
+     * In RealTime mode, tell the stretcher the range of time ratios
+     * and pitch scales that you will be using.  Every window, FFT
+     * and buffer needed for any ratio and scale within the range is
+     * allocated in advance, so that subsequent calls to
+     * setTimeRatio() and setPitchScale() within the range never
+     * allocate or free memory and may safely be made from a
+     * real-time audio thread.  Ratios outside the range still work,
+     * but may require allocation when they are set.
+     *
+     * If you don't call this, the range is 0.5 to 2.0 for both time
+     * ratio and pitch scale (extended to include the initial values
+     * passed to the constructor).
+     *
+     * This function has no effect in Offline mode, and may not be
+     * called after the first call to process().
+     */
+    void setRealTimeRatioRange(double minTimeRatio, double maxTimeRatio,
+                               double minPitchScale, double maxPitchScale);
+
+    /**
+     * With OptionFormantPreserved, recalculate the spectral envelope
+     * used for formant preservation only once every "chunks" processing
+     * chunks, reusing it in between.  The envelope is still shifted
+     * by the current pitch scale on every chunk.  Values above 1 save
+     * an inverse and a forward FFT per channel on the skipped chunks,
+     * at the expense of the envelope lagging the input a little.
+     * The default is 1, recalculating on every chunk.
+     *
+     * This may be called at any time in any mode.
+     */
+    void setFormantEnvelopeInterval(size_t chunks);
+
     /**
      * Ask the stretcher how many audio sample frames should be
      * provided as input in order to ensure that some more output
@@ -585,6 +648,47 @@ public:
      */
     void study(const float *const *input, size_t samples, bool final);
 
+    /**
+     * Return the results of study() as a compact block of binary
+     * data, which may be stored and later passed to setStudyData()
+     * on another stretcher, in place of studying the same input
+     * again.  This is useful when producing several stretches of
+     * one source at different ratios.
+     *
+     * The data holds the detection function values for each
+     * processing chunk together with the analysis sizes and options
+     * they were calculated with, about eight bytes per chunk in
+     * all.  It does not depend on the channel count or on the time
+     * ratio or pitch scale.
+     *
+     * This function is only meaningful in Offline mode, after the
+     * final call to study() and before the first call to process().
+     * It returns an empty vector otherwise.
+     */
+    std::vector<char> getStudyData() const;
+
+    /**
+     * Use the results of an earlier study() of the same input,
+     * obtained from getStudyData(), instead of calling study().
+     * The stretcher switches to the analysis window size and
+     * increment that the data was made with, whatever the time ratio
+     * and pitch scale, so the data stays valid for any ratio set
+     * before processing starts.  (Very different ratios from the one
+     * it was studied at may therefore stretch with less overlap than
+     * usual.)
+     *
+     * The output then differs from that of a stretcher which studied
+     * the input itself only where the sizes differ.
+     *
+     * This function cannot be used in RealTime mode, and must be
+     * called before any study() or process() call.  The data must
+     * come from a stretcher with the same sample rate and detector
+     * and stretch options.  Returns false, leaving the stretcher
+     * unchanged, if the data is unusable.  Calling reset() clears
+     * the imported data.
+     */
+    bool setStudyData(const std::vector<char> &data);
+
     /**
      * Provide a block of "samples" sample frames for processing.
      * See also getSamplesRequired() and setMaxProcessSize().
@@ -604,6 +708,46 @@ public:
      */
     void process(const float *const *input, size_t samples, bool final);
 
+    /**
+     * Stretch a complete piece of audio in a single call, in Offline
+     * mode.  This has the same effect as passing all of "input"
+     * through study() and process() and calling retrieve() until
+     * the output is complete, except that long input is divided into
+     * segments of ten seconds or more which are studied and
+     * processed simultaneously on separate threads.
+     *
+     * The results of studying the segments are combined before any
+     * processing, so the stretch profile is calculated for the input
+     * as a whole and any key frame map is honoured as usual.
+     * Neighbouring segments are then joined with a short crossfade
+     * just after a phase reset, where both produce the same output.
+     * Transients are used for this where there is one near the
+     * intended join; otherwise an extra phase reset is added there,
+     * which is the only way in which the result differs from that of
+     * a single pass (other than in rounding when the pitch is also
+     * being shifted).
+     *
+     * Input is split only when threading is available and
+     * OptionThreadingNever is not set; otherwise the whole input is
+     * processed in one pass on the calling thread.
+     *
+     * "input" should point to de-interleaved audio data with one
+     * float array per channel, "samples" frames long.  "output"
+     * should point to one float array per channel with room for
+     * "outputSize" frames.  The stretched result is approximately
+     * "samples" * getTimeRatio() frames long.  The return value is
+     * the number of frames written, which is no more than
+     * "outputSize".
+     *
+     * This function cannot be used in RealTime mode.  It must be
+     * called before any study() or process() call, or after reset(),
+     * and leaves the stretcher finished, as if all its output had
+     * been retrieved.  This function blocks until processing is
+     * complete.
+     */
+    size_t processWhole(const float *const *input, size_t samples,
+                        float *const *output, size_t outputSize);
+
     /**
      * Ask the stretcher how many audio sample frames of output data
      * are available for reading (via retrieve()).
@@ -726,6 +870,45 @@ public:
      */
     static void setDefaultDebugLevel(int level);
 
+    /**
+     * Summary of the time spent in one internally profiled part of
+     * the library (such as "RubberBandStretcher::Impl::processChunks"),
+     * as returned by getProfileSnapshot().  Times are in milliseconds
+     * of wall-clock time per call; the percentiles are approximate.
+     */
+    struct ProfileScope {
+        const char *name;
+        size_t calls;
+        double totalMs;
+        double p50Ms;
+        double p99Ms;
+        double worstMs;
+    };
+
+    /**
+     * Switch the library's internal profiler on or off, for all
+     * stretchers and threads.  It is off by default in release builds
+     * and costs almost nothing when off.  When on, each profiled call
+     * records its time to a histogram belonging to the calling thread,
+     * without locking or allocation, so it is reasonable to leave on
+     * in production use.
+     */
+    static void setProfilingEnabled(bool enabled);
+
+    /**
+     * Return a summary of the times recorded by the internal profiler
+     * since it was enabled or last reset, across all threads, for each
+     * profiled part of the library.  This may be called from any
+     * thread, including while others are processing, but it does
+     * allocate and so should not be called from a real-time thread.
+     */
+    static std::vector<ProfileScope> getProfileSnapshot();
+
+    /**
+     * Discard all times recorded by the internal profiler so far.
+     */
+    static void resetProfile();
+
 protected:
     class Impl;
     Impl *m_d;
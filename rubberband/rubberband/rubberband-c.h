@@ -49,6 +49,7 @@ enum RubberBandOption {
 
     RubberBandOptionProcessOffline       = 0x00000000,
     RubberBandOptionProcessRealTime      = 0x00000001,
+    RubberBandOptionProcessSmallBlocks   = 0x00000002,
 
     RubberBandOptionStretchElastic       = 0x00000000,
     RubberBandOptionStretchPrecise       = 0x00000010,
@@ -84,6 +85,8 @@ enum RubberBandOption {
 
     RubberBandOptionChannelsApart        = 0x00000000,
     RubberBandOptionChannelsTogether     = 0x10000000,
+
+    RubberBandOptionChannelsLinked       = 0x20000000,
 };
 
 typedef int RubberBandOptions;
@@ -135,6 +138,54 @@ extern void rubberband_calculate_stretch(RubberBandState);
 extern void rubberband_set_debug_level(RubberBandState, int level);
 extern void rubberband_set_default_debug_level(int level);
 
+/**
+ * Batch processing of many short, independent clips, each with its
+ * own time ratio and pitch scale, in offline mode.
+ *
+ * A batch keeps a pool of stretchers with the sample rate, channel
+ * count and options given to rubberband_batch_new, and reuses them
+ * (via reset) from one clip and one rubberband_batch_process call to
+ * the next, so that the cost of constructing a stretcher is only paid
+ * once per thread rather than once per clip.  The clips in a call
+ * are shared out between up to maxThreads threads (the calling thread
+ * and workers from the library's thread pool), or one per processor
+ * if maxThreads is 0.  Each clip is processed in a single pass as by
+ * RubberBandStretcher::processWhole, on one thread.
+ *
+ * For each clip, "input" points to one array of "inputFrames" frames
+ * per channel and "output" to one array of "outputCapacity" frames
+ * per channel.  On return "outputFrames" holds the number of frames
+ * written, approximately inputFrames * timeRatio.  Clips must not
+ * share output arrays.
+ *
+ * RubberBandOptionProcessRealTime is ignored, and the stretchers do
+ * no threading of their own.  rubberband_batch_process blocks until
+ * every clip is done; a batch may be used by only one thread at a
+ * time, but separate batches are independent.
+ */
+
+typedef struct {
+    const float *const *input;
+    unsigned int inputFrames;
+    double timeRatio;
+    double pitchScale;
+    float *const *output;
+    unsigned int outputCapacity;
+    unsigned int outputFrames;
+} RubberBandClip;
+
+struct RubberBandBatch_;
+typedef struct RubberBandBatch_ *RubberBandBatch;
+
+extern RubberBandBatch rubberband_batch_new(unsigned int sampleRate,
+                                            unsigned int channels,
+                                            RubberBandOptions options,
+                                            unsigned int maxThreads);
+
+extern void rubberband_batch_delete(RubberBandBatch);
+
+extern void rubberband_batch_process(RubberBandBatch, RubberBandClip *clips, unsigned int count);
+
 #ifdef __cplusplus
 }
 #endif
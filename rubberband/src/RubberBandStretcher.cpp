@@ -23,6 +23,8 @@
 
 #include "StretcherImpl.h"
 
+#include "base/Profiler.h"
+
 using namespace std;
 
 namespace RubberBand {
@@ -121,6 +123,22 @@ RubberBandStretcher::setMaxProcessSize(size_t samples)
     m_d->setMaxProcessSize(samples);
 }
 
+void
+RubberBandStretcher::setRealTimeRatioRange(double minTimeRatio,
+                                           double maxTimeRatio,
+                                           double minPitchScale,
+                                           double maxPitchScale)
+{
+    m_d->setRealTimeRatioRange(minTimeRatio, maxTimeRatio,
+                               minPitchScale, maxPitchScale);
+}
+
+void
+RubberBandStretcher::setFormantEnvelopeInterval(size_t chunks)
+{
+    m_d->setFormantEnvelopeInterval(chunks);
+}
+
 void
 RubberBandStretcher::setKeyFrameMap(const map<size_t, size_t> &mapping)
 {
@@ -147,6 +165,25 @@ RubberBandStretcher::process(const float *const *input, size_t samples,
     m_d->process(input, samples, final);
 }
 
+vector<char>
+RubberBandStretcher::getStudyData() const
+{
+    return m_d->getStudyData();
+}
+
+bool
+RubberBandStretcher::setStudyData(const vector<char> &data)
+{
+    return m_d->setStudyData(data);
+}
+
+size_t
+RubberBandStretcher::processWhole(const float *const *input, size_t samples,
+                                  float *const *output, size_t outputSize)
+{
+    return m_d->processWhole(input, samples, output, outputSize);
+}
+
 int
 RubberBandStretcher::available() const
 {
@@ -219,5 +256,35 @@ RubberBandStretcher::setDefaultDebugLevel(int level)
     Impl::setDefaultDebugLevel(level);
 }
 
+void
+RubberBandStretcher::setProfilingEnabled(bool enabled)
+{
+    Profiler::setEnabled(enabled);
+}
+
+std::vector<RubberBandStretcher::ProfileScope>
+RubberBandStretcher::getProfileSnapshot()
+{
+    std::vector<Profiler::Stats> stats = Profiler::getStats();
+    std::vector<ProfileScope> scopes;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        ProfileScope scope;
+        scope.name = stats[i].name;
+        scope.calls = stats[i].calls;
+        scope.totalMs = stats[i].total;
+        scope.p50Ms = stats[i].p50;
+        scope.p99Ms = stats[i].p99;
+        scope.worstMs = stats[i].worst;
+        scopes.push_back(scope);
+    }
+    return scopes;
+}
+
+void
+RubberBandStretcher::resetProfile()
+{
+    Profiler::clear();
+}
+
 }
 
@@ -75,13 +75,16 @@ RubberBandStretcher::Impl::ChannelData::construct(const std::set<size_t> &sizes,
 
     inbuf = new RingBuffer<float>(maxSize);
     outbuf = new RingBuffer<float>(outbufSize);
+    allocSize = maxSize;
 
     mag = allocate_and_zero<process_t>(realSize);
     phase = allocate_and_zero<process_t>(realSize);
     prevPhase = allocate_and_zero<process_t>(realSize);
     prevError = allocate_and_zero<process_t>(realSize);
-    unwrappedPhase = allocate_and_zero<process_t>(realSize);
+    unwrappedPhase = allocate_and_zero<double>(realSize);
     envelope = allocate_and_zero<process_t>(realSize);
+    errorChange = allocate_and_zero<process_t>(realSize);
+    advance = allocate_and_zero<process_t>(realSize);
 
     fltbuf = allocate_and_zero<float>(maxSize);
     dblbuf = allocate_and_zero<process_t>(maxSize);
@@ -113,17 +116,72 @@ RubberBandStretcher::Impl::ChannelData::construct(const std::set<size_t> &sizes,
     windowAccumulator[0] = 1.f;
 }
 
+void
+RubberBandStretcher::Impl::ChannelData::reserve(const std::set<size_t> &sizes)
+{
+    if (sizes.empty()) return;
+
+    for (std::set<size_t>::const_iterator i = sizes.begin();
+         i != sizes.end(); ++i) {
+        if (ffts.find(*i) == ffts.end()) {
+            ffts[*i] = new FFT(*i);
+            if (sizeof(process_t) == sizeof(double)) {
+                ffts[*i]->initDouble();
+            } else {
+                ffts[*i]->initFloat();
+            }
+        }
+        // setSizes wants an inbuf of twice the larger of window and
+        // FFT size; have one ready for every size we could grow to
+        size_t sz = *i * 2;
+        if (sz > size_t(inbuf->getSize()) &&
+            spareInbufs.find(sz) == spareInbufs.end()) {
+            spareInbufs[sz] = new RingBuffer<float>(sz);
+        }
+    }
+
+    size_t maxSize = *sizes.rbegin() * 2;
+    if (maxSize <= allocSize) return;
+
+    size_t oldReal = allocSize / 2 + 1;
+    size_t realSize = maxSize / 2 + 1;
+
+    // Nothing has been processed yet, so there is nothing to lose
+    // here except the initial windowAccumulator value
+
+    mag = reallocate_and_zero(mag, oldReal, realSize);
+    phase = reallocate_and_zero(phase, oldReal, realSize);
+    prevPhase = reallocate_and_zero(prevPhase, oldReal, realSize);
+    prevError = reallocate_and_zero(prevError, oldReal, realSize);
+    unwrappedPhase = reallocate_and_zero(unwrappedPhase, oldReal, realSize);
+    envelope = reallocate_and_zero(envelope, oldReal, realSize);
+    errorChange = reallocate_and_zero(errorChange, oldReal, realSize);
+    advance = reallocate_and_zero(advance, oldReal, realSize);
+    fltbuf = reallocate_and_zero(fltbuf, allocSize, maxSize);
+    dblbuf = reallocate_and_zero(dblbuf, allocSize, maxSize);
+    ms = reallocate_and_zero(ms, allocSize, maxSize);
+    interpolator = reallocate_and_zero(interpolator, allocSize, maxSize);
+
+    accumulator = reallocate_and_zero_extension
+        (accumulator, allocSize, maxSize);
+
+    windowAccumulator = reallocate_and_zero_extension
+        (windowAccumulator, allocSize, maxSize);
+
+    allocSize = maxSize;
+}
+
 
 void
 RubberBandStretcher::Impl::ChannelData::setSizes(size_t windowSize,
-                                                 size_t fftSize)
+                                                 size_t fftSize,
+                                                 Scavenger<RingBuffer<float> > &scavenger)
 {
 //    std::cerr << "ChannelData::setSizes: windowSize = " << windowSize << ", fftSize = " << fftSize << std::endl;
 
     size_t maxSize = 2 * std::max(windowSize, fftSize);
     size_t realSize = maxSize / 2 + 1;
     size_t oldMax = inbuf->getSize();
-    size_t oldReal = oldMax / 2 + 1;
 
     if (oldMax >= maxSize) {
 
@@ -155,6 +213,7 @@ RubberBandStretcher::Impl::ChannelData::setSizes(size_t windowSize,
         v_zero(prevError, realSize);
         v_zero(unwrappedPhase, realSize);
 
+        envelopeAge = 0;
         return;
     }
 
@@ -165,30 +224,77 @@ RubberBandStretcher::Impl::ChannelData::setSizes(size_t windowSize,
     //is unavailable (since this should never normally be the case in
     //general use in RT mode)
 
-    RingBuffer<float> *newbuf = inbuf->resized(maxSize);
-    delete inbuf;
-    inbuf = newbuf;
+    std::map<size_t, RingBuffer<float> *>::iterator si =
+        spareInbufs.find(maxSize);
+
+    if (si != spareInbufs.end() && si->second) {
+
+        // Reserved in advance: move the pending input across, using
+        // fltbuf (which we're about to clear anyway) as scratch space
+        RingBuffer<float> *newbuf = si->second;
+        si->second = 0;
+        int n = inbuf->getReadSpace();
+        inbuf->read(fltbuf, n);
+        newbuf->write(fltbuf, n);
+        scavenger.claim(inbuf);
+        inbuf = newbuf;
+
+    } else {
+        RingBuffer<float> *newbuf = inbuf->resized(maxSize);
+        scavenger.claim(inbuf);
+        inbuf = newbuf;
+    }
 
-    // We don't want to preserve data in these arrays
+    // The arrays may already be big enough, if reserve was called
 
-    mag = reallocate_and_zero(mag, oldReal, realSize);
-    phase = reallocate_and_zero(phase, oldReal, realSize);
-    prevPhase = reallocate_and_zero(prevPhase, oldReal, realSize);
-    prevError = reallocate_and_zero(prevError, oldReal, realSize);
-    unwrappedPhase = reallocate_and_zero(unwrappedPhase, oldReal, realSize);
-    envelope = reallocate_and_zero(envelope, oldReal, realSize);
-    fltbuf = reallocate_and_zero(fltbuf, oldMax, maxSize);
-    dblbuf = reallocate_and_zero(dblbuf, oldMax, maxSize);
-    ms = reallocate_and_zero(ms, oldMax, maxSize);
-    interpolator = reallocate_and_zero(interpolator, oldMax, maxSize);
+    if (allocSize < maxSize) {
 
-    // But we do want to preserve data in these
+        size_t allocReal = allocSize / 2 + 1;
 
-    accumulator = reallocate_and_zero_extension
-        (accumulator, oldMax, maxSize);
+        // We don't want to preserve data in these arrays
 
-    windowAccumulator = reallocate_and_zero_extension
-        (windowAccumulator, oldMax, maxSize);
+        mag = reallocate_and_zero(mag, allocReal, realSize);
+        phase = reallocate_and_zero(phase, allocReal, realSize);
+        prevPhase = reallocate_and_zero(prevPhase, allocReal, realSize);
+        prevError = reallocate_and_zero(prevError, allocReal, realSize);
+        unwrappedPhase = reallocate_and_zero(unwrappedPhase, allocReal, realSize);
+        envelope = reallocate_and_zero(envelope, allocReal, realSize);
+        errorChange = reallocate_and_zero(errorChange, allocReal, realSize);
+        advance = reallocate_and_zero(advance, allocReal, realSize);
+        fltbuf = reallocate_and_zero(fltbuf, allocSize, maxSize);
+        dblbuf = reallocate_and_zero(dblbuf, allocSize, maxSize);
+        ms = reallocate_and_zero(ms, allocSize, maxSize);
+        interpolator = reallocate_and_zero(interpolator, allocSize, maxSize);
+
+        // But we do want to preserve data in these
+
+        accumulator = reallocate_and_zero_extension
+            (accumulator, allocSize, maxSize);
+
+        windowAccumulator = reallocate_and_zero_extension
+            (windowAccumulator, allocSize, maxSize);
+
+        allocSize = maxSize;
+
+    } else {
+
+        v_zero(mag, realSize);
+        v_zero(phase, realSize);
+        v_zero(prevPhase, realSize);
+        v_zero(prevError, realSize);
+        v_zero(unwrappedPhase, realSize);
+        v_zero(envelope, realSize);
+        v_zero(fltbuf, maxSize);
+        v_zero(dblbuf, maxSize);
+        v_zero(ms, maxSize);
+        v_zero(interpolator, maxSize);
+    }
+
+    // Anything beyond the old inbuf size in the accumulators is
+    // treated as new, whether or not it was already allocated
+
+    v_zero(accumulator + oldMax, maxSize - oldMax);
+    v_zero(windowAccumulator + oldMax, maxSize - oldMax);
 
     interpolatorScale = 0;
     
@@ -204,10 +310,12 @@ RubberBandStretcher::Impl::ChannelData::setSizes(size_t windowSize,
     }
     
     fft = ffts[fftSize];
+    envelopeAge = 0;
 }
 
 void
-RubberBandStretcher::Impl::ChannelData::setOutbufSize(size_t outbufSize)
+RubberBandStretcher::Impl::ChannelData::setOutbufSize(size_t outbufSize,
+                                                      Scavenger<RingBuffer<float> > &scavenger)
 {
     size_t oldSize = outbuf->getSize();
 
@@ -219,7 +327,7 @@ RubberBandStretcher::Impl::ChannelData::setOutbufSize(size_t outbufSize)
         //thread is calling process()
 
         RingBuffer<float> *newbuf = outbuf->resized(outbufSize);
-        delete outbuf;
+        scavenger.claim(outbuf);
         outbuf = newbuf;
     }
 }
@@ -246,6 +354,8 @@ RubberBandStretcher::Impl::ChannelData::~ChannelData()
     deallocate(prevError);
     deallocate(unwrappedPhase);
     deallocate(envelope);
+    deallocate(errorChange);
+    deallocate(advance);
     deallocate(interpolator);
     deallocate(ms);
     deallocate(accumulator);
@@ -257,6 +367,11 @@ RubberBandStretcher::Impl::ChannelData::~ChannelData()
          i != ffts.end(); ++i) {
         delete i->second;
     }
+
+    for (std::map<size_t, RingBuffer<float> *>::iterator i =
+             spareInbufs.begin(); i != spareInbufs.end(); ++i) {
+        delete i->second;
+    }
 }
 
 void
@@ -280,6 +395,7 @@ RubberBandStretcher::Impl::ChannelData::reset()
     accumulatorFill = 0;
     prevIncrement = 0;
     chunkCount = 0;
+    envelopeAge = 0;
     inCount = 0;
     inputSize = -1;
     outCount = 0;
@@ -82,21 +82,33 @@ public:
      * Set the FFT, analysis window, and buffer sizes.  If this
      * ChannelData was constructed with a set of sizes and the given
      * window and FFT sizes here were among them, no reallocation will
-     * be required.
+     * be required.  If the inbuf does have to be reallocated, the old
+     * one is handed to the scavenger rather than deleted.
      */
-    void setSizes(size_t windowSize, size_t fftSizes);
+    void setSizes(size_t windowSize, size_t fftSizes,
+                  Scavenger<RingBuffer<float> > &scavenger);
 
     /**
      * Set the outbufSize for the channel data.  Reallocation will
-     * occur.
+     * occur if the outbuf is smaller than this, in which case the old
+     * one is handed to the scavenger rather than deleted.
      */
-    void setOutbufSize(size_t outbufSize);
+    void setOutbufSize(size_t outbufSize,
+                       Scavenger<RingBuffer<float> > &scavenger);
 
     /**
      * Set the resampler buffer size.  Default if not called is no
      * buffer allocated at all.
      */
     void setResampleBufSize(size_t resamplebufSize);
+
+    /**
+     * Allocate in advance everything that setSizes would need in
+     * order to switch to any of the given window or FFT sizes, so
+     * that it can do so without allocating.  This does not change
+     * the current sizes.
+     */
+    void reserve(const std::set<size_t> &sizes);
     
     RingBuffer<float> *inbuf;
     RingBuffer<float> *outbuf;
@@ -106,7 +118,7 @@ public:
 
     process_t *prevPhase;
     process_t *prevError;
-    process_t *unwrappedPhase;
+    double *unwrappedPhase; // accumulated, so double whatever process_t is
 
     float *accumulator;
     size_t accumulatorFill;
@@ -118,6 +130,9 @@ public:
     float *fltbuf;
     process_t *dblbuf; // owned by FFT object, only used for time domain FFT i/o
     process_t *envelope; // for cepstral formant shift
+    size_t envelopeAge; // chunks since envelope was computed, 0 = stale
+    process_t *errorChange; // scratch for phase advance in modifyChunk
+    process_t *advance; // likewise
     bool unchanged;
 
     size_t prevIncrement; // only used in RT mode
@@ -138,6 +153,9 @@ public:
     size_t resamplebufSize;
 
 private:
+    size_t allocSize; // of the arrays above, may exceed inbuf size
+    std::map<size_t, RingBuffer<float> *> spareInbufs; // from reserve
+
     void construct(const std::set<size_t> &sizes,
                    size_t initialWindowSize, size_t initialFftSize,
                    size_t outbufSize);
@@ -36,13 +36,16 @@
 #include "StretcherChannelData.h"
 
 #include "base/Profiler.h"
+#include "system/VectorOps.h"
 
 #ifndef _WIN32
 #include <alloca.h>
+#include <unistd.h>
 #endif
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <set>
 #include <map>
 #include <algorithm>
@@ -86,6 +89,13 @@ RubberBandStretcher::Impl::Impl(size_t sampleRate,
     m_outbufSize(m_defaultFftSize * 2),
     m_maxProcessSize(m_defaultFftSize),
     m_expectedInputDuration(0),
+    m_outputLimit(-1),
+    m_linkedChunk(false),
+    m_smallBlocks(false),
+    m_chunkStage(0),
+    m_stagePhaseIncrement(0),
+    m_stageShiftIncrement(0),
+    m_stagePhaseReset(false),
 #ifndef NO_THREADING
     m_threaded(false),
 #endif
@@ -99,13 +109,17 @@ RubberBandStretcher::Impl::Impl(size_t sampleRate,
     m_studyFFT(0),
 #ifndef NO_THREADING
     m_spaceAvailable("space"),
+    m_abandoning(false),
 #endif
     m_inputDuration(0),
     m_detectorType(CompoundAudioCurve::CompoundDetector),
+    m_studyIncrement(0),
+    m_studyFftSize(0),
     m_silentHistory(0),
     m_lastProcessOutputIncrements(16),
     m_lastProcessPhaseResetDf(16),
     m_emergencyScavenger(10, 4),
+    m_outbufReader(m_emergencyScavenger.addReader()),
     m_phaseResetAudioCurve(0),
     m_stretchAudioCurve(0),
     m_silentAudioCurve(0),
@@ -113,7 +127,12 @@ RubberBandStretcher::Impl::Impl(size_t sampleRate,
     m_freq0(600),
     m_freq1(1200),
     m_freq2(12000),
-    m_baseFftSize(m_defaultFftSize)
+    m_baseFftSize(m_defaultFftSize),
+    m_minTimeRatio(std::min(initialTimeRatio, 0.5)),
+    m_maxTimeRatio(std::max(initialTimeRatio, 2.0)),
+    m_minPitchScale(std::min(initialPitchScale, 0.5)),
+    m_maxPitchScale(std::max(initialPitchScale, 2.0)),
+    m_formantEnvelopeInterval(1)
 {
     if (!_initialised) {
         system_specific_initialise();
@@ -130,6 +149,15 @@ RubberBandStretcher::Impl::Impl(size_t sampleRate,
 //    if (m_rateMultiple < 1.f) m_rateMultiple = 1.f;
     m_baseFftSize = roundUp(int(m_defaultFftSize * m_rateMultiple));
 
+    if ((options & OptionProcessRealTime) &&
+        (options & OptionProcessSmallBlocks)) {
+        m_smallBlocks = true;
+        if (!(options & OptionWindowLong)) {
+            options |= OptionWindowShort;
+            m_options |= OptionWindowShort;
+        }
+    }
+
     if ((options & OptionWindowShort) || (options & OptionWindowLong)) {
         if ((options & OptionWindowShort) && (options & OptionWindowLong)) {
             cerr << "RubberBandStretcher::Impl::Impl: Cannot specify OptionWindowLong and OptionWindowShort together; falling back to OptionWindowStandard" << endl;
@@ -167,6 +195,8 @@ RubberBandStretcher::Impl::Impl(size_t sampleRate,
 
         if (m_realtime) {
             m_threaded = false;
+        } else if (m_options & OptionChannelsLinked) {
+            m_threaded = false;
         } else if (m_options & OptionThreadingNever) {
             m_threaded = false;
         } else if (!(m_options & OptionThreadingAlways) &&
@@ -187,15 +217,9 @@ RubberBandStretcher::Impl::~Impl()
 {
 #ifndef NO_THREADING
     if (m_threaded) {
-        MutexLocker locker(&m_threadSetMutex);
-        for (set<ProcessThread *>::iterator i = m_threadSet.begin();
-             i != m_threadSet.end(); ++i) {
-            if (m_debugLevel > 0) {
-                cerr << "RubberBandStretcher::~RubberBandStretcher: joining (channel " << *i << ")" << endl;
-            }
-            (*i)->abandon();
-            (*i)->wait();
-            delete *i;
+        abandonJobs();
+        for (size_t c = 0; c < m_jobs.size(); ++c) {
+            delete m_jobs[c];
         }
     }
 #endif
@@ -210,13 +234,13 @@ RubberBandStretcher::Impl::~Impl()
     delete m_stretchCalculator;
     delete m_studyFFT;
 
-    for (map<size_t, Window<float> *>::iterator i = m_windows.begin();
+    for (map<size_t, const Window<float> *>::iterator i = m_windows.begin();
          i != m_windows.end(); ++i) {
-        delete i->second;
+        Window<float>::releaseShared(i->second);
     }
-    for (map<size_t, SincWindow<float> *>::iterator i = m_sincs.begin();
+    for (map<size_t, const SincWindow<float> *>::iterator i = m_sincs.begin();
          i != m_sincs.end(); ++i) {
-        delete i->second;
+        SincWindow<float>::releaseShared(i->second);
     }
 }
 
@@ -225,17 +249,11 @@ RubberBandStretcher::Impl::reset()
 {
 #ifndef NO_THREADING
     if (m_threaded) {
-        m_threadSetMutex.lock();
-        for (set<ProcessThread *>::iterator i = m_threadSet.begin();
-             i != m_threadSet.end(); ++i) {
-            if (m_debugLevel > 0) {
-                cerr << "RubberBandStretcher::~RubberBandStretcher: joining (channel " << *i << ")" << endl;
-            }
-            (*i)->abandon();
-            (*i)->wait();
-            delete *i;
+        abandonJobs();
+        m_jobMutex.lock();
+        for (size_t c = 0; c < m_jobs.size(); ++c) {
+            m_jobs[c]->finished = false;
         }
-        m_threadSet.clear();
     }
 #endif
 
@@ -249,6 +267,7 @@ RubberBandStretcher::Impl::reset()
         m_channelData[c]->reset();
     }
 
+    m_chunkStage = 0;
     m_mode = JustCreated;
     if (m_phaseResetAudioCurve) m_phaseResetAudioCurve->reset();
     if (m_stretchAudioCurve) m_stretchAudioCurve->reset();
@@ -256,8 +275,17 @@ RubberBandStretcher::Impl::reset()
     m_inputDuration = 0;
     m_silentHistory = 0;
 
+    // Otherwise the study results and increments for the next input
+    // would be appended to those from the last one
+    m_phaseResetDf.clear();
+    m_stretchDf.clear();
+    m_silence.clear();
+    m_outputIncrements.clear();
+    m_studyIncrement = 0;
+    m_studyFftSize = 0;
+
 #ifndef NO_THREADING
-    if (m_threaded) m_threadSetMutex.unlock();
+    if (m_threaded) m_jobMutex.unlock();
 #endif
 
     reconfigure();
@@ -341,6 +369,46 @@ RubberBandStretcher::Impl::setMaxProcessSize(size_t samples)
     reconfigure();
 }
 
+void
+RubberBandStretcher::Impl::setRealTimeRatioRange(double minTimeRatio,
+                                                 double maxTimeRatio,
+                                                 double minPitchScale,
+                                                 double maxPitchScale)
+{
+    if (!m_realtime) return;
+
+    if (m_mode != JustCreated) {
+        cerr << "RubberBandStretcher::Impl::setRealTimeRatioRange: Cannot set ratio range after processing has begun" << endl;
+        return;
+    }
+
+    if (minTimeRatio <= 0.0 || minTimeRatio > maxTimeRatio ||
+        minPitchScale <= 0.0 || minPitchScale > maxPitchScale) {
+        cerr << "RubberBandStretcher::Impl::setRealTimeRatioRange: Invalid range (time ratio " << minTimeRatio << " to " << maxTimeRatio << ", pitch scale " << minPitchScale << " to " << maxPitchScale << ")" << endl;
+        return;
+    }
+
+    m_minTimeRatio = minTimeRatio;
+    m_maxTimeRatio = maxTimeRatio;
+    m_minPitchScale = minPitchScale;
+    m_maxPitchScale = maxPitchScale;
+
+    // Rebuild the channels with buffers for the new range
+    for (size_t c = 0; c < m_channelData.size(); ++c) {
+        delete m_channelData[c];
+    }
+    m_channelData.clear();
+
+    configure();
+}
+
+void
+RubberBandStretcher::Impl::setFormantEnvelopeInterval(size_t chunks)
+{
+    if (chunks < 1) chunks = 1;
+    m_formantEnvelopeInterval = chunks;
+}
+
 void
 RubberBandStretcher::Impl::setKeyFrameMap(const std::map<size_t, size_t> &
                                           mapping)
@@ -515,6 +583,12 @@ RubberBandStretcher::Impl::calculateSizes()
         }
     }
 
+    if (m_studyIncrement > 0) {
+        // Imported study data only fits the sizes it was made with
+        inputIncrement = m_studyIncrement;
+        windowSize = m_studyFftSize;
+    }
+
     // m_fftSize can be almost anything, but it can't be greater than
     // 4 * m_baseFftSize unless ratio is less than 1/1024.
 
@@ -573,6 +647,94 @@ RubberBandStretcher::Impl::calculateSizes()
     }
 }
 
+void
+RubberBandStretcher::Impl::calculateRealTimeSizes(set<size_t> &windowSizes,
+                                                  size_t &outbufSize,
+                                                  size_t &resamplebufSize)
+{
+    // Find every window and FFT size, and the largest buffers, that
+    // calculateSizes can produce for time ratios and pitch scales
+    // in the configured range, by trying it at points across the
+    // range.  The sizes only change at powers of two, so a modest
+    // number of points per octave is plenty.  Allocating for all of
+    // these on construction means reconfigure never has to.
+
+    std::vector<double> ratios, scales;
+    const int steps = 24;
+    for (int i = 0; i <= steps; ++i) {
+        ratios.push_back(m_minTimeRatio *
+                         pow(m_maxTimeRatio / m_minTimeRatio, double(i) / steps));
+        scales.push_back(m_minPitchScale *
+                         pow(m_maxPitchScale / m_minPitchScale, double(i) / steps));
+    }
+    ratios.push_back(m_timeRatio);
+    scales.push_back(m_pitchScale);
+    if (m_minTimeRatio <= 1.0 && m_maxTimeRatio >= 1.0) ratios.push_back(1.0);
+    if (m_minPitchScale <= 1.0 && m_maxPitchScale >= 1.0) scales.push_back(1.0);
+
+    double timeRatio = m_timeRatio;
+    double pitchScale = m_pitchScale;
+    size_t fftSize = m_fftSize;
+    size_t aWindowSize = m_aWindowSize;
+    size_t sWindowSize = m_sWindowSize;
+    size_t increment = m_increment;
+    size_t currentOutbufSize = m_outbufSize;
+    size_t maxProcessSize = m_maxProcessSize;
+    int debugLevel = m_debugLevel;
+
+    m_debugLevel = 0;
+
+    // Two passes, because the outbuf size depends on the largest
+    // window size seen so far (via m_maxProcessSize)
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < ratios.size(); ++i) {
+            for (size_t j = 0; j < scales.size(); ++j) {
+
+                m_timeRatio = ratios[i];
+                m_pitchScale = scales[j];
+                calculateSizes();
+
+                windowSizes.insert(m_fftSize);
+                windowSizes.insert(m_aWindowSize);
+                windowSizes.insert(m_sWindowSize);
+
+                if (m_outbufSize > outbufSize) outbufSize = m_outbufSize;
+
+                // Resampling after stretching takes up to a chunk's
+                // output increment at a time, resampling before
+                // takes whatever the inbuf has room for; the inbuf
+                // size comes from the window sizes below
+                size_t rbs = lrint(ceil((std::max(m_aWindowSize, m_sWindowSize)
+                                         * 2) / m_pitchScale));
+                if (rbs > resamplebufSize) resamplebufSize = rbs;
+            }
+        }
+    }
+
+    // The inbuf may grow to twice the largest size (see
+    // ChannelData::reserve)
+    size_t inbufSize = *windowSizes.rbegin() * 2;
+    if (inbufSize + 1 > resamplebufSize) resamplebufSize = inbufSize + 1;
+
+    m_timeRatio = timeRatio;
+    m_pitchScale = pitchScale;
+    m_fftSize = fftSize;
+    m_aWindowSize = aWindowSize;
+    m_sWindowSize = sWindowSize;
+    m_increment = increment;
+    m_outbufSize = currentOutbufSize;
+    m_maxProcessSize = maxProcessSize;
+    m_debugLevel = debugLevel;
+
+    if (m_debugLevel > 0) {
+        cerr << "calculateRealTimeSizes: " << windowSizes.size()
+             << " window sizes from " << *windowSizes.begin()
+             << " to " << *windowSizes.rbegin() << ", outbuf size = "
+             << outbufSize << ", resample buffer size = "
+             << resamplebufSize << endl;
+    }
+}
+
 void
 RubberBandStretcher::Impl::configure()
 {
@@ -616,15 +778,27 @@ RubberBandStretcher::Impl::configure()
     windowSizes.insert(m_aWindowSize);
     windowSizes.insert(m_sWindowSize);
 
-    if (windowSizeChanged) {
+    // In RT mode, also every size reachable within the ratio range,
+    // for which we allocate up front but without otherwise changing
+    // the initial buffer sizes
+    set<size_t> allSizes = windowSizes;
+    size_t outbufSize = m_outbufSize;
+    size_t resamplebufSize = 0;
+    if (m_realtime) {
+        calculateRealTimeSizes(allSizes, outbufSize, resamplebufSize);
+    }
+
+    bool rebuild = m_channelData.empty();
+
+    if (windowSizeChanged || rebuild) {
 
-        for (set<size_t>::const_iterator i = windowSizes.begin();
-             i != windowSizes.end(); ++i) {
+        for (set<size_t>::const_iterator i = allSizes.begin();
+             i != allSizes.end(); ++i) {
             if (m_windows.find(*i) == m_windows.end()) {
-                m_windows[*i] = new Window<float>(HanningWindow, *i);
+                m_windows[*i] = Window<float>::getShared(HanningWindow, *i);
             }
             if (m_sincs.find(*i) == m_sincs.end()) {
-                m_sincs[*i] = new SincWindow<float>(*i, *i);
+                m_sincs[*i] = SincWindow<float>::getShared(*i, *i);
             }
         }
         m_awindow = m_windows[m_aWindowSize];
@@ -636,7 +810,7 @@ RubberBandStretcher::Impl::configure()
         }
     }
 
-    if (windowSizeChanged || outbufSizeChanged) {
+    if (windowSizeChanged || outbufSizeChanged || rebuild) {
         
         for (size_t c = 0; c < m_channelData.size(); ++c) {
             delete m_channelData[c];
@@ -648,7 +822,10 @@ RubberBandStretcher::Impl::configure()
                 (new ChannelData(windowSizes,
                                  std::max(m_aWindowSize, m_sWindowSize),
                                  m_fftSize,
-                                 m_outbufSize));
+                                 outbufSize));
+            if (m_realtime) {
+                m_channelData[c]->reserve(allSizes);
+            }
         }
     }
 
@@ -676,7 +853,13 @@ RubberBandStretcher::Impl::configure()
             size_t rbs = 
                 lrintf(ceil((m_increment * m_timeRatio * 2) / m_pitchScale));
             if (rbs < m_increment * 16) rbs = m_increment * 16;
+            if (rbs < resamplebufSize) rbs = resamplebufSize;
             m_channelData[c]->setResampleBufSize(rbs);
+
+            if (m_realtime) {
+                m_channelData[c]->resampler->reserve
+                    (float(1.0 / m_maxPitchScale));
+            }
         }
     }
     
@@ -689,6 +872,13 @@ RubberBandStretcher::Impl::configure()
         (CompoundAudioCurve::Parameters(m_sampleRate, m_fftSize));
     m_phaseResetAudioCurve->setType(m_detectorType);
 
+    if (m_realtime) {
+        // Make room for the largest FFT size, so that reconfigure can
+        // change size without reallocating
+        m_phaseResetAudioCurve->setFftSize(*allSizes.rbegin());
+        m_phaseResetAudioCurve->setFftSize(m_fftSize);
+    }
+
     delete m_silentAudioCurve;
     m_silentAudioCurve = new SilentAudioCurve
         (SilentAudioCurve::Parameters(m_sampleRate, m_fftSize));
@@ -710,7 +900,9 @@ RubberBandStretcher::Impl::configure()
          !(m_options & OptionTransientsSmooth));
 
     m_stretchCalculator->setDebugLevel(m_debugLevel);
-    m_inputDuration = 0;
+
+    // Imported study data brings its own input duration
+    if (m_studyIncrement == 0) m_inputDuration = 0;
 
     // Prepare the inbufs with half a chunk of emptiness.  The centre
     // point of the first processing chunk for the onset detector
@@ -751,6 +943,13 @@ RubberBandStretcher::Impl::reconfigure()
         configure();
     }
 
+    if (m_chunkStage > 0) {
+        // The sizes may be about to change, so finish the chunk that
+        // OptionProcessSmallBlocks has left part-processed first
+        bool last = false;
+        while (m_chunkStage > 0) processChunkStage(last);
+    }
+
     size_t prevFftSize = m_fftSize;
     size_t prevAWindowSize = m_aWindowSize;
     size_t prevSWindowSize = m_sWindowSize;
@@ -761,26 +960,28 @@ RubberBandStretcher::Impl::reconfigure()
     // There are various allocations in this function, but they should
     // never happen in normal use -- they just recover from the case
     // where not all of the things we need were correctly created when
-    // we first configured (for whatever reason).  This is intended to
-    // be "effectively" realtime safe.  The same goes for
-    // ChannelData::setOutbufSize and setSizes.
+    // we first configured, which in RT mode means the ratio has gone
+    // outside the range given to setRealTimeRatioRange.  Within the
+    // range this only selects among preallocated objects.  The same
+    // goes for ChannelData::setOutbufSize and setSizes, which pass
+    // any buffers they replace to the scavenger.
 
     if (m_aWindowSize != prevAWindowSize ||
         m_sWindowSize != prevSWindowSize) {
 
         if (m_windows.find(m_aWindowSize) == m_windows.end()) {
             std::cerr << "WARNING: reconfigure(): window allocation (size " << m_aWindowSize << ") required in RT mode" << std::endl;
-            m_windows[m_aWindowSize] = new Window<float>
+            m_windows[m_aWindowSize] = Window<float>::getShared
                 (HanningWindow, m_aWindowSize);
-            m_sincs[m_aWindowSize] = new SincWindow<float>
+            m_sincs[m_aWindowSize] = SincWindow<float>::getShared
                 (m_aWindowSize, m_aWindowSize);
         }
 
         if (m_windows.find(m_sWindowSize) == m_windows.end()) {
             std::cerr << "WARNING: reconfigure(): window allocation (size " << m_sWindowSize << ") required in RT mode" << std::endl;
-            m_windows[m_sWindowSize] = new Window<float>
+            m_windows[m_sWindowSize] = Window<float>::getShared
                 (HanningWindow, m_sWindowSize);
-            m_sincs[m_sWindowSize] = new SincWindow<float>
+            m_sincs[m_sWindowSize] = SincWindow<float>::getShared
                 (m_sWindowSize, m_sWindowSize);
         }
 
@@ -790,13 +991,14 @@ RubberBandStretcher::Impl::reconfigure()
 
         for (size_t c = 0; c < m_channels; ++c) {
             m_channelData[c]->setSizes(std::max(m_aWindowSize, m_sWindowSize),
-                                       m_fftSize);
+                                       m_fftSize, m_emergencyScavenger);
         }
     }
 
     if (m_outbufSize != prevOutbufSize) {
         for (size_t c = 0; c < m_channels; ++c) {
-            m_channelData[c]->setOutbufSize(m_outbufSize);
+            m_channelData[c]->setOutbufSize(m_outbufSize,
+                                            m_emergencyScavenger);
         }
     }
 
@@ -827,7 +1029,13 @@ size_t
 RubberBandStretcher::Impl::getLatency() const
 {
     if (!m_realtime) return 0;
-    return int((m_aWindowSize/2) / m_pitchScale + 1);
+    size_t latency = m_aWindowSize/2;
+    if (m_smallBlocks) {
+        // a chunk's output is complete only once the input for the
+        // next chunk has arrived
+        latency += m_increment;
+    }
+    return int(latency / m_pitchScale + 1);
 }
 
 void
@@ -924,6 +1132,11 @@ RubberBandStretcher::Impl::study(const float *const *input, size_t samples, bool
         cerr << "RubberBandStretcher::Impl::study: Cannot study after processing" << endl;
         return;
     }
+
+    if (m_studyIncrement > 0) {
+        cerr << "RubberBandStretcher::Impl::study: Cannot study after setStudyData" << endl;
+        return;
+    }
     m_mode = Studying;
     
     size_t consumed = 0;
@@ -970,8 +1183,13 @@ RubberBandStretcher::Impl::study(const float *const *input, size_t samples, bool
             consumed += writable;
         }
 
+        // Only take a short final chunk once all of the input has
+        // been written, not just whatever fitted into inbuf so far
+
+        bool last = (final && consumed == samples);
+
 	while ((inbuf.getReadSpace() >= int(m_aWindowSize)) ||
-               (final && (inbuf.getReadSpace() >= int(m_aWindowSize/2)))) {
+               (last && (inbuf.getReadSpace() >= int(m_aWindowSize/2)))) {
 
 	    // We know we have at least m_aWindowSize samples
 	    // available in m_inbuf.  We need to peek m_aWindowSize of
@@ -982,18 +1200,37 @@ RubberBandStretcher::Impl::study(const float *const *input, size_t samples, bool
             // so we can use it as a temporary buffer here
 
             size_t ready = inbuf.getReadSpace();
-            assert(final || ready >= m_aWindowSize);
-            inbuf.peek(cd.accumulator, std::min(ready, m_aWindowSize));
+            assert(last || ready >= m_aWindowSize);
 
-            if (m_aWindowSize == m_fftSize) {
+            if (m_aWindowSize == m_fftSize && ready >= m_aWindowSize) {
 
                 // We don't need the fftshift for studying, as we're
-                // only interested in magnitude.
+                // only interested in magnitude.  So we can window
+                // straight from inbuf into the FFT input without
+                // copying first.
+
+                const float *first, *second;
+                int firstCount, secondCount;
+                inbuf.peekSpans(m_aWindowSize,
+                                first, firstCount, second, secondCount);
+
+                m_awindow->cut(first, cd.accumulator, 0, firstCount);
+                if (secondCount > 0) {
+                    m_awindow->cut(second, cd.accumulator + firstCount,
+                                   firstCount, secondCount);
+                }
 
+            } else if (m_aWindowSize == m_fftSize) {
+
+                // Short final chunk
+
+                inbuf.peek(cd.accumulator, ready);
                 m_awindow->cut(cd.accumulator);
 
             } else {
 
+                inbuf.peek(cd.accumulator, std::min(ready, m_aWindowSize));
+
                 // If we need to fold (i.e. if the window size is
                 // greater than the fft size so we are doing a
                 // time-aliased presum fft) or zero-pad, then we might
@@ -1061,6 +1298,189 @@ RubberBandStretcher::Impl::study(const float *const *input, size_t samples, bool
     if (m_channels > 1 || final) delete[] mdalloc;
 }
 
+// Study data layout, all values 32-bit little-endian: magic, version,
+// sample rate, detector type, option flags, fft size, increment,
+// input duration (low word then high), chunk count n; then n phase
+// reset df values, n stretch df values, and the silence flags packed
+// eight to a byte
+
+static const char studyMagic[4] = { 'R', 'B', 's', 'd' };
+static const unsigned int studyVersion = 1;
+static const size_t studyHeaderSize = 4 + 9 * 4;
+
+enum {
+    StudyStretchPrecise = 1,
+    StudySmoothing = 2
+};
+
+static void
+putStudyWord(vector<char> &data, unsigned int w)
+{
+    for (int i = 0; i < 4; ++i) {
+        data.push_back(char((w >> (i * 8)) & 0xff));
+    }
+}
+
+static unsigned int
+getStudyWord(const vector<char> &data, size_t &index)
+{
+    unsigned int w = 0;
+    for (int i = 0; i < 4; ++i) {
+        w |= (unsigned int)(unsigned char)data[index++] << (i * 8);
+    }
+    return w;
+}
+
+static unsigned int
+studyFloatBits(float f)
+{
+    unsigned int w;
+    memcpy(&w, &f, sizeof(w));
+    return w;
+}
+
+static float
+studyBitsFloat(unsigned int w)
+{
+    float f;
+    memcpy(&f, &w, sizeof(f));
+    return f;
+}
+
+vector<char>
+RubberBandStretcher::Impl::getStudyData() const
+{
+    vector<char> data;
+
+    // Processing goes on to update the input duration, so the
+    // results are only complete in between
+    if (m_realtime) return data;
+    if (m_mode != Studying && !(m_mode == JustCreated && m_studyIncrement > 0)) {
+        return data;
+    }
+
+    const size_t n = m_phaseResetDf.size();
+    if (n == 0 || m_stretchDf.size() != n || m_silence.size() != n) {
+        return data;
+    }
+
+    unsigned int flags = 0;
+    if (m_options & OptionStretchPrecise) flags |= StudyStretchPrecise;
+    if (m_options & OptionSmoothingOn) flags |= StudySmoothing;
+
+    data.reserve(studyHeaderSize + n * 8 + (n + 7) / 8);
+
+    for (int i = 0; i < 4; ++i) {
+        data.push_back(studyMagic[i]);
+    }
+    putStudyWord(data, studyVersion);
+    putStudyWord(data, (unsigned int)m_sampleRate);
+    putStudyWord(data, (unsigned int)m_detectorType);
+    putStudyWord(data, flags);
+    putStudyWord(data, (unsigned int)m_fftSize);
+    putStudyWord(data, (unsigned int)m_increment);
+    putStudyWord(data, (unsigned int)(m_inputDuration & 0xffffffffu));
+    putStudyWord(data, (unsigned int)((unsigned long long)m_inputDuration >> 32));
+    putStudyWord(data, (unsigned int)n);
+
+    for (size_t i = 0; i < n; ++i) {
+        putStudyWord(data, studyFloatBits(m_phaseResetDf[i]));
+    }
+    for (size_t i = 0; i < n; ++i) {
+        putStudyWord(data, studyFloatBits(m_stretchDf[i]));
+    }
+    for (size_t i = 0; i < n; i += 8) {
+        unsigned char bits = 0;
+        for (size_t j = 0; j < 8 && i + j < n; ++j) {
+            if (m_silence[i + j]) bits |= (unsigned char)(1 << j);
+        }
+        data.push_back(char(bits));
+    }
+
+    return data;
+}
+
+bool
+RubberBandStretcher::Impl::setStudyData(const vector<char> &data)
+{
+    if (m_realtime) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Not available in realtime mode" << endl;
+        return false;
+    }
+
+    if (m_mode != JustCreated) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Cannot set study data after study() or process()" << endl;
+        return false;
+    }
+
+    if (data.size() < studyHeaderSize ||
+        memcmp(&data[0], studyMagic, 4) != 0) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Not study data" << endl;
+        return false;
+    }
+
+    size_t index = 4;
+    unsigned int version = getStudyWord(data, index);
+    unsigned int sampleRate = getStudyWord(data, index);
+    unsigned int detectorType = getStudyWord(data, index);
+    unsigned int flags = getStudyWord(data, index);
+    unsigned int fftSize = getStudyWord(data, index);
+    unsigned int increment = getStudyWord(data, index);
+    unsigned long long duration = getStudyWord(data, index);
+    duration |= (unsigned long long)getStudyWord(data, index) << 32;
+    size_t n = getStudyWord(data, index);
+
+    if (version != studyVersion) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Unsupported study data version " << version << endl;
+        return false;
+    }
+
+    if (n == 0 || n > (data.size() - studyHeaderSize) / 8 ||
+        data.size() != studyHeaderSize + n * 8 + (n + 7) / 8 ||
+        fftSize < 16 || fftSize > 1048576 || (fftSize & (fftSize - 1)) ||
+        increment == 0 || increment >= fftSize) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Study data is truncated or corrupt" << endl;
+        return false;
+    }
+
+    unsigned int ourFlags = 0;
+    if (m_options & OptionStretchPrecise) ourFlags |= StudyStretchPrecise;
+    if (m_options & OptionSmoothingOn) ourFlags |= StudySmoothing;
+
+    if (sampleRate != m_sampleRate ||
+        detectorType != (unsigned int)m_detectorType ||
+        flags != ourFlags) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: Study data was made with a different sample rate or options" << endl;
+        return false;
+    }
+
+    m_phaseResetDf.resize(n);
+    m_stretchDf.resize(n);
+    m_silence.resize(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        m_phaseResetDf[i] = studyBitsFloat(getStudyWord(data, index));
+    }
+    for (size_t i = 0; i < n; ++i) {
+        m_stretchDf[i] = studyBitsFloat(getStudyWord(data, index));
+    }
+    for (size_t i = 0; i < n; ++i) {
+        unsigned char bits = (unsigned char)data[index + i / 8];
+        m_silence[i] = ((bits >> (i % 8)) & 1) != 0;
+    }
+
+    m_inputDuration = size_t(duration);
+    m_studyIncrement = increment;
+    m_studyFftSize = fftSize;
+
+    if (m_debugLevel > 0) {
+        cerr << "RubberBandStretcher::Impl::setStudyData: " << n << " chunks, fft size " << fftSize << ", increment " << increment << ", input duration " << m_inputDuration << endl;
+    }
+
+    reconfigure();
+    return true;
+}
+
 vector<int>
 RubberBandStretcher::Impl::getOutputIncrements() const
 {
@@ -1174,6 +1594,9 @@ RubberBandStretcher::Impl::getSamplesRequired() const
 {
     Profiler profiler("RubberBandStretcher::Impl::getSamplesRequired");
 
+    Scavenger<RingBuffer<float> >::ReadSection section
+        (m_emergencyScavenger, m_outbufReader);
+
     size_t reqd = 0;
 
     for (size_t c = 0; c < m_channels; ++c) {
@@ -1232,7 +1655,13 @@ RubberBandStretcher::Impl::process(const float *const *input, size_t samples, bo
 
     if (m_mode == JustCreated || m_mode == Studying) {
 
-        if (m_mode == Studying) {
+        if (m_mode == JustCreated && m_studyIncrement > 0) {
+
+            // Study data was imported, and the input buffers were
+            // prefilled in configure() as usual
+            calculateStretch();
+
+        } else if (m_mode == Studying) {
 
             calculateStretch();
 
@@ -1250,17 +1679,17 @@ RubberBandStretcher::Impl::process(const float *const *input, size_t samples, bo
         }
 
 #ifndef NO_THREADING
-        if (m_threaded) {
-            MutexLocker locker(&m_threadSetMutex);
+        if (m_threaded && m_jobs.empty()) {
+            MutexLocker locker(&m_jobMutex);
 
             for (size_t c = 0; c < m_channels; ++c) {
-                ProcessThread *thread = new ProcessThread(this, c);
-                m_threadSet.insert(thread);
-                thread->start();
+                m_jobs.push_back(new ChannelJob(this, c));
             }
             
             if (m_debugLevel > 0) {
-                cerr << m_channels << " threads created" << endl;
+                cerr << m_channels << " channel jobs created for pool of "
+                     << ThreadPool::getInstance()->getWorkerCount()
+                     << " threads" << endl;
             }
         }
 #endif
@@ -1304,25 +1733,37 @@ RubberBandStretcher::Impl::process(const float *const *input, size_t samples, bo
 #ifndef NO_THREADING
                 !m_threaded &&
 #endif
-                !m_realtime) {
+                !m_realtime && !(m_options & OptionChannelsLinked)) {
                 bool any = false, last = false;
                 processChunks(c, any, last);
             }
         }
 
+        if (!m_realtime && (m_options & OptionChannelsLinked)) {
+            // All channels must have their input before any can be
+            // processed
+            bool any = false, last = false;
+            processLinkedChunks(any, last);
+        }
+
         if (m_realtime) {
             // When running in real time, we need to process both
             // channels in step because we will need to use the sum of
             // their frequency domain representations as the input to
             // the realtime onset detector
-            processOneChunk();
+            if (m_smallBlocks && allConsumed && !final) {
+                size_t added = samples;
+                if (resampleBeforeStretching()) {
+                    added = size_t(ceil(samples / m_pitchScale));
+                }
+                processChunkStagesForBlock(added);
+            } else {
+                processOneChunk();
+            }
         }
 #ifndef NO_THREADING
         if (m_threaded) {
-            for (ThreadSet::iterator i = m_threadSet.begin();
-                 i != m_threadSet.end(); ++i) {
-                (*i)->signalDataAvailable();
-            }
+            submitJobs();
             m_spaceAvailable.lock();
             if (!allConsumed) {
                 m_spaceAvailable.wait(500);
@@ -1343,6 +1784,487 @@ RubberBandStretcher::Impl::process(const float *const *input, size_t samples, bo
     if (final) m_mode = Finished;
 }
 
+size_t
+RubberBandStretcher::Impl::processWhole(const float *const *input,
+                                        size_t samples,
+                                        float *const *output,
+                                        size_t outputSize)
+{
+    Profiler profiler("RubberBandStretcher::Impl::processWhole");
+
+    if (m_realtime) {
+        cerr << "RubberBandStretcher::Impl::processWhole: Not available in realtime mode" << endl;
+        return 0;
+    }
+
+    if (m_mode != JustCreated) {
+        cerr << "RubberBandStretcher::Impl::processWhole: Cannot process whole input after study() or process()" << endl;
+        return 0;
+    }
+
+    for (size_t c = 0; c < m_channels; ++c) {
+        v_zero(output[c], int(outputSize));
+    }
+
+    // Segments of at least ten seconds, and no more of them than
+    // there are worker threads
+
+    size_t segmentCount = 1;
+
+#ifndef NO_THREADING
+    if (!(m_options & OptionThreadingNever)) {
+        segmentCount = std::min(size_t(ThreadPool::getInstance()->getWorkerCount()),
+                                samples / (m_sampleRate * 10));
+    }
+#endif
+
+    // Imported study data can't be split between segments, and
+    // there is nothing left to study in parallel anyway
+    if (m_studyIncrement > 0) segmentCount = 1;
+
+    if (segmentCount < 2) {
+        
+        // Just do it the usual way
+
+        const float **in = (const float **)alloca(m_channels * sizeof(float *));
+        float **out = (float **)alloca(m_channels * sizeof(float *));
+
+        if (m_studyIncrement == 0) {
+            study(input, samples, true);
+        }
+
+        size_t done = 0, written = 0;
+
+        while (written < outputSize) {
+            if (done < samples) {
+                size_t n = std::min(m_maxProcessSize, samples - done);
+                for (size_t c = 0; c < m_channels; ++c) {
+                    in[c] = input[c] + done;
+                }
+                done += n;
+                process(in, n, done == samples);
+            }
+            int avail = available();
+            if (avail < 0) break;
+            if (avail == 0) {
+#ifndef NO_THREADING
+                if (m_threaded && done == samples) usleep(1000);
+#endif
+                continue;
+            }
+            for (size_t c = 0; c < m_channels; ++c) {
+                out[c] = output[c] + written;
+            }
+            written += retrieve(out, std::min(size_t(avail),
+                                              outputSize - written));
+        }
+
+        return written;
+    }
+
+#ifndef NO_THREADING
+
+    if (m_debugLevel > 0) {
+        cerr << "RubberBandStretcher::Impl::processWhole: " << samples
+             << " samples in " << segmentCount << " segments" << endl;
+    }
+
+    const size_t half = m_aWindowSize / 2;
+    std::vector<Segment> segments(segmentCount);
+
+    // Study the segments in parallel. Each starts a little early, so
+    // that by the first chunk it keeps the detectors have seen as
+    // much of the input as they would have in a single pass, and the
+    // results can simply be put end to end.
+
+    const size_t approxChunks = samples / m_increment + 1;
+    const size_t studyPreroll = half / m_increment + 32;
+
+    for (size_t i = 0; i < segmentCount; ++i) {
+        Segment &seg = segments[i];
+        seg.keepFrom = (approxChunks * i) / segmentCount;
+        seg.keepTo = (approxChunks * (i + 1)) / segmentCount;
+        seg.from = (seg.keepFrom > studyPreroll ?
+                    seg.keepFrom - studyPreroll : 0);
+        seg.to = seg.keepTo;
+    }
+
+    runSegmentJobs(input, samples, segments, true);
+
+    m_phaseResetDf.clear();
+    m_stretchDf.clear();
+    m_silence.clear();
+
+    for (size_t i = 0; i < segmentCount; ++i) {
+        Segment &seg = segments[i];
+        m_phaseResetDf.insert(m_phaseResetDf.end(),
+                              seg.phaseResetDf.begin(), seg.phaseResetDf.end());
+        m_stretchDf.insert(m_stretchDf.end(),
+                           seg.stretchDf.begin(), seg.stretchDf.end());
+        m_silence.insert(m_silence.end(),
+                         seg.silence.begin(), seg.silence.end());
+    }
+
+    m_inputDuration = samples;
+    m_mode = Studying;
+    calculateStretch();
+
+    std::vector<int> &increments = m_outputIncrements;
+    const size_t chunks = increments.size();
+
+    // Join the segments at phase resets. After a reset the output no
+    // longer depends on what came before it, so once a synthesis
+    // window has passed the segments either side of the join produce
+    // the same output and can be crossfaded without any phasiness.
+    // Use the transient nearest to each nominal join point, within a
+    // couple of seconds, or else add a reset there.
+
+    std::vector<size_t> joins(segmentCount + 1);
+    joins[0] = 0;
+    joins[segmentCount] = chunks;
+
+    const size_t range = (m_sampleRate * 2) / m_increment;
+
+    for (size_t i = 1; i < segmentCount; ++i) {
+        size_t nominal = (chunks * i) / segmentCount;
+        size_t join = nominal;
+        bool found = false;
+        for (size_t d = 0; d <= range && !found; ++d) {
+            if (nominal + d < chunks && increments[nominal + d] < 0) {
+                join = nominal + d;
+                found = true;
+            } else if (d <= nominal && increments[nominal - d] < 0) {
+                join = nominal - d;
+                found = true;
+            }
+        }
+        if (!found) {
+            increments[join] = -increments[join];
+        }
+        if (m_debugLevel > 1) {
+            cerr << "processWhole: join " << i << " at chunk " << join
+                 << (found ? " (transient)" : " (added reset)") << endl;
+        }
+        joins[i] = join;
+    }
+
+    // Output frame at which each chunk's output starts. Each chunk
+    // is shifted by the following chunk's increment, as in
+    // getIncrements()
+
+    std::vector<double> position(chunks + 1);
+    position[0] = 0.0;
+    for (size_t i = 0; i < chunks; ++i) {
+        int shift = (i + 1 < chunks ? increments[i+1] : increments[i]);
+        position[i+1] = position[i] + abs(shift) / m_pitchScale;
+    }
+
+    const size_t settle = size_t(ceil(m_sWindowSize / m_pitchScale));
+    const size_t fade = m_sWindowSize;
+
+    std::vector<size_t> fadeStart(segmentCount, 0);
+    for (size_t i = 1; i < segmentCount; ++i) {
+        fadeStart[i] = lrint(position[joins[i]]) + settle;
+    }
+
+    // Process the segments in parallel, each starting far enough
+    // before its join for the analysis window to be full by then,
+    // and continuing until past the end of the following crossfade
+
+    const size_t processPreroll = half / m_increment + 2;
+
+    const long total = lrint(samples * m_timeRatio);
+
+    for (size_t i = 0; i < segmentCount; ++i) {
+        Segment &seg = segments[i];
+        seg.from = (i == 0 ? 0 : joins[i] - processPreroll);
+        seg.to = chunks;
+        seg.outputLimit = total - lrint(position[seg.from]);
+        if (i + 1 < segmentCount) {
+            double needed = fadeStart[i+1] + fade + settle;
+            seg.to = joins[i+1];
+            while (seg.to < chunks && position[seg.to] < needed) {
+                ++seg.to;
+            }
+        }
+    }
+
+    runSegmentJobs(input, samples, segments, false);
+
+    // Put the outputs together
+
+    std::vector<size_t> origin(segmentCount), length(segmentCount);
+    for (size_t i = 0; i < segmentCount; ++i) {
+        origin[i] = lrint(position[segments[i].from]);
+        length[i] = segments[i].output[0].size();
+    }
+
+    for (size_t i = 0; i < segmentCount; ++i) {
+
+        size_t from = (i == 0 ? 0 : fadeStart[i] + fade);
+        size_t to = (i + 1 == segmentCount ?
+                     origin[i] + length[i] : fadeStart[i+1]);
+        to = std::min(to, std::min(origin[i] + length[i], outputSize));
+
+        for (size_t c = 0; c < m_channels; ++c) {
+            const std::vector<float> &so = segments[i].output[c];
+            for (size_t j = from; j < to; ++j) {
+                output[c][j] = so[j - origin[i]];
+            }
+        }
+
+        if (i == 0) continue;
+
+        // Raised-cosine crossfade from the previous segment. The two
+        // should be identical here; but if the previous one has ended
+        // too soon, use this one alone rather than leave a gap
+
+        from = fadeStart[i];
+        to = std::min(fadeStart[i] + fade, outputSize);
+
+        for (size_t c = 0; c < m_channels; ++c) {
+            const std::vector<float> &prev = segments[i-1].output[c];
+            const std::vector<float> &so = segments[i].output[c];
+            for (size_t j = from; j < to; ++j) {
+                bool havePrev = (j < origin[i-1] + length[i-1]);
+                bool haveThis = (j < origin[i] + length[i]);
+                float g = float(0.5 - 0.5 * cos(M_PI * (j - from + 0.5) / fade));
+                if (havePrev && haveThis) {
+                    output[c][j] = (1.f - g) * prev[j - origin[i-1]] +
+                        g * so[j - origin[i]];
+                } else if (haveThis) {
+                    output[c][j] = so[j - origin[i]];
+                } else if (havePrev) {
+                    output[c][j] = prev[j - origin[i-1]];
+                }
+            }
+        }
+    }
+
+    m_mode = Finished;
+
+    size_t last = segmentCount - 1;
+    return std::min(origin[last] + length[last], outputSize);
+
+#else
+    return 0;
+#endif
+}
+
+RubberBandStretcher::Impl *
+RubberBandStretcher::Impl::createSegmentStretcher() const
+{
+    // Single-threaded, as the segments run in parallel with one
+    // another already
+
+    Options options = m_options;
+    options &= ~(OptionThreadingNever | OptionThreadingAlways);
+    options |= OptionThreadingNever;
+
+    Impl *s = new Impl(m_sampleRate, m_channels, options,
+                       m_timeRatio, m_pitchScale);
+
+    s->setDebugLevel(m_debugLevel);
+    s->setExpectedInputDuration(m_expectedInputDuration);
+    s->m_freq0 = m_freq0;
+    s->m_freq1 = m_freq1;
+    s->m_freq2 = m_freq2;
+
+    return s;
+}
+
+void
+RubberBandStretcher::Impl::studySegment(const float *const *input,
+                                        size_t samples,
+                                        Segment &segment) const
+{
+    Profiler profiler("RubberBandStretcher::Impl::studySegment");
+
+    Impl *s = createSegmentStretcher();
+
+    // Chunk n of the segment stretcher is chunk segment.from + n of
+    // ours, as each one starts with half an analysis window of
+    // padding. Give it enough input after the last chunk wanted for
+    // that chunk's window to be full, unless this is the end anyway.
+
+    size_t start = segment.from * m_increment;
+    size_t end = segment.to * m_increment + m_aWindowSize / 2;
+    bool final = (end >= samples);
+    if (final) end = samples;
+
+    const float **in = (const float **)alloca(m_channels * sizeof(float *));
+    for (size_t c = 0; c < m_channels; ++c) {
+        in[c] = input[c] + start;
+    }
+
+    s->study(in, end - start, final);
+
+    size_t from = segment.keepFrom - segment.from;
+    size_t to = s->m_phaseResetDf.size();
+    if (!final) to = std::min(to, segment.keepTo - segment.from);
+
+    if (!final && to < segment.keepTo - segment.from) {
+        cerr << "RubberBandStretcher::Impl::studySegment: WARNING: Only "
+             << to << " of " << segment.keepTo - segment.from
+             << " chunks studied" << endl;
+    }
+
+    segment.phaseResetDf.assign(s->m_phaseResetDf.begin() + from,
+                                s->m_phaseResetDf.begin() + to);
+    segment.stretchDf.assign(s->m_stretchDf.begin() + from,
+                             s->m_stretchDf.begin() + to);
+    segment.silence.assign(s->m_silence.begin() + from,
+                           s->m_silence.begin() + to);
+
+    delete s;
+}
+
+void
+RubberBandStretcher::Impl::stretchSegment(const float *const *input,
+                                          size_t samples,
+                                          Segment &segment) const
+{
+    Profiler profiler("RubberBandStretcher::Impl::stretchSegment");
+
+    const size_t block = 4096;
+
+    Impl *s = createSegmentStretcher();
+    s->setMaxProcessSize(block);
+
+    // Use our increments from the segment's first chunk onwards,
+    // rather than letting it study for its own. Its output should
+    // end where ours does, not where its own shorter input implies.
+
+    s->m_outputIncrements.assign(m_outputIncrements.begin() + segment.from,
+                                 m_outputIncrements.end());
+    s->m_outputLimit = segment.outputLimit;
+
+    // Enough input to cover the output of the chunks to segment.to
+
+    double needed = 0.0;
+    for (size_t i = segment.from + 1; i <= segment.to &&
+             i < m_outputIncrements.size(); ++i) {
+        needed += abs(m_outputIncrements[i]) / m_pitchScale;
+    }
+
+    size_t start = segment.from * m_increment;
+    size_t end = std::max(segment.to * m_increment,
+                          start + size_t(needed / m_timeRatio));
+    end = std::min(samples, end + m_aWindowSize);
+
+    // Only the last segment needs to be drained; the others can
+    // stop once they have processed what they were given
+
+    bool final = (end == samples);
+
+    const float **in = (const float **)alloca(m_channels * sizeof(float *));
+    float **out = (float **)alloca(m_channels * sizeof(float *));
+
+    segment.output = std::vector<std::vector<float> >(m_channels);
+    for (size_t c = 0; c < m_channels; ++c) {
+        segment.output[c].reserve(size_t(needed) + block);
+        out[c] = allocate<float>(block);
+    }
+
+    size_t done = start;
+
+    while (true) {
+
+        if (done < end) {
+            size_t n = std::min(block, end - done);
+            for (size_t c = 0; c < m_channels; ++c) {
+                in[c] = input[c] + done;
+            }
+            done += n;
+            s->process(in, n, final && done == end);
+        }
+
+        int avail = s->available();
+        if (avail < 0) break;
+        if (avail == 0 && done == end && !final) break;
+
+        while (avail > 0) {
+            size_t got = s->retrieve(out, std::min(size_t(avail), block));
+            for (size_t c = 0; c < m_channels; ++c) {
+                segment.output[c].insert(segment.output[c].end(),
+                                         out[c], out[c] + got);
+            }
+            avail -= int(got);
+        }
+    }
+
+    for (size_t c = 0; c < m_channels; ++c) {
+        deallocate(out[c]);
+    }
+
+    delete s;
+}
+
+#ifndef NO_THREADING
+
+void
+RubberBandStretcher::Impl::runSegmentJobs(const float *const *input,
+                                          size_t samples,
+                                          std::vector<Segment> &segments,
+                                          bool study) const
+{
+    Condition done("segments");
+    int remaining = int(segments.size());
+    std::vector<SegmentJob *> jobs;
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        jobs.push_back(new SegmentJob(this, input, samples, &segments[i],
+                                      study, &done, &remaining));
+    }
+
+    ThreadPool *pool = ThreadPool::getInstance();
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        pool->submit(jobs[i]);
+    }
+
+    done.lock();
+    while (remaining > 0) {
+        done.wait();
+    }
+    done.unlock();
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        delete jobs[i];
+    }
+}
+
+RubberBandStretcher::Impl::SegmentJob::SegmentJob(const Impl *s,
+                                                  const float *const *input,
+                                                  size_t samples,
+                                                  Segment *segment,
+                                                  bool study,
+                                                  Condition *done,
+                                                  int *remaining) :
+    m_s(s),
+    m_input(input),
+    m_samples(samples),
+    m_segment(segment),
+    m_study(study),
+    m_done(done),
+    m_remaining(remaining)
+{ }
+
+void
+RubberBandStretcher::Impl::SegmentJob::run()
+{
+    if (m_study) {
+        m_s->studySegment(m_input, m_samples, *m_segment);
+    } else {
+        m_s->stretchSegment(m_input, m_samples, *m_segment);
+    }
+
+    m_done->lock();
+    --*m_remaining;
+    m_done->signal();
+    m_done->unlock();
+}
+
+#endif
 
 }
 
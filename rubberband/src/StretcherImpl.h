@@ -35,6 +35,7 @@
 #include "base/RingBuffer.h"
 #include "base/Scavenger.h"
 #include "system/Thread.h"
+#include "system/ThreadPool.h"
 #include "system/sysutils.h"
 
 #include <set>
@@ -78,12 +79,19 @@ public:
 
     void setExpectedInputDuration(size_t samples);
     void setMaxProcessSize(size_t samples);
+    void setRealTimeRatioRange(double minTimeRatio, double maxTimeRatio,
+                               double minPitchScale, double maxPitchScale);
+    void setFormantEnvelopeInterval(size_t chunks);
     void setKeyFrameMap(const std::map<size_t, size_t> &);
 
     size_t getSamplesRequired() const;
 
     void study(const float *const *input, size_t samples, bool final);
+    std::vector<char> getStudyData() const;
+    bool setStudyData(const std::vector<char> &data);
     void process(const float *const *input, size_t samples, bool final);
+    size_t processWhole(const float *const *input, size_t samples,
+                        float *const *output, size_t outputSize);
 
     int available() const;
     size_t retrieve(float *const *output, size_t samples) const;
@@ -108,6 +116,10 @@ public:
     void setDebugLevel(int level);
     static void setDefaultDebugLevel(int level) { m_defaultDebugLevel = level; }
 
+#ifdef PHASE_ADVANCE_MEASUREMENT
+    static std::string tunePhaseAdvance();
+#endif
+
 protected:
     size_t m_sampleRate;
     size_t m_channels;
@@ -117,9 +129,15 @@ protected:
     size_t consumeChannel(size_t channel, const float *const *inputs,
                           size_t offset, size_t samples, bool final);
     void processChunks(size_t channel, bool &any, bool &last);
+    void processLinkedChunks(bool &any, bool &last); // all channels in step
     bool processOneChunk(); // across all channels, for real time use
+    bool processChunkStage(bool &last); // one stage of it, in RT mode
+    void processChunkStagesForBlock(size_t added); // OptionProcessSmallBlocks
     bool processChunkForChannel(size_t channel, size_t phaseIncrement,
                                 size_t shiftIncrement, bool phaseReset);
+    bool processOverlongChunkForChannel(size_t channel, size_t phaseIncrement,
+                                        size_t shiftIncrement, bool phaseReset,
+                                        float *tmp);
     bool testInbufReadSpace(size_t channel);
     void calculateIncrements(size_t &phaseIncrement,
                              size_t &shiftIncrement, bool &phaseReset);
@@ -132,6 +150,9 @@ protected:
     void writeChunk(size_t channel, size_t shiftIncrement, bool last);
 
     void calculateSizes();
+    void calculateRealTimeSizes(std::set<size_t> &windowSizes,
+                                size_t &outbufSize,
+                                size_t &resamplebufSize);
     void configure();
     void reconfigure();
 
@@ -142,7 +163,7 @@ protected:
     template <typename T, typename S>
     void cutShiftAndFold(T *target, int targetSize,
                          S *src, // destructive to src
-                         Window<float> *window) {
+                         const Window<float> *window) {
         window->cut(src);
         const int windowSize = window->getSize();
         const int hs = targetSize / 2;
@@ -175,6 +196,19 @@ protected:
 
     size_t m_maxProcessSize;
     size_t m_expectedInputDuration;
+    long m_outputLimit; // set by processWhole() for its segments, else -1
+    bool m_linkedChunk; // all channels processing one chunk in order
+
+    // In RT mode each chunk is processed in stages, the analysis of
+    // each channel and then the synthesis of each channel.  These
+    // usually all run together in processOneChunk, but with
+    // OptionProcessSmallBlocks they are spread across the process()
+    // calls that deliver the input for the next chunk
+    bool m_smallBlocks;
+    size_t m_chunkStage; // next stage of the chunk in progress, or 0
+    size_t m_stagePhaseIncrement; // increments for the chunk in progress
+    size_t m_stageShiftIncrement;
+    bool m_stagePhaseReset;
 
 #ifndef NO_THREADING    
     bool m_threaded;
@@ -193,35 +227,89 @@ protected:
 
     ProcessMode m_mode;
 
-    std::map<size_t, Window<float> *> m_windows;
-    std::map<size_t, SincWindow<float> *> m_sincs;
-    Window<float> *m_awindow;
-    SincWindow<float> *m_afilter;
-    Window<float> *m_swindow;
+    // Windows are shared with other stretchers (see SharedCache) and
+    // so must not be modified
+    std::map<size_t, const Window<float> *> m_windows;
+    std::map<size_t, const SincWindow<float> *> m_sincs;
+    const Window<float> *m_awindow;
+    const SincWindow<float> *m_afilter;
+    const Window<float> *m_swindow;
     FFT *m_studyFFT;
 
 #ifndef NO_THREADING
     Condition m_spaceAvailable;
-    
-    class ProcessThread : public Thread
+
+    // In threaded mode the channels are processed by jobs submitted
+    // to the shared ThreadPool, at most one job per channel in flight
+    // at a time.  A job processes all the chunks available on its
+    // channel and then ends; process() submits it again when more
+    // input arrives.
+    class ChannelJob : public ThreadPool::Job
     {
     public:
-        ProcessThread(Impl *s, size_t c);
+        ChannelJob(Impl *s, size_t c);
         void run();
-        void signalDataAvailable();
-        void abandon();
+        bool pending; // queued or running; guarded by m_jobMutex
+        bool finished; // last chunk processed; guarded by m_jobMutex
     private:
         Impl *m_s;
         size_t m_channel;
-        Condition m_dataAvailable;
-        bool m_abandoning;
     };
 
-    mutable Mutex m_threadSetMutex;
-    typedef std::set<ProcessThread *> ThreadSet;
-    ThreadSet m_threadSet;
-    
-#if defined HAVE_IPP && !defined USE_SPEEX
+    mutable Mutex m_jobMutex;
+    std::vector<ChannelJob *> m_jobs;
+    bool m_abandoning; // guarded by m_jobMutex
+
+    void submitJobs();
+    void abandonJobs();
+#endif
+
+    // A part of the input for processWhole(), measured in chunks of
+    // m_increment input frames
+    struct Segment
+    {
+        size_t from; // chunks studied or processed, from "from" to "to"
+        size_t to;
+        size_t keepFrom; // chunks whose study results are wanted
+        size_t keepTo;
+        long outputLimit; // output frames wanted from stretchSegment
+        std::vector<float> phaseResetDf; // results of studySegment
+        std::vector<float> stretchDf;
+        std::vector<bool> silence;
+        std::vector<std::vector<float> > output; // of stretchSegment
+    };
+
+    Impl *createSegmentStretcher() const;
+    void studySegment(const float *const *input, size_t samples,
+                      Segment &segment) const;
+    void stretchSegment(const float *const *input, size_t samples,
+                        Segment &segment) const;
+
+#ifndef NO_THREADING
+    // processWhole() submits one of these per segment to the shared
+    // ThreadPool, for either the study or the processing pass, and
+    // waits for all of them to finish in runSegmentJobs()
+    class SegmentJob : public ThreadPool::Job
+    {
+    public:
+        SegmentJob(const Impl *s, const float *const *input, size_t samples,
+                   Segment *segment, bool study,
+                   Condition *done, int *remaining);
+        void run();
+    private:
+        const Impl *m_s;
+        const float *const *m_input;
+        size_t m_samples;
+        Segment *m_segment;
+        bool m_study;
+        Condition *m_done;
+        int *m_remaining; // guarded by m_done
+    };
+
+    void runSegmentJobs(const float *const *input, size_t samples,
+                        std::vector<Segment> &segments, bool study) const;
+
+#if defined HAVE_IPP && !defined USE_SPEEX && !defined USE_BUILTIN_RESAMPLER
     // Exasperatingly, the IPP polyphase resampler does not appear to
     // be thread-safe as advertised -- a good reason to prefer the
     // Speex alternative
@@ -234,6 +322,11 @@ protected:
     std::vector<float> m_phaseResetDf;
     std::vector<float> m_stretchDf;
     std::vector<bool> m_silence;
+
+    // Analysis sizes fixed by setStudyData, or 0 if the stretcher
+    // chooses its own (see calculateSizes)
+    size_t m_studyIncrement;
+    size_t m_studyFftSize;
     int m_silentHistory;
 
     class ChannelData; 
@@ -244,6 +337,7 @@ protected:
     mutable RingBuffer<int> m_lastProcessOutputIncrements;
     mutable RingBuffer<float> m_lastProcessPhaseResetDf;
     Scavenger<RingBuffer<float> > m_emergencyScavenger;
+    int m_outbufReader; // for the calling thread's use of the outbufs
 
     CompoundAudioCurve *m_phaseResetAudioCurve;
     AudioCurveCalculator *m_stretchAudioCurve;
@@ -255,8 +349,17 @@ protected:
     float m_freq2;
 
     size_t m_baseFftSize;
+
+    // Range of ratios for which everything is allocated up front in
+    // RT mode, see calculateRealTimeSizes
+    double m_minTimeRatio;
+    double m_maxTimeRatio;
+    double m_minPitchScale;
+    double m_maxPitchScale;
     float m_rateMultiple;
 
+    size_t m_formantEnvelopeInterval; // chunks between envelope updates
+
     void writeOutput(RingBuffer<float> &to, float *from,
                      size_t qty, size_t &outCount, size_t theoreticalOut);
 
@@ -33,6 +33,7 @@
 #include "dsp/Resampler.h"
 #include "base/Profiler.h"
 #include "system/VectorOps.h"
+#include "system/VectorOpsComplex.h"
 
 #ifndef _WIN32
 #include <alloca.h>
@@ -45,6 +46,13 @@
 #include <deque>
 #include <algorithm>
 
+//#define PHASE_ADVANCE_MEASUREMENT 1
+
+#ifdef PHASE_ADVANCE_MEASUREMENT
+#include <sstream>
+#include <sys/time.h>
+#endif
+
 using namespace RubberBand;
 
 using std::cerr;
@@ -52,80 +60,119 @@ using std::endl;
 
 namespace RubberBand {
 
+// The phase to synthesise a bin with, given its accumulated phase.
+// The accumulated phase grows with every chunk and soon needs more
+// precision than a float has, so it is kept as a double, and wrapped
+// here first where process_t is float.
+static inline process_t
+synthesisPhase(double unwrapped)
+{
+    if (sizeof(process_t) < sizeof(double)) {
+        return process_t(princarg(unwrapped));
+    }
+    return process_t(unwrapped);
+}
+
 #ifndef NO_THREADING
 
-RubberBandStretcher::Impl::ProcessThread::ProcessThread(Impl *s, size_t c) :
+RubberBandStretcher::Impl::ChannelJob::ChannelJob(Impl *s, size_t c) :
+    pending(false),
+    finished(false),
     m_s(s),
-    m_channel(c),
-    m_dataAvailable(std::string("data ") + char('A' + c)),
-    m_abandoning(false)
+    m_channel(c)
 { }
 
 void
-RubberBandStretcher::Impl::ProcessThread::run()
+RubberBandStretcher::Impl::ChannelJob::run()
 {
-    if (m_s->m_debugLevel > 1) {
-        cerr << "thread " << m_channel << " getting going" << endl;
+    {
+        MutexLocker locker(&m_s->m_jobMutex);
+        if (m_s->m_abandoning) {
+            pending = false;
+            return;
+        }
     }
 
-    ChannelData &cd = *m_s->m_channelData[m_channel];
+    while (true) {
 
-    while (cd.inputSize == -1 ||
-           cd.inbuf->getReadSpace() > 0) {
-
-//        if (cd.inputSize != -1) {
-//            cerr << "inputSize == " << cd.inputSize
-//                 << ", readSpace == " << cd.inbuf->getReadSpace() << endl;
-//        }
-        
         bool any = false, last = false;
         m_s->processChunks(m_channel, any, last);
 
-        if (last) break;
-
-        if (any) {
+        if (any || last) {
             m_s->m_spaceAvailable.lock();
             m_s->m_spaceAvailable.signal();
             m_s->m_spaceAvailable.unlock();
         }
 
-        m_dataAvailable.lock();
-        if (!m_s->testInbufReadSpace(m_channel) && !m_abandoning) {
-            m_dataAvailable.wait(50000); // bounded in case of abandonment
-        }
-        m_dataAvailable.unlock();
+        // Test for more input with the job mutex held, so that
+        // submitJobs either sees this job still pending (and we see
+        // its input here) or sees it finished and submits it again
+        
+        MutexLocker locker(&m_s->m_jobMutex);
 
-        if (m_abandoning) {
+        if (last) {
             if (m_s->m_debugLevel > 1) {
-                cerr << "thread " << m_channel << " abandoning" << endl;
+                cerr << "channel " << m_channel << " done" << endl;
             }
-            return;
+            finished = true;
         }
-    }
 
-    bool any = false, last = false;
-    m_s->processChunks(m_channel, any, last);
-    m_s->m_spaceAvailable.lock();
-    m_s->m_spaceAvailable.signal();
-    m_s->m_spaceAvailable.unlock();
-    
-    if (m_s->m_debugLevel > 1) {
-        cerr << "thread " << m_channel << " done" << endl;
+        if (last || m_s->m_abandoning ||
+            !m_s->testInbufReadSpace(m_channel)) {
+            // The stretcher may be deleted as soon as we clear
+            // pending, so we must not touch it after this
+            pending = false;
+            return;
+        }
     }
 }
 
 void
-RubberBandStretcher::Impl::ProcessThread::signalDataAvailable()
+RubberBandStretcher::Impl::submitJobs()
 {
-    m_dataAvailable.lock();
-    m_dataAvailable.signal();
-    m_dataAvailable.unlock();
+    ThreadPool *pool = ThreadPool::getInstance();
+
+    MutexLocker locker(&m_jobMutex);
+
+    for (size_t c = 0; c < m_jobs.size(); ++c) {
+        ChannelJob *job = m_jobs[c];
+        if (job->pending || job->finished) continue;
+        ChannelData &cd = *m_channelData[c];
+        size_t rs = cd.inbuf->getReadSpace();
+        if (cd.inputSize == -1 && rs < m_aWindowSize) {
+            continue; // not enough for a chunk yet
+        }
+        job->pending = true;
+        pool->submit(job);
+    }
 }
 
 void
-RubberBandStretcher::Impl::ProcessThread::abandon()
+RubberBandStretcher::Impl::abandonJobs()
 {
+    // Wait for any queued or running jobs to see the abandon flag and
+    // return.  A running job only notices it between calls to
+    // processChunks.
+
+    m_jobMutex.lock();
     m_abandoning = true;
+
+    while (true) {
+        bool running = false;
+        for (size_t c = 0; c < m_jobs.size(); ++c) {
+            if (m_jobs[c]->pending) running = true;
+        }
+        m_jobMutex.unlock();
+        if (!running) break;
+        m_spaceAvailable.lock();
+        m_spaceAvailable.wait(500);
+        m_spaceAvailable.unlock();
+        m_jobMutex.lock();
+    }
+
+    m_jobMutex.lock();
+    m_abandoning = false;
+    m_jobMutex.unlock();
 }
 
 #endif
@@ -206,7 +253,7 @@ RubberBandStretcher::Impl::consumeChannel(size_t c,
         }
 
 #ifndef NO_THREADING
-#if defined HAVE_IPP && !defined USE_SPEEX
+#if defined HAVE_IPP && !defined USE_SPEEX && !defined USE_BUILTIN_RESAMPLER
         if (m_threaded) {
             m_resamplerMutex.lock();
         }
@@ -227,7 +274,7 @@ RubberBandStretcher::Impl::consumeChannel(size_t c,
                                          final);
 
 #ifndef NO_THREADING
-#if defined HAVE_IPP && !defined USE_SPEEX
+#if defined HAVE_IPP && !defined USE_SPEEX && !defined USE_BUILTIN_RESAMPLER
         if (m_threaded) {
             m_resamplerMutex.unlock();
         }
@@ -303,28 +350,15 @@ RubberBandStretcher::Impl::processChunks(size_t c, bool &any, bool &last)
         size_t phaseIncrement, shiftIncrement;
         getIncrements(c, phaseIncrement, shiftIncrement, phaseReset);
 
+        analyseChunk(c);
+
         if (shiftIncrement <= m_aWindowSize) {
-            analyseChunk(c);
             last = processChunkForChannel
                 (c, phaseIncrement, shiftIncrement, phaseReset);
         } else {
-            size_t bit = m_aWindowSize/4;
-            if (m_debugLevel > 1) {
-                cerr << "channel " << c << " breaking down overlong increment " << shiftIncrement << " into " << bit << "-size bits" << endl;
-            }
             if (!tmp) tmp = allocate<float>(m_aWindowSize);
-            analyseChunk(c);
-            v_copy(tmp, cd.fltbuf, m_aWindowSize);
-            for (size_t i = 0; i < shiftIncrement; i += bit) {
-                v_copy(cd.fltbuf, tmp, m_aWindowSize);
-                size_t thisIncrement = bit;
-                if (i + thisIncrement > shiftIncrement) {
-                    thisIncrement = shiftIncrement - i;
-                }
-                last = processChunkForChannel
-                    (c, phaseIncrement + i, thisIncrement, phaseReset);
-                phaseReset = false;
-            }
+            last = processOverlongChunkForChannel
+                (c, phaseIncrement, shiftIncrement, phaseReset, tmp);
         }
 
         cd.chunkCount++;
@@ -336,6 +370,70 @@ RubberBandStretcher::Impl::processChunks(size_t c, bool &any, bool &last)
     if (tmp) deallocate(tmp);
 }
 
+bool
+RubberBandStretcher::Impl::processOverlongChunkForChannel(size_t c,
+                                                          size_t phaseIncrement,
+                                                          size_t shiftIncrement,
+                                                          bool phaseReset,
+                                                          float *tmp)
+{
+    // Process an already-analysed chunk whose shift increment is
+    // longer than the analysis window, by breaking it down into
+    // smaller increments. tmp must have room for m_aWindowSize
+    // samples.
+
+    ChannelData &cd = *m_channelData[c];
+
+    size_t bit = m_aWindowSize/4;
+    if (m_debugLevel > 1) {
+        cerr << "channel " << c << " breaking down overlong increment " << shiftIncrement << " into " << bit << "-size bits" << endl;
+    }
+
+    bool last = false;
+
+    v_copy(tmp, cd.fltbuf, m_aWindowSize);
+    for (size_t i = 0; i < shiftIncrement; i += bit) {
+        v_copy(cd.fltbuf, tmp, m_aWindowSize);
+        size_t thisIncrement = bit;
+        if (i + thisIncrement > shiftIncrement) {
+            thisIncrement = shiftIncrement - i;
+        }
+        last = processChunkForChannel
+            (c, phaseIncrement + i, thisIncrement, phaseReset);
+        phaseReset = false;
+    }
+
+    return last;
+}
+
+void
+RubberBandStretcher::Impl::processLinkedChunks(bool &any, bool &last)
+{
+    Profiler profiler("RubberBandStretcher::Impl::processLinkedChunks");
+
+    // Process as many chunks as there are available on the input
+    // buffers of all channels, keeping the channels in step so that
+    // they can share phase calculations.
+
+    // This is the offline process method with OptionChannelsLinked.
+
+    last = false;
+    any = false;
+
+    while (!last) {
+        for (size_t c = 0; c < m_channels; ++c) {
+            if (!testInbufReadSpace(c)) {
+                if (m_debugLevel > 2) {
+                    cerr << "processLinkedChunks: out of input" << endl;
+                }
+                return;
+            }
+        }
+        any = true;
+        last = processOneChunk();
+    }
+}
+
 bool
 RubberBandStretcher::Impl::processOneChunk()
 {
@@ -347,6 +445,16 @@ RubberBandStretcher::Impl::processOneChunk()
 
     // This is the normal process method in RT mode.
 
+    if (m_realtime) {
+        // Finish any chunk already in progress (see
+        // processChunkStagesForBlock), then process a new one
+        bool last = false;
+        while (m_chunkStage > 0) processChunkStage(last);
+        if (last || !processChunkStage(last)) return last;
+        while (m_chunkStage > 0) processChunkStage(last);
+        return last;
+    }
+
     for (size_t c = 0; c < m_channels; ++c) {
         if (!testInbufReadSpace(c)) {
             if (m_debugLevel > 2) {
@@ -363,22 +471,149 @@ RubberBandStretcher::Impl::processOneChunk()
             analyseChunk(c);
         }
     }
-    
+
+    // Offline, with OptionChannelsLinked: the increments are all
+    // known already, and the same for every channel
     bool phaseReset = false;
     size_t phaseIncrement, shiftIncrement;
-    if (!getIncrements(0, phaseIncrement, shiftIncrement, phaseReset)) {
-        calculateIncrements(phaseIncrement, shiftIncrement, phaseReset);
+    for (size_t c = 0; c < m_channels; ++c) {
+        getIncrements(c, phaseIncrement, shiftIncrement, phaseReset);
     }
 
     bool last = false;
+
+    if (shiftIncrement > m_aWindowSize) {
+        float *tmp = (float *)alloca(m_aWindowSize * sizeof(float));
+        for (size_t c = 0; c < m_channels; ++c) {
+            last = processOverlongChunkForChannel
+                (c, phaseIncrement, shiftIncrement, phaseReset, tmp);
+            m_channelData[c]->chunkCount++;
+        }
+        return last;
+    }
+
+    m_linkedChunk = ((m_options & OptionChannelsLinked) != 0);
+
     for (size_t c = 0; c < m_channels; ++c) {
         last = processChunkForChannel(c, phaseIncrement, shiftIncrement, phaseReset);
         m_channelData[c]->chunkCount++;
     }
 
+    m_linkedChunk = false;
+
     return last;
 }
 
+bool
+RubberBandStretcher::Impl::processChunkStage(bool &last)
+{
+    Profiler profiler("RubberBandStretcher::Impl::processChunkStage");
+
+    // Run the next stage of the current RT chunk, starting a new
+    // chunk if none is in progress.  Stages 0 .. channels-1 analyse
+    // each channel in turn, and stages channels .. 2*channels-1
+    // synthesise them, the first of those calculating the increments
+    // from all of the analyses.  Return false if a new chunk is
+    // needed but there is not enough input to start it.
+
+    if (m_chunkStage == 0) {
+        for (size_t c = 0; c < m_channels; ++c) {
+            if (!testInbufReadSpace(c)) {
+                if (m_debugLevel > 2) {
+                    cerr << "processChunkStage: out of input" << endl;
+                }
+                return false;
+            }
+        }
+    }
+
+    if (m_chunkStage < m_channels) {
+
+        const size_t c = m_chunkStage;
+        ChannelData &cd = *m_channelData[c];
+        if (!cd.draining) {
+            size_t ready = cd.inbuf->getReadSpace();
+            assert(ready >= m_aWindowSize || cd.inputSize >= 0);
+            cd.inbuf->peek(cd.fltbuf, std::min(ready, m_aWindowSize));
+            cd.inbuf->skip(m_increment);
+            analyseChunk(c);
+        }
+
+    } else {
+
+        const size_t c = m_chunkStage - m_channels;
+
+        if (c == 0) {
+            m_stagePhaseReset = false;
+            if (!getIncrements(0, m_stagePhaseIncrement,
+                               m_stageShiftIncrement, m_stagePhaseReset)) {
+                calculateIncrements(m_stagePhaseIncrement,
+                                    m_stageShiftIncrement, m_stagePhaseReset);
+            }
+        }
+
+        m_linkedChunk = ((m_options & OptionChannelsLinked) != 0);
+        last = processChunkForChannel(c, m_stagePhaseIncrement,
+                                      m_stageShiftIncrement, m_stagePhaseReset);
+        m_linkedChunk = false;
+        m_channelData[c]->chunkCount++;
+    }
+
+    if (++m_chunkStage == 2 * m_channels) {
+        m_chunkStage = 0;
+    }
+
+    return true;
+}
+
+void
+RubberBandStretcher::Impl::processChunkStagesForBlock(size_t added)
+{
+    Profiler profiler("RubberBandStretcher::Impl::processChunkStagesForBlock");
+
+    // With OptionProcessSmallBlocks, called at the end of each
+    // process() call (other than the final one) with the number of
+    // frames the call added to each input buffer.  Rather than
+    // running a whole chunk in whichever call completes its input,
+    // run a share of the stages of the chunk in progress in
+    // proportion to the input added, out of what is still to come
+    // before the next chunk is due.  With evenly sized blocks that
+    // gives each call a near-constant amount of work, and the chunk
+    // is always finished by the time the next one can start.
+
+    const size_t stages = 2 * m_channels;
+    bool last = false;
+
+    while (true) {
+
+        size_t rs = m_channelData[0]->inbuf->getReadSpace();
+
+        if (m_chunkStage == 0) {
+            if (rs < m_aWindowSize) return; // next chunk not ready yet
+            rs -= m_increment; // as it will be once the chunk starts
+        }
+
+        const size_t remaining = stages - m_chunkStage;
+        size_t n = remaining;
+
+        if (rs < m_aWindowSize) {
+            const size_t due = added + (m_aWindowSize - rs);
+            n = (remaining * added + due - 1) / due;
+            if (n == 0) return;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            if (!processChunkStage(last)) return;
+        }
+
+        if (m_chunkStage > 0) return;
+
+        // A chunk was finished: go on to the next only if it is
+        // already overdue, as this call's input has been accounted for
+        added = 0;
+    }
+}
+
 bool
 RubberBandStretcher::Impl::testInbufReadSpace(size_t c)
 {
@@ -781,6 +1016,28 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
     int bandlow = lrint((150 * m_fftSize) / rate);
     int bandhigh = lrint((1000 * m_fftSize) / rate);
 
+    if (m_linkedChunk && channel > 0) {
+
+        // Take the phase advance for each bin from the first channel,
+        // which has just processed the same chunk, rather than working
+        // it out again. This also keeps the phase relationships
+        // between the channels as they were in the input.
+
+        const ChannelData &ref = *m_channelData[0];
+
+        for (int i = 0; i <= count; ++i) {
+            process_t p = cd.phase[i];
+            double outphase = p + (ref.phase[i] - ref.prevPhase[i]);
+            cd.prevPhase[i] = p;
+            cd.phase[i] = synthesisPhase(outphase);
+            cd.unwrappedPhase[i] = outphase;
+        }
+
+        if (phaseReset && !bandlimited) unchanged = true;
+        cd.unchanged = unchanged;
+        return;
+    }
+
     float freq0 = m_freq0;
     float freq1 = m_freq1;
     float freq2 = m_freq2;
@@ -814,6 +1071,18 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
 
     process_t distacc = 0.0;
 
+    // The phase error and advance for each bin don't depend on its
+    // neighbours, so calculate them all at once first. Only the
+    // decision about inheriting from the bin above has to go bin by
+    // bin, from the top down. Bins that turn out to be reset get
+    // their error zeroed again below.
+    
+    v_phase_advance(cd.errorChange, cd.advance, cd.prevError,
+                    cd.phase, cd.prevPhase,
+                    2 * M_PI * m_increment, double(m_fftSize),
+                    process_t(m_increment), process_t(outputIncrement),
+                    count + 1);
+
     for (int i = count; i >= 0; i -= lookback) {
 
         bool resetThis = phaseReset;
@@ -828,8 +1097,7 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
         }
 
         process_t p = cd.phase[i];
-        process_t perr = 0.0;
-        process_t outphase = p;
+        double outphase = p;
 
         process_t mi = maxdist;
         if (i <= limit0) mi = 0.0;
@@ -838,14 +1106,9 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
 
         if (!resetThis) {
 
-            process_t omega = (2 * M_PI * m_increment * i) / (m_fftSize);
-
-            process_t pp = cd.prevPhase[i];
-            process_t ep = pp + omega;
-            perr = princarg(p - ep);
-
-            process_t instability = fabs(perr - cd.prevError[i]);
-            bool direction = (perr > cd.prevError[i]);
+            process_t change = cd.errorChange[i];
+            process_t instability = fabs(change);
+            bool direction = (change > 0);
 
             bool inherit = false;
 
@@ -860,10 +1123,10 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
                 }
             }
 
-            process_t advance = outputIncrement * ((omega + perr) / m_increment);
+            double advance = cd.advance[i];
 
             if (inherit) {
-                process_t inherited =
+                double inherited =
                     cd.unwrappedPhase[i + lookback] - cd.prevPhase[i + lookback];
                 advance = ((advance * distance) +
                            (inherited * (maxdist - distance)))
@@ -880,12 +1143,12 @@ RubberBandStretcher::Impl::modifyChunk(size_t channel,
             prevDirection = direction;
 
         } else {
+            cd.prevError[i] = 0.0;
             distance = 0.0;
         }
 
-        cd.prevError[i] = perr;
         cd.prevPhase[i] = p;
-        cd.phase[i] = outphase;
+        cd.phase[i] = synthesisPhase(outphase);
         cd.unwrappedPhase[i] = outphase;
     }
 
@@ -915,49 +1178,66 @@ RubberBandStretcher::Impl::formantShiftChunk(size_t channel)
 
     const int sz = m_fftSize;
     const int hs = sz / 2;
-    const process_t factor = 1.0 / sz;
 
-    cd.fft->inverseCepstral(mag, dblbuf);
+    // The spectral envelope moves far more slowly than the chunk
+    // rate, so it may be kept for several chunks and only the shift
+    // applied to each
+    if (cd.envelopeAge == 0) {
 
-    const int cutoff = m_sampleRate / 700;
+        const process_t factor = 1.0 / sz;
 
-//    cerr <<"cutoff = "<< cutoff << ", m_sampleRate/cutoff = " << m_sampleRate/cutoff << endl;
+        cd.fft->inverseCepstral(mag, dblbuf);
 
-    dblbuf[0] /= 2;
-    dblbuf[cutoff-1] /= 2;
+        const int cutoff = m_sampleRate / 700;
 
-    for (int i = cutoff; i < sz; ++i) {
-        dblbuf[i] = 0.0;
-    }
+//        cerr <<"cutoff = "<< cutoff << ", m_sampleRate/cutoff = " << m_sampleRate/cutoff << endl;
+
+        dblbuf[0] /= 2;
+        dblbuf[cutoff-1] /= 2;
+
+        for (int i = cutoff; i < sz; ++i) {
+            dblbuf[i] = 0.0;
+        }
+
+        v_scale(dblbuf, factor, cutoff);
 
-    v_scale(dblbuf, factor, cutoff);
+        // errorChange is only scratch between modifyChunk calls
+        cd.fft->forward(dblbuf, envelope, cd.errorChange);
 
-    process_t *spare = (process_t *)alloca((hs + 1) * sizeof(process_t));
-    cd.fft->forward(dblbuf, envelope, spare);
+        v_fast_exp(envelope, hs + 1);
+    }
+
+    if (++cd.envelopeAge >= m_formantEnvelopeInterval) {
+        cd.envelopeAge = 0;
+    }
 
-    v_exp(envelope, hs + 1);
     v_divide(mag, envelope, hs + 1);
 
+    // Shift into dblbuf, which is free again by now, leaving the
+    // unshifted envelope in place for the next chunk
+    process_t *const R__ shifted = dblbuf;
+
     if (m_pitchScale > 1.0) {
         // scaling up, we want a new envelope that is lower by the pitch factor
         for (int target = 0; target <= hs; ++target) {
             int source = lrint(target * m_pitchScale);
             if (source > hs) {
-                envelope[target] = 0.0;
+                shifted[target] = 0.0;
             } else {
-                envelope[target] = envelope[source];
+                shifted[target] = envelope[source];
             }
         }
     } else {
         // scaling down, we want a new envelope that is higher by the pitch factor
+        shifted[hs] = envelope[hs];
         for (int target = hs; target > 0; ) {
             --target;
             int source = lrint(target * m_pitchScale);
-            envelope[target] = envelope[source];
+            shifted[target] = envelope[source];
         }
     }
 
-    v_multiply(mag, envelope, hs+1);
+    v_multiply(mag, shifted, hs+1);
 
     cd.unchanged = false;
 }
@@ -1057,7 +1337,11 @@ RubberBandStretcher::Impl::writeChunk(size_t channel, size_t shiftIncrement, boo
     // were running in RT mode)
     size_t theoreticalOut = 0;
     if (cd.inputSize >= 0) {
-        theoreticalOut = lrint(cd.inputSize * m_timeRatio);
+        if (m_outputLimit >= 0) {
+            theoreticalOut = m_outputLimit;
+        } else {
+            theoreticalOut = lrint(cd.inputSize * m_timeRatio);
+        }
     }
 
     bool resampledAlready = resampleBeforeStretching();
@@ -1079,7 +1363,7 @@ RubberBandStretcher::Impl::writeChunk(size_t channel, size_t shiftIncrement, boo
         }
 
 #ifndef NO_THREADING
-#if defined HAVE_IPP && !defined USE_SPEEX
+#if defined HAVE_IPP && !defined USE_SPEEX && !defined USE_BUILTIN_RESAMPLER
         if (m_threaded) {
             m_resamplerMutex.lock();
         }
@@ -1093,7 +1377,7 @@ RubberBandStretcher::Impl::writeChunk(size_t channel, size_t shiftIncrement, boo
                                                   last);
 
 #ifndef NO_THREADING
-#if defined HAVE_IPP && !defined USE_SPEEX
+#if defined HAVE_IPP && !defined USE_SPEEX && !defined USE_BUILTIN_RESAMPLER
         if (m_threaded) {
             m_resamplerMutex.unlock();
         }
@@ -1206,9 +1490,13 @@ RubberBandStretcher::Impl::available() const
 {
     Profiler profiler("RubberBandStretcher::Impl::available");
 
+    // The process thread may be swapping out an outbuf as we look
+    Scavenger<RingBuffer<float> >::ReadSection section
+        (m_emergencyScavenger, m_outbufReader);
+
 #ifndef NO_THREADING
     if (m_threaded) {
-        MutexLocker locker(&m_threadSetMutex);
+        MutexLocker locker(&m_jobMutex);
         if (m_channelData.empty()) return 0;
     } else {
         if (m_channelData.empty()) return 0;
@@ -1218,7 +1506,13 @@ RubberBandStretcher::Impl::available() const
 #ifndef NO_THREADING
     if (!m_threaded) {
 #endif
-        for (size_t c = 0; c < m_channels; ++c) {
+        if (!m_realtime && (m_options & OptionChannelsLinked)) {
+            if (m_channelData[0]->inputSize >= 0 &&
+                m_channelData[0]->inbuf->getReadSpace() > 0) {
+                bool any = false, last = false;
+                ((RubberBandStretcher::Impl *)this)->processLinkedChunks(any, last);
+            }
+        } else for (size_t c = 0; c < m_channels; ++c) {
             if (m_channelData[c]->inputSize >= 0) {
 //                cerr << "available: m_done true" << endl;
                 if (m_channelData[c]->inbuf->getReadSpace() > 0) {
@@ -1263,6 +1557,9 @@ RubberBandStretcher::Impl::retrieve(float *const *output, size_t samples) const
 {
     Profiler profiler("RubberBandStretcher::Impl::retrieve");
 
+    Scavenger<RingBuffer<float> >::ReadSection section
+        (m_emergencyScavenger, m_outbufReader);
+
     size_t got = samples;
 
     for (size_t c = 0; c < m_channels; ++c) {
@@ -1291,5 +1588,110 @@ RubberBandStretcher::Impl::retrieve(float *const *output, size_t samples) const
     return got;
 }
 
+#ifdef PHASE_ADVANCE_MEASUREMENT
+
+static double
+secondsNow()
+{
+    struct timeval tv;
+    (void)gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+std::string
+RubberBandStretcher::Impl::tunePhaseAdvance()
+{
+    std::ostringstream os;
+    os << "RubberBandStretcher::Impl::tunePhaseAdvance()..." << std::endl;
+
+    const size_t increment = 256;
+    const size_t outputIncrement = 307;
+
+    for (int fftSize = 256; fftSize <= 16384; fftSize *= 2) {
+
+        int hs = fftSize / 2 + 1;
+
+        process_t *phase = allocate<process_t>(hs);
+        process_t *prevPhase = allocate<process_t>(hs);
+        process_t *prevError = allocate_and_zero<process_t>(hs);
+        process_t *change = allocate<process_t>(hs);
+        process_t *advance = allocate<process_t>(hs);
+        process_t *refError = allocate_and_zero<process_t>(hs);
+        process_t *refChange = allocate<process_t>(hs);
+        process_t *refAdvance = allocate<process_t>(hs);
+
+        for (int i = 0; i < hs; ++i) {
+            phase[i] = process_t(sin(i * 0.37) * 3.0);
+            prevPhase[i] = process_t(cos(i * 0.11) * 3.0);
+        }
+
+        double rate[2];
+        const int batch = 16;
+        const double minTime = 0.01;
+
+        for (int v = 0; v < 2; ++v) {
+            int rounds = 0;
+            double start = secondsNow(), elapsed = 0.0;
+            while (elapsed < minTime) {
+                for (int b = 0; b < batch; ++b) {
+                    if (v == 0) {
+                        v_phase_advance_scalar
+                            (refChange, refAdvance, refError, phase, prevPhase,
+                             2 * M_PI * increment, double(fftSize),
+                             process_t(increment), process_t(outputIncrement),
+                             hs);
+                    } else {
+                        v_phase_advance
+                            (change, advance, prevError, phase, prevPhase,
+                             2 * M_PI * increment, double(fftSize),
+                             process_t(increment), process_t(outputIncrement),
+                             hs);
+                    }
+                }
+                rounds += batch;
+                elapsed = secondsNow() - start;
+            }
+            rate[v] = rounds / elapsed;
+        }
+
+        // The timing runs leave different errors behind, so compare
+        // a single call of each from the same start
+        v_zero(prevError, hs);
+        v_zero(refError, hs);
+        v_phase_advance_scalar(refChange, refAdvance, refError, phase, prevPhase,
+                               2 * M_PI * increment, double(fftSize),
+                               process_t(increment), process_t(outputIncrement),
+                               hs);
+        v_phase_advance(change, advance, prevError, phase, prevPhase,
+                        2 * M_PI * increment, double(fftSize),
+                        process_t(increment), process_t(outputIncrement),
+                        hs);
+
+        double maxdiff = 0.0;
+        for (int i = 0; i < hs; ++i) {
+            maxdiff = std::max(maxdiff, fabs(double(advance[i] - refAdvance[i])));
+            maxdiff = std::max(maxdiff, fabs(double(prevError[i] - refError[i])));
+        }
+
+        os << "Size " << fftSize << ": scalar " << int(rate[0])
+           << "/sec, vector " << int(rate[1]) << "/sec ("
+           << rate[1] / rate[0] << "x), max difference " << maxdiff
+           << std::endl;
+
+        deallocate(phase);
+        deallocate(prevPhase);
+        deallocate(prevError);
+        deallocate(change);
+        deallocate(advance);
+        deallocate(refError);
+        deallocate(refChange);
+        deallocate(refAdvance);
+    }
+
+    return os.str();
+}
+
+#endif
+
 }
 
@@ -87,8 +87,7 @@ CompoundAudioCurve::processFloat(const float *R__ mag, int increment)
         percussive = m_percussive.processFloat(mag, increment);
         break;
     case CompoundDetector:
-        percussive = m_percussive.processFloat(mag, increment);
-        hf = m_hf.processFloat(mag, increment);
+        percussive = m_percussive.processFloatWithHf(mag, hf);
         break;
     case SoftDetector:
         hf = m_hf.processFloat(mag, increment);
@@ -107,8 +106,7 @@ CompoundAudioCurve::processDouble(const double *R__ mag, int increment)
         percussive = m_percussive.processDouble(mag, increment);
         break;
     case CompoundDetector:
-        percussive = m_percussive.processDouble(mag, increment);
-        hf = m_hf.processDouble(mag, increment);
+        percussive = m_percussive.processDoubleWithHf(mag, hf);
         break;
     case SoftDetector:
         hf = m_hf.processDouble(mag, increment);
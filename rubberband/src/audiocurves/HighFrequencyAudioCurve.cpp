@@ -58,7 +58,7 @@ HighFrequencyAudioCurve::processFloat(const float *R__ mag, int increment)
 double
 HighFrequencyAudioCurve::processDouble(const double *R__ mag, int increment)
 {
-    float result = 0.0;
+    double result = 0.0;
 
     const int sz = m_lastPerceivedBin;
 
@@ -35,7 +35,8 @@ namespace RubberBand
 PercussiveAudioCurve::PercussiveAudioCurve(Parameters parameters) :
     AudioCurveCalculator(parameters)
 {
-    m_prevMag = allocate_and_zero<double>(m_fftSize/2 + 1);
+    m_prevMagSize = m_fftSize/2 + 1;
+    m_prevMag = allocate_and_zero<double>(m_prevMagSize);
 }
 
 PercussiveAudioCurve::~PercussiveAudioCurve()
@@ -52,13 +53,66 @@ PercussiveAudioCurve::reset()
 void
 PercussiveAudioCurve::setFftSize(int newSize)
 {
-    m_prevMag = reallocate(m_prevMag, m_fftSize/2 + 1, newSize/2 + 1);
+    // Never shrink, so that switching back to a previous size
+    // doesn't allocate
+    if (newSize/2 + 1 > m_prevMagSize) {
+        m_prevMag = reallocate(m_prevMag, m_prevMagSize, newSize/2 + 1);
+        m_prevMagSize = newSize/2 + 1;
+    }
     AudioCurveCalculator::setFftSize(newSize);
     reset();
 }
 
+// One pass over the magnitudes, counting the bins that have risen by
+// at least the threshold since the previous chunk and the bins that
+// are non-zero at all, and optionally also summing the high-frequency
+// content as HighFrequencyAudioCurve does. The loop body has no
+// branches so that the compiler can vectorise it.
+
+template <typename T, bool WithHf>
+static inline void
+countRises(const T *const R__ mag, const double *const R__ prevMag,
+           const int sz, const T threshold, const T zeroThresh,
+           int &count, int &nonZeroCount, T &hf)
+{
+    int c = 0;
+    int nz = 0;
+    T h = 0;
+
+    for (int n = 1; n <= sz; ++n) {
+        const T m = mag[n];
+        const double p = prevMag[n];
+        const int mnz = (m > zeroThresh);
+        // If the previous magnitude was zero, a non-zero one counts
+        // as a rise: the ratio is only used when it is well-defined
+        const T v = T(m / p);
+        c += (p > zeroThresh) ? int(v >= threshold) : mnz;
+        nz += mnz;
+        if (WithHf) h = h + m * n;
+    }
+
+    count = c;
+    nonZeroCount = nz;
+    hf = h;
+}
+
 float
 PercussiveAudioCurve::processFloat(const float *R__ mag, int increment)
+{
+    float hf;
+    return processFloatWithHf(mag, hf, false);
+}
+
+double
+PercussiveAudioCurve::processDouble(const double *R__ mag, int increment)
+{
+    double hf;
+    return processDoubleWithHf(mag, hf, false);
+}
+
+float
+PercussiveAudioCurve::processFloatWithHf(const float *R__ mag, float &hf,
+                                         bool wantHf)
 {
     static float threshold = powf(10.f, 0.15f); // 3dB rise in square of magnitude
     static float zeroThresh = powf(10.f, -8);
@@ -68,13 +122,12 @@ PercussiveAudioCurve::processFloat(const float *R__ mag, int increment)
 
     const int sz = m_lastPerceivedBin;
 
-    for (int n = 1; n <= sz; ++n) {
-        float v = 0.f;
-        if (m_prevMag[n] > zeroThresh) v = mag[n] / m_prevMag[n];
-        else if (mag[n] > zeroThresh) v = threshold;
-        bool above = (v >= threshold);
-        if (above) ++count;
-        if (mag[n] > zeroThresh) ++nonZeroCount;
+    if (wantHf) {
+        countRises<float, true>
+            (mag, m_prevMag, sz, threshold, zeroThresh, count, nonZeroCount, hf);
+    } else {
+        countRises<float, false>
+            (mag, m_prevMag, sz, threshold, zeroThresh, count, nonZeroCount, hf);
     }
 
     v_convert(m_prevMag, mag, sz + 1);
@@ -84,7 +137,8 @@ PercussiveAudioCurve::processFloat(const float *R__ mag, int increment)
 }
 
 double
-PercussiveAudioCurve::processDouble(const double *R__ mag, int increment)
+PercussiveAudioCurve::processDoubleWithHf(const double *R__ mag, double &hf,
+                                          bool wantHf)
 {
     static double threshold = powf(10., 0.15); // 3dB rise in square of magnitude
     static double zeroThresh = powf(10., -8);
@@ -94,13 +148,12 @@ PercussiveAudioCurve::processDouble(const double *R__ mag, int increment)
 
     const int sz = m_lastPerceivedBin;
 
-    for (int n = 1; n <= sz; ++n) {
-        double v = 0.0;
-        if (m_prevMag[n] > zeroThresh) v = mag[n] / m_prevMag[n];
-        else if (mag[n] > zeroThresh) v = threshold;
-        bool above = (v >= threshold);
-        if (above) ++count;
-        if (mag[n] > zeroThresh) ++nonZeroCount;
+    if (wantHf) {
+        countRises<double, true>
+            (mag, m_prevMag, sz, threshold, zeroThresh, count, nonZeroCount, hf);
+    } else {
+        countRises<double, false>
+            (mag, m_prevMag, sz, threshold, zeroThresh, count, nonZeroCount, hf);
     }
 
     v_copy(m_prevMag, mag, sz + 1);
@@ -109,6 +162,5 @@ PercussiveAudioCurve::processDouble(const double *R__ mag, int increment)
     else return double(count) / double(nonZeroCount);
 }
 
-
 }
 
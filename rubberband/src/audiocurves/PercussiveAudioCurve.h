@@ -41,12 +41,20 @@ public:
     virtual float processFloat(const float *R__ mag, int increment);
     virtual double processDouble(const double *R__ mag, int increment);
 
+    /**
+     * As processFloat/processDouble, but if wantHf is true, also
+     * return in hf the result HighFrequencyAudioCurve would give for
+     * the same magnitudes, calculated in the same pass over them.
+     */
+    float processFloatWithHf(const float *R__ mag, float &hf, bool wantHf = true);
+    double processDoubleWithHf(const double *R__ mag, double &hf, bool wantHf = true);
 
     virtual void reset();
     virtual const char *getUnit() const { return "bin/total"; }
 
 protected:
     double *R__ m_prevMag;
+    int m_prevMagSize; // allocated, may exceed m_fftSize/2 + 1
 };
 
 }
@@ -26,6 +26,8 @@
 #include "system/Allocators.h"
 #include "system/VectorOps.h"
 
+#include <cmath>
+
 namespace RubberBand
 {
 
@@ -34,14 +36,12 @@ SpectralDifferenceAudioCurve::SpectralDifferenceAudioCurve(Parameters parameters
     AudioCurveCalculator(parameters)
 {
     m_mag = allocate<double>(m_lastPerceivedBin + 1);
-    m_tmpbuf = allocate<double>(m_lastPerceivedBin + 1);
     v_zero(m_mag, m_lastPerceivedBin + 1);
 }
 
 SpectralDifferenceAudioCurve::~SpectralDifferenceAudioCurve()
 {
     deallocate(m_mag);
-    deallocate(m_tmpbuf);
 }
 
 void
@@ -53,54 +53,39 @@ SpectralDifferenceAudioCurve::reset()
 void
 SpectralDifferenceAudioCurve::setFftSize(int newSize)
 {
-    deallocate(m_tmpbuf);
     deallocate(m_mag);
     AudioCurveCalculator::setFftSize(newSize);
     m_mag = allocate<double>(m_lastPerceivedBin + 1);
-    m_tmpbuf = allocate<double>(m_lastPerceivedBin + 1);
     reset();
 }
 
-float
-SpectralDifferenceAudioCurve::processFloat(const float *R__ mag, int increment)
+// The difference between the square roots of successive squared
+// magnitudes, summed over the bins. prevMag holds the previous squared
+// magnitudes and is updated in the same pass.
+
+template <typename T>
+static inline double
+sumDifferences(const T *const R__ mag, double *const R__ prevMag, const int hs1)
 {
     double result = 0.0;
-
-    const int hs1 = m_lastPerceivedBin + 1;
-
-    v_convert(m_tmpbuf, mag, hs1);
-    v_square(m_tmpbuf, hs1);
-    v_subtract(m_mag, m_tmpbuf, hs1);
-    v_abs(m_mag, hs1);
-    v_sqrt(m_mag, hs1);
-    
     for (int i = 0; i < hs1; ++i) {
-        result += m_mag[i];
+        const double sq = double(mag[i]) * double(mag[i]);
+        result += sqrt(fabs(prevMag[i] - sq));
+        prevMag[i] = sq;
     }
-
-    v_copy(m_mag, m_tmpbuf, hs1);
     return result;
 }
 
+float
+SpectralDifferenceAudioCurve::processFloat(const float *R__ mag, int increment)
+{
+    return sumDifferences(mag, m_mag, m_lastPerceivedBin + 1);
+}
+
 double
 SpectralDifferenceAudioCurve::processDouble(const double *R__ mag, int increment)
 {
-    double result = 0.0;
-
-    const int hs1 = m_lastPerceivedBin + 1;
-
-    v_convert(m_tmpbuf, mag, hs1);
-    v_square(m_tmpbuf, hs1);
-    v_subtract(m_mag, m_tmpbuf, hs1);
-    v_abs(m_mag, hs1);
-    v_sqrt(m_mag, hs1);
-    
-    for (int i = 0; i < hs1; ++i) {
-        result += m_mag[i];
-    }
-
-    v_copy(m_mag, m_tmpbuf, hs1);
-    return result;
+    return sumDifferences(mag, m_mag, m_lastPerceivedBin + 1);
 }
 
 }
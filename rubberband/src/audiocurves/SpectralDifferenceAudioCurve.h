@@ -46,7 +46,6 @@ public:
 
 protected:
     double *R__ m_mag;
-    double *R__ m_tmpbuf;
 };
 
 }
@@ -23,57 +23,407 @@
 
 #include "Profiler.h"
 
+#ifndef NO_TIMING_COMPLETE_NOOP
+
+#include "system/Thread.h"
+#include "system/sysutils.h"
+
 #include <algorithm>
-#include <set>
-#include <string>
 #include <map>
+#include <string>
+#include <cstring>
 
 #include <stdio.h>
 
+#ifndef PROFILE_CLOCKS
+#ifdef _WIN32
+#include <windows.h>
+#else
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+#endif
+#endif
+
 #ifdef __MSVC__
 // Ugh --cc
 #define snprintf sprintf_s
 #endif
 
+#ifdef NO_THREADING
+#define PROFILER_THREAD_LOCAL
+#else
+#if defined _MSC_VER
+#define PROFILER_THREAD_LOCAL __declspec(thread)
+#else
+#define PROFILER_THREAD_LOCAL __thread
+#endif
+#endif
+
 namespace RubberBand {
 
-#ifndef NO_TIMING
+// Times are binned with four bins per octave from 64ns, with one bin
+// below that, up to about a minute
+static const int minOctave = 6;
+static const int binsPerOctave = 4;
+static const int binCount = 1 + 30 * binsPerOctave;
+
+// Distinct names per thread; times for any more are not recorded
+static const int maxNames = 64;
+
+struct Profiler::ThreadRecord
+{
+    struct Entry {
+        const char *name; // 0 if unused; written once, with release
+        unsigned int calls;
+        unsigned int bins[binCount];
+        unsigned long long total; // ns
+        unsigned long long worst; // ns
+    };
+
+    Entry entries[maxNames];
+    int generation; // of the clear() this thread last responded to
+    ThreadRecord *next;
+};
+
+// Each thread writes only to its own ThreadRecord, and other threads
+// only read from it, so the counters need no locks. The atomic loads
+// and stores here just ensure a reader never sees a torn value.
+
+template <typename T>
+static inline T
+loadRelaxed(const T *p)
+{
+#if defined NO_THREADING || !defined __ATOMIC_RELAXED
+    return *((const volatile T *)p);
+#else
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+#endif
+}
+
+template <typename T>
+static inline void
+storeRelaxed(T *p, T value)
+{
+#if defined NO_THREADING || !defined __ATOMIC_RELAXED
+    *((volatile T *)p) = value;
+#else
+    __atomic_store_n(p, value, __ATOMIC_RELAXED);
+#endif
+}
+
+template <typename T>
+static inline T
+loadAcquire(const T *p)
+{
+#if defined NO_THREADING || !defined __ATOMIC_ACQUIRE
+    T value = *((const volatile T *)p);
+#ifndef NO_THREADING
+    MBARRIER();
+#endif
+    return value;
+#else
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#endif
+}
+
+template <typename T>
+static inline void
+storeRelease(T *p, T value)
+{
+#if defined NO_THREADING || !defined __ATOMIC_RELEASE
+#ifndef NO_THREADING
+    MBARRIER();
+#endif
+    *((volatile T *)p) = value;
+#else
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+#endif
+}
+
+#ifdef NO_TIMING
+static bool s_enabled = false;
+#else
+static bool s_enabled = true;
+#endif
+
+static int s_generation = 0;
+
+static Profiler::ThreadRecord *s_records = 0; // only ever added to
+#ifndef NO_THREADING
+static Mutex s_recordsMutex;
+#endif
+
+static PROFILER_THREAD_LOCAL Profiler::ThreadRecord *s_threadRecord = 0;
+
+static Profiler::ThreadRecord *
+getThreadRecord()
+{
+    if (s_threadRecord) return s_threadRecord;
+
+    // First recording on this thread. The record is never freed, so
+    // that the times stay available after the thread has gone
+    Profiler::ThreadRecord *r = new Profiler::ThreadRecord;
+    memset(r, 0, sizeof(Profiler::ThreadRecord));
+    r->generation = loadRelaxed(&s_generation);
+
+#ifndef NO_THREADING
+    s_recordsMutex.lock();
+#endif
+    r->next = s_records;
+    storeRelease(&s_records, r);
+#ifndef NO_THREADING
+    s_recordsMutex.unlock();
+#endif
+
+    s_threadRecord = r;
+    return r;
+}
+
+static inline int
+binFor(unsigned long long ns)
+{
+    if (ns < (1ULL << minOctave)) return 0;
+    int octave = 0;
+#if defined __GNUC__
+    octave = 63 - __builtin_clzll(ns);
+#else
+    for (unsigned long long n = ns; n > 1; n >>= 1) ++octave;
+#endif
+    int bin = 1 + (octave - minOctave) * binsPerOctave +
+        int((ns >> (octave - 2)) & (binsPerOctave - 1));
+    if (bin >= binCount) bin = binCount - 1;
+    return bin;
+}
+
+static double
+binMidpoint(int bin) // ms
+{
+    if (bin == 0) return double(1ULL << (minOctave - 1)) / 1000000.0;
+    int octave = minOctave + (bin - 1) / binsPerOctave;
+    int step = (bin - 1) % binsPerOctave;
+    double lower = double((binsPerOctave + step) * (1ULL << (octave - 2)));
+    double upper = double((binsPerOctave + step + 1) * (1ULL << (octave - 2)));
+    return (lower + upper) / 2000000.0;
+}
+
+static void
+record(const char *name, unsigned long long ns)
+{
+    Profiler::ThreadRecord *r = getThreadRecord();
+
+    int generation = loadRelaxed(&s_generation);
+    if (generation != r->generation) {
+        // clear() has been called since we last recorded, so we
+        // discard our own data
+        for (int i = 0; i < maxNames; ++i) {
+            Profiler::ThreadRecord::Entry &e = r->entries[i];
+            storeRelaxed(&e.name, (const char *)0);
+            storeRelaxed(&e.calls, 0u);
+            for (int j = 0; j < binCount; ++j) storeRelaxed(&e.bins[j], 0u);
+            storeRelaxed(&e.total, 0ULL);
+            storeRelaxed(&e.worst, 0ULL);
+        }
+        storeRelease(&r->generation, generation);
+    }
+
+    int i = int((size_t(name) >> 3) % maxNames);
+    for (int probe = 0; probe < maxNames; ++probe) {
+        Profiler::ThreadRecord::Entry &e = r->entries[i];
+        if (!e.name) storeRelease(&e.name, name);
+        if (e.name == name) {
+            storeRelaxed(&e.calls, e.calls + 1);
+            int bin = binFor(ns);
+            storeRelaxed(&e.bins[bin], e.bins[bin] + 1);
+            storeRelaxed(&e.total, e.total + ns);
+            if (ns > e.worst) storeRelaxed(&e.worst, ns);
+            return;
+        }
+        if (++i == maxNames) i = 0;
+    }
+}
+
+#ifndef PROFILE_CLOCKS
+
+static inline unsigned long long
+now() // ns
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = { 0 };
+    if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+    return (unsigned long long)
+        ((double(count.QuadPart) * 1000000000.0) / double(frequency.QuadPart));
+#else
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase = { 0, 0 };
+    if (!timebase.denom) mach_timebase_info(&timebase);
+    return (mach_absolute_time() * timebase.numer) / timebase.denom;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+#endif
+}
+
+#endif
+
+Profiler::Profiler(const char* c) :
+    m_c(c),
+    m_start(0),
+    m_running(loadRelaxed(&s_enabled))
+{
+    if (!m_running) return;
+#ifdef PROFILE_CLOCKS
+    m_start = clock();
+#else
+    m_start = now();
+#endif
+}
+
+Profiler::~Profiler()
+{
+    if (m_running) end();
+}
 
-Profiler::ProfileMap
-Profiler::m_profiles;
+void
+Profiler::end()
+{
+    if (!m_running) return;
+    m_running = false;
 
-Profiler::WorstCallMap
-Profiler::m_worstCalls;
+#ifdef PROFILE_CLOCKS
+    clock_t elapsed = clock() - m_start;
+    double ns = (double(elapsed) / double(CLOCKS_PER_SEC)) * 1000000000.0;
+    record(m_c, (unsigned long long)ns);
+#else
+    record(m_c, now() - m_start);
+#endif
+}
 
 void
-Profiler::add(const char *id, float ms)
-{
-    ProfileMap::iterator pmi = m_profiles.find(id);
-    if (pmi != m_profiles.end()) {
-        ++pmi->second.first;
-        pmi->second.second += ms;
-    } else {
-        m_profiles[id] = TimePair(1, ms);
+Profiler::setEnabled(bool enabled)
+{
+    storeRelaxed(&s_enabled, enabled);
+}
+
+bool
+Profiler::isEnabled()
+{
+    return loadRelaxed(&s_enabled);
+}
+
+void
+Profiler::clear()
+{
+#ifndef NO_THREADING
+    s_recordsMutex.lock();
+#endif
+    storeRelaxed(&s_generation, s_generation + 1);
+#ifndef NO_THREADING
+    s_recordsMutex.unlock();
+#endif
+}
+
+namespace {
+
+struct StrLess {
+    bool operator()(const char *a, const char *b) const {
+        return strcmp(a, b) < 0;
+    }
+};
+
+struct Accumulated {
+    Accumulated() : calls(0), total(0), worst(0), bins(binCount, 0) { }
+    size_t calls;
+    unsigned long long total;
+    unsigned long long worst;
+    std::vector<size_t> bins;
+};
+
+double
+percentile(const Accumulated &a, double p)
+{
+    size_t target = size_t(a.calls * p);
+    if (target < 1) target = 1;
+    size_t sum = 0;
+    double worst = double(a.worst) / 1000000.0;
+    for (int i = 0; i < binCount; ++i) {
+        sum += a.bins[i];
+        if (sum >= target) return std::min(binMidpoint(i), worst);
+    }
+    return worst;
+}
+
+}
+
+std::vector<Profiler::Stats>
+Profiler::getStats()
+{
+    // The same name may appear at different addresses if it is a
+    // literal used in more than one file, so we merge by content
+    typedef std::map<const char *, Accumulated, StrLess> AccMap;
+    AccMap acc;
+
+#ifndef NO_THREADING
+    s_recordsMutex.lock();
+#endif
+    int generation = loadRelaxed(&s_generation);
+#ifndef NO_THREADING
+    s_recordsMutex.unlock();
+#endif
+
+    for (ThreadRecord *r = loadAcquire(&s_records); r; r = r->next) {
+        // A thread that has not recorded since the last clear() still
+        // holds its data from before it
+        if (loadAcquire(&r->generation) != generation) continue;
+        for (int i = 0; i < maxNames; ++i) {
+            const ThreadRecord::Entry &e = r->entries[i];
+            const char *name = loadAcquire(&e.name);
+            if (!name) continue;
+            Accumulated &a = acc[name];
+            a.calls += loadRelaxed(&e.calls);
+            a.total += loadRelaxed(&e.total);
+            a.worst = std::max(a.worst, loadRelaxed(&e.worst));
+            for (int j = 0; j < binCount; ++j) {
+                a.bins[j] += loadRelaxed(&e.bins[j]);
+            }
+        }
     }
 
-    WorstCallMap::iterator wci = m_worstCalls.find(id);
-    if (wci != m_worstCalls.end()) {
-        if (ms > wci->second) wci->second = ms;
-    } else {
-        m_worstCalls[id] = ms;
+    std::vector<Stats> stats;
+    for (AccMap::const_iterator i = acc.begin(); i != acc.end(); ++i) {
+        const Accumulated &a = i->second;
+        if (a.calls == 0) continue;
+        Stats s;
+        s.name = i->first;
+        s.calls = a.calls;
+        s.total = double(a.total) / 1000000.0;
+        s.p50 = percentile(a, 0.5);
+        s.p99 = percentile(a, 0.99);
+        s.worst = double(a.worst) / 1000000.0;
+        stats.push_back(s);
     }
+    return stats;
 }
 
 void
 Profiler::dump()
 {
     std::string report = getReport();
-    fprintf(stderr, "%s", report.c_str());
+    if (report != "") fprintf(stderr, "%s", report.c_str());
 }
 
 std::string
 Profiler::getReport()
 {
+    std::vector<Stats> stats = getStats();
+    if (stats.empty()) return std::string();
+
     static const int buflen = 256;
     char buffer[buflen];
     std::string report;
@@ -85,22 +435,17 @@ Profiler::getReport()
 #endif
     report += buffer;
 
-    typedef std::multimap<float, const char *> TimeRMap;
-    typedef std::multimap<int, const char *> IntRMap;
+    typedef std::multimap<double, const char *> TimeRMap;
+    typedef std::multimap<size_t, const char *> IntRMap;
     TimeRMap totmap, avgmap, worstmap;
     IntRMap ncallmap;
 
-    for (ProfileMap::const_iterator i = m_profiles.begin();
-         i != m_profiles.end(); ++i) {
-        totmap.insert(TimeRMap::value_type(i->second.second, i->first));
-        avgmap.insert(TimeRMap::value_type(i->second.second /
-                                           i->second.first, i->first));
-        ncallmap.insert(IntRMap::value_type(i->second.first, i->first));
-    }
-
-    for (WorstCallMap::const_iterator i = m_worstCalls.begin();
-         i != m_worstCalls.end(); ++i) {
-        worstmap.insert(TimeRMap::value_type(i->second, i->first));
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const Stats &s = stats[i];
+        totmap.insert(TimeRMap::value_type(s.total, s.name));
+        avgmap.insert(TimeRMap::value_type(s.total / s.calls, s.name));
+        worstmap.insert(TimeRMap::value_type(s.worst, s.name));
+        ncallmap.insert(IntRMap::value_type(s.calls, s.name));
     }
 
     snprintf(buffer, buflen, "\nBy total:\n");
@@ -131,97 +476,32 @@ Profiler::getReport()
     report += buffer;
     for (IntRMap::const_iterator i = ncallmap.end(); i != ncallmap.begin(); ) {
         --i;
-        snprintf(buffer, buflen, "%-40s  %d\n", i->second, i->first);
+        snprintf(buffer, buflen, "%-40s  %lu\n", i->second,
+                 (unsigned long)i->first);
         report += buffer;
     }
 
     snprintf(buffer, buflen, "\nBy name:\n");
     report += buffer;
 
-    typedef std::set<const char *, std::less<std::string> > StringSet;
-
-    StringSet profileNames;
-    for (ProfileMap::const_iterator i = m_profiles.begin();
-         i != m_profiles.end(); ++i) {
-        profileNames.insert(i->first);
-    }
-
-    for (StringSet::const_iterator i = profileNames.begin();
-         i != profileNames.end(); ++i) {
-
-        ProfileMap::const_iterator j = m_profiles.find(*i);
-        if (j == m_profiles.end()) continue;
-
-        const TimePair &pp(j->second);
-        snprintf(buffer, buflen, "%s(%d):\n", *i, pp.first);
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const Stats &s = stats[i];
+        snprintf(buffer, buflen, "%s(%lu):\n", s.name,
+                 (unsigned long)s.calls);
         report += buffer;
         snprintf(buffer, buflen, "\tReal: \t%f ms      \t[%f ms total]\n",
-                (pp.second / pp.first),
-                (pp.second));
+                 (s.total / s.calls), s.total);
         report += buffer;
-
-        WorstCallMap::const_iterator k = m_worstCalls.find(*i);
-        if (k == m_worstCalls.end()) continue;
-        
-        snprintf(buffer, buflen, "\tWorst:\t%f ms/call\n", k->second);
+        snprintf(buffer, buflen, "\tMedian:\t%f ms\t99th:\t%f ms\n",
+                 s.p50, s.p99);
+        report += buffer;
+        snprintf(buffer, buflen, "\tWorst:\t%f ms/call\n", s.worst);
         report += buffer;
     }
 
     return report;
 }
 
-Profiler::Profiler(const char* c) :
-    m_c(c),
-    m_ended(false)
-{
-#ifdef PROFILE_CLOCKS
-    m_start = clock();
-#else
-    (void)gettimeofday(&m_start, 0);
-#endif
 }
 
-Profiler::~Profiler()
-{
-    if (!m_ended) end();
-}
-
-void
-Profiler::end()
-{
-#ifdef PROFILE_CLOCKS
-    clock_t end = clock();
-    clock_t elapsed = end - m_start;
-    float ms = float((double(elapsed) / double(CLOCKS_PER_SEC)) * 1000.0);
-#else
-    struct timeval tv;
-    (void)gettimeofday(&tv, 0);
-
-    tv.tv_sec -= m_start.tv_sec;
-    if (tv.tv_usec < m_start.tv_usec) {
-        tv.tv_usec += 1000000;
-        tv.tv_sec -= 1;
-    }
-    tv.tv_usec -= m_start.tv_usec;
-    float ms = float((double(tv.tv_sec) + (double(tv.tv_usec) / 1000000.0)) * 1000.0);
-#endif
-
-    add(m_c, ms);
-
-    m_ended = true;
-}
- 
-#else /* NO_TIMING */
-
-#ifndef NO_TIMING_COMPLETE_NOOP
-
-Profiler::Profiler(const char *) { }
-Profiler::~Profiler() { }
-void Profiler::end() { }
-void Profiler::dump() { }
-
-#endif
-
 #endif
-
-}
@@ -38,26 +38,38 @@
 #undef NO_TIMING
 #endif
 
-#ifndef NO_TIMING
+#ifndef NO_TIMING_COMPLETE_NOOP
 #ifdef PROFILE_CLOCKS
 #include <time.h>
-#else
-#include "system/sysutils.h"
-#ifndef _WIN32
-#include <sys/time.h>
-#endif
 #endif
 #endif
 
-#ifndef NO_TIMING
-#include <map>
+#include <vector>
 #include <string>
-#endif
+#include <cstddef>
 
 namespace RubberBand {
 
-#ifndef NO_TIMING
-
+/**
+ * Scoped timer for a named part of the code.  Construct one at the
+ * start of a scope and it records the elapsed time when it goes out
+ * of scope (or when end() is called).
+ *
+ * Timings are accumulated into a histogram for each name, held per
+ * thread, so that recording a time never takes a lock or allocates
+ * (other than the first time a thread records anything).  Summaries
+ * of the histograms, across all threads, can be obtained at any time
+ * with getStats().
+ *
+ * Recording is enabled by default if the library was built with
+ * timing (i.e. without NO_TIMING, see above).  Otherwise it is
+ * disabled by default, but can still be switched on at run time with
+ * setEnabled(true): the cost of a disabled Profiler is a single test
+ * of a flag.  Only NO_TIMING_COMPLETE_NOOP removes it entirely.
+ *
+ * The name is not copied and must be a string that outlives all
+ * profiling, typically a literal.
+ */
 class Profiler
 {
 public:
@@ -66,63 +78,72 @@ public:
 
     void end(); // same action as dtor
 
-    static void dump();
-
-    // Unlike the other functions, this is only defined if NO_TIMING
-    // is not set (because it uses std::string which is otherwise
-    // unused here). So, treat this as a tricksy internal function
-    // rather than an API call and guard any call to it appropriately.
+    /**
+     * Summary of the times recorded for one name, in milliseconds.
+     * The percentiles are approximate, taken from a histogram with
+     * four bins per octave.
+     */
+    struct Stats {
+        const char *name;
+        size_t calls;
+        double total;
+        double p50;
+        double p99;
+        double worst;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /**
+     * Return the times recorded since startup (or since the last
+     * clear()) for every name, across all threads, sorted by name.
+     * This may be called from any thread while others are recording.
+     */
+    static std::vector<Stats> getStats();
+
+    /**
+     * Discard all times recorded so far.  Each thread discards its own
+     * on its next recording, so a clear() concurrent with recording
+     * may lose a few of the recorded times around it.
+     */
+    static void clear();
+
+    static void dump(); // report to stderr, if anything was recorded
     static std::string getReport();
 
+#ifndef NO_TIMING_COMPLETE_NOOP
+    struct ThreadRecord; // private to Profiler.cpp
+
 protected:
-    const char* m_c;
+    const char *m_c;
 #ifdef PROFILE_CLOCKS
     clock_t m_start;
 #else
-    struct timeval m_start;
+    unsigned long long m_start; // ns
+#endif
+    bool m_running;
 #endif
-    bool m_showOnDestruct;
-    bool m_ended;
-
-    typedef std::pair<int, float> TimePair;
-    typedef std::map<const char *, TimePair> ProfileMap;
-    typedef std::map<const char *, float> WorstCallMap;
-    static ProfileMap m_profiles;
-    static WorstCallMap m_worstCalls;
-    static void add(const char *, float);
 };
 
-#else
-
 #ifdef NO_TIMING_COMPLETE_NOOP
 
 // Fastest for release builds, but annoying because it can't be linked
 // with code built in debug mode (expecting non-inline functions), so
 // not preferred during development
 
-class Profiler
-{
-public:
-    Profiler(const char *) { }
-    ~Profiler() { }
-
-    void end() { }
-    static void dump() { }
-};
-
-#else
-
-class Profiler
-{
-public:
-    Profiler(const char *);
-    ~Profiler();
-
-    void end();
-    static void dump();
-};
+inline Profiler::Profiler(const char *) { }
+inline Profiler::~Profiler() { }
+inline void Profiler::end() { }
+inline void Profiler::setEnabled(bool) { }
+inline bool Profiler::isEnabled() { return false; }
+inline std::vector<Profiler::Stats> Profiler::getStats() {
+    return std::vector<Stats>();
+}
+inline void Profiler::clear() { }
+inline void Profiler::dump() { }
+inline std::string Profiler::getReport() { return std::string(); }
 
-#endif
 #endif
 
 }
@@ -40,7 +40,11 @@ namespace RubberBand {
  * one reader, that is to be used to store a sample type T.
  *
  * RingBuffer is thread-safe provided only one thread writes and only
- * one thread reads.
+ * one thread reads.  Each thread publishes its index with a release
+ * store and reads the other's with an acquire load, where the
+ * compiler provides atomic builtins, or else through a full memory
+ * barrier.  The two indices are kept on separate cache lines so that
+ * the threads do not contend for one line when updating them.
  */
 
 template <typename T>
@@ -147,6 +151,21 @@ public:
      */
     T peekOne() const;
 
+    /**
+     * Obtain the next n samples in the buffer without copying them or
+     * advancing the read pointer, for example to window them straight
+     * into an FFT input buffer, before skip()ping them.  As they may
+     * wrap around the end of the buffer, the samples are returned in
+     * two parts: "firstCount" samples starting at "first", followed
+     * by "secondCount" starting at "second" (usually none).  If fewer
+     * than n are available, the counts cover only those that are.
+     * Returns the total, firstCount + secondCount.  The pointers are
+     * valid until the samples are read or skipped.
+     */
+    int peekSpans(int n,
+                  const T *&first, int &firstCount,
+                  const T *&second, int &secondCount) const;
+
     /**
      * Pretend to read n samples from the buffer, without actually
      * returning them (i.e. discard the next n samples).  Returns the
@@ -174,11 +193,41 @@ public:
     int zero(int n);
 
 protected:
+    enum { CacheLineSize = 64 };
+
     T *const R__ m_buffer;
-    int          m_writer;
-    int          m_reader;
     const int    m_size;
     bool         m_mlocked;
+    char         m_pad0[CacheLineSize];
+    int          m_writer;
+    char         m_pad1[CacheLineSize - sizeof(int)];
+    int          m_reader;
+    char         m_pad2[CacheLineSize - sizeof(int)];
+
+    // Acquire loads and release stores of the indices
+
+    static int load(const int &index) {
+#if defined NO_THREADING
+        return index;
+#elif defined __ATOMIC_ACQUIRE
+        return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+#else
+        int value = *(const volatile int *)&index;
+        MBARRIER();
+        return value;
+#endif
+    }
+
+    static void store(int &index, int value) {
+#if defined NO_THREADING
+        index = value;
+#elif defined __ATOMIC_RELEASE
+        __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+#else
+        MBARRIER();
+        *(volatile int *)&index = value;
+#endif
+    }
 
     int readSpaceFor(int w, int r) const {
         int space;
@@ -202,15 +251,14 @@ private:
 template <typename T>
 RingBuffer<T>::RingBuffer(int n) :
     m_buffer(allocate<T>(n + 1)),
-    m_writer(0),
     m_size(n + 1),
-    m_mlocked(false)
+    m_mlocked(false),
+    m_writer(0),
+    m_reader(0)
 {
 #ifdef DEBUG_RINGBUFFER
     std::cerr << "RingBuffer<T>[" << this << "]::RingBuffer(" << n << ")" << std::endl;
 #endif
-
-    m_reader = 0;
 }
 
 template <typename T>
@@ -244,8 +292,8 @@ RingBuffer<T>::resized(int newSize) const
 {
     RingBuffer<T> *newBuffer = new RingBuffer<T>(newSize);
 
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     while (r != w) {
         T value = m_buffer[r];
@@ -273,21 +321,21 @@ RingBuffer<T>::reset()
     std::cerr << "RingBuffer<T>[" << this << "]::reset" << std::endl;
 #endif
 
-    m_reader = m_writer;
+    store(m_reader, load(m_writer));
 }
 
 template <typename T>
 int
 RingBuffer<T>::getReadSpace() const
 {
-    return readSpaceFor(m_writer, m_reader);
+    return readSpaceFor(load(m_writer), load(m_reader));
 }
 
 template <typename T>
 int
 RingBuffer<T>::getWriteSpace() const
 {
-    return writeSpaceFor(m_writer, m_reader);
+    return writeSpaceFor(load(m_writer), load(m_reader));
 }
 
 template <typename T>
@@ -295,8 +343,8 @@ template <typename S>
 int
 RingBuffer<T>::read(S *const R__ destination, int n)
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = readSpaceFor(w, r);
     if (n > available) {
@@ -320,8 +368,7 @@ RingBuffer<T>::read(S *const R__ destination, int n)
     r += n;
     while (r >= m_size) r -= m_size;
 
-    MBARRIER();
-    m_reader = r;
+    store(m_reader, r);
 
     return n;
 }
@@ -331,8 +378,8 @@ template <typename S>
 int
 RingBuffer<T>::readAdding(S *const R__ destination, int n)
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = readSpaceFor(w, r);
     if (n > available) {
@@ -355,8 +402,7 @@ RingBuffer<T>::readAdding(S *const R__ destination, int n)
     r += n;
     while (r >= m_size) r -= m_size;
 
-    MBARRIER();
-    m_reader = r;
+    store(m_reader, r);
 
     return n;
 }
@@ -365,8 +411,8 @@ template <typename T>
 T
 RingBuffer<T>::readOne()
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     if (w == r) {
 	std::cerr << "WARNING: RingBuffer::readOne: no sample available"
@@ -377,8 +423,7 @@ RingBuffer<T>::readOne()
     T value = m_buffer[r];
     if (++r == m_size) r = 0;
 
-    MBARRIER();
-    m_reader = r;
+    store(m_reader, r);
 
     return value;
 }
@@ -387,8 +432,8 @@ template <typename T>
 int
 RingBuffer<T>::peek(T *const R__ destination, int n) const
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = readSpaceFor(w, r);
     if (n > available) {
@@ -399,14 +444,13 @@ RingBuffer<T>::peek(T *const R__ destination, int n) const
     }
     if (n == 0) return n;
 
-    int here = m_size - r;
-    const T *const R__ bufbase = m_buffer + r;
+    const T *first, *second;
+    int firstCount, secondCount;
+    peekSpans(n, first, firstCount, second, secondCount);
 
-    if (here >= n) {
-        v_copy(destination, bufbase, n);
-    } else {
-        v_copy(destination, bufbase, here);
-        v_copy(destination + here, m_buffer, n - here);
+    v_copy(destination, first, firstCount);
+    if (secondCount > 0) {
+        v_copy(destination + firstCount, second, secondCount);
     }
 
     return n;
@@ -416,8 +460,8 @@ template <typename T>
 T
 RingBuffer<T>::peekOne() const
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     if (w == r) {
 	std::cerr << "WARNING: RingBuffer::peekOne: no sample available"
@@ -429,12 +473,40 @@ RingBuffer<T>::peekOne() const
     return value;
 }
 
+template <typename T>
+int
+RingBuffer<T>::peekSpans(int n,
+                         const T *&first, int &firstCount,
+                         const T *&second, int &secondCount) const
+{
+    int w = load(m_writer);
+    int r = load(m_reader);
+
+    int available = readSpaceFor(w, r);
+    if (n > available) n = available;
+
+    int here = m_size - r;
+
+    first = m_buffer + r;
+    second = m_buffer;
+
+    if (here >= n) {
+        firstCount = n;
+        secondCount = 0;
+    } else {
+        firstCount = here;
+        secondCount = n - here;
+    }
+
+    return n;
+}
+
 template <typename T>
 int
 RingBuffer<T>::skip(int n)
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = readSpaceFor(w, r);
     if (n > available) {
@@ -447,8 +519,7 @@ RingBuffer<T>::skip(int n)
     r += n;
     while (r >= m_size) r -= m_size;
 
-    // No memory barrier required, because we didn't read any data
-    m_reader = r;
+    store(m_reader, r);
 
     return n;
 }
@@ -458,8 +529,8 @@ template <typename S>
 int
 RingBuffer<T>::write(const S *const R__ source, int n)
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = writeSpaceFor(w, r);
     if (n > available) {
@@ -482,8 +553,7 @@ RingBuffer<T>::write(const S *const R__ source, int n)
     w += n;
     while (w >= m_size) w -= m_size;
 
-    MBARRIER();
-    m_writer = w;
+    store(m_writer, w);
 
     return n;
 }
@@ -492,8 +562,8 @@ template <typename T>
 int
 RingBuffer<T>::zero(int n)
 {
-    int w = m_writer;
-    int r = m_reader;
+    int w = load(m_writer);
+    int r = load(m_reader);
 
     int available = writeSpaceFor(w, r);
     if (n > available) {
@@ -516,8 +586,7 @@ RingBuffer<T>::zero(int n)
     w += n;
     while (w >= m_size) w -= m_size;
 
-    MBARRIER();
-    m_writer = w;
+    store(m_writer, w);
 
     return n;
 }
@@ -0,0 +1,115 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    Rubber Band Library
+    An audio time-stretching and pitch-shifting library.
+    Copyright 2007-2015 Particular Programs Ltd.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+
+    Alternatively, if you have a valid commercial licence for the
+    Rubber Band Library obtained by agreement with the copyright
+    holders, you may redistribute and/or modify it under the terms
+    described in that licence.
+
+    If you wish to distribute code using the Rubber Band Library
+    under terms other than those of the GNU General Public License,
+    you must obtain a valid commercial licence before doing so.
+*/
+
+
+#include "Scavenger.h"
+
+#include <set>
+
+namespace RubberBand
+{
+
+#ifndef NO_THREADING
+
+/**
+ * The background thread.  It wakes a few times a second and runs
+ * scavenge() on each registered scavenger in turn.  Like the thread
+ * pool, it is started when first needed and never stopped.
+ */
+
+class ScavengerThread : public Thread
+{
+public:
+    static ScavengerThread *getInstance() {
+        MutexLocker locker(&m_instanceMutex);
+        if (!m_instance) {
+            m_instance = new ScavengerThread();
+            m_instance->start();
+        }
+        return m_instance;
+    }
+
+    void add(ScavengerBase *s) {
+        MutexLocker locker(&m_mutex);
+        m_scavengers.insert(s);
+    }
+
+    void remove(ScavengerBase *s) {
+        MutexLocker locker(&m_mutex);
+        m_scavengers.erase(s);
+    }
+
+protected:
+    ScavengerThread() : m_wake("scavenger") { }
+
+    void run() {
+        while (true) {
+            m_wake.lock();
+            m_wake.wait(250000);
+            m_wake.unlock();
+            MutexLocker locker(&m_mutex);
+            for (std::set<ScavengerBase *>::iterator i = m_scavengers.begin();
+                 i != m_scavengers.end(); ++i) {
+                (*i)->scavenge();
+            }
+        }
+    }
+
+    Mutex m_mutex;
+    std::set<ScavengerBase *> m_scavengers;
+    Condition m_wake;
+
+    static Mutex m_instanceMutex;
+    static ScavengerThread *m_instance;
+};
+
+Mutex ScavengerThread::m_instanceMutex;
+ScavengerThread *ScavengerThread::m_instance = 0;
+
+void
+ScavengerBase::addToBackgroundThread(ScavengerBase *s)
+{
+    ScavengerThread::getInstance()->add(s);
+}
+
+void
+ScavengerBase::removeFromBackgroundThread(ScavengerBase *s)
+{
+    ScavengerThread::getInstance()->remove(s);
+}
+
+#else
+
+void
+ScavengerBase::addToBackgroundThread(ScavengerBase *)
+{
+}
+
+void
+ScavengerBase::removeFromBackgroundThread(ScavengerBase *)
+{
+}
+
+#endif
+
+}
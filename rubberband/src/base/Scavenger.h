@@ -42,21 +42,76 @@
 namespace RubberBand {
 
 /**
- * A very simple class that facilitates running things like plugins
- * without locking, by collecting unwanted objects and deleting them
- * after a delay so as to be sure nobody's in the middle of using
- * them.  Requires scavenge() to be called regularly from a non-RT
- * thread.
- *
- * This is currently not at all suitable for large numbers of objects
- * -- it's just a quick hack for use with things like plugins.
+ * The part of Scavenger that doesn't depend on the object type, so
+ * that the background thread can keep a list of scavengers of any
+ * type.
  */
 
-//!!! should review this, it's not really thread safe owing to lack of
-//!!! atomic updates
+class ScavengerBase
+{
+public:
+    virtual ~ScavengerBase() { }
+    virtual void scavenge(bool clearNow = false) = 0;
+
+protected:
+    /**
+     * Add to or remove from the scavengers that a single process-wide
+     * thread calls scavenge() on a few times a second, starting the
+     * thread on the first call.  remove() waits for any scavenge()
+     * call already under way on that thread to return.  Neither does
+     * anything if NO_THREADING is defined.
+     */
+    static void addToBackgroundThread(ScavengerBase *);
+    static void removeFromBackgroundThread(ScavengerBase *);
+
+    // Acquire loads and release stores, as in RingBuffer
+
+    static unsigned int load(const unsigned int &value) {
+#if defined NO_THREADING
+        return value;
+#elif defined __ATOMIC_ACQUIRE
+        return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+#else
+        unsigned int v = *(const volatile unsigned int *)&value;
+        MBARRIER();
+        return v;
+#endif
+    }
+
+    static void store(unsigned int &value, unsigned int v) {
+#if defined NO_THREADING
+        value = v;
+#elif defined __ATOMIC_RELEASE
+        __atomic_store_n(&value, v, __ATOMIC_RELEASE);
+#else
+        MBARRIER();
+        *(volatile unsigned int *)&value = v;
+#endif
+    }
+};
+
+/**
+ * A class that facilitates running things like plugins without
+ * locking, by collecting unwanted objects and deleting them once
+ * nobody can be in the middle of using them.
+ *
+ * A thread that swaps out an object still visible to other threads
+ * passes the old one to claim(), which is wait-free and never deletes
+ * anything itself.  Deletion happens in scavenge(), which is called
+ * a few times a second from a background thread, and may also be
+ * called from any non-RT thread.
+ *
+ * By default an object is deleted "sec" seconds after it was
+ * claimed, on the assumption that nobody holds on to one for that
+ * long.  Threads that read the objects may instead register with
+ * addReader() and bracket each use with enter() and leave().  Once
+ * any reader is registered, an object is deleted as soon as every
+ * reader has been outside enter() and leave() at some point since it
+ * was claimed, however long or short a time that is.
+ */
 
 template <typename T>
-class Scavenger
+class Scavenger : public ScavengerBase
 {
 public:
     Scavenger(int sec = 2, int defaultObjectListSize = 200);
@@ -65,31 +120,79 @@ public:
     /**
      * Call from an RT thread etc., to pass ownership of t to us.
      * Only one thread should be calling this on any given scavenger.
+     * This is wait-free unless defaultObjectListSize objects are
+     * already waiting to be deleted, in which case it has to take a
+     * lock.
      */
     void claim(T *t);
 
     /**
-     * Call from a non-RT thread.
-     * Only one thread should be calling this on any given scavenger.
+     * Register a thread that uses objects which another thread may
+     * claim, returning the index to pass to enter() and leave(), or
+     * -1 if there are already MaxReaders.  Call from a non-RT thread
+     * before the reader first uses an object.
+     */
+    int addReader();
+
+    /**
+     * Call before and after using an object that may be claimed by
+     * another thread.  Both are wait-free.  Only one thread at a time
+     * should use any given reader index.  A reader index of -1 is
+     * ignored.
+     */
+    void enter(int reader) const;
+    void leave(int reader) const;
+
+    /**
+     * Calls enter() on construction and leave() on destruction.
+     */
+    class ReadSection
+    {
+    public:
+        ReadSection(const Scavenger<T> &s, int reader) :
+            m_s(s), m_reader(reader) { m_s.enter(m_reader); }
+        ~ReadSection() { m_s.leave(m_reader); }
+    private:
+        const Scavenger<T> &m_s;
+        int m_reader;
+    };
+
+    /**
+     * Delete whatever can be deleted now, or everything if clearNow
+     * is true.  Call from a non-RT thread.
      */
     void scavenge(bool clearNow = false);
 
+    enum { MaxReaders = 8 };
+
 protected:
-    typedef std::pair<T *, int> ObjectTimePair;
-    typedef std::vector<ObjectTimePair> ObjectTimeList;
-    ObjectTimeList m_objects;
+    struct Entry {
+        T *object;
+        unsigned int epoch; // at claim
+        int sec; // likewise
+    };
+
+    // Single-writer, single-reader ring of claimed objects, written
+    // by claim() and read by scavenge()
+    std::vector<Entry> m_objects;
+    unsigned int m_writer;
+    unsigned int m_reader;
     int m_sec;
 
-    typedef std::list<T *> ObjectList;
+    // Advanced by each scavenge().  A reader's slot holds the epoch in
+    // which it last called enter(), or 0 when it is outside
+    unsigned int m_epoch;
+    mutable unsigned int m_readerEpochs[MaxReaders];
+    int m_readerCount;
+
+    typedef std::list<Entry> ObjectList;
     ObjectList m_excess;
-    int m_lastExcess;
     Mutex m_excessMutex;
-    void pushExcess(T *);
-    void clearExcess(int);
+    Mutex m_scavengeMutex;
+    void pushExcess(const Entry &);
 
-    unsigned int m_claimed;
-    unsigned int m_scavenged;
-    unsigned int m_asExcess;
+    bool canDelete(const Entry &e, int sec, bool clearNow) const;
+    static int now();
 };
 
 
@@ -128,31 +231,33 @@ private:
 
 template <typename T>
 Scavenger<T>::Scavenger(int sec, int defaultObjectListSize) :
-    m_objects(ObjectTimeList(defaultObjectListSize)),
+    m_objects(defaultObjectListSize + 1),
+    m_writer(0),
+    m_reader(0),
     m_sec(sec),
-    m_lastExcess(0),
-    m_claimed(0),
-    m_scavenged(0),
-    m_asExcess(0)
+    m_epoch(1),
+    m_readerCount(0)
 {
+    for (int i = 0; i < MaxReaders; ++i) {
+        m_readerEpochs[i] = 0;
+    }
+    addToBackgroundThread(this);
 }
 
 template <typename T>
 Scavenger<T>::~Scavenger()
 {
-    if (m_scavenged < m_claimed) {
-	for (size_t i = 0; i < m_objects.size(); ++i) {
-	    ObjectTimePair &pair = m_objects[i];
-	    if (pair.first != 0) {
-		T *ot = pair.first;
-		pair.first = 0;
-		delete ot;
-		++m_scavenged;
-	    }
-	}
-    }
+    removeFromBackgroundThread(this);
+    scavenge(true);
+}
 
-    clearExcess(0);
+template <typename T>
+int
+Scavenger<T>::now()
+{
+    struct timeval tv;
+    (void)gettimeofday(&tv, 0);
+    return tv.tv_sec;
 }
 
 template <typename T>
@@ -161,87 +266,136 @@ Scavenger<T>::claim(T *t)
 {
 //    std::cerr << "Scavenger::claim(" << t << ")" << std::endl;
 
-    struct timeval tv;
-    (void)gettimeofday(&tv, 0);
-    int sec = tv.tv_sec;
-
-    for (size_t i = 0; i < m_objects.size(); ++i) {
-	ObjectTimePair &pair = m_objects[i];
-	if (pair.first == 0) {
-	    pair.second = sec;
-	    pair.first = t;
-	    ++m_claimed;
-	    return;
-	}
+    // The caller has just replaced t with something else where
+    // readers can find it; that must be visible before we read the
+    // epoch, so that any reader entering in a later epoch can't see t
+    MBARRIER();
+
+    Entry e;
+    e.object = t;
+    e.epoch = load(m_epoch);
+    e.sec = now();
+
+    const unsigned int size = m_objects.size();
+    unsigned int w = m_writer;
+    unsigned int next = (w + 1 == size ? 0 : w + 1);
+
+    if (next != load(m_reader)) {
+        m_objects[w] = e;
+        store(m_writer, next);
+        return;
     }
 
 #ifdef DEBUG_SCAVENGER
     std::cerr << "WARNING: Scavenger::claim(" << t << "): run out of slots (at "
-              << m_objects.size() << "), using non-RT-safe method" << std::endl;
+              << size - 1 << "), using non-RT-safe method" << std::endl;
 #endif
-    pushExcess(t);
+    pushExcess(e);
+}
+
+template <typename T>
+int
+Scavenger<T>::addReader()
+{
+    MutexLocker locker(&m_scavengeMutex);
+    if (m_readerCount == MaxReaders) return -1;
+    return m_readerCount++;
 }
 
 template <typename T>
 void
-Scavenger<T>::scavenge(bool clearNow)
+Scavenger<T>::enter(int reader) const
 {
-#ifdef DEBUG_SCAVENGER
-    std::cerr << "Scavenger::scavenge: claimed " << m_claimed << ", scavenged " << m_scavenged << ", cleared as excess " << m_asExcess << std::endl;
-#endif
+    if (reader < 0) return;
+    store(m_readerEpochs[reader], load(m_epoch));
+    // Our slot must be visible before we look at any shared object
+    MBARRIER();
+}
 
-    if (m_scavenged >= m_claimed) return;
-    
-    struct timeval tv;
-    (void)gettimeofday(&tv, 0);
-    int sec = tv.tv_sec;
-    bool anything = false;
-
-    for (size_t i = 0; i < m_objects.size(); ++i) {
-	ObjectTimePair &pair = m_objects[i];
-        if (!pair.first) continue;
-	if (clearNow || pair.second + m_sec < sec) {
-	    T *ot = pair.first;
-	    pair.first = 0;
-	    delete ot;
-	    ++m_scavenged;
-            anything = true;
-	}
+template <typename T>
+void
+Scavenger<T>::leave(int reader) const
+{
+    if (reader < 0) return;
+    store(m_readerEpochs[reader], 0);
+}
+
+template <typename T>
+bool
+Scavenger<T>::canDelete(const Entry &e, int sec, bool clearNow) const
+{
+    if (clearNow) return true;
+
+    if (m_readerCount == 0) {
+        return e.sec + m_sec < sec;
     }
 
-    if (clearNow || anything || (sec > m_lastExcess + m_sec)) {
-        clearExcess(sec);
+    // A reader that has been inside since the epoch the object was
+    // claimed in may still be using it
+    for (int i = 0; i < m_readerCount; ++i) {
+        unsigned int r = load(m_readerEpochs[i]);
+        if (r != 0 && int(r - e.epoch) <= 0) return false;
     }
+    return true;
 }
 
 template <typename T>
 void
-Scavenger<T>::pushExcess(T *t)
+Scavenger<T>::scavenge(bool clearNow)
 {
+    MutexLocker locker(&m_scavengeMutex);
+
+    int sec = now();
+
+    // Begin a new epoch, so that readers entering from here on are
+    // known not to have seen anything claimed so far
+    unsigned int epoch = m_epoch + 1;
+    if (epoch == 0) epoch = 1;
+    store(m_epoch, epoch);
+    MBARRIER();
+
+    // Entries are in order of claiming, so stop at the first that
+    // has to stay
+    const unsigned int size = m_objects.size();
+    unsigned int r = m_reader;
+    unsigned int w = load(m_writer);
+    int deleted = 0;
+
+    while (r != w) {
+        Entry &e = m_objects[r];
+        if (!canDelete(e, sec, clearNow)) break;
+        delete e.object;
+        e.object = 0;
+        ++deleted;
+        r = (r + 1 == size ? 0 : r + 1);
+        store(m_reader, r);
+    }
+
     m_excessMutex.lock();
-    m_excess.push_back(t);
-    struct timeval tv;
-    (void)gettimeofday(&tv, 0);
-    m_lastExcess = tv.tv_sec;
+    typename ObjectList::iterator i = m_excess.begin();
+    while (i != m_excess.end()) {
+        if (!canDelete(*i, sec, clearNow)) break;
+        delete i->object;
+        ++deleted;
+        i = m_excess.erase(i);
+    }
     m_excessMutex.unlock();
+
+#ifdef DEBUG_SCAVENGER
+    if (deleted > 0) {
+        std::cerr << "Scavenger::scavenge: deleted " << deleted << std::endl;
+    }
+#else
+    (void)deleted;
+#endif
 }
 
 template <typename T>
 void
-Scavenger<T>::clearExcess(int sec)
+Scavenger<T>::pushExcess(const Entry &e)
 {
-#ifdef DEBUG_SCAVENGER
-    std::cerr << "Scavenger::clearExcess: Excess now " << m_excess.size() << std::endl;
-#endif
-
     m_excessMutex.lock();
-    for (typename ObjectList::iterator i = m_excess.begin();
-	 i != m_excess.end(); ++i) {
-	delete *i;
-        ++m_asExcess;
-    }
-    m_excess.clear();
-    m_lastExcess = sec;
+    m_excess.push_back(e);
     m_excessMutex.unlock();
 }
 
@@ -0,0 +1,138 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    Rubber Band Library
+    An audio time-stretching and pitch-shifting library.
+    Copyright 2007-2015 Particular Programs Ltd.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+
+    Alternatively, if you have a valid commercial licence for the
+    Rubber Band Library obtained by agreement with the copyright
+    holders, you may redistribute and/or modify it under the terms
+    described in that licence.
+
+    If you wish to distribute code using the Rubber Band Library
+    under terms other than those of the GNU General Public License,
+    you must obtain a valid commercial licence before doing so.
+*/
+
+#ifndef _RUBBERBAND_SHARED_CACHE_H_
+#define _RUBBERBAND_SHARED_CACHE_H_
+
+#include <map>
+
+#include "system/Thread.h"
+
+namespace RubberBand {
+
+/**
+ * A process-wide, reference-counted cache of read-only objects such
+ * as windows and FFT tables, keyed by whatever determines their
+ * contents (size, type etc).  acquire() returns the object for a
+ * key, constructing it with the given factory function only if no
+ * matching object exists; release() gives it back.  The same object
+ * may be in use by any number of stretchers on any number of threads
+ * at once, so nothing acquired from here may be modified.
+ *
+ * An object whose last user has released it is not deleted
+ * straight away, so that a sequence of stretchers with the same
+ * sizes (as from a pool of workers, each handling one request at a
+ * time) does not rebuild it every time.  Up to MaxRetained such
+ * unused objects are kept per cache, and the least recently used
+ * is deleted when that limit is exceeded.
+ *
+ * Both functions take a lock and may allocate or free, so neither
+ * may be called from a realtime thread.  Retained objects are not
+ * freed on exit, as a static cache cannot safely be torn down while
+ * other static objects might still release into it.
+ */
+
+template <typename Key, typename T>
+class SharedCache
+{
+public:
+    typedef T *(*Factory)(const Key &);
+
+    enum { MaxRetained = 16 };
+
+    static const T *acquire(const Key &key, Factory factory) {
+        MutexLocker locker(&m_mutex);
+        if (!m_entries) m_entries = new EntryMap;
+        typename EntryMap::iterator i = m_entries->find(key);
+        if (i != m_entries->end()) {
+            if (i->second.refs++ == 0) --m_unused;
+            return i->second.object;
+        }
+        Entry e;
+        e.object = factory(key);
+        e.refs = 1;
+        e.lastUsed = 0;
+        (*m_entries)[key] = e;
+        return e.object;
+    }
+
+    static void release(const T *object) {
+        if (!object) return;
+        MutexLocker locker(&m_mutex);
+        if (!m_entries) return;
+        for (typename EntryMap::iterator i = m_entries->begin();
+             i != m_entries->end(); ++i) {
+            if (i->second.object != object) continue;
+            if (--i->second.refs == 0) {
+                i->second.lastUsed = ++m_clock;
+                if (++m_unused > MaxRetained) evictOne();
+            }
+            return;
+        }
+    }
+
+private:
+    struct Entry {
+        T *object;
+        int refs;
+        unsigned long lastUsed; // value of m_clock when refs reached 0
+    };
+    typedef std::map<Key, Entry> EntryMap;
+
+    static void evictOne() {
+        typename EntryMap::iterator oldest = m_entries->end();
+        for (typename EntryMap::iterator i = m_entries->begin();
+             i != m_entries->end(); ++i) {
+            if (i->second.refs > 0) continue;
+            if (oldest == m_entries->end() ||
+                i->second.lastUsed < oldest->second.lastUsed) {
+                oldest = i;
+            }
+        }
+        if (oldest == m_entries->end()) return;
+        delete oldest->second.object;
+        m_entries->erase(oldest);
+        --m_unused;
+    }
+
+    static Mutex m_mutex;
+    static EntryMap *m_entries; // guarded by m_mutex, created on first use
+    static int m_unused;
+    static unsigned long m_clock;
+};
+
+template <typename Key, typename T>
+Mutex SharedCache<Key, T>::m_mutex;
+
+template <typename Key, typename T>
+typename SharedCache<Key, T>::EntryMap *SharedCache<Key, T>::m_entries = 0;
+
+template <typename Key, typename T>
+int SharedCache<Key, T>::m_unused = 0;
+
+template <typename Key, typename T>
+unsigned long SharedCache<Key, T>::m_clock = 0;
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "FFT.h"
 #include "system/Thread.h"
 #include "base/Profiler.h"
+#include "base/SharedCache.h"
 #include "system/Allocators.h"
 #include "system/VectorOps.h"
 #include "system/VectorOpsComplex.h"
@@ -64,24 +65,6 @@ extern "C" {
 #include "kissfft/kiss_fftr.h"
 #endif
 
-#ifndef HAVE_IPP
-#ifndef HAVE_FFTW3
-#ifndef USE_KISSFFT
-#ifndef USE_BUILTIN_FFT
-#ifndef HAVE_VDSP
-#ifndef HAVE_MEDIALIB
-#ifndef HAVE_OPENMAX
-#ifndef HAVE_SFFT
-#error No FFT implementation selected!
-#endif
-#endif
-#endif
-#endif
-#endif
-#endif
-#endif
-#endif
-
 #include <cmath>
 #include <iostream>
 #include <map>
@@ -89,6 +72,10 @@ extern "C" {
 #include <cstdlib>
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
 #ifdef FFT_MEASUREMENT
 #ifndef _WIN32
 #include <unistd.h>
@@ -1957,8 +1944,13 @@ public:
         fft_double_type *const R__ dbuf = m_dbuf;
         fftw_complex *const R__ dpacked = m_dpacked;
         const int hs = m_size/2;
+        // log into the output buffer first, which the plan overwrites
         for (int i = 0; i <= hs; ++i) {
-            dpacked[i][0] = log(magIn[i] + 0.000001);
+            dbuf[i] = magIn[i] + 0.000001;
+        }
+        v_fast_log(dbuf, hs + 1);
+        for (int i = 0; i <= hs; ++i) {
+            dpacked[i][0] = dbuf[i];
         }
         for (int i = 0; i <= hs; ++i) {
             dpacked[i][1] = 0.0;
@@ -2026,15 +2018,19 @@ public:
         if (!m_fplanf) initFloat();
         const int hs = m_size/2;
         fftwf_complex *const R__ fpacked = m_fpacked;
+        fft_float_type *const R__ fbuf = m_fbuf;
+        for (int i = 0; i <= hs; ++i) {
+            fbuf[i] = magIn[i] + 0.000001f;
+        }
+        v_fast_log(fbuf, hs + 1);
         for (int i = 0; i <= hs; ++i) {
-            fpacked[i][0] = logf(magIn[i] + 0.000001f);
+            fpacked[i][0] = fbuf[i];
         }
         for (int i = 0; i <= hs; ++i) {
             fpacked[i][1] = 0.f;
         }
         fftwf_execute(m_fplani);
         const int sz = m_size;
-        fft_float_type *const R__ fbuf = m_fbuf;
 #ifndef FFTW_DOUBLE_ONLY
         if (cepOut != fbuf)
 #endif
@@ -2653,7 +2649,12 @@ public:
         const int hs = m_size/2;
 
         for (int i = 0; i <= hs; ++i) {
-            m_fpacked[i].r = float(log(magIn[i] + 0.000001));
+            m_fbuf[i] = float(magIn[i] + 0.000001);
+        }
+        v_fast_log(m_fbuf, hs + 1);
+
+        for (int i = 0; i <= hs; ++i) {
+            m_fpacked[i].r = m_fbuf[i];
             m_fpacked[i].i = 0.0f;
         }
 
@@ -2693,7 +2694,12 @@ public:
         const int hs = m_size/2;
 
         for (int i = 0; i <= hs; ++i) {
-            m_fpacked[i].r = logf(magIn[i] + 0.000001f);
+            m_fbuf[i] = magIn[i] + 0.000001f;
+        }
+        v_fast_log(m_fbuf, hs + 1);
+
+        for (int i = 0; i <= hs; ++i) {
+            m_fpacked[i].r = m_fbuf[i];
             m_fpacked[i].i = 0.0f;
         }
 
@@ -2881,7 +2887,11 @@ public:
     void inverseCepstral(const double *R__ magIn, double *R__ cepOut) {
         const int hs = m_size/2;
         for (int i = 0; i <= hs; ++i) {
-            double real = log(magIn[i] + 0.000001);
+            m_c[i] = magIn[i] + 0.000001;
+        }
+        v_fast_log(m_c, hs + 1);
+        for (int i = 0; i <= hs; ++i) {
+            double real = m_c[i];
             m_a[i] = real;
             m_b[i] = 0.0;
             if (i > 0) {
@@ -2943,7 +2953,11 @@ public:
     void inverseCepstral(const float *R__ magIn, float *R__ cepOut) {
         const int hs = m_size/2;
         for (int i = 0; i <= hs; ++i) {
-            float real = logf(magIn[i] + 0.000001);
+            m_c[i] = magIn[i] + 0.000001;
+        }
+        v_fast_log(m_c, hs + 1);
+        for (int i = 0; i <= hs; ++i) {
+            double real = m_c[i];
             m_a[i] = real;
             m_b[i] = 0.0;
             if (i > 0) {
@@ -3057,10 +3071,450 @@ D_Cross::basefft(bool inverse, const double *R__ ri, const double *R__ ii, doubl
 
 #endif /* USE_BUILTIN_FFT */
 
+/*
+ * Built-in real FFT, always available.  A real transform of size n
+ * is calculated as a complex transform of size n/2, with the even
+ * input samples as real and the odd samples as imaginary parts,
+ * followed by a step that splits the result into the spectra of the
+ * two halves.  The complex transform is iterative radix-2
+ * decimation in time, with the first two stages merged into one
+ * radix-4 pass and the twiddle factors of each later stage in a
+ * contiguous table.  Real and imaginary parts are kept in separate
+ * arrays, so that the butterflies of the later stages are plain
+ * element-wise loops that the compiler can vectorise.
+ */
+
+// The tables for one size and type, shared between all plans of
+// that size through a SharedCache, and read-only once constructed
+template <typename T>
+struct D_RadixTables
+{
+    D_RadixTables(int size) :
+        half(size / 2)
+    {
+        const int h = half;
+
+        rev = allocate<int>(h);
+        twr = allocate<T>(h);
+        twi = allocate<T>(h);
+        splitr = allocate<T>(h + 1);
+        spliti = allocate<T>(h + 1);
+
+        int bits = 0;
+        while ((1 << bits) < h) ++bits;
+        for (int i = 0; i < h; ++i) {
+            int k = 0;
+            for (int j = 0; j < bits; ++j) {
+                if (i & (1 << j)) k |= (1 << (bits - 1 - j));
+            }
+            rev[i] = k;
+        }
+
+        // Twiddles for the stage with butterfly span s are at s
+        // .. 2s-1; the two stages with spans 1 and 2 don't need any
+        for (int s = 4; s < h; s <<= 1) {
+            for (int k = 0; k < s; ++k) {
+                double a = -M_PI * k / s;
+                twr[s + k] = T(cos(a));
+                twi[s + k] = T(sin(a));
+            }
+        }
+
+        for (int k = 0; k <= h; ++k) {
+            double a = -2.0 * M_PI * k / size;
+            splitr[k] = T(cos(a));
+            spliti[k] = T(sin(a));
+        }
+    }
+
+    ~D_RadixTables() {
+        deallocate(rev);
+        deallocate(twr);
+        deallocate(twi);
+        deallocate(splitr);
+        deallocate(spliti);
+    }
+
+    static D_RadixTables *create(const int &size) {
+        return new D_RadixTables(size);
+    }
+
+    const int half;
+    int *rev;
+    T *twr;
+    T *twi;
+    T *splitr;
+    T *spliti;
+};
+
+template <typename T>
+class D_RadixPlan
+{
+public:
+    D_RadixPlan(int size) :
+        m_tables(SharedCache<int, D_RadixTables<T> >::acquire
+                 (size, D_RadixTables<T>::create)),
+        m_half(size / 2),
+        m_rev(m_tables->rev),
+        m_twr(m_tables->twr),
+        m_twi(m_tables->twi),
+        m_splitr(m_tables->splitr),
+        m_spliti(m_tables->spliti)
+    {
+        m_re = allocate<T>(m_half + 1);
+        m_im = allocate<T>(m_half + 1);
+    }
+
+    ~D_RadixPlan() {
+        deallocate(m_re);
+        deallocate(m_im);
+        SharedCache<int, D_RadixTables<T> >::release(m_tables);
+    }
+
+    // Spectrum bins 0 .. size/2 of the latest forward transform, or
+    // the input of the next inverse one
+    T *re() { return m_re; }
+    T *im() { return m_im; }
+    int bins() const { return m_half + 1; }
+
+    void forward(const T *R__ realIn) {
+        const int h = m_half;
+        for (int i = 0; i < h; ++i) {
+            m_re[m_rev[i]] = realIn[i*2];
+            m_im[m_rev[i]] = realIn[i*2+1];
+        }
+        transform();
+        splitForward();
+    }
+
+    void inverse(T *R__ realOut) {
+        const int h = m_half;
+        splitInverse();
+        // Inverse transform as the conjugate of the forward
+        // transform of the conjugate
+        for (int i = 0; i < h; ++i) {
+            m_im[i] = -m_im[i];
+        }
+        reorder();
+        transform();
+        for (int i = 0; i < h; ++i) {
+            realOut[i*2] = m_re[i];
+            realOut[i*2+1] = -m_im[i];
+        }
+    }
+
+private:
+    const D_RadixTables<T> *const m_tables;
+    const int m_half;
+    const int *const m_rev;
+    const T *const m_twr;
+    const T *const m_twi;
+    const T *const m_splitr;
+    const T *const m_spliti;
+    T *m_re;
+    T *m_im;
+
+    void reorder() {
+        for (int i = 0; i < m_half; ++i) {
+            int j = m_rev[i];
+            if (i < j) {
+                T t = m_re[i]; m_re[i] = m_re[j]; m_re[j] = t;
+                t = m_im[i]; m_im[i] = m_im[j]; m_im[j] = t;
+            }
+        }
+    }
+
+    void transform() {
+
+        T *const R__ re = m_re;
+        T *const R__ im = m_im;
+        const int h = m_half;
+        int s;
+
+        if (h >= 4) {
+            for (int i = 0; i < h; i += 4) {
+                T r0 = re[i] + re[i+1], i0 = im[i] + im[i+1];
+                T r1 = re[i] - re[i+1], i1 = im[i] - im[i+1];
+                T r2 = re[i+2] + re[i+3], i2 = im[i+2] + im[i+3];
+                T r3 = re[i+2] - re[i+3], i3 = im[i+2] - im[i+3];
+                re[i] = r0 + r2;   im[i] = i0 + i2;
+                re[i+2] = r0 - r2; im[i+2] = i0 - i2;
+                // second butterfly of the radix-4 pass has twiddle -i
+                re[i+1] = r1 + i3; im[i+1] = i1 - r3;
+                re[i+3] = r1 - i3; im[i+3] = i1 + r3;
+            }
+            s = 4;
+        } else if (h == 2) {
+            T r0 = re[0] + re[1], i0 = im[0] + im[1];
+            re[1] = re[0] - re[1]; im[1] = im[0] - im[1];
+            re[0] = r0; im[0] = i0;
+            s = 2;
+        } else {
+            s = 1;
+        }
+
+        for (; s < h; s <<= 1) {
+            const T *const R__ wr = m_twr + s;
+            const T *const R__ wi = m_twi + s;
+            for (int i = 0; i < h; i += s*2) {
+                T *const R__ ar = re + i;
+                T *const R__ ai = im + i;
+                T *const R__ br = re + i + s;
+                T *const R__ bi = im + i + s;
+                for (int k = 0; k < s; ++k) {
+                    T tr = br[k] * wr[k] - bi[k] * wi[k];
+                    T ti = br[k] * wi[k] + bi[k] * wr[k];
+                    br[k] = ar[k] - tr;
+                    bi[k] = ai[k] - ti;
+                    ar[k] += tr;
+                    ai[k] += ti;
+                }
+            }
+        }
+    }
+
+    // From the transform z of even + i * odd samples, X[k] = E[k] +
+    // w^k O[k] where E[k] = (z[k] + z*[h-k]) / 2 and O[k] = (z[k] -
+    // z*[h-k]) / 2i.  Bins k and h-k are calculated together, since
+    // X[h-k] = (E[k] - w^k O[k])*.
+    void splitForward() {
+
+        T *const R__ re = m_re;
+        T *const R__ im = m_im;
+        const int h = m_half;
+
+        T r0 = re[0], i0 = im[0];
+        re[0] = r0 + i0; im[0] = T(0);
+        re[h] = r0 - i0; im[h] = T(0);
+
+        for (int k = 1; k*2 <= h; ++k) {
+            T zr = re[k], zi = im[k];
+            T cr = re[h-k], ci = im[h-k];
+            T er = (zr + cr) * T(0.5), ei = (zi - ci) * T(0.5);
+            T or_ = (zi + ci) * T(0.5), oi = (cr - zr) * T(0.5);
+            T tr = or_ * m_splitr[k] - oi * m_spliti[k];
+            T ti = or_ * m_spliti[k] + oi * m_splitr[k];
+            re[k] = er + tr;   im[k] = ei + ti;
+            re[h-k] = er - tr; im[h-k] = ti - ei;
+        }
+    }
+
+    // Inverse of splitForward, but without the halving, so that the
+    // unscaled inverse transform gives n times the input as usual:
+    // z[k] = E[k] + i O[k] where E[k] = X[k] + X*[h-k] and O[k] =
+    // (X[k] - X*[h-k]) / w^k, and z[h-k] = E*[k] + i O*[k].
+    void splitInverse() {
+
+        T *const R__ re = m_re;
+        T *const R__ im = m_im;
+        const int h = m_half;
+
+        T r0 = re[0], rh = re[h];
+        re[0] = r0 + rh;
+        im[0] = r0 - rh;
+
+        for (int k = 1; k*2 <= h; ++k) {
+            T xr = re[k], xi = im[k];
+            T cr = re[h-k], ci = im[h-k];
+            T er = xr + cr, ei = xi - ci;
+            T dr = xr - cr, di = xi + ci;
+            T or_ = dr * m_splitr[k] + di * m_spliti[k];
+            T oi = di * m_splitr[k] - dr * m_spliti[k];
+            re[k] = er - oi;   im[k] = ei + or_;
+            re[h-k] = er + oi; im[h-k] = or_ - ei;
+        }
+    }
+};
+
+class D_Radix : public FFTImpl
+{
+public:
+    D_Radix(int size) : m_size(size), m_dplan(0), m_fplan(0) { }
+
+    ~D_Radix() {
+        delete m_dplan;
+        delete m_fplan;
+    }
+
+    FFT::Precisions
+    getSupportedPrecisions() const {
+        return FFT::SinglePrecision | FFT::DoublePrecision;
+    }
+
+    void initFloat() {
+        if (!m_fplan) m_fplan = new D_RadixPlan<float>(m_size);
+    }
+
+    void initDouble() {
+        if (!m_dplan) m_dplan = new D_RadixPlan<double>(m_size);
+    }
+
+    void forward(const double *R__ realIn, double *R__ realOut, double *R__ imagOut) {
+        initDouble();
+        m_dplan->forward(realIn);
+        v_copy(realOut, m_dplan->re(), m_dplan->bins());
+        v_copy(imagOut, m_dplan->im(), m_dplan->bins());
+    }
+
+    void forwardInterleaved(const double *R__ realIn, double *R__ complexOut) {
+        initDouble();
+        m_dplan->forward(realIn);
+        interleave(complexOut, m_dplan);
+    }
+
+    void forwardPolar(const double *R__ realIn, double *R__ magOut, double *R__ phaseOut) {
+        initDouble();
+        m_dplan->forward(realIn);
+        v_cartesian_to_polar(magOut, phaseOut, m_dplan->re(), m_dplan->im(),
+                             m_dplan->bins());
+    }
+
+    void forwardMagnitude(const double *R__ realIn, double *R__ magOut) {
+        initDouble();
+        m_dplan->forward(realIn);
+        magnitude(magOut, m_dplan);
+    }
+
+    void forward(const float *R__ realIn, float *R__ realOut, float *R__ imagOut) {
+        initFloat();
+        m_fplan->forward(realIn);
+        v_copy(realOut, m_fplan->re(), m_fplan->bins());
+        v_copy(imagOut, m_fplan->im(), m_fplan->bins());
+    }
+
+    void forwardInterleaved(const float *R__ realIn, float *R__ complexOut) {
+        initFloat();
+        m_fplan->forward(realIn);
+        interleave(complexOut, m_fplan);
+    }
+
+    void forwardPolar(const float *R__ realIn, float *R__ magOut, float *R__ phaseOut) {
+        initFloat();
+        m_fplan->forward(realIn);
+        v_cartesian_to_polar(magOut, phaseOut, m_fplan->re(), m_fplan->im(),
+                             m_fplan->bins());
+    }
+
+    void forwardMagnitude(const float *R__ realIn, float *R__ magOut) {
+        initFloat();
+        m_fplan->forward(realIn);
+        magnitude(magOut, m_fplan);
+    }
+
+    void inverse(const double *R__ realIn, const double *R__ imagIn, double *R__ realOut) {
+        initDouble();
+        v_copy(m_dplan->re(), realIn, m_dplan->bins());
+        v_copy(m_dplan->im(), imagIn, m_dplan->bins());
+        m_dplan->inverse(realOut);
+    }
+
+    void inverseInterleaved(const double *R__ complexIn, double *R__ realOut) {
+        initDouble();
+        deinterleave(m_dplan, complexIn);
+        m_dplan->inverse(realOut);
+    }
+
+    void inversePolar(const double *R__ magIn, const double *R__ phaseIn, double *R__ realOut) {
+        initDouble();
+        v_polar_to_cartesian(m_dplan->re(), m_dplan->im(), magIn, phaseIn,
+                             m_dplan->bins());
+        m_dplan->inverse(realOut);
+    }
+
+    void inverseCepstral(const double *R__ magIn, double *R__ cepOut) {
+        initDouble();
+        logMagnitude(m_dplan, magIn);
+        m_dplan->inverse(cepOut);
+    }
+
+    void inverse(const float *R__ realIn, const float *R__ imagIn, float *R__ realOut) {
+        initFloat();
+        v_copy(m_fplan->re(), realIn, m_fplan->bins());
+        v_copy(m_fplan->im(), imagIn, m_fplan->bins());
+        m_fplan->inverse(realOut);
+    }
+
+    void inverseInterleaved(const float *R__ complexIn, float *R__ realOut) {
+        initFloat();
+        deinterleave(m_fplan, complexIn);
+        m_fplan->inverse(realOut);
+    }
+
+    void inversePolar(const float *R__ magIn, const float *R__ phaseIn, float *R__ realOut) {
+        initFloat();
+        v_polar_to_cartesian(m_fplan->re(), m_fplan->im(), magIn, phaseIn,
+                             m_fplan->bins());
+        m_fplan->inverse(realOut);
+    }
+
+    void inverseCepstral(const float *R__ magIn, float *R__ cepOut) {
+        initFloat();
+        logMagnitude(m_fplan, magIn);
+        m_fplan->inverse(cepOut);
+    }
+
+private:
+    const int m_size;
+    D_RadixPlan<double> *m_dplan;
+    D_RadixPlan<float> *m_fplan;
+
+    template <typename T>
+    void interleave(T *R__ complexOut, D_RadixPlan<T> *plan) {
+        const T *const R__ re = plan->re();
+        const T *const R__ im = plan->im();
+        const int n = plan->bins();
+        for (int i = 0; i < n; ++i) {
+            complexOut[i*2] = re[i];
+            complexOut[i*2+1] = im[i];
+        }
+    }
+
+    template <typename T>
+    void deinterleave(D_RadixPlan<T> *plan, const T *R__ complexIn) {
+        T *const R__ re = plan->re();
+        T *const R__ im = plan->im();
+        const int n = plan->bins();
+        for (int i = 0; i < n; ++i) {
+            re[i] = complexIn[i*2];
+            im[i] = complexIn[i*2+1];
+        }
+    }
+
+    template <typename T>
+    void magnitude(T *R__ magOut, D_RadixPlan<T> *plan) {
+        const T *const R__ re = plan->re();
+        const T *const R__ im = plan->im();
+        const int n = plan->bins();
+        for (int i = 0; i < n; ++i) {
+            magOut[i] = sqrt(re[i] * re[i] + im[i] * im[i]);
+        }
+    }
+
+    template <typename T>
+    void logMagnitude(D_RadixPlan<T> *plan, const T *R__ magIn) {
+        T *const R__ re = plan->re();
+        T *const R__ im = plan->im();
+        const int n = plan->bins();
+        for (int i = 0; i < n; ++i) {
+            re[i] = magIn[i] + T(0.000001);
+            im[i] = T(0);
+        }
+        v_fast_log(re, n);
+    }
+};
+
 } /* end namespace FFTs */
 
 std::string
-FFT::m_implementation;
+FFT::m_implementation
+#ifdef FFT_AUTO_SELECT
+= "auto"
+#endif
+;
+
+// Guards m_implementation, which stretchers being constructed on
+// several threads at once may all try to set
+static Mutex implementationMutex;
 
 std::set<std::string>
 FFT::getImplementations()
@@ -3090,6 +3544,7 @@ FFT::getImplementations()
 #ifdef USE_BUILTIN_FFT
     impls.insert("cross");
 #endif
+    impls.insert("radix");
     return impls;
 }
 
@@ -3100,7 +3555,8 @@ FFT::pickDefaultImplementation()
 
     std::set<std::string> impls = getImplementations();
 
-    std::string best = "cross";
+    std::string best = "radix";
+    if (impls.find("cross") != impls.end()) best = "cross";
     if (impls.find("kissfft") != impls.end()) best = "kissfft";
     if (impls.find("medialib") != impls.end()) best = "medialib";
     if (impls.find("openmax") != impls.end()) best = "openmax";
@@ -3115,17 +3571,42 @@ FFT::pickDefaultImplementation()
 std::string
 FFT::getDefaultImplementation()
 {
+    MutexLocker locker(&implementationMutex);
     return m_implementation;
 }
 
 void
 FFT::setDefaultImplementation(std::string i)
 {
+    MutexLocker locker(&implementationMutex);
     m_implementation = i;
 }
 
+std::string
+FFT::defaultImplementation()
+{
+    MutexLocker locker(&implementationMutex);
+    if (m_implementation == "") pickDefaultImplementation();
+    return m_implementation;
+}
+
 FFT::FFT(int size, int debugLevel) :
     d(0)
+{
+    init(size, defaultImplementation(), debugLevel);
+}
+
+FFT::FFT(int size, std::string implementation, int debugLevel) :
+    d(0)
+{
+    if (implementation == "") {
+        implementation = defaultImplementation();
+    }
+    init(size, implementation, debugLevel);
+}
+
+void
+FFT::init(int size, std::string impl, int debugLevel)
 {
     if ((size < 2) ||
         (size & (size-1))) {
@@ -3137,14 +3618,35 @@ FFT::FFT(int size, int debugLevel) :
 #endif
     }
 
-    if (m_implementation == "") pickDefaultImplementation();
-    std::string impl = m_implementation;
+    if (impl == "auto") {
+        impl = getFastestImplementation(size);
+    }
 
     if (debugLevel > 0) {
         std::cerr << "FFT::FFT(" << size << "): using implementation: "
                   << impl << std::endl;
     }
 
+    d = makeImpl(size, impl);
+
+    if (!d) {
+        std::cerr << "FFT::FFT(" << size << "): ERROR: implementation "
+                  << impl << " is not compiled in" << std::endl;
+#ifndef NO_EXCEPTIONS
+        throw InvalidImplementation;
+#else
+        abort();
+#endif
+    }
+
+    m_chosen = impl;
+}
+
+FFTImpl *
+FFT::makeImpl(int size, std::string impl)
+{
+    FFTImpl *d = 0;
+
     if (impl == "ipp") {
 #ifdef HAVE_IPP
         d = new FFTs::D_IPP(size);
@@ -3177,17 +3679,111 @@ FFT::FFT(int size, int debugLevel) :
 #ifdef USE_BUILTIN_FFT
         d = new FFTs::D_Cross(size);
 #endif
+    } else if (impl == "radix") {
+        d = new FFTs::D_Radix(size);
     }
 
-    if (!d) {
-        std::cerr << "FFT::FFT(" << size << "): ERROR: implementation "
-                  << impl << " is not compiled in" << std::endl;
-#ifndef NO_EXCEPTIONS
-        throw InvalidImplementation;
-#else
-        abort();
-#endif
+    return d;
+}
+
+std::string
+FFT::getImplementation() const
+{
+    return m_chosen;
+}
+
+static double
+secondsNow()
+{
+    struct timeval tv;
+    (void)gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static double
+timeImpl(FFTImpl *d, int size)
+{
+    // Round trips per second through the polar functions, which are
+    // what the stretcher mostly uses, at both precisions
+
+    double *dd = allocate_and_zero<double>(size);
+    double *dm = allocate_and_zero<double>(size/2 + 1);
+    double *dp = allocate_and_zero<double>(size/2 + 1);
+    float *fd = allocate_and_zero<float>(size);
+    float *fm = allocate_and_zero<float>(size/2 + 1);
+    float *fp = allocate_and_zero<float>(size/2 + 1);
+
+    for (int i = 0; i < size; ++i) {
+        dd[i] = fd[i] = float(sin(i * 0.1) + cos(i * 0.37));
     }
+
+    d->initDouble();
+    d->initFloat();
+
+    // one round first to get everything into cache
+    d->forwardPolar(dd, dm, dp);
+    d->inversePolar(dm, dp, dd);
+    v_scale(dd, 1.0 / size, size);
+
+    const int batch = 8;
+    const double minTime = 0.002;
+    int rounds = 0;
+    double start = secondsNow(), elapsed = 0.0;
+
+    while (elapsed < minTime) {
+        for (int i = 0; i < batch; ++i) {
+            d->forwardPolar(dd, dm, dp);
+            d->inversePolar(dm, dp, dd);
+            v_scale(dd, 1.0 / size, size);
+            d->forwardPolar(fd, fm, fp);
+            d->inversePolar(fm, fp, fd);
+            v_scale(fd, 1.f / size, size);
+        }
+        rounds += batch;
+        elapsed = secondsNow() - start;
+    }
+
+    deallocate(dd);
+    deallocate(dm);
+    deallocate(dp);
+    deallocate(fd);
+    deallocate(fm);
+    deallocate(fp);
+
+    return rounds / elapsed;
+}
+
+typedef std::map<int, std::string> FastestMap;
+static FastestMap fastest;
+static Mutex fastestMutex;
+
+std::string
+FFT::getFastestImplementation(int size)
+{
+    MutexLocker locker(&fastestMutex);
+
+    FastestMap::const_iterator fi = fastest.find(size);
+    if (fi != fastest.end()) return fi->second;
+
+    std::string best = defaultImplementation();
+    if (best == "auto") best = "radix";
+    double bestRate = 0.0;
+
+    std::set<std::string> impls = getImplementations();
+    for (std::set<std::string>::const_iterator i = impls.begin();
+         i != impls.end(); ++i) {
+        FFTImpl *d = makeImpl(size, *i);
+        if (!d) continue;
+        double rate = timeImpl(d, size);
+        delete d;
+        if (rate > bestRate) {
+            best = *i;
+            bestRate = rate;
+        }
+    }
+
+    fastest[size] = best;
+    return best;
 }
 
 FFT::~FFT()
@@ -3455,6 +4051,12 @@ FFT::tune()
         candidates[d] = 6;
 #endif
 
+        os << "Constructing new Radix FFT object for size " << size << "..." << std::endl;
+        d = new FFTs::D_Radix(size);
+        d->initFloat();
+        d->initDouble();
+        candidates[d] = 7;
+
         os << "CLOCKS_PER_SEC = " << CLOCKS_PER_SEC << std::endl;
         float divisor = float(CLOCKS_PER_SEC) / 1000.f;
         
@@ -62,6 +62,16 @@ public:
     };
 
     FFT(int size, int debugLevel = 0); // may throw InvalidSize
+
+    /**
+     * Construct an FFT using the given implementation, which must be
+     * one of those returned by getImplementations() or "auto" to use
+     * the one that getFastestImplementation() picks for this size.
+     * An empty string means the default implementation.  May throw
+     * InvalidSize or InvalidImplementation.
+     */
+    FFT(int size, std::string implementation, int debugLevel = 0);
+
     ~FFT();
 
     void forward(const double *R__ realIn, double *R__ realOut, double *R__ imagOut);
@@ -109,18 +119,43 @@ public:
      */
     Precisions getSupportedPrecisions() const;
 
+    /**
+     * Return the name of the implementation this FFT is using.
+     */
+    std::string getImplementation() const;
+
     static std::set<std::string> getImplementations();
     static std::string getDefaultImplementation();
+
+    /**
+     * Set the implementation used by FFTs constructed without one
+     * from now on.  "auto" picks the fastest for each size, as with
+     * getFastestImplementation().  The default is "auto" when built
+     * with FFT_AUTO_SELECT, otherwise the best available library
+     * from a fixed order of preference.
+     */
     static void setDefaultImplementation(std::string);
 
+    /**
+     * Time each of the compiled-in implementations at the given size
+     * and return the name of the fastest.  This takes a couple of
+     * milliseconds per implementation the first time it is called
+     * for a size; the result is remembered after that.  Thread safe.
+     */
+    static std::string getFastestImplementation(int size);
+
 #ifdef FFT_MEASUREMENT
     static std::string tune();
 #endif
 
 protected:
     FFTImpl *d;
+    std::string m_chosen;
+    void init(int size, std::string implementation, int debugLevel);
+    static FFTImpl *makeImpl(int size, std::string implementation);
     static std::string m_implementation;
     static void pickDefaultImplementation();
+    static std::string defaultImplementation();
 };
 
 }
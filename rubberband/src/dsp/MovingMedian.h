@@ -35,6 +35,17 @@
 namespace RubberBand
 {
 
+/**
+ * Running percentile (by default the median) of the most recent
+ * "size" values pushed, zero-initialised.
+ *
+ * The values are kept in two heaps: a max-heap of the lowest values,
+ * up to and including the one at the percentile, and a min-heap of
+ * the rest. Each push replaces the oldest value in whichever heap it
+ * is in, and at most one exchange between the heap tops is then
+ * needed to restore the ordering, so push() is O(log size) and get()
+ * is O(1).
+ */
 template <typename T>
 class MovingMedian : public SampleFilter<T>
 {
@@ -43,21 +54,24 @@ class MovingMedian : public SampleFilter<T>
 public:
     MovingMedian(int size, float percentile = 50.f) :
         SampleFilter<T>(size),
-	m_frame(allocate_and_zero<T>(size)),
-	m_sorted(allocate_and_zero<T>(size)),
-	m_sortend(m_sorted + P::m_size - 1) {
+	m_value(allocate_and_zero<T>(size)),
+	m_heap(allocate_and_zero<int>(size)),
+	m_where(allocate_and_zero<int>(size)),
+        m_oldest(0) {
         setPercentile(percentile);
     }
 
     ~MovingMedian() { 
-	deallocate(m_frame);
-	deallocate(m_sorted);
+	deallocate(m_value);
+	deallocate(m_heap);
+	deallocate(m_where);
     }
 
     void setPercentile(float p) {
         m_index = int((P::m_size * p) / 100.f);
         if (m_index >= P::m_size) m_index = P::m_size-1;
         if (m_index < 0) m_index = 0;
+        rebuild();
     }
 
     void push(T value) {
@@ -65,42 +79,112 @@ public:
             std::cerr << "WARNING: MovingMedian: NaN encountered" << std::endl;
             value = T();
         }
-	drop(m_frame[0]);
-	v_move(m_frame, m_frame+1, P::m_size-1);
-	m_frame[P::m_size-1] = value;
-	put(value);
+        int slot = m_oldest;
+        if (++m_oldest == P::m_size) m_oldest = 0;
+        m_value[slot] = value;
+        int i = m_where[slot];
+        if (i < m_lowSize) {
+            siftLow(i);
+        } else {
+            siftHigh(i);
+        }
+        if (m_lowSize < P::m_size &&
+            m_value[m_heap[0]] > m_value[m_heap[m_lowSize]]) {
+            std::swap(m_heap[0], m_heap[m_lowSize]);
+            m_where[m_heap[0]] = 0;
+            m_where[m_heap[m_lowSize]] = m_lowSize;
+            siftLowDown(0);
+            siftHighDown(m_lowSize);
+        }
     }
 
     T get() const {
-	return m_sorted[m_index];
+	return m_value[m_heap[0]];
     }
 
     void reset() {
-	v_zero(m_frame, P::m_size);
-	v_zero(m_sorted, P::m_size);
+	v_zero(m_value, P::m_size);
+        m_oldest = 0;
+        rebuild();
     }
 
 private:
-    T *const m_frame;
-    T *const m_sorted;
-    T *const m_sortend;
+    T *const m_value; // by slot, in order of arrival
+    int *const m_heap; // slots: max-heap at [0, m_lowSize), min-heap after
+    int *const m_where; // index in m_heap of each slot
+    int m_oldest; // slot
     int m_index;
+    int m_lowSize;
+
+    // The heaps are laid out in the usual way, the children of i
+    // being at 2i+1 and 2i+2, with the min-heap's indices relative to
+    // m_lowSize
+
+    void rebuild() {
+        // Sort all the slots by value and split them at the percentile
+        m_lowSize = m_index + 1;
+        for (int i = 0; i < P::m_size; ++i) m_heap[i] = i;
+        std::sort(m_heap, m_heap + P::m_size, ByValue(m_value));
+        std::reverse(m_heap, m_heap + m_lowSize);
+        for (int i = 0; i < P::m_size; ++i) m_where[m_heap[i]] = i;
+    }
+
+    struct ByValue {
+        ByValue(const T *v) : m_v(v) { }
+        bool operator()(int a, int b) const { return m_v[a] < m_v[b]; }
+        const T *m_v;
+    };
+
+    void exchange(int i, int j) {
+        std::swap(m_heap[i], m_heap[j]);
+        m_where[m_heap[i]] = i;
+        m_where[m_heap[j]] = j;
+    }
+
+    void siftLow(int i) {
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!(m_value[m_heap[i]] > m_value[m_heap[parent]])) break;
+            exchange(i, parent);
+            i = parent;
+        }
+        siftLowDown(i);
+    }
 
-    void put(T value) {
-	// precondition: m_sorted contains m_size-1 values, packed at start
-	// postcondition: m_sorted contains m_size values, one of which is value
-	T *index = std::lower_bound(m_sorted, m_sortend, value);
-	v_move(index + 1, index, m_sortend - index);
-	*index = value;
+    void siftLowDown(int i) {
+        while (true) {
+            int c = 2 * i + 1;
+            if (c >= m_lowSize) break;
+            if (c + 1 < m_lowSize &&
+                m_value[m_heap[c + 1]] > m_value[m_heap[c]]) ++c;
+            if (!(m_value[m_heap[c]] > m_value[m_heap[i]])) break;
+            exchange(i, c);
+            i = c;
+        }
     }
 
-    void drop(T value) {
-	// precondition: m_sorted contains m_size values, one of which is value
-	// postcondition: m_sorted contains m_size-1 values, packed at start
-	T *index = std::lower_bound(m_sorted, m_sortend + 1, value);
-	assert(*index == value);
-	v_move(index, index + 1, m_sortend - index);
-	*m_sortend = T(0);
+    void siftHigh(int i) {
+        const int base = m_lowSize;
+        while (i > base) {
+            int parent = base + (i - base - 1) / 2;
+            if (!(m_value[m_heap[i]] < m_value[m_heap[parent]])) break;
+            exchange(i, parent);
+            i = parent;
+        }
+        siftHighDown(i);
+    }
+
+    void siftHighDown(int i) {
+        const int base = m_lowSize;
+        while (true) {
+            int c = base + 2 * (i - base) + 1;
+            if (c >= P::m_size) break;
+            if (c + 1 < P::m_size &&
+                m_value[m_heap[c + 1]] < m_value[m_heap[c]]) ++c;
+            if (!(m_value[m_heap[c]] < m_value[m_heap[i]])) break;
+            exchange(i, c);
+            i = c;
+        }
     }
 };
 
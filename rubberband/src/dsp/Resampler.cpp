@@ -31,6 +31,7 @@
 #include <algorithm>
 
 #include "system/Allocators.h"
+#include "system/VectorOps.h"
 
 #ifdef HAVE_IPP
 #include <ipps.h>
@@ -50,14 +51,8 @@
 #include "speex/speex_resampler.h"
 #endif
 
-#ifndef HAVE_IPP
-#ifndef HAVE_LIBSAMPLERATE
-#ifndef HAVE_LIBRESAMPLE
-#ifndef USE_SPEEX
-#error No resampler implementation selected!
-#endif
-#endif
-#endif
+#if defined __SSE__ || defined _M_X64
+#include <xmmintrin.h>
 #endif
 
 namespace RubberBand {
@@ -82,6 +77,8 @@ public:
     virtual int getChannelCount() const = 0;
 
     virtual void reset() = 0;
+
+    virtual void reserve(float) { }
 };
 
 namespace Resamplers {
@@ -831,6 +828,8 @@ public:
 
     void reset();
 
+    void reserve(float minRatio);
+
 protected:
     SpeexResamplerState *m_resampler;
     float *m_iin;
@@ -1038,8 +1037,427 @@ D_Speex::reset()
     speex_resampler_reset_mem(m_resampler);
 }
 
+void
+D_Speex::reserve(float minRatio)
+{
+    // Only down-sampling lengthens the filter.  The fraction is as
+    // in setRatio, input rate over output rate
+    if (minRatio <= 0.f || minRatio >= 1.f) return;
+
+    unsigned int big = 272408136U; 
+    unsigned int num = (unsigned int)(double(big) * double(minRatio));
+
+    speex_resampler_reserve_frac(m_resampler, big, num);
+}
+
 #endif
 
+/**
+ * Built-in polyphase resampler, a Kaiser-windowed sinc interpolator
+ * with the ratio continuously variable.
+ *
+ * The filter is stored for a fixed number of fractional phases, and
+ * coefficients between phases are linearly interpolated (as in the
+ * sinc resampler used in resampler.h). Each channel is filtered
+ * separately from its own history buffer, without interleaving, and
+ * nothing is shared between instances so no locking is needed.
+ *
+ * Like the Speex resampler as used here, the first output sample is
+ * aligned with the first input sample, and output is held back until
+ * the filter has enough input after it. The final flag is ignored.
+ */
+class D_Polyphase : public ResamplerImpl
+{
+public:
+    D_Polyphase(Resampler::Quality quality, int channels, int maxBufferSize,
+                int debugLevel);
+    ~D_Polyphase();
+
+    int resample(const float *const R__ *const R__ in,
+                 float *const R__ *const R__ out,
+                 int incount,
+                 float ratio,
+                 bool final);
+
+    int resampleInterleaved(const float *const R__ in,
+                            float *const R__ out,
+                            int incount,
+                            float ratio,
+                            bool final = false);
+
+    int getChannelCount() const { return m_channels; }
+
+    void reset();
+
+    void reserve(float minRatio);
+
+protected:
+    enum { phases = 256 };
+
+    int m_channels;
+    int m_debugLevel;
+    int m_baseHalfLength; // of filter at ratios of 1 or more
+    double m_cutoff; // fraction of the lower of the two Nyquist rates
+    double m_beta; // of Kaiser window
+
+    float m_ratio;
+    float m_filterRatio; // that the filter is designed for, or 0 if none yet
+    int m_halfLength; // of current filter, a multiple of 2
+    float *m_filter; // (phases + 1) rows each of coefficients and deltas
+    int m_filterSize; // allocated
+
+    int m_maxHalfLength; // of any filter, and the history kept
+    float **m_buffers; // history, then input, per channel
+    int m_bufferSize; // allocated
+    int m_fill; // valid samples in each buffer
+    double m_time; // of next output, in samples from start of buffer
+    float *m_ibuf; // for resampleInterleaved
+    float *m_obuf;
+    int m_ibufSize;
+    int m_obufSize;
+    float **m_iptrs;
+    float **m_optrs;
+
+    void setRatio(float ratio);
+    void designFilter(float ratio, float *filter, int halfLength) const;
+    int halfLengthFor(float ratio) const;
+    void ensureBuffers(int incount, int halfLength);
+};
+
+D_Polyphase::D_Polyphase(Resampler::Quality quality, int channels,
+                         int maxBufferSize, int debugLevel) :
+    m_channels(channels),
+    m_debugLevel(debugLevel),
+    m_ratio(0.f),
+    m_filterRatio(0.f),
+    m_halfLength(0),
+    m_filter(0),
+    m_filterSize(0),
+    m_maxHalfLength(0),
+    m_buffers(0),
+    m_bufferSize(0),
+    m_fill(0),
+    m_time(0.0),
+    m_ibuf(0),
+    m_obuf(0),
+    m_ibufSize(0),
+    m_obufSize(0),
+    m_iptrs(0),
+    m_optrs(0)
+{
+    // Filter lengths, cutoffs and windows as for Speex qualities 10,
+    // 4 and 0, which D_Speex uses for these
+    switch (quality) {
+    case Resampler::Best:
+        m_baseHalfLength = 128; m_cutoff = 0.975; m_beta = 12.0;
+        break;
+    case Resampler::FastestTolerable:
+        m_baseHalfLength = 32; m_cutoff = 0.921; m_beta = 8.0;
+        break;
+    case Resampler::Fastest:
+        m_baseHalfLength = 4; m_cutoff = 0.83; m_beta = 6.0;
+        break;
+    }
+
+    if (m_debugLevel > 0) {
+        std::cerr << "Resampler::Resampler: using built-in implementation with filter length "
+                  << m_baseHalfLength * 2 << std::endl;
+    }
+
+    m_buffers = allocate<float *>(m_channels);
+    m_iptrs = allocate<float *>(m_channels);
+    m_optrs = allocate<float *>(m_channels);
+    for (int c = 0; c < m_channels; ++c) m_buffers[c] = 0;
+
+    setRatio(1.f);
+    ensureBuffers(maxBufferSize, m_halfLength);
+    reset();
+}
+
+D_Polyphase::~D_Polyphase()
+{
+    deallocate(m_filter);
+    for (int c = 0; c < m_channels; ++c) deallocate(m_buffers[c]);
+    deallocate(m_buffers);
+    deallocate(m_ibuf);
+    deallocate(m_obuf);
+    deallocate(m_iptrs);
+    deallocate(m_optrs);
+}
+
+int
+D_Polyphase::halfLengthFor(float ratio) const
+{
+    // Down-sampling lowers the cutoff, so the filter must be longer
+    // in proportion to keep the same stopband attenuation
+    int h = m_baseHalfLength;
+    if (ratio < 1.f) h = int(ceil(h / ratio));
+    return (h + 1) & ~1; // so that rows are a multiple of four
+}
+
+static double
+besselI0(double x)
+{
+    double sum = 1.0, term = 1.0, xx = x * x / 4.0;
+    for (int k = 1; k < 50; ++k) {
+        term *= xx / (double(k) * double(k));
+        sum += term;
+        if (term < sum * 1e-12) break;
+    }
+    return sum;
+}
+
+void
+D_Polyphase::designFilter(float ratio, float *filter, int halfLength) const
+{
+    // Row p holds the coefficients for an output sample p/phases of
+    // the way from input sample floor(t) to the next, applied to the
+    // 2*halfLength inputs from floor(t) - halfLength + 1; it is
+    // followed by the differences from row p+1
+    
+    const int taps = halfLength * 2;
+    const double cutoff = (ratio < 1.f ? m_cutoff * ratio : m_cutoff);
+    const double norm = besselI0(m_beta);
+
+    for (int p = 0; p <= phases; ++p) {
+        float *row = filter + p * taps * 2;
+        for (int j = 0; j < taps; ++j) {
+            double x = double(halfLength - 1 - j) + double(p) / phases;
+            double w = x / halfLength;
+            double v = 0.0;
+            if (w > -1.0 && w < 1.0) {
+                double sx = M_PI * x * cutoff;
+                double sinc = (fabs(sx) < 1e-9 ? 1.0 : sin(sx) / sx);
+                v = cutoff * sinc * besselI0(m_beta * sqrt(1.0 - w * w)) / norm;
+            }
+            row[j] = float(v);
+        }
+    }
+
+    for (int p = 0; p < phases; ++p) {
+        float *row = filter + p * taps * 2;
+        float *next = row + taps * 2;
+        for (int j = 0; j < taps; ++j) {
+            row[taps + j] = next[j] - row[j];
+        }
+    }
+    v_zero(filter + phases * taps * 2 + taps, taps);
+}
+
+void
+D_Polyphase::setRatio(float ratio)
+{
+    // Only down-sampling changes the filter, and small changes in
+    // ratio don't change it enough to be worth designing it again:
+    // we redesign if the cutoff would move by more than 1%
+    float fr = std::min(ratio, 1.f);
+    bool newFilter = (m_filterRatio == 0.f ||
+                      fabsf(fr - m_filterRatio) > m_filterRatio * 0.01f);
+    int h = m_halfLength;
+
+    if (newFilter) {
+        h = halfLengthFor(fr);
+        int size = (phases + 1) * h * 4;
+        if (size > m_filterSize) {
+            if (m_debugLevel > 0 && m_filterSize > 0) {
+                std::cerr << "D_Polyphase: WARNING: allocating new filter for ratio "
+                          << ratio << " (call reserve() to avoid this)"
+                          << std::endl;
+            }
+            deallocate(m_filter);
+            m_filter = allocate<float>(size);
+            m_filterSize = size;
+        }
+        designFilter(fr, m_filter, h);
+        if (m_debugLevel > 1) {
+            std::cerr << "D_Polyphase: ratio " << ratio << ", filter length "
+                      << h * 2 << std::endl;
+        }
+        m_filterRatio = fr;
+    }
+
+    if (h > m_maxHalfLength) {
+        ensureBuffers(0, h);
+    }
+
+    m_halfLength = h;
+    m_ratio = ratio;
+}
+
+void
+D_Polyphase::ensureBuffers(int incount, int halfLength)
+{
+    // Each buffer can hold the history for the longest filter plus
+    // incount new samples, and the lookahead of both
+    int history = std::max(m_maxHalfLength, halfLength);
+    int shift = history - m_maxHalfLength;
+    int size = std::max(m_bufferSize + shift, incount + history * 4);
+
+    if (size == m_bufferSize && shift == 0) return;
+
+    for (int c = 0; c < m_channels; ++c) {
+        float *b = allocate_and_zero<float>(size);
+        if (m_buffers[c]) {
+            // Longer history than before: pad it with zeros
+            v_copy(b + shift, m_buffers[c], m_fill);
+            deallocate(m_buffers[c]);
+        }
+        m_buffers[c] = b;
+    }
+
+    m_bufferSize = size;
+    m_maxHalfLength = history;
+    if (shift > 0) {
+        m_fill += shift;
+        m_time += shift;
+    }
+}
+
+static inline float
+polyphaseSample(const float *const R__ buf,
+                const float *const R__ row,
+                const float *const R__ delta,
+                const float frac, const int taps)
+{
+#if defined __SSE__ || defined _M_X64
+    __m128 f = _mm_set1_ps(frac);
+    __m128 sum = _mm_setzero_ps();
+    for (int j = 0; j < taps; j += 4) {
+        __m128 c = _mm_add_ps(_mm_loadu_ps(row + j),
+                              _mm_mul_ps(_mm_loadu_ps(delta + j), f));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(buf + j), c));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#else
+    float s0 = 0.f, s1 = 0.f, s2 = 0.f, s3 = 0.f;
+    for (int j = 0; j < taps; j += 4) {
+        s0 += buf[j]   * (row[j]   + delta[j]   * frac);
+        s1 += buf[j+1] * (row[j+1] + delta[j+1] * frac);
+        s2 += buf[j+2] * (row[j+2] + delta[j+2] * frac);
+        s3 += buf[j+3] * (row[j+3] + delta[j+3] * frac);
+    }
+    return (s0 + s1) + (s2 + s3);
+#endif
+}
+
+int
+D_Polyphase::resample(const float *const R__ *const R__ in,
+                      float *const R__ *const R__ out,
+                      int incount,
+                      float ratio,
+                      bool final)
+{
+    if (ratio != m_ratio) {
+        setRatio(ratio);
+    }
+    
+    if (m_fill + incount > m_bufferSize) {
+        ensureBuffers(m_fill + incount, m_halfLength);
+    }
+
+    for (int c = 0; c < m_channels; ++c) {
+        v_copy(m_buffers[c] + m_fill, in[c], incount);
+    }
+    m_fill += incount;
+
+    const int h = m_halfLength;
+    const int taps = h * 2;
+    const double step = 1.0 / ratio;
+    const int outspace = int(ceil(incount * ratio));
+    
+    int outcount = 0;
+    double t = m_time;
+
+    while (outcount < outspace) {
+        int i = int(t);
+        if (i + h >= m_fill) break; // not enough lookahead yet
+        double pos = (t - i) * phases;
+        int p = int(pos);
+        float frac = float(pos - p);
+        const float *row = m_filter + p * taps * 2;
+        for (int c = 0; c < m_channels; ++c) {
+            out[c][outcount] = polyphaseSample
+                (m_buffers[c] + i - h + 1, row, row + taps, frac, taps);
+        }
+        ++outcount;
+        t += step;
+    }
+
+    // Keep the longest history any filter may need, from the
+    // position of the next output sample
+    int keep = std::min(int(t), m_fill) - m_maxHalfLength + 1;
+    if (keep > 0) {
+        for (int c = 0; c < m_channels; ++c) {
+            v_move(m_buffers[c], m_buffers[c] + keep, m_fill - keep);
+        }
+        m_fill -= keep;
+        t -= keep;
+    }
+
+    m_time = t;
+    return outcount;
+}
+
+int
+D_Polyphase::resampleInterleaved(const float *const R__ in,
+                                 float *const R__ out,
+                                 int incount,
+                                 float ratio,
+                                 bool final)
+{
+    int outspace = int(ceil(incount * ratio));
+    if (incount * m_channels > m_ibufSize) {
+        m_ibuf = reallocate<float>(m_ibuf, m_ibufSize, incount * m_channels);
+        m_ibufSize = incount * m_channels;
+    }
+    if (outspace * m_channels > m_obufSize) {
+        m_obuf = reallocate<float>(m_obuf, m_obufSize, outspace * m_channels);
+        m_obufSize = outspace * m_channels;
+    }
+
+    for (int c = 0; c < m_channels; ++c) {
+        m_iptrs[c] = m_ibuf + c * incount;
+        m_optrs[c] = m_obuf + c * outspace;
+    }
+
+    v_deinterleave(m_iptrs, in, m_channels, incount);
+    int outcount = resample(m_iptrs, m_optrs, incount, ratio, final);
+    v_interleave(out, m_optrs, m_channels, outcount);
+    return outcount;
+}
+
+void
+D_Polyphase::reset()
+{
+    // The history starts as silence, and the first output sample
+    // is at the first input sample
+    for (int c = 0; c < m_channels; ++c) {
+        v_zero(m_buffers[c], m_bufferSize);
+    }
+    m_fill = m_maxHalfLength;
+    m_time = m_maxHalfLength;
+}
+
+void
+D_Polyphase::reserve(float minRatio)
+{
+    if (minRatio <= 0.f || minRatio >= 1.f) return;
+    int h = halfLengthFor(minRatio);
+    int size = (phases + 1) * h * 4;
+    if (size > m_filterSize) {
+        deallocate(m_filter);
+        m_filter = allocate<float>(size);
+        m_filterSize = size;
+        m_filterRatio = 0.f; // so that the filter is designed again
+        setRatio(m_ratio);
+    }
+    if (h > m_maxHalfLength) {
+        ensureBuffers(0, h);
+    }
+}
+
 } /* end namespace Resamplers */
 
 Resampler::Resampler(Resampler::Quality quality, int channels,
@@ -1095,11 +1513,13 @@ Resampler::Resampler(Resampler::Quality quality, int channels,
         break;
     }
 
+#ifdef USE_BUILTIN_RESAMPLER
+    m_method = 4;
+#endif
+
     if (m_method == -1) {
-        std::cerr << "Resampler::Resampler(" << quality << ", " << channels
-                  << ", " << maxBufferSize << "): No implementation available!"
-                  << std::endl;
-        abort();
+        // No library implementation, so use the built-in one
+        m_method = 4;
     }
 
     switch (m_method) {
@@ -1146,6 +1566,10 @@ Resampler::Resampler(Resampler::Quality quality, int channels,
         abort();
 #endif
         break;
+
+    case 4:
+        d = new Resamplers::D_Polyphase(quality, channels, maxBufferSize, debugLevel);
+        break;
     }
 
     if (!d) {
@@ -1192,4 +1616,10 @@ Resampler::reset()
     d->reset();
 }
 
+void
+Resampler::reserve(float minRatio)
+{
+    d->reserve(minRatio);
+}
+
 }
@@ -73,6 +73,14 @@ public:
 
     void reset();
 
+    /**
+     * Allocate whatever the resampler needs in order to resample at
+     * any ratio down to minRatio, so that later calls to resample()
+     * with a ratio between minRatio and 1 don't allocate because of
+     * the ratio change.  Not all implementations need this.
+     */
+    void reserve(float minRatio);
+
 protected:
     ResamplerImpl *d;
     int m_method;
@@ -28,10 +28,12 @@
 #include <iostream>
 #include <cstdlib>
 #include <map>
+#include <utility>
 
 #include "system/sysutils.h"
 #include "system/VectorOps.h"
 #include "system/Allocators.h"
+#include "base/SharedCache.h"
 
 namespace RubberBand {
 
@@ -94,6 +96,20 @@ public:
     inline int getSize() const { return m_size; }
     inline int getP() const { return m_p; }
 
+    /**
+     * Return a sinc window of size n with scale p from a cache shared
+     * across the process, constructing it only if there is not one
+     * already.  The window must be treated as read-only (so rewrite()
+     * may not be used on it), and given back with releaseShared()
+     * rather than deleted.  Not RT-safe.
+     */
+    static const SincWindow *getShared(int n, int p) {
+        return Cache::acquire(Key(n, p), create);
+    }
+    static void releaseShared(const SincWindow *w) {
+        Cache::release(w);
+    }
+
     /**
      * Write a sinc window of size n with scale p (the p value is
      * interpreted as for the argument of the same name to the
@@ -113,6 +129,12 @@ public:
     }
 
 protected:
+    typedef std::pair<int, int> Key; // n, p
+    typedef SharedCache<Key, SincWindow> Cache;
+    static SincWindow *create(const Key &k) {
+        return new SincWindow(k.first, k.second);
+    }
+
     int m_size;
     int m_p;
     T *R__ m_cache;
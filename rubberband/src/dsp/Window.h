@@ -27,10 +27,12 @@
 #include <cmath>
 #include <cstdlib>
 #include <map>
+#include <utility>
 
 #include "system/sysutils.h"
 #include "system/VectorOps.h"
 #include "system/Allocators.h"
+#include "base/SharedCache.h"
 
 namespace RubberBand {
 
@@ -79,6 +81,11 @@ public:
         v_multiply(dst, src, m_cache, m_size);
     }
 
+    inline void cut(const T *const R__ src, T *const R__ dst,
+                    int from, int count) const {
+        v_multiply(dst, src, m_cache + from, count);
+    }
+
     inline void add(T *const R__ dst, T scale) const {
         v_add_with_gain(dst, m_cache, scale, m_size);
     }
@@ -98,7 +105,26 @@ public:
     inline WindowType getType() const { return m_type; }
     inline int getSize() const { return m_size; }
 
+    /**
+     * Return a window of the given type and size from a cache shared
+     * across the process, constructing it only if there is not one
+     * already.  The window must be treated as read-only, and given
+     * back with releaseShared() rather than deleted.  Not RT-safe.
+     */
+    static const Window *getShared(WindowType type, int size) {
+        return Cache::acquire(Key(int(type), size), create);
+    }
+    static void releaseShared(const Window *w) {
+        Cache::release(w);
+    }
+
 protected:
+    typedef std::pair<int, int> Key; // type, size
+    typedef SharedCache<Key, Window> Cache;
+    static Window *create(const Key &k) {
+        return new Window(WindowType(k.first), k.second);
+    }
+
     WindowType m_type;
     int m_size;
     T *R__ m_cache;
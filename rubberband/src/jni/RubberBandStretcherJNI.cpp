@@ -191,6 +191,30 @@ JNIEXPORT jint JNICALL Java_com_breakfastquay_rubberband_RubberBandStretcher_ava
 JNIEXPORT jint JNICALL Java_com_breakfastquay_rubberband_RubberBandStretcher_retrieve
   (JNIEnv *, jobject, jobjectArray, jint, jint);
 
+/*
+ * Class:     com_breakfastquay_rubberband_RubberBandStretcher
+ * Method:    studyDirect
+ * Signature: ([Ljava/nio/FloatBuffer;IIZ)V
+ */
+JNIEXPORT void JNICALL Java_com_breakfastquay_rubberband_RubberBandStretcher_studyDirect
+  (JNIEnv *, jobject, jobjectArray, jint, jint, jboolean);
+
+/*
+ * Class:     com_breakfastquay_rubberband_RubberBandStretcher
+ * Method:    processDirect
+ * Signature: ([Ljava/nio/FloatBuffer;IIZ)V
+ */
+JNIEXPORT void JNICALL Java_com_breakfastquay_rubberband_RubberBandStretcher_processDirect
+  (JNIEnv *, jobject, jobjectArray, jint, jint, jboolean);
+
+/*
+ * Class:     com_breakfastquay_rubberband_RubberBandStretcher
+ * Method:    retrieveDirect
+ * Signature: ([Ljava/nio/FloatBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_breakfastquay_rubberband_RubberBandStretcher_retrieveDirect
+  (JNIEnv *, jobject, jobjectArray, jint, jint);
+
 /*
  * Class:     com_breakfastquay_rubberband_RubberBandStretcher
  * Method:    initialise
@@ -342,6 +366,9 @@ Java_com_breakfastquay_rubberband_RubberBandStretcher_study(JNIEnv *env, jobject
         jfloatArray cdata = (jfloatArray)env->GetObjectArrayElement(data, c);
         env->ReleaseFloatArrayElements(cdata, arr[c], 0);
     }
+
+    deallocate(input);
+    deallocate(arr);
 }
 
 JNIEXPORT void JNICALL
@@ -392,3 +419,72 @@ Java_com_breakfastquay_rubberband_RubberBandStretcher_retrieve(JNIEnv *env, jobj
     return retrieved;
 }
 
+// Fill ptrs with the addresses of floats offset .. offset+n-1 in each
+// of the direct FloatBuffers in data, or throw IllegalArgumentException
+// and return false if any buffer is not direct or is too short
+
+static bool
+getDirectChannels(JNIEnv *env, jobjectArray data, jint offset, jint n,
+                  size_t channels, float **ptrs)
+{
+    if (offset < 0 || n < 0 || size_t(env->GetArrayLength(data)) < channels) {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"),
+                      "Invalid offset or count, or too few channel buffers");
+        return false;
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        jobject buf = env->GetObjectArrayElement(data, c);
+        float *base = buf ? (float *)env->GetDirectBufferAddress(buf) : 0;
+        jlong capacity = buf ? env->GetDirectBufferCapacity(buf) : -1;
+        if (buf) env->DeleteLocalRef(buf);
+        if (!base || capacity < jlong(offset) + n) {
+            env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"),
+                          "Channel buffer is not a direct FloatBuffer or is too short");
+            return false;
+        }
+        ptrs[c] = base + offset;
+    }
+    return true;
+}
+
+JNIEXPORT void JNICALL
+Java_com_breakfastquay_rubberband_RubberBandStretcher_studyDirect(JNIEnv *env, jobject obj, jobjectArray data, jint offset, jint n, jboolean final)
+{
+    RubberBandStretcher *stretcher = getStretcher(env, obj);
+    size_t channels = stretcher->getChannelCount();
+
+    float **input = allocate<float *>(channels);
+    if (getDirectChannels(env, data, offset, n, channels, input)) {
+        stretcher->study(input, n, final);
+    }
+    deallocate(input);
+}
+
+JNIEXPORT void JNICALL
+Java_com_breakfastquay_rubberband_RubberBandStretcher_processDirect(JNIEnv *env, jobject obj, jobjectArray data, jint offset, jint n, jboolean final)
+{
+    RubberBandStretcher *stretcher = getStretcher(env, obj);
+    size_t channels = stretcher->getChannelCount();
+
+    float **input = allocate<float *>(channels);
+    if (getDirectChannels(env, data, offset, n, channels, input)) {
+        stretcher->process(input, n, final);
+    }
+    deallocate(input);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_breakfastquay_rubberband_RubberBandStretcher_retrieveDirect(JNIEnv *env, jobject obj, jobjectArray output, jint offset, jint n)
+{
+    RubberBandStretcher *stretcher = getStretcher(env, obj);
+    size_t channels = stretcher->getChannelCount();
+
+    size_t retrieved = 0;
+    float **outbuf = allocate<float *>(channels);
+    if (getDirectChannels(env, output, offset, n, channels, outbuf)) {
+        retrieved = stretcher->retrieve(outbuf, n);
+    }
+    deallocate(outbuf);
+    return retrieved;
+}
+
@@ -24,6 +24,11 @@
 #include "rubberband/rubberband-c.h"
 #include "rubberband/RubberBandStretcher.h"
 
+#include "system/Thread.h"
+#include "system/ThreadPool.h"
+
+#include <vector>
+
 struct RubberBandState_
 {
     RubberBand::RubberBandStretcher *m_s;
@@ -167,3 +172,150 @@ void rubberband_set_default_debug_level(int level)
     RubberBand::RubberBandStretcher::setDefaultDebugLevel(level);
 }
 
+
+struct RubberBandBatch_
+{
+    unsigned int m_sampleRate;
+    unsigned int m_channels;
+    RubberBandOptions m_options;
+    unsigned int m_maxThreads;
+    std::vector<RubberBand::RubberBandStretcher *> m_stretchers;
+};
+
+static void
+processBatchClip(RubberBand::RubberBandStretcher *s, RubberBandClip &clip)
+{
+    s->reset();
+    s->setTimeRatio(clip.timeRatio);
+    s->setPitchScale(clip.pitchScale);
+    clip.outputFrames = 0;
+    if (clip.inputFrames == 0) return;
+    clip.outputFrames = s->processWhole(clip.input, clip.inputFrames,
+                                        clip.output, clip.outputCapacity);
+}
+
+#ifndef NO_THREADING
+
+// Each job takes the next unclaimed clip until there are none left,
+// so that a thread that gets short clips goes on to take more of them
+
+class BatchJob : public RubberBand::ThreadPool::Job
+{
+public:
+    BatchJob(RubberBand::RubberBandStretcher *s,
+             RubberBandClip *clips, unsigned int count,
+             RubberBand::Condition *done,
+             unsigned int *next, int *remaining) :
+        m_s(s), m_clips(clips), m_count(count),
+        m_done(done), m_next(next), m_remaining(remaining) { }
+
+    void run() {
+        while (true) {
+            m_done->lock();
+            unsigned int i = (*m_next)++;
+            m_done->unlock();
+            if (i >= m_count) break;
+            processBatchClip(m_s, m_clips[i]);
+        }
+        m_done->lock();
+        --*m_remaining;
+        m_done->signal();
+        m_done->unlock();
+    }
+
+private:
+    RubberBand::RubberBandStretcher *m_s;
+    RubberBandClip *m_clips;
+    unsigned int m_count;
+    RubberBand::Condition *m_done;
+    unsigned int *m_next; // guarded by m_done
+    int *m_remaining; // guarded by m_done
+};
+
+#endif
+
+RubberBandBatch rubberband_batch_new(unsigned int sampleRate,
+                                     unsigned int channels,
+                                     RubberBandOptions options,
+                                     unsigned int maxThreads)
+{
+    RubberBandBatch_ *batch = new RubberBandBatch_();
+    batch->m_sampleRate = sampleRate;
+    batch->m_channels = channels;
+    batch->m_options =
+        (options & ~(RubberBandOptionProcessRealTime |
+                     RubberBandOptionProcessSmallBlocks |
+                     RubberBandOptionThreadingAlways)) |
+        RubberBandOptionThreadingNever;
+    batch->m_maxThreads = maxThreads;
+    return batch;
+}
+
+void rubberband_batch_delete(RubberBandBatch batch)
+{
+    for (size_t i = 0; i < batch->m_stretchers.size(); ++i) {
+        delete batch->m_stretchers[i];
+    }
+    delete batch;
+}
+
+void rubberband_batch_process(RubberBandBatch batch, RubberBandClip *clips, unsigned int count)
+{
+    if (count == 0) return;
+
+    unsigned int threads = 1;
+
+#ifndef NO_THREADING
+    RubberBand::ThreadPool *pool = RubberBand::ThreadPool::getInstance();
+    threads = batch->m_maxThreads;
+    if (threads == 0) threads = pool->getWorkerCount();
+    if (threads > count) threads = count;
+    if (threads < 1) threads = 1;
+#endif
+
+    // Stretchers are created as needed and kept for later calls
+    while (batch->m_stretchers.size() < threads) {
+        batch->m_stretchers.push_back
+            (new RubberBand::RubberBandStretcher
+             (batch->m_sampleRate, batch->m_channels, batch->m_options));
+    }
+
+#ifndef NO_THREADING
+    if (threads > 1) {
+
+        // The calling thread takes a share of the clips too, rather
+        // than waiting idle, so if the pool is busy with other work
+        // the clips are not all left waiting for it
+
+        RubberBand::Condition done("batch");
+        unsigned int next = 0;
+        int remaining = int(threads);
+        std::vector<BatchJob *> jobs;
+
+        for (unsigned int t = 0; t < threads; ++t) {
+            jobs.push_back(new BatchJob(batch->m_stretchers[t], clips, count,
+                                        &done, &next, &remaining));
+        }
+        for (unsigned int t = 1; t < threads; ++t) {
+            pool->submit(jobs[t]);
+        }
+
+        jobs[0]->run();
+
+        done.lock();
+        while (remaining > 0) {
+            done.wait();
+        }
+        done.unlock();
+
+        for (size_t t = 0; t < jobs.size(); ++t) {
+            delete jobs[t];
+        }
+        return;
+    }
+#endif
+
+    for (unsigned int i = 0; i < count; ++i) {
+        processBatchClip(batch->m_stretchers[0], clips[i]);
+    }
+}
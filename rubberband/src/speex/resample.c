@@ -184,6 +184,7 @@ struct SpeexResamplerState_ {
     spx_uint32_t nb_channels;
     spx_uint32_t filt_len;
     spx_uint32_t mem_alloc_size;
+    spx_uint32_t mem_capacity;
     int          int_advance;
     int          frac_advance;
     float  cutoff;
@@ -711,6 +712,7 @@ static void update_filter(SpeexResamplerState *st)
 
             st->sinc_table = (float *)speex_alloc
                 (st->filt_len * st->den_rate, sizeof(float));
+            st->sinc_table_alloc = st->filt_len * st->den_rate;
 
 	} else if (st->sinc_table_alloc < st->filt_len*st->den_rate) {
 
@@ -750,6 +752,7 @@ static void update_filter(SpeexResamplerState *st)
 
             st->sinc_table = (float *)speex_alloc
                 ((st->filt_len * st->oversample + 8),  sizeof(float));
+            st->sinc_table_alloc = st->filt_len * st->oversample + 8;
 
 	} else if (st->sinc_table_alloc < st->filt_len*st->oversample + 8) {
 
@@ -790,6 +793,7 @@ static void update_filter(SpeexResamplerState *st)
         unsigned int i;
         st->mem = (float*)speex_alloc
             (st->nb_channels * (st->filt_len - 1), sizeof(float));
+        st->mem_capacity = st->nb_channels * (st->filt_len - 1);
 
         for (i = 0; i < st->nb_channels * (st->filt_len - 1); i++)
             st->mem[i] = 0;
@@ -800,9 +804,12 @@ static void update_filter(SpeexResamplerState *st)
 
         unsigned int i;
 
+        if (st->nb_channels * (st->filt_len - 1) > st->mem_capacity) {
 		//fprintf(stderr,"mem=%p\n",st->mem);
 		st->mem = (float*)speex_realloc
             (st->mem, 0, st->nb_channels * (st->filt_len - 1), sizeof(float));
+            st->mem_capacity = st->nb_channels * (st->filt_len - 1);
+        }
 
         for (i = 0; i < st->nb_channels * (st->filt_len - 1); i++)
             st->mem[i] = 0;
@@ -819,11 +826,18 @@ static void update_filter(SpeexResamplerState *st)
 
         if (st->filt_len - 1 > st->mem_alloc_size) {
 			
+            /* A reserved buffer may be big enough already, in which
+               case only the per-channel stride changes */
+
+            if (st->nb_channels * (st->filt_len - 1) > st->mem_capacity) {
+
 		//fprintf(stderr,"mem=%p\n",st->mem);
 
-            st->mem = (float*)speex_realloc
-                (st->mem, st->nb_channels * (old_length - 1),
-                 st->nb_channels * (st->filt_len - 1), sizeof(float));
+                st->mem = (float*)speex_realloc
+                    (st->mem, st->nb_channels * (old_length - 1),
+                     st->nb_channels * (st->filt_len - 1), sizeof(float));
+                st->mem_capacity = st->nb_channels * (st->filt_len - 1);
+            }
             st->mem_alloc_size = st->filt_len - 1;
         }
 
@@ -941,6 +955,7 @@ SpeexResamplerState *speex_resampler_init_frac(unsigned int nb_channels, unsigne
     st->sinc_table_length = 0;
     st->sinc_table_alloc = 0;
     st->mem_alloc_size = 0;
+    st->mem_capacity = 0;
     st->filt_len = 0;
     st->mem = 0;
     st->resampler_ptr = 0;
@@ -1114,6 +1129,69 @@ static unsigned int gcd(unsigned int a, unsigned int b)
     return a;
 }
 
+static void reserved_sizes(SpeexResamplerState *st, double ratio, spx_uint32_t *table_len, spx_uint32_t *filt_len)
+{
+    /* Filter and table lengths for a ratio of ratio:1 with the
+       interpolating filter, calculated as in update_filter */
+
+    spx_uint32_t len = quality_map[st->quality].base_length;
+    spx_uint32_t over = quality_map[st->quality].oversample;
+
+    if (ratio > 1.0) {
+        len = (spx_uint32_t)ceil(len * ratio);
+        len &= (~0x3);
+        if (ratio > 2.0) over >>= 1;
+        if (ratio > 4.0) over >>= 1;
+        if (ratio > 8.0) over >>= 1;
+        if (ratio > 16.0) over >>= 1;
+        if (over < 1) over = 1;
+    }
+
+    *table_len = len * over + 8;
+    *filt_len = len;
+}
+
+int speex_resampler_reserve_frac(SpeexResamplerState *st, spx_uint32_t ratio_num, spx_uint32_t ratio_den)
+{
+    double ratio, limit;
+    spx_uint32_t table_len = 0, filt_len = 0, tl, fl;
+
+    if (ratio_den == 0) {
+        return RESAMPLER_ERR_INVALID_ARG;
+    }
+
+    ratio = (double)ratio_num / (double)ratio_den;
+
+    /* The table is longest just before each halving of the
+       oversampling, and the filter at the reserved ratio itself */
+
+    for (limit = 1.0; limit < 32.0; limit *= 2.0) {
+        reserved_sizes(st, ratio < limit ? ratio : limit, &tl, &fl);
+        if (tl > table_len) table_len = tl;
+        if (fl > filt_len) filt_len = fl;
+    }
+    reserved_sizes(st, ratio, &tl, &fl);
+    if (tl > table_len) table_len = tl;
+    if (fl > filt_len) filt_len = fl;
+
+    if (table_len > st->sinc_table_alloc) {
+        st->sinc_table = (float *)speex_realloc
+            (st->sinc_table, st->sinc_table_alloc, table_len, sizeof(float));
+        st->sinc_table_alloc = table_len;
+    }
+
+    if (st->nb_channels * (filt_len - 1) > st->mem_capacity) {
+        /* The existing layout is a prefix of the new buffer, so this
+           keeps the contents where update_filter expects them */
+        st->mem = (float *)speex_realloc
+            (st->mem, st->mem_capacity, st->nb_channels * (filt_len - 1),
+             sizeof(float));
+        st->mem_capacity = st->nb_channels * (filt_len - 1);
+    }
+
+    return RESAMPLER_ERR_SUCCESS;
+}
+
 int speex_resampler_set_rate_frac(SpeexResamplerState *st, unsigned int ratio_num, unsigned int ratio_den, unsigned int in_rate, unsigned int out_rate)
 {
     unsigned int old_den;
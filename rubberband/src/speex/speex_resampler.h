@@ -64,6 +64,7 @@
 #define speex_resampler_get_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_get_rate)
 #define speex_resampler_set_rate_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate_frac)
 #define speex_resampler_get_ratio CAT_PREFIX(RANDOM_PREFIX,_resampler_get_ratio)
+#define speex_resampler_reserve_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_reserve_frac)
 #define speex_resampler_set_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_set_quality)
 #define speex_resampler_get_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_get_quality)
 #define speex_resampler_set_input_stride CAT_PREFIX(RANDOM_PREFIX,_resampler_set_input_stride)
@@ -209,6 +210,18 @@ int speex_resampler_set_rate_frac(SpeexResamplerState *st,
                                    spx_uint32_t in_rate, 
                                    spx_uint32_t out_rate);
 
+/** Allocate the filter memory needed for any resampling ratio between
+ * 1:1 and ratio_num:ratio_den (a ratio of input to output rate, so
+ * this matters for down-sampling), so that subsequent changes of rate
+ * within that range don't allocate memory.
+ * @param st Resampler state
+ * @param ratio_num Numerator of the largest sampling rate ratio
+ * @param ratio_den Denominator of the largest sampling rate ratio
+ */
+int speex_resampler_reserve_frac(SpeexResamplerState *st, 
+                                 spx_uint32_t ratio_num, 
+                                 spx_uint32_t ratio_den);
+
 /** Get the current resampling ratio. This will be reduced to the least
  * common denominator.
  * @param st Resampler state
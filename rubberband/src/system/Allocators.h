@@ -43,6 +43,12 @@
 #include <sys/mman.h>
 #endif
 
+// USE_RETRO_ARENA: allocate from the arena set for the calling thread
+// with retro_arena.h
+#ifdef USE_RETRO_ARENA
+#include "retro_arena.h"
+#endif
+
 #ifdef LACK_BAD_ALLOC
 namespace std { struct bad_alloc { }; }
 #endif
@@ -55,6 +61,9 @@ T *allocate(size_t count)
     void *ptr = 0;
     // 32-byte alignment is required for at least OpenMAX
     static const int alignment = 32;
+#ifdef USE_RETRO_ARENA
+    ptr = retro_arena_memalign(alignment, count * sizeof(T));
+#else /* !USE_RETRO_ARENA */
 #ifdef USE_OWN_ALIGNED_MALLOC
     // Alignment must be a power of two, bigger than the pointer
     // size. Stuff the actual malloc'd pointer in just before the
@@ -85,6 +94,7 @@ T *allocate(size_t count)
 #endif /* !__MSVC__ */
 #endif /* !HAVE_POSIX_MEMALIGN */
 #endif /* !USE_OWN_ALIGNED_MALLOC */
+#endif /* !USE_RETRO_ARENA */
     if (!ptr) {
 #ifndef NO_EXCEPTIONS
         throw(std::bad_alloc());
@@ -116,6 +126,9 @@ T *allocate_and_zero(size_t count)
 template <typename T>
 void deallocate(T *ptr)
 {
+#ifdef USE_RETRO_ARENA
+    retro_arena_free((void *)ptr);
+#else /* !USE_RETRO_ARENA */
 #ifdef USE_OWN_ALIGNED_MALLOC
     if (ptr) free(((void **)ptr)[-1]);
 #else /* !USE_OWN_ALIGNED_MALLOC */
@@ -125,6 +138,7 @@ void deallocate(T *ptr)
     if (ptr) free((void *)ptr);
 #endif /* !__MSVC__ */
 #endif /* !USE_OWN_ALIGNED_MALLOC */
+#endif /* !USE_RETRO_ARENA */
 }
 
 #ifdef HAVE_IPP
@@ -0,0 +1,130 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    Rubber Band Library
+    An audio time-stretching and pitch-shifting library.
+    Copyright 2007-2015 Particular Programs Ltd.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+
+    Alternatively, if you have a valid commercial licence for the
+    Rubber Band Library obtained by agreement with the copyright
+    holders, you may redistribute and/or modify it under the terms
+    described in that licence.
+
+    If you wish to distribute code using the Rubber Band Library
+    under terms other than those of the GNU General Public License,
+    you must obtain a valid commercial licence before doing so.
+*/
+
+
+#ifndef NO_THREADING
+
+#include "ThreadPool.h"
+#include "sysutils.h"
+
+namespace RubberBand
+{
+
+Mutex ThreadPool::m_instanceMutex;
+ThreadPool *ThreadPool::m_instance = 0;
+
+ThreadPool *
+ThreadPool::getInstance()
+{
+    MutexLocker locker(&m_instanceMutex);
+    if (!m_instance) {
+        m_instance = new ThreadPool(system_get_processor_count());
+    }
+    return m_instance;
+}
+
+ThreadPool::ThreadPool(int workers) :
+    m_jobAvailable("job available"),
+    m_queued(0),
+    m_next(0)
+{
+    if (workers < 1) workers = 1;
+    for (int i = 0; i < workers; ++i) {
+        m_workers.push_back(new Worker(this, i));
+    }
+    for (int i = 0; i < workers; ++i) {
+        m_workers[i]->start();
+    }
+}
+
+void
+ThreadPool::submit(Job *job)
+{
+    m_jobAvailable.lock();
+    Worker *w = m_workers[m_next];
+    if (++m_next == int(m_workers.size())) m_next = 0;
+    m_jobAvailable.unlock();
+
+    w->mutex.lock();
+    w->jobs.push_back(job);
+    w->mutex.unlock();
+
+    m_jobAvailable.lock();
+    ++m_queued;
+    m_jobAvailable.signal();
+    m_jobAvailable.unlock();
+}
+
+ThreadPool::Job *
+ThreadPool::takeJob(int index)
+{
+    int n = int(m_workers.size());
+
+    // Own queue first, then steal from the others, starting with the
+    // next one along so that thieves don't all converge on one queue
+    for (int i = 0; i < n; ++i) {
+        Worker *w = m_workers[(index + i) % n];
+        w->mutex.lock();
+        if (!w->jobs.empty()) {
+            Job *job = w->jobs.front();
+            w->jobs.pop_front();
+            w->mutex.unlock();
+            return job;
+        }
+        w->mutex.unlock();
+    }
+
+    return 0;
+}
+
+ThreadPool::Worker::Worker(ThreadPool *pool, int index) :
+    m_pool(pool),
+    m_index(index)
+{ }
+
+void
+ThreadPool::Worker::run()
+{
+    while (true) {
+
+        Job *job = m_pool->takeJob(m_index);
+
+        if (job) {
+            m_pool->m_jobAvailable.lock();
+            --m_pool->m_queued;
+            m_pool->m_jobAvailable.unlock();
+            job->run();
+            continue;
+        }
+
+        m_pool->m_jobAvailable.lock();
+        if (m_pool->m_queued == 0) {
+            m_pool->m_jobAvailable.wait(100000);
+        }
+        m_pool->m_jobAvailable.unlock();
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    Rubber Band Library
+    An audio time-stretching and pitch-shifting library.
+    Copyright 2007-2015 Particular Programs Ltd.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+
+    Alternatively, if you have a valid commercial licence for the
+    Rubber Band Library obtained by agreement with the copyright
+    holders, you may redistribute and/or modify it under the terms
+    described in that licence.
+
+    If you wish to distribute code using the Rubber Band Library
+    under terms other than those of the GNU General Public License,
+    you must obtain a valid commercial licence before doing so.
+*/
+
+
+#ifndef _RUBBERBAND_THREAD_POOL_H_
+#define _RUBBERBAND_THREAD_POOL_H_
+
+#ifndef NO_THREADING
+
+#include "Thread.h"
+
+#include <deque>
+#include <vector>
+
+namespace RubberBand
+{
+
+/**
+ * A process-wide pool of worker threads, one per processor, that
+ * runs jobs submitted by any number of stretcher instances.  This
+ * keeps the total thread count tracking the number of processors
+ * rather than the number of channels being processed.
+ *
+ * Each worker has its own job queue, and submitted jobs are
+ * distributed round-robin between the queues.  A worker runs the jobs
+ * from its own queue in order, and when that is empty steals the
+ * oldest job from the other queues before going to sleep.  A job that
+ * blocks one worker therefore doesn't hold up the jobs queued behind
+ * it.
+ *
+ * Jobs are not owned by the pool, and must remain valid until they
+ * have been run.  A job that should run again must be resubmitted.
+ */
+
+class ThreadPool
+{
+public:
+    class Job
+    {
+    public:
+        virtual ~Job() { }
+        virtual void run() = 0;
+    };
+
+    /**
+     * Return the process-wide pool, starting its threads on the
+     * first call.  The pool is never destroyed.
+     */
+    static ThreadPool *getInstance();
+
+    /**
+     * Queue a job to be run by one of the worker threads.
+     */
+    void submit(Job *job);
+
+    int getWorkerCount() const { return int(m_workers.size()); }
+
+protected:
+    ThreadPool(int workers);
+
+    class Worker : public Thread
+    {
+    public:
+        Worker(ThreadPool *pool, int index);
+
+        Mutex mutex;
+        std::deque<Job *> jobs;
+
+    protected:
+        void run();
+
+    private:
+        ThreadPool *m_pool;
+        int m_index;
+    };
+
+    Job *takeJob(int index);
+
+    std::vector<Worker *> m_workers;
+    Condition m_jobAvailable;
+    int m_queued;
+    int m_next;
+
+    static Mutex m_instanceMutex;
+    static ThreadPool *m_instance;
+
+private:
+    ThreadPool(const ThreadPool &); // not provided
+    ThreadPool &operator=(const ThreadPool &); // not provided
+};
+
+}
+
+#endif
+
+#endif
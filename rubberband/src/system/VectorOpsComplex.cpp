@@ -32,9 +32,16 @@
 #include "pommier/neon_mathfun.h"
 #else
 #include "pommier/sse_mathfun.h"
+#include <emmintrin.h>
 #endif
 #endif
 
+#if defined __AVX__
+#include <immintrin.h>
+#elif defined __aarch64__
+#include <arm_neon.h>
+#endif
+
 namespace RubberBand {
 
 #ifdef USE_APPROXIMATE_ATAN2
@@ -93,20 +100,20 @@ v_polar_to_cartesian_pommier(float *const R__ real,
                              const int count)
 {
     int idx = 0, tidx = 0;
-    int i = 0;
+    int i;
 
-    for (int i = 0; i + 4 < count; i += 4) {
+    for (i = 0; i + 4 <= count; i += 4) {
 
 	V4SF fmag, fphase, fre, fim;
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             fmag.f[j] = mag[idx];
             fphase.f[j] = phase[idx++];
         }
 
 	sincos_ps(fphase.v, &fim.v, &fre.v);
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             real[tidx] = fre.f[j] * fmag.f[j];
             imag[tidx++] = fim.f[j] * fmag.f[j];
         }
@@ -128,18 +135,18 @@ v_polar_interleaved_to_cartesian_inplace_pommier(float *const R__ srcdst,
     int i;
     int idx = 0, tidx = 0;
 
-    for (i = 0; i + 4 < count; i += 4) {
+    for (i = 0; i + 4 <= count; i += 4) {
 
 	V4SF fmag, fphase, fre, fim;
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             fmag.f[j] = srcdst[idx++];
             fphase.f[j] = srcdst[idx++];
         }
 
 	sincos_ps(fphase.v, &fim.v, &fre.v);
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             srcdst[tidx++] = fre.f[j] * fmag.f[j];
             srcdst[tidx++] = fim.f[j] * fmag.f[j];
         }
@@ -169,7 +176,7 @@ v_polar_to_cartesian_interleaved_pommier(float *const R__ dst,
 
 	V4SF fmag, fphase, fre, fim;
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             fmag.f[j] = mag[idx];
             fphase.f[j] = phase[idx];
             ++idx;
@@ -177,7 +184,7 @@ v_polar_to_cartesian_interleaved_pommier(float *const R__ dst,
 
 	sincos_ps(fphase.v, &fim.v, &fre.v);
 
-        for (int j = 0; j < 3; ++j) {
+        for (int j = 0; j < 4; ++j) {
             dst[tidx++] = fre.f[j] * fmag.f[j];
             dst[tidx++] = fim.f[j] * fmag.f[j];
         }
@@ -192,7 +199,253 @@ v_polar_to_cartesian_interleaved_pommier(float *const R__ dst,
     }
 }    
 
+
+#if defined __ARMEL__ || defined __aarch64__
+static inline v4sf set1_ps(float f) { return vdupq_n_f32(f); }
+static inline v4sf loadu_ps(const float *p) { return vld1q_f32(p); }
+static inline void storeu_ps(float *p, v4sf v) { vst1q_f32(p, v); }
+static inline v4sf add_ps(v4sf a, v4sf b) { return vaddq_f32(a, b); }
+static inline v4sf sub_ps(v4sf a, v4sf b) { return vsubq_f32(a, b); }
+static inline v4sf mul_ps(v4sf a, v4sf b) { return vmulq_f32(a, b); }
+static inline v4sf floor_ps(v4sf x)
+{
+    // truncate, then step down where that rounded upwards
+    v4sf t = vcvtq_f32_s32(vcvtq_s32_f32(x));
+    uint32x4_t up = vcgtq_f32(t, x);
+    return vsubq_f32(t, vreinterpretq_f32_u32
+                     (vandq_u32(up, vreinterpretq_u32_f32(vdupq_n_f32(1.f)))));
+}
+#else
+static inline v4sf set1_ps(float f) { return _mm_set1_ps(f); }
+static inline v4sf loadu_ps(const float *p) { return _mm_loadu_ps(p); }
+static inline void storeu_ps(float *p, v4sf v) { _mm_storeu_ps(p, v); }
+static inline v4sf add_ps(v4sf a, v4sf b) { return _mm_add_ps(a, b); }
+static inline v4sf sub_ps(v4sf a, v4sf b) { return _mm_sub_ps(a, b); }
+static inline v4sf mul_ps(v4sf a, v4sf b) { return _mm_mul_ps(a, b); }
+static inline v4sf floor_ps(v4sf x)
+{
+    // truncate, then step down where that rounded upwards
+    v4sf t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    v4sf up = _mm_cmpgt_ps(t, x);
+    return _mm_sub_ps(t, _mm_and_ps(up, _mm_set1_ps(1.f)));
+}
 #endif
 
+void
+v_phase_advance_pommier(float *const R__ errorChange,
+                        float *const R__ advance,
+                        float *const R__ prevError,
+                        const float *const R__ phase,
+                        const float *const R__ prevPhase,
+                        const double omegaScale,
+                        const double fftSize,
+                        const float increment,
+                        const float outputIncrement,
+                        const int count)
+{
+    const float omegaStep = float(omegaScale / fftSize);
+    const float twopi = float(2.0 * M_PI);
+
+    const v4sf vstep = set1_ps(4.f * omegaStep);
+    const v4sf vpi = set1_ps(float(M_PI));
+    const v4sf vtwopi = set1_ps(twopi);
+    const v4sf vrecip = set1_ps(float(-1.0 / (2.0 * M_PI)));
+    const v4sf vratio = set1_ps(outputIncrement / increment);
+
+    V4SF o;
+    for (int j = 0; j < 4; ++j) o.f[j] = j * omegaStep;
+    v4sf omega = o.v;
+
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+
+        // princarg(phase - (prevPhase + omega)), wrapping into
+        // (-pi, pi] as mod(x + pi, -2pi) + pi
+        v4sf x = add_ps(sub_ps(loadu_ps(phase + i),
+                               add_ps(loadu_ps(prevPhase + i), omega)),
+                        vpi);
+        v4sf perr = add_ps(add_ps(x, mul_ps(vtwopi,
+                                            floor_ps(mul_ps(x, vrecip)))),
+                           vpi);
+
+        storeu_ps(errorChange + i, sub_ps(perr, loadu_ps(prevError + i)));
+        storeu_ps(prevError + i, perr);
+        storeu_ps(advance + i, mul_ps(add_ps(omega, perr), vratio));
+
+        omega = add_ps(omega, vstep);
+    }
+
+    while (i < count) {
+        float om = i * omegaStep;
+        float perr = princargf(phase[i] - (prevPhase[i] + om));
+        errorChange[i] = perr - prevError[i];
+        prevError[i] = perr;
+        advance[i] = (om + perr) * (outputIncrement / increment);
+        ++i;
+    }
+}
+
+void
+v_fast_log_pommier(float *const R__ dst,
+                   const int count)
+{
+    int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        storeu_ps(dst + i, log_ps(loadu_ps(dst + i)));
+    }
+    while (i < count) {
+        dst[i] = logf(dst[i]);
+        ++i;
+    }
+}
+
+void
+v_fast_log_pommier(double *const R__ dst,
+                   const int count)
+{
+    int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        V4SF x;
+        for (int j = 0; j < 4; ++j) x.f[j] = float(dst[i + j]);
+        x.v = log_ps(x.v);
+        for (int j = 0; j < 4; ++j) dst[i + j] = x.f[j];
+    }
+    while (i < count) {
+        dst[i] = log(dst[i]);
+        ++i;
+    }
+}
+
+void
+v_fast_exp_pommier(float *const R__ dst,
+                   const int count)
+{
+    int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        storeu_ps(dst + i, exp_ps(loadu_ps(dst + i)));
+    }
+    while (i < count) {
+        dst[i] = expf(dst[i]);
+        ++i;
+    }
+}
+
+void
+v_fast_exp_pommier(double *const R__ dst,
+                   const int count)
+{
+    int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        V4SF x;
+        for (int j = 0; j < 4; ++j) x.f[j] = float(dst[i + j]);
+        x.v = exp_ps(x.v);
+        for (int j = 0; j < 4; ++j) dst[i + j] = x.f[j];
+    }
+    while (i < count) {
+        dst[i] = exp(dst[i]);
+        ++i;
+    }
+}
+
+#endif
+
+#if defined __AVX__ || defined __aarch64__
+
+void
+v_phase_advance_simd(double *const R__ errorChange,
+                     double *const R__ advance,
+                     double *const R__ prevError,
+                     const double *const R__ phase,
+                     const double *const R__ prevPhase,
+                     const double omegaScale,
+                     const double fftSize,
+                     const double increment,
+                     const double outputIncrement,
+                     const int count)
+{
+    // The same operations in the same order as v_phase_advance_scalar
+
+    int i;
+
+#if defined __AVX__
+
+    const __m256d vscale = _mm256_set1_pd(omegaScale);
+    const __m256d vsize = _mm256_set1_pd(fftSize);
+    const __m256d vpi = _mm256_set1_pd(M_PI);
+    const __m256d vm2pi = _mm256_set1_pd(-2.0 * M_PI);
+    const __m256d vinc = _mm256_set1_pd(increment);
+    const __m256d voinc = _mm256_set1_pd(outputIncrement);
+    const __m256d vfour = _mm256_set1_pd(4.0);
+
+    __m256d vi = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+
+    for (i = 0; i + 4 <= count; i += 4) {
+
+        __m256d omega = _mm256_div_pd(_mm256_mul_pd(vscale, vi), vsize);
+        __m256d a = _mm256_add_pd
+            (_mm256_sub_pd(_mm256_loadu_pd(phase + i),
+                           _mm256_add_pd(_mm256_loadu_pd(prevPhase + i),
+                                         omega)),
+             vpi);
+        __m256d q = _mm256_floor_pd(_mm256_div_pd(a, vm2pi));
+        __m256d perr = _mm256_add_pd
+            (_mm256_sub_pd(a, _mm256_mul_pd(vm2pi, q)), vpi);
+
+        _mm256_storeu_pd(errorChange + i,
+                         _mm256_sub_pd(perr, _mm256_loadu_pd(prevError + i)));
+        _mm256_storeu_pd(prevError + i, perr);
+        _mm256_storeu_pd(advance + i,
+                         _mm256_mul_pd(voinc,
+                                       _mm256_div_pd(_mm256_add_pd(omega, perr),
+                                                     vinc)));
+
+        vi = _mm256_add_pd(vi, vfour);
+    }
+
+#else // __aarch64__
+
+    const float64x2_t vscale = vdupq_n_f64(omegaScale);
+    const float64x2_t vsize = vdupq_n_f64(fftSize);
+    const float64x2_t vpi = vdupq_n_f64(M_PI);
+    const float64x2_t vm2pi = vdupq_n_f64(-2.0 * M_PI);
+    const float64x2_t vinc = vdupq_n_f64(increment);
+    const float64x2_t voinc = vdupq_n_f64(outputIncrement);
+    const float64x2_t vtwo = vdupq_n_f64(2.0);
+
+    const double first[2] = { 0.0, 1.0 };
+    float64x2_t vi = vld1q_f64(first);
+
+    for (i = 0; i + 2 <= count; i += 2) {
+
+        float64x2_t omega = vdivq_f64(vmulq_f64(vscale, vi), vsize);
+        float64x2_t a = vaddq_f64
+            (vsubq_f64(vld1q_f64(phase + i),
+                       vaddq_f64(vld1q_f64(prevPhase + i), omega)),
+             vpi);
+        float64x2_t q = vrndmq_f64(vdivq_f64(a, vm2pi));
+        float64x2_t perr = vaddq_f64(vsubq_f64(a, vmulq_f64(vm2pi, q)), vpi);
+
+        vst1q_f64(errorChange + i, vsubq_f64(perr, vld1q_f64(prevError + i)));
+        vst1q_f64(prevError + i, perr);
+        vst1q_f64(advance + i,
+                  vmulq_f64(voinc, vdivq_f64(vaddq_f64(omega, perr), vinc)));
+
+        vi = vaddq_f64(vi, vtwo);
+    }
+
+#endif
+
+    while (i < count) {
+        double omega = (omegaScale * i) / fftSize;
+        double perr = princarg(phase[i] - (prevPhase[i] + omega));
+        errorChange[i] = perr - prevError[i];
+        prevError[i] = perr;
+        advance[i] = outputIncrement * ((omega + perr) / increment);
+        ++i;
+    }
+}
+
+#endif
 
 }
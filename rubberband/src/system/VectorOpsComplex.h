@@ -246,6 +246,171 @@ void v_cartesian_to_polar_interleaved_inplace(T *const R__ srcdst,
     }
 }
 
+/**
+ * Phase vocoder phase advance for count bins, the independent part
+ * of each bin's calculation in the stretcher's modifyChunk. Bin i has
+ * expected phase advance omega = omegaScale * i / fftSize per input
+ * increment. Calculates the wrapped deviation of the new phase from
+ * the expected one, writes it to prevError and the change from the
+ * previous value of prevError to errorChange, and writes the phase
+ * advance for outputIncrement to advance.
+ */
+template<typename T>
+void v_phase_advance_scalar(T *const R__ errorChange,
+                            T *const R__ advance,
+                            T *const R__ prevError,
+                            const T *const R__ phase,
+                            const T *const R__ prevPhase,
+                            const double omegaScale,
+                            const double fftSize,
+                            const T increment,
+                            const T outputIncrement,
+                            const int count)
+{
+    for (int i = 0; i < count; ++i) {
+        T omega = (omegaScale * i) / fftSize;
+        T perr = princarg(phase[i] - (prevPhase[i] + omega));
+        errorChange[i] = perr - prevError[i];
+        prevError[i] = perr;
+        advance[i] = outputIncrement * ((omega + perr) / increment);
+    }
+}
+
+template<typename T>
+inline void v_phase_advance(T *const R__ errorChange,
+                            T *const R__ advance,
+                            T *const R__ prevError,
+                            const T *const R__ phase,
+                            const T *const R__ prevPhase,
+                            const double omegaScale,
+                            const double fftSize,
+                            const T increment,
+                            const T outputIncrement,
+                            const int count)
+{
+    v_phase_advance_scalar(errorChange, advance, prevError, phase, prevPhase,
+                           omegaScale, fftSize, increment, outputIncrement,
+                           count);
+}
+
+#if defined USE_POMMIER_MATHFUN
+// Calculates in single precision throughout, where the scalar
+// version wraps in double, so a bin whose phase error is right at
+// +/-pi may be wrapped to the other side
+void v_phase_advance_pommier(float *const R__ errorChange,
+                             float *const R__ advance,
+                             float *const R__ prevError,
+                             const float *const R__ phase,
+                             const float *const R__ prevPhase,
+                             const double omegaScale,
+                             const double fftSize,
+                             const float increment,
+                             const float outputIncrement,
+                             const int count);
+
+template<>
+inline void v_phase_advance(float *const R__ errorChange,
+                            float *const R__ advance,
+                            float *const R__ prevError,
+                            const float *const R__ phase,
+                            const float *const R__ prevPhase,
+                            const double omegaScale,
+                            const double fftSize,
+                            const float increment,
+                            const float outputIncrement,
+                            const int count)
+{
+    v_phase_advance_pommier(errorChange, advance, prevError, phase, prevPhase,
+                            omegaScale, fftSize, increment, outputIncrement,
+                            count);
+}
+#endif
+
+// Natural log and exponential for spectral envelope estimation,
+// where single-precision accuracy is plenty. Same as v_log and v_exp
+// unless the pommier functions are available and there is no IPP or
+// vDSP to do better.
+template<typename T>
+inline void v_fast_log(T *const R__ dst,
+                       const int count)
+{
+    v_log(dst, count);
+}
+
+template<typename T>
+inline void v_fast_exp(T *const R__ dst,
+                       const int count)
+{
+    v_exp(dst, count);
+}
+
+#if defined USE_POMMIER_MATHFUN && !defined HAVE_IPP && !defined HAVE_VDSP
+// Double variants round through single precision four at a time
+void v_fast_log_pommier(float *const R__ dst, const int count);
+void v_fast_log_pommier(double *const R__ dst, const int count);
+void v_fast_exp_pommier(float *const R__ dst, const int count);
+void v_fast_exp_pommier(double *const R__ dst, const int count);
+
+template<>
+inline void v_fast_log(float *const R__ dst,
+                       const int count)
+{
+    v_fast_log_pommier(dst, count);
+}
+
+template<>
+inline void v_fast_log(double *const R__ dst,
+                       const int count)
+{
+    v_fast_log_pommier(dst, count);
+}
+
+template<>
+inline void v_fast_exp(float *const R__ dst,
+                       const int count)
+{
+    v_fast_exp_pommier(dst, count);
+}
+
+template<>
+inline void v_fast_exp(double *const R__ dst,
+                       const int count)
+{
+    v_fast_exp_pommier(dst, count);
+}
+#endif
+
+#if defined __AVX__ || defined __aarch64__
+// Same results as the scalar version, with AVX or 64-bit NEON
+void v_phase_advance_simd(double *const R__ errorChange,
+                          double *const R__ advance,
+                          double *const R__ prevError,
+                          const double *const R__ phase,
+                          const double *const R__ prevPhase,
+                          const double omegaScale,
+                          const double fftSize,
+                          const double increment,
+                          const double outputIncrement,
+                          const int count);
+
+template<>
+inline void v_phase_advance(double *const R__ errorChange,
+                            double *const R__ advance,
+                            double *const R__ prevError,
+                            const double *const R__ phase,
+                            const double *const R__ prevPhase,
+                            const double omegaScale,
+                            const double fftSize,
+                            const double increment,
+                            const double outputIncrement,
+                            const int count)
+{
+    v_phase_advance_simd(errorChange, advance, prevError, phase, prevPhase,
+                         omegaScale, fftSize, increment, outputIncrement,
+                         count);
+}
+#endif
+
 }
 
 #endif
@@ -85,12 +85,13 @@ system_get_platform_tag()
 #endif /* !_WIN32 */
 }
 
-bool
-system_is_multiprocessor()
+int
+system_get_processor_count()
 {
-    static bool tested = false, mp = false;
+    static bool tested = false;
+    static int ncpu = 1;
 
-    if (tested) return mp;
+    if (tested) return ncpu;
     int count = 0;
 
 #ifdef _WIN32
@@ -105,9 +106,6 @@ system_is_multiprocessor()
     size_t sz = sizeof(count);
     if (sysctlbyname("hw.ncpu", &count, &sz, NULL, 0)) {
         count = 0;
-        mp = false;
-    } else {
-        mp = (count > 1);
     }
 
 #else /* !__APPLE__, !_WIN32 */
@@ -120,7 +118,6 @@ system_is_multiprocessor()
         if (status == P_ONLINE) {
             ++count;
         }
-        if (count > 1) break;
     }
 
 #else /* !__sun, !__APPLE__, !_WIN32 */
@@ -128,7 +125,7 @@ system_is_multiprocessor()
     //...
 
     FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
-    if (!cpuinfo) return false;
+    if (!cpuinfo) return 1;
 
     char buf[256];
     while (!feof(cpuinfo)) {
@@ -136,7 +133,6 @@ system_is_multiprocessor()
         if (!strncmp(buf, "processor", 9)) {
             ++count;
         }
-        if (count > 1) break;
     }
 
     fclose(cpuinfo);
@@ -145,9 +141,15 @@ system_is_multiprocessor()
 #endif /* !__APPLE__, !_WIN32 */
 #endif /* !_WIN32 */
 
-    mp = (count > 1);
+    if (count > 0) ncpu = count;
     tested = true;
-    return mp;
+    return ncpu;
+}
+
+bool
+system_is_multiprocessor()
+{
+    return system_get_processor_count() > 1;
 }
 
 #ifdef _WIN32
@@ -75,6 +75,7 @@ namespace RubberBand {
 
 extern const char *system_get_platform_tag();
 extern bool system_is_multiprocessor();
+extern int system_get_processor_count();
 extern void system_specific_initialise();
 extern void system_specific_application_initialise();
 
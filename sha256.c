@@ -13,10 +13,50 @@
 *********************************************************************/
 
 /*************************** HEADER FILES ***************************/
+#if !defined(SHA256_NO_SCAN) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L   // for lstat, which -std=c99 leaves undeclared otherwise
+#endif
 #include <stdlib.h>
 #include <memory.h>
 #include "sha256.h"
 
+// sha256_file and sha256_scan map files into memory and hash them on a
+// pool of threads. Define SHA256_NO_SCAN to leave them out.
+#if !defined(SHA256_NO_SCAN)
+#include <string.h>
+#if !defined(_WIN32)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#endif
+
+// The SHA extension and AVX2 backends are compiled on x86 with GCC, Clang
+// or MSVC and picked at run time from what cpu_features() reports. The
+// ARMv8 backend is compiled when the compiler targets the crypto
+// extension, or for MSVC on ARM64, where it is also checked for at run
+// time. Define SHA256_NO_SIMD to build only the portable code.
+#if !defined(SHA256_NO_SIMD)
+#include "cpu_features.h"
+#if (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)) && \
+	(defined(_MSC_VER) || (defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))))
+#define SHA256_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define SHA256_TARGET(t)
+#else
+#define SHA256_TARGET(t) __attribute__((target(t)))
+#endif
+#elif defined(_M_ARM64) || (defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)))
+#define SHA256_ARMV8
+#include <arm_neon.h>
+#endif
+#endif
+
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
@@ -41,45 +81,278 @@ static const DWORD k[64] = {
 };
 
 /*********************** FUNCTION DEFINITIONS ***********************/
-void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+typedef void (*sha256_blocks_fn)(DWORD state[8], const BYTE data[], size_t blocks);
+
+static void sha256_blocks_c(DWORD state[8], const BYTE data[], size_t blocks)
 {
 	DWORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-	a = ctx->state[0];
-	b = ctx->state[1];
-	c = ctx->state[2];
-	d = ctx->state[3];
-	e = ctx->state[4];
-	f = ctx->state[5];
-	g = ctx->state[6];
-	h = ctx->state[7];
-
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
-	}
-
-	ctx->state[0] += a;
-	ctx->state[1] += b;
-	ctx->state[2] += c;
-	ctx->state[3] += d;
-	ctx->state[4] += e;
-	ctx->state[5] += f;
-	ctx->state[6] += g;
-	ctx->state[7] += h;
+	for ( ; blocks; --blocks, data += 64) {
+		for (i = 0, j = 0; i < 16; ++i, j += 4)
+			m[i] = ((DWORD)data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+		for ( ; i < 64; ++i)
+			m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; ++i) {
+			t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
+			t2 = EP0(a) + MAJ(a,b,c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	}
+}
+
+#ifdef SHA256_X86
+// Intel SHA extensions. The state is kept as ABEF and CDGH, the order
+// sha256rnds2 works on, and each pass of the loop does four rounds while
+// the message schedule for four rounds later is worked out.
+SHA256_TARGET("sha,sse4.1")
+static void sha256_blocks_shani(DWORD state[8], const BYTE data[], size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, abef, cdgh, msg, tmp, m0, m1, m2, m3, m4;
+	int i;
+
+	tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+	state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xb1);             // CDAB
+	state1 = _mm_shuffle_epi32(state1, 0x1b);       // EFGH
+	state0 = _mm_alignr_epi8(tmp, state1, 8);       // ABEF
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);    // CDGH
+
+	for ( ; blocks; --blocks, data += 64) {
+		abef = state0;
+		cdgh = state1;
+		m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), mask);
+		m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+		m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+		m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+
+		for (i = 0; i < 16; ++i) {
+			msg = _mm_add_epi32(m0, _mm_loadu_si128((const __m128i *)&k[i * 4]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0e);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+			m4 = _mm_add_epi32(_mm_sha256msg1_epu32(m0, m1), _mm_alignr_epi8(m3, m2, 4));
+			m4 = _mm_sha256msg2_epu32(m4, m3);
+			m0 = m1;
+			m1 = m2;
+			m2 = m3;
+			m3 = m4;
+		}
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1b);          // FEBA
+	state1 = _mm_shuffle_epi32(state1, 0xb1);       // DCHG
+	state0 = _mm_blend_epi16(tmp, state1, 0xf0);    // DCBA
+	state1 = _mm_alignr_epi8(state1, tmp, 8);       // HGFE
+	_mm_storeu_si128((__m128i *)&state[0], state0);
+	_mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+// Eight independent messages at once, one in each 32-bit lane.
+#define SHA256_ROTR8(x,n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+#define SHA256_CH8(x,y,z) _mm256_xor_si256(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z))
+#define SHA256_MAJ8(x,y,z) _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(z, _mm256_or_si256(x, y)))
+#define SHA256_EP08(x) _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR8(x, 2), SHA256_ROTR8(x, 13)), SHA256_ROTR8(x, 22))
+#define SHA256_EP18(x) _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR8(x, 6), SHA256_ROTR8(x, 11)), SHA256_ROTR8(x, 25))
+#define SHA256_SIG08(x) _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR8(x, 7), SHA256_ROTR8(x, 18)), _mm256_srli_epi32(x, 3))
+#define SHA256_SIG18(x) _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR8(x, 17), SHA256_ROTR8(x, 19)), _mm256_srli_epi32(x, 10))
+
+// Loads 32 bytes from each of the eight messages and transposes them, so
+// that w[i] holds big endian word i of every message.
+SHA256_TARGET("avx2")
+static void sha256_load8(__m256i w[8], const BYTE *const data[8], size_t offset)
+{
+	const __m256i mask = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+		0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m256i t0, t1, t2, t3, t4, t5, t6, t7, u0, u1, u2, u3, u4, u5, u6, u7;
+
+	t0 = _mm256_loadu_si256((const __m256i *)(data[0] + offset));
+	t1 = _mm256_loadu_si256((const __m256i *)(data[1] + offset));
+	t2 = _mm256_loadu_si256((const __m256i *)(data[2] + offset));
+	t3 = _mm256_loadu_si256((const __m256i *)(data[3] + offset));
+	t4 = _mm256_loadu_si256((const __m256i *)(data[4] + offset));
+	t5 = _mm256_loadu_si256((const __m256i *)(data[5] + offset));
+	t6 = _mm256_loadu_si256((const __m256i *)(data[6] + offset));
+	t7 = _mm256_loadu_si256((const __m256i *)(data[7] + offset));
+
+	u0 = _mm256_unpacklo_epi32(t0, t1);
+	u1 = _mm256_unpackhi_epi32(t0, t1);
+	u2 = _mm256_unpacklo_epi32(t2, t3);
+	u3 = _mm256_unpackhi_epi32(t2, t3);
+	u4 = _mm256_unpacklo_epi32(t4, t5);
+	u5 = _mm256_unpackhi_epi32(t4, t5);
+	u6 = _mm256_unpacklo_epi32(t6, t7);
+	u7 = _mm256_unpackhi_epi32(t6, t7);
+
+	t0 = _mm256_unpacklo_epi64(u0, u2);
+	t1 = _mm256_unpackhi_epi64(u0, u2);
+	t2 = _mm256_unpacklo_epi64(u1, u3);
+	t3 = _mm256_unpackhi_epi64(u1, u3);
+	t4 = _mm256_unpacklo_epi64(u4, u6);
+	t5 = _mm256_unpackhi_epi64(u4, u6);
+	t6 = _mm256_unpacklo_epi64(u5, u7);
+	t7 = _mm256_unpackhi_epi64(u5, u7);
+
+	w[0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t4, 0x20), mask);
+	w[1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t5, 0x20), mask);
+	w[2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t2, t6, 0x20), mask);
+	w[3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t3, t7, 0x20), mask);
+	w[4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t4, 0x31), mask);
+	w[5] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t5, 0x31), mask);
+	w[6] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t2, t6, 0x31), mask);
+	w[7] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t3, t7, 0x31), mask);
+}
+
+SHA256_TARGET("avx2")
+static void sha256_blocks_avx2_x8(SHA256_CTX *const ctx[8], const BYTE *const data[8], size_t blocks)
+{
+	__m256i s[8], v[8], w[16], t1, t2;
+	DWORD lanes[8][8];
+	size_t offset;
+	int i, j;
+
+	for (i = 0; i < 8; ++i)
+		s[i] = _mm256_set_epi32(ctx[7]->state[i], ctx[6]->state[i], ctx[5]->state[i], ctx[4]->state[i],
+			ctx[3]->state[i], ctx[2]->state[i], ctx[1]->state[i], ctx[0]->state[i]);
+
+	for (offset = 0; blocks; --blocks, offset += 64) {
+		sha256_load8(w, data, offset);
+		sha256_load8(w + 8, data, offset + 32);
+		for (i = 0; i < 8; ++i)
+			v[i] = s[i];
+
+		for (i = 0; i < 64; ++i) {
+			if (i >= 16)
+				w[i & 15] = _mm256_add_epi32(_mm256_add_epi32(SHA256_SIG18(w[(i - 2) & 15]), w[(i - 7) & 15]),
+					_mm256_add_epi32(SHA256_SIG08(w[(i - 15) & 15]), w[i & 15]));
+			t1 = _mm256_add_epi32(_mm256_add_epi32(v[7], SHA256_EP18(v[4])),
+				_mm256_add_epi32(SHA256_CH8(v[4], v[5], v[6]), _mm256_add_epi32(_mm256_set1_epi32(k[i]), w[i & 15])));
+			t2 = _mm256_add_epi32(SHA256_EP08(v[0]), SHA256_MAJ8(v[0], v[1], v[2]));
+			v[7] = v[6];
+			v[6] = v[5];
+			v[5] = v[4];
+			v[4] = _mm256_add_epi32(v[3], t1);
+			v[3] = v[2];
+			v[2] = v[1];
+			v[1] = v[0];
+			v[0] = _mm256_add_epi32(t1, t2);
+		}
+
+		for (i = 0; i < 8; ++i)
+			s[i] = _mm256_add_epi32(s[i], v[i]);
+	}
+
+	for (i = 0; i < 8; ++i)
+		_mm256_storeu_si256((__m256i *)lanes[i], s[i]);
+	for (i = 0; i < 8; ++i)
+		for (j = 0; j < 8; ++j)
+			ctx[j]->state[i] = lanes[i][j];
+}
+#endif   // SHA256_X86
+
+#ifdef SHA256_ARMV8
+// ARMv8 crypto extension, with the state kept as ABCD and EFGH.
+static void sha256_blocks_armv8(DWORD state[8], const BYTE data[], size_t blocks)
+{
+	uint32x4_t state0, state1, abcd, efgh, msg, tmp, m0, m1, m2, m3, m4;
+	int i;
+
+	state0 = vld1q_u32((const uint32_t *)&state[0]);
+	state1 = vld1q_u32((const uint32_t *)&state[4]);
+
+	for ( ; blocks; --blocks, data += 64) {
+		abcd = state0;
+		efgh = state1;
+		m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+		m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+		m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+		m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+		for (i = 0; i < 16; ++i) {
+			msg = vaddq_u32(m0, vld1q_u32((const uint32_t *)&k[i * 4]));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, msg);
+			state1 = vsha256h2q_u32(state1, tmp, msg);
+
+			m4 = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3);
+			m0 = m1;
+			m1 = m2;
+			m2 = m3;
+			m3 = m4;
+		}
+
+		state0 = vaddq_u32(state0, abcd);
+		state1 = vaddq_u32(state1, efgh);
+	}
+
+	vst1q_u32((uint32_t *)&state[0], state0);
+	vst1q_u32((uint32_t *)&state[4], state1);
+}
+#endif   // SHA256_ARMV8
+
+// Chosen on first use. Threads racing to set these all store the same value.
+static sha256_blocks_fn sha256_blocks;
+static int sha256_avx2_x8;
+
+#if !defined(SHA256_NO_SIMD)
+static const cpu_kernel sha256_kernels[] = {
+#if defined(SHA256_X86)
+	{ "shani", CPU_FEATURE_SHA | CPU_FEATURE_SSSE3 | CPU_FEATURE_SSE41, (cpu_func)sha256_blocks_shani },
+#elif defined(SHA256_ARMV8)
+	{ "armv8", CPU_FEATURE_SHA, (cpu_func)sha256_blocks_armv8 },
+#endif
+	{ "c", 0, (cpu_func)sha256_blocks_c }
+};
+#endif
+
+static sha256_blocks_fn sha256_select(void)
+{
+	sha256_blocks_fn blocks = sha256_blocks_c;
+#if !defined(SHA256_NO_SIMD)
+	blocks = (sha256_blocks_fn)cpu_select(sha256_kernels,
+		sizeof(sha256_kernels) / sizeof(sha256_kernels[0]))->func;
+#endif
+#if defined(SHA256_X86)
+	// the SHA extensions hash one message faster than AVX2 hashes eight
+	sha256_avx2_x8 = blocks == sha256_blocks_c && cpu_has(CPU_FEATURE_AVX2);
+#endif
+	sha256_blocks = blocks;
+	return blocks;
+}
+
+void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+{
+	(sha256_blocks ? sha256_blocks : sha256_select())(ctx->state, data, 1);
 }
 
 void sha256_init(SHA256_CTX *ctx)
@@ -98,22 +371,92 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	sha256_blocks_fn blocks = sha256_blocks ? sha256_blocks : sha256_select();
+	size_t n;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
-		if (ctx->datalen == 64) {
-			sha256_transform(ctx, ctx->data);
-			ctx->bitlen += 512;
-			ctx->datalen = 0;
+	// Top up a partly filled block first, then hash whole blocks straight
+	// from the input and keep what is left over for next time.
+	if (ctx->datalen) {
+		n = 64 - ctx->datalen;
+		if (n > len)
+			n = len;
+		memcpy(ctx->data + ctx->datalen, data, n);
+		ctx->datalen += (DWORD)n;
+		data += n;
+		len -= n;
+		if (ctx->datalen < 64)
+			return;
+		blocks(ctx->state, ctx->data, 1);
+		ctx->bitlen += 512;
+		ctx->datalen = 0;
+	}
+
+	n = len / 64;
+	if (n) {
+		blocks(ctx->state, data, n);
+		ctx->bitlen += 512 * (unsigned long long)n;
+		data += n * 64;
+		len -= n * 64;
+	}
+
+	memcpy(ctx->data, data, len);
+	ctx->datalen = (DWORD)len;
+}
+
+void sha256_update8(SHA256_CTX *const ctx[8], const BYTE *const data[8], size_t len)
+{
+	const BYTE *lane[8];
+	size_t left[8], blocks;
+	int i;
+
+	if (!sha256_blocks)
+		sha256_select();
+	if (!sha256_avx2_x8) {
+		for (i = 0; i < 8; ++i)
+			sha256_update(ctx[i], data[i], len);
+		return;
+	}
+
+#ifdef SHA256_X86
+	// Bring every context to a block boundary, hash as many blocks as all
+	// eight have together, then the rest of each one on its own.
+	blocks = len / 64;
+	for (i = 0; i < 8; ++i) {
+		lane[i] = data[i];
+		left[i] = len;
+		if (ctx[i]->datalen) {
+			size_t n = 64 - ctx[i]->datalen;
+			if (n > len)
+				n = len;
+			sha256_update(ctx[i], data[i], n);
+			lane[i] += n;
+			left[i] -= n;
 		}
+		if (left[i] / 64 < blocks)
+			blocks = left[i] / 64;
 	}
+
+	if (blocks) {
+		sha256_blocks_avx2_x8(ctx, lane, blocks);
+		for (i = 0; i < 8; ++i) {
+			ctx[i]->bitlen += 512 * (unsigned long long)blocks;
+			lane[i] += blocks * 64;
+			left[i] -= blocks * 64;
+		}
+	}
+
+	for (i = 0; i < 8; ++i)
+		sha256_update(ctx[i], lane[i], left[i]);
+#else
+	(void)lane;
+	(void)left;
+	(void)blocks;
+#endif
 }
 
 void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 {
-	WORD i;
+	DWORD i;
 
 	i = ctx->datalen;
 
@@ -156,3 +499,434 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 		hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+#ifndef SHA256_NO_SCAN
+/*************************** FILE HASHING ***************************/
+// CRC-32 as used by zlib and the ROM databases, eight bytes at a time.
+static DWORD crc32_table[8][256];
+static volatile int crc32_table_ready;
+
+static void crc32_init(void)
+{
+	DWORD c;
+	int i, j;
+
+	if (crc32_table_ready)
+		return;
+	for (i = 0; i < 256; ++i) {
+		c = i;
+		for (j = 0; j < 8; ++j)
+			c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+		crc32_table[0][i] = c;
+	}
+	for (i = 0; i < 256; ++i)
+		for (j = 1; j < 8; ++j)
+			crc32_table[j][i] = crc32_table[0][crc32_table[j - 1][i] & 0xff] ^ (crc32_table[j - 1][i] >> 8);
+	crc32_table_ready = 1;
+}
+
+static DWORD crc32_update(DWORD crc, const BYTE *p, size_t len)
+{
+	DWORD lo, hi;
+
+	crc = ~crc;
+	for ( ; len >= 8; len -= 8, p += 8) {
+		lo = crc ^ (p[0] | (p[1] << 8) | (p[2] << 16) | ((DWORD)p[3] << 24));
+		hi = p[4] | (p[5] << 8) | (p[6] << 16) | ((DWORD)p[7] << 24);
+		crc = crc32_table[7][lo & 0xff] ^ crc32_table[6][(lo >> 8) & 0xff] ^
+			crc32_table[5][(lo >> 16) & 0xff] ^ crc32_table[4][lo >> 24] ^
+			crc32_table[3][hi & 0xff] ^ crc32_table[2][(hi >> 8) & 0xff] ^
+			crc32_table[1][(hi >> 16) & 0xff] ^ crc32_table[0][hi >> 24];
+	}
+	for ( ; len; --len, ++p)
+		crc = crc32_table[0][(crc ^ *p) & 0xff] ^ (crc >> 8);
+	return ~crc;
+}
+
+// Files are mapped a window at a time, so large ones fit in a 32-bit
+// address space, and hashed in chunks small enough to still be in the
+// cache when the CRC goes over them.
+#define SHA256_MAP_WINDOW (64 << 20)
+#define SHA256_HASH_CHUNK (64 << 10)
+
+static void sha256_crc32_update(SHA256_CTX *ctx, DWORD *crc, const BYTE *p, size_t len)
+{
+	size_t n;
+
+	for ( ; len; p += n, len -= n) {
+		n = len < SHA256_HASH_CHUNK ? len : SHA256_HASH_CHUNK;
+		sha256_update(ctx, p, n);
+		*crc = crc32_update(*crc, p, n);
+	}
+}
+
+int sha256_file(const char *path, BYTE hash[], DWORD *crc32, unsigned long long *size)
+{
+	SHA256_CTX ctx;
+	DWORD crc = 0;
+	unsigned long long length, offset;
+	size_t n;
+	int error = 0;
+#if defined(_WIN32)
+	HANDLE file, mapping = NULL;
+	LARGE_INTEGER file_size;
+	const BYTE *view;
+#else
+	int fd;
+	struct stat st;
+	void *view;
+#endif
+
+	crc32_init();
+	sha256_init(&ctx);
+
+#if defined(_WIN32)
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return (int)GetLastError();
+	if (!GetFileSizeEx(file, &file_size)) {
+		error = (int)GetLastError();
+		CloseHandle(file);
+		return error;
+	}
+	length = (unsigned long long)file_size.QuadPart;
+	if (length) {
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!mapping)
+			error = (int)GetLastError();
+	}
+	for (offset = 0; !error && offset < length; offset += n) {
+		n = length - offset < SHA256_MAP_WINDOW ? (size_t)(length - offset) : SHA256_MAP_WINDOW;
+		view = (const BYTE *)MapViewOfFile(mapping, FILE_MAP_READ, (DWORD)(offset >> 32), (DWORD)offset, n);
+		if (!view) {
+			error = (int)GetLastError();
+			break;
+		}
+		sha256_crc32_update(&ctx, &crc, view, n);
+		UnmapViewOfFile(view);
+	}
+	if (mapping)
+		CloseHandle(mapping);
+	CloseHandle(file);
+#else
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return errno;
+	if (fstat(fd, &st) != 0) {
+		error = errno;
+		close(fd);
+		return error;
+	}
+	length = (unsigned long long)st.st_size;
+	for (offset = 0; offset < length; offset += n) {
+		n = length - offset < SHA256_MAP_WINDOW ? (size_t)(length - offset) : SHA256_MAP_WINDOW;
+		view = mmap(NULL, n, PROT_READ, MAP_PRIVATE, fd, (off_t)offset);
+		if (view == MAP_FAILED) {
+			error = errno;
+			break;
+		}
+#ifdef POSIX_MADV_SEQUENTIAL
+		posix_madvise(view, n, POSIX_MADV_SEQUENTIAL);
+#endif
+		sha256_crc32_update(&ctx, &crc, (const BYTE *)view, n);
+		munmap(view, n);
+	}
+	close(fd);
+#endif
+
+	if (error)
+		return error;
+	sha256_final(&ctx, hash);
+	if (crc32)
+		*crc32 = crc;
+	if (size)
+		*size = length;
+	return 0;
+}
+
+/*************************** TREE SCANNING **************************/
+#if defined(_WIN32)
+#define SHA256_PATH_SEPARATOR '\\'
+typedef HANDLE sha256_thread;
+#define sha256_lock(s) EnterCriticalSection(&(s)->lock)
+#define sha256_unlock(s) LeaveCriticalSection(&(s)->lock)
+#define sha256_wait(s,c) SleepConditionVariableCS(&(s)->c, &(s)->lock, INFINITE)
+#define sha256_signal(s,c) WakeConditionVariable(&(s)->c)
+#define sha256_broadcast(s,c) WakeAllConditionVariable(&(s)->c)
+#else
+#define SHA256_PATH_SEPARATOR '/'
+typedef pthread_t sha256_thread;
+#define sha256_lock(s) pthread_mutex_lock(&(s)->lock)
+#define sha256_unlock(s) pthread_mutex_unlock(&(s)->lock)
+#define sha256_wait(s,c) pthread_cond_wait(&(s)->c, &(s)->lock)
+#define sha256_signal(s,c) pthread_cond_signal(&(s)->c)
+#define sha256_broadcast(s,c) pthread_cond_broadcast(&(s)->c)
+#endif
+
+// The walking thread queues up paths for the workers, waiting when the
+// queue is full so a huge tree doesn't get ahead of the disk.
+typedef struct {
+	char **queue;
+	int capacity;
+	int head;
+	int count;
+	int finished;   // no more paths coming
+	int threads;
+	sha256_scan_callback callback;
+	void *user;
+#if defined(_WIN32)
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE queued;
+	CONDITION_VARIABLE taken;
+	CRITICAL_SECTION report;
+#else
+	pthread_mutex_t lock;
+	pthread_cond_t queued;
+	pthread_cond_t taken;
+	pthread_mutex_t report;
+#endif
+} SHA256_SCAN;
+
+static void sha256_scan_file(SHA256_SCAN *scan, char *path)
+{
+	SHA256_SCAN_RESULT result;
+
+	memset(&result, 0, sizeof(result));
+	result.path = path;
+	result.error = sha256_file(path, result.sha256, &result.crc32, &result.size);
+	if (scan->threads) {
+#if defined(_WIN32)
+		EnterCriticalSection(&scan->report);
+		scan->callback(scan->user, &result);
+		LeaveCriticalSection(&scan->report);
+#else
+		pthread_mutex_lock(&scan->report);
+		scan->callback(scan->user, &result);
+		pthread_mutex_unlock(&scan->report);
+#endif
+	}
+	else {
+		scan->callback(scan->user, &result);
+	}
+	free(path);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI sha256_scan_worker(LPVOID data)
+#else
+static void *sha256_scan_worker(void *data)
+#endif
+{
+	SHA256_SCAN *scan = (SHA256_SCAN *)data;
+	char *path;
+
+	for (;;) {
+		sha256_lock(scan);
+		while (!scan->count && !scan->finished)
+			sha256_wait(scan, queued);
+		if (!scan->count) {
+			sha256_unlock(scan);
+			break;
+		}
+		path = scan->queue[scan->head];
+		scan->head = (scan->head + 1) % scan->capacity;
+		--scan->count;
+		sha256_signal(scan, taken);
+		sha256_unlock(scan);
+
+		sha256_scan_file(scan, path);
+	}
+	return 0;
+}
+
+// Takes ownership of path.
+static void sha256_scan_push(SHA256_SCAN *scan, char *path)
+{
+	if (!scan->threads) {
+		sha256_scan_file(scan, path);
+		return;
+	}
+	sha256_lock(scan);
+	while (scan->count == scan->capacity)
+		sha256_wait(scan, taken);
+	scan->queue[(scan->head + scan->count) % scan->capacity] = path;
+	++scan->count;
+	sha256_signal(scan, queued);
+	sha256_unlock(scan);
+}
+
+static char *sha256_join(const char *dir, const char *name)
+{
+	size_t dir_len = strlen(dir), name_len = strlen(name);
+	char *path = (char *)malloc(dir_len + name_len + 2);
+
+	if (path) {
+		memcpy(path, dir, dir_len);
+		if (dir_len && dir[dir_len - 1] != SHA256_PATH_SEPARATOR && dir[dir_len - 1] != '/')
+			path[dir_len++] = SHA256_PATH_SEPARATOR;
+		memcpy(path + dir_len, name, name_len + 1);
+	}
+	return path;
+}
+
+// Returns the number of files found, or -1 if dir couldn't be read.
+static int sha256_scan_dir(SHA256_SCAN *scan, const char *dir)
+{
+	int files = 0, n;
+	char *path;
+#if defined(_WIN32)
+	WIN32_FIND_DATAA find;
+	HANDLE handle;
+
+	path = sha256_join(dir, "*");
+	if (!path)
+		return -1;
+	handle = FindFirstFileA(path, &find);
+	free(path);
+	if (handle == INVALID_HANDLE_VALUE)
+		return -1;
+	do {
+		if (!strcmp(find.cFileName, ".") || !strcmp(find.cFileName, ".."))
+			continue;
+		path = sha256_join(dir, find.cFileName);
+		if (!path)
+			continue;
+		if (find.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			// junctions and directory links could lead round in circles
+			if (!(find.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) && (n = sha256_scan_dir(scan, path)) > 0)
+				files += n;
+			free(path);
+		}
+		else {
+			sha256_scan_push(scan, path);
+			++files;
+		}
+	} while (FindNextFileA(handle, &find));
+	FindClose(handle);
+#else
+	DIR *d;
+	struct dirent *entry;
+	struct stat st;
+
+	d = opendir(dir);
+	if (!d)
+		return -1;
+	while ((entry = readdir(d)) != NULL) {
+		if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+			continue;
+		path = sha256_join(dir, entry->d_name);
+		if (!path)
+			continue;
+		// symbolic links are followed to files but not to directories,
+		// which could lead round in circles
+		if (lstat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+			if ((n = sha256_scan_dir(scan, path)) > 0)
+				files += n;
+			free(path);
+		}
+		else if (stat(path, &st) == 0 && S_ISREG(st.st_mode)) {
+			sha256_scan_push(scan, path);
+			++files;
+		}
+		else {
+			free(path);
+		}
+	}
+	closedir(d);
+#endif
+	return files;
+}
+
+static int sha256_cpu_count(void)
+{
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#else
+	return 1;
+#endif
+}
+
+int sha256_scan(const char *root, int threads, sha256_scan_callback callback, void *user)
+{
+	SHA256_SCAN scan;
+	sha256_thread *workers = NULL;
+	int files, started = 0, i;
+
+	if (threads <= 0)
+		threads = sha256_cpu_count();
+
+	crc32_init();
+	if (!sha256_blocks)
+		sha256_select();
+
+	memset(&scan, 0, sizeof(scan));
+	scan.callback = callback;
+	scan.user = user;
+	scan.capacity = threads * 4;
+	scan.queue = (char **)malloc(scan.capacity * sizeof(char *));
+	if (threads > 1)
+		workers = (sha256_thread *)malloc(threads * sizeof(sha256_thread));
+
+	// with one thread, or if none can be started, the files are hashed
+	// as they are found
+	if (scan.queue && workers) {
+#if defined(_WIN32)
+		InitializeCriticalSection(&scan.lock);
+		InitializeCriticalSection(&scan.report);
+		InitializeConditionVariable(&scan.queued);
+		InitializeConditionVariable(&scan.taken);
+		for (started = 0; started < threads; ++started)
+			if ((workers[started] = CreateThread(NULL, 0, sha256_scan_worker, &scan, 0, NULL)) == NULL)
+				break;
+#else
+		pthread_mutex_init(&scan.lock, NULL);
+		pthread_mutex_init(&scan.report, NULL);
+		pthread_cond_init(&scan.queued, NULL);
+		pthread_cond_init(&scan.taken, NULL);
+		for (started = 0; started < threads; ++started)
+			if (pthread_create(&workers[started], NULL, sha256_scan_worker, &scan) != 0)
+				break;
+#endif
+	}
+	// the workers only look at this once they have something to do
+	scan.threads = started;
+
+	files = sha256_scan_dir(&scan, root);
+
+	if (workers) {
+		if (started) {
+			sha256_lock(&scan);
+			scan.finished = 1;
+			sha256_broadcast(&scan, queued);
+			sha256_unlock(&scan);
+		}
+		for (i = 0; i < started; ++i) {
+#if defined(_WIN32)
+			WaitForSingleObject(workers[i], INFINITE);
+			CloseHandle(workers[i]);
+#else
+			pthread_join(workers[i], NULL);
+#endif
+		}
+		if (scan.queue) {
+#if defined(_WIN32)
+			DeleteCriticalSection(&scan.lock);
+			DeleteCriticalSection(&scan.report);
+#else
+			pthread_cond_destroy(&scan.taken);
+			pthread_cond_destroy(&scan.queued);
+			pthread_mutex_destroy(&scan.report);
+			pthread_mutex_destroy(&scan.lock);
+#endif
+		}
+		free(workers);
+	}
+	free(scan.queue);
+	return files;
+}
+#endif   // SHA256_NO_SCAN
@@ -11,7 +11,13 @@
 
 /*************************** HEADER FILES ***************************/
 #include <stddef.h>
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <stdint.h>
+typedef uint8_t BYTE;             // 8-bit byte
+typedef uint32_t DWORD;           // 32-bit word, as on Windows
+#endif
 /****************************** MACROS ******************************/
 #define SHA256_BLOCK_SIZE 32            // SHA256 outputs a 32 byte digest
 
@@ -24,6 +30,18 @@ typedef struct {
 	DWORD state[8];
 } SHA256_CTX;
 
+#ifndef SHA256_NO_SCAN
+typedef struct {
+	const char *path;               // only valid during the callback
+	unsigned long long size;
+	BYTE sha256[SHA256_BLOCK_SIZE];
+	DWORD crc32;
+	int error;                      // 0, or the OS error that stopped the file being read
+} SHA256_SCAN_RESULT;
+
+typedef void (*sha256_scan_callback)(void *user, const SHA256_SCAN_RESULT *result);
+#endif
+
 /*********************** FUNCTION DECLARATIONS **********************/
 #ifdef __cplusplus
 extern "C" {
@@ -31,6 +49,27 @@ extern "C" {
 	void sha256_init(SHA256_CTX *ctx);
 	void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len);
 	void sha256_final(SHA256_CTX *ctx, BYTE hash[]);
+
+	// Updates eight contexts at once with len bytes each, which uses AVX2 to
+	// hash the eight messages in parallel on CPUs that have it but not the
+	// SHA extensions. The contexts must be distinct.
+	void sha256_update8(SHA256_CTX *const ctx[8], const BYTE *const data[8], size_t len);
+
+#ifndef SHA256_NO_SCAN
+	// Hashes a file with SHA-256 and the zlib CRC-32 in a single pass over a
+	// memory mapping of it. Returns 0 on success, or the OS error code
+	// (GetLastError or errno). crc32 and size may be NULL.
+	int sha256_file(const char *path, BYTE hash[], DWORD *crc32, unsigned long long *size);
+
+	// Walks the directory tree under root and hashes every file in it as
+	// sha256_file does, on threads worker threads (one per CPU if threads is 0
+	// or less) while the calling thread goes on walking. The callback is
+	// called once per file from whichever thread hashed it, but never from
+	// two threads at once, so results can go straight into a database.
+	// Symbolic links and junctions to directories are not followed. Returns
+	// the number of files found, or -1 if root can't be read.
+	int sha256_scan(const char *root, int threads, sha256_scan_callback callback, void *user);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,39 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/*
+    BACKENDS
+    ========
+
+    - Windows: WASAPI
+    - macOS, iOS: CoreAudio (AudioUnit), link with AudioToolbox.framework
+      (and CoreAudio.framework on macOS)
+    - Linux: ALSA, link with -lasound -lpthread, or PipeWire when
+      SOKOL_AUDIO_PIPEWIRE is defined, link with libpipewire-0.3
+    - SOKOL_DUMMY_BACKEND: no audio output
+
+    The ALSA, PipeWire and CoreAudio backends open the device at its own
+    rate and period where they can, so the OS mixer doesn't resample;
+    the requested sample rate is only a hint there, so query
+    saudio_sample_rate() after saudio_setup() for the rate the stream
+    callback and saudio_push() actually run at.
+
+    STREAMS
+    =======
+
+    Besides the main stream set up by saudio_setup(), any number (up to
+    SAUDIO_MAX_STREAMS) of extra streams can be added with
+    saudio_make_stream(), each with its own sample rate, channel count
+    and volume, fed by its own callback or by saudio_stream_push(). The
+    audio thread mixes them into the device buffer after the main
+    stream. A stream at a different rate than the device is resampled
+    with resampler.h, which needs SOKOL_AUDIO_RESAMPLER defined before
+    the implementation is included (and RESAMPLER_IMPLEMENTATION in
+    one translation unit), otherwise only the device rate is accepted.
+    Streams are made and destroyed on the main thread, never in a
+    stream callback.
+*/
+
 #if defined(SOKOL_API_DECL) && !defined(SOKOL_AUDIO_API_DECL)
 #define SOKOL_AUDIO_API_DECL SOKOL_API_DECL
 #endif
@@ -60,27 +93,74 @@
 extern "C" {
 #endif
 
+/* return type of the stream callbacks, the number of bytes written,
+   the rest of the buffer is filled with silence (same type as DWORD on Windows) */
+#if defined(_WIN32)
+typedef unsigned long saudio_dword;
+#else
+typedef uint32_t saudio_dword;
+#endif
+
 typedef struct saudio_desc {
     int sample_rate;        /* requested sample rate */
     int num_channels;       /* number of channels, default: 1 (mono) */
     int buffer_frames;      /* number of frames in streaming buffer */
     int packet_frames;      /* number of frames in a packet */
     int num_packets;        /* number of packets in packet queue */
-    DWORD (*stream_cb)(float* buffer, int num_frames, int num_channels);  /* optional streaming callback (no user data) */
-    DWORD (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data); /*... and with user data */
+    saudio_dword (*stream_cb)(float* buffer, int num_frames, int num_channels);  /* optional streaming callback (no user data) */
+    saudio_dword (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data); /*... and with user data */
     void* user_data;        /* optional user data argument for stream_userdata_cb */
+    bool exclusive;         /* WASAPI: open the device in exclusive mode, falls back to shared mode if the format isn't supported */
+    bool low_latency;       /* WASAPI: in shared mode, use the audio engine's minimum period (IAudioClient3) when the requested format matches the device's */
 } saudio_desc;
 
 /* setup sokol-audio */
 SOKOL_AUDIO_API_DECL void saudio_setup(const saudio_desc* desc);
 /* shutdown sokol-audio */
 SOKOL_AUDIO_API_DECL void saudio_shutdown(void);
+/* push interleaved frames when no stream callback is set, returns the number of frames actually pushed (never blocks) */
+SOKOL_AUDIO_API_DECL int saudio_push(const float* frames, int num_frames);
+/* number of frames that can be pushed right now */
+SOKOL_AUDIO_API_DECL int saudio_expect(void);
+/* size of the push ring buffer in frames */
+SOKOL_AUDIO_API_DECL int saudio_ring_frames(void);
+/* number of frames pushed and not yet taken by the audio thread */
+SOKOL_AUDIO_API_DECL int saudio_ring_fill(void);
+/* frames between the next pushed frame and the speaker: ring fill, device buffer and stream latency */
+SOKOL_AUDIO_API_DECL int saudio_latency_frames(void);
+/* the actual sample rate */
+SOKOL_AUDIO_API_DECL int saudio_sample_rate(void);
+
+/* an additional stream mixed into the output, id 0 is invalid */
+typedef struct saudio_stream { uint32_t id; } saudio_stream;
+
+typedef struct saudio_stream_desc {
+    int sample_rate;        /* default: the device's sample rate */
+    int num_channels;       /* default: 1 (mono), mono is played on all output channels */
+    int buffer_frames;      /* push ring size in frames, default: 4 * the main stream's buffer */
+    float volume;           /* default: 1.0 */
+    saudio_dword (*stream_cb)(float* buffer, int num_frames, int num_channels);  /* optional, as in saudio_desc */
+    saudio_dword (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data);
+    void* user_data;
+} saudio_stream_desc;
+
+/* add a stream after saudio_setup(), returns an invalid stream on failure */
+SOKOL_AUDIO_API_DECL saudio_stream saudio_make_stream(const saudio_stream_desc* desc);
+/* remove a stream, waits for a mix pass in progress to finish */
+SOKOL_AUDIO_API_DECL void saudio_destroy_stream(saudio_stream stream);
+/* push interleaved frames at the stream's rate when it has no callback, never blocks */
+SOKOL_AUDIO_API_DECL int saudio_stream_push(saudio_stream stream, const float* frames, int num_frames);
+/* number of frames that can be pushed to the stream right now */
+SOKOL_AUDIO_API_DECL int saudio_stream_expect(saudio_stream stream);
+/* change a stream's volume, takes effect with the next mix pass */
+SOKOL_AUDIO_API_DECL void saudio_stream_set_volume(saudio_stream stream, float volume);
 
 #ifdef __cplusplus
 } /* extern "C" */
 
 /* reference-based equivalents for c++ */
 inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc); }
+inline saudio_stream saudio_make_stream(const saudio_stream_desc& desc) { return saudio_make_stream(&desc); }
 
 #endif
 #endif // SOKOL_AUDIO_INCLUDED
@@ -139,6 +219,7 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
     #endif
     #include <windows.h>
     #include <synchapi.h>
+    #include <mmreg.h>
     #if (defined(WINAPI_FAMILY_PARTITION) && !WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP))
         #define SOKOL_WIN32_NO_MMDEVICE
         #pragma comment (lib, "WindowsApp.lib")
@@ -149,6 +230,14 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
             #pragma comment (lib, "mmdevapi.lib")
         #endif
     #endif
+#elif defined(__APPLE__)
+    // CoreAudio runs the render callback on its own thread
+    #include <sched.h>
+#elif defined(__linux__) && !defined(SOKOL_AUDIO_PIPEWIRE)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(__linux__)
+    #include <sched.h>
 #endif
 
 #if defined(SOKOL_DUMMY_BACKEND)
@@ -171,6 +260,8 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
     static const IID _saudio_IID_IAudioRenderClient = { 0xf294acfc, 0x3146, 0x4483,{ 0xa7, 0xbf, 0xad, 0xdc, 0xa7, 0xc2, 0x60, 0xe2 } };
     static const IID _saudio_IID_Devinterface_Audio_Render = { 0xe6327cad, 0xdcec, 0x4949, {0xae, 0x8a, 0x99, 0x1e, 0x97, 0x6a, 0x79, 0xd2 } };
     static const IID _saudio_IID_IActivateAudioInterface_Completion_Handler = { 0x94ea2b94, 0xe9cc, 0x49e0, {0xc0, 0xff, 0xee, 0x64, 0xca, 0x8f, 0x5b, 0x90} };
+    static const IID _saudio_IID_IAudioClient3 = { 0x7ed4ee07, 0x8e67, 0x4cd4, { 0x8c, 0x1a, 0x2b, 0x7a, 0x59, 0x87, 0xad, 0x42 } };
+    static const GUID _saudio_KSDATAFORMAT_SUBTYPE_IEEE_FLOAT = { 0x00000003, 0x0000, 0x0010, { 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71 } };
     #if defined(__cplusplus)
     #define _SOKOL_AUDIO_WIN32COM_ID(x) (x)
     #else
@@ -183,6 +274,38 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
     #ifndef AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY
     #define AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY 0x08000000
     #endif
+    /* avrt.dll is loaded at runtime for MMCSS, so no import library is needed */
+    typedef HANDLE (WINAPI *_saudio_AvSetMmThreadCharacteristicsW_t)(LPCWSTR, LPDWORD);
+    typedef BOOL (WINAPI *_saudio_AvRevertMmThreadCharacteristics_t)(HANDLE);
+#elif defined(__APPLE__)
+    #include <TargetConditionals.h>
+    #include <AudioToolbox/AudioToolbox.h>
+    #if !TARGET_OS_IPHONE
+        #include <CoreAudio/CoreAudio.h>
+    #endif
+#elif defined(__linux__) && defined(SOKOL_AUDIO_PIPEWIRE)
+    #include <pipewire/pipewire.h>
+    #include <spa/param/audio/format-utils.h>
+#elif defined(__linux__)
+    #define ALSA_PCM_NEW_HW_PARAMS_API
+    #include <alsa/asoundlib.h>
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+    #define _SAUDIO_ATOMIC_GNUC (1)
+#elif defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+#if !defined(SOKOL_AUDIO_NO_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>
+        #define _SAUDIO_SSE (1)
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #include <arm_neon.h>
+        #define _SAUDIO_NEON (1)
+    #endif
+#endif
+#if defined(SOKOL_AUDIO_RESAMPLER)
+    #include "resampler.h"
 #endif
 #ifdef _MSC_VER
     #pragma warning(push)
@@ -200,16 +323,43 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
 #ifndef SAUDIO_RING_MAX_SLOTS
 #define SAUDIO_RING_MAX_SLOTS (1024)
 #endif
+#ifndef SAUDIO_MAX_STREAMS
+#define SAUDIO_MAX_STREAMS (16)
+#endif
+/* streams are rendered and mixed in blocks of at most this many device frames */
+#define _SAUDIO_MIX_BLOCK_FRAMES (256)
+
+/* single-producer/single-consumer ring of interleaved frames between
+   saudio_push() and the audio thread, read_pos and write_pos count
+   frames and only ever increase (wrapping at 2^32), so fill level is
+   write_pos - read_pos and neither side ever waits for the other */
+#if defined(_SAUDIO_ATOMIC_GNUC)
+typedef uint32_t _saudio_atomic_t;
+#else
+typedef long _saudio_atomic_t;
+#endif
 
 typedef struct {
-    CRITICAL_SECTION critsec;
-} _saudio_mutex_t;
+    float* buffer;
+    uint32_t num_frames;                /* power of two */
+    uint32_t num_channels;
+    volatile _saudio_atomic_t read_pos; /* written by the audio thread */
+    volatile _saudio_atomic_t write_pos;/* written by saudio_push() */
+} _saudio_ring_t;
 
+#if defined(SOKOL_DUMMY_BACKEND)
+
+typedef struct {
+    int dummy;
+} _saudio_backend_t;
+
+#elif defined(_WIN32)
 
 typedef struct {
     HANDLE thread_handle;
     HANDLE buffer_end_event;
     bool stop;
+    bool exclusive;             /* each event refills the whole buffer */
     UINT32 dst_buffer_frames;
 } _saudio_wasapi_thread_data_t;
 
@@ -222,13 +372,66 @@ typedef struct {
     _saudio_wasapi_thread_data_t thread;
 } _saudio_backend_t;
 
+#elif defined(__APPLE__)
+
+typedef struct {
+    AudioComponentInstance unit;
+    bool initialized;           /* AudioUnitInitialize succeeded */
+} _saudio_backend_t;
+
+#elif defined(__linux__) && defined(SOKOL_AUDIO_PIPEWIRE)
+
+typedef struct {
+    struct pw_thread_loop* loop;
+    struct pw_stream* stream;
+    struct pw_stream_events events;     /* must outlive the stream */
+    bool format_done;           /* format negotiated or stream failed */
+} _saudio_backend_t;
+
+#elif defined(__linux__)
+
+typedef struct {
+    snd_pcm_t* device;
+    float* buffer;              /* period-sized, for the non-mmap fallback only */
+    bool mmap;
+    snd_pcm_uframes_t period_frames;
+    snd_pcm_uframes_t buffer_frames;
+    pthread_t thread;
+    bool thread_valid;
+    volatile bool thread_stop;
+} _saudio_backend_t;
+
+#else
+#error "sokol_audio.h: no backend for this platform, define SOKOL_DUMMY_BACKEND"
+#endif
+
 /*=== GENERAL DECLARATIONS ===================================================*/
 
+/* an additional stream, only touched by the audio thread while active,
+   out_buf keeps what the resampler produced beyond the last mix block */
+typedef struct {
+    volatile _saudio_atomic_t active;
+    uint32_t id;                /* main thread only */
+    int sample_rate;
+    int num_channels;
+    volatile float volume;
+    saudio_dword (*stream_cb)(float* buffer, int num_frames, int num_channels);
+    saudio_dword (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data);
+    void* user_data;
+    _saudio_ring_t ring;        /* push model only */
+    void* resampler;            /* only if sample_rate isn't the device's */
+    float* in_buf;              /* frames at the stream's rate */
+    int in_frames;
+    float* out_buf;             /* frames at the device rate */
+    int out_frames;
+    int out_fill;
+} _saudio_stream_t;
+
 /* sokol-audio state */
 typedef struct {
     bool valid;
-    DWORD (*stream_cb)(float* buffer, int num_frames, int num_channels);
-    DWORD (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data);
+    saudio_dword (*stream_cb)(float* buffer, int num_frames, int num_channels);
+    saudio_dword (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data);
     void* user_data;
     int sample_rate;            /* sample rate */
     int buffer_frames;          /* number of frames in streaming buffer */
@@ -236,7 +439,13 @@ typedef struct {
     int packet_frames;          /* number of frames in a packet */
     int num_packets;            /* number of packets in packet queue */
     int num_channels;           /* actual number of channels */
+    _saudio_ring_t ring;        /* push model only */
+    volatile _saudio_atomic_t device_frames;   /* frames queued in the device buffer after the last refill */
+    uint32_t stream_latency_frames;             /* fixed latency after the device buffer, if the backend knows it */
     saudio_desc desc;
+    _saudio_stream_t streams[SAUDIO_MAX_STREAMS];
+    uint32_t stream_unique_counter;
+    volatile _saudio_atomic_t mix_busy;     /* set by the audio thread while it reads streams */
     _saudio_backend_t backend;
 } _saudio_state_t;
 
@@ -246,59 +455,347 @@ _SOKOL_PRIVATE bool _saudio_has_callback(void) {
     return (_saudio.stream_cb || _saudio.stream_userdata_cb);
 }
 
-_SOKOL_PRIVATE DWORD _saudio_stream_callback(float* buffer, int num_frames, int num_channels) {
-    if (_saudio.stream_cb) {
-       return _saudio.stream_cb(buffer, num_frames, num_channels);
+/*=== RING BUFFER IMPLEMENTATION =============================================*/
+/* a position is only published (release) after the frames it covers have
+   been copied, and read (acquire) before they are touched, the
+   Interlocked functions are full barriers */
+_SOKOL_PRIVATE uint32_t _saudio_atomic_load(volatile _saudio_atomic_t* p) {
+#if defined(_SAUDIO_ATOMIC_GNUC)
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    return (uint32_t) _InterlockedCompareExchange(p, 0, 0);
+#endif
+}
+
+_SOKOL_PRIVATE void _saudio_atomic_store(volatile _saudio_atomic_t* p, uint32_t v) {
+#if defined(_SAUDIO_ATOMIC_GNUC)
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#else
+    _InterlockedExchange(p, (long) v);
+#endif
+}
+
+/* a store that no later load moves ahead of, for the handshake between
+   saudio_destroy_stream() and a mix pass */
+_SOKOL_PRIVATE void _saudio_atomic_store_fence(volatile _saudio_atomic_t* p, uint32_t v) {
+#if defined(_SAUDIO_ATOMIC_GNUC)
+    __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#else
+    _InterlockedExchange(p, (long) v);
+#endif
+}
+
+_SOKOL_PRIVATE bool _saudio_ring_init(_saudio_ring_t* ring, int min_frames, int num_channels) {
+    uint32_t num_frames = 1;
+    while (num_frames < (uint32_t)min_frames) {
+        num_frames <<= 1;
+    }
+    ring->buffer = (float*) SOKOL_MALLOC(num_frames * num_channels * sizeof(float));
+    if (!ring->buffer) {
+        return false;
+    }
+    ring->num_frames = num_frames;
+    ring->num_channels = (uint32_t) num_channels;
+    ring->read_pos = 0;
+    ring->write_pos = 0;
+    return true;
+}
+
+_SOKOL_PRIVATE void _saudio_ring_discard(_saudio_ring_t* ring) {
+    if (ring->buffer) {
+        SOKOL_FREE(ring->buffer);
+        ring->buffer = 0;
+    }
+    ring->num_frames = 0;
+}
+
+/* copy frames between ring and linear memory in at most two pieces */
+_SOKOL_PRIVATE void _saudio_ring_copy(_saudio_ring_t* ring, uint32_t pos, float* linear, uint32_t num_frames, bool to_ring) {
+    const uint32_t nch = ring->num_channels;
+    const uint32_t start = pos & (ring->num_frames - 1);
+    const uint32_t first = ((ring->num_frames - start) < num_frames) ? (ring->num_frames - start) : num_frames;
+    if (to_ring) {
+        memcpy(ring->buffer + start * nch, linear, first * nch * sizeof(float));
+        memcpy(ring->buffer, linear + first * nch, (num_frames - first) * nch * sizeof(float));
+    }
+    else {
+        memcpy(linear, ring->buffer + start * nch, first * nch * sizeof(float));
+        memcpy(linear + first * nch, ring->buffer, (num_frames - first) * nch * sizeof(float));
+    }
+}
+
+_SOKOL_PRIVATE int _saudio_ring_write(_saudio_ring_t* ring, const float* frames, int num_frames) {
+    const uint32_t write_pos = (uint32_t) ring->write_pos;
+    const uint32_t fill = write_pos - _saudio_atomic_load(&ring->read_pos);
+    uint32_t n = ring->num_frames - fill;
+    if ((uint32_t)num_frames < n) {
+        n = (uint32_t)num_frames;
+    }
+    _saudio_ring_copy(ring, write_pos, (float*)frames, n, true);
+    _saudio_atomic_store(&ring->write_pos, write_pos + n);
+    return (int) n;
+}
+
+/* returns the number of frames read, the rest of the buffer is left alone */
+_SOKOL_PRIVATE uint32_t _saudio_ring_read(_saudio_ring_t* ring, float* frames, uint32_t num_frames) {
+    const uint32_t read_pos = (uint32_t) ring->read_pos;
+    uint32_t n = _saudio_atomic_load(&ring->write_pos) - read_pos;
+    if (num_frames < n) {
+        n = num_frames;
+    }
+    _saudio_ring_copy(ring, read_pos, frames, n, false);
+    _saudio_atomic_store(&ring->read_pos, read_pos + n);
+    return n;
+}
+
+/*=== MIXER IMPLEMENTATION ===================================================*/
+/* fill an interleaved buffer from a stream callback or else a push ring,
+   whatever they don't provide is silence */
+_SOKOL_PRIVATE void _saudio_pull(saudio_dword (*stream_cb)(float*, int, int),
+    saudio_dword (*stream_userdata_cb)(float*, int, int, void*), void* user_data,
+    _saudio_ring_t* ring, float* buffer, int num_frames, int num_channels)
+{
+    const saudio_dword num_bytes = (saudio_dword)(num_frames * num_channels * sizeof(float));
+    saudio_dword consumed_bytes = 0;
+    if (stream_cb) {
+        consumed_bytes = stream_cb(buffer, num_frames, num_channels);
+    }
+    else if (stream_userdata_cb) {
+        consumed_bytes = stream_userdata_cb(buffer, num_frames, num_channels, user_data);
+    }
+    else if (ring->buffer) {
+        consumed_bytes = (saudio_dword)(_saudio_ring_read(ring, buffer, (uint32_t)num_frames) * num_channels * sizeof(float));
+    }
+    if (consumed_bytes < num_bytes) {
+        memset((uint8_t*)buffer + consumed_bytes, 0, num_bytes - consumed_bytes);
+    }
+}
+
+/* dst += src * volume, from src_channels to the device's channels: the
+   same layout and mono to stereo are vectorized, anything else maps
+   channel to channel, with mono on every channel and stereo averaged to mono */
+_SOKOL_PRIVATE void _saudio_mix(float* dst, const float* src, int num_frames, int src_channels, float volume) {
+    const int dst_channels = _saudio.num_channels;
+    int i = 0;
+    if (src_channels == dst_channels) {
+        const int num_samples = num_frames * dst_channels;
+        #if defined(_SAUDIO_SSE)
+        const __m128 vol = _mm_set1_ps(volume);
+        for (; i + 4 <= num_samples; i += 4) {
+            _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), vol)));
+        }
+        #elif defined(_SAUDIO_NEON)
+        for (; i + 4 <= num_samples; i += 4) {
+            vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), volume));
+        }
+        #endif
+        for (; i < num_samples; i++) {
+            dst[i] += src[i] * volume;
+        }
+    }
+    else if ((src_channels == 1) && (dst_channels == 2)) {
+        #if defined(_SAUDIO_SSE)
+        const __m128 vol = _mm_set1_ps(volume);
+        for (; i + 4 <= num_frames; i += 4) {
+            const __m128 s = _mm_mul_ps(_mm_loadu_ps(src + i), vol);
+            _mm_storeu_ps(dst + 2*i, _mm_add_ps(_mm_loadu_ps(dst + 2*i), _mm_unpacklo_ps(s, s)));
+            _mm_storeu_ps(dst + 2*i + 4, _mm_add_ps(_mm_loadu_ps(dst + 2*i + 4), _mm_unpackhi_ps(s, s)));
+        }
+        #elif defined(_SAUDIO_NEON)
+        for (; i + 4 <= num_frames; i += 4) {
+            const float32x4_t s = vmulq_n_f32(vld1q_f32(src + i), volume);
+            const float32x4x2_t z = vzipq_f32(s, s);
+            vst1q_f32(dst + 2*i, vaddq_f32(vld1q_f32(dst + 2*i), z.val[0]));
+            vst1q_f32(dst + 2*i + 4, vaddq_f32(vld1q_f32(dst + 2*i + 4), z.val[1]));
+        }
+        #endif
+        for (; i < num_frames; i++) {
+            const float s = src[i] * volume;
+            dst[2*i] += s;
+            dst[2*i + 1] += s;
+        }
+    }
+    else if ((src_channels == 2) && (dst_channels == 1)) {
+        const float half = volume * 0.5f;
+        for (; i < num_frames; i++) {
+            dst[i] += (src[2*i] + src[2*i + 1]) * half;
+        }
+    }
+    else {
+        for (; i < num_frames; i++) {
+            for (int c = 0; c < dst_channels; c++) {
+                if (src_channels == 1) {
+                    dst[i*dst_channels + c] += src[i] * volume;
+                }
+                else if (c < src_channels) {
+                    dst[i*dst_channels + c] += src[i*src_channels + c] * volume;
+                }
+            }
+        }
+    }
+}
+
+/* render num_frames (at most a mix block) of one stream at the device rate and mix them into dst */
+_SOKOL_PRIVATE void _saudio_stream_mix(_saudio_stream_t* stream, float* dst, int num_frames) {
+    const int nch = stream->num_channels;
+#if defined(SOKOL_AUDIO_RESAMPLER)
+    if (stream->resampler) {
+        while (stream->out_fill < num_frames) {
+            /* just enough input for what's missing, the resampler keeps the
+               fraction of a frame it's in the middle of */
+            int in_frames = (int)(((int64_t)(num_frames - stream->out_fill) * stream->sample_rate) / _saudio.sample_rate) + 1;
+            if (in_frames > stream->in_frames) {
+                in_frames = stream->in_frames;
+            }
+            _saudio_pull(stream->stream_cb, stream->stream_userdata_cb, stream->user_data,
+                &stream->ring, stream->in_buf, in_frames, nch);
+            struct resampler_data data;
+            data.data_in = stream->in_buf;
+            data.data_out = stream->out_buf + stream->out_fill * nch;
+            data.input_frames = (size_t)in_frames;
+            data.output_frames = 0;
+            data.ratio = (double)_saudio.sample_rate / (double)stream->sample_rate;
+            resampler_sinc_process(stream->resampler, &data);
+            stream->out_fill += (int)data.output_frames;
+        }
+        _saudio_mix(dst, stream->out_buf, num_frames, nch, stream->volume);
+        stream->out_fill -= num_frames;
+        memmove(stream->out_buf, stream->out_buf + num_frames * nch, (size_t)(stream->out_fill * nch) * sizeof(float));
+        return;
     }
-    else if (_saudio.stream_userdata_cb) {
-       return _saudio.stream_userdata_cb(buffer, num_frames, num_channels, _saudio.user_data);
+#endif
+    _saudio_pull(stream->stream_cb, stream->stream_userdata_cb, stream->user_data,
+        &stream->ring, stream->out_buf, num_frames, nch);
+    _saudio_mix(dst, stream->out_buf, num_frames, nch, stream->volume);
+}
+
+/* fill an interleaved device buffer: the main stream, then every active extra stream mixed on top */
+_SOKOL_PRIVATE void _saudio_fill(float* buffer, int num_frames) {
+    _saudio_pull(_saudio.stream_cb, _saudio.stream_userdata_cb, _saudio.user_data,
+        &_saudio.ring, buffer, num_frames, _saudio.num_channels);
+    _saudio_atomic_store_fence(&_saudio.mix_busy, 1);
+    for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+        _saudio_stream_t* stream = &_saudio.streams[i];
+        if (!_saudio_atomic_load(&stream->active)) {
+            continue;
+        }
+        for (int done = 0; done < num_frames; done += _SAUDIO_MIX_BLOCK_FRAMES) {
+            const int n = ((num_frames - done) < _SAUDIO_MIX_BLOCK_FRAMES) ? (num_frames - done) : _SAUDIO_MIX_BLOCK_FRAMES;
+            _saudio_stream_mix(stream, buffer + done * _saudio.num_channels, n);
+        }
     }
+    _saudio_atomic_store(&_saudio.mix_busy, 0);
 }
 
-/*=== MUTEX IMPLEMENTATION ===================================================*/
-_SOKOL_PRIVATE void _saudio_mutex_init(_saudio_mutex_t* m) {
-    InitializeCriticalSection(&m->critsec);
+_SOKOL_PRIVATE void _saudio_yield(void) {
+#if defined(SOKOL_DUMMY_BACKEND)
+    /* no audio thread */
+#elif defined(_WIN32)
+    Sleep(0);
+#else
+    sched_yield();
+#endif
 }
 
-_SOKOL_PRIVATE void _saudio_mutex_destroy(_saudio_mutex_t* m) {
-    DeleteCriticalSection(&m->critsec);
+_SOKOL_PRIVATE void _saudio_stream_discard(_saudio_stream_t* stream) {
+#if defined(SOKOL_AUDIO_RESAMPLER)
+    if (stream->resampler) {
+        resampler_sinc_free(stream->resampler);
+    }
+#endif
+    if (stream->in_buf) {
+        SOKOL_FREE(stream->in_buf);
+    }
+    if (stream->out_buf) {
+        SOKOL_FREE(stream->out_buf);
+    }
+    _saudio_ring_discard(&stream->ring);
+    memset(stream, 0, sizeof(*stream));
 }
 
-_SOKOL_PRIVATE void _saudio_mutex_lock(_saudio_mutex_t* m) {
-    EnterCriticalSection(&m->critsec);
+_SOKOL_PRIVATE _saudio_stream_t* _saudio_lookup_stream(saudio_stream stream) {
+    if ((0 == stream.id) || !_saudio.valid) {
+        return 0;
+    }
+    const uint32_t slot = (stream.id & 0xFFFF) - 1;
+    if ((slot < SAUDIO_MAX_STREAMS) && (_saudio.streams[slot].id == stream.id)) {
+        return &_saudio.streams[slot];
+    }
+    return 0;
 }
 
-_SOKOL_PRIVATE void _saudio_mutex_unlock(_saudio_mutex_t* m) {
-    LeaveCriticalSection(&m->critsec);
+/*=== DUMMY BACKEND IMPLEMENTATION ===========================================*/
+#if defined(SOKOL_DUMMY_BACKEND)
+_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
+    return true;
 }
 
+_SOKOL_PRIVATE void _saudio_backend_shutdown(void) { }
+
+/*=== WASAPI BACKEND IMPLEMENTATION ==========================================*/
+#elif defined(_WIN32)
 _SOKOL_PRIVATE void _saudio_wasapi_submit_buffer(UINT32 num_frames) {
     BYTE* wasapi_buffer = 0;
     if (FAILED(IAudioRenderClient_GetBuffer(_saudio.backend.render_client, num_frames, &wasapi_buffer))) {
         return;
     }
     SOKOL_ASSERT(wasapi_buffer);
-    DWORD consumedBytes = _saudio_stream_callback((float*)wasapi_buffer, num_frames, _saudio.num_channels);
-    DWORD samplesRead = ((num_frames * _saudio.num_channels) * sizeof(float));
-    memset((BYTE*)wasapi_buffer + consumedBytes, 0, samplesRead-consumedBytes);
+    _saudio_fill((float*)wasapi_buffer, (int)num_frames);
     IAudioRenderClient_ReleaseBuffer(_saudio.backend.render_client, num_frames, 0);
 }
 
 _SOKOL_PRIVATE DWORD WINAPI _saudio_wasapi_thread_fn(LPVOID param) {
     (void)param;
-    _saudio_wasapi_submit_buffer(_saudio.buffer_frames);
+    /* register with MMCSS so the audio thread keeps being scheduled under load */
+    HANDLE mmcss_task = 0;
+    DWORD mmcss_task_index = 0;
+    HMODULE avrt = LoadLibraryA("avrt.dll");
+    if (avrt) {
+        _saudio_AvSetMmThreadCharacteristicsW_t set_characteristics =
+            (_saudio_AvSetMmThreadCharacteristicsW_t) GetProcAddress(avrt, "AvSetMmThreadCharacteristicsW");
+        if (set_characteristics) {
+            mmcss_task = set_characteristics(L"Pro Audio", &mmcss_task_index);
+        }
+    }
+
+    /* exclusive mode only accepts whole buffers */
+    const UINT32 dst_buffer_frames = _saudio.backend.thread.dst_buffer_frames;
+    const bool prefill_all = _saudio.backend.thread.exclusive || ((UINT32)_saudio.buffer_frames > dst_buffer_frames);
+    const UINT32 prefill_frames = prefill_all ? dst_buffer_frames : (UINT32)_saudio.buffer_frames;
+    _saudio_wasapi_submit_buffer(prefill_frames);
+    _saudio_atomic_store(&_saudio.device_frames, prefill_frames);
     IAudioClient_Start(_saudio.backend.audio_client);
     while (!_saudio.backend.thread.stop) {
         WaitForSingleObject(_saudio.backend.thread.buffer_end_event, INFINITE);
+        if (_saudio.backend.thread.stop) {
+            break;
+        }
+        /* in exclusive event-driven mode the device hands back the whole buffer on each event */
         UINT32 padding = 0;
-        if (FAILED(IAudioClient_GetCurrentPadding(_saudio.backend.audio_client, &padding))) {
+        if (!_saudio.backend.thread.exclusive &&
+            FAILED(IAudioClient_GetCurrentPadding(_saudio.backend.audio_client, &padding)))
+        {
             continue;
         }
-        SOKOL_ASSERT(_saudio.backend.thread.dst_buffer_frames >= padding);
-        UINT32 num_frames = _saudio.backend.thread.dst_buffer_frames - padding;
+        SOKOL_ASSERT(dst_buffer_frames >= padding);
+        UINT32 num_frames = dst_buffer_frames - padding;
         if (num_frames > 0) {
             _saudio_wasapi_submit_buffer(num_frames);
         }
+        _saudio_atomic_store(&_saudio.device_frames, padding + num_frames);
+    }
+
+    if (mmcss_task) {
+        _saudio_AvRevertMmThreadCharacteristics_t revert_characteristics =
+            (_saudio_AvRevertMmThreadCharacteristics_t) GetProcAddress(avrt, "AvRevertMmThreadCharacteristics");
+        if (revert_characteristics) {
+            revert_characteristics(mmcss_task);
+        }
+    }
+    if (avrt) {
+        FreeLibrary(avrt);
     }
     return 0;
 }
@@ -328,8 +825,129 @@ _SOKOL_PRIVATE void _saudio_wasapi_release(void) {
     }
 }
 
+_SOKOL_PRIVATE bool _saudio_wasapi_activate(void) {
+    if (_saudio.backend.audio_client) {
+        IAudioClient_Release(_saudio.backend.audio_client);
+        _saudio.backend.audio_client = 0;
+    }
+    return SUCCEEDED(IMMDevice_Activate(_saudio.backend.device,
+        _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient),
+        CLSCTX_ALL, 0,
+        (void**)&_saudio.backend.audio_client));
+}
+
+/* a float32 format with the requested rate and channel count */
+_SOKOL_PRIVATE void _saudio_wasapi_float_format(WAVEFORMATEXTENSIBLE* fmt) {
+    memset(fmt, 0, sizeof(*fmt));
+    fmt->Format.wFormatTag = WAVE_FORMAT_EXTENSIBLE;
+    fmt->Format.nChannels = (WORD) _saudio.num_channels;
+    fmt->Format.nSamplesPerSec = _saudio.sample_rate;
+    fmt->Format.wBitsPerSample = 32;
+    fmt->Format.nBlockAlign = (fmt->Format.nChannels * fmt->Format.wBitsPerSample) / 8;
+    fmt->Format.nAvgBytesPerSec = fmt->Format.nSamplesPerSec * fmt->Format.nBlockAlign;
+    fmt->Format.cbSize = sizeof(WAVEFORMATEXTENSIBLE) - sizeof(WAVEFORMATEX);
+    fmt->Samples.wValidBitsPerSample = 32;
+    fmt->dwChannelMask = (_saudio.num_channels == 1) ? SPEAKER_FRONT_CENTER :
+                         (_saudio.num_channels == 2) ? (SPEAKER_FRONT_LEFT|SPEAKER_FRONT_RIGHT) : 0;
+    fmt->SubFormat = _saudio_KSDATAFORMAT_SUBTYPE_IEEE_FLOAT;
+}
+
+/* true if the shared-mode mix format is float32 with the requested rate and channel count */
+_SOKOL_PRIVATE bool _saudio_wasapi_mix_format_matches(void) {
+    WAVEFORMATEX* mix_fmt = 0;
+    if (FAILED(IAudioClient_GetMixFormat(_saudio.backend.audio_client, &mix_fmt))) {
+        return false;
+    }
+    bool is_float = (mix_fmt->wFormatTag == WAVE_FORMAT_IEEE_FLOAT);
+    if (mix_fmt->wFormatTag == WAVE_FORMAT_EXTENSIBLE) {
+        const WAVEFORMATEXTENSIBLE* ext = (const WAVEFORMATEXTENSIBLE*) mix_fmt;
+        is_float = (0 == memcmp(&ext->SubFormat, &_saudio_KSDATAFORMAT_SUBTYPE_IEEE_FLOAT, sizeof(GUID)));
+    }
+    bool matches = is_float && (mix_fmt->wBitsPerSample == 32) &&
+        (mix_fmt->nChannels == _saudio.num_channels) &&
+        (mix_fmt->nSamplesPerSec == (DWORD)_saudio.sample_rate);
+    CoTaskMemFree(mix_fmt);
+    return matches;
+}
+
+/* exclusive mode, event-driven: the buffer is one device period, at least
+   the device's minimum period, filled whole on every event */
+_SOKOL_PRIVATE bool _saudio_wasapi_init_exclusive(REFERENCE_TIME dur) {
+    WAVEFORMATEXTENSIBLE fmt;
+    _saudio_wasapi_float_format(&fmt);
+    if (S_OK != IAudioClient_IsFormatSupported(_saudio.backend.audio_client,
+        AUDCLNT_SHAREMODE_EXCLUSIVE, (WAVEFORMATEX*)&fmt, 0))
+    {
+        return false;
+    }
+    REFERENCE_TIME default_period = 0, min_period = 0;
+    if (SUCCEEDED(IAudioClient_GetDevicePeriod(_saudio.backend.audio_client, &default_period, &min_period))) {
+        if (dur < min_period) {
+            dur = min_period;
+        }
+    }
+    HRESULT hr = IAudioClient_Initialize(_saudio.backend.audio_client,
+        AUDCLNT_SHAREMODE_EXCLUSIVE, AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
+        dur, dur, (WAVEFORMATEX*)&fmt, 0);
+    if (hr == AUDCLNT_E_BUFFER_SIZE_NOT_ALIGNED) {
+        /* retry with the nearest size the device accepts, which needs a new audio client */
+        UINT32 aligned_frames = 0;
+        if (FAILED(IAudioClient_GetBufferSize(_saudio.backend.audio_client, &aligned_frames))) {
+            return false;
+        }
+        dur = (REFERENCE_TIME)((10000000.0 * aligned_frames / _saudio.sample_rate) + 0.5);
+        if (!_saudio_wasapi_activate()) {
+            return false;
+        }
+        hr = IAudioClient_Initialize(_saudio.backend.audio_client,
+            AUDCLNT_SHAREMODE_EXCLUSIVE, AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
+            dur, dur, (WAVEFORMATEX*)&fmt, 0);
+    }
+    if (FAILED(hr)) {
+        /* a failed Initialize leaves the audio client unusable */
+        _saudio_wasapi_activate();
+        return false;
+    }
+    _saudio.backend.thread.exclusive = true;
+    return true;
+}
+
+/* shared mode with the audio engine's minimum period (Windows 10 and later),
+   only possible in the engine's own mix format */
+_SOKOL_PRIVATE bool _saudio_wasapi_init_low_latency(void) {
+#if defined(__IAudioClient3_INTERFACE_DEFINED__)
+    if (!_saudio_wasapi_mix_format_matches()) {
+        return false;
+    }
+    IAudioClient3* client3 = 0;
+    if (FAILED(IAudioClient_QueryInterface(_saudio.backend.audio_client,
+        _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient3), (void**)&client3)))
+    {
+        return false;
+    }
+    bool initialized = false;
+    WAVEFORMATEX* mix_fmt = 0;
+    if (SUCCEEDED(IAudioClient3_GetMixFormat(client3, &mix_fmt))) {
+        UINT32 default_period = 0, fundamental_period = 0, min_period = 0, max_period = 0;
+        if (SUCCEEDED(IAudioClient3_GetSharedModeEnginePeriod(client3, mix_fmt,
+            &default_period, &fundamental_period, &min_period, &max_period)))
+        {
+            initialized = SUCCEEDED(IAudioClient3_InitializeSharedAudioStream(client3,
+                AUDCLNT_STREAMFLAGS_EVENTCALLBACK, min_period, mix_fmt, 0));
+        }
+        CoTaskMemFree(mix_fmt);
+    }
+    IAudioClient3_Release(client3);
+    return initialized;
+#else
+    return false;
+#endif
+}
+
 _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     REFERENCE_TIME dur;
+    REFERENCE_TIME stream_latency = 0;
+    bool initialized = false;
     /* UWP Threads are CoInitialized by default with a different threading model, and this call fails
     See https://github.com/Microsoft/cppwinrt/issues/6#issuecomment-253930637 */
 #if (defined(WINAPI_FAMILY_PARTITION) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP))
@@ -361,11 +979,7 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
         SOKOL_LOG("sokol_audio wasapi: GetDefaultAudioEndPoint failed");
         goto error;
     }
-    if (FAILED(IMMDevice_Activate(_saudio.backend.device,
-        _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient),
-        CLSCTX_ALL, 0,
-        (void**)&_saudio.backend.audio_client)))
-    {
+    if (!_saudio_wasapi_activate()) {
         SOKOL_LOG("sokol_audio wasapi: device activate failed");
         goto error;
     }
@@ -380,18 +994,42 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     fmt.nAvgBytesPerSec = fmt.nSamplesPerSec * fmt.nBlockAlign;
     dur = (REFERENCE_TIME)
         (((double)_saudio.buffer_frames) / (((double)_saudio.sample_rate) * (1.0/10000000.0)));
-    if (FAILED(IAudioClient_Initialize(_saudio.backend.audio_client,
-        AUDCLNT_SHAREMODE_SHARED,
-        AUDCLNT_STREAMFLAGS_EVENTCALLBACK|AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM|AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
-        dur, 0, &fmt, 0)))
-    {
-        SOKOL_LOG("sokol_audio wasapi: audio client initialize failed");
-        goto error;
+
+    if (_saudio.desc.exclusive) {
+        initialized = _saudio_wasapi_init_exclusive(dur);
+        if (!initialized) {
+            SOKOL_LOG("sokol_audio wasapi: exclusive mode not available, using shared mode");
+        }
+    }
+    if (!initialized && _saudio.desc.low_latency) {
+        initialized = _saudio_wasapi_init_low_latency();
+        if (!initialized) {
+            SOKOL_LOG("sokol_audio wasapi: low-latency shared mode not available, using the default period");
+        }
+    }
+    if (!initialized) {
+        /* no conversion in the audio engine is needed when the requested
+           format is the engine's own mix format */
+        DWORD flags = AUDCLNT_STREAMFLAGS_EVENTCALLBACK;
+        if (!_saudio_wasapi_mix_format_matches()) {
+            flags |= AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM|AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY;
+        }
+        if (FAILED(IAudioClient_Initialize(_saudio.backend.audio_client,
+            AUDCLNT_SHAREMODE_SHARED,
+            flags,
+            dur, 0, &fmt, 0)))
+        {
+            SOKOL_LOG("sokol_audio wasapi: audio client initialize failed");
+            goto error;
+        }
     }
     if (FAILED(IAudioClient_GetBufferSize(_saudio.backend.audio_client, &_saudio.backend.thread.dst_buffer_frames))) {
         SOKOL_LOG("sokol_audio wasapi: audio client get buffer size failed");
         goto error;
     }
+    if (SUCCEEDED(IAudioClient_GetStreamLatency(_saudio.backend.audio_client, &stream_latency))) {
+        _saudio.stream_latency_frames = (uint32_t)((stream_latency * _saudio.sample_rate) / 10000000);
+    }
     if (FAILED(IAudioClient_GetService(_saudio.backend.audio_client,
         _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioRenderClient),
         (void**)&_saudio.backend.render_client)))
@@ -434,6 +1072,472 @@ _SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
 #endif
 }
 
+/*=== COREAUDIO BACKEND IMPLEMENTATION =======================================*/
+#elif defined(__APPLE__)
+_SOKOL_PRIVATE OSStatus _saudio_coreaudio_render(void* user_data, AudioUnitRenderActionFlags* flags,
+    const AudioTimeStamp* time_stamp, UInt32 bus, UInt32 num_frames, AudioBufferList* buffers)
+{
+    _SOKOL_UNUSED(user_data);
+    _SOKOL_UNUSED(flags);
+    _SOKOL_UNUSED(time_stamp);
+    _SOKOL_UNUSED(bus);
+    /* interleaved, so there's exactly one buffer */
+    SOKOL_ASSERT(buffers->mNumberBuffers == 1);
+    _saudio_fill((float*)buffers->mBuffers[0].mData, (int)num_frames);
+    _saudio_atomic_store(&_saudio.device_frames, num_frames);
+    return noErr;
+}
+
+#if !TARGET_OS_IPHONE
+/* ask the output device for the requested period and read back its latency */
+_SOKOL_PRIVATE void _saudio_coreaudio_config_device(void) {
+    AudioObjectID device = kAudioObjectUnknown;
+    UInt32 size = sizeof(device);
+    if (noErr != AudioUnitGetProperty(_saudio.backend.unit, kAudioOutputUnitProperty_CurrentDevice,
+        kAudioUnitScope_Global, 0, &device, &size))
+    {
+        return;
+    }
+    AudioObjectPropertyAddress addr;
+    addr.mSelector = kAudioDevicePropertyBufferFrameSize;
+    addr.mScope = kAudioObjectPropertyScopeGlobal;
+    addr.mElement = 0;  /* kAudioObjectPropertyElementMain */
+    UInt32 frames = (UInt32)_saudio.buffer_frames;
+    if (noErr != AudioObjectSetPropertyData(device, &addr, 0, 0, sizeof(frames), &frames)) {
+        SOKOL_LOG("sokol_audio coreaudio: failed to set device buffer size");
+    }
+    UInt32 latency = 0, safety_offset = 0;
+    addr.mScope = kAudioObjectPropertyScopeOutput;
+    addr.mSelector = kAudioDevicePropertyLatency;
+    size = sizeof(latency);
+    AudioObjectGetPropertyData(device, &addr, 0, 0, &size, &latency);
+    addr.mSelector = kAudioDevicePropertySafetyOffset;
+    size = sizeof(safety_offset);
+    AudioObjectGetPropertyData(device, &addr, 0, 0, &size, &safety_offset);
+    _saudio.stream_latency_frames = latency + safety_offset;
+}
+#endif
+
+_SOKOL_PRIVATE void _saudio_coreaudio_release(void) {
+    if (_saudio.backend.unit) {
+        if (_saudio.backend.initialized) {
+            AudioUnitUninitialize(_saudio.backend.unit);
+            _saudio.backend.initialized = false;
+        }
+        AudioComponentInstanceDispose(_saudio.backend.unit);
+        _saudio.backend.unit = 0;
+    }
+}
+
+_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+    AudioComponentDescription comp_desc;
+    memset(&comp_desc, 0, sizeof(comp_desc));
+    comp_desc.componentType = kAudioUnitType_Output;
+#if TARGET_OS_IPHONE
+    comp_desc.componentSubType = kAudioUnitSubType_RemoteIO;
+#else
+    comp_desc.componentSubType = kAudioUnitSubType_DefaultOutput;
+#endif
+    comp_desc.componentManufacturer = kAudioUnitManufacturer_Apple;
+    AudioComponent comp = AudioComponentFindNext(0, &comp_desc);
+    if (!comp || (noErr != AudioComponentInstanceNew(comp, &_saudio.backend.unit))) {
+        SOKOL_LOG("sokol_audio coreaudio: failed to create output unit");
+        return false;
+    }
+
+    /* the output scope of the output element has the hardware format,
+       use its rate so the unit's built-in converter only changes the sample format */
+    AudioStreamBasicDescription hw_fmt;
+    UInt32 size = sizeof(hw_fmt);
+    if ((noErr == AudioUnitGetProperty(_saudio.backend.unit, kAudioUnitProperty_StreamFormat,
+        kAudioUnitScope_Output, 0, &hw_fmt, &size)) && (hw_fmt.mSampleRate > 0.0))
+    {
+        _saudio.sample_rate = (int)hw_fmt.mSampleRate;
+    }
+#if !TARGET_OS_IPHONE
+    _saudio_coreaudio_config_device();
+#endif
+
+    AudioStreamBasicDescription fmt;
+    memset(&fmt, 0, sizeof(fmt));
+    fmt.mSampleRate = (Float64)_saudio.sample_rate;
+    fmt.mFormatID = kAudioFormatLinearPCM;
+    fmt.mFormatFlags = kLinearPCMFormatFlagIsFloat | kAudioFormatFlagIsPacked;
+    fmt.mFramesPerPacket = 1;
+    fmt.mChannelsPerFrame = (UInt32)_saudio.num_channels;
+    fmt.mBytesPerFrame = (UInt32)(sizeof(float) * _saudio.num_channels);
+    fmt.mBytesPerPacket = fmt.mBytesPerFrame;
+    fmt.mBitsPerChannel = 32;
+    if (noErr != AudioUnitSetProperty(_saudio.backend.unit, kAudioUnitProperty_StreamFormat,
+        kAudioUnitScope_Input, 0, &fmt, sizeof(fmt)))
+    {
+        SOKOL_LOG("sokol_audio coreaudio: failed to set stream format");
+        goto error;
+    }
+
+    AURenderCallbackStruct cb;
+    memset(&cb, 0, sizeof(cb));
+    cb.inputProc = _saudio_coreaudio_render;
+    if (noErr != AudioUnitSetProperty(_saudio.backend.unit, kAudioUnitProperty_SetRenderCallback,
+        kAudioUnitScope_Input, 0, &cb, sizeof(cb)))
+    {
+        SOKOL_LOG("sokol_audio coreaudio: failed to set render callback");
+        goto error;
+    }
+    if (noErr != AudioUnitInitialize(_saudio.backend.unit)) {
+        SOKOL_LOG("sokol_audio coreaudio: AudioUnitInitialize failed");
+        goto error;
+    }
+    _saudio.backend.initialized = true;
+    _saudio.bytes_per_frame = (int)fmt.mBytesPerFrame;
+    if (noErr != AudioOutputUnitStart(_saudio.backend.unit)) {
+        SOKOL_LOG("sokol_audio coreaudio: AudioOutputUnitStart failed");
+        goto error;
+    }
+    return true;
+error:
+    _saudio_coreaudio_release();
+    return false;
+}
+
+_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
+    if (_saudio.backend.unit) {
+        AudioOutputUnitStop(_saudio.backend.unit);
+    }
+    _saudio_coreaudio_release();
+}
+
+/*=== PIPEWIRE BACKEND IMPLEMENTATION ========================================*/
+#elif defined(__linux__) && defined(SOKOL_AUDIO_PIPEWIRE)
+/* called on the realtime data thread (PW_STREAM_FLAG_RT_PROCESS) */
+_SOKOL_PRIVATE void _saudio_pipewire_process(void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    struct pw_buffer* pw_buf = pw_stream_dequeue_buffer(_saudio.backend.stream);
+    if (!pw_buf) {
+        return;
+    }
+    struct spa_data* data = &pw_buf->buffer->datas[0];
+    if (data->data) {
+        const uint32_t stride = (uint32_t)(sizeof(float) * _saudio.num_channels);
+        uint32_t num_frames = data->maxsize / stride;
+        /* the graph's quantum, so only one period is queued at a time */
+        if ((pw_buf->requested > 0) && (pw_buf->requested < num_frames)) {
+            num_frames = (uint32_t)pw_buf->requested;
+        }
+        _saudio_fill((float*)data->data, (int)num_frames);
+        data->chunk->offset = 0;
+        data->chunk->stride = (int32_t)stride;
+        data->chunk->size = num_frames * stride;
+        _saudio_atomic_store(&_saudio.device_frames, num_frames);
+    }
+    pw_stream_queue_buffer(_saudio.backend.stream, pw_buf);
+}
+
+_SOKOL_PRIVATE void _saudio_pipewire_param_changed(void* user_data, uint32_t id, const struct spa_pod* param) {
+    _SOKOL_UNUSED(user_data);
+    if (!param || (id != SPA_PARAM_Format)) {
+        return;
+    }
+    struct spa_audio_info_raw info;
+    memset(&info, 0, sizeof(info));
+    if ((spa_format_audio_raw_parse(param, &info) >= 0) && (info.rate > 0)) {
+        _saudio.sample_rate = (int)info.rate;
+    }
+    _saudio.backend.format_done = true;
+    pw_thread_loop_signal(_saudio.backend.loop, false);
+}
+
+_SOKOL_PRIVATE void _saudio_pipewire_state_changed(void* user_data, enum pw_stream_state old_state,
+    enum pw_stream_state state, const char* error)
+{
+    _SOKOL_UNUSED(user_data);
+    _SOKOL_UNUSED(old_state);
+    _SOKOL_UNUSED(error);
+    if (state == PW_STREAM_STATE_ERROR) {
+        _saudio.backend.format_done = true;
+        pw_thread_loop_signal(_saudio.backend.loop, false);
+    }
+}
+
+_SOKOL_PRIVATE void _saudio_pipewire_release(void) {
+    if (_saudio.backend.loop) {
+        pw_thread_loop_stop(_saudio.backend.loop);
+    }
+    if (_saudio.backend.stream) {
+        pw_stream_destroy(_saudio.backend.stream);
+        _saudio.backend.stream = 0;
+    }
+    if (_saudio.backend.loop) {
+        pw_thread_loop_destroy(_saudio.backend.loop);
+        _saudio.backend.loop = 0;
+    }
+    pw_deinit();
+}
+
+_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+    uint8_t pod_buffer[1024];
+    struct spa_pod_builder builder;
+    struct spa_audio_info_raw info;
+    const struct spa_pod* params[1];
+    struct pw_properties* props;
+    bool format_ok = false;
+
+    pw_init(0, 0);
+    _saudio.backend.loop = pw_thread_loop_new("sokol-audio", 0);
+    if (!_saudio.backend.loop) {
+        SOKOL_LOG("sokol_audio pipewire: pw_thread_loop_new failed");
+        goto error;
+    }
+
+    /* a node rate and latency in the graph's own terms: the graph switches to
+       the requested rate if it is one of its allowed rates and otherwise keeps
+       its own, which the stream then runs at instead of being resampled */
+    props = pw_properties_new(
+        PW_KEY_MEDIA_TYPE, "Audio",
+        PW_KEY_MEDIA_CATEGORY, "Playback",
+        PW_KEY_MEDIA_ROLE, "Game",
+        (const char*)0);
+    pw_properties_setf(props, PW_KEY_NODE_RATE, "1/%d", _saudio.sample_rate);
+    pw_properties_setf(props, PW_KEY_NODE_LATENCY, "%d/%d", _saudio.buffer_frames, _saudio.sample_rate);
+
+    memset(&_saudio.backend.events, 0, sizeof(_saudio.backend.events));
+    _saudio.backend.events.version = PW_VERSION_STREAM_EVENTS;
+    _saudio.backend.events.state_changed = _saudio_pipewire_state_changed;
+    _saudio.backend.events.param_changed = _saudio_pipewire_param_changed;
+    _saudio.backend.events.process = _saudio_pipewire_process;
+
+    pw_thread_loop_lock(_saudio.backend.loop);
+    _saudio.backend.stream = pw_stream_new_simple(pw_thread_loop_get_loop(_saudio.backend.loop),
+        "sokol-audio", props, &_saudio.backend.events, 0);
+    if (!_saudio.backend.stream) {
+        pw_thread_loop_unlock(_saudio.backend.loop);
+        SOKOL_LOG("sokol_audio pipewire: pw_stream_new_simple failed");
+        goto error;
+    }
+
+    /* no rate in the format, so it's negotiated to the graph rate */
+    memset(&info, 0, sizeof(info));
+    info.format = SPA_AUDIO_FORMAT_F32;
+    info.channels = (uint32_t)_saudio.num_channels;
+    if (info.channels == 1) {
+        info.position[0] = SPA_AUDIO_CHANNEL_MONO;
+    }
+    else if (info.channels == 2) {
+        info.position[0] = SPA_AUDIO_CHANNEL_FL;
+        info.position[1] = SPA_AUDIO_CHANNEL_FR;
+    }
+    spa_pod_builder_init(&builder, pod_buffer, sizeof(pod_buffer));
+    params[0] = spa_format_audio_raw_build(&builder, SPA_PARAM_EnumFormat, &info);
+    if ((pw_stream_connect(_saudio.backend.stream, PW_DIRECTION_OUTPUT, PW_ID_ANY,
+        (enum pw_stream_flags)(PW_STREAM_FLAG_AUTOCONNECT | PW_STREAM_FLAG_MAP_BUFFERS | PW_STREAM_FLAG_RT_PROCESS),
+        params, 1) < 0) || (pw_thread_loop_start(_saudio.backend.loop) < 0))
+    {
+        pw_thread_loop_unlock(_saudio.backend.loop);
+        SOKOL_LOG("sokol_audio pipewire: failed to connect stream");
+        goto error;
+    }
+    /* wait for the negotiated rate, process() doesn't run before that */
+    while (!_saudio.backend.format_done) {
+        if (pw_thread_loop_timed_wait(_saudio.backend.loop, 2) != 0) {
+            break;
+        }
+    }
+    format_ok = (pw_stream_get_state(_saudio.backend.stream, 0) != PW_STREAM_STATE_ERROR);
+    pw_thread_loop_unlock(_saudio.backend.loop);
+    if (!format_ok) {
+        SOKOL_LOG("sokol_audio pipewire: stream failed");
+        goto error;
+    }
+    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
+    return true;
+error:
+    _saudio_pipewire_release();
+    return false;
+}
+
+_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
+    _saudio_pipewire_release();
+}
+
+/*=== ALSA BACKEND IMPLEMENTATION ============================================*/
+#elif defined(__linux__)
+/* refill the device buffer straight through the mmap areas, returns false on an unrecoverable error */
+_SOKOL_PRIVATE bool _saudio_alsa_write_mmap(snd_pcm_uframes_t num_frames) {
+    while (num_frames > 0) {
+        const snd_pcm_channel_area_t* areas = 0;
+        snd_pcm_uframes_t offset = 0;
+        snd_pcm_uframes_t frames = num_frames;
+        int err = snd_pcm_mmap_begin(_saudio.backend.device, &areas, &offset, &frames);
+        if (err < 0) {
+            return snd_pcm_recover(_saudio.backend.device, err, 1) >= 0;
+        }
+        /* interleaved, so the first area's start is the start of the frame */
+        float* dst = (float*)((uint8_t*)areas[0].addr + ((areas[0].first + offset * areas[0].step) / 8));
+        _saudio_fill(dst, (int)frames);
+        snd_pcm_sframes_t committed = snd_pcm_mmap_commit(_saudio.backend.device, offset, frames);
+        if ((committed < 0) || ((snd_pcm_uframes_t)committed != frames)) {
+            return snd_pcm_recover(_saudio.backend.device, (committed < 0) ? (int)committed : -EPIPE, 1) >= 0;
+        }
+        num_frames -= frames;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE bool _saudio_alsa_write_rw(snd_pcm_uframes_t num_frames) {
+    while (num_frames > 0) {
+        snd_pcm_uframes_t frames = (num_frames < _saudio.backend.period_frames) ? num_frames : _saudio.backend.period_frames;
+        _saudio_fill(_saudio.backend.buffer, (int)frames);
+        snd_pcm_sframes_t written = snd_pcm_writei(_saudio.backend.device, _saudio.backend.buffer, frames);
+        if (written < 0) {
+            return snd_pcm_recover(_saudio.backend.device, (int)written, 1) >= 0;
+        }
+        num_frames -= (snd_pcm_uframes_t)written;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void* _saudio_alsa_thread_fn(void* param) {
+    _SOKOL_UNUSED(param);
+    snd_pcm_t* pcm = _saudio.backend.device;
+    while (!_saudio.backend.thread_stop) {
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm);
+        if (avail < 0) {
+            if (snd_pcm_recover(pcm, (int)avail, 1) < 0) {
+                SOKOL_LOG("sokol_audio alsa: unrecoverable device error");
+                break;
+            }
+            continue;
+        }
+        if ((snd_pcm_uframes_t)avail < _saudio.backend.period_frames) {
+            /* the device starts once the first buffer is queued, after an
+               underrun recovery too, so don't wait on a stopped device */
+            if (snd_pcm_state(pcm) == SND_PCM_STATE_PREPARED) {
+                snd_pcm_start(pcm);
+            }
+            /* bounded, so a stop request is noticed */
+            snd_pcm_wait(pcm, 100);
+            continue;
+        }
+        /* only whole periods, so each refill wakes up once per device period */
+        const snd_pcm_uframes_t num_frames = ((snd_pcm_uframes_t)avail / _saudio.backend.period_frames) * _saudio.backend.period_frames;
+        const bool ok = _saudio.backend.mmap ? _saudio_alsa_write_mmap(num_frames) : _saudio_alsa_write_rw(num_frames);
+        if (!ok) {
+            SOKOL_LOG("sokol_audio alsa: unrecoverable device error");
+            break;
+        }
+        snd_pcm_sframes_t delay = 0;
+        if (snd_pcm_delay(pcm, &delay) >= 0) {
+            _saudio_atomic_store(&_saudio.device_frames, (uint32_t)((delay > 0) ? delay : 0));
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE void _saudio_alsa_release(void) {
+    if (_saudio.backend.device) {
+        snd_pcm_close(_saudio.backend.device);
+        _saudio.backend.device = 0;
+    }
+    if (_saudio.backend.buffer) {
+        SOKOL_FREE(_saudio.backend.buffer);
+        _saudio.backend.buffer = 0;
+    }
+}
+
+_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+    snd_pcm_hw_params_t* hw_params = 0;
+    snd_pcm_sw_params_t* sw_params = 0;
+    unsigned int rate = (unsigned int)_saudio.sample_rate;
+    snd_pcm_uframes_t buffer_frames = (snd_pcm_uframes_t)_saudio.buffer_frames;
+    snd_pcm_uframes_t period_frames = 0;
+    int dir = 0;
+
+    if (snd_pcm_open(&_saudio.backend.device, "default", SND_PCM_STREAM_PLAYBACK, 0) < 0) {
+        SOKOL_LOG("sokol_audio alsa: snd_pcm_open failed");
+        return false;
+    }
+    snd_pcm_hw_params_alloca(&hw_params);
+    snd_pcm_hw_params_any(_saudio.backend.device, hw_params);
+    /* write straight into the device buffer if the device (or plugin) allows it */
+    _saudio.backend.mmap = (0 == snd_pcm_hw_params_set_access(_saudio.backend.device, hw_params, SND_PCM_ACCESS_MMAP_INTERLEAVED));
+    if (!_saudio.backend.mmap &&
+        (snd_pcm_hw_params_set_access(_saudio.backend.device, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED) < 0))
+    {
+        SOKOL_LOG("sokol_audio alsa: no interleaved access");
+        goto error;
+    }
+    if (snd_pcm_hw_params_set_format(_saudio.backend.device, hw_params, SND_PCM_FORMAT_FLOAT) < 0) {
+        SOKOL_LOG("sokol_audio alsa: float32 format not supported");
+        goto error;
+    }
+    if (snd_pcm_hw_params_set_channels(_saudio.backend.device, hw_params, (unsigned int)_saudio.num_channels) < 0) {
+        SOKOL_LOG("sokol_audio alsa: requested channel count not supported");
+        goto error;
+    }
+    /* no resampling in alsa-lib: take the nearest rate the device runs at */
+    snd_pcm_hw_params_set_rate_resample(_saudio.backend.device, hw_params, 0);
+    if (snd_pcm_hw_params_set_rate_near(_saudio.backend.device, hw_params, &rate, &dir) < 0) {
+        SOKOL_LOG("sokol_audio alsa: no usable sample rate");
+        goto error;
+    }
+    /* the requested buffer as two device periods, the device rounds both to what it supports */
+    period_frames = buffer_frames / 2;
+    dir = 0;
+    snd_pcm_hw_params_set_period_size_near(_saudio.backend.device, hw_params, &period_frames, &dir);
+    snd_pcm_hw_params_set_buffer_size_near(_saudio.backend.device, hw_params, &buffer_frames);
+    if (snd_pcm_hw_params(_saudio.backend.device, hw_params) < 0) {
+        SOKOL_LOG("sokol_audio alsa: snd_pcm_hw_params failed");
+        goto error;
+    }
+    snd_pcm_hw_params_get_period_size(hw_params, &period_frames, &dir);
+    snd_pcm_hw_params_get_buffer_size(hw_params, &buffer_frames);
+    _saudio.backend.period_frames = period_frames;
+    _saudio.backend.buffer_frames = buffer_frames;
+
+    snd_pcm_sw_params_alloca(&sw_params);
+    snd_pcm_sw_params_current(_saudio.backend.device, sw_params);
+    snd_pcm_sw_params_set_avail_min(_saudio.backend.device, sw_params, period_frames);
+    /* started by the audio thread after the first refill */
+    snd_pcm_sw_params_set_start_threshold(_saudio.backend.device, sw_params, buffer_frames);
+    if (snd_pcm_sw_params(_saudio.backend.device, sw_params) < 0) {
+        SOKOL_LOG("sokol_audio alsa: snd_pcm_sw_params failed");
+        goto error;
+    }
+
+    if (!_saudio.backend.mmap) {
+        _saudio.backend.buffer = (float*) SOKOL_MALLOC(period_frames * _saudio.num_channels * sizeof(float));
+        if (!_saudio.backend.buffer) {
+            SOKOL_LOG("sokol_audio alsa: failed to allocate buffer");
+            goto error;
+        }
+    }
+    _saudio.sample_rate = (int)rate;
+    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
+
+    if (0 != pthread_create(&_saudio.backend.thread, 0, _saudio_alsa_thread_fn, 0)) {
+        SOKOL_LOG("sokol_audio alsa: pthread_create failed");
+        goto error;
+    }
+    _saudio.backend.thread_valid = true;
+    return true;
+error:
+    _saudio_alsa_release();
+    return false;
+}
+
+_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
+    if (_saudio.backend.thread_valid) {
+        _saudio.backend.thread_stop = true;
+        pthread_join(_saudio.backend.thread, 0);
+        _saudio.backend.thread_valid = false;
+    }
+    if (_saudio.backend.device) {
+        snd_pcm_drop(_saudio.backend.device);
+    }
+    _saudio_alsa_release();
+}
+#endif
+
 /*=== PUBLIC API FUNCTIONS ===================================================*/
 SOKOL_API_IMPL void saudio_setup(const saudio_desc* desc) {
     SOKOL_ASSERT(!_saudio.valid);
@@ -448,6 +1552,13 @@ SOKOL_API_IMPL void saudio_setup(const saudio_desc* desc) {
     _saudio.packet_frames = _saudio_def(_saudio.desc.packet_frames, _SAUDIO_DEFAULT_PACKET_FRAMES);
     _saudio.num_packets = _saudio_def(_saudio.desc.num_packets, _SAUDIO_DEFAULT_NUM_PACKETS);
     _saudio.num_channels = _saudio_def(_saudio.desc.num_channels, 1);
+    /* the ring must exist before the audio thread starts reading from it */
+    if (!_saudio_has_callback() &&
+        !_saudio_ring_init(&_saudio.ring, _saudio.num_packets * _saudio.packet_frames, _saudio.num_channels))
+    {
+        SOKOL_LOG("sokol_audio.h: failed to allocate push ring buffer");
+        return;
+    }
     if (_saudio_backend_init()) {
         /* the backend might not support the requested exact buffer size,
            make sure the actual buffer size is still a multiple of
@@ -456,19 +1567,171 @@ SOKOL_API_IMPL void saudio_setup(const saudio_desc* desc) {
         if (0 != (_saudio.buffer_frames % _saudio.packet_frames)) {
             SOKOL_LOG("sokol_audio.h: actual backend buffer size isn't multiple of requested packet size");
             _saudio_backend_shutdown();
+            _saudio_ring_discard(&_saudio.ring);
             return;
         }
         _saudio.valid = true;
     }
+    else {
+        _saudio_ring_discard(&_saudio.ring);
+    }
 }
 
 SOKOL_API_IMPL void saudio_shutdown(void) {
     if (_saudio.valid) {
         _saudio_backend_shutdown();
+        for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+            _saudio_stream_discard(&_saudio.streams[i]);
+        }
+        _saudio_ring_discard(&_saudio.ring);
         _saudio.valid = false;
     }
 }
 
+SOKOL_API_IMPL int saudio_push(const float* frames, int num_frames) {
+    SOKOL_ASSERT(frames && (num_frames >= 0));
+    if (!_saudio.valid || !_saudio.ring.buffer) {
+        return 0;
+    }
+    return _saudio_ring_write(&_saudio.ring, frames, num_frames);
+}
+
+SOKOL_API_IMPL int saudio_expect(void) {
+    if (!_saudio.valid || !_saudio.ring.buffer) {
+        return 0;
+    }
+    return (int)(_saudio.ring.num_frames - (uint32_t)saudio_ring_fill());
+}
+
+SOKOL_API_IMPL int saudio_ring_frames(void) {
+    return _saudio.valid ? (int)_saudio.ring.num_frames : 0;
+}
+
+SOKOL_API_IMPL int saudio_ring_fill(void) {
+    if (!_saudio.valid || !_saudio.ring.buffer) {
+        return 0;
+    }
+    return (int)(_saudio_atomic_load(&_saudio.ring.write_pos) - _saudio_atomic_load(&_saudio.ring.read_pos));
+}
+
+SOKOL_API_IMPL int saudio_latency_frames(void) {
+    if (!_saudio.valid) {
+        return 0;
+    }
+    return saudio_ring_fill() +
+        (int)_saudio_atomic_load(&_saudio.device_frames) +
+        (int)_saudio.stream_latency_frames;
+}
+
+SOKOL_API_IMPL int saudio_sample_rate(void) {
+    return _saudio.sample_rate;
+}
+
+SOKOL_API_IMPL saudio_stream saudio_make_stream(const saudio_stream_desc* desc) {
+    SOKOL_ASSERT(desc);
+    saudio_stream res = { 0 };
+    if (!_saudio.valid) {
+        return res;
+    }
+    int slot = 0;
+    while ((slot < SAUDIO_MAX_STREAMS) && (_saudio.streams[slot].id != 0)) {
+        slot++;
+    }
+    if (slot == SAUDIO_MAX_STREAMS) {
+        SOKOL_LOG("sokol_audio.h: too many streams (SAUDIO_MAX_STREAMS)");
+        return res;
+    }
+    _saudio_stream_t* stream = &_saudio.streams[slot];
+    stream->sample_rate = _saudio_def(desc->sample_rate, _saudio.sample_rate);
+    stream->num_channels = _saudio_def(desc->num_channels, 1);
+    stream->volume = _saudio_def_flt(desc->volume, 1.0f);
+    stream->stream_cb = desc->stream_cb;
+    stream->stream_userdata_cb = desc->stream_userdata_cb;
+    stream->user_data = desc->user_data;
+    const int nch = stream->num_channels;
+    bool ok = true;
+    if (!stream->stream_cb && !stream->stream_userdata_cb) {
+        ok = _saudio_ring_init(&stream->ring, _saudio_def(desc->buffer_frames, 4 * _saudio.buffer_frames), nch);
+    }
+    if (stream->sample_rate == _saudio.sample_rate) {
+        stream->out_frames = _SAUDIO_MIX_BLOCK_FRAMES;
+    }
+    else {
+#if defined(SOKOL_AUDIO_RESAMPLER)
+        /* a pull of in_frames never produces more than one mix block and
+           the ratio of a frame beyond what's missing */
+        stream->in_frames = (int)(((int64_t)_SAUDIO_MIX_BLOCK_FRAMES * stream->sample_rate) / _saudio.sample_rate) + 2;
+        stream->out_frames = 2 * _SAUDIO_MIX_BLOCK_FRAMES + (_saudio.sample_rate / stream->sample_rate) + 4;
+        struct resampler_sinc_config config;
+        resampler_sinc_config_preset(&config, RESAMPLER_QUALITY_NORMAL, (unsigned)nch);
+        stream->resampler = resampler_sinc_init_config(&config);
+        if (stream->resampler) {
+            /* exact phases if the rates have a small enough common period */
+            resampler_sinc_set_fixed_ratio(stream->resampler, (unsigned)stream->sample_rate, (unsigned)_saudio.sample_rate);
+        }
+        stream->in_buf = (float*) SOKOL_MALLOC((size_t)(stream->in_frames * nch) * sizeof(float));
+        ok = ok && stream->resampler && stream->in_buf;
+#else
+        SOKOL_LOG("sokol_audio.h: stream sample rate differs from the device's, define SOKOL_AUDIO_RESAMPLER");
+        ok = false;
+#endif
+    }
+    stream->out_buf = (float*) SOKOL_MALLOC((size_t)(stream->out_frames * nch) * sizeof(float));
+    if (!ok || !stream->out_buf) {
+        SOKOL_LOG("sokol_audio.h: failed to create stream");
+        _saudio_stream_discard(stream);
+        return res;
+    }
+    /* slot in the low bits, a unique counter above, so a stale handle doesn't match a reused slot */
+    _saudio.stream_unique_counter = (_saudio.stream_unique_counter + 1) & 0xFFFF;
+    if (0 == _saudio.stream_unique_counter) {
+        _saudio.stream_unique_counter = 1;
+    }
+    stream->id = (_saudio.stream_unique_counter << 16) | (uint32_t)(slot + 1);
+    /* publishes everything above to the audio thread */
+    _saudio_atomic_store(&stream->active, 1);
+    res.id = stream->id;
+    return res;
+}
+
+SOKOL_API_IMPL void saudio_destroy_stream(saudio_stream stream) {
+    _saudio_stream_t* s = _saudio_lookup_stream(stream);
+    if (!s) {
+        return;
+    }
+    /* a mix pass that started before the stream went inactive might still
+       be using it, one that starts after won't look at it */
+    _saudio_atomic_store_fence(&s->active, 0);
+    while (_saudio_atomic_load(&_saudio.mix_busy)) {
+        _saudio_yield();
+    }
+    _saudio_stream_discard(s);
+}
+
+SOKOL_API_IMPL int saudio_stream_push(saudio_stream stream, const float* frames, int num_frames) {
+    SOKOL_ASSERT(frames && (num_frames >= 0));
+    _saudio_stream_t* s = _saudio_lookup_stream(stream);
+    if (!s || !s->ring.buffer) {
+        return 0;
+    }
+    return _saudio_ring_write(&s->ring, frames, num_frames);
+}
+
+SOKOL_API_IMPL int saudio_stream_expect(saudio_stream stream) {
+    _saudio_stream_t* s = _saudio_lookup_stream(stream);
+    if (!s || !s->ring.buffer) {
+        return 0;
+    }
+    return (int)(s->ring.num_frames - (_saudio_atomic_load(&s->ring.write_pos) - _saudio_atomic_load(&s->ring.read_pos)));
+}
+
+SOKOL_API_IMPL void saudio_stream_set_volume(saudio_stream stream, float volume) {
+    _saudio_stream_t* s = _saudio_lookup_stream(stream);
+    if (s) {
+        s->volume = volume;
+    }
+}
+
 #undef _saudio_def
 #undef _saudio_def_flt
 
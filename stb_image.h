@@ -14,6 +14,8 @@
 
    You can #define STBI_ASSERT(x) before the #include to avoid using assert.h.
    And #define STBI_MALLOC, STBI_REALLOC, and STBI_FREE to avoid using malloc,realloc,free
+   Or #define STBI_RETRO_ARENA to allocate with retro_arena.h, from the arena
+   set for the calling thread
 
 
    QUICK NOTES:
@@ -209,10 +211,102 @@ RECENT REVISION HISTORY:
 // (at least this is true for iOS and Android). Therefore, the NEON support is
 // toggled by a build flag: define STBI_NEON to get NEON loops.
 //
+// If the compiler targets AVX2 (e.g. -mavx2 or /arch:AVX2), the JPEG color
+// conversion also uses 256-bit loops; define STBI_NO_AVX2 to stay on SSE2.
+//
 // If for some reason you do not want to use any of SIMD code, or if
 // you have issues compiling it, you can disable it entirely by
 // defining STBI_NO_SIMD.
 //
+// The PNG decoder uses the same SSE2/NEON selection to unfilter scanlines
+// of 3, 4, 6 and 8 byte pixels.
+//
+// With SIMD, 4:2:0 and 4:2:2 JPEGs upsample the chroma while converting to
+// RGB, and RGB output (3 channels) is converted as fast as RGBA; the results
+// are identical to the generic path. stbi_set_jpeg_downscale_on_load()
+// decodes JPEGs directly at 1/2, 1/4 or 1/8 size with smaller IDCTs.
+//
+// ===========================================================================
+//
+// Batch decoding
+//
+// stbi_load_batch_from_memory() decodes several independent images in one
+// call. stb_image does not create threads itself; instead you pass a
+// function that runs 'job_count' jobs, e.g. by handing them to your own
+// thread pool, and returns once they have all finished. Passing NULL runs
+// them one after the other on the calling thread:
+//
+//    static void run_jobs(void *user, stbi_batch_job *job, void *job_data, int job_count)
+//    {
+//       int i;
+//       for (i=0; i < job_count; ++i)
+//          my_pool_submit(user, job, job_data, i); // job(job_data, i) on a worker
+//       my_pool_wait(user);
+//    }
+//
+//    stbi_batch_image images[N]; // fill in buffer, len and desired_channels
+//    stbi_load_batch_from_memory(images, N, run_jobs, my_pool);
+//
+// Each decode is independent, so this is safe as long as the global
+// settings (stbi_set_flip_vertically_on_load() and friends) are not changed
+// while the batch runs. The failure reason of each image is only reliable if
+// the compiler supports thread-local storage, see STBI_NO_THREAD_LOCALS.
+//
+// ===========================================================================
+//
+// Decoding into your own memory
+//
+// stbi_load_from_memory_into() writes the image into a buffer you provide,
+// e.g. a mapped GPU staging buffer, with your own row stride and channel
+// count, optionally with red and blue swapped. Scratch memory for the decode
+// comes from the stbi_allocator you pass instead of STBI_MALLOC; with an
+// allocator that recycles its memory (say, a bump allocator reset after
+// each image) decoding does no heap allocations at all:
+//
+//    stbi_output_buffer out;
+//    out.pixels   = mapped;               // staging memory
+//    out.size     = mapped_size;
+//    out.stride   = row_pitch;
+//    out.channels = 4;
+//    out.bgr      = 0;
+//    if (!stbi_load_from_memory_into(file, file_len, &x, &y, &n, &out, &scratch))
+//       ... stbi_failure_reason() ...
+//
+// Use stbi_info_from_memory() first to size the buffer; if the image doesn't
+// fit the call fails without writing past out.size. Baseline and progressive
+// JPEGs are decoded straight into the buffer (unless flipping vertically);
+// other formats are decoded into scratch memory and then copied, one row at
+// a time. The allocator is only used by the calling thread, and only while
+// the call runs, if the compiler supports thread-local storage; otherwise
+// don't run several of these calls with different allocators at once.
+//
+// ===========================================================================
+//
+// Streaming PNG decoding
+//
+// stbi_png_stream_from_memory() and friends decode a PNG without holding
+// either its compressed or its decompressed image in memory: IDAT chunks are
+// read as inflate needs them, and each row is unfiltered and converted as
+// soon as it has been inflated. Rows are handed to your callback in bands of
+// up to band_rows rows, top to bottom, e.g. to upload a huge texture atlas
+// one tile row at a time:
+//
+//    int upload(void *user, stbi_uc const *rows, int y, int count, int stride)
+//    {
+//       ... copy count rows starting at row y, stride bytes apart ...
+//       return 1; // 0 stops decoding
+//    }
+//
+//    if (!stbi_png_stream("atlas.png", &x, &y, &n, 4, 256, upload, &gpu))
+//       ... stbi_failure_reason() ...
+//
+// Working memory is a few rows, one band and about 100K for inflate and
+// input, however large the image. x, y and channels_in_file are set before
+// the first band is passed, so the callback can read them through user.
+// Output is 8 bits per channel; 16-bit images give the top 8 bits of each
+// sample, as stbi_load() does. Interlaced and iPhone PNGs can't be streamed
+// and fail, and stbi_set_flip_vertically_on_load() is ignored.
+//
 // ===========================================================================
 //
 // HDR image support   (disable by defining STBI_NO_HDR)
@@ -299,11 +393,16 @@ RECENT REVISION HISTORY:
 //   - If you use STBI_NO_PNG (or _ONLY_ without PNG), and you still
 //     want the zlib decoder to be available, #define STBI_SUPPORT_ZLIB
 //
+//   - The failure reason is kept per thread when the compiler supports
+//     thread-local storage. #define STBI_NO_THREAD_LOCALS to use a single
+//     global instead, e.g. on platforms where thread-locals are expensive.
+//
 
 
 #ifndef STBI_NO_STDIO
 #include <stdio.h>
 #endif // STBI_NO_STDIO
+#include <stddef.h> // size_t
 
 #define STBI_VERSION 1
 
@@ -407,7 +506,7 @@ STBIDEF int      stbi_is_hdr_from_file(FILE *f);
 
 
 // get a VERY brief reason for failure
-// NOT THREADSAFE
+// NOT THREADSAFE unless thread-local storage is available (see STBI_NO_THREAD_LOCALS)
 STBIDEF const char *stbi_failure_reason  (void);
 
 // free the loaded image -- this is just free()
@@ -437,6 +536,12 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+// decode JPEGs at 1/2, 1/4 or 1/8 of their size (factor 2, 4 or 8; anything
+// else means full size). this is much faster than decoding at full size and
+// resizing, as most of the IDCT is skipped. the returned size is rounded up;
+// stbi_info() still reports the full size
+STBIDEF void stbi_set_jpeg_downscale_on_load(int factor);
+
 // ZLIB client - used by PNG, available for other purposes
 
 STBIDEF char *stbi_zlib_decode_malloc_guesssize(const char *buffer, int len, int initial_size, int *outlen);
@@ -447,6 +552,61 @@ STBIDEF int   stbi_zlib_decode_buffer(char *obuffer, int olen, const char *ibuff
 STBIDEF char *stbi_zlib_decode_noheader_malloc(const char *buffer, int len, int *outlen);
 STBIDEF int   stbi_zlib_decode_noheader_buffer(char *obuffer, int olen, const char *ibuffer, int ilen);
 
+// batch decoding, see "Batch decoding" above
+
+typedef struct
+{
+   stbi_uc const *buffer;           // in: the image file in memory
+   int            len;
+   int            desired_channels;
+
+   stbi_uc       *data;             // out: as from stbi_load_from_memory(), NULL on failure
+   int            x, y, channels_in_file;
+   const char    *failure_reason;   // out: stbi_failure_reason() for this image if it failed
+} stbi_batch_image;
+
+typedef void stbi_batch_job(void *job_data, int job_index);
+typedef void stbi_batch_run_jobs(void *user, stbi_batch_job *job, void *job_data, int job_count);
+
+// returns the number of images decoded successfully
+STBIDEF int   stbi_load_batch_from_memory(stbi_batch_image *images, int count, stbi_batch_run_jobs *run_jobs, void *user);
+
+// decoding into your own memory, see "Decoding into your own memory" above
+
+typedef struct
+{
+   void *(*alloc)(void *user, size_t size); // return NULL on failure
+   void  (*free) (void *user, void *ptr);   // ptr is never NULL
+   void   *user;
+} stbi_allocator;
+
+typedef struct
+{
+   stbi_uc *pixels;   // first pixel of the first row
+   size_t   size;     // bytes writable from pixels
+   int      stride;   // bytes from the start of one row to the next; any
+                      // padding after a row may be overwritten
+   int      channels; // 1..4, as desired_channels for stbi_load_from_memory
+   int      bgr;      // nonzero to store 3 and 4 channel pixels as BGR(A)
+} stbi_output_buffer;
+
+// returns 1 on success, 0 on failure. alloc may be NULL to use STBI_MALLOC
+STBIDEF int   stbi_load_from_memory_into(stbi_uc const *buffer, int len, int *x, int *y, int *channels_in_file, stbi_output_buffer const *out, stbi_allocator const *alloc);
+
+// streaming PNG decoding, see "Streaming PNG decoding" above
+
+// receives row_count rows starting at row y, stride bytes apart; returns 0
+// to stop decoding
+typedef int stbi_row_callback(void *user, stbi_uc const *rows, int y, int row_count, int stride);
+
+// returns 1 once every row has been passed to the callback, 0 on failure or
+// if the callback stopped decoding
+STBIDEF int   stbi_png_stream_from_memory   (stbi_uc const *buffer, int len, int *x, int *y, int *channels_in_file, int desired_channels, int band_rows, stbi_row_callback *rows, void *user);
+STBIDEF int   stbi_png_stream_from_callbacks(stbi_io_callbacks const *clbk, void *io_user, int *x, int *y, int *channels_in_file, int desired_channels, int band_rows, stbi_row_callback *rows, void *user);
+#ifndef STBI_NO_STDIO
+STBIDEF int   stbi_png_stream               (char const *filename, int *x, int *y, int *channels_in_file, int desired_channels, int band_rows, stbi_row_callback *rows, void *user);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -560,6 +720,13 @@ typedef unsigned char validate_uint32[sizeof(stbi__uint32)==4 ? 1 : -1];
    #define stbi_lrot(x,y)  (((x) << (y)) | ((x) >> (32 - (y))))
 #endif
 
+#ifdef STBI_RETRO_ARENA
+#include "retro_arena.h"
+#define STBI_MALLOC(sz)           retro_arena_malloc(sz)
+#define STBI_REALLOC(p,newsz)     retro_arena_realloc(p,newsz)
+#define STBI_FREE(p)              retro_arena_free(p)
+#endif
+
 #if defined(STBI_MALLOC) && defined(STBI_FREE) && (defined(STBI_REALLOC) || defined(STBI_REALLOC_SIZED))
 // ok
 #elif !defined(STBI_MALLOC) && !defined(STBI_FREE) && !defined(STBI_REALLOC) && !defined(STBI_REALLOC_SIZED)
@@ -578,6 +745,22 @@ typedef unsigned char validate_uint32[sizeof(stbi__uint32)==4 ? 1 : -1];
 #define STBI_REALLOC_SIZED(p,oldsz,newsz) STBI_REALLOC(p,newsz)
 #endif
 
+#ifndef STBI_NO_THREAD_LOCALS
+   #if defined(__cplusplus) && __cplusplus >= 201103L
+      #define STBI_THREAD_LOCAL       thread_local
+   #elif defined(_MSC_VER)
+      #define STBI_THREAD_LOCAL       __declspec(thread)
+   #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+      #define STBI_THREAD_LOCAL       _Thread_local
+   #elif defined(__GNUC__)
+      #define STBI_THREAD_LOCAL       __thread
+   #endif
+#endif
+
+#ifndef STBI_THREAD_LOCAL
+#define STBI_THREAD_LOCAL
+#endif
+
 // x86/x64 detection
 #if defined(__x86_64__) || defined(_M_X64)
 #define STBI__X64_TARGET
@@ -658,6 +841,13 @@ static int stbi__sse2_available(void)
 #endif
 #endif
 
+// AVX2 is only used when the compiler targets it anyway (e.g. -mavx2 or
+// /arch:AVX2), so it doesn't need a run-time test of its own
+#if defined(STBI_SSE2) && defined(__AVX2__) && !defined(STBI_NO_AVX2)
+#define STBI_AVX2
+#include <immintrin.h>
+#endif
+
 // ARM NEON
 #if defined(STBI_NO_SIMD) && defined(STBI_NEON)
 #undef STBI_NEON
@@ -693,6 +883,8 @@ typedef struct
 
    stbi_uc *img_buffer, *img_buffer_end;
    stbi_uc *img_buffer_original, *img_buffer_original_end;
+
+   stbi_output_buffer const *out; // if decoding for stbi_load_from_memory_into
 } stbi__context;
 
 
@@ -703,6 +895,7 @@ static void stbi__start_mem(stbi__context *s, stbi_uc const *buffer, int len)
 {
    s->io.read = NULL;
    s->read_from_callbacks = 0;
+   s->out = NULL;
    s->img_buffer = s->img_buffer_original = (stbi_uc *) buffer;
    s->img_buffer_end = s->img_buffer_original_end = (stbi_uc *) buffer+len;
 }
@@ -714,6 +907,7 @@ static void stbi__start_callbacks(stbi__context *s, stbi_io_callbacks *c, void *
    s->io_user_data = user;
    s->buflen = sizeof(s->buffer_start);
    s->read_from_callbacks = 1;
+   s->out = NULL;
    s->img_buffer_original = s->buffer_start;
    stbi__refill_buffer(s);
    s->img_buffer_original_end = s->img_buffer_end;
@@ -828,8 +1022,8 @@ static void    *stbi__pnm_load(stbi__context *s, int *x, int *y, int *comp, int
 static int      stbi__pnm_info(stbi__context *s, int *x, int *y, int *comp);
 #endif
 
-// this is not threadsafe
-static const char *stbi__g_failure_reason;
+// one per thread if the compiler has thread-locals, otherwise not threadsafe
+static STBI_THREAD_LOCAL const char *stbi__g_failure_reason;
 
 STBIDEF const char *stbi_failure_reason(void)
 {
@@ -842,11 +1036,38 @@ static int stbi__err(const char *str)
    return 0;
 }
 
+// scratch allocator of the stbi_load_from_memory_into() call running on
+// this thread, if any
+static STBI_THREAD_LOCAL stbi_allocator const *stbi__g_allocator;
+
 static void *stbi__malloc(size_t size)
 {
+    if (stbi__g_allocator)
+       return stbi__g_allocator->alloc(stbi__g_allocator->user, size);
     return STBI_MALLOC(size);
 }
 
+static void stbi__free(void *p)
+{
+    if (stbi__g_allocator) {
+       if (p) stbi__g_allocator->free(stbi__g_allocator->user, p);
+    } else
+       STBI_FREE(p);
+}
+
+static void *stbi__realloc_sized(void *p, size_t oldsz, size_t newsz)
+{
+    void *q;
+    if (!stbi__g_allocator)
+       return STBI_REALLOC_SIZED(p, oldsz, newsz);
+    q = stbi__g_allocator->alloc(stbi__g_allocator->user, newsz);
+    if (q && p) {
+       memcpy(q, p, oldsz < newsz ? oldsz : newsz);
+       stbi__g_allocator->free(stbi__g_allocator->user, p);
+    }
+    return q;
+}
+
 // stb_image uses ints pervasively, including for offset calculations.
 // therefore the largest decoded image size we can support with the
 // current code, even on 64-bit targets, is INT_MAX. this is not a
@@ -953,6 +1174,13 @@ STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip)
     stbi__vertically_flip_on_load = flag_true_if_should_flip;
 }
 
+static int stbi__jpeg_downscale_shift = 0;
+
+STBIDEF void stbi_set_jpeg_downscale_on_load(int factor)
+{
+    stbi__jpeg_downscale_shift = factor == 8 ? 3 : factor == 4 ? 2 : factor == 2 ? 1 : 0;
+}
+
 static void *stbi__load_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri, int bpc)
 {
    memset(ri, 0, sizeof(*ri)); // make sure it's initialized if we add new fields
@@ -1010,7 +1238,7 @@ static stbi_uc *stbi__convert_16_to_8(stbi__uint16 *orig, int w, int h, int chan
    for (i = 0; i < img_len; ++i)
       reduced[i] = (stbi_uc)((orig[i] >> 8) & 0xFF); // top half of each byte is sufficient approx of 16->8 bit scaling
 
-   STBI_FREE(orig);
+   stbi__free(orig);
    return reduced;
 }
 
@@ -1026,7 +1254,7 @@ static stbi__uint16 *stbi__convert_8_to_16(stbi_uc *orig, int w, int h, int chan
    for (i = 0; i < img_len; ++i)
       enlarged[i] = (stbi__uint16)((orig[i] << 8) + orig[i]); // replicate to high and low byte, maps 0->0, 255->0xffff
 
-   STBI_FREE(orig);
+   stbi__free(orig);
    return enlarged;
 }
 
@@ -1205,6 +1433,80 @@ STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk, void *u
    return stbi__load_and_postprocess_8bit(&s,x,y,comp,req_comp);
 }
 
+static int stbi__output_fits(stbi_output_buffer const *out, int x, int y)
+{
+   int row = x * out->channels;
+   if (out->stride < row) return 0;
+   return (size_t) out->stride * (y-1) + row <= out->size;
+}
+
+// copy a tightly packed image to the output buffer, or with src == NULL
+// just apply the channel order to pixels already stored there
+static void stbi__copy_to_output(stbi_output_buffer const *out, stbi_uc const *src, int x, int y)
+{
+   int i, j, n = out->channels;
+   for (j=0; j < y; ++j) {
+      stbi_uc *d = out->pixels + (size_t) out->stride * j;
+      if (src) memcpy(d, src + (size_t) x * n * j, (size_t) x * n);
+      if (out->bgr && n >= 3)
+         for (i=0; i < x*n; i += n) {
+            stbi_uc t = d[i];
+            d[i] = d[i+2];
+            d[i+2] = t;
+         }
+   }
+}
+
+STBIDEF int stbi_load_from_memory_into(stbi_uc const *buffer, int len, int *x, int *y, int *comp, stbi_output_buffer const *out, stbi_allocator const *alloc)
+{
+   stbi__context s;
+   stbi_allocator const *prev = stbi__g_allocator;
+   stbi_uc *result;
+   int ok = 0;
+
+   if (out->channels < 1 || out->channels > 4) return stbi__err("bad req_comp", "Internal error");
+   stbi__start_mem(&s,buffer,len);
+   s.out = out;
+   stbi__g_allocator = alloc;
+   result = stbi__load_and_postprocess_8bit(&s,x,y,comp,out->channels);
+   if (result == out->pixels) {
+      // decoded in place
+      stbi__copy_to_output(out, NULL, *x, *y);
+      ok = 1;
+   } else if (result) {
+      if (stbi__output_fits(out, *x, *y)) {
+         stbi__copy_to_output(out, result, *x, *y);
+         ok = 1;
+      } else
+         stbi__err("output too small", "Output buffer too small for image");
+      stbi__free(result);
+   }
+   stbi__g_allocator = prev;
+   return ok;
+}
+
+static void stbi__batch_load_job(void *job_data, int job_index)
+{
+   stbi_batch_image *img = (stbi_batch_image *) job_data + job_index;
+   img->x = img->y = img->channels_in_file = 0;
+   img->data = stbi_load_from_memory(img->buffer, img->len, &img->x, &img->y, &img->channels_in_file, img->desired_channels);
+   img->failure_reason = img->data ? NULL : stbi_failure_reason();
+}
+
+STBIDEF int stbi_load_batch_from_memory(stbi_batch_image *images, int count, stbi_batch_run_jobs *run_jobs, void *user)
+{
+   int i, n = 0;
+   if (count <= 0) return 0;
+   if (run_jobs)
+      run_jobs(user, stbi__batch_load_job, images, count);
+   else
+      for (i=0; i < count; ++i)
+         stbi__batch_load_job(images, i);
+   for (i=0; i < count; ++i)
+      if (images[i].data) ++n;
+   return n;
+}
+
 #ifndef STBI_NO_LINEAR
 static float *stbi__loadf_main(stbi__context *s, int *x, int *y, int *comp, int req_comp)
 {
@@ -1336,7 +1638,8 @@ enum
 {
    STBI__SCAN_load=0,
    STBI__SCAN_type,
-   STBI__SCAN_header
+   STBI__SCAN_header,
+   STBI__SCAN_stream  // png only: decode rows to a stbi_row_callback
 };
 
 static void stbi__refill_buffer(stbi__context *s)
@@ -1468,9 +1771,34 @@ static stbi_uc stbi__compute_y(int r, int g, int b)
    return (stbi_uc) (((r*77) + (g*150) +  (29*b)) >> 8);
 }
 
+static void stbi__convert_format_row(unsigned char const *src, int img_n, unsigned char *dest, int req_comp, unsigned int x)
+{
+   int i;
+   #define STBI__COMBO(a,b)  ((a)*8+(b))
+   #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
+   // convert source image with img_n components to one with req_comp components;
+   // avoid switch per pixel, so use switch per scanline and massive macros
+   switch (STBI__COMBO(img_n, req_comp)) {
+      STBI__CASE(1,2) { dest[0]=src[0], dest[1]=255;                                     } break;
+      STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
+      STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0], dest[3]=255;                     } break;
+      STBI__CASE(2,1) { dest[0]=src[0];                                                  } break;
+      STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
+      STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0], dest[3]=src[1];                  } break;
+      STBI__CASE(3,4) { dest[0]=src[0],dest[1]=src[1],dest[2]=src[2],dest[3]=255;        } break;
+      STBI__CASE(3,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(3,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]), dest[1] = 255;    } break;
+      STBI__CASE(4,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(4,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]), dest[1] = src[3]; } break;
+      STBI__CASE(4,3) { dest[0]=src[0],dest[1]=src[1],dest[2]=src[2];                    } break;
+      default: STBI_ASSERT(0);
+   }
+   #undef STBI__CASE
+}
+
 static unsigned char *stbi__convert_format(unsigned char *data, int img_n, int req_comp, unsigned int x, unsigned int y)
 {
-   int i,j;
+   int j;
    unsigned char *good;
 
    if (req_comp == img_n) return data;
@@ -1478,37 +1806,14 @@ static unsigned char *stbi__convert_format(unsigned char *data, int img_n, int r
 
    good = (unsigned char *) stbi__malloc_mad3(req_comp, x, y, 0);
    if (good == NULL) {
-      STBI_FREE(data);
+      stbi__free(data);
       return stbi__errpuc("outofmem", "Out of memory");
    }
 
-   for (j=0; j < (int) y; ++j) {
-      unsigned char *src  = data + j * x * img_n   ;
-      unsigned char *dest = good + j * x * req_comp;
-
-      #define STBI__COMBO(a,b)  ((a)*8+(b))
-      #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
-      // convert source image with img_n components to one with req_comp components;
-      // avoid switch per pixel, so use switch per scanline and massive macros
-      switch (STBI__COMBO(img_n, req_comp)) {
-         STBI__CASE(1,2) { dest[0]=src[0], dest[1]=255;                                     } break;
-         STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
-         STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0], dest[3]=255;                     } break;
-         STBI__CASE(2,1) { dest[0]=src[0];                                                  } break;
-         STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
-         STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0], dest[3]=src[1];                  } break;
-         STBI__CASE(3,4) { dest[0]=src[0],dest[1]=src[1],dest[2]=src[2],dest[3]=255;        } break;
-         STBI__CASE(3,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(3,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]), dest[1] = 255;    } break;
-         STBI__CASE(4,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(4,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]), dest[1] = src[3]; } break;
-         STBI__CASE(4,3) { dest[0]=src[0],dest[1]=src[1],dest[2]=src[2];                    } break;
-         default: STBI_ASSERT(0);
-      }
-      #undef STBI__CASE
-   }
+   for (j=0; j < (int) y; ++j)
+      stbi__convert_format_row(data + j * x * img_n, img_n, good + j * x * req_comp, req_comp, x);
 
-   STBI_FREE(data);
+   stbi__free(data);
    return good;
 }
 
@@ -1527,7 +1832,7 @@ static stbi__uint16 *stbi__convert_format16(stbi__uint16 *data, int img_n, int r
 
    good = (stbi__uint16 *) stbi__malloc(req_comp * x * y * 2);
    if (good == NULL) {
-      STBI_FREE(data);
+      stbi__free(data);
       return (stbi__uint16 *) stbi__errpuc("outofmem", "Out of memory");
    }
 
@@ -1557,7 +1862,7 @@ static stbi__uint16 *stbi__convert_format16(stbi__uint16 *data, int img_n, int r
       #undef STBI__CASE
    }
 
-   STBI_FREE(data);
+   stbi__free(data);
    return good;
 }
 
@@ -1568,7 +1873,7 @@ static float   *stbi__ldr_to_hdr(stbi_uc *data, int x, int y, int comp)
    float *output;
    if (!data) return NULL;
    output = (float *) stbi__malloc_mad4(x, y, comp, sizeof(float), 0);
-   if (output == NULL) { STBI_FREE(data); return stbi__errpf("outofmem", "Out of memory"); }
+   if (output == NULL) { stbi__free(data); return stbi__errpf("outofmem", "Out of memory"); }
    // compute number of non-alpha components
    if (comp & 1) n = comp; else n = comp-1;
    for (i=0; i < x*y; ++i) {
@@ -1577,7 +1882,7 @@ static float   *stbi__ldr_to_hdr(stbi_uc *data, int x, int y, int comp)
       }
       if (k < comp) output[i*comp + k] = data[i*comp+k]/255.0f;
    }
-   STBI_FREE(data);
+   stbi__free(data);
    return output;
 }
 #endif
@@ -1590,7 +1895,7 @@ static stbi_uc *stbi__hdr_to_ldr(float   *data, int x, int y, int comp)
    stbi_uc *output;
    if (!data) return NULL;
    output = (stbi_uc *) stbi__malloc_mad3(x, y, comp, 0);
-   if (output == NULL) { STBI_FREE(data); return stbi__errpuc("outofmem", "Out of memory"); }
+   if (output == NULL) { stbi__free(data); return stbi__errpuc("outofmem", "Out of memory"); }
    // compute number of non-alpha components
    if (comp & 1) n = comp; else n = comp-1;
    for (i=0; i < x*y; ++i) {
@@ -1607,7 +1912,7 @@ static stbi_uc *stbi__hdr_to_ldr(float   *data, int x, int y, int comp)
          output[i*comp + k] = (stbi_uc) stbi__float2int(z);
       }
    }
-   STBI_FREE(data);
+   stbi__free(data);
    return output;
 }
 #endif
@@ -1696,11 +2001,13 @@ typedef struct
 
    int scan_n, order[4];
    int restart_interval, todo;
+   int scale; // log2 of the downscale factor, see stbi_set_jpeg_downscale_on_load
 
 // kernels
    void (*idct_block_kernel)(stbi_uc *out, int out_stride, short data[64]);
    void (*YCbCr_to_RGB_kernel)(stbi_uc *out, const stbi_uc *y, const stbi_uc *pcb, const stbi_uc *pcr, int count, int step);
    stbi_uc *(*resample_row_hv_2_kernel)(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs);
+   void (*YCbCr_h2_to_RGB_kernel)(stbi_uc *out, stbi_uc const *y, stbi_uc const *cb_near, stbi_uc const *cb_far, stbi_uc const *cr_near, stbi_uc const *cr_far, int w, int count, int step);
 } stbi__jpeg;
 
 static int stbi__build_huffman(stbi__huffman *h, int *count)
@@ -2211,6 +2518,66 @@ static void stbi__idct_block(stbi_uc *out, int out_stride, short data[64])
    }
 }
 
+// reduced IDCTs for stbi_set_jpeg_downscale_on_load(). an n x n block is
+// computed from the lowest n x n coefficients, with the cosines weighted so
+// that each output is the average of the (8/n) x (8/n) pixels it replaces,
+// as far as those low frequencies go. k[x*n+u] is 1/2 C(u) cos((2x+1)u pi/2n)
+// times that weight, scaled by 1<<12
+stbi_inline static void stbi__idct_reduced(stbi_uc *out, int out_stride, short data[64], int n, const int *k)
+{
+   int i,j,u,val[16];
+
+   // columns, descaled back to coefficient precision
+   for (u=0; u < n; ++u) {
+      int v, ac = 0;
+      for (v=1; v < n; ++v)
+         ac |= data[v*8+u];
+      for (j=0; j < n; ++j) {
+         int t = 2048 + k[j*n] * data[u];
+         if (ac) // shortcut for columns with only a DC term, as in stbi__idct_block
+            for (v=1; v < n; ++v)
+               t += k[j*n+v] * data[v*8+u];
+         val[j*n+u] = t >> 12;
+      }
+   }
+
+   // rows, adding the 128 bias before the final descale
+   for (j=0; j < n; ++j, out += out_stride)
+      for (i=0; i < n; ++i) {
+         int t = 2048 + (128<<12);
+         for (u=0; u < n; ++u)
+            t += k[i*n+u] * val[j*n+u];
+         out[i] = stbi__clamp(t >> 12);
+      }
+}
+
+static void stbi__idct_block_4x4(stbi_uc *out, int out_stride, short data[64])
+{
+   static const int k[16] = {
+      stbi__f2f(0.353553391f),  stbi__f2f(0.453063723f),  stbi__f2f(0.326640741f),  stbi__f2f(0.159094823f),
+      stbi__f2f(0.353553391f),  stbi__f2f(0.187665139f), -stbi__f2f(0.326640741f), -stbi__f2f(0.384088878f),
+      stbi__f2f(0.353553391f), -stbi__f2f(0.187665139f), -stbi__f2f(0.326640741f),  stbi__f2f(0.384088878f),
+      stbi__f2f(0.353553391f), -stbi__f2f(0.453063723f),  stbi__f2f(0.326640741f), -stbi__f2f(0.159094823f),
+   };
+   stbi__idct_reduced(out, out_stride, data, 4, k);
+}
+
+static void stbi__idct_block_2x2(stbi_uc *out, int out_stride, short data[64])
+{
+   static const int k[4] = {
+      stbi__f2f(0.353553391f),  stbi__f2f(0.320364431f),
+      stbi__f2f(0.353553391f), -stbi__f2f(0.320364431f),
+   };
+   stbi__idct_reduced(out, out_stride, data, 2, k);
+}
+
+static void stbi__idct_block_1x1(stbi_uc *out, int out_stride, short data[64])
+{
+   // the DC coefficient is 8 times the average
+   STBI_NOTUSED(out_stride);
+   out[0] = stbi__clamp((data[0] + 1024 + 4) >> 3);
+}
+
 #ifdef STBI_SSE2
 // sse2 integer IDCT. not the fastest possible implementation but it
 // produces bit-identical results to the generic C version so it's
@@ -2652,7 +3019,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
             for (i=0; i < w; ++i) {
                int ha = z->img_comp[n].ha;
                if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               z->idct_block_kernel(z->img_comp[n].data+(z->img_comp[n].w2*j+i)*(8>>z->scale), z->img_comp[n].w2, data);
                // every data block is an MCU, so countdown the restart interval
                if (--z->todo <= 0) {
                   if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
@@ -2676,8 +3043,8 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
                   // by the basic H and V specified for the component
                   for (y=0; y < z->img_comp[n].v; ++y) {
                      for (x=0; x < z->img_comp[n].h; ++x) {
-                        int x2 = (i*z->img_comp[n].h + x)*8;
-                        int y2 = (j*z->img_comp[n].v + y)*8;
+                        int x2 = (i*z->img_comp[n].h + x)*(8>>z->scale);
+                        int y2 = (j*z->img_comp[n].v + y)*(8>>z->scale);
                         int ha = z->img_comp[n].ha;
                         if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
                         z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
@@ -2761,6 +3128,20 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
 static void stbi__jpeg_dequantize(short *data, stbi__uint16 *dequant)
 {
    int i;
+#if defined(STBI_SSE2)
+   if (stbi__sse2_available()) {
+      for (i=0; i < 64; i += 8) {
+         __m128i d = _mm_loadu_si128((__m128i *) (data + i));
+         __m128i q = _mm_loadu_si128((__m128i *) (dequant + i));
+         _mm_storeu_si128((__m128i *) (data + i), _mm_mullo_epi16(d, q));
+      }
+      return;
+   }
+#elif defined(STBI_NEON)
+   for (i=0; i < 64; i += 8)
+      vst1q_s16(data + i, vmulq_s16(vld1q_s16(data + i), vreinterpretq_s16_u16(vld1q_u16(dequant + i))));
+   return;
+#endif
    for (i=0; i < 64; ++i)
       data[i] *= dequant[i];
 }
@@ -2777,7 +3158,7 @@ static void stbi__jpeg_finish(stbi__jpeg *z)
             for (i=0; i < w; ++i) {
                short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
                stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               z->idct_block_kernel(z->img_comp[n].data+(z->img_comp[n].w2*j+i)*(8>>z->scale), z->img_comp[n].w2, data);
             }
          }
       }
@@ -2931,17 +3312,17 @@ static int stbi__free_jpeg_components(stbi__jpeg *z, int ncomp, int why)
    int i;
    for (i=0; i < ncomp; ++i) {
       if (z->img_comp[i].raw_data) {
-         STBI_FREE(z->img_comp[i].raw_data);
+         stbi__free(z->img_comp[i].raw_data);
          z->img_comp[i].raw_data = NULL;
          z->img_comp[i].data = NULL;
       }
       if (z->img_comp[i].raw_coeff) {
-         STBI_FREE(z->img_comp[i].raw_coeff);
+         stbi__free(z->img_comp[i].raw_coeff);
          z->img_comp[i].raw_coeff = 0;
          z->img_comp[i].coeff = 0;
       }
       if (z->img_comp[i].linebuf) {
-         STBI_FREE(z->img_comp[i].linebuf);
+         stbi__free(z->img_comp[i].linebuf);
          z->img_comp[i].linebuf = NULL;
       }
    }
@@ -3007,8 +3388,8 @@ static int stbi__process_frame_header(stbi__jpeg *z, int scan)
       //
       // img_mcu_x, img_mcu_y: <=17 bits; comp[i].h and .v are <=4 (checked earlier)
       // so these muls can't overflow with 32-bit ints (which we require)
-      z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * 8;
-      z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * 8;
+      z->img_comp[i].w2 = (z->img_mcu_x * z->img_comp[i].h * 8) >> z->scale;
+      z->img_comp[i].h2 = (z->img_mcu_y * z->img_comp[i].v * 8) >> z->scale;
       z->img_comp[i].coeff = 0;
       z->img_comp[i].raw_coeff = 0;
       z->img_comp[i].linebuf = NULL;
@@ -3018,10 +3399,9 @@ static int stbi__process_frame_header(stbi__jpeg *z, int scan)
       // align blocks for idct using mmx/sse
       z->img_comp[i].data = (stbi_uc*) (((size_t) z->img_comp[i].raw_data + 15) & ~15);
       if (z->progressive) {
-         // w2, h2 are multiples of 8 (see above)
-         z->img_comp[i].coeff_w = z->img_comp[i].w2 / 8;
-         z->img_comp[i].coeff_h = z->img_comp[i].h2 / 8;
-         z->img_comp[i].raw_coeff = stbi__malloc_mad3(z->img_comp[i].w2, z->img_comp[i].h2, sizeof(short), 15);
+         z->img_comp[i].coeff_w = z->img_mcu_x * z->img_comp[i].h;
+         z->img_comp[i].coeff_h = z->img_mcu_y * z->img_comp[i].v;
+         z->img_comp[i].raw_coeff = stbi__malloc_mad3(z->img_comp[i].coeff_w * 64, z->img_comp[i].coeff_h, sizeof(short), 15);
          if (z->img_comp[i].raw_coeff == NULL)
             return stbi__free_jpeg_components(z, i+1, stbi__err("outofmem", "Out of memory"));
          z->img_comp[i].coeff = (short*) (((size_t) z->img_comp[i].raw_coeff + 15) & ~15);
@@ -3341,117 +3721,210 @@ static void stbi__YCbCr_to_RGB_row(stbi_uc *out, const stbi_uc *y, const stbi_uc
    }
 }
 
+#ifdef STBI_SSE2
+// 8 pixels of YCbCr to RGBX, as two registers of 4 pixels each
+static void stbi__YCbCr_to_RGBX_sse2(__m128i *o0, __m128i *o1, __m128i y_bytes, __m128i cb_bytes, __m128i cr_bytes)
+{
+   // this is a fairly straightforward implementation and not super-optimized.
+   __m128i signflip  = _mm_set1_epi8(-0x80);
+   __m128i cr_const0 = _mm_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+   __m128i cr_const1 = _mm_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+   __m128i cb_const0 = _mm_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+   __m128i cb_const1 = _mm_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+   __m128i y_bias = _mm_set1_epi8((char) (unsigned char) 128);
+   __m128i xw = _mm_set1_epi16(255); // alpha channel
+
+   __m128i cr_biased = _mm_xor_si128(cr_bytes, signflip); // -128
+   __m128i cb_biased = _mm_xor_si128(cb_bytes, signflip); // -128
+
+   // unpack to short (and left-shift cr, cb by 8)
+   __m128i yw  = _mm_unpacklo_epi8(y_bias, y_bytes);
+   __m128i crw = _mm_unpacklo_epi8(_mm_setzero_si128(), cr_biased);
+   __m128i cbw = _mm_unpacklo_epi8(_mm_setzero_si128(), cb_biased);
+
+   // color transform
+   __m128i yws = _mm_srli_epi16(yw, 4);
+   __m128i cr0 = _mm_mulhi_epi16(cr_const0, crw);
+   __m128i cb0 = _mm_mulhi_epi16(cb_const0, cbw);
+   __m128i cb1 = _mm_mulhi_epi16(cbw, cb_const1);
+   __m128i cr1 = _mm_mulhi_epi16(crw, cr_const1);
+   __m128i rws = _mm_add_epi16(cr0, yws);
+   __m128i gwt = _mm_add_epi16(cb0, yws);
+   __m128i bws = _mm_add_epi16(yws, cb1);
+   __m128i gws = _mm_add_epi16(gwt, cr1);
+
+   // descale
+   __m128i rw = _mm_srai_epi16(rws, 4);
+   __m128i bw = _mm_srai_epi16(bws, 4);
+   __m128i gw = _mm_srai_epi16(gws, 4);
+
+   // back to byte, set up for transpose
+   __m128i brb = _mm_packus_epi16(rw, bw);
+   __m128i gxb = _mm_packus_epi16(gw, xw);
+
+   // transpose to interleave channels
+   __m128i t0 = _mm_unpacklo_epi8(brb, gxb);
+   __m128i t1 = _mm_unpackhi_epi8(brb, gxb);
+   *o0 = _mm_unpacklo_epi16(t0, t1);
+   *o1 = _mm_unpackhi_epi16(t0, t1);
+}
+
+// squeeze 4 RGBX pixels into the bottom 12 bytes
+static __m128i stbi__RGBX_to_RGB_sse2(__m128i v)
+{
+   __m128i lo32 = _mm_set_epi32(0, -1, 0, -1);
+   __m128i lo64 = _mm_set_epi32(0, 0, -1, -1);
+   __m128i rgb  = _mm_and_si128(v, _mm_set1_epi32(0x00ffffff));
+   // odd pixels move down a byte to follow the even ones, then the upper
+   // half moves down two bytes to follow the lower one
+   __m128i q    = _mm_or_si128(_mm_and_si128(rgb, lo32), _mm_srli_epi64(_mm_andnot_si128(lo32, rgb), 8));
+   return _mm_or_si128(_mm_and_si128(q, lo64), _mm_srli_si128(_mm_andnot_si128(lo64, q), 2));
+}
+
+// store 8 pixels from stbi__YCbCr_to_RGBX_sse2 with step 3 or 4
+static void stbi__store_RGB_sse2(stbi_uc *out, __m128i o0, __m128i o1, int step)
+{
+   if (step == 4) {
+      _mm_storeu_si128((__m128i *) (out + 0), o0);
+      _mm_storeu_si128((__m128i *) (out + 16), o1);
+   } else {
+      __m128i p0 = stbi__RGBX_to_RGB_sse2(o0);
+      __m128i p1 = stbi__RGBX_to_RGB_sse2(o1);
+      _mm_storeu_si128((__m128i *) (out + 0), _mm_or_si128(p0, _mm_slli_si128(p1, 12)));
+      _mm_storel_epi64((__m128i *) (out + 16), _mm_srli_si128(p1, 4));
+   }
+}
+#endif
+
+#ifdef STBI_AVX2
+// 16 pixels at once; the same math as stbi__YCbCr_to_RGBX_sse2, so the
+// results are identical
+static void stbi__YCbCr_to_RGB16_avx2(stbi_uc *out, __m128i y_bytes, __m128i cb_bytes, __m128i cr_bytes, int step)
+{
+   __m128i signflip  = _mm_set1_epi8(-0x80);
+   __m256i cr_const0 = _mm256_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+   __m256i cr_const1 = _mm256_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+   __m256i cb_const0 = _mm256_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+   __m256i cb_const1 = _mm256_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+   __m256i xw = _mm256_set1_epi16(255); // alpha channel
+
+   // widen to short: y*256 + 128 and (c-128)*256, as the SSE2 unpacks do
+   __m256i yw  = _mm256_or_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(y_bytes), 8), _mm256_set1_epi16(128));
+   __m256i crw = _mm256_slli_epi16(_mm256_cvtepi8_epi16(_mm_xor_si128(cr_bytes, signflip)), 8);
+   __m256i cbw = _mm256_slli_epi16(_mm256_cvtepi8_epi16(_mm_xor_si128(cb_bytes, signflip)), 8);
+
+   // color transform
+   __m256i yws = _mm256_srli_epi16(yw, 4);
+   __m256i cr0 = _mm256_mulhi_epi16(cr_const0, crw);
+   __m256i cb0 = _mm256_mulhi_epi16(cb_const0, cbw);
+   __m256i cb1 = _mm256_mulhi_epi16(cbw, cb_const1);
+   __m256i cr1 = _mm256_mulhi_epi16(crw, cr_const1);
+   __m256i rws = _mm256_add_epi16(cr0, yws);
+   __m256i gwt = _mm256_add_epi16(cb0, yws);
+   __m256i bws = _mm256_add_epi16(yws, cb1);
+   __m256i gws = _mm256_add_epi16(gwt, cr1);
+
+   // descale
+   __m256i rw = _mm256_srai_epi16(rws, 4);
+   __m256i bw = _mm256_srai_epi16(bws, 4);
+   __m256i gw = _mm256_srai_epi16(gws, 4);
+
+   // back to byte and interleave; everything works within 128-bit lanes,
+   // so o0 ends up with pixels 0-3 and 8-11, o1 with 4-7 and 12-15
+   __m256i brb = _mm256_packus_epi16(rw, bw);
+   __m256i gxb = _mm256_packus_epi16(gw, xw);
+   __m256i t0  = _mm256_unpacklo_epi8(brb, gxb);
+   __m256i t1  = _mm256_unpackhi_epi8(brb, gxb);
+   __m256i o0  = _mm256_unpacklo_epi16(t0, t1);
+   __m256i o1  = _mm256_unpackhi_epi16(t0, t1);
+   __m256i p0  = _mm256_permute2x128_si256(o0, o1, 0x20); // pixels 0-7
+   __m256i p1  = _mm256_permute2x128_si256(o0, o1, 0x31); // pixels 8-15
+
+   if (step == 4) {
+      _mm256_storeu_si256((__m256i *) (out + 0), p0);
+      _mm256_storeu_si256((__m256i *) (out + 32), p1);
+   } else {
+      stbi__store_RGB_sse2(out +  0, _mm256_castsi256_si128(p0), _mm256_extracti128_si256(p0, 1), 3);
+      stbi__store_RGB_sse2(out + 24, _mm256_castsi256_si128(p1), _mm256_extracti128_si256(p1, 1), 3);
+   }
+}
+#endif
+
+#ifdef STBI_NEON
+// 8 pixels of YCbCr to RGB(X) with step 3 or 4
+static void stbi__YCbCr_to_RGB8_neon(stbi_uc *out, uint8x8_t y_bytes, uint8x8_t cb_bytes, uint8x8_t cr_bytes, int step)
+{
+   // this is a fairly straightforward implementation and not super-optimized.
+   uint8x8_t signflip = vdup_n_u8(0x80);
+   int16x8_t cr_const0 = vdupq_n_s16(   (short) ( 1.40200f*4096.0f+0.5f));
+   int16x8_t cr_const1 = vdupq_n_s16( - (short) ( 0.71414f*4096.0f+0.5f));
+   int16x8_t cb_const0 = vdupq_n_s16( - (short) ( 0.34414f*4096.0f+0.5f));
+   int16x8_t cb_const1 = vdupq_n_s16(   (short) ( 1.77200f*4096.0f+0.5f));
+
+   int8x8_t cr_biased = vreinterpret_s8_u8(vsub_u8(cr_bytes, signflip));
+   int8x8_t cb_biased = vreinterpret_s8_u8(vsub_u8(cb_bytes, signflip));
+
+   // expand to s16
+   int16x8_t yws = vreinterpretq_s16_u16(vshll_n_u8(y_bytes, 4));
+   int16x8_t crw = vshll_n_s8(cr_biased, 7);
+   int16x8_t cbw = vshll_n_s8(cb_biased, 7);
+
+   // color transform
+   int16x8_t cr0 = vqdmulhq_s16(crw, cr_const0);
+   int16x8_t cb0 = vqdmulhq_s16(cbw, cb_const0);
+   int16x8_t cr1 = vqdmulhq_s16(crw, cr_const1);
+   int16x8_t cb1 = vqdmulhq_s16(cbw, cb_const1);
+   int16x8_t rws = vaddq_s16(yws, cr0);
+   int16x8_t gws = vaddq_s16(vaddq_s16(yws, cb0), cr1);
+   int16x8_t bws = vaddq_s16(yws, cb1);
+
+   // undo scaling, round, convert to byte
+   uint8x8x4_t o;
+   o.val[0] = vqrshrun_n_s16(rws, 4);
+   o.val[1] = vqrshrun_n_s16(gws, 4);
+   o.val[2] = vqrshrun_n_s16(bws, 4);
+   o.val[3] = vdup_n_u8(255);
+
+   // store, interleaving r/g/b(/a)
+   if (step == 4) {
+      vst4_u8(out, o);
+   } else {
+      uint8x8x3_t o3;
+      o3.val[0] = o.val[0];
+      o3.val[1] = o.val[1];
+      o3.val[2] = o.val[2];
+      vst3_u8(out, o3);
+   }
+}
+#endif
+
 #if defined(STBI_SSE2) || defined(STBI_NEON)
 static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc const *pcb, stbi_uc const *pcr, int count, int step)
 {
    int i = 0;
 
+   if (step == 3 || step == 4) {
+#ifdef STBI_AVX2
+      for (; i+15 < count; i += 16) {
+         stbi__YCbCr_to_RGB16_avx2(out, _mm_loadu_si128((__m128i *) (y+i)), _mm_loadu_si128((__m128i *) (pcb+i)), _mm_loadu_si128((__m128i *) (pcr+i)), step);
+         out += 16*step;
+      }
+#endif
 #ifdef STBI_SSE2
-   // step == 3 is pretty ugly on the final interleave, and i'm not convinced
-   // it's useful in practice (you wouldn't use it for textures, for example).
-   // so just accelerate step == 4 case.
-   if (step == 4) {
-      // this is a fairly straightforward implementation and not super-optimized.
-      __m128i signflip  = _mm_set1_epi8(-0x80);
-      __m128i cr_const0 = _mm_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
-      __m128i cr_const1 = _mm_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
-      __m128i cb_const0 = _mm_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
-      __m128i cb_const1 = _mm_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
-      __m128i y_bias = _mm_set1_epi8((char) (unsigned char) 128);
-      __m128i xw = _mm_set1_epi16(255); // alpha channel
-
       for (; i+7 < count; i += 8) {
-         // load
-         __m128i y_bytes = _mm_loadl_epi64((__m128i *) (y+i));
-         __m128i cr_bytes = _mm_loadl_epi64((__m128i *) (pcr+i));
-         __m128i cb_bytes = _mm_loadl_epi64((__m128i *) (pcb+i));
-         __m128i cr_biased = _mm_xor_si128(cr_bytes, signflip); // -128
-         __m128i cb_biased = _mm_xor_si128(cb_bytes, signflip); // -128
-
-         // unpack to short (and left-shift cr, cb by 8)
-         __m128i yw  = _mm_unpacklo_epi8(y_bias, y_bytes);
-         __m128i crw = _mm_unpacklo_epi8(_mm_setzero_si128(), cr_biased);
-         __m128i cbw = _mm_unpacklo_epi8(_mm_setzero_si128(), cb_biased);
-
-         // color transform
-         __m128i yws = _mm_srli_epi16(yw, 4);
-         __m128i cr0 = _mm_mulhi_epi16(cr_const0, crw);
-         __m128i cb0 = _mm_mulhi_epi16(cb_const0, cbw);
-         __m128i cb1 = _mm_mulhi_epi16(cbw, cb_const1);
-         __m128i cr1 = _mm_mulhi_epi16(crw, cr_const1);
-         __m128i rws = _mm_add_epi16(cr0, yws);
-         __m128i gwt = _mm_add_epi16(cb0, yws);
-         __m128i bws = _mm_add_epi16(yws, cb1);
-         __m128i gws = _mm_add_epi16(gwt, cr1);
-
-         // descale
-         __m128i rw = _mm_srai_epi16(rws, 4);
-         __m128i bw = _mm_srai_epi16(bws, 4);
-         __m128i gw = _mm_srai_epi16(gws, 4);
-
-         // back to byte, set up for transpose
-         __m128i brb = _mm_packus_epi16(rw, bw);
-         __m128i gxb = _mm_packus_epi16(gw, xw);
-
-         // transpose to interleave channels
-         __m128i t0 = _mm_unpacklo_epi8(brb, gxb);
-         __m128i t1 = _mm_unpackhi_epi8(brb, gxb);
-         __m128i o0 = _mm_unpacklo_epi16(t0, t1);
-         __m128i o1 = _mm_unpackhi_epi16(t0, t1);
-
-         // store
-         _mm_storeu_si128((__m128i *) (out + 0), o0);
-         _mm_storeu_si128((__m128i *) (out + 16), o1);
-         out += 32;
+         __m128i o0, o1;
+         stbi__YCbCr_to_RGBX_sse2(&o0, &o1, _mm_loadl_epi64((__m128i *) (y+i)), _mm_loadl_epi64((__m128i *) (pcb+i)), _mm_loadl_epi64((__m128i *) (pcr+i)));
+         stbi__store_RGB_sse2(out, o0, o1, step);
+         out += 8*step;
       }
-   }
 #endif
-
 #ifdef STBI_NEON
-   // in this version, step=3 support would be easy to add. but is there demand?
-   if (step == 4) {
-      // this is a fairly straightforward implementation and not super-optimized.
-      uint8x8_t signflip = vdup_n_u8(0x80);
-      int16x8_t cr_const0 = vdupq_n_s16(   (short) ( 1.40200f*4096.0f+0.5f));
-      int16x8_t cr_const1 = vdupq_n_s16( - (short) ( 0.71414f*4096.0f+0.5f));
-      int16x8_t cb_const0 = vdupq_n_s16( - (short) ( 0.34414f*4096.0f+0.5f));
-      int16x8_t cb_const1 = vdupq_n_s16(   (short) ( 1.77200f*4096.0f+0.5f));
-
       for (; i+7 < count; i += 8) {
-         // load
-         uint8x8_t y_bytes  = vld1_u8(y + i);
-         uint8x8_t cr_bytes = vld1_u8(pcr + i);
-         uint8x8_t cb_bytes = vld1_u8(pcb + i);
-         int8x8_t cr_biased = vreinterpret_s8_u8(vsub_u8(cr_bytes, signflip));
-         int8x8_t cb_biased = vreinterpret_s8_u8(vsub_u8(cb_bytes, signflip));
-
-         // expand to s16
-         int16x8_t yws = vreinterpretq_s16_u16(vshll_n_u8(y_bytes, 4));
-         int16x8_t crw = vshll_n_s8(cr_biased, 7);
-         int16x8_t cbw = vshll_n_s8(cb_biased, 7);
-
-         // color transform
-         int16x8_t cr0 = vqdmulhq_s16(crw, cr_const0);
-         int16x8_t cb0 = vqdmulhq_s16(cbw, cb_const0);
-         int16x8_t cr1 = vqdmulhq_s16(crw, cr_const1);
-         int16x8_t cb1 = vqdmulhq_s16(cbw, cb_const1);
-         int16x8_t rws = vaddq_s16(yws, cr0);
-         int16x8_t gws = vaddq_s16(vaddq_s16(yws, cb0), cr1);
-         int16x8_t bws = vaddq_s16(yws, cb1);
-
-         // undo scaling, round, convert to byte
-         uint8x8x4_t o;
-         o.val[0] = vqrshrun_n_s16(rws, 4);
-         o.val[1] = vqrshrun_n_s16(gws, 4);
-         o.val[2] = vqrshrun_n_s16(bws, 4);
-         o.val[3] = vdup_n_u8(255);
-
-         // store, interleaving r/g/b/a
-         vst4_u8(out, o);
-         out += 8*4;
+         stbi__YCbCr_to_RGB8_neon(out, vld1_u8(y + i), vld1_u8(pcb + i), vld1_u8(pcr + i), step);
+         out += 8*step;
       }
-   }
 #endif
+   }
 
    for (; i < count; ++i) {
       int y_fixed = (y[i] << 20) + (1<<19); // rounding
@@ -3474,20 +3947,119 @@ static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc cons
       out += step;
    }
 }
+
+// 2x2 upsampling of cb and cr (2x1 if the far rows are NULL) fused with the
+// color conversion, without the trip through the line buffers. gives the same
+// results as stbi__resample_row_hv_2 (or _h_2) followed by
+// stbi__YCbCr_to_RGB_simd
+static stbi_uc stbi__h2_sample(stbi_uc const *in_near, stbi_uc const *in_far, int w, int k)
+{
+   int i = k >> 1, j;
+   int t1;
+   if (!in_far) {
+      // stbi__resample_row_h_2 weights the next to last sample this way
+      if (w > 1 && k == w*2-2)
+         return stbi__div4(in_near[w-2]*3 + in_near[w-1] + 2);
+      in_far = in_near;
+   }
+   t1 = 3*in_near[i] + in_far[i];
+   if (k == 0 || k == w*2-1)
+      return stbi__div4(t1+2);
+   j = (k & 1) ? i+1 : i-1;
+   return stbi__div16(3*t1 + 3*in_near[j] + in_far[j] + 8);
+}
+
+static void stbi__YCbCr_h2_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc const *cb_near, stbi_uc const *cb_far, stbi_uc const *cr_near, stbi_uc const *cr_far, int w, int count, int step)
+{
+   int p;
+   stbi_uc const *cb_far4 = cb_far ? cb_far : cb_near;
+   stbi_uc const *cr_far4 = cr_far ? cr_far : cr_near;
+   // 16 output pixels (8 lores samples) at a time. the groups at the edges of
+   // the row are upsampled with scalar code and converted as usual, which
+   // keeps the conversion aligned the same way as the unfused path
+   for (p=0; p < count; p += 16) {
+      int i = p >> 1;
+      if (i >= 1 && i+8 < w && p+16 <= count) {
+#ifdef STBI_SSE2
+         __m128i c16[2];
+         int c;
+         for (c=0; c < 2; ++c) {
+            stbi_uc const *in_near = c ? cr_near : cb_near;
+            stbi_uc const *in_far  = c ? cr_far4 : cb_far4;
+            __m128i zero = _mm_setzero_si128();
+            __m128i pn = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_near + i - 1)), zero);
+            __m128i cn = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_near + i    )), zero);
+            __m128i nn = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_near + i + 1)), zero);
+            __m128i pf = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_far  + i - 1)), zero);
+            __m128i cf = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_far  + i    )), zero);
+            __m128i nf = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (in_far  + i + 1)), zero);
+            // vertical pass, 3*near + far
+            __m128i prev = _mm_add_epi16(_mm_add_epi16(pn, _mm_slli_epi16(pn, 1)), pf);
+            __m128i curr = _mm_add_epi16(_mm_add_epi16(cn, _mm_slli_epi16(cn, 1)), cf);
+            __m128i next = _mm_add_epi16(_mm_add_epi16(nn, _mm_slli_epi16(nn, 1)), nf);
+            // horizontal pass, as in stbi__resample_row_hv_2_simd
+            __m128i curb = _mm_add_epi16(_mm_slli_epi16(curr, 2), _mm_set1_epi16(8));
+            __m128i even = _mm_add_epi16(_mm_sub_epi16(prev, curr), curb);
+            __m128i odd  = _mm_add_epi16(_mm_sub_epi16(next, curr), curb);
+            __m128i de0  = _mm_srli_epi16(_mm_unpacklo_epi16(even, odd), 4);
+            __m128i de1  = _mm_srli_epi16(_mm_unpackhi_epi16(even, odd), 4);
+            c16[c] = _mm_packus_epi16(de0, de1);
+         }
+#ifdef STBI_AVX2
+         stbi__YCbCr_to_RGB16_avx2(out + p*step, _mm_loadu_si128((__m128i *) (y + p)), c16[0], c16[1], step);
+#else
+         {
+            __m128i y16 = _mm_loadu_si128((__m128i *) (y + p));
+            __m128i o0, o1;
+            stbi__YCbCr_to_RGBX_sse2(&o0, &o1, y16, c16[0], c16[1]);
+            stbi__store_RGB_sse2(out + p*step, o0, o1, step);
+            stbi__YCbCr_to_RGBX_sse2(&o0, &o1, _mm_srli_si128(y16, 8), _mm_srli_si128(c16[0], 8), _mm_srli_si128(c16[1], 8));
+            stbi__store_RGB_sse2(out + (p+8)*step, o0, o1, step);
+         }
+#endif
+#endif
+#ifdef STBI_NEON
+         uint8x8_t three = vdup_n_u8(3);
+         uint16x8_t cbp = vmlal_u8(vmovl_u8(vld1_u8(cb_far4 + i - 1)), vld1_u8(cb_near + i - 1), three);
+         uint16x8_t cbc = vmlal_u8(vmovl_u8(vld1_u8(cb_far4 + i    )), vld1_u8(cb_near + i    ), three);
+         uint16x8_t cbn = vmlal_u8(vmovl_u8(vld1_u8(cb_far4 + i + 1)), vld1_u8(cb_near + i + 1), three);
+         uint16x8_t crp = vmlal_u8(vmovl_u8(vld1_u8(cr_far4 + i - 1)), vld1_u8(cr_near + i - 1), three);
+         uint16x8_t crc = vmlal_u8(vmovl_u8(vld1_u8(cr_far4 + i    )), vld1_u8(cr_near + i    ), three);
+         uint16x8_t crn = vmlal_u8(vmovl_u8(vld1_u8(cr_far4 + i + 1)), vld1_u8(cr_near + i + 1), three);
+         // (3*curr + neighbour + 8) >> 4, then interleave even and odd
+         uint8x8x2_t cb16 = vzip_u8(vrshrn_n_u16(vmlaq_n_u16(cbp, cbc, 3), 4), vrshrn_n_u16(vmlaq_n_u16(cbn, cbc, 3), 4));
+         uint8x8x2_t cr16 = vzip_u8(vrshrn_n_u16(vmlaq_n_u16(crp, crc, 3), 4), vrshrn_n_u16(vmlaq_n_u16(crn, crc, 3), 4));
+         stbi__YCbCr_to_RGB8_neon(out + p*step,     vld1_u8(y + p),     cb16.val[0], cr16.val[0], step);
+         stbi__YCbCr_to_RGB8_neon(out + (p+8)*step, vld1_u8(y + p + 8), cb16.val[1], cr16.val[1], step);
+#endif
+      } else {
+         stbi_uc cb[16], cr[16];
+         int k, n = count - p < 16 ? count - p : 16;
+         for (k=0; k < n; ++k) {
+            cb[k] = stbi__h2_sample(cb_near, cb_far, w, p+k);
+            cr[k] = stbi__h2_sample(cr_near, cr_far, w, p+k);
+         }
+         stbi__YCbCr_to_RGB_simd(out + p*step, y + p, cb, cr, n, step);
+      }
+   }
+}
 #endif
 
 // set up the kernels
 static void stbi__setup_jpeg(stbi__jpeg *j)
 {
+   j->scale = 0;
    j->idct_block_kernel = stbi__idct_block;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_row;
    j->resample_row_hv_2_kernel = stbi__resample_row_hv_2;
+   j->YCbCr_h2_to_RGB_kernel = NULL;
 
 #ifdef STBI_SSE2
    if (stbi__sse2_available()) {
       j->idct_block_kernel = stbi__idct_simd;
       j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
       j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
+      j->YCbCr_h2_to_RGB_kernel = stbi__YCbCr_h2_to_RGB_simd;
    }
 #endif
 
@@ -3495,6 +4067,7 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
    j->idct_block_kernel = stbi__idct_simd;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
    j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
+   j->YCbCr_h2_to_RGB_kernel = stbi__YCbCr_h2_to_RGB_simd;
 #endif
 }
 
@@ -3523,7 +4096,7 @@ static stbi_uc stbi__blinn_8x8(stbi_uc x, stbi_uc y)
 
 static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp)
 {
-   int n, decode_n, is_rgb;
+   int n, decode_n, is_rgb, fused, stride;
    z->s->img_n = 0; // make stbi__cleanup_jpeg safe
 
    // validate req_comp
@@ -3532,6 +4105,15 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    // load a jpeg image from whichever source, but leave in YCbCr format
    if (!stbi__decode_jpeg_image(z)) { stbi__cleanup_jpeg(z); return NULL; }
 
+   // from here on, work with the size of the downscaled image
+   if (z->scale) {
+      int k, round = (1 << z->scale) - 1;
+      z->s->img_x = (z->s->img_x + round) >> z->scale;
+      z->s->img_y = (z->s->img_y + round) >> z->scale;
+      for (k=0; k < z->s->img_n; ++k)
+         z->img_comp[k].y = (z->img_comp[k].y + round) >> z->scale;
+   }
+
    // determine actual number of components to generate
    n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
 
@@ -3546,8 +4128,8 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    {
       int k;
       unsigned int i,j;
-      stbi_uc *output;
-      stbi_uc *coutput[4];
+      stbi_uc *output, *lastrow = NULL;
+      stbi_uc *coutput[4], *cfar[4];
 
       stbi__resample res_comp[4];
 
@@ -3573,20 +4155,45 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
          else                               r->resample = stbi__resample_row_generic;
       }
 
-      // can't error after this so, this is safe
-      output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
-      if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
+      // for the common 4:2:0 and 4:2:2 layouts, the chroma upsampling is
+      // done together with the color conversion
+      fused = z->YCbCr_h2_to_RGB_kernel && n >= 3 && z->s->img_n == 3 && !is_rgb
+           && res_comp[0].hs == 1 && res_comp[0].vs == 1;
+      for (k=1; fused && k < 3; ++k)
+         fused = res_comp[k].hs == 2 && res_comp[k].vs <= 2;
+
+      // can't error after this so, this is safe. with stbi_load_from_memory_into
+      // the rows go straight to the caller's buffer if they fit, and if
+      // they don't have to be flipped afterwards. rows of fewer than 4
+      // channels may be written with a byte to spare, so the last of those
+      // goes through a scratch row
+      if (z->s->out && !stbi__vertically_flip_on_load && stbi__output_fits(z->s->out, z->s->img_x, z->s->img_y)) {
+         if (n < 4) {
+            lastrow = (stbi_uc *) stbi__malloc_mad2(n, z->s->img_x, 1);
+            if (!lastrow) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
+         }
+         output = z->s->out->pixels;
+         stride = z->s->out->stride;
+      } else {
+         output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+         if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
+         stride = n * z->s->img_x;
+      }
 
       // now go ahead and resample
       for (j=0; j < z->s->img_y; ++j) {
-         stbi_uc *out = output + n * z->s->img_x * j;
+         stbi_uc *out = lastrow && j == z->s->img_y-1 ? lastrow : output + (size_t) stride * j;
          for (k=0; k < decode_n; ++k) {
             stbi__resample *r = &res_comp[k];
             int y_bot = r->ystep >= (r->vs >> 1);
-            coutput[k] = r->resample(z->img_comp[k].linebuf,
-                                     y_bot ? r->line1 : r->line0,
-                                     y_bot ? r->line0 : r->line1,
-                                     r->w_lores, r->hs);
+            if (fused && k > 0) {
+               coutput[k] = y_bot ? r->line1 : r->line0;
+               cfar[k]    = r->vs == 1 ? NULL : y_bot ? r->line0 : r->line1;
+            } else
+               coutput[k] = r->resample(z->img_comp[k].linebuf,
+                                        y_bot ? r->line1 : r->line0,
+                                        y_bot ? r->line0 : r->line1,
+                                        r->w_lores, r->hs);
             if (++r->ystep >= r->vs) {
                r->ystep = 0;
                r->line0 = r->line1;
@@ -3605,6 +4212,8 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
                      out[3] = 255;
                      out += n;
                   }
+               } else if (fused) {
+                  z->YCbCr_h2_to_RGB_kernel(out, y, coutput[1], cfar[1], coutput[2], cfar[2], res_comp[1].w_lores, z->s->img_x, n);
                } else {
                   z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
                }
@@ -3672,6 +4281,10 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
             }
          }
       }
+      if (lastrow) {
+         memcpy(output + (size_t) stride * (z->s->img_y-1), lastrow, n * z->s->img_x);
+         stbi__free(lastrow);
+      }
       stbi__cleanup_jpeg(z);
       *out_x = z->s->img_x;
       *out_y = z->s->img_y;
@@ -3687,8 +4300,12 @@ static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int re
    STBI_NOTUSED(ri);
    j->s = s;
    stbi__setup_jpeg(j);
+   j->scale = stbi__jpeg_downscale_shift;
+   if (j->scale == 1) j->idct_block_kernel = stbi__idct_block_4x4;
+   if (j->scale == 2) j->idct_block_kernel = stbi__idct_block_2x2;
+   if (j->scale == 3) j->idct_block_kernel = stbi__idct_block_1x1;
    result = load_jpeg_image(j, x,y,comp,req_comp);
-   STBI_FREE(j);
+   stbi__free(j);
    return result;
 }
 
@@ -3700,7 +4317,7 @@ static int stbi__jpeg_test(stbi__context *s)
    stbi__setup_jpeg(j);
    r = stbi__decode_jpeg_header(j, STBI__SCAN_type);
    stbi__rewind(s);
-   STBI_FREE(j);
+   stbi__free(j);
    return r;
 }
 
@@ -3721,8 +4338,9 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
    int result;
    stbi__jpeg* j = (stbi__jpeg*) (stbi__malloc(sizeof(stbi__jpeg)));
    j->s = s;
+   j->scale = 0;
    result = stbi__jpeg_info_raw(j, x, y, comp);
-   STBI_FREE(j);
+   stbi__free(j);
    return result;
 }
 #endif
@@ -3737,9 +4355,19 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 #ifndef STBI_NO_ZLIB
 
 // fast-way is faster to check than jpeg huffman, but slow way is slower
-#define STBI__ZFAST_BITS  9 // accelerate all cases in default tables
+#define STBI__ZFAST_BITS  11 // accelerate all cases in default tables, and most pairs of literals
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
 
+// on 64-bit targets the bit buffer is 64 bits wide, so one refill usually
+// covers several symbols
+#if defined(STBI__X64_TARGET) || defined(__aarch64__) || defined(_M_ARM64) || (defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ == 8)
+#define STBI__ZBITS64
+typedef size_t stbi__zword;
+#else
+typedef stbi__uint32 stbi__zword;
+#endif
+#define STBI__ZWORD_BITS  ((int) sizeof(stbi__zword) * 8)
+
 // zlib-style huffman encoding
 // (jpegs packs from left, zlib from right, so can't share code)
 typedef struct
@@ -3822,40 +4450,73 @@ static int stbi__zbuild_huffman(stbi__zhuffman *z, const stbi_uc *sizelist, int
 //    we require PNG read all the IDATs and combine them into a single
 //    memory buffer
 
-typedef struct
+typedef struct stbi__zbuf stbi__zbuf;
+
+struct stbi__zbuf
 {
    stbi_uc *zbuffer, *zbuffer_end;
    int num_bits;
-   stbi__uint32 code_buffer;
+   int num_eof_bytes; // zero bytes in code_buffer from past zbuffer_end
+   stbi__zword code_buffer;
 
    char *zout;
    char *zout_start;
    char *zout_end;
    int   z_expandable;
 
+   // streaming, or NULL: refill() replaces zbuffer..zbuffer_end with the next
+   // input, keeping at least 8 bytes before it in place, and returns 0 at the
+   // end of input; flush() consumes output from zout_flushed to zout, after
+   // which zout_start..zout_end is a window keeping the last 32K as history
+   int  (*refill)(stbi__zbuf *z);
+   int  (*flush)(stbi__zbuf *z);
+   char *zout_flushed;
+   void *stream;
+
    stbi__zhuffman z_length, z_distance;
-} stbi__zbuf;
+
+   // two literals at once: lit1 | lit2 << 8 | total code size << 16, or 0
+   stbi__uint32 z_literal_pair[1 << STBI__ZFAST_BITS];
+};
 
 stbi_inline static stbi_uc stbi__zget8(stbi__zbuf *z)
 {
-   if (z->zbuffer >= z->zbuffer_end) return 0;
+   if (z->zbuffer >= z->zbuffer_end && !(z->refill && z->refill(z))) return 0;
    return *z->zbuffer++;
 }
 
 static void stbi__fill_bits(stbi__zbuf *z)
 {
+#ifdef STBI__ZBITS64
+   if (z->zbuffer_end - z->zbuffer >= 8) {
+      // load 8 bytes and keep as many whole ones as fit. the bits above
+      // num_bits then hold the start of the next byte, which is what the
+      // next refill ORs in again, so they are harmless
+      stbi_uc *p = z->zbuffer;
+      stbi__zword v = (stbi__zword) p[0]       | ((stbi__zword) p[1] <<  8)
+                   | ((stbi__zword) p[2] << 16) | ((stbi__zword) p[3] << 24)
+                   | ((stbi__zword) p[4] << 32) | ((stbi__zword) p[5] << 40)
+                   | ((stbi__zword) p[6] << 48) | ((stbi__zword) p[7] << 56);
+      z->code_buffer |= v << z->num_bits;
+      z->zbuffer += (63 - z->num_bits) >> 3;
+      z->num_bits |= 56;
+      return;
+   }
+#endif
    do {
-      STBI_ASSERT(z->code_buffer < (1U << z->num_bits));
-      z->code_buffer |= (unsigned int) stbi__zget8(z) << z->num_bits;
+      if (z->zbuffer < z->zbuffer_end || (z->refill && z->refill(z)))
+         z->code_buffer |= (stbi__zword) *z->zbuffer++ << z->num_bits;
+      else
+         ++z->num_eof_bytes;
       z->num_bits += 8;
-   } while (z->num_bits <= 24);
+   } while (z->num_bits <= STBI__ZWORD_BITS - 8);
 }
 
 stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
 {
    unsigned int k;
    if (z->num_bits < n) stbi__fill_bits(z);
-   k = z->code_buffer & ((1 << n) - 1);
+   k = (unsigned int) (z->code_buffer & ((1 << n) - 1));
    z->code_buffer >>= n;
    z->num_bits -= n;
    return k;
@@ -3866,7 +4527,7 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    int b,s,k;
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse((int) (a->code_buffer & 0xffff), 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -3893,17 +4554,32 @@ stbi_inline static int stbi__zhuffman_decode(stbi__zbuf *a, stbi__zhuffman *z)
    return stbi__zhuffman_decode_slowpath(a, z);
 }
 
+// hand the window's new output to flush() and slide the history to its start
+static int stbi__zflush(stbi__zbuf *z, int n)
+{
+   int keep = (int) (z->zout - z->zout_start);
+   // the window never fills up, so stop here if the input ran out long ago
+   if (z->num_eof_bytes > 16) return stbi__err("unexpected end","Corrupt PNG");
+   if (!z->flush(z)) return 0;
+   if (keep > 32768) keep = 32768;
+   memmove(z->zout_start, z->zout - keep, keep);
+   z->zout = z->zout_flushed = z->zout_start + keep;
+   if (z->zout + n > z->zout_end) return stbi__err("output buffer limit","Corrupt PNG");
+   return 1;
+}
+
 static int stbi__zexpand(stbi__zbuf *z, char *zout, int n)  // need to make room for n bytes
 {
    char *q;
    int cur, limit, old_limit;
    z->zout = zout;
+   if (z->flush) return stbi__zflush(z, n);
    if (!z->z_expandable) return stbi__err("output buffer limit","Corrupt PNG");
    cur   = (int) (z->zout     - z->zout_start);
    limit = old_limit = (int) (z->zout_end - z->zout_start);
    while (cur + n > limit)
       limit *= 2;
-   q = (char *) STBI_REALLOC_SIZED(z->zout_start, old_limit, limit);
+   q = (char *) stbi__realloc_sized(z->zout_start, old_limit, limit);
    STBI_NOTUSED(old_limit);
    if (q == NULL) return stbi__err("outofmem", "Out of memory");
    z->zout_start = q;
@@ -3912,6 +4588,26 @@ static int stbi__zexpand(stbi__zbuf *z, char *zout, int n)  // need to make room
    return 1;
 }
 
+// fill in z_literal_pair from z_length: wherever the next bits hold two
+// literal codes that both fit in the fast table
+static void stbi__zbuild_literal_pairs(stbi__zbuf *a)
+{
+   const stbi__uint16 *fast = a->z_length.fast;
+   int j;
+   for (j=0; j < (1 << STBI__ZFAST_BITS); ++j) {
+      int b1 = fast[j], b2, s1, s2;
+      stbi__uint32 pair = 0;
+      if (b1 && (b1 & 511) < 256) {
+         s1 = b1 >> 9;
+         b2 = fast[j >> s1];
+         s2 = b2 >> 9;
+         if (b2 && (b2 & 511) < 256 && s1 + s2 <= STBI__ZFAST_BITS)
+            pair = (stbi__uint32) ((b1 & 255) | ((b2 & 255) << 8) | ((s1 + s2) << 16));
+      }
+      a->z_literal_pair[j] = pair;
+   }
+}
+
 static int stbi__zlength_base[31] = {
    3,4,5,6,7,8,9,10,11,13,
    15,17,19,23,27,31,35,43,51,59,
@@ -3930,7 +4626,19 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+      stbi__uint32 pair;
+      if (a->num_bits < 16) stbi__fill_bits(a);
+      pair = a->z_literal_pair[a->code_buffer & STBI__ZFAST_MASK];
+      if (pair && a->zout_end - zout >= 2) {
+         zout[0] = (char) (pair & 255);
+         zout[1] = (char) ((pair >> 8) & 255);
+         zout += 2;
+         a->code_buffer >>= pair >> 16;
+         a->num_bits -= (int) (pair >> 16);
+         continue;
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -3959,8 +4667,19 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
          }
          p = (stbi_uc *) (zout - dist);
          if (dist == 1) { // run of one byte; common in images.
-            stbi_uc v = *p;
-            if (len) { do *zout++ = v; while (--len); }
+            memset(zout, *p, len);
+            zout += len;
+         } else if (dist >= 8 && a->zout_end - zout >= len + 8) {
+            // copy 8 bytes at a time; this may write up to 7 bytes past the
+            // match, but those are inside the buffer and get overwritten by
+            // whatever is decoded next
+            char *end = zout + len;
+            do {
+               memcpy(zout, p, 8);
+               zout += 8;
+               p += 8;
+            } while (zout < end);
+            zout = end;
          } else {
             if (len) { do *zout++ = *p++; while (--len); }
          }
@@ -4020,23 +4739,43 @@ static int stbi__compute_huffman_codes(stbi__zbuf *a)
 static int stbi__parse_uncompressed_block(stbi__zbuf *a)
 {
    stbi_uc header[4];
-   int len,nlen,k;
+   int len,nlen,k,n;
    if (a->num_bits & 7)
       stbi__zreceive(a, a->num_bits & 7); // discard
    // drain the bit-packed data into header
    k = 0;
-   while (a->num_bits > 0) {
+   while (a->num_bits > 0 && k < 4) {
       header[k++] = (stbi_uc) (a->code_buffer & 255); // suppress MSVC run-time check
       a->code_buffer >>= 8;
       a->num_bits -= 8;
    }
-   STBI_ASSERT(a->num_bits == 0);
+   // a wide bit buffer can hold bytes past the header; give back the real ones
+   n = (a->num_bits >> 3) - a->num_eof_bytes;
+   if (n > 0) a->zbuffer -= n;
+   a->num_eof_bytes = 0;
+   a->code_buffer = 0;
+   a->num_bits = 0;
    // now fill header the normal way
    while (k < 4)
       header[k++] = stbi__zget8(a);
    len  = header[1] * 256 + header[0];
    nlen = header[3] * 256 + header[2];
    if (nlen != (len ^ 0xffff)) return stbi__err("zlib corrupt","Corrupt PNG");
+   if (a->refill) {
+      // the block can span several refills
+      while (len > 0) {
+         if (a->zbuffer >= a->zbuffer_end && !a->refill(a)) return stbi__err("read past buffer","Corrupt PNG");
+         n = (int) (a->zbuffer_end - a->zbuffer);
+         if (n > len) n = len;
+         if (a->zout + n > a->zout_end)
+            if (!stbi__zexpand(a, a->zout, n)) return 0;
+         memcpy(a->zout, a->zbuffer, n);
+         a->zbuffer += n;
+         a->zout += n;
+         len -= n;
+      }
+      return 1;
+   }
    if (a->zbuffer + len > a->zbuffer_end) return stbi__err("read past buffer","Corrupt PNG");
    if (a->zout + len > a->zout_end)
       if (!stbi__zexpand(a, a->zout, len)) return 0;
@@ -4094,6 +4833,7 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
    if (parse_header)
       if (!stbi__parse_zlib_header(a)) return 0;
    a->num_bits = 0;
+   a->num_eof_bytes = 0;
    a->code_buffer = 0;
    do {
       final = stbi__zreceive(a,1);
@@ -4110,6 +4850,7 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
          } else {
             if (!stbi__compute_huffman_codes(a)) return 0;
          }
+         stbi__zbuild_literal_pairs(a);
          if (!stbi__parse_huffman_block(a)) return 0;
       }
    } while (!final);
@@ -4122,6 +4863,8 @@ static int stbi__do_zlib(stbi__zbuf *a, char *obuf, int olen, int exp, int parse
    a->zout       = obuf;
    a->zout_end   = obuf + olen;
    a->z_expandable = exp;
+   a->refill     = NULL;
+   a->flush      = NULL;
 
    return stbi__parse_zlib(a, parse_header);
 }
@@ -4137,7 +4880,7 @@ STBIDEF char *stbi_zlib_decode_malloc_guesssize(const char *buffer, int len, int
       if (outlen) *outlen = (int) (a.zout - a.zout_start);
       return a.zout_start;
    } else {
-      STBI_FREE(a.zout_start);
+      stbi__free(a.zout_start);
       return NULL;
    }
 }
@@ -4158,7 +4901,7 @@ STBIDEF char *stbi_zlib_decode_malloc_guesssize_headerflag(const char *buffer, i
       if (outlen) *outlen = (int) (a.zout - a.zout_start);
       return a.zout_start;
    } else {
-      STBI_FREE(a.zout_start);
+      stbi__free(a.zout_start);
       return NULL;
    }
 }
@@ -4185,7 +4928,7 @@ STBIDEF char *stbi_zlib_decode_noheader_malloc(char const *buffer, int len, int
       if (outlen) *outlen = (int) (a.zout - a.zout_start);
       return a.zout_start;
    } else {
-      STBI_FREE(a.zout_start);
+      stbi__free(a.zout_start);
       return NULL;
    }
 }
@@ -4236,11 +4979,42 @@ static int stbi__check_png_header(stbi__context *s)
    return 1;
 }
 
+// inflate window (32K history and room for more) and IDAT input buffer
+#define STBI__PNG_STREAM_WINDOW  65536
+#define STBI__PNG_STREAM_IN      16384
+
+// state of stbi_png_stream_from_memory() and friends
+typedef struct
+{
+   stbi_row_callback *callback;
+   void *user;
+   int band_rows;
+   int *x, *y, *comp;
+
+   // from the chunks before the first IDAT
+   stbi_uc *palette;
+   int pal_img_n, has_trans, color;
+   stbi_uc *tc;
+   stbi__uint16 *tc16;
+
+   // input, see stbi__png_stream_refill()
+   stbi__uint32 chunk_left;
+   int idat_done;
+   stbi_uc *in;
+
+   // rows: raw is inflated (with filter byte), cur and prior unfiltered,
+   // smp 8-bit samples, pix after palette or tRNS
+   stbi_uc *raw, *cur, *prior, *smp, *pix, *band;
+   int raw_len, raw_fill, filter_bytes, pix_n, out_n;
+   int row_y, band_count, simd;
+} stbi__png_stream;
+
 typedef struct
 {
    stbi__context *s;
    stbi_uc *idata, *expanded, *out;
    int depth;
+   stbi__png_stream *stream; // only for STBI__SCAN_stream
 } stbi__png;
 
 
@@ -4277,6 +5051,208 @@ static int stbi__paeth(int a, int b, int c)
 
 static stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+// SIMD unfiltering. sub, avg and paeth depend on the pixel to the left, so
+// these work a pixel at a time with all of its bytes in one register; only
+// 3, 4, 6 and 8 byte pixels are handled, everything else is left to the
+// scalar loops. out_bpp may be bpp+1 or bpp+2, in which case the extra
+// (alpha) bytes are set to 255.
+
+#ifdef STBI_SSE2
+typedef __m128i stbi__pngpx;
+
+stbi_inline static stbi__pngpx stbi__png_load_px(const stbi_uc *p, int nb)
+{
+   if (nb == 8) {
+      return _mm_loadl_epi64((const __m128i *) p);
+   } else if (nb == 4) {
+      int v;
+      memcpy(&v, p, 4);
+      return _mm_cvtsi32_si128(v);
+   } else {
+      stbi_uc t[8] = { 0 };
+      memcpy(t, p, nb);
+      return _mm_loadl_epi64((const __m128i *) t);
+   }
+}
+
+stbi_inline static void stbi__png_store_px(stbi_uc *p, stbi__pngpx v, int nb)
+{
+   if (nb == 8) {
+      _mm_storel_epi64((__m128i *) p, v);
+   } else if (nb == 4) {
+      int r = _mm_cvtsi128_si32(v);
+      memcpy(p, &r, 4);
+   } else {
+      stbi_uc t[8];
+      _mm_storel_epi64((__m128i *) t, v);
+      memcpy(p, t, nb);
+   }
+}
+
+#define stbi__png_px_zero()     _mm_setzero_si128()
+#define stbi__png_px_add(x,y)   _mm_add_epi8(x, y)
+// floor((x+y)/2); pavgb rounds up, so take off the low bit where x+y is odd
+#define stbi__png_px_avg(x,y)   _mm_sub_epi8(_mm_avg_epu8(x, y), _mm_and_si128(_mm_xor_si128(x, y), _mm_set1_epi8(1)))
+#define stbi__png_px_half(x)    _mm_and_si128(_mm_srli_epi16(x, 1), _mm_set1_epi8(0x7f))
+
+stbi_inline static stbi__pngpx stbi__png_px_paeth(stbi__pngpx a, stbi__pngpx b, stbi__pngpx c)
+{
+   // same choice as stbi__paeth, in 16-bit lanes: p-a = b-c, p-b = a-c
+   __m128i zero = _mm_setzero_si128();
+   __m128i a16 = _mm_unpacklo_epi8(a, zero);
+   __m128i b16 = _mm_unpacklo_epi8(b, zero);
+   __m128i c16 = _mm_unpacklo_epi8(c, zero);
+   __m128i pa = _mm_sub_epi16(b16, c16);
+   __m128i pb = _mm_sub_epi16(a16, c16);
+   __m128i pc = _mm_add_epi16(pa, pb);
+   __m128i smallest, use_a, use_b, r;
+   pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+   pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+   pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+   smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+   use_a = _mm_cmpeq_epi16(pa, smallest);
+   use_b = _mm_cmpeq_epi16(pb, smallest);
+   r = _mm_or_si128(_mm_and_si128(use_b, b16), _mm_andnot_si128(use_b, c16));
+   r = _mm_or_si128(_mm_and_si128(use_a, a16), _mm_andnot_si128(use_a, r));
+   return _mm_packus_epi16(r, zero);
+}
+
+static void stbi__png_unfilter_up(stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int n)
+{
+   int k = 0;
+   for (; k + 16 <= n; k += 16) {
+      __m128i x = _mm_loadu_si128((const __m128i *) (raw + k));
+      __m128i b = _mm_loadu_si128((const __m128i *) (prior + k));
+      _mm_storeu_si128((__m128i *) (cur + k), _mm_add_epi8(x, b));
+   }
+   for (; k < n; ++k)
+      cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+}
+#else // STBI_NEON
+typedef uint8x8_t stbi__pngpx;
+
+stbi_inline static stbi__pngpx stbi__png_load_px(const stbi_uc *p, int nb)
+{
+   if (nb == 8) {
+      return vld1_u8(p);
+   } else if (nb == 4) {
+      stbi__uint32 v;
+      memcpy(&v, p, 4);
+      return vreinterpret_u8_u32(vdup_n_u32(v));
+   } else {
+      stbi_uc t[8] = { 0 };
+      memcpy(t, p, nb);
+      return vld1_u8(t);
+   }
+}
+
+stbi_inline static void stbi__png_store_px(stbi_uc *p, stbi__pngpx v, int nb)
+{
+   if (nb == 8) {
+      vst1_u8(p, v);
+   } else if (nb == 4) {
+      stbi__uint32 r = vget_lane_u32(vreinterpret_u32_u8(v), 0);
+      memcpy(p, &r, 4);
+   } else {
+      stbi_uc t[8];
+      vst1_u8(t, v);
+      memcpy(p, t, nb);
+   }
+}
+
+#define stbi__png_px_zero()     vdup_n_u8(0)
+#define stbi__png_px_add(x,y)   vadd_u8(x, y)
+#define stbi__png_px_avg(x,y)   vhadd_u8(x, y)
+#define stbi__png_px_half(x)    vshr_n_u8(x, 1)
+
+stbi_inline static stbi__pngpx stbi__png_px_paeth(stbi__pngpx a, stbi__pngpx b, stbi__pngpx c)
+{
+   // same choice as stbi__paeth: |p-a| = |b-c|, |p-b| = |a-c|, |p-c| = |a+b-2c|
+   uint16x8_t pa = vabdl_u8(b, c);
+   uint16x8_t pb = vabdl_u8(a, c);
+   uint16x8_t pc = vabdq_u16(vaddl_u8(a, b), vaddl_u8(c, c));
+   uint16x8_t smallest = vminq_u16(vminq_u16(pa, pb), pc);
+   uint8x8_t use_a = vmovn_u16(vceqq_u16(pa, smallest));
+   uint8x8_t use_b = vmovn_u16(vceqq_u16(pb, smallest));
+   return vbsl_u8(use_a, a, vbsl_u8(use_b, b, c));
+}
+
+static void stbi__png_unfilter_up(stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int n)
+{
+   int k = 0;
+   for (; k + 16 <= n; k += 16)
+      vst1q_u8(cur + k, vaddq_u8(vld1q_u8(raw + k), vld1q_u8(prior + k)));
+   for (; k < n; ++k)
+      cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+}
+#endif
+
+// unfilter 'count' pixels starting at cur, whose left neighbour (and the
+// one above that) has already been done. each pixel is loaded and stored
+// as nb >= bpp bytes
+stbi_inline static void stbi__png_unfilter_px(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int count, int bpp, int out_bpp, int nb)
+{
+   stbi__pngpx a = stbi__png_load_px(cur - out_bpp, nb), b, c;
+   int i;
+   #define STBI__PX_LOOP(body) \
+      for (i=0; i < count; ++i, raw += bpp, cur += out_bpp, prior += out_bpp) { \
+         body \
+         stbi__png_store_px(cur, a, nb); \
+         if (out_bpp != bpp) memset(cur + bpp, 255, out_bpp - bpp); \
+      }
+   switch (filter) {
+      case STBI__F_sub:
+      case STBI__F_paeth_first: // paeth(a,0,0) is always a
+         STBI__PX_LOOP(a = stbi__png_px_add(stbi__png_load_px(raw, nb), a);)
+         break;
+      case STBI__F_up:
+         STBI__PX_LOOP(a = stbi__png_px_add(stbi__png_load_px(raw, nb), stbi__png_load_px(prior, nb));)
+         break;
+      case STBI__F_avg:
+         STBI__PX_LOOP(a = stbi__png_px_add(stbi__png_load_px(raw, nb), stbi__png_px_avg(a, stbi__png_load_px(prior, nb)));)
+         break;
+      case STBI__F_avg_first:
+         STBI__PX_LOOP(a = stbi__png_px_add(stbi__png_load_px(raw, nb), stbi__png_px_half(a));)
+         break;
+      case STBI__F_paeth:
+         c = stbi__png_load_px(prior - out_bpp, nb);
+         STBI__PX_LOOP(b = stbi__png_load_px(prior, nb); a = stbi__png_px_add(stbi__png_load_px(raw, nb), stbi__png_px_paeth(a, b, c)); c = b;)
+         break;
+   }
+   #undef STBI__PX_LOOP
+}
+
+// returns 0 if the scalar code has to do it
+static int stbi__png_unfilter_simd(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int count, int bpp, int out_bpp)
+{
+   if (filter == STBI__F_none) return 0;
+   if (filter == STBI__F_up && bpp == out_bpp) {
+      stbi__png_unfilter_up(cur, prior, raw, count * bpp);
+      return 1;
+   }
+   // constant sizes, so each of these gets its own copy of the loops
+   switch (bpp) {
+      case 4: stbi__png_unfilter_px(filter, cur, prior, raw, count, 4, out_bpp, 4); return 1;
+      case 8: stbi__png_unfilter_px(filter, cur, prior, raw, count, 8, out_bpp, 8); return 1;
+      case 3:
+      case 6:
+         // 3 and 6 byte pixels go through the 4/8 byte word around them; what
+         // spills into the next pixel is rewritten by it, so only the last
+         // one (which could spill past the row or the buffer) is done exactly
+         if (count <= 0) return 1;
+         if (bpp == 3) stbi__png_unfilter_px(filter, cur, prior, raw, count - 1, 3, out_bpp, 4);
+         else          stbi__png_unfilter_px(filter, cur, prior, raw, count - 1, 6, out_bpp, 8);
+         cur   += (count - 1) * out_bpp;
+         prior += (count - 1) * out_bpp;
+         raw   += (count - 1) * bpp;
+         stbi__png_unfilter_px(filter, cur, prior, raw, 1, bpp, out_bpp, bpp);
+         return 1;
+   }
+   return 0;
+}
+#endif
+
 // create the png data from post-deflated data
 static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 raw_len, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
 {
@@ -4290,6 +5266,11 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
    int width = x;
+#ifdef STBI_SSE2
+   int simd = stbi__sse2_available();
+#elif defined(STBI_NEON)
+   int simd = 1;
+#endif
 
    STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
    a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
@@ -4360,6 +5341,9 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
          #define STBI__CASE(f) \
              case f:     \
                 for (k=0; k < nk; ++k)
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+         if (!simd || !stbi__png_unfilter_simd(filter, cur, prior, raw, width - 1, filter_bytes, filter_bytes))
+#endif
          switch (filter) {
             // "none" filter turns into a memcpy here; make that explicit.
             case STBI__F_none:         memcpy(cur, raw, nk); break;
@@ -4378,6 +5362,11 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
              case f:     \
                 for (i=x-1; i >= 1; --i, cur[filter_bytes]=255,raw+=filter_bytes,cur+=output_bytes,prior+=output_bytes) \
                    for (k=0; k < filter_bytes; ++k)
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+         if (simd && stbi__png_unfilter_simd(filter, cur, prior, raw, x - 1, filter_bytes, output_bytes))
+            raw += (x - 1) * filter_bytes;
+         else
+#endif
          switch (filter) {
             STBI__CASE(STBI__F_none)         { cur[k] = raw[k]; } break;
             STBI__CASE(STBI__F_sub)          { cur[k] = STBI__BYTECAST(raw[k] + cur[k- output_bytes]); } break;
@@ -4511,7 +5500,7 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
       if (x && y) {
          stbi__uint32 img_len = ((((a->s->img_n * x * depth) + 7) >> 3) + 1) * y;
          if (!stbi__create_png_image_raw(a, image_data, image_data_len, out_n, x, y, depth, color)) {
-            STBI_FREE(final);
+            stbi__free(final);
             return 0;
          }
          for (j=0; j < y; ++j) {
@@ -4522,7 +5511,7 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
                       a->out + (j*x+i)*out_bytes, out_bytes);
             }
          }
-         STBI_FREE(a->out);
+         stbi__free(a->out);
          image_data += img_len;
          image_data_len -= img_len;
       }
@@ -4611,7 +5600,7 @@ static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int
          p += 4;
       }
    }
-   STBI_FREE(a->out);
+   stbi__free(a->out);
    a->out = temp_out;
 
    STBI_NOTUSED(len);
@@ -4677,6 +5666,224 @@ static void stbi__de_iphone(stbi__png *z)
 
 #define STBI__PNG_TYPE(a,b,c,d)  (((a) << 24) + ((b) << 16) + ((c) << 8) + (d))
 
+// unfilter one row into cur from raw, n bytes with fb bytes per pixel (or 1
+// below 8 bits), given the previous row in prior, which is all zeros for the
+// first row
+static void stbi__png_unfilter_row(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int n, int fb, int simd)
+{
+   int k;
+   for (k=0; k < fb; ++k) {
+      switch (filter) {
+         case STBI__F_none : cur[k] = raw[k]; break;
+         case STBI__F_sub  : cur[k] = raw[k]; break;
+         case STBI__F_up   : cur[k] = STBI__BYTECAST(raw[k] + prior[k]); break;
+         case STBI__F_avg  : cur[k] = STBI__BYTECAST(raw[k] + (prior[k]>>1)); break;
+         case STBI__F_paeth: cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(0,prior[k],0)); break;
+      }
+   }
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+   if (simd && stbi__png_unfilter_simd(filter, cur + fb, prior + fb, raw + fb, n / fb - 1, fb, fb))
+      return;
+#else
+   STBI_NOTUSED(simd);
+#endif
+   #define STBI__CASE(f) \
+       case f:     \
+          for (k=fb; k < n; ++k)
+   switch (filter) {
+      case STBI__F_none:   memcpy(cur + fb, raw + fb, n - fb); break;
+      STBI__CASE(STBI__F_sub)   { cur[k] = STBI__BYTECAST(raw[k] + cur[k-fb]); } break;
+      STBI__CASE(STBI__F_up)    { cur[k] = STBI__BYTECAST(raw[k] + prior[k]); } break;
+      STBI__CASE(STBI__F_avg)   { cur[k] = STBI__BYTECAST(raw[k] + ((prior[k] + cur[k-fb])>>1)); } break;
+      STBI__CASE(STBI__F_paeth) { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k-fb],prior[k],prior[k-fb])); } break;
+   }
+   #undef STBI__CASE
+}
+
+// unfilter and convert the row in st->raw, and pass the band on once full
+static int stbi__png_stream_row(stbi__png *z)
+{
+   stbi__png_stream *st = z->stream;
+   stbi__context *s = z->s;
+   int x = s->img_x, img_n = s->img_n, depth = z->depth;
+   int filter = st->raw[0], i, k;
+   stbi_uc *smp = st->cur, *pix, *t;
+
+   if (filter > 4) return stbi__err("invalid filter","Corrupt PNG");
+   stbi__png_unfilter_row(filter, st->cur, st->prior, st->raw + 1, st->raw_len - 1, st->filter_bytes, st->simd);
+
+   // 8-bit samples; 16-bit ones keep their top byte, as stbi__convert_16_to_8 does
+   if (depth == 16) {
+      smp = st->smp;
+      for (i=0; i < x*img_n; ++i)
+         smp[i] = st->cur[i*2];
+   } else if (depth < 8) {
+      stbi_uc scale = (st->color == 0) ? stbi__depth_scale_table[depth] : 1;
+      int mask = (1 << depth) - 1;
+      smp = st->smp;
+      for (i=0; i < x*img_n; ++i) {
+         int bit = i * depth;
+         smp[i] = scale * ((st->cur[bit >> 3] >> (8 - depth - (bit & 7))) & mask);
+      }
+   }
+
+   pix = smp;
+   if (st->pal_img_n) {
+      pix = st->pix;
+      for (i=0; i < x; ++i)
+         memcpy(pix + i*st->pal_img_n, st->palette + smp[i]*4, st->pal_img_n);
+   } else if (st->has_trans) {
+      // alpha is 0 where every sample matches the tRNS colour
+      pix = st->pix;
+      for (i=0, t=pix; i < x; ++i, t += img_n+1) {
+         int match = 1;
+         for (k=0; k < img_n; ++k) {
+            t[k] = smp[i*img_n + k];
+            if (depth == 16)
+               match &= (st->cur[(i*img_n + k)*2] << 8 | st->cur[(i*img_n + k)*2 + 1]) == st->tc16[k];
+            else
+               match &= t[k] == st->tc[k];
+         }
+         t[img_n] = match ? 0 : 255;
+      }
+   }
+
+   t = st->band + (size_t) st->band_count * x * st->out_n;
+   if (st->out_n == st->pix_n)
+      memcpy(t, pix, (size_t) x * st->out_n);
+   else
+      stbi__convert_format_row(pix, st->pix_n, t, st->out_n, x);
+   if (depth == 16 && st->pix_n >= 3 && st->out_n <= 2) {
+      // luma from the full samples, as stbi__convert_format16 computes it
+      for (i=0; i < x; ++i) {
+         stbi_uc *c = st->cur + i*img_n*2;
+         t[i*st->out_n] = (stbi_uc) (stbi__compute_y_16(c[0] << 8 | c[1], c[2] << 8 | c[3], c[4] << 8 | c[5]) >> 8);
+      }
+   }
+
+   // this row is the next one's prior
+   t = st->prior; st->prior = st->cur; st->cur = t;
+
+   ++st->row_y;
+   if (++st->band_count == st->band_rows || st->row_y == (int) s->img_y) {
+      int ok = st->callback(st->user, st->band, st->row_y - st->band_count, st->band_count, x * st->out_n);
+      st->band_count = 0;
+      if (!ok) return stbi__err("stopped","Row callback stopped decoding");
+   }
+   return 1;
+}
+
+// zlib input: the rest of this IDAT, then following ones. The last 8 bytes
+// of the previous input stay in front, as the zlib reader may give some back
+static int stbi__png_stream_refill(stbi__zbuf *a)
+{
+   stbi__png *z = (stbi__png *) a->stream;
+   stbi__png_stream *st = z->stream;
+   stbi__uint32 n;
+   while (st->chunk_left == 0) {
+      stbi__pngchunk c;
+      if (st->idat_done) return 0;
+      stbi__get32be(z->s); // CRC
+      c = stbi__get_chunk_header(z->s);
+      if (c.type != STBI__PNG_TYPE('I','D','A','T')) {
+         st->idat_done = 1;
+         return 0;
+      }
+      st->chunk_left = c.length;
+   }
+   n = st->chunk_left < STBI__PNG_STREAM_IN ? st->chunk_left : STBI__PNG_STREAM_IN;
+   memmove(st->in, a->zbuffer_end - 8, 8);
+   if (!stbi__getn(z->s, st->in + 8, n)) {
+      st->idat_done = 1;
+      return 0;
+   }
+   st->chunk_left -= n;
+   a->zbuffer     = st->in + 8;
+   a->zbuffer_end = st->in + 8 + n;
+   return 1;
+}
+
+// zlib output: gather it into rows. Anything after the last row is ignored,
+// as stbi__create_png_image_raw does
+static int stbi__png_stream_flush(stbi__zbuf *a)
+{
+   stbi__png *z = (stbi__png *) a->stream;
+   stbi__png_stream *st = z->stream;
+   stbi_uc *p = (stbi_uc *) a->zout_flushed, *end = (stbi_uc *) a->zout;
+   while (p < end && st->row_y < (int) z->s->img_y) {
+      int n = st->raw_len - st->raw_fill;
+      if (n > end - p) n = (int) (end - p);
+      memcpy(st->raw + st->raw_fill, p, n);
+      p += n;
+      st->raw_fill += n;
+      if (st->raw_fill == st->raw_len) {
+         st->raw_fill = 0;
+         if (!stbi__png_stream_row(z)) return 0;
+      }
+   }
+   a->zout_flushed = a->zout;
+   return 1;
+}
+
+// decode the zlib stream starting with an IDAT of idat_len bytes, a row at a time
+static int stbi__png_stream_idat(stbi__png *z, stbi__uint32 idat_len, int req_comp)
+{
+   stbi__png_stream *st = z->stream;
+   stbi__context *s = z->s;
+   int x = s->img_x, img_n = s->img_n;
+   int row_bytes = (img_n * x * z->depth + 7) >> 3;
+   size_t band_size, size;
+   stbi_uc *mem;
+   stbi__zbuf a;
+   int ok;
+
+   st->pix_n = st->pal_img_n ? st->pal_img_n : img_n + (st->has_trans != 0);
+   st->out_n = req_comp ? req_comp : st->pix_n;
+   st->raw_len = row_bytes + 1;
+   st->filter_bytes = z->depth < 8 ? 1 : img_n * (z->depth / 8);
+   if (st->band_rows > (int) s->img_y) st->band_rows = s->img_y;
+   if (st->band_rows > INT_MAX / x / st->out_n) st->band_rows = INT_MAX / x / st->out_n;
+   band_size = (size_t) st->band_rows * x * st->out_n;
+   size = STBI__PNG_STREAM_WINDOW + 8 + STBI__PNG_STREAM_IN + (size_t) st->raw_len + 2 * (size_t) row_bytes
+        + (size_t) x * img_n + (size_t) x * 4 + band_size;
+   mem = (stbi_uc *) stbi__malloc(size);
+   if (!mem) return stbi__err("outofmem", "Out of memory");
+#ifdef STBI_SSE2
+   st->simd = stbi__sse2_available();
+#elif defined(STBI_NEON)
+   st->simd = 1;
+#endif
+
+   a.zout_start = a.zout = a.zout_flushed = (char *) mem;
+   a.zout_end = a.zout_start + STBI__PNG_STREAM_WINDOW;
+   st->in    = mem + STBI__PNG_STREAM_WINDOW;
+   st->raw   = st->in + 8 + STBI__PNG_STREAM_IN;
+   st->cur   = st->raw + st->raw_len;
+   st->prior = st->cur + row_bytes;
+   st->smp   = st->prior + row_bytes;
+   st->pix   = st->smp + (size_t) x * img_n;
+   st->band  = st->pix + (size_t) x * 4;
+   memset(st->in, 0, 8);
+   memset(st->prior, 0, row_bytes);
+   st->chunk_left = idat_len;
+
+   a.zbuffer = a.zbuffer_end = st->in + 8;
+   a.z_expandable = 0;
+   a.refill = stbi__png_stream_refill;
+   a.flush  = stbi__png_stream_flush;
+   a.stream = z;
+
+   if (st->x) *st->x = s->img_x;
+   if (st->y) *st->y = s->img_y;
+   if (st->comp) *st->comp = st->pix_n;
+
+   ok = stbi__parse_zlib(&a, 1) && stbi__png_stream_flush(&a);
+   if (ok && st->row_y < (int) s->img_y)
+      ok = stbi__err("not enough pixels","Corrupt PNG");
+   stbi__free(mem);
+   return ok;
+}
+
 static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
 {
    stbi_uc palette[1024], pal_img_n=0;
@@ -4718,13 +5925,14 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (!s->img_x || !s->img_y) return stbi__err("0-pixel image","Corrupt PNG");
             if (!pal_img_n) {
                s->img_n = (color & 2 ? 3 : 1) + (color & 4 ? 1 : 0);
-               if ((1 << 30) / s->img_x / s->img_n < s->img_y) return stbi__err("too large", "Image too large to decode");
+               // streaming never holds the whole image, so isn't limited by its size
+               if (scan != STBI__SCAN_stream && (1 << 30) / s->img_x / s->img_n < s->img_y) return stbi__err("too large", "Image too large to decode");
                if (scan == STBI__SCAN_header) return 1;
             } else {
                // if paletted, then pal_n is our final components, and
                // img_n is # components to decompress/filter.
                s->img_n = 1;
-               if ((1 << 30) / s->img_x / 4 < s->img_y) return stbi__err("too large","Corrupt PNG");
+               if (scan != STBI__SCAN_stream && (1 << 30) / s->img_x / 4 < s->img_y) return stbi__err("too large","Corrupt PNG");
                // if SCAN_header, have to scan to see if we have a tRNS
             }
             break;
@@ -4771,6 +5979,19 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (pal_img_n && !pal_len) return stbi__err("no PLTE","Corrupt PNG");
             if (scan == STBI__SCAN_header) { s->img_n = pal_img_n; return 1; }
+            if (scan == STBI__SCAN_stream) {
+               // everything else is done a row at a time as IDATs are read
+               stbi__png_stream *st = z->stream;
+               if (interlace) return stbi__err("interlaced","PNG not supported: can't stream interlaced images");
+               if (is_iphone) return stbi__err("CgBI","PNG not supported: can't stream iPhone images");
+               st->palette   = palette;
+               st->pal_img_n = pal_img_n;
+               st->has_trans = has_trans;
+               st->color     = color;
+               st->tc        = tc;
+               st->tc16      = tc16;
+               return stbi__png_stream_idat(z, c.length, req_comp);
+            }
             if ((int)(ioff + c.length) < (int)ioff) return 0;
             if (ioff + c.length > idata_limit) {
                stbi__uint32 idata_limit_old = idata_limit;
@@ -4779,7 +6000,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                while (ioff + c.length > idata_limit)
                   idata_limit *= 2;
                STBI_NOTUSED(idata_limit_old);
-               p = (stbi_uc *) STBI_REALLOC_SIZED(z->idata, idata_limit_old, idata_limit); if (p == NULL) return stbi__err("outofmem", "Out of memory");
+               p = (stbi_uc *) stbi__realloc_sized(z->idata, idata_limit_old, idata_limit); if (p == NULL) return stbi__err("outofmem", "Out of memory");
                z->idata = p;
             }
             if (!stbi__getn(s, z->idata+ioff,c.length)) return stbi__err("outofdata","Corrupt PNG");
@@ -4790,14 +6011,14 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
          case STBI__PNG_TYPE('I','E','N','D'): {
             stbi__uint32 raw_len, bpl;
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
-            if (scan != STBI__SCAN_load) return 1;
+            if (scan != STBI__SCAN_load && scan != STBI__SCAN_stream) return 1;
             if (z->idata == NULL) return stbi__err("no IDAT","Corrupt PNG");
             // initial guess for decoded data size to avoid unnecessary reallocs
             bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
             raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
             z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
             if (z->expanded == NULL) return 0; // zlib should set error
-            STBI_FREE(z->idata); z->idata = NULL;
+            stbi__free(z->idata); z->idata = NULL;
             if ((req_comp == s->img_n+1 && req_comp != 3 && !pal_img_n) || has_trans)
                s->img_out_n = s->img_n+1;
             else
@@ -4823,7 +6044,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                // non-paletted image with tRNS -> source image has (constant) alpha
                ++s->img_n;
             }
-            STBI_FREE(z->expanded); z->expanded = NULL;
+            stbi__free(z->expanded); z->expanded = NULL;
             return 1;
          }
 
@@ -4872,9 +6093,9 @@ static void *stbi__do_png(stbi__png *p, int *x, int *y, int *n, int req_comp, st
       *y = p->s->img_y;
       if (n) *n = p->s->img_n;
    }
-   STBI_FREE(p->out);      p->out      = NULL;
-   STBI_FREE(p->expanded); p->expanded = NULL;
-   STBI_FREE(p->idata);    p->idata    = NULL;
+   stbi__free(p->out);      p->out      = NULL;
+   stbi__free(p->expanded); p->expanded = NULL;
+   stbi__free(p->idata);    p->idata    = NULL;
 
    return result;
 }
@@ -4912,6 +6133,69 @@ static int stbi__png_info(stbi__context *s, int *x, int *y, int *comp)
    p.s = s;
    return stbi__png_info_raw(&p, x, y, comp);
 }
+
+static int stbi__png_stream_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, int band_rows, stbi_row_callback *rows, void *user)
+{
+   stbi__png p;
+   stbi__png_stream st;
+   if (req_comp < 0 || req_comp > 4) return stbi__err("bad req_comp", "Internal error");
+   memset(&st, 0, sizeof(st));
+   st.callback  = rows;
+   st.user      = user;
+   st.band_rows = band_rows < 1 ? 1 : band_rows;
+   st.x = x;
+   st.y = y;
+   st.comp = comp;
+   p.s = s;
+   p.stream = &st;
+   return stbi__parse_png_file(&p, STBI__SCAN_stream, req_comp);
+}
+#endif
+
+STBIDEF int stbi_png_stream_from_memory(stbi_uc const *buffer, int len, int *x, int *y, int *comp, int req_comp, int band_rows, stbi_row_callback *rows, void *user)
+{
+#ifndef STBI_NO_PNG
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__png_stream_main(&s,x,y,comp,req_comp,band_rows,rows,user);
+#else
+   STBI_NOTUSED(buffer); STBI_NOTUSED(len); STBI_NOTUSED(x); STBI_NOTUSED(y); STBI_NOTUSED(comp);
+   STBI_NOTUSED(req_comp); STBI_NOTUSED(band_rows); STBI_NOTUSED(rows); STBI_NOTUSED(user);
+   return stbi__err("PNG disabled", "Built with STBI_NO_PNG");
+#endif
+}
+
+STBIDEF int stbi_png_stream_from_callbacks(stbi_io_callbacks const *clbk, void *io_user, int *x, int *y, int *comp, int req_comp, int band_rows, stbi_row_callback *rows, void *user)
+{
+#ifndef STBI_NO_PNG
+   stbi__context s;
+   stbi__start_callbacks(&s, (stbi_io_callbacks *) clbk, io_user);
+   return stbi__png_stream_main(&s,x,y,comp,req_comp,band_rows,rows,user);
+#else
+   STBI_NOTUSED(clbk); STBI_NOTUSED(io_user); STBI_NOTUSED(x); STBI_NOTUSED(y); STBI_NOTUSED(comp);
+   STBI_NOTUSED(req_comp); STBI_NOTUSED(band_rows); STBI_NOTUSED(rows); STBI_NOTUSED(user);
+   return stbi__err("PNG disabled", "Built with STBI_NO_PNG");
+#endif
+}
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_png_stream(char const *filename, int *x, int *y, int *comp, int req_comp, int band_rows, stbi_row_callback *rows, void *user)
+{
+#ifndef STBI_NO_PNG
+   stbi__context s;
+   int result;
+   FILE *f = stbi__fopen(filename, "rb");
+   if (!f) return stbi__err("can't fopen", "Unable to open file");
+   stbi__start_file(&s,f);
+   result = stbi__png_stream_main(&s,x,y,comp,req_comp,band_rows,rows,user);
+   fclose(f);
+   return result;
+#else
+   STBI_NOTUSED(filename); STBI_NOTUSED(x); STBI_NOTUSED(y); STBI_NOTUSED(comp);
+   STBI_NOTUSED(req_comp); STBI_NOTUSED(band_rows); STBI_NOTUSED(rows); STBI_NOTUSED(user);
+   return stbi__err("PNG disabled", "Built with STBI_NO_PNG");
+#endif
+}
 #endif
 
 // Microsoft/Windows BMP image
@@ -5116,7 +6400,7 @@ static void *stbi__bmp_load(stbi__context *s, int *x, int *y, int *comp, int req
    if (!out) return stbi__errpuc("outofmem", "Out of memory");
    if (info.bpp < 16) {
       int z=0;
-      if (psize == 0 || psize > 256) { STBI_FREE(out); return stbi__errpuc("invalid", "Corrupt BMP"); }
+      if (psize == 0 || psize > 256) { stbi__free(out); return stbi__errpuc("invalid", "Corrupt BMP"); }
       for (i=0; i < psize; ++i) {
          pal[i][2] = stbi__get8(s);
          pal[i][1] = stbi__get8(s);
@@ -5127,7 +6411,7 @@ static void *stbi__bmp_load(stbi__context *s, int *x, int *y, int *comp, int req
       stbi__skip(s, info.offset - 14 - info.hsz - psize * (info.hsz == 12 ? 3 : 4));
       if (info.bpp == 4) width = (s->img_x + 1) >> 1;
       else if (info.bpp == 8) width = s->img_x;
-      else { STBI_FREE(out); return stbi__errpuc("bad bpp", "Corrupt BMP"); }
+      else { stbi__free(out); return stbi__errpuc("bad bpp", "Corrupt BMP"); }
       pad = (-width)&3;
       for (j=0; j < (int) s->img_y; ++j) {
          for (i=0; i < (int) s->img_x; i += 2) {
@@ -5165,7 +6449,7 @@ static void *stbi__bmp_load(stbi__context *s, int *x, int *y, int *comp, int req
             easy = 2;
       }
       if (!easy) {
-         if (!mr || !mg || !mb) { STBI_FREE(out); return stbi__errpuc("bad masks", "Corrupt BMP"); }
+         if (!mr || !mg || !mb) { stbi__free(out); return stbi__errpuc("bad masks", "Corrupt BMP"); }
          // right shift amt to put high bit in position #7
          rshift = stbi__high_bit(mr)-7; rcount = stbi__bitcount(mr);
          gshift = stbi__high_bit(mg)-7; gcount = stbi__bitcount(mg);
@@ -5437,7 +6721,7 @@ static void *stbi__tga_load(stbi__context *s, int *x, int *y, int *comp, int req
          //   load the palette
          tga_palette = (unsigned char*)stbi__malloc_mad2(tga_palette_len, tga_comp, 0);
          if (!tga_palette) {
-            STBI_FREE(tga_data);
+            stbi__free(tga_data);
             return stbi__errpuc("outofmem", "Out of memory");
          }
          if (tga_rgb16) {
@@ -5448,8 +6732,8 @@ static void *stbi__tga_load(stbi__context *s, int *x, int *y, int *comp, int req
                pal_entry += tga_comp;
             }
          } else if (!stbi__getn(s, tga_palette, tga_palette_len * tga_comp)) {
-               STBI_FREE(tga_data);
-               STBI_FREE(tga_palette);
+               stbi__free(tga_data);
+               stbi__free(tga_palette);
                return stbi__errpuc("bad palette", "Corrupt TGA");
          }
       }
@@ -5530,7 +6814,7 @@ static void *stbi__tga_load(stbi__context *s, int *x, int *y, int *comp, int req
       //   clear my palette, if I had one
       if ( tga_palette != NULL )
       {
-         STBI_FREE( tga_palette );
+         stbi__free( tga_palette );
       }
    }
 
@@ -5718,7 +7002,7 @@ static void *stbi__psd_load(stbi__context *s, int *x, int *y, int *comp, int req
          } else {
             // Read the RLE data.
             if (!stbi__psd_decode_rle(s, p, pixelCount)) {
-               STBI_FREE(out);
+               stbi__free(out);
                return stbi__errpuc("corrupt", "bad RLE data");
             }
          }
@@ -6005,7 +7289,7 @@ static void *stbi__pic_load(stbi__context *s,int *px,int *py,int *comp,int req_c
    memset(result, 0xff, x*y*4);
 
    if (!stbi__pic_load_core(s,x,y,comp, result)) {
-      STBI_FREE(result);
+      stbi__free(result);
       result=0;
    }
    *px = x;
@@ -6112,13 +7396,13 @@ static int stbi__gif_info_raw(stbi__context *s, int *x, int *y, int *comp)
 {
    stbi__gif* g = (stbi__gif*) stbi__malloc(sizeof(stbi__gif));
    if (!stbi__gif_header(s, g, comp, 1)) {
-      STBI_FREE(g);
+      stbi__free(g);
       stbi__rewind( s );
       return 0;
    }
    if (x) *x = g->w;
    if (y) *y = g->h;
-   STBI_FREE(g);
+   stbi__free(g);
    return 1;
 }
 
@@ -6387,8 +7671,8 @@ static void *stbi__gif_load(stbi__context *s, int *x, int *y, int *comp, int req
          u = stbi__convert_format(u, 4, req_comp, g->w, g->h);
    }
    else if (g->out)
-      STBI_FREE(g->out);
-   STBI_FREE(g);
+      stbi__free(g->out);
+   stbi__free(g);
    return u;
 }
 
@@ -6557,16 +7841,16 @@ static float *stbi__hdr_load(stbi__context *s, int *x, int *y, int *comp, int re
             stbi__hdr_convert(hdr_data, rgbe, req_comp);
             i = 1;
             j = 0;
-            STBI_FREE(scanline);
+            stbi__free(scanline);
             goto main_decode_loop; // yes, this makes no sense
          }
          len <<= 8;
          len |= stbi__get8(s);
-         if (len != width) { STBI_FREE(hdr_data); STBI_FREE(scanline); return stbi__errpf("invalid decoded scanline length", "corrupt HDR"); }
+         if (len != width) { stbi__free(hdr_data); stbi__free(scanline); return stbi__errpf("invalid decoded scanline length", "corrupt HDR"); }
          if (scanline == NULL) {
             scanline = (stbi_uc *) stbi__malloc_mad2(width, 4, 0);
             if (!scanline) {
-               STBI_FREE(hdr_data);
+               stbi__free(hdr_data);
                return stbi__errpf("outofmem", "Out of memory");
             }
          }
@@ -6580,12 +7864,12 @@ static float *stbi__hdr_load(stbi__context *s, int *x, int *y, int *comp, int re
                   // Run
                   value = stbi__get8(s);
                   count -= 128;
-                  if (count > nleft) { STBI_FREE(hdr_data); STBI_FREE(scanline); return stbi__errpf("corrupt", "bad RLE data in HDR"); }
+                  if (count > nleft) { stbi__free(hdr_data); stbi__free(scanline); return stbi__errpf("corrupt", "bad RLE data in HDR"); }
                   for (z = 0; z < count; ++z)
                      scanline[i++ * 4 + k] = value;
                } else {
                   // Dump
-                  if (count > nleft) { STBI_FREE(hdr_data); STBI_FREE(scanline); return stbi__errpf("corrupt", "bad RLE data in HDR"); }
+                  if (count > nleft) { stbi__free(hdr_data); stbi__free(scanline); return stbi__errpf("corrupt", "bad RLE data in HDR"); }
                   for (z = 0; z < count; ++z)
                      scanline[i++ * 4 + k] = stbi__get8(s);
                }
@@ -6595,7 +7879,7 @@ static float *stbi__hdr_load(stbi__context *s, int *x, int *y, int *comp, int re
             stbi__hdr_convert(hdr_data+(j*width + i)*req_comp, scanline + i*4, req_comp);
       }
       if (scanline)
-         STBI_FREE(scanline);
+         stbi__free(scanline);
    }
 
    return hdr_data;
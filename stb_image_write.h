@@ -24,7 +24,8 @@ BUILDING:
 
    You can #define STBIW_ASSERT(x) before the #include to avoid using assert.h.
    You can #define STBIW_MALLOC(), STBIW_REALLOC(), and STBIW_FREE() to replace
-   malloc,realloc,free.
+   malloc,realloc,free, or #define STBIW_RETRO_ARENA to allocate with
+   retro_arena.h, from the arena set for the calling thread.
    You can define STBIW_MEMMOVE() to replace memmove()
 
 USAGE:
@@ -81,10 +82,79 @@ USAGE:
 
    TGA supports RLE or non-RLE compressed data. To use non-RLE-compressed
    data, set the global variable 'stbi_write_tga_with_rle' to 0.
+
+   PNG compression effort is set by the global variable
+   'stbi_write_png_compression_level' (default 8; higher values look further
+   for matches and are slower). Level 0 is a fast mode for screenshots and
+   frame dumps: every row uses the "up" filter and the deflate stream only
+   encodes runs of repeated bytes.
+
+   The PNG writer compresses the image in independent bands of rows and
+   writes each band as its own IDAT chunk as soon as it is done, so the file
+   and callback variants never hold the whole compressed image. To compress
+   the bands in parallel, pass a function that runs jobs on your own threads
+   to stbi_write_png_set_run_jobs():
+
+      static void run_jobs(void *user, stbi_write_job *job, void *job_data, int job_count)
+      {
+         int i;
+         for (i=0; i < job_count; ++i)
+            my_pool_submit(user, job, job_data, i); // job(job_data, i) on a worker
+         my_pool_wait(user);
+      }
+
+      stbi_write_png_set_run_jobs(run_jobs, my_pool);
+
+   All bands are then compressed before any is written. Don't change these
+   settings while another thread is writing a PNG.
    
    JPEG does ignore alpha channels in input data; quality is between 1 and 100.
    Higher quality looks better but results in a bigger image.
-   JPEG baseline (no JPEG progressive).
+   JPEG baseline (no JPEG progressive). Quality 90 and below (including the
+   default) subsamples the chroma 4:2:0; above 90 it is kept at full size.
+
+   The JPEG writer encodes strips of a few macroblock rows each, ending every
+   strip but the last with a restart marker so that they are independent.
+   stbi_write_jpg_set_run_jobs() takes the same kind of job runner as the PNG
+   writer to encode the strips in parallel; the file is the same either way.
+   The DCT and colour conversion use SSE2 where the compiler targets it
+   (define STBIW_NO_SIMD to turn that off).
+
+FRAME DUMPS:
+
+   To capture a sequence of frames (video dumps, regression testing) without
+   slowing down the thread that renders them, open a frame dump:
+
+     stbi_write_frame_dump *stbi_write_frame_dump_open(const stbi_write_frame_sink *sink,
+                          int w, int h, int comp, int jpg_quality, int buffers, int threads);
+     stbi_write_frame_dump *stbi_write_frame_dump_open_files(char const *pattern,
+                          int w, int h, int comp, int jpg_quality, int buffers, int threads);
+     int stbi_write_frame_dump_push(stbi_write_frame_dump *d, const void *data, int stride_in_bytes, int wait);
+     int stbi_write_frame_dump_close(stbi_write_frame_dump *d);
+
+   Every frame has the same size and number of components. The dump
+   allocates 'buffers' frame buffers up front and starts 'threads' worker
+   threads. stbi_write_frame_dump_push() copies the frame into a free buffer
+   and returns; a worker then encodes it with stbi_write_png_to_func(), or
+   with stbi_write_jpg_to_func() at 'jpg_quality' if that is non-zero. When
+   every buffer is waiting to be encoded, push waits for one to come free if
+   'wait' is non-zero, or else drops the frame and returns 0. Frames are
+   numbered from 0 in the order they're pushed, dropped ones included, so the
+   numbers stay in step with the frames rendered. Use more buffers to ride
+   out bursts, and more threads when encoding is slower than rendering.
+
+   The sink says where each frame goes. open() is called on a worker with
+   the frame number and returns the context passed to write() (NULL for an
+   error), and close() gets the same context back and returns 0 for an
+   error. stbi_write_frame_dump_open_files() writes each frame to a file
+   named by passing its number to sprintf() with 'pattern', which should
+   contain a single integer conversion such as "dump/%06d.png".
+
+   stbi_write_frame_dump_close() waits for every pushed frame to be written
+   and returns 0 if any of them couldn't be. The workers use Win32 threads on
+   Windows and pthreads elsewhere, so you may need to link with -pthread.
+   With STBI_WRITE_NO_THREADS defined, or on other platforms, push encodes
+   the frame itself before returning.
 
 CREDITS:
 
@@ -133,6 +203,7 @@ extern "C" {
 #else
 #define STBIWDEF extern
 extern int stbi_write_tga_with_rle;
+extern int stbi_write_png_compression_level;
 #endif
 
 #ifndef STBI_WRITE_NO_STDIO
@@ -151,6 +222,31 @@ STBIWDEF int stbi_write_tga_to_func(stbi_write_func *func, void *context, int w,
 STBIWDEF int stbi_write_hdr_to_func(stbi_write_func *func, void *context, int w, int h, int comp, const float *data);
 STBIWDEF int stbi_write_jpg_to_func(stbi_write_func *func, void *context, int x, int y, int comp, const void  *data, int quality);
 
+typedef void stbi_write_job(void *job_data, int job_index);
+typedef void stbi_write_run_jobs(void *user, stbi_write_job *job, void *job_data, int job_count);
+
+// NULL (the default) compresses PNG bands one at a time on the calling thread
+STBIWDEF void stbi_write_png_set_run_jobs(stbi_write_run_jobs *run_jobs, void *user);
+// same for JPEG strips
+STBIWDEF void stbi_write_jpg_set_run_jobs(stbi_write_run_jobs *run_jobs, void *user);
+
+typedef struct stbi_write_frame_dump stbi_write_frame_dump;
+
+typedef struct
+{
+   void *(*open)(void *user, int frame);        // returns the context for write(), NULL on failure
+   stbi_write_func *write;
+   int (*close)(void *user, void *context);   // returns 0 on failure
+   void *user;
+} stbi_write_frame_sink;
+
+STBIWDEF stbi_write_frame_dump *stbi_write_frame_dump_open(const stbi_write_frame_sink *sink, int w, int h, int comp, int jpg_quality, int buffers, int threads);
+#ifndef STBI_WRITE_NO_STDIO
+STBIWDEF stbi_write_frame_dump *stbi_write_frame_dump_open_files(char const *pattern, int w, int h, int comp, int jpg_quality, int buffers, int threads);
+#endif
+STBIWDEF int stbi_write_frame_dump_push(stbi_write_frame_dump *d, const void *data, int stride_in_bytes, int wait);
+STBIWDEF int stbi_write_frame_dump_close(stbi_write_frame_dump *d);
+
 #ifdef __cplusplus
 }
 #endif
@@ -177,6 +273,31 @@ STBIWDEF int stbi_write_jpg_to_func(stbi_write_func *func, void *context, int x,
 #include <string.h>
 #include <math.h>
 
+// worker threads for the frame dump
+#ifndef STBI_WRITE_NO_THREADS
+   #if defined(_WIN32)
+      #include <windows.h>
+      #define STBIW__HAS_THREADS
+   #elif defined(__unix__) || defined(__APPLE__)
+      #include <pthread.h>
+      #define STBIW__HAS_THREADS
+   #endif
+#endif
+
+// SSE2 for the JPEG writer's DCT and colour conversion; it's part of every
+// x64 target, so there is no run-time check
+#if !defined(STBIW_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+   #include <emmintrin.h>
+   #define STBIW_SSE2
+#endif
+
+#ifdef STBIW_RETRO_ARENA
+#include "retro_arena.h"
+#define STBIW_MALLOC(sz)        retro_arena_malloc(sz)
+#define STBIW_REALLOC(p,newsz)  retro_arena_realloc(p,newsz)
+#define STBIW_FREE(p)           retro_arena_free(p)
+#endif
+
 #if defined(STBIW_MALLOC) && defined(STBIW_FREE) && (defined(STBIW_REALLOC) || defined(STBIW_REALLOC_SIZED))
 // ok
 #elif !defined(STBIW_MALLOC) && !defined(STBIW_FREE) && !defined(STBIW_REALLOC) && !defined(STBIW_REALLOC_SIZED)
@@ -247,8 +368,10 @@ typedef int stb_image_write_test[sizeof(stbiw_uint32)==4 ? 1 : -1];
 
 #ifdef STB_IMAGE_WRITE_STATIC
 static int stbi_write_tga_with_rle = 1;
+static int stbi_write_png_compression_level = 8;
 #else
 int stbi_write_tga_with_rle = 1;
+int stbi_write_png_compression_level = 8;
 #endif
 
 static void stbiw__writefv(stbi__write_context *s, const char *fmt, va_list v)
@@ -742,7 +865,11 @@ static unsigned int stbiw__zhash(unsigned char *data)
 
 #define stbiw__ZHASH   16384
 
-unsigned char * stbi_zlib_compress(unsigned char *data, int data_len, int *out_len, int quality)
+// compress data as one fixed-huffman deflate block, returning a stretchy
+// buffer. with quality <= 0 only runs of repeated bytes are matched. unless
+// it is the last, the block is followed by an empty stored block, which ends
+// the output on a byte boundary so that another band's blocks can follow
+static unsigned char *stbiw__zlib_compress_band(unsigned char *data, int data_len, int quality, int last)
 {
    static unsigned short lengthc[] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258, 259 };
    static unsigned char  lengtheb[]= { 0,0,0,0,0,0,0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4,  4,  5,  5,  5,  5,  0 };
@@ -751,103 +878,176 @@ unsigned char * stbi_zlib_compress(unsigned char *data, int data_len, int *out_l
    unsigned int bitbuf=0;
    int i,j, bitcount=0;
    unsigned char *out = NULL;
-   unsigned char ***hash_table = (unsigned char***) STBIW_MALLOC(stbiw__ZHASH * sizeof(char**));
-   if (quality < 5) quality = 5;
 
-   stbiw__sbpush(out, 0x78);   // DEFLATE 32K window
-   stbiw__sbpush(out, 0x5e);   // FLEVEL = 1
-   stbiw__zlib_add(1,1);  // BFINAL = 1
+   stbiw__zlib_add(last ? 1 : 0,1);  // BFINAL
    stbiw__zlib_add(1,2);  // BTYPE = 1 -- fixed huffman
 
-   for (i=0; i < stbiw__ZHASH; ++i)
-      hash_table[i] = NULL;
-
-   i=0;
-   while (i < data_len-3) {
-      // hash next 3 bytes of data to be compressed
-      int h = stbiw__zhash(data+i)&(stbiw__ZHASH-1), best=3;
-      unsigned char *bestloc = 0;
-      unsigned char **hlist = hash_table[h];
-      int n = stbiw__sbcount(hlist);
-      for (j=0; j < n; ++j) {
-         if (hlist[j]-data > i-32768) { // if entry lies within window
-            int d = stbiw__zlib_countm(hlist[j], data+i, data_len-i);
-            if (d >= best) best=d,bestloc=hlist[j];
+   if (quality <= 0) {
+      // run-length only: a run of 3 or more copies of the previous byte is
+      // a match at distance 1 (distance code 0, no extra bits). literals are
+      // most of the output here, so their bit-reversed codes are tabled
+      unsigned short litcode[256];
+      for (i=0; i < 256; ++i)
+         litcode[i] = (unsigned short) (i <= 143 ? stbiw__zlib_bitrev(0x30 + i, 8) : stbiw__zlib_bitrev(0x190 + i-144, 9));
+      i=0;
+      while (i < data_len) {
+         int best = 0;
+         if (i > 0)
+            while (best < 258 && i+best < data_len && data[i+best] == data[i-1])
+               ++best;
+         if (best >= 3) {
+            for (j=0; best > lengthc[j+1]-1; ++j);
+            stbiw__zlib_huff(j+257);
+            if (lengtheb[j]) stbiw__zlib_add(best - lengthc[j], lengtheb[j]);
+            stbiw__zlib_add(0,5);
+            i += best;
+         } else {
+            stbiw__zlib_add(litcode[data[i]], data[i] <= 143 ? 8 : 9);
+            ++i;
          }
       }
-      // when hash table entry is too long, delete half the entries
-      if (hash_table[h] && stbiw__sbn(hash_table[h]) == 2*quality) {
-         STBIW_MEMMOVE(hash_table[h], hash_table[h]+quality, sizeof(hash_table[h][0])*quality);
-         stbiw__sbn(hash_table[h]) = quality;
-      }
-      stbiw__sbpush(hash_table[h],data+i);
-
-      if (bestloc) {
-         // "lazy matching" - check match at *next* byte, and if it's better, do cur byte as literal
-         h = stbiw__zhash(data+i+1)&(stbiw__ZHASH-1);
-         hlist = hash_table[h];
-         n = stbiw__sbcount(hlist);
+   } else {
+      unsigned char ***hash_table = (unsigned char***) STBIW_MALLOC(stbiw__ZHASH * sizeof(char**));
+      if (!hash_table) { (void) stbiw__sbfree(out); return NULL; }
+      if (quality < 5) quality = 5;
+
+      for (i=0; i < stbiw__ZHASH; ++i)
+         hash_table[i] = NULL;
+
+      i=0;
+      while (i < data_len-3) {
+         // hash next 3 bytes of data to be compressed
+         int h = stbiw__zhash(data+i)&(stbiw__ZHASH-1), best=3;
+         unsigned char *bestloc = 0;
+         unsigned char **hlist = hash_table[h];
+         int n = stbiw__sbcount(hlist);
          for (j=0; j < n; ++j) {
-            if (hlist[j]-data > i-32767) {
-               int e = stbiw__zlib_countm(hlist[j], data+i+1, data_len-i-1);
-               if (e > best) { // if next match is better, bail on current match
-                  bestloc = NULL;
-                  break;
+            if (hlist[j]-data > i-32768) { // if entry lies within window
+               int d = stbiw__zlib_countm(hlist[j], data+i, data_len-i);
+               if (d >= best) best=d,bestloc=hlist[j];
+            }
+         }
+         // when hash table entry is too long, delete half the entries
+         if (hash_table[h] && stbiw__sbn(hash_table[h]) == 2*quality) {
+            STBIW_MEMMOVE(hash_table[h], hash_table[h]+quality, sizeof(hash_table[h][0])*quality);
+            stbiw__sbn(hash_table[h]) = quality;
+         }
+         stbiw__sbpush(hash_table[h],data+i);
+
+         if (bestloc) {
+            // "lazy matching" - check match at *next* byte, and if it's better, do cur byte as literal
+            h = stbiw__zhash(data+i+1)&(stbiw__ZHASH-1);
+            hlist = hash_table[h];
+            n = stbiw__sbcount(hlist);
+            for (j=0; j < n; ++j) {
+               if (hlist[j]-data > i-32767) {
+                  int e = stbiw__zlib_countm(hlist[j], data+i+1, data_len-i-1);
+                  if (e > best) { // if next match is better, bail on current match
+                     bestloc = NULL;
+                     break;
+                  }
                }
             }
          }
-      }
 
-      if (bestloc) {
-         int d = (int) (data+i - bestloc); // distance back
-         STBIW_ASSERT(d <= 32767 && best <= 258);
-         for (j=0; best > lengthc[j+1]-1; ++j);
-         stbiw__zlib_huff(j+257);
-         if (lengtheb[j]) stbiw__zlib_add(best - lengthc[j], lengtheb[j]);
-         for (j=0; d > distc[j+1]-1; ++j);
-         stbiw__zlib_add(stbiw__zlib_bitrev(j,5),5);
-         if (disteb[j]) stbiw__zlib_add(d - distc[j], disteb[j]);
-         i += best;
-      } else {
-         stbiw__zlib_huffb(data[i]);
-         ++i;
+         if (bestloc) {
+            int d = (int) (data+i - bestloc); // distance back
+            STBIW_ASSERT(d <= 32767 && best <= 258);
+            for (j=0; best > lengthc[j+1]-1; ++j);
+            stbiw__zlib_huff(j+257);
+            if (lengtheb[j]) stbiw__zlib_add(best - lengthc[j], lengtheb[j]);
+            for (j=0; d > distc[j+1]-1; ++j);
+            stbiw__zlib_add(stbiw__zlib_bitrev(j,5),5);
+            if (disteb[j]) stbiw__zlib_add(d - distc[j], disteb[j]);
+            i += best;
+         } else {
+            stbiw__zlib_huffb(data[i]);
+            ++i;
+         }
       }
+      // write out final bytes
+      for (;i < data_len; ++i)
+         stbiw__zlib_huffb(data[i]);
+
+      for (i=0; i < stbiw__ZHASH; ++i)
+         (void) stbiw__sbfree(hash_table[i]);
+      STBIW_FREE(hash_table);
    }
-   // write out final bytes
-   for (;i < data_len; ++i)
-      stbiw__zlib_huffb(data[i]);
    stbiw__zlib_huff(256); // end of block
+   if (!last) {
+      // empty stored block: BFINAL = 0, BTYPE = 0, pad, LEN = 0, NLEN = ~0
+      stbiw__zlib_add(0,3);
+      while (bitcount)
+         stbiw__zlib_add(0,1);
+      stbiw__sbpush(out, 0x00);
+      stbiw__sbpush(out, 0x00);
+      stbiw__sbpush(out, 0xff);
+      stbiw__sbpush(out, 0xff);
+   }
    // pad with 0 bits to byte boundary
    while (bitcount)
       stbiw__zlib_add(0,1);
+   return out;
+}
 
-   for (i=0; i < stbiw__ZHASH; ++i)
-      (void) stbiw__sbfree(hash_table[i]);
-   STBIW_FREE(hash_table);
+#define stbiw__ADLER_MOD 65521
 
-   {
-      // compute adler32 on input
-      unsigned int s1=1, s2=0;
-      int blocklen = (int) (data_len % 5552);
-      j=0;
-      while (j < data_len) {
-         for (i=0; i < blocklen; ++i) s1 += data[j+i], s2 += s1;
-         s1 %= 65521, s2 %= 65521;
-         j += blocklen;
-         blocklen = 5552;
-      }
-      stbiw__sbpush(out, STBIW_UCHAR(s2 >> 8));
-      stbiw__sbpush(out, STBIW_UCHAR(s2));
-      stbiw__sbpush(out, STBIW_UCHAR(s1 >> 8));
-      stbiw__sbpush(out, STBIW_UCHAR(s1));
+// adler32 of data, continuing from a previous value (1 for a new stream)
+static unsigned int stbiw__adler32(unsigned int adler, unsigned char *data, int data_len)
+{
+   unsigned int s1 = adler & 0xffff, s2 = adler >> 16;
+   int i, j=0, blocklen = (int) (data_len % 5552);
+   while (j < data_len) {
+      for (i=0; i < blocklen; ++i) s1 += data[j+i], s2 += s1;
+      s1 %= stbiw__ADLER_MOD, s2 %= stbiw__ADLER_MOD;
+      j += blocklen;
+      blocklen = 5552;
    }
+   return (s2 << 16) | s1;
+}
+
+// adler32 of two buffers one after the other, from the adler32 of each and
+// the length of the second
+static unsigned int stbiw__adler32_combine(unsigned int a1, unsigned int a2, int len2)
+{
+   unsigned int rem = (unsigned int) len2 % stbiw__ADLER_MOD;
+   unsigned int s1a = a1 & 0xffff, s2a = a1 >> 16;
+   unsigned int s1b = a2 & 0xffff, s2b = a2 >> 16;
+   unsigned int s1 = (s1a + s1b + stbiw__ADLER_MOD - 1) % stbiw__ADLER_MOD;
+   unsigned int s2 = (rem * s1a) % stbiw__ADLER_MOD; // both < 65521, so this can't overflow
+   s2 = (s2 + s2a + s2b + stbiw__ADLER_MOD - rem) % stbiw__ADLER_MOD;
+   return (s2 << 16) | s1;
+}
+
+unsigned char * stbi_zlib_compress(unsigned char *data, int data_len, int *out_len, int quality)
+{
+   unsigned char *out = NULL, *block;
+   unsigned int adler;
+   int n;
+
+   block = stbiw__zlib_compress_band(data, data_len, quality < 5 ? 5 : quality, 1);
+   if (!block) return NULL;
+   n = stbiw__sbn(block);
+   stbiw__sbmaybegrow(out, n + 6);
+   stbiw__sbpush(out, 0x78);   // DEFLATE 32K window
+   stbiw__sbpush(out, 0x5e);   // FLEVEL = 1
+   STBIW_MEMMOVE(out + 2, block, n);
+   stbiw__sbn(out) += n;
+   (void) stbiw__sbfree(block);
+
+   adler = stbiw__adler32(1, data, data_len);
+   stbiw__sbpush(out, STBIW_UCHAR(adler >> 24));
+   stbiw__sbpush(out, STBIW_UCHAR(adler >> 16));
+   stbiw__sbpush(out, STBIW_UCHAR(adler >> 8));
+   stbiw__sbpush(out, STBIW_UCHAR(adler));
    *out_len = stbiw__sbn(out);
    // make returned pointer freeable
    STBIW_MEMMOVE(stbiw__sbraw(out), out, *out_len);
    return (unsigned char *) stbiw__sbraw(out);
 }
 
-static unsigned int stbiw__crc32(unsigned char *buffer, int len)
+// crc of buffer, continuing from a previous value (0 for a new one)
+static unsigned int stbiw__crc32(unsigned int crc, unsigned char *buffer, int len)
 {
    static unsigned int crc_table[256] =
    {
@@ -885,8 +1085,8 @@ static unsigned int stbiw__crc32(unsigned char *buffer, int len)
       0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
    };
 
-   unsigned int crc = ~0u;
    int i;
+   crc = ~crc;
    for (i=0; i < len; ++i)
       crc = (crc >> 8) ^ crc_table[buffer[i] ^ (crc & 0xff)];
    return ~crc;
@@ -896,12 +1096,6 @@ static unsigned int stbiw__crc32(unsigned char *buffer, int len)
 #define stbiw__wp32(data,v) stbiw__wpng4(data, (v)>>24,(v)>>16,(v)>>8,(v));
 #define stbiw__wptag(data,s) stbiw__wpng4(data, s[0],s[1],s[2],s[3])
 
-static void stbiw__wpcrc(unsigned char **data, int len)
-{
-   unsigned int crc = stbiw__crc32(*data - len - 4, len+4);
-   stbiw__wp32(*data, crc);
-}
-
 static unsigned char stbiw__paeth(int a, int b, int c)
 {
    int p = a + b - c, pa = abs(p-a), pb = abs(p-b), pc = abs(p-c);
@@ -910,74 +1104,188 @@ static unsigned char stbiw__paeth(int a, int b, int c)
    return STBIW_UCHAR(c);
 }
 
-// @OPTIMIZE: provide an option that always forces left-predict or paeth predict
-unsigned char *stbi_write_png_to_mem(unsigned char *pixels, int stride_bytes, int x, int y, int n, int *out_len)
+// filter row j into filt (the filter type byte, then x*n bytes). the fast
+// mode always uses "up", which is "none" on the first row
+static void stbiw__png_filter_row(unsigned char *pixels, int stride_bytes, int x, int n, int j, int fast, signed char *line_buffer, unsigned char *filt)
+{
+   static int mapping[] = { 0,1,2,3,4 };
+   static int firstmap[] = { 0,1,0,5,6 };
+   int *mymap = (j != 0) ? mapping : firstmap;
+   int best = 0, bestval = 0x7fffffff;
+   int i,k,p;
+   if (fast) {
+      unsigned char *z = pixels + stride_bytes*j;
+      filt[0] = 2;
+      if (j == 0)
+         STBIW_MEMMOVE(filt+1, z, x*n);
+      else
+         for (i=0; i < x*n; ++i)
+            filt[i+1] = STBIW_UCHAR(z[i] - z[i-stride_bytes]);
+      return;
+   }
+   for (p=0; p < 2; ++p) {
+      for (k= p?best:0; k < 5; ++k) { // @TODO: clarity: rewrite this to go 0..5, and 'continue' the unwanted ones during 2nd pass
+         int type = mymap[k],est=0;
+         unsigned char *z = pixels + stride_bytes*j;
+         for (i=0; i < n; ++i)
+            switch (type) {
+               case 0: line_buffer[i] = z[i]; break;
+               case 1: line_buffer[i] = z[i]; break;
+               case 2: line_buffer[i] = z[i] - z[i-stride_bytes]; break;
+               case 3: line_buffer[i] = z[i] - (z[i-stride_bytes]>>1); break;
+               case 4: line_buffer[i] = (signed char) (z[i] - stbiw__paeth(0,z[i-stride_bytes],0)); break;
+               case 5: line_buffer[i] = z[i]; break;
+               case 6: line_buffer[i] = z[i]; break;
+            }
+         for (i=n; i < x*n; ++i) {
+            switch (type) {
+               case 0: line_buffer[i] = z[i]; break;
+               case 1: line_buffer[i] = z[i] - z[i-n]; break;
+               case 2: line_buffer[i] = z[i] - z[i-stride_bytes]; break;
+               case 3: line_buffer[i] = z[i] - ((z[i-n] + z[i-stride_bytes])>>1); break;
+               case 4: line_buffer[i] = z[i] - stbiw__paeth(z[i-n], z[i-stride_bytes], z[i-stride_bytes-n]); break;
+               case 5: line_buffer[i] = z[i] - (z[i-n]>>1); break;
+               case 6: line_buffer[i] = z[i] - stbiw__paeth(z[i-n], 0,0); break;
+            }
+         }
+         if (p) break;
+         for (i=0; i < x*n; ++i)
+            est += abs((signed char) line_buffer[i]);
+         if (est < bestval) { bestval = est; best = k; }
+      }
+   }
+   // when we get here, best contains the filter type, and line_buffer contains the data
+   filt[0] = (unsigned char) best;
+   STBIW_MEMMOVE(filt+1, line_buffer, x*n);
+}
+
+// the PNG writer compresses bands of about this many bytes of filtered data
+// independently, so that they can be written as soon as they are done and
+// compressed in parallel
+#define stbiw__PNG_BAND_BYTES (1 << 18)
+
+typedef struct
+{
+   unsigned char *pixels;
+   int stride_bytes, x, n, quality;
+   int y0, y1, last;    // rows y0..y1-1; last if it's the final band
+   unsigned char *zlib; // out: stretchy buffer of deflate data, NULL on failure
+   unsigned int adler;  // out: adler32 of the filtered rows
+} stbiw__png_band;
+
+static void stbiw__png_band_job(void *job_data, int job_index)
+{
+   stbiw__png_band *b = (stbiw__png_band *) job_data + job_index;
+   int j, row = b->x*b->n+1, len = (b->y1-b->y0) * row;
+   unsigned char *filt = (unsigned char *) STBIW_MALLOC(len);
+   signed char *line_buffer = (signed char *) STBIW_MALLOC(b->x * b->n);
+   b->zlib = NULL;
+   if (filt && line_buffer) {
+      for (j=b->y0; j < b->y1; ++j)
+         stbiw__png_filter_row(b->pixels, b->stride_bytes, b->x, b->n, j, b->quality <= 0, line_buffer, filt + (j-b->y0)*row);
+      b->zlib = stbiw__zlib_compress_band(filt, len, b->quality, b->last);
+      b->adler = stbiw__adler32(1, filt, len);
+   }
+   if (line_buffer) STBIW_FREE(line_buffer);
+   if (filt) STBIW_FREE(filt);
+}
+
+static stbi_write_run_jobs *stbiw__png_run_jobs = NULL;
+static void *stbiw__png_run_jobs_user = NULL;
+
+STBIWDEF void stbi_write_png_set_run_jobs(stbi_write_run_jobs *run_jobs, void *user)
+{
+   stbiw__png_run_jobs = run_jobs;
+   stbiw__png_run_jobs_user = user;
+}
+
+static void stbiw__write_png_chunk_start(stbi__write_context *s, const char *tag, int len, unsigned int *crc)
+{
+   unsigned char b[8];
+   unsigned char *o = b;
+   stbiw__wp32(o, len);
+   stbiw__wptag(o, tag);
+   s->func(s->context, b, 8);
+   *crc = stbiw__crc32(0, b+4, 4);
+}
+
+static void stbiw__write_png_chunk_data(stbi__write_context *s, void *data, int len, unsigned int *crc)
+{
+   s->func(s->context, data, len);
+   *crc = stbiw__crc32(*crc, (unsigned char *) data, len);
+}
+
+static void stbiw__write_png_chunk_end(stbi__write_context *s, unsigned int crc)
+{
+   unsigned char b[4];
+   unsigned char *o = b;
+   stbiw__wp32(o, crc);
+   s->func(s->context, b, 4);
+}
+
+// write one band as an IDAT chunk, with the zlib header before the first band
+// and the checksum after the last
+static void stbiw__write_png_band(stbi__write_context *s, stbiw__png_band *b, int first, unsigned int adler)
+{
+   static unsigned char zhdr[2] = { 0x78, 0x5e }; // DEFLATE 32K window, FLEVEL = 1
+   unsigned char zend[4];
+   unsigned int crc;
+   int n = stbiw__sbn(b->zlib);
+   stbiw__write_png_chunk_start(s, "IDAT", n + (first ? 2 : 0) + (b->last ? 4 : 0), &crc);
+   if (first) stbiw__write_png_chunk_data(s, zhdr, 2, &crc);
+   stbiw__write_png_chunk_data(s, b->zlib, n, &crc);
+   if (b->last) {
+      unsigned char *o = zend;
+      stbiw__wp32(o, adler);
+      stbiw__write_png_chunk_data(s, zend, 4, &crc);
+   }
+   stbiw__write_png_chunk_end(s, crc);
+}
+
+static int stbi_write_png_core(stbi__write_context *s, unsigned char *pixels, int stride_bytes, int x, int y, int n)
 {
    int ctype[5] = { -1, 0, 4, 2, 6 };
    unsigned char sig[8] = { 137,80,78,71,13,10,26,10 };
-   unsigned char *out,*o, *filt, *zlib;
-   signed char *line_buffer;
-   int i,j,k,p,zlen;
+   unsigned char hdr[13], *o = hdr;
+   unsigned int crc, adler = 1;
+   int rows, count, i, ok = 1;
+   stbiw__png_band *bands;
 
+   if (x <= 0 || y <= 0) return 0;
    if (stride_bytes == 0)
       stride_bytes = x * n;
 
-   filt = (unsigned char *) STBIW_MALLOC((x*n+1) * y); if (!filt) return 0;
-   line_buffer = (signed char *) STBIW_MALLOC(x * n); if (!line_buffer) { STBIW_FREE(filt); return 0; }
-   for (j=0; j < y; ++j) {
-      static int mapping[] = { 0,1,2,3,4 };
-      static int firstmap[] = { 0,1,0,5,6 };
-      int *mymap = (j != 0) ? mapping : firstmap;
-      int best = 0, bestval = 0x7fffffff;
-      for (p=0; p < 2; ++p) {
-         for (k= p?best:0; k < 5; ++k) { // @TODO: clarity: rewrite this to go 0..5, and 'continue' the unwanted ones during 2nd pass
-            int type = mymap[k],est=0;
-            unsigned char *z = pixels + stride_bytes*j;
-            for (i=0; i < n; ++i)
-               switch (type) {
-                  case 0: line_buffer[i] = z[i]; break;
-                  case 1: line_buffer[i] = z[i]; break;
-                  case 2: line_buffer[i] = z[i] - z[i-stride_bytes]; break;
-                  case 3: line_buffer[i] = z[i] - (z[i-stride_bytes]>>1); break;
-                  case 4: line_buffer[i] = (signed char) (z[i] - stbiw__paeth(0,z[i-stride_bytes],0)); break;
-                  case 5: line_buffer[i] = z[i]; break;
-                  case 6: line_buffer[i] = z[i]; break;
-               }
-            for (i=n; i < x*n; ++i) {
-               switch (type) {
-                  case 0: line_buffer[i] = z[i]; break;
-                  case 1: line_buffer[i] = z[i] - z[i-n]; break;
-                  case 2: line_buffer[i] = z[i] - z[i-stride_bytes]; break;
-                  case 3: line_buffer[i] = z[i] - ((z[i-n] + z[i-stride_bytes])>>1); break;
-                  case 4: line_buffer[i] = z[i] - stbiw__paeth(z[i-n], z[i-stride_bytes], z[i-stride_bytes-n]); break;
-                  case 5: line_buffer[i] = z[i] - (z[i-n]>>1); break;
-                  case 6: line_buffer[i] = z[i] - stbiw__paeth(z[i-n], 0,0); break;
-               }
-            }
-            if (p) break;
-            for (i=0; i < x*n; ++i)
-               est += abs((signed char) line_buffer[i]);
-            if (est < bestval) { bestval = est; best = k; }
-         }
+   rows = stbiw__PNG_BAND_BYTES / (x*n+1);
+   if (rows < 1) rows = 1;
+   count = (y + rows-1) / rows;
+   // with a job runner all the bands are compressed up front, otherwise
+   // they are compressed and written one at a time
+   bands = (stbiw__png_band *) STBIW_MALLOC(sizeof(*bands) * (stbiw__png_run_jobs ? count : 1));
+   if (!bands) return 0;
+   for (i=0; i < (stbiw__png_run_jobs ? count : 1); ++i) {
+      bands[i].pixels = pixels;
+      bands[i].stride_bytes = stride_bytes;
+      bands[i].x = x;
+      bands[i].n = n;
+      bands[i].quality = stbi_write_png_compression_level;
+      bands[i].y0 = i * rows;
+      bands[i].y1 = i+1 == count ? y : (i+1) * rows;
+      bands[i].last = i+1 == count;
+      bands[i].zlib = NULL;
+   }
+   if (stbiw__png_run_jobs) {
+      stbiw__png_run_jobs(stbiw__png_run_jobs_user, stbiw__png_band_job, bands, count);
+      for (i=0; i < count; ++i)
+         if (!bands[i].zlib) ok = 0;
+      if (!ok) {
+         for (i=0; i < count; ++i)
+            (void) stbiw__sbfree(bands[i].zlib);
+         STBIW_FREE(bands);
+         return 0;
       }
-      // when we get here, best contains the filter type, and line_buffer contains the data
-      filt[j*(x*n+1)] = (unsigned char) best;
-      STBIW_MEMMOVE(filt+j*(x*n+1)+1, line_buffer, x*n);
    }
-   STBIW_FREE(line_buffer);
-   zlib = stbi_zlib_compress(filt, y*( x*n+1), &zlen, 8); // increase 8 to get smaller but use more memory
-   STBIW_FREE(filt);
-   if (!zlib) return 0;
-
-   // each tag requires 12 bytes of overhead
-   out = (unsigned char *) STBIW_MALLOC(8 + 12+13 + 12+zlen + 12);
-   if (!out) return 0;
-   *out_len = 8 + 12+13 + 12+zlen + 12;
-
-   o=out;
-   STBIW_MEMMOVE(o,sig,8); o+= 8;
-   stbiw__wp32(o, 13); // header length
-   stbiw__wptag(o, "IHDR");
+
+   s->func(s->context, sig, 8);
    stbiw__wp32(o, x);
    stbiw__wp32(o, y);
    *o++ = 8;
@@ -985,48 +1293,74 @@ unsigned char *stbi_write_png_to_mem(unsigned char *pixels, int stride_bytes, in
    *o++ = 0;
    *o++ = 0;
    *o++ = 0;
-   stbiw__wpcrc(&o,13);
-
-   stbiw__wp32(o, zlen);
-   stbiw__wptag(o, "IDAT");
-   STBIW_MEMMOVE(o, zlib, zlen);
-   o += zlen;
-   STBIW_FREE(zlib);
-   stbiw__wpcrc(&o, zlen);
+   stbiw__write_png_chunk_start(s, "IHDR", 13, &crc);
+   stbiw__write_png_chunk_data(s, hdr, 13, &crc);
+   stbiw__write_png_chunk_end(s, crc);
+
+   for (i=0; i < count; ++i) {
+      stbiw__png_band *b = bands;
+      if (stbiw__png_run_jobs)
+         b += i;
+      else {
+         b->y0 = i * rows;
+         b->y1 = i+1 == count ? y : (i+1) * rows;
+         b->last = i+1 == count;
+         stbiw__png_band_job(b, 0);
+         if (!b->zlib) { ok = 0; break; } // the file so far is truncated
+      }
+      adler = i ? stbiw__adler32_combine(adler, b->adler, (b->y1 - b->y0) * (x*n+1)) : b->adler;
+      stbiw__write_png_band(s, b, i == 0, adler);
+      (void) stbiw__sbfree(b->zlib);
+   }
+   STBIW_FREE(bands);
+   if (!ok) return 0;
 
-   stbiw__wp32(o,0);
-   stbiw__wptag(o, "IEND");
-   stbiw__wpcrc(&o,0);
+   stbiw__write_png_chunk_start(s, "IEND", 0, &crc);
+   stbiw__write_png_chunk_end(s, crc);
+   return 1;
+}
 
-   STBIW_ASSERT(o == out + *out_len);
+static void stbiw__write_to_sb(void *context, void *data, int size)
+{
+   unsigned char **out = (unsigned char **) context;
+   stbiw__sbmaybegrow(*out, size);
+   STBIW_MEMMOVE(*out + stbiw__sbn(*out), data, size);
+   stbiw__sbn(*out) += size;
+}
 
-   return out;
+unsigned char *stbi_write_png_to_mem(unsigned char *pixels, int stride_bytes, int x, int y, int n, int *out_len)
+{
+   stbi__write_context s;
+   unsigned char *out = NULL;
+   stbi__start_write_callbacks(&s, stbiw__write_to_sb, &out);
+   if (!stbi_write_png_core(&s, pixels, stride_bytes, x, y, n)) {
+      (void) stbiw__sbfree(out);
+      return 0;
+   }
+   *out_len = stbiw__sbn(out);
+   // make returned pointer freeable
+   STBIW_MEMMOVE(stbiw__sbraw(out), out, *out_len);
+   return (unsigned char *) stbiw__sbraw(out);
 }
 
 #ifndef STBI_WRITE_NO_STDIO
 STBIWDEF int stbi_write_png(char const *filename, int x, int y, int comp, const void *data, int stride_bytes)
 {
-   FILE *f;
-   int len;
-   unsigned char *png = stbi_write_png_to_mem((unsigned char *) data, stride_bytes, x, y, comp, &len);
-   if (png == NULL) return 0;
-   f = fopen(filename, "wb");
-   if (!f) { STBIW_FREE(png); return 0; }
-   fwrite(png, 1, len, f);
-   fclose(f);
-   STBIW_FREE(png);
-   return 1;
+   stbi__write_context s;
+   if (stbi__start_write_file(&s,filename)) {
+      int r = stbi_write_png_core(&s, (unsigned char *) data, stride_bytes, x, y, comp);
+      stbi__end_write_file(&s);
+      return r;
+   } else
+      return 0;
 }
 #endif
 
 STBIWDEF int stbi_write_png_to_func(stbi_write_func *func, void *context, int x, int y, int comp, const void *data, int stride_bytes)
 {
-   int len;
-   unsigned char *png = stbi_write_png_to_mem((unsigned char *) data, stride_bytes, x, y, comp, &len);
-   if (png == NULL) return 0;
-   func(context, png, len);
-   STBIW_FREE(png);
-   return 1;
+   stbi__write_context s;
+   stbi__start_write_callbacks(&s, func, context);
+   return stbi_write_png_core(&s, (unsigned char *) data, stride_bytes, x, y, comp);
 }
 
 
@@ -1041,23 +1375,37 @@ STBIWDEF int stbi_write_png_to_func(stbi_write_func *func, void *context, int x,
 static const unsigned char stbiw__jpg_ZigZag[] = { 0,1,5,6,14,15,27,28,2,4,7,13,16,26,29,42,3,8,12,17,25,30,41,43,9,11,18,
       24,31,40,44,53,10,19,23,32,39,45,52,54,20,22,33,38,46,51,55,60,21,34,37,47,50,56,59,61,35,36,48,49,57,58,62,63 };
 
-static void stbiw__jpg_writeBits(stbi__write_context *s, int *bitBufP, int *bitCntP, const unsigned short *bs) {
-   int bitBuf = *bitBufP, bitCnt = *bitCntP;
+// entropy-coded output of one strip. processDU reserves room for a whole
+// block up front, so writeBits can store bytes without checking
+typedef struct
+{
+   unsigned char *out; // stretchy buffer
+   int bitBuf, bitCnt;
+} stbiw__jpg_bits;
+
+// one 8x8 block codes to at most 64 codes of 16+11 bits, doubled by 0xFF stuffing
+#define stbiw__JPG_BLOCK_BYTES 512
+
+static void stbiw__jpg_writeBits(stbiw__jpg_bits *b, const unsigned short *bs) {
+   int bitBuf = b->bitBuf, bitCnt = b->bitCnt;
+   unsigned char *o = b->out + stbiw__sbn(b->out);
    bitCnt += bs[1];
    bitBuf |= bs[0] << (24 - bitCnt);
    while(bitCnt >= 8) {
       unsigned char c = (bitBuf >> 16) & 255;
-      stbiw__putc(s, c);
+      *o++ = c;
       if(c == 255) {
-         stbiw__putc(s, 0);
+         *o++ = 0;
       }
       bitBuf <<= 8;
       bitCnt -= 8;
    }
-   *bitBufP = bitBuf;
-   *bitCntP = bitCnt;
+   stbiw__sbn(b->out) = (int) (o - b->out);
+   b->bitBuf = bitBuf;
+   b->bitCnt = bitCnt;
 }
 
+#ifndef STBIW_SSE2
 static void stbiw__jpg_DCT(float *d0p, float *d1p, float *d2p, float *d3p, float *d4p, float *d5p, float *d6p, float *d7p) {
    float d0 = *d0p, d1 = *d1p, d2 = *d2p, d3 = *d3p, d4 = *d4p, d5 = *d5p, d6 = *d6p, d7 = *d7p;
    float z1, z2, z3, z4, z5, z11, z13;
@@ -1106,6 +1454,117 @@ static void stbiw__jpg_DCT(float *d0p, float *d1p, float *d2p, float *d3p, float
    *d0p = d0;  *d2p = d2;  *d4p = d4;  *d6p = d6;
 }
 
+#else
+// stbiw__jpg_DCT on four columns at once, d[0], d[step], ... being the rows;
+// same operations in the same order, so the results are the same
+static void stbiw__jpg_DCT_sse2(__m128 *d, int step) {
+   __m128 d0 = d[0], d1 = d[step], d2 = d[2*step], d3 = d[3*step];
+   __m128 d4 = d[4*step], d5 = d[5*step], d6 = d[6*step], d7 = d[7*step];
+   __m128 z1, z2, z3, z4, z5, z11, z13;
+
+   __m128 tmp0 = _mm_add_ps(d0, d7);
+   __m128 tmp7 = _mm_sub_ps(d0, d7);
+   __m128 tmp1 = _mm_add_ps(d1, d6);
+   __m128 tmp6 = _mm_sub_ps(d1, d6);
+   __m128 tmp2 = _mm_add_ps(d2, d5);
+   __m128 tmp5 = _mm_sub_ps(d2, d5);
+   __m128 tmp3 = _mm_add_ps(d3, d4);
+   __m128 tmp4 = _mm_sub_ps(d3, d4);
+
+   __m128 tmp10 = _mm_add_ps(tmp0, tmp3);
+   __m128 tmp13 = _mm_sub_ps(tmp0, tmp3);
+   __m128 tmp11 = _mm_add_ps(tmp1, tmp2);
+   __m128 tmp12 = _mm_sub_ps(tmp1, tmp2);
+
+   d[0]      = _mm_add_ps(tmp10, tmp11);
+   d[4*step] = _mm_sub_ps(tmp10, tmp11);
+
+   z1 = _mm_mul_ps(_mm_add_ps(tmp12, tmp13), _mm_set1_ps(0.707106781f));
+   d[2*step] = _mm_add_ps(tmp13, z1);
+   d[6*step] = _mm_sub_ps(tmp13, z1);
+
+   tmp10 = _mm_add_ps(tmp4, tmp5);
+   tmp11 = _mm_add_ps(tmp5, tmp6);
+   tmp12 = _mm_add_ps(tmp6, tmp7);
+
+   z5 = _mm_mul_ps(_mm_sub_ps(tmp10, tmp12), _mm_set1_ps(0.382683433f));
+   z2 = _mm_add_ps(_mm_mul_ps(tmp10, _mm_set1_ps(0.541196100f)), z5);
+   z4 = _mm_add_ps(_mm_mul_ps(tmp12, _mm_set1_ps(1.306562965f)), z5);
+   z3 = _mm_mul_ps(tmp11, _mm_set1_ps(0.707106781f));
+
+   z11 = _mm_add_ps(tmp7, z3);
+   z13 = _mm_sub_ps(tmp7, z3);
+
+   d[5*step] = _mm_add_ps(z13, z2);
+   d[3*step] = _mm_sub_ps(z13, z2);
+   d[1*step] = _mm_add_ps(z11, z4);
+   d[7*step] = _mm_sub_ps(z11, z4);
+}
+
+// transpose an 8x8 block held as v[2*row] (columns 0-3) and v[2*row+1] (4-7)
+static void stbiw__jpg_transpose_sse2(__m128 *v) {
+   __m128 t;
+   _MM_TRANSPOSE4_PS(v[0], v[2], v[4], v[6]);
+   _MM_TRANSPOSE4_PS(v[1], v[3], v[5], v[7]);
+   _MM_TRANSPOSE4_PS(v[8], v[10], v[12], v[14]);
+   _MM_TRANSPOSE4_PS(v[9], v[11], v[13], v[15]);
+   t = v[1];  v[1] = v[8];   v[8] = t;
+   t = v[3];  v[3] = v[10];  v[10] = t;
+   t = v[5];  v[5] = v[12];  v[12] = t;
+   t = v[7];  v[7] = v[14];  v[14] = t;
+}
+#endif
+
+// DCT the 8x8 block at CDU (rows du_stride apart), then quantize/descale/zigzag it into DU
+static void stbiw__jpg_fdct_quantize(int *DU, float *CDU, int du_stride, const float *fdtbl) {
+#ifdef STBIW_SSE2
+   __m128 v[16];
+   int row, i;
+   for(row = 0; row < 8; ++row) {
+      v[2*row]   = _mm_loadu_ps(CDU + row*du_stride);
+      v[2*row+1] = _mm_loadu_ps(CDU + row*du_stride + 4);
+   }
+   // rows first, as the scalar code does
+   stbiw__jpg_transpose_sse2(v);
+   stbiw__jpg_DCT_sse2(v, 2);
+   stbiw__jpg_DCT_sse2(v+1, 2);
+   stbiw__jpg_transpose_sse2(v);
+   stbiw__jpg_DCT_sse2(v, 2);
+   stbiw__jpg_DCT_sse2(v+1, 2);
+   for(i = 0; i < 16; ++i) {
+      // round half away from zero, like the scalar (v < 0 ? v - 0.5f : v + 0.5f)
+      __m128 q = _mm_mul_ps(v[i], _mm_loadu_ps(fdtbl + i*4));
+      __m128 half = _mm_or_ps(_mm_and_ps(q, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+      int r[4];
+      _mm_storeu_si128((__m128i *) r, _mm_cvttps_epi32(_mm_add_ps(q, half)));
+      DU[stbiw__jpg_ZigZag[i*4+0]] = r[0];
+      DU[stbiw__jpg_ZigZag[i*4+1]] = r[1];
+      DU[stbiw__jpg_ZigZag[i*4+2]] = r[2];
+      DU[stbiw__jpg_ZigZag[i*4+3]] = r[3];
+   }
+#else
+   int dataOff, i, x, y, n;
+   // DCT rows
+   for(dataOff=0, n=du_stride*8; dataOff<n; dataOff+=du_stride) {
+      stbiw__jpg_DCT(&CDU[dataOff], &CDU[dataOff+1], &CDU[dataOff+2], &CDU[dataOff+3], &CDU[dataOff+4], &CDU[dataOff+5], &CDU[dataOff+6], &CDU[dataOff+7]);
+   }
+   // DCT columns
+   for(dataOff=0; dataOff<8; ++dataOff) {
+      stbiw__jpg_DCT(&CDU[dataOff], &CDU[dataOff+du_stride], &CDU[dataOff+du_stride*2], &CDU[dataOff+du_stride*3], &CDU[dataOff+du_stride*4],
+                     &CDU[dataOff+du_stride*5], &CDU[dataOff+du_stride*6], &CDU[dataOff+du_stride*7]);
+   }
+   // Quantize/descale/zigzag the coefficients
+   for(y = 0, i = 0; y < 8; ++y) {
+      for(x = 0; x < 8; ++x, ++i) {
+         float v = CDU[y*du_stride+x]*fdtbl[i];
+         // DU[stbiw__jpg_ZigZag[i]] = (int)(v < 0 ? ceilf(v - 0.5f) : floorf(v + 0.5f));
+         // ceilf() and floorf() are C99, not C89, but I /think/ they're not needed here anyway?
+         DU[stbiw__jpg_ZigZag[i]] = (int)(v < 0 ? v - 0.5f : v + 0.5f);
+      }
+   }
+#endif
+}
+
 static void stbiw__jpg_calcBits(int val, unsigned short bits[2]) {
    int tmp1 = val < 0 ? -val : val;
    val = val < 0 ? val-1 : val;
@@ -1116,37 +1575,24 @@ static void stbiw__jpg_calcBits(int val, unsigned short bits[2]) {
    bits[0] = val & ((1<<bits[1])-1);
 }
 
-static int stbiw__jpg_processDU(stbi__write_context *s, int *bitBuf, int *bitCnt, float *CDU, float *fdtbl, int DC, const unsigned short HTDC[256][2], const unsigned short HTAC[256][2]) {
+static int stbiw__jpg_processDU(stbiw__jpg_bits *b, float *CDU, int du_stride, const float *fdtbl, int DC, const unsigned short HTDC[256][2], const unsigned short HTAC[256][2]) {
    const unsigned short EOB[2] = { HTAC[0x00][0], HTAC[0x00][1] };
    const unsigned short M16zeroes[2] = { HTAC[0xF0][0], HTAC[0xF0][1] };
-   int dataOff, i, diff, end0pos;
+   int i, diff, end0pos;
    int DU[64];
 
-   // DCT rows
-   for(dataOff=0; dataOff<64; dataOff+=8) {
-      stbiw__jpg_DCT(&CDU[dataOff], &CDU[dataOff+1], &CDU[dataOff+2], &CDU[dataOff+3], &CDU[dataOff+4], &CDU[dataOff+5], &CDU[dataOff+6], &CDU[dataOff+7]);
-   }
-   // DCT columns
-   for(dataOff=0; dataOff<8; ++dataOff) {
-      stbiw__jpg_DCT(&CDU[dataOff], &CDU[dataOff+8], &CDU[dataOff+16], &CDU[dataOff+24], &CDU[dataOff+32], &CDU[dataOff+40], &CDU[dataOff+48], &CDU[dataOff+56]);
-   }
-   // Quantize/descale/zigzag the coefficients
-   for(i=0; i<64; ++i) {
-      float v = CDU[i]*fdtbl[i];
-      // DU[stbiw__jpg_ZigZag[i]] = (int)(v < 0 ? ceilf(v - 0.5f) : floorf(v + 0.5f));
-      // ceilf() and floorf() are C99, not C89, but I /think/ they're not needed here anyway?
-      DU[stbiw__jpg_ZigZag[i]] = (int)(v < 0 ? v - 0.5f : v + 0.5f);
-   }
+   stbiw__jpg_fdct_quantize(DU, CDU, du_stride, fdtbl);
+   stbiw__sbmaybegrow(b->out, stbiw__JPG_BLOCK_BYTES);
 
    // Encode DC
    diff = DU[0] - DC;
    if (diff == 0) {
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, HTDC[0]);
+      stbiw__jpg_writeBits(b, HTDC[0]);
    } else {
       unsigned short bits[2];
       stbiw__jpg_calcBits(diff, bits);
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, HTDC[bits[1]]);
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, bits);
+      stbiw__jpg_writeBits(b, HTDC[bits[1]]);
+      stbiw__jpg_writeBits(b, bits);
    }
    // Encode ACs
    end0pos = 63;
@@ -1154,7 +1600,7 @@ static int stbiw__jpg_processDU(stbi__write_context *s, int *bitBuf, int *bitCnt
    }
    // end0pos = first element in reverse order !=0
    if(end0pos == 0) {
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, EOB);
+      stbiw__jpg_writeBits(b, EOB);
       return DU[0];
    }
    for(i = 1; i <= end0pos; ++i) {
@@ -1168,19 +1614,191 @@ static int stbiw__jpg_processDU(stbi__write_context *s, int *bitBuf, int *bitCnt
          int lng = nrzeroes>>4;
          int nrmarker;
          for (nrmarker=1; nrmarker <= lng; ++nrmarker)
-            stbiw__jpg_writeBits(s, bitBuf, bitCnt, M16zeroes);
+            stbiw__jpg_writeBits(b, M16zeroes);
          nrzeroes &= 15;
       }
       stbiw__jpg_calcBits(DU[i], bits);
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, HTAC[(nrzeroes<<4)+bits[1]]);
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, bits);
+      stbiw__jpg_writeBits(b, HTAC[(nrzeroes<<4)+bits[1]]);
+      stbiw__jpg_writeBits(b, bits);
    }
    if(end0pos != 63) {
-      stbiw__jpg_writeBits(s, bitBuf, bitCnt, EOB);
+      stbiw__jpg_writeBits(b, EOB);
    }
    return DU[0];
 }
 
+// Huffman tables
+static const unsigned short stbiw__jpg_YDC_HT[256][2] = { {0,2},{2,3},{3,3},{4,3},{5,3},{6,3},{14,4},{30,5},{62,6},{126,7},{254,8},{510,9}};
+static const unsigned short stbiw__jpg_UVDC_HT[256][2] = { {0,2},{1,2},{2,2},{6,3},{14,4},{30,5},{62,6},{126,7},{254,8},{510,9},{1022,10},{2046,11}};
+static const unsigned short stbiw__jpg_YAC_HT[256][2] = {
+   {10,4},{0,2},{1,2},{4,3},{11,4},{26,5},{120,7},{248,8},{1014,10},{65410,16},{65411,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {12,4},{27,5},{121,7},{502,9},{2038,11},{65412,16},{65413,16},{65414,16},{65415,16},{65416,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {28,5},{249,8},{1015,10},{4084,12},{65417,16},{65418,16},{65419,16},{65420,16},{65421,16},{65422,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {58,6},{503,9},{4085,12},{65423,16},{65424,16},{65425,16},{65426,16},{65427,16},{65428,16},{65429,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {59,6},{1016,10},{65430,16},{65431,16},{65432,16},{65433,16},{65434,16},{65435,16},{65436,16},{65437,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {122,7},{2039,11},{65438,16},{65439,16},{65440,16},{65441,16},{65442,16},{65443,16},{65444,16},{65445,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {123,7},{4086,12},{65446,16},{65447,16},{65448,16},{65449,16},{65450,16},{65451,16},{65452,16},{65453,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {250,8},{4087,12},{65454,16},{65455,16},{65456,16},{65457,16},{65458,16},{65459,16},{65460,16},{65461,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {504,9},{32704,15},{65462,16},{65463,16},{65464,16},{65465,16},{65466,16},{65467,16},{65468,16},{65469,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {505,9},{65470,16},{65471,16},{65472,16},{65473,16},{65474,16},{65475,16},{65476,16},{65477,16},{65478,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {506,9},{65479,16},{65480,16},{65481,16},{65482,16},{65483,16},{65484,16},{65485,16},{65486,16},{65487,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {1017,10},{65488,16},{65489,16},{65490,16},{65491,16},{65492,16},{65493,16},{65494,16},{65495,16},{65496,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {1018,10},{65497,16},{65498,16},{65499,16},{65500,16},{65501,16},{65502,16},{65503,16},{65504,16},{65505,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {2040,11},{65506,16},{65507,16},{65508,16},{65509,16},{65510,16},{65511,16},{65512,16},{65513,16},{65514,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {65515,16},{65516,16},{65517,16},{65518,16},{65519,16},{65520,16},{65521,16},{65522,16},{65523,16},{65524,16},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {2041,11},{65525,16},{65526,16},{65527,16},{65528,16},{65529,16},{65530,16},{65531,16},{65532,16},{65533,16},{65534,16},{0,0},{0,0},{0,0},{0,0},{0,0}
+};
+static const unsigned short stbiw__jpg_UVAC_HT[256][2] = {
+   {0,2},{1,2},{4,3},{10,4},{24,5},{25,5},{56,6},{120,7},{500,9},{1014,10},{4084,12},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {11,4},{57,6},{246,8},{501,9},{2038,11},{4085,12},{65416,16},{65417,16},{65418,16},{65419,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {26,5},{247,8},{1015,10},{4086,12},{32706,15},{65420,16},{65421,16},{65422,16},{65423,16},{65424,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {27,5},{248,8},{1016,10},{4087,12},{65425,16},{65426,16},{65427,16},{65428,16},{65429,16},{65430,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {58,6},{502,9},{65431,16},{65432,16},{65433,16},{65434,16},{65435,16},{65436,16},{65437,16},{65438,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {59,6},{1017,10},{65439,16},{65440,16},{65441,16},{65442,16},{65443,16},{65444,16},{65445,16},{65446,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {121,7},{2039,11},{65447,16},{65448,16},{65449,16},{65450,16},{65451,16},{65452,16},{65453,16},{65454,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {122,7},{2040,11},{65455,16},{65456,16},{65457,16},{65458,16},{65459,16},{65460,16},{65461,16},{65462,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {249,8},{65463,16},{65464,16},{65465,16},{65466,16},{65467,16},{65468,16},{65469,16},{65470,16},{65471,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {503,9},{65472,16},{65473,16},{65474,16},{65475,16},{65476,16},{65477,16},{65478,16},{65479,16},{65480,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {504,9},{65481,16},{65482,16},{65483,16},{65484,16},{65485,16},{65486,16},{65487,16},{65488,16},{65489,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {505,9},{65490,16},{65491,16},{65492,16},{65493,16},{65494,16},{65495,16},{65496,16},{65497,16},{65498,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {506,9},{65499,16},{65500,16},{65501,16},{65502,16},{65503,16},{65504,16},{65505,16},{65506,16},{65507,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {2041,11},{65508,16},{65509,16},{65510,16},{65511,16},{65512,16},{65513,16},{65514,16},{65515,16},{65516,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {16352,14},{65517,16},{65518,16},{65519,16},{65520,16},{65521,16},{65522,16},{65523,16},{65524,16},{65525,16},{0,0},{0,0},{0,0},{0,0},{0,0},
+   {1018,10},{32707,15},{65526,16},{65527,16},{65528,16},{65529,16},{65530,16},{65531,16},{65532,16},{65533,16},{65534,16},{0,0},{0,0},{0,0},{0,0},{0,0}
+};
+
+// convert a row of pixels to Y, U and V, repeating the last pixel out to pw
+static void stbiw__jpg_convert_row(const unsigned char *p, int width, int comp, int pw, float *Y, float *U, float *V) {
+   // comp == 2 is grey+alpha (alpha is ignored)
+   int ofsG = comp > 2 ? 1 : 0, ofsB = comp > 2 ? 2 : 0;
+   int col = 0;
+#ifdef STBIW_SSE2
+   for(; col+4 <= width; col += 4, p += 4*comp) {
+      __m128 r = _mm_cvtepi32_ps(_mm_setr_epi32(p[0],    p[comp],      p[2*comp],      p[3*comp]));
+      __m128 g = _mm_cvtepi32_ps(_mm_setr_epi32(p[ofsG], p[comp+ofsG], p[2*comp+ofsG], p[3*comp+ofsG]));
+      __m128 b = _mm_cvtepi32_ps(_mm_setr_epi32(p[ofsB], p[comp+ofsB], p[2*comp+ofsB], p[3*comp+ofsB]));
+      _mm_storeu_ps(Y+col, _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(+0.29900f), r), _mm_mul_ps(_mm_set1_ps(0.58700f), g)),
+                                                 _mm_mul_ps(_mm_set1_ps(0.11400f), b)), _mm_set1_ps(128)));
+      _mm_storeu_ps(U+col, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(-0.16874f), r), _mm_mul_ps(_mm_set1_ps(0.33126f), g)),
+                                      _mm_mul_ps(_mm_set1_ps(0.50000f), b)));
+      _mm_storeu_ps(V+col, _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(+0.50000f), r), _mm_mul_ps(_mm_set1_ps(0.41869f), g)),
+                                      _mm_mul_ps(_mm_set1_ps(0.08131f), b)));
+   }
+#endif
+   for(; col < width; ++col, p += comp) {
+      float r = p[0], g = p[ofsG], b = p[ofsB];
+      Y[col]=+0.29900f*r+0.58700f*g+0.11400f*b-128;
+      U[col]=-0.16874f*r-0.33126f*g+0.50000f*b;
+      V[col]=+0.50000f*r-0.41869f*g-0.08131f*b;
+   }
+   for(; col < pw; ++col) {
+      Y[col] = Y[width-1];
+      U[col] = U[width-1];
+      V[col] = V[width-1];
+   }
+}
+
+// average each 2x2 of the 16x16 block at C (rows c_stride apart) into an 8x8 block
+static void stbiw__jpg_subsample(float *out, const float *C, int c_stride) {
+   int yy, xx;
+   for(yy = 0; yy < 8; ++yy, C += 2*c_stride, out += 8) {
+#ifdef STBIW_SSE2
+      for(xx = 0; xx < 8; xx += 4) {
+         __m128 a0 = _mm_loadu_ps(C + xx*2), a1 = _mm_loadu_ps(C + xx*2 + 4);
+         __m128 b0 = _mm_loadu_ps(C + c_stride + xx*2), b1 = _mm_loadu_ps(C + c_stride + xx*2 + 4);
+         __m128 sum = _mm_add_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2,0,2,0)), _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3,1,3,1)));
+         sum = _mm_add_ps(_mm_add_ps(sum, _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2,0,2,0))), _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3,1,3,1)));
+         _mm_storeu_ps(out + xx, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+      }
+#else
+      for(xx = 0; xx < 8; ++xx) {
+         out[xx] = (C[xx*2] + C[xx*2+1] + C[c_stride+xx*2] + C[c_stride+xx*2+1]) * 0.25f;
+      }
+#endif
+   }
+}
+
+// the JPEG writer encodes strips of about this many pixels independently,
+// each ending with a restart marker, so they can be encoded in parallel
+#define stbiw__JPG_STRIP_PIXELS (1 << 16)
+
+typedef struct
+{
+   const unsigned char *data;
+   int width, height, comp, subsample;
+   const float *fdtbl_Y, *fdtbl_UV;
+   int y0, y1;          // MCU rows y0..y1-1
+   int restart;         // number of the restart marker to end with, -1 for the last strip
+   unsigned char *out;  // in/out: stretchy buffer of entropy-coded data, NULL on failure
+} stbiw__jpg_strip;
+
+static void stbiw__jpg_strip_job(void *job_data, int job_index)
+{
+   static const unsigned short fillBits[] = {0x7F, 7};
+   stbiw__jpg_strip *b = (stbiw__jpg_strip *) job_data + job_index;
+   int mcu = b->subsample ? 16 : 8, pw = (b->width + mcu-1) / mcu * mcu;
+   float *Y = (float *) STBIW_MALLOC(sizeof(float) * 3 * mcu * pw), *U, *V;
+   int DCY=0, DCU=0, DCV=0;
+   int my, row, x;
+   stbiw__jpg_bits bits;
+
+   if (!Y) {
+      (void) stbiw__sbfree(b->out);
+      b->out = NULL;
+      return;
+   }
+   U = Y + mcu*pw;
+   V = U + mcu*pw;
+   bits.out = b->out;
+   bits.bitBuf = 0;
+   bits.bitCnt = 0;
+   if (bits.out) stbiw__sbn(bits.out) = 0;
+
+   for(my = b->y0; my < b->y1; ++my) {
+      for(row = 0; row < mcu; ++row) {
+         // rows past the bottom repeat the last one
+         int y = my*mcu + row < b->height ? my*mcu + row : b->height-1;
+         stbiw__jpg_convert_row(b->data + (size_t) y*b->width*b->comp, b->width, b->comp, pw, Y + row*pw, U + row*pw, V + row*pw);
+      }
+      for(x = 0; x < pw; x += mcu) {
+         if (b->subsample) {
+            float subU[64], subV[64];
+            DCY = stbiw__jpg_processDU(&bits, Y+x,        pw, b->fdtbl_Y, DCY, stbiw__jpg_YDC_HT, stbiw__jpg_YAC_HT);
+            DCY = stbiw__jpg_processDU(&bits, Y+x+8,      pw, b->fdtbl_Y, DCY, stbiw__jpg_YDC_HT, stbiw__jpg_YAC_HT);
+            DCY = stbiw__jpg_processDU(&bits, Y+x+8*pw,   pw, b->fdtbl_Y, DCY, stbiw__jpg_YDC_HT, stbiw__jpg_YAC_HT);
+            DCY = stbiw__jpg_processDU(&bits, Y+x+8*pw+8, pw, b->fdtbl_Y, DCY, stbiw__jpg_YDC_HT, stbiw__jpg_YAC_HT);
+            stbiw__jpg_subsample(subU, U+x, pw);
+            stbiw__jpg_subsample(subV, V+x, pw);
+            DCU = stbiw__jpg_processDU(&bits, subU, 8, b->fdtbl_UV, DCU, stbiw__jpg_UVDC_HT, stbiw__jpg_UVAC_HT);
+            DCV = stbiw__jpg_processDU(&bits, subV, 8, b->fdtbl_UV, DCV, stbiw__jpg_UVDC_HT, stbiw__jpg_UVAC_HT);
+         } else {
+            DCY = stbiw__jpg_processDU(&bits, Y+x, pw, b->fdtbl_Y,  DCY, stbiw__jpg_YDC_HT,  stbiw__jpg_YAC_HT);
+            DCU = stbiw__jpg_processDU(&bits, U+x, pw, b->fdtbl_UV, DCU, stbiw__jpg_UVDC_HT, stbiw__jpg_UVAC_HT);
+            DCV = stbiw__jpg_processDU(&bits, V+x, pw, b->fdtbl_UV, DCV, stbiw__jpg_UVDC_HT, stbiw__jpg_UVAC_HT);
+         }
+      }
+   }
+   STBIW_FREE(Y);
+
+   // Do the bit alignment of the restart or EOI marker
+   stbiw__sbmaybegrow(bits.out, 2);
+   stbiw__jpg_writeBits(&bits, fillBits);
+   if (b->restart >= 0) {
+      stbiw__sbpush(bits.out, 0xFF);
+      stbiw__sbpush(bits.out, STBIW_UCHAR(0xD0 + b->restart));
+   }
+   b->out = bits.out;
+}
+
+static stbi_write_run_jobs *stbiw__jpg_run_jobs = NULL;
+static void *stbiw__jpg_run_jobs_user = NULL;
+
+STBIWDEF void stbi_write_jpg_set_run_jobs(stbi_write_run_jobs *run_jobs, void *user)
+{
+   stbiw__jpg_run_jobs = run_jobs;
+   stbiw__jpg_run_jobs_user = user;
+}
+
 static int stbi_write_jpg_core(stbi__write_context *s, int width, int height, int comp, const void* data, int quality) {
    // Constants that don't pollute global namespace
    static const unsigned char std_dc_luminance_nrcodes[] = {0,0,1,5,1,1,1,1,1,1,0,0,0,0,0,0,0};
@@ -1207,45 +1825,6 @@ static int stbi_write_jpg_core(stbi__write_context *s, int width, int height, in
       0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,
       0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa
    };
-   // Huffman tables
-   static const unsigned short YDC_HT[256][2] = { {0,2},{2,3},{3,3},{4,3},{5,3},{6,3},{14,4},{30,5},{62,6},{126,7},{254,8},{510,9}};
-   static const unsigned short UVDC_HT[256][2] = { {0,2},{1,2},{2,2},{6,3},{14,4},{30,5},{62,6},{126,7},{254,8},{510,9},{1022,10},{2046,11}};
-   static const unsigned short YAC_HT[256][2] = {
-      {10,4},{0,2},{1,2},{4,3},{11,4},{26,5},{120,7},{248,8},{1014,10},{65410,16},{65411,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {12,4},{27,5},{121,7},{502,9},{2038,11},{65412,16},{65413,16},{65414,16},{65415,16},{65416,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {28,5},{249,8},{1015,10},{4084,12},{65417,16},{65418,16},{65419,16},{65420,16},{65421,16},{65422,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {58,6},{503,9},{4085,12},{65423,16},{65424,16},{65425,16},{65426,16},{65427,16},{65428,16},{65429,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {59,6},{1016,10},{65430,16},{65431,16},{65432,16},{65433,16},{65434,16},{65435,16},{65436,16},{65437,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {122,7},{2039,11},{65438,16},{65439,16},{65440,16},{65441,16},{65442,16},{65443,16},{65444,16},{65445,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {123,7},{4086,12},{65446,16},{65447,16},{65448,16},{65449,16},{65450,16},{65451,16},{65452,16},{65453,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {250,8},{4087,12},{65454,16},{65455,16},{65456,16},{65457,16},{65458,16},{65459,16},{65460,16},{65461,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {504,9},{32704,15},{65462,16},{65463,16},{65464,16},{65465,16},{65466,16},{65467,16},{65468,16},{65469,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {505,9},{65470,16},{65471,16},{65472,16},{65473,16},{65474,16},{65475,16},{65476,16},{65477,16},{65478,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {506,9},{65479,16},{65480,16},{65481,16},{65482,16},{65483,16},{65484,16},{65485,16},{65486,16},{65487,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {1017,10},{65488,16},{65489,16},{65490,16},{65491,16},{65492,16},{65493,16},{65494,16},{65495,16},{65496,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {1018,10},{65497,16},{65498,16},{65499,16},{65500,16},{65501,16},{65502,16},{65503,16},{65504,16},{65505,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {2040,11},{65506,16},{65507,16},{65508,16},{65509,16},{65510,16},{65511,16},{65512,16},{65513,16},{65514,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {65515,16},{65516,16},{65517,16},{65518,16},{65519,16},{65520,16},{65521,16},{65522,16},{65523,16},{65524,16},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {2041,11},{65525,16},{65526,16},{65527,16},{65528,16},{65529,16},{65530,16},{65531,16},{65532,16},{65533,16},{65534,16},{0,0},{0,0},{0,0},{0,0},{0,0}
-   };
-   static const unsigned short UVAC_HT[256][2] = {
-      {0,2},{1,2},{4,3},{10,4},{24,5},{25,5},{56,6},{120,7},{500,9},{1014,10},{4084,12},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {11,4},{57,6},{246,8},{501,9},{2038,11},{4085,12},{65416,16},{65417,16},{65418,16},{65419,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {26,5},{247,8},{1015,10},{4086,12},{32706,15},{65420,16},{65421,16},{65422,16},{65423,16},{65424,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {27,5},{248,8},{1016,10},{4087,12},{65425,16},{65426,16},{65427,16},{65428,16},{65429,16},{65430,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {58,6},{502,9},{65431,16},{65432,16},{65433,16},{65434,16},{65435,16},{65436,16},{65437,16},{65438,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {59,6},{1017,10},{65439,16},{65440,16},{65441,16},{65442,16},{65443,16},{65444,16},{65445,16},{65446,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {121,7},{2039,11},{65447,16},{65448,16},{65449,16},{65450,16},{65451,16},{65452,16},{65453,16},{65454,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {122,7},{2040,11},{65455,16},{65456,16},{65457,16},{65458,16},{65459,16},{65460,16},{65461,16},{65462,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {249,8},{65463,16},{65464,16},{65465,16},{65466,16},{65467,16},{65468,16},{65469,16},{65470,16},{65471,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {503,9},{65472,16},{65473,16},{65474,16},{65475,16},{65476,16},{65477,16},{65478,16},{65479,16},{65480,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {504,9},{65481,16},{65482,16},{65483,16},{65484,16},{65485,16},{65486,16},{65487,16},{65488,16},{65489,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {505,9},{65490,16},{65491,16},{65492,16},{65493,16},{65494,16},{65495,16},{65496,16},{65497,16},{65498,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {506,9},{65499,16},{65500,16},{65501,16},{65502,16},{65503,16},{65504,16},{65505,16},{65506,16},{65507,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {2041,11},{65508,16},{65509,16},{65510,16},{65511,16},{65512,16},{65513,16},{65514,16},{65515,16},{65516,16},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {16352,14},{65517,16},{65518,16},{65519,16},{65520,16},{65521,16},{65522,16},{65523,16},{65524,16},{65525,16},{0,0},{0,0},{0,0},{0,0},{0,0},
-      {1018,10},{32707,15},{65526,16},{65527,16},{65528,16},{65529,16},{65530,16},{65531,16},{65532,16},{65533,16},{65534,16},{0,0},{0,0},{0,0},{0,0},{0,0}
-   };
    static const int YQT[] = {16,11,10,16,24,40,51,61,12,12,14,19,26,58,60,55,14,13,16,24,40,57,69,56,14,17,22,29,51,87,80,62,18,22,
                              37,56,68,109,103,77,24,35,55,64,81,104,113,92,49,64,78,87,103,121,120,101,72,92,95,98,112,100,103,99};
    static const int UVQT[] = {17,18,24,47,99,99,99,99,18,21,26,66,99,99,99,99,24,26,56,99,99,99,99,99,47,66,99,99,99,99,99,99,
@@ -1253,15 +1832,19 @@ static int stbi_write_jpg_core(stbi__write_context *s, int width, int height, in
    static const float aasf[] = { 1.0f * 2.828427125f, 1.387039845f * 2.828427125f, 1.306562965f * 2.828427125f, 1.175875602f * 2.828427125f, 
                                  1.0f * 2.828427125f, 0.785694958f * 2.828427125f, 0.541196100f * 2.828427125f, 0.275899379f * 2.828427125f };
 
-   int row, col, i, k;
+   int row, col, i, k, subsample;
    float fdtbl_Y[64], fdtbl_UV[64];
    unsigned char YTable[64], UVTable[64];
+   int mcu, mcus_per_row, mcu_rows, rows, count, ok = 1;
+   stbiw__jpg_strip *strips;
 
    if(!data || !width || !height || comp > 4 || comp < 1) {
       return 0;
    }
 
    quality = quality ? quality : 90;
+   // 4:2:0 chroma subsampling, except at the highest qualities
+   subsample = quality <= 90 ? 1 : 0;
    quality = quality < 1 ? 1 : quality > 100 ? 100 : quality;
    quality = quality < 50 ? 5000 / quality : 200 - quality * 2;
 
@@ -1279,12 +1862,50 @@ static int stbi_write_jpg_core(stbi__write_context *s, int width, int height, in
       }
    }
 
+   // a restart interval can't be more than 65535 MCUs
+   mcu = subsample ? 16 : 8;
+   mcus_per_row = (width + mcu-1) / mcu;
+   mcu_rows = (height + mcu-1) / mcu;
+   rows = stbiw__JPG_STRIP_PIXELS / (mcus_per_row * mcu * mcu);
+   if (rows > 65535 / mcus_per_row) rows = 65535 / mcus_per_row;
+   if (rows < 1) rows = 1;
+   count = (mcu_rows + rows-1) / rows;
+   // with a job runner all the strips are encoded up front, otherwise
+   // they are encoded and written one at a time
+   strips = (stbiw__jpg_strip *) STBIW_MALLOC(sizeof(*strips) * (stbiw__jpg_run_jobs ? count : 1));
+   if (!strips) return 0;
+   for (i=0; i < (stbiw__jpg_run_jobs ? count : 1); ++i) {
+      strips[i].data = (const unsigned char *) data;
+      strips[i].width = width;
+      strips[i].height = height;
+      strips[i].comp = comp;
+      strips[i].subsample = subsample;
+      strips[i].fdtbl_Y = fdtbl_Y;
+      strips[i].fdtbl_UV = fdtbl_UV;
+      strips[i].y0 = i * rows;
+      strips[i].y1 = i+1 == count ? mcu_rows : (i+1) * rows;
+      strips[i].restart = i+1 == count ? -1 : i & 7;
+      strips[i].out = NULL;
+   }
+   if (stbiw__jpg_run_jobs) {
+      stbiw__jpg_run_jobs(stbiw__jpg_run_jobs_user, stbiw__jpg_strip_job, strips, count);
+      for (i=0; i < count; ++i)
+         if (!strips[i].out) ok = 0;
+      if (!ok) {
+         for (i=0; i < count; ++i)
+            (void) stbiw__sbfree(strips[i].out);
+         STBIW_FREE(strips);
+         return 0;
+      }
+   }
+
    // Write Headers
    {
       static const unsigned char head0[] = { 0xFF,0xD8,0xFF,0xE0,0,0x10,'J','F','I','F',0,1,1,0,0,1,0,1,0,0,0xFF,0xDB,0,0x84,0 };
       static const unsigned char head2[] = { 0xFF,0xDA,0,0xC,3,1,0,2,0x11,3,0x11,0,0x3F,0 };
       const unsigned char head1[] = { 0xFF,0xC0,0,0x11,8,(unsigned char)(height>>8),STBIW_UCHAR(height),(unsigned char)(width>>8),STBIW_UCHAR(width),
-                                      3,1,0x11,0,2,0x11,1,3,0x11,1,0xFF,0xC4,0x01,0xA2,0 };
+                                      3,1,(unsigned char)(subsample?0x22:0x11),0,2,0x11,1,3,0x11,1,0xFF,0xC4,0x01,0xA2,0 };
+      const unsigned char dri[] = { 0xFF,0xDD,0,4,(unsigned char)((rows*mcus_per_row)>>8),STBIW_UCHAR(rows*mcus_per_row) };
       s->func(s->context, (void*)head0, sizeof(head0));
       s->func(s->context, (void*)YTable, sizeof(YTable));
       stbiw__putc(s, 1);
@@ -1301,50 +1922,31 @@ static int stbi_write_jpg_core(stbi__write_context *s, int width, int height, in
       stbiw__putc(s, 0x11); // HTUACinfo
       s->func(s->context, (void*)(std_ac_chrominance_nrcodes+1), sizeof(std_ac_chrominance_nrcodes)-1);
       s->func(s->context, (void*)std_ac_chrominance_values, sizeof(std_ac_chrominance_values));
+      if (count > 1)
+         s->func(s->context, (void*)dri, sizeof(dri));
       s->func(s->context, (void*)head2, sizeof(head2));
    }
 
-   // Encode 8x8 macroblocks
-   {
-      static const unsigned short fillBits[] = {0x7F, 7};
-      const unsigned char *imageData = (const unsigned char *)data;
-      int DCY=0, DCU=0, DCV=0;
-      int bitBuf=0, bitCnt=0;
-      // comp == 2 is grey+alpha (alpha is ignored)
-      int ofsG = comp > 2 ? 1 : 0, ofsB = comp > 2 ? 2 : 0;
-      int x, y, pos;
-      for(y = 0; y < height; y += 8) {
-         for(x = 0; x < width; x += 8) {
-            float YDU[64], UDU[64], VDU[64];
-            for(row = y, pos = 0; row < y+8; ++row) {
-               for(col = x; col < x+8; ++col, ++pos) {
-                  int p = row*width*comp + col*comp;
-                  float r, g, b;
-                  if(row >= height) {
-                     p -= width*comp*(row+1 - height);
-                  }
-                  if(col >= width) {
-                     p -= comp*(col+1 - width);
-                  }
-
-                  r = imageData[p+0];
-                  g = imageData[p+ofsG];
-                  b = imageData[p+ofsB];
-                  YDU[pos]=+0.29900f*r+0.58700f*g+0.11400f*b-128;
-                  UDU[pos]=-0.16874f*r-0.33126f*g+0.50000f*b;
-                  VDU[pos]=+0.50000f*r-0.41869f*g-0.08131f*b;
-               }
-            }
-
-            DCY = stbiw__jpg_processDU(s, &bitBuf, &bitCnt, YDU, fdtbl_Y, DCY, YDC_HT, YAC_HT);
-            DCU = stbiw__jpg_processDU(s, &bitBuf, &bitCnt, UDU, fdtbl_UV, DCU, UVDC_HT, UVAC_HT);
-            DCV = stbiw__jpg_processDU(s, &bitBuf, &bitCnt, VDU, fdtbl_UV, DCV, UVDC_HT, UVAC_HT);
-         }
+   // Encode the strips of macroblocks
+   for (i=0; i < count; ++i) {
+      stbiw__jpg_strip *b = strips;
+      if (stbiw__jpg_run_jobs)
+         b += i;
+      else {
+         b->y0 = i * rows;
+         b->y1 = i+1 == count ? mcu_rows : (i+1) * rows;
+         b->restart = i+1 == count ? -1 : i & 7;
+         stbiw__jpg_strip_job(b, 0);
+         if (!b->out) { ok = 0; break; } // the file so far is truncated
       }
-
-      // Do the bit alignment of the EOI marker
-      stbiw__jpg_writeBits(s, &bitBuf, &bitCnt, fillBits);
+      s->func(s->context, b->out, stbiw__sbn(b->out));
+      if (stbiw__jpg_run_jobs)
+         (void) stbiw__sbfree(b->out);
    }
+   if (!stbiw__jpg_run_jobs)
+      (void) stbiw__sbfree(strips[0].out);
+   STBIW_FREE(strips);
+   if (!ok) return 0;
 
    // EOI
    stbiw__putc(s, 0xFF);
@@ -1374,6 +1976,351 @@ STBIWDEF int stbi_write_jpg(char const *filename, int x, int y, int comp, const
 }
 #endif
 
+/* ***************************************************************************
+ *
+ * Frame dump
+ *
+ * The caller pushes frames into a fixed pool of buffers; workers take them in
+ * order from a queue of filled buffers, encode them and put the buffers back
+ * on the free list.
+ */
+
+struct stbi_write_frame_dump
+{
+   stbi_write_frame_sink sink;
+   int w, h, comp, quality;
+   int buffers;
+   unsigned char **buffer;
+   int *frame;               // frame number in each buffer
+   int *free_list;           // buffers ready to fill, used as a stack
+   int num_free;
+   int *queue;               // filled buffers in the order they were pushed
+   int queue_head, queue_count;
+   int next_frame;
+   int failed;
+   int stopping;
+   int threads;              // number of workers running, 0 to encode in push
+   char *pattern;            // owned copy for stbi_write_frame_dump_open_files
+#ifdef STBIW__HAS_THREADS
+#if defined(_WIN32)
+   HANDLE *thread;
+   CRITICAL_SECTION lock;
+   CONDITION_VARIABLE filled;
+   CONDITION_VARIABLE emptied;
+#else
+   pthread_t *thread;
+   pthread_mutex_t lock;
+   pthread_cond_t filled;
+   pthread_cond_t emptied;
+#endif
+#endif
+};
+
+// returns 0 on failure
+static int stbiw__frame_encode(stbi_write_frame_dump *d, int frame, const unsigned char *pixels, int stride_in_bytes)
+{
+   void *context = d->sink.open(d->sink.user, frame);
+   int ok;
+   if (context == NULL)
+      return 0;
+   if (d->quality)
+      ok = stbi_write_jpg_to_func(d->sink.write, context, d->w, d->h, d->comp, pixels, d->quality);
+   else
+      ok = stbi_write_png_to_func(d->sink.write, context, d->w, d->h, d->comp, pixels, stride_in_bytes);
+   if (!d->sink.close(d->sink.user, context))
+      ok = 0;
+   return ok;
+}
+
+static void stbiw__frame_copy(stbi_write_frame_dump *d, int b, const void *data, int stride_in_bytes)
+{
+   int j, row = d->w * d->comp;
+   for (j=0; j < d->h; ++j)
+      memcpy(d->buffer[b] + (size_t) row*j, (const unsigned char *) data + (size_t) stride_in_bytes*j, row);
+}
+
+#ifdef STBIW__HAS_THREADS
+#if defined(_WIN32)
+#define STBIW_THREAD_T            HANDLE
+#define stbiw__frame_lock(d)      EnterCriticalSection(&(d)->lock)
+#define stbiw__frame_unlock(d)    LeaveCriticalSection(&(d)->lock)
+#define stbiw__frame_wait(d,c)    SleepConditionVariableCS(&(d)->c, &(d)->lock, INFINITE)
+#define stbiw__frame_signal(d,c)  WakeConditionVariable(&(d)->c)
+#define stbiw__frame_wake_all(d,c) WakeAllConditionVariable(&(d)->c)
+#else
+#define STBIW_THREAD_T            pthread_t
+#define stbiw__frame_lock(d)      pthread_mutex_lock(&(d)->lock)
+#define stbiw__frame_unlock(d)    pthread_mutex_unlock(&(d)->lock)
+#define stbiw__frame_wait(d,c)    pthread_cond_wait(&(d)->c, &(d)->lock)
+#define stbiw__frame_signal(d,c)  pthread_cond_signal(&(d)->c)
+#define stbiw__frame_wake_all(d,c) pthread_cond_broadcast(&(d)->c)
+#endif
+
+#if defined(_WIN32)
+static DWORD WINAPI stbiw__frame_worker(LPVOID data)
+#else
+static void *stbiw__frame_worker(void *data)
+#endif
+{
+   stbi_write_frame_dump *d = (stbi_write_frame_dump *) data;
+   for (;;) {
+      int b, ok;
+      stbiw__frame_lock(d);
+      while (d->queue_count == 0 && !d->stopping)
+         stbiw__frame_wait(d, filled);
+      if (d->queue_count == 0) {
+         stbiw__frame_unlock(d);
+         break;
+      }
+      b = d->queue[d->queue_head];
+      d->queue_head = (d->queue_head + 1) % d->buffers;
+      --d->queue_count;
+      stbiw__frame_unlock(d);
+
+      ok = stbiw__frame_encode(d, d->frame[b], d->buffer[b], d->w*d->comp);
+
+      stbiw__frame_lock(d);
+      if (!ok) d->failed = 1;
+      d->free_list[d->num_free++] = b;
+      stbiw__frame_signal(d, emptied);
+      stbiw__frame_unlock(d);
+   }
+   return 0;
+}
+
+static void stbiw__frame_start_workers(stbi_write_frame_dump *d, int threads)
+{
+   if (threads <= 0)
+      return;
+   d->thread = (STBIW_THREAD_T *) STBIW_MALLOC(sizeof(*d->thread) * threads);
+   if (d->thread == NULL)
+      return;
+#if defined(_WIN32)
+   InitializeCriticalSection(&d->lock);
+   InitializeConditionVariable(&d->filled);
+   InitializeConditionVariable(&d->emptied);
+   while (d->threads < threads) {
+      d->thread[d->threads] = CreateThread(NULL, 0, stbiw__frame_worker, d, 0, NULL);
+      if (d->thread[d->threads] == NULL) break;
+      ++d->threads;
+   }
+   if (d->threads == 0)
+      DeleteCriticalSection(&d->lock);
+#else
+   if (pthread_mutex_init(&d->lock, NULL) != 0)
+      return;
+   if (pthread_cond_init(&d->filled, NULL) != 0) {
+      pthread_mutex_destroy(&d->lock);
+      return;
+   }
+   if (pthread_cond_init(&d->emptied, NULL) != 0) {
+      pthread_cond_destroy(&d->filled);
+      pthread_mutex_destroy(&d->lock);
+      return;
+   }
+   while (d->threads < threads) {
+      if (pthread_create(&d->thread[d->threads], NULL, stbiw__frame_worker, d) != 0) break;
+      ++d->threads;
+   }
+   if (d->threads == 0) {
+      pthread_cond_destroy(&d->emptied);
+      pthread_cond_destroy(&d->filled);
+      pthread_mutex_destroy(&d->lock);
+   }
+#endif
+}
+
+static void stbiw__frame_stop_workers(stbi_write_frame_dump *d)
+{
+   int i;
+   if (d->threads) {
+      stbiw__frame_lock(d);
+      d->stopping = 1;
+      stbiw__frame_wake_all(d, filled);
+      stbiw__frame_unlock(d);
+#if defined(_WIN32)
+      for (i=0; i < d->threads; ++i) {
+         WaitForSingleObject(d->thread[i], INFINITE);
+         CloseHandle(d->thread[i]);
+      }
+      DeleteCriticalSection(&d->lock);
+#else
+      for (i=0; i < d->threads; ++i)
+         pthread_join(d->thread[i], NULL);
+      pthread_cond_destroy(&d->emptied);
+      pthread_cond_destroy(&d->filled);
+      pthread_mutex_destroy(&d->lock);
+#endif
+   }
+   STBIW_FREE(d->thread);
+}
+#endif // STBIW__HAS_THREADS
+
+static void stbiw__frame_dump_free(stbi_write_frame_dump *d)
+{
+   int i;
+   if (d->buffer)
+      for (i=0; i < d->buffers; ++i)
+         STBIW_FREE(d->buffer[i]);
+   STBIW_FREE(d->buffer);
+   STBIW_FREE(d->frame);
+   STBIW_FREE(d->free_list);
+   STBIW_FREE(d->queue);
+   STBIW_FREE(d->pattern);
+   STBIW_FREE(d);
+}
+
+STBIWDEF stbi_write_frame_dump *stbi_write_frame_dump_open(const stbi_write_frame_sink *sink, int w, int h, int comp, int jpg_quality, int buffers, int threads)
+{
+   stbi_write_frame_dump *d;
+   int i;
+   if (w <= 0 || h <= 0 || comp < 1 || comp > 4 || w > 0x7fffffff / comp / h)
+      return NULL;
+#ifndef STBIW__HAS_THREADS
+   buffers = 1;
+   threads = 0;
+#endif
+   if (buffers < 1) buffers = 1;
+   d = (stbi_write_frame_dump *) STBIW_MALLOC(sizeof(*d));
+   if (!d) return NULL;
+   memset(d, 0, sizeof(*d));
+   d->sink = *sink;
+   d->w = w;
+   d->h = h;
+   d->comp = comp;
+   d->quality = jpg_quality;
+   d->buffers = buffers;
+   d->buffer = (unsigned char **) STBIW_MALLOC(sizeof(*d->buffer) * buffers);
+   d->frame = (int *) STBIW_MALLOC(sizeof(int) * buffers);
+   d->free_list = (int *) STBIW_MALLOC(sizeof(int) * buffers);
+   d->queue = (int *) STBIW_MALLOC(sizeof(int) * buffers);
+   if (d->buffer) memset(d->buffer, 0, sizeof(*d->buffer) * buffers);
+   if (!d->buffer || !d->frame || !d->free_list || !d->queue) {
+      stbiw__frame_dump_free(d);
+      return NULL;
+   }
+   for (i=0; i < buffers; ++i) {
+      d->buffer[i] = (unsigned char *) STBIW_MALLOC((size_t) w * h * comp);
+      if (!d->buffer[i]) {
+         stbiw__frame_dump_free(d);
+         return NULL;
+      }
+      d->free_list[i] = buffers-1 - i;
+   }
+   d->num_free = buffers;
+#ifdef STBIW__HAS_THREADS
+   // if no worker could be started, push encodes the frames itself
+   stbiw__frame_start_workers(d, threads);
+#else
+   (void) threads;
+#endif
+   return d;
+}
+
+STBIWDEF int stbi_write_frame_dump_push(stbi_write_frame_dump *d, const void *data, int stride_in_bytes, int wait)
+{
+   int b;
+   if (stride_in_bytes == 0)
+      stride_in_bytes = d->w * d->comp;
+
+   if (d->threads == 0) {
+      // the PNG writer takes a stride, the JPEG writer needs packed rows
+      int ok;
+      if (d->quality && stride_in_bytes != d->w * d->comp) {
+         stbiw__frame_copy(d, 0, data, stride_in_bytes);
+         data = d->buffer[0];
+      }
+      ok = stbiw__frame_encode(d, d->next_frame++, (const unsigned char *) data, stride_in_bytes);
+      if (!ok) d->failed = 1;
+      return ok;
+   }
+
+#ifdef STBIW__HAS_THREADS
+   stbiw__frame_lock(d);
+   while (d->num_free == 0) {
+      if (!wait) {
+         ++d->next_frame;
+         stbiw__frame_unlock(d);
+         return 0;
+      }
+      stbiw__frame_wait(d, emptied);
+   }
+   b = d->free_list[--d->num_free];
+   d->frame[b] = d->next_frame++;
+   stbiw__frame_unlock(d);
+
+   // the buffer belongs to this thread until it's queued
+   stbiw__frame_copy(d, b, data, stride_in_bytes);
+
+   stbiw__frame_lock(d);
+   d->queue[(d->queue_head + d->queue_count) % d->buffers] = b;
+   ++d->queue_count;
+   stbiw__frame_signal(d, filled);
+   stbiw__frame_unlock(d);
+   return 1;
+#else
+   (void) b;
+   (void) wait;
+   return 0;
+#endif
+}
+
+STBIWDEF int stbi_write_frame_dump_close(stbi_write_frame_dump *d)
+{
+   int ok;
+   if (d == NULL) return 0;
+#ifdef STBIW__HAS_THREADS
+   stbiw__frame_stop_workers(d);
+#endif
+   ok = !d->failed;
+   stbiw__frame_dump_free(d);
+   return ok;
+}
+
+#ifndef STBI_WRITE_NO_STDIO
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define stbiw__snprintf _snprintf
+#else
+#define stbiw__snprintf snprintf
+#endif
+
+static void *stbiw__frame_file_open(void *user, int frame)
+{
+   char name[1024];
+   int len = stbiw__snprintf(name, sizeof(name), (const char *) user, frame);
+   if (len < 0 || len >= (int) sizeof(name))
+      return NULL;
+   return fopen(name, "wb");
+}
+
+static int stbiw__frame_file_close(void *user, void *context)
+{
+   FILE *f = (FILE *) context;
+   int ok = !ferror(f);
+   (void) user;
+   return fclose(f) == 0 && ok;
+}
+
+STBIWDEF stbi_write_frame_dump *stbi_write_frame_dump_open_files(char const *pattern, int w, int h, int comp, int jpg_quality, int buffers, int threads)
+{
+   stbi_write_frame_sink sink;
+   stbi_write_frame_dump *d;
+   char *copy = (char *) STBIW_MALLOC(strlen(pattern) + 1);
+   if (!copy) return NULL;
+   strcpy(copy, pattern);
+   sink.open = stbiw__frame_file_open;
+   sink.write = stbi__stdio_write;
+   sink.close = stbiw__frame_file_close;
+   sink.user = copy;
+   d = stbi_write_frame_dump_open(&sink, w, h, comp, jpg_quality, buffers, threads);
+   if (d)
+      d->pattern = copy;
+   else
+      STBIW_FREE(copy);
+   return d;
+}
+#endif // !STBI_WRITE_NO_STDIO
+
 #endif // STB_IMAGE_WRITE_IMPLEMENTATION
 
 /* Revision history
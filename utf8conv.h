@@ -33,6 +33,12 @@
 
 #include <Windows.h>    // Win32 Platform SDK main header
 
+#if defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define UTF8CONV_SSE2 1
+#include <emmintrin.h>  // SSE2 intrinsics for ASCII fast path
+#endif
+
 
 
 namespace utf8util {
@@ -82,126 +88,178 @@ inline const char * utf8_error::what() const
 
 
 //------------------------------------------------------------------------
-// Converts a string from UTF-8 to UTF-16.
-// On error, can throw an utf8_error exception.
+// ASCII fast path.
+//
+// Both conversions copy the leading run of 7-bit characters directly,
+// 16 at a time with SSE2, and hand only the rest of the string to the
+// Win32 API. File paths and playlist entries are mostly ASCII, so the
+// API is often not called at all.
 //------------------------------------------------------------------------
-inline std::wstring utf16_from_utf8(const std::string & utf8)
-{
-    //
-    // Special case of empty input string
-    //
-    if (utf8.empty())
-        return std::wstring();
+namespace detail {
 
+// Widens the leading ASCII characters of src into dest.
+// Returns how many were copied.
+inline size_t widen_ascii(const char * src, size_t length, wchar_t * dest)
+{
+    size_t i = 0;
 
-    //
-    // Get length (in wchar_t's) of resulting UTF-16 string
-    //
-    const int utf16_length = ::MultiByteToWideChar(
-        CP_UTF8,            // convert from UTF-8
-        0,                  // default flags
-        utf8.data(),        // source UTF-8 string
-        utf8.length(),      // length (in chars) of source UTF-8 string
-        NULL,               // unused - no conversion done in this step
-        0                   // request size of destination buffer, in wchar_t's
-        );
-    if (utf16_length == 0)
+#if UTF8CONV_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16)
     {
-        // Error
-        DWORD error = ::GetLastError();
-        throw utf8_error(
-            "Can't get length of UTF-16 string (MultiByteToWideChar set last error to %lu).", 
-            error);
+        const __m128i bytes = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i));
+
+        // Stop at a block with any byte >= 0x80
+        if (_mm_movemask_epi8(bytes))
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i),
+            _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8),
+            _mm_unpackhi_epi8(bytes, zero));
     }
+#endif
 
+    for (; i < length && static_cast<unsigned char>(src[i]) < 0x80; ++i)
+        dest[i] = src[i];
 
-    //
-    // Allocate destination buffer for UTF-16 string
-    //
-    std::wstring utf16;
-    utf16.resize(utf16_length);
+    return i;
+}
 
 
-    //
-    // Do the conversion from UTF-8 to UTF-16
-    //
-    if ( ! ::MultiByteToWideChar(
-        CP_UTF8,            // convert from UTF-8
-        0,                  // default flags
-        utf8.data(),        // source UTF-8 string
-        utf8.length(),      // length (in chars) of source UTF-8 string
-        &utf16[0],          // destination buffer
-        utf16.length()      // size of destination buffer, in wchar_t's
-        ) )
+// Narrows the leading ASCII characters of src into dest.
+// Returns how many were copied.
+inline size_t narrow_ascii(const wchar_t * src, size_t length, char * dest)
+{
+    size_t i = 0;
+
+#if UTF8CONV_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 16 <= length; i += 16)
     {
-        // Error
-        DWORD error = ::GetLastError();
-        throw utf8_error(
-            "Can't convert string from UTF-8 to UTF-16 (MultiByteToWideChar set last error to %lu).", 
-            error);
+        const __m128i lo = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i));
+        const __m128i hi = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i + 8));
+
+        // Stop at a block with any unit >= 0x80
+        const __m128i high_bits = _mm_and_si128(_mm_or_si128(lo, hi), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i),
+            _mm_packus_epi16(lo, hi));
     }
+#endif
 
-    //
-    // Return resulting UTF-16 string
-    //
-    return utf16;
+    for (; i < length && src[i] < 0x80; ++i)
+        dest[i] = static_cast<char>(src[i]);
+
+    return i;
 }
 
+} // namespace detail
+
+
 
 //------------------------------------------------------------------------
-// Converts a string from UTF-16 to UTF-8.
+// Converts length chars of UTF-8 into utf16, reusing its storage.
+// Converts in one pass; the Win32 API is called at most once, and only
+// for the part after the leading ASCII run.
 // On error, can throw an utf8_error exception.
 //------------------------------------------------------------------------
-inline std::string utf8_from_utf16(const std::wstring & utf16)
+inline void utf16_from_utf8(const char * utf8, size_t length, std::wstring & utf16)
 {
     //
-    // Special case of empty input string
+    // Each UTF-8 char gives at most one UTF-16 wchar_t, so size
+    // the destination for the worst case and trim afterwards
     //
-    if (utf16.empty())
-        return std::string();
+    utf16.resize(length);
+    if (length == 0)
+        return;
+
+    const size_t ascii = detail::widen_ascii(utf8, length, &utf16[0]);
+    if (ascii == length)
+        return;
 
 
     //
-    // Get length (in chars) of resulting UTF-8 string
+    // Convert the rest, which starts on a character boundary
     //
-    const int utf8_length = ::WideCharToMultiByte(
-        CP_UTF8,            // convert to UTF-8
+    const int rest = static_cast<int>(length - ascii);
+    const int utf16_length = ::MultiByteToWideChar(
+        CP_UTF8,            // convert from UTF-8
         0,                  // default flags
-        utf16.data(),       // source UTF-16 string
-        utf16.length(),     // source string length, in wchar_t's,
-        NULL,               // unused - no conversion required in this step
-        0,                  // request buffer size
-        NULL, NULL          // unused
+        utf8 + ascii,       // source UTF-8 string
+        rest,               // length (in chars) of source UTF-8 string
+        &utf16[ascii],      // destination buffer
+        rest                // size of destination buffer, in wchar_t's
         );
-    if (utf8_length == 0)
+    if (utf16_length == 0)
     {
         // Error
         DWORD error = ::GetLastError();
         throw utf8_error(
-            "Can't get length of UTF-8 string (WideCharToMultiByte set last error to %lu).", 
+            "Can't convert string from UTF-8 to UTF-16 (MultiByteToWideChar set last error to %lu).", 
             error);
     }
 
+    utf16.resize(ascii + utf16_length);
+}
+
+
+//------------------------------------------------------------------------
+// Converts a string from UTF-8 to UTF-16.
+// On error, can throw an utf8_error exception.
+//------------------------------------------------------------------------
+inline std::wstring utf16_from_utf8(const std::string & utf8)
+{
+    std::wstring utf16;
+    utf16_from_utf8(utf8.data(), utf8.length(), utf16);
+    return utf16;
+}
 
+
+//------------------------------------------------------------------------
+// Converts length wchar_t's of UTF-16 into utf8, reusing its storage.
+// Converts in one pass; the Win32 API is called at most once, and only
+// for the part after the leading ASCII run.
+// On error, can throw an utf8_error exception.
+//------------------------------------------------------------------------
+inline void utf8_from_utf16(const wchar_t * utf16, size_t length, std::string & utf8)
+{
     //
-    // Allocate destination buffer for UTF-8 string
+    // Each UTF-16 wchar_t gives at most three UTF-8 chars (a surrogate
+    // pair gives four from two), so size the destination for the worst
+    // case and trim afterwards
     //
-    std::string utf8;
-    utf8.resize(utf8_length);
+    utf8.resize(length * 3);
+    if (length == 0)
+        return;
+
+    const size_t ascii = detail::narrow_ascii(utf16, length, &utf8[0]);
+    if (ascii == length)
+    {
+        utf8.resize(length);
+        return;
+    }
 
 
     //
-    // Do the conversion from UTF-16 to UTF-8
+    // Convert the rest, which can't start inside a surrogate pair
     //
-    if ( ! ::WideCharToMultiByte(
+    const int utf8_length = ::WideCharToMultiByte(
         CP_UTF8,                // convert to UTF-8
         0,                      // default flags
-        utf16.data(),           // source UTF-16 string
-        utf16.length(),         // source string length, in wchar_t's,
-        &utf8[0],               // destination buffer
-        utf8.length(),          // destination buffer size, in chars
+        utf16 + ascii,          // source UTF-16 string
+        static_cast<int>(length - ascii),   // source string length, in wchar_t's
+        &utf8[ascii],           // destination buffer
+        static_cast<int>((length - ascii) * 3), // destination buffer size, in chars
         NULL, NULL              // unused
-        ) )
+        );
+    if (utf8_length == 0)
     {
         // Error
         DWORD error = ::GetLastError();
@@ -210,10 +268,18 @@ inline std::string utf8_from_utf16(const std::wstring & utf16)
             error);
     }
 
+    utf8.resize(ascii + utf8_length);
+}
 
-    //
-    // Return resulting UTF-8 string
-    //
+
+//------------------------------------------------------------------------
+// Converts a string from UTF-16 to UTF-8.
+// On error, can throw an utf8_error exception.
+//------------------------------------------------------------------------
+inline std::string utf8_from_utf16(const std::wstring & utf16)
+{
+    std::string utf8;
+    utf8_from_utf16(utf16.data(), utf16.length(), utf8);
     return utf8;
 }
 
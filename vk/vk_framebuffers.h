@@ -0,0 +1,444 @@
+/* vk_framebuffers.h - libretro software framebuffers in host-visible
+ * Vulkan memory, on top of volk.h.
+ *
+ * A core that renders in software hands its frame to retro_video_refresh_t,
+ * and the frontend copies it into a staging buffer before copying that
+ * to an image. With RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER
+ * the core can render straight into the staging buffer instead. This
+ * keeps a ring of persistently mapped VkBuffers to hand out there, so
+ * the only copy left is the buffer to image one on the GPU.
+ *
+ * A buffer is reused once the GPU is done reading it, which is tracked
+ * with a timeline semaphore (Vulkan 1.2, or VK_KHR_timeline_semaphore,
+ * with the timelineSemaphore feature enabled). The submit that copies
+ * a frame signals the value vk_framebuffers_frame() gives for it. With
+ * three or more buffers the GPU is normally done long before one comes
+ * round again, so getting one doesn't wait.
+ *
+ * In the environment callback:
+ *
+ *    case RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER:
+ *       return vk_framebuffers_get_current(fbs, (struct retro_framebuffer*)data);
+ *
+ * and in retro_video_refresh_t:
+ *
+ *    struct vk_framebuffer_frame frame;
+ *    if (vk_framebuffers_frame(fbs, data, width, height, pitch, &frame))
+ *    {
+ *       vkCmdCopyBufferToImage(cmd, frame.buffer, image,
+ *             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &frame.region);
+ *       ... submit, signalling frame.semaphore with frame.signal_value
+ *    }
+ *    else
+ *       ... the old path, copying data into a staging buffer
+ *
+ * A frame from vk_framebuffers_frame() that isn't submitted must be
+ * passed to vk_framebuffers_drop(), or its buffer is never reused.
+ *
+ * Device functions are called through a VolkDeviceTable, as in
+ * vk_pipelines.h. One file must define VK_FRAMEBUFFERS_IMPLEMENTATION
+ * before including this. */
+
+#ifndef __VK_FRAMEBUFFERS_H__
+#define __VK_FRAMEBUFFERS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "volk.h"
+#include "../libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct vk_framebuffers vk_framebuffers_t;
+
+struct vk_framebuffers_config
+{
+   VkPhysicalDevice physical_device;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+
+   /* @device's functions, or NULL to load them with
+    * volkLoadDeviceTable(). Copied. */
+   const struct VolkDeviceTable *table;
+
+   /* The largest frame, normally retro_game_geometry's max_width and
+    * max_height. Larger requests are refused, and the core falls back
+    * to its own buffer. */
+   unsigned max_width;
+   unsigned max_height;
+
+   /* Buffers in the ring, 0 for 3 */
+   unsigned count;
+};
+
+/* A frame rendered into one of the buffers, ready to be copied. */
+struct vk_framebuffer_frame
+{
+   VkBuffer buffer;
+   VkBufferImageCopy region;  /* the whole frame, to mip 0 layer 0 at 0,0 */
+   VkSemaphore semaphore;     /* timeline semaphore to signal ... */
+   uint64_t signal_value;     /* ... with this, once the copy is done */
+};
+
+/**
+ * vk_framebuffers_new:
+ * @config                  : device, largest frame and ring size
+ *
+ * Create the buffers, map them, and create the timeline semaphore.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+vk_framebuffers_t *vk_framebuffers_new(const struct vk_framebuffers_config *config);
+
+/**
+ * vk_framebuffers_free:
+ * @fbs                     : pointer to framebuffers object
+ *
+ * Wait for the GPU to finish with every buffer, then free everything.
+ */
+void vk_framebuffers_free(vk_framebuffers_t *fbs);
+
+/* The format to hand out buffers in, from RETRO_ENVIRONMENT_SET_PIXEL_FORMAT.
+ * RETRO_PIXEL_FORMAT_0RGB1555 until set. */
+void vk_framebuffers_set_format(vk_framebuffers_t *fbs, enum retro_pixel_format format);
+
+/**
+ * vk_framebuffers_get_current:
+ * @fbs                     : pointer to framebuffers object
+ * @fb                      : width, height and access_flags set by the core
+ *
+ * Handle RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER: fill in
+ * @fb's data, pitch, format and memory_flags with the next buffer of
+ * the ring, waiting for the GPU to be done with it if need be. Asking
+ * again before the frame is presented gives the same buffer.
+ *
+ * Returns: true (1) if @fb was filled in, false (0) if the frame is
+ * too large or waiting failed.
+ */
+bool vk_framebuffers_get_current(vk_framebuffers_t *fbs, struct retro_framebuffer *fb);
+
+/**
+ * vk_framebuffers_frame:
+ * @fbs                     : pointer to framebuffers object
+ * @data                    : from retro_video_refresh_t
+ * @width                   : from retro_video_refresh_t
+ * @height                  : from retro_video_refresh_t
+ * @pitch                   : from retro_video_refresh_t
+ * @frame                   : filled in with what to copy from
+ *
+ * Check whether the core presented the buffer it got from
+ * vk_framebuffers_get_current(), and if so, flush it if the memory
+ * isn't coherent and describe it for the copy. The next
+ * vk_framebuffers_get_current() moves on to the next buffer.
+ *
+ * Returns: true (1) if @data is the current buffer, false (0) if it
+ * is the core's own, or a dupe (NULL).
+ */
+bool vk_framebuffers_frame(vk_framebuffers_t *fbs, const void *data,
+      unsigned width, unsigned height, size_t pitch,
+      struct vk_framebuffer_frame *frame);
+
+/* Releases a frame that won't be submitted, by signalling its value
+ * from the host. */
+void vk_framebuffers_drop(vk_framebuffers_t *fbs, const struct vk_framebuffer_frame *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef VK_FRAMEBUFFERS_IMPLEMENTATION
+#undef VK_FRAMEBUFFERS_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#define VK_FRAMEBUFFERS_MAX_COUNT 8
+
+struct vk_framebuffer
+{
+   VkBuffer buffer;
+   VkDeviceMemory memory;
+   uint8_t *data;
+   uint64_t busy_until;  /* timeline value the GPU is done with it at */
+};
+
+struct vk_framebuffers
+{
+   struct VolkDeviceTable table;
+   PFN_vkWaitSemaphores wait_semaphores;
+   PFN_vkSignalSemaphore signal_semaphore;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+   VkSemaphore semaphore;
+   uint64_t next_value;
+
+   unsigned max_width, max_height;
+   size_t size;                 /* of each buffer */
+   size_t pitch_alignment;
+   bool coherent, cached;
+   enum retro_pixel_format format;
+
+   unsigned count;
+   unsigned next;               /* buffer the next frame goes in */
+   int current;                 /* buffer handed out for this frame, or -1 */
+   unsigned width, height;      /* and the frame size it was handed out for */
+   size_t pitch;
+   struct vk_framebuffer buffers[VK_FRAMEBUFFERS_MAX_COUNT];
+};
+
+static unsigned vk_framebuffers_bpp(enum retro_pixel_format format)
+{
+   return format == RETRO_PIXEL_FORMAT_XRGB8888 ? 4 : 2;
+}
+
+static size_t vk_framebuffers_pitch(vk_framebuffers_t *fbs,
+      unsigned width, enum retro_pixel_format format)
+{
+   size_t align = fbs->pitch_alignment;
+   return ((size_t)width * vk_framebuffers_bpp(format) + align - 1) / align * align;
+}
+
+/* Host-visible memory, preferring coherent and cached so that cores
+ * reading back what they drew don't go through write-combined memory. */
+static int vk_framebuffers_memory_type(const VkPhysicalDeviceMemoryProperties *props,
+      uint32_t type_bits)
+{
+   static const VkMemoryPropertyFlags wanted[] = {
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+         | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+   };
+   unsigned i;
+   uint32_t type;
+
+   for (i = 0; i < sizeof(wanted) / sizeof(wanted[0]); i++)
+      for (type = 0; type < props->memoryTypeCount; type++)
+         if ((type_bits & (1u << type))
+               && (props->memoryTypes[type].propertyFlags & wanted[i]) == wanted[i])
+            return (int)type;
+   return -1;
+}
+
+vk_framebuffers_t *vk_framebuffers_new(const struct vk_framebuffers_config *config)
+{
+   VkPhysicalDeviceProperties props;
+   VkPhysicalDeviceMemoryProperties mem_props;
+   VkSemaphoreTypeCreateInfo type_info;
+   VkSemaphoreCreateInfo sem_info;
+   unsigned i;
+   vk_framebuffers_t *fbs = (vk_framebuffers_t*)calloc(1, sizeof(*fbs));
+
+   if (!fbs)
+      return NULL;
+   fbs->device     = config->device;
+   fbs->allocator  = config->allocator;
+   fbs->max_width  = config->max_width;
+   fbs->max_height = config->max_height;
+   fbs->count      = config->count ? config->count : 3;
+   fbs->format     = RETRO_PIXEL_FORMAT_0RGB1555;
+   fbs->current    = -1;
+   if (fbs->count > VK_FRAMEBUFFERS_MAX_COUNT)
+      fbs->count = VK_FRAMEBUFFERS_MAX_COUNT;
+   if (config->table)
+      fbs->table = *config->table;
+   else
+      volkLoadDeviceTable(&fbs->table, fbs->device);
+   fbs->wait_semaphores  = fbs->table.vkWaitSemaphores
+      ? fbs->table.vkWaitSemaphores : fbs->table.vkWaitSemaphoresKHR;
+   fbs->signal_semaphore = fbs->table.vkSignalSemaphore
+      ? fbs->table.vkSignalSemaphore : fbs->table.vkSignalSemaphoreKHR;
+   if (!fbs->wait_semaphores || !fbs->signal_semaphore)
+      goto error;
+
+   /* rows whole texels and suitably aligned for the copy, in any format */
+   vkGetPhysicalDeviceProperties(config->physical_device, &props);
+   fbs->pitch_alignment = (size_t)props.limits.optimalBufferCopyRowPitchAlignment;
+   if (fbs->pitch_alignment < 64)
+      fbs->pitch_alignment = 64;
+   fbs->size = vk_framebuffers_pitch(fbs, fbs->max_width, RETRO_PIXEL_FORMAT_XRGB8888)
+      * fbs->max_height;
+   if (!fbs->size)
+      goto error;
+
+   memset(&type_info, 0, sizeof(type_info));
+   type_info.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+   type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+   memset(&sem_info, 0, sizeof(sem_info));
+   sem_info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+   sem_info.pNext          = &type_info;
+   if (fbs->table.vkCreateSemaphore(fbs->device, &sem_info, fbs->allocator,
+            &fbs->semaphore) != VK_SUCCESS)
+      goto error;
+
+   vkGetPhysicalDeviceMemoryProperties(config->physical_device, &mem_props);
+   for (i = 0; i < fbs->count; i++)
+   {
+      struct vk_framebuffer *buf = &fbs->buffers[i];
+      VkBufferCreateInfo buf_info;
+      VkMemoryAllocateInfo alloc;
+      VkMemoryRequirements reqs;
+      VkMemoryPropertyFlags flags;
+      int type;
+
+      memset(&buf_info, 0, sizeof(buf_info));
+      buf_info.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+      buf_info.size        = fbs->size;
+      buf_info.usage       = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+      buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+      if (fbs->table.vkCreateBuffer(fbs->device, &buf_info, fbs->allocator,
+               &buf->buffer) != VK_SUCCESS)
+         goto error;
+
+      fbs->table.vkGetBufferMemoryRequirements(fbs->device, buf->buffer, &reqs);
+      if ((type = vk_framebuffers_memory_type(&mem_props, reqs.memoryTypeBits)) < 0)
+         goto error;
+      flags         = mem_props.memoryTypes[type].propertyFlags;
+      fbs->coherent = (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+      fbs->cached   = (flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0;
+
+      memset(&alloc, 0, sizeof(alloc));
+      alloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+      alloc.allocationSize  = reqs.size;
+      alloc.memoryTypeIndex = (uint32_t)type;
+      if (fbs->table.vkAllocateMemory(fbs->device, &alloc, fbs->allocator,
+               &buf->memory) != VK_SUCCESS
+            || fbs->table.vkBindBufferMemory(fbs->device, buf->buffer,
+               buf->memory, 0) != VK_SUCCESS
+            || fbs->table.vkMapMemory(fbs->device, buf->memory, 0,
+               VK_WHOLE_SIZE, 0, (void**)&buf->data) != VK_SUCCESS)
+         goto error;
+   }
+   return fbs;
+
+error:
+   vk_framebuffers_free(fbs);
+   return NULL;
+}
+
+static bool vk_framebuffers_wait(vk_framebuffers_t *fbs, uint64_t value)
+{
+   VkSemaphoreWaitInfo info;
+   if (!value)
+      return true;
+   memset(&info, 0, sizeof(info));
+   info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+   info.semaphoreCount = 1;
+   info.pSemaphores    = &fbs->semaphore;
+   info.pValues        = &value;
+   return fbs->wait_semaphores(fbs->device, &info, UINT64_MAX) == VK_SUCCESS;
+}
+
+void vk_framebuffers_free(vk_framebuffers_t *fbs)
+{
+   unsigned i;
+
+   if (!fbs)
+      return;
+   if (fbs->semaphore)
+   {
+      for (i = 0; i < fbs->count; i++)
+         vk_framebuffers_wait(fbs, fbs->buffers[i].busy_until);
+      fbs->table.vkDestroySemaphore(fbs->device, fbs->semaphore, fbs->allocator);
+   }
+   for (i = 0; i < fbs->count; i++)
+   {
+      struct vk_framebuffer *buf = &fbs->buffers[i];
+      if (buf->buffer)
+         fbs->table.vkDestroyBuffer(fbs->device, buf->buffer, fbs->allocator);
+      /* freeing unmaps it */
+      if (buf->memory)
+         fbs->table.vkFreeMemory(fbs->device, buf->memory, fbs->allocator);
+   }
+   free(fbs);
+}
+
+void vk_framebuffers_set_format(vk_framebuffers_t *fbs, enum retro_pixel_format format)
+{
+   fbs->format = format;
+}
+
+bool vk_framebuffers_get_current(vk_framebuffers_t *fbs, struct retro_framebuffer *fb)
+{
+   size_t pitch;
+
+   if (fb->width > fbs->max_width || fb->height > fbs->max_height)
+      return false;
+   pitch = vk_framebuffers_pitch(fbs, fb->width, fbs->format);
+
+   if (fbs->current < 0)
+   {
+      if (!vk_framebuffers_wait(fbs, fbs->buffers[fbs->next].busy_until))
+         return false;
+      fbs->current = (int)fbs->next;
+   }
+   fbs->width  = fb->width;
+   fbs->height = fb->height;
+   fbs->pitch  = pitch;
+
+   fb->data         = fbs->buffers[fbs->current].data;
+   fb->pitch        = pitch;
+   fb->format       = fbs->format;
+   fb->memory_flags = fbs->cached ? RETRO_MEMORY_TYPE_CACHED : 0;
+   return true;
+}
+
+bool vk_framebuffers_frame(vk_framebuffers_t *fbs, const void *data,
+      unsigned width, unsigned height, size_t pitch,
+      struct vk_framebuffer_frame *frame)
+{
+   struct vk_framebuffer *buf;
+
+   if (fbs->current < 0 || !data)
+      return false;
+   buf = &fbs->buffers[fbs->current];
+   if (data != buf->data || width != fbs->width || height != fbs->height
+         || pitch != fbs->pitch)
+      return false;
+
+   if (!fbs->coherent)
+   {
+      VkMappedMemoryRange range;
+      memset(&range, 0, sizeof(range));
+      range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+      range.memory = buf->memory;
+      range.size   = VK_WHOLE_SIZE;
+      fbs->table.vkFlushMappedMemoryRanges(fbs->device, 1, &range);
+   }
+
+   buf->busy_until = ++fbs->next_value;
+   fbs->current    = -1;
+   fbs->next       = (fbs->next + 1) % fbs->count;
+
+   memset(frame, 0, sizeof(*frame));
+   frame->buffer                             = buf->buffer;
+   frame->region.bufferRowLength             = (uint32_t)(pitch / vk_framebuffers_bpp(fbs->format));
+   frame->region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+   frame->region.imageSubresource.layerCount = 1;
+   frame->region.imageExtent.width           = width;
+   frame->region.imageExtent.height          = height;
+   frame->region.imageExtent.depth           = 1;
+   frame->semaphore                          = fbs->semaphore;
+   frame->signal_value                       = buf->busy_until;
+   return true;
+}
+
+void vk_framebuffers_drop(vk_framebuffers_t *fbs, const struct vk_framebuffer_frame *frame)
+{
+   VkSemaphoreSignalInfo info;
+   /* a host signal must not overtake a pending one for an earlier frame */
+   vk_framebuffers_wait(fbs, frame->signal_value - 1);
+   memset(&info, 0, sizeof(info));
+   info.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+   info.semaphore = frame->semaphore;
+   info.value     = frame->signal_value;
+   fbs->signal_semaphore(fbs->device, &info);
+}
+
+#endif
@@ -0,0 +1,739 @@
+/* vk_pipelines.h - persistent pipeline cache and background pipeline
+ * compilation, on top of volk.h and rthreads.h.
+ *
+ * The VkPipelineCache is loaded from, and saved to, a file in a given
+ * directory. The file name holds the vendor and device IDs and the
+ * pipelineCacheUUID of the physical device, and the contents are only
+ * used if the driver version, the Vulkan cache header and a checksum
+ * all match. Any driver update or GPU swap therefore starts from an
+ * empty cache rather than handing a driver data it might not check.
+ *
+ * Pipelines are compiled on an sthread_pool_t. Until one is ready,
+ * vk_pipeline_get() returns the placeholder it was created with (say,
+ * a simple pipeline built at startup, or VK_NULL_HANDLE to skip the
+ * draw), so nothing waits on the compiler unless vk_pipeline_wait() is
+ * called. With VK_EXT_pipeline_creation_feedback (or Vulkan 1.3)
+ * enabled on the device, each compile reports whether it was a cache
+ * hit, and vk_pipelines_get_stats() sums them up.
+ *
+ * Device functions are called through a VolkDeviceTable, never volk's
+ * global pointers, so volkLoadDevice() isn't needed, calls skip the
+ * loader trampolines, and objects for different devices can be used
+ * from different threads at once. The build callbacks get the table to
+ * call through too.
+ *
+ * One file must define VK_PIPELINES_IMPLEMENTATION before including
+ * this, with volk.h and rthreads.h (built with THREADS_IMPLEMENTATION
+ * somewhere) available, and volk loaded for the instance. */
+
+#ifndef __VK_PIPELINES_H__
+#define __VK_PIPELINES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "volk.h"
+#include "../rthreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct vk_pipelines vk_pipelines_t;
+typedef struct vk_pipeline vk_pipeline_t;
+
+struct vk_pipelines_config
+{
+   VkPhysicalDevice physical_device;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+
+   /* @device's functions, or NULL to load them with
+    * volkLoadDeviceTable(). Copied. */
+   const struct VolkDeviceTable *table;
+
+   /* Directory the cache file is kept in, which must exist, or NULL
+    * to keep the cache in memory only. */
+   const char *cache_dir;
+
+   /* Pool to compile on, or NULL to create one with @threads workers
+    * (0 for one per CPU). */
+   sthread_pool_t *pool;
+   unsigned threads;
+
+   /* VK_EXT_pipeline_creation_feedback, or Vulkan 1.3, is enabled on
+    * @device, so cache hits can be counted. */
+   bool creation_feedback;
+};
+
+struct vk_pipelines_stats
+{
+   uint32_t pending;       /* queued or compiling */
+   uint32_t compiled;      /* finished successfully */
+   uint32_t failed;
+   /* From creation feedback, for the pipelines that got it. The hit
+    * rate is cache_hits / (cache_hits + cache_misses). */
+   uint32_t cache_hits;
+   uint32_t cache_misses;
+   uint32_t cache_unknown; /* finished without feedback */
+   uint64_t compile_us;    /* total time spent compiling */
+   size_t loaded_bytes;    /* cache data loaded from disk, 0 if none */
+   size_t saved_bytes;     /* cache data written by the last save */
+};
+
+/* What a build callback gets, on a pool thread. @feedback is NULL
+ * without creation feedback; otherwise the callback should chain it
+ * into the create info's pNext so that hits can be counted. */
+struct vk_pipeline_build_info
+{
+   const struct VolkDeviceTable *table;
+   VkDevice device;
+   VkPipelineCache cache;
+   const VkAllocationCallbacks *allocator;
+   VkPipelineCreationFeedbackCreateInfoEXT *feedback;
+};
+
+typedef VkResult (*vk_pipeline_build_t)(void *userdata,
+      const struct vk_pipeline_build_info *info, VkPipeline *pipeline);
+
+/**
+ * vk_pipelines_new:
+ * @config                  : device, cache directory and threads
+ *
+ * Create the pipeline cache, from the cache file if there is a usable
+ * one, and the pool if none was given.
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+vk_pipelines_t *vk_pipelines_new(const struct vk_pipelines_config *config);
+
+/**
+ * vk_pipelines_free:
+ * @p                       : pointer to pipelines object
+ *
+ * Wait for every pipeline still compiling, save the cache if anything
+ * new went into it, and free everything. Pipelines not yet freed with
+ * vk_pipeline_free() are freed too, destroying their VkPipeline.
+ */
+void vk_pipelines_free(vk_pipelines_t *p);
+
+/**
+ * vk_pipelines_save:
+ * @p                       : pointer to pipelines object
+ *
+ * Write the cache file now, through a temporary file so that a crash
+ * part way through leaves the old one. May be called while pipelines
+ * are compiling.
+ *
+ * Returns: true (1) if the file was written, or there is no cache
+ * directory, false (0) otherwise.
+ */
+bool vk_pipelines_save(vk_pipelines_t *p);
+
+VkPipelineCache vk_pipelines_get_cache(vk_pipelines_t *p);
+void vk_pipelines_get_stats(vk_pipelines_t *p, struct vk_pipelines_stats *stats);
+
+/**
+ * vk_pipeline_new:
+ * @p                       : pointer to pipelines object
+ * @build                   : creates the pipeline with the cache it's given
+ * @userdata                : passed to @build, and must stay valid
+ *                            until @build has returned
+ * @placeholder             : returned by vk_pipeline_get() until then
+ *
+ * Queue a pipeline to be compiled on the pool.
+ *
+ * Returns: the pipeline's handle, or NULL if out of memory.
+ */
+vk_pipeline_t *vk_pipeline_new(vk_pipelines_t *p, vk_pipeline_build_t build,
+      void *userdata, VkPipeline placeholder);
+
+/* The same for one graphics or compute pipeline. The create info is
+ * copied, but not what it points to, which must stay valid until the
+ * pipeline is ready. */
+vk_pipeline_t *vk_pipeline_new_graphics(vk_pipelines_t *p,
+      const VkGraphicsPipelineCreateInfo *info, VkPipeline placeholder);
+vk_pipeline_t *vk_pipeline_new_compute(vk_pipelines_t *p,
+      const VkComputePipelineCreateInfo *info, VkPipeline placeholder);
+
+/* Whether the pipeline has finished compiling, successfully or not. */
+bool vk_pipeline_ready(vk_pipeline_t *pipe);
+
+/* The compiled pipeline once it is ready and if it succeeded,
+ * otherwise the placeholder. Never blocks. */
+VkPipeline vk_pipeline_get(vk_pipeline_t *pipe);
+
+/**
+ * vk_pipeline_wait:
+ * @pipe                    : pipeline handle
+ *
+ * Block until the pipeline is ready. Must not be called from a task on
+ * the pool it is compiling on.
+ *
+ * Returns: the result of compiling it.
+ */
+VkResult vk_pipeline_wait(vk_pipeline_t *pipe);
+
+/**
+ * vk_pipeline_free:
+ * @pipe                    : pipeline handle
+ *
+ * Destroy the pipeline, and free the handle. The GPU must be done with
+ * the pipeline. One that is still compiling is destroyed when it
+ * finishes. The placeholder is left alone.
+ */
+void vk_pipeline_free(vk_pipeline_t *pipe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef VK_PIPELINES_IMPLEMENTATION
+#undef VK_PIPELINES_IMPLEMENTATION
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+#define VK_PIPELINES_FILE_VERSION 1
+
+enum vk_pipeline_state
+{
+   VK_PIPELINE_QUEUED = 0,
+   VK_PIPELINE_DONE,
+   VK_PIPELINE_ABANDONED  /* freed while still compiling */
+};
+
+/* Written in front of the driver's cache data */
+struct vk_pipelines_file_header
+{
+   char magic[4];
+   uint32_t version;
+   uint32_t vendor_id;
+   uint32_t device_id;
+   uint32_t driver_version;
+   uint8_t uuid[VK_UUID_SIZE];
+   uint32_t data_size;
+   uint32_t checksum;
+};
+
+struct vk_pipeline
+{
+   vk_pipelines_t *owner;
+   vk_pipeline_t *prev, *next;  /* in owner's list, guarded by owner->lock */
+   vk_pipeline_build_t build;
+   void *userdata;
+   VkPipeline placeholder;
+   VkPipeline pipeline;
+   VkResult result;
+   volatile uint32_t state;
+   union
+   {
+      VkGraphicsPipelineCreateInfo graphics;
+      VkComputePipelineCreateInfo compute;
+   } info;
+   VkPipelineCreationFeedbackCreateInfoEXT feedback_info;
+   VkPipelineCreationFeedbackEXT feedback;
+};
+
+struct vk_pipelines
+{
+   struct VolkDeviceTable table;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+   VkPhysicalDeviceProperties props;
+   VkPipelineCache cache;
+   char *path;                  /* of the cache file, or NULL */
+   bool creation_feedback;
+
+   sthread_pool_t *pool;
+   bool own_pool;
+   sthread_wait_group_t *group; /* the compiles in flight */
+
+   slock_t *lock;
+   scond_t *done;               /* broadcast as each compile finishes */
+   vk_pipeline_t *pipelines;    /* not yet freed */
+   struct vk_pipelines_stats stats;
+   uint32_t unsaved;            /* newly compiled pipelines since the last save */
+};
+
+/* FNV-1a, enough to catch a truncated or damaged file */
+static uint32_t vk_pipelines_checksum(const uint8_t *data, size_t size)
+{
+   uint32_t hash = 2166136261u;
+   size_t i;
+   for (i = 0; i < size; i++)
+      hash = (hash ^ data[i]) * 16777619u;
+   return hash;
+}
+
+static void vk_pipelines_fill_header(vk_pipelines_t *p,
+      struct vk_pipelines_file_header *header)
+{
+   memset(header, 0, sizeof(*header));
+   memcpy(header->magic, "VKPC", 4);
+   header->version        = VK_PIPELINES_FILE_VERSION;
+   header->vendor_id      = p->props.vendorID;
+   header->device_id      = p->props.deviceID;
+   header->driver_version = p->props.driverVersion;
+   memcpy(header->uuid, p->props.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+/* Reads the cache file into a new buffer if it was written for this
+ * device and driver and is intact, otherwise returns NULL. */
+static void *vk_pipelines_load_file(vk_pipelines_t *p, size_t *size)
+{
+   struct vk_pipelines_file_header header, expected;
+   uint8_t *data;
+   uint32_t vk_header[4];
+   FILE *file = fopen(p->path, "rb");
+
+   if (!file)
+      return NULL;
+   vk_pipelines_fill_header(p, &expected);
+   if (fread(&header, sizeof(header), 1, file) != 1
+         || memcmp(&header, &expected, offsetof(struct vk_pipelines_file_header, data_size))
+         || header.data_size < 16 + VK_UUID_SIZE
+         || !(data = (uint8_t*)malloc(header.data_size)))
+   {
+      fclose(file);
+      return NULL;
+   }
+   if (fread(data, header.data_size, 1, file) != 1
+         || vk_pipelines_checksum(data, header.data_size) != header.checksum)
+   {
+      free(data);
+      fclose(file);
+      return NULL;
+   }
+   fclose(file);
+
+   /* The driver's own VkPipelineCacheHeaderVersionOne should agree */
+   memcpy(vk_header, data, sizeof(vk_header));
+   if (vk_header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+         || vk_header[2] != p->props.vendorID
+         || vk_header[3] != p->props.deviceID
+         || memcmp(data + 16, p->props.pipelineCacheUUID, VK_UUID_SIZE))
+   {
+      free(data);
+      return NULL;
+   }
+
+   *size = header.data_size;
+   return data;
+}
+
+vk_pipelines_t *vk_pipelines_new(const struct vk_pipelines_config *config)
+{
+   VkPipelineCacheCreateInfo info;
+   void *data     = NULL;
+   size_t size    = 0;
+   vk_pipelines_t *p = (vk_pipelines_t*)calloc(1, sizeof(*p));
+
+   if (!p)
+      return NULL;
+   p->device            = config->device;
+   p->allocator         = config->allocator;
+   p->creation_feedback = config->creation_feedback;
+   if (config->table)
+      p->table = *config->table;
+   else
+      volkLoadDeviceTable(&p->table, p->device);
+   vkGetPhysicalDeviceProperties(config->physical_device, &p->props);
+
+   if (config->cache_dir)
+   {
+      const uint8_t *uuid = p->props.pipelineCacheUUID;
+      size_t len = strlen(config->cache_dir) + 64;
+      p->path = (char*)malloc(len);
+      if (!p->path)
+         goto error;
+      snprintf(p->path, len, "%s/pipelines-%08x-%08x-"
+            "%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x.bin",
+            config->cache_dir, (unsigned)p->props.vendorID, (unsigned)p->props.deviceID,
+            uuid[0], uuid[1], uuid[2], uuid[3], uuid[4], uuid[5], uuid[6], uuid[7],
+            uuid[8], uuid[9], uuid[10], uuid[11], uuid[12], uuid[13], uuid[14], uuid[15]);
+      data = vk_pipelines_load_file(p, &size);
+   }
+
+   memset(&info, 0, sizeof(info));
+   info.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+   info.initialDataSize = size;
+   info.pInitialData    = data;
+   if (p->table.vkCreatePipelineCache(p->device, &info, p->allocator, &p->cache) != VK_SUCCESS)
+   {
+      /* the driver didn't take the data after all; start empty */
+      info.initialDataSize = 0;
+      info.pInitialData    = NULL;
+      size                 = 0;
+      if (p->table.vkCreatePipelineCache(p->device, &info, p->allocator, &p->cache) != VK_SUCCESS)
+         goto error;
+   }
+   free(data);
+   data                  = NULL;
+   p->stats.loaded_bytes = size;
+
+   p->pool = config->pool;
+   if (!p->pool)
+   {
+      p->pool     = sthread_pool_new(config->threads);
+      p->own_pool = true;
+   }
+   p->group = sthread_wait_group_new();
+   p->lock  = slock_new();
+   p->done  = scond_new();
+   if (!p->pool || !p->group || !p->lock || !p->done)
+      goto error;
+   return p;
+
+error:
+   free(data);
+   if (p->cache)
+      p->table.vkDestroyPipelineCache(p->device, p->cache, p->allocator);
+   if (p->own_pool && p->pool)
+      sthread_pool_free(p->pool);
+   if (p->group)
+      sthread_wait_group_free(p->group);
+   if (p->lock)
+      slock_free(p->lock);
+   if (p->done)
+      scond_free(p->done);
+   free(p->path);
+   free(p);
+   return NULL;
+}
+
+bool vk_pipelines_save(vk_pipelines_t *p)
+{
+   struct vk_pipelines_file_header header;
+   char *tmp_path;
+   uint8_t *data;
+   size_t size = 0;
+   FILE *file;
+   bool ok;
+
+   if (!p->path)
+      return true;
+   slock_lock(p->lock);
+   p->unsaved = 0;
+   slock_unlock(p->lock);
+
+   if (p->table.vkGetPipelineCacheData(p->device, p->cache, &size, NULL) != VK_SUCCESS
+         || !size || size > UINT32_MAX)
+      return false;
+   if (!(data = (uint8_t*)malloc(size)))
+      return false;
+   /* more may have been added since the size was taken; VK_INCOMPLETE
+    * still gives a valid cache, of what fitted */
+   if (p->table.vkGetPipelineCacheData(p->device, p->cache, &size, data) < 0)
+   {
+      free(data);
+      return false;
+   }
+
+   vk_pipelines_fill_header(p, &header);
+   header.data_size = (uint32_t)size;
+   header.checksum  = vk_pipelines_checksum(data, size);
+
+   tmp_path = (char*)malloc(strlen(p->path) + 5);
+   if (!tmp_path)
+   {
+      free(data);
+      return false;
+   }
+   strcpy(tmp_path, p->path);
+   strcat(tmp_path, ".tmp");
+
+   file = fopen(tmp_path, "wb");
+   ok   = file
+      && fwrite(&header, sizeof(header), 1, file) == 1
+      && fwrite(data, size, 1, file) == 1;
+   if (file && fclose(file))
+      ok = false;
+#ifdef _WIN32
+   ok = ok && MoveFileExA(tmp_path, p->path, MOVEFILE_REPLACE_EXISTING);
+#else
+   ok = ok && !rename(tmp_path, p->path);
+#endif
+   if (!ok)
+      remove(tmp_path);
+   else
+   {
+      slock_lock(p->lock);
+      p->stats.saved_bytes = size;
+      slock_unlock(p->lock);
+   }
+
+   free(tmp_path);
+   free(data);
+   return ok;
+}
+
+static void vk_pipeline_destroy(vk_pipeline_t *pipe)
+{
+   vk_pipelines_t *p = pipe->owner;
+   if (pipe->pipeline != VK_NULL_HANDLE)
+      p->table.vkDestroyPipeline(p->device, pipe->pipeline, p->allocator);
+   free(pipe);
+}
+
+/* Takes pipe off its owner's list; called with owner->lock held. */
+static void vk_pipeline_unlink(vk_pipeline_t *pipe)
+{
+   vk_pipelines_t *p = pipe->owner;
+   if (pipe->prev)
+      pipe->prev->next = pipe->next;
+   else
+      p->pipelines = pipe->next;
+   if (pipe->next)
+      pipe->next->prev = pipe->prev;
+}
+
+void vk_pipelines_free(vk_pipelines_t *p)
+{
+   if (!p)
+      return;
+   sthread_wait_group_wait(p->pool, p->group);
+   if (p->unsaved)
+      vk_pipelines_save(p);
+
+   while (p->pipelines)
+   {
+      vk_pipeline_t *pipe = p->pipelines;
+      vk_pipeline_unlink(pipe);
+      vk_pipeline_destroy(pipe);
+   }
+
+   if (p->own_pool)
+      sthread_pool_free(p->pool);
+   sthread_wait_group_free(p->group);
+   scond_free(p->done);
+   slock_free(p->lock);
+   p->table.vkDestroyPipelineCache(p->device, p->cache, p->allocator);
+   free(p->path);
+   free(p);
+}
+
+VkPipelineCache vk_pipelines_get_cache(vk_pipelines_t *p)
+{
+   return p->cache;
+}
+
+void vk_pipelines_get_stats(vk_pipelines_t *p, struct vk_pipelines_stats *stats)
+{
+   slock_lock(p->lock);
+   *stats = p->stats;
+   slock_unlock(p->lock);
+}
+
+static void vk_pipeline_task(void *data)
+{
+   vk_pipeline_t *pipe = (vk_pipeline_t*)data;
+   vk_pipelines_t *p   = pipe->owner;
+   struct vk_pipeline_build_info info;
+   VkPipeline pipeline = VK_NULL_HANDLE;
+   VkResult result;
+   int64_t start;
+   uint32_t expected   = VK_PIPELINE_QUEUED;
+
+   info.table     = &p->table;
+   info.device    = p->device;
+   info.cache     = p->cache;
+   info.allocator = p->allocator;
+   info.feedback  = NULL;
+   if (p->creation_feedback)
+   {
+      memset(&pipe->feedback, 0, sizeof(pipe->feedback));
+      memset(&pipe->feedback_info, 0, sizeof(pipe->feedback_info));
+      pipe->feedback_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+      pipe->feedback_info.pPipelineCreationFeedback = &pipe->feedback;
+      info.feedback = &pipe->feedback_info;
+   }
+
+   start  = sthread_clock_us();
+   result = pipe->build(pipe->userdata, &info, &pipeline);
+
+   slock_lock(p->lock);
+   p->stats.compile_us += (uint64_t)(sthread_clock_us() - start);
+   p->stats.pending--;
+   if (result == VK_SUCCESS)
+   {
+      p->stats.compiled++;
+      if (!(pipe->feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT))
+         p->stats.cache_unknown++;
+      else if (pipe->feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT)
+         p->stats.cache_hits++;
+      else
+      {
+         p->stats.cache_misses++;
+         p->unsaved++;
+      }
+      if (!info.feedback)
+         p->unsaved++;
+   }
+   else
+      p->stats.failed++;
+
+   pipe->pipeline = pipeline;
+   pipe->result   = result;
+   if (!satomic_compare_exchange(&pipe->state, &expected, VK_PIPELINE_DONE))
+   {
+      /* freed while compiling */
+      vk_pipeline_unlink(pipe);
+      vk_pipeline_destroy(pipe);
+   }
+   scond_broadcast(p->done);
+   slock_unlock(p->lock);
+}
+
+/* Adds pipe to p's list and queues its compile, or frees it. */
+static vk_pipeline_t *vk_pipeline_queue(vk_pipelines_t *p, vk_pipeline_t *pipe)
+{
+   slock_lock(p->lock);
+   pipe->next = p->pipelines;
+   if (p->pipelines)
+      p->pipelines->prev = pipe;
+   p->pipelines = pipe;
+   p->stats.pending++;
+   slock_unlock(p->lock);
+
+   if (!sthread_pool_submit(p->pool, vk_pipeline_task, pipe, p->group))
+   {
+      slock_lock(p->lock);
+      p->stats.pending--;
+      vk_pipeline_unlink(pipe);
+      slock_unlock(p->lock);
+      free(pipe);
+      return NULL;
+   }
+   return pipe;
+}
+
+vk_pipeline_t *vk_pipeline_new(vk_pipelines_t *p, vk_pipeline_build_t build,
+      void *userdata, VkPipeline placeholder)
+{
+   vk_pipeline_t *pipe = (vk_pipeline_t*)calloc(1, sizeof(*pipe));
+   if (!pipe)
+      return NULL;
+   pipe->owner       = p;
+   pipe->build       = build;
+   pipe->userdata    = userdata;
+   pipe->placeholder = placeholder;
+   pipe->result      = VK_NOT_READY;
+   pipe->state       = VK_PIPELINE_QUEUED;
+   return vk_pipeline_queue(p, pipe);
+}
+
+static VkResult vk_pipeline_build_graphics(void *userdata,
+      const struct vk_pipeline_build_info *info, VkPipeline *pipeline)
+{
+   vk_pipeline_t *pipe = (vk_pipeline_t*)userdata;
+   if (info->feedback)
+   {
+      info->feedback->pNext     = pipe->info.graphics.pNext;
+      pipe->info.graphics.pNext = info->feedback;
+   }
+   return info->table->vkCreateGraphicsPipelines(info->device, info->cache, 1,
+         &pipe->info.graphics, info->allocator, pipeline);
+}
+
+static VkResult vk_pipeline_build_compute(void *userdata,
+      const struct vk_pipeline_build_info *info, VkPipeline *pipeline)
+{
+   vk_pipeline_t *pipe = (vk_pipeline_t*)userdata;
+   if (info->feedback)
+   {
+      info->feedback->pNext    = pipe->info.compute.pNext;
+      pipe->info.compute.pNext = info->feedback;
+   }
+   return info->table->vkCreateComputePipelines(info->device, info->cache, 1,
+         &pipe->info.compute, info->allocator, pipeline);
+}
+
+/* The create info is kept in the pipeline itself, which is the build
+ * callback's userdata. */
+static vk_pipeline_t *vk_pipeline_new_with_info(vk_pipelines_t *p,
+      vk_pipeline_build_t build, const void *info, size_t size,
+      VkPipeline placeholder)
+{
+   vk_pipeline_t *pipe = (vk_pipeline_t*)calloc(1, sizeof(*pipe));
+   if (!pipe)
+      return NULL;
+   memcpy(&pipe->info, info, size);
+   pipe->owner       = p;
+   pipe->build       = build;
+   pipe->userdata    = pipe;
+   pipe->placeholder = placeholder;
+   pipe->result      = VK_NOT_READY;
+   pipe->state       = VK_PIPELINE_QUEUED;
+   return vk_pipeline_queue(p, pipe);
+}
+
+vk_pipeline_t *vk_pipeline_new_graphics(vk_pipelines_t *p,
+      const VkGraphicsPipelineCreateInfo *info, VkPipeline placeholder)
+{
+   return vk_pipeline_new_with_info(p, vk_pipeline_build_graphics,
+         info, sizeof(*info), placeholder);
+}
+
+vk_pipeline_t *vk_pipeline_new_compute(vk_pipelines_t *p,
+      const VkComputePipelineCreateInfo *info, VkPipeline placeholder)
+{
+   return vk_pipeline_new_with_info(p, vk_pipeline_build_compute,
+         info, sizeof(*info), placeholder);
+}
+
+bool vk_pipeline_ready(vk_pipeline_t *pipe)
+{
+   return satomic_load(&pipe->state) == VK_PIPELINE_DONE;
+}
+
+VkPipeline vk_pipeline_get(vk_pipeline_t *pipe)
+{
+   if (satomic_load(&pipe->state) == VK_PIPELINE_DONE
+         && pipe->result == VK_SUCCESS)
+      return pipe->pipeline;
+   return pipe->placeholder;
+}
+
+VkResult vk_pipeline_wait(vk_pipeline_t *pipe)
+{
+   vk_pipelines_t *p = pipe->owner;
+   slock_lock(p->lock);
+   while (satomic_load(&pipe->state) != VK_PIPELINE_DONE)
+      scond_wait(p->done, p->lock);
+   slock_unlock(p->lock);
+   return pipe->result;
+}
+
+void vk_pipeline_free(vk_pipeline_t *pipe)
+{
+   vk_pipelines_t *p;
+   uint32_t expected = VK_PIPELINE_QUEUED;
+
+   if (!pipe)
+      return;
+   p = pipe->owner;
+   slock_lock(p->lock);
+   /* a compile still running frees it when it finishes */
+   if (satomic_compare_exchange(&pipe->state, &expected, VK_PIPELINE_ABANDONED))
+   {
+      slock_unlock(p->lock);
+      return;
+   }
+   vk_pipeline_unlink(pipe);
+   slock_unlock(p->lock);
+   vk_pipeline_destroy(pipe);
+}
+
+#endif
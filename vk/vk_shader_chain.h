@@ -0,0 +1,769 @@
+/* vk_shader_chain.h - render passes, intermediate images and memory for
+ * a chain of full-screen shader passes (CRT and scaler presets), on top
+ * of volk.h.
+ *
+ * Each pass draws one output from the outputs of earlier ones, and the
+ * last draws to an image the caller gives per frame (a swapchain image,
+ * say). Giving every pass its own render pass and full-size image makes
+ * every intermediate go out to memory and back, which is most of the
+ * cost on tile-based GPUs and integrated ones. Instead:
+ *
+ * - A pass that only reads the previous pass's output at the pixel it
+ *   is shading (pixel_local), and has the same size, becomes the next
+ *   subpass of the previous pass's render pass, and reads that output
+ *   as an input attachment (subpassLoad()) rather than a texture.
+ * - An output that nothing reads outside its render pass is a transient
+ *   attachment in lazily allocated memory where the device has it, so
+ *   on a tiler it never leaves tile memory and takes no real memory.
+ * - The other outputs are kept in as few allocations as possible, with
+ *   images that are never needed at the same time sharing memory.
+ *
+ * vk_shader_chain_get_pass() says which render pass and subpass each
+ * pass's pipeline is for, and whether its shader has to read the
+ * previous output as an input attachment; descriptors for sampled
+ * outputs come from vk_shader_chain_get_output(). A frame is recorded
+ * with vk_shader_chain_record(), which begins and ends the render
+ * passes and calls back to bind and draw each pass.
+ *
+ * Device functions are called through a VolkDeviceTable, as in
+ * vk_pipelines.h. One file must define VK_SHADER_CHAIN_IMPLEMENTATION
+ * before including this. */
+
+#ifndef __VK_SHADER_CHAIN_H__
+#define __VK_SHADER_CHAIN_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "volk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Passes in a chain, at most; one bit each in vk_shader_chain_pass_desc's
+ * reads */
+#define VK_SHADER_CHAIN_MAX_PASSES 32
+
+typedef struct vk_shader_chain vk_shader_chain_t;
+
+struct vk_shader_chain_pass_desc
+{
+   /* Format and size of the pass's output. Ignored for the last pass,
+    * which draws to the chain's output. */
+   VkFormat format;
+   uint32_t width;
+   uint32_t height;
+
+   /* Bit i set: the pass samples pass i's output (i less than this
+    * pass's index). The chain's source image isn't a pass, and is bound
+    * by the caller. */
+   uint32_t reads;
+
+   /* The pass reads the previous pass's output only at the pixel it is
+    * shading, unfiltered, so it can be merged into the previous pass's
+    * render pass if the sizes match. Whether it was is in
+    * vk_shader_chain_pass_info. */
+   bool pixel_local;
+};
+
+struct vk_shader_chain_config
+{
+   VkPhysicalDevice physical_device;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+
+   /* @device's functions, or NULL to load them with
+    * volkLoadDeviceTable(). Copied. */
+   const struct VolkDeviceTable *table;
+
+   const struct vk_shader_chain_pass_desc *passes;  /* copied */
+   unsigned pass_count;
+
+   /* The images the last pass draws to */
+   VkFormat output_format;
+   uint32_t output_width;
+   uint32_t output_height;
+   VkImageLayout output_layout;  /* left in, e.g. VK_IMAGE_LAYOUT_PRESENT_SRC_KHR */
+   bool clear_output;            /* to black first, if the last pass leaves borders */
+};
+
+/* What a pass's pipeline and descriptors are for */
+struct vk_shader_chain_pass_info
+{
+   VkRenderPass render_pass;
+   uint32_t subpass;
+   VkExtent2D extent;            /* viewport and scissor */
+
+   /* The previous pass's output, when this pass was merged into its
+    * render pass: bind it as VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT in
+    * VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, and read it with
+    * subpassLoad(). VK_NULL_HANDLE otherwise, when the previous output
+    * (if the pass reads it) is sampled like any other. */
+   VkImageView input_attachment;
+
+   /* The pass's output is a transient attachment, only readable as the
+    * next pass's input attachment */
+   bool transient;
+};
+
+struct vk_shader_chain_stats
+{
+   unsigned render_passes;
+   unsigned transient;             /* outputs in transient attachments */
+   VkDeviceSize memory;            /* allocated for the other outputs */
+   VkDeviceSize memory_unaliased;  /* what they would take without sharing */
+   bool lazily_allocated;          /* transient memory is lazily allocated */
+};
+
+/* Called by vk_shader_chain_record() inside the render pass and subpass
+ * for @pass, to bind its pipeline and descriptors and draw. */
+typedef void (*vk_shader_chain_draw_t)(void *userdata, VkCommandBuffer cmd,
+      unsigned pass);
+
+/**
+ * vk_shader_chain_new:
+ * @config                  : device, passes and output
+ *
+ * Work out which passes share a render pass and which outputs are
+ * transient, then create the images, memory, views, render passes and
+ * framebuffers (except the last render pass's, which are made for each
+ * output image as it comes).
+ *
+ * Returns: pointer to the new object if successful, otherwise NULL.
+ */
+vk_shader_chain_t *vk_shader_chain_new(const struct vk_shader_chain_config *config);
+
+/**
+ * vk_shader_chain_free:
+ * @c                       : pointer to shader chain object
+ *
+ * Destroy everything. The GPU must be done with the chain.
+ */
+void vk_shader_chain_free(vk_shader_chain_t *c);
+
+void vk_shader_chain_get_pass(vk_shader_chain_t *c, unsigned pass,
+      struct vk_shader_chain_pass_info *info);
+
+/* A pass's output, to sample in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+ * from the passes that read it. VK_NULL_HANDLE for transient outputs and
+ * the last pass. */
+VkImageView vk_shader_chain_get_output(vk_shader_chain_t *c, unsigned pass);
+
+void vk_shader_chain_get_stats(vk_shader_chain_t *c, struct vk_shader_chain_stats *stats);
+
+/**
+ * vk_shader_chain_record:
+ * @c                       : pointer to shader chain object
+ * @cmd                     : command buffer to record into
+ * @output                  : view of the image to draw to, in the
+ *                            configured format and size
+ * @draw                    : binds and draws each pass
+ * @userdata                : passed to @draw
+ *
+ * Record every pass, in order. Framebuffers for the last render pass
+ * are kept for the last few output views seen (enough for a swapchain);
+ * call vk_shader_chain_forget_outputs() when those views are destroyed.
+ *
+ * Returns: true (1) if recorded, false (0) if a framebuffer for @output
+ * couldn't be created.
+ */
+bool vk_shader_chain_record(vk_shader_chain_t *c, VkCommandBuffer cmd,
+      VkImageView output, vk_shader_chain_draw_t draw, void *userdata);
+
+/* Destroy the framebuffers made for output views, e.g. before the
+ * swapchain is recreated. The GPU must be done with them. */
+void vk_shader_chain_forget_outputs(vk_shader_chain_t *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#ifdef VK_SHADER_CHAIN_IMPLEMENTATION
+#undef VK_SHADER_CHAIN_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Output views with a framebuffer kept for them */
+#define VK_SHADER_CHAIN_MAX_OUTPUTS 8
+
+struct vk_shader_chain_image
+{
+   VkImage image;
+   VkImageView view;
+   VkDeviceMemory memory;      /* owned, or VK_NULL_HANDLE if in a shared slot */
+   VkMemoryRequirements reqs;
+   unsigned first_group;       /* render passes it is live across */
+   unsigned last_group;
+   bool transient;
+   bool sampled;
+   bool input;                 /* read as the next pass's input attachment */
+};
+
+struct vk_shader_chain_group
+{
+   unsigned first_pass;
+   unsigned pass_count;
+   VkExtent2D extent;
+   VkRenderPass render_pass;
+   VkFramebuffer framebuffer;  /* VK_NULL_HANDLE for the last group */
+};
+
+struct vk_shader_chain_output
+{
+   VkImageView view;
+   VkFramebuffer framebuffer;
+};
+
+struct vk_shader_chain
+{
+   struct VolkDeviceTable table;
+   VkDevice device;
+   const VkAllocationCallbacks *allocator;
+
+   unsigned pass_count;
+   struct vk_shader_chain_pass_desc passes[VK_SHADER_CHAIN_MAX_PASSES];
+   unsigned pass_group[VK_SHADER_CHAIN_MAX_PASSES];
+   struct vk_shader_chain_image images[VK_SHADER_CHAIN_MAX_PASSES];  /* all but the last pass */
+
+   unsigned group_count;
+   struct vk_shader_chain_group groups[VK_SHADER_CHAIN_MAX_PASSES];
+
+   /* shared allocations for the non-transient images */
+   unsigned slot_count;
+   VkDeviceMemory slots[VK_SHADER_CHAIN_MAX_PASSES];
+
+   VkFormat output_format;
+   VkExtent2D output_extent;
+   VkImageLayout output_layout;
+   bool clear_output;
+
+   unsigned output_count;
+   unsigned next_output;       /* entry to replace when full */
+   struct vk_shader_chain_output outputs[VK_SHADER_CHAIN_MAX_OUTPUTS];
+
+   struct vk_shader_chain_stats stats;
+};
+
+static int vk_shader_chain_memory_type(const VkPhysicalDeviceMemoryProperties *props,
+      uint32_t type_bits, VkMemoryPropertyFlags wanted)
+{
+   uint32_t type;
+   for (type = 0; type < props->memoryTypeCount; type++)
+      if ((type_bits & (1u << type))
+            && (props->memoryTypes[type].propertyFlags & wanted) == wanted)
+         return (int)type;
+   return -1;
+}
+
+static VkExtent2D vk_shader_chain_pass_extent(vk_shader_chain_t *c, unsigned pass)
+{
+   VkExtent2D extent = c->output_extent;
+   if (pass + 1 < c->pass_count)
+   {
+      extent.width  = c->passes[pass].width;
+      extent.height = c->passes[pass].height;
+   }
+   return extent;
+}
+
+/* Merge each pixel-local pass into the previous pass's render pass when
+ * the sizes match and it samples nothing else drawn in that render pass */
+static void vk_shader_chain_group_passes(vk_shader_chain_t *c)
+{
+   unsigned i;
+   uint32_t group_mask = 0;
+
+   for (i = 0; i < c->pass_count; i++)
+   {
+      struct vk_shader_chain_group *g = &c->groups[c->group_count - 1];
+      VkExtent2D extent = vk_shader_chain_pass_extent(c, i);
+      uint32_t prev = i ? 1u << (i - 1) : 0;
+
+      if (i && c->passes[i].pixel_local
+            && extent.width == g->extent.width && extent.height == g->extent.height
+            && !(c->passes[i].reads & group_mask & ~prev))
+         g->pass_count++;
+      else
+      {
+         g = &c->groups[c->group_count++];
+         g->first_pass = i;
+         g->pass_count = 1;
+         g->extent     = extent;
+         group_mask    = 0;
+      }
+      group_mask |= 1u << i;
+      c->pass_group[i] = c->group_count - 1;
+   }
+}
+
+/* How each output is used, and the render passes it has to live across */
+static void vk_shader_chain_classify(vk_shader_chain_t *c)
+{
+   unsigned i, j;
+
+   for (i = 0; i + 1 < c->pass_count; i++)
+   {
+      struct vk_shader_chain_image *img = &c->images[i];
+      bool merged_next = c->pass_group[i + 1] == c->pass_group[i];
+
+      img->first_group = img->last_group = c->pass_group[i];
+      img->input = merged_next;
+      for (j = i + 1; j < c->pass_count; j++)
+      {
+         bool reads = (c->passes[j].reads & (1u << i)) != 0;
+         if (j == i + 1)
+         {
+            /* pixel-local but not merged: sampled after all */
+            if (merged_next)
+               reads = false;
+            else if (c->passes[j].pixel_local)
+               reads = true;
+         }
+         if (reads)
+         {
+            img->sampled = true;
+            if (c->pass_group[j] > img->last_group)
+               img->last_group = c->pass_group[j];
+         }
+      }
+      img->transient = merged_next && !img->sampled;
+   }
+}
+
+static bool vk_shader_chain_create_images(vk_shader_chain_t *c,
+      const VkPhysicalDeviceMemoryProperties *mem_props)
+{
+   unsigned i, j;
+   VkDeviceSize slot_size[VK_SHADER_CHAIN_MAX_PASSES];
+   uint32_t slot_bits[VK_SHADER_CHAIN_MAX_PASSES];
+   unsigned slot_last[VK_SHADER_CHAIN_MAX_PASSES];
+   unsigned img_slot[VK_SHADER_CHAIN_MAX_PASSES];
+
+   for (i = 0; i + 1 < c->pass_count; i++)
+   {
+      struct vk_shader_chain_image *img = &c->images[i];
+      VkImageCreateInfo info;
+
+      memset(&info, 0, sizeof(info));
+      info.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+      info.imageType     = VK_IMAGE_TYPE_2D;
+      info.format        = c->passes[i].format;
+      info.extent.width  = c->passes[i].width;
+      info.extent.height = c->passes[i].height;
+      info.extent.depth  = 1;
+      info.mipLevels     = 1;
+      info.arrayLayers   = 1;
+      info.samples       = VK_SAMPLE_COUNT_1_BIT;
+      info.tiling        = VK_IMAGE_TILING_OPTIMAL;
+      info.usage         = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+      if (img->transient)
+         info.usage     |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+      if (img->sampled)
+         info.usage     |= VK_IMAGE_USAGE_SAMPLED_BIT;
+      if (img->input)
+         info.usage     |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+      info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+      info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+      if (c->table.vkCreateImage(c->device, &info, c->allocator, &img->image) != VK_SUCCESS)
+         return false;
+      c->table.vkGetImageMemoryRequirements(c->device, img->image, &img->reqs);
+   }
+
+   /* Transient attachments get memory of their own, lazily allocated if
+    * there is such a type. The rest go in the first slot that no image
+    * live at the same time is in, and that has a memory type in common */
+   for (i = 0; i + 1 < c->pass_count; i++)
+   {
+      struct vk_shader_chain_image *img = &c->images[i];
+
+      if (img->transient)
+      {
+         VkMemoryAllocateInfo alloc;
+         int type = vk_shader_chain_memory_type(mem_props, img->reqs.memoryTypeBits,
+               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+         if (type >= 0)
+            c->stats.lazily_allocated = true;
+         else if ((type = vk_shader_chain_memory_type(mem_props, img->reqs.memoryTypeBits,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) < 0)
+            return false;
+         memset(&alloc, 0, sizeof(alloc));
+         alloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+         alloc.allocationSize  = img->reqs.size;
+         alloc.memoryTypeIndex = (uint32_t)type;
+         if (c->table.vkAllocateMemory(c->device, &alloc, c->allocator, &img->memory) != VK_SUCCESS
+               || c->table.vkBindImageMemory(c->device, img->image, img->memory, 0) != VK_SUCCESS)
+            return false;
+         c->stats.transient++;
+         continue;
+      }
+
+      c->stats.memory_unaliased += img->reqs.size;
+      for (j = 0; j < c->slot_count; j++)
+         if (slot_last[j] < img->first_group
+               && (slot_bits[j] & img->reqs.memoryTypeBits))
+            break;
+      if (j == c->slot_count)
+      {
+         slot_size[j] = 0;
+         slot_bits[j] = img->reqs.memoryTypeBits;
+         c->slot_count++;
+      }
+      if (slot_size[j] < img->reqs.size)
+         slot_size[j] = img->reqs.size;
+      slot_bits[j] &= img->reqs.memoryTypeBits;
+      slot_last[j]  = img->last_group;
+      img_slot[i]   = j;
+   }
+
+   /* everything in a slot is bound at offset 0, so alignment doesn't matter */
+   for (j = 0; j < c->slot_count; j++)
+   {
+      VkMemoryAllocateInfo alloc;
+      int type = vk_shader_chain_memory_type(mem_props, slot_bits[j],
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+      if (type < 0)
+         return false;
+      memset(&alloc, 0, sizeof(alloc));
+      alloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+      alloc.allocationSize  = slot_size[j];
+      alloc.memoryTypeIndex = (uint32_t)type;
+      if (c->table.vkAllocateMemory(c->device, &alloc, c->allocator, &c->slots[j]) != VK_SUCCESS)
+         return false;
+      c->stats.memory += slot_size[j];
+   }
+
+   for (i = 0; i + 1 < c->pass_count; i++)
+   {
+      struct vk_shader_chain_image *img = &c->images[i];
+      VkImageViewCreateInfo view;
+
+      if (!img->transient
+            && c->table.vkBindImageMemory(c->device, img->image,
+               c->slots[img_slot[i]], 0) != VK_SUCCESS)
+         return false;
+
+      memset(&view, 0, sizeof(view));
+      view.sType                       = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+      view.image                       = img->image;
+      view.viewType                    = VK_IMAGE_VIEW_TYPE_2D;
+      view.format                      = c->passes[i].format;
+      view.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+      view.subresourceRange.levelCount = 1;
+      view.subresourceRange.layerCount = 1;
+      if (c->table.vkCreateImageView(c->device, &view, c->allocator, &img->view) != VK_SUCCESS)
+         return false;
+   }
+   return true;
+}
+
+/* One attachment and subpass per pass in the group. Outputs start out
+ * undefined, since images sharing memory leave each other garbage, and
+ * the ones read later end up ready to sample. */
+static bool vk_shader_chain_create_render_pass(vk_shader_chain_t *c,
+      struct vk_shader_chain_group *g)
+{
+   VkAttachmentDescription attachments[VK_SHADER_CHAIN_MAX_PASSES];
+   VkAttachmentReference colors[VK_SHADER_CHAIN_MAX_PASSES];
+   VkAttachmentReference inputs[VK_SHADER_CHAIN_MAX_PASSES];
+   VkSubpassDescription subpasses[VK_SHADER_CHAIN_MAX_PASSES];
+   VkSubpassDependency deps[VK_SHADER_CHAIN_MAX_PASSES + 1];
+   VkRenderPassCreateInfo info;
+   unsigned s, dep_count = 0;
+
+   for (s = 0; s < g->pass_count; s++)
+   {
+      unsigned pass = g->first_pass + s;
+      VkAttachmentDescription *a = &attachments[s];
+
+      memset(a, 0, sizeof(*a));
+      a->samples        = VK_SAMPLE_COUNT_1_BIT;
+      a->loadOp         = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+      a->stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+      a->stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+      a->initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+      if (pass + 1 == c->pass_count)
+      {
+         a->format      = c->output_format;
+         a->storeOp     = VK_ATTACHMENT_STORE_OP_STORE;
+         a->finalLayout = c->output_layout;
+         if (c->clear_output)
+            a->loadOp   = VK_ATTACHMENT_LOAD_OP_CLEAR;
+      }
+      else
+      {
+         struct vk_shader_chain_image *img = &c->images[pass];
+         a->format      = c->passes[pass].format;
+         a->storeOp     = img->sampled ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+         a->finalLayout = img->sampled ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                                       : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+      }
+
+      colors[s].attachment = s;
+      colors[s].layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+      inputs[s].attachment = s - 1;
+      inputs[s].layout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+      memset(&subpasses[s], 0, sizeof(subpasses[s]));
+      subpasses[s].pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+      subpasses[s].colorAttachmentCount = 1;
+      subpasses[s].pColorAttachments    = &colors[s];
+      if (s)
+      {
+         VkSubpassDependency *d = &deps[dep_count++];
+         subpasses[s].inputAttachmentCount = 1;
+         subpasses[s].pInputAttachments    = &inputs[s];
+         d->srcSubpass      = s - 1;
+         d->dstSubpass      = s;
+         d->srcStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+         d->dstStageMask    = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+         d->srcAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+         d->dstAccessMask   = VK_ACCESS_INPUT_ATTACHMENT_READ_BIT;
+         d->dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+      }
+   }
+
+   /* Earlier render passes' outputs are sampled here, and images sharing
+    * memory with them are drawn to here after they were last read */
+   deps[dep_count].srcSubpass      = VK_SUBPASS_EXTERNAL;
+   deps[dep_count].dstSubpass      = 0;
+   deps[dep_count].srcStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+                                   | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+   deps[dep_count].dstStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+                                   | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+   deps[dep_count].srcAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+   deps[dep_count].dstAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+                                   | VK_ACCESS_SHADER_READ_BIT;
+   deps[dep_count].dependencyFlags = 0;
+   dep_count++;
+   deps[dep_count].srcSubpass      = g->pass_count - 1;
+   deps[dep_count].dstSubpass      = VK_SUBPASS_EXTERNAL;
+   deps[dep_count].srcStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+   deps[dep_count].dstStageMask    = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+   deps[dep_count].srcAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+   deps[dep_count].dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+   deps[dep_count].dependencyFlags = 0;
+   dep_count++;
+
+   memset(&info, 0, sizeof(info));
+   info.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+   info.attachmentCount = g->pass_count;
+   info.pAttachments    = attachments;
+   info.subpassCount    = g->pass_count;
+   info.pSubpasses      = subpasses;
+   info.dependencyCount = dep_count;
+   info.pDependencies   = deps;
+   return c->table.vkCreateRenderPass(c->device, &info, c->allocator,
+         &g->render_pass) == VK_SUCCESS;
+}
+
+static bool vk_shader_chain_create_framebuffer(vk_shader_chain_t *c,
+      struct vk_shader_chain_group *g, VkImageView output, VkFramebuffer *fb)
+{
+   VkImageView views[VK_SHADER_CHAIN_MAX_PASSES];
+   VkFramebufferCreateInfo info;
+   unsigned s;
+
+   for (s = 0; s < g->pass_count; s++)
+   {
+      unsigned pass = g->first_pass + s;
+      views[s] = pass + 1 == c->pass_count ? output : c->images[pass].view;
+   }
+   memset(&info, 0, sizeof(info));
+   info.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+   info.renderPass      = g->render_pass;
+   info.attachmentCount = g->pass_count;
+   info.pAttachments    = views;
+   info.width           = g->extent.width;
+   info.height          = g->extent.height;
+   info.layers          = 1;
+   return c->table.vkCreateFramebuffer(c->device, &info, c->allocator, fb) == VK_SUCCESS;
+}
+
+vk_shader_chain_t *vk_shader_chain_new(const struct vk_shader_chain_config *config)
+{
+   VkPhysicalDeviceMemoryProperties mem_props;
+   unsigned i;
+   vk_shader_chain_t *c;
+
+   if (!config->pass_count || config->pass_count > VK_SHADER_CHAIN_MAX_PASSES)
+      return NULL;
+   if (!(c = (vk_shader_chain_t*)calloc(1, sizeof(*c))))
+      return NULL;
+   c->device               = config->device;
+   c->allocator            = config->allocator;
+   c->pass_count           = config->pass_count;
+   c->output_format        = config->output_format;
+   c->output_extent.width  = config->output_width;
+   c->output_extent.height = config->output_height;
+   c->output_layout        = config->output_layout;
+   c->clear_output         = config->clear_output;
+   memcpy(c->passes, config->passes, sizeof(*c->passes) * c->pass_count);
+   if (config->table)
+      c->table = *config->table;
+   else
+      volkLoadDeviceTable(&c->table, c->device);
+
+   vk_shader_chain_group_passes(c);
+   vk_shader_chain_classify(c);
+   c->stats.render_passes = c->group_count;
+
+   vkGetPhysicalDeviceMemoryProperties(config->physical_device, &mem_props);
+   if (!vk_shader_chain_create_images(c, &mem_props))
+      goto error;
+   for (i = 0; i < c->group_count; i++)
+   {
+      struct vk_shader_chain_group *g = &c->groups[i];
+      if (!vk_shader_chain_create_render_pass(c, g))
+         goto error;
+      if (i + 1 < c->group_count
+            && !vk_shader_chain_create_framebuffer(c, g, VK_NULL_HANDLE, &g->framebuffer))
+         goto error;
+   }
+   return c;
+
+error:
+   vk_shader_chain_free(c);
+   return NULL;
+}
+
+void vk_shader_chain_forget_outputs(vk_shader_chain_t *c)
+{
+   unsigned i;
+   for (i = 0; i < c->output_count; i++)
+      c->table.vkDestroyFramebuffer(c->device, c->outputs[i].framebuffer, c->allocator);
+   c->output_count = 0;
+   c->next_output  = 0;
+}
+
+void vk_shader_chain_free(vk_shader_chain_t *c)
+{
+   unsigned i;
+
+   if (!c)
+      return;
+   vk_shader_chain_forget_outputs(c);
+   for (i = 0; i < c->group_count; i++)
+   {
+      struct vk_shader_chain_group *g = &c->groups[i];
+      if (g->framebuffer)
+         c->table.vkDestroyFramebuffer(c->device, g->framebuffer, c->allocator);
+      if (g->render_pass)
+         c->table.vkDestroyRenderPass(c->device, g->render_pass, c->allocator);
+   }
+   for (i = 0; i + 1 < c->pass_count; i++)
+   {
+      struct vk_shader_chain_image *img = &c->images[i];
+      if (img->view)
+         c->table.vkDestroyImageView(c->device, img->view, c->allocator);
+      if (img->image)
+         c->table.vkDestroyImage(c->device, img->image, c->allocator);
+      if (img->memory)
+         c->table.vkFreeMemory(c->device, img->memory, c->allocator);
+   }
+   for (i = 0; i < c->slot_count; i++)
+      if (c->slots[i])
+         c->table.vkFreeMemory(c->device, c->slots[i], c->allocator);
+   free(c);
+}
+
+void vk_shader_chain_get_pass(vk_shader_chain_t *c, unsigned pass,
+      struct vk_shader_chain_pass_info *info)
+{
+   struct vk_shader_chain_group *g = &c->groups[c->pass_group[pass]];
+
+   memset(info, 0, sizeof(*info));
+   info->render_pass = g->render_pass;
+   info->subpass     = pass - g->first_pass;
+   info->extent      = g->extent;
+   if (pass > g->first_pass)
+      info->input_attachment = c->images[pass - 1].view;
+   if (pass + 1 < c->pass_count)
+      info->transient = c->images[pass].transient;
+}
+
+VkImageView vk_shader_chain_get_output(vk_shader_chain_t *c, unsigned pass)
+{
+   if (pass + 1 >= c->pass_count || !c->images[pass].sampled)
+      return VK_NULL_HANDLE;
+   return c->images[pass].view;
+}
+
+void vk_shader_chain_get_stats(vk_shader_chain_t *c, struct vk_shader_chain_stats *stats)
+{
+   *stats = c->stats;
+}
+
+static VkFramebuffer vk_shader_chain_output_framebuffer(vk_shader_chain_t *c,
+      VkImageView output)
+{
+   struct vk_shader_chain_output *o;
+   unsigned i;
+
+   for (i = 0; i < c->output_count; i++)
+      if (c->outputs[i].view == output)
+         return c->outputs[i].framebuffer;
+
+   /* Full: replace the oldest, which a swapchain of fewer images than
+    * this is done with */
+   if (c->output_count < VK_SHADER_CHAIN_MAX_OUTPUTS)
+      o = &c->outputs[c->output_count++];
+   else
+   {
+      o = &c->outputs[c->next_output];
+      c->next_output = (c->next_output + 1) % VK_SHADER_CHAIN_MAX_OUTPUTS;
+      c->table.vkDestroyFramebuffer(c->device, o->framebuffer, c->allocator);
+   }
+   o->view = output;
+   if (!vk_shader_chain_create_framebuffer(c, &c->groups[c->group_count - 1],
+            output, &o->framebuffer))
+   {
+      *o = c->outputs[--c->output_count];
+      return VK_NULL_HANDLE;
+   }
+   return o->framebuffer;
+}
+
+bool vk_shader_chain_record(vk_shader_chain_t *c, VkCommandBuffer cmd,
+      VkImageView output, vk_shader_chain_draw_t draw, void *userdata)
+{
+   VkFramebuffer out_fb = vk_shader_chain_output_framebuffer(c, output);
+   VkClearValue clears[VK_SHADER_CHAIN_MAX_PASSES];
+   unsigned i, s;
+
+   if (!out_fb)
+      return false;
+   memset(clears, 0, sizeof(clears));
+   for (i = 0; i < c->group_count; i++)
+   {
+      struct vk_shader_chain_group *g = &c->groups[i];
+      VkRenderPassBeginInfo begin;
+
+      memset(&begin, 0, sizeof(begin));
+      begin.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+      begin.renderPass        = g->render_pass;
+      begin.framebuffer       = i + 1 < c->group_count ? g->framebuffer : out_fb;
+      begin.renderArea.extent = g->extent;
+      /* black; only the output is cleared, the others ignore theirs */
+      if (i + 1 == c->group_count && c->clear_output)
+      {
+         begin.clearValueCount = g->pass_count;
+         begin.pClearValues    = clears;
+      }
+      c->table.vkCmdBeginRenderPass(cmd, &begin, VK_SUBPASS_CONTENTS_INLINE);
+      for (s = 0; s < g->pass_count; s++)
+      {
+         if (s)
+            c->table.vkCmdNextSubpass(cmd, VK_SUBPASS_CONTENTS_INLINE);
+         draw(userdata, cmd, g->first_pass + s);
+      }
+      c->table.vkCmdEndRenderPass(cmd);
+   }
+   return true;
+}
+
+#endif
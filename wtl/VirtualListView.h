@@ -0,0 +1,257 @@
+#ifndef __VIRTUALLISTVIEW__H
+#define __VIRTUALLISTVIEW__H
+
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// CVirtualListView - A list view for very large item counts
+//
+// The control is a report-mode list view with the LVS_OWNERDATA style, so
+// it keeps no items of its own: it only knows how many there are, and asks
+// for the text of the rows it paints. Setting 100k items takes no time and
+// no memory in the control.
+//
+// Rows come from the derived class (CVirtualListViewImpl), or from an
+// IVirtualListSource (CVirtualListViewCtrl):
+//   GetItemText()  - text of one cell, for the rows being painted
+//   GetItemImage() - image list index of a cell, -1 for none
+//   PrepareCache() - the control is about to ask for rows iFrom..iTo; load
+//                    them in one go (e.g. one database query), and queue
+//                    them first for any background metadata fill
+//   FindItem()     - type-ahead search; the default walks column 0 with
+//                    GetItemText(), override it if the data has an index
+//
+// Data that is filled in later (e.g. tags read by a worker thread) can show
+// a placeholder until then; call PostItemsChanged() from any thread when
+// rows are ready and the ones on screen are repainted.
+//
+// The LVS_OWNERDATA style can't be added after the list view is created,
+// so include it in the dialog template when using SubclassWindow().
+//
+// Add the following macro to the parent's message map:
+//   REFLECT_NOTIFICATIONS()
+//
+
+#ifndef __cplusplus
+  #error WTL requires C++ compilation (use a .cpp suffix)
+#endif
+
+#ifndef __ATLAPP_H__
+  #error VirtualListView.h requires atlapp.h to be included first
+#endif
+
+#ifndef __ATLCTRLS_H__
+  #error VirtualListView.h requires atlctrls.h to be included first
+#endif
+
+#if (_WIN32_IE < 0x0400)
+  #error VirtualListView.h requires IE4
+#endif
+
+
+// Posted by PostItemsChanged(); wParam and lParam are the first and last row
+#define WM_USER_VLV_ITEMSCHANGED  WM_USER+440
+
+
+/////////////////////////////////////////////////////////////////////////////
+// Data source for CVirtualListViewCtrl
+
+class IVirtualListSource
+{
+public:
+   virtual void GetItemText(int iItem, int iSubItem, LPTSTR pstr, int cchMax) = 0;
+   virtual int GetItemImage(int /*iItem*/, int /*iSubItem*/) { return -1; }
+   virtual void PrepareCache(int /*iFrom*/, int /*iTo*/) { }
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+// The Virtual List View control
+
+template< class T, class TBase = CListViewCtrl, class TWinTraits = CWinTraitsOR<LVS_OWNERDATA|LVS_REPORT|LVS_SHOWSELALWAYS> >
+class ATL_NO_VTABLE CVirtualListViewImpl :
+   public CWindowImpl< T, TBase, TWinTraits >
+{
+public:
+   DECLARE_WND_SUPERCLASS(NULL, TBase::GetWndClassName())
+
+   int m_iCacheFrom;
+   int m_iCacheTo;
+
+   CVirtualListViewImpl() :
+      m_iCacheFrom(0),
+      m_iCacheTo(-1)
+   {
+   }
+
+   // Operations
+
+   BOOL SubclassWindow(HWND hWnd)
+   {
+      ATLASSERT(m_hWnd==NULL);
+      ATLASSERT(::IsWindow(hWnd));
+      BOOL bRet = CWindowImpl< T, TBase, TWinTraits >::SubclassWindow(hWnd);
+      ATLASSERT(!bRet || (GetStyle() & LVS_OWNERDATA)!=0);
+      return bRet;
+   }
+
+   // Replaces the item count. Selection and scroll position are kept
+   // where they are still in range; all rows are asked for again.
+   void SetVirtualItemCount(int nItems)
+   {
+      ATLASSERT(::IsWindow(m_hWnd));
+      m_iCacheFrom = 0;
+      m_iCacheTo = -1;
+      SetItemCountEx(nItems, LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+      Invalidate();
+   }
+
+   // Rows iFrom..iTo have new data. Safe to call from any thread.
+   void PostItemsChanged(int iFrom, int iTo) const
+   {
+      ATLASSERT(::IsWindow(m_hWnd));
+      ::PostMessage(m_hWnd, WM_USER_VLV_ITEMSCHANGED, (WPARAM) iFrom, (LPARAM) iTo);
+   }
+
+   // Overridables
+
+   void GetItemText(int /*iItem*/, int /*iSubItem*/, LPTSTR pstr, int cchMax)
+   {
+      if( cchMax > 0 ) pstr[0] = _T('\0');
+   }
+
+   int GetItemImage(int /*iItem*/, int /*iSubItem*/)
+   {
+      return -1;
+   }
+
+   void PrepareCache(int /*iFrom*/, int /*iTo*/)
+   {
+   }
+
+   int FindItem(LPCTSTR pstrText, int iStart, bool bPartial, bool bWrap)
+   {
+      T* pT = static_cast<T*>(this);
+      int nCount = TBase::GetItemCount();
+      int cchText = ::lstrlen(pstrText);
+      TCHAR szItem[260];
+      if( iStart < 0 || iStart >= nCount ) iStart = 0;
+      for( int i = 0; i < nCount; i++ ) {
+         int iItem = iStart + i;
+         if( iItem >= nCount ) {
+            if( !bWrap ) break;
+            iItem -= nCount;
+         }
+         szItem[0] = _T('\0');
+         pT->GetItemText(iItem, 0, szItem, sizeof(szItem) / sizeof(TCHAR));
+         int cchItem = ::lstrlen(szItem);
+         if( bPartial ) {
+            if( cchItem < cchText ) continue;
+            cchItem = cchText;
+         }
+         if( ::CompareString(LOCALE_USER_DEFAULT, NORM_IGNORECASE, szItem, cchItem, pstrText, cchText) == CSTR_EQUAL ) return iItem;
+      }
+      return -1;
+   }
+
+   // Message map and handlers
+
+   BEGIN_MSG_MAP(CVirtualListViewImpl)
+      MESSAGE_HANDLER(WM_USER_VLV_ITEMSCHANGED, OnItemsChanged)
+      REFLECTED_NOTIFY_CODE_HANDLER(LVN_GETDISPINFO, OnGetDispInfo)
+      REFLECTED_NOTIFY_CODE_HANDLER(LVN_ODCACHEHINT, OnCacheHint)
+      REFLECTED_NOTIFY_CODE_HANDLER(LVN_ODFINDITEM, OnFindItem)
+      DEFAULT_REFLECTION_HANDLER()
+   END_MSG_MAP()
+
+   LRESULT OnItemsChanged(UINT /*uMsg*/, WPARAM wParam, LPARAM lParam, BOOL& /*bHandled*/)
+   {
+      // Only the rows on screen need repainting; the rest are asked for
+      // when they're scrolled into view
+      int iFrom = (int) wParam;
+      int iTo = (int) lParam;
+      int iTop = GetTopIndex();
+      int iBottom = iTop + GetCountPerPage();
+      if( iFrom < iTop ) iFrom = iTop;
+      if( iTo > iBottom ) iTo = iBottom;
+      if( iTo >= TBase::GetItemCount() ) iTo = TBase::GetItemCount() - 1;
+      if( iFrom <= iTo ) RedrawItems(iFrom, iTo);
+      return 0;
+   }
+
+   LRESULT OnGetDispInfo(int /*idCtrl*/, LPNMHDR pnmh, BOOL& /*bHandled*/)
+   {
+      T* pT = static_cast<T*>(this);
+      LVITEM& item = reinterpret_cast<NMLVDISPINFO*>(pnmh)->item;
+      if( (item.mask & LVIF_TEXT) != 0 && item.cchTextMax > 0 ) {
+         item.pszText[0] = _T('\0');
+         pT->GetItemText(item.iItem, item.iSubItem, item.pszText, item.cchTextMax);
+      }
+      if( (item.mask & LVIF_IMAGE) != 0 ) {
+         int iImage = pT->GetItemImage(item.iItem, item.iSubItem);
+         if( iImage >= 0 ) item.iImage = iImage;
+      }
+      return 0;
+   }
+
+   LRESULT OnCacheHint(int /*idCtrl*/, LPNMHDR pnmh, BOOL& /*bHandled*/)
+   {
+      // The control sends hints for rows it already asked about (e.g. on
+      // every repaint), so only pass on ones that go past the last range
+      T* pT = static_cast<T*>(this);
+      NMLVCACHEHINT* pHint = reinterpret_cast<NMLVCACHEHINT*>(pnmh);
+      if( pHint->iFrom < m_iCacheFrom || pHint->iTo > m_iCacheTo ) {
+         m_iCacheFrom = pHint->iFrom;
+         m_iCacheTo = pHint->iTo;
+         pT->PrepareCache(pHint->iFrom, pHint->iTo);
+      }
+      return 0;
+   }
+
+   LRESULT OnFindItem(int /*idCtrl*/, LPNMHDR pnmh, BOOL& /*bHandled*/)
+   {
+      T* pT = static_cast<T*>(this);
+      NMLVFINDITEM* pFind = reinterpret_cast<NMLVFINDITEM*>(pnmh);
+      UINT flags = pFind->lvfi.flags;
+      if( (flags & (LVFI_STRING | LVFI_PARTIAL)) == 0 || pFind->lvfi.psz == NULL ) return -1;
+      return pT->FindItem(pFind->lvfi.psz, pFind->iStart, (flags & LVFI_PARTIAL) != 0, (flags & LVFI_WRAP) != 0);
+   }
+};
+
+class CVirtualListViewCtrl : public CVirtualListViewImpl<CVirtualListViewCtrl>
+{
+public:
+   DECLARE_WND_SUPERCLASS(_T("WTL_VirtualListView"), GetWndClassName())
+
+   IVirtualListSource* m_pSource;
+
+   CVirtualListViewCtrl() : m_pSource(NULL)
+   {
+   }
+
+   void SetSource(IVirtualListSource* pSource, int nItems)
+   {
+      m_pSource = pSource;
+      SetVirtualItemCount(pSource != NULL ? nItems : 0);
+   }
+
+   // Overridables
+
+   void GetItemText(int iItem, int iSubItem, LPTSTR pstr, int cchMax)
+   {
+      if( m_pSource != NULL ) m_pSource->GetItemText(iItem, iSubItem, pstr, cchMax);
+   }
+
+   int GetItemImage(int iItem, int iSubItem)
+   {
+      return m_pSource != NULL ? m_pSource->GetItemImage(iItem, iSubItem) : -1;
+   }
+
+   void PrepareCache(int iFrom, int iTo)
+   {
+      if( m_pSource != NULL ) m_pSource->PrepareCache(iFrom, iTo);
+   }
+};
+
+
+#endif // __VIRTUALLISTVIEW__H
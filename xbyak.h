@@ -18,6 +18,8 @@
 #include <stdio.h> // for debug print
 #include <assert.h>
 #include <list>
+#include <map>
+#include <vector>
 #include <string>
 #include <algorithm>
 #ifndef NDEBUG
@@ -28,6 +30,7 @@
 #if !defined(__GNUC__) || defined(__MINGW32__)
 	#undef XBYAK_USE_MMAP_ALLOCATOR
 #endif
+//#define XBYAK_USE_DUAL_MAP_ALLOCATOR
 
 // This covers -std=(gnu|c)++(0x|11|1y), -stdlib=libc++, and modern Microsoft.
 #if ((defined(_MSC_VER) && (_MSC_VER >= 1600)) || defined(_LIBCPP_VERSION) ||\
@@ -65,6 +68,15 @@
 	#include <unistd.h>
 	#include <sys/mman.h>
 	#include <stdlib.h>
+	#ifdef XBYAK_USE_DUAL_MAP_ALLOCATOR
+		#include <fcntl.h>
+		#if defined(__linux__)
+			#include <sys/syscall.h>
+		#elif defined(__APPLE__)
+			#include <mach/mach.h>
+			#include <mach/mach_vm.h>
+		#endif
+	#endif
 #endif
 #if !defined(_MSC_VER) || (_MSC_VER >= 1600)
 	#include <stdint.h>
@@ -286,6 +298,8 @@ struct Allocator {
 	virtual ~Allocator() {}
 	/* override to return false if you call protect() manually */
 	virtual bool useProtect() const { return true; }
+	/* override to return the address the code written at p is executed from, if the memory is mapped twice */
+	virtual const uint8 *getExecAddr(const uint8 *p) const { return p; }
 };
 
 #ifdef XBYAK_USE_MMAP_ALLOCATOR
@@ -321,6 +335,355 @@ public:
 };
 #endif
 
+/*
+	allocator that packs the code of many CodeGenerators into shared arenas
+	of arenaSize bytes, in 64-byte slots, and reuses freed slots.
+	useProtect() is false, so CodeArray never changes the protection itself;
+	instead protect(true) makes every page holding code read+exec (not
+	writable) in one pass over the arenas, and protect(false) makes them
+	all writable again. While code is executable, alloc() only hands out
+	pages with no live code on them, so a new generator can be written
+	without touching the protection of code that may be running.
+	not thread-safe
+*/
+class ArenaAllocator : public Allocator {
+	enum {
+		SLOT_SIZE = 64,
+		DEFAULT_ARENA_SIZE = 1024 * 1024
+	};
+	typedef std::map<size_t, size_t> FreeList; // offset -> size, coalesced
+	struct Arena {
+		uint8 *top;
+		size_t size;
+		size_t usedSize;
+		FreeList freeList;
+		std::vector<uint8> exec; // per page, 1 if read+exec
+	};
+	typedef std::map<uintptr_t, Arena*> ArenaList; // top -> arena
+	typedef XBYAK_STD_UNORDERED_MAP<uintptr_t, size_t> SizeList;
+	ArenaList arenaList_;
+	SizeList sizeList_;
+	size_t arenaSize_;
+	ArenaAllocator(const ArenaAllocator&);
+	void operator=(const ArenaAllocator&);
+	static size_t roundUp(size_t x, size_t align) { return (x + align - 1) & ~(align - 1); }
+	static size_t roundDown(size_t x, size_t align) { return x & ~(align - 1); }
+	static uint8 *mapPages(size_t size)
+	{
+#if defined(_WIN32)
+		return reinterpret_cast<uint8*>(VirtualAlloc(0, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+#elif defined(__GNUC__)
+#ifdef MAP_ANONYMOUS
+		const int mode = MAP_PRIVATE | MAP_ANONYMOUS;
+#elif defined(MAP_ANON)
+		const int mode = MAP_PRIVATE | MAP_ANON;
+#else
+		#error "not supported"
+#endif
+		void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, mode, -1, 0);
+		return p == MAP_FAILED ? 0 : reinterpret_cast<uint8*>(p);
+#else
+		return reinterpret_cast<uint8*>(AlignedMalloc(size, inner::ALIGN_PAGE_SIZE));
+#endif
+	}
+	static bool unmapPages(uint8 *p, size_t size)
+	{
+#if defined(_WIN32)
+		(void)size;
+		return VirtualFree(p, 0, MEM_RELEASE) != 0;
+#elif defined(__GNUC__)
+		return munmap(p, size) == 0;
+#else
+		(void)size;
+		AlignedFree(p);
+		return true;
+#endif
+	}
+	static bool protectPages(uint8 *p, size_t size, bool canExec)
+	{
+#if defined(_WIN32)
+		DWORD oldProtect;
+		return VirtualProtect(p, size, canExec ? PAGE_EXECUTE_READ : PAGE_READWRITE, &oldProtect) != 0;
+#elif defined(__GNUC__)
+		return mprotect(p, size, canExec ? (PROT_READ | PROT_EXEC) : (PROT_READ | PROT_WRITE)) == 0;
+#else
+		(void)p; (void)size; (void)canExec;
+		return true;
+#endif
+	}
+	/*
+		set the protection of the pages [begin, end) of arena for which need(page) is true,
+		one call per run of consecutive pages
+	*/
+	template<class Pred>
+	static bool protectRuns(Arena *arena, size_t begin, size_t end, bool canExec, Pred need)
+	{
+		const size_t pageSize = inner::ALIGN_PAGE_SIZE;
+		size_t page = begin;
+		while (page < end) {
+			if (!need(arena, page)) { page++; continue; }
+			size_t last = page + 1;
+			while (last < end && need(arena, last)) last++;
+			if (!protectPages(arena->top + page * pageSize, (last - page) * pageSize, canExec)) return false;
+			for (size_t i = page; i < last; i++) arena->exec[i] = canExec ? 1 : 0;
+			page = last;
+		}
+		return true;
+	}
+	static bool isExec(const Arena *arena, size_t page) { return arena->exec[page] != 0; }
+	static bool isWritableInUse(const Arena *arena, size_t page)
+	{
+		if (arena->exec[page]) return false;
+		// a page is unused if it lies within a single free block
+		const size_t pageSize = inner::ALIGN_PAGE_SIZE;
+		FreeList::const_iterator i = arena->freeList.upper_bound(page * pageSize);
+		if (i == arena->freeList.begin()) return true;
+		--i;
+		return i->first + i->second < (page + 1) * pageSize;
+	}
+	Arena *newArena(size_t size)
+	{
+		const size_t pageSize = inner::ALIGN_PAGE_SIZE;
+		size = roundUp(size, pageSize);
+		uint8 *top = mapPages(size);
+		if (top == 0) throw Error(ERR_CANT_ALLOC);
+		Arena *arena = new Arena;
+		arena->top = top;
+		arena->size = size;
+		arena->usedSize = 0;
+		arena->freeList[0] = size;
+		arena->exec.resize(size / pageSize, 0);
+		arenaList_[(uintptr_t)top] = arena;
+		return arena;
+	}
+	void deleteArena(ArenaList::iterator i)
+	{
+		Arena *arena = i->second;
+		arenaList_.erase(i);
+		bool ok = unmapPages(arena->top, arena->size);
+		delete arena;
+		if (!ok) throw Error(ERR_MUNMAP);
+	}
+	/*
+		take size bytes from a free block of arena, avoiding the free parts of
+		read+exec pages that also hold live code
+	*/
+	uint8 *allocFrom(Arena *arena, size_t size)
+	{
+		const size_t pageSize = inner::ALIGN_PAGE_SIZE;
+		for (FreeList::iterator i = arena->freeList.begin(), ie = arena->freeList.end(); i != ie; ++i) {
+			const size_t blockBegin = i->first;
+			const size_t blockEnd = i->first + i->second;
+			size_t begin = blockBegin;
+			size_t end = blockEnd;
+			if (isExec(arena, begin / pageSize)) begin = roundUp(begin, pageSize);
+			if (isExec(arena, (end - 1) / pageSize)) end = roundDown(end, pageSize);
+			if (end <= begin || end - begin < size) continue;
+			// any read+exec page left in [begin, begin + size) is entirely free
+			if (!protectRuns(arena, begin / pageSize, (begin + size - 1) / pageSize + 1, false, isExec)) throw Error(ERR_CANT_PROTECT);
+			arena->freeList.erase(i);
+			if (begin > blockBegin) arena->freeList[blockBegin] = begin - blockBegin;
+			if (blockEnd > begin + size) arena->freeList[begin + size] = blockEnd - (begin + size);
+			arena->usedSize += size;
+			uint8 *p = arena->top + begin;
+			sizeList_[(uintptr_t)p] = size;
+			return p;
+		}
+		return 0;
+	}
+public:
+	explicit ArenaAllocator(size_t arenaSize = DEFAULT_ARENA_SIZE)
+		: arenaSize_(roundUp((std::max<size_t>)(arenaSize, 1), inner::ALIGN_PAGE_SIZE))
+	{
+	}
+	~ArenaAllocator()
+	{
+		for (ArenaList::iterator i = arenaList_.begin(), ie = arenaList_.end(); i != ie; ++i) {
+			unmapPages(i->second->top, i->second->size);
+			delete i->second;
+		}
+	}
+	uint8 *alloc(size_t size)
+	{
+		size = roundUp((std::max<size_t>)(size, 1), SLOT_SIZE);
+		for (ArenaList::iterator i = arenaList_.begin(), ie = arenaList_.end(); i != ie; ++i) {
+			uint8 *p = allocFrom(i->second, size);
+			if (p) return p;
+		}
+		uint8 *p = allocFrom(newArena((std::max)(arenaSize_, size)), size);
+		assert(p);
+		return p;
+	}
+	void free(uint8 *p)
+	{
+		if (p == 0) return;
+		SizeList::iterator s = sizeList_.find((uintptr_t)p);
+		if (s == sizeList_.end()) throw Error(ERR_BAD_PARAMETER);
+		const size_t slotSize = s->second;
+		sizeList_.erase(s);
+		ArenaList::iterator a = arenaList_.upper_bound((uintptr_t)p);
+		assert(a != arenaList_.begin());
+		--a;
+		Arena *arena = a->second;
+		arena->usedSize -= slotSize;
+		if (arena->usedSize == 0 && arenaList_.size() > 1) {
+			deleteArena(a);
+			return;
+		}
+		// return the slot to the free list, merging it with its neighbours
+		FreeList &freeList = arena->freeList;
+		size_t offset = p - arena->top;
+		size_t size = slotSize;
+		FreeList::iterator next = freeList.lower_bound(offset);
+		if (next != freeList.end() && next->first == offset + size) {
+			size += next->second;
+			freeList.erase(next++);
+		}
+		if (next != freeList.begin()) {
+			FreeList::iterator prev = next;
+			--prev;
+			if (prev->first + prev->second == offset) {
+				prev->second += size;
+				return;
+			}
+		}
+		freeList[offset] = size;
+	}
+	/*
+		change exec permission of all the code in the arenas
+		@param canExec [in] true(read+exec, for every page holding code), false(read+write, for all pages)
+		@return true(success), false(failure)
+	*/
+	bool protect(bool canExec)
+	{
+		for (ArenaList::iterator i = arenaList_.begin(), ie = arenaList_.end(); i != ie; ++i) {
+			Arena *arena = i->second;
+			const size_t pageNum = arena->exec.size();
+			if (!(canExec ? protectRuns(arena, 0, pageNum, true, isWritableInUse) : protectRuns(arena, 0, pageNum, false, isExec))) return false;
+		}
+		return true;
+	}
+	bool useProtect() const { return false; }
+};
+
+#ifdef XBYAK_USE_DUAL_MAP_ALLOCATOR
+/*
+	allocator that maps the memory of each CodeGenerator twice, read+write to
+	emit and patch code and read+exec to run it, so that no page is ever both
+	writable and executable and no protection changes are needed at all.
+	getCode() and getCurr() of a CodeArray using it return the read+exec
+	addresses. useProtect() is false.
+*/
+class DualMapAllocator : public Allocator {
+	struct Mapping {
+		uint8 *execAddr;
+		size_t size;
+	};
+	typedef XBYAK_STD_UNORDERED_MAP<uintptr_t, Mapping> MappingList;
+	MappingList mappingList_;
+	DualMapAllocator(const DualMapAllocator&);
+	void operator=(const DualMapAllocator&);
+	static bool mapTwice(size_t size, uint8 **writeAddr, uint8 **execAddr)
+	{
+#if defined(_WIN32)
+		HANDLE h = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_EXECUTE_READWRITE | SEC_COMMIT, (DWORD)(uint64(size) >> 32), (DWORD)size, NULL);
+		if (h == NULL) return false;
+		void *w = MapViewOfFile(h, FILE_MAP_WRITE, 0, 0, size);
+		void *x = w ? MapViewOfFile(h, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, size) : 0;
+		CloseHandle(h); // the views keep the section alive
+		if (x == 0) {
+			if (w) UnmapViewOfFile(w);
+			return false;
+		}
+#elif defined(__APPLE__)
+		void *w = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANON, -1, 0);
+		if (w == MAP_FAILED) return false;
+		mach_vm_address_t target = 0;
+		vm_prot_t cur, max;
+		if (mach_vm_remap(mach_task_self(), &target, size, 0, VM_FLAGS_ANYWHERE, mach_task_self(), (mach_vm_address_t)w, FALSE, &cur, &max, VM_INHERIT_NONE) != KERN_SUCCESS) {
+			munmap(w, size);
+			return false;
+		}
+		void *x = (void*)target;
+		if (mprotect(x, size, PROT_READ | PROT_EXEC) != 0) {
+			munmap(x, size);
+			munmap(w, size);
+			return false;
+		}
+#else
+#if defined(__linux__) && defined(SYS_memfd_create)
+		int fd = (int)syscall(SYS_memfd_create, "xbyak", 1 /* MFD_CLOEXEC */);
+#else
+		char name[64];
+		static unsigned int count = 0;
+		snprintf(name, sizeof(name), "/xbyak.%d.%u", (int)getpid(), ++count);
+		int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (fd >= 0) shm_unlink(name);
+#endif
+		if (fd < 0) return false;
+		void *w = MAP_FAILED, *x = MAP_FAILED;
+		if (ftruncate(fd, size) == 0) {
+			w = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (w != MAP_FAILED) x = mmap(NULL, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+		}
+		close(fd); // the mappings keep the memory alive
+		if (x == MAP_FAILED) {
+			if (w != MAP_FAILED) munmap(w, size);
+			return false;
+		}
+#endif
+		*writeAddr = reinterpret_cast<uint8*>(w);
+		*execAddr = reinterpret_cast<uint8*>(x);
+		return true;
+	}
+	static bool unmapTwice(uint8 *writeAddr, uint8 *execAddr, size_t size)
+	{
+#if defined(_WIN32)
+		(void)size;
+		bool ok = UnmapViewOfFile(execAddr) != 0;
+		return UnmapViewOfFile(writeAddr) != 0 && ok;
+#else
+		bool ok = munmap(execAddr, size) == 0;
+		return munmap(writeAddr, size) == 0 && ok;
+#endif
+	}
+public:
+	DualMapAllocator() {}
+	~DualMapAllocator()
+	{
+		for (MappingList::iterator i = mappingList_.begin(), ie = mappingList_.end(); i != ie; ++i) {
+			unmapTwice(reinterpret_cast<uint8*>(i->first), i->second.execAddr, i->second.size);
+		}
+	}
+	uint8 *alloc(size_t size)
+	{
+		const size_t alignedSizeM1 = inner::ALIGN_PAGE_SIZE - 1;
+		size = ((std::max<size_t>)(size, 1) + alignedSizeM1) & ~alignedSizeM1;
+		Mapping m;
+		uint8 *p;
+		if (!mapTwice(size, &p, &m.execAddr)) throw Error(ERR_CANT_ALLOC);
+		m.size = size;
+		mappingList_[(uintptr_t)p] = m;
+		return p;
+	}
+	void free(uint8 *p)
+	{
+		if (p == 0) return;
+		MappingList::iterator i = mappingList_.find((uintptr_t)p);
+		if (i == mappingList_.end()) throw Error(ERR_BAD_PARAMETER);
+		Mapping m = i->second;
+		mappingList_.erase(i);
+		if (!unmapTwice(p, m.execAddr, m.size)) throw Error(ERR_MUNMAP);
+	}
+	const uint8 *getExecAddr(const uint8 *p) const
+	{
+		MappingList::const_iterator i = mappingList_.find((uintptr_t)p);
+		return i == mappingList_.end() ? p : i->second.execAddr;
+	}
+	bool useProtect() const { return false; }
+};
+#endif
+
 class Operand {
 private:
 	uint8 idx_; // 0..15, MSB = 1 if spl/bpl/sil/dil
@@ -682,6 +1045,11 @@ protected:
 	size_t maxSize_;
 	uint8 *top_;
 	size_t size_;
+	size_t execOffset_; // getCode() - top_, nonzero if the code is executed from another mapping
+	void updateExecOffset()
+	{
+		execOffset_ = type_ == USER_BUF ? 0 : size_t(alloc_->getExecAddr(top_)) - size_t(top_);
+	}
 
 	/*
 		allocate new memory and copy old data to the new area
@@ -695,6 +1063,7 @@ protected:
 		alloc_->free(top_);
 		top_ = newTop;
 		maxSize_ = newSize;
+		updateExecOffset();
 	}
 	/*
 		calc jmp address for AutoGrow mode
@@ -702,7 +1071,7 @@ protected:
 	void calcJmpAddress()
 	{
 		for (AddrInfoList::const_iterator i = addrInfoList_.begin(), ie = addrInfoList_.end(); i != ie; ++i) {
-			uint64 disp = i->getVal(top_);
+			uint64 disp = i->getVal(getCode());
 			rewrite(i->codeOffset, disp, i->jmpSize);
 		}
 		if (alloc_->useProtect() && !protect(top_, size_, true)) throw Error(ERR_CANT_PROTECT);
@@ -714,12 +1083,14 @@ public:
 		, maxSize_(maxSize)
 		, top_(type_ == USER_BUF ? reinterpret_cast<uint8*>(userPtr) : alloc_->alloc((std::max<size_t>)(maxSize, 1)))
 		, size_(0)
+		, execOffset_(0)
 	{
 		if (maxSize_ > 0 && top_ == 0) throw Error(ERR_CANT_ALLOC);
 		if ((type_ == ALLOC_BUF && alloc_->useProtect()) && !protect(top_, maxSize, true)) {
 			alloc_->free(top_);
 			throw Error(ERR_CANT_PROTECT);
 		}
+		updateExecOffset();
 	}
 	virtual ~CodeArray()
 	{
@@ -756,12 +1127,12 @@ public:
 	void dw(uint32 code) { db(code, 2); }
 	void dd(uint32 code) { db(code, 4); }
 	void dq(uint64 code) { db(code, 8); }
-	const uint8 *getCode() const { return top_; }
+	const uint8 *getCode() const { return CastTo<uint8*>(size_t(top_) + execOffset_); }
 	template<class F>
-	const F getCode() const { return CastTo<F>(top_); }
-	const uint8 *getCurr() const { return &top_[size_]; }
+	const F getCode() const { return CastTo<F>(size_t(top_) + execOffset_); }
+	const uint8 *getCurr() const { return CastTo<uint8*>(size_t(top_) + execOffset_ + size_); }
 	template<class F>
-	const F getCurr() const { return CastTo<F>(&top_[size_]); }
+	const F getCurr() const { return CastTo<F>(size_t(top_) + execOffset_ + size_); }
 	size_t getSize() const { return size_; }
 	void setSize(size_t size)
 	{
@@ -1905,7 +2276,7 @@ private:
 				db(uint64(0), jmpSize);
 				save(size_ - jmpSize, offset, jmpSize, inner::LaddTop);
 			} else {
-				db(size_t(top_) + offset, jmpSize);
+				db(size_t(getCode()) + offset, jmpSize);
 			}
 			return;
 		}
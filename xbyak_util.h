@@ -5,6 +5,7 @@
 	utility class and functions for Xbyak
 	Xbyak::util::Clock ; rdtsc timer
 	Xbyak::util::Cpu ; detect CPU
+	Xbyak::util::Profiler ; register generated code with perf/VTune
 	@note this header is UNDER CONSTRUCTION!
 */
 #include "xbyak.h"
@@ -52,6 +53,24 @@
 extern "C" unsigned __int64 __xgetbv(int);
 #endif
 
+/*
+	define XBYAK_USE_PERF (Linux) and/or XBYAK_USE_VTUNE (link with libjitprofiling)
+	to compile in the backends of Xbyak::util::Profiler
+*/
+//#define XBYAK_USE_PERF
+//#define XBYAK_USE_VTUNE
+#if defined(XBYAK_USE_PERF) && defined(__linux__)
+	#include <fcntl.h>
+	#include <string.h>
+	#include <time.h>
+	#include <sys/syscall.h>
+#else
+	#undef XBYAK_USE_PERF
+#endif
+#ifdef XBYAK_USE_VTUNE
+	#include <jitprofiling.h>
+#endif
+
 namespace Xbyak { namespace util {
 
 /**
@@ -164,6 +183,9 @@ public:
 	static const Type tRTM = uint64(1) << 32; // xbegin, xend, xabort
 	static const Type tF16C = uint64(1) << 33; // vcvtph2ps, vcvtps2ph
 	static const Type tMOVBE = uint64(1) << 34; // mobve
+	static const Type tSHA = uint64(1) << 35; // sha1rnds4, sha256rnds2, ...
+	static const Type tAVX512F = uint64(1) << 36; // with the OS saving opmask and zmm state
+	static const Type tAVX512BW = uint64(1) << 37;
 
 	Cpu()
 		: type_(NONE)
@@ -225,6 +247,12 @@ public:
 			if (data[1] & (1U << 20)) type_ |= tSMAP;
 			if (data[1] & (1U << 4)) type_ |= tHLE;
 			if (data[1] & (1U << 11)) type_ |= tRTM;
+			if (data[1] & (1U << 29)) type_ |= tSHA;
+			// check XFEATURE_ENABLED_MASK[7:5] = '111b' as well
+			if ((type_ & tAVX) && (data[1] & (1U << 16)) && (getXfeature() & 0xe0) == 0xe0) {
+				type_ |= tAVX512F;
+				if (data[1] & (1U << 30)) type_ |= tAVX512BW;
+			}
 		}
 		setFamily();
 	}
@@ -274,6 +302,227 @@ private:
 	int count_;
 };
 
+/*
+	tell profilers the name of generated code so that samples in it are not anonymous
+	Profiler prof;
+	prof.init(Profiler::Perf | Profiler::VTune);
+	prof.set("func", code); // after code is finished (ready() for AutoGrow)
+
+	Perf     : append "addr size name" to /tmp/perf-<pid>.map, read by perf report
+	PerfDump : write code load records to /tmp/jit-<pid>.dump for
+	           perf record -k mono ...; perf inject --jit -i perf.data -o perf.jit.data
+	VTune    : notify through the VTune JIT profiling API if VTune is collecting
+	modes whose backend is not compiled in are ignored, and set() of a Profiler
+	without modes is a single comparison.
+	use one Profiler per process; the files are named after the pid only.
+*/
+class Profiler {
+public:
+	enum {
+		None = 0,
+		Perf = 1 << 0,
+		PerfDump = 1 << 1,
+		VTune = 1 << 2
+	};
+	Profiler()
+		: mode_(None)
+#ifdef XBYAK_USE_PERF
+		, mapFp_(0)
+		, dumpFd_(-1)
+		, dumpMarker_(0)
+		, codeIndex_(0)
+#endif
+	{
+	}
+	explicit Profiler(int mode)
+		: mode_(None)
+#ifdef XBYAK_USE_PERF
+		, mapFp_(0)
+		, dumpFd_(-1)
+		, dumpMarker_(0)
+		, codeIndex_(0)
+#endif
+	{
+		init(mode);
+	}
+	~Profiler() { close(); }
+	/*
+		enable mode (bitwise or of Perf, PerfDump, VTune)
+		return enabled modes, which lack those not compiled in or not available
+	*/
+	int init(int mode)
+	{
+		close();
+#ifdef XBYAK_USE_PERF
+		if (mode & Perf) openPerfMap();
+		if (mode & PerfDump) openPerfDump();
+#endif
+#ifdef XBYAK_USE_VTUNE
+		if ((mode & VTune) && iJIT_IsProfilingActive() == iJIT_SAMPLING_ON) mode_ |= VTune;
+#endif
+		(void)mode;
+		return mode_;
+	}
+	int getMode() const { return mode_; }
+	void close()
+	{
+#ifdef XBYAK_USE_PERF
+		if (mapFp_) {
+			fclose(mapFp_);
+			mapFp_ = 0;
+		}
+		closePerfDump();
+#endif
+		mode_ = None;
+	}
+	/*
+		register [addr, addr + size) as funcName
+		the code must not change afterwards since PerfDump takes a copy of it
+	*/
+	void set(const char *funcName, const void *addr, size_t size)
+	{
+		if (mode_ == None || size == 0) return;
+#ifdef XBYAK_USE_PERF
+		if (mode_ & Perf) {
+			fprintf(mapFp_, "%llx %llx %s\n", (unsigned long long)(size_t)addr, (unsigned long long)size, funcName);
+			fflush(mapFp_);
+		}
+		if (mode_ & PerfDump) writeCodeLoad(funcName, addr, size);
+#endif
+#ifdef XBYAK_USE_VTUNE
+		if (mode_ & VTune) {
+			iJIT_Method_Load jmethod = {};
+			jmethod.method_id = iJIT_GetNewMethodID();
+			jmethod.method_name = const_cast<char*>(funcName);
+			jmethod.method_load_address = const_cast<void*>(addr);
+			jmethod.method_size = static_cast<unsigned int>(size);
+			iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, &jmethod);
+		}
+#endif
+		(void)funcName;
+		(void)addr;
+	}
+	void set(const char *funcName, const void *addr, const void *endAddr)
+	{
+		set(funcName, addr, (const char*)endAddr - (const char*)addr);
+	}
+	// register all the code generated so far by code
+	void set(const char *funcName, const Xbyak::CodeArray& code)
+	{
+		set(funcName, code.getCode(), code.getSize());
+	}
+private:
+	Profiler(const Profiler&);
+	void operator=(const Profiler&);
+	int mode_;
+#ifdef XBYAK_USE_PERF
+	FILE *mapFp_;
+	int dumpFd_;
+	void *dumpMarker_;
+	uint64 codeIndex_;
+	static size_t getPageSize()
+	{
+		const long pageSize = sysconf(_SC_PAGESIZE);
+		return pageSize > 0 ? size_t(pageSize) : 4096;
+	}
+	static uint64 getTimestamp()
+	{
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return uint64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+	}
+	bool writeAll(const void *p, size_t size)
+	{
+		const char *q = (const char*)p;
+		while (size > 0) {
+			ssize_t n = ::write(dumpFd_, q, size);
+			if (n <= 0) return false;
+			q += n;
+			size -= n;
+		}
+		return true;
+	}
+	void openPerfMap()
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "/tmp/perf-%d.map", (int)getpid());
+		mapFp_ = fopen(name, "a");
+		if (mapFp_) mode_ |= Perf;
+	}
+	// jitdump format, see tools/perf/Documentation/jitdump-specification.txt in Linux
+	void openPerfDump()
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "/tmp/jit-%d.dump", (int)getpid());
+		dumpFd_ = open(name, O_CREAT | O_TRUNC | O_RDWR, 0666);
+		if (dumpFd_ < 0) return;
+		/*
+			perf finds the dump through this mapping of it in the recorded mmap events,
+			so it has to stay mapped (and executable) while profiling
+		*/
+		dumpMarker_ = mmap(0, getPageSize(), PROT_READ | PROT_EXEC, MAP_PRIVATE, dumpFd_, 0);
+		if (dumpMarker_ == MAP_FAILED) dumpMarker_ = 0;
+		struct {
+			uint32 magic;
+			uint32 version;
+			uint32 totalSize;
+			uint32 elfMach;
+			uint32 pad1;
+			uint32 pid;
+			uint64 timestamp;
+			uint64 flags;
+		} header = {
+			0x4A695444, 1, sizeof(header),
+#ifdef XBYAK64
+			62, // EM_X86_64
+#else
+			3, // EM_386
+#endif
+			0, (uint32)getpid(), getTimestamp(), 0
+		};
+		if (dumpMarker_ == 0 || !writeAll(&header, sizeof(header))) {
+			closePerfDump();
+			return;
+		}
+		mode_ |= PerfDump;
+	}
+	void closePerfDump()
+	{
+		if (dumpMarker_) {
+			munmap(dumpMarker_, getPageSize());
+			dumpMarker_ = 0;
+		}
+		if (dumpFd_ >= 0) {
+			::close(dumpFd_);
+			dumpFd_ = -1;
+		}
+	}
+	void writeCodeLoad(const char *funcName, const void *addr, size_t size)
+	{
+		const size_t nameSize = strlen(funcName) + 1;
+		struct {
+			uint32 id;
+			uint32 totalSize;
+			uint64 timestamp;
+			uint32 pid;
+			uint32 tid;
+			uint64 vma;
+			uint64 codeAddr;
+			uint64 codeSize;
+			uint64 codeIndex;
+		} rec = {
+			0, // JIT_CODE_LOAD
+			uint32(sizeof(rec) + nameSize + size), getTimestamp(),
+			(uint32)getpid(), (uint32)syscall(SYS_gettid),
+			(uint64)(size_t)addr, (uint64)(size_t)addr, (uint64)size, codeIndex_++
+		};
+		writeAll(&rec, sizeof(rec));
+		writeAll(funcName, nameSize);
+		writeAll(addr, size);
+	}
+#endif
+};
+
 #ifdef XBYAK64
 const int UseRCX = 1 << 6;
 const int UseRDX = 1 << 7;